@@ -951,7 +951,7 @@ T* Array<T>::getStorage(bool& deleteIt)
 
   // We need to do a copy
   size_t n = nelements();
-  T* storage = std::allocator<T>().allocate(n);
+  T* storage = arrays_internal::allocateStorage<T>(n);
   try {
     for(size_t i=0; i!=n; ++i)
       new (&storage[i]) T();
@@ -960,7 +960,7 @@ T* Array<T>::getStorage(bool& deleteIt)
     // TODO To be correct, the destructors of the already
     // constructed object should be called, but this is
     // a border case so ignored for now.
-    std::allocator<T>().deallocate(storage, nelements());
+    arrays_internal::deallocateStorage<T>(storage, nelements());
     throw;
   }
   deleteIt = true;
@@ -1023,7 +1023,7 @@ void Array<T>::freeStorage(const T*&storage, bool deleteIt) const
     // TODO this is only allowed when allocator is always equal, but is done for
     // now to keep the method const.
     // see e.g. std::allocator_traits<allocator_type>::is_always_equal
-    std::allocator<T>().deallocate(ptr, n);
+    arrays_internal::deallocateStorage<T>(ptr, n);
   }
   storage = nullptr;
 }
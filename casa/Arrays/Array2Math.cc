@@ -27,10 +27,23 @@
 #include "ArrayError.h"
 #include "Matrix.h"
 
+#include <atomic>
 #include <complex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+static std::atomic<size_t> theArrayMathParallelThreshold(4*1024*1024);
+
+void setArrayMathParallelThreshold (size_t nelements)
+{
+  theArrayMathParallelThreshold = nelements;
+}
+
+size_t arrayMathParallelThreshold()
+{
+  return theArrayMathParallelThreshold;
+}
+
 //# We could use macros to considerably reduce the number of lines, however
 //# that makes it harder to debug, understand, etc.
 
@@ -555,31 +555,42 @@ void ArrayBase::validateIndex (const IPosition& i) const
 			 " and array differ"));
   }
   for (size_t j=0; j < ndim(); j++) {
-    if (i(j) < 0  ||  i(j) >= length_p(j)) {
+    if (size_t(i[j]) >= size_t(length_p[j])) {      // also catches i<0
       throw(ArrayIndexError(i, length_p));
     }
   }
   // OK - normal return
 }
 
+// The fixed-rank versions check the indices directly and only create an
+// IPosition if an error has to be reported.
 void ArrayBase::validateIndex (size_t index) const
 {
-  validateIndex (IPosition(1, index));
+  if (ndim() != 1  ||  index >= size_t(length_p[0])) {
+    validateIndex (IPosition(1, index));
+  }
 }
 void ArrayBase::validateIndex (size_t index1, size_t index2) const
 {
-  IPosition inx(2);
-  inx[0] = index1;
-  inx[1] = index2;
-  validateIndex (inx);
+  if (ndim() != 2  ||  index1 >= size_t(length_p[0])
+                   ||  index2 >= size_t(length_p[1])) {
+    IPosition inx(2);
+    inx[0] = index1;
+    inx[1] = index2;
+    validateIndex (inx);
+  }
 }
 void ArrayBase::validateIndex (size_t index1, size_t index2, size_t index3) const
 {
-  IPosition inx(3);
-  inx[0] = index1;
-  inx[1] = index2;
-  inx[2] = index3;
-  validateIndex (inx);
+  if (ndim() != 3  ||  index1 >= size_t(length_p[0])
+                   ||  index2 >= size_t(length_p[1])
+                   ||  index3 >= size_t(length_p[2])) {
+    IPosition inx(3);
+    inx[0] = index1;
+    inx[1] = index2;
+    inx[2] = index3;
+    validateIndex (inx);
+  }
 }
 
 bool ArrayBase::copyVectorHelper (const ArrayBase& other)
@@ -0,0 +1,353 @@
+//# ArrayExpr.h: Lazy element-wise expressions of Arrays
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_ARRAYEXPR_2_H
+#define CASA_ARRAYEXPR_2_H
+
+#include "Array.h"
+#include "ArrayBase.h"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <utility>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+//    Lazy element-wise expressions of Arrays.
+// </summary>
+// <reviewed reviewer="" date="" tests="tArrayExpr">
+//
+// <prerequisite>
+//   <li> <linkto class=Array>Array</linkto>
+//   <li> <linkto group="ArrayMath.h#Array mathematical operations">ArrayMath</linkto>
+// </prerequisite>
+//
+// <synopsis>
+// The operators and functions in ArrayMath.h create a new result Array
+// for each operation, so an expression like <src>a*b + c*d</src> creates
+// three temporary arrays and makes four passes over memory.
+// <br>The classes and functions in this file form an opt-in layer of
+// expression templates. An expression is started by wrapping an Array
+// (or Vector, Matrix, Cube) with the function <src>arrayExpr</src>.
+// Combining it with other expressions, arrays or scalars using the
+// operators +, -, *, / and the functions sqrt, square, exp, log, sin, cos,
+// abs, amplitude, real, and imag creates a lazy expression tree without
+// evaluating anything. The expression is evaluated in a single loop when
+// it is assigned to an array using <src>arrayExprAssign</src>, converted
+// to a new array using its <src>evaluate</src> function, or summed using
+// <src>sum</src>.
+// <br>The shapes of the array operands are checked when the expression is
+// built; an ArrayConformanceError is thrown if they differ.
+// <br>Operands are kept by (reference counted) value, so an expression can
+// safely be kept in a variable. A non-contiguous operand is copied once
+// into a contiguous array when it is wrapped.
+// Because all operations are element-wise, the result array can also be
+// one of the operands.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   Cube<Complex> a(shp), b(shp), c(shp), d(shp), res;
+//      . . .
+//   arrayExprAssign (res, arrayExpr(a)*b + arrayExpr(c)*d);
+//   Cube<Float> amp = amplitude(arrayExpr(a) - b).evaluate();
+// </srcblock>
+// </example>
+//
+// <motivation>
+// Reduce memory traffic and allocations when evaluating arithmetic
+// expressions on large arrays such as visibility cubes.
+// </motivation>
+//
+// <group name="Array expression templates">
+
+
+template<typename E> class ArrayExprBase;
+template<typename T, typename E>
+void arrayExprAssign (Array<T>& result, const ArrayExprBase<E>& expr);
+
+// Base class of all array expression nodes (using CRTP).
+// A node defines its <src>value_type</src>, the <src>shape()</src>
+// (empty for a scalar), and <src>operator[]</src> giving the i-th element
+// in the (contiguous) storage order.
+template<typename E>
+class ArrayExprBase
+{
+public:
+  const E& self() const
+    { return static_cast<const E&>(*this); }
+
+  // Evaluate the expression into a new contiguous array.
+  template<typename U=E>
+  Array<typename U::value_type> evaluate() const
+  {
+    Array<typename U::value_type> result;
+    arrayExprAssign (result, *this);
+    return result;
+  }
+};
+
+// Leaf node wrapping an Array.
+template<typename T>
+class ArrayExprLeaf : public ArrayExprBase<ArrayExprLeaf<T>>
+{
+public:
+  typedef T value_type;
+  explicit ArrayExprLeaf (const Array<T>& arr)
+    : itsArray (arr.contiguousStorage()  ?  arr : arr.copy()),
+      itsData  (itsArray.data())
+  {}
+  const IPosition& shape() const
+    { return itsArray.shape(); }
+  const T& operator[] (size_t i) const
+    { return itsData[i]; }
+private:
+  Array<T> itsArray;
+  const T* itsData;
+};
+
+// Leaf node holding a scalar.
+template<typename T>
+class ArrayExprScalar : public ArrayExprBase<ArrayExprScalar<T>>
+{
+public:
+  typedef T value_type;
+  explicit ArrayExprScalar (const T& value)
+    : itsValue (value)
+  {}
+  const IPosition& shape() const
+    { return itsShape; }
+  const T& operator[] (size_t) const
+    { return itsValue; }
+private:
+  T         itsValue;
+  IPosition itsShape;
+};
+
+// Node applying a binary operator to two nodes.
+template<typename Op, typename L, typename R>
+class ArrayExprBinary : public ArrayExprBase<ArrayExprBinary<Op,L,R>>
+{
+public:
+  typedef decltype(Op()(std::declval<typename L::value_type>(),
+                        std::declval<typename R::value_type>())) value_type;
+  ArrayExprBinary (const L& left, const R& right, const char* name)
+    : itsLeft (left),
+      itsRight (right)
+  {
+    if (left.shape().empty()) {
+      itsShape = right.shape();
+    } else {
+      itsShape = left.shape();
+      if (! right.shape().empty()  &&  ! left.shape().isEqual(right.shape())) {
+        throwArrayShapes (left.shape(), right.shape(), name);
+      }
+    }
+  }
+  const IPosition& shape() const
+    { return itsShape; }
+  value_type operator[] (size_t i) const
+    { return Op()(itsLeft[i], itsRight[i]); }
+private:
+  L         itsLeft;
+  R         itsRight;
+  IPosition itsShape;
+};
+
+// Node applying a unary operator to a node.
+template<typename Op, typename E>
+class ArrayExprUnary : public ArrayExprBase<ArrayExprUnary<Op,E>>
+{
+public:
+  typedef decltype(Op()(std::declval<typename E::value_type>())) value_type;
+  explicit ArrayExprUnary (const E& expr)
+    : itsExpr (expr)
+  {}
+  const IPosition& shape() const
+    { return itsExpr.shape(); }
+  value_type operator[] (size_t i) const
+    { return Op()(itsExpr[i]); }
+private:
+  E itsExpr;
+};
+
+
+// Functors used in the expression nodes.
+// <group>
+struct ArrayExprPlus
+{ template<typename A, typename B> auto operator() (const A& a, const B& b)
+    const -> decltype(a+b) { return a+b; } };
+struct ArrayExprMinus
+{ template<typename A, typename B> auto operator() (const A& a, const B& b)
+    const -> decltype(a-b) { return a-b; } };
+struct ArrayExprTimes
+{ template<typename A, typename B> auto operator() (const A& a, const B& b)
+    const -> decltype(a*b) { return a*b; } };
+struct ArrayExprDivide
+{ template<typename A, typename B> auto operator() (const A& a, const B& b)
+    const -> decltype(a/b) { return a/b; } };
+struct ArrayExprNegate
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(-a) { return -a; } };
+struct ArrayExprSquare
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(a*a) { return a*a; } };
+struct ArrayExprSqrt
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(std::sqrt(a)) { return std::sqrt(a); } };
+struct ArrayExprExp
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(std::exp(a)) { return std::exp(a); } };
+struct ArrayExprLog
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(std::log(a)) { return std::log(a); } };
+struct ArrayExprSin
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(std::sin(a)) { return std::sin(a); } };
+struct ArrayExprCos
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(std::cos(a)) { return std::cos(a); } };
+struct ArrayExprAbs
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(std::abs(a)) { return std::abs(a); } };
+struct ArrayExprReal
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(std::real(a)) { return std::real(a); } };
+struct ArrayExprImag
+{ template<typename A> auto operator() (const A& a)
+    const -> decltype(std::imag(a)) { return std::imag(a); } };
+// </group>
+
+
+// Start an expression by wrapping an Array (or Vector, Matrix, Cube).
+template<typename T>
+inline ArrayExprLeaf<T> arrayExpr (const Array<T>& arr)
+  { return ArrayExprLeaf<T>(arr); }
+
+// Define the binary operators for all combinations of expressions with
+// expressions, arrays and scalars. A scalar must have the value type of
+// the expression (or be convertible to it).
+#define CASA_ARRAYEXPR_BINOP(OPER, OP, NAME) \
+template<typename L, typename R> \
+inline ArrayExprBinary<OP,L,R> \
+OPER (const ArrayExprBase<L>& left, const ArrayExprBase<R>& right) \
+  { return ArrayExprBinary<OP,L,R> (left.self(), right.self(), NAME); } \
+template<typename L, typename T> \
+inline ArrayExprBinary<OP,L,ArrayExprLeaf<T>> \
+OPER (const ArrayExprBase<L>& left, const Array<T>& right) \
+  { return ArrayExprBinary<OP,L,ArrayExprLeaf<T>> \
+      (left.self(), ArrayExprLeaf<T>(right), NAME); } \
+template<typename T, typename R> \
+inline ArrayExprBinary<OP,ArrayExprLeaf<T>,R> \
+OPER (const Array<T>& left, const ArrayExprBase<R>& right) \
+  { return ArrayExprBinary<OP,ArrayExprLeaf<T>,R> \
+      (ArrayExprLeaf<T>(left), right.self(), NAME); } \
+template<typename L> \
+inline ArrayExprBinary<OP,L,ArrayExprScalar<typename L::value_type>> \
+OPER (const ArrayExprBase<L>& left, const typename L::value_type& right) \
+  { return ArrayExprBinary<OP,L,ArrayExprScalar<typename L::value_type>> \
+      (left.self(), ArrayExprScalar<typename L::value_type>(right), NAME); } \
+template<typename R> \
+inline ArrayExprBinary<OP,ArrayExprScalar<typename R::value_type>,R> \
+OPER (const typename R::value_type& left, const ArrayExprBase<R>& right) \
+  { return ArrayExprBinary<OP,ArrayExprScalar<typename R::value_type>,R> \
+      (ArrayExprScalar<typename R::value_type>(left), right.self(), NAME); }
+
+CASA_ARRAYEXPR_BINOP(operator+, ArrayExprPlus,   "+")
+CASA_ARRAYEXPR_BINOP(operator-, ArrayExprMinus,  "-")
+CASA_ARRAYEXPR_BINOP(operator*, ArrayExprTimes,  "*")
+CASA_ARRAYEXPR_BINOP(operator/, ArrayExprDivide, "/")
+
+#undef CASA_ARRAYEXPR_BINOP
+
+// Define the unary operator and functions.
+#define CASA_ARRAYEXPR_UNOP(FUNC, OP) \
+template<typename E> \
+inline ArrayExprUnary<OP,E> FUNC (const ArrayExprBase<E>& expr) \
+  { return ArrayExprUnary<OP,E> (expr.self()); }
+
+CASA_ARRAYEXPR_UNOP(operator-, ArrayExprNegate)
+CASA_ARRAYEXPR_UNOP(square,    ArrayExprSquare)
+CASA_ARRAYEXPR_UNOP(sqrt,      ArrayExprSqrt)
+CASA_ARRAYEXPR_UNOP(exp,       ArrayExprExp)
+CASA_ARRAYEXPR_UNOP(log,       ArrayExprLog)
+CASA_ARRAYEXPR_UNOP(sin,       ArrayExprSin)
+CASA_ARRAYEXPR_UNOP(cos,       ArrayExprCos)
+CASA_ARRAYEXPR_UNOP(abs,       ArrayExprAbs)
+CASA_ARRAYEXPR_UNOP(amplitude, ArrayExprAbs)
+CASA_ARRAYEXPR_UNOP(real,      ArrayExprReal)
+CASA_ARRAYEXPR_UNOP(imag,      ArrayExprImag)
+
+#undef CASA_ARRAYEXPR_UNOP
+
+
+// Evaluate the expression into the result array in a single loop.
+// If the result array is empty, it is resized to the shape of the
+// expression. Otherwise the shapes must conform.
+// An expression consisting of scalars only requires a non-empty result,
+// which is filled with the value.
+template<typename T, typename E>
+void arrayExprAssign (Array<T>& result, const ArrayExprBase<E>& expr)
+{
+  const E& e = expr.self();
+  if (result.empty()) {
+    result.resize (e.shape());
+  } else if (! e.shape().empty()  &&  ! result.shape().isEqual(e.shape())) {
+    throwArrayShapes (result.shape(), e.shape(), "arrayExprAssign");
+  }
+  size_t n = result.nelements();
+  if (result.contiguousStorage()) {
+    T* data = result.data();
+    for (size_t i=0; i<n; ++i) {
+      data[i] = e[i];
+    }
+  } else {
+    typename Array<T>::iterator iter = result.begin();
+    for (size_t i=0; i<n; ++i, ++iter) {
+      *iter = e[i];
+    }
+  }
+}
+
+// Sum the elements of an expression without creating a temporary array.
+template<typename E>
+typename E::value_type sum (const ArrayExprBase<E>& expr)
+{
+  const E& e = expr.self();
+  size_t n = e.shape().product();
+  typename E::value_type result = typename E::value_type();
+  for (size_t i=0; i<n; ++i) {
+    result += e[i];
+  }
+  return result;
+}
+
+// </group>
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef ARRAY2_ARRAY_FWD_H
 #define ARRAY2_ARRAY_FWD_H
 
+#include <cstddef>
 #include <memory>
 
 namespace casacore { //#Begin casa namespace
@@ -16,6 +17,7 @@ typedef MaskedArray<LogicalArrayElem> MaskedLogicalArray;
 class Slice;
 class Slicer;
 template<typename T> class ArrayIterator;
+template<typename T, size_t N> class ArrayView;
 
 }
 
@@ -27,6 +27,7 @@
 #define CASA_ARRAYMATH_2_H
 
 #include "Array.h"
+#include "ArrayMathKernels.h"
 
 #include <algorithm>
 #include <cassert>
@@ -173,6 +174,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // </group>
 
 
+// Set or get the minimum nr of elements for which the transform functions
+// on contiguous arrays and the reductions sum, sumsqr, mean, and minMax
+// use multiple threads. Each thread handles a contiguous chunk of the array.
+// It is only done if casacore is built with OpenMP; the nr of threads can
+// be set using <src>OMP::setNumThreads</src>. A value of 0 means that
+// single-threaded execution is always used. The default is 4M elements.
+// <br>Note that the operator used in a transform function must be
+// thread-safe if multiple threads are used.
+// <group>
+void setArrayMathParallelThreshold (size_t nelements);
+size_t arrayMathParallelThreshold();
+// </group>
+
 // Functions to apply a binary or unary operator to arrays.
 // They are modeled after std::transform.
 // They do not check if the shapes conform; as in std::transform the
@@ -186,8 +200,14 @@ inline void arrayContTransform (const Array<L>& left, const Array<R>& right,
 {
   assert (result.contiguousStorage());
   if (left.contiguousStorage()  &&  right.contiguousStorage()) {
-    std::transform (left.cbegin(), left.cend(), right.cbegin(),
-                    result.cbegin(), op);
+    const L* l = left.data();
+    const R* r = right.data();
+    RES* res = result.data();
+    size_t n = left.nelements();
+    arrays_internal::parallelChunks
+      (n, arrays_internal::parallelNChunk(n),
+       [&](size_t, size_t st, size_t len)
+       { std::transform (l+st, l+st+len, r+st, res+st, op); });
   } else {
     std::transform (left.begin(), left.end(), right.begin(),
                     result.cbegin(), op);
@@ -202,8 +222,13 @@ inline void arrayContTransform (const Array<L>& left, R right,
 {
   assert (result.contiguousStorage());
   if (left.contiguousStorage()) {
-    myrtransform (left.cbegin(), left.cend(),
-                 result.cbegin(), right, op);
+    const L* l = left.data();
+    RES* res = result.data();
+    size_t n = left.nelements();
+    arrays_internal::parallelChunks
+      (n, arrays_internal::parallelNChunk(n),
+       [&](size_t, size_t st, size_t len)
+       { myrtransform (l+st, l+st+len, res+st, right, op); });
     ////    std::transform (left.cbegin(), left.cend(),
     ////                    result.cbegin(), bind2nd(op, right));
   } else {
@@ -222,8 +247,13 @@ inline void arrayContTransform (L left, const Array<R>& right,
 {
   assert (result.contiguousStorage());
   if (right.contiguousStorage()) {
-    myltransform (right.cbegin(), right.cend(),
-                  result.cbegin(), left, op);
+    const R* r = right.data();
+    RES* res = result.data();
+    size_t n = right.nelements();
+    arrays_internal::parallelChunks
+      (n, arrays_internal::parallelNChunk(n),
+       [&](size_t, size_t st, size_t len)
+       { myltransform (r+st, r+st+len, res+st, left, op); });
     ////    std::transform (right.cbegin(), right.cend(),
     ////                    result.cbegin(), bind1st(op, left));
   } else {
@@ -242,7 +272,13 @@ inline void arrayContTransform (const Array<T>& arr,
 {
   assert (result.contiguousStorage());
   if (arr.contiguousStorage()) {
-    std::transform (arr.cbegin(), arr.cend(), result.cbegin(), op);
+    const T* a = arr.data();
+    RES* res = result.data();
+    size_t n = arr.nelements();
+    arrays_internal::parallelChunks
+      (n, arrays_internal::parallelNChunk(n),
+       [&](size_t, size_t st, size_t len)
+       { std::transform (a+st, a+st+len, res+st, op); });
   } else {
     std::transform (arr.begin(), arr.end(), result.cbegin(), op);
   }
@@ -300,7 +336,13 @@ inline void arrayTransformInPlace (Array<L>& left, const Array<R>& right,
                                    BinaryOperator op)
 {
   if (left.contiguousStorage()  &&  right.contiguousStorage()) {
-    std::transform(left.cbegin(), left.cend(), right.cbegin(), left.cbegin(), op);
+    L* l = left.data();
+    const R* r = right.data();
+    size_t n = left.nelements();
+    arrays_internal::parallelChunks
+      (n, arrays_internal::parallelNChunk(n),
+       [&](size_t, size_t st, size_t len)
+       { std::transform (l+st, l+st+len, r+st, l+st, op); });
   } else {
     std::transform(left.begin(), left.end(), right.begin(), left.begin(), op);
   }
@@ -312,7 +354,12 @@ template<typename L, typename R, typename BinaryOperator>
 inline void arrayTransformInPlace (Array<L>& left, R right, BinaryOperator op)
 {
   if (left.contiguousStorage()) {
-    myiptransform (left.cbegin(), left.cend(), right, op);
+    L* l = left.data();
+    size_t n = left.nelements();
+    arrays_internal::parallelChunks
+      (n, arrays_internal::parallelNChunk(n),
+       [&](size_t, size_t st, size_t len)
+       { myiptransform (l+st, l+st+len, right, op); });
     ////    transformInPlace (left.cbegin(), left.cend(), bind2nd(op, right));
   } else {
     myiptransform (left.begin(), left.end(), right, op);
@@ -327,7 +374,12 @@ template<typename T, typename UnaryOperator>
 inline void arrayTransformInPlace (Array<T>& arr, UnaryOperator op)
 {
   if (arr.contiguousStorage()) {
-    std::transform(arr.cbegin(), arr.cend(), arr.cbegin(), op);
+    T* a = arr.data();
+    size_t n = arr.nelements();
+    arrays_internal::parallelChunks
+      (n, arrays_internal::parallelNChunk(n),
+       [&](size_t, size_t st, size_t len)
+       { std::transform (a+st, a+st+len, a+st, op); });
   } else {
     std::transform(arr.begin(), arr.end(), arr.begin(), op);
   }
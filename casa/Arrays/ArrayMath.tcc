@@ -34,6 +34,7 @@
 #include "VectorIter.h"
 #include "ArrayError.h"
 #include "ElementFunctions.h"
+#include "ArrayMathKernels.h"
 
 #include <algorithm>
 #include <cassert>
@@ -598,22 +599,10 @@ template<typename T> void minMax(T &minVal, T &maxVal, const Array<T> &array)
                      "Array has no elements"));	
   }
   if (array.contiguousStorage()) {
-    // minimal scope as some compilers may spill onto stack otherwise
-    T minv = array.data()[0];
-    T maxv = minv;
-    typename Array<T>::const_contiter iterEnd = array.cend();
-    for (typename Array<T>::const_contiter iter = array.cbegin();
-         iter!=iterEnd; ++iter) {
-      if (*iter < minv) {
-        minv = *iter;
-      }
-      // no else allows compiler to use branchless instructions
-      if (*iter > maxv) {
-        maxv = *iter;
-      }
-    }
-    maxVal = maxv;
-    minVal = minv;
+    arrays_internal::contMinMax
+      (minVal, maxVal, array.data(), array.nelements(),
+       std::integral_constant<bool, std::is_arithmetic<T>::value  &&
+                                    !std::is_same<T,bool>::value>());
   } else {
     T minv = array.data()[0];
     T maxv = minv;
@@ -916,7 +905,8 @@ template<typename T> Array<T> floormod(const Array<T> &a, const T &b)
 template<typename T> T sum(const Array<T> &a)
 {
   return a.contiguousStorage() ?
-    std::accumulate(a.cbegin(), a.cend(), T(), std::plus<T>()) :
+    arrays_internal::contSum (a.data(), a.nelements(),
+                              arrays_internal::UseLaneKernel<T>()) :
     std::accumulate(a.begin(),  a.end(),  T(), std::plus<T>());
 }
 
@@ -924,7 +914,8 @@ template<typename T> T sumsqr(const Array<T> &a)
 {
   auto sumsqr = [](T left, T right) { return left + right*right;};
   return a.contiguousStorage() ?
-    std::accumulate(a.cbegin(), a.cend(), T(), sumsqr) :
+    arrays_internal::contSumSqr (a.data(), a.nelements(),
+                                 arrays_internal::UseLaneKernel<T>()) :
     std::accumulate(a.begin(),  a.end(),  T(), sumsqr);
 }
 
@@ -0,0 +1,314 @@
+#ifndef CASACORE_ARRAYMATHKERNELS_2_H
+#define CASACORE_ARRAYMATHKERNELS_2_H
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace casacore {
+
+// Get the minimum nr of elements for multi-threaded array math
+// (see ArrayMath.h).
+size_t arrayMathParallelThreshold();
+
+namespace arrays_internal {
+
+// Get the nr of chunks to split an operation on n contiguous elements into.
+// It is the max nr of OpenMP threads if n exceeds the threshold and if not
+// already in a parallel region; otherwise it is 1.
+inline size_t parallelNChunk (size_t n)
+{
+#ifdef _OPENMP
+  size_t threshold = arrayMathParallelThreshold();
+  int nthr = omp_get_max_threads();
+  if (threshold > 0  &&  n >= threshold  &&  nthr > 1  &&  !omp_in_parallel()) {
+    return nthr;
+  }
+#else
+  (void)n;
+#endif
+  return 1;
+}
+
+// Execute func(chunkNr, start, length) for each of the nchunk chunks
+// of n elements. The chunks are executed in parallel using OpenMP.
+// An exception thrown in a chunk is rethrown after all chunks are done.
+template<typename Func>
+inline void parallelChunks (size_t n, size_t nchunk, Func func)
+{
+  if (nchunk <= 1) {
+    func (0, 0, n);
+    return;
+  }
+  size_t chunk = (n + nchunk - 1) / nchunk;
+  std::vector<std::exception_ptr> errors(nchunk);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nchunk) schedule(static)
+#endif
+  for (long long c=0; c<(long long)nchunk; ++c) {
+    size_t st = c*chunk;
+    if (st < n) {
+      try {
+        func (c, st, std::min (chunk, n-st));
+      } catch (...) {
+        errors[c] = std::current_exception();
+      }
+    }
+  }
+  for (const auto& err : errors) {
+    if (err) {
+      std::rethrow_exception (err);
+    }
+  }
+}
+
+// The reduction kernels below work on contiguous data using a number of
+// independent accumulators (lanes). Unlike a single running sum, the lanes
+// do not depend on each other, so the compiler can keep them in SIMD
+// registers without needing -ffast-math. The lanes are combined at the end,
+// so the result of a floating point sum can differ in rounding from a
+// sequential sum (it is usually more accurate).
+// Only arithmetic (but not bool) and complex types use the kernels, because
+// for other types (e.g. String) the order of summation matters.
+
+template<typename T>
+struct UseLaneKernel
+  : std::integral_constant<bool, std::is_arithmetic<T>::value  &&
+                                 !std::is_same<T,bool>::value> {};
+template<typename T>
+struct UseLaneKernel<std::complex<T>> : UseLaneKernel<T> {};
+
+constexpr size_t laneKernelWidth = 8;
+
+// Sum of the n values in data.
+template<typename T>
+inline T laneSum (const T* data, size_t n)
+{
+  T lane[laneKernelWidth];
+  for (size_t j=0; j<laneKernelWidth; ++j) {
+    lane[j] = T();
+  }
+  size_t i = 0;
+  for (; i+laneKernelWidth <= n; i+=laneKernelWidth) {
+    for (size_t j=0; j<laneKernelWidth; ++j) {
+      lane[j] += data[i+j];
+    }
+  }
+  T sum = T();
+  for (size_t j=0; j<laneKernelWidth; ++j) {
+    sum += lane[j];
+  }
+  for (; i<n; ++i) {
+    sum += data[i];
+  }
+  return sum;
+}
+
+// Sum of the squares of the n values in data.
+template<typename T>
+inline T laneSumSqr (const T* data, size_t n)
+{
+  T lane[laneKernelWidth];
+  for (size_t j=0; j<laneKernelWidth; ++j) {
+    lane[j] = T();
+  }
+  size_t i = 0;
+  for (; i+laneKernelWidth <= n; i+=laneKernelWidth) {
+    for (size_t j=0; j<laneKernelWidth; ++j) {
+      lane[j] += data[i+j] * data[i+j];
+    }
+  }
+  T sum = T();
+  for (size_t j=0; j<laneKernelWidth; ++j) {
+    sum += lane[j];
+  }
+  for (; i<n; ++i) {
+    sum += data[i] * data[i];
+  }
+  return sum;
+}
+
+// Sum (of the squares if SQR) of the n values in data with a false mask
+// value. The number of those values is added to nvalid.
+// The mask is applied by selecting zero instead of branching, so the
+// loop can be vectorized.
+template<bool SQR, typename T>
+inline T laneMaskedSum (const T* data, const bool* mask, size_t n,
+                        size_t& nvalid)
+{
+  T lane[laneKernelWidth];
+  size_t cnt[laneKernelWidth];
+  for (size_t j=0; j<laneKernelWidth; ++j) {
+    lane[j] = T();
+    cnt[j]  = 0;
+  }
+  size_t i = 0;
+  for (; i+laneKernelWidth <= n; i+=laneKernelWidth) {
+    for (size_t j=0; j<laneKernelWidth; ++j) {
+      const T v = mask[i+j]  ?  T() : data[i+j];
+      lane[j] += SQR  ?  v*v : v;
+      cnt[j]  += !mask[i+j];
+    }
+  }
+  T sum = T();
+  for (size_t j=0; j<laneKernelWidth; ++j) {
+    sum    += lane[j];
+    nvalid += cnt[j];
+  }
+  for (; i<n; ++i) {
+    if (!mask[i]) {
+      sum += SQR  ?  data[i]*data[i] : data[i];
+      ++nvalid;
+    }
+  }
+  return sum;
+}
+
+// Minimum and maximum of the n values in data, starting with the
+// initial value.
+// As in the scalar loop, NaN values are ignored unless init is NaN.
+template<typename T>
+inline void laneMinMax (T& minVal, T& maxVal, const T* data, size_t n,
+                        const T& init)
+{
+  T lmin[laneKernelWidth];
+  T lmax[laneKernelWidth];
+  for (size_t j=0; j<laneKernelWidth; ++j) {
+    lmin[j] = lmax[j] = init;
+  }
+  size_t i = 0;
+  for (; i+laneKernelWidth <= n; i+=laneKernelWidth) {
+    for (size_t j=0; j<laneKernelWidth; ++j) {
+      const T v = data[i+j];
+      lmin[j] = v < lmin[j]  ?  v : lmin[j];
+      lmax[j] = v > lmax[j]  ?  v : lmax[j];
+    }
+  }
+  for (; i<n; ++i) {
+    const T v = data[i];
+    lmin[0] = v < lmin[0]  ?  v : lmin[0];
+    lmax[0] = v > lmax[0]  ?  v : lmax[0];
+  }
+  T minv = lmin[0];
+  T maxv = lmax[0];
+  for (size_t j=1; j<laneKernelWidth; ++j) {
+    minv = lmin[j] < minv  ?  lmin[j] : minv;
+    maxv = lmax[j] > maxv  ?  lmax[j] : maxv;
+  }
+  minVal = minv;
+  maxVal = maxv;
+}
+
+// Dispatch to a lane kernel or to a plain sequential loop.
+// The lane kernels are applied in parallel on large arrays.
+// <group>
+template<typename T>
+inline T contSum (const T* data, size_t n, std::true_type)
+{
+  size_t nchunk = parallelNChunk (n);
+  if (nchunk <= 1) {
+    return laneSum (data, n);
+  }
+  std::vector<T> part(nchunk, T());
+  parallelChunks (n, nchunk, [&](size_t c, size_t st, size_t len)
+                  { part[c] = laneSum (data+st, len); });
+  T sum = T();
+  for (const T& v : part) {
+    sum += v;
+  }
+  return sum;
+}
+template<typename T>
+inline T contSum (const T* data, size_t n, std::false_type)
+{
+  T sum = T();
+  for (size_t i=0; i<n; ++i) {
+    sum = sum + data[i];
+  }
+  return sum;
+}
+template<typename T>
+inline T contSumSqr (const T* data, size_t n, std::true_type)
+{
+  size_t nchunk = parallelNChunk (n);
+  if (nchunk <= 1) {
+    return laneSumSqr (data, n);
+  }
+  std::vector<T> part(nchunk, T());
+  parallelChunks (n, nchunk, [&](size_t c, size_t st, size_t len)
+                  { part[c] = laneSumSqr (data+st, len); });
+  T sum = T();
+  for (const T& v : part) {
+    sum += v;
+  }
+  return sum;
+}
+template<typename T>
+inline T contSumSqr (const T* data, size_t n, std::false_type)
+{
+  T sum = T();
+  for (size_t i=0; i<n; ++i) {
+    sum = sum + data[i]*data[i];
+  }
+  return sum;
+}
+template<typename T>
+inline void contAddSum (T& result, const T* data, size_t n, std::true_type)
+  { result += laneSum (data, n); }
+template<typename T>
+inline void contAddSum (T& result, const T* data, size_t n, std::false_type)
+{
+  T tmp = result;
+  for (size_t i=0; i<n; ++i) {
+    tmp += data[i];
+  }
+  result = tmp;
+}
+template<typename T>
+inline void contMinMax (T& minVal, T& maxVal, const T* data, size_t n,
+                        std::true_type)
+{
+  size_t nchunk = parallelNChunk (n);
+  if (nchunk <= 1) {
+    laneMinMax (minVal, maxVal, data, n, data[0]);
+    return;
+  }
+  // All chunks start with the first value, so NaNs are handled as in the
+  // sequential case.
+  std::vector<T> pmin(nchunk, data[0]);
+  std::vector<T> pmax(nchunk, data[0]);
+  parallelChunks (n, nchunk, [&](size_t c, size_t st, size_t len)
+                  { laneMinMax (pmin[c], pmax[c], data+st, len, data[0]); });
+  T dummy;
+  laneMinMax (minVal, dummy, pmin.data(), nchunk, data[0]);
+  laneMinMax (dummy, maxVal, pmax.data(), nchunk, data[0]);
+}
+template<typename T>
+inline void contMinMax (T& minVal, T& maxVal, const T* data, size_t n,
+                        std::false_type)
+{
+  T minv = data[0];
+  T maxv = minv;
+  for (size_t i=0; i<n; ++i) {
+    if (data[i] < minv) {
+      minv = data[i];
+    }
+    if (data[i] > maxv) {
+      maxv = data[i];
+    }
+  }
+  minVal = minv;
+  maxVal = maxv;
+}
+// </group>
+
+} }
+
+#endif
@@ -26,6 +26,7 @@
 #include "ArrayPartMath.h"
 #include "ArrayIter.h"
 #include "ArrayError.h"
+#include "ArrayMathKernels.h"
 
 #include <cassert>
 #include <complex>
@@ -71,11 +72,9 @@ template<typename T> Array<T> partialSums (const Array<T>& array,
   IPosition pos(ndim, 0);
   while (true) {
     if (cont) {
-      T tmp = *res;
-      for (size_t i=0; i<n0; i++) {
-	tmp += *data++;
-      }
-      *res = tmp;
+      arrays_internal::contAddSum (*res, data, n0,
+                                   arrays_internal::UseLaneKernel<T>());
+      data += n0;
     } else {
       for (size_t i=0; i<n0; i++) {
 	*res += *data++;
@@ -0,0 +1,173 @@
+//# ArrayPool.cc: Thread-local pool of Array data buffers
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include "ArrayPool.h"
+#include "../OS/MemorySampler.h"
+#include "../OS/NumaMemory.h"
+
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+
+  // The pool state of a thread.
+  struct PoolState
+  {
+    size_t maxBytes = 0;     // 0 means disabled
+    size_t cached   = 0;
+    std::unordered_map<size_t, std::vector<void*>> buffers;
+
+    void release()
+    {
+      for (auto& bucket : buffers) {
+        for (void* ptr : bucket.second) {
+          ::operator delete (ptr);
+        }
+      }
+      buffers.clear();
+      cached = 0;
+    }
+  };
+
+  // A plain pointer is used for the state, so it can still be tested after
+  // the thread-local guard has been destructed at thread exit (e.g. when a
+  // static Array is destructed thereafter).
+  thread_local PoolState* theState = nullptr;
+
+  struct PoolStateGuard
+  {
+    ~PoolStateGuard()
+    {
+      if (theState) {
+        theState->release();
+        delete theState;
+        theState = nullptr;
+      }
+    }
+  };
+  thread_local PoolStateGuard theGuard;
+
+  PoolState& getState()
+  {
+    if (! theState) {
+      (void)&theGuard;     // make sure the guard gets constructed
+      theState = new PoolState();
+    }
+    return *theState;
+  }
+
+} //# end anonymous namespace
+
+
+void ArrayPool::enable (size_t maxCacheBytes)
+{
+  PoolState& state = getState();
+  state.maxBytes = maxCacheBytes;
+  if (state.cached > maxCacheBytes) {
+    state.release();
+  }
+}
+
+void ArrayPool::disable()
+{
+  if (theState) {
+    theState->release();
+    theState->maxBytes = 0;
+  }
+}
+
+bool ArrayPool::isEnabled()
+{
+  return theState  &&  theState->maxBytes > 0;
+}
+
+size_t ArrayPool::maxCacheBytes()
+{
+  return theState ? theState->maxBytes : 0;
+}
+
+size_t ArrayPool::cachedBytes()
+{
+  return theState ? theState->cached : 0;
+}
+
+void ArrayPool::release()
+{
+  if (theState) {
+    theState->release();
+  }
+}
+
+void* ArrayPool::allocate (size_t nbytes)
+{
+  PoolState* state = theState;
+  if (state  &&  state->cached > 0) {
+    auto iter = state->buffers.find (nbytes);
+    if (iter != state->buffers.end()  &&  ! iter->second.empty()) {
+      void* ptr = iter->second.back();
+      iter->second.pop_back();
+      state->cached -= nbytes;
+      MemorySampler::recordAlloc (ptr, nbytes);
+      return ptr;
+    }
+  }
+  void* ptr = ::operator new (nbytes);
+  NumaMemory::place (ptr, nbytes);
+  MemorySampler::recordAlloc (ptr, nbytes);
+  return ptr;
+}
+
+void ArrayPool::deallocate (void* ptr, size_t nbytes)
+{
+  MemorySampler::recordFree (ptr);
+  PoolState* state = theState;
+  if (state  &&  state->cached + nbytes <= state->maxBytes) {
+    state->buffers[nbytes].push_back (ptr);
+    state->cached += nbytes;
+  } else {
+    ::operator delete (ptr);
+  }
+}
+
+
+ArrayPoolScope::ArrayPoolScope (size_t maxCacheBytes)
+  : itsOldMaxBytes (ArrayPool::maxCacheBytes())
+{
+  ArrayPool::enable (maxCacheBytes);
+}
+
+ArrayPoolScope::~ArrayPoolScope()
+{
+  if (itsOldMaxBytes == 0) {
+    ArrayPool::disable();
+  } else {
+    ArrayPool::enable (itsOldMaxBytes);
+  }
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,118 @@
+//# ArrayPool.h: Thread-local pool of Array data buffers
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_ARRAYPOOL_2_H
+#define CASA_ARRAYPOOL_2_H
+
+#include <cstddef>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Thread-local pool of Array data buffers.
+// </summary>
+// <reviewed reviewer="" date="" tests="tArrayPool">
+//
+// <synopsis>
+// Code iterating over table rows (e.g. using ArrayColumn::get) creates and
+// destroys many arrays with the same shape. Each of them allocates and frees
+// its data buffer, which can take a noticeable part of the run time.
+// <br>ArrayPool makes it possible to reuse the data buffers of Array
+// objects in the current thread. If enabled, a freed buffer is kept in a
+// cache (keyed by its size in bytes), so the next allocation of the same
+// size can take it from the cache instead of the heap. The cache is limited
+// to a maximum number of bytes; buffers not fitting in it are freed.
+// <br>The pool is disabled by default. It can be enabled for the current
+// thread using <src>ArrayPool::enable</src>, or for a scope using an
+// <linkto class=ArrayPoolScope>ArrayPoolScope</linkto> object.
+// A buffer can be freed in another thread than it was allocated in;
+// it is then cached in (or freed by) the other thread.
+// <br>Only element types with a normal alignment are pooled.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   {
+//     ArrayPoolScope pool;
+//     for (rownr_t i=0; i<nrow; ++i) {
+//       Matrix<Complex> data = dataCol(i);     // reuses buffers
+//     }
+//   }   // the cached buffers are freed
+// </srcblock>
+// </example>
+
+class ArrayPool
+{
+public:
+  // Enable the pool for the current thread using a cache of at most
+  // the given number of bytes.
+  static void enable (size_t maxCacheBytes = 64*1024*1024);
+
+  // Disable the pool for the current thread and free the cached buffers.
+  static void disable();
+
+  // Is the pool enabled in the current thread?
+  static bool isEnabled();
+
+  // Get the maximum cache size of the current thread (0 if disabled).
+  static size_t maxCacheBytes();
+
+  // Get the number of bytes cached in the current thread.
+  static size_t cachedBytes();
+
+  // Free the cached buffers in the current thread.
+  static void release();
+
+  // Allocate or deallocate a buffer (used by the Array classes).
+  // <group>
+  static void* allocate (size_t nbytes);
+  static void deallocate (void* ptr, size_t nbytes);
+  // </group>
+};
+
+
+// <summary>
+// Enable the ArrayPool for the current thread in a scope.
+// </summary>
+// <synopsis>
+// The constructor enables the pool in the current thread. The destructor
+// restores the previous state, thus disables the pool (freeing the cached
+// buffers) if it was not enabled before.
+// </synopsis>
+class ArrayPoolScope
+{
+public:
+  explicit ArrayPoolScope (size_t maxCacheBytes = 64*1024*1024);
+  ~ArrayPoolScope();
+  ArrayPoolScope (const ArrayPoolScope&) = delete;
+  ArrayPoolScope& operator= (const ArrayPoolScope&) = delete;
+private:
+  size_t itsOldMaxBytes;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,517 @@
+//# ArrayView.h: Non-owning strided view on array data
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_ARRAYVIEW_2_H
+#define CASA_ARRAYVIEW_2_H
+
+#include "Array.h"
+#include "ArrayError.h"
+#include "ArrayMathKernels.h"
+#include "IPosition.h"
+#include "Slicer.h"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Non-owning strided view on array data with a compile-time rank.
+// </summary>
+// <reviewed reviewer="" date="" tests="tArrayView">
+//
+// <prerequisite>
+//   <li> <linkto class=Array>Array</linkto>
+// </prerequisite>
+//
+// <synopsis>
+// An ArrayView refers to N-dimensional data in memory owned by someone
+// else (an Array, a Lattice cursor, a buffer of an external library, etc.).
+// It holds the data pointer and the length and (element) stride of each
+// axis in fixed size arrays, so creating, copying and sectioning a view
+// does not allocate memory and does not involve reference counting.
+// Copying a view gives another view on the same data.
+// <br>The template parameter T can be const to get a read-only view.
+// A view on non-const data converts implicitly to a view on const data.
+// An Array<T> (or Vector, Matrix, Cube) converts implicitly to a view
+// with the same dimensionality; an ArrayNDimError is thrown if the
+// dimensionality differs.
+// <br>A view must not be used after its underlying storage is freed or
+// resized.
+// <p>
+// Besides element access and sectioning, the class has in-place
+// element-wise operations (assignment, +=, -=, *=, /=) and functions
+// like <src>sum</src>, <src>min</src>, <src>max</src> and
+// <src>mean</src> are defined for it. The operations use a plain loop
+// when the data are contiguous and otherwise iterate with the innermost
+// axis as the inner loop.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   Cube<Complex> data(4, 64, 1000);
+//   ArrayView<Complex,3> view(data);
+//   for (size_t i=0; i<view.shape(2); ++i) {
+//     ArrayView<Complex,2> plane = view.slab(i);   // no allocation
+//     plane *= Complex(2,0);
+//   }
+//   // Sum a strided section.
+//   Complex s = sum (view.section ({{0,0,0}}, {{3,63,999}}, {{1,2,10}}));
+// </srcblock>
+// </example>
+//
+// <motivation>
+// Taking a section of an Array creates a new reference counted Array
+// object with heap allocated state. Inner loops passing many small
+// sub-arrays around should not pay that price.
+// </motivation>
+
+template<typename T, size_t N>
+class ArrayView
+{
+  static_assert (N > 0, "ArrayView must have at least one dimension");
+public:
+  typedef typename std::remove_const<T>::type value_type;
+  typedef std::array<size_t,N>    shape_type;
+  typedef std::array<ptrdiff_t,N> stride_type;
+
+  // Create an empty view.
+  ArrayView()
+    : itsData (nullptr)
+  {
+    itsShape.fill (0);
+    itsSteps.fill (1);
+  }
+
+  // Create a view on contiguous data with the given shape.
+  ArrayView (T* data, const shape_type& shape)
+    : itsData (data),
+      itsShape (shape)
+  {
+    ptrdiff_t step = 1;
+    for (size_t i=0; i<N; ++i) {
+      itsSteps[i] = step;
+      step *= itsShape[i];
+    }
+  }
+
+  // Create a view on strided data with the given shape and steps (in
+  // elements) of each axis.
+  ArrayView (T* data, const shape_type& shape, const stride_type& steps)
+    : itsData (data),
+      itsShape (shape),
+      itsSteps (steps)
+  {}
+
+  // Create a view on the data of an Array.
+  // An exception is thrown if the dimensionality of the Array is not N.
+  // <group>
+  ArrayView (Array<value_type>& arr)
+    { init (arr.data(), arr); }
+  template<typename U=T,
+           typename=typename std::enable_if<std::is_const<U>::value>::type>
+  ArrayView (const Array<value_type>& arr)
+    { init (arr.data(), arr); }
+  // </group>
+
+  // Convert a view on non-const data to a view on const data.
+  template<typename U,
+           typename=typename std::enable_if<std::is_same<const U,T>::value>::type>
+  ArrayView (const ArrayView<U,N>& that)
+    : itsData  (that.data()),
+      itsShape (that.shape()),
+      itsSteps (that.steps())
+  {}
+
+  // Copying a view gives a view on the same data.
+  // <group>
+  ArrayView (const ArrayView&) = default;
+  ArrayView& operator= (const ArrayView&) = default;
+  // </group>
+
+  // Get the dimensionality.
+  static constexpr size_t ndim()
+    { return N; }
+
+  // Get the data pointer (of the first element).
+  T* data() const
+    { return itsData; }
+
+  // Get the shape and steps.
+  // <group>
+  const shape_type& shape() const
+    { return itsShape; }
+  size_t shape (size_t axis) const
+    { return itsShape[axis]; }
+  const stride_type& steps() const
+    { return itsSteps; }
+  ptrdiff_t steps (size_t axis) const
+    { return itsSteps[axis]; }
+  IPosition shapeIP() const
+  {
+    IPosition shp(N);
+    for (size_t i=0; i<N; ++i) shp[i] = itsShape[i];
+    return shp;
+  }
+  // </group>
+
+  // Get the number of elements.
+  size_t nelements() const
+  {
+    size_t n = 1;
+    for (size_t i=0; i<N; ++i) n *= itsShape[i];
+    return n;
+  }
+  size_t size() const
+    { return nelements(); }
+  bool empty() const
+    { return nelements() == 0; }
+
+  // Are the data contiguous in memory (in Fortran order)?
+  bool contiguous() const
+  {
+    ptrdiff_t step = 1;
+    for (size_t i=0; i<N; ++i) {
+      if (itsShape[i] > 1  &&  itsSteps[i] != step) return false;
+      step *= itsShape[i];
+    }
+    return true;
+  }
+
+  // Get a reference to an element. No bounds checking is done.
+  // <group>
+  template<typename... Inx>
+  T& operator() (Inx... inx) const
+  {
+    static_assert (sizeof...(Inx) == N, "Nr of indices must match rank");
+    const size_t index[] = {size_t(inx)...};
+    return itsData[offset(index)];
+  }
+  T& operator[] (const shape_type& index) const
+    { return itsData[offset(index.data())]; }
+  // </group>
+
+  // Get the view of the i-th slab along the last axis, thus with one
+  // dimension less (e.g. a plane of a cube or a column of a matrix).
+  template<size_t M=N, typename=typename std::enable_if<(M>1)>::type>
+  ArrayView<T,N-1> slab (size_t i) const
+  {
+    typename ArrayView<T,N-1>::shape_type  shp;
+    typename ArrayView<T,N-1>::stride_type stp;
+    for (size_t j=0; j<N-1; ++j) {
+      shp[j] = itsShape[j];
+      stp[j] = itsSteps[j];
+    }
+    return ArrayView<T,N-1> (itsData + i*itsSteps[N-1], shp, stp);
+  }
+
+  // Get a view on a section given by the start, inclusive end and
+  // stride per axis. An ArraySlicerError is thrown if the section
+  // exceeds the view.
+  // <group>
+  ArrayView<T,N> section (const shape_type& start, const shape_type& end) const
+  {
+    shape_type incr;
+    incr.fill (1);
+    return section (start, end, incr);
+  }
+  ArrayView<T,N> section (const shape_type& start, const shape_type& end,
+                          const shape_type& incr) const
+  {
+    shape_type  shp;
+    stride_type stp;
+    for (size_t i=0; i<N; ++i) {
+      if (start[i] > end[i]  ||  end[i] >= itsShape[i]  ||  incr[i] == 0) {
+        throw ArraySlicerError ("ArrayView::section - invalid section");
+      }
+      shp[i] = (end[i] - start[i]) / incr[i] + 1;
+      stp[i] = itsSteps[i] * ptrdiff_t(incr[i]);
+    }
+    return ArrayView<T,N> (itsData + offset(start.data()), shp, stp);
+  }
+  // </group>
+
+  // Get a view on the section given by a Slicer.
+  ArrayView<T,N> operator() (const Slicer& slicer) const
+  {
+    if (slicer.ndim() != N) {
+      throw ArrayNDimError (slicer.ndim(), N,
+                            "ArrayView::operator()(Slicer)");
+    }
+    IPosition blc, trc, inc;
+    slicer.inferShapeFromSource (shapeIP(), blc, trc, inc);
+    shape_type start, end, incr;
+    for (size_t i=0; i<N; ++i) {
+      start[i] = blc[i];
+      end[i]   = trc[i];
+      incr[i]  = inc[i];
+    }
+    return section (start, end, incr);
+  }
+
+  // Make a copy of the viewed data in a new (contiguous) Array.
+  Array<value_type> copy() const
+  {
+    Array<value_type> arr(shapeIP());
+    ArrayView<value_type,N> (arr).assign (*this);
+    return arr;
+  }
+
+  // Call func for each element (in Fortran order).
+  template<typename Func>
+  void forEach (Func func) const
+  {
+    if (contiguous()) {
+      const size_t n = nelements();
+      for (size_t i=0; i<n; ++i) func (itsData[i]);
+    } else if (! empty()) {
+      std::array<size_t,N> pos;
+      pos.fill (0);
+      T* ptr = itsData;
+      const size_t n0 = itsShape[0];
+      const ptrdiff_t s0 = itsSteps[0];
+      while (true) {
+        for (size_t i=0; i<n0; ++i) func (ptr[i*s0]);
+        if (! nextLine (pos, ptr)) break;
+      }
+    }
+  }
+
+  // Call func for each pair of elements in this view and the other view.
+  // An ArrayConformanceError is thrown if the shapes differ.
+  template<typename U, typename Func>
+  void forEach (const ArrayView<U,N>& other, Func func) const
+  {
+    checkShape (other.shape());
+    if (contiguous()  &&  other.contiguous()) {
+      const size_t n = nelements();
+      U* optr = other.data();
+      for (size_t i=0; i<n; ++i) func (itsData[i], optr[i]);
+    } else if (! empty()) {
+      std::array<size_t,N> pos;
+      pos.fill (0);
+      T* ptr = itsData;
+      U* optr = other.data();
+      const size_t n0 = itsShape[0];
+      const ptrdiff_t s0 = itsSteps[0];
+      const ptrdiff_t os0 = other.steps(0);
+      while (true) {
+        for (size_t i=0; i<n0; ++i) func (ptr[i*s0], optr[i*os0]);
+        for (size_t ax=1; ax<N; ++ax) {
+          optr += other.steps(ax);
+          if (pos[ax] + 1 < itsShape[ax]) break;
+          optr -= other.steps(ax) * ptrdiff_t(itsShape[ax]);
+        }
+        if (! nextLine (pos, ptr)) break;
+      }
+    }
+  }
+
+  // Copy the values of another view or array with the same shape into the
+  // viewed data.
+  // <group>
+  template<typename U>
+  const ArrayView& assign (const ArrayView<U,N>& other) const
+  {
+    forEach (other, [](T& v, const U& o) { v = o; });
+    return *this;
+  }
+  const ArrayView& assign (const Array<value_type>& other) const
+    { return assign (ArrayView<const value_type,N>(other)); }
+  // </group>
+
+  // Set all viewed elements to the given value.
+  const ArrayView& set (const value_type& value) const
+  {
+    forEach ([&value](T& v) { v = value; });
+    return *this;
+  }
+
+  // In-place element-wise operations with a scalar or another view.
+  // <group>
+  const ArrayView& operator+= (const value_type& value) const
+    { forEach ([&value](T& v) { v += value; }); return *this; }
+  const ArrayView& operator-= (const value_type& value) const
+    { forEach ([&value](T& v) { v -= value; }); return *this; }
+  const ArrayView& operator*= (const value_type& value) const
+    { forEach ([&value](T& v) { v *= value; }); return *this; }
+  const ArrayView& operator/= (const value_type& value) const
+    { forEach ([&value](T& v) { v /= value; }); return *this; }
+  template<typename U>
+  const ArrayView& operator+= (const ArrayView<U,N>& other) const
+    { forEach (other, [](T& v, const U& o) { v += o; }); return *this; }
+  template<typename U>
+  const ArrayView& operator-= (const ArrayView<U,N>& other) const
+    { forEach (other, [](T& v, const U& o) { v -= o; }); return *this; }
+  template<typename U>
+  const ArrayView& operator*= (const ArrayView<U,N>& other) const
+    { forEach (other, [](T& v, const U& o) { v *= o; }); return *this; }
+  template<typename U>
+  const ArrayView& operator/= (const ArrayView<U,N>& other) const
+    { forEach (other, [](T& v, const U& o) { v /= o; }); return *this; }
+  // </group>
+
+private:
+  template<typename U>
+  void init (U* data, const Array<value_type>& arr)
+  {
+    if (arr.ndim() != N) {
+      throw ArrayNDimError (arr.ndim(), N, "ArrayView from Array");
+    }
+    itsData = const_cast<T*>(data);
+    for (size_t i=0; i<N; ++i) {
+      itsShape[i] = arr.shape()[i];
+      itsSteps[i] = arr.steps()[i];
+    }
+  }
+
+  ptrdiff_t offset (const size_t* index) const
+  {
+    ptrdiff_t off = 0;
+    for (size_t i=0; i<N; ++i) off += ptrdiff_t(index[i]) * itsSteps[i];
+    return off;
+  }
+
+  // Step to the start of the next line (along axis 0).
+  // It returns false if at the end.
+  bool nextLine (std::array<size_t,N>& pos, T*& ptr) const
+  {
+    for (size_t ax=1; ax<N; ++ax) {
+      ptr += itsSteps[ax];
+      if (++pos[ax] < itsShape[ax]) return true;
+      ptr -= itsSteps[ax] * ptrdiff_t(itsShape[ax]);
+      pos[ax] = 0;
+    }
+    return false;
+  }
+
+  void checkShape (const std::array<size_t,N>& shape) const
+  {
+    if (shape != itsShape) {
+      throw ArrayConformanceError ("ArrayView - shapes differ");
+    }
+  }
+
+  T*          itsData;
+  shape_type  itsShape;
+  stride_type itsSteps;
+};
+
+
+// <summary>
+// Reductions of an ArrayView.
+// </summary>
+// <synopsis>
+// These functions behave as their counterparts for Array in ArrayMath.h.
+// Contiguous views use the same (possibly multi-threaded) kernels.
+// The functions taking the minimum or maximum throw an ArrayError for
+// an empty view.
+// </synopsis>
+// <group name="ArrayView reductions">
+template<typename T, size_t N>
+typename ArrayView<T,N>::value_type sum (const ArrayView<T,N>& view)
+{
+  typedef typename ArrayView<T,N>::value_type V;
+  if (view.contiguous()) {
+    return arrays_internal::contSum (static_cast<const V*>(view.data()),
+                                     view.nelements(),
+                                     arrays_internal::UseLaneKernel<V>());
+  }
+  V s = V();
+  view.forEach ([&s](const V& v) { s += v; });
+  return s;
+}
+
+template<typename T, size_t N>
+typename ArrayView<T,N>::value_type sumsqr (const ArrayView<T,N>& view)
+{
+  typedef typename ArrayView<T,N>::value_type V;
+  if (view.contiguous()) {
+    return arrays_internal::contSumSqr (static_cast<const V*>(view.data()),
+                                        view.nelements(),
+                                        arrays_internal::UseLaneKernel<V>());
+  }
+  V s = V();
+  view.forEach ([&s](const V& v) { s += v*v; });
+  return s;
+}
+
+template<typename T, size_t N>
+void minMax (typename ArrayView<T,N>::value_type& minVal,
+             typename ArrayView<T,N>::value_type& maxVal,
+             const ArrayView<T,N>& view)
+{
+  typedef typename ArrayView<T,N>::value_type V;
+  if (view.empty()) {
+    throw ArrayError ("minMax(ArrayView) - empty view");
+  }
+  if (view.contiguous()) {
+    arrays_internal::contMinMax (minVal, maxVal,
+                                 static_cast<const V*>(view.data()),
+                                 view.nelements(),
+                                 arrays_internal::UseLaneKernel<V>());
+    return;
+  }
+  V minv = *view.data();
+  V maxv = minv;
+  view.forEach ([&minv, &maxv](const V& v)
+                { if (v < minv) minv = v;
+                  if (v > maxv) maxv = v; });
+  minVal = minv;
+  maxVal = maxv;
+}
+
+template<typename T, size_t N>
+typename ArrayView<T,N>::value_type min (const ArrayView<T,N>& view)
+{
+  typename ArrayView<T,N>::value_type minv, maxv;
+  minMax (minv, maxv, view);
+  return minv;
+}
+
+template<typename T, size_t N>
+typename ArrayView<T,N>::value_type max (const ArrayView<T,N>& view)
+{
+  typename ArrayView<T,N>::value_type minv, maxv;
+  minMax (minv, maxv, view);
+  return maxv;
+}
+
+template<typename T, size_t N>
+typename ArrayView<T,N>::value_type mean (const ArrayView<T,N>& view)
+{
+  typedef typename ArrayView<T,N>::value_type V;
+  if (view.empty()) {
+    throw ArrayError ("mean(ArrayView) - empty view");
+  }
+  return sum(view) / V(view.nelements());
+}
+// </group>
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -113,17 +113,6 @@ IPosition::IPosition (size_t length, ssize_t val)
     std::fill_n(data_p, size_p, val);
 }
 
-IPosition::IPosition (const IPosition& other)
-: size_p (other.size_p),
-  data_p (buffer_p)
-{
-    if (size_p > BufferLength) {
-	allocateBuffer();
-    }
-    std::copy_n(other.data_p, size_p, data_p);
-    assert(ok());
-}
-
 IPosition::IPosition (IPosition&& source) noexcept
 : size_p (source.size_p),
   data_p (size_p > BufferLength ? source.data_p : buffer_p)
@@ -252,23 +241,6 @@ void IPosition::resize (size_t newSize, bool copy)
     assert(ok());
 }
 
-// <thrown>
-//    <item> ArrayConformanceError
-// </thrown>
-IPosition& IPosition::operator= (const IPosition& other)
-{
-  assert(ok());
-  if (&other == this) {
-    return *this;
-  }
-  if (size_p != other.size_p) {
-    resize (other.nelements(), false);
-  }
-  std::copy_n(other.data_p, size_p, data_p);
-  assert(ok());
-  return *this;
-}
-
 IPosition& IPosition::operator=(IPosition&& source)
 {
   size_p = source.size_p;
@@ -484,11 +456,6 @@ void IPosition::operator /= (ssize_t val)
     }
 }
 
-bool IPosition::isEqual (const IPosition& other) const
-{
-    return isEqual (other, nelements());
-}
-
 bool IPosition::isEqual (const IPosition& other,
 			 bool skipDegeneratedAxes) const
 {
@@ -718,18 +685,6 @@ IPosition min (const IPosition& left, const IPosition& right)
     return result;
 }
 
-long long IPosition::product() const
-{
-    if (nelements() ==  0) {
-	return 0;
-    }
-    long long total = 1;
-    for (size_t i=0; i<nelements(); i++) {
-	total *= data_p[i];
-    }
-    return total;
-}
-
 bool IPosition::allOne() const
 {
     for (size_t i=0; i<nelements(); ++i) {
@@ -29,6 +29,7 @@
 //# Includes
 #include "ArrayFwd.h"
 
+#include <algorithm>
 #include <vector>
 #include <cstddef>                  // for ptrdiff_t
 #include <initializer_list>
@@ -636,6 +637,47 @@ inline bool IPosition::conform(const IPosition& other) const
     return  (size_p == other.size_p);
 }
 
+// The functions below are used in many hot paths, so they are inlined
+// with a fast path for the inline buffer.
+inline IPosition::IPosition (const IPosition& other)
+: size_p (other.size_p),
+  data_p (buffer_p)
+{
+    if (size_p > BufferLength) {
+	allocateBuffer();
+    }
+    std::copy_n(other.data_p, size_p, data_p);
+}
+
+inline IPosition& IPosition::operator= (const IPosition& other)
+{
+    if (&other != this) {
+	if (size_p != other.size_p) {
+	    resize (other.size_p, false);
+	}
+	std::copy_n(other.data_p, size_p, data_p);
+    }
+    return *this;
+}
+
+inline long long IPosition::product() const
+{
+    if (size_p == 0) {
+	return 0;
+    }
+    long long total = data_p[0];
+    for (size_t i=1; i<size_p; ++i) {
+	total *= data_p[i];
+    }
+    return total;
+}
+
+inline bool IPosition::isEqual (const IPosition& other) const
+{
+    return size_p == other.size_p  &&
+	std::equal(data_p, data_p + size_p, other.data_p);
+}
+
 } //# NAMESPACE CASACORE - END
 
 #endif
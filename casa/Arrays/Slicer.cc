@@ -196,6 +196,28 @@ IPosition Slicer::inferShapeFromSource (const IPosition& shp,
 	throw (ArraySlicerError
 	               ("Shape IPosition-lengths differ from ndim()"));
     }
+    //# A fixed Slicer needs no inference; only check it against the shape.
+    if (fixed_p) {
+        const size_t nd = start_p.nelements();
+        start.resize (nd, false);
+        end.resize (nd, false);
+        stride.resize (nd, false);
+        IPosition res(nd);
+        for (size_t i=0; i<nd; i++) {
+            start[i]  = start_p[i];
+            stride[i] = stride_p[i];
+            res[i]    = len_p[i];
+            end[i] = (res[i] == 0  ?  start[i] - 1 :
+                                      start[i] + (res[i] - 1) * stride[i]);
+            if (start[i] >= shp[i]) {
+                throw (ArraySlicerError ("infer: startResult>=shape"));
+            }
+            if (end[i] >= shp[i]) {
+                throw (ArraySlicerError ("infer: endResult>=shape"));
+            }
+        }
+        return res;
+    }
     //# Resize the output IPositions.
     //# Initialize them, so they will do for unspecified values.
     start.resize (start_p.nelements());
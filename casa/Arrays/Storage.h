@@ -1,12 +1,35 @@
 #ifndef CASACORE_STORAGE_2_H
 #define CASACORE_STORAGE_2_H
 
+#include "ArrayPool.h"
+
+#include <cstddef>
 #include <cstring>
 #include <memory>
   
 namespace casacore {
 
 namespace arrays_internal {
+
+// Allocate or deallocate uninitialized memory for n elements.
+// The memory is taken from the ArrayPool if the type has a normal
+// alignment, otherwise std::allocator is used.
+template<typename T>
+inline T* allocateStorage(std::size_t n)
+{
+  if(alignof(T) <= alignof(std::max_align_t))
+    return static_cast<T*>(ArrayPool::allocate(n * sizeof(T)));
+  return std::allocator<T>().allocate(n);
+}
+
+template<typename T>
+inline void deallocateStorage(T* data, std::size_t n)
+{
+  if(alignof(T) <= alignof(std::max_align_t))
+    ArrayPool::deallocate(data, n * sizeof(T));
+  else
+    std::allocator<T>().deallocate(data, n);
+}
   
 // This class emplements a static (but run-time) sized array. It is used in the
 // Array class, and is necessary because std::vector specializes for bool.
@@ -85,7 +108,7 @@ public:
     if(n == 0)
       newStorage->_data = nullptr;
     else
-      newStorage->_data = std::allocator<T>().allocate(n);
+      newStorage->_data = allocateStorage<T>(n);
     newStorage->_end = newStorage->_data + n;
     return newStorage;
   }
@@ -97,7 +120,7 @@ public:
     {
       for(size_t i=0; i!=size(); ++i)
         _data[size()-i-1].~T();
-      std::allocator<T>().deallocate(_data, size());
+      deallocateStorage<T>(_data, size());
     }
   }
     
@@ -153,7 +176,7 @@ private:
     if(n == 0)
       return nullptr;
     else {
-      T* data = std::allocator<T>().allocate(n);
+      T* data = allocateStorage<T>(n);
       T* current = data;
        try {
         for (; current != data+n; ++current) {
@@ -165,7 +188,7 @@ private:
           --current;
           current->~T();
         }
-        std::allocator<T>().deallocate(data, n);
+        deallocateStorage<T>(data, n);
         throw;
       }
       return data;
@@ -177,7 +200,7 @@ private:
     if(n == 0)
       return nullptr;
     else {
-      T* data = std::allocator<T>().allocate(n);
+      T* data = allocateStorage<T>(n);
       T* current = data;
       try {
         for (; current != data+n; ++current) {
@@ -189,7 +212,7 @@ private:
           --current;
           current->~T();
         }
-        std::allocator<T>().deallocate(data, n);
+        deallocateStorage<T>(data, n);
         throw;
       }
       return data;
@@ -203,7 +226,7 @@ private:
       return nullptr;
     else {
       size_t n = std::distance(startIter, endIter);
-      T* data = std::allocator<T>().allocate(n);
+      T* data = allocateStorage<T>(n);
       T* current = data;
       try {
         for (; current != data+n; ++current) {
@@ -216,7 +239,7 @@ private:
           --current;
           current->~T();
         }
-        std::allocator<T>().deallocate(data, n);
+        deallocateStorage<T>(data, n);
         throw;
       }
       return data;
@@ -229,7 +252,7 @@ private:
       return nullptr;
     else {
       size_t n = endIter - startIter;
-      T* data = std::allocator<T>().allocate(n);
+      T* data = allocateStorage<T>(n);
       T* current = data;
       try {
         for (; current != data+n; ++current) {
@@ -242,7 +265,7 @@ private:
           --current;
           current->~T();
         }
-        std::allocator<T>().deallocate(data, n);
+        deallocateStorage<T>(data, n);
         throw;
       }
       return data;
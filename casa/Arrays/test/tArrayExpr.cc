@@ -0,0 +1,111 @@
+//# tArrayExpr.cc: Test program for the Array expression templates
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include "../Array.h"
+#include "../ArrayExpr.h"
+#include "../ArrayMath.h"
+#include "../ArrayLogical.h"
+#include "../ArrayError.h"
+#include "../Cube.h"
+#include "../Matrix.h"
+#include "../Vector.h"
+
+#include <complex>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace casacore;
+
+BOOST_AUTO_TEST_SUITE(array_expr)
+
+BOOST_AUTO_TEST_CASE(arithmetic)
+{
+  Cube<double> a(4,5,6), b(4,5,6), c(4,5,6), d(4,5,6);
+  indgen (a, 1.);
+  indgen (b, 2., 0.5);
+  indgen (c, -3.);
+  indgen (d, 0.25, 0.25);
+  Cube<double> exp1 = a*b + c*d;
+  Cube<double> res;
+  arrayExprAssign (res, arrayExpr(a)*b + arrayExpr(c)*d);
+  BOOST_CHECK (res.shape() == a.shape());
+  BOOST_CHECK (allNear (res, exp1, 1e-13));
+  // Mix with scalars and unary functions.
+  Cube<double> exp2 = sqrt(a) * 2. - b / 4. + (-c);
+  res = 0.;
+  arrayExprAssign (res, sqrt(arrayExpr(a)) * 2. - arrayExpr(b) / 4.
+                        + (-arrayExpr(c)));
+  BOOST_CHECK (allNear (res, exp2, 1e-13));
+  Array<double> res2 = (3. - arrayExpr(a) * a).evaluate();
+  BOOST_CHECK (allNear (res2, 3. - a*a, 1e-13));
+  BOOST_CHECK (std::abs(sum(square(arrayExpr(a))) - sum(a*a)) < 1e-6);
+  // The result can be an operand.
+  Cube<double> acopy = a.copy();
+  arrayExprAssign (a, arrayExpr(a) + a);
+  BOOST_CHECK (allNear (a, 2.*acopy, 1e-13));
+}
+
+BOOST_AUTO_TEST_CASE(complex_amplitude)
+{
+  typedef std::complex<float> Cplx;
+  Matrix<Cplx> a(3,7), b(3,7);
+  for (size_t i=0; i<a.nelements(); ++i) {
+    a.data()[i] = Cplx(i, -float(i)/2);
+    b.data()[i] = Cplx(1, i%3);
+  }
+  Matrix<float> amp = amplitude(arrayExpr(a) * b).evaluate();
+  BOOST_CHECK (allNear (amp, amplitude(a*b), 1e-5));
+  Matrix<float> re = real(arrayExpr(a) - b).evaluate();
+  BOOST_CHECK (allNear (re, real(a-b), 1e-5));
+}
+
+BOOST_AUTO_TEST_CASE(noncontiguous)
+{
+  Matrix<int> a(6,8), b(3,4);
+  indgen (a);
+  indgen (b);
+  Matrix<int> sect = a(Slice(0,3,2), Slice(0,4,2));
+  Matrix<int> exp1 = sect + b;
+  Matrix<int> res(3,4);
+  arrayExprAssign (res, arrayExpr(sect) + b);
+  BOOST_CHECK (allEQ (res, exp1));
+  // Assign into a non-contiguous section.
+  arrayExprAssign (sect, arrayExpr(b) * 10);
+  BOOST_CHECK (allEQ (sect, b*10));
+  BOOST_CHECK (a(2,2) == b(1,1)*10);
+  BOOST_CHECK (a(1,0) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(shape_mismatch)
+{
+  Vector<int> a(5), b(6);
+  BOOST_CHECK_THROW (arrayExpr(a) + b, ArrayConformanceError);
+  Vector<int> res(4);
+  BOOST_CHECK_THROW (arrayExprAssign (res, arrayExpr(a) * 2),
+                     ArrayConformanceError);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
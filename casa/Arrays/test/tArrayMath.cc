@@ -26,6 +26,7 @@
 //# Includes
 #include "../Cube.h"
 #include "../ArrayMath.h"
+#include "../ArrayPartMath.h"
 #include "../ArrayLogical.h"
 //#include "../ArrayIO.h"
 #include "../ElementFunctions.h"
@@ -734,4 +735,86 @@ BOOST_AUTO_TEST_CASE( convert_array )
   BOOST_CHECK_EQUAL_COLLECTIONS(b.begin(), b.end(), ref.begin(), ref.end());
 }
 
+// Test the lane kernels used for contiguous reductions for lengths that
+// are and are not a multiple of the number of lanes.
+BOOST_AUTO_TEST_CASE( lane_kernels )
+{
+  for (size_t n : {1, 7, 8, 9, 64, 1001}) {
+    Vector<double> vd(n);
+    Vector<int> vi(n);
+    Vector<std::complex<float>> vc(n);
+    double sd = 0, sd2 = 0;
+    int si = 0;
+    std::complex<float> sc;
+    for (size_t i=0; i<n; ++i) {
+      vd[i] = std::sin(0.1*i) * (i+1);
+      vi[i] = (i*37) % 101 - 50;
+      vc[i] = std::complex<float>(i, 1.5*i);
+      sd += vd[i];
+      sd2 += vd[i]*vd[i];
+      si += vi[i];
+      sc += vc[i];
+    }
+    BOOST_CHECK_CLOSE (sum(vd), sd, 1e-9);
+    BOOST_CHECK_CLOSE (sumsqr(vd), sd2, 1e-9);
+    BOOST_CHECK_EQUAL (sum(vi), si);
+    BOOST_CHECK (std::abs(sum(vc) - sc) <= 1e-5 * std::abs(sc));
+    int mini, maxi;
+    minMax (mini, maxi, vi);
+    BOOST_CHECK_EQUAL (mini, *std::min_element(vi.begin(), vi.end()));
+    BOOST_CHECK_EQUAL (maxi, *std::max_element(vi.begin(), vi.end()));
+    double mind, maxd;
+    minMax (mind, maxd, vd);
+    BOOST_CHECK_EQUAL (mind, *std::min_element(vd.begin(), vd.end()));
+    BOOST_CHECK_EQUAL (maxd, *std::max_element(vd.begin(), vd.end()));
+  }
+  // Partial sums over the first (contiguous) axis.
+  Cube<float> cube(13, 3, 2);
+  indgen (cube);
+  Array<float> psum = partialSums (cube, IPosition(1,0));
+  BOOST_CHECK (psum.shape() == IPosition(2,3,2));
+  Matrix<float> psumMat(psum);
+  for (size_t k=0; k<2; ++k) {
+    for (size_t j=0; j<3; ++j) {
+      float s = 0;
+      for (size_t i=0; i<13; ++i) {
+        s += cube(i,j,k);
+      }
+      BOOST_CHECK_CLOSE (psumMat(j,k), s, 1e-5);
+    }
+  }
+}
+
+// Test multi-threaded transforms and reductions (only parallel if built
+// with OpenMP) by using a low threshold.
+BOOST_AUTO_TEST_CASE( parallel_threshold )
+{
+  size_t oldThreshold = arrayMathParallelThreshold();
+  setArrayMathParallelThreshold (100);
+  BOOST_CHECK_EQUAL (arrayMathParallelThreshold(), 100u);
+  Vector<double> a(10001), b(10001);
+  indgen (a, -5000.);
+  indgen (b, 1., 2.);
+  a[7777] = 1e6;
+  a[3] = -1e6;
+  Vector<double> c = a + b;
+  Vector<double> d = 2. * a;
+  Vector<double> e = sqrt(b);
+  bool ok = true;
+  for (size_t i=0; i<a.size(); ++i) {
+    ok = ok && c[i] == a[i]+b[i] && d[i] == 2*a[i] && e[i] == std::sqrt(b[i]);
+  }
+  BOOST_CHECK (ok);
+  c += a;
+  d *= 0.5;
+  BOOST_CHECK (allEQ (c, 2.*a + b));
+  BOOST_CHECK (allEQ (d, a));
+  BOOST_CHECK_CLOSE (sum(b), 10001.*10001., 1e-10);
+  double mn, mx;
+  minMax (mn, mx, a);
+  BOOST_CHECK_EQUAL (mn, -1e6);
+  BOOST_CHECK_EQUAL (mx, 1e6);
+  setArrayMathParallelThreshold (oldThreshold);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,125 @@
+//# tArrayPool.cc: Test program for the ArrayPool class
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include "../ArrayPool.h"
+#include "../Array.h"
+#include "../ArrayMath.h"
+#include "../ArrayLogical.h"
+#include "../Matrix.h"
+#include "../Vector.h"
+
+#include <string>
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace casacore;
+
+BOOST_AUTO_TEST_SUITE(array_pool)
+
+BOOST_AUTO_TEST_CASE( disabled_by_default )
+{
+  BOOST_CHECK(!ArrayPool::isEnabled());
+  { Vector<double> v(100, 1.); }
+  BOOST_CHECK_EQUAL(ArrayPool::cachedBytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE( reuse_buffers )
+{
+  {
+    ArrayPoolScope pool;
+    BOOST_CHECK(ArrayPool::isEnabled());
+    const double* first;
+    {
+      Matrix<double> m(10, 20, 3.);
+      first = m.data();
+    }
+    BOOST_CHECK_EQUAL(ArrayPool::cachedBytes(), 200*sizeof(double));
+    // The same size should get the same buffer.
+    Matrix<double> m2(20, 10, 2.);
+    BOOST_CHECK_EQUAL(m2.data(), first);
+    BOOST_CHECK_EQUAL(ArrayPool::cachedBytes(), 0u);
+    BOOST_CHECK(allEQ(m2, 2.));
+    // Another size gets a new buffer.
+    Vector<double> v(7, 1.);
+    BOOST_CHECK(v.data() != first);
+    BOOST_CHECK_CLOSE(sum(m2) + sum(v), 407., 1e-12);
+  }
+  BOOST_CHECK(!ArrayPool::isEnabled());
+  BOOST_CHECK_EQUAL(ArrayPool::cachedBytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE( non_trivial_type )
+{
+  ArrayPoolScope pool;
+  for (int i=0; i<3; ++i) {
+    Vector<std::string> v(5, "abcdefghijklmnopqrstuvwxyz");
+    v[2] = "x";
+    BOOST_CHECK_EQUAL(v[1], "abcdefghijklmnopqrstuvwxyz");
+    BOOST_CHECK_EQUAL(v[2], "x");
+  }
+  BOOST_CHECK_EQUAL(ArrayPool::cachedBytes(), 5*sizeof(std::string));
+}
+
+BOOST_AUTO_TEST_CASE( cache_limit )
+{
+  ArrayPoolScope pool(1000);
+  { Vector<char> v(600); }
+  { Vector<char> v(500); }    // does not fit anymore
+  BOOST_CHECK_EQUAL(ArrayPool::cachedBytes(), 600u);
+  ArrayPool::release();
+  BOOST_CHECK_EQUAL(ArrayPool::cachedBytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE( nested_scopes )
+{
+  ArrayPool::enable(5000);
+  {
+    ArrayPoolScope pool(100);
+    BOOST_CHECK_EQUAL(ArrayPool::maxCacheBytes(), 100u);
+  }
+  BOOST_CHECK_EQUAL(ArrayPool::maxCacheBytes(), 5000u);
+  ArrayPool::disable();
+  BOOST_CHECK(!ArrayPool::isEnabled());
+}
+
+BOOST_AUTO_TEST_CASE( other_thread )
+{
+  // Arrays can be freed in a thread other than the allocating one.
+  ArrayPoolScope pool;
+  Vector<int> v(1000, 5);
+  std::thread thr([&v]() {
+      ArrayPoolScope threadPool;
+      v.resize(10);
+      BOOST_CHECK_EQUAL(ArrayPool::cachedBytes(), 1000*sizeof(int));
+    });
+  thr.join();
+  BOOST_CHECK_EQUAL(ArrayPool::cachedBytes(), 0u);
+  v = 3;
+  BOOST_CHECK(allEQ(v, 3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+//# tArrayView.cc: Test program for the ArrayView class
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include "../ArrayView.h"
+#include "../ArrayMath.h"
+#include "../ArrayLogical.h"
+#include "../ArrayError.h"
+#include "../Cube.h"
+#include "../Matrix.h"
+#include "../Slicer.h"
+
+#include <complex>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace casacore;
+
+BOOST_AUTO_TEST_SUITE(array_view)
+
+BOOST_AUTO_TEST_CASE( from_array )
+{
+  Cube<int> cube(3, 4, 5);
+  indgen(cube);
+  ArrayView<int,3> view(cube);
+  BOOST_CHECK_EQUAL(view.data(), cube.data());
+  BOOST_CHECK(view.contiguous());
+  BOOST_CHECK_EQUAL(view.nelements(), 60u);
+  BOOST_CHECK(view.shapeIP() == cube.shape());
+  BOOST_CHECK_EQUAL(view(1,2,3), cube(1,2,3));
+  view(1,2,3) = -1;
+  BOOST_CHECK_EQUAL(cube(1,2,3), -1);
+  // Const view from a const array and from a non-const view.
+  const Cube<int>& ccube = cube;
+  ArrayView<const int,3> cview(ccube);
+  ArrayView<const int,3> cview2(view);
+  BOOST_CHECK_EQUAL(cview(2,3,4), 59);
+  BOOST_CHECK_EQUAL(cview2.data(), cube.data());
+  // Wrong dimensionality.
+  BOOST_CHECK_THROW((ArrayView<int,2>(cube)), ArrayNDimError);
+}
+
+BOOST_AUTO_TEST_CASE( sections )
+{
+  Cube<double> cube(6, 5, 4);
+  indgen(cube);
+  ArrayView<double,3> view(cube);
+  ArrayView<double,3> sect = view.section({{1,0,1}}, {{5,4,3}}, {{2,2,1}});
+  Array<double> exp = cube(IPosition(3,1,0,1), IPosition(3,5,4,3),
+                           IPosition(3,2,2,1));
+  BOOST_CHECK(!sect.contiguous());
+  BOOST_CHECK(sect.shapeIP() == exp.shape());
+  BOOST_CHECK(allEQ(sect.copy(), exp));
+  BOOST_CHECK_EQUAL(sum(sect), sum(exp));
+  BOOST_CHECK_EQUAL(min(sect), min(exp));
+  BOOST_CHECK_EQUAL(max(sect), max(exp));
+  BOOST_CHECK_CLOSE(mean(sect), mean(exp), 1e-12);
+  BOOST_CHECK_EQUAL(sumsqr(sect), sumsqr(exp));
+  // Same using a Slicer.
+  ArrayView<double,3> sect2 = view(Slicer(IPosition(3,1,0,1),
+                                          IPosition(3,5,4,3),
+                                          IPosition(3,2,2,1),
+                                          Slicer::endIsLast));
+  BOOST_CHECK(allEQ(sect2.copy(), exp));
+  BOOST_CHECK_THROW(view.section({{0,0,0}}, {{6,0,0}}), ArraySlicerError);
+  // Slabs along the last axis.
+  ArrayView<double,2> plane = view.slab(2);
+  BOOST_CHECK(plane.contiguous());
+  BOOST_CHECK(allEQ(plane.copy(), Array<double>(cube.xyPlane(2))));
+  ArrayView<double,1> line = plane.slab(3);
+  BOOST_CHECK_EQUAL(line(4), cube(4,3,2));
+}
+
+BOOST_AUTO_TEST_CASE( inplace_operations )
+{
+  Matrix<std::complex<float>> mat(4, 6, std::complex<float>(1,2));
+  ArrayView<std::complex<float>,2> view(mat);
+  ArrayView<std::complex<float>,2> sect = view.section({{0,1}}, {{3,5}},
+                                                       {{1,2}});
+  sect *= std::complex<float>(2,0);
+  sect += sect;
+  BOOST_CHECK_EQUAL(mat(0,0), std::complex<float>(1,2));
+  BOOST_CHECK_EQUAL(mat(2,3), std::complex<float>(4,8));
+  BOOST_CHECK_EQUAL(sum(view), 12.f*std::complex<float>(1,2) +
+                               12.f*std::complex<float>(4,8));
+  sect.set(std::complex<float>(0,0));
+  sect.assign(view.section({{0,0}}, {{3,4}}, {{1,2}}));
+  BOOST_CHECK(allEQ(mat, std::complex<float>(1,2)));
+  BOOST_CHECK_THROW(sect.assign(view), ArrayConformanceError);
+}
+
+BOOST_AUTO_TEST_CASE( foreign_memory )
+{
+  std::vector<float> buf(12);
+  for (size_t i=0; i<buf.size(); ++i) buf[i] = i;
+  ArrayView<const float,2> view(buf.data(), {{3,4}});
+  BOOST_CHECK_EQUAL(view(2,3), 11.f);
+  float mn, mx;
+  minMax(mn, mx, view);
+  BOOST_CHECK_EQUAL(mn, 0.f);
+  BOOST_CHECK_EQUAL(mx, 11.f);
+  // A transposed view using negative and swapped steps.
+  ArrayView<const float,2> tview(buf.data() + 9, {{4,3}}, {{-3,1}});
+  BOOST_CHECK_EQUAL(tview(0,0), 9.f);
+  BOOST_CHECK_EQUAL(tview(3,2), 2.f);
+  BOOST_CHECK_EQUAL(sum(tview), 66.f);
+  ArrayView<const float,2> empty;
+  BOOST_CHECK(empty.empty());
+  BOOST_CHECK_EQUAL(sum(empty), 0.f);
+  BOOST_CHECK_THROW(min(empty), ArrayError);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -418,6 +418,25 @@ BOOST_AUTO_TEST_CASE( product )
   BOOST_CHECK(x.product() == 0 && y.product() == 120);
 }
 
+BOOST_AUTO_TEST_CASE( copy_and_compare )
+{
+  // Small (inline buffer) and large IPositions.
+  IPosition small(3, 1, 2, 3);
+  IPosition large(6, 1, 2, 3, 4, 5, 6);
+  IPosition x(small);
+  BOOST_CHECK(x.isEqual(small));
+  x = large;
+  BOOST_CHECK(x.isEqual(large));
+  BOOST_CHECK(!x.isEqual(small));
+  BOOST_CHECK_EQUAL(x.product(), 720);
+  x = small;
+  BOOST_CHECK(x.isEqual(small));
+  BOOST_CHECK(!x.isEqual(IPosition(3, 1, 2, 4)));
+  x = x;
+  BOOST_CHECK(x.isEqual(small));
+  BOOST_CHECK(IPosition().isEqual(IPosition()));
+}
+
 BOOST_AUTO_TEST_CASE( as_vector )
 {
   Vector<int> vi;
@@ -290,6 +290,29 @@ BOOST_AUTO_TEST_CASE( errors )
   BOOST_CHECK_THROW(Slicer(IPosition(2,0,1), IPosition(2,1,1), IPosition(2,0,0)), ArrayError);
 }
 
+BOOST_FIXTURE_TEST_CASE( fixed_slicer, Fixture )
+{
+  // A fixed Slicer takes a fast path in inferShapeFromSource.
+  IPosition shp(2, 10, 10);
+  Slicer s1(IPosition(2,0,0), IPosition(2,6,7), IPosition(2,4,3),
+            Slicer::endIsLast);
+  BOOST_CHECK(s1.isFixed());
+  check(s1.inferShapeFromSource (shp, blc, trc, inc), {2, 3});
+  check(blc, {0, 0});
+  check(trc, {4, 6});
+  check(inc, {4, 3});
+  Slicer s2(IPosition(2,3,0), IPosition(2,0,2), IPosition(2,1,5));
+  BOOST_CHECK(s2.isFixed());
+  check(s2.inferShapeFromSource (shp, blc, trc, inc), {0, 2});
+  check(blc, {3, 0});
+  check(trc, {2, 5});
+  check(inc, {1, 5});
+  Slicer s3(IPosition(2,10,0), IPosition(2,1,1));
+  BOOST_CHECK_THROW(s3.inferShapeFromSource (shp, blc, trc, inc), ArrayError);
+  Slicer s4(IPosition(2,9,0), IPosition(2,2,1));
+  BOOST_CHECK_THROW(s4.inferShapeFromSource (shp, blc, trc, inc), ArrayError);
+}
+
 BOOST_FIXTURE_TEST_CASE( change_length, Fixture )
 {
   // Check if changing length of trc,blc,inc works fine.
@@ -33,6 +33,7 @@
 #include <casacore/casa/BasicMath/Functional.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/BasicMath/Random.h>
+#include <casacore/casa/BasicMath/Philox.h>
 #include <casacore/casa/BasicMath/Primes.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -66,6 +67,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> Class <linkto class=Random:description>
 //       Random</linkto>
 //       to offer random number generators.
+//  <li> Class <linkto class=Philox:description>
+//       Philox</linkto>
+//       is a counter-based generator for reproducible parallel noise.
 // <li> <linkto class="Primes">Prime</linkto> numbers
 // </ul>
 //
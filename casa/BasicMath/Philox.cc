@@ -0,0 +1,179 @@
+//# Philox.cc: Counter-based random number generator
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/BasicMath/Philox.h>
+#include <casacore/casa/BasicSL/Constants.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// The multipliers and key increments of Philox4x32.
+static const uInt64 philoxM0 = 0xD2511F53;
+static const uInt64 philoxM1 = 0xCD9E8D57;
+static const uInt   philoxW0 = 0x9E3779B9;
+static const uInt   philoxW1 = 0xBB67AE85;
+
+// Do the 10 rounds on the counter words.
+static inline void philoxRounds (uInt& c0, uInt& c1, uInt& c2, uInt& c3,
+                                 uInt k0, uInt k1)
+{
+  for (uInt r=0; r<10; ++r) {
+    const uInt64 p0 = philoxM0 * c0;
+    const uInt64 p1 = philoxM1 * c2;
+    const uInt n0 = uInt(p1>>32) ^ c1 ^ k0;
+    const uInt n2 = uInt(p0>>32) ^ c3 ^ k1;
+    c0 = n0;
+    c1 = uInt(p1);
+    c2 = n2;
+    c3 = uInt(p0);
+    k0 += philoxW0;
+    k1 += philoxW1;
+  }
+}
+
+// Convert 64 random bits to a value in (0,1) with 53 bits precision.
+static inline Double philoxUnit (uInt hi, uInt lo)
+{
+  const uInt64 x = (uInt64(hi) << 32) | lo;
+  return (Double(x >> 11) + 0.5) * (1. / 9007199254740992.);
+}
+
+
+Philox::Philox (uInt64 seed)
+: itsSeed (seed)
+{
+  itsKey[0] = uInt(seed);
+  itsKey[1] = uInt(seed >> 32);
+  reset();
+}
+
+Philox::~Philox()
+{}
+
+void Philox::reset()
+{
+  itsCounter = 0;
+  itsIndex   = 4;
+}
+
+uInt Philox::asuInt()
+{
+  if (itsIndex >= 4) {
+    itsBuffer[0] = uInt(itsCounter);
+    itsBuffer[1] = uInt(itsCounter >> 32);
+    itsBuffer[2] = itsBuffer[3] = 0;
+    block (itsBuffer, itsKey);
+    itsCounter++;
+    itsIndex = 0;
+  }
+  return itsBuffer[itsIndex++];
+}
+
+void Philox::block (uInt counter[4], const uInt key[2])
+{
+  philoxRounds (counter[0], counter[1], counter[2], counter[3],
+                key[0], key[1]);
+}
+
+void Philox::uniformBlocks (Double* u1, Double* u2, size_t n,
+                            uInt64 first) const
+{
+  // Plain loop over independent blocks, so it can be vectorized.
+  const uInt k0 = itsKey[0];
+  const uInt k1 = itsKey[1];
+  for (size_t j=0; j<n; ++j) {
+    const uInt64 ctr = first + j;
+    uInt c0 = uInt(ctr);
+    uInt c1 = uInt(ctr >> 32);
+    uInt c2 = 0;
+    uInt c3 = 0;
+    philoxRounds (c0, c1, c2, c3, k0, k1);
+    u1[j] = philoxUnit (c0, c1);
+    u2[j] = philoxUnit (c2, c3);
+  }
+}
+
+void Philox::uniform (Double* out, size_t n, uInt64 first,
+                      Double low, Double high) const
+{
+  const size_t chunkSize = 256;
+  Double u1[chunkSize];
+  Double u2[chunkSize];
+  const Double delta = high - low;
+  const uInt64 end = first + n;
+  uInt64 blk = first >> 1;
+  const uInt64 endBlk = (end + 1) >> 1;
+  while (blk < endBlk) {
+    const size_t nb = std::min (uInt64(chunkSize), endBlk - blk);
+    uniformBlocks (u1, u2, nb, blk);
+    for (size_t j=0; j<nb; ++j) {
+      const uInt64 i = 2 * (blk + j);
+      if (i >= first) {
+        out[i - first] = low + delta * u1[j];
+      }
+      if (i + 1 < end) {
+        out[i + 1 - first] = low + delta * u2[j];
+      }
+    }
+    blk += nb;
+  }
+}
+
+void Philox::normal (Double* out, size_t n, uInt64 first,
+                     Double mean, Double variance) const
+{
+  const size_t chunkSize = 256;
+  Double u1[chunkSize];
+  Double u2[chunkSize];
+  const Double sigma = std::sqrt(variance);
+  const uInt64 end = first + n;
+  uInt64 blk = first >> 1;
+  const uInt64 endBlk = (end + 1) >> 1;
+  while (blk < endBlk) {
+    const size_t nb = std::min (uInt64(chunkSize), endBlk - blk);
+    uniformBlocks (u1, u2, nb, blk);
+    // Box-Muller transform; u1 and u2 are replaced by the normal pair.
+    for (size_t j=0; j<nb; ++j) {
+      const Double r = sigma * std::sqrt(-2. * std::log(u1[j]));
+      const Double t = C::_2pi * u2[j];
+      u1[j] = mean + r * std::cos(t);
+      u2[j] = mean + r * std::sin(t);
+    }
+    for (size_t j=0; j<nb; ++j) {
+      const uInt64 i = 2 * (blk + j);
+      if (i >= first) {
+        out[i - first] = u1[j];
+      }
+      if (i + 1 < end) {
+        out[i + 1 - first] = u2[j];
+      }
+    }
+    blk += nb;
+  }
+}
+
+} //# NAMESPACE CASACORE - END
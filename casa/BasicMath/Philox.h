@@ -0,0 +1,130 @@
+//# Philox.h: Counter-based random number generator
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_PHILOX_H
+#define CASA_PHILOX_H
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicMath/Random.h>
+
+#include <cstddef>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Counter-based random number generator (Philox4x32-10)
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tPhilox">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class="RNG">RNG</linkto>
+// </prerequisite>
+
+// <etymology>
+// Philox is the name given to this generator by its authors
+// (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11).
+// </etymology>
+
+// <synopsis>
+// The Philox generator computes its random bits as a function of a key
+// (the seed) and a counter. Unlike MLCG or ACG it has no state that must
+// be advanced value by value, so value number <src>i</src> of a stream can
+// be computed directly. This makes it possible to fill a large data set in
+// parallel, where each thread generates the values for its part of the
+// data; the result is the same whatever the number of threads.
+//
+// The functions <src>uniform</src> and <src>normal</src> fill a buffer
+// with values <src>first ... first+n-1</src> of a uniform or normal stream.
+// They are thread-safe and generate the values in blocks, so the loops can
+// be vectorized by the compiler. A normal value is made with the
+// Box-Muller transform from the two uniform values of the same block,
+// so values <src>2k</src> and <src>2k+1</src> form a pair.
+//
+// The class is also derived from <linkto class="RNG">RNG</linkto> and can
+// be used as a sequential generator for the distributions in
+// <linkto file="Random.h">Random.h</linkto>.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   Philox gen(1234);
+//   std::vector<Double> buf(1000);
+//   // Fill buf with values 5000-5999 of the N(0,1) stream.
+//   gen.normal (buf.data(), buf.size(), 5000);
+// </srcblock>
+// </example>
+
+class Philox : public RNG
+{
+public:
+  // Create the generator with the given seed (the key).
+  explicit Philox (uInt64 seed=0);
+
+  virtual ~Philox();
+
+  // Return the next 32 random bits of the sequential stream.
+  virtual uInt asuInt();
+
+  // Restart the sequential stream.
+  virtual void reset();
+
+  // Get the seed.
+  uInt64 seed() const
+    { return itsSeed; }
+
+  // Fill <src>out</src> with values <src>first ... first+n-1</src> of the
+  // stream of uniform values in [low,high).
+  void uniform (Double* out, size_t n, uInt64 first,
+                Double low=0., Double high=1.) const;
+
+  // Fill <src>out</src> with values <src>first ... first+n-1</src> of the
+  // stream of normal values with the given mean and variance.
+  void normal (Double* out, size_t n, uInt64 first,
+               Double mean=0., Double variance=1.) const;
+
+  // Apply the 10 Philox rounds to the 128 bit counter using the 64 bit key.
+  // The result replaces the counter.
+  static void block (uInt counter[4], const uInt key[2]);
+
+private:
+  // Fill the uniform values in (0,1) of blocks <src>first ... first+n-1</src>.
+  // Block k gives two values, stored in u1[k] and u2[k].
+  void uniformBlocks (Double* u1, Double* u2, size_t n, uInt64 first) const;
+
+  uInt64 itsSeed;
+  uInt   itsKey[2];
+  uInt64 itsCounter;   //# next block of the sequential stream
+  uInt   itsBuffer[4];
+  uInt   itsIndex;     //# next word in itsBuffer
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,165 @@
+//# tPhilox.cc: Test program for class Philox
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/casa/BasicMath/Philox.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <cmath>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// Known answers of Philox4x32-10 (from the Random123 distribution).
+void testBlock()
+{
+  {
+    uInt ctr[4] = {0, 0, 0, 0};
+    uInt key[2] = {0, 0};
+    Philox::block (ctr, key);
+    AlwaysAssertExit (ctr[0] == 0x6627e8d5  &&  ctr[1] == 0xe169c58d  &&
+                      ctr[2] == 0xbc57ac4c  &&  ctr[3] == 0x9b00dbd8);
+  }
+  {
+    uInt ctr[4] = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+    uInt key[2] = {0xffffffff, 0xffffffff};
+    Philox::block (ctr, key);
+    AlwaysAssertExit (ctr[0] == 0x408f276d  &&  ctr[1] == 0x41c83b0e  &&
+                      ctr[2] == 0xa20bc7c6  &&  ctr[3] == 0x6d5451fd);
+  }
+  {
+    uInt ctr[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+    uInt key[2] = {0xa4093822, 0x299f31d0};
+    Philox::block (ctr, key);
+    AlwaysAssertExit (ctr[0] == 0xd16cfe09  &&  ctr[1] == 0x94fdcceb  &&
+                      ctr[2] == 0x5001e420  &&  ctr[3] == 0x24126ea1);
+  }
+}
+
+// A part of a stream must be the same as that part of the full stream.
+void testSubStreams()
+{
+  Philox gen(12345);
+  const size_t n = 1001;
+  std::vector<Double> full(n), part(n);
+  gen.normal (full.data(), n, 7, 1., 4.);
+  for (size_t st=0; st<20; ++st) {
+    for (size_t len=1; len<600; len+=37) {
+      gen.normal (part.data(), len, 7+st, 1., 4.);
+      for (size_t i=0; i<len; ++i) {
+        AlwaysAssertExit (part[i] == full[st+i]);
+      }
+    }
+  }
+  gen.uniform (full.data(), n, 3, -2., 2.);
+  gen.uniform (part.data(), 500, 504, -2., 2.);
+  for (size_t i=0; i<500; ++i) {
+    AlwaysAssertExit (part[i] == full[501+i]);
+  }
+  // Another seed gives other values.
+  Philox gen2(12346);
+  gen2.uniform (part.data(), 100, 3, -2., 2.);
+  uInt nsame = 0;
+  for (size_t i=0; i<100; ++i) {
+    if (part[i] == full[i]) nsame++;
+  }
+  AlwaysAssertExit (nsame == 0);
+}
+
+// Check the moments of the distributions.
+void testStats()
+{
+  Philox gen(1);
+  const size_t n = 1000000;
+  std::vector<Double> buf(n);
+  gen.normal (buf.data(), n, 0, 0.5, 2.);
+  Double sum = 0, sum2 = 0;
+  for (size_t i=0; i<n; ++i) {
+    sum += buf[i];
+    sum2 += buf[i] * buf[i];
+  }
+  Double mean = sum/n;
+  Double var  = sum2/n - mean*mean;
+  AlwaysAssertExit (std::abs(mean - 0.5) < 0.01);
+  AlwaysAssertExit (std::abs(var - 2.) < 0.02);
+  gen.uniform (buf.data(), n, 0, 1., 3.);
+  sum = sum2 = 0;
+  for (size_t i=0; i<n; ++i) {
+    AlwaysAssertExit (buf[i] >= 1.  &&  buf[i] < 3.);
+    sum += buf[i];
+    sum2 += buf[i] * buf[i];
+  }
+  mean = sum/n;
+  var  = sum2/n - mean*mean;
+  AlwaysAssertExit (std::abs(mean - 2.) < 0.01);
+  AlwaysAssertExit (std::abs(var - 1./3.) < 0.01);
+}
+
+// The sequential stream can be used with the Random distributions.
+void testSequential()
+{
+  Philox gen(7);
+  Uniform unif(&gen, 0., 1.);
+  Double sum = 0;
+  for (uInt i=0; i<100000; ++i) {
+    sum += unif();
+  }
+  AlwaysAssertExit (std::abs(sum/100000 - 0.5) < 0.01);
+  // Each Double takes two words, so the next word is word 200000.
+  const uInt next = gen.asuInt();
+  gen.reset();
+  for (uInt i=0; i<200000; ++i) {
+    gen.asuInt();
+  }
+  AlwaysAssertExit (gen.asuInt() == next);
+  // The sequential stream consists of the blocks 0,1,2,...
+  gen.reset();
+  uInt ctr[4] = {1, 0, 0, 0};
+  uInt key[2] = {7, 0};
+  Philox::block (ctr, key);
+  for (uInt i=0; i<4; ++i) {
+    gen.asuInt();
+  }
+  for (uInt i=0; i<4; ++i) {
+    AlwaysAssertExit (gen.asuInt() == ctr[i]);
+  }
+}
+
+int main()
+{
+  try {
+    testBlock();
+    testSubStreams();
+    testStats();
+    testSequential();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
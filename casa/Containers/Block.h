@@ -33,6 +33,7 @@
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/Containers/Allocator.h>
+#include <casacore/casa/OS/MemorySampler.h>
 #include <cstddef>                  // for ptrdiff_t
 #include <algorithm> // for std:min/max
 #include <type_traits>
@@ -455,7 +456,7 @@ public:
     size_t n = get_size() - 1;
     if (forceSmaller == True) {
       T *tp = n > 0 ? allocator_p->allocate(n) : 0;
-      traceAlloc(array, n);
+      traceAlloc(tp, n);
       if (initPolicy == ArrayInitPolicies::INIT && n > 0) {
         try {
           allocator_p->construct(tp, n);
@@ -653,12 +654,14 @@ public:
 
   inline void traceAlloc (const void* addr, size_t sz) const
   {
+    MemorySampler::recordAlloc (addr, sz*sizeof(T));
     if (itsTraceSize>0 && sz>=itsTraceSize) {
       doTraceAlloc (addr, sz, whatType<T>(), sizeof(T));
     }
   }
   inline void traceFree (const void* addr, size_t sz) const
   {
+    MemorySampler::recordFree (addr);
     if (itsTraceSize>0 && sz>=itsTraceSize) {
       doTraceFree (addr, sz, whatType<T>(), sizeof(T));
     }
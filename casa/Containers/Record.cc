@@ -29,6 +29,7 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <utility>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -91,6 +92,36 @@ Record::Record (const RecordInterface& other)
     }
 }
 
+// The representation given to a moved-from record. It is shared, so
+// moving a record does not need to allocate a new representation.
+static const COWPtr<RecordRep>& emptyRepForMove()
+{
+    static COWPtr<RecordRep> rep(new RecordRep);
+    return rep;
+}
+
+Record::Record (Record&& other)
+: RecordInterface (other),
+  rep_p    (emptyRepForMove()),
+  parent_p (other.parent_p)
+{
+    std::swap (rep_p, other.rep_p);
+}
+
+Record& Record::operator= (Record&& other)
+{
+    if (this != &other) {
+	if (! isFixed()  ||  nfields() == 0) {
+	    // Give the other record an empty representation.
+	    rep_p = other.rep_p;
+	    other.rep_p = emptyRepForMove();
+	}else{
+	    *this = static_cast<const Record&>(other);
+	}
+    }
+    return *this;
+}
+
 Record& Record::operator= (const Record& other)
 {
     // Assignment is only possible when the Record is empty or
@@ -177,6 +177,7 @@ class AipsIO;
 class Record : public RecordInterface
 {
 friend class RecordRep;
+friend class RecordBinaryIO;
 
 public:
     // Create a record with no fields.
@@ -205,6 +206,9 @@ public:
     // Create a copy of other using copy semantics.
     Record (const Record& other);
 
+    // Move constructor. The other record is left empty.
+    Record (Record&& other);
+
     // Create a Record from another type of record using copy semantics.
     // Subrecords are also converted to a Record.
     Record (const RecordInterface& other);
@@ -230,6 +234,12 @@ public:
     // be copied.
     // </note>
     Record& operator= (const Record& other);
+
+    // Move assignment. For a variable structured (or empty) record it takes
+    // over the representation of the other record, thus avoids that the
+    // data have to be copied when either record is changed thereafter.
+    // For a fixed structured record it is the same as copy assignment.
+    Record& operator= (Record&& other);
     
     // Release resources associated with this object.
     ~Record();
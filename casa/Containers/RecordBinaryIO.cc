@@ -0,0 +1,609 @@
+//# RecordBinaryIO.cc: Fast binary serialization of a Record
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/Containers/RecordBinaryIO.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Containers/RecordRep.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/MemoryIO.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+
+  // Layout of the message header (20 bytes):
+  //   3 bytes  magic value "CRB"
+  //   1 byte   format version
+  //   1 byte   byte order (0=big endian, 1=little endian)
+  //   1 byte   record type
+  //   1 byte   1 = description follows the header
+  //   1 byte   unused
+  //   4 bytes  description id
+  //   8 bytes  total message length (including header)
+  const char   theMagic[3]   = {'C', 'R', 'B'};
+  const uChar  theVersion    = 1;
+  const size_t theHeaderSize = 20;
+
+#if defined(AIPS_LITTLE_ENDIAN)
+  const uChar theHostOrder = 1;
+#else
+  const uChar theHostOrder = 0;
+#endif
+
+  // Swap the bytes of each word in the data.
+  void swapWords (void* data, size_t nbytes, size_t wordSize)
+  {
+    if (wordSize > 1) {
+      char* ptr = static_cast<char*>(data);
+      for (size_t i=0; i<nbytes; i+=wordSize) {
+        std::reverse (ptr+i, ptr+i+wordSize);
+      }
+    }
+  }
+
+  // Append bytes to the buffer.
+  inline void putBytes (std::vector<char>& buf, const void* data,
+                        size_t nbytes)
+  {
+    const char* ptr = static_cast<const char*>(data);
+    buf.insert (buf.end(), ptr, ptr+nbytes);
+  }
+
+  template<typename T>
+  inline void putValue (std::vector<char>& buf, const T& value)
+  {
+    putBytes (buf, &value, sizeof(T));
+  }
+
+  inline void putString (std::vector<char>& buf, const String& value)
+  {
+    putValue (buf, uInt(value.size()));
+    putBytes (buf, value.data(), value.size());
+  }
+
+  void putShape (std::vector<char>& buf, const IPosition& shape)
+  {
+    putValue (buf, uInt(shape.size()));
+    for (size_t i=0; i<shape.size(); ++i) {
+      putValue (buf, Int64(shape[i]));
+    }
+  }
+
+  template<typename T>
+  void putArray (std::vector<char>& buf, const void* ptr)
+  {
+    const Array<T>& arr = *static_cast<const Array<T>*>(ptr);
+    putShape (buf, arr.shape());
+    Bool deleteIt;
+    const T* data = arr.getStorage (deleteIt);
+    putBytes (buf, data, arr.size() * sizeof(T));
+    arr.freeStorage (data, deleteIt);
+  }
+
+  void putStringArray (std::vector<char>& buf, const void* ptr)
+  {
+    const Array<String>& arr = *static_cast<const Array<String>*>(ptr);
+    putShape (buf, arr.shape());
+    for (const String& str : arr) {
+      putString (buf, str);
+    }
+  }
+
+  // Put the description using AipsIO, which is fine because it is
+  // done only once for each structure.
+  void putDesc (std::vector<char>& buf, const RecordDesc& desc)
+  {
+    std::shared_ptr<MemoryIO> memio = std::make_shared<MemoryIO>();
+    AipsIO aio(memio);
+    aio << desc;
+    aio.close();
+    putValue (buf, uInt64(memio->length()));
+    putBytes (buf, memio->getBuffer(), memio->length());
+  }
+
+} //# end anonymous namespace
+
+
+// Decoder keeping track of the position in the message.
+struct RecordBinaryIO::Decoder
+{
+  Decoder (const char* data, size_t size, Bool swap)
+    : ptr  (data),
+      end  (data+size),
+      swap (swap)
+  {}
+
+  void get (void* to, size_t nbytes, size_t wordSize)
+  {
+    if (size_t(end-ptr) < nbytes) {
+      throw AipsError ("RecordBinaryIO: message is truncated");
+    }
+    memcpy (to, ptr, nbytes);
+    ptr += nbytes;
+    if (swap) {
+      swapWords (to, nbytes, wordSize);
+    }
+  }
+
+  template<typename T>
+  T getValue()
+  {
+    T value;
+    get (&value, sizeof(T), sizeof(T));
+    return value;
+  }
+
+  void getString (String& value)
+  {
+    uInt n = getValue<uInt>();
+    if (size_t(end-ptr) < n) {
+      throw AipsError ("RecordBinaryIO: message is truncated");
+    }
+    value.assign (ptr, n);
+    ptr += n;
+  }
+
+  IPosition getShape()
+  {
+    uInt ndim = getValue<uInt>();
+    IPosition shape(ndim);
+    for (uInt i=0; i<ndim; ++i) {
+      shape[i] = getValue<Int64>();
+    }
+    return shape;
+  }
+
+  RecordDesc getDesc()
+  {
+    uInt64 n = getValue<uInt64>();
+    if (uInt64(end-ptr) < n) {
+      throw AipsError ("RecordBinaryIO: message is truncated");
+    }
+    std::shared_ptr<MemoryIO> memio = std::make_shared<MemoryIO>(ptr, n);
+    AipsIO aio(memio);
+    RecordDesc desc;
+    aio >> desc;
+    ptr += n;
+    return desc;
+  }
+
+  // Get an array into the field. Its storage is reused if the field is
+  // not shared and has the correct shape.
+  template<typename T>
+  void getArray (void* ptr, size_t wordSize)
+  {
+    Array<T>& arr = *static_cast<Array<T>*>(ptr);
+    IPosition shape = getShape();
+    if (arr.nrefs() > 1) {
+      arr.reference (Array<T>());
+    }
+    arr.resize (shape);
+    Bool deleteIt;
+    T* data = arr.getStorage (deleteIt);
+    get (data, arr.size() * sizeof(T), wordSize);
+    arr.putStorage (data, deleteIt);
+  }
+
+  void getStringArray (void* ptr)
+  {
+    Array<String>& arr = *static_cast<Array<String>*>(ptr);
+    IPosition shape = getShape();
+    if (arr.nrefs() > 1) {
+      arr.reference (Array<String>());
+    }
+    arr.resize (shape);
+    for (String& str : arr) {
+      getString (str);
+    }
+  }
+
+  const char* ptr;
+  const char* end;
+  Bool        swap;
+};
+
+
+RecordBinaryIO::RecordBinaryIO()
+  : itsLastWrite (0)
+{}
+
+void RecordBinaryIO::clearCache()
+{
+  itsWriteDescs.clear();
+  itsReadDescs.clear();
+  itsLastWrite = 0;
+}
+
+Bool RecordBinaryIO::sameDesc (const RecordDesc& left,
+                               const RecordDesc& right)
+{
+  uInt nfield = left.nfields();
+  if (right.nfields() != nfield) {
+    return False;
+  }
+  for (uInt i=0; i<nfield; ++i) {
+    if (left.type(i) != right.type(i)  ||  left.name(i) != right.name(i)
+    ||  !left.shape(i).isEqual (right.shape(i))
+    ||  left.comment(i) != right.comment(i)) {
+      return False;
+    }
+    if (left.isSubRecord(i)) {
+      if (! sameDesc (left.subRecord(i), right.subRecord(i))) {
+        return False;
+      }
+    } else if (left.isTable(i)) {
+      if (left.tableDescName(i) != right.tableDescName(i)) {
+        return False;
+      }
+    }
+  }
+  return True;
+}
+
+uInt RecordBinaryIO::findWriteDesc (const RecordDesc& desc, Bool& isNew)
+{
+  isNew = False;
+  // Usually the same structure is written over and over again.
+  if (itsLastWrite < itsWriteDescs.size()  &&
+      sameDesc (desc, itsWriteDescs[itsLastWrite])) {
+    return itsLastWrite;
+  }
+  for (uInt i=0; i<itsWriteDescs.size(); ++i) {
+    if (sameDesc (desc, itsWriteDescs[i])) {
+      itsLastWrite = i;
+      return i;
+    }
+  }
+  isNew = True;
+  itsWriteDescs.push_back (desc);
+  itsLastWrite = itsWriteDescs.size() - 1;
+  return itsLastWrite;
+}
+
+void RecordBinaryIO::encode (const Record& record, std::vector<char>& buffer)
+{
+  size_t start = buffer.size();
+  Bool isNew;
+  uInt id = findWriteDesc (record.description(), isNew);
+  buffer.resize (start + theHeaderSize);
+  if (isNew) {
+    putDesc (buffer, record.description());
+  }
+  putValues (buffer, record);
+  // Fill in the header.
+  uInt64 length = buffer.size() - start;
+  char* hdr = buffer.data() + start;
+  memcpy (hdr, theMagic, 3);
+  hdr[3] = theVersion;
+  hdr[4] = theHostOrder;
+  hdr[5] = record.recordType();
+  hdr[6] = isNew  ?  1 : 0;
+  hdr[7] = 0;
+  memcpy (hdr+8, &id, 4);
+  memcpy (hdr+12, &length, 8);
+}
+
+void RecordBinaryIO::putValues (std::vector<char>& buf, const Record& record)
+{
+  const RecordDesc& desc = record.description();
+  uInt nfield = desc.nfields();
+  for (uInt i=0; i<nfield; ++i) {
+    DataType type = desc.type(i);
+    const void* ptr = record.get_pointer (i, type);
+    switch (type) {
+    case TpBool:
+      putValue (buf, *static_cast<const Bool*>(ptr));
+      break;
+    case TpUChar:
+      putValue (buf, *static_cast<const uChar*>(ptr));
+      break;
+    case TpShort:
+      putValue (buf, *static_cast<const Short*>(ptr));
+      break;
+    case TpInt:
+      putValue (buf, *static_cast<const Int*>(ptr));
+      break;
+    case TpUInt:
+      putValue (buf, *static_cast<const uInt*>(ptr));
+      break;
+    case TpInt64:
+      putValue (buf, *static_cast<const Int64*>(ptr));
+      break;
+    case TpFloat:
+      putValue (buf, *static_cast<const Float*>(ptr));
+      break;
+    case TpDouble:
+      putValue (buf, *static_cast<const Double*>(ptr));
+      break;
+    case TpComplex:
+      putValue (buf, *static_cast<const Complex*>(ptr));
+      break;
+    case TpDComplex:
+      putValue (buf, *static_cast<const DComplex*>(ptr));
+      break;
+    case TpString:
+      putString (buf, *static_cast<const String*>(ptr));
+      break;
+    case TpArrayBool:
+      putArray<Bool> (buf, ptr);
+      break;
+    case TpArrayUChar:
+      putArray<uChar> (buf, ptr);
+      break;
+    case TpArrayShort:
+      putArray<Short> (buf, ptr);
+      break;
+    case TpArrayInt:
+      putArray<Int> (buf, ptr);
+      break;
+    case TpArrayUInt:
+      putArray<uInt> (buf, ptr);
+      break;
+    case TpArrayInt64:
+      putArray<Int64> (buf, ptr);
+      break;
+    case TpArrayFloat:
+      putArray<Float> (buf, ptr);
+      break;
+    case TpArrayDouble:
+      putArray<Double> (buf, ptr);
+      break;
+    case TpArrayComplex:
+      putArray<Complex> (buf, ptr);
+      break;
+    case TpArrayDComplex:
+      putArray<DComplex> (buf, ptr);
+      break;
+    case TpArrayString:
+      putStringArray (buf, ptr);
+      break;
+    case TpRecord:
+      {
+        const Record& sub = *static_cast<const Record*>(ptr);
+        // A subrecord with a variable structure has its own description.
+        if (desc.subRecord(i).nfields() == 0) {
+          putDesc (buf, sub.description());
+          putValue (buf, uChar(sub.recordType()));
+        }
+        putValues (buf, sub);
+      }
+      break;
+    default:
+      throw AipsError ("RecordBinaryIO: cannot write field " + desc.name(i) +
+                       " of data type " + String::toString(type));
+    }
+  }
+}
+
+size_t RecordBinaryIO::decode (Record& record, const void* buffer, size_t size)
+{
+  const char* hdr = static_cast<const char*>(buffer);
+  if (size < theHeaderSize  ||  memcmp (hdr, theMagic, 3) != 0) {
+    throw AipsError ("RecordBinaryIO: no valid message header found");
+  }
+  if (uChar(hdr[3]) > theVersion) {
+    throw AipsError ("RecordBinaryIO: message format version " +
+                     String::toString(Int(hdr[3])) + " is not supported");
+  }
+  Bool swap = (hdr[4] != theHostOrder);
+  Int recordType = hdr[5];
+  Bool hasDesc = (hdr[6] != 0);
+  uInt id;
+  uInt64 length;
+  memcpy (&id, hdr+8, 4);
+  memcpy (&length, hdr+12, 8);
+  if (swap) {
+    swapWords (&id, 4, 4);
+    swapWords (&length, 8, 8);
+  }
+  if (length > size) {
+    throw AipsError ("RecordBinaryIO: message is truncated");
+  }
+  Decoder dec(hdr + theHeaderSize, length - theHeaderSize, swap);
+  if (hasDesc) {
+    if (id > itsReadDescs.size()) {
+      throw AipsError ("RecordBinaryIO: description id " +
+                       String::toString(id) + " is out of order");
+    }
+    if (id == itsReadDescs.size()) {
+      itsReadDescs.push_back (dec.getDesc());
+    } else {
+      itsReadDescs[id] = dec.getDesc();
+    }
+  } else if (id >= itsReadDescs.size()) {
+    throw AipsError ("RecordBinaryIO: unknown description id " +
+                     String::toString(id) +
+                     "; the message defining it has not been read");
+  }
+  setDesc (record, itsReadDescs[id], recordType);
+  getValues (dec, record);
+  return length;
+}
+
+void RecordBinaryIO::setDesc (Record& record, const RecordDesc& desc,
+                              Int recordType)
+{
+  // Only restructure if needed, so the fields can be filled in place.
+  if (! sameDesc (record.description(), desc)) {
+    if (record.isFixed()  &&  record.nfields() > 0) {
+      throw AipsError ("RecordBinaryIO: cannot read a record with another "
+                       "structure into a fixed record");
+    }
+    record.rwRef().restructure (desc, True);
+  }
+  record.recordType() = RecordInterface::RecordType(recordType);
+}
+
+void RecordBinaryIO::getValues (Decoder& dec, Record& record)
+{
+  RecordRep& rep = record.rwRef();
+  const RecordDesc& desc = record.description();
+  uInt nfield = desc.nfields();
+  for (uInt i=0; i<nfield; ++i) {
+    DataType type = desc.type(i);
+    void* ptr = rep.get_pointer (i, type);
+    switch (type) {
+    case TpBool:
+    case TpUChar:
+      dec.get (ptr, 1, 1);
+      break;
+    case TpShort:
+      dec.get (ptr, sizeof(Short), sizeof(Short));
+      break;
+    case TpInt:
+    case TpUInt:
+    case TpFloat:
+      dec.get (ptr, 4, 4);
+      break;
+    case TpInt64:
+    case TpDouble:
+      dec.get (ptr, 8, 8);
+      break;
+    case TpComplex:
+      dec.get (ptr, sizeof(Complex), sizeof(Float));
+      break;
+    case TpDComplex:
+      dec.get (ptr, sizeof(DComplex), sizeof(Double));
+      break;
+    case TpString:
+      dec.getString (*static_cast<String*>(ptr));
+      break;
+    case TpArrayBool:
+      dec.getArray<Bool> (ptr, 1);
+      break;
+    case TpArrayUChar:
+      dec.getArray<uChar> (ptr, 1);
+      break;
+    case TpArrayShort:
+      dec.getArray<Short> (ptr, sizeof(Short));
+      break;
+    case TpArrayInt:
+      dec.getArray<Int> (ptr, sizeof(Int));
+      break;
+    case TpArrayUInt:
+      dec.getArray<uInt> (ptr, sizeof(uInt));
+      break;
+    case TpArrayInt64:
+      dec.getArray<Int64> (ptr, sizeof(Int64));
+      break;
+    case TpArrayFloat:
+      dec.getArray<Float> (ptr, sizeof(Float));
+      break;
+    case TpArrayDouble:
+      dec.getArray<Double> (ptr, sizeof(Double));
+      break;
+    case TpArrayComplex:
+      dec.getArray<Complex> (ptr, sizeof(Float));
+      break;
+    case TpArrayDComplex:
+      dec.getArray<DComplex> (ptr, sizeof(Double));
+      break;
+    case TpArrayString:
+      dec.getStringArray (ptr);
+      break;
+    case TpRecord:
+      {
+        Record& sub = *static_cast<Record*>(ptr);
+        if (desc.subRecord(i).nfields() == 0) {
+          RecordDesc subDesc = dec.getDesc();
+          setDesc (sub, subDesc, dec.getValue<uChar>());
+        }
+        getValues (dec, sub);
+      }
+      break;
+    default:
+      throw AipsError ("RecordBinaryIO: cannot read field " + desc.name(i) +
+                       " of data type " + String::toString(type));
+    }
+  }
+}
+
+void RecordBinaryIO::write (ByteIO& io, const Record& record)
+{
+  itsBuffer.clear();
+  encode (record, itsBuffer);
+  io.write (itsBuffer.size(), itsBuffer.data());
+}
+
+void RecordBinaryIO::read (ByteIO& io, Record& record)
+{
+  // A MemoryIO can be decoded directly from its buffer.
+  MemoryIO* memio = dynamic_cast<MemoryIO*>(&io);
+  if (memio) {
+    Int64 pos = memio->seek (Int64(0), ByteIO::Current);
+    size_t n = decode (record, memio->getBuffer() + pos,
+                       memio->length() - pos);
+    memio->seek (Int64(n), ByteIO::Current);
+    return;
+  }
+  // Otherwise read the header to know the message length.
+  itsBuffer.resize (theHeaderSize);
+  io.read (theHeaderSize, itsBuffer.data());
+  uInt64 length;
+  memcpy (&length, itsBuffer.data()+12, 8);
+  if (itsBuffer[4] != theHostOrder) {
+    swapWords (&length, 8, 8);
+  }
+  if (length < theHeaderSize) {
+    throw AipsError ("RecordBinaryIO: no valid message header found");
+  }
+  itsBuffer.resize (length);
+  io.read (length - theHeaderSize, itsBuffer.data() + theHeaderSize);
+  decode (record, itsBuffer.data(), itsBuffer.size());
+}
+
+void RecordBinaryIO::write (AipsIO& os, const Record& record)
+{
+  itsBuffer.clear();
+  encode (record, itsBuffer);
+  if (itsBuffer.size() > 0xffffffffu) {
+    throw AipsError ("RecordBinaryIO: message too large to write to AipsIO");
+  }
+  os.putstart ("RecordBinaryIO", 1);
+  os.put (uInt(itsBuffer.size()),
+          reinterpret_cast<const uChar*>(itsBuffer.data()));
+  os.putend();
+}
+
+void RecordBinaryIO::read (AipsIO& os, Record& record)
+{
+  os.getstart ("RecordBinaryIO");
+  uInt n;
+  os >> n;
+  itsBuffer.resize (n);
+  os.get (n, reinterpret_cast<uChar*>(itsBuffer.data()));
+  os.getend();
+  decode (record, itsBuffer.data(), itsBuffer.size());
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,186 @@
+//# RecordBinaryIO.h: Fast binary serialization of a Record
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_RECORDBINARYIO_H
+#define CASA_RECORDBINARYIO_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Containers/RecordDesc.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Record;
+class AipsIO;
+class ByteIO;
+
+
+// <summary>
+// Fast binary serialization of a Record.
+// </summary>
+
+// <use visibility=export>
+// <reviewed reviewer="" date="" tests="tRecordBinaryIO">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=Record>Record</linkto>
+// </prerequisite>
+
+// <synopsis>
+// RecordBinaryIO writes and reads a Record in a compact binary format.
+// It is meant for records that are serialized often, such as messages
+// exchanged between processes or the keywords of many subtables.
+// Compared to writing a Record with AipsIO it is faster because:
+// <ul>
+//  <li> The description (schema) of a record is written only once.
+//       The object keeps a cache of the descriptions written (and read),
+//       so a message for a record having the same structure as a previous
+//       one only contains the id of its description.
+//       Thus the reader and writer of a stream of messages should each use
+//       a single RecordBinaryIO object for the entire stream.
+//  <li> The values are written in the native byte order of the writer,
+//       so no canonical conversion is done. The byte order is stored in
+//       the message and the reader only swaps bytes if its byte order
+//       differs. Arrays are copied with a single memcpy.
+//  <li> Field names and data type tags are not part of the data.
+// </ul>
+// When reading a message whose description matches the description of the
+// Record read into, the Record is not restructured; its fields are filled
+// in place, so array storage of the right shape is reused.
+// <p>
+// A message consists of a fixed header followed by the optional description
+// and the values. The header contains a magic value, the byte order,
+// the record type, the description id and the total message length.
+// The values are written in field order, where strings are written as a
+// length followed by the characters and arrays as their shape followed
+// by the values. A subrecord with a variable structure is written with its
+// own description.
+// <p>
+// Functions are available to encode/decode a message to/from a memory
+// buffer and to write/read it to/from a ByteIO or AipsIO object.
+// Reading from a MemoryIO is done directly from its buffer.
+// <br>A TableRecord can be serialized by means of its functions
+// <src>toRecord</src> and <src>fromRecord</src>.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   // Send a record for each time stamp using the same encoder.
+//   RecordBinaryIO encoder;
+//   std::vector<char> buffer;
+//   for (...) {
+//     buffer.clear();
+//     encoder.encode (record, buffer);
+//     send (buffer.data(), buffer.size());
+//   }
+//   // The receiving end uses a single decoder.
+//   RecordBinaryIO decoder;
+//   Record rec;
+//   decoder.decode (rec, message, messageLength);
+// </srcblock>
+// </example>
+
+// <motivation>
+// Writing a Record with AipsIO converts each value to canonical format and
+// writes the full description for each record, which is slow for records
+// that are serialized many times.
+// </motivation>
+
+class RecordBinaryIO
+{
+public:
+    // Create the object with empty description caches.
+    RecordBinaryIO();
+
+    // Encode the record and append the message to the buffer.
+    void encode (const Record& record, std::vector<char>& buffer);
+
+    // Decode a message from the buffer into the record and return the
+    // number of bytes used. The buffer can contain more data.
+    // <br>The record is restructured if the message has a different
+    // description, which is only possible if the record is not fixed
+    // or empty.
+    size_t decode (Record& record, const void* buffer, size_t size);
+
+    // Write the record to the ByteIO object.
+    void write (ByteIO& io, const Record& record);
+
+    // Read a record from the ByteIO object.
+    // If the ByteIO object is a MemoryIO, the message is decoded directly
+    // from its buffer.
+    void read (ByteIO& io, Record& record);
+
+    // Write the record to the AipsIO object as a single object.
+    void write (AipsIO& os, const Record& record);
+
+    // Read a record written by the write function above.
+    void read (AipsIO& os, Record& record);
+
+    // Clear the description caches. It should be done by both the writer
+    // and the reader, e.g. when a new stream is started.
+    void clearCache();
+
+    // Get the number of descriptions in the write or read cache.
+    // <group>
+    uInt nwriteCache() const
+      { return itsWriteDescs.size(); }
+    uInt nreadCache() const
+      { return itsReadDescs.size(); }
+    // </group>
+
+    // Test if the two descriptions are identical, including field names,
+    // comments and the descriptions of subrecords.
+    static Bool sameDesc (const RecordDesc& left, const RecordDesc& right);
+
+private:
+    struct Decoder;
+
+    // Put the values of the record's fields into the buffer.
+    static void putValues (std::vector<char>& buf, const Record& record);
+
+    // Get the values of the record's fields from the message.
+    static void getValues (Decoder& dec, Record& record);
+
+    // Restructure the record if its description differs from the given one.
+    static void setDesc (Record& record, const RecordDesc& desc,
+                         Int recordType);
+
+    // Find the description in the write cache. Add it if not found.
+    // It sets <src>isNew</src> if added.
+    uInt findWriteDesc (const RecordDesc& desc, Bool& isNew);
+
+    std::vector<RecordDesc> itsWriteDescs;
+    std::vector<RecordDesc> itsReadDescs;
+    uInt                    itsLastWrite;   //# last description id written
+    std::vector<char>       itsBuffer;      //# buffer used by write and read
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -28,6 +28,7 @@
 
 
 #include <casacore/casa/Containers/RecordField.h>
+#include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Utilities/Assert.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -75,11 +76,24 @@ void RecordFieldPtr<T>::detach()
     fieldNumber_p = -1;
 }
 
+// An array field can share its storage with a copy of the record
+// (copy-on-write), so make it unique before giving write access.
+template<class T>
+inline void recordFieldMakeUnique (T&)
+{}
+template<class T>
+inline void recordFieldMakeUnique (Array<T>& arr)
+{
+    arr.unique();
+}
+
 template<class T>
 T& RecordFieldPtr<T>::operator*()
 {
     parent_p->makeUnique();
-    return const_cast<T&>(get());
+    T& value = const_cast<T&>(get());
+    recordFieldMakeUnique (value);
+    return value;
 }
 
 template<>
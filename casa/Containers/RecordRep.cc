@@ -39,6 +39,42 @@
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+namespace {
+
+  // An array field can share its storage with the same field in a copy of
+  // the record (see RecordRep::copy_other). Before writing into the field,
+  // the storage has to be detached. The contents are not preserved.
+  template<typename T>
+  inline void detachArrayField (void* ptr)
+  {
+    Array<T>& arr = *static_cast<Array<T>*>(ptr);
+    if (arr.nrefs() > 1) {
+      Array<T> empty;
+      arr.reference (empty);
+    }
+  }
+
+  template<typename T>
+  inline void assignArrayField (void* ptr, const void* that)
+  {
+    if (ptr != that) {
+      detachArrayField<T> (ptr);
+      Array<T>& arr = *static_cast<Array<T>*>(ptr);
+      const Array<T>& value = *static_cast<const Array<T>*>(that);
+      arr.resize (value.shape());
+      arr = value;
+    }
+  }
+
+  template<typename T>
+  inline void shareArrayField (void* ptr, const void* that)
+  {
+    static_cast<Array<T>*>(ptr)->reference (*static_cast<const Array<T>*>(that));
+  }
+
+} //# end anonymous namespace
+
+
 // Tweaked for SUN NTV compiler.  Added the const_cast<void*> to give a hint to the Solaris compiler.
 
 
@@ -58,7 +94,7 @@ RecordRep::RecordRep (const RecordRep& other)
   nused_p (0)
 {
     restructure (desc_p, False);
-    copy_other (other);
+    copy_other (other, True);
 }
 
 RecordRep& RecordRep::operator= (const RecordRep& other)
@@ -576,12 +612,14 @@ void RecordRep::copyData (const RecordRep& other)
     copy_other (other);
 }
 
-void RecordRep::copy_other (const RecordRep& other)
+void RecordRep::copy_other (const RecordRep& other, Bool shareArrays)
 {
     for (uInt i=0; i<nused_p; i++) {
 	if (desc_p.type(i) == TpRecord) {
 	    *static_cast<Record*>(data_p[i]) =
 	      *static_cast<Record*>(const_cast<void*>(other.data_p[i]));
+	} else if (shareArrays) {
+	    shareDataField (desc_p.type(i), data_p[i], other.data_p[i]);
 	}else{
 	    copyDataField (desc_p.type(i), data_p[i], other.data_p[i]);
 	}
@@ -632,70 +670,37 @@ void RecordRep::copyDataField (DataType type, void* ptr,
 	*static_cast<String*>(ptr) = *static_cast<const String*>(that);
 	break;
     case TpArrayBool:
-        static_cast<Array<Bool>*>(ptr)->resize
-	  (static_cast<const Array<Bool>*>(that)->shape());
-	*static_cast<Array<Bool>*>(ptr) =
-	  *static_cast<const Array<Bool>*>(that);
+	assignArrayField<Bool> (ptr, that);
 	break;
     case TpArrayUChar:
-	static_cast<Array<uChar>*>(ptr)->resize
-	  (static_cast<const Array<uChar>*>(that)->shape());
-	*static_cast<Array<uChar>*>(ptr) =
-	  *static_cast<const Array<uChar>*>(that);
+	assignArrayField<uChar> (ptr, that);
 	break;
     case TpArrayShort:
-	static_cast<Array<Short>*>(ptr)->resize
-	  (static_cast<const Array<Short>*>(that)->shape());
-	*static_cast<Array<Short>*>(ptr) =
-	  *static_cast<const Array<Short>*>(that);
+	assignArrayField<Short> (ptr, that);
 	break;
     case TpArrayInt:
-	static_cast<Array<Int>*>(ptr)->resize
-	  (static_cast<const Array<Int>*>(that)->shape());
-	*static_cast<Array<Int>*>(ptr) =
-	  *static_cast<const Array<Int>*>(that);
+	assignArrayField<Int> (ptr, that);
 	break;
     case TpArrayUInt:
-	static_cast<Array<uInt>*>(ptr)->resize
-	  (static_cast<const Array<uInt>*>(that)->shape());
-	*static_cast<Array<uInt>*>(ptr) =
-	  *static_cast<const Array<uInt>*>(that);
+	assignArrayField<uInt> (ptr, that);
 	break;
     case TpArrayInt64:
-	static_cast<Array<Int64>*>(ptr)->resize
-	  (static_cast<const Array<Int64>*>(that)->shape());
-	*static_cast<Array<Int64>*>(ptr) 
-	  = *static_cast<const Array<Int64>*>(that);
+	assignArrayField<Int64> (ptr, that);
 	break;
     case TpArrayFloat:
-	static_cast<Array<float>*>(ptr)->resize
-	  (static_cast<const Array<float>*>(that)->shape());
-	*static_cast<Array<float>*>(ptr) 
-	  = *static_cast<const Array<float>*>(that);
+	assignArrayField<float> (ptr, that);
 	break;
     case TpArrayDouble:
-	static_cast<Array<double>*>(ptr)->resize
-	  (static_cast<const Array<double>*>(that)->shape());
-	*static_cast<Array<double>*>(ptr) =
-	  *static_cast<const Array<double>*>(that);
+	assignArrayField<double> (ptr, that);
 	break;
     case TpArrayComplex:
-	static_cast<Array<Complex>*>(ptr)->resize
-	  (static_cast<const Array<Complex>*>(that)->shape());
-	*static_cast<Array<Complex>*>(ptr) =
-	  *static_cast<const Array<Complex>*>(that);
+	assignArrayField<Complex> (ptr, that);
 	break;
     case TpArrayDComplex:
-	static_cast<Array<DComplex>*>(ptr)->resize
-	  (static_cast<const Array<DComplex>*>(that)->shape());
-	*static_cast<Array<DComplex>*>(ptr) =
-	  *static_cast<const Array<DComplex>*>(that);
+	assignArrayField<DComplex> (ptr, that);
 	break;
     case TpArrayString:
-        static_cast<Array<String>*>(ptr)->resize
-	  (static_cast<const Array<String>*>(that)->shape());
-	*static_cast<Array<String>*>(ptr) =
-	  *static_cast<const Array<String>*>(that);
+	assignArrayField<String> (ptr, that);
 	break;
     default:
 	throw (AipsError ("RecordRep::copyDataField"));
@@ -703,6 +708,90 @@ void RecordRep::copyDataField (DataType type, void* ptr,
 }
 
 
+void RecordRep::shareDataField (DataType type, void* ptr,
+                                const void* that) const
+{
+    switch (type) {
+    case TpArrayBool:
+	shareArrayField<Bool> (ptr, that);
+	break;
+    case TpArrayUChar:
+	shareArrayField<uChar> (ptr, that);
+	break;
+    case TpArrayShort:
+	shareArrayField<Short> (ptr, that);
+	break;
+    case TpArrayInt:
+	shareArrayField<Int> (ptr, that);
+	break;
+    case TpArrayUInt:
+	shareArrayField<uInt> (ptr, that);
+	break;
+    case TpArrayInt64:
+	shareArrayField<Int64> (ptr, that);
+	break;
+    case TpArrayFloat:
+	shareArrayField<float> (ptr, that);
+	break;
+    case TpArrayDouble:
+	shareArrayField<double> (ptr, that);
+	break;
+    case TpArrayComplex:
+	shareArrayField<Complex> (ptr, that);
+	break;
+    case TpArrayDComplex:
+	shareArrayField<DComplex> (ptr, that);
+	break;
+    case TpArrayString:
+	shareArrayField<String> (ptr, that);
+	break;
+    default:
+	copyDataField (type, ptr, that);
+    }
+}
+
+void RecordRep::detachDataField (DataType type, void* ptr)
+{
+    switch (type) {
+    case TpArrayBool:
+	detachArrayField<Bool> (ptr);
+	break;
+    case TpArrayUChar:
+	detachArrayField<uChar> (ptr);
+	break;
+    case TpArrayShort:
+	detachArrayField<Short> (ptr);
+	break;
+    case TpArrayInt:
+	detachArrayField<Int> (ptr);
+	break;
+    case TpArrayUInt:
+	detachArrayField<uInt> (ptr);
+	break;
+    case TpArrayInt64:
+	detachArrayField<Int64> (ptr);
+	break;
+    case TpArrayFloat:
+	detachArrayField<float> (ptr);
+	break;
+    case TpArrayDouble:
+	detachArrayField<double> (ptr);
+	break;
+    case TpArrayComplex:
+	detachArrayField<Complex> (ptr);
+	break;
+    case TpArrayDComplex:
+	detachArrayField<DComplex> (ptr);
+	break;
+    case TpArrayString:
+	detachArrayField<String> (ptr);
+	break;
+    default:
+	break;
+    }
+}
+
+
 void* RecordRep::get_pointer (Int whichField, DataType type,
 			      const String& recordType) const
 {
@@ -1259,6 +1348,7 @@ void RecordRep::getData (AipsIO& os, uInt version)
 		static_cast<Record*>(data_p[i])->getData (os, version);
 	    }
 	}else{
+	    detachDataField (desc_p.type(i), data_p[i]);
 	    getDataField (os, desc_p.type(i), data_p[i]);
 	}
     }
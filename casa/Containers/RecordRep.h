@@ -218,7 +218,11 @@ protected:
     // functions.
     // <group>
     void delete_myself (uInt nfields);
-    void copy_other (const RecordRep& other);
+    // If <src>shareArrays=True</src> the array fields share their storage
+    // with the other record (used by the copy constructor which is invoked
+    // by the copy-on-write mechanism of class Record). The storage of such
+    // a field is detached when the field is written.
+    void copy_other (const RecordRep& other, Bool shareArrays = False);
     // </group>
 
     // Get the field number for a given name.
@@ -258,6 +262,16 @@ protected:
     // This can only handle scalars and arrays.
     void copyDataField (DataType type, void* ptr, const void* that) const;
 
+    // Copy a data field, but let an array field reference the storage of
+    // the other array (thus copy-on-write sharing).
+    // This can only handle scalars and arrays.
+    void shareDataField (DataType type, void* ptr, const void* that) const;
+
+    // Detach the storage of an array field from the storage shared with
+    // another record, so it can be overwritten (the values get lost).
+    // Scalar fields are left alone.
+    static void detachDataField (DataType type, void* ptr);
+
     // Print a data field.
     // This can only handle scalars and arrays.
     void printDataField (std::ostream& os, DataType type,
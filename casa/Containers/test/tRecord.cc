@@ -54,11 +54,13 @@
 
 void check (const Record&, Int intValue, uInt nrField);
 void doIt (Bool doExcp);
+void doCopyMove();
 
 int main (int argc, const char*[])
 {
     try {
 	doIt ( (argc<2));
+	doCopyMove();
     } catch (std::exception& x) {
 	cout << "Caught an exception: " << x.what() << endl;
 	return 1;
@@ -187,6 +189,31 @@ void doDefineAssign (const Record& inrecord)
     }
 }
 
+// Check that a copied record shares its arrays until one of them is
+// changed, and that moving a record leaves an empty record behind.
+void doCopyMove()
+{
+    Record record;
+    record.define ("arr", Vector<Int>(4, 1));
+    record.define ("int", 3);
+    Record copy (record);
+    RecordFieldPtr<Array<Int> > rfarr (copy, "arr");
+    (*rfarr)(IPosition(1,0)) = 5;
+    AlwaysAssertExit (allEQ (record.asArrayInt ("arr"), 1));
+    AlwaysAssertExit (copy.asArrayInt("arr")(IPosition(1,0)) == 5);
+    Record copy2 (record);
+    copy2.define ("arr", Vector<Int>(4, 7));
+    AlwaysAssertExit (allEQ (record.asArrayInt ("arr"), 1));
+    AlwaysAssertExit (allEQ (copy2.asArrayInt ("arr"), 7));
+    Record moved (std::move(copy));
+    AlwaysAssertExit (moved.nfields() == 2  &&  copy.nfields() == 0);
+    AlwaysAssertExit (moved.asArrayInt("arr")(IPosition(1,0)) == 5);
+    Record assigned;
+    assigned = std::move(moved);
+    AlwaysAssertExit (assigned.nfields() == 2  &&  moved.nfields() == 0);
+    AlwaysAssertExit (assigned.asInt ("int") == 3);
+}
+
 void doSubRecord (Bool doExcp, const RecordDesc& desc)
 {
     Int subField  = desc.fieldNumber ("SubRecord");
@@ -0,0 +1,266 @@
+//# tRecordBinaryIO.cc: Test the RecordBinaryIO class
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/Containers/RecordBinaryIO.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Containers/RecordField.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/MemoryIO.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <memory>
+
+using namespace casacore;
+
+Record makeRecord (Int value)
+{
+  Record rec;
+  rec.define ("bool", True);
+  rec.define ("uchar", uChar(value));
+  rec.define ("short", Short(-value));
+  rec.define ("int", value);
+  rec.define ("uint", uInt(value+1));
+  rec.define ("int64", Int64(value) * 1000000000);
+  rec.define ("float", Float(value) / 4);
+  rec.define ("double", Double(value) / 3);
+  rec.define ("complex", Complex(value, -value));
+  rec.define ("dcomplex", DComplex(-value, value));
+  rec.define ("string", "str" + String::toString(value));
+  rec.setComment ("string", "a comment");
+  Matrix<Float> mat(3, 4);
+  indgen (mat, Float(value));
+  rec.define ("arrfloat", mat);
+  Vector<String> vecs(3);
+  vecs[0] = "a";
+  vecs[2] = String::toString(value);
+  rec.define ("arrstring", vecs);
+  rec.define ("arrbool", Vector<Bool>(5, False));
+  rec.define ("arrdcomplex", Vector<DComplex>(2, DComplex(1, value)));
+  Record sub;
+  sub.define ("subint", value*2);
+  sub.define ("subarr", Vector<Int64>(4, value));
+  rec.defineRecord ("sub", sub);
+  // A fixed subrecord (with described fields).
+  RecordDesc fdesc;
+  fdesc.addField ("fint", TpInt);
+  Record fsub(fdesc);
+  fsub.define ("fint", -value);
+  rec.defineRecord ("fsub", fsub, RecordInterface::Fixed);
+  return rec;
+}
+
+void checkRecord (const Record& rec, Int value)
+{
+  Record exp = makeRecord (value);
+  AlwaysAssertExit (RecordBinaryIO::sameDesc (rec.description(),
+                                              exp.description()));
+  AlwaysAssertExit (rec.asBool("bool") == True);
+  AlwaysAssertExit (rec.asuChar("uchar") == uChar(value));
+  AlwaysAssertExit (rec.asShort("short") == Short(-value));
+  AlwaysAssertExit (rec.asInt("int") == value);
+  AlwaysAssertExit (rec.asuInt("uint") == uInt(value+1));
+  AlwaysAssertExit (rec.asInt64("int64") == Int64(value) * 1000000000);
+  AlwaysAssertExit (rec.asFloat("float") == Float(value) / 4);
+  AlwaysAssertExit (rec.asDouble("double") == Double(value) / 3);
+  AlwaysAssertExit (rec.asComplex("complex") == Complex(value, -value));
+  AlwaysAssertExit (rec.asDComplex("dcomplex") == DComplex(-value, value));
+  AlwaysAssertExit (rec.asString("string") == exp.asString("string"));
+  AlwaysAssertExit (rec.comment("string") == "a comment");
+  AlwaysAssertExit (allEQ (rec.asArrayFloat("arrfloat"),
+                           exp.asArrayFloat("arrfloat")));
+  AlwaysAssertExit (allEQ (rec.asArrayString("arrstring"),
+                           exp.asArrayString("arrstring")));
+  AlwaysAssertExit (allEQ (rec.asArrayBool("arrbool"), False));
+  AlwaysAssertExit (allEQ (rec.asArrayDComplex("arrdcomplex"),
+                           DComplex(1, value)));
+  const Record& sub = rec.subRecord("sub");
+  AlwaysAssertExit (sub.asInt("subint") == value*2);
+  AlwaysAssertExit (allEQ (sub.asArrayInt64("subarr"), Int64(value)));
+  AlwaysAssertExit (rec.subRecord("fsub").asInt("fint") == -value);
+}
+
+// Encode a few records in a buffer and decode them.
+// The description is only written for the first one.
+void testBuffer()
+{
+  RecordBinaryIO writer;
+  std::vector<char> buf;
+  std::vector<size_t> sizes;
+  for (Int i=0; i<5; ++i) {
+    size_t st = buf.size();
+    writer.encode (makeRecord(i), buf);
+    sizes.push_back (buf.size() - st);
+  }
+  AlwaysAssertExit (writer.nwriteCache() == 1);
+  AlwaysAssertExit (sizes[1] < sizes[0]);
+  AlwaysAssertExit (sizes[2] == sizes[1]);
+  RecordBinaryIO reader;
+  Record rec;
+  size_t pos = 0;
+  for (Int i=0; i<5; ++i) {
+    pos += reader.decode (rec, buf.data() + pos, buf.size() - pos);
+    checkRecord (rec, i);
+  }
+  AlwaysAssertExit (pos == buf.size());
+  AlwaysAssertExit (reader.nreadCache() == 1);
+  // A record with another structure gets a new description.
+  Record other;
+  other.define ("x", 1.5);
+  buf.clear();
+  writer.encode (other, buf);
+  writer.encode (makeRecord(7), buf);
+  AlwaysAssertExit (writer.nwriteCache() == 2);
+  pos = reader.decode (rec, buf.data(), buf.size());
+  AlwaysAssertExit (rec.nfields() == 1  &&  rec.asDouble("x") == 1.5);
+  reader.decode (rec, buf.data() + pos, buf.size() - pos);
+  checkRecord (rec, 7);
+  AlwaysAssertExit (reader.nreadCache() == 2);
+}
+
+// Decoding into a record with the same structure fills it in place,
+// so RecordFieldPtr objects stay valid.
+void testInPlace()
+{
+  RecordBinaryIO writer;
+  RecordBinaryIO reader;
+  std::vector<char> buf;
+  writer.encode (makeRecord(1), buf);
+  Record rec;
+  reader.decode (rec, buf.data(), buf.size());
+  RecordFieldPtr<Int> fint (rec, "int");
+  Record copy(rec);
+  buf.clear();
+  writer.encode (makeRecord(2), buf);
+  reader.decode (rec, buf.data(), buf.size());
+  AlwaysAssertExit (*fint == 2);
+  checkRecord (rec, 2);
+  // The copy sharing the arrays is not changed.
+  checkRecord (copy, 1);
+}
+
+void testErrors()
+{
+  RecordBinaryIO writer;
+  std::vector<char> buf;
+  writer.encode (makeRecord(1), buf);
+  size_t size1 = buf.size();
+  writer.encode (makeRecord(2), buf);
+  // The second message cannot be read without the first one.
+  {
+    RecordBinaryIO reader;
+    Record rec;
+    Bool failed = False;
+    try {
+      reader.decode (rec, buf.data() + size1, buf.size() - size1);
+    } catch (const AipsError&) {
+      failed = True;
+    }
+    AlwaysAssertExit (failed);
+  }
+  // A truncated message.
+  {
+    RecordBinaryIO reader;
+    Record rec;
+    Bool failed = False;
+    try {
+      reader.decode (rec, buf.data(), size1 - 1);
+    } catch (const AipsError&) {
+      failed = True;
+    }
+    AlwaysAssertExit (failed);
+  }
+  // A fixed record with another structure.
+  {
+    RecordBinaryIO reader;
+    RecordDesc desc;
+    desc.addField ("a", TpInt);
+    Record rec(desc);
+    Bool failed = False;
+    try {
+      reader.decode (rec, buf.data(), size1);
+    } catch (const AipsError&) {
+      failed = True;
+    }
+    AlwaysAssertExit (failed);
+  }
+}
+
+void testMemoryIO()
+{
+  RecordBinaryIO writer;
+  MemoryIO memio;
+  for (Int i=0; i<3; ++i) {
+    writer.write (memio, makeRecord(i));
+  }
+  memio.seek (Int64(0));
+  RecordBinaryIO reader;
+  Record rec;
+  for (Int i=0; i<3; ++i) {
+    reader.read (memio, rec);
+    checkRecord (rec, i);
+  }
+  AlwaysAssertExit (memio.seek (Int64(0), ByteIO::Current) == memio.length());
+}
+
+void testAipsIO()
+{
+  std::shared_ptr<MemoryIO> memio = std::make_shared<MemoryIO>();
+  {
+    AipsIO aio(memio);
+    RecordBinaryIO writer;
+    for (Int i=0; i<3; ++i) {
+      writer.write (aio, makeRecord(i));
+    }
+  }
+  memio->seek (Int64(0));
+  AipsIO aio(memio);
+  RecordBinaryIO reader;
+  Record rec;
+  for (Int i=0; i<3; ++i) {
+    reader.read (aio, rec);
+    checkRecord (rec, i);
+  }
+}
+
+int main()
+{
+  try {
+    testBuffer();
+    testInPlace();
+    testErrors();
+    testMemoryIO();
+    testAipsIO();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
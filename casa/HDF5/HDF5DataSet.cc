@@ -35,82 +35,92 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const Bool* type)
+			    const Bool* type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const uChar* type)
+			    const uChar* type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const Short* type)
+			    const Short* type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const Int* type)
+			    const Int* type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const Int64* type)
+			    const Int64* type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const Float* type)
+			    const Float* type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const Double* type)
+			    const Double* type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
  
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const Complex* type)
+			    const Complex* type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const DComplex* type)
+			    const DComplex* type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const HDF5DataType& type)
+			    const HDF5DataType& type, Compression compression,
+			    uInt compressionLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compression, compressionLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
@@ -191,9 +201,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 #ifdef HAVE_HDF5
 
   void HDF5DataSet::create (const HDF5Object& parentHid, const String& name,
-			    const IPosition& shape, const IPosition& tileShape)
+			    const IPosition& shape, const IPosition& tileShape,
+			    Compression compression, uInt compressionLevel)
   {
     itsParent = &parentHid;
+    itsCompression = NoCompression;
     setName (name);
     // Get the array shape and tile shape. Adjust as needed.
     AlwaysAssert (shape.nelements() >= tileShape.nelements(), AipsError);
@@ -201,10 +213,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsTileShape = IPosition(shape.nelements(), 1);
     // Trailing elements already have value 1; set the first elements.
     for (uInt i=0; i<tileShape.nelements(); ++i) {
+      itsTileShape[i] = std::max(ssize_t(1), tileShape[i]);
       if (shape[i] > 0) {
-        itsTileShape[i] = std::min(tileShape[i], shape[i]);
+        itsTileShape[i] = std::min(itsTileShape[i], shape[i]);
       }
-      itsTileShape[i] = std::max(ssize_t(1), tileShape[i]);
     }
     // Create access property for later setting of cache size.
     itsDaplid = H5Pcreate (H5P_DATASET_ACCESS);
@@ -225,6 +237,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     AlwaysAssert (itsPLid.getHid() >= 0, AipsError);
     Block<hsize_t> cs = HDF5DataType::fromShape (itsTileShape);
     H5Pset_chunk(itsPLid, rank, cs.storage());
+    setFilter (compression, compressionLevel);
     // Create the data set.
     setHid (H5Dcreate2(parentHid, name.chars(), itsDataType.getHidFile(),
 		       itsDSid, 0, itsPLid, 0));
@@ -233,9 +246,56 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
   }
 
+  void HDF5DataSet::setFilter (Compression compression, uInt compressionLevel)
+  {
+    // The Blosc filter id registered with the HDF Group.
+    const H5Z_filter_t bloscFilter = 32001;
+    int err = 0;
+    switch (compression) {
+    case NoCompression:
+      break;
+    case Deflate:
+      if (! H5Zfilter_avail (H5Z_FILTER_DEFLATE)) {
+        throw HDF5Error ("Deflate filter is not available in HDF5");
+      }
+      // Shuffling the bytes of the values improves the compression a lot.
+      err = H5Pset_shuffle (itsPLid);
+      if (err >= 0) {
+        err = H5Pset_deflate (itsPLid, std::min(compressionLevel, 9u));
+      }
+      break;
+    case Szip:
+      if (! H5Zfilter_avail (H5Z_FILTER_SZIP)) {
+        throw HDF5Error ("Szip filter is not available in HDF5");
+      }
+      // Use 16 pixels per block.
+      err = H5Pset_szip (itsPLid, H5_SZIP_NN_OPTION_MASK, 16);
+      break;
+    case Blosc:
+      {
+        if (! H5Zfilter_avail (bloscFilter)) {
+          throw HDF5Error ("Blosc filter plugin is not available in HDF5");
+        }
+        // The first 4 values are reserved for the filter; then follow
+        // the level, byte shuffle and compressor (0 is blosclz).
+        unsigned int values[7] = {0, 0, 0, 0,
+                                  std::min(compressionLevel, 9u), 1, 0};
+        err = H5Pset_filter (itsPLid, bloscFilter, H5Z_FLAG_OPTIONAL,
+                             7, values);
+      }
+      break;
+    }
+    if (err < 0) {
+      throw HDF5Error ("Could not set the compression filter of data set " +
+                       getName());
+    }
+    itsCompression = compression;
+  }
+
   void HDF5DataSet::open (const HDF5Object& parentHid, const String& name)
   {
     itsParent = &parentHid;
+    itsCompression = NoCompression;
     setName (name);
     // Open the dataset.
     setHid (H5Dopen2(parentHid, name.chars(), 0));
@@ -281,6 +341,23 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       }
       itsTileShape = HDF5DataType::toShape(shp);
     }
+    // Find the compression filter used (if any).
+    itsCompression = NoCompression;
+    int nfilter = H5Pget_nfilters(itsPLid);
+    for (int i=0; i<nfilter; ++i) {
+      unsigned int flags;
+      size_t nvalues = 0;
+      unsigned int filterConfig;
+      H5Z_filter_t filter = H5Pget_filter2 (itsPLid, i, &flags, &nvalues, 0,
+                                            0, 0, &filterConfig);
+      if (filter == H5Z_FILTER_DEFLATE) {
+        itsCompression = Deflate;
+      } else if (filter == H5Z_FILTER_SZIP) {
+        itsCompression = Szip;
+      } else if (filter == 32001) {
+        itsCompression = Blosc;
+      }
+    }
   }
 
   void HDF5DataSet::closeDataSet()
@@ -299,6 +376,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsDSid.close();
     itsPLid.close();
     itsDaplid.close();
+    itsDxplid.close();
   }
 
   void HDF5DataSet::setCacheSize (uInt nchunks)
@@ -328,6 +406,23 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
   }
 
+  void HDF5DataSet::setCollectiveIO (Bool collective)
+  {
+#ifdef H5_HAVE_PARALLEL
+    if (itsDxplid.getHid() < 0) {
+      itsDxplid = H5Pcreate (H5P_DATASET_XFER);
+      AlwaysAssert (itsDxplid.getHid() >= 0, AipsError);
+    }
+    if (H5Pset_dxpl_mpio (itsDxplid, collective ? H5FD_MPIO_COLLECTIVE
+                                                : H5FD_MPIO_INDEPENDENT) < 0) {
+      throw HDF5Error ("Could not set transfer mode for HDF5 Dataset " +
+                       getName());
+    }
+#else
+    (void)collective;
+#endif
+  }
+
   DataType HDF5DataSet::getDataType (hid_t parentHid, const String& name)
   {
     hid_t id = H5Dopen2(parentHid, name.chars(), 0);
@@ -378,8 +473,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       throw HDF5Error("setting slab of memory buffer for dataset " + getName());
     }
     // Read the data.
+    hid_t xfer = itsDxplid.getHid() < 0 ? H5P_DEFAULT : itsDxplid.getHid();
     if (H5Dread (getHid(), itsDataType.getHidMem(), memspace, itsDSid,
-		 H5P_DEFAULT, buf) < 0) {
+		 xfer, buf) < 0) {
       throw HDF5Error("reading slab from data set array " + getName());
     }
   }
@@ -418,8 +514,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       throw HDF5Error("setting slab of memory buffer for dataset " + getName());
     }
     // Write the data.
+    hid_t xfer = itsDxplid.getHid() < 0 ? H5P_DEFAULT : itsDxplid.getHid();
     if (H5Dwrite (getHid(), itsDataType.getHidMem(), memspace, itsDSid,
-		  H5P_DEFAULT, buf) < 0) {
+		  xfer, buf) < 0) {
       throw HDF5Error("writing slab into data set array " + getName());
     }
   }
@@ -451,11 +548,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 #else
 
   void HDF5DataSet::create (const HDF5Object&, const String&,
-			    const IPosition&, const IPosition&)
+			    const IPosition&, const IPosition&,
+			    Compression, uInt)
   {
     HDF5Object::throwNoHDF5();
   }
 
+  void HDF5DataSet::setFilter (Compression, uInt)
+  {}
+
   void HDF5DataSet::open (const HDF5Object&, const String&)
   {
     HDF5Object::throwNoHDF5();
@@ -467,6 +568,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void HDF5DataSet::setCacheSize (uInt)
   {}
 
+  void HDF5DataSet::setCollectiveIO (Bool)
+  {}
+
   DataType HDF5DataSet::getDataType (hid_t, const String&)
     { return TpOther; }
 
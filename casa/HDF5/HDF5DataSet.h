@@ -90,29 +90,57 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   class HDF5DataSet : public HDF5Object
   {
   public: 
+    // The compression filter applied to the chunks of a new data set.
+    enum Compression {
+      // Do not compress.
+      NoCompression,
+      // Shuffle the bytes of the values and compress them with zlib
+      // using the given level (1-9).
+      Deflate,
+      // Szip compression using nearest neighbour coding (only for integer
+      // and floating point data).
+      Szip,
+      // Blosc compression (HDF5 registered filter 32001) using the given
+      // level (1-9). It requires the Blosc filter plugin to be available.
+      Blosc
+    };
+
     // Create an HDF5 data set in the given hid (file or group).
     // It gets the given name, shape (also tile shape), and data type.
+    // The chunks are compressed using the given filter.
+    // An exception is thrown if the filter is not available in the
+    // HDF5 library.
     // <group>
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const Bool*);
+		 const IPosition& tileShape, const Bool*,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const uChar*);
+		 const IPosition& tileShape, const uChar*,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const Short*);
+		 const IPosition& tileShape, const Short*,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const Int*);
+		 const IPosition& tileShape, const Int*,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const Int64*);
+		 const IPosition& tileShape, const Int64*,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const Float*);
+		 const IPosition& tileShape, const Float*,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const Double*);
+		 const IPosition& tileShape, const Double*,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const Complex*);
+		 const IPosition& tileShape, const Complex*,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const DComplex*);
+		 const IPosition& tileShape, const DComplex*,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const HDF5DataType&);
+		 const IPosition& tileShape, const HDF5DataType&,
+		 Compression = NoCompression, uInt compressionLevel = 6);
     // </group>
 
     // Open an existing HDF5 data set in the given hid (file or group).
@@ -140,6 +168,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // It needs to close and reopen the DataSet to take effect.
     void setCacheSize (uInt nchunks);
 
+    // Use collective (instead of independent) transfers when reading or
+    // writing a data set in a file opened for parallel access (see
+    // <linkto class=HDF5File>HDF5File</linkto>). Then all processes have
+    // to call get or put, but data can be gathered before being written,
+    // which is much faster for many small sections. It is required to write
+    // compressed data in parallel.
+    // It is ignored if the HDF5 library does not support parallel I/O.
+    void setCollectiveIO (Bool collective);
+
+    // Get the compression filter of the data set.
+    Compression compression() const
+      { return itsCompression; }
+
     // Get the data type for the data set with the given name.
     static DataType getDataType (hid_t, const String& name);
 
@@ -176,7 +217,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   protected:
     // Create the data set.
     void create (const HDF5Object&, const String&,
-		 const IPosition& shape, const IPosition& tileShape);
+		 const IPosition& shape, const IPosition& tileShape,
+		 Compression compression, uInt compressionLevel);
+
+    // Add the compression filter to the create property list.
+    void setFilter (Compression compression, uInt compressionLevel);
 
     // Open the data set and check if the external data type matches.
     void open (const HDF5Object&, const String&);
@@ -193,9 +238,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     HDF5HidDataSpace   itsDSid;        //# data space id
     HDF5HidProperty    itsPLid;        //# create property list id
     HDF5HidProperty    itsDaplid;      //# access property list id
+    HDF5HidProperty    itsDxplid;      //# transfer property list id
     IPosition          itsShape;
     IPosition          itsTileShape;
     HDF5DataType       itsDataType;
+    Compression        itsCompression;
     const HDF5Object*  itsParent;
   };
 
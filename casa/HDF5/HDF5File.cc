@@ -35,8 +35,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   HDF5File::HDF5File (const String& name,
 		      ByteIO::OpenOption option)
-    : itsOption (option),
-      itsDelete (False)
+    : itsOption   (option),
+      itsDelete   (False),
+      itsParallel (False)
   {
     // Disable automatic printing of errors.
     H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
@@ -45,10 +46,37 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     doOpen();
   }
 
+#ifdef HAVE_MPI
+  HDF5File::HDF5File (const String& name,
+		      ByteIO::OpenOption option, MPI_Comm mpiComm)
+    : itsOption   (option),
+      itsDelete   (False),
+      itsParallel (True),
+      itsComm     (mpiComm)
+  {
+    // Disable automatic printing of errors.
+    H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+    // Use absolute expanded path name.
+    setName (Path(name).absoluteName());
+    doOpen();
+  }
+#endif
+
   HDF5File::~HDF5File()
   {
     close();
     if (itsDelete) {
+#ifdef HAVE_MPI
+      // Only one process should remove the file after all have closed it.
+      if (itsParallel) {
+        int rank;
+        MPI_Barrier (itsComm);
+        MPI_Comm_rank (itsComm, &rank);
+        if (rank != 0) {
+          return;
+        }
+      }
+#endif
       RegularFile file(getName());
       file.remove();
     }
@@ -103,9 +131,22 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Use 8 byte offets and blocks of 32768 bytes.
     HDF5HidProperty create_plist (H5Pcreate(H5P_FILE_CREATE));
     H5Pset_sizes(create_plist, 8, 8);
-    // Use unbuffered IO.
     HDF5HidProperty access_plist (H5Pcreate(H5P_FILE_ACCESS));
-    H5Pset_fapl_sec2(access_plist);
+    if (itsParallel) {
+      // Use MPI-IO.
+#if defined(HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+      if (H5Pset_fapl_mpio(access_plist, itsComm, MPI_INFO_NULL) < 0) {
+        throw HDF5Error ("Could not use MPI-IO for HDF5 file " + getName());
+      }
+#else
+      throw HDF5Error ("HDF5 file " + getName() + " cannot be opened for "
+                       "parallel access; the HDF5 library does not support "
+                       "parallel I/O");
+#endif
+    } else {
+      // Use unbuffered IO.
+      H5Pset_fapl_sec2(access_plist);
+    }
     // Set a cache size of 16 MB.
     // First get old values and use them for the other parameters.
     int mdn;
@@ -150,13 +191,27 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   HDF5File::HDF5File (const String& name,
 		      ByteIO::OpenOption option)
-    : itsOption (option),
-      itsDelete (False)
+    : itsOption   (option),
+      itsDelete   (False),
+      itsParallel (False)
   {
     setName (name);
     doOpen();
   }
 
+#ifdef HAVE_MPI
+  HDF5File::HDF5File (const String& name,
+		      ByteIO::OpenOption option, MPI_Comm mpiComm)
+    : itsOption   (option),
+      itsDelete   (False),
+      itsParallel (True),
+      itsComm     (mpiComm)
+  {
+    setName (name);
+    doOpen();
+  }
+#endif
+
   HDF5File::~HDF5File()
   {}
 
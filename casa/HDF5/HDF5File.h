@@ -32,6 +32,10 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/IO/ByteIO.h>
 
+#ifdef HAVE_MPI
+#include <mpi.h>
+#endif
+
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   // <summary>
@@ -53,6 +57,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // If the file is opened as readonly, it is possible to reopen it for
   // read/write (provided the user has the correct privileges).
   // It is also possible to temporarily close the file and reopen it later.
+  // <br>If casacore is built with MPI and a parallel HDF5 library, a file
+  // can be opened by all processes in an MPI communicator for parallel
+  // access using MPI-IO. All processes have to open, create or extend the
+  // file and its groups and data sets collectively (i.e., in the same order),
+  // but each process can read or write its own sections of the data sets.
   // <note> It is ensured that the class and the static function <tt>isHDF5</tt>
   // are also defined if HDF5 is not compiled in. </note>
   // </synopsis> 
@@ -73,6 +82,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit HDF5File (const String& name,
 		       ByteIO::OpenOption = ByteIO::Old);
 
+#ifdef HAVE_MPI
+    // Create an HDF5 file object for parallel access by the processes in
+    // the given communicator. An exception is thrown if the HDF5 library
+    // does not support parallel I/O.
+    HDF5File (const String& name, ByteIO::OpenOption, MPI_Comm mpiComm);
+#endif
+
     // The destructor closes the file and deletes it when it was opened
     // using ByteIO::Scratch or ByteIO::Delete.
     ~HDF5File();
@@ -94,6 +110,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool isOpenedForDelete() const
       { return itsDelete; }
 
+    // Is the file opened for parallel access?
+    Bool isParallel() const
+      { return itsParallel; }
+
     // Is the file temporarily closed?
     Bool isClosed() const
       { return getHid()<0; }
@@ -124,6 +144,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     ByteIO::OpenOption itsOption;
     String             itsName;
     Bool               itsDelete;
+    Bool               itsParallel;
+#ifdef HAVE_MPI
+    MPI_Comm           itsComm;
+#endif
 
   private:
     // Copy constructor cannot be used.
@@ -94,6 +94,43 @@ void testCompound()
   }
 }
 
+void testCompression()
+{
+  IPosition shape(3,40,30,4);
+  IPosition tsh(3,16,16,1);
+  Array<Float> farr(shape);
+  indgen(farr);
+  {
+    // Create a data set using the deflate filter.
+    HDF5File file("tHDF5DataSet_tmp", ByteIO::New);
+    HDF5DataSet dset(file, "farray", shape, tsh, (Float*)0,
+                     HDF5DataSet::Deflate, 5);
+    AlwaysAssertExit (dset.compression() == HDF5DataSet::Deflate);
+    AlwaysAssertExit (dset.tileShape() == tsh);
+    dset.put (Slicer(IPosition(3,0), shape), farr);
+    // A tile shape exceeding the shape is clamped.
+    HDF5DataSet dset2(file, "farray2", shape, IPosition(3,64,8,0), (Float*)0);
+    AlwaysAssertExit (dset2.compression() == HDF5DataSet::NoCompression);
+    AlwaysAssertExit (dset2.tileShape() == IPosition(3,40,8,1));
+  }
+  {
+    // Read it back and check that the filter is detected.
+    HDF5File file("tHDF5DataSet_tmp", ByteIO::Old);
+    HDF5DataSet dset(file, "farray", (Float*)0);
+    AlwaysAssertExit (dset.compression() == HDF5DataSet::Deflate);
+    AlwaysAssertExit (dset.tileShape() == tsh);
+    Array<Float> fres(shape);
+    dset.get (Slicer(IPosition(3,0), shape), fres);
+    AlwaysAssertExit (allEQ(farr, fres));
+    Slicer section(IPosition(3,3,20,1), IPosition(3,30,5,2));
+    Array<Float> fres2(section.length());
+    dset.get (section, fres2);
+    AlwaysAssertExit (allEQ(farr(section), fres2));
+    HDF5DataSet dset2(file, "farray2", (Float*)0);
+    AlwaysAssertExit (dset2.compression() == HDF5DataSet::NoCompression);
+  }
+}
+
 int main()
 {
   // Exit with untested if no HDF5 support.
@@ -162,6 +199,8 @@ int main()
     }
     // Test a compound data type.
     testCompound();
+    // Test compressed data sets.
+    testCompression();
 
   } catch (std::exception& x) {
     cout << "Unexpected exception: " << x.what() << endl;
@@ -26,8 +26,11 @@
 
 //# Includes
 #include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/OS/ProfileRegistry.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -91,6 +94,8 @@ BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
 
 BucketCache::~BucketCache()
 {
+    // Stop reading ahead before the cache is removed.
+    its_Prefetcher.reset();
     // Clear the entire cache.
     // It is not flushed (that should have been done before).
     // In that way no needless flushes are done for a temporary table.
@@ -171,6 +176,9 @@ void BucketCache::resync (uInt nrBucket, uInt nrOfFreeBucket,
     // Clear the entire cache, so data will be reread.
     // Set it to the new size.
     clear();
+    if (its_Prefetcher) {
+        its_Prefetcher->clear();
+    }
     if (nrBucket > its_NewNrOfBuckets) {
 	extend (nrBucket - its_NewNrOfBuckets);
     }
@@ -180,6 +188,35 @@ void BucketCache::resync (uInt nrBucket, uInt nrOfFreeBucket,
 }
 
 
+Bool BucketCache::setPrefetch (uInt nrBuckets)
+{
+    its_Prefetcher.reset();
+    if (nrBuckets == 0  ||  its_file->isWritable()  ||
+        its_file->isMultiFile()) {
+        return False;
+    }
+    its_Prefetcher.reset (new BucketPrefetcher (its_file, its_StartOffset,
+                                                its_BucketSize, nrBuckets));
+    return True;
+}
+
+void BucketCache::prefetch (const std::vector<uInt>& bucketNrs)
+{
+    if (its_Prefetcher) {
+        std::vector<uInt> todo;
+        todo.reserve (bucketNrs.size());
+        for (uInt bucketNr : bucketNrs) {
+            if (bucketNr < its_CurNrOfBuckets  &&  its_SlotNr[bucketNr] < 0) {
+                todo.push_back (bucketNr);
+            }
+        }
+        if (! todo.empty()) {
+            its_Prefetcher->prefetch (todo);
+        }
+    }
+}
+
+
 uInt BucketCache::nBucket() const
 {
     return its_NewNrOfBuckets;
@@ -203,7 +240,7 @@ void BucketCache::setLRU()
     its_LRU[its_ActualSlot] = ++its_LRUCounter;
 }
 
-char* BucketCache::getBucket (uInt bucketNr)
+char* BucketCache::getBucket (uInt bucketNr, Bool readData)
 {
     if (bucketNr >= its_NewNrOfBuckets) {
 	throw (indexError<Int> (bucketNr));
@@ -219,8 +256,18 @@ char* BucketCache::getBucket (uInt bucketNr)
     // Read the bucket when it is already in the file.
     // Otherwise get a new initialized bucket.
     if (bucketNr < its_CurNrOfBuckets) {
-	getSlot (bucketNr);
-	readBucket (its_ActualSlot);
+        if (readData) {
+            static ProfileCounter& missCounter =
+              ProfileRegistry::counter ("BucketCache.miss");
+            ProfileTimer timer(missCounter);
+            getSlot (bucketNr);
+            readBucket (its_ActualSlot);
+        } else {
+            // The bucket will be overwritten, so it need not be read.
+            getSlot (bucketNr);
+            its_Cache[its_ActualSlot] = its_InitCallBack (its_Owner);
+            ninit_p++;
+        }
     }else{
         if (! its_file->isWritable()) {
             throw AipsError ("BucketCache::getBucket: bucket " +
@@ -232,6 +279,52 @@ char* BucketCache::getBucket (uInt bucketNr)
     return its_Cache[its_ActualSlot];
 }
 
+void BucketCache::loadBuckets (const std::vector<uInt>& bucketNrs)
+{
+    // Mark the buckets already in the cache as recently used, so they
+    // are not removed when getting slots for the missing ones.
+    std::vector<uInt> missing;
+    missing.reserve (bucketNrs.size());
+    uInt ncached = 0;
+    for (uInt bucketNr : bucketNrs) {
+        if (bucketNr < its_CurNrOfBuckets) {
+            if (its_SlotNr[bucketNr] >= 0) {
+                its_ActualSlot = its_SlotNr[bucketNr];
+                setLRU();
+                ncached++;
+            } else {
+                missing.push_back (bucketNr);
+            }
+        }
+    }
+    std::sort (missing.begin(), missing.end());
+    missing.erase (std::unique (missing.begin(), missing.end()),
+                   missing.end());
+    // Do not read more than fits in the cache.
+    uInt nfree = (ncached < its_CacheSize  ?  its_CacheSize - ncached : 0);
+    if (missing.size() > nfree) {
+        missing.resize (nfree);
+    }
+    if (missing.size() < 2) {
+        // Not worth a batch; getBucket reads it.
+        return;
+    }
+    std::vector<char> data (size_t(its_BucketSize) * missing.size());
+    std::vector<Int64> offsets (missing.size());
+    std::vector<char*> buffers (missing.size());
+    for (size_t i=0; i<missing.size(); ++i) {
+        offsets[i] = its_StartOffset + Int64(missing[i]) * its_BucketSize;
+        buffers[i] = &(data[i*its_BucketSize]);
+    }
+    its_file->preadv (offsets, buffers, its_BucketSize);
+    // Put the buckets in the cache after converting them to local format.
+    for (size_t i=0; i<missing.size(); ++i) {
+        getSlot (missing[i]);
+        its_Cache[its_ActualSlot] = its_ReadCallBack (its_Owner, buffers[i]);
+        nread_p++;
+    }
+}
+
 void BucketCache::extend (uInt nrBucket)
 {
     its_NewNrOfBuckets += nrBucket;
@@ -360,9 +453,13 @@ void BucketCache::writeBucket (uInt slotNr)
 void BucketCache::readBucket (uInt slotNr)
 {
 ///    cout << "read " << its_BucketNr[slotNr] << " " << slotNr;
-    its_file->seek (its_StartOffset +
-		    Int64(its_BucketNr[slotNr]) * its_BucketSize);
-    its_file->read (its_Buffer, its_BucketSize);
+    // Use the bucket if read ahead; otherwise read it now.
+    if (!its_Prefetcher  ||
+        !its_Prefetcher->take (its_BucketNr[slotNr], its_Buffer)) {
+        its_file->seek (its_StartOffset +
+                        Int64(its_BucketNr[slotNr]) * its_BucketSize);
+        its_file->read (its_Buffer, its_BucketSize);
+    }
     its_Cache[slotNr] = its_ReadCallBack (its_Owner, its_Buffer);
     nread_p++;
 }
@@ -407,9 +504,30 @@ void BucketCache::showStatistics (ostream& os) const
 	   << 100 * float(naccess_p - nread_p - ninit_p) /
 	                               float(naccess_p) << "%";
     }
+    if (its_Prefetcher) {
+        os << endl << "#prefetch: " << its_Prefetcher->nread()
+           << "        used:      " << its_Prefetcher->nhit();
+    }
     cout << endl;
 }
 
+Record BucketCache::statistics() const
+{
+    Record rec;
+    rec.define ("NACCESS", Int64(naccess_p));
+    rec.define ("NREAD", Int64(nread_p));
+    rec.define ("NINIT", Int64(ninit_p));
+    rec.define ("NWRITE", Int64(nwrite_p));
+    rec.define ("CACHESIZE", Int64(its_CacheSize));
+    rec.define ("BUCKETSIZE", Int64(its_BucketSize));
+    rec.define ("NBUCKET", Int64(its_CurNrOfBuckets));
+    rec.define ("NREADCALL", Int64(its_file->nReadCalls()));
+    rec.define ("NWRITECALL", Int64(its_file->nWriteCalls()));
+    rec.define ("NBYTEREAD", Int64(its_file->nBytesRead()));
+    rec.define ("NBYTEWRITTEN", Int64(its_file->nBytesWritten()));
+    return rec;
+}
+
 void BucketCache::initStatistics()
 {
     naccess_p = 0;
@@ -29,8 +29,11 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/BucketPrefetcher.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
+#include <memory>
+#include <vector>
 
 //# Forward clarations
 #include <casacore/casa/iosfwd.h>
@@ -38,6 +41,9 @@
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+//# Forward Declarations
+class Record;
+
 // <summary>
 // Define the type of the static read and write function.
 // </summary>
@@ -141,6 +147,13 @@ typedef void (*BucketCacheDeleteBuffer) (void* ownerObject, char* buffer);
 // <p>
 // Statistics are kept to know how efficient the cache is working.
 // It is possible to initialize and show the statistics.
+// <p>
+// For a read-only file it is possible to read buckets ahead using a
+// <linkto class=BucketPrefetcher>BucketPrefetcher</linkto> object.
+// After enabling it with <src>setPrefetch</src>, the owner can tell
+// which buckets it expects to need using <src>prefetch</src>. These
+// buckets are read in a background thread and are taken from there
+// when <src>getBucket</src> needs them.
 // </synopsis> 
 
 // <motivation>
@@ -272,7 +285,23 @@ public:
     // function. When the bucket does not exist yet in the file, it
     // gets added and initialized using the AddBuffer callback function.
     // A pointer to the data in converted format is returned.
-    char* getBucket (uInt bucketNr);
+    // <br>If <src>readData=False</src>, a bucket not in the cache is not
+    // read from the file, but initialized using the AddBuffer callback
+    // function. It can be used if the caller overwrites the entire bucket.
+    char* getBucket (uInt bucketNr, Bool readData=True);
+
+    // Is the given bucket in the cache?
+    Bool isCached (uInt bucketNr) const;
+
+    // Make sure the given buckets are in the cache.
+    // The buckets not in the cache yet are read in a single batch using
+    // <src>BucketFile::preadv</src>, which reads adjacent buckets with a
+    // single system call. Buckets not in the file yet are ignored.
+    // No more buckets than fit in the cache are read; the remaining ones
+    // are read when needed.
+    // Afterwards the current bucket is undefined, so <src>getBucket</src>
+    // has to be called before <src>setDirty</src> can be used.
+    void loadBuckets (const std::vector<uInt>& bucketNrs);
 
     // Extend the file with the given number of buckets.
     // The buckets get initialized when they are acquired
@@ -311,9 +340,42 @@ public:
     // Get the number of free buckets.
     uInt nFreeBucket() const;
 
+    // Enable reading buckets ahead in a background thread.
+    // At most nrBuckets buckets are held by the prefetcher; 0 disables it.
+    // Prefetching can only be done for a read-only file that is not part
+    // of a MultiFileBase. False is returned if not enabled.
+    Bool setPrefetch (uInt nrBuckets);
+
+    // Is prefetching enabled?
+    Bool hasPrefetch() const;
+
+    // Read the given buckets ahead if prefetching is enabled.
+    // Buckets already in the cache or not in the file are ignored.
+    void prefetch (const std::vector<uInt>& bucketNrs);
+
     // (Re)initialize the cache statistics.
     void initStatistics();
 
+    // Get the cache statistics: the number of bucket accesses, and the
+    // number of buckets read, initialized and written.
+    // <group>
+    uInt nAccess() const
+      { return naccess_p; }
+    uInt nRead() const
+      { return nread_p; }
+    uInt nInit() const
+      { return ninit_p; }
+    uInt nWrite() const
+      { return nwrite_p; }
+    // </group>
+
+    // Get the cache statistics and the IO counts of the underlying file
+    // as a record with the fields NACCESS, NREAD, NINIT, NWRITE, CACHESIZE,
+    // BUCKETSIZE, NBUCKET, NREADCALL, NWRITECALL, NBYTEREAD and NBYTEWRITTEN.
+    // Note that the file IO counts also contain the IO done directly on
+    // the file by the owner of the cache.
+    Record statistics() const;
+
     // Show the statistics.
     void showStatistics (ostream& os) const;
 
@@ -358,6 +420,8 @@ private:
     uInt         its_LRUCounter;
     // The internal buffer.
     char*        its_Buffer;
+    // The optional object reading buckets ahead.
+    std::unique_ptr<BucketPrefetcher> its_Prefetcher;
     // The number of free buckets.
     uInt its_NrOfFree;
     // The first free bucket (-1 = no free buckets).
@@ -407,6 +471,12 @@ inline Int BucketCache::firstFreeBucket() const
 inline uInt BucketCache::nFreeBucket() const
     { return its_NrOfFree; }
 
+inline Bool BucketCache::isCached (uInt bucketNr) const
+    { return bucketNr < its_SlotNr.nelements()  &&  its_SlotNr[bucketNr] >= 0; }
+
+inline Bool BucketCache::hasPrefetch() const
+    { return Bool(its_Prefetcher); }
+
 
 
 
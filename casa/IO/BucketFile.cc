@@ -34,10 +34,15 @@
 #include <casacore/casa/OS/DOos.h>
 #include <casacore/casa/Logging/LogIO.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Utilities/AlignMemory.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <limits.h>
+#include <algorithm>
+#include <numeric>
 #include <errno.h>                // needed for errno
 #include <casacore/casa/string.h>          // needed for strerror
 
@@ -60,10 +65,16 @@ BucketFile::BucketFile (const String& fileName,
   isMapped_p     (mappedFile),
   bufSize_p      (bufSizeFile),
   fd_p           (-1),
+  useODirect_p   (False),
+  fdDirect_p     (-1),
   file_p         (),
   mappedFile_p   (0),
   bufferedFile_p (0),
-  mfile_p        (mfile)
+  mfile_p        (mfile),
+  nReadCalls_p   (0),
+  nWriteCalls_p  (0),
+  nBytesRead_p   (0),
+  nBytesWritten_p(0)
 {
     // Create the file.
     if (mfile_p) {
@@ -85,10 +96,16 @@ BucketFile::BucketFile (const String& fileName, Bool isWritable,
   isMapped_p     (mappedFile),
   bufSize_p      (bufSizeFile),
   fd_p           (-1),
+  useODirect_p   (False),
+  fdDirect_p     (-1),
   file_p         (),
   mappedFile_p   (0),
   bufferedFile_p (0),
-  mfile_p        (mfile)
+  mfile_p        (mfile),
+  nReadCalls_p   (0),
+  nWriteCalls_p  (0),
+  nBytesRead_p   (0),
+  nBytesWritten_p(0)
 {
   if (mfile_p) {
     isMapped_p = False;
@@ -112,6 +129,7 @@ std::shared_ptr<ByteIO> BucketFile::makeFilebufIO (uInt bufferSize)
 
 void BucketFile::close()
 {
+    closeDirect();
     if (file_p) {
         deleteMapBuf();
 	file_p.reset();
@@ -133,6 +151,71 @@ void BucketFile::open()
       }
       createMapBuf();
     }
+    openDirect();
+}
+
+Bool BucketFile::setODirect (Bool useODirect)
+{
+#ifdef HAVE_O_DIRECT
+    useODirect_p = useODirect  &&  !isWritable_p  &&  !mfile_p;
+#else
+    useODirect_p = False;
+#endif
+    if (useODirect_p) {
+        if (file_p) {
+            openDirect();
+        }
+    } else {
+        closeDirect();
+    }
+    return useODirect_p;
+}
+
+void BucketFile::openDirect()
+{
+#ifdef HAVE_O_DIRECT
+    if (useODirect_p  &&  fdDirect_p < 0) {
+        // Not all file systems support O_DIRECT; then normal reads are done.
+        fdDirect_p = ::trace2OPEN ((char*)(name_p.chars()), O_RDONLY | O_DIRECT);
+    }
+#endif
+}
+
+void BucketFile::closeDirect()
+{
+    if (fdDirect_p >= 0) {
+        FiledesIO::close (fdDirect_p);
+        fdDirect_p = -1;
+    }
+}
+
+void BucketFile::readDirect (void* buffer, uInt length, Int64 offset)
+{
+    // O_DIRECT requires the offset, length and buffer to be aligned to the
+    // logical block size of the device. 4096 suffices for all common devices.
+    const Int64 align = 4096;
+    Int64 start = offset - offset % align;
+    Int64 end   = offset + length;
+    end = (end + align - 1) / align * align;
+    size_t size = end - start;
+    std::unique_ptr<char, void(*)(void*)> buf
+      (static_cast<char*>(AlignMemory(align).alloc(size)), free);
+    // The aligned end can be beyond the end-of-file, so fewer bytes can be
+    // read than asked for.
+    Int64 need = offset + length - start;
+    Int64 done = 0;
+    while (done < need) {
+        Int64 nr = ::tracePREAD (fdDirect_p, buf.get() + done, size - done,
+                                 start + done);
+        if (nr <= 0) {
+            int error = errno;
+            throw AipsError ("BucketFile::read - O_DIRECT read error in " +
+                             name_p + (nr < 0 ? ": " + String(strerror(error)) :
+                                       String(": unexpected end-of-file")));
+        }
+        done += nr;
+    }
+    memcpy (buffer, buf.get() + (offset - start), length);
 }
 
 void BucketFile::createMapBuf()
@@ -185,6 +268,8 @@ void BucketFile::setRW()
 	return;
     }
     isWritable_p = True;
+    // O_DIRECT is only used for reading read-only files.
+    setODirect (False);
     // Try to reopen the file as read/write.
     // Throw an exception if it fails.
     if (file_p) {
@@ -200,15 +285,103 @@ void BucketFile::setRW()
 
 uInt BucketFile::read (void* buffer, uInt length)
 {
+  nReadCalls_p++;
+  nBytesRead_p += length;
+  if (fdDirect_p >= 0) {
+    Int64 offset = file_p->seek (0, ByteIO::Current);
+    readDirect (buffer, length, offset);
+    file_p->seek (offset + length, ByteIO::Begin);
+    return length;
+  }
   return file_p->read (length, buffer);
 }
 
 uInt BucketFile::write (const void* buffer, uInt length)
 {
+  nWriteCalls_p++;
+  nBytesWritten_p += length;
   file_p->write (length, buffer);
     return length;
 }
 
+uInt BucketFile::pread (void* buffer, uInt length, Int64 offset)
+{
+  nReadCalls_p++;
+  nBytesRead_p += length;
+  if (fdDirect_p >= 0) {
+    readDirect (buffer, length, offset);
+    return length;
+  }
+  return file_p->pread (length, offset, buffer);
+}
+
+void BucketFile::preadv (const std::vector<Int64>& offsets,
+                         const std::vector<char*>& buffers, uInt length)
+{
+  AlwaysAssert (offsets.size() == buffers.size(), AipsError);
+#if defined(AIPS_LINUX) || defined(AIPS_BSD)
+  if (fd_p >= 0  &&  fdDirect_p < 0) {
+    // Sort the parts on offset, so adjacent parts can be combined.
+    std::vector<size_t> inx(offsets.size());
+    std::iota (inx.begin(), inx.end(), 0);
+    std::sort (inx.begin(), inx.end(),
+               [&offsets] (size_t i, size_t j) { return offsets[i] < offsets[j]; });
+#ifdef IOV_MAX
+    const size_t maxIov = IOV_MAX;
+#else
+    const size_t maxIov = 1024;
+#endif
+    std::vector<struct iovec> iov;
+    iov.reserve (std::min(inx.size(), maxIov));
+    size_t i = 0;
+    while (i < inx.size()) {
+      // Combine the adjacent parts in a single call.
+      Int64 start = offsets[inx[i]];
+      iov.clear();
+      do {
+        struct iovec vec;
+        vec.iov_base = buffers[inx[i]];
+        vec.iov_len  = length;
+        iov.push_back (vec);
+        ++i;
+      } while (i < inx.size()  &&  iov.size() < maxIov  &&
+               offsets[inx[i]] == start + Int64(iov.size()) * length);
+      // Continue if only part of the data has been read.
+      size_t todo = iov.size() * size_t(length);
+      size_t done = 0;
+      size_t first = 0;
+      while (done < todo) {
+        ssize_t nr = ::preadv (fd_p, &(iov[first]), iov.size() - first,
+                               start + done);
+        nReadCalls_p++;
+        if (nr <= 0) {
+          int error = errno;
+          throw AipsError ("BucketFile::preadv - read error in " + name_p +
+                           (nr < 0 ? ": " + String(strerror(error)) :
+                                     String(": unexpected end-of-file")));
+        }
+        done += nr;
+        nBytesRead_p += nr;
+        // Skip the buffers that are filled entirely; adjust a partial one.
+        while (first < iov.size()  &&  size_t(nr) >= iov[first].iov_len) {
+          nr -= iov[first].iov_len;
+          first++;
+        }
+        if (nr > 0) {
+          iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + nr;
+          iov[first].iov_len -= nr;
+        }
+      }
+    }
+    return;
+  }
+#endif
+  // Read the parts one by one.
+  for (size_t i=0; i<offsets.size(); ++i) {
+    pread (buffers[i], length, offsets[i]);
+  }
+}
+
 void BucketFile::seek (Int64 offset)
 {
     AlwaysAssert (bufferedFile_p == 0, AipsError);
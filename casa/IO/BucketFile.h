@@ -33,7 +33,9 @@
 #include <casacore/casa/IO/FilebufIO.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <unistd.h>
+#include <atomic>
 #include <memory>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -77,6 +79,13 @@ class MultiFileBase;
 //       the access using the FilebufIO member.
 // </ul>
 // A MultiFileBase file can only be accessed in the unbuffered way.
+// <p>
+// An ordinary file opened read-only can be read with O_DIRECT (if supported
+// by the OS) to bypass the kernel's file cache. It is useful for one-pass
+// processing of large files which would otherwise evict the more useful
+// data of other processes from the file cache. Because O_DIRECT requires
+// the file offset, size and memory address to be aligned, the data are read
+// via an aligned intermediate buffer.
 // </synopsis> 
 
 // <motivation>
@@ -173,6 +182,22 @@ public:
     // Write bytes into the file.
     virtual uInt write (const void* buffer, uInt length);
 
+    // Read bytes from the file at the given offset.
+    // For an ordinary file it does not change the file pointer, so it can
+    // be used by another thread while the file is used in the normal way.
+    // That is not the case for a file in a MultiFileBase.
+    virtual uInt pread (void* buffer, uInt length, Int64 offset);
+
+    // Read multiple parts of equal length at the given offsets into the
+    // given buffers. It does not change the file pointer.
+    // For an ordinary file the parts that are adjacent in the file are
+    // read with a single <src>preadv</src> system call (if available),
+    // so a batch of buckets needs far fewer system calls.
+    // The offsets can be in any order.
+    // An exception is thrown if a part cannot be read entirely.
+    virtual void preadv (const std::vector<Int64>& offsets,
+                         const std::vector<char*>& buffers, uInt length);
+
     // Seek in the file.
     // <group>
     virtual void seek (Int64 offset);
@@ -190,6 +215,34 @@ public:
     Bool isBuffered() const;
     // </group>
 
+    // Is the file part of a MultiFileBase?
+    Bool isMultiFile() const;
+
+    // Get the I/O statistics of the <src>read</src>, <src>write</src>,
+    // <src>pread</src> and <src>preadv</src> functions: the number of
+    // read and write calls done on the file and the number of bytes read and
+    // written. Note that IO done via the mapped or buffered file object
+    // is not counted.
+    // <group>
+    uInt64 nReadCalls() const
+      { return nReadCalls_p; }
+    uInt64 nWriteCalls() const
+      { return nWriteCalls_p; }
+    uInt64 nBytesRead() const
+      { return nBytesRead_p; }
+    uInt64 nBytesWritten() const
+      { return nBytesWritten_p; }
+    // </group>
+
+    // Tell if reads have to be done using O_DIRECT.
+    // It can only be used for an ordinary file opened read-only and only if
+    // the OS supports O_DIRECT. It returns False if O_DIRECT is not used.
+    // If the file system does not support O_DIRECT, normal reads are done.
+    Bool setODirect (Bool useODirect);
+
+    // Are reads done using O_DIRECT?
+    Bool isODirect() const;
+
 private:
     // The file name.
     String name_p;
@@ -198,6 +251,8 @@ private:
     Bool isMapped_p;
     uInt bufSize_p;
     int  fd_p;    //  fd (if used) of unbuffered file
+    Bool useODirect_p;
+    int  fdDirect_p;  // fd (if used) of file opened with O_DIRECT
     // The unbuffered file.
     std::shared_ptr<ByteIO> file_p;
     // The optional mapped file.
@@ -206,6 +261,11 @@ private:
     FilebufIO* bufferedFile_p;
     // The possibly used MultiFileBase.
     std::shared_ptr<MultiFileBase> mfile_p;
+    // The I/O statistics (atomic because pread can be used by multiple threads).
+    std::atomic<uInt64> nReadCalls_p;
+    std::atomic<uInt64> nWriteCalls_p;
+    std::atomic<uInt64> nBytesRead_p;
+    std::atomic<uInt64> nBytesWritten_p;
 	    
 
     // Create the mapped or buffered file object.
@@ -213,6 +273,15 @@ private:
 
     // Delete the possible mapped or buffered file object.
     void deleteMapBuf();
+
+    // Open or close the file descriptor used for O_DIRECT reads.
+    // <group>
+    void openDirect();
+    void closeDirect();
+    // </group>
+
+    // Read using O_DIRECT via an aligned buffer.
+    void readDirect (void* buffer, uInt length, Int64 offset);
 };
 
 
@@ -231,6 +300,10 @@ inline Bool BucketFile::isMapped() const
     { return isMapped_p; }
 inline Bool BucketFile::isBuffered() const
     { return bufSize_p>0; }
+inline Bool BucketFile::isMultiFile() const
+    { return Bool(mfile_p); }
+inline Bool BucketFile::isODirect() const
+    { return fdDirect_p >= 0; }
 
 
 } //# NAMESPACE CASACORE - END
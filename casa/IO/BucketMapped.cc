@@ -28,6 +28,7 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <cstring>   //# for memset
+#include <algorithm>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -73,6 +74,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       (itsStartOffset + Int64(bucketNr)*itsBucketSize));
   }
 
+  void BucketMapped::advise (uInt bucketNr, uInt nrBuckets,
+                             MMapfdIO::Advice advice)
+  {
+    if (bucketNr < itsCurNrOfBuckets) {
+      nrBuckets = std::min (nrBuckets, itsCurNrOfBuckets - bucketNr);
+      itsFile->mappedFile()->advise
+        (itsStartOffset + Int64(bucketNr)*itsBucketSize,
+         Int64(nrBuckets)*itsBucketSize, advice);
+    }
+  }
+
   void BucketMapped::initializeBuckets (uInt bucketNr)
   {
     if (itsCurNrOfBuckets <= bucketNr) {
@@ -96,6 +96,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       return const_cast<char*>(getBucket(bucketNr));
     }
 
+    // Tell the OS how the given range of buckets will be accessed.
+    // Buckets not in the file yet are ignored.
+    void advise (uInt bucketNr, uInt nrBuckets, MMapfdIO::Advice advice);
+
 private:
     // Copy constructor is not possible.
     BucketMapped (const BucketMapped&);
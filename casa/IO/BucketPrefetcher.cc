@@ -0,0 +1,183 @@
+//# BucketPrefetcher.cc: Read buckets ahead in a background thread
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/IO/BucketPrefetcher.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+BucketPrefetcher::BucketPrefetcher (BucketFile* file, Int64 startOffset,
+                                    uInt bucketSize, uInt maxBuckets)
+: itsFile        (file),
+  itsStartOffset (startOffset),
+  itsBucketSize  (bucketSize),
+  itsMaxBuckets  (std::max(maxBuckets, 1u)),
+  itsBusy        (-1),
+  itsStop        (False),
+  itsNread       (0),
+  itsNhit        (0)
+{
+    itsThread = std::thread (&BucketPrefetcher::run, this);
+}
+
+BucketPrefetcher::~BucketPrefetcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        itsStop = True;
+        itsQueue.clear();
+    }
+    itsWorkCond.notify_all();
+    itsThread.join();
+}
+
+void BucketPrefetcher::prefetch (const std::vector<uInt>& bucketNrs)
+{
+    {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        itsQueue.clear();
+        // Do not schedule more than can be held.
+        for (uInt bucketNr : bucketNrs) {
+            if (itsQueue.size() >= itsMaxBuckets) {
+                break;
+            }
+            if (Int64(bucketNr) != itsBusy  &&
+                itsBuckets.find(bucketNr) == itsBuckets.end()) {
+                itsQueue.push_back (bucketNr);
+            }
+        }
+        if (itsQueue.empty()) {
+            return;
+        }
+    }
+    itsWorkCond.notify_one();
+}
+
+Bool BucketPrefetcher::take (uInt bucketNr, char* buffer)
+{
+    std::unique_lock<std::mutex> lock(itsMutex);
+    // Wait if the bucket is being read.
+    while (itsBusy == Int64(bucketNr)) {
+        itsDoneCond.wait (lock);
+    }
+    std::map<uInt, std::vector<char>>::iterator iter =
+        itsBuckets.find (bucketNr);
+    if (iter == itsBuckets.end()) {
+        // No need to read it anymore (the caller does it).
+        std::deque<uInt>::iterator qiter =
+            std::find (itsQueue.begin(), itsQueue.end(), bucketNr);
+        if (qiter != itsQueue.end()) {
+            itsQueue.erase (qiter);
+        }
+        return False;
+    }
+    memcpy (buffer, iter->second.data(), itsBucketSize);
+    itsBuckets.erase (iter);
+    std::deque<uInt>::iterator oiter =
+        std::find (itsOrder.begin(), itsOrder.end(), bucketNr);
+    if (oiter != itsOrder.end()) {
+        itsOrder.erase (oiter);
+    }
+    itsNhit++;
+    return True;
+}
+
+void BucketPrefetcher::clear()
+{
+    std::unique_lock<std::mutex> lock(itsMutex);
+    itsQueue.clear();
+    while (itsBusy >= 0) {
+        itsDoneCond.wait (lock);
+    }
+    itsBuckets.clear();
+    itsOrder.clear();
+}
+
+uInt BucketPrefetcher::nread() const
+{
+    std::lock_guard<std::mutex> lock(itsMutex);
+    return itsNread;
+}
+
+uInt BucketPrefetcher::nhit() const
+{
+    std::lock_guard<std::mutex> lock(itsMutex);
+    return itsNhit;
+}
+
+void BucketPrefetcher::limitBuckets()
+{
+    while (itsBuckets.size() > itsMaxBuckets  &&  !itsOrder.empty()) {
+        itsBuckets.erase (itsOrder.front());
+        itsOrder.pop_front();
+    }
+}
+
+void BucketPrefetcher::run()
+{
+    std::unique_lock<std::mutex> lock(itsMutex);
+    while (True) {
+        while (!itsStop  &&  itsQueue.empty()) {
+            itsWorkCond.wait (lock);
+        }
+        if (itsStop) {
+            break;
+        }
+        uInt bucketNr = itsQueue.front();
+        itsQueue.pop_front();
+        if (itsBuckets.find(bucketNr) != itsBuckets.end()) {
+            continue;
+        }
+        itsBusy = bucketNr;
+        lock.unlock();
+        // Do the read without holding the lock.
+        std::vector<char> data(itsBucketSize);
+        Bool ok = True;
+        try {
+            itsFile->pread (data.data(), itsBucketSize,
+                            itsStartOffset + Int64(bucketNr) * itsBucketSize);
+        } catch (const std::exception&) {
+            // Ignore errors; the cache will read the bucket itself
+            // and report the error (if still present).
+            ok = False;
+        }
+        lock.lock();
+        if (ok) {
+            itsBuckets[bucketNr].swap (data);
+            itsOrder.push_back (bucketNr);
+            itsNread++;
+            limitBuckets();
+        }
+        itsBusy = -1;
+        itsDoneCond.notify_all();
+    }
+}
+
+} //# NAMESPACE CASACORE - END
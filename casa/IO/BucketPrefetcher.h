@@ -0,0 +1,164 @@
+//# BucketPrefetcher.h: Read buckets ahead in a background thread
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_BUCKETPREFETCHER_H
+#define CASA_BUCKETPREFETCHER_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class BucketFile;
+
+
+// <summary>
+// Read buckets of a BucketFile ahead in a background thread
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tBucketCache">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=BucketCache>BucketCache</linkto>
+//   <li> <linkto class=BucketFile>BucketFile</linkto>
+// </prerequisite>
+
+// <synopsis>
+// BucketPrefetcher is a helper class for BucketCache. It reads buckets
+// the cache is expected to need soon in a background thread, so the
+// I/O latency overlaps with the computations done by the caller.
+// <p>
+// The buckets are read in external (canonical) format into buffers
+// owned by this class. When BucketCache has to read a bucket, it first
+// asks the prefetcher if the bucket is available (or being read).
+// If so, the external data is copied into the cache's buffer and the
+// normal conversion to local format is done by the cache.
+// <br>
+// Only a limited number of buckets is kept; when the limit is exceeded,
+// the bucket read first is discarded. Requesting new buckets to be
+// prefetched replaces the buckets still pending.
+// <p>
+// The file is read using <src>BucketFile::pread</src>, which does not
+// change the file pointer used by the cache. Because the prefetched data
+// are not updated when the cache writes a bucket, a prefetcher should
+// only be used for files opened read-only.
+// </synopsis>
+
+// <motivation>
+// Sequential scans through a tiled column stall on every cache miss.
+// Reading the next tiles ahead makes it possible to keep the storage
+// busy while the caller processes the current tiles.
+// </motivation>
+
+class BucketPrefetcher
+{
+public:
+    // Create the prefetcher for the part of the file starting at
+    // startOffset. At most maxBuckets buckets are held.
+    // The file should be open.
+    BucketPrefetcher (BucketFile* file, Int64 startOffset,
+                      uInt bucketSize, uInt maxBuckets);
+
+    // The destructor stops the background thread.
+    ~BucketPrefetcher();
+
+    // Forbid copy constructor.
+    BucketPrefetcher (const BucketPrefetcher&) = delete;
+
+    // Forbid assignment.
+    BucketPrefetcher& operator= (const BucketPrefetcher&) = delete;
+
+    // Schedule the given buckets for reading.
+    // The buckets still pending from a previous call are discarded.
+    // Buckets already read or being read are not read again.
+    void prefetch (const std::vector<uInt>& bucketNrs);
+
+    // Copy the external data of the bucket into the buffer if the bucket
+    // has been prefetched. If the bucket is being read, it waits until
+    // the read has finished. If the bucket is still pending, it is removed
+    // from the queue (the caller reads it itself).
+    // It returns False if the bucket was not prefetched.
+    Bool take (uInt bucketNr, char* buffer);
+
+    // Remove all pending and prefetched buckets.
+    // It waits for a possible read in progress.
+    void clear();
+
+    // Get the maximum number of buckets held.
+    uInt maxBuckets() const
+      { return itsMaxBuckets; }
+
+    // Get the statistics.
+    // <group>
+    uInt nread() const;
+    uInt nhit() const;
+    // </group>
+
+private:
+    // The function executed by the background thread.
+    void run();
+
+    // Remove the oldest buckets if more than the maximum are held.
+    // The mutex must be locked by the caller.
+    void limitBuckets();
+
+    //# Data members
+    BucketFile* itsFile;
+    Int64       itsStartOffset;
+    uInt        itsBucketSize;
+    uInt        itsMaxBuckets;
+    // The buckets still to be read.
+    std::deque<uInt>  itsQueue;
+    // The buckets that have been read (in external format).
+    std::map<uInt, std::vector<char>> itsBuckets;
+    // The order in which the buckets have been read.
+    std::deque<uInt>  itsOrder;
+    // The bucket being read by the thread (-1 = none).
+    Int64             itsBusy;
+    Bool              itsStop;
+    uInt              itsNread;
+    uInt              itsNhit;
+    mutable std::mutex      itsMutex;
+    std::condition_variable itsWorkCond;
+    std::condition_variable itsDoneCond;
+    std::thread             itsThread;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
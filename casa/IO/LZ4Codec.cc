@@ -0,0 +1,256 @@
+//# LZ4Codec.cc: Lossless byte-shuffle and LZ4 block compression
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/IO/LZ4Codec.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <cstring>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// Parameters of the LZ4 block format.
+// The last match must start at least 12 bytes before the end of the block
+// and the last 5 bytes are always literals.
+static const size_t lz4MinMatch   = 4;
+static const size_t lz4MfLimit    = 12;
+static const size_t lz4LastLit    = 5;
+static const size_t lz4MaxOffset  = 65535;
+static const uInt   lz4HashLog    = 14;
+
+inline uInt lz4Read32 (const uChar* ptr)
+{
+    uInt v;
+    memcpy (&v, ptr, sizeof(uInt));
+    return v;
+}
+
+inline uInt lz4Hash (uInt seq)
+{
+    return (seq * 2654435761U) >> (32 - lz4HashLog);
+}
+
+inline uChar* lz4PutLength (uChar* op, size_t len)
+{
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = uChar(len);
+    return op;
+}
+
+
+void LZ4Codec::shuffle (void* to, const void* from,
+                        size_t nelem, size_t elemSize)
+{
+    uChar* out = static_cast<uChar*>(to);
+    const uChar* in = static_cast<const uChar*>(from);
+    if (elemSize <= 1) {
+        memcpy (out, in, nelem*elemSize);
+        return;
+    }
+    for (size_t k=0; k<elemSize; ++k) {
+        const uChar* inp = in + k;
+        for (size_t i=0; i<nelem; ++i) {
+            *out++ = *inp;
+            inp += elemSize;
+        }
+    }
+}
+
+void LZ4Codec::unshuffle (void* to, const void* from,
+                          size_t nelem, size_t elemSize)
+{
+    uChar* out = static_cast<uChar*>(to);
+    const uChar* in = static_cast<const uChar*>(from);
+    if (elemSize <= 1) {
+        memcpy (out, in, nelem*elemSize);
+        return;
+    }
+    for (size_t k=0; k<elemSize; ++k) {
+        uChar* outp = out + k;
+        for (size_t i=0; i<nelem; ++i) {
+            *outp = *in++;
+            outp += elemSize;
+        }
+    }
+}
+
+size_t LZ4Codec::maxCompressedSize (size_t nbytes)
+{
+    return nbytes + nbytes/255 + 16;
+}
+
+size_t LZ4Codec::compress (void* to, const void* from, size_t nbytes)
+{
+    const uChar* src = static_cast<const uChar*>(from);
+    const uChar* end = src + nbytes;
+    const uChar* anchor = src;
+    uChar* op = static_cast<uChar*>(to);
+    if (nbytes > lz4MfLimit) {
+        const uChar* mflimit    = end - lz4MfLimit;
+        const uChar* matchlimit = end - lz4LastLit;
+        // The hash table contains the last position (+1) of a sequence.
+        std::vector<size_t> table (size_t(1) << lz4HashLog, 0);
+        const uChar* ip = src;
+        // Skip faster through data that do not compress.
+        uInt nmiss = 0;
+        while (ip <= mflimit) {
+            uInt seq = lz4Read32 (ip);
+            uInt h = lz4Hash (seq);
+            size_t refPos = table[h];
+            table[h] = ip - src + 1;
+            if (refPos > 0) {
+                const uChar* ref = src + refPos - 1;
+                if (size_t(ip - ref) <= lz4MaxOffset  &&
+                    lz4Read32(ref) == seq) {
+                    // Extend the match as far as possible.
+                    const uChar* mp = ip + lz4MinMatch;
+                    const uChar* rp = ref + lz4MinMatch;
+                    while (mp < matchlimit  &&  *mp == *rp) {
+                        ++mp;
+                        ++rp;
+                    }
+                    size_t litLen   = ip - anchor;
+                    size_t matchLen = mp - ip - lz4MinMatch;
+                    size_t offset   = ip - ref;
+                    uChar* token = op++;
+                    if (litLen >= 15) {
+                        *token = 15 << 4;
+                        op = lz4PutLength (op, litLen - 15);
+                    } else {
+                        *token = uChar(litLen << 4);
+                    }
+                    memcpy (op, anchor, litLen);
+                    op += litLen;
+                    *op++ = uChar(offset & 0xff);
+                    *op++ = uChar(offset >> 8);
+                    if (matchLen >= 15) {
+                        *token |= 15;
+                        op = lz4PutLength (op, matchLen - 15);
+                    } else {
+                        *token |= uChar(matchLen);
+                    }
+                    ip = mp;
+                    anchor = mp;
+                    nmiss = 0;
+                    continue;
+                }
+            }
+            ip += 1 + (nmiss++ >> 6);
+        }
+    }
+    // The last sequence only contains literals.
+    size_t litLen = end - anchor;
+    if (litLen >= 15) {
+        *op++ = 15 << 4;
+        op = lz4PutLength (op, litLen - 15);
+    } else {
+        *op++ = uChar(litLen << 4);
+    }
+    memcpy (op, anchor, litLen);
+    op += litLen;
+    return op - static_cast<uChar*>(to);
+}
+
+void LZ4Codec::decompress (void* to, size_t nbytes,
+                           const void* from, size_t compressedSize)
+{
+    const uChar* ip   = static_cast<const uChar*>(from);
+    const uChar* iend = ip + compressedSize;
+    uChar* dst  = static_cast<uChar*>(to);
+    uChar* op   = dst;
+    uChar* oend = dst + nbytes;
+    while (True) {
+        if (ip >= iend) {
+            throw AipsError ("LZ4Codec::decompress: unexpected end of input");
+        }
+        uInt token = *ip++;
+        size_t litLen = token >> 4;
+        if (litLen == 15) {
+            uInt s;
+            do {
+                if (ip >= iend) {
+                    throw AipsError ("LZ4Codec::decompress: invalid "
+                                     "literal length");
+                }
+                s = *ip++;
+                litLen += s;
+            } while (s == 255);
+        }
+        if (litLen > size_t(iend - ip)  ||  litLen > size_t(oend - op)) {
+            throw AipsError ("LZ4Codec::decompress: literals exceed buffer");
+        }
+        memcpy (op, ip, litLen);
+        op += litLen;
+        ip += litLen;
+        // The last sequence has no match.
+        if (ip == iend) {
+            break;
+        }
+        if (iend - ip < 2) {
+            throw AipsError ("LZ4Codec::decompress: truncated offset");
+        }
+        size_t offset = size_t(ip[0]) | (size_t(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0  ||  offset > size_t(op - dst)) {
+            throw AipsError ("LZ4Codec::decompress: invalid match offset");
+        }
+        size_t matchLen = token & 15;
+        if (matchLen == 15) {
+            uInt s;
+            do {
+                if (ip >= iend) {
+                    throw AipsError ("LZ4Codec::decompress: invalid "
+                                     "match length");
+                }
+                s = *ip++;
+                matchLen += s;
+            } while (s == 255);
+        }
+        matchLen += lz4MinMatch;
+        if (matchLen > size_t(oend - op)) {
+            throw AipsError ("LZ4Codec::decompress: match exceeds buffer");
+        }
+        const uChar* mp = op - offset;
+        if (offset >= matchLen) {
+            memcpy (op, mp, matchLen);
+            op += matchLen;
+        } else {
+            // Overlapping copy, which repeats the last offset bytes.
+            for (size_t i=0; i<matchLen; ++i) {
+                *op++ = *mp++;
+            }
+        }
+    }
+    if (op != oend) {
+        throw AipsError ("LZ4Codec::decompress: decompressed size mismatch");
+    }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,114 @@
+//# LZ4Codec.h: Lossless byte-shuffle and LZ4 block compression
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_LZ4CODEC_H
+#define CASA_LZ4CODEC_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <cstddef>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Lossless byte-shuffle and LZ4 block compression
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tLZ4Codec">
+// </reviewed>
+
+// <synopsis>
+// LZ4Codec contains static functions to compress and decompress a buffer
+// without loss of information.
+// <p>
+// The compression uses the LZ4 block format, which is a fast
+// Lempel-Ziv variant. The data are written as a sequence of literal bytes
+// and matches, where a match is a copy of earlier output given by its
+// offset and length. The compressor uses a simple greedy search with a hash
+// table of 4-byte sequences; it is not as strong as the reference LZ4 or
+// Zstd implementations, but decompression is very fast and the output can
+// be decompressed by any LZ4 block decoder.
+// <p>
+// Numerical data usually compress much better if the bytes are shuffled
+// first. Shuffling puts byte <src>k</src> of all elements together, so
+// the (often constant) high-order bytes form long runs.
+// <p>
+// The decompress function checks the validity of the compressed data
+// and throws an exception if they are corrupt. It never writes outside
+// the output buffer.
+// </synopsis>
+
+// <example>
+// <srcblock>
+// std::vector<float> data(1000);
+// std::vector<char> shuffled(data.size()*sizeof(float));
+// LZ4Codec::shuffle (shuffled.data(), data.data(), data.size(), sizeof(float));
+// std::vector<char> out(LZ4Codec::maxCompressedSize(shuffled.size()));
+// size_t n = LZ4Codec::compress (out.data(), shuffled.data(), shuffled.size());
+// </srcblock>
+// </example>
+
+// <motivation>
+// Columns like FLAG, UVW or WEIGHT_SPECTRUM contain data with a lot of
+// redundancy, which can be stored losslessly in a much smaller space.
+// The LZ4 format is implemented here to avoid an external dependency.
+// </motivation>
+
+class LZ4Codec
+{
+public:
+    // Shuffle <src>nelem</src> elements of <src>elemSize</src> bytes.
+    // Byte <src>k</src> of element <src>i</src> is written to position
+    // <src>k*nelem+i</src>. The buffers must not overlap.
+    static void shuffle (void* to, const void* from,
+                         size_t nelem, size_t elemSize);
+
+    // Undo the shuffle.
+    static void unshuffle (void* to, const void* from,
+                           size_t nelem, size_t elemSize);
+
+    // Get the maximum size of the compressed output for a buffer of
+    // the given size.
+    static size_t maxCompressedSize (size_t nbytes);
+
+    // Compress the buffer of <src>nbytes</src> into <src>to</src>,
+    // which must have at least size <src>maxCompressedSize(nbytes)</src>.
+    // It returns the size of the compressed data.
+    static size_t compress (void* to, const void* from, size_t nbytes);
+
+    // Decompress <src>compressedSize</src> bytes into <src>to</src>.
+    // An exception is thrown if the data are corrupt or do not
+    // decompress to exactly <src>nbytes</src> bytes.
+    static void decompress (void* to, size_t nbytes,
+                            const void* from, size_t compressedSize);
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
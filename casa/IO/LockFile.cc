@@ -35,6 +35,8 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/sstream.h>
 
@@ -79,7 +81,11 @@ LockFile::LockFile (const String& fileName, double inspectInterval,
 ///  itsHostId    (gethostid()),     gethostid is not declared in unistd.h
   itsHostId      (0),
   itsReqId       (SIZEREQID/SIZEINT, (Int)0),
-  itsInspectCount(0)
+  itsInspectCount(0),
+  itsShmCounter  (0),
+  itsLastCounter (0),
+  itsCounterValid(False),
+  itsInfoUnchanged(False)
 {
     AlwaysAssert (SIZEINT == CanonicalConversion::canonicalSize (static_cast<Int*>(0)),
 		  AipsError);
@@ -136,12 +142,60 @@ LockFile::LockFile (const String& fileName, double inspectInterval,
 
 LockFile::~LockFile()
 {
+    if (itsShmCounter != 0) {
+        ::munmap (itsShmCounter, sizeof(uInt64));
+        //# Remove the shared counter if no other process uses the lock file.
+        //# That is the case if a write lock on the entire file can be
+        //# obtained (it is released when the file is closed below).
+        FileLocker allLocker (itsLocker.fd());
+        if (allLocker.acquire (FileLocker::Write, 1)) {
+            ::unlink (itsShmName.chars());
+        }
+    }
     int fd = itsLocker.fd();
     if (fd >= 0) {
 	FiledesIO::close (fd);
     }
 }
 
+Bool LockFile::enableSharedCounter()
+{
+    if (itsShmCounter != 0) {
+        return True;
+    }
+    if (!itsFileIO) {
+        return False;
+    }
+    // Derive the name from the device and inode of the lock file, so all
+    // processes on this host (and all locknrs) share the same counter.
+    struct stat st;
+    if (::fstat (itsLocker.fd(), &st) != 0) {
+        return False;
+    }
+    String name = "/dev/shm/casacore_lock_" +
+      String::toString(uInt64(st.st_dev)) + '_' +
+      String::toString(uInt64(st.st_ino));
+    // Only processes of the same user can update the counter.
+    int fd = trace3OPEN (name.chars(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return False;
+    }
+    // Make sure the file has the size of the counter (a new file is zeroed).
+    void* ptr = MAP_FAILED;
+    if (::ftruncate (fd, sizeof(uInt64)) == 0) {
+        ptr = ::mmap (0, sizeof(uInt64), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+    }
+    traceCLOSE (fd);
+    if (ptr == MAP_FAILED) {
+        return False;
+    }
+    itsShmName      = name;
+    itsShmCounter   = static_cast<std::atomic<uInt64>*>(ptr);
+    itsCounterValid = False;
+    return True;
+}
+
 Bool LockFile::isMultiUsed()
 {
     //# If a write lock cannot be obtained, the file is in use.
@@ -181,6 +235,20 @@ Bool LockFile::acquire (MemoryIO* info, FileLocker::LockType type,
     //# If no info is needed, read req id's only when needed.
     //# Note that each IO-operation is quite expensive, so do as few
     //# IO's as possible.
+    //# If the shared counter did not change, the info is unchanged, which
+    //# is indicated by returning an empty info object.
+    itsInfoUnchanged = False;
+    if (info != 0  &&  itsShmCounter != 0) {
+        uInt64 counter = itsShmCounter->load();
+        if (itsCounterValid  &&  counter == itsLastCounter) {
+            info->clear();
+            info = 0;
+            itsInfoUnchanged = True;
+        } else {
+            itsLastCounter  = counter;
+            itsCounterValid = True;
+        }
+    }
     if (info != 0) {
 	getInfo (*info);
     } else if (added) {
@@ -302,6 +370,12 @@ void LockFile::putInfo (const MemoryIO& info) const
     }
     // Do an fsync to achieve NFS synchronization.
     fsync (itsLocker.fd());
+    // Tell other processes on this host that the info has changed.
+    // This process does not need to reread its own info.
+    if (itsShmCounter != 0) {
+        itsLastCounter  = ++(*itsShmCounter);
+        itsCounterValid = True;
+    }
 }
 
 Int LockFile::getNrReqId() const
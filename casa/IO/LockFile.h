@@ -34,6 +34,8 @@
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <sys/types.h>
+#include <atomic>
+#include <memory>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -130,6 +132,21 @@ class CanonicalIO;
 // locks held by the other LockFile objects. This behaviour is due to the way
 // file locking is working on UNIX machines (certainly on Solaris 2.6).
 // One can use the test program tLockFile to test for this behaviour.
+// <p>
+// Reading the synchronization info on each lock acquisition can be
+// expensive, in particular on network file systems. If all processes
+// using the file run on the same host, function <src>enableSharedCounter</src>
+// can be used to reduce this overhead. It maps a small counter in shared
+// memory (in /dev/shm) which is incremented each time the info is written.
+// If the counter did not change since the last time the info was read
+// by this object, <src>acquire</src> does not read the info, but returns
+// an empty <src>MemoryIO</src> object telling that nothing changed.
+// Note that this is only correct if all processes writing the file
+// use the shared counter, thus if they all run on the same host.
+// The counter file is created with permissions 0644 (restricted by the
+// umask), so these processes must also be run by the same user.
+// The counter file is removed when the last process using the lock file
+// deletes its LockFile object (if it has the lock file open for write).
 // </synopsis>
 
 // <example>
@@ -280,6 +297,25 @@ public:
     // be opened.
     static uInt showLock (uInt& pid, Bool& permLocked, const String& fileName);
 
+    // Use a counter in shared memory telling if the info has been changed
+    // by another process on this host, which makes it possible to skip
+    // reading the info in <src>acquire</src> if nothing changed.
+    // It should only be used if all processes writing the file run on this
+    // host and also use the shared counter.
+    // It returns False if the shared counter could not be used (e.g., if
+    // no lock file is used or if /dev/shm is not available).
+    Bool enableSharedCounter();
+
+    // Did the last acquire skip reading the info because the shared
+    // counter did not change?
+    Bool infoUnchanged() const
+      { return itsInfoUnchanged; }
+
+    // Get the name of the file holding the shared counter
+    // (empty if not used).
+    const String& sharedCounterName() const
+      { return itsShmName; }
+
 private:
     // The copy constructor cannot be used (its semantics are too difficult).
     LockFile (const LockFile&);
@@ -330,6 +366,11 @@ private:
     Int          itsInspectCount;     //# The number of times inspect() has
                                       //# been called since the last elapsed
                                       //# time check.
+    String       itsShmName;          //# Name of the shared counter file
+    std::atomic<uInt64>* itsShmCounter; //# Shared change counter (0 = none)
+    mutable uInt64 itsLastCounter;    //# Counter value of last info read
+    mutable Bool   itsCounterValid;   //# Is itsLastCounter valid?
+    Bool         itsInfoUnchanged;    //# Info not read by last acquire?
 };
 
 
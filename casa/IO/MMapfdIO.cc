@@ -32,6 +32,7 @@
 #include <unistd.h>
 #include <errno.h>
 #include <cstring>
+#include <algorithm>
 
 namespace casacore
 {
@@ -165,6 +166,39 @@ namespace casacore
     return itsPtr+offset;
   }
 
+  void MMapfdIO::advise (Int64 offset, Int64 length, Advice advice)
+  {
+    if (itsPtr == 0  ||  offset >= itsFileSize  ||  length <= 0) {
+      return;
+    }
+    length = std::min (length, itsFileSize - offset);
+    // madvise requires a page-aligned start address.
+    Int64 pageSize = sysconf(_SC_PAGESIZE);
+    Int64 start = offset - offset % pageSize;
+    if (advice == HugePage) {
+#ifdef MADV_HUGEPAGE
+      // A failure (e.g. not supported for the file) is no problem.
+      ::madvise (itsPtr + start, length + offset - start, MADV_HUGEPAGE);
+#endif
+      return;
+    }
+    int adv = POSIX_MADV_NORMAL;
+    switch (advice) {
+    case Sequential:
+      adv = POSIX_MADV_SEQUENTIAL;
+      break;
+    case Random:
+      adv = POSIX_MADV_RANDOM;
+      break;
+    case WillNeed:
+      adv = POSIX_MADV_WILLNEED;
+      break;
+    default:
+      break;
+    }
+    posix_madvise (itsPtr + start, length + offset - start, adv);
+  }
+
   void* MMapfdIO::getWritePointer (Int64 offset)
   {
     if (!itsIsWritable) {
@@ -61,6 +61,22 @@ namespace casacore
 class MMapfdIO: public FiledesIO
 {
 public:
+  // The expected access pattern of (part of) the mapped file.
+  // It is used to tell the OS how to do read-ahead.
+  enum Advice {
+    // Default read-ahead.
+    Normal,
+    // The data will be accessed sequentially (aggressive read-ahead).
+    Sequential,
+    // The data will be accessed in random order (no read-ahead).
+    Random,
+    // The data will be needed soon (read it in the background).
+    WillNeed,
+    // Back the mapping with transparent huge pages if the file system
+    // supports it. It does not change the read-ahead.
+    HugePage
+  };
+
   // Default constructor.
   // A file can be memory-mapped using the map function.
   MMapfdIO();
@@ -119,6 +135,11 @@ public:
   void* getWritePointer (Int64 offset);
   // </group>
 
+  // Tell the OS how the given part of the mapped file will be accessed.
+  // The part is extended to whole pages. Parts beyond end-of-file are
+  // ignored, as is a failing advice because it is only a hint.
+  void advise (Int64 offset, Int64 length, Advice advice);
+
   // Get the file size.
   Int64 getFileSize() const
     { return itsFileSize; }
@@ -26,7 +26,9 @@
 //# Includes
 #include <casacore/casa/IO/MultiFile.h>
 #include <casacore/casa/IO/MFFileIO.h>
+#include <casacore/casa/IO/MultiFileAsyncIO.h>
 #include <casacore/casa/IO/FileUnbufferedIO.h>
+#include <casacore/casa/IO/ObjectStoreIO.h>
 #include <casacore/casa/IO/MemoryIO.h>
 #include <casacore/casa/IO/CanonicalIO.h>
 #include <casacore/casa/IO/AipsIO.h>
@@ -97,14 +99,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
  */
 
   MultiFile::MultiFile (const String& name, ByteIO::OpenOption option,
-                        Int blockSize, Bool useODirect, Bool useCRC)
+                        Int blockSize, Bool useODirect, Bool useCRC,
+                        uInt nstripe, Bool asyncIO)
     : MultiFileBase (name, blockSize, useODirect),
       itsNrContUsed {0,0},
       itsHdrContInx (0),     // Start using the first continuation block
-      itsUseCRC     (useCRC)
+      itsUseCRC     (useCRC),
+      itsNrStripe   (std::max(nstripe, 1u))
   {
-    itsIO.reset (new FileUnbufferedIO (name, option, useODirect));
-    init (option);
+    // The nr of stripes is stored in a single byte in the header.
+    if (itsNrStripe > 255) {
+      throw AipsError ("MultiFile " + name + ": at most 255 stripes can be used");
+    }
+    if (ObjectStoreClient::isURL (name)) {
+      itsIO.reset (newObjectStoreIO (name, option));
+    } else {
+      itsIO.reset (new FileUnbufferedIO (name, option, useODirect));
+    }
+    init (option, asyncIO);
   }
 
   MultiFile::MultiFile (const String& name,
@@ -115,10 +127,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     : MultiFileBase (name, blockSize>0 ? blockSize:parent->blockSize(), False),
       itsNrContUsed {0,0},
       itsHdrContInx (0),     // Start using the first continuation block
-      itsUseCRC     (False)
+      itsUseCRC     (False),
+      itsNrStripe   (1)
   {
+    // A nested MultiFile cannot use asynchronous I/O, because the parent
+    // cannot be accessed by multiple threads.
     itsIO.reset (new MFFileIO (parent, name, option));
-    init (option);
+    init (option, False);
   }
 
   std::shared_ptr<MultiFileBase> MultiFile::makeNested
@@ -128,16 +143,70 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return std::make_shared<MultiFile>(name, parent, option, blockSize);
   }
 
-  void MultiFile::init (ByteIO::OpenOption option)
+  void MultiFile::init (ByteIO::OpenOption option, Bool asyncIO)
   {
     if (option == ByteIO::New  ||  option == ByteIO::NewNoReplace) {
       // New file; first block is for administration.
       setNewFile();
       itsNrBlock = 1;
+      openStripes (option);
     } else {
+      // Reading the header also opens the stripe files.
       readHeader();
     }
     itsWritable = itsIO->isWritable();
+    if (asyncIO) {
+      std::vector<ByteIO*> files(1, itsIO.get());
+      for (const std::unique_ptr<ByteIO>& io : itsStripeIO) {
+        files.push_back (io.get());
+      }
+      // Allow for a few blocks per stripe to keep all files busy.
+      itsAsyncIO.reset (new MultiFileAsyncIO (files, itsBlockSize,
+                                              itsUseODirect, 4*itsNrStripe));
+    }
+  }
+
+  void MultiFile::openStripes (ByteIO::OpenOption option)
+  {
+    if (itsStripeIO.size() + 1 >= itsNrStripe) {
+      return;
+    }
+    if (option != ByteIO::New  &&  option != ByteIO::NewNoReplace) {
+      option = (itsIO->isWritable() ? ByteIO::Update : ByteIO::Old);
+    }
+    for (uInt i=itsStripeIO.size()+1; i<itsNrStripe; ++i) {
+      String name = itsName + "_stripe" + String::toString(i);
+      if (ObjectStoreClient::isURL (name)) {
+        itsStripeIO.push_back (std::unique_ptr<ByteIO>
+                               (newObjectStoreIO (name, option)));
+      } else {
+        itsStripeIO.push_back (std::unique_ptr<ByteIO>
+          (new FileUnbufferedIO (name, option, itsUseODirect)));
+      }
+    }
+  }
+
+  ByteIO* MultiFile::newObjectStoreIO (const String& url,
+                                       ByteIO::OpenOption option) const
+  {
+    if (option != ByteIO::Old) {
+      throw AipsError ("MultiFile " + url + ": an object in an object store "
+                       "can only be opened readonly");
+    }
+    // Fetch several MultiFile blocks per request to hide the latency.
+    Int64 blockSize = std::max (Int64(4*1024*1024), Int64(itsBlockSize));
+    return new ObjectStoreIO (url, blockSize);
+  }
+
+  ByteIO& MultiFile::blockIO (Int64 blknr, Int64& offset) const
+  {
+    if (itsNrStripe == 1) {
+      offset = blknr * itsBlockSize;
+      return *itsIO;
+    }
+    offset = (blknr / itsNrStripe) * itsBlockSize;
+    uInt stripe = blknr % itsNrStripe;
+    return (stripe == 0 ? *itsIO : *itsStripeIO[stripe-1]);
   }
 
   MultiFile::~MultiFile()
@@ -147,16 +216,25 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void MultiFile::doFlushFile()
   {
+    if (itsAsyncIO) {
+      itsAsyncIO->wait();
+    }
     itsIO->flush();
+    for (std::unique_ptr<ByteIO>& io : itsStripeIO) {
+      io->flush();
+    }
   }
 
   void MultiFile::close()
   {
     // Flush.
     flush();
+    // Stop the I/O threads.
+    itsAsyncIO.reset();
     // Clear all file info.
     itsInfo.clear();
-    // Delete the file object.
+    // Delete the file objects.
+    itsStripeIO.clear();
     itsIO.reset (0);
   }
 
@@ -166,12 +244,21 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       return;
     }
     itsIO->reopenRW();
+    for (std::unique_ptr<ByteIO>& io : itsStripeIO) {
+      io->reopenRW();
+    }
     itsWritable = True;
   }
 
   void MultiFile::fsync()
   {
+    if (itsAsyncIO) {
+      itsAsyncIO->wait();
+    }
     itsIO->fsync();
+    for (std::unique_ptr<ByteIO>& io : itsStripeIO) {
+      io->fsync();
+    }
   }
 
   void MultiFile::writeHeader()
@@ -181,6 +268,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // If too large, the remainder is written into continuation blocks.
     // There are 2 sets of continuation blocks to avoid that the header
     // gets corrupted in case of a crash while writing the header.
+    // All data blocks must have been written before the header.
+    if (itsAsyncIO) {
+      itsAsyncIO->wait();
+    }
     auto mio = std::make_shared<MemoryIO>(itsBlockSize, itsBlockSize);
     auto cio = std::make_shared<CanonicalIO>(mio);
     AipsIO aio(cio);
@@ -188,7 +279,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 zero64 = 0;
     uInt  zero32 = 0;
     char  char8[8] = {0,0,0,0,0,0,0,0};
-    Int   version = 2;
+    // A striped file gets version 3, so older software does not
+    // misinterpret it.
+    Int   version = (itsNrStripe > 1 ? 3 : 2);
     // Start with a zero to distinguish it from version 1.
     // The first value in version 1 is always > 0.
     cio->write (1, &zero64);
@@ -200,6 +293,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     cio->write (1, &itsBlockSize);
     cio->write (1, &itsNrBlock);
     if (itsUseCRC) char8[0] = 1;
+    char8[1] = (itsNrStripe > 1 ? char(itsNrStripe) : 0);
     cio->write (8, char8);
     AlwaysAssert (mio->length() == 64, AipsError);
     // First write general info and file names, etc.
@@ -306,7 +400,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       memcpy (iobuf + sizeof(Int64), remHdr, std::min(todo,contBlkSize));
       remHdr += contBlkSize;
       todo -= contBlkSize;
-      itsIO->pwrite (itsBlockSize, hdrContNrs[i]*itsBlockSize, iobuf);
+      Int64 offset;
+      ByteIO& io = blockIO (hdrContNrs[i], offset);
+      io.pwrite (itsBlockSize, offset, iobuf);
     }
     // Store first continuation blocknr in header.
     uChar* buf = const_cast<uChar*>(mio.getBuffer());
@@ -375,7 +471,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                   Int64[n] index (MultiFile block containing file block i)
                   Int64    file size (bytes)
               Note that .hdrext is used if header does not fit in first block
-        version 2
+        version 2 and 3 (3 is used for a striped MultiFile)
           Int64  0
           Int64  first block of header continuation (<0=none)
           Int64  hdrCounter
@@ -384,7 +480,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
           Int64  header size
           Int64  blockSize
           char   useCRC
-          char[7] spare
+          uChar  nr of stripes (only version 3; 0 or 1 is no striping)
+          char[6] spare
           AipsIO 'MultiFile' with same version as above
               Int64   nr of blocks used
               nfile*fileinfo
@@ -409,6 +506,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     - Make CRC of entire header (with 0 in headerCRC)
     - First write cont.blocks and finally first block (reset cont.blocknr)
     */
+    // Prefetched blocks might be outdated.
+    if (itsAsyncIO) {
+      itsAsyncIO->clearPrefetch();
+    }
     // Read the first 24 bytes (3x Int64) of the header.
     std::vector<char> buf(3*sizeof(Int64));
     itsIO->pread (buf.size(), 0, buf.data());
@@ -477,11 +578,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     leadSize += 40;
     CanonicalConversion::toLocal (contBlockNr, &(buf[8]));
     CanonicalConversion::toLocal (version, &(buf[24]));
-    // This version of MultiFile can only handle version 2.
+    // This version of MultiFile can only handle version 2 and 3.
     // Future versions might use higher version numbers.
-    if (version != 2) {
+    if (version != 2  &&  version != 3) {
       throw AipsError("This version of Casacore supports up to MultiFile "
-                      "version 2, not version " + String::toString(version));
+                      "version 3, not version " + String::toString(version));
     }
     CanonicalConversion::toLocal (headerCRC, &(buf[28]));
     CanonicalConversion::toLocal (headerSize, &(buf[32]));
@@ -490,6 +591,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     char tmpc;
     CanonicalConversion::toLocal (tmpc, &(buf[56]));
     itsUseCRC = (tmpc!=0);
+    // The stripe files are needed to read the header continuation blocks.
+    itsNrStripe = 1;
+    if (version == 3) {
+      uChar nstripe = buf[57];
+      itsNrStripe = std::max(uInt(nstripe), 1u);
+    }
+    openStripes (ByteIO::Old);
     buf.resize (headerSize);
     if (headerSize <= itsBlockSize) {
       // Only one header block; read only the part that is needed.
@@ -556,7 +664,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 contBlkSize = itsBlockSize - sizeof(Int64);
     while (off < buf.size()) {
       AlwaysAssert (blknr!=0, AipsError);
-      itsIO->pread (itsBlockSize, blknr*itsBlockSize, iobuf);
+      Int64 offset;
+      ByteIO& io = blockIO (blknr, offset);
+      io.pread (itsBlockSize, offset, iobuf);
       memcpy (&(buf[off]), iobuf + sizeof(Int64),
               std::min(todo,contBlkSize));
       off += contBlkSize;
@@ -585,6 +695,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void MultiFile::doTruncateFile (MultiFileInfo& info, uInt64 nrblk)
   {
     if (nrblk < info.blockNrs.size()) {
+      // Freed blocks might be reused, so forget their prefetched data.
+      if (itsAsyncIO) {
+        itsAsyncIO->clearPrefetch();
+      }
       // Add the blocknrs to the free list.
       // Later we can merge them in order and leave out blocks past last block used.
       itsFreeBlocks.reserve (itsFreeBlocks.size() + info.blockNrs.size() - nrblk);
@@ -619,7 +733,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (i > 0) {
       itsFreeBlocks.erase (itsFreeBlocks.begin(), itsFreeBlocks.begin() + i);
       itsNrBlock -= i;
-      itsIO->truncate (itsNrBlock * itsBlockSize);
+      // Stripe file j contains the blocks j, j+nstripe, etc.
+      itsIO->truncate (((itsNrBlock + itsNrStripe - 1) / itsNrStripe) *
+                       itsBlockSize);
+      for (uInt j=1; j<itsNrStripe; ++j) {
+        Int64 nrb = (itsNrBlock > j ?
+                     (itsNrBlock - j + itsNrStripe - 1) / itsNrStripe : 0);
+        itsStripeIO[j-1]->truncate (nrb * itsBlockSize);
+      }
       if (itsUseCRC) {
         itsCRC.resize (itsNrBlock);
       }
@@ -658,18 +779,40 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void MultiFile::readBlock (MultiFileInfo& info, Int64 blknr,
                              void* buffer)
   {
-    itsIO->pread (itsBlockSize, info.blockNrs[blknr] * itsBlockSize, buffer);
+    Int64 physnr = info.blockNrs[blknr];
+    if (!itsAsyncIO  ||  !itsAsyncIO->read (physnr, buffer)) {
+      Int64 offset;
+      ByteIO& io = blockIO (physnr, offset);
+      io.pread (itsBlockSize, offset, buffer);
+    }
     if (itsUseCRC) {
-      checkCRC (buffer, info.blockNrs[blknr]);
+      checkCRC (buffer, physnr);
+    }
+    // Read the next blocks ahead if the file is read sequentially.
+    if (itsAsyncIO  &&  blknr == info.lastRead + 1) {
+      Int64 nrblk = info.blockNrs.size();
+      Int64 last  = std::min(blknr + 2*Int64(itsNrStripe), nrblk-1);
+      for (Int64 i=blknr+1; i<=last; ++i) {
+        itsAsyncIO->prefetch (info.blockNrs[i]);
+      }
     }
+    info.lastRead = blknr;
   }
 
   void MultiFile::writeBlock (MultiFileInfo& info, Int64 blknr,
                               const void* buffer)
   {
-    itsIO->pwrite (itsBlockSize, info.blockNrs[blknr] * itsBlockSize, buffer);
+    Int64 physnr = info.blockNrs[blknr];
+    // Calculate the CRC before the buffer can be reused.
     if (itsUseCRC) {
-      storeCRC (buffer, info.blockNrs[blknr]);
+      storeCRC (buffer, physnr);
+    }
+    if (itsAsyncIO) {
+      itsAsyncIO->write (physnr, buffer);
+    } else {
+      Int64 offset;
+      ByteIO& io = blockIO (physnr, offset);
+      io.pwrite (itsBlockSize, offset, buffer);
     }
   }
 
@@ -724,7 +867,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     os << fileName() << ": blocksize=" << blockSize()
        << "  nfile="  << nfile() << "  nblock=" << nblock()
-       << "  nCRC=" << itsCRC.size() << endl
+       << "  nCRC=" << itsCRC.size();
+    if (itsNrStripe > 1) {
+      os << "  nstripe=" << itsNrStripe;
+    }
+    os << endl
        << "  ncont=" << itsNrContUsed[0] << ',' << itsNrContUsed[1]
        << "  cont=" << itsHdrContInx
        << ' ' << itsHdrCont[itsHdrContInx].blockNrs
@@ -37,6 +37,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   class ByteIO;
   class CanonicalIO;
   class MemoryIO;
+  class MultiFileAsyncIO;
 
 
   // <summary> 
@@ -73,6 +74,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   //       data in a block are correctly read. The CRC values are stored as
   //       part of the header, thus not in each individual block. This is done
   //       to make the zero-copy behaviour possible (as described above).
+  //  <li> The data blocks can be striped over several physical files
+  //       (the first one is the MultiFile itself, the others have suffix
+  //       <src>_stripe1</src>, etc.). Block <src>i</src> is stored in file
+  //       <src>i%nstripe</src>. On Lustre each stripe file can be put on
+  //       another OST (using <src>lfs setstripe</src> on the directory),
+  //       so a single MultiFile can use the bandwidth of several OSTs.
+  //       Striping is only possible for a top-level MultiFile.
+  //  <li> Optionally asynchronous I/O is used. Dirty data blocks are written
+  //       by background threads (one per stripe file), so the application
+  //       does not wait for the writes. Furthermore, when a logical file is
+  //       read sequentially, the next blocks are read ahead in the background.
+  //       All data are written when the MultiFile is flushed, which is always
+  //       done before the header is written.
   //  <li> The header and the index are stored in the first block. If too large,
   //       continuation blocks are used. There are two sets of continuation
   //       blocks between which is alternated. This is done for robustness
@@ -154,8 +168,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // I/O behaviour.
     // <br>If useCRC=True, 32-bit CRC values are calculated and stored for
     // each data block. Note that useCRC is only used for new files.
+    // <br>The data blocks are striped over <src>nstripe</src> files.
+    // Also nstripe is only used for new files.
+    // <br>If asyncIO=True, data blocks are written and read ahead
+    // asynchronously.
+    // <br>If the name is a URL of an object store (e.g. s3://bucket/key),
+    // the MultiFile is read from the object store using
+    // <linkto class=ObjectStoreIO>ObjectStoreIO</linkto>. It can only be
+    // opened readonly.
     explicit MultiFile (const String& name, ByteIO::OpenOption, Int blockSize=0,
-                        Bool useODirect=False, Bool useCRC=False);
+                        Bool useODirect=False, Bool useCRC=False,
+                        uInt nstripe=1, Bool asyncIO=False);
 
     // Open or create a MultiFile with the given name which is nested in the
     // given parent. Thus data are read/written in the parent file.
@@ -189,6 +212,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Show some info.
     void show (std::ostream&) const;
 
+    // Get the number of files the data blocks are striped over.
+    uInt nstripe() const
+      { return itsNrStripe; }
+
+    // Is asynchronous I/O used?
+    Bool asyncIO() const
+      { return itsAsyncIO != nullptr; }
+
     // Compress a block index by looking for subsequent block numbers.
     static std::vector<Int64> packIndex (const std::vector<Int64>& blockNrs);
 
@@ -197,7 +228,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   private:
     // Initialize the MultiFile object.
-    void init (ByteIO::OpenOption option);
+    void init (ByteIO::OpenOption option, Bool asyncIO);
+    // Open or create the stripe files (if not opened yet).
+    void openStripes (ByteIO::OpenOption option);
+    // Get the file containing the given block and the offset in that file.
+    ByteIO& blockIO (Int64 blknr, Int64& offset) const;
+    // Create the ByteIO object to read a file in an object store.
+    ByteIO* newObjectStoreIO (const String& url,
+                              ByteIO::OpenOption option) const;
     // Read the file info for the new version 2.
     void getInfoVersion2 (Int64 contBlockNr, CanonicalIO& aio);
     // Write a vector of Int64.
@@ -269,6 +307,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool  itsUseCRC;
     std::vector<uInt> itsCRC;   // CRC value per block (empty if useCRC=False)
     std::unique_ptr<ByteIO> itsIO;   // A regular file or nested MFFileIO
+    uInt  itsNrStripe;          // nr of files the blocks are striped over
+    std::vector<std::unique_ptr<ByteIO>> itsStripeIO;  // stripe files 1..n-1
+    std::unique_ptr<MultiFileAsyncIO> itsAsyncIO;
   };
 
 
@@ -0,0 +1,263 @@
+//# MultiFileAsyncIO.cc: Asynchronous block I/O for a (striped) MultiFile
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/IO/MultiFileAsyncIO.h>
+#include <casacore/casa/IO/ByteIO.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <string.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  MultiFileAsyncIO::MultiFileAsyncIO (const std::vector<ByteIO*>& files,
+                                      Int64 blockSize, Bool useODirect,
+                                      uInt maxBlocks)
+    : itsFiles         (files),
+      itsBlockSize     (blockSize),
+      itsUseODirect    (useODirect),
+      itsMaxBlocks     (std::max(maxBlocks, 1u)),
+      itsQueues        (files.size()),
+      itsSeqNr         (0),
+      itsNrOutstanding (0),
+      itsStop          (False)
+  {
+    for (uInt i=0; i<itsFiles.size(); ++i) {
+      itsThreads.push_back (std::thread(&MultiFileAsyncIO::run, this, i));
+    }
+  }
+
+  MultiFileAsyncIO::~MultiFileAsyncIO()
+  {
+    {
+      std::lock_guard<std::mutex> lock(itsMutex);
+      itsStop = True;
+    }
+    itsWorkCond.notify_all();
+    // The threads execute all outstanding requests before stopping.
+    for (std::thread& thr : itsThreads) {
+      thr.join();
+    }
+  }
+
+  std::shared_ptr<MultiFileBuffer> MultiFileAsyncIO::getBuffer()
+  {
+    if (itsFreeBuffers.empty()) {
+      return std::make_shared<MultiFileBuffer>(itsBlockSize, itsUseODirect);
+    }
+    std::shared_ptr<MultiFileBuffer> buf = itsFreeBuffers.back();
+    itsFreeBuffers.pop_back();
+    return buf;
+  }
+
+  void MultiFileAsyncIO::checkError()
+  {
+    if (! itsError.empty()) {
+      String msg = itsError;
+      itsError = String();
+      throw AipsError ("MultiFile asynchronous write failed: " + msg);
+    }
+  }
+
+  void MultiFileAsyncIO::write (Int64 blknr, const void* buffer)
+  {
+    std::unique_lock<std::mutex> lock(itsMutex);
+    checkError();
+    // A prefetched copy of the block is outdated.
+    itsPrefetched.erase (blknr);
+    // If the block is still queued, simply replace its contents.
+    auto iter = itsWrites.find (blknr);
+    if (iter != itsWrites.end()) {
+      memcpy (iter->second->data(), buffer, itsBlockSize);
+      return;
+    }
+    // Wait until there is room for another block.
+    itsDoneCond.wait (lock, [this] {
+        return itsWrites.size() + itsInFlight.size() < itsMaxBlocks; });
+    std::shared_ptr<MultiFileBuffer> buf = getBuffer();
+    memcpy (buf->data(), buffer, itsBlockSize);
+    itsWrites[blknr] = buf;
+    itsQueues[blknr % itsFiles.size()].push_back (Request{blknr, 0});
+    itsNrOutstanding++;
+    itsWorkCond.notify_all();
+  }
+
+  Bool MultiFileAsyncIO::read (Int64 blknr, void* buffer)
+  {
+    std::unique_lock<std::mutex> lock(itsMutex);
+    // The latest data of a block are in the write queue.
+    auto witer = itsWrites.find (blknr);
+    if (witer != itsWrites.end()) {
+      memcpy (buffer, witer->second->data(), itsBlockSize);
+      return True;
+    }
+    witer = itsInFlight.find (blknr);
+    if (witer != itsInFlight.end()) {
+      memcpy (buffer, witer->second->data(), itsBlockSize);
+      return True;
+    }
+    auto piter = itsPrefetched.find (blknr);
+    if (piter == itsPrefetched.end()) {
+      return False;
+    }
+    // Wait until the prefetch is done.
+    uInt64 seqnr = piter->second.seqnr;
+    itsDoneCond.wait (lock, [this, blknr, seqnr] {
+        auto iter = itsPrefetched.find (blknr);
+        return (iter == itsPrefetched.end()  ||  iter->second.seqnr != seqnr  ||
+                iter->second.buffer);
+      });
+    piter = itsPrefetched.find (blknr);
+    if (piter == itsPrefetched.end()  ||  !piter->second.buffer) {
+      return False;
+    }
+    memcpy (buffer, piter->second.buffer->data(), itsBlockSize);
+    itsFreeBuffers.push_back (piter->second.buffer);
+    itsPrefetched.erase (piter);
+    return True;
+  }
+
+  void MultiFileAsyncIO::prefetch (Int64 blknr)
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    if (itsPrefetched.find(blknr) != itsPrefetched.end()  ||
+        itsWrites.find(blknr) != itsWrites.end()  ||
+        itsInFlight.find(blknr) != itsInFlight.end()) {
+      return;
+    }
+    // Remove the oldest prefetched blocks if the maximum is reached.
+    // Blocks still being read are kept.
+    while (itsPrefetched.size() >= itsMaxBlocks  &&
+           !itsPrefetchOrder.empty()) {
+      auto iter = itsPrefetched.find (itsPrefetchOrder.front());
+      if (iter != itsPrefetched.end()) {
+        if (! iter->second.buffer) {
+          break;
+        }
+        itsFreeBuffers.push_back (iter->second.buffer);
+        itsPrefetched.erase (iter);
+      }
+      itsPrefetchOrder.pop_front();
+    }
+    if (itsPrefetched.size() >= itsMaxBlocks) {
+      return;
+    }
+    itsSeqNr++;
+    itsPrefetched[blknr] = Prefetched{std::shared_ptr<MultiFileBuffer>(),
+                                      itsSeqNr};
+    itsPrefetchOrder.push_back (blknr);
+    itsQueues[blknr % itsFiles.size()].push_back (Request{blknr, itsSeqNr});
+    itsNrOutstanding++;
+    itsWorkCond.notify_all();
+  }
+
+  void MultiFileAsyncIO::wait()
+  {
+    std::unique_lock<std::mutex> lock(itsMutex);
+    itsDoneCond.wait (lock, [this] { return itsNrOutstanding == 0; });
+    checkError();
+  }
+
+  void MultiFileAsyncIO::clearPrefetch()
+  {
+    wait();
+    std::lock_guard<std::mutex> lock(itsMutex);
+    for (auto& pf : itsPrefetched) {
+      if (pf.second.buffer) {
+        itsFreeBuffers.push_back (pf.second.buffer);
+      }
+    }
+    itsPrefetched.clear();
+    itsPrefetchOrder.clear();
+  }
+
+  void MultiFileAsyncIO::run (uInt fileNr)
+  {
+    ByteIO* file = itsFiles[fileNr];
+    const Int64 nfile = itsFiles.size();
+    std::deque<Request>& queue = itsQueues[fileNr];
+    std::unique_lock<std::mutex> lock(itsMutex);
+    while (True) {
+      itsWorkCond.wait (lock, [this, &queue] {
+          return itsStop  ||  !queue.empty(); });
+      if (queue.empty()) {
+        break;
+      }
+      Request req = queue.front();
+      queue.pop_front();
+      Int64 offset = (req.blknr / nfile) * itsBlockSize;
+      if (req.seqnr == 0) {
+        // Write the block; keep it readable while being written.
+        auto iter = itsWrites.find (req.blknr);
+        std::shared_ptr<MultiFileBuffer> buf = iter->second;
+        itsWrites.erase (iter);
+        itsInFlight[req.blknr] = buf;
+        lock.unlock();
+        String error;
+        try {
+          file->pwrite (itsBlockSize, offset, buf->data());
+        } catch (const std::exception& x) {
+          error = x.what();
+        }
+        lock.lock();
+        if (! error.empty()  &&  itsError.empty()) {
+          itsError = error;
+        }
+        itsInFlight.erase (req.blknr);
+        itsFreeBuffers.push_back (buf);
+      } else {
+        // Prefetch the block if still needed.
+        auto iter = itsPrefetched.find (req.blknr);
+        if (iter != itsPrefetched.end()  &&  iter->second.seqnr == req.seqnr) {
+          std::shared_ptr<MultiFileBuffer> buf = getBuffer();
+          lock.unlock();
+          Bool ok = True;
+          try {
+            file->pread (itsBlockSize, offset, buf->data());
+          } catch (const std::exception&) {
+            ok = False;
+          }
+          lock.lock();
+          // The block might have been overwritten in the meantime.
+          iter = itsPrefetched.find (req.blknr);
+          if (ok  &&  iter != itsPrefetched.end()  &&
+              iter->second.seqnr == req.seqnr) {
+            iter->second.buffer = buf;
+          } else {
+            if (iter != itsPrefetched.end()  &&
+                iter->second.seqnr == req.seqnr) {
+              itsPrefetched.erase (iter);
+            }
+            itsFreeBuffers.push_back (buf);
+          }
+        }
+      }
+      itsNrOutstanding--;
+      itsDoneCond.notify_all();
+    }
+  }
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,155 @@
+//# MultiFileAsyncIO.h: Asynchronous block I/O for a (striped) MultiFile
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_MULTIFILEASYNCIO_H
+#define CASA_MULTIFILEASYNCIO_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/IO/MultiFileBase.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  //# Forward declarations.
+  class ByteIO;
+
+
+  // <summary>
+  // Asynchronous block I/O for a (striped) MultiFile
+  // </summary>
+
+  // <use visibility=local>
+
+  // <reviewed reviewer="" date="" tests="tMultiFile" demos="">
+  // </reviewed>
+
+  // <synopsis>
+  // This class is used by MultiFile to write its data blocks in the
+  // background and to read blocks ahead. The blocks of a MultiFile can be
+  // striped over several physical files; block <src>i</src> is stored in
+  // file <src>i%nfile</src> as its block <src>i/nfile</src>.
+  // Each file has its own I/O thread, so blocks in different files are
+  // written or read in parallel.
+  // <p>
+  // A block to be written is copied and queued, so the caller can continue
+  // immediately. Reading a block still queued (or being written) gives the
+  // queued data. Prefetched blocks are kept until read (or overwritten).
+  // The total number of blocks held for writing or prefetching is limited.
+  // An error in a background write is rethrown by the next call to
+  // <src>write</src> or <src>wait</src>. Errors in a prefetch are ignored;
+  // the block will then be read synchronously, which reports the error.
+  // <p>
+  // The ByteIO objects must support <src>pread</src> and <src>pwrite</src>
+  // from several threads (as FiledesIO does). This class must only be used
+  // by a single (main) thread.
+  // </synopsis>
+
+  class MultiFileAsyncIO
+  {
+  public:
+    // Create the object for the given files and start the I/O threads.
+    // The files are not owned by this object.
+    // At most <src>maxBlocks</src> blocks are held for writing and
+    // for prefetching.
+    MultiFileAsyncIO (const std::vector<ByteIO*>& files, Int64 blockSize,
+                      Bool useODirect, uInt maxBlocks);
+
+    // The destructor finishes all writes and stops the threads.
+    ~MultiFileAsyncIO();
+
+    // Copy constructor and assignment not possible.
+    MultiFileAsyncIO (const MultiFileAsyncIO&) = delete;
+    MultiFileAsyncIO& operator= (const MultiFileAsyncIO&) = delete;
+
+    // Queue a block to be written. It waits if too many blocks are queued.
+    void write (Int64 blknr, const void* buffer);
+
+    // Get a block if it is queued for writing or has been prefetched.
+    // It waits if the block is still being prefetched.
+    // It returns False if the block is not available (so has to be read).
+    Bool read (Int64 blknr, void* buffer);
+
+    // Start to read the block in the background (if not available yet).
+    void prefetch (Int64 blknr);
+
+    // Wait until all queued writes and prefetches are done.
+    // It throws an exception if a write failed.
+    void wait();
+
+    // Wait until all I/O is done and remove the prefetched blocks.
+    void clearPrefetch();
+
+  private:
+    // A request for an I/O thread.
+    struct Request {
+      Int64  blknr;
+      uInt64 seqnr;     // 0 for a write, otherwise prefetch sequence nr
+    };
+    // A prefetched block (null buffer while being read).
+    struct Prefetched {
+      std::shared_ptr<MultiFileBuffer> buffer;
+      uInt64 seqnr;
+    };
+
+    // Execute the requests for the given file.
+    void run (uInt fileNr);
+    // Get a buffer from the free list or allocate it.
+    std::shared_ptr<MultiFileBuffer> getBuffer();
+    // Throw an exception if a write failed.
+    void checkError();
+
+    //# Data members
+    std::vector<ByteIO*>     itsFiles;
+    Int64                    itsBlockSize;
+    Bool                     itsUseODirect;
+    uInt                     itsMaxBlocks;
+    std::mutex               itsMutex;
+    std::condition_variable  itsWorkCond;   // signals new requests
+    std::condition_variable  itsDoneCond;   // signals finished requests
+    std::vector<std::deque<Request>> itsQueues;
+    std::map<Int64, std::shared_ptr<MultiFileBuffer>> itsWrites;
+    std::map<Int64, std::shared_ptr<MultiFileBuffer>> itsInFlight;
+    std::map<Int64, Prefetched>  itsPrefetched;
+    std::deque<Int64>            itsPrefetchOrder;
+    std::vector<std::shared_ptr<MultiFileBuffer>> itsFreeBuffers;
+    uInt64                   itsSeqNr;
+    uInt64                   itsNrOutstanding;
+    String                   itsError;
+    Bool                     itsStop;
+    std::vector<std::thread> itsThreads;
+  };
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -27,6 +27,7 @@
 #include <casacore/casa/IO/MultiFileBase.h>
 #include <casacore/casa/IO/MultiFile.h>
 #include <casacore/casa/IO/MultiHDF5.h>
+#include <casacore/casa/IO/ObjectStoreIO.h>
 #include <casacore/casa/OS/Path.h>
 #include <casacore/casa/BasicSL/STLIO.h>
 #include <casacore/casa/Utilities/Assert.h>
@@ -82,12 +83,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 #ifndef HAVE_O_DIRECT
     itsUseODirect = False;
 #endif
-    itsName = Path(name).expandedName();
+    // An object store URL cannot be expanded as a path.
+    if (ObjectStoreClient::isURL (name)) {
+      itsName = name;
+    } else {
+      itsName = Path(name).expandedName();
+    }
   }
 
   std::shared_ptr<MultiFileBase> MultiFileBase::openMF (const String& fileName)
   {
-    if (HDF5File::isHDF5 (fileName)) {
+    if (!ObjectStoreClient::isURL (fileName)  &&  HDF5File::isHDF5 (fileName)) {
       return std::make_shared<MultiHDF5>(fileName, ByteIO::Old);
     }
     return std::make_shared<MultiFile>(fileName, ByteIO::Old);
@@ -408,6 +414,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   MultiFileInfo::MultiFileInfo()
     : curBlock (-1),
+      lastRead (-1),
       fsize    (0),
       nested   (False),
       dirty    (False)
@@ -83,6 +83,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     //# Data members.
     std::vector<Int64> blockNrs;     // physical blocknrs for this logical file
     Int64         curBlock;     // the data block held in buffer (<0 is none)
+    Int64         lastRead;     // the data block last read (<0 is none)
     Int64         fsize;        // file size (in bytes)
     String        name;         // the virtual file name
     Bool          nested;       // is the file a nested MultiFile?
@@ -0,0 +1,555 @@
+//# ObjectStoreIO.cc: Read-only ByteIO for an object in an object store
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/casa/IO/ObjectStoreIO.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <atomic>
+#include <thread>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_CURL
+#include <curl/curl.h>
+#endif
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+#ifdef HAVE_CURL
+  // HTTP(S) client for an object store using libcurl.
+  // Each request uses its own curl handle, so requests can be done in
+  // parallel.
+  class CurlObjectStoreClient : public ObjectStoreClient
+  {
+  public:
+    CurlObjectStoreClient();
+    ~CurlObjectStoreClient() override;
+    Int64 objectSize (const String& url) override;
+    void getRange (const String& url, Int64 offset, Int64 size,
+                   void* buf) override;
+  private:
+    // Convert an s3 URL to an http(s) URL.
+    std::string httpURL (const String& url) const;
+    // Perform the request and check the response code.
+    void perform (CURL* curl, const String& url, Bool ranged) const;
+    std::string itsEndpoint;
+    std::string itsRegion;
+    std::string itsUserPwd;
+    std::string itsSessionToken;
+  };
+
+  // The buffer to receive the data of a ranged read.
+  struct CurlRangeBuffer {
+    char* buf;
+    Int64 size;
+    Int64 nrdone;
+  };
+
+  extern "C" {
+    static size_t casacoreCurlWriteRange (char* ptr, size_t size,
+                                          size_t nmemb, void* userdata)
+    {
+      CurlRangeBuffer* rb = static_cast<CurlRangeBuffer*>(userdata);
+      size_t n = size*nmemb;
+      // Returning less than n aborts the transfer if too much data arrive
+      // (e.g. if the server does not support ranged reads).
+      if (rb->nrdone + Int64(n) > rb->size) {
+        return 0;
+      }
+      memcpy (rb->buf + rb->nrdone, ptr, n);
+      rb->nrdone += n;
+      return n;
+    }
+  }
+
+  CurlObjectStoreClient::CurlObjectStoreClient()
+    : itsRegion ("us-east-1")
+  {
+    curl_global_init (CURL_GLOBAL_DEFAULT);
+    const char* env = getenv ("AWS_ENDPOINT_URL");
+    if (env) {
+      itsEndpoint = env;
+      // Remove a trailing slash.
+      if (!itsEndpoint.empty()  &&  itsEndpoint.back() == '/') {
+        itsEndpoint.pop_back();
+      }
+    }
+    env = getenv ("AWS_REGION");
+    if (env  &&  env[0] != 0) {
+      itsRegion = env;
+    }
+    const char* key    = getenv ("AWS_ACCESS_KEY_ID");
+    const char* secret = getenv ("AWS_SECRET_ACCESS_KEY");
+    if (key  &&  secret) {
+      itsUserPwd = std::string(key) + ':' + secret;
+    }
+    env = getenv ("AWS_SESSION_TOKEN");
+    if (env) {
+      itsSessionToken = env;
+    }
+  }
+
+  CurlObjectStoreClient::~CurlObjectStoreClient()
+  {
+    curl_global_cleanup();
+  }
+
+  std::string CurlObjectStoreClient::httpURL (const String& url) const
+  {
+    if (url.substr(0,5) != "s3://") {
+      return url;
+    }
+    std::string path = url.substr(5);
+    std::string::size_type pos = path.find('/');
+    std::string bucket = path.substr (0, pos);
+    std::string key = (pos == std::string::npos ? "" : path.substr(pos+1));
+    if (! itsEndpoint.empty()) {
+      return itsEndpoint + '/' + bucket + '/' + key;
+    }
+    return "https://" + bucket + ".s3." + itsRegion + ".amazonaws.com/" + key;
+  }
+
+  void CurlObjectStoreClient::perform (CURL* curl, const String& url,
+                                       Bool ranged) const
+  {
+    std::string httpUrl = httpURL (url);
+    curl_easy_setopt (curl, CURLOPT_URL, httpUrl.c_str());
+    curl_easy_setopt (curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt (curl, CURLOPT_NOSIGNAL, 1L);
+    struct curl_slist* headers = 0;
+    if (url.substr(0,5) == "s3://"  &&  !itsUserPwd.empty()) {
+#if LIBCURL_VERSION_NUM >= 0x074b00
+      std::string sigv4 = "aws:amz:" + itsRegion + ":s3";
+      curl_easy_setopt (curl, CURLOPT_USERPWD, itsUserPwd.c_str());
+      curl_easy_setopt (curl, CURLOPT_AWS_SIGV4, sigv4.c_str());
+      if (! itsSessionToken.empty()) {
+        headers = curl_slist_append
+          (headers, ("x-amz-security-token: " + itsSessionToken).c_str());
+        curl_easy_setopt (curl, CURLOPT_HTTPHEADER, headers);
+      }
+#else
+      throw AipsError ("ObjectStoreIO: signed S3 requests need libcurl "
+                       ">= 7.75; cannot access " + url);
+#endif
+    }
+    CURLcode status = curl_easy_perform (curl);
+    long code = 0;
+    curl_easy_getinfo (curl, CURLINFO_RESPONSE_CODE, &code);
+    curl_slist_free_all (headers);
+    if (status != CURLE_OK) {
+      throw AipsError ("ObjectStoreIO: request for " + url + " failed: " +
+                       curl_easy_strerror(status));
+    }
+    if (code != 200  &&  !(ranged  &&  code == 206)) {
+      throw AipsError ("ObjectStoreIO: request for " + url +
+                       " failed with HTTP status " + String::toString(code));
+    }
+  }
+
+  Int64 CurlObjectStoreClient::objectSize (const String& url)
+  {
+    CURL* curl = curl_easy_init();
+    if (! curl) {
+      throw AipsError ("ObjectStoreIO: could not initialize libcurl");
+    }
+    curl_off_t size = -1;
+    try {
+      curl_easy_setopt (curl, CURLOPT_NOBODY, 1L);
+      perform (curl, url, False);
+      curl_easy_getinfo (curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &size);
+    } catch (...) {
+      curl_easy_cleanup (curl);
+      throw;
+    }
+    curl_easy_cleanup (curl);
+    if (size < 0) {
+      throw AipsError ("ObjectStoreIO: size of " + url + " is unknown");
+    }
+    return size;
+  }
+
+  void CurlObjectStoreClient::getRange (const String& url, Int64 offset,
+                                        Int64 size, void* buf)
+  {
+    CURL* curl = curl_easy_init();
+    if (! curl) {
+      throw AipsError ("ObjectStoreIO: could not initialize libcurl");
+    }
+    CurlRangeBuffer rb {static_cast<char*>(buf), size, 0};
+    std::string range = std::to_string(offset) + '-' +
+                        std::to_string(offset + size - 1);
+    try {
+      curl_easy_setopt (curl, CURLOPT_RANGE, range.c_str());
+      curl_easy_setopt (curl, CURLOPT_WRITEFUNCTION, casacoreCurlWriteRange);
+      curl_easy_setopt (curl, CURLOPT_WRITEDATA, &rb);
+      perform (curl, url, True);
+    } catch (...) {
+      curl_easy_cleanup (curl);
+      throw;
+    }
+    curl_easy_cleanup (curl);
+    if (rb.nrdone != size) {
+      throw AipsError ("ObjectStoreIO: read " + String::toString(rb.nrdone) +
+                       " bytes instead of " + String::toString(size) +
+                       " from " + url);
+    }
+  }
+#endif
+
+
+  std::mutex ObjectStoreClient::theirMutex;
+  std::map<String, std::shared_ptr<ObjectStoreClient>>
+    ObjectStoreClient::theirClients;
+
+  ObjectStoreClient::~ObjectStoreClient()
+  {}
+
+  String ObjectStoreClient::scheme (const String& name)
+  {
+    String::size_type pos = name.find ("://");
+    if (pos == String::npos  ||  pos == 0) {
+      return String();
+    }
+    String sch;
+    for (String::size_type i=0; i<pos; ++i) {
+      char c = name[i];
+      if (!isalnum(c)  &&  c != '+'  &&  c != '-'  &&  c != '.') {
+        return String();
+      }
+      sch += char(tolower(c));
+    }
+    return sch;
+  }
+
+  void ObjectStoreClient::registerClient
+  (const String& scheme, const std::shared_ptr<ObjectStoreClient>& client)
+  {
+    std::lock_guard<std::mutex> lock(theirMutex);
+    if (client) {
+      theirClients[scheme] = client;
+    } else {
+      theirClients.erase (scheme);
+    }
+  }
+
+  std::shared_ptr<ObjectStoreClient> ObjectStoreClient::defaultClient
+  (const String& scheme)
+  {
+#ifdef HAVE_CURL
+    if (scheme == "s3"  ||  scheme == "http"  ||  scheme == "https") {
+      static std::shared_ptr<ObjectStoreClient> client
+        (std::make_shared<CurlObjectStoreClient>());
+      return client;
+    }
+#else
+    (void)scheme;
+#endif
+    return std::shared_ptr<ObjectStoreClient>();
+  }
+
+  std::shared_ptr<ObjectStoreClient> ObjectStoreClient::get (const String& url)
+  {
+    String sch = scheme (url);
+    {
+      std::lock_guard<std::mutex> lock(theirMutex);
+      auto iter = theirClients.find (sch);
+      if (iter != theirClients.end()) {
+        return iter->second;
+      }
+    }
+    std::shared_ptr<ObjectStoreClient> client = defaultClient (sch);
+    if (! client) {
+      throw AipsError ("ObjectStoreIO: no client available for " + url +
+#ifndef HAVE_CURL
+                       " (casacore is built without libcurl)" +
+#endif
+                       String());
+    }
+    return client;
+  }
+
+  Bool ObjectStoreClient::isURL (const String& name)
+  {
+    String sch = scheme (name);
+    if (sch.empty()) {
+      return False;
+    }
+    // The default schemes are always recognized, so a proper error message
+    // is given if casacore is built without libcurl.
+    if (sch == "s3"  ||  sch == "http"  ||  sch == "https") {
+      return True;
+    }
+    std::lock_guard<std::mutex> lock(theirMutex);
+    return theirClients.find(sch) != theirClients.end();
+  }
+
+
+  ObjectStoreIO::ObjectStoreIO (const String& url, Int64 blockSize,
+                                uInt cacheBlocks, uInt nthreads)
+    : ObjectStoreIO (ObjectStoreClient::get(url), url, blockSize,
+                     cacheBlocks, nthreads)
+  {}
+
+  ObjectStoreIO::ObjectStoreIO (const std::shared_ptr<ObjectStoreClient>& client,
+                                const String& url, Int64 blockSize,
+                                uInt cacheBlocks, uInt nthreads)
+    : itsClient         (client),
+      itsURL            (url),
+      itsSize           (0),
+      itsBlockSize      (blockSize),
+      itsMaxBlocks      (std::max(cacheBlocks, 1u)),
+      itsNrThreads      (std::max(nthreads, 1u)),
+      itsPosition       (0),
+      itsUseCounter     (0),
+      itsLastBlock      (-2),
+      itsNrRequests     (0),
+      itsNrBytesFetched (0)
+  {
+    ThrowIf (blockSize <= 0, "ObjectStoreIO: block size must be positive");
+    itsSize = itsClient->objectSize (itsURL);
+  }
+
+  ObjectStoreIO::~ObjectStoreIO()
+  {}
+
+  void ObjectStoreIO::write (Int64, const void*)
+  {
+    throw AipsError ("ObjectStoreIO::write - object " + itsURL +
+                     " is not writable");
+  }
+
+  void ObjectStoreIO::pwrite (Int64, Int64, const void*)
+  {
+    throw AipsError ("ObjectStoreIO::pwrite - object " + itsURL +
+                     " is not writable");
+  }
+
+  void ObjectStoreIO::reopenRW()
+  {
+    throw AipsError ("ObjectStoreIO::reopenRW - object " + itsURL +
+                     " cannot be opened for write");
+  }
+
+  Int64 ObjectStoreIO::read (Int64 size, void* buf, Bool throwException)
+  {
+    Int64 nread = pread (size, itsPosition, buf, throwException);
+    if (nread > 0) {
+      itsPosition += nread;
+    }
+    return nread;
+  }
+
+  Int64 ObjectStoreIO::pread (Int64 size, Int64 offset, void* buf,
+                              Bool throwException)
+  {
+    Int64 avail = std::max (Int64(0), std::min (size, itsSize - offset));
+    if (avail < size  &&  throwException) {
+      throw AipsError ("ObjectStoreIO::pread - incorrect number of bytes ("
+                       + String::toString(avail) + " out of "
+                       + String::toString(size) + ") read for object "
+                       + itsURL);
+    }
+    if (avail == 0) {
+      return 0;
+    }
+    Int64 first = offset / itsBlockSize;
+    Int64 last  = (offset + avail - 1) / itsBlockSize;
+    Int64 lastAhead = last;
+    {
+      // Read ahead if the object is read sequentially.
+      std::lock_guard<std::mutex> lock(itsMutex);
+      if (first == itsLastBlock  ||  first == itsLastBlock + 1) {
+        Int64 nblock = (itsSize + itsBlockSize - 1) / itsBlockSize;
+        lastAhead = std::min (last + itsNrThreads, nblock - 1);
+      }
+      itsLastBlock = last;
+    }
+    std::vector<BlockPtr> blocks = getBlocks (first, last, lastAhead);
+    char* out = static_cast<char*>(buf);
+    Int64 pos = offset;
+    Int64 end = offset + avail;
+    for (size_t i=0; i<blocks.size(); ++i) {
+      Int64 st = pos - (first + Int64(i)) * itsBlockSize;
+      Int64 n  = std::min (Int64(blocks[i]->size()) - st, end - pos);
+      memcpy (out, blocks[i]->data() + st, n);
+      out += n;
+      pos += n;
+    }
+    return avail;
+  }
+
+  std::vector<ObjectStoreIO::BlockPtr> ObjectStoreIO::getBlocks
+  (Int64 first, Int64 last, Int64 lastAhead)
+  {
+    std::vector<BlockPtr> result(last - first + 1);
+    std::vector<Int64> missing;
+    {
+      std::lock_guard<std::mutex> lock(itsMutex);
+      for (Int64 blk=first; blk<=last; ++blk) {
+        auto iter = itsCache.find (blk);
+        if (iter == itsCache.end()) {
+          missing.push_back (blk);
+        } else {
+          iter->second.lastUse = ++itsUseCounter;
+          result[blk-first] = iter->second.data;
+        }
+      }
+      // Only read ahead if a request has to be done anyway.
+      if (! missing.empty()) {
+        for (Int64 blk=last+1; blk<=lastAhead; ++blk) {
+          if (itsCache.find(blk) == itsCache.end()) {
+            missing.push_back (blk);
+          }
+        }
+      }
+    }
+    if (! missing.empty()) {
+      std::vector<String> errors;
+      std::vector<BlockPtr> fetched = fetch (missing, errors);
+      std::lock_guard<std::mutex> lock(itsMutex);
+      for (size_t i=0; i<missing.size(); ++i) {
+        if (fetched[i]) {
+          itsCache[missing[i]] = CacheBlock{fetched[i], ++itsUseCounter};
+          itsNrRequests++;
+          itsNrBytesFetched += fetched[i]->size();
+          if (missing[i] <= last) {
+            result[missing[i] - first] = fetched[i];
+          }
+        } else if (missing[i] <= last) {
+          // A failing read-ahead is ignored.
+          throw AipsError (errors[i]);
+        }
+      }
+      limitCache();
+    }
+    return result;
+  }
+
+  std::vector<ObjectStoreIO::BlockPtr> ObjectStoreIO::fetch
+  (const std::vector<Int64>& blocks, std::vector<String>& errors)
+  {
+    std::vector<BlockPtr> result(blocks.size());
+    errors.resize (blocks.size());
+    std::atomic<size_t> next(0);
+    auto work = [&]() {
+      size_t i;
+      while ((i = next++) < blocks.size()) {
+        try {
+          Int64 start = blocks[i] * itsBlockSize;
+          Int64 n = std::min (itsBlockSize, itsSize - start);
+          BlockPtr buf = std::make_shared<std::vector<char>>(n);
+          itsClient->getRange (itsURL, start, n, buf->data());
+          result[i] = buf;
+        } catch (const std::exception& x) {
+          errors[i] = x.what();
+        }
+      }
+    };
+    // The current thread also does part of the work.
+    uInt nthread = std::min (size_t(itsNrThreads), blocks.size());
+    std::vector<std::thread> threads;
+    for (uInt i=1; i<nthread; ++i) {
+      threads.push_back (std::thread(work));
+    }
+    work();
+    for (std::thread& thr : threads) {
+      thr.join();
+    }
+    return result;
+  }
+
+  void ObjectStoreIO::limitCache()
+  {
+    while (itsCache.size() > itsMaxBlocks) {
+      auto oldest = itsCache.begin();
+      for (auto iter=itsCache.begin(); iter!=itsCache.end(); ++iter) {
+        if (iter->second.lastUse < oldest->second.lastUse) {
+          oldest = iter;
+        }
+      }
+      itsCache.erase (oldest);
+    }
+  }
+
+  void ObjectStoreIO::resync()
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsCache.clear();
+    itsLastBlock = -2;
+    itsSize = itsClient->objectSize (itsURL);
+  }
+
+  String ObjectStoreIO::fileName() const
+  {
+    return itsURL;
+  }
+
+  Int64 ObjectStoreIO::length()
+  {
+    return itsSize;
+  }
+
+  Bool ObjectStoreIO::isReadable() const
+  {
+    return True;
+  }
+
+  Bool ObjectStoreIO::isWritable() const
+  {
+    return False;
+  }
+
+  Bool ObjectStoreIO::isSeekable() const
+  {
+    return True;
+  }
+
+  Int64 ObjectStoreIO::doSeek (Int64 offset, ByteIO::SeekOption dir)
+  {
+    Int64 newPos;
+    switch (dir) {
+    case ByteIO::Begin:
+      newPos = offset;
+      break;
+    case ByteIO::End:
+      newPos = itsSize + offset;
+      break;
+    default:
+      newPos = itsPosition + offset;
+      break;
+    }
+    if (newPos < 0) {
+      throw AipsError ("ObjectStoreIO::seek - cannot seek before start of "
+                       "object " + itsURL);
+    }
+    itsPosition = newPos;
+    return itsPosition;
+  }
+
+
+} //# NAMESPACE CASACORE - END
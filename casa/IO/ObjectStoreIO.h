@@ -0,0 +1,256 @@
+//# ObjectStoreIO.h: Read-only ByteIO for an object in an object store
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef CASA_OBJECTSTOREIO_H
+#define CASA_OBJECTSTOREIO_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/IO/ByteIO.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+  // <summary>
+  // Abstract base class for a client accessing an object store
+  // </summary>
+
+  // <use visibility=export>
+
+  // <reviewed reviewer="" date="" tests="tObjectStoreIO" demos="">
+  // </reviewed>
+
+  // <synopsis>
+  // An ObjectStoreClient gives access to objects given by a URL like
+  // <src>s3://bucket/key</src> or <src>https://host/path</src>.
+  // Only the size of an object and ranged reads are needed by
+  // <linkto class=ObjectStoreIO>ObjectStoreIO</linkto>. The functions must
+  // be thread-safe, because ranges are fetched in parallel.
+  // <p>
+  // A client is registered per URL scheme. If casacore is built with
+  // libcurl, a default HTTP client is used for the schemes
+  // <src>http</src>, <src>https</src> and <src>s3</src>.
+  // An <src>s3</src> URL is mapped to the endpoint given by environment
+  // variable <src>AWS_ENDPOINT_URL</src> (path-style) or otherwise to
+  // <src>https://bucket.s3.REGION.amazonaws.com/key</src>, where REGION is
+  // given by <src>AWS_REGION</src> (default us-east-1). If
+  // <src>AWS_ACCESS_KEY_ID</src> and <src>AWS_SECRET_ACCESS_KEY</src> are
+  // defined, the requests are signed (AWS signature version 4).
+  // Other clients (e.g. using a vendor SDK) can be registered for
+  // any scheme.
+  // </synopsis>
+
+  class ObjectStoreClient
+  {
+  public:
+    virtual ~ObjectStoreClient();
+
+    // Get the size of the object given by the URL.
+    // An exception is thrown if the object does not exist.
+    virtual Int64 objectSize (const String& url) = 0;
+
+    // Read <src>size</src> bytes starting at <src>offset</src> from the
+    // object. An exception is thrown if not all bytes could be read.
+    virtual void getRange (const String& url, Int64 offset, Int64 size,
+                           void* buf) = 0;
+
+    // Register the client to be used for the given URL scheme (e.g. "s3").
+    // A null pointer removes the registration.
+    static void registerClient (const String& scheme,
+                                const std::shared_ptr<ObjectStoreClient>&);
+
+    // Get the client for the given URL.
+    // An exception is thrown if no client is available for its scheme.
+    static std::shared_ptr<ObjectStoreClient> get (const String& url);
+
+    // Is the name a URL of an object store (i.e., has it a scheme for which
+    // a client is registered or a default client exists)?
+    static Bool isURL (const String& name);
+
+  private:
+    // Get the scheme of a URL (empty if not a URL).
+    static String scheme (const String& name);
+    // Get the default client for a scheme (null if none).
+    static std::shared_ptr<ObjectStoreClient> defaultClient (const String& scheme);
+
+    static std::mutex theirMutex;
+    static std::map<String, std::shared_ptr<ObjectStoreClient>> theirClients;
+  };
+
+
+  // <summary>
+  // Read-only ByteIO for an object in an object store
+  // </summary>
+
+  // <use visibility=export>
+
+  // <reviewed reviewer="" date="" tests="tObjectStoreIO" demos="">
+  // </reviewed>
+
+  // <prerequisite>
+  //    <li> <linkto class=ByteIO>ByteIO</linkto> class
+  //    <li> <linkto class=ObjectStoreClient>ObjectStoreClient</linkto> class
+  // </prerequisite>
+
+  // <synopsis>
+  // This class reads an object in an object store (such as S3) using ranged
+  // reads, so tables and images can be used without staging them to local
+  // disk first. It is read-only.
+  // <p>
+  // The object is read in blocks which are kept in a local cache with
+  // least-recently-used replacement. The blocks needed by a read and not
+  // in the cache yet are fetched in parallel. If the object is read
+  // sequentially, the next blocks are fetched ahead in the same go.
+  // The block size should be fairly large (order MBytes), because the
+  // latency of an object store is much higher than that of a disk.
+  // <p>
+  // MultiFile uses this class if its file name is an object store URL.
+  // Thereby a table created with <src>StorageOption::MultiFile</src>,
+  // which keeps all its storage manager files in a single object, can be
+  // read directly from an object store. Note that this also applies to
+  // the stripe files of a striped MultiFile. The BucketFile objects of the
+  // storage managers read their data via such a MultiFile.
+  // <p>
+  // <src>pread</src> can be used by multiple threads simultaneously.
+  // </synopsis>
+
+  // <example>
+  // <srcblock>
+  //   ObjectStoreIO io("s3://mybucket/obs1.ms/table.mf");
+  //   std::vector<char> buf(1000);
+  //   io.pread (buf.size(), 0, buf.data());
+  // </srcblock>
+  // </example>
+
+  class ObjectStoreIO: public ByteIO
+  {
+  public:
+    // Open the object given by the URL using the registered client.
+    // The object is read in blocks of the given size using at most
+    // <src>nthreads</src> parallel reads. At most <src>cacheBlocks</src>
+    // blocks are held in the cache.
+    explicit ObjectStoreIO (const String& url, Int64 blockSize=4*1024*1024,
+                            uInt cacheBlocks=64, uInt nthreads=8);
+
+    // Open the object using the given client.
+    ObjectStoreIO (const std::shared_ptr<ObjectStoreClient>& client,
+                   const String& url, Int64 blockSize=4*1024*1024,
+                   uInt cacheBlocks=64, uInt nthreads=8);
+
+    ~ObjectStoreIO() override;
+
+    // Copy constructor and assignment cannot be used.
+    ObjectStoreIO (const ObjectStoreIO&) = delete;
+    ObjectStoreIO& operator= (const ObjectStoreIO&) = delete;
+
+    // Writing is not possible; an exception is thrown.
+    // <group>
+    void write (Int64 size, const void* buf) override;
+    void pwrite (Int64 size, Int64 offset, const void* buf) override;
+    // </group>
+
+    // Read <src>size</src> bytes at the current position.
+    Int64 read (Int64 size, void* buf, Bool throwException=True) override;
+
+    // Read <src>size</src> bytes at the given offset.
+    Int64 pread (Int64 size, Int64 offset, void* buf,
+                 Bool throwException=True) override;
+
+    // Reopening for read/write is not possible; an exception is thrown.
+    void reopenRW() override;
+
+    // Remove all blocks from the cache, so the object is read again.
+    // It also gets the object size again.
+    void resync() override;
+
+    // Get the URL of the object.
+    String fileName() const override;
+
+    // Get the size of the object.
+    Int64 length() override;
+
+    // The object is readable, seekable and not writable.
+    // <group>
+    Bool isReadable() const override;
+    Bool isWritable() const override;
+    Bool isSeekable() const override;
+    // </group>
+
+    // Get the number of ranged reads done and the number of bytes read
+    // from the object store.
+    // <group>
+    uInt64 nrRequests() const
+      { return itsNrRequests; }
+    uInt64 nrBytesFetched() const
+      { return itsNrBytesFetched; }
+    // </group>
+
+  protected:
+    Int64 doSeek (Int64 offset, ByteIO::SeekOption) override;
+
+  private:
+    typedef std::shared_ptr<std::vector<char>> BlockPtr;
+    struct CacheBlock {
+      BlockPtr data;
+      uInt64   lastUse;
+    };
+
+    // Get the blocks from the cache, fetching missing ones in parallel.
+    // The blocks to read ahead are fetched too, but not returned.
+    std::vector<BlockPtr> getBlocks (Int64 first, Int64 last, Int64 lastAhead);
+    // Fetch the given blocks in parallel.
+    // A null pointer is returned for a failed block; its error message
+    // is put in <src>errors</src>.
+    std::vector<BlockPtr> fetch (const std::vector<Int64>& blocks,
+                                 std::vector<String>& errors);
+    // Remove the least recently used blocks if the cache is full.
+    void limitCache();
+
+    //# Data members
+    std::shared_ptr<ObjectStoreClient> itsClient;
+    String   itsURL;
+    Int64    itsSize;
+    Int64    itsBlockSize;
+    uInt     itsMaxBlocks;
+    uInt     itsNrThreads;
+    Int64    itsPosition;
+    std::mutex itsMutex;
+    std::map<Int64, CacheBlock> itsCache;
+    uInt64   itsUseCounter;
+    Int64    itsLastBlock;       // last block read (for read-ahead)
+    uInt64   itsNrRequests;
+    uInt64   itsNrBytesFetched;
+  };
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
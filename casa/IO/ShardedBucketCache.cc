@@ -0,0 +1,189 @@
+//# ShardedBucketCache.cc: Thread-safe cache for buckets in a read-only file
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/IO/ShardedBucketCache.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/iostream.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+ShardedBucketCache::ShardedBucketCache (BucketFile* file, Int64 startOffset,
+                                        uInt bucketSize, uInt nrOfBuckets,
+                                        uInt cacheSize, uInt nshard,
+                                        void* ownerObject,
+                                        BucketCacheToLocal readCallBack,
+                                        BucketCacheDeleteBuffer deleteCallBack)
+: itsFile           (file),
+  itsOwner          (ownerObject),
+  itsReadCallBack   (readCallBack),
+  itsDeleteCallBack (deleteCallBack),
+  itsStartOffset    (startOffset),
+  itsBucketSize     (bucketSize),
+  itsNrOfBuckets    (nrOfBuckets)
+{
+    if (bucketSize == 0) {
+        throw AipsError ("ShardedBucketCache: bucketsize=0");
+    }
+    if (file->isWritable()  ||  file->isMultiFile()) {
+        throw AipsError ("ShardedBucketCache: file " + file->name() +
+                         " must be read-only and not in a MultiFile");
+    }
+    if (nshard == 0) {
+        nshard = std::min (std::max (HostInfo::numCPUs(), 1), 64);
+    }
+    // Each shard must hold at least one bucket.
+    uInt perShard = std::max ((cacheSize + nshard - 1) / nshard, 1u);
+    itsShards.reserve (nshard);
+    for (uInt i=0; i<nshard; ++i) {
+        itsShards.push_back (std::unique_ptr<Shard>(new Shard()));
+        itsShards[i]->maxBuckets = perShard;
+    }
+    initStatistics();
+    file->open();
+}
+
+ShardedBucketCache::~ShardedBucketCache()
+{
+    clear();
+}
+
+uInt ShardedBucketCache::cacheSize() const
+{
+    return itsShards.size() * itsShards[0]->maxBuckets;
+}
+
+std::shared_ptr<const char> ShardedBucketCache::getBucket (uInt bucketNr)
+{
+    if (bucketNr >= itsNrOfBuckets) {
+        throw indexError<Int> (bucketNr);
+    }
+    Shard& shard = *itsShards[bucketNr % itsShards.size()];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.naccess++;
+        std::unordered_map<uInt, Shard::Entry>::iterator iter =
+            shard.buckets.find (bucketNr);
+        if (iter != shard.buckets.end()) {
+            // Make it the most recently used.
+            shard.lru.splice (shard.lru.begin(), shard.lru,
+                              iter->second.lruPos);
+            return iter->second.data;
+        }
+    }
+    // Read the bucket without holding the lock.
+    std::shared_ptr<char> data = readBucket (bucketNr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.nread++;
+    std::unordered_map<uInt, Shard::Entry>::iterator iter =
+        shard.buckets.find (bucketNr);
+    if (iter != shard.buckets.end()) {
+        // Another thread read it in the meantime; use that one.
+        shard.lru.splice (shard.lru.begin(), shard.lru, iter->second.lruPos);
+        return iter->second.data;
+    }
+    // Remove the least recently used buckets if the shard is full.
+    while (shard.buckets.size() >= shard.maxBuckets) {
+        shard.buckets.erase (shard.lru.back());
+        shard.lru.pop_back();
+    }
+    shard.lru.push_front (bucketNr);
+    Shard::Entry& entry = shard.buckets[bucketNr];
+    entry.data   = data;
+    entry.lruPos = shard.lru.begin();
+    return data;
+}
+
+std::shared_ptr<char> ShardedBucketCache::readBucket (uInt bucketNr)
+{
+    std::vector<char> buffer(itsBucketSize);
+    itsFile->pread (buffer.data(), itsBucketSize,
+                    itsStartOffset + Int64(bucketNr) * itsBucketSize);
+    void* owner = itsOwner;
+    BucketCacheDeleteBuffer deleteCallBack = itsDeleteCallBack;
+    return std::shared_ptr<char> (itsReadCallBack (itsOwner, buffer.data()),
+                                  [owner, deleteCallBack] (char* ptr)
+                                  { deleteCallBack (owner, ptr); });
+}
+
+void ShardedBucketCache::clear()
+{
+    for (std::unique_ptr<Shard>& shard : itsShards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->buckets.clear();
+        shard->lru.clear();
+    }
+}
+
+void ShardedBucketCache::initStatistics()
+{
+    for (std::unique_ptr<Shard>& shard : itsShards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->naccess = 0;
+        shard->nread   = 0;
+    }
+}
+
+uInt ShardedBucketCache::nAccess() const
+{
+    uInt n = 0;
+    for (const std::unique_ptr<Shard>& shard : itsShards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        n += shard->naccess;
+    }
+    return n;
+}
+
+uInt ShardedBucketCache::nRead() const
+{
+    uInt n = 0;
+    for (const std::unique_ptr<Shard>& shard : itsShards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        n += shard->nread;
+    }
+    return n;
+}
+
+void ShardedBucketCache::showStatistics (ostream& os) const
+{
+    uInt naccess = nAccess();
+    uInt nread   = nRead();
+    os << "cacheSize: " << cacheSize() << " (*" << itsBucketSize
+       << ") in " << nShard() << " shards" << endl;
+    os << "#buckets:  " << itsNrOfBuckets << endl;
+    os << "#reads:    " << nread << endl;
+    os << "#accesses: " << naccess;
+    if (naccess > 0) {
+        os << "        hit-rate:  "
+           << 100 * float(naccess - nread) / float(naccess) << "%";
+    }
+    os << endl;
+}
+
+} //# NAMESPACE CASACORE - END
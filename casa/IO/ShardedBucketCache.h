@@ -0,0 +1,186 @@
+//# ShardedBucketCache.h: Thread-safe cache for buckets in a read-only file
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_SHARDEDBUCKETCACHE_H
+#define CASA_SHARDEDBUCKETCACHE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/iosfwd.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Thread-safe cache for buckets in a part of a read-only file
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tShardedBucketCache">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=BucketCache>BucketCache</linkto>
+//   <li> <linkto class=BucketFile>BucketFile</linkto>
+// </prerequisite>
+
+// <synopsis>
+// ShardedBucketCache is a variant of class
+// <linkto class=BucketCache>BucketCache</linkto> for files that are only
+// read. Its <src>getBucket</src> function can be called by multiple threads
+// simultaneously.
+// <p>
+// The cache is divided into a number of shards; bucket <src>n</src> is held
+// in shard <src>n % nshard</src>. Each shard has its own lock and LRU list,
+// so threads accessing different buckets hardly ever wait for each other.
+// The lock is not held while a bucket is read from the file (using
+// <src>BucketFile::pread</src>), so reads in the same shard can also
+// overlap. If two threads read the same bucket simultaneously, the first
+// one inserted is kept.
+// <p>
+// A bucket is returned as a <src>std::shared_ptr</src>. It keeps the bucket
+// alive while being used, even if it is removed from the cache by another
+// thread. The data are converted to local format using the ToLocal
+// callback function and deleted using the DeleteBuffer callback function
+// (see <linkto group=BucketCache_CallBack>BucketCache callbacks</linkto>).
+// These callback functions must be thread-safe.
+// <p>
+// The cache size is given as the total number of buckets. It is divided
+// evenly over the shards, where each shard holds at least one bucket.
+// </synopsis>
+
+// <motivation>
+// BucketCache has a single LRU list and no locking, so a table can only
+// be read by multiple threads if all access is serialized.
+// </motivation>
+
+// <example>
+// <srcblock>
+//  BucketFile file ("file.name", False);
+//  file.open();
+//  // Cache of 64 buckets divided over 8 shards.
+//  ShardedBucketCache cache (&file, 512, 32768, nbucket, 64, 8,
+//                            0, toLocal, deleteBuffer);
+//  // The following can be done by multiple threads.
+//  std::shared_ptr<const char> buf = cache.getBucket (10);
+// </srcblock>
+// </example>
+
+class ShardedBucketCache
+{
+public:
+    // Create the cache for a part of a file, which must have been opened
+    // read-only and cannot be part of a MultiFileBase.
+    // The file part used starts at startOffset. Its length is
+    // bucketSize*nrOfBuckets bytes.
+    // If nshard is 0, it is set to the number of cores (at most 64).
+    ShardedBucketCache (BucketFile* file, Int64 startOffset, uInt bucketSize,
+                        uInt nrOfBuckets, uInt cacheSize, uInt nshard,
+                        void* ownerObject,
+                        BucketCacheToLocal readCallBack,
+                        BucketCacheDeleteBuffer deleteCallBack);
+
+    ~ShardedBucketCache();
+
+    // Forbid copy constructor.
+    ShardedBucketCache (const ShardedBucketCache&) = delete;
+
+    // Forbid assignment.
+    ShardedBucketCache& operator= (const ShardedBucketCache&) = delete;
+
+    // Get a bucket in local format; it is read if not in the cache.
+    // This function is thread-safe.
+    std::shared_ptr<const char> getBucket (uInt bucketNr);
+
+    // Remove all buckets from the cache. Buckets still in use by the
+    // caller stay alive until they are released.
+    void clear();
+
+    // Get the nr of buckets in the file part.
+    uInt nBucket() const
+      { return itsNrOfBuckets; }
+
+    // Get the total cache size (in buckets).
+    uInt cacheSize() const;
+
+    // Get the number of shards.
+    uInt nShard() const
+      { return itsShards.size(); }
+
+    // (Re)initialize the cache statistics.
+    void initStatistics();
+
+    // Get the statistics summed over all shards.
+    // <group>
+    uInt nAccess() const;
+    uInt nRead() const;
+    // </group>
+
+    // Show the statistics.
+    void showStatistics (ostream& os) const;
+
+private:
+    // A shard contains the buckets and LRU list for a subset of the buckets.
+    struct Shard {
+        typedef std::list<uInt> LRUList;
+        struct Entry {
+            std::shared_ptr<char> data;
+            LRUList::iterator     lruPos;
+        };
+        std::mutex mutex;
+        std::unordered_map<uInt, Entry> buckets;
+        // Most recently used at the front.
+        LRUList lru;
+        uInt    maxBuckets;
+        uInt    naccess;
+        uInt    nread;
+    };
+
+    // Read the bucket and convert it to local format.
+    std::shared_ptr<char> readBucket (uInt bucketNr);
+
+    //# Data members
+    BucketFile* itsFile;
+    void*       itsOwner;
+    BucketCacheToLocal      itsReadCallBack;
+    BucketCacheDeleteBuffer itsDeleteCallBack;
+    Int64       itsStartOffset;
+    uInt        itsBucketSize;
+    uInt        itsNrOfBuckets;
+    std::vector<std::unique_ptr<Shard>> itsShards;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
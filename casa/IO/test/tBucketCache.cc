@@ -26,6 +26,7 @@
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/BucketFile.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/OS/Timer.h>
 #include <casacore/casa/iostream.h>
 
@@ -38,6 +39,8 @@ void a (Bool);
 void b (Bool);
 void c (uInt bufSize);
 void d (uInt bufSize);
+void e();
+void f();
 
 int main (int argc, const char*[])
 {
@@ -52,6 +55,8 @@ int main (int argc, const char*[])
 //	d (1024);
 //	d (32768);
 //	d (327680);
+	e();
+	f();
     } catch (std::exception& x) {
 	cout << "Caught an exception: " << x.what() << endl;
 	return 1;
@@ -254,3 +259,82 @@ void d (uInt)
     timer.show();
     cout << "<<<" << endl;
 }
+
+// Read the file using the prefetcher.
+void e()
+{
+    // Open the file.
+    BucketFile file("tBucketCache_tmp.data", False);
+    file.open();
+    Int rec[128];
+    file.read ((char*)rec, 512);
+    BucketCache cache (&file, 512, 32768, rec[0], 4, 0, aToLocal, aFromLocal,
+		       aInitBuffer, aDeleteBuffer);
+    AlwaysAssertExit (cache.setPrefetch (8));
+    AlwaysAssertExit (cache.hasPrefetch());
+    for (uInt j=0; j<2; j++) {
+	for (uInt i=0; i<100; i++) {
+	    // Read the next buckets ahead.
+	    std::vector<uInt> next;
+	    for (uInt k=1; k<=8; k++) {
+		next.push_back (i+5+k);
+	    }
+	    cache.prefetch (next);
+	    char* buf = cache.getBucket(i+5);
+	    if (*(Int*)buf != Int(i+1)  ||  *(Int*)(buf+32760) != Int(i+10)) {
+		cout << "Error in prefetched bucket " << i+5 << endl;
+	    }
+	}
+    }
+    // Prefetching cannot be done for a writable file.
+    BucketFile wfile("tBucketCache_tmp.data", True);
+    wfile.open();
+    BucketCache wcache (&wfile, 512, 32768, rec[0], 4, 0, aToLocal, aFromLocal,
+                        aInitBuffer, aDeleteBuffer);
+    AlwaysAssertExit (! wcache.setPrefetch (8));
+    cout << "checked prefetching " << cache.nBucket() << " buckets" << endl;
+}
+
+// Read buckets in a batch.
+void f()
+{
+    // Open the file.
+    BucketFile file("tBucketCache_tmp.data", False);
+    file.open();
+    Int rec[128];
+    file.read ((char*)rec, 512);
+    BucketCache cache (&file, 512, 32768, rec[0], 20, 0, aToLocal, aFromLocal,
+		       aInitBuffer, aDeleteBuffer);
+    // Load a few adjacent and non-adjacent buckets (in arbitrary order).
+    std::vector<uInt> bucketNrs;
+    for (uInt i=15; i>=5; i--) {
+	bucketNrs.push_back (i);
+    }
+    bucketNrs.push_back (50);
+    bucketNrs.push_back (52);
+    bucketNrs.push_back (50);
+    cache.loadBuckets (bucketNrs);
+    for (uInt i=5; i<=15; i++) {
+	char* buf = cache.getBucket(i);
+	if (*(Int*)buf != Int(i-4)  ||  *(Int*)(buf+32760) != Int(i+5)) {
+	    cout << "Error in loaded bucket " << i << endl;
+	}
+    }
+    char* buf = cache.getBucket(52);
+    if (*(Int*)buf != 48  ||  *(Int*)(buf+32760) != 57) {
+	cout << "Error in loaded bucket 52" << endl;
+    }
+    // No more buckets than fit in the cache are loaded.
+    bucketNrs.clear();
+    for (uInt i=60; i<100; i++) {
+	bucketNrs.push_back (i);
+    }
+    cache.loadBuckets (bucketNrs);
+    for (uInt i=60; i<100; i++) {
+	char* buf = cache.getBucket(i);
+	if (*(Int*)buf != Int(i-4)  ||  *(Int*)(buf+32760) != Int(i+5)) {
+	    cout << "Error in loaded bucket " << i << endl;
+	}
+    }
+    cout << "checked loading buckets" << endl;
+}
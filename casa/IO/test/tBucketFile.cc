@@ -29,6 +29,7 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/iostream.h>
+#include <vector>
 
 #include <casacore/casa/namespace.h>
 // <summary>
@@ -38,6 +39,7 @@
 void a(const std::shared_ptr<MultiFileBase>&);
 void b(const std::shared_ptr<MultiFileBase>&);
 void c(const std::shared_ptr<MultiFileBase>&);
+void d(const std::shared_ptr<MultiFileBase>&);
 
 int main (int argc, const char*[])
 {
@@ -49,6 +51,7 @@ int main (int argc, const char*[])
         }
 	a(mfile);
 	b(mfile);
+	d(mfile);
 	// Do exceptional things only when needed.
 	if (argc < 2) {
 	    cout << ">>>" << endl;
@@ -174,3 +177,66 @@ void c(const std::shared_ptr<MultiFileBase>& mfile)
     // Make it writable again.
     rfile.setPermissions (0644);
 }
+
+void d(const std::shared_ptr<MultiFileBase>& mfile)
+{
+    // Write parts of an odd length, so they are not aligned.
+    const uInt length = 1001;
+    const uInt nparts = 20;
+    {
+      BucketFile file ("tBucketFile_tmp.data2", 0, False, mfile);
+      // O_DIRECT cannot be used for a writable file.
+      AlwaysAssertExit (! file.setODirect (True));
+      std::vector<Int> buf(length);
+      for (uInt i=0; i<nparts; ++i) {
+        for (uInt j=0; j<length; ++j) {
+          buf[j] = i*length + j;
+        }
+        file.write (buf.data(), length*sizeof(Int));
+      }
+    }
+    // Read them back in various ways, possibly using O_DIRECT.
+    // Whether O_DIRECT can be used depends on OS and file system,
+    // so the result of setODirect is not checked for an ordinary file.
+    BucketFile file ("tBucketFile_tmp.data2", False, 0, False, mfile);
+    file.open();
+    Bool useODirect = file.setODirect (True);
+    if (mfile) {
+      AlwaysAssertExit (! useODirect);
+    }
+    const uInt nbytes = length*sizeof(Int);
+    std::vector<Int> buf(length);
+    file.seek (Int64(3*nbytes));
+    file.read (buf.data(), nbytes);
+    file.read (buf.data(), nbytes);
+    for (uInt j=0; j<length; ++j) {
+      AlwaysAssertExit (buf[j] == Int(4*length + j));
+    }
+    file.pread (buf.data(), nbytes, 7*nbytes);
+    for (uInt j=0; j<length; ++j) {
+      AlwaysAssertExit (buf[j] == Int(7*length + j));
+    }
+    // Read a batch of adjacent and non-adjacent parts (including the last).
+    std::vector<Int64> offsets;
+    std::vector<std::vector<Int>> bufs(6, std::vector<Int>(length));
+    std::vector<char*> bufPtrs;
+    uInt partNrs[] = {12, 2, 3, 4, 19, 11};
+    for (uInt i=0; i<6; ++i) {
+      offsets.push_back (Int64(partNrs[i]) * nbytes);
+      bufPtrs.push_back (reinterpret_cast<char*>(bufs[i].data()));
+    }
+    file.preadv (offsets, bufPtrs, nbytes);
+    for (uInt i=0; i<6; ++i) {
+      for (uInt j=0; j<length; ++j) {
+        AlwaysAssertExit (bufs[i][j] == Int(partNrs[i]*length + j));
+      }
+    }
+    // Reading beyond the end is an error.
+    Bool flag = False;
+    try {
+      file.pread (buf.data(), nbytes, nparts*nbytes);
+    } catch (const std::exception&) {
+      flag = True;
+    }
+    AlwaysAssertExit (flag);
+}
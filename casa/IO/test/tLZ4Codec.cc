@@ -0,0 +1,154 @@
+//# tLZ4Codec.cc: Test program for class LZ4Codec
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/IO/LZ4Codec.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for the LZ4Codec class
+// </summary>
+
+// Compress and decompress the data and check the result.
+// It returns the compressed size.
+size_t roundTrip (const std::vector<uChar>& data)
+{
+  std::vector<uChar> comp (LZ4Codec::maxCompressedSize (data.size()));
+  size_t n = LZ4Codec::compress (comp.data(), data.data(), data.size());
+  AlwaysAssertExit (n <= comp.size());
+  std::vector<uChar> out (data.size() + 1, 0xee);
+  LZ4Codec::decompress (out.data(), data.size(), comp.data(), n);
+  AlwaysAssertExit (out[data.size()] == 0xee);
+  AlwaysAssertExit (memcmp (out.data(), data.data(), data.size()) == 0);
+  return n;
+}
+
+void testSmall()
+{
+  // All sizes up to the minimum size for a match.
+  for (size_t sz=0; sz<40; ++sz) {
+    std::vector<uChar> data(sz, 'a');
+    roundTrip (data);
+  }
+}
+
+void testPatterns()
+{
+  // Constant data compress very well.
+  std::vector<uChar> zeros(100000, 0);
+  size_t n = roundTrip (zeros);
+  AlwaysAssertExit (n < 500);
+  // A repeating pattern with a short period (overlapping matches).
+  std::vector<uChar> pattern(50000);
+  for (size_t i=0; i<pattern.size(); ++i) {
+    pattern[i] = i%3;
+  }
+  AlwaysAssertExit (roundTrip (pattern) < 500);
+  // Random data do not compress, but must round trip.
+  std::vector<uChar> random(70000);
+  srand (1);
+  for (size_t i=0; i<random.size(); ++i) {
+    random[i] = rand() % 256;
+  }
+  roundTrip (random);
+  // Mixed data with long literal runs and matches.
+  std::vector<uChar> mixed;
+  for (int j=0; j<20; ++j) {
+    for (int i=0; i<300; ++i) mixed.push_back (rand() % 256);
+    for (int i=0; i<1000; ++i) mixed.push_back (j);
+  }
+  roundTrip (mixed);
+}
+
+void testShuffle()
+{
+  std::vector<Int> data(1000);
+  for (size_t i=0; i<data.size(); ++i) {
+    data[i] = i;
+  }
+  std::vector<uChar> shuffled (data.size() * sizeof(Int));
+  LZ4Codec::shuffle (shuffled.data(), data.data(), data.size(), sizeof(Int));
+  std::vector<Int> back(data.size());
+  LZ4Codec::unshuffle (back.data(), shuffled.data(), data.size(), sizeof(Int));
+  AlwaysAssertExit (back == data);
+  // Shuffled small integers compress better than unshuffled ones.
+  std::vector<uChar> plain (shuffled.size());
+  memcpy (plain.data(), data.data(), plain.size());
+  AlwaysAssertExit (roundTrip (shuffled) < roundTrip (plain));
+}
+
+void testCorrupt()
+{
+  std::vector<uChar> data(10000, 7);
+  std::vector<uChar> comp (LZ4Codec::maxCompressedSize (data.size()));
+  size_t n = LZ4Codec::compress (comp.data(), data.data(), data.size());
+  std::vector<uChar> out (data.size());
+  // Truncated input.
+  Bool ok = False;
+  try {
+    LZ4Codec::decompress (out.data(), out.size(), comp.data(), n-1);
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+  // Output buffer too small.
+  ok = False;
+  try {
+    LZ4Codec::decompress (out.data(), out.size()-1, comp.data(), n);
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+  // An offset pointing before the start of the output.
+  uChar bad[] = {0x10, 'x', 0x05, 0x00, 0x00};
+  ok = False;
+  try {
+    LZ4Codec::decompress (out.data(), 10, bad, sizeof(bad));
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+}
+
+int main()
+{
+  try {
+    testSmall();
+    testPatterns();
+    testShuffle();
+    testCorrupt();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
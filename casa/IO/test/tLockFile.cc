@@ -26,6 +26,7 @@
 
 #include <casacore/casa/IO/LockFile.h>
 #include <casacore/casa/IO/MemoryIO.h>
+#include <casacore/casa/OS/File.h>
 #include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/IO/RegularFileIO.h>
 #include <casacore/casa/OS/Path.h>
@@ -35,6 +36,7 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/sstream.h>
+#include <unistd.h>
 
 
 #include <casacore/casa/namespace.h>
@@ -195,6 +197,54 @@ void doTest()
     }
 }
 
+// Test that the shared counter makes acquire skip reading unchanged info.
+void doTestShared()
+{
+    String shmName;
+    {
+        LockFile lock1 ("tLockFile_tmp.data", 0, True);
+        LockFile lock2 ("tLockFile_tmp.data", 0, False, True, True, 1);
+        if (! lock1.enableSharedCounter()) {
+            cout << "Shared counter cannot be used on this system" << endl;
+            return;
+        }
+        AlwaysAssertExit (lock2.enableSharedCounter());
+        AlwaysAssertExit (lock1.sharedCounterName() == lock2.sharedCounterName());
+        MemoryIO memio;
+        uInt value = 10;
+        memio.write (sizeof(value), &value);
+        AlwaysAssertExit (lock1.acquire());
+        lock1.release (memio);
+        //# The first acquire always reads the info.
+        MemoryIO memio2;
+        AlwaysAssertExit (lock2.acquire (memio2, FileLocker::Read));
+        AlwaysAssertExit (! lock2.infoUnchanged());
+        AlwaysAssertExit (memio2.length() == sizeof(value));
+        lock2.release();
+        //# Nothing changed, so the info is not read again.
+        AlwaysAssertExit (lock2.acquire (memio2, FileLocker::Read));
+        AlwaysAssertExit (lock2.infoUnchanged());
+        AlwaysAssertExit (memio2.length() == 0);
+        lock2.release();
+        //# The writer does not need to reread its own info.
+        AlwaysAssertExit (lock1.acquire (memio));
+        AlwaysAssertExit (lock1.infoUnchanged());
+        AlwaysAssertExit (memio.length() == 0);
+        memio.write (sizeof(value), &value);
+        lock1.release (memio);
+        //# Now the info has been changed.
+        AlwaysAssertExit (lock2.acquire (memio2, FileLocker::Read));
+        AlwaysAssertExit (! lock2.infoUnchanged());
+        AlwaysAssertExit (memio2.length() == sizeof(value));
+        memio2.read (sizeof(value), &value);
+        AlwaysAssertExit (value == 10);
+        lock2.release();
+        shmName = lock1.sharedCounterName();
+    }
+    //# The counter file is removed when the lock files are closed.
+    AlwaysAssertExit (! File(shmName).exists());
+}
+
 int main (int argc, const char* argv[])
 {
     try {
@@ -209,6 +259,7 @@ int main (int argc, const char* argv[])
 	    doIt (argv[1], interval);
 	}else{
 	    doTest();
+	    doTestShared();
 	    cout << "Run as:   tLockFile <fileName> [inspectionInterval]"
 		 << endl;
 	    cout << "for a manual control of acquiring and releasing locks."
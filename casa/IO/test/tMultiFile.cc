@@ -374,6 +374,73 @@ void testTruncate()
   AlwaysAssertExit (mfile->freeBlocks().size() == 0);
 }
 
+void testStriped (uInt nstripe, Bool asyncIO, Bool useCRC)
+{
+  // Write and read files with various access patterns.
+  // Note that nothing is printed, because nothing differs from a normal
+  // MultiFile apart from the block locations.
+  const Int64 bs = 256;
+  const Int nval = 10*bs/sizeof(Int);
+  Vector<Int> vec0(nval), vec1(nval), res(nval);
+  indgen (vec0);
+  indgen (vec1, 1000000);
+  {
+    MultiFile mfile("tMultiFile_tmp.dat", ByteIO::New, bs, False, useCRC,
+                    nstripe, asyncIO);
+    AlwaysAssertExit (mfile.nstripe() == nstripe  &&
+                      mfile.asyncIO() == asyncIO);
+    Int id0 = mfile.createFile ("file0");
+    Int id1 = mfile.createFile ("file1");
+    // Interleave the files, so their blocks are mixed.
+    for (Int i=0; i<10; ++i) {
+      mfile.write (id0, vec0.data() + i*bs/4, bs, i*bs);
+      mfile.write (id1, vec1.data() + i*bs/4, bs, i*bs);
+    }
+    // Overwrite part of a block that is possibly still being written.
+    vec0[3] = -3;
+    mfile.write (id0, vec0.data()+3, sizeof(Int), 3*sizeof(Int));
+    // Read back while writing might be busy.
+    mfile.read (id0, res.data(), 10*bs, 0);
+    AlwaysAssertExit (allEQ (res, vec0));
+    mfile.flush();
+    mfile.closeFile (id0);
+    mfile.closeFile (id1);
+  }
+  {
+    // Reopen and check the data by reading sequentially in small pieces.
+    MultiFile mfile("tMultiFile_tmp.dat", ByteIO::Update, 0, False, False,
+                    1, asyncIO);
+    AlwaysAssertExit (mfile.nstripe() == nstripe);
+    AlwaysAssertExit (mfile.blockSize() == bs);
+    Int id0 = mfile.openFile ("file0");
+    Int id1 = mfile.openFile ("file1");
+    for (Int i=0; i<nval; i+=20) {
+      mfile.read (id1, res.data()+i, 20*sizeof(Int), i*sizeof(Int));
+    }
+    AlwaysAssertExit (allEQ (res, vec1));
+    // Overwrite blocks that have been prefetched.
+    mfile.read (id0, res.data(), bs, 0);
+    vec0 += 10;
+    mfile.write (id0, vec0.data(), 10*bs, 0);
+    mfile.read (id0, res.data(), 10*bs, 0);
+    AlwaysAssertExit (allEQ (res, vec0));
+    // Delete a file, so the MultiFile gets truncated.
+    mfile.deleteFile (id1);
+    mfile.read (id0, res.data(), 10*bs, 0);
+    AlwaysAssertExit (allEQ (res, vec0));
+    mfile.closeFile (id0);
+  }
+  {
+    MultiFile mfile("tMultiFile_tmp.dat", ByteIO::Old);
+    AlwaysAssertExit (mfile.nstripe() == nstripe  &&  !mfile.asyncIO());
+    AlwaysAssertExit (mfile.nfile() == 1);
+    Int id0 = mfile.openFile ("file0");
+    mfile.read (id0, res.data(), 10*bs, 0);
+    AlwaysAssertExit (allEQ (res, vec0));
+    mfile.closeFile (id0);
+  }
+}
+
 void doPackTest (const std::vector<Int64>& bl, const std::vector<Int64>& exp)
 {
   std::vector<Int64> pck = MultiFile::packIndex (bl);
@@ -408,6 +475,10 @@ int main()
     testNested (512, 0);
     // Test file truncation.
     testTruncate();
+    // Test striping and asynchronous I/O.
+    testStriped (1, True, False);
+    testStriped (3, False, True);
+    testStriped (4, True, True);
     // Do some timings.
     // Exclude timings from checked output.
     cout << ">>>" << endl;
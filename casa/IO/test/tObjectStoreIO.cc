@@ -0,0 +1,205 @@
+//# tObjectStoreIO.cc: Test program for class ObjectStoreIO
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/casa/IO/ObjectStoreIO.h>
+#include <casacore/casa/IO/MultiFile.h>
+#include <casacore/casa/IO/RegularFileIO.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+using namespace casacore;
+using namespace std;
+
+// A client reading local files given by a test:// URL.
+// It counts the number of requests.
+class LocalObjectStore : public ObjectStoreClient
+{
+public:
+  LocalObjectStore()
+    : itsNrGets (0)
+  {}
+  Int64 objectSize (const String& url) override
+  {
+    RegularFileIO file(RegularFile(path(url)));
+    return file.length();
+  }
+  void getRange (const String& url, Int64 offset, Int64 size,
+                 void* buf) override
+  {
+    itsNrGets++;
+    RegularFileIO file(RegularFile(path(url)));
+    file.pread (size, offset, buf);
+  }
+  String path (const String& url) const
+    { return url.substr(7); }
+  std::atomic<Int64> itsNrGets;
+};
+
+void makeFile (const String& name, Int64 size)
+{
+  std::vector<char> buf(size);
+  for (Int64 i=0; i<size; ++i) {
+    buf[i] = char(i%251);
+  }
+  RegularFileIO file(RegularFile(name), ByteIO::New);
+  file.write (size, buf.data());
+}
+
+void checkData (const std::vector<char>& buf, Int64 offset)
+{
+  for (size_t i=0; i<buf.size(); ++i) {
+    AlwaysAssertExit (buf[i] == char((offset+i)%251));
+  }
+}
+
+void testRead (const std::shared_ptr<LocalObjectStore>& client)
+{
+  const Int64 size = 10500;
+  makeFile ("tObjectStoreIO_tmp.dat", size);
+  ObjectStoreIO io(client, "test://tObjectStoreIO_tmp.dat", 1000, 4, 3);
+  AlwaysAssertExit (io.length() == size);
+  AlwaysAssertExit (io.isReadable()  &&  !io.isWritable()  &&
+                    io.isSeekable());
+  AlwaysAssertExit (io.fileName() == "test://tObjectStoreIO_tmp.dat");
+  // Read spanning 3 blocks; they are fetched in parallel.
+  std::vector<char> buf(2500);
+  AlwaysAssertExit (io.pread (buf.size(), 1000, buf.data()) == 2500);
+  checkData (buf, 1000);
+  AlwaysAssertExit (io.nrRequests() == 3);
+  AlwaysAssertExit (io.nrBytesFetched() == 3000);
+  // Reading from the cache does not need requests.
+  AlwaysAssertExit (io.pread (100, 1200, buf.data()) == 100);
+  AlwaysAssertExit (io.nrRequests() == 3);
+  // A sequential read fetches the next blocks as well.
+  buf.resize (500);
+  AlwaysAssertExit (io.pread (buf.size(), 3400, buf.data()) == 500);
+  checkData (buf, 3400);
+  AlwaysAssertExit (io.nrRequests() == 3);
+  AlwaysAssertExit (io.pread (buf.size(), 3900, buf.data()) == 500);
+  checkData (buf, 3900);
+  AlwaysAssertExit (io.nrRequests() == 7);
+  AlwaysAssertExit (io.pread (buf.size(), 5200, buf.data()) == 500);
+  AlwaysAssertExit (io.nrRequests() == 7);
+  // The last (partial) block; the cache holds only 4 blocks.
+  buf.resize (700);
+  AlwaysAssertExit (io.pread (buf.size(), 9800, buf.data()) == 700);
+  checkData (buf, 9800);
+  AlwaysAssertExit (io.nrBytesFetched() == 8500);
+  // Reading past the end.
+  AlwaysAssertExit (io.pread (1000, 10000, buf.data(), False) == 500);
+  AlwaysAssertExit (io.pread (10, size, buf.data(), False) == 0);
+  Bool failed = False;
+  try {
+    io.pread (1000, 10000, buf.data());
+  } catch (const AipsError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  // Sequential reads using the position.
+  io.seek (Int64(10), ByteIO::Begin);
+  buf.resize (4000);
+  AlwaysAssertExit (io.read (buf.size(), buf.data()) == 4000);
+  checkData (buf, 10);
+  AlwaysAssertExit (io.seek (Int64(0), ByteIO::Current) == 4010);
+  AlwaysAssertExit (io.seek (Int64(-10), ByteIO::End) == size-10);
+  // Writing is not possible.
+  failed = False;
+  try {
+    io.pwrite (10, 0, buf.data());
+  } catch (const AipsError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  // After a resync the object is read again.
+  uInt64 nreq = io.nrRequests();
+  io.resync();
+  AlwaysAssertExit (io.pread (100, 0, buf.data()) == 100);
+  AlwaysAssertExit (io.nrRequests() == nreq+1);
+}
+
+void testMultiFile (uInt nstripe)
+{
+  const Int64 bs = 512;
+  std::vector<Int> vec0(3000), vec1(1000);
+  for (size_t i=0; i<vec0.size(); ++i) vec0[i] = i;
+  for (size_t i=0; i<vec1.size(); ++i) vec1[i] = -Int(i);
+  {
+    MultiFile mfile("tObjectStoreIO_tmp.mf", ByteIO::New, bs, False, True,
+                    nstripe);
+    Int id0 = mfile.createFile ("file0");
+    Int id1 = mfile.createFile ("file1");
+    mfile.write (id0, vec0.data(), vec0.size()*sizeof(Int), 0);
+    mfile.write (id1, vec1.data(), vec1.size()*sizeof(Int), 0);
+  }
+  // Read it back via the object store.
+  AlwaysAssertExit (ObjectStoreClient::isURL ("test://tObjectStoreIO_tmp.mf"));
+  std::shared_ptr<MultiFileBase> mfile =
+    MultiFileBase::openMF ("test://tObjectStoreIO_tmp.mf");
+  AlwaysAssertExit (! mfile->isWritable());
+  AlwaysAssertExit (mfile->blockSize() == bs);
+  std::vector<Int> res0(vec0.size()), res1(vec1.size());
+  mfile->read (mfile->openFile("file1"), res1.data(),
+               res1.size()*sizeof(Int), 0);
+  mfile->read (mfile->openFile("file0"), res0.data(),
+               res0.size()*sizeof(Int), 0);
+  AlwaysAssertExit (res0 == vec0);
+  AlwaysAssertExit (res1 == vec1);
+  // An object cannot be created.
+  Bool failed = False;
+  try {
+    MultiFile mf("test://tObjectStoreIO_tmp2.mf", ByteIO::New);
+  } catch (const AipsError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+int main()
+{
+  try {
+    std::shared_ptr<LocalObjectStore> client =
+      std::make_shared<LocalObjectStore>();
+    ObjectStoreClient::registerClient ("test", client);
+    AlwaysAssertExit (ObjectStoreClient::isURL ("s3://bucket/key"));
+    AlwaysAssertExit (! ObjectStoreClient::isURL ("/tmp/test://a"));
+    AlwaysAssertExit (! ObjectStoreClient::isURL ("tObjectStoreIO_tmp.dat"));
+    testRead (client);
+    testMultiFile (1);
+    testMultiFile (3);
+    ObjectStoreClient::registerClient ("test",
+                                       std::shared_ptr<ObjectStoreClient>());
+    AlwaysAssertExit (! ObjectStoreClient::isURL ("test://a"));
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,171 @@
+//# tShardedBucketCache.cc: Test program for class ShardedBucketCache
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/IO/ShardedBucketCache.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for the ShardedBucketCache class
+// </summary>
+
+const uInt bucketSize = 4096;
+const uInt nbucket    = 200;
+
+char* toLocal (void*, const char* data)
+{
+  char* ptr = new char[bucketSize];
+  memcpy (ptr, data, bucketSize);
+  return ptr;
+}
+
+void deleteBuffer (void*, char* buffer)
+{
+  delete [] buffer;
+}
+
+void writeFile()
+{
+  BucketFile file ("tShardedBucketCache_tmp.data");
+  file.open();
+  std::vector<Int> buf(bucketSize/sizeof(Int));
+  for (uInt i=0; i<nbucket; ++i) {
+    for (uInt j=0; j<buf.size(); ++j) {
+      buf[j] = i*1000 + j;
+    }
+    file.write (buf.data(), bucketSize);
+  }
+}
+
+// Check that a bucket has the correct contents.
+Bool checkBucket (const char* data, uInt bucketNr)
+{
+  const Int* ptr = reinterpret_cast<const Int*>(data);
+  for (uInt j=0; j<bucketSize/sizeof(Int); ++j) {
+    if (ptr[j] != Int(bucketNr*1000 + j)) {
+      return False;
+    }
+  }
+  return True;
+}
+
+void readSequential()
+{
+  BucketFile file ("tShardedBucketCache_tmp.data", False);
+  file.open();
+  ShardedBucketCache cache (&file, 0, bucketSize, nbucket, 16, 4,
+                            0, toLocal, deleteBuffer);
+  AlwaysAssertExit (cache.nShard() == 4);
+  AlwaysAssertExit (cache.cacheSize() == 16);
+  AlwaysAssertExit (cache.nBucket() == nbucket);
+  for (uInt i=0; i<nbucket; ++i) {
+    AlwaysAssertExit (checkBucket (cache.getBucket(i).get(), i));
+  }
+  AlwaysAssertExit (cache.nRead() == nbucket);
+  // The last 16 buckets (4 per shard) are still in the cache.
+  for (uInt i=nbucket-16; i<nbucket; ++i) {
+    AlwaysAssertExit (checkBucket (cache.getBucket(i).get(), i));
+  }
+  AlwaysAssertExit (cache.nRead() == nbucket);
+  AlwaysAssertExit (cache.nAccess() == nbucket+16);
+  // A bucket stays valid when removed from the cache.
+  std::shared_ptr<const char> keep = cache.getBucket(0);
+  cache.clear();
+  AlwaysAssertExit (checkBucket (keep.get(), 0));
+  // An invalid bucket number.
+  Bool ok = False;
+  try {
+    cache.getBucket (nbucket);
+  } catch (const std::exception&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+}
+
+void readParallel (uInt nthread)
+{
+  BucketFile file ("tShardedBucketCache_tmp.data", False);
+  file.open();
+  ShardedBucketCache cache (&file, 0, bucketSize, nbucket, 32, 8,
+                            0, toLocal, deleteBuffer);
+  std::vector<uInt> nerr(nthread, 0);
+  std::vector<std::thread> threads;
+  for (uInt t=0; t<nthread; ++t) {
+    threads.emplace_back ([&cache, &nerr, t] () {
+      for (uInt k=0; k<20; ++k) {
+        for (uInt i=0; i<nbucket; ++i) {
+          uInt bucketNr = (i*7 + t*13 + k) % nbucket;
+          if (! checkBucket (cache.getBucket(bucketNr).get(), bucketNr)) {
+            nerr[t]++;
+          }
+        }
+      }
+    });
+  }
+  for (std::thread& thr : threads) {
+    thr.join();
+  }
+  for (uInt t=0; t<nthread; ++t) {
+    AlwaysAssertExit (nerr[t] == 0);
+  }
+  AlwaysAssertExit (cache.nAccess() == nthread*20*nbucket);
+}
+
+void checkWritable()
+{
+  // A writable file cannot be used.
+  BucketFile file ("tShardedBucketCache_tmp.data", True);
+  file.open();
+  Bool ok = False;
+  try {
+    ShardedBucketCache cache (&file, 0, bucketSize, nbucket, 16, 4,
+                              0, toLocal, deleteBuffer);
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+}
+
+int main()
+{
+  try {
+    writeFile();
+    readSequential();
+    readParallel (4);
+    checkWritable();
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -40,6 +40,10 @@ namespace casacore {
   : map<String, JsonValue> (that)
   {}
 
+  JsonKVMap::JsonKVMap (JsonKVMap&& that)
+  : map<String, JsonValue> (std::move(that))
+  {}
+
   JsonKVMap::~JsonKVMap()
   {}
 
@@ -51,6 +55,12 @@ namespace casacore {
     return *this;
   }
 
+  JsonKVMap& JsonKVMap::operator= (JsonKVMap&& that)
+  {
+    map<String, JsonValue>::operator= (std::move(that));
+    return *this;
+  }
+
   const JsonValue& JsonKVMap::get (const String& name) const
   {
     const_iterator value = find(name);
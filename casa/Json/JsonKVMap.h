@@ -84,6 +84,12 @@ namespace casacore {
       
     // Assignment (copy semantics)
     JsonKVMap& operator= (const JsonKVMap& that);
+
+    // Move constructor and assignment.
+    // <group>
+    JsonKVMap (JsonKVMap&& that);
+    JsonKVMap& operator= (JsonKVMap&& that);
+    // </group>
       
     // Is a key defined?
     Bool isDefined (const String& name) const
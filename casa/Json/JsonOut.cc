@@ -32,9 +32,9 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Containers/ValueHolder.h>
-#include <sstream>
-#include <iomanip>
 #include <ctype.h>    //# for iscntrl
+#include <stdio.h>
+#include <string.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -56,13 +56,23 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   // Close the stream.
   JsonOut::~JsonOut()
-  {}
+  {
+    flushBuffer();
+  }
+
+  void JsonOut::flushBuffer()
+  {
+    if (! itsBuffer.empty()) {
+      itsStream.write (itsBuffer.data(), itsBuffer.size());
+      itsBuffer.clear();
+    }
+  }
 
   void JsonOut::start (const String& commentStart, const String& commentEnd,
                        const String& indent)
   {
     AlwaysAssert (itsLevel==0, JsonError);
-    itsStream << '{' << endl;
+    itsBuffer += "{\n";
     itsIndent       = indent;
     itsIndentStep   = indent;
     itsCommentStart = commentStart;
@@ -70,6 +80,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsLevel = 1;
     itsFirstName.resize (1);
     itsFirstName[0] = True;
+    flushBuffer();
   }
 
   void JsonOut::end()
@@ -77,19 +88,22 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsLevel--;
     AlwaysAssert (itsLevel==0, JsonError);
     itsIndent.clear();
-    itsStream << '}' << endl;
+    itsBuffer += "}\n";
+    flushBuffer();
+    itsStream.flush();
   }
 
   void JsonOut::startNested (const String& name, const String& comment)
   {
     AlwaysAssert (itsLevel>0, JsonError);
-    writeComment (comment);
+    addComment (comment);
     putName (name);
-    itsStream << '{' << endl;
+    itsBuffer += "{\n";
     itsIndent += itsIndentStep;
     itsLevel++;
     itsFirstName.resize (itsLevel);
     itsFirstName[itsLevel-1] = True;
+    flushBuffer();
   }
 
   void JsonOut::endNested()
@@ -97,13 +111,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsLevel--;
     AlwaysAssert (itsLevel>0, JsonError);
     itsIndent = itsIndent.substr (0, itsIndent.size() - itsIndentStep.size());
-    itsStream << itsIndent << '}' << endl;
+    itsBuffer += itsIndent;
+    itsBuffer += "}\n";
+    flushBuffer();
   }
 
   void JsonOut::writeKV (const String& name, const ValueHolder& vh)
   {
     if (vh.isNull()) {
-      putNull();
+      itsBuffer += "null";
     } else {
       switch (vh.dataType()) {
       case TpBool:
@@ -170,15 +186,23 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
   void JsonOut::writeComment (const String& comment)
+  {
+    addComment (comment);
+    flushBuffer();
+  }
+
+  void JsonOut::addComment (const String& comment)
   {
     if (!itsCommentStart.empty()  &&  !comment.empty()) {
-      itsStream << itsIndent << ' ' << itsCommentStart << ' ' << comment;
-      if (!itsCommentEnd.empty()) {
-        itsStream << itsCommentEnd;
-      }
-      itsStream << endl;
+      itsBuffer += itsIndent;
+      itsBuffer += ' ';
+      itsBuffer += itsCommentStart;
+      itsBuffer += ' ';
+      itsBuffer += comment;
+      itsBuffer += itsCommentEnd;
+      itsBuffer += '\n';
     } 
- }
+  }
 
   String JsonOut::indentValue (const String& indent, const String& name) const
   {
@@ -188,142 +212,189 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void JsonOut::putName (const String& name)
   {
-    itsStream << itsIndent;
+    itsBuffer += itsIndent;
     if (itsFirstName[itsLevel-1]) {
-      itsStream << ' ';
+      itsBuffer += ' ';
       itsFirstName[itsLevel-1] = False;
     } else {
-      itsStream << ',';
+      itsBuffer += ',';
     }
-    itsStream << '"' << name << "\": ";
+    itsBuffer += '"';
+    itsBuffer += name;
+    itsBuffer += "\": ";
   }
 
   void JsonOut::putNull()
   {
-    itsStream << "null";
+    itsBuffer += "null";
+    flushBuffer();
   }
 
   void JsonOut::put (Bool value)
   {
-    itsStream << (value ? "true" : "false");
+    addValue (value);
+    flushBuffer();
   }
   void JsonOut::put (Float value)
+  {
+    addValue (value);
+    flushBuffer();
+  }
+  void JsonOut::put (Double value)
+  {
+    addValue (value);
+    flushBuffer();
+  }
+  void JsonOut::put (const Complex& value)
+  {
+    addValue (value);
+    flushBuffer();
+  }
+  void JsonOut::put (const DComplex& value)
+  {
+    addValue (value);
+    flushBuffer();
+  }
+  void JsonOut::put (const char* value)
+  {
+    addValue (value);
+    flushBuffer();
+  }
+  void JsonOut::put (const String& value)
+  {
+    addValue (value);
+    flushBuffer();
+  }
+
+  void JsonOut::addValue (Bool value)
+  {
+    itsBuffer += (value ? "true" : "false");
+  }
+  void JsonOut::addValue (Float value)
   {
     if (! isFinite(value)) {
-      putNull();
+      itsBuffer += "null";
     } else {
-      char buf[16];
-      sprintf (buf, "%.7g", value);
-      // Add a decimal point if needed, otherwise it is integer.
-      unsigned i;
-      for (i=0; i<sizeof(buf); ++i) {
-        if (buf[i] == '.'  ||  buf[i] == 'e') break;
-        if (buf[i] == 0) break;
-      }
-      if (buf[i] ==0 ) {
-        buf[i]   = '.';
-        buf[i+1] = '0';
-        buf[i+2] = 0;
-      }
-      itsStream << buf;
+      addReal ("%.7g", value);
     }
   }
-  void JsonOut::put (Double value)
+  void JsonOut::addValue (Double value)
   {
     if (! isFinite(value)) {
-      putNull();
+      itsBuffer += "null";
     } else {
-      char buf[24];
-      sprintf (buf, "%.16g", value);
-      // Add a decimal point if needed, otherwise it is integer.
-      unsigned i;
-      for (i=0; i<sizeof(buf); ++i) {
-        if (buf[i] == '.'  ||  buf[i] == 'e') break;
-        if (buf[i] == 0) break;
-      }
-      if (buf[i] ==0 ) {
-        buf[i]   = '.';
-        buf[i+1] = '0';
-        buf[i+2] = 0;
-      }
-      itsStream << buf;
+      addReal ("%.16g", value);
     }
   }
-  void JsonOut::put (const Complex& value)
+  void JsonOut::addReal (const char* format, double value)
   {
-    itsStream << "{\"r\":";
-    put (value.real());
-    itsStream << ", \"i\":";
-    put (value.imag());
-    itsStream << '}';
+    char buf[32];
+    int n = snprintf (buf, sizeof(buf), format, value);
+    itsBuffer.append (buf, n);
+    // Add a decimal point if needed, otherwise it is integer.
+    if (strpbrk (buf, ".e") == 0) {
+      itsBuffer += ".0";
+    }
   }
-  void JsonOut::put (const DComplex& value)
+  void JsonOut::addValue (const Complex& value)
   {
-    itsStream << "{\"r\":";
-    put (value.real());
-    itsStream << ", \"i\":";
-    put (value.imag());
-    itsStream << '}';
+    itsBuffer += "{\"r\":";
+    addValue (value.real());
+    itsBuffer += ", \"i\":";
+    addValue (value.imag());
+    itsBuffer += '}';
+  }
+  void JsonOut::addValue (const DComplex& value)
+  {
+    itsBuffer += "{\"r\":";
+    addValue (value.real());
+    itsBuffer += ", \"i\":";
+    addValue (value.imag());
+    itsBuffer += '}';
+  }
+  void JsonOut::addValue (const char* value)
+  {
+    itsBuffer += '"';
+    addEscaped (itsBuffer, value, strlen(value));
+    itsBuffer += '"';
+  }
+  void JsonOut::addValue (const String& value)
+  {
+    itsBuffer += '"';
+    addEscaped (itsBuffer, value.data(), value.size());
+    itsBuffer += '"';
   }
-  void JsonOut::put (const char* value)
-    { itsStream << '"' << escapeString(value) << '"'; }
-  void JsonOut::put (const String& value)
-    { itsStream << '"' << escapeString(value) << '"'; }
 
-  void JsonOut::put (const Record& rec)
+  void JsonOut::addValue (const Record& rec)
   {
-    itsStream << '{' << endl;
+    itsBuffer += "{\n";
     String oldIndent(itsIndent);
     itsIndent += itsIndentStep;
     itsLevel++;
     itsFirstName.resize (itsLevel);
     itsFirstName[itsLevel-1] = True;
     for (uInt i=0; i<rec.nfields(); ++i) {
-      write (rec.name(i), rec.asValueHolder(i));
+      putName (rec.name(i));
+      writeKV (rec.name(i), rec.asValueHolder(i));
+      itsBuffer += '\n';
     }
     itsLevel--;
     itsIndent = oldIndent;
-    itsStream << itsIndent << '}';
+    itsBuffer += itsIndent;
+    itsBuffer += '}';
   }
 
   String JsonOut::escapeString (const String& in)
   {
     String out;
     out.reserve (in.size());
-    for (size_t i=0; i<in.size(); ++i) {
-      switch (in[i]) {
+    addEscaped (out, in.data(), in.size());
+    return out;
+  }
+
+  void JsonOut::addEscaped (std::string& out, const char* in, size_t size)
+  {
+    const char* end = in + size;
+    while (in < end) {
+      // Copy the characters not needing an escape in one go.
+      const char* st = in;
+      while (in < end  &&  *in != '"'  &&  *in != '\\'  &&  !iscntrl(*in)) {
+        ++in;
+      }
+      out.append (st, in - st);
+      if (in == end) {
+        break;
+      }
+      switch (*in) {
       case '\b':
-        out.append ("\\b");  // backspace
+        out += "\\b";  // backspace
         break;
       case '\f':
-        out.append ("\\f");  // formfeed
+        out += "\\f";  // formfeed
         break;
       case '\n':
-        out.append ("\\n");  // newline
+        out += "\\n";  // newline
         break;
       case '\r':
-        out.append ("\\r");  // carriage return
+        out += "\\r";  // carriage return
         break;
       case '\t':
-        out.append ("\\t");  // tab
+        out += "\\t";  // tab
         break;
       case '"':
       case '\\':
-        out.append ('\\');
-        out.append (in[i]);
+        out += '\\';
+        out += *in;
         break;
       default:
-        if (iscntrl(in[i])) {
-          ostringstream oss;
-          oss << "\\u" << std::hex << std::uppercase << std::setfill('0')
-              << std::setw(4) << static_cast<int>(in[i]);
-          out.append (oss.str());
-        } else {
-          out.append (in[i]);
+        {
+          char buf[8];
+          snprintf (buf, sizeof(buf), "\\u%04X", static_cast<int>(*in));
+          out += buf;
         }
       }
+      ++in;
     }
-    return out;
   }
 
 } //# NAMESPACE CASACORE - END
@@ -34,6 +34,8 @@
 #include <casacore/casa/vector.h>
 #include <iostream>
 #include <fstream>
+#include <string>
+#include <type_traits>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -75,6 +77,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   //
   // The output of JsonOut can be any iostream. If a file name is given, an
   // ofstream will be opened in the constructor and closed in the destructor.
+  // The values are formatted into an internal buffer (not through the
+  // ostream), which is written to the stream at the end of each public
+  // function. So the output of JsonOut can be mixed with other output to
+  // the same stream. The stream is not flushed per line.
   // The output is formatted pretty nicely. Nested structs are indented with
   // 2 spaces. Arrays are written with a single axis per line; continuation
   // lines are indented properly. String arrays have one value per line.
@@ -200,24 +206,58 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Assignment cannot be used.
     JsonOut& operator= (const JsonOut& other);
 
-    // Write the name.
+    // Write the buffer to the stream and clear it.
+    void flushBuffer();
+
+    // Add a comment line to the buffer.
+    void addComment (const String& comment);
+
+    // Add the name to the buffer.
     void putName (const String& name);
 
-    // General function to write a key and value.
+    // General function to add a key and value.
     // Specializations exist for particular data types.
     template <typename T>
     void writeKV (const String& name, T value);
 
-    // Write a key and array value.
+    // Add a key and array value.
     template <typename T>
     void writeKV (const String& name, const Array<T>& value);
 
-    // Write a key and valueholder.
+    // Add a key and valueholder.
     void writeKV (const String& name, const ValueHolder& vh);
 
-    // Put a Record which is written as a {} structure.
+    // Add a scalar value to the buffer as done by the put functions.
+    // Integer values are formatted directly; values of other types
+    // are formatted using operator<<.
+    // <group>
+    template <typename T> void addValue (T value);
+    template <typename T> void addValue (T value, std::true_type isInteger);
+    template <typename T> void addValue (T value, std::false_type isInteger);
+    void addValue (Bool value);
+    void addValue (Float value);
+    void addValue (Double value);
+    void addValue (const Complex& value);
+    void addValue (const DComplex& value);
+    void addValue (const char* value);
+    void addValue (const String& value);
+    // </group>
+
+    // Add a Record which is written as a {} structure.
     // The Record can be nested.
-    void put (const Record&);
+    void addValue (const Record&);
+
+    // Add an array as done by putArray.
+    template <typename T>
+    void addArray (const Array<T>& value, const String& indent,
+                   Bool firstLine, Bool valueEndl);
+
+    // Append a string with escaped special characters to out.
+    static void addEscaped (std::string& out, const char* in, size_t size);
+
+    // Add a formatted floating point value. A decimal point is added
+    // if needed to make clear it is not an integer.
+    void addReal (const char* format, double value);
 
     // Get the indentation after a name.
     // It indents with the length of the name (including quotes and colon)
@@ -233,6 +273,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     String        itsCommentStart;
     String        itsCommentEnd;
     vector<Bool>  itsFirstName;
+    std::string   itsBuffer;
   };
 
 
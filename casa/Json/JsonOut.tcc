@@ -29,6 +29,8 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Containers/Record.h>
+#include <sstream>
+#include <stdio.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -36,28 +38,63 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   inline void JsonOut::write (const String& name, T value,
                               const String& comment)
   {
-    writeComment (comment);
+    addComment (comment);
     putName (name);
     writeKV (name, value);
-    itsStream << endl;
+    itsBuffer += '\n';
+    flushBuffer();
   }
 
   template <typename T>
   inline void JsonOut::writeKV (const String&, T value)
   {
-    put (value);
+    addValue (value);
   }
 
   template <typename T>
   inline void JsonOut::writeKV (const String& name, const Array<T>& value)
   {
     // Use extra indentation for possible continuation lines.
-    putArray (value, indentValue(itsIndent, name), True);
+    addArray (value, indentValue(itsIndent, name), True,
+              std::is_same<T,String>::value);
   }
 
   template <typename T>
   inline void JsonOut::put (T value)
-    { itsStream << value; }
+  {
+    addValue (value);
+    flushBuffer();
+  }
+
+  template <typename T>
+  inline void JsonOut::addValue (T value)
+  {
+    // Characters are written as such by operator<<, so not as integers.
+    addValue (value, std::integral_constant<bool,
+              (std::is_integral<T>::value  &&  sizeof(T) > 1)>());
+  }
+
+  template <typename T>
+  inline void JsonOut::addValue (T value, std::true_type)
+  {
+    char buf[24];
+    int n;
+    if (std::is_signed<T>::value) {
+      n = snprintf (buf, sizeof(buf), "%lld", static_cast<long long>(value));
+    } else {
+      n = snprintf (buf, sizeof(buf), "%llu",
+                    static_cast<unsigned long long>(value));
+    }
+    itsBuffer.append (buf, n);
+  }
+
+  template <typename T>
+  inline void JsonOut::addValue (T value, std::false_type)
+  {
+    std::ostringstream oss;
+    oss << value;
+    itsBuffer += oss.str();
+  }
 
   template <typename T>
   inline void JsonOut::putArray (const Array<T>& arr,
@@ -75,8 +112,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void JsonOut::putArray (const Array<T>& arr, const String& indent,
                           Bool firstLine, Bool valueEndl)
   {
-    if (!firstLine) itsStream << indent;
-    itsStream << '[';
+    addArray (arr, indent, firstLine, valueEndl);
+    flushBuffer();
+  }
+
+  template <typename T>
+  void JsonOut::addArray (const Array<T>& arr, const String& indent,
+                          Bool firstLine, Bool valueEndl)
+  {
+    if (!firstLine) itsBuffer += indent;
+    itsBuffer += '[';
     Bool first = True;
     if (arr.ndim() <= 1) {
       size_t todo = arr.size();
@@ -86,28 +131,29 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         if (first) {
           first = False;
         } else if (!valueEndl) {
-          itsStream << ", ";
+          itsBuffer += ", ";
         } else {
-          itsStream << indent << ' ';
+          itsBuffer += indent;
+          itsBuffer += ' ';
         }
-        put (*iter);
+        addValue (*iter);
         todo--;
         if (valueEndl  &&  todo > 0) {
-          itsStream << ',' << endl;
+          itsBuffer += ",\n";
         }
       }
     } else {
       ArrayIterator<T> iter(arr, IPosition(1, arr.ndim()-1), False);
       while (! iter.pastEnd()) {
         if (!first) {
-          itsStream << ',' << endl;
+          itsBuffer += ",\n";
         }
-        putArray (iter.array(), indent+' ', first);
+        addArray (iter.array(), indent+' ', first, valueEndl);
         first = False;
         iter.next();
       }
     }
-    itsStream << ']';
+    itsBuffer += ']';
   }
 
 
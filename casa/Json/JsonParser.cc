@@ -27,102 +27,321 @@
 #include <casacore/casa/Json/JsonParser.h>
 #include <casacore/casa/Json/JsonError.h>
 #include <casacore/casa/BasicSL/Complex.h>
-#include <iostream>
-#include <sstream>
 #include <fstream>
-#include <stdio.h>
-
-//# stdlib.h is needed for bison 1.28 and needs to be included here
-//# (before the flex/bison files).
-//# Bison defines WHERE, which is also defined in LogOrigin.h (which
-//# is included in auto-template mode).
-//# So undefine WHERE first.
-#undef WHERE
-#include <casacore/casa/stdlib.h>
-
-//# Let clang and gcc ignore some warnings in bison/flex code.
-//# Undef YY_NULL because flex can redefine it slightly differently (giving a warning).
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wpragmas"
-#pragma GCC diagnostic ignored "-Wdeprecated-register"
-#pragma GCC diagnostic ignored "-Wsign-compare"
-
-#include "JsonGram.ycc"                  // bison output
-#ifdef YY_NULL
-# undef YY_NULL
-#endif
-#include "JsonGram.lcc"                  // flex output
-#pragma GCC diagnostic pop
-
-
-//# Define extern symbols in JsonGram.cc.
-//extern int yy_start;
-extern char* JsonGramtext;
-extern FILE* JsonGramin;
-extern int JsonGramparse();
-extern void JsonGramrestart(FILE*);
+#include <sstream>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
 
 namespace casacore {
 
-  // Initialize statics.
-  int JsonParser::theirPosition = 0;
-  const char* JsonParser::theirCommand = 0;
-  JsonKVMap* JsonParser::theirJsonMap = 0;
-
-
   JsonKVMap JsonParser::parseFile (const String& fileName)
   {
-    String command;
-    char buf[4096];
-    std::ifstream ifs(fileName.c_str());
+    std::ifstream ifs(fileName.c_str(), std::ios::in | std::ios::binary);
     if (!ifs) {
       throw JsonError("Json file " + fileName + " could not be opened");
     }
-    while (ifs.getline(buf, sizeof(buf))) {
-      command += buf;
-      command += '\n';
-    }
-    return parse(command);
+    // Read the entire file in one go.
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    return parse (oss.str());
   }
 
   JsonKVMap JsonParser::parse (const String& command)
   {
-    // Return an empty map if the command is empty.
-    Bool empty = true;
-    for (size_t i=0; i<command.size(); i++) {
-      if (command[i] != ' ') {
-        empty = false;
+    JsonParser parser (command.c_str(), command.size());
+    // An empty command (or only comments) gives an empty map.
+    parser.skipWhite();
+    if (parser.itsPos == parser.itsEnd) {
+      return JsonKVMap();
+    }
+    if (*parser.itsPos != '{') {
+      parser.error ("expected {");
+    }
+    parser.itsPos++;
+    JsonKVMap map (parser.parseKeyValues());
+    parser.skipWhite();
+    if (parser.itsPos != parser.itsEnd) {
+      parser.error ("unexpected text after the final }");
+    }
+    return map;
+  }
+
+  JsonParser::JsonParser (const char* text, size_t size)
+    : itsBegin (text),
+      itsPos   (text),
+      itsEnd   (text + size)
+  {}
+
+  const char* JsonParser::whiteEnd (const char* ptr) const
+  {
+    while (ptr < itsEnd  &&  (*ptr == ' '  ||  *ptr == '\n'  ||
+                              *ptr == '\t'  ||  *ptr == '\r'  ||
+                              *ptr == '\f')) {
+      ++ptr;
+    }
+    return ptr;
+  }
+
+  void JsonParser::skipWhite()
+  {
+    while (True) {
+      itsPos = whiteEnd (itsPos);
+      if (itsPos == itsEnd) {
+        return;
+      }
+      if (*itsPos == '#'  ||
+          (*itsPos == '/'  &&  itsPos[1] == '/')) {
+        // Comment till end-of-line.
+        const void* eol = memchr (itsPos, '\n', itsEnd - itsPos);
+        itsPos = (eol == 0  ?  itsEnd : static_cast<const char*>(eol) + 1);
+      } else if (*itsPos == '/'  &&  itsPos[1] == '*') {
+        // Comment till */
+        const char* ptr = itsPos + 2;
+        while (ptr < itsEnd  &&  !(ptr[0] == '*'  &&  ptr[1] == '/')) {
+          ++ptr;
+        }
+        if (ptr == itsEnd) {
+          error ("unterminated comment");
+        }
+        itsPos = ptr + 2;
+      } else {
+        return;
+      }
+    }
+  }
+
+  JsonKVMap JsonParser::parseKeyValues()
+  {
+    JsonKVMap map;
+    skipWhite();
+    if (itsPos < itsEnd  &&  *itsPos == '}') {
+      itsPos++;
+      return map;
+    }
+    while (True) {
+      skipWhite();
+      if (itsPos == itsEnd  ||  *itsPos != '"') {
+        error ("expected a key");
+      }
+      String key (parseString());
+      skipWhite();
+      if (itsPos == itsEnd  ||  *itsPos != ':') {
+        error ("expected :");
+      }
+      itsPos++;
+      // A later value of the same key replaces the earlier one.
+      map[std::move(key)] = parseValue();
+      skipWhite();
+      if (itsPos < itsEnd) {
+        if (*itsPos == '}') {
+          itsPos++;
+          return map;
+        }
+        if (*itsPos == ',') {
+          itsPos++;
+          continue;
+        }
+      }
+      error ("expected , or }");
+    }
+  }
+
+  std::vector<JsonValue> JsonParser::parseVector()
+  {
+    std::vector<JsonValue> vec;
+    skipWhite();
+    if (itsPos < itsEnd  &&  *itsPos == ']') {
+      itsPos++;
+      return vec;
+    }
+    while (True) {
+      vec.push_back (parseValue());
+      skipWhite();
+      if (itsPos < itsEnd) {
+        if (*itsPos == ']') {
+          itsPos++;
+          return vec;
+        }
+        if (*itsPos == ',') {
+          itsPos++;
+          continue;
+        }
+      }
+      error ("expected , or ]");
+    }
+  }
+
+  JsonValue JsonParser::parseValue()
+  {
+    skipWhite();
+    if (itsPos < itsEnd) {
+      switch (*itsPos) {
+      case '"':
+        return JsonValue (parseString());
+      case '[':
+        itsPos++;
+        return JsonValue (parseVector());
+      case '{':
+        {
+          DComplex value;
+          if (parseComplex (value)) {
+            return JsonValue (value);
+          }
+          itsPos++;
+          return JsonValue (parseKeyValues());
+        }
+      case 't':
+        if (itsEnd - itsPos >= 4  &&  strncmp (itsPos, "true", 4) == 0) {
+          itsPos += 4;
+          return JsonValue (True);
+        }
+        break;
+      case 'f':
+        if (itsEnd - itsPos >= 5  &&  strncmp (itsPos, "false", 5) == 0) {
+          itsPos += 5;
+          return JsonValue (False);
+        }
         break;
+      case 'n':
+        if (itsEnd - itsPos >= 4  &&  strncmp (itsPos, "null", 4) == 0) {
+          itsPos += 4;
+          return JsonValue();
+        }
+        break;
+      default:
+        if (*itsPos == '-'  ||  (*itsPos >= '0'  &&  *itsPos <= '9')) {
+          return parseNumber();
+        }
       }
     }
-    if (empty) {
-      return JsonKVMap();
+    error ("expected a value");
+    return JsonValue();
+  }
+
+  String JsonParser::parseString()
+  {
+    // Find the closing quote. Strings cannot contain a newline.
+    const char* start = itsPos + 1;
+    const char* ptr   = start;
+    Bool escaped = False;
+    while (ptr < itsEnd  &&  *ptr != '"'  &&  *ptr != '\n') {
+      if (*ptr == '\\') {
+        // Skip the escaped character (which cannot be a newline).
+        escaped = True;
+        if (ptr+1 == itsEnd  ||  ptr[1] == '\n') {
+          break;
+        }
+        ++ptr;
+      }
+      ++ptr;
     }
-    //# Parse the command.
-    //# Do a yyrestart(yyin) first to make the flex scanner reentrant.
-    JsonGramrestart (JsonGramin);
-    yy_start = 1;
-    theirCommand = command.c_str();     // get pointer to command string
-    theirPosition = 0;                  // initialize string position
-    delete theirJsonMap;
-    theirJsonMap = 0;
-    JsonGramparse();                    // parse command string
-    JsonKVMap map(*theirJsonMap);
-    delete theirJsonMap;
-    theirJsonMap = 0;
-    return map;
+    if (ptr >= itsEnd  ||  *ptr != '"') {
+      error ("unterminated string");
+    }
+    itsPos = ptr + 1;
+    if (escaped) {
+      return removeEscapes (String(start, ptr - start));
+    }
+    return String(start, ptr - start);
   }
 
-  int JsonParser::input (char* buf, int max_size)
+  const char* JsonParser::numberEnd (const char* ptr, Bool& isInt) const
   {
-    int nr=0;
-    while (*theirCommand != 0) {
-      if (nr >= max_size) {
-        break;                         // get max. max_size char.
+    // Json is very strict on number representation; see json.org
+    const char* start = ptr;
+    isInt = True;
+    if (ptr < itsEnd  &&  *ptr == '-') {
+      ++ptr;
+    }
+    if (ptr == itsEnd  ||  *ptr < '0'  ||  *ptr > '9') {
+      return start;
+    }
+    if (*ptr == '0') {
+      ++ptr;
+    } else {
+      while (ptr < itsEnd  &&  *ptr >= '0'  &&  *ptr <= '9') ++ptr;
+    }
+    // A fraction or exponent without digits is not part of the number.
+    if (ptr+1 < itsEnd  &&  *ptr == '.'  &&  ptr[1] >= '0'  &&  ptr[1] <= '9') {
+      isInt = False;
+      ptr += 2;
+      while (ptr < itsEnd  &&  *ptr >= '0'  &&  *ptr <= '9') ++ptr;
+    }
+    if (ptr < itsEnd  &&  (*ptr == 'e'  ||  *ptr == 'E')) {
+      const char* exp = ptr + 1;
+      if (exp < itsEnd  &&  (*exp == '+'  ||  *exp == '-')) ++exp;
+      if (exp < itsEnd  &&  *exp >= '0'  &&  *exp <= '9') {
+        isInt = False;
+        ptr = exp;
+        while (ptr < itsEnd  &&  *ptr >= '0'  &&  *ptr <= '9') ++ptr;
       }
-      buf[nr++] = *theirCommand++;
     }
-    return nr;
+    return ptr;
+  }
+
+  JsonValue JsonParser::parseNumber()
+  {
+    Bool isInt;
+    const char* end = numberEnd (itsPos, isInt);
+    if (end == itsPos) {
+      error ("invalid number");
+    }
+    // Copy the number to make sure strtod only sees the Json number
+    // (it also accepts hexadecimal numbers).
+    std::string str (itsPos, end);
+    itsPos = end;
+    if (isInt) {
+      // Handle integers exceeding integer precision as doubles.
+      errno = 0;
+      Int64 ival = strtoll (str.c_str(), 0, 10);
+      if (errno != ERANGE) {
+        return JsonValue (ival);
+      }
+    }
+    return JsonValue (strtod (str.c_str(), 0));
+  }
+
+  Bool JsonParser::parseComplex (DComplex& value)
+  {
+    // Match {"r":real,"i":imag} where only whitespace can be used.
+    Bool isInt;
+    const char* ptr = whiteEnd (itsPos + 1);
+    double parts[2];
+    for (int i=0; i<2; ++i) {
+      if (i == 1) {
+        if (ptr == itsEnd  ||  *ptr != ',') return False;
+        ptr = whiteEnd (ptr + 1);
+      }
+      if (itsEnd - ptr < 3  ||  ptr[0] != '"'  ||
+          ptr[1] != (i == 0 ? 'r' : 'i')  ||  ptr[2] != '"') {
+        return False;
+      }
+      ptr = whiteEnd (ptr + 3);
+      if (ptr == itsEnd  ||  *ptr != ':') return False;
+      ptr = whiteEnd (ptr + 1);
+      const char* end = numberEnd (ptr, isInt);
+      if (end == ptr) return False;
+      parts[i] = strtod (std::string(ptr, end).c_str(), 0);
+      ptr = whiteEnd (end);
+    }
+    if (ptr == itsEnd  ||  *ptr != '}') return False;
+    itsPos = ptr + 1;
+    value = DComplex(parts[0], parts[1]);
+    return True;
+  }
+
+  void JsonParser::error (const String& msg) const
+  {
+    // Show the text till the end of the line (at most 20 characters).
+    const char* end = itsPos;
+    while (end < itsEnd  &&  end < itsPos + 20  &&  *end != '\n') {
+      ++end;
+    }
+    std::ostringstream os;
+    os << "Json parse error at position " << itsPos - itsBegin
+       << ": " << msg << " (at or near '" << String(itsPos, end) << "')";
+    throw JsonError (os.str());
   }
 
   String JsonParser::removeEscapes (const String& in)
@@ -181,22 +400,4 @@ namespace casacore {
   }
 
 
-  void JsonGramerror (const char*)
-  {
-    std::ostringstream os2;
-    os2 << JsonParser::position();
-    String s2(os2.str());
-    throw JsonError("Json parse error at position "
-                    + s2 + " (at or near '" +
-                    String(JsonGramtext) + "')");
-  }
-
 } // end namespace
-
-
-// Define the yywrap function for flex.
-// Note it is not declared in the .h file, but by flex.
-int JsonGramwrap()
-{
-    return 1;
-}
@@ -28,17 +28,15 @@
 
 //# Includes
 #include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/Exceptions/Error.h>
-
-extern "C" {
-  int JsonGramwrap();        // yywrap
-}
+#include <vector>
 
 namespace casacore {
 
   //# Forward Declarations
   class JsonValue;
-  class JSonKVMap;
+  class JsonKVMap;
   
   // <summary>
   // Class for parsing Json-style key:value lines.
@@ -63,6 +61,12 @@ namespace casacore {
   // and values (scalars, arrays and structs, possibly nested in any way).
   // The values in the map are stored as JsonValue objects, which have functions to
   // get the value with the proper type.
+  //
+  // The parser is a hand-written recursive descent parser working directly
+  // on the characters of the text. Values are moved into their parent
+  // vector or map (instead of being copied) and a string value without
+  // escape characters is copied only once. A / * comment can span
+  // multiple lines.
   // </synopsis>
 
   // <example>
@@ -99,30 +103,55 @@ namespace casacore {
     // or be enclosed in / * and * /.
     static JsonKVMap parseFile (const String& fileName);
       
-    // Give the next chunk of input for the scanner.
-    static int input (char* buf, int max_size);
-      
-    // Give the current position (for read or update).
-    static int& position()
-      { return theirPosition; }
-      
     // Remove all possible escape characters and convert as needed (including <src>\uxxxx</src>).
     static String removeEscapes (const String& in);
       
-    // Let the parser set the final KeyValueMap.
-    static void setMap (JsonKVMap* map)
-      { theirJsonMap = map; }
-      
   private:
-    static int theirPosition;
-    static const char* theirCommand;
-    static JsonKVMap* theirJsonMap;
+    // Construct the parser for the given text, which must be followed
+    // by a null character.
+    JsonParser (const char* text, size_t size);
+
+    // Skip whitespace and comments.
+    void skipWhite();
+
+    // Parse the key:value pairs of a struct till the closing brace.
+    // The opening brace has already been read.
+    JsonKVMap parseKeyValues();
+
+    // Parse a value (a scalar, complex, vector or nested struct).
+    JsonValue parseValue();
+
+    // Parse the values of a vector till the closing bracket.
+    // The opening bracket has already been read.
+    std::vector<JsonValue> parseVector();
+
+    // Parse a string value and remove the quotes and escape characters.
+    String parseString();
+
+    // Parse an integer or floating point number.
+    JsonValue parseNumber();
+
+    // Parse a complex value written as a struct with fields "r" and "i"
+    // (only whitespace can be used in between). It returns False if the
+    // next characters do not form a complex value.
+    Bool parseComplex (DComplex& value);
+
+    // Get the end of the number starting at ptr. It returns ptr if not
+    // a valid number. isInt tells if the number is an integer.
+    const char* numberEnd (const char* ptr, Bool& isInt) const;
+
+    // Skip the whitespace starting at ptr.
+    const char* whiteEnd (const char* ptr) const;
+
+    // Throw a JsonError telling the position of the error.
+    void error (const String& msg) const;
+
+    //# Data members.
+    const char* itsBegin;
+    const char* itsPos;
+    const char* itsEnd;
   };
   
-  // The global yyerror function for the parser.
-  // It throws an exception with the current token.
-  void JsonGramerror (const char*);
-  
   // </group>
 
 } // end namespace
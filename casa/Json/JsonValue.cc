@@ -75,16 +75,31 @@ namespace casacore {
     itsValuePtr (new String(value))
   {}
 
+  JsonValue::JsonValue (String&& value)
+  : itsDataType (TpString),
+    itsValuePtr (new String(std::move(value)))
+  {}
+
   JsonValue::JsonValue (const vector<JsonValue>& value)
   : itsDataType (TpOther),
     itsValuePtr (new vector<JsonValue>(value))
   {}
 
+  JsonValue::JsonValue (vector<JsonValue>&& value)
+  : itsDataType (TpOther),
+    itsValuePtr (new vector<JsonValue>(std::move(value)))
+  {}
+
   JsonValue::JsonValue (const JsonKVMap& value)
   : itsDataType (TpRecord),
     itsValuePtr (new JsonKVMap(value))
   {}
 
+  JsonValue::JsonValue (JsonKVMap&& value)
+  : itsDataType (TpRecord),
+    itsValuePtr (new JsonKVMap(std::move(value)))
+  {}
+
   JsonValue::JsonValue (const JsonValue& that)
   : itsValuePtr (0)
   {
@@ -100,6 +115,26 @@ namespace casacore {
     return *this;
   }
 
+  JsonValue::JsonValue (JsonValue&& that) noexcept
+  : itsDataType (that.itsDataType),
+    itsValuePtr (that.itsValuePtr)
+  {
+    that.itsDataType = TpNumberOfTypes;
+    that.itsValuePtr = 0;
+  }
+
+  JsonValue& JsonValue::operator= (JsonValue&& that) noexcept
+  {
+    if (this != &that) {
+      clear();
+      itsDataType = that.itsDataType;
+      itsValuePtr = that.itsValuePtr;
+      that.itsDataType = TpNumberOfTypes;
+      that.itsValuePtr = 0;
+    }
+    return *this;
+  }
+
   JsonValue::~JsonValue()
   {
     clear();
@@ -101,8 +101,11 @@ namespace casacore {
     JsonValue (const DComplex&);
     JsonValue (const char*);
     JsonValue (const String&);
+    JsonValue (String&&);
     JsonValue (const std::vector<JsonValue>&);
+    JsonValue (std::vector<JsonValue>&&);
     JsonValue (const JsonKVMap&);
+    JsonValue (JsonKVMap&&);
     // </group>
       
     // Copy constructor (copy semantics).
@@ -110,6 +113,12 @@ namespace casacore {
       
     // Assignment (copy semantics).
     JsonValue& operator= (const JsonValue&);
+
+    // Move constructor and assignment. The moved-from object is null.
+    // <group>
+    JsonValue (JsonValue&&) noexcept;
+    JsonValue& operator= (JsonValue&&) noexcept;
+    // </group>
       
     ~JsonValue();
 
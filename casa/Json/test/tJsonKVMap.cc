@@ -26,12 +26,16 @@
 #include <casacore/casa/Json/JsonKVMap.h>
 #include <casacore/casa/Json/JsonParser.h>
 #include <casacore/casa/Json/JsonOut.h>
+#include <casacore/casa/Json/JsonError.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/BasicMath/Math.h>
 #include <iostream>
+#include <sstream>
+#include <limits>
 #include <cstdlib>
 
 using namespace casacore;
@@ -153,11 +157,82 @@ void doItParse()
   }
 }
 
+void checkError (const String& command)
+{
+  Bool failed = False;
+  try {
+    JsonParser::parse (command);
+  } catch (const JsonError& x) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+void doItParse2()
+{
+  // Test some special cases of the parser.
+  JsonKVMap map = JsonParser::parse
+    ("/* multi-line\n comment */ {\"e\":[], \"n\":[[],[]], \"k\":1, \"k\":2,"
+     " \"big\":123456789012345678901234567890, \"neg\":-9223372036854775808,"
+     " \"esc\":\"a\\tb\\u0041\\\\\", \"c\":{\"r\":1, \"i\":-2e1},"
+     " \"nc\":{\"r\":1, \"i\":true}} // end");
+  AlwaysAssertExit (map.size() == 8);
+  AlwaysAssertExit (map["e"].isVector()  &&  map["e"].size() == 0);
+  AlwaysAssertExit (map["n"].size() == 2);
+  AlwaysAssertExit (map["k"].getInt() == 2);
+  AlwaysAssertExit (map["big"].dataType() == TpDouble);
+  AlwaysAssertExit (near (map["big"].getDouble(), 1.2345678901234568e29));
+  AlwaysAssertExit (map["neg"].getInt() == std::numeric_limits<Int64>::min());
+  AlwaysAssertExit (map["esc"].getString() == "a\tbA\\");
+  AlwaysAssertExit (map["c"].getDComplex() == DComplex(1,-20));
+  AlwaysAssertExit (map["nc"].isValueMap());
+  AlwaysAssertExit (JsonParser::parse("  \n# comment only\n").empty());
+  AlwaysAssertExit (JsonParser::parse("{}").empty());
+  checkError ("[1]");
+  checkError ("{\"a\":1,}");
+  checkError ("{\"a\":01}");
+  checkError ("{\"a\":1.}");
+  checkError ("{\"a\":\"abc\n\"}");
+  checkError ("{\"a\":tru}");
+  checkError ("{\"a\":1} x");
+  checkError ("{\"a\":1 /* unterminated }");
+  // Check that JsonOut output can be read back.
+  Record rec;
+  rec.define ("i", Int(-3));
+  rec.define ("d", 1e-300);
+  rec.define ("s", String("x\"y\n") + char(2));
+  Vector<Float> vec(24);
+  indgen (vec);
+  rec.define ("vec", vec);
+  rec.define ("emptyarr", Vector<Int>());
+  Record subrec;
+  subrec.define ("c", Complex(1,2));
+  rec.defineRecord ("sub", subrec);
+  std::ostringstream oss;
+  {
+    JsonOut jout(oss);
+    jout.start ("//");
+    jout.write ("rec", rec, "a record");
+    jout.end();
+  }
+  JsonKVMap jmap = JsonParser::parse (oss.str());
+  Record rec2 = jmap.get("rec").getValueMap().toRecord();
+  AlwaysAssertExit (rec2.asInt64("i") == -3);
+  AlwaysAssertExit (rec2.asDouble("d") == 1e-300);
+  AlwaysAssertExit (rec2.asString("s") == rec.asString("s"));
+  Vector<Double> dvec(24);
+  indgen (dvec);
+  AlwaysAssertExit (allEQ (rec2.toArrayDouble("vec"), Array<Double>(dvec)));
+  AlwaysAssertExit (rec2.shape("emptyarr").product() == 0);
+  AlwaysAssertExit (rec2.subRecord("sub").asDComplex("c") == DComplex(1,2));
+}
+
 int main()
 {
   try {
     doIt();
     doItParse();
+    doItParse2();
   } catch (...) {
     cout << "Unexpected exception" << endl;
     exit(1);
@@ -0,0 +1,246 @@
+//# AsyncLogSink.cc: Log sink writing messages in a background thread
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/Logging/AsyncLogSink.h>
+#include <chrono>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+String AsyncLogSink::localId()
+{
+  return String("AsyncLogSink");
+}
+
+String AsyncLogSink::id() const
+{
+  return String("AsyncLogSink");
+}
+
+AsyncLogSink::AsyncLogSink (const std::shared_ptr<LogSinkInterface>& sink,
+                            uInt bufferSize, Bool discardIfFull)
+  : LogSinkInterface (sink->filter()),
+    itsSink        (sink),
+    itsDiscard     (discardIfFull),
+    itsPushPos     (0),
+    itsPopPos      (0),
+    itsNrPosted    (0),
+    itsNrWritten   (0),
+    itsNrDiscarded (0),
+    itsSleeping    (False),
+    itsNrWaiting   (0),
+    itsStop        (False)
+{
+  uInt64 size = 2;
+  while (size < bufferSize) {
+    size *= 2;
+  }
+  itsMask = size - 1;
+  itsBuffer.reset (new Entry[size]);
+  // Entry i is free for the push at position i.
+  for (uInt64 i=0; i<size; ++i) {
+    itsBuffer[i].seqnr = i;
+  }
+  itsThread = std::thread (&AsyncLogSink::run, this);
+}
+
+AsyncLogSink::~AsyncLogSink()
+{
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsStop = True;
+  }
+  itsWorkCond.notify_all();
+  // The thread writes all outstanding messages before stopping.
+  itsThread.join();
+  itsSink->flush (False);
+}
+
+Bool AsyncLogSink::push (const LogMessage& message)
+{
+  // This is the enqueue of a bounded MPMC queue (D. Vyukov).
+  // An entry is free for position pos if its seqnr equals pos.
+  uInt64 pos = itsPushPos.load (std::memory_order_relaxed);
+  Entry* entry;
+  while (True) {
+    entry = &(itsBuffer[pos & itsMask]);
+    uInt64 seqnr = entry->seqnr.load (std::memory_order_acquire);
+    Int64 diff = Int64(seqnr) - Int64(pos);
+    if (diff == 0) {
+      if (itsPushPos.compare_exchange_weak (pos, pos+1,
+                                            std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return False;     // buffer is full
+    } else {
+      pos = itsPushPos.load (std::memory_order_relaxed);
+    }
+  }
+  entry->message = message;
+  // Tell the writer the entry is filled.
+  entry->seqnr.store (pos+1, std::memory_order_release);
+  return True;
+}
+
+Bool AsyncLogSink::hasMessage() const
+{
+  const Entry& entry = itsBuffer[itsPopPos & itsMask];
+  return entry.seqnr.load (std::memory_order_acquire) == itsPopPos+1;
+}
+
+Bool AsyncLogSink::postLocally (const LogMessage& message)
+{
+  if (! filter().pass (message)) {
+    return False;
+  }
+  while (! push (message)) {
+    if (itsDiscard) {
+      itsNrDiscarded++;
+      return False;
+    }
+    std::this_thread::yield();
+  }
+  itsNrPosted++;
+  // Wake up the writer if it is sleeping.
+  if (itsSleeping.load()) {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsWorkCond.notify_one();
+  }
+  return True;
+}
+
+void AsyncLogSink::run()
+{
+  while (True) {
+    if (hasMessage()) {
+      Entry& entry = itsBuffer[itsPopPos & itsMask];
+      // The message is formatted and written by the other sink.
+      try {
+        itsSink->postLocally (entry.message);
+      } catch (const std::exception&) {
+      }
+      // Free the entry for the push one round later.
+      entry.seqnr.store (itsPopPos + itsMask + 1, std::memory_order_release);
+      itsPopPos++;
+      itsNrWritten++;
+      if (itsNrWaiting.load() > 0) {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        itsDoneCond.notify_all();
+      }
+      continue;
+    }
+    // The buffer is empty, so wait for a new message.
+    std::unique_lock<std::mutex> lock(itsMutex);
+    itsSleeping = True;
+    itsDoneCond.notify_all();
+    if (itsStop  &&  !hasMessage()) {
+      break;
+    }
+    // The timeout is a safeguard; a poster notifies if it sees the writer
+    // sleeping.
+    itsWorkCond.wait_for (lock, std::chrono::milliseconds(100),
+                          [this] { return itsStop || hasMessage(); });
+    itsSleeping = False;
+  }
+}
+
+void AsyncLogSink::waitWritten() const
+{
+  uInt64 target = itsNrPosted.load();
+  if (itsNrWritten.load() >= target) {
+    return;
+  }
+  itsNrWaiting++;
+  std::unique_lock<std::mutex> lock(itsMutex);
+  itsDoneCond.wait (lock, [this, target] {
+      return itsNrWritten.load() >= target; });
+  itsNrWaiting--;
+}
+
+void AsyncLogSink::flush (Bool)
+{
+  waitWritten();
+  itsSink->flush (False);
+}
+
+uInt AsyncLogSink::nelements() const
+{
+  waitWritten();
+  return itsSink->nelements();
+}
+
+Double AsyncLogSink::getTime (uInt i) const
+{
+  waitWritten();
+  return itsSink->getTime (i);
+}
+
+String AsyncLogSink::getPriority (uInt i) const
+{
+  waitWritten();
+  return itsSink->getPriority (i);
+}
+
+String AsyncLogSink::getMessage (uInt i) const
+{
+  waitWritten();
+  return itsSink->getMessage (i);
+}
+
+String AsyncLogSink::getLocation (uInt i) const
+{
+  waitWritten();
+  return itsSink->getLocation (i);
+}
+
+String AsyncLogSink::getObjectID (uInt i) const
+{
+  waitWritten();
+  return itsSink->getObjectID (i);
+}
+
+void AsyncLogSink::writeLocally (Double time, const String& message,
+                                 const String& priority,
+                                 const String& location,
+                                 const String& objectID)
+{
+  waitWritten();
+  itsSink->writeLocally (time, message, priority, location, objectID);
+}
+
+void AsyncLogSink::clearLocally()
+{
+  waitWritten();
+  itsSink->clearLocally();
+}
+
+void AsyncLogSink::cerrToo (bool cerr2)
+{
+  itsSink->cerrToo (cerr2);
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,189 @@
+//# AsyncLogSink.h: Log sink writing messages in a background thread
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_ASYNCLOGSINK_H
+#define CASA_ASYNCLOGSINK_H
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Logging/LogSinkInterface.h>
+#include <casacore/casa/Logging/LogMessage.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Log sink writing messages in a background thread.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tAsyncLogSink" demos="">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=LogSinkInterface>LogSinkInterface</linkto>
+// </prerequisite>
+//
+// <synopsis>
+// AsyncLogSink passes the messages to another sink (e.g. a
+// <linkto class=StreamLogSink>StreamLogSink</linkto>) in a background
+// thread, so the threads posting messages do not have to wait for the
+// messages to be formatted and written, nor for each other.
+// <p>
+// A posted message passing the filter is copied into a ring buffer of
+// fixed size. Putting a message into the buffer is lock-free, so many
+// threads can post at the same time. The background thread takes the
+// messages from the buffer in order and posts them to the other sink.
+// If the buffer is full, the posting thread waits until there is room or,
+// if so defined, the message is discarded. The number of discarded
+// messages can be obtained.
+// <p>
+// Errors in the other sink are ignored by the background thread.
+// <src>flush</src> waits until all messages posted before have been
+// written. The functions accessing the messages of the other sink (like
+// <src>nelements</src>) also flush first.
+// <p>
+// The default global sink (writing to cerr) is made asynchronous if the
+// environment variable <src>CASACORE_ASYNC_LOGGING</src> is set to true.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   // Replace the global sink by an asynchronous one writing to cerr.
+//   LogSinkInterface* sink = new AsyncLogSink
+//     (std::make_shared<StreamLogSink>(LogMessage::NORMAL, &cerr));
+//   LogSink::globalSink (sink);
+// </srcblock>
+// </example>
+//
+// <motivation>
+// Verbose logging in multi-threaded code should not serialize the threads.
+// </motivation>
+
+class AsyncLogSink : public LogSinkInterface
+{
+public:
+  // Create the sink passing messages to the given sink. Its filter is
+  // copied and applied before the message is put into the buffer.
+  // The buffer size is rounded up to a power of 2.
+  // If <src>discardIfFull</src> is True, a message is thrown away if the
+  // buffer is full, otherwise the posting thread waits.
+  explicit AsyncLogSink (const std::shared_ptr<LogSinkInterface>& sink,
+                         uInt bufferSize = 4096,
+                         Bool discardIfFull = False);
+
+  // Copy constructor and assignment cannot be used.
+  AsyncLogSink (const AsyncLogSink&) = delete;
+  AsyncLogSink& operator= (const AsyncLogSink&) = delete;
+
+  // The destructor writes all outstanding messages and stops the thread.
+  ~AsyncLogSink();
+
+  // Put the message in the buffer if it passes the filter.
+  // It returns False if the message did not pass or was discarded.
+  virtual Bool postLocally (const LogMessage& message);
+
+  // Wait until all messages posted before have been written and flush
+  // the other sink.
+  virtual void flush (Bool global=True);
+
+  // Get the messages from the other sink (after flushing).
+  // <group>
+  virtual uInt nelements() const;
+  virtual Double getTime (uInt i) const;
+  virtual String getPriority (uInt i) const;
+  virtual String getMessage (uInt i) const;
+  virtual String getLocation (uInt i) const;
+  virtual String getObjectID (uInt i) const;
+  // </group>
+
+  // Write a message into the other sink (after flushing).
+  virtual void writeLocally (Double time, const String& message,
+			     const String& priority, const String& location,
+			     const String& objectID);
+
+  // Clear the other sink (after flushing).
+  virtual void clearLocally();
+
+  // Write to cerr too.
+  virtual void cerrToo (bool cerr2);
+
+  // Get the number of discarded messages.
+  uInt64 nDiscarded() const
+    { return itsNrDiscarded.load (std::memory_order_relaxed); }
+
+  // Get the other sink.
+  const std::shared_ptr<LogSinkInterface>& sink() const
+    { return itsSink; }
+
+  // Returns the id for this class...
+  static String localId();
+  // Returns the id of the LogSink in use...
+  virtual String id() const;
+
+private:
+  // An entry in the ring buffer. Its sequence number tells if the entry
+  // is free or filled (see push and pop).
+  struct Entry {
+    std::atomic<uInt64> seqnr;
+    LogMessage message;
+  };
+
+  // Try to put a message into the buffer. Returns False if full.
+  Bool push (const LogMessage& message);
+  // Is there a message to be written? Only used by the writer thread.
+  Bool hasMessage() const;
+  // Write the messages in the background thread.
+  void run();
+  // Wait until all messages posted before have been written.
+  void waitWritten() const;
+
+  //# Data members
+  std::shared_ptr<LogSinkInterface> itsSink;
+  std::unique_ptr<Entry[]>  itsBuffer;
+  uInt64                    itsMask;
+  Bool                      itsDiscard;
+  std::atomic<uInt64>       itsPushPos;
+  uInt64                    itsPopPos;       // only used by the writer
+  std::atomic<uInt64>       itsNrPosted;
+  std::atomic<uInt64>       itsNrWritten;
+  std::atomic<uInt64>       itsNrDiscarded;
+  std::atomic<Bool>         itsSleeping;
+  mutable std::atomic<uInt> itsNrWaiting;
+  Bool                      itsStop;
+  mutable std::mutex        itsMutex;
+  std::condition_variable   itsWorkCond;
+  mutable std::condition_variable itsDoneCond;
+  std::thread               itsThread;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -58,6 +58,11 @@ Bool LogFilter::pass (const LogMessage& message) const
   return message.priority() >= lowest_p;
 }
 
+Bool LogFilter::mayPass (LogMessage::Priority priority) const
+{
+  return priority >= lowest_p;
+}
+
 
 
 } //# NAMESPACE CASACORE - END
@@ -102,6 +102,9 @@ public:
   // Return True if <src>message</src> passes this filter.
   virtual Bool pass (const LogMessage& message) const;
 
+  // Return True if a message with the given priority passes this filter.
+  virtual Bool mayPass (LogMessage::Priority priority) const;
+
   // Return the lowest priority which will pass this filter.
   LogMessage::Priority lowestPriority() const;
 
@@ -31,5 +31,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 LogFilterInterface::~LogFilterInterface()
 {}
 
+Bool LogFilterInterface::mayPass (LogMessage::Priority) const
+{
+  return True;
+}
+
 } //# NAMESPACE CASACORE - END
 
@@ -97,6 +97,11 @@ public:
   // Return True if <src>message</src> passes this filter.
   virtual Bool pass (const LogMessage& message) const = 0;
 
+  // Return False if no message with the given priority can pass this
+  // filter. It makes it possible to avoid constructing a message that
+  // would be thrown away. The default implementation returns True.
+  virtual Bool mayPass (LogMessage::Priority priority) const;
+
 private:
   // Copy constructor and assignment cannot be used.
   // <group>
@@ -33,23 +33,24 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 LogIO::LogIO()
-    : sink_p(), text_p(0)
+    : sink_p(), text_p(0), hasText_p(False), ignore_p(False)
 {}
 
 LogIO::LogIO(LogSink &sink)
-    : sink_p(sink), text_p(0)
+    : sink_p(sink), text_p(0), hasText_p(False), ignore_p(False)
 {}
 
 LogIO::LogIO(const LogOrigin &OR)
-    : sink_p(), msg_p(OR), text_p(0)
+    : sink_p(), msg_p(OR), text_p(0), hasText_p(False), ignore_p(False)
 {}
 
 LogIO::LogIO(const LogOrigin &OR, LogSink &sink)
-    : sink_p(sink),  msg_p(OR), text_p(0)
+    : sink_p(sink),  msg_p(OR), text_p(0), hasText_p(False), ignore_p(False)
 {}
 
 LogIO::LogIO(const LogIO &other)
-    : sink_p(other.sink_p), msg_p(other.msg_p), text_p(0)
+    : sink_p(other.sink_p), msg_p(other.msg_p), text_p(0),
+      hasText_p(False), ignore_p(False)
 {}
 
 LogIO& LogIO::operator=(const LogIO &other)
@@ -64,9 +65,10 @@ LogIO& LogIO::operator=(const LogIO &other)
 
 LogIO::~LogIO()
 {
-    if (text_p) {
+    if (hasText_p) {
 	post();
     }
+    delete text_p;
     text_p = 0;
 }
 
@@ -77,47 +79,56 @@ void LogIO::post(LogMessage &amess)
 }
 void LogIO::post()
 {
-    if (text_p) {
-	msg_p.message(*text_p);
-	delete text_p;
-	text_p = 0;
+    if (hasText_p) {
+	takeText();
         sink_p.post(msg_p);
     }
     // Reset priority.
     msg_p.priority(LogMessage::NORMAL);
+    ignore_p = False;
 }
 
 void LogIO::postLocally()
 {
-    if (text_p) {
-	msg_p.message(*text_p);
-	delete text_p;
-	text_p = 0;
+    if (hasText_p) {
+	takeText();
         sink_p.postLocally(msg_p);
     }
     // Reset priority.
     msg_p.priority(LogMessage::NORMAL);
+    ignore_p = False;
+}
+
+void LogIO::takeText()
+{
+    // Keep the stream for the next message.
+    msg_p.message(text_p->str());
+    text_p->str(String());
+    text_p->clear();
+    hasText_p = False;
 }
 
 void LogIO::preparePostThenThrow (const AipsError& x)
 {
+    // An exception is always posted, so do not ignore its text.
+    ignore_p = False;
     if (! String(x.what()).empty()) {
         output() << "; " << x.what();
     }
-    if (text_p == 0) {
+    if (! hasText_p) {
 	output() << "Unknown error!";
     }
-    msg_p.message(*text_p);
+    takeText();
     // Reset priority before the post, because that'll make a copy and
     // thereafter throw an exception.
     msg_p.priority(LogMessage::NORMAL);
-    delete text_p;
-    text_p = 0;
 }
 
 void LogIO::priority(LogMessage::Priority which)
 {
     msg_p.priority(which);
+    // Text already given is kept, so only ignore text for a new message.
+    ignore_p = (!hasText_p  &&  !sink_p.mayPass(which));
 }
 
 LogMessage::Priority LogIO::priority()
@@ -137,10 +148,17 @@ void LogIO::origin(const LogOrigin &OR)
 
 ostream &LogIO::output()
 {
+    if (ignore_p) {
+        // A stream without buffer ignores all output.
+        // It is thread-local, because writing sets its state.
+        static thread_local std::ostream nullStream(0);
+        return nullStream;
+    }
     if (!text_p) {
 	text_p = new ostringstream;
 	AlwaysAssert(text_p != 0, AipsError);
     }
+    hasText_p = True;
     return *text_p;
 }
 
@@ -129,6 +129,14 @@ class LogOrigin;
 // message. The message does not get posted until the POST is done.
 // So in the above example the DEBUGGING priority does not do anything
 // because the priority is overwritten by the SEVERE one.
+// However, if the sinks do not accept DEBUGGING messages, the text
+// "Boring message" is not formatted at all (see below).
+//
+// Formatting the text of a message that will be thrown away can be
+// expensive. Therefore, if the priority is explicitly set to a level that
+// neither the local nor the global sink accepts, the text given before the
+// next post (or priority change) is ignored. <src>output()</src> then gives
+// a stream that ignores its input.
 //
 // You can also change the origin information with the << operator:
 // <srcblock>
@@ -247,9 +255,16 @@ private:
     // Prepare message stream for postThenThrow function.
     void preparePostThenThrow (const AipsError& x);
 
+    // Move the accumulated text to the message.
+    void takeText();
+
     LogSink sink_p;
     LogMessage msg_p;
     ostringstream *text_p;
+    // Has text been written to text_p since the last post?
+    Bool hasText_p;
+    // Is the text ignored because the priority cannot pass the sinks?
+    Bool ignore_p;
 
 };
 
@@ -30,6 +30,8 @@
 #include <casacore/casa/Logging/NullLogSink.h>
 #include <casacore/casa/Logging/MemoryLogSink.h>
 #include <casacore/casa/Logging/StreamLogSink.h>
+#include <casacore/casa/Logging/AsyncLogSink.h>
+#include <casacore/casa/OS/EnvVar.h>
 
 #include <casacore/casa/Utilities/Assert.h>
 
@@ -275,6 +277,14 @@ Bool LogSink::postLocally(const LogMessage &message)
     }
 }
 
+Bool LogSink::mayPass (LogMessage::Priority priority) const
+{
+    if (filter().mayPass(priority)  &&  local_sink_p->mayPass(priority)) {
+        return True;
+    }
+    return useGlobalSink_p  &&  (*global_sink_p)->mayPass(priority);
+}
+
 void LogSink::writeLocally (Double time, const String& message,
 			    const String& priority, const String& location,
 			    const String& objectID)
@@ -299,8 +309,14 @@ void LogSink::flush (Bool global)
 
 void LogSink::createGlobalSink()
 {
-    global_sink_p = std::make_shared<LsiIntermediate>
-      (new StreamLogSink(LogMessage::NORMAL, &cerr));
+    LogSinkInterface* sink = new StreamLogSink(LogMessage::NORMAL, &cerr);
+    // Aipsrc cannot be used here, because it might log itself.
+    String async (EnvironmentVariable::get ("CASACORE_ASYNC_LOGGING"));
+    async.downcase();
+    if (async == "true"  ||  async == "1"  ||  async == "yes") {
+        sink = new AsyncLogSink (std::shared_ptr<LogSinkInterface>(sink));
+    }
+    global_sink_p = std::make_shared<LsiIntermediate> (sink);
 }
 
 } //# NAMESPACE CASACORE - END
@@ -194,6 +194,10 @@ public:
   // if it passes the filter.
   virtual Bool postLocally (const LogMessage &message);
 
+  // Return False if a message with the given priority is rejected by both
+  // the local and the global sink, thus does not need to be constructed.
+  virtual Bool mayPass (LogMessage::Priority priority) const;
+
   // Post <src>message</src> and then throw an <src>AipsError</src> exception
   // containing <src>message.toString()</src>. It is always posted as a 
   // <src>SEVERE</src> priority message, no matter what 
@@ -110,6 +110,11 @@ LogSinkInterface &LogSinkInterface::filter(const LogFilterInterface &filter)
     return *this;
 }
 
+Bool LogSinkInterface::mayPass (LogMessage::Priority priority) const
+{
+    return filter().mayPass (priority);
+}
+
 void LogSinkInterface::flush(Bool)
 {
     // Defult implementation is to do nothing.
@@ -132,6 +132,10 @@ public:
   // <src>True</src>.
   virtual Bool postLocally(const LogMessage &message)= 0;
 
+  // Return False if a message with the given priority will certainly not
+  // be handled by this sink. By default it asks the filter.
+  virtual Bool mayPass (LogMessage::Priority priority) const;
+
   // Write any pending output.
   virtual void flush (Bool global=True);
 
@@ -78,6 +78,11 @@ Bool NullLogSink::postLocally(const LogMessage &message)
     return filter().pass(message);
 }
 
+Bool NullLogSink::mayPass (LogMessage::Priority) const
+{
+    return False;
+}
+
 
 } //# NAMESPACE CASACORE - END
 
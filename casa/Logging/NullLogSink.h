@@ -84,6 +84,9 @@ public:
     // the filter.
     virtual Bool postLocally(const LogMessage &message);
 
+    // No message is handled, so it always returns <src>False</src>.
+    virtual Bool mayPass (LogMessage::Priority priority) const;
+
     // Returns the id for this class...
     static String localId( );
     // Returns the id of the LogSink in use...
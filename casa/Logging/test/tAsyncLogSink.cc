@@ -0,0 +1,194 @@
+//# tAsyncLogSink.cc: Test program for class AsyncLogSink
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/Logging/AsyncLogSink.h>
+#include <casacore/casa/Logging/LogIO.h>
+#include <casacore/casa/Logging/LogSink.h>
+#include <casacore/casa/Logging/LogFilter.h>
+#include <casacore/casa/Logging/MemoryLogSink.h>
+#include <casacore/casa/Logging/NullLogSink.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// A sink waiting until it is allowed to handle messages.
+class SlowLogSink : public LogSinkInterface
+{
+public:
+  SlowLogSink() : itsGo(False), itsNr(0) {}
+  virtual Bool postLocally (const LogMessage&)
+  {
+    while (! itsGo) {
+      std::this_thread::yield();
+    }
+    itsNr++;
+    return True;
+  }
+  virtual String id() const { return "SlowLogSink"; }
+  std::atomic<Bool> itsGo;
+  std::atomic<Int>  itsNr;
+};
+
+// Count how often it is formatted. Like the standard inserters, it does
+// nothing if the stream is not good.
+struct Counter
+{
+  mutable Int itsNr = 0;
+};
+ostream& operator<< (ostream& os, const Counter& counter)
+{
+  if (os.good()) {
+    counter.itsNr++;
+    os << "counter";
+  }
+  return os;
+}
+
+void testThreads()
+{
+  std::shared_ptr<MemoryLogSink> memSink = std::make_shared<MemoryLogSink>();
+  AsyncLogSink sink(memSink, 16);
+  AlwaysAssertExit (sink.id() == "AsyncLogSink");
+  const Int nthread = 4;
+  const Int nmsg = 500;
+  std::vector<std::thread> threads;
+  for (Int i=0; i<nthread; ++i) {
+    threads.push_back (std::thread([&sink, i] {
+          for (Int j=0; j<nmsg; ++j) {
+            sink.postLocally (LogMessage(String::toString(i) + ' ' +
+                                         String::toString(j),
+                                         LogOrigin("tAsyncLogSink")));
+          }
+        }));
+  }
+  for (std::thread& thr : threads) {
+    thr.join();
+  }
+  AlwaysAssertExit (sink.nelements() == uInt(nthread*nmsg));
+  AlwaysAssertExit (sink.nDiscarded() == 0);
+  // The messages of a thread are in order.
+  std::vector<Int> last(nthread, -1);
+  for (uInt i=0; i<sink.nelements(); ++i) {
+    String msg = sink.getMessage(i);
+    Int thr = atoi (String(msg.before(' ')).c_str());
+    Int nr = atoi (String(msg.after(' ')).c_str());
+    AlwaysAssertExit (nr == last[thr] + 1);
+    last[thr] = nr;
+  }
+  // Messages not passing the filter are not posted.
+  sink.filter (LogFilter(LogMessage::WARN));
+  AlwaysAssertExit (! sink.postLocally (LogMessage("normal", LogOrigin("t"))));
+  AlwaysAssertExit (sink.postLocally (LogMessage("warn", LogOrigin("t"),
+                                                 LogMessage::WARN)));
+  AlwaysAssertExit (sink.nelements() == uInt(nthread*nmsg + 1));
+  sink.clearLocally();
+  AlwaysAssertExit (sink.nelements() == 0);
+}
+
+void testDiscard()
+{
+  std::shared_ptr<SlowLogSink> slowSink = std::make_shared<SlowLogSink>();
+  {
+    AsyncLogSink sink(slowSink, 4, True);
+    for (Int i=0; i<20; ++i) {
+      sink.postLocally (LogMessage("msg", LogOrigin("t")));
+    }
+    // The buffer has 4 entries and the writer can hold one message.
+    AlwaysAssertExit (sink.nDiscarded() >= 15);
+    slowSink->itsGo = True;
+    sink.flush();
+    AlwaysAssertExit (slowSink->itsNr + sink.nDiscarded() == 20);
+  }
+}
+
+void testLogIO()
+{
+  // Make the global sink a null sink.
+  LogSinkInterface* globalSink = new NullLogSink();
+  LogSink::globalSink (globalSink);
+  std::shared_ptr<MemoryLogSink> memSink = std::make_shared<MemoryLogSink>();
+  LogSink sink(LogFilter(LogMessage::WARN), memSink);
+  AlwaysAssertExit (! sink.mayPass (LogMessage::NORMAL));
+  AlwaysAssertExit (sink.mayPass (LogMessage::WARN));
+  LogIO os(sink);
+  Counter counter;
+  // Text is not formatted if the message cannot pass.
+  os << LogIO::DEBUG1 << "debug ";
+  os.output() << counter;
+  os << LogIO::POST;
+  AlwaysAssertExit (counter.itsNr == 0);
+  AlwaysAssertExit (memSink->nelements() == 0);
+  os << LogIO::WARN << "warn ";
+  os.output() << counter;
+  os << LogIO::POST;
+  AlwaysAssertExit (counter.itsNr == 1);
+  AlwaysAssertExit (memSink->nelements() == 1);
+  AlwaysAssertExit (memSink->getMessage(0) == "warn counter");
+  // Text given before lowering the priority is kept.
+  os << LogIO::WARN << "warn2 " << LogIO::NORMAL;
+  os.output() << counter;
+  os << LogIO::WARN << LogIO::POST;
+  AlwaysAssertExit (counter.itsNr == 2);
+  AlwaysAssertExit (memSink->getMessage(1) == "warn2 counter");
+  // The text of an exception is kept.
+  os << LogIO::SEVERE << "failure";
+  try {
+    os << LogIO::EXCEPTION;
+    AlwaysAssertExit (False);
+  } catch (const AipsError& x) {
+    AlwaysAssertExit (String(x.what()).find("failure") != String::npos);
+  }
+  // Use an asynchronous global sink.
+  globalSink = new AsyncLogSink (std::make_shared<MemoryLogSink>());
+  LogSink::globalSink (globalSink);
+  LogIO gos;
+  for (Int i=0; i<10; ++i) {
+    gos << "message " << i << LogIO::POST;
+  }
+  gos << LogIO::DEBUGGING << "debug ";
+  gos.output() << counter;
+  gos << LogIO::POST;
+  AlwaysAssertExit (counter.itsNr == 2);
+  AlwaysAssertExit (LogSink::globalSink().nelements() == 10);
+  AlwaysAssertExit (LogSink::globalSink().getMessage(9) == "message 9");
+}
+
+int main()
+{
+  try {
+    testThreads();
+    testDiscard();
+    testLogIO();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
@@ -0,0 +1,473 @@
+//# Benchmark.cc: Run benchmarks and report their results
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/OS/Benchmark.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/Utilities/Regex.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/version.h>
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+BenchmarkState::BenchmarkState()
+{
+  reset();
+}
+
+void BenchmarkState::reset()
+{
+  itsRunning    = False;
+  itsSkipped    = False;
+  itsIterations = 0;
+  itsBytes      = 0;
+  itsItems      = 0;
+  itsRealTime   = 0;
+  itsCpuTime    = 0;
+  itsLabel      = String();
+  itsSkipReason = String();
+  itsCounters.clear();
+}
+
+void BenchmarkState::startIteration()
+{
+  itsRunning = False;
+  resumeTiming();
+}
+
+void BenchmarkState::stopIteration()
+{
+  pauseTiming();
+  itsIterations++;
+}
+
+void BenchmarkState::pauseTiming()
+{
+  if (itsRunning) {
+    itsRealTime += std::chrono::duration<Double>
+      (std::chrono::steady_clock::now() - itsRealStart).count();
+    itsCpuTime  += cpuTime() - itsCpuStart;
+    itsRunning = False;
+  }
+}
+
+void BenchmarkState::resumeTiming()
+{
+  if (! itsRunning) {
+    itsRunning   = True;
+    itsCpuStart  = cpuTime();
+    itsRealStart = std::chrono::steady_clock::now();
+  }
+}
+
+Double BenchmarkState::cpuTime()
+{
+  // std::clock has a too coarse resolution for short iterations.
+#if defined(CLOCK_PROCESS_CPUTIME_ID)
+  struct timespec ts;
+  if (clock_gettime (CLOCK_PROCESS_CPUTIME_ID, &ts) == 0) {
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+  }
+#endif
+  return Double(std::clock()) / CLOCKS_PER_SEC;
+}
+
+void BenchmarkState::addCounter (const String& name, Double value)
+{
+  for (auto& counter : itsCounters) {
+    if (counter.first == name) {
+      counter.second += value;
+      return;
+    }
+  }
+  itsCounters.push_back (std::make_pair (name, value));
+}
+
+void BenchmarkState::skip (const String& reason)
+{
+  itsSkipped    = True;
+  itsSkipReason = reason;
+}
+
+
+Benchmark::Benchmark (int argc, const char* argv[])
+  : itsMinTime     (0.5),
+    itsRepetitions (1),
+    itsFormat      ("console"),
+    itsOutFormat   ("json"),
+    itsListOnly    (False)
+{
+  if (argc > 0) {
+    itsProgram = argv[0];
+  }
+  for (int i=1; i<argc; ++i) {
+    String arg(argv[i]);
+    String val;
+    Int inx = arg.index('=');
+    if (inx > 0) {
+      val = arg.after(inx);
+    }
+    if (arg.startsWith ("--benchmark_filter=")) {
+      itsFilter = val;
+    } else if (arg.startsWith ("--benchmark_min_time=")) {
+      itsMinTime = std::max (0., atof(val.chars()));
+    } else if (arg.startsWith ("--benchmark_repetitions=")) {
+      itsRepetitions = std::max (1, atoi(val.chars()));
+    } else if (arg.startsWith ("--benchmark_format=")) {
+      checkFormat (val);
+      itsFormat = val;
+    } else if (arg.startsWith ("--benchmark_out=")) {
+      itsOutName = val;
+    } else if (arg.startsWith ("--benchmark_out_format=")) {
+      checkFormat (val);
+      itsOutFormat = val;
+    } else if (arg == "--benchmark_list_tests") {
+      itsListOnly = True;
+    } else if (arg.startsWith ("--benchmark_")) {
+      throw AipsError ("Benchmark: unknown option " + arg);
+    } else {
+      itsArgs.push_back (arg);
+    }
+  }
+}
+
+void Benchmark::checkFormat (const String& format)
+{
+  if (format != "console"  &&  format != "json"  &&  format != "csv") {
+    throw AipsError ("Benchmark: unknown output format " + format +
+                     " (valid are console, json, csv)");
+  }
+}
+
+void Benchmark::add (const String& name, const Function& func)
+{
+  itsBench.push_back (std::make_pair (name, func));
+}
+
+int Benchmark::run()
+{
+  Regex filter (itsFilter.empty()  ?  String(".*") : itsFilter);
+  Bool allOK = True;
+  itsResults.clear();
+  for (const auto& bench : itsBench) {
+    if (! bench.first.contains (filter)) {
+      continue;
+    }
+    if (itsListOnly) {
+      std::cout << bench.first << std::endl;
+      continue;
+    }
+    if (! runOne (bench.first, bench.second)) {
+      allOK = False;
+    }
+  }
+  if (itsListOnly) {
+    return 0;
+  }
+  write (std::cout, itsFormat);
+  if (! itsOutName.empty()) {
+    std::ofstream ofs(itsOutName.chars());
+    if (! ofs) {
+      throw AipsError ("Benchmark: could not create output file " +
+                       itsOutName);
+    }
+    write (ofs, itsOutFormat);
+  }
+  return allOK ? 0 : 1;
+}
+
+Bool Benchmark::runOne (const String& name, const Function& func)
+{
+  BenchmarkState state;
+  for (uInt rep=0; rep<itsRepetitions; ++rep) {
+    state.reset();
+    try {
+      // Iterate until the minimum time has passed.
+      do {
+        state.startIteration();
+        func (state);
+        state.stopIteration();
+      } while (!state.itsSkipped  &&  state.itsRealTime < itsMinTime);
+    } catch (const std::exception& x) {
+      std::cerr << name << ": exception " << x.what() << std::endl;
+      return False;
+    }
+    if (state.itsSkipped) {
+      std::cerr << name << ": skipped (" << state.itsSkipReason << ')'
+                << std::endl;
+      return True;
+    }
+    Result res;
+    res.name       = name;
+    res.runName    = name;
+    res.repetition = rep;
+    res.label      = state.itsLabel;
+    res.iterations = state.itsIterations;
+    res.realTime   = 1e9 * state.itsRealTime / state.itsIterations;
+    res.cpuTime    = 1e9 * state.itsCpuTime / state.itsIterations;
+    res.bytesPerSecond = (state.itsRealTime > 0  ?
+                          state.itsBytes / state.itsRealTime : 0);
+    res.itemsPerSecond = (state.itsRealTime > 0  ?
+                          state.itsItems / state.itsRealTime : 0);
+    res.counters = state.itsCounters;
+    for (auto& counter : res.counters) {
+      counter.second /= state.itsIterations;
+    }
+    itsResults.push_back (res);
+  }
+  if (itsRepetitions > 1) {
+    addAggregates (itsRepetitions);
+  }
+  return True;
+}
+
+void Benchmark::addAggregates (uInt nrep)
+{
+  const std::vector<Result> reps (itsResults.end() - nrep, itsResults.end());
+  Result mean = reps[0];
+  mean.aggregate = "mean";
+  mean.repetition = -1;
+  mean.realTime = mean.cpuTime = mean.bytesPerSecond = mean.itemsPerSecond = 0;
+  for (auto& counter : mean.counters) {
+    counter.second = 0;
+  }
+  for (const Result& r : reps) {
+    mean.realTime       += r.realTime / nrep;
+    mean.cpuTime        += r.cpuTime / nrep;
+    mean.bytesPerSecond += r.bytesPerSecond / nrep;
+    mean.itemsPerSecond += r.itemsPerSecond / nrep;
+    // All repetitions add the same counters in the same order.
+    for (uInt j=0; j<std::min(mean.counters.size(), r.counters.size()); ++j) {
+      mean.counters[j].second += r.counters[j].second / nrep;
+    }
+  }
+  mean.name = mean.runName + "_mean";
+  // Take the median of each value separately.
+  Result median = mean;
+  median.aggregate = "median";
+  median.name = median.runName + "_median";
+  std::vector<Double> vals(nrep);
+  auto medianOf = [&vals, nrep](std::function<Double(const Result&)> get,
+                                const std::vector<Result>& rs) {
+    for (uInt i=0; i<nrep; ++i) vals[i] = get(rs[i]);
+    std::sort (vals.begin(), vals.end());
+    return (nrep%2 == 1  ?  vals[nrep/2] : (vals[nrep/2-1] + vals[nrep/2]) / 2);
+  };
+  median.realTime = medianOf ([](const Result& r) {return r.realTime;}, reps);
+  median.cpuTime  = medianOf ([](const Result& r) {return r.cpuTime;}, reps);
+  median.bytesPerSecond = medianOf
+    ([](const Result& r) {return r.bytesPerSecond;}, reps);
+  median.itemsPerSecond = medianOf
+    ([](const Result& r) {return r.itemsPerSecond;}, reps);
+  for (uInt j=0; j<median.counters.size(); ++j) {
+    median.counters[j].second = medianOf
+      ([j](const Result& r) {return j < r.counters.size() ?
+                                    r.counters[j].second : 0.;}, reps);
+  }
+  itsResults.push_back (mean);
+  itsResults.push_back (median);
+}
+
+void Benchmark::write (std::ostream& os, const String& format) const
+{
+  if (format == "json") {
+    writeJson (os);
+  } else if (format == "csv") {
+    writeCsv (os);
+  } else {
+    writeConsole (os);
+  }
+}
+
+namespace {
+  // Format a time (in nsec) with a suitable unit.
+  String formatTime (Double nsec)
+  {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(3);
+    if (nsec >= 1e9) {
+      oss << nsec/1e9 << " s";
+    } else if (nsec >= 1e6) {
+      oss << nsec/1e6 << " ms";
+    } else if (nsec >= 1e3) {
+      oss << nsec/1e3 << " us";
+    } else {
+      oss << nsec << " ns";
+    }
+    return oss.str();
+  }
+
+  // Format a rate with a suitable prefix (binary for bytes).
+  String formatRate (Double rate, const String& unit, Double base)
+  {
+    if (rate <= 0) {
+      return String();
+    }
+    const char* prefix[] = {"", "k", "M", "G", "T"};
+    uInt i = 0;
+    while (rate >= base  &&  i < 4) {
+      rate /= base;
+      ++i;
+    }
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2) << rate << ' '
+        << prefix[i] << unit << "/s";
+    return oss.str();
+  }
+
+  // Quote a string for JSON or CSV.
+  String quote (const String& str)
+  {
+    String res("\"");
+    for (char c : str) {
+      if (c == '"'  ||  c == '\\') {
+        res += '\\';
+      }
+      res += c;
+    }
+    return res + '"';
+  }
+}
+
+void Benchmark::writeConsole (std::ostream& os) const
+{
+  size_t nameWidth = 9;
+  for (const Result& r : itsResults) {
+    nameWidth = std::max (nameWidth, r.name.size());
+  }
+  os << std::left << std::setw(nameWidth) << "Benchmark" << std::right
+     << std::setw(15) << "Time" << std::setw(15) << "CPU"
+     << std::setw(12) << "Iterations" << "  Throughput" << std::endl;
+  os << String(nameWidth + 42 + 12, '-') << std::endl;
+  for (const Result& r : itsResults) {
+    os << std::left << std::setw(nameWidth) << r.name << std::right
+       << std::setw(15) << formatTime(r.realTime)
+       << std::setw(15) << formatTime(r.cpuTime)
+       << std::setw(12) << r.iterations;
+    String rate = formatRate (r.bytesPerSecond, "B", 1024);
+    String items = formatRate (r.itemsPerSecond, "", 1000);
+    if (! items.empty()) {
+      rate += (rate.empty() ? "" : "  ") + items;
+    }
+    os << "  " << rate;
+    for (const auto& counter : r.counters) {
+      os << "  " << counter.first << '=' << counter.second;
+    }
+    if (! r.label.empty()) {
+      os << "  " << r.label;
+    }
+    os << std::endl;
+  }
+}
+
+void Benchmark::writeJson (std::ostream& os) const
+{
+  char date[64];
+  std::time_t now = std::time(0);
+  std::strftime (date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z",
+                 std::localtime(&now));
+  os << "{" << std::endl;
+  os << "  \"context\": {" << std::endl;
+  os << "    \"date\": " << quote(date) << ',' << std::endl;
+  os << "    \"host_name\": " << quote(HostInfo::hostName()) << ',' << std::endl;
+  os << "    \"executable\": " << quote(itsProgram) << ',' << std::endl;
+  os << "    \"num_cpus\": " << HostInfo::numCPUs() << ',' << std::endl;
+  os << "    \"casacore_version\": " << quote(getVersion()) << ',' << std::endl;
+  os << "    \"library_build_type\": "
+#ifdef AIPS_DEBUG
+     << quote("debug")
+#else
+     << quote("release")
+#endif
+     << std::endl;
+  os << "  }," << std::endl;
+  os << "  \"benchmarks\": [";
+  os << std::setprecision(10);
+  for (uInt i=0; i<itsResults.size(); ++i) {
+    const Result& r = itsResults[i];
+    os << (i==0 ? "" : ",") << std::endl;
+    os << "    {" << std::endl;
+    os << "      \"name\": " << quote(r.name) << ',' << std::endl;
+    os << "      \"run_name\": " << quote(r.runName) << ',' << std::endl;
+    if (r.aggregate.empty()) {
+      os << "      \"run_type\": \"iteration\"," << std::endl;
+      os << "      \"repetitions\": " << itsRepetitions << ',' << std::endl;
+      os << "      \"repetition_index\": " << r.repetition << ',' << std::endl;
+    } else {
+      os << "      \"run_type\": \"aggregate\"," << std::endl;
+      os << "      \"repetitions\": " << itsRepetitions << ',' << std::endl;
+      os << "      \"aggregate_name\": " << quote(r.aggregate) << ','
+         << std::endl;
+    }
+    os << "      \"iterations\": " << r.iterations << ',' << std::endl;
+    os << "      \"real_time\": " << r.realTime << ',' << std::endl;
+    os << "      \"cpu_time\": " << r.cpuTime << ',' << std::endl;
+    os << "      \"time_unit\": \"ns\"";
+    if (r.bytesPerSecond > 0) {
+      os << ',' << std::endl << "      \"bytes_per_second\": "
+         << r.bytesPerSecond;
+    }
+    if (r.itemsPerSecond > 0) {
+      os << ',' << std::endl << "      \"items_per_second\": "
+         << r.itemsPerSecond;
+    }
+    if (! r.label.empty()) {
+      os << ',' << std::endl << "      \"label\": " << quote(r.label);
+    }
+    // User counters are written as extra fields (as Google Benchmark does).
+    for (const auto& counter : r.counters) {
+      os << ',' << std::endl << "      " << quote(counter.first) << ": "
+         << counter.second;
+    }
+    os << std::endl << "    }";
+  }
+  os << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
+
+void Benchmark::writeCsv (std::ostream& os) const
+{
+  // Use the same columns as Google Benchmark.
+  os << "name,iterations,real_time,cpu_time,time_unit,bytes_per_second,"
+        "items_per_second,label,error_occurred,error_message" << std::endl;
+  os << std::setprecision(10);
+  for (const Result& r : itsResults) {
+    os << quote(r.name) << ',' << r.iterations << ','
+       << r.realTime << ',' << r.cpuTime << ",ns,";
+    if (r.bytesPerSecond > 0) os << r.bytesPerSecond;
+    os << ',';
+    if (r.itemsPerSecond > 0) os << r.itemsPerSecond;
+    os << ',' << quote(r.label) << ",," << std::endl;
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,263 @@
+//# Benchmark.h: Run benchmarks and report their results
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_BENCHMARK_H
+#define CASA_BENCHMARK_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// State of a benchmark being run
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tBenchmark" demos="">
+// </reviewed>
+
+// <synopsis>
+// A BenchmarkState object is passed to the function of a benchmark.
+// Each call of the function is one iteration. The function can tell how
+// many bytes and items it processed, so throughput can be reported.
+// Work not to be measured (such as setup) can be excluded by pausing
+// the timing.
+// </synopsis>
+
+class BenchmarkState
+{
+public:
+  BenchmarkState();
+
+  // Stop or restart the timing in the current iteration.
+  // <group>
+  void pauseTiming();
+  void resumeTiming();
+  // </group>
+
+  // Add the number of bytes or items processed in the current iteration.
+  // <group>
+  void addBytes (uInt64 nbytes)
+    { itsBytes += nbytes; }
+  void addItems (uInt64 nitems)
+    { itsItems += nitems; }
+  // </group>
+
+  // Add a value to a user counter (e.g., the time spent in a phase).
+  // The counters are reported as the average per iteration.
+  void addCounter (const String& name, Double value);
+
+  // Set a label shown with the results (e.g., a data manager type).
+  void setLabel (const String& label)
+    { itsLabel = label; }
+
+  // Get the number of iterations done so far.
+  uInt64 iterations() const
+    { return itsIterations; }
+
+  // Tell that the benchmark cannot be run (e.g., a data manager that is
+  // not available). It should be called in the first iteration.
+  void skip (const String& reason);
+
+private:
+  friend class Benchmark;
+
+  // Get the CPU time used by the process (in seconds).
+  static Double cpuTime();
+
+  // Reset the state for a new run.
+  void reset();
+  // Start and stop an iteration.
+  // <group>
+  void startIteration();
+  void stopIteration();
+  // </group>
+
+  Bool     itsRunning;
+  Bool     itsSkipped;
+  uInt64   itsIterations;
+  uInt64   itsBytes;
+  uInt64   itsItems;
+  Double   itsRealTime;         //# seconds
+  Double   itsCpuTime;          //# seconds
+  String   itsLabel;
+  String   itsSkipReason;
+  std::vector<std::pair<String,Double>> itsCounters;
+  std::chrono::steady_clock::time_point itsRealStart;
+  Double   itsCpuStart;
+};
+
+
+// <summary>
+// Run benchmarks and report their results
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tBenchmark" demos="">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=BenchmarkState>BenchmarkState</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Benchmark is a small framework for performance benchmarks in the style
+// of Google Benchmark. A program adds named benchmark functions and runs
+// them. Each function is called repeatedly until the minimum time has
+// passed; the time per iteration and the throughput are reported.
+// <p>
+// The results can be written in a console table and in a machine-readable
+// format (JSON compatible with Google Benchmark, or CSV), so the results
+// of different releases can be compared (e.g., with Google Benchmark's
+// <src>compare.py</src>). The JSON context contains the casacore version,
+// host name and number of CPUs.
+// <p>
+// A benchmark can also add user counters (such as the time spent in
+// the phases of a query). Their average per iteration is reported
+// with the results.
+// <p>
+// The following command line options are recognized:
+// <ul>
+//  <li> <src>--benchmark_filter=regex</src> only runs the benchmarks whose
+//       name contains a match of the regular expression.
+//  <li> <src>--benchmark_min_time=seconds</src> is the minimum time
+//       each benchmark is run (default 0.5).
+//  <li> <src>--benchmark_repetitions=n</src> repeats each benchmark;
+//       the mean and median are reported as well (default 1).
+//  <li> <src>--benchmark_format=console|json|csv</src> gives the format
+//       written to stdout (default console).
+//  <li> <src>--benchmark_out=file</src> also writes the results to a file.
+//  <li> <src>--benchmark_out_format=json|csv|console</src> gives the
+//       format of that file (default json).
+//  <li> <src>--benchmark_list_tests</src> only lists the benchmark names.
+// </ul>
+// Other arguments are left to the program (see <src>arguments</src>).
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   int main (int argc, const char* argv[])
+//   {
+//     Benchmark bench(argc, argv);
+//     bench.add ("copy/1MB", [](BenchmarkState& state) {
+//         std::vector<char> in(1000000), out(1000000);
+//         memcpy (out.data(), in.data(), in.size());
+//         state.addBytes (in.size());
+//       });
+//     return bench.run();
+//   }
+// </srcblock>
+// </example>
+
+// <motivation>
+// The existing performance programs have no standard output, so
+// performance regressions between releases were hard to detect.
+// </motivation>
+
+class Benchmark
+{
+public:
+  typedef std::function<void(BenchmarkState&)> Function;
+
+  // Create from the program arguments. The benchmark options are
+  // interpreted; an exception is thrown if an option value is invalid.
+  Benchmark (int argc, const char* argv[]);
+
+  // Add a benchmark. The name should be unique.
+  void add (const String& name, const Function& func);
+
+  // Run all benchmarks (matching the filter) and report the results.
+  // It returns 0 if all could be run, otherwise 1.
+  int run();
+
+  // Get the program arguments which are not benchmark options.
+  const std::vector<String>& arguments() const
+    { return itsArgs; }
+
+  // Get the number of benchmarks added.
+  uInt size() const
+    { return itsBench.size(); }
+
+  // Set the minimum time per benchmark (seconds).
+  void setMinTime (Double minTime)
+    { itsMinTime = minTime; }
+
+  // Write the results in the given format (console, json, or csv).
+  void write (std::ostream& os, const String& format) const;
+
+private:
+  struct Result {
+    String name;
+    String runName;
+    String aggregate;             //# empty, mean, or median
+    Int    repetition;
+    String label;
+    uInt64 iterations;
+    Double realTime;              //# nsec per iteration
+    Double cpuTime;               //# nsec per iteration
+    Double bytesPerSecond;
+    Double itemsPerSecond;
+    std::vector<std::pair<String,Double>> counters;   //# per iteration
+  };
+
+  // Run a single benchmark and add its result(s).
+  Bool runOne (const String& name, const Function& func);
+
+  // Add the mean and median of the last repetitions.
+  void addAggregates (uInt nrep);
+
+  void writeConsole (std::ostream& os) const;
+  void writeJson (std::ostream& os) const;
+  void writeCsv (std::ostream& os) const;
+
+  // Check if a format is valid.
+  static void checkFormat (const String& format);
+
+  String              itsProgram;
+  String              itsFilter;
+  Double              itsMinTime;
+  uInt                itsRepetitions;
+  String              itsFormat;
+  String              itsOutName;
+  String              itsOutFormat;
+  Bool                itsListOnly;
+  std::vector<String> itsArgs;
+  std::vector<std::pair<String,Function>> itsBench;
+  std::vector<Result> itsResults;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
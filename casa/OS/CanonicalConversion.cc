@@ -133,6 +133,9 @@ size_t CanonicalConversion::TOLOCAL (void* to, const void* from, \
     if (CONVERT == 0) { \
 	assert (sizeof(T) == SIZE); \
 	memcpy (to, from, nr*SIZE); \
+    }else if (sizeof(T) == SIZE) { \
+	/* Only the byte order differs. */ \
+	Conversion::reverseBytes (to, from, nr, SIZE); \
     }else{ \
 	const char* data = (const char*)from; \
         T* dest = (T*)to; \
@@ -151,6 +154,9 @@ size_t CanonicalConversion::FROMLOCAL (void* to, const void* from, \
     if (CONVERT == 0) { \
 	assert (sizeof(T) == SIZE); \
 	memcpy (to, from, nr*SIZE); \
+    }else if (sizeof(T) == SIZE) { \
+	/* Only the byte order differs. */ \
+	Conversion::reverseBytes (to, from, nr, SIZE); \
     }else{ \
 	char* data = (char*)to; \
 	const T* src = (const T*)from; \
@@ -32,6 +32,11 @@
 #ifdef __SSE2__
 #include <emmintrin.h>
 #endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CASA_CONVERSION_X86_DISPATCH
+#include <immintrin.h>
+#endif
+#include <algorithm>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -59,6 +64,16 @@ size_t Conversion::boolToBit (void* to, const void* from,
         memcpy(&bits[i / 8], &r, 2);
     }
     data = &data[i];
+#elif defined(AIPS_LITTLE_ENDIAN)
+    //# Pack 8 Bools (bytes 0 or 1) at a time by gathering the lowest bit
+    //# of each byte into the top byte of the product.
+    const uInt64 gather = 0x0102040810204080ULL;
+    for (i = 0; i < nvalues - (nvalues & 0x7); i+=8) {
+        uInt64 v;
+        memcpy(&v, &data[i], 8);
+        bits[i / 8] = (unsigned char)((v * gather) >> 56);
+    }
+    data = &data[i];
 #endif
 
     //# Fill as many full bytes as possible.
@@ -121,15 +136,10 @@ void Conversion::boolToBit (void* to, const void* from,
 	    mask <<= 1;
 	}
     }
-    //# Set the bits in all 'full' bytes.
-    for (size_t i=startByte; i<endByte; ++i) {
-	unsigned char& ch = bits[i];
-	ch = 0;
-	for (size_t j=0; j<8; ++j) {
-	    if (*data++) {
-                ch |= (1<<j);
-	    }
-	}
+    //# Set the bits in all 'full' bytes using the fast conversion.
+    if (endByte > startByte) {
+        boolToBit (bits + startByte, data, 8 * (endByte - startByte));
+        data += 8 * (endByte - startByte);
     }
     //# Set the bits in the last byte (if needed).
     if (endBit2 > 0) {
@@ -446,6 +456,36 @@ static m64d_t conv_tab[256] __attribute__ ((aligned (8))) = {
 size_t Conversion::bitToBool (void* to, const void* from,
                               size_t nvalues)
 {
+#ifdef __SSE2__
+    if (sizeof(Bool) == sizeof(char)) {
+        Bool* data = (Bool*)to;
+        const uint8_t* bits = (const uint8_t*)from;
+        const size_t nwords = nvalues / 16;
+        const __m128i sel = _mm_setr_epi8 (1, 2, 4, 8, 16, 32, 64, -128,
+                                           1, 2, 4, 8, 16, 32, 64, -128);
+        const __m128i one = _mm_set1_epi8 (1);
+#ifdef _OPENMP
+        size_t nthr =
+            std::max((size_t)1,
+                     std::min((size_t)omp_get_max_threads(), nwords / (8 * 1024)));
+# pragma omp parallel for if (nwords >= 16 * 1024) num_threads(nthr)
+#endif
+        for (size_t i = 0; i < nwords; ++i) {
+            uint16_t w;
+            memcpy (&w, &bits[2*i], 2);
+            /* spread the 2 bytes over the low and high 8 bytes */
+            __m128i v = _mm_cvtsi32_si128 (w);
+            v = _mm_unpacklo_epi8 (v, v);
+            v = _mm_unpacklo_epi16 (v, v);
+            v = _mm_unpacklo_epi32 (v, v);
+            /* select the bit of each byte and turn it into 0 or 1 */
+            v = _mm_cmpeq_epi8 (_mm_and_si128 (v, sel), sel);
+            _mm_storeu_si128 ((__m128i*)&data[16*i], _mm_and_si128 (v, one));
+        }
+        return 2 * nwords + bitToBool_ (&data[16*nwords], &bits[2*nwords],
+                                        nvalues - 16*nwords);
+    }
+#endif
     if (sizeof(Bool) != sizeof(char)  ||  (7 & (unsigned long long)to)) {
 	return bitToBool_ (to, from, nvalues);
     }
@@ -497,12 +537,10 @@ void Conversion::bitToBool (void* to, const void* from,
             *data++ = (ch & (1<<j));
 	}
     }
-    //# Set the bits in all 'full' bytes.
-    for (size_t i=startByte; i<endByte; ++i) {
-	int ch = bits[i];
-	for (size_t j=0; j<8; ++j) {
-            *data++ = (ch & (1<<j));
-	}
+    //# Get the bits in all 'full' bytes using the fast conversion.
+    if (endByte > startByte) {
+        bitToBool (data, bits + startByte, 8 * (endByte - startByte));
+        data += 8 * (endByte - startByte);
     }
     //# Get the bits in the last byte (if needed).
     if (endBit2 > 0) {
@@ -514,6 +552,199 @@ void Conversion::bitToBool (void* to, const void* from,
 }
 
 
+void Conversion::copyBits (void* to, size_t toStartBit,
+                           const void* from, size_t fromStartBit,
+                           size_t nbits)
+{
+    unsigned char* out = (unsigned char*)to + toStartBit / 8;
+    const unsigned char* in = (const unsigned char*)from + fromStartBit / 8;
+    size_t toBit   = toStartBit % 8;
+    size_t fromBit = fromStartBit % 8;
+    //# Copy bit by bit until the output is at a byte boundary.
+    for (; nbits > 0  &&  toBit != 0; --nbits) {
+        if ((*in >> fromBit) & 1) {
+            *out |= (1 << toBit);
+        } else {
+            *out &= ~(1 << toBit);
+        }
+        if (++toBit == 8) {
+            toBit = 0;
+            ++out;
+        }
+        if (++fromBit == 8) {
+            fromBit = 0;
+            ++in;
+        }
+    }
+    //# Copy full output bytes; shift them if the input is not aligned.
+    //# Reading ahead is safe, because the output does not run ahead.
+    size_t nbytes = nbits / 8;
+    if (fromBit == 0) {
+        memmove (out, in, nbytes);
+    } else {
+        for (size_t i=0; i<nbytes; ++i) {
+            out[i] = (unsigned char)((in[i] >> fromBit) |
+                                     (in[i+1] << (8 - fromBit)));
+        }
+    }
+    out += nbytes;
+    in  += nbytes;
+    nbits -= 8 * nbytes;
+    //# Copy the remaining bits into the last output byte.
+    for (size_t j=0; j<nbits; ++j) {
+        if ((*in >> fromBit) & 1) {
+            *out |= (1 << j);
+        } else {
+            *out &= ~(1 << j);
+        }
+        if (++fromBit == 8) {
+            fromBit = 0;
+            ++in;
+        }
+    }
+}
+
+
+//# The byte reversal kernels. The SIMD versions process as many full
+//# vectors as possible and return the number of values done.
+namespace {
+
+  template<size_t N> struct ByteSwapper;
+  template<> struct ByteSwapper<2> {
+    static void swap (void* to, const void* from)
+    {
+      uint16_t x;
+      memcpy (&x, from, 2);
+      x = uint16_t((x << 8) | (x >> 8));
+      memcpy (to, &x, 2);
+    }
+  };
+  template<> struct ByteSwapper<4> {
+    static void swap (void* to, const void* from)
+    {
+      uint32_t x;
+      memcpy (&x, from, 4);
+      x = __builtin_bswap32 (x);
+      memcpy (to, &x, 4);
+    }
+  };
+  template<> struct ByteSwapper<8> {
+    static void swap (void* to, const void* from)
+    {
+      uint64_t x;
+      memcpy (&x, from, 8);
+      x = __builtin_bswap64 (x);
+      memcpy (to, &x, 8);
+    }
+  };
+
+  template<size_t N>
+  void reverseScalar (char* to, const char* from, size_t nvalues)
+  {
+    for (size_t i=0; i<nvalues; ++i) {
+      ByteSwapper<N>::swap (to + i*N, from + i*N);
+    }
+  }
+
+#ifdef CASA_CONVERSION_X86_DISPATCH
+  // Shuffle control for reversing the bytes of each N-byte word
+  // in a 16-byte lane.
+  template<size_t N>
+  inline void makeShuffle (char* ctrl)
+  {
+    for (size_t i=0; i<16; ++i) {
+      ctrl[i] = char((i/N)*N + N-1 - i%N);
+    }
+  }
+
+  template<size_t N>
+  __attribute__((target("ssse3")))
+  size_t reverseSSSE3 (char* to, const char* from, size_t nvalues)
+  {
+    char ctrl[16];
+    makeShuffle<N> (ctrl);
+    const __m128i shuf = _mm_loadu_si128 ((const __m128i*)ctrl);
+    const size_t nbytes = (nvalues*N) & ~size_t(15);
+    for (size_t i=0; i<nbytes; i+=16) {
+      __m128i v = _mm_loadu_si128 ((const __m128i*)(from+i));
+      _mm_storeu_si128 ((__m128i*)(to+i), _mm_shuffle_epi8 (v, shuf));
+    }
+    return nbytes / N;
+  }
+
+  template<size_t N>
+  __attribute__((target("avx2")))
+  size_t reverseAVX2 (char* to, const char* from, size_t nvalues)
+  {
+    char ctrl[32];
+    makeShuffle<N> (ctrl);
+    makeShuffle<N> (ctrl+16);
+    const __m256i shuf = _mm256_loadu_si256 ((const __m256i*)ctrl);
+    const size_t nbytes = (nvalues*N) & ~size_t(31);
+    for (size_t i=0; i<nbytes; i+=32) {
+      __m256i v = _mm256_loadu_si256 ((const __m256i*)(from+i));
+      _mm256_storeu_si256 ((__m256i*)(to+i), _mm256_shuffle_epi8 (v, shuf));
+    }
+    return nbytes / N;
+  }
+
+  // Get the SIMD level supported by the CPU (0=none, 1=SSSE3, 2=AVX2).
+  int simdLevel()
+  {
+    static const int level = (__builtin_cpu_supports ("avx2")  ?  2 :
+                              __builtin_cpu_supports ("ssse3")  ?  1 : 0);
+    return level;
+  }
+#endif
+
+  template<size_t N>
+  void reverseValues (void* to, const void* from, size_t nvalues)
+  {
+    char* out = static_cast<char*>(to);
+    const char* in = static_cast<const char*>(from);
+    size_t ndone = 0;
+#ifdef CASA_CONVERSION_X86_DISPATCH
+    int level = simdLevel();
+    if (level == 2) {
+      ndone = reverseAVX2<N> (out, in, nvalues);
+    } else if (level == 1) {
+      ndone = reverseSSSE3<N> (out, in, nvalues);
+    }
+#endif
+    reverseScalar<N> (out + ndone*N, in + ndone*N, nvalues - ndone);
+  }
+
+} //# end anonymous namespace
+
+
+void Conversion::reverseBytes (void* to, const void* from,
+                               size_t nvalues, size_t valueSize)
+{
+    switch (valueSize) {
+    case 2:
+        reverseValues<2> (to, from, nvalues);
+        break;
+    case 4:
+        reverseValues<4> (to, from, nvalues);
+        break;
+    case 8:
+        reverseValues<8> (to, from, nvalues);
+        break;
+    default:
+        {
+            char* out = static_cast<char*>(to);
+            const char* in = static_cast<const char*>(from);
+            if (out != in) {
+                memmove (out, in, nvalues*valueSize);
+            }
+            for (size_t i=0; i<nvalues; ++i) {
+                std::reverse (out + i*valueSize, out + (i+1)*valueSize);
+            }
+        }
+    }
+}
+
+
 size_t Conversion::valueCopy (void* to, const void* from,
                               size_t nbytes)
 {
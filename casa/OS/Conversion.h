@@ -55,6 +55,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // <li>
 // It defines functions to convert Bools to bits and vice-versa.
 // These are used elsewhere to store Bools as space efficient as possible.
+// A function to copy bit streams at arbitrary bit offsets makes it
+// possible to handle packed Bools without expanding them.
 // Note that these functions are machine independent (they work on little
 // and big endian machines).
 // <li>
@@ -128,6 +130,25 @@ public:
 			   size_t nvalues);
     // </group>
 
+    // Copy <src>nbits</src> bits from the <src>from</src> buffer starting
+    // at bit <src>fromStartBit</src> to the <src>to</src> buffer starting
+    // at bit <src>toStartBit</src>. The other bits in the output bytes are
+    // left untouched. Both buffers use the bit order of
+    // <src>boolToBit</src>.
+    // <br>The buffers may overlap if the output starts before the input
+    // (as needed when shifting packed Bools down to delete a row).
+    static void copyBits (void* to, size_t toStartBit,
+                          const void* from, size_t fromStartBit,
+                          size_t nbits);
+
+    // Reverse the bytes of <src>nvalues</src> values of <src>valueSize</src>
+    // bytes each (i.e., swap their byte order).
+    // The <src>to</src> and <src>from</src> buffers can be the same.
+    // For value sizes 2, 4 and 8 SSSE3 or AVX2 instructions are used if the
+    // CPU supports them (determined at run time).
+    static void reverseBytes (void* to, const void* from,
+                              size_t nvalues, size_t valueSize);
+
     // Copy a value using memcpy.
     // It differs from memcpy in the return value.
     // <note> This version has the <src>ValueFunction</src> signature,
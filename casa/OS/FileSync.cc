@@ -0,0 +1,150 @@
+//# FileSync.cc: Batched syncing of files to disk
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/OS/FileSync.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <algorithm>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+std::atomic<Int> FileSync::theirUseSyncfs (-1);
+
+namespace {
+
+  // Sync a single file or directory.
+  void syncFile (const String& name)
+  {
+    int fd = ::open (name.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat st;
+    if (::fstat (fd, &st) == 0  &&  S_ISREG(st.st_mode)) {
+#if defined(__APPLE__)
+      ::fsync (fd);
+#else
+      ::fdatasync (fd);
+#endif
+    } else {
+      ::fsync (fd);
+    }
+    ::close (fd);
+  }
+
+} //# end anonymous namespace
+
+
+void FileSync::setUseSyncfs (Bool useSyncfs)
+{
+  theirUseSyncfs = useSyncfs;
+}
+
+Bool FileSync::useSyncfs()
+{
+  if (theirUseSyncfs < 0) {
+    Bool value;
+    AipsrcValue<Bool>::find (value, "system.fsync.syncfs", False);
+    Int uninit = -1;
+    theirUseSyncfs.compare_exchange_strong (uninit, value);
+  }
+  return theirUseSyncfs > 0;
+}
+
+void FileSync::syncFiles (const std::vector<String>& fileNames)
+{
+  if (fileNames.size() == 1) {
+    syncFile (fileNames[0]);
+  } else if (! fileNames.empty()) {
+    // The threads mostly wait for the device, so use all workers.
+    ThreadPool::global().parallelFor (fileNames.size(), [&] (size_t i) {
+        syncFile (fileNames[i]);
+      });
+  }
+}
+
+void FileSync::syncDirectories (const std::vector<String>& dirNames)
+{
+  if (useSyncfs()  &&  syncFileSystems (dirNames)) {
+    return;
+  }
+  // Collect the regular files in the directories.
+  std::vector<String> names;
+  for (const String& dirName : dirNames) {
+    DIR* dir = ::opendir (dirName.c_str());
+    if (dir == 0) {
+      continue;
+    }
+    while (struct dirent* ent = ::readdir (dir)) {
+      String name = dirName + '/' + ent->d_name;
+      struct stat st;
+      if (::stat (name.c_str(), &st) == 0  &&  S_ISREG(st.st_mode)) {
+        names.push_back (name);
+      }
+    }
+    ::closedir (dir);
+    names.push_back (dirName);
+  }
+  syncFiles (names);
+}
+
+Bool FileSync::syncFileSystems (const std::vector<String>& dirNames)
+{
+#if defined(__linux__) && defined(SYS_syncfs)
+  std::vector<dev_t> devices;
+  for (const String& dirName : dirNames) {
+    int fd = ::open (dirName.c_str(), O_RDONLY);
+    if (fd < 0) {
+      continue;
+    }
+    struct stat st;
+    Bool ok = True;
+    if (::fstat (fd, &st) == 0  &&
+        std::find (devices.begin(), devices.end(), st.st_dev) ==
+        devices.end()) {
+      ok = (::syscall (SYS_syncfs, fd) == 0);
+      devices.push_back (st.st_dev);
+    }
+    ::close (fd);
+    if (!ok) {
+      return False;
+    }
+  }
+  return True;
+#else
+  (void)dirNames;
+  return False;
+#endif
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,109 @@
+//# FileSync.h: Batched syncing of files to disk
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_FILESYNC_H
+#define CASA_FILESYNC_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <atomic>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// Batched syncing of files to disk
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tFileSync" demos="">
+// </reviewed>
+
+// <synopsis>
+// FileSync ensures that the contents of a set of files are physically
+// written to disk. Instead of syncing the files one after another, it
+// syncs them in parallel using the global
+// <linkto class=ThreadPool>ThreadPool</linkto>, so the storage device
+// can handle the requests together.
+// Only the data of regular files is synced (using fdatasync); directories
+// are fully synced to make new or renamed files durable.
+// <p>
+// Alternatively syncfs can be used (on Linux only), which syncs an entire
+// file system in a single call. It is much faster if many files have to
+// be synced, but it also syncs unrelated data written by other processes
+// to the same file system. Therefore it has to be enabled explicitly
+// using <src>setUseSyncfs</src> or using the aipsrc variable
+// <src>system.fsync.syncfs</src>.
+// <p>
+// Errors (e.g., a file that cannot be opened) are ignored, similar to
+// the other fsync functions in casacore.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   std::vector<String> dirs;
+//   dirs.push_back ("my.ms");
+//   dirs.push_back ("my.ms/ANTENNA");
+//   FileSync::syncDirectories (dirs);
+// </srcblock>
+// </example>
+
+// <motivation>
+// Checkpointing a MeasurementSet with many subtables did dozens of
+// serial fsync calls.
+// </motivation>
+
+class FileSync
+{
+public:
+  // Sync the given files and directories.
+  static void syncFiles (const std::vector<String>& fileNames);
+
+  // Sync the given directories and the regular files in them.
+  // Subdirectories are not synced.
+  // If syncfs is used, each file system is synced once.
+  static void syncDirectories (const std::vector<String>& dirNames);
+
+  // Set if syncfs has to be used by <src>syncDirectories</src>.
+  // It is only possible on Linux.
+  static void setUseSyncfs (Bool useSyncfs);
+
+  // Tell if syncfs is used.
+  static Bool useSyncfs();
+
+private:
+  // Sync the given file systems. It returns False if not possible.
+  static Bool syncFileSystems (const std::vector<String>& dirNames);
+
+  static std::atomic<Int> theirUseSyncfs;      //# -1 is not initialized
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -110,10 +110,16 @@ public:
     static Bool bigEndian();
 
     // Returns 0 if unable to determine the number of CPUs.
+    // On Linux it is the number of CPUs the process can run on, thus
+    // limited by its CPU affinity and a cgroup CPU quota (as used by
+    // containers and batch systems like Slurm).
     static Int numCPUs(bool use_aipsrc=false);
 
     // Get memory info (in KBytes).
     // Returns -1 if unable to determine memory info.
+    // On Linux the memory is limited by the cgroup (v1 or v2) memory limit
+    // of the process, so caches are not sized for the host memory in a
+    // container.
     // <group>
     static ptrdiff_t memoryTotal(bool use_aipsrc=false);
     static ptrdiff_t memoryUsed();
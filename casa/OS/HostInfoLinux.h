@@ -56,6 +56,7 @@
 #include <limits>
 #include <sys/time.h>
 #include <sys/resource.h>
+#include <cmath>
 
 
 // <summary>
@@ -133,7 +134,7 @@ skip_token(const char *p)
 // e.g. total_rss from memory.stat
 // returns std::numeric_limits<uInt64>::max() on error
 // note unset cgroup limits usually have intptr_t.max()
-// does not support v2 cgroups
+// v2 cgroups are handled by get_cgroup2_value and get_cgroup2_limit
 static inline uInt64
 get_cgroup_limit(std::string group, std::string value, std::string sub_value="")
 {
@@ -190,6 +191,126 @@ get_cgroup_limit(std::string group, std::string value, std::string sub_value="")
     return result;
 }
 
+// get the hierarchy of the current process in the v2 (unified) cgroup
+// hierarchy (line 0::hierarchy in /proc/self/cgroup) and the directory
+// where the v2 hierarchy is mounted (assuming a common location)
+// returns false if v2 cgroups are not used
+static inline bool
+get_cgroup2_hierarchy(std::string& root, std::string& hierarchy)
+{
+    std::string line;
+    std::ifstream ifs("/proc/self/cgroup", std::ifstream::in);
+    while (getline(ifs, line)) {
+	if (line.compare(0, 3, "0::") == 0) {
+	    hierarchy = line.substr(3);
+	    // a pure v2 system mounts it at /sys/fs/cgroup, a hybrid one
+	    // at /sys/fs/cgroup/unified
+	    root = "/sys/fs/cgroup";
+	    if (access("/sys/fs/cgroup/cgroup.controllers", F_OK) != 0) {
+		root += "/unified";
+	    }
+	    return true;
+	}
+    }
+    return false;
+}
+
+// get integer value from v2 cgroup hierarchy of current process, if
+// sub_value is set it returns the entry of a collection identified by value,
+// e.g. anon from memory.stat
+// returns std::numeric_limits<uInt64>::max() on error or if unset ('max')
+static inline uInt64
+get_cgroup2_value(const std::string& value, const std::string& sub_value="")
+{
+    uInt64 result = std::numeric_limits<uInt64>::max();
+    std::string root, hierarchy;
+    if (!get_cgroup2_hierarchy(root, hierarchy)) {
+	return result;
+    }
+    std::ifstream ifs((root + hierarchy + "/" + value).c_str(), std::ifstream::in);
+    std::string line;
+    while (getline(ifs, line)) {
+	std::stringstream ss(line);
+	std::string token;
+	ss >> token;
+	if (sub_value.empty()) {
+	    if (token != "max") {
+		result = strtoull(token.c_str(), 0, 10);
+	    }
+	    break;
+	} else if (token == sub_value) {
+	    ss >> result;
+	    break;
+	}
+    }
+    return result;
+}
+
+// get a limit from the v2 cgroup hierarchy of the current process
+// the limits of the parent groups also apply, so the minimum is returned
+// returns std::numeric_limits<uInt64>::max() on error or if unlimited
+static inline uInt64
+get_cgroup2_limit(const std::string& value)
+{
+    uInt64 result = std::numeric_limits<uInt64>::max();
+    std::string root, hierarchy;
+    if (!get_cgroup2_hierarchy(root, hierarchy)) {
+	return result;
+    }
+    while (true) {
+	std::ifstream ifs((root + hierarchy + "/" + value).c_str(), std::ifstream::in);
+	std::string token;
+	if (ifs >> token  &&  token != "max") {
+	    result = std::min(result, (uInt64)strtoull(token.c_str(), 0, 10));
+	}
+	std::string::size_type pos = hierarchy.rfind('/');
+	if (hierarchy.empty() || pos == std::string::npos) {
+	    break;
+	}
+	hierarchy.erase(pos);
+    }
+    return result;
+}
+
+// get the number of CPUs the cgroup CPU quota allows (rounded up)
+// v2 uses cpu.max ('quota period' of the group and its parents), v1 uses
+// cpu.cfs_quota_us and cpu.cfs_period_us
+// returns 0 if no quota is set
+static inline int
+get_cgroup_cpus()
+{
+    double ncpu = 0;
+    std::string root, hierarchy;
+    if (get_cgroup2_hierarchy(root, hierarchy)) {
+	while (true) {
+	    std::ifstream ifs((root + hierarchy + "/cpu.max").c_str(), std::ifstream::in);
+	    std::string quota;
+	    double period;
+	    if (ifs >> quota >> period  &&  quota != "max"  &&  period > 0) {
+		double n = atof(quota.c_str()) / period;
+		if (ncpu == 0 || n < ncpu) {
+		    ncpu = n;
+		}
+	    }
+	    std::string::size_type pos = hierarchy.rfind('/');
+	    if (hierarchy.empty() || pos == std::string::npos) {
+		break;
+	    }
+	    hierarchy.erase(pos);
+	}
+    }
+    if (ncpu == 0) {
+	/* -1 means no quota, which is a huge value for unsigned */
+	uInt64 quota = get_cgroup_limit("cpu", "cpu.cfs_quota_us");
+	uInt64 period = get_cgroup_limit("cpu", "cpu.cfs_period_us");
+	if (quota < (uInt64)std::numeric_limits<Int64>::max() &&
+	    period > 0 && period < (uInt64)std::numeric_limits<Int64>::max()) {
+	    ncpu = double(quota) / period;
+	}
+    }
+    return ncpu > 0 ? int(std::ceil(ncpu)) : 0;
+}
+
 HostMachineInfo::HostMachineInfo( ) : valid(1)
 {
     char buffer[4096+1];
@@ -197,6 +318,7 @@ HostMachineInfo::HostMachineInfo( ) : valid(1)
 
     /* get number of usable CPUs */
     cpu_set_t cpuset;
+    cpus = 0;
     if (sched_getaffinity(0, sizeof(cpuset), &cpuset) == 0) {
 # ifdef CPU_COUNT /* glibc < 2.6 */
 	cpus = CPU_COUNT(&cpuset);
@@ -233,6 +355,12 @@ HostMachineInfo::HostMachineInfo( ) : valid(1)
 	}
     }
 
+    /* a cgroup CPU quota (e.g. in a container) limits the usable CPUs */
+    int quota_cpus = get_cgroup_cpus();
+    if (quota_cpus > 0 && quota_cpus < cpus) {
+	cpus = quota_cpus;
+    }
+
     update_info();
 }
 
@@ -282,6 +410,13 @@ void HostMachineInfo::update_info( )
 	uInt64 proc_mem_max = get_cgroup_limit("memory", "memory.limit_in_bytes") / 1024;
 	/* usage_in_bytes also includes cache so use memory.stat */
 	uInt64 proc_mem_used = get_cgroup_limit("memory", "memory.stat", "total_rss") / 1024;
+	/* v2 cgroups; memory.max is the limit, anon the non-cache usage */
+	uInt64 cg2_mem_max = get_cgroup2_limit("memory.max");
+	if (cg2_mem_max != std::numeric_limits<uInt64>::max() &&
+	    cg2_mem_max / 1024 < proc_mem_max) {
+	    proc_mem_max = cg2_mem_max / 1024;
+	    proc_mem_used = get_cgroup2_value("memory.stat", "anon") / 1024;
+	}
 
 	/* set HostInfo memoryTotal() */
 	memory_total = std::min((uInt64)sys_mem_total, proc_mem_max);
@@ -308,6 +443,12 @@ void HostMachineInfo::update_info( )
 	if (proc_mem_max <= sys_mem_total && proc_mem_max <= proc_swap_max) {
 	    proc_swap_max = proc_swap_max - proc_mem_max;
 	}
+	/* v2 cgroups have a separate swap limit */
+	uInt64 cg2_swap_max = get_cgroup2_limit("memory.swap.max");
+	if (cg2_swap_max != std::numeric_limits<uInt64>::max()) {
+	    proc_swap_max = cg2_swap_max / 1024;
+	    proc_swap_used = get_cgroup2_value("memory.swap.current") / 1024;
+	}
 
 	/* set swapTotal() */
 	swap_total = std::min((uInt64)sys_swap_total, proc_swap_max);
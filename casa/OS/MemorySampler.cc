@@ -0,0 +1,291 @@
+//# MemorySampler.cc: Sampling heap profiler attributing live memory to tags
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/OS/MemorySampler.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <random>
+#include <thread>
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#define CASA_MEMORYSAMPLER_BACKTRACE
+#endif
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+std::atomic<Bool>   MemorySampler::theirOn (False);
+std::atomic<Int64>  MemorySampler::theirNrLive (0);
+std::atomic<uInt>   MemorySampler::theirGeneration (0);
+std::atomic<uInt>   MemorySampler::theirFilter[MemorySampler::theirFilterSize];
+std::atomic<size_t> MemorySampler::theirInterval (512*1024);
+std::atomic<uInt>   MemorySampler::theirMaxDepth (32);
+std::mutex          MemorySampler::theirMutex;
+std::map<const void*, MemorySampler::Sample> MemorySampler::theirSamples;
+thread_local Int64  MemorySampler::theirBytesLeft = 0;
+
+namespace {
+  // The per-thread sampling state.
+  thread_local uInt theirThreadGeneration = 0;
+  thread_local std::minstd_rand theirRandom;
+  thread_local std::vector<const char*> theirTags;
+
+  // Draw the number of bytes until the next sample (exponentially
+  // distributed with the given mean).
+  Int64 nextInterval (Double mean)
+  {
+    Double u = (Double(theirRandom() - theirRandom.min()) + 1.) /
+               (Double(theirRandom.max() - theirRandom.min()) + 1.);
+    return Int64(-std::log(u) * mean) + 1;
+  }
+}
+
+
+void MemorySampler::start (size_t sampleInterval, uInt maxDepth)
+{
+  ThrowIf (sampleInterval == 0, "MemorySampler: sample interval must be > 0");
+  theirInterval = sampleInterval;
+  theirMaxDepth = maxDepth;
+  // A new generation makes all threads draw a new sample countdown.
+  theirGeneration++;
+  theirOn = True;
+}
+
+void MemorySampler::stop()
+{
+  theirOn = False;
+}
+
+size_t MemorySampler::sampleInterval()
+{
+  return theirInterval;
+}
+
+void MemorySampler::doSample (const void* ptr, size_t size)
+{
+  Double interval = theirInterval.load (std::memory_order_relaxed);
+  uInt generation = theirGeneration.load (std::memory_order_relaxed);
+  if (theirThreadGeneration != generation) {
+    // First sample of this thread since sampling was started.
+    theirThreadGeneration = generation;
+    theirRandom.seed (generation * 2654435761u +
+                      std::hash<std::thread::id>()(std::this_thread::get_id()));
+    theirBytesLeft = nextInterval(interval) - Int64(size);
+    if (theirBytesLeft >= 0) {
+      return;
+    }
+  }
+  // The sample points form a Poisson process, so the next one can be drawn
+  // independently of where the last one was in this allocation.
+  theirBytesLeft = nextInterval (interval);
+  Sample sample;
+  sample.ptr    = ptr;
+  sample.size   = size;
+  sample.weight = size / (1. - std::exp(-Double(size) / interval));
+  sample.tag    = currentTag();
+#ifdef CASA_MEMORYSAMPLER_BACKTRACE
+  uInt maxDepth = theirMaxDepth.load (std::memory_order_relaxed);
+  if (maxDepth > 0) {
+    // Skip the frame of this function.
+    std::vector<void*> frames(maxDepth + 1);
+    int n = backtrace (frames.data(), frames.size());
+    if (n > 1) {
+      sample.stack.assign (frames.begin() + 1, frames.begin() + n);
+    }
+  }
+#endif
+  std::lock_guard<std::mutex> lock(theirMutex);
+  auto iter = theirSamples.find (ptr);
+  if (iter != theirSamples.end()) {
+    // The pointer was reused without its free being recorded.
+    iter->second = std::move(sample);
+  } else {
+    theirSamples.emplace (ptr, std::move(sample));
+    theirFilter[filterIndex(ptr)]++;
+    theirNrLive++;
+  }
+}
+
+void MemorySampler::doFree (const void* ptr)
+{
+  uInt inx = filterIndex (ptr);
+  if (theirFilter[inx].load (std::memory_order_relaxed) == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(theirMutex);
+  auto iter = theirSamples.find (ptr);
+  if (iter != theirSamples.end()) {
+    theirSamples.erase (iter);
+    theirFilter[inx]--;
+    theirNrLive--;
+  }
+}
+
+void MemorySampler::pushTag (const char* name)
+{
+  theirTags.push_back (name);
+}
+
+void MemorySampler::popTag()
+{
+  if (! theirTags.empty()) {
+    theirTags.pop_back();
+  }
+}
+
+String MemorySampler::currentTag()
+{
+  String tag;
+  for (const char* name : theirTags) {
+    if (! tag.empty()) {
+      tag += '/';
+    }
+    tag += name;
+  }
+  return tag;
+}
+
+std::vector<MemorySampler::Sample> MemorySampler::snapshot()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  std::vector<Sample> samples;
+  samples.reserve (theirSamples.size());
+  for (const auto& s : theirSamples) {
+    samples.push_back (s.second);
+  }
+  return samples;
+}
+
+Double MemorySampler::liveBytes()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  Double bytes = 0;
+  for (const auto& s : theirSamples) {
+    bytes += s.second.weight;
+  }
+  return bytes;
+}
+
+std::map<String, Double> MemorySampler::liveBytesPerTag()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  std::map<String, Double> bytes;
+  for (const auto& s : theirSamples) {
+    bytes[s.second.tag] += s.second.weight;
+  }
+  return bytes;
+}
+
+Record MemorySampler::toRecord()
+{
+  std::map<String, std::pair<Double,Int>> tags;
+  {
+    std::lock_guard<std::mutex> lock(theirMutex);
+    for (const auto& s : theirSamples) {
+      std::pair<Double,Int>& val = tags[s.second.tag];
+      val.first += s.second.weight;
+      val.second++;
+    }
+  }
+  Record rec;
+  for (const auto& t : tags) {
+    Record sub;
+    sub.define ("bytes", t.second.first);
+    sub.define ("nsamples", t.second.second);
+    rec.defineRecord (t.first.empty() ? String("untagged") : t.first, sub);
+  }
+  return rec;
+}
+
+void MemorySampler::show (std::ostream& os, uInt nstack)
+{
+  std::vector<Sample> samples = snapshot();
+  // Accumulate per tag and per call stack.
+  std::map<String, std::pair<Double,Int>> tags;
+  std::map<std::vector<void*>, std::pair<Double,Int>> stacks;
+  Double total = 0;
+  for (const Sample& s : samples) {
+    std::pair<Double,Int>& tval = tags[s.tag];
+    tval.first += s.weight;
+    tval.second++;
+    std::pair<Double,Int>& sval = stacks[s.stack];
+    sval.first += s.weight;
+    sval.second++;
+    total += s.weight;
+  }
+  os << "Estimated live memory " << std::fixed << std::setprecision(3)
+     << total / (1024.*1024.) << " MB in " << samples.size()
+     << " samples (interval " << sampleInterval() << " bytes)" << std::endl;
+  for (const auto& t : tags) {
+    os << "  " << std::setw(12) << t.second.first / (1024.*1024.) << " MB "
+       << std::setw(8) << t.second.second << "  "
+       << (t.first.empty() ? String("untagged") : t.first) << std::endl;
+  }
+  // Show the stacks with most live memory.
+  std::vector<std::pair<Double, const std::vector<void*>*>> order;
+  for (const auto& s : stacks) {
+    if (! s.first.empty()) {
+      order.push_back (std::make_pair (s.second.first, &s.first));
+    }
+  }
+  std::sort (order.begin(), order.end(),
+             [](const std::pair<Double, const std::vector<void*>*>& left,
+                const std::pair<Double, const std::vector<void*>*>& right)
+             { return left.first > right.first; });
+  for (uInt i=0; i<std::min(size_t(nstack), order.size()); ++i) {
+    const std::vector<void*>& stack = *order[i].second;
+    os << " stack " << i << ": " << order[i].first / (1024.*1024.)
+       << " MB" << std::endl;
+#ifdef CASA_MEMORYSAMPLER_BACKTRACE
+    char** symbols = backtrace_symbols (stack.data(), stack.size());
+    for (uInt j=0; j<stack.size(); ++j) {
+      os << "    " << (symbols ? symbols[j] : "?") << std::endl;
+    }
+    free (symbols);
+#endif
+  }
+  os.unsetf (std::ios::floatfield);
+}
+
+void MemorySampler::clear()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  theirSamples.clear();
+  for (uInt i=0; i<theirFilterSize; ++i) {
+    theirFilter[i] = 0;
+  }
+  theirNrLive = 0;
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,201 @@
+//# MemorySampler.h: Sampling heap profiler attributing live memory to tags
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_MEMORYSAMPLER_H
+#define CASA_MEMORYSAMPLER_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <atomic>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Record;
+
+
+// <summary>
+// Sampling heap profiler attributing live memory to tags
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tMemorySampler" demos="">
+// </reviewed>
+
+// <synopsis>
+// MemorySampler keeps track of a sample of the allocations done by casacore
+// (Array storage and Blocks) that are still alive. Unlike
+// <linkto class=MemoryTrace>MemoryTrace</linkto> it does not log every
+// allocation, so it can be used in long-running processes to find out
+// where memory is going.
+// <p>
+// On average one of every <src>sampleInterval</src> allocated bytes is
+// sampled; an allocation is sampled with a probability
+// <src>1-exp(-size/sampleInterval)</src>, so large allocations are (almost)
+// always sampled. For each sampled allocation the size, the current tag
+// and the call stack (where supported by the system) are kept until it is
+// freed. Each sample gets a weight being the inverse of its probability, so
+// the sum of the weights is an unbiased estimate of the live memory.
+// <p>
+// The tag of an allocation is the nesting of the active
+// <linkto class=MemoryTraceBlock>MemoryTraceBlock</linkto> scopes of the
+// thread doing the allocation (e.g. <src>"imager/gridder"</src>).
+// Allocations outside such a scope get an empty tag.
+// <p>
+// Other allocators can feed the sampler by calling <src>recordAlloc</src>
+// and <src>recordFree</src>. These functions are inline and cost only a
+// few instructions if sampling is off or if the allocation is not sampled.
+// The bookkeeping of a sampled allocation is done under a lock.
+// Freeing memory does not take the lock unless the pointer might be a
+// sampled one.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   MemorySampler::start (256*1024);
+//   {
+//     MemoryTraceBlock block("gridder");
+//     ... do the work
+//   }
+//   // Show the estimated live memory per tag and the 10 largest stacks.
+//   MemorySampler::show (cout, 10);
+// </srcblock>
+// </example>
+
+class MemorySampler
+{
+public:
+  // A sampled allocation.
+  struct Sample {
+    const void* ptr;
+    size_t      size;
+    // Estimated number of bytes represented by this sample.
+    Double      weight;
+    String      tag;
+    std::vector<void*> stack;
+  };
+
+  // Start sampling with the given mean interval in bytes.
+  // At most <src>maxDepth</src> stack frames are kept per sample.
+  static void start (size_t sampleInterval = 512*1024, uInt maxDepth = 32);
+
+  // Stop sampling new allocations. Samples still alive are kept (and
+  // removed when freed), so a snapshot can be made after stopping.
+  static void stop();
+
+  // Is sampling on?
+  static Bool isOn()
+    { return theirOn.load (std::memory_order_relaxed); }
+
+  // Get the mean sample interval.
+  static size_t sampleInterval();
+
+  // Record the allocation or deallocation of a buffer.
+  // <group>
+  static void recordAlloc (const void* ptr, size_t size)
+  {
+    if (isOn()) {
+      theirBytesLeft -= Int64(size);
+      if (theirBytesLeft < 0) {
+        doSample (ptr, size);
+      }
+    }
+  }
+  static void recordFree (const void* ptr)
+  {
+    if (theirNrLive.load (std::memory_order_relaxed) > 0) {
+      doFree (ptr);
+    }
+  }
+  // </group>
+
+  // Push or pop a tag for the current thread. It is done by the constructor
+  // and destructor of MemoryTraceBlock. The name must stay alive until
+  // popped.
+  // <group>
+  static void pushTag (const char* name);
+  static void popTag();
+  // </group>
+
+  // Get the current tag of this thread (nested names separated by a slash).
+  static String currentTag();
+
+  // Get a copy of the live samples.
+  static std::vector<Sample> snapshot();
+
+  // Get the estimated number of live bytes (in total or per tag).
+  // <group>
+  static Double liveBytes();
+  static std::map<String, Double> liveBytesPerTag();
+  // </group>
+
+  // Get the live memory per tag as a record. Each tag is a subrecord with
+  // the fields <src>bytes</src> (estimated live bytes) and
+  // <src>nsamples</src>. An empty tag is shown as <src>untagged</src>.
+  static Record toRecord();
+
+  // Show the estimated live memory per tag and the call stacks having the
+  // most live memory (at most <src>nstack</src>). The stack frames are
+  // symbolized if possible.
+  static void show (std::ostream&, uInt nstack = 10);
+
+  // Remove all samples.
+  static void clear();
+
+private:
+  // Do the bookkeeping of a possibly sampled allocation.
+  static void doSample (const void* ptr, size_t size);
+  // Remove the sample of a freed pointer if present.
+  static void doFree (const void* ptr);
+  // Get the index in the filter of sampled pointers.
+  static uInt filterIndex (const void* ptr)
+    { uInt64 v = reinterpret_cast<uInt64>(ptr);
+      return ((v >> 4) ^ (v >> 16)) & (theirFilterSize-1); }
+
+  //# Data members
+  static const uInt        theirFilterSize = 4096;
+  static std::atomic<Bool> theirOn;
+  static std::atomic<Int64> theirNrLive;
+  static std::atomic<uInt> theirGeneration;
+  // Number of sampled pointers per filter entry.
+  static std::atomic<uInt> theirFilter[theirFilterSize];
+  static std::atomic<size_t> theirInterval;
+  static std::atomic<uInt> theirMaxDepth;
+  static std::mutex        theirMutex;
+  static std::map<const void*, Sample> theirSamples;
+  // Bytes left before the next sample in this thread.
+  static thread_local Int64 theirBytesLeft;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -27,6 +27,7 @@
 //# Do so by #ifdef on AIPS_LINUX_DEPR instead of AIPS_LINUX.
 
 #include <casacore/casa/OS/MemoryTrace.h>
+#include <casacore/casa/OS/MemorySampler.h>
 #include <casacore/casa/OS/EnvVar.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Exceptions/Error.h>
@@ -230,18 +231,21 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   MemoryTraceBlock::MemoryTraceBlock (const std::string& name)
     : itsName (name)
   {
+    MemorySampler::pushTag (itsName.c_str());
     traceMemoryBlockBegin (itsName);
   }
 
   MemoryTraceBlock::MemoryTraceBlock (const char* name)
     : itsName (MemoryTrace::makeString(name))
   {
+    MemorySampler::pushTag (itsName.c_str());
     traceMemoryBlockBegin (itsName);
   }
 
   MemoryTraceBlock::~MemoryTraceBlock()
   {
     traceMemoryBlockEnd (itsName);
+    MemorySampler::popTag();
   }
 
 
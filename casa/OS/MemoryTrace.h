@@ -129,6 +129,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // work fine in case of a premature exit from a function.
   //
   // It is possible to nest blocks as deeply as one likes.
+  //
+  // The block also sets the tag used by
+  // <linkto class=MemorySampler>MemorySampler</linkto> for the allocations
+  // done in this thread while the block is active.
   // </synopsis>
   class MemoryTraceBlock
   {
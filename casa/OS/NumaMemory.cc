@@ -0,0 +1,171 @@
+//# NumaMemory.cc: Placement of large memory buffers on NUMA nodes
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/OS/NumaMemory.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/System/Aipsrc.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+//# The mbind policy; numaif.h is part of libnuma, which is not required.
+#ifndef MPOL_INTERLEAVE
+#define MPOL_INTERLEAVE 3
+#endif
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+std::atomic<size_t> NumaMemory::theirMinBytes (4*1024*1024);
+std::atomic<Int>    NumaMemory::theirPolicy (-1);
+
+namespace {
+
+  // The online NUMA nodes as a bit mask as used by mbind.
+  struct NodeMask
+  {
+    std::vector<unsigned long> mask;
+    uInt nnodes;
+
+    NodeMask()
+      : nnodes (0)
+    {
+      // The file contains a list of ranges like 0-1,4.
+      std::ifstream ifs("/sys/devices/system/node/online");
+      std::string list;
+      if (ifs >> list) {
+        size_t pos = 0;
+        while (pos < list.size()) {
+          size_t end = list.find (',', pos);
+          if (end == std::string::npos) {
+            end = list.size();
+          }
+          std::string range = list.substr (pos, end-pos);
+          size_t dash = range.find ('-');
+          uInt first = atoi (range.c_str());
+          uInt last = (dash == std::string::npos  ?  first :
+                       uInt(atoi (range.c_str() + dash + 1)));
+          for (uInt node=first; node<=last; ++node) {
+            size_t word = node / (8*sizeof(unsigned long));
+            if (word >= mask.size()) {
+              mask.resize (word+1, 0);
+            }
+            mask[word] |= 1UL << (node % (8*sizeof(unsigned long)));
+            nnodes++;
+          }
+          pos = end+1;
+        }
+      }
+      nnodes = std::max (nnodes, 1u);
+    }
+  };
+
+  const NodeMask& nodeMask()
+  {
+    static NodeMask mask;
+    return mask;
+  }
+
+} //# end anonymous namespace
+
+
+uInt NumaMemory::nnodes()
+{
+  return nodeMask().nnodes;
+}
+
+void NumaMemory::setPolicy (Policy policy, size_t minBytes)
+{
+  theirMinBytes = minBytes;
+  theirPolicy   = policy;
+}
+
+NumaMemory::Policy NumaMemory::policy()
+{
+  if (theirPolicy < 0) {
+    init();
+  }
+  return Policy(theirPolicy.load());
+}
+
+void NumaMemory::init()
+{
+  Int policy = Default;
+  String value;
+  if (Aipsrc::find (value, "system.numa.policy")) {
+    value.downcase();
+    if (value == "interleave") {
+      policy = Interleave;
+    } else if (value == "spread") {
+      policy = Spread;
+    }
+  }
+  Int uninit = -1;
+  theirPolicy.compare_exchange_strong (uninit, policy);
+}
+
+void NumaMemory::place (void* ptr, size_t nbytes, Policy policy)
+{
+  if (policy == Default  ||  nnodes() <= 1) {
+    return;
+  }
+  // Only whole pages can be placed.
+  size_t pageSize = sysconf(_SC_PAGESIZE);
+  char* start = static_cast<char*>(ptr) + pageSize - 1;
+  start -= size_t(start) % pageSize;
+  char* end = static_cast<char*>(ptr) + nbytes;
+  end -= size_t(end) % pageSize;
+  if (end <= start) {
+    return;
+  }
+  if (policy == Interleave) {
+#if defined(__linux__) && defined(SYS_mbind)
+    const NodeMask& mask = nodeMask();
+    // A failure is ignored; the pages are then placed by first touch.
+    syscall (SYS_mbind, start, end-start, MPOL_INTERLEAVE,
+             mask.mask.data(), 8*sizeof(unsigned long)*mask.mask.size() + 1,
+             0);
+#endif
+  } else {
+    // Let each thread of the pool touch a contiguous part of the pages.
+    size_t npage = (end-start) / pageSize;
+    size_t nthread = std::min (size_t(ThreadPool::concurrency()), npage);
+    size_t chunk = (npage + nthread - 1) / nthread;
+    ThreadPool::global().parallelFor (nthread, [=] (size_t i) {
+        size_t last = std::min (npage, (i+1)*chunk);
+        for (size_t page=i*chunk; page<last; ++page) {
+          start[page*pageSize] = 0;
+        }
+      });
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,130 @@
+//# NumaMemory.h: Placement of large memory buffers on NUMA nodes
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_NUMAMEMORY_H
+#define CASA_NUMAMEMORY_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <atomic>
+#include <cstddef>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// Placement of large memory buffers on NUMA nodes
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tNumaMemory" demos="">
+// </reviewed>
+
+// <synopsis>
+// On a machine with multiple NUMA nodes (e.g., a dual-socket node), a
+// memory page is placed on the node of the thread touching it first.
+// Usually that is the thread allocating and initializing a buffer, so
+// threads on other nodes processing the buffer access remote memory.
+// <br>NumaMemory defines how large buffers are placed:
+// <ul>
+//  <li> <src>Default</src> leaves the placement to the OS (first touch).
+//  <li> <src>Interleave</src> spreads the pages round-robin over all nodes,
+//       which gives an even memory bandwidth for any access pattern.
+//  <li> <src>Spread</src> lets the threads of the global
+//       <linkto class=ThreadPool>ThreadPool</linkto> touch contiguous parts
+//       of the buffer first, so each part is local to one of the workers.
+//       It works best for code processing a buffer in parallel in
+//       contiguous chunks.
+// </ul>
+// The policy is applied to the data of Array objects (thus also to
+// TempLattice buffers) and to the tiles of the TiledStMan caches, if
+// the buffer size is at least <src>minBytes()</src> (default 4 MiB).
+// The policy can be set using <src>setPolicy</src> or using the aipsrc
+// variable <src>system.numa.policy</src> (default, interleave or spread).
+// <br>The placement only affects pages not touched yet, so it is most
+// effective for large buffers which the system allocator takes directly
+// from the OS. Nothing is done on non-Linux systems or if the machine
+// has a single NUMA node.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   NumaMemory::setPolicy (NumaMemory::Interleave);
+//   Array<Complex> grid(IPosition(3,8192,8192,4));   // interleaved pages
+// </srcblock>
+// </example>
+
+// <motivation>
+// Memory-bandwidth bound kernels like gridding and statistics lose a lot
+// of their performance when threads read memory of another socket.
+// </motivation>
+
+class NumaMemory
+{
+public:
+  enum Policy {
+    Default,
+    Interleave,
+    Spread
+  };
+
+  // Get the number of NUMA nodes (1 if unknown).
+  static uInt nnodes();
+
+  // Set the placement policy for buffers of at least the given size.
+  static void setPolicy (Policy policy, size_t minBytes=4*1024*1024);
+
+  // Get the placement policy.
+  static Policy policy();
+
+  // Get the minimum buffer size the policy is applied to.
+  static size_t minBytes()
+    { return theirMinBytes; }
+
+  // Apply the policy to a newly allocated buffer. Nothing is done if
+  // the buffer is smaller than <src>minBytes()</src>.
+  static void place (void* ptr, size_t nbytes)
+  {
+    if (nbytes >= theirMinBytes) {
+      place (ptr, nbytes, policy());
+    }
+  }
+
+  // Apply the given policy to a buffer (regardless of its size).
+  static void place (void* ptr, size_t nbytes, Policy policy);
+
+private:
+  // Read the policy from the aipsrc variable.
+  static void init();
+
+  static std::atomic<size_t> theirMinBytes;
+  static std::atomic<Int>    theirPolicy;     //# -1 is not initialized
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -24,11 +24,16 @@
 //#
 
 #include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/OS/ThreadPool.h>
 
 namespace casacore {
   namespace OMP {
 
     uInt nMaxThreads() {
+        // Do not use more threads in a task of the thread pool.
+        if (ThreadPool::inWorker()) {
+            return 1;
+        }
 #ifdef _OPENMP
         return (omp_get_num_threads() > 1) ? 1 : omp_get_max_threads();
 #else
@@ -46,7 +46,8 @@ namespace casacore {
       return 1;
 #endif
     }
-    // Backward 
+    // Get the maximum number of threads to use in a parallel section.
+    // It is 1 if already in a parallel section or in a task of ThreadPool.
     uInt nMaxThreads();
 
     // Set the number of threads to use. Note it can be overridden
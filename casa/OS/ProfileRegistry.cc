@@ -0,0 +1,144 @@
+//# ProfileRegistry.cc: Registry of named counters and timers for profiling
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/casa/OS/ProfileRegistry.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+std::atomic<Bool> ProfileRegistry::theirEnabled (True);
+std::mutex        ProfileRegistry::theirMutex;
+std::map<String, std::unique_ptr<ProfileCounter>>
+                  ProfileRegistry::theirCounters;
+
+void ProfileRegistry::init()
+{
+  static Bool initialized = False;
+  // Called with the mutex locked.
+  if (! initialized) {
+    initialized = True;
+    Bool enable;
+    AipsrcValue<Bool>::find (enable, "casa.profiling", True);
+    theirEnabled = enable;
+  }
+}
+
+ProfileCounter& ProfileRegistry::counter (const String& name)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  init();
+  std::unique_ptr<ProfileCounter>& ptr = theirCounters[name];
+  if (! ptr) {
+    ptr.reset (new ProfileCounter(name));
+  }
+  return *ptr;
+}
+
+void ProfileRegistry::setEnabled (Bool enable)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  init();
+  theirEnabled = enable;
+}
+
+void ProfileRegistry::reset()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  for (auto& cnt : theirCounters) {
+    cnt.second->reset();
+  }
+}
+
+Record ProfileRegistry::toRecord()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  Record rec;
+  for (const auto& cnt : theirCounters) {
+    Record sub;
+    sub.define ("count", Int64(cnt.second->count()));
+    sub.define ("time", cnt.second->seconds());
+    rec.defineRecord (cnt.first, sub);
+  }
+  return rec;
+}
+
+// Escape a Prometheus label value.
+static String escapeLabel (const String& value)
+{
+  String result;
+  for (char c : value) {
+    if (c == '\\'  ||  c == '"') {
+      result += '\\';
+      result += c;
+    } else if (c == '\n') {
+      result += "\\n";
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+String ProfileRegistry::toPrometheus (const String& prefix)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  std::ostringstream os;
+  os << std::setprecision(9);
+  os << "# HELP " << prefix << "_calls_total Number of calls per code path\n";
+  os << "# TYPE " << prefix << "_calls_total counter\n";
+  for (const auto& cnt : theirCounters) {
+    os << prefix << "_calls_total{name=\"" << escapeLabel(cnt.first)
+       << "\"} " << cnt.second->count() << '\n';
+  }
+  os << "# HELP " << prefix << "_seconds_total Time spent per code path\n";
+  os << "# TYPE " << prefix << "_seconds_total counter\n";
+  for (const auto& cnt : theirCounters) {
+    os << prefix << "_seconds_total{name=\"" << escapeLabel(cnt.first)
+       << "\"} " << cnt.second->seconds() << '\n';
+  }
+  return os.str();
+}
+
+void ProfileRegistry::show (std::ostream& os)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  for (const auto& cnt : theirCounters) {
+    if (cnt.second->count() > 0) {
+      os << std::setw(30) << std::left << cnt.first << std::right
+         << std::setw(14) << cnt.second->count()
+         << std::setw(14) << cnt.second->seconds() << " sec" << std::endl;
+    }
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,265 @@
+//# ProfileRegistry.h: Registry of named counters and timers for profiling
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef CASA_PROFILEREGISTRY_H
+#define CASA_PROFILEREGISTRY_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Record;
+
+
+// <summary>
+// A named counter with accumulated time for profiling
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tProfileRegistry" demos="">
+// </reviewed>
+
+// <synopsis>
+// A ProfileCounter counts the number of times something happened and
+// optionally accumulates the time spent. It is thread-safe (using relaxed
+// atomic operations), so it can be used in parallel code without locking.
+// Counters are created by and kept in the
+// <linkto class=ProfileRegistry>ProfileRegistry</linkto>.
+// Nothing is counted if profiling is disabled in the registry.
+// </synopsis>
+
+class ProfileCounter
+{
+public:
+  explicit ProfileCounter (const String& name)
+    : itsName (name), itsCount (0), itsNanoSec (0)
+  {}
+
+  ProfileCounter (const ProfileCounter&) = delete;
+  ProfileCounter& operator= (const ProfileCounter&) = delete;
+
+  // Increment the count.
+  inline void add (uInt64 n=1);
+
+  // Increment the count and add the time (in nanoseconds).
+  inline void addTime (uInt64 nanoSec, uInt64 n=1);
+
+  // Get the name.
+  const String& name() const
+    { return itsName; }
+
+  // Get the count.
+  uInt64 count() const
+    { return itsCount.load (std::memory_order_relaxed); }
+
+  // Get the accumulated time in seconds.
+  Double seconds() const
+    { return 1e-9 * itsNanoSec.load (std::memory_order_relaxed); }
+
+  // Reset the count and time to zero.
+  void reset()
+    { itsCount.store (0); itsNanoSec.store (0); }
+
+private:
+  String                itsName;
+  std::atomic<uInt64>   itsCount;
+  std::atomic<uInt64>   itsNanoSec;
+};
+
+
+// <summary>
+// Scoped timer adding the elapsed time to a ProfileCounter
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tProfileRegistry" demos="">
+// </reviewed>
+
+// <synopsis>
+// The constructor starts the timer; the destructor adds 1 and the elapsed
+// (wall clock) time to the counter. Nothing is done if profiling was
+// disabled when the timer was constructed.
+// </synopsis>
+
+class ProfileTimer
+{
+public:
+  inline explicit ProfileTimer (ProfileCounter& counter);
+  inline ~ProfileTimer();
+
+  ProfileTimer (const ProfileTimer&) = delete;
+  ProfileTimer& operator= (const ProfileTimer&) = delete;
+
+private:
+  ProfileCounter& itsCounter;
+  Bool            itsActive;
+  std::chrono::steady_clock::time_point itsStart;
+};
+
+
+// <summary>
+// Global registry of named profiling counters and timers
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tProfileRegistry" demos="">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=PrecTimer>PrecTimer</linkto>
+// </prerequisite>
+
+// <synopsis>
+// ProfileRegistry holds named <linkto class=ProfileCounter>counters</linkto>
+// giving the number of times a code path is executed and the time
+// spent in it. Contrary to <linkto class=PrecTimer>PrecTimer</linkto> and
+// <linkto class=Timer>Timer</linkto>, which have to be placed and printed
+// by hand, the counters are global and can be inspected at any time. They
+// are cheap enough to be always enabled: counting is a relaxed atomic
+// increment, timing adds two reads of the steady clock.
+// <p>
+// A counter is looked up once and kept in a function-local static, so the
+// lookup (which needs a lock) is not done in the hot path.
+// Casacore itself counts (and times) the following:
+// <ul>
+//  <li> <src>BucketCache.miss</src>: buckets read because not in the cache
+//  <li> <src>TSM.tileRead</src>: tiles read by the tiled storage managers
+//  <li> <src>TaQL.command</src>: TaQL commands executed
+//  <li> <src>TaQL.parse</src>, <src>TaQL.where</src>, <src>TaQL.groupby</src>,
+//       <src>TaQL.having</src>, <src>TaQL.orderby</src>,
+//       <src>TaQL.projection</src>, <src>TaQL.distinct</src>: the phases
+//       of TaQL commands
+//  <li> <src>MeasConvert.convert</src>: measure conversions
+//  <li> <src>LatticeIterator.move</src>: moves of a lattice iterator
+//       (including getting the new cursor)
+// </ul>
+// The counters can be exported as a Record or in the text format used
+// by Prometheus, so they can be served by a monitoring endpoint.
+// <p>
+// Profiling is enabled by default. It can be disabled by the aipsrc
+// variable <src>casa.profiling</src> or by <src>setEnabled</src>.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   void MyClass::hotFunction()
+//   {
+//     static ProfileCounter& counter =
+//       ProfileRegistry::counter ("MyClass.hotFunction");
+//     ProfileTimer timer(counter);
+//     ...
+//   }
+//   // Later on:
+//   cout << ProfileRegistry::toPrometheus();
+// </srcblock>
+// </example>
+
+class ProfileRegistry
+{
+public:
+  // Get the counter with the given name. It is created if not existing.
+  // The reference stays valid during the entire program.
+  static ProfileCounter& counter (const String& name);
+
+  // Is profiling enabled?
+  static Bool enabled()
+    { return theirEnabled.load (std::memory_order_relaxed); }
+
+  // Enable or disable profiling.
+  static void setEnabled (Bool enable);
+
+  // Reset all counters to zero.
+  static void reset();
+
+  // Get the counters as a Record containing a subrecord per counter
+  // with fields <src>count</src> (Int64) and <src>time</src> (seconds).
+  static Record toRecord();
+
+  // Get the counters in the Prometheus text exposition format.
+  // Each counter gives a sample of the metrics
+  // <src>prefix_calls_total</src> and <src>prefix_seconds_total</src>
+  // with its name as label.
+  static String toPrometheus (const String& prefix = "casacore");
+
+  // Show the counters with a non-zero count.
+  static void show (std::ostream& os);
+
+private:
+  // Initialize from aipsrc (once).
+  static void init();
+
+  static std::atomic<Bool> theirEnabled;
+  static std::mutex        theirMutex;
+  static std::map<String, std::unique_ptr<ProfileCounter>> theirCounters;
+};
+
+
+inline void ProfileCounter::add (uInt64 n)
+{
+  if (ProfileRegistry::enabled()) {
+    itsCount.fetch_add (n, std::memory_order_relaxed);
+  }
+}
+
+inline void ProfileCounter::addTime (uInt64 nanoSec, uInt64 n)
+{
+  itsCount.fetch_add (n, std::memory_order_relaxed);
+  itsNanoSec.fetch_add (nanoSec, std::memory_order_relaxed);
+}
+
+inline ProfileTimer::ProfileTimer (ProfileCounter& counter)
+  : itsCounter (counter),
+    itsActive  (ProfileRegistry::enabled())
+{
+  if (itsActive) {
+    itsStart = std::chrono::steady_clock::now();
+  }
+}
+
+inline ProfileTimer::~ProfileTimer()
+{
+  if (itsActive) {
+    itsCounter.addTime (std::chrono::duration_cast<std::chrono::nanoseconds>
+                        (std::chrono::steady_clock::now() - itsStart).count());
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
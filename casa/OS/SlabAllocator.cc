@@ -0,0 +1,174 @@
+//# SlabAllocator.cc: Fixed-size buffers taken from (huge page) memory slabs
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/OS/SlabAllocator.h>
+#include <casacore/casa/OS/NumaMemory.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <sys/mman.h>
+#include <errno.h>
+#include <cstring>
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+const size_t SlabAllocator::HugePageSize;
+
+SlabAllocator::SlabAllocator (size_t bufferSize, Bool useHugePages)
+  : itsBufferSize (bufferSize),
+    itsHugePages  (useHugePages),
+    itsNUsed      (0)
+{
+  if (bufferSize == 0) {
+    throw AipsError ("SlabAllocator: buffer size cannot be 0");
+  }
+  // Align each buffer on a cache line.
+  itsStride   = (bufferSize + 63) / 64 * 64;
+  // A slab holds at least 1 buffer and is a multiple of 2 MiB.
+  itsSlabSize = (itsStride + HugePageSize - 1) / HugePageSize * HugePageSize;
+  itsNPerSlab = itsSlabSize / itsStride;
+}
+
+SlabAllocator::~SlabAllocator()
+{
+  for (auto& slab : itsSlabs) {
+    ::munmap (slab.first, itsSlabSize);
+  }
+}
+
+char* SlabAllocator::allocate()
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  // Take a buffer from the lowest slab having free buffers, so the
+  // buffers are packed in the first slabs and others can be released.
+  Slab* slab;
+  if (itsAvail.empty()) {
+    char* start = mapSlab();
+    slab = &itsSlabs[start];
+    slab->nused = 0;
+    slab->free.reserve (itsNPerSlab);
+    // Hand out the buffers in address order.
+    for (size_t i=itsNPerSlab; i>0; --i) {
+      slab->free.push_back (start + (i-1)*itsStride);
+    }
+    itsAvail.insert (start);
+  } else {
+    slab = &itsSlabs[*itsAvail.begin()];
+  }
+  char* buffer = slab->free.back();
+  slab->free.pop_back();
+  slab->nused++;
+  itsNUsed++;
+  if (slab->free.empty()) {
+    itsAvail.erase (itsAvail.begin());
+  }
+  return buffer;
+}
+
+void SlabAllocator::deallocate (char* buffer)
+{
+  if (buffer == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(itsMutex);
+  // Find the slab containing the buffer.
+  auto iter = itsSlabs.upper_bound (buffer);
+  if (iter == itsSlabs.begin()) {
+    throw AipsError ("SlabAllocator::deallocate: unknown buffer");
+  }
+  --iter;
+  if (buffer >= iter->first + itsSlabSize  ||
+      size_t(buffer - iter->first) % itsStride != 0) {
+    throw AipsError ("SlabAllocator::deallocate: unknown buffer");
+  }
+  Slab& slab = iter->second;
+  if (slab.free.empty()) {
+    itsAvail.insert (iter->first);
+  }
+  slab.free.push_back (buffer);
+  slab.nused--;
+  itsNUsed--;
+  // Release an unused slab, but keep the last one to avoid thrashing.
+  if (slab.nused == 0  &&  itsSlabs.size() > 1) {
+    itsAvail.erase (iter->first);
+    unmapSlab (iter->first);
+    itsSlabs.erase (iter);
+  }
+}
+
+size_t SlabAllocator::nused() const
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  return itsNUsed;
+}
+
+size_t SlabAllocator::nslabs() const
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  return itsSlabs.size();
+}
+
+char* SlabAllocator::mapSlab()
+{
+  // Map an extra huge page to be able to align the slab.
+  size_t mapSize = itsSlabSize + HugePageSize;
+  void* ptr = ::mmap (0, mapSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) {
+    throw AipsError ("SlabAllocator: mmap of " +
+                     String::toString(mapSize) + " bytes failed: " +
+                     strerror(errno));
+  }
+  // Unmap the unaligned head and the remaining tail.
+  char* base  = static_cast<char*>(ptr);
+  char* start = base + (HugePageSize - size_t(base) % HugePageSize) %
+                       HugePageSize;
+  if (start > base) {
+    ::munmap (base, start - base);
+  }
+  char* end = start + itsSlabSize;
+  if (base + mapSize > end) {
+    ::munmap (end, base + mapSize - end);
+  }
+#ifdef MADV_HUGEPAGE
+  if (itsHugePages) {
+    // A failure (e.g. THP not configured) means normal pages are used.
+    ::madvise (start, itsSlabSize, MADV_HUGEPAGE);
+  }
+#endif
+  NumaMemory::place (start, itsSlabSize);
+  return start;
+}
+
+void SlabAllocator::unmapSlab (char* start)
+{
+  ::munmap (start, itsSlabSize);
+}
+
+
+} //# NAMESPACE CASACORE - END
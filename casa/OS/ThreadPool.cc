@@ -0,0 +1,265 @@
+//# ThreadPool.cc: Shared work-stealing pool of threads
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/OMP.h>
+#include <algorithm>
+#include <cstdlib>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# The pool and worker number of the current thread (if a worker).
+static thread_local ThreadPool* theirPool = 0;
+static thread_local uInt theirWorker = 0;
+
+// Get the default concurrency.
+// It is the number of usable cores (taking CPU affinity and a cgroup quota
+// into account), unless OMP_NUM_THREADS is set for OpenMP.
+static uInt defaultConcurrency()
+{
+  Int nthr = HostInfo::numCPUs();
+#ifdef _OPENMP
+  if (getenv("OMP_NUM_THREADS")  ||  nthr <= 0) {
+    nthr = OMP::maxThreads();
+  }
+#endif
+  return std::max (nthr, 1);
+}
+
+
+ThreadPool::ThreadPool (uInt nworkers)
+  : itsNTask (0),
+    itsNext  (0),
+    itsStop  (False)
+{
+  start (nworkers);
+}
+
+ThreadPool::~ThreadPool()
+{
+  stop();
+}
+
+ThreadPool& ThreadPool::global()
+{
+  static ThreadPool pool(defaultConcurrency() - 1);
+  return pool;
+}
+
+void ThreadPool::setConcurrency (uInt nthreads)
+{
+  if (nthreads == 0) {
+    nthreads = defaultConcurrency();
+  }
+  global().resize (nthreads - 1);
+  OMP::setNumThreads (nthreads);
+}
+
+uInt ThreadPool::concurrency()
+{
+  return global().nworkers() + 1;
+}
+
+Bool ThreadPool::inWorker()
+{
+  return theirPool != 0;
+}
+
+void ThreadPool::resize (uInt nworkers)
+{
+  if (nworkers != itsQueues.size()) {
+    stop();
+    start (nworkers);
+  }
+}
+
+void ThreadPool::start (uInt nworkers)
+{
+  itsStop = False;
+  itsQueues.reserve (nworkers);
+  for (uInt i=0; i<nworkers; ++i) {
+    itsQueues.push_back (std::unique_ptr<Queue>(new Queue()));
+  }
+  itsThreads.reserve (nworkers);
+  for (uInt i=0; i<nworkers; ++i) {
+    itsThreads.emplace_back (&ThreadPool::run, this, i);
+  }
+}
+
+void ThreadPool::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsStop = True;
+  }
+  itsCond.notify_all();
+  // The workers finish the remaining tasks before stopping.
+  for (std::thread& thr : itsThreads) {
+    thr.join();
+  }
+  itsThreads.clear();
+  itsQueues.clear();
+}
+
+void ThreadPool::push (Task task)
+{
+  // A worker of this pool adds to its own queue.
+  uInt q = (theirPool == this  ?  theirWorker :
+            uInt(itsNext++ % itsQueues.size()));
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsNTask++;
+  }
+  {
+    std::lock_guard<std::mutex> lock(itsQueues[q]->mutex);
+    itsQueues[q]->tasks.push_back (std::move(task));
+  }
+  itsCond.notify_one();
+}
+
+Bool ThreadPool::pop (uInt worker, Task& task)
+{
+  // Take the newest task from the own queue.
+  {
+    Queue& queue = *itsQueues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (! queue.tasks.empty()) {
+      task = std::move (queue.tasks.back());
+      queue.tasks.pop_back();
+      itsNTask--;
+      return True;
+    }
+  }
+  // Steal the oldest task from another queue.
+  uInt nq = itsQueues.size();
+  for (uInt i=1; i<nq; ++i) {
+    Queue& queue = *itsQueues[(worker+i) % nq];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (! queue.tasks.empty()) {
+      task = std::move (queue.tasks.front());
+      queue.tasks.pop_front();
+      itsNTask--;
+      return True;
+    }
+  }
+  return False;
+}
+
+void ThreadPool::run (uInt worker)
+{
+  theirPool   = this;
+  theirWorker = worker;
+  while (True) {
+    Task task;
+    if (pop (worker, task)) {
+      task();
+    } else {
+      std::unique_lock<std::mutex> lock(itsMutex);
+      itsCond.wait (lock, [this]() { return itsNTask > 0  ||  itsStop; });
+      if (itsStop  &&  itsNTask == 0) {
+        break;
+      }
+    }
+  }
+  theirPool = 0;
+}
+
+void ThreadPool::parallelFor (size_t n,
+                              const std::function<void(size_t)>& func,
+                              uInt maxThreads)
+{
+  // The state is shared with the helper tasks, because a helper task
+  // can start after parallelFor has finished.
+  struct State
+  {
+    std::atomic<size_t> next;
+    size_t n;
+    const std::function<void(size_t)>* func;
+    std::mutex mutex;
+    std::condition_variable cond;
+    uInt active;
+    std::exception_ptr error;
+
+    void work()
+    {
+      size_t i;
+      while ((i = next++) < n) {
+        try {
+          (*func)(i);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (! error) {
+            error = std::current_exception();
+          }
+          next = n;
+        }
+      }
+    }
+  };
+  uInt nthread = nworkers() + 1;
+  if (maxThreads > 0) {
+    nthread = std::min (nthread, maxThreads);
+  }
+  if (nthread <= 1  ||  n <= 1) {
+    for (size_t i=0; i<n; ++i) {
+      func (i);
+    }
+    return;
+  }
+  auto state = std::make_shared<State>();
+  state->next   = 0;
+  state->n      = n;
+  state->func   = &func;
+  state->active = 0;
+  size_t nhelp = std::min (size_t(nthread-1), n-1);
+  for (size_t i=0; i<nhelp; ++i) {
+    push ([state]() {
+        // Being active before taking an index guarantees that the
+        // calling thread waits for the index to be done.
+        {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          state->active++;
+        }
+        state->work();
+        {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          state->active--;
+        }
+        state->cond.notify_all();
+      });
+  }
+  // The calling thread takes part and waits for the active helpers.
+  // Helper tasks not started yet do not need to be waited for.
+  state->work();
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->cond.wait (lock, [&state]() { return state->active == 0; });
+  if (state->error) {
+    std::rethrow_exception (state->error);
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
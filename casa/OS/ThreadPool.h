@@ -0,0 +1,203 @@
+//# ThreadPool.h: Shared work-stealing pool of threads
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_THREADPOOL_H
+#define CASA_THREADPOOL_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// Shared work-stealing pool of threads
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tThreadPool" demos="">
+// </reviewed>
+
+// <synopsis>
+// ThreadPool is a pool of worker threads executing tasks. Each worker has
+// its own queue of tasks. A task submitted by a worker is added to its own
+// queue, other tasks are distributed over the queues. A worker takes the
+// newest task from its own queue; if empty, it steals the oldest task from
+// the queue of another worker.
+//
+// The function <src>parallelFor</src> executes a function for a range of
+// indices, where the indices are handed out dynamically. The calling thread
+// takes part in the work, so the number of threads used is at most the
+// number of workers plus one. Because parallelFor only waits for tasks
+// that already started, it can be used in a nested way (e.g. in a task
+// executed by the pool) without deadlock or creating extra threads.
+//
+// casacore uses a single global pool for its parallel code (sorting, table
+// selection and copying, compression). Its concurrency (the number of
+// threads including the calling thread) can be set by an application
+// using <src>setConcurrency</src>, which also sets the number of threads
+// used by OpenMP. Code running in a pool task uses a single OpenMP thread
+// (see <src>OMP::nMaxThreads</src>), so nested parallelism does not
+// oversubscribe the cores. Applications embedding casacore can submit
+// their own tasks to the global pool to share its threads.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   // Use at most 8 threads in casacore.
+//   ThreadPool::setConcurrency (8);
+//   // Square the values in parallel.
+//   std::vector<double> vec(1000000, 2.);
+//   ThreadPool::global().parallelFor (vec.size(),
+//                                     [&vec](size_t i) { vec[i] *= vec[i]; });
+//   // Run a task asynchronously.
+//   std::future<int> fut = ThreadPool::global().submit ([]() { return 1; });
+// </srcblock>
+// </example>
+
+// <motivation>
+// casacore used OpenMP and ad-hoc std::thread objects. Nested use of those
+// (and of the threads of applications) could start many more threads than
+// cores. A single pool with a settable concurrency avoids that.
+// </motivation>
+
+class ThreadPool
+{
+public:
+  // Create a pool with the given number of worker threads.
+  // 0 means that all tasks are executed by the calling thread.
+  explicit ThreadPool (uInt nworkers);
+
+  // Wait for all tasks to finish and stop the worker threads.
+  ~ThreadPool();
+
+  // Copying is not possible.
+  // <group>
+  ThreadPool (const ThreadPool&) = delete;
+  ThreadPool& operator= (const ThreadPool&) = delete;
+  // </group>
+
+  // Get the global pool used by casacore.
+  static ThreadPool& global();
+
+  // Set the concurrency of the global pool (i.e., its number of workers
+  // plus one) and of OpenMP. 0 means the default, which is OMP_NUM_THREADS
+  // if defined and OpenMP is used, otherwise the number of usable cores
+  // (see <src>HostInfo::numCPUs</src>).
+  // <br>It should not be done while tasks are being executed.
+  static void setConcurrency (uInt nthreads);
+
+  // Get the concurrency of the global pool.
+  static uInt concurrency();
+
+  // Is the current thread a worker thread of a pool?
+  static Bool inWorker();
+
+  // Get the number of worker threads.
+  uInt nworkers() const
+    { return itsQueues.size(); }
+
+  // Set the number of worker threads. It waits for the current tasks to
+  // finish.
+  void resize (uInt nworkers);
+
+  // Execute <src>func(i)</src> for i in [0,n) using at most
+  // <src>maxThreads</src> threads (including the calling thread).
+  // 0 means all workers plus the calling thread.
+  // It returns when all calls are done. If a call throws an exception,
+  // the other indices are not started anymore and the first exception
+  // is rethrown.
+  void parallelFor (size_t n, const std::function<void(size_t)>& func,
+                    uInt maxThreads=0);
+
+  // Submit a task to be executed by a worker thread. The returned future
+  // gives its result (or exception). If the pool has no workers, the task
+  // is executed immediately.
+  // <br>Note that a task should not wait for the result of another submitted
+  // task, because it might be queued behind itself; use parallelFor for
+  // nested parallelism.
+  template<typename Func>
+  auto submit (Func func) -> std::future<decltype(func())>
+  {
+    typedef decltype(func()) Result;
+    auto task = std::make_shared<std::packaged_task<Result()>> (func);
+    std::future<Result> result = task->get_future();
+    if (itsQueues.empty()) {
+      (*task)();
+    } else {
+      push ([task]() { (*task)(); });
+    }
+    return result;
+  }
+
+private:
+  typedef std::function<void()> Task;
+
+  // A queue of tasks of a worker.
+  struct Queue
+  {
+    std::mutex       mutex;
+    std::deque<Task> tasks;
+  };
+
+  // Start and stop the worker threads.
+  // <group>
+  void start (uInt nworkers);
+  void stop();
+  // </group>
+
+  // Add a task to a queue.
+  void push (Task task);
+
+  // Get a task for the given worker; first from its own queue, otherwise
+  // from another one. False is returned if no task is available.
+  Bool pop (uInt worker, Task& task);
+
+  // The loop executed by a worker thread.
+  void run (uInt worker);
+
+  std::vector<std::unique_ptr<Queue>> itsQueues;
+  std::vector<std::thread> itsThreads;
+  std::mutex              itsMutex;      //# guards the waiting for tasks
+  std::condition_variable itsCond;
+  std::atomic<size_t>     itsNTask;      //# nr of tasks in the queues
+  std::atomic<size_t>     itsNext;       //# round-robin queue for push
+  Bool                    itsStop;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
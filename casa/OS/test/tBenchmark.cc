@@ -0,0 +1,144 @@
+//# tBenchmark.cc: Test program for class Benchmark
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/OS/Benchmark.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace casacore;
+using namespace std;
+
+void testRun()
+{
+  const char* argv[] = {"tBenchmark", "--benchmark_filter=^copy",
+                        "--benchmark_min_time=0.01",
+                        "--benchmark_repetitions=3",
+                        "--benchmark_format=json", "myarg"};
+  Benchmark bench(6, argv);
+  AlwaysAssertExit (bench.arguments().size() == 1);
+  AlwaysAssertExit (bench.arguments()[0] == "myarg");
+  uInt nsetup = 0;
+  bench.add ("copy/1kB", [&nsetup](BenchmarkState& state) {
+      // Setup is not timed.
+      state.pauseTiming();
+      std::vector<char> in(1000, 'a');
+      nsetup++;
+      state.resumeTiming();
+      std::vector<char> out(in);
+      state.addBytes (out.size());
+      state.addItems (1);
+      state.addCounter ("setups", 2);
+    });
+  bench.add ("copy/skip", [](BenchmarkState& state) {
+      state.skip ("not available");
+    });
+  bench.add ("sleep", [](BenchmarkState&) {
+      std::this_thread::sleep_for (std::chrono::milliseconds(1));
+    });
+  AlwaysAssertExit (bench.size() == 3);
+  AlwaysAssertExit (bench.run() == 0);
+  AlwaysAssertExit (nsetup > 0);
+  // The sleep benchmark was filtered out; the skipped one has no results.
+  ostringstream json;
+  bench.write (json, "json");
+  String str(json.str());
+  AlwaysAssertExit (str.contains ("\"name\": \"copy/1kB\""));
+  AlwaysAssertExit (str.contains ("\"name\": \"copy/1kB_mean\""));
+  AlwaysAssertExit (str.contains ("\"name\": \"copy/1kB_median\""));
+  AlwaysAssertExit (str.contains ("\"repetition_index\": 2"));
+  AlwaysAssertExit (str.contains ("\"bytes_per_second\": "));
+  AlwaysAssertExit (str.contains ("\"casacore_version\": "));
+  // The counter is the average per iteration.
+  AlwaysAssertExit (str.contains ("\"setups\": 2,")  ||
+                    str.contains ("\"setups\": 2\n"));
+  AlwaysAssertExit (! str.contains ("sleep"));
+  AlwaysAssertExit (! str.contains ("copy/skip"));
+  ostringstream csv;
+  bench.write (csv, "csv");
+  AlwaysAssertExit (String(csv.str()).startsWith ("name,iterations,"));
+  // Header and 5 results.
+  AlwaysAssertExit (String(csv.str()).freq('\n') == 6);
+}
+
+void testMinTime()
+{
+  const char* argv[] = {"tBenchmark", "--benchmark_min_time=0.02"};
+  Benchmark bench(2, argv);
+  uInt64 niter = 0;
+  bench.add ("sleep", [&niter](BenchmarkState& state) {
+      std::this_thread::sleep_for (std::chrono::milliseconds(2));
+      niter = state.iterations() + 1;
+    });
+  AlwaysAssertExit (bench.run() == 0);
+  // At least 10 iterations are needed for 20 msec.
+  AlwaysAssertExit (niter >= 10);
+}
+
+void testErrors()
+{
+  // An exception in a benchmark is reported.
+  const char* argv[] = {"tBenchmark"};
+  Benchmark bench(1, argv);
+  bench.add ("throw", [](BenchmarkState&) {
+      throw AipsError ("test exception");
+    });
+  AlwaysAssertExit (bench.run() == 1);
+  // Invalid options.
+  const char* argv2[] = {"tBenchmark", "--benchmark_format=xml"};
+  Bool ok = False;
+  try {
+    Benchmark bench2(2, argv2);
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+  const char* argv3[] = {"tBenchmark", "--benchmark_unknown"};
+  ok = False;
+  try {
+    Benchmark bench3(2, argv3);
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+}
+
+int main()
+{
+  try {
+    testRun();
+    testMinTime();
+    testErrors();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
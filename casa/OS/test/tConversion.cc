@@ -29,6 +29,7 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <cstring>
 
 
 #include <casacore/casa/namespace.h>
@@ -68,6 +69,80 @@ void checkAll()
   }
 }
 
+// Check the partial conversions and copyBits for all bit offsets.
+void checkOffsets()
+{
+  cout << "checkOffsets ..." << endl;
+  uChar src[32];
+  for (uInt i=0; i<32; ++i) {
+    src[i] = (i*37 + 11) % 256;
+  }
+  // Expand the source bits in an unoptimized way.
+  Bool srcFlags[8*32];
+  for (uInt i=0; i<8*32; ++i) {
+    srcFlags[i] = (src[i/8] >> (i%8)) & 1;
+  }
+  for (uInt from=0; from<16; ++from) {
+    for (uInt to=0; to<16; ++to) {
+      for (uInt n=0; n<150; n+=7) {
+        // bitToBool with a start bit.
+        Bool flags[160];
+        Conversion::bitToBool (flags, src, from, n);
+        for (uInt i=0; i<n; ++i) {
+          AlwaysAssertExit (flags[i] == srcFlags[from+i]);
+        }
+        // boolToBit with a start bit must leave the other bits alone.
+        uChar out[32];
+        memset (out, 0xa5, sizeof(out));
+        Conversion::boolToBit (out, srcFlags+from, to, n);
+        // copyBits must give the same result.
+        uChar out2[32];
+        memset (out2, 0xa5, sizeof(out2));
+        Conversion::copyBits (out2, to, src, from, n);
+        for (uInt i=0; i<8*32; ++i) {
+          Bool exp = (i>=to && i<to+n) ? srcFlags[from+i-to] : (0xa5>>(i%8))&1;
+          AlwaysAssertExit (Bool((out[i/8] >> (i%8)) & 1) == exp);
+          AlwaysAssertExit (Bool((out2[i/8] >> (i%8)) & 1) == exp);
+        }
+      }
+    }
+  }
+  // copyBits can shift down in place.
+  uChar buf[32];
+  memcpy (buf, src, sizeof(buf));
+  Conversion::copyBits (buf, 3, buf, 13, 200);
+  for (uInt i=0; i<200; ++i) {
+    AlwaysAssertExit (Bool((buf[(i+3)/8] >> ((i+3)%8)) & 1) == srcFlags[i+13]);
+  }
+}
+
+// Check reverseBytes for various value sizes and lengths, also in place.
+void checkReverse()
+{
+  cout << "checkReverse ..." << endl;
+  uChar src[8*80+1];
+  for (uInt i=0; i<sizeof(src); ++i) {
+    src[i] = (i*13 + 5) % 256;
+  }
+  uInt sizes[] = {2, 3, 4, 8};
+  for (uInt size : sizes) {
+    for (uInt n=0; n<80; n+=3) {
+      // Use an unaligned input buffer.
+      uChar out[8*80];
+      Conversion::reverseBytes (out, src+1, n, size);
+      uChar inplace[8*80];
+      memcpy (inplace, src+1, n*size);
+      Conversion::reverseBytes (inplace, inplace, n, size);
+      for (uInt i=0; i<n; ++i) {
+        for (uInt j=0; j<size; ++j) {
+          AlwaysAssertExit (out[i*size + j] == src[1 + i*size + size-1-j]);
+          AlwaysAssertExit (inplace[i*size + j] == out[i*size + j]);
+        }
+      }
+    }
+  }
+}
+
 int main()
 {
     uInt nbool = 100;
@@ -153,6 +228,8 @@ int main()
     delete [] bits;
 
     checkAll();
+    checkOffsets();
+    checkReverse();
     cout << "OK" << endl;
     return 0;
 }
@@ -0,0 +1,84 @@
+//# tFileSync.cc: Test program for class FileSync
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/OS/FileSync.h>
+#include <casacore/casa/OS/Directory.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <fstream>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+void makeFiles (const String& dirName, uInt nfile)
+{
+  Directory dir(dirName);
+  dir.create();
+  for (uInt i=0; i<nfile; ++i) {
+    std::ofstream ofs((dirName + "/f" + String::toString(i)).c_str());
+    ofs << "file " << i << endl;
+  }
+}
+
+void testSync (Bool useSyncfs)
+{
+  FileSync::setUseSyncfs (useSyncfs);
+  AlwaysAssertExit (FileSync::useSyncfs() == useSyncfs);
+  std::vector<String> dirs;
+  dirs.push_back ("tFileSync_tmp.dir");
+  dirs.push_back ("tFileSync_tmp.dir/sub");
+  // Non-existing directories and files are ignored.
+  dirs.push_back ("tFileSync_tmp.nonexisting");
+  FileSync::syncDirectories (dirs);
+  std::vector<String> files;
+  files.push_back ("tFileSync_tmp.dir/f0");
+  files.push_back ("tFileSync_tmp.dir/sub");
+  files.push_back ("tFileSync_tmp.nonexisting");
+  FileSync::syncFiles (files);
+  FileSync::syncFiles (std::vector<String>(1, "tFileSync_tmp.dir/f1"));
+  FileSync::syncFiles (std::vector<String>());
+  // The contents must be unchanged.
+  RegularFile file("tFileSync_tmp.dir/sub/f2");
+  AlwaysAssertExit (file.size() == 7);
+}
+
+int main()
+{
+  try {
+    ThreadPool::setConcurrency (4);
+    makeFiles ("tFileSync_tmp.dir", 5);
+    makeFiles ("tFileSync_tmp.dir/sub", 3);
+    testSync (False);
+    testSync (True);
+    Directory("tFileSync_tmp.dir").removeRecursive();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
@@ -75,6 +75,17 @@ int main()
     Int memory = HostInfo::memoryTotal( );
     AlwaysAssertExit(memory == HostInfo::memoryTotal( )); // make sure no chang
 
+#if defined(AIPS_LINUX)
+    // The usable CPUs and memory (limited by affinity and cgroups)
+    // cannot exceed those of the host.
+    AlwaysAssertExit(cpus >= 1  &&  cpus <= sysconf(_SC_NPROCESSORS_CONF));
+    ptrdiff_t hostMemory = ptrdiff_t(sysconf(_SC_PHYS_PAGES)) *
+                           (sysconf(_SC_PAGESIZE) / 1024);
+    AlwaysAssertExit(HostInfo::memoryTotal() > 0  &&
+                     HostInfo::memoryTotal() <= hostMemory);
+    AlwaysAssertExit(HostInfo::memoryFree() <= HostInfo::memoryTotal());
+#endif
+
     Double now = HostInfo::secondsFrom1970();
     sleep(1);
     Double diff = HostInfo::secondsFrom1970() - now;
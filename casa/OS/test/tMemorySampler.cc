@@ -0,0 +1,155 @@
+//# tMemorySampler.cc: Test program for class MemorySampler
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/OS/MemorySampler.h>
+#include <casacore/casa/OS/MemoryTrace.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <sstream>
+#include <thread>
+
+#include <casacore/casa/namespace.h>
+
+// Sample every allocation and check the tags.
+void testAll()
+{
+  MemorySampler::clear();
+  MemorySampler::start (1);
+  AlwaysAssertExit (MemorySampler::isOn());
+  AlwaysAssertExit (MemorySampler::sampleInterval() == 1);
+  {
+    Array<Double> arr1(IPosition(2,10,10));
+    Block<Int> blk;
+    {
+      MemoryTraceBlock outer("outer");
+      AlwaysAssertExit (MemorySampler::currentTag() == "outer");
+      blk.resize (1000);
+      {
+        MemoryTraceBlock inner("inner");
+        AlwaysAssertExit (MemorySampler::currentTag() == "outer/inner");
+        Array<Float> arr2(IPosition(1,500));
+        std::map<String,Double> tags = MemorySampler::liveBytesPerTag();
+        AlwaysAssertExit (tags.size() == 3);
+        AlwaysAssertExit (near (tags[""], 800.));
+        AlwaysAssertExit (near (tags["outer"], 4000.));
+        AlwaysAssertExit (near (tags["outer/inner"], 2000.));
+        AlwaysAssertExit (near (MemorySampler::liveBytes(), 6800.));
+      }
+      AlwaysAssertExit (MemorySampler::currentTag() == "outer");
+    }
+    AlwaysAssertExit (MemorySampler::currentTag() == "");
+    // Stop sampling, so the Record's Blocks are not sampled.
+    MemorySampler::stop();
+    AlwaysAssertExit (! MemorySampler::isOn());
+    // arr2 has been freed.
+    Record rec = MemorySampler::toRecord();
+    AlwaysAssertExit (rec.nfields() == 2);
+    AlwaysAssertExit (near (rec.subRecord("untagged").asDouble("bytes"), 800.));
+    AlwaysAssertExit (rec.subRecord("outer").asInt("nsamples") == 1);
+    std::vector<MemorySampler::Sample> samples = MemorySampler::snapshot();
+    AlwaysAssertExit (samples.size() == 2);
+    for (const MemorySampler::Sample& s : samples) {
+      AlwaysAssertExit (s.size == 800  ||  s.size == 4000);
+    }
+    std::ostringstream os;
+    MemorySampler::show (os, 2);
+    AlwaysAssertExit (os.str().find ("outer") != std::string::npos);
+  }
+  // All memory has been freed.
+  AlwaysAssertExit (MemorySampler::snapshot().empty());
+  AlwaysAssertExit (MemorySampler::liveBytes() == 0);
+}
+
+// Sample with a larger interval and check if the estimate is reasonable.
+void testEstimate()
+{
+  MemorySampler::clear();
+  MemorySampler::start (4096);
+  std::vector<Array<Float>> arrays;
+  for (uInt i=0; i<4000; ++i) {
+    arrays.push_back (Array<Float>(IPosition(1, 64 + i%256)));
+  }
+  Double expected = 0;
+  for (const Array<Float>& arr : arrays) {
+    expected += arr.size() * sizeof(Float);
+  }
+  Double estimate = MemorySampler::liveBytes();
+  AlwaysAssertExit (estimate > 0.8*expected  &&  estimate < 1.2*expected);
+  // Large allocations are always sampled.
+  {
+    Block<Double> large(1000000);
+    AlwaysAssertExit (MemorySampler::liveBytes() >= estimate + 8000000);
+  }
+  arrays.clear();
+  AlwaysAssertExit (MemorySampler::liveBytes() == 0);
+  // Memory freed after stopping is removed from the samples.
+  Array<Double> arr(IPosition(1,100000));
+  MemorySampler::stop();
+  AlwaysAssertExit (MemorySampler::snapshot().size() == 1);
+  arr.resize();
+  AlwaysAssertExit (MemorySampler::snapshot().empty());
+}
+
+// Allocate in several threads, freeing in another thread.
+void testThreads()
+{
+  MemorySampler::clear();
+  MemorySampler::start (1);
+  std::vector<Array<Int>> arrays(4);
+  std::vector<std::thread> threads;
+  for (uInt i=0; i<arrays.size(); ++i) {
+    threads.push_back (std::thread([&arrays, i] {
+          MemoryTraceBlock block("thread");
+          arrays[i].resize (IPosition(1, 1000));
+        }));
+  }
+  for (std::thread& thr : threads) {
+    thr.join();
+  }
+  std::map<String,Double> tags = MemorySampler::liveBytesPerTag();
+  AlwaysAssertExit (tags.size() == 1);
+  AlwaysAssertExit (near (tags["thread"], 16000.));
+  arrays.clear();
+  AlwaysAssertExit (MemorySampler::liveBytes() == 0);
+  MemorySampler::stop();
+}
+
+int main()
+{
+  try {
+    testAll();
+    testEstimate();
+    testThreads();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
@@ -0,0 +1,90 @@
+//# tNumaMemory.cc: Test program for class NumaMemory
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/OS/NumaMemory.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <cstring>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+void testPlace (NumaMemory::Policy policy)
+{
+  // Unaligned and small buffers must be handled.
+  const size_t nbytes = 1024*1024 + 13;
+  std::vector<char> buf(nbytes + 1, 1);
+  NumaMemory::place (buf.data() + 1, nbytes, policy);
+  NumaMemory::place (buf.data() + 1, 10, policy);
+  // Placing a new buffer must not change its contents it is filled with.
+  char* ptr = new char[nbytes];
+  NumaMemory::place (ptr, nbytes, policy);
+  memset (ptr, 3, nbytes);
+  for (size_t i=0; i<nbytes; ++i) {
+    AlwaysAssertExit (ptr[i] == 3);
+  }
+  delete [] ptr;
+}
+
+void testArrays (NumaMemory::Policy policy)
+{
+  // Apply the policy to all arrays.
+  NumaMemory::setPolicy (policy, 1);
+  AlwaysAssertExit (NumaMemory::policy() == policy);
+  AlwaysAssertExit (NumaMemory::minBytes() == 1);
+  Array<Double> arr(IPosition(2, 1000, 300));
+  indgen (arr);
+  AlwaysAssertExit (arr.data()[0] == 0  &&  arr.data()[299999] == 299999);
+  Array<Int> arr2(IPosition(1, 3), 7);
+  AlwaysAssertExit (allEQ (arr2, 7));
+  NumaMemory::setPolicy (NumaMemory::Default);
+  AlwaysAssertExit (NumaMemory::minBytes() == 4*1024*1024);
+}
+
+int main()
+{
+  try {
+    cout << "NUMA nodes: " << NumaMemory::nnodes() << endl;
+    AlwaysAssertExit (NumaMemory::nnodes() >= 1);
+    AlwaysAssertExit (NumaMemory::policy() == NumaMemory::Default);
+    // Use multiple threads to test Spread.
+    ThreadPool::setConcurrency (4);
+    for (NumaMemory::Policy policy : {NumaMemory::Default,
+                                      NumaMemory::Interleave,
+                                      NumaMemory::Spread}) {
+      testPlace (policy);
+      testArrays (policy);
+    }
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
@@ -0,0 +1,107 @@
+//# tProfileRegistry.cc: Test program for class ProfileRegistry
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/casa/OS/ProfileRegistry.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace casacore;
+using namespace std;
+
+void testCount()
+{
+  ProfileCounter& cnt = ProfileRegistry::counter ("tProfileRegistry.count");
+  AlwaysAssertExit (&cnt == &ProfileRegistry::counter ("tProfileRegistry.count"));
+  AlwaysAssertExit (cnt.name() == "tProfileRegistry.count");
+  // Count in parallel.
+  std::vector<std::thread> threads;
+  for (int i=0; i<4; ++i) {
+    threads.push_back (std::thread([&cnt]() {
+          for (int j=0; j<10000; ++j) cnt.add();
+        }));
+  }
+  for (std::thread& thr : threads) {
+    thr.join();
+  }
+  AlwaysAssertExit (cnt.count() == 40000);
+  // Nothing is counted if disabled.
+  ProfileRegistry::setEnabled (False);
+  cnt.add (5);
+  AlwaysAssertExit (cnt.count() == 40000);
+  ProfileRegistry::setEnabled (True);
+  cnt.add (5);
+  AlwaysAssertExit (cnt.count() == 40005);
+}
+
+void testTimer()
+{
+  ProfileCounter& cnt = ProfileRegistry::counter ("tProfileRegistry.timer");
+  for (int i=0; i<3; ++i) {
+    ProfileTimer timer(cnt);
+    std::this_thread::sleep_for (std::chrono::milliseconds(2));
+  }
+  AlwaysAssertExit (cnt.count() == 3);
+  AlwaysAssertExit (cnt.seconds() >= 0.006  &&  cnt.seconds() < 10);
+}
+
+void testExport()
+{
+  Record rec = ProfileRegistry::toRecord();
+  AlwaysAssertExit (rec.isDefined ("tProfileRegistry.count"));
+  const Record& sub = rec.subRecord ("tProfileRegistry.count");
+  AlwaysAssertExit (sub.asInt64("count") == 40005);
+  AlwaysAssertExit (sub.asDouble("time") == 0);
+  String prom = ProfileRegistry::toPrometheus ("casa");
+  AlwaysAssertExit (prom.contains ("# TYPE casa_calls_total counter\n"));
+  AlwaysAssertExit (prom.contains
+                    ("casa_calls_total{name=\"tProfileRegistry.count\"} 40005\n"));
+  AlwaysAssertExit (prom.contains
+                    ("casa_calls_total{name=\"tProfileRegistry.timer\"} 3\n"));
+  AlwaysAssertExit (prom.contains
+                    ("casa_seconds_total{name=\"tProfileRegistry.count\"} 0\n"));
+  ProfileRegistry::reset();
+  AlwaysAssertExit (ProfileRegistry::counter("tProfileRegistry.count").count() == 0);
+  AlwaysAssertExit (ProfileRegistry::counter("tProfileRegistry.timer").seconds() == 0);
+}
+
+int main()
+{
+  try {
+    AlwaysAssertExit (ProfileRegistry::enabled());
+    testCount();
+    testTimer();
+    testExport();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,139 @@
+//# tSlabAllocator.cc: Test program for class SlabAllocator
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/OS/SlabAllocator.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <cstring>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+void testSmall (Bool useHugePages)
+{
+  // Many buffers fit in a slab.
+  SlabAllocator alloc(1000, useHugePages);
+  AlwaysAssertExit (alloc.bufferSize() == 1000);
+  AlwaysAssertExit (alloc.slabSize() == SlabAllocator::HugePageSize);
+  AlwaysAssertExit (alloc.useHugePages() == useHugePages);
+  const size_t nperSlab = SlabAllocator::HugePageSize / 1024;
+  std::vector<char*> bufs;
+  for (size_t i=0; i<2*nperSlab+1; ++i) {
+    char* buf = alloc.allocate();
+    // A buffer is aligned and does not overlap others.
+    AlwaysAssertExit (size_t(buf) % 64 == 0);
+    memset (buf, int(i%128), 1000);
+    bufs.push_back (buf);
+  }
+  AlwaysAssertExit (alloc.nused() == bufs.size());
+  AlwaysAssertExit (alloc.nslabs() == 3);
+  for (size_t i=0; i<bufs.size(); ++i) {
+    AlwaysAssertExit (bufs[i][0] == char(i%128)  &&
+                      bufs[i][999] == char(i%128));
+  }
+  // A freed buffer is reused.
+  char* last = bufs.back();
+  alloc.deallocate (last);
+  AlwaysAssertExit (alloc.allocate() == last);
+  // Freeing all buffers releases all slabs but one.
+  for (char* buf : bufs) {
+    alloc.deallocate (buf);
+  }
+  AlwaysAssertExit (alloc.nused() == 0);
+  AlwaysAssertExit (alloc.nslabs() == 1);
+  // Unknown buffers are detected.
+  char other[10];
+  Bool caught = False;
+  try {
+    alloc.deallocate (other);
+  } catch (const AipsError&) {
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+  char* buf = alloc.allocate();
+  caught = False;
+  try {
+    alloc.deallocate (buf+1);
+  } catch (const AipsError&) {
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+  alloc.deallocate (buf);
+}
+
+void testLarge()
+{
+  // A buffer larger than a huge page uses a slab of its own.
+  const size_t size = 3*1024*1024 + 5;
+  SlabAllocator alloc(size, True);
+  AlwaysAssertExit (alloc.slabSize() == 2*SlabAllocator::HugePageSize);
+  char* buf1 = alloc.allocate();
+  char* buf2 = alloc.allocate();
+  AlwaysAssertExit (size_t(buf1) % SlabAllocator::HugePageSize == 0);
+  AlwaysAssertExit (size_t(buf2) % SlabAllocator::HugePageSize == 0);
+  AlwaysAssertExit (alloc.nslabs() == 2);
+  memset (buf1, 1, size);
+  memset (buf2, 2, size);
+  AlwaysAssertExit (buf1[size-1] == 1  &&  buf2[0] == 2);
+  alloc.deallocate (buf1);
+  alloc.deallocate (buf2);
+  AlwaysAssertExit (alloc.nslabs() == 1);
+}
+
+void testThreads()
+{
+  // Allocate and free in parallel.
+  SlabAllocator alloc(4096, True);
+  ThreadPool pool(3);
+  pool.parallelFor (8, [&alloc](size_t i) {
+      std::vector<char*> bufs;
+      for (size_t j=0; j<1000; ++j) {
+        bufs.push_back (alloc.allocate());
+        memset (bufs.back(), int(i), 4096);
+      }
+      for (char* buf : bufs) {
+        AlwaysAssertExit (buf[0] == char(i)  &&  buf[4095] == char(i));
+        alloc.deallocate (buf);
+      }
+    });
+  AlwaysAssertExit (alloc.nused() == 0);
+}
+
+int main()
+{
+  try {
+    testSmall (False);
+    testSmall (True);
+    testLarge();
+    testThreads();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
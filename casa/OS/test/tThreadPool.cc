@@ -0,0 +1,162 @@
+//# tThreadPool.cc: Test program for class ThreadPool
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+void testParallelFor (ThreadPool& pool)
+{
+  const size_t n = 10000;
+  std::vector<Int> vec(n, 0);
+  pool.parallelFor (n, [&vec](size_t i) { vec[i] += Int(i); });
+  for (size_t i=0; i<n; ++i) {
+    AlwaysAssertExit (vec[i] == Int(i));
+  }
+  // Limit the number of threads.
+  std::mutex mutex;
+  std::set<std::thread::id> ids;
+  pool.parallelFor (n, [&](size_t) {
+      std::lock_guard<std::mutex> lock(mutex);
+      ids.insert (std::this_thread::get_id());
+    }, 2);
+  AlwaysAssertExit (ids.size() >= 1  &&  ids.size() <= 2);
+  ids.clear();
+  pool.parallelFor (n, [&](size_t) {
+      std::lock_guard<std::mutex> lock(mutex);
+      ids.insert (std::this_thread::get_id());
+    }, 1);
+  AlwaysAssertExit (ids.size() == 1  &&
+                    *ids.begin() == std::this_thread::get_id());
+  // Empty range.
+  pool.parallelFor (0, [](size_t) { throw AipsError("not expected"); });
+}
+
+void testException (ThreadPool& pool)
+{
+  std::atomic<size_t> ndone(0);
+  Bool caught = False;
+  try {
+    pool.parallelFor (1000, [&ndone](size_t i) {
+        if (i == 10) {
+          throw AipsError ("index 10");
+        }
+        ndone++;
+      });
+  } catch (const AipsError& x) {
+    AlwaysAssertExit (String(x.what()).contains ("index 10"));
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+  AlwaysAssertExit (ndone < 1000);
+}
+
+void testNested (ThreadPool& pool)
+{
+  // Nested parallel loops must not deadlock and must do all work.
+  std::atomic<size_t> sum(0);
+  pool.parallelFor (20, [&](size_t i) {
+      pool.parallelFor (100, [&](size_t j) { sum += i*100 + j; });
+    });
+  AlwaysAssertExit (sum == 2000*1999/2);
+}
+
+void testSubmit (ThreadPool& pool)
+{
+  std::vector<std::future<Int>> futs;
+  for (Int i=0; i<50; ++i) {
+    futs.push_back (pool.submit ([i]() { return i*i; }));
+  }
+  for (Int i=0; i<50; ++i) {
+    AlwaysAssertExit (futs[i].get() == i*i);
+  }
+  std::future<Bool> fut = pool.submit ([]() {
+      return ThreadPool::inWorker();
+    });
+  AlwaysAssertExit (fut.get() == (pool.nworkers() > 0));
+  // An exception is passed through the future.
+  std::future<void> futex = pool.submit ([]() { throw AipsError("task"); });
+  Bool caught = False;
+  try {
+    futex.get();
+  } catch (const AipsError&) {
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+}
+
+void testPool (uInt nworkers)
+{
+  ThreadPool pool(nworkers);
+  AlwaysAssertExit (pool.nworkers() == nworkers);
+  testParallelFor (pool);
+  testException (pool);
+  testNested (pool);
+  testSubmit (pool);
+  pool.resize (nworkers+1);
+  AlwaysAssertExit (pool.nworkers() == nworkers+1);
+  testParallelFor (pool);
+}
+
+void testGlobal()
+{
+  ThreadPool::setConcurrency (3);
+  AlwaysAssertExit (ThreadPool::concurrency() == 3);
+  AlwaysAssertExit (ThreadPool::global().nworkers() == 2);
+  AlwaysAssertExit (! ThreadPool::inWorker());
+  // Code in a task uses a single OpenMP thread.
+  std::future<uInt> fut = ThreadPool::global().submit ([]() {
+      return OMP::nMaxThreads();
+    });
+  AlwaysAssertExit (fut.get() == 1);
+  ThreadPool::setConcurrency (1);
+  AlwaysAssertExit (ThreadPool::concurrency() == 1);
+  testParallelFor (ThreadPool::global());
+  ThreadPool::setConcurrency (0);
+  AlwaysAssertExit (ThreadPool::concurrency() >= 1);
+}
+
+int main()
+{
+  try {
+    testPool (0);
+    testPool (1);
+    testPool (4);
+    testGlobal();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
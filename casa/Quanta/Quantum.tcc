@@ -97,7 +97,10 @@ Quantum<Qtype> Quantum<Qtype>::operator-() const{
 
 template <class Qtype>
 Quantum<Qtype> &Quantum<Qtype>::operator+=(const Quantum<Qtype> &other) {
-    if (qUnit.getValue() != other.qUnit.getValue()) {
+    // Fast path for identical units (no conversion needed).
+    if (qUnit.getName() == other.qUnit.getName()) {
+        qVal += other.qVal;
+    } else if (qUnit.getValue() != other.qUnit.getValue()) {
 	throw (AipsError("Quantum::operator+ unequal units '" +
 			 qUnit.getName() + ", '" + 
 			 other.qUnit.getName() + "'"));
@@ -116,7 +119,10 @@ Quantum<Qtype> &Quantum<Qtype>::operator+=(const Qtype &other) {
 
 template <class Qtype>
 Quantum<Qtype> &Quantum<Qtype>::operator-=(const Quantum<Qtype> &other) {
-    if (qUnit.getValue() != other.qUnit.getValue()) {
+    // Fast path for identical units (no conversion needed).
+    if (qUnit.getName() == other.qUnit.getName()) {
+        qVal -= other.qVal;
+    } else if (qUnit.getValue() != other.qUnit.getValue()) {
 	throw (AipsError("Quantum::operator- unequal units '" +
 			 qUnit.getName() + ", '" + 
 			 other.qUnit.getName() + "'"));
@@ -140,7 +146,10 @@ Quantum<Qtype> &Quantum<Qtype>::operator*=(const Quantum<Qtype> &other) {
 	if (qUnit.getName().empty()) {
 	    qUnit = other.qUnit;
 	} else {
-	    qUnit = Unit(qUnit.getName() + ("." + other.qUnit.getName()));
+	    // Both names are valid and normalized, so the product does not
+	    // need to be parsed.
+	    qUnit.setValue (qUnit.getValue() * other.qUnit.getValue());
+	    qUnit.setName (qUnit.getName() + ("." + other.qUnit.getName()));
 	}
     }
     return *this;
@@ -156,12 +165,15 @@ template <class Qtype>
 Quantum<Qtype> &Quantum<Qtype>::operator/=(const Quantum<Qtype> &other) {
     qVal /= (other.qVal);
     if (!(other.qUnit.getName().empty())) {
+	// Both names are valid and normalized, so the quotient does not
+	// need to be parsed.
+	qUnit.setValue (qUnit.getValue() / other.qUnit.getValue());
 	if (qUnit.getName().empty()) {
-	    qUnit = Unit(String("(") + other.qUnit.getName() +
-			 String(")-1"));
+	    qUnit.setName (String("(") + other.qUnit.getName() +
+			   String(")-1"));
 	} else {
-	    qUnit = Unit(qUnit.getName() +
-			 ("/(" + other.qUnit.getName() + ")"));
+	    qUnit.setName (qUnit.getName() +
+			   ("/(" + other.qUnit.getName() + ")"));
 	}
     }
     return *this;
@@ -220,8 +232,8 @@ Qtype & Quantum<Qtype>::getValue() {
 
 template <class Qtype>
 Qtype Quantum<Qtype>::getValue(const Unit &other, Bool requireConform) const {
-    UnitVal myType = qUnit.getValue();
-    UnitVal otherType = other.getValue();
+    const UnitVal& myType = qUnit.getValue();
+    const UnitVal& otherType = other.getValue();
 	Double myFac = myType.getFac();
 	Double otherFac = otherType.getFac();
 	Double d1 = otherFac/myFac;
@@ -311,6 +323,10 @@ void Quantum<Qtype>::convert() {
 
 template <class Qtype>
 void Quantum<Qtype>::convert(const Unit &s) {
+    if (qUnit.getName() == s.getName()) {
+      // Already in the requested unit.
+      return;
+    }
     if (qUnit.getValue() == s.getValue()) {
       // To suppress some warnings, next statement not used
       //	qVal *= (qUnit.getValue().getFac()/s.getValue().getFac());
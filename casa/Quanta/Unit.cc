@@ -27,10 +27,12 @@
 
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Quanta/Unit.h>
+#include <casacore/casa/Quanta/UnitMap.h>
 #include <casacore/casa/Utilities/Regex.h>
 #include <casacore/casa/OS/malloc.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unordered_map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -215,8 +217,43 @@ void pass_two( char *source, char *dest )
 }
 
 
+namespace {
+  // A unit string parsed before.
+  struct ParsedUnit {
+    String  name;
+    UnitVal value;
+  };
+  // The per-thread cache of parsed unit strings. It does not need locking.
+  // It is cleared if the UnitMap cache is cleared, thus if unit
+  // definitions change.
+  struct ParsedUnitCache {
+    uInt generation = 0;
+    std::unordered_map<std::string, ParsedUnit> units;
+  };
+  thread_local ParsedUnitCache theirParsedUnits;
+}
+
 void Unit::check()
 {
+  // Usually the same unit strings are used over and over again, so first
+  // look if already parsed in this thread.
+  ParsedUnitCache& cache = theirParsedUnits;
+  uInt generation = UnitMap::cacheGeneration();
+  if (cache.generation != generation) {
+    cache.units.clear();
+    cache.generation = generation;
+  }
+  auto iter = cache.units.find (uName);
+  if (iter != cache.units.end()) {
+    uName = iter->second.name;
+    uVal  = iter->second.value;
+    return;
+  }
+  // Limit the size of the cache (in case many different strings are used).
+  if (cache.units.size() >= 1000) {
+    cache.units.clear();
+  }
+  String origName (uName);
   if (!UnitVal::check(uName, uVal)) {
     throw (AipsError("Unit::check Illegal unit string '" +
 		     uName + "'"));
@@ -241,6 +278,7 @@ void Unit::check()
     free(b1);
     free(b2);
   }
+  cache.units.emplace (origName, ParsedUnit{uName, uVal});
 }
 
 } //# NAMESPACE CASACORE - END
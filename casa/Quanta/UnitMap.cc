@@ -34,6 +34,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 // Initialize statics.
 std::mutex UnitMap::fitsMutex;
+std::mutex UnitMap::cacheMutex;
+std::atomic<uInt> UnitMap::cacheGen (0);
 
 
   
@@ -44,6 +46,7 @@ UnitMap::~UnitMap() {
 }
 
 Bool UnitMap::getCache(const String& s, UnitVal &val) {
+  std::lock_guard<std::mutex> lock(cacheMutex);
   map<String, UnitVal>& mapCache = getMapCache();
   map<String, UnitVal>::iterator pos = mapCache.find(s);
   if (pos == mapCache.end()) {
@@ -86,6 +89,7 @@ Bool UnitMap::getUnit(const String& s, UnitName &name, UMaps* maps) {
 }
 
 void UnitMap::putCache(const String& s, const UnitVal& val) {
+  std::lock_guard<std::mutex> lock(cacheMutex);
   map<String, UnitVal>& mapCache = getMapCache();
   if (! s.empty()) {
     mapCache.insert(map<String, UnitVal>::value_type(s,val));
@@ -259,7 +263,9 @@ Unit UnitMap::toFITS(const Unit &un) {
 }
 
 void UnitMap::clearCache() {
+  std::lock_guard<std::mutex> lock(cacheMutex);
   getMapCache().clear();
+  cacheGen++;
 }
 
 void UnitMap::listPref() {
@@ -345,6 +351,7 @@ void UnitMap::listCache() {
 }
 
 void UnitMap::listCache(ostream &os) {
+  std::lock_guard<std::mutex> lock(cacheMutex);
   map<String, UnitVal>& mapCache = getMapCache();
   os  << "Cached unit table (" << mapCache.size() << "):" << endl;
   for (map<String, UnitVal>::iterator i=mapCache.begin();
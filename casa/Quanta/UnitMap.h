@@ -36,6 +36,7 @@
 #include <casacore/casa/Quanta/UnitVal.h>
 #include <casacore/casa/Quanta/UnitName.h>
 
+#include <atomic>
 #include <mutex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -181,6 +182,10 @@ const uInt N_FITS = 19;
 // <srcblock>
 // UnitMap::clearCache();
 // </srcblock>
+// The cache is thread-safe. Clearing it increments a generation number,
+// which makes it possible to keep a per-thread cache of parsed units (as
+// the class <linkto class=Unit>Unit</linkto> does) that is invalidated
+// if unit definitions change.
 // </synopsis> 
 //
 // <example>
@@ -253,6 +258,11 @@ public:
 // Clear out the cache
     static void clearCache();
 
+// Get the generation number of the cache. It is incremented each time
+// the cache is cleared.
+    static uInt cacheGeneration()
+      { return cacheGen.load (std::memory_order_acquire); }
+
 // Define FITS related unit names
     static void addFITS();
 
@@ -332,6 +342,9 @@ public:
   UnitMap &operator=(const UnitMap &other);
   
   static std::mutex fitsMutex;
+  // Mutex and generation number of the cache.
+  static std::mutex cacheMutex;
+  static std::atomic<uInt> cacheGen;
   
   //# member functions
   // Get the static UMaps struct.
@@ -35,6 +35,9 @@
 #include <casacore/casa/Quanta/QC.h>
 #include <casacore/casa/Quanta/UnitMap.h>
 #include <casacore/casa/iostream.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include <casacore/casa/namespace.h>
 int main ()
@@ -321,6 +324,67 @@ try {
         copy_assigned.getValue()[0] = 100;
         AlwaysAssert(original.getValue()[0] == 1, AipsError);
     }
+    // Units of products and quotients are made without parsing; they must
+    // match the parsed units.
+    {
+        Quantum<Double> a(2, "km/s"), b(3, "m"), c(4, "s2");
+        Quantum<Double> q = a*b;
+        AlwaysAssert(q.getFullUnit().getName() == "km/s.m", AipsError);
+        AlwaysAssert(q.getFullUnit() == Unit("km/s.m"), AipsError);
+        AlwaysAssert(near(q.getFullUnit().getValue().getFac(),
+                          Unit("km/s.m").getValue().getFac()), AipsError);
+        q = a/c;
+        AlwaysAssert(q.getFullUnit().getName() == "km/s/(s2)", AipsError);
+        AlwaysAssert(q.getFullUnit() == Unit("km/s/(s2)"), AipsError);
+        AlwaysAssert(near(q.getValue("m.s-3"), 500.), AipsError);
+        q = Quantum<Double>(2) / c;
+        AlwaysAssert(q.getFullUnit() == Unit("s-2"), AipsError);
+        AlwaysAssert(near(q.getValue("s-2"), 0.5), AipsError);
+        // Identical units need no conversion.
+        Quantum<Double> d(5, "km/s");
+        d += a;
+        AlwaysAssert(d.getValue() == 7, AipsError);
+        d -= Quantum<Double>(1000, "m/s");
+        AlwaysAssert(near(d.getValue(), 6.), AipsError);
+        d.convert(Unit("km/s"));
+        AlwaysAssert(near(d.getValue(), 6.), AipsError);
+    }
+
+    // Redefining a unit invalidates the cached parsed units.
+    {
+        UnitMap::putUser("tqunit", UnitVal(2., "m"));
+        AlwaysAssert(near(Quantum<Double>(1, "tqunit").getValue("m"), 2.),
+                     AipsError);
+        UnitMap::removeUser("tqunit");
+        UnitMap::putUser("tqunit", UnitVal(3., "m"));
+        AlwaysAssert(near(Quantum<Double>(1, "tqunit").getValue("m"), 3.),
+                     AipsError);
+        UnitMap::removeUser("tqunit");
+    }
+
+    // Units can be parsed in parallel.
+    {
+        std::vector<std::thread> threads;
+        std::atomic<Int> nerr(0);
+        for (Int i=0; i<4; ++i) {
+            threads.push_back(std::thread([&nerr, i] {
+                const char* names[] = {"km/s", "cm", "m/s", "mm"};
+                for (Int j=0; j<1000; ++j) {
+                    Int k = (i+j) % 4;
+                    Unit u(names[k]);
+                    if (u.getValue() != (k%2 == 0 ?
+                                         UnitVal::LENGTH/UnitVal::TIME :
+                                         UnitVal::LENGTH)) {
+                        nerr++;
+                    }
+                }
+            }));
+        }
+        for (std::thread& thr : threads) {
+            thr.join();
+        }
+        AlwaysAssert(nerr == 0, AipsError);
+    }
     cout << endl << "--------------------------" << endl;
     return 0;
 }
@@ -40,22 +40,58 @@
 #include <casacore/casa/fstream.h>
 #include <casacore/casa/sstream.h>
 
+#include <algorithm>
+
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
-// This is the function that does most of the work. It is pretty slow for
-// large maps, but no real problem.
+// This is the function that does most of the work. The first matching
+// pattern at or after start wins; an exact keyword is found with a single
+// hash probe, so only the wildcard patterns before it need a Regex match.
 
 Bool Aipsrc::matchKeyword(uInt &where,  const String &keyword,
 			  uInt start) {
-  for (uInt i=start; i<keywordPattern.nelements(); i++) {
-     if (keyword.contains(Regex(keywordPattern[i]))) {
-       where = i;
-       return True;
-     }
-   }
-   return False;
+  uInt end = keywordPattern.nelements();
+  std::unordered_map<String, std::vector<uInt>,
+                     std::hash<std::string> >::const_iterator iter =
+    exactIndex.find(keyword);
+  if (iter != exactIndex.end()) {
+    std::vector<uInt>::const_iterator inx =
+      std::lower_bound(iter->second.begin(), iter->second.end(), start);
+    if (inx != iter->second.end()) {
+      end = *inx;
+    }
+  }
+  for (std::vector<std::pair<uInt, Regex> >::const_iterator
+         wild = wildIndex.begin(); wild != wildIndex.end(); ++wild) {
+    if (wild->first >= end) {
+      break;
+    }
+    if (wild->first >= start  &&  keyword.contains(wild->second)) {
+      where = wild->first;
+      return True;
+    }
+  }
+  if (end < keywordPattern.nelements()) {
+    where = end;
+    return True;
+  }
+  return False;
 } 
 
+void Aipsrc::makeIndex(const Block<String> &keywords) {
+  exactIndex.clear();
+  wildIndex.clear();
+  for (uInt i=0; i<keywords.nelements(); i++) {
+    // Only a '.' is escaped in the pattern; any other special character
+    // makes it a real regular expression.
+    if (keywords[i].find_first_of("*+?()[]{}|^$\\") == String::npos) {
+      exactIndex[keywords[i]].push_back(i);
+    } else {
+      wildIndex.push_back(std::make_pair(i, Regex(keywordPattern[i])));
+    }
+  }
+}
+
 Bool Aipsrc::find(String &value,	
 		  const String &keyword,
 		  uInt start) {
@@ -443,6 +479,7 @@ void Aipsrc::doParse(String &fileList) {
   const String gs01("\\.");
   const String gs10("*");
   const String gs11(".*");
+  Block<String> keywords(keywordPattern);
   String keyword;
   for (Int i=0; i<nkw; i++) {
     keyword = keywordPattern[i];
@@ -450,6 +487,7 @@ void Aipsrc::doParse(String &fileList) {
     keyword.gsub(gs10, gs11);
     keywordPattern[i] = String("^") + keyword + String("$");
   }
+  makeIndex(keywords);
 }
 
 uInt Aipsrc::genParse(Block<String> &keywordPattern, 
@@ -632,6 +670,9 @@ Bool Aipsrc::genGet(String &val, Vector<String> &namlst, Vector<String> &vallst,
   Double Aipsrc::lastParse = 0;
   Block<String> Aipsrc::keywordPattern(0);
   Block<String> Aipsrc::keywordValue(0);
+  std::unordered_map<String, std::vector<uInt>, std::hash<std::string> >
+    Aipsrc::exactIndex;
+  std::vector<std::pair<uInt, Regex> > Aipsrc::wildIndex;
   uInt Aipsrc::fileEnd = 0;
   String Aipsrc::extAipsPath  = String();
   String Aipsrc::root = String();
@@ -30,8 +30,12 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Utilities/Regex.h>
 
 #include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -390,6 +394,14 @@ private:
   static Block<String> keywordValue;
   // List of patterns deducted from names
   static Block<String> keywordPattern;
+  // Index of the keywords without wildcards, mapping the keyword to the
+  // (ascending) pattern numbers carrying it. It makes a lookup a hash probe
+  // instead of compiling and matching a Regex for each pattern.
+  static std::unordered_map<String, std::vector<uInt>,
+                            std::hash<std::string> > exactIndex;
+  // The precompiled patterns of the keywords with wildcards, in
+  // ascending pattern number.
+  static std::vector<std::pair<uInt, Regex> > wildIndex;
   // The start of the non-home values
   static uInt fileEnd;
   // The possibly set external AIPSPATH
@@ -430,6 +442,9 @@ private:
 		       Block<String> &keywordValue,
 		       uInt &fileEnd, const String &fileList);
 
+  // Build exactIndex and wildIndex from the keywords as read from the files.
+  static void makeIndex(const Block<String> &keywords);
+
   // Locate the right keyword in the static maps
   static Bool matchKeyword(uInt &where, const String &keyword,
 			   uInt start);
@@ -27,6 +27,8 @@
 #include <casacore/casa/System/Aipsrc.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/iostream.h>
+#include <casacore/casa/fstream.h>
+#include <stdlib.h>
 
 #include <casacore/casa/namespace.h>
 int main(){
@@ -84,6 +86,38 @@ int main(){
     Aipsrc::save(n1);
   }
 
+  // test that the first matching pattern wins, exact or wildcard
+  {
+    {
+      ofstream ostr("tAipsrc_tmp.rc");
+      ostr << "# comment" << endl;
+      ostr << "a.b.c: first" << endl;
+      ostr << "a.*.d: wild1" << endl;
+      ostr << "a.x.d: exact" << endl;
+      ostr << "a.x.e: exact1" << endl;
+      ostr << "a.x.e: exact2" << endl;
+      ostr << "*.e: wild2" << endl;
+      ostr << "f.(g|h): alt" << endl;
+    }
+    setenv ("CASARCFILES", "tAipsrc_tmp.rc", 1);
+    Aipsrc::reRead();
+    String result;
+    AlwaysAssertExit(Aipsrc::find(result, "a.b.c") && result == "first");
+    AlwaysAssertExit(Aipsrc::find(result, "a.x.d") && result == "wild1");
+    AlwaysAssertExit(Aipsrc::find(result, "a.y.d") && result == "wild1");
+    AlwaysAssertExit(Aipsrc::find(result, "a.x.e") && result == "exact1");
+    AlwaysAssertExit(Aipsrc::find(result, "b.e") && result == "wild2");
+    AlwaysAssertExit(Aipsrc::find(result, "f.h") && result == "alt");
+    AlwaysAssertExit(! Aipsrc::find(result, "aXb.c"));
+    AlwaysAssertExit(Aipsrc::find(result, "a.b.c.d") && result == "wild1");
+    AlwaysAssertExit(! Aipsrc::find(result, "a.b.cd"));
+    AlwaysAssertExit(Aipsrc::patterns().nelements() == 7);
+    AlwaysAssertExit(Aipsrc::patterns()[1] == "^a\\..*\\.d$");
+    // All keywords come from the first (home) file.
+    AlwaysAssertExit(! Aipsrc::findNoHome(result, "a.b.c"));
+    unsetenv ("CASARCFILES");
+  }
+
 
   return 0; 
 }
@@ -29,6 +29,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
 #include <casacore/casa/Utilities/Sort.h>
+#include <casacore/casa/Utilities/RadixSort.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -87,6 +88,12 @@ template<class T> class Block;
 // degenerated cases like an already ordered or reversely ordered array.
 // Furthermore, merge sort is always stable and will be parallelized if OpenMP
 // support is enabled giving a 6-fold speedup on 8 cores.
+// <br>For the standard integer and floating point types a (parallel)
+// <linkto class=RadixSort>radix sort</linkto> is used instead if the array
+// has at least <src>RadixSort::minSize()</src> elements and option
+// <src>Sort::DefaultSort</src> or <src>Sort::ParSort</src> is given.
+// It gives the same (stable) result in linear time. It can also be
+// requested explicitly using <src>Sort::RadixSort</src>.
 // <br><src>Sort::NoDuplicates</src> in the options field indicates that
 // duplicate values will be removed (only the first occurrance is kept).
 // <br>The previous sort functionality is still available through the functions
@@ -147,6 +154,10 @@ public:
     // By default OpenMP determines the number of threads that can be used.
     static uInt parSort    (T*, uInt nr, Sort::Order = Sort::Ascending,
                             int options = 0, int nthread = 0);
+    // Sort C-array using a radix sort. It uses parSort if the data type
+    // is not supported by RadixSort.
+    static uInt radixSort  (T*, uInt nr, Sort::Order = Sort::Ascending,
+                            int options = 0, int nthread = 0);
 
     // Swap 2 elements in array.
     static inline void swap (T&, T&);
@@ -245,6 +256,10 @@ public:
     // By default the maximum number of threads is used.
     static INX parSort (INX* inx, const T* data,
 			 INX nr, Sort::Order, int options, int nthreads=0);
+    // Sort container using a radix sort. It uses parSort if the data type
+    // is not supported by RadixSort.
+    static INX radixSort (INX* inx, const T* data,
+			   INX nr, Sort::Order, int options, int nthreads=0);
 
 private:
     // Swap 2 indices.
@@ -27,6 +27,7 @@
 #define CASA_GENSORT_TCC
 
 #include <casacore/casa/Utilities/GenSort.h>
+#include <casacore/casa/Utilities/RadixSort.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
@@ -443,9 +444,35 @@ uInt GenSort<T>::heapSort (T* data, uInt nr, Sort::Order ord, int opt)
 
 
 
+template<class T>
+uInt GenSort<T>::radixSort (T* data, uInt nr, Sort::Order ord, int opt,
+                            int nthread)
+{
+  if (! RadixSort::sort (data, nr, std::max(nthread, 0))) {
+    return parSort (data, nr, ord, opt, nthread);
+  }
+  // Skip duplicates if needed (fast, because the array is ordered).
+  if ((opt & Sort::NoDuplicates) != 0) {
+    nr = insSortAscNoDup (data, nr);
+  }
+  if (ord == Sort::Descending) {
+    reverse (data, data, nr);
+  }
+  return nr;
+}
+
 template<class T>
 uInt GenSort<T>::sort (T* data, uInt nr, Sort::Order ord, int opt)
 {
+  // Use a radix sort for large arrays of numbers, unless a specific
+  // comparison sort is requested.
+  int type = opt - (opt&Sort::NoDuplicates);
+  if (RadixSortKey<T>::Supported  &&
+      (type == Sort::RadixSort  ||
+       ((type == Sort::DefaultSort  ||  type == Sort::ParSort)  &&
+        nr >= RadixSort::minSize()))) {
+    return radixSort (data, nr, ord, opt, Sort::maxThreads());
+  }
   // Determine the default sort to use.
   if (opt - (opt&Sort::NoDuplicates) == Sort::DefaultSort) {
     int nthr = 1;
@@ -521,6 +548,15 @@ INX GenSortIndirect<T,INX>::sort (Vector<INX>& indexVector, const T* data,
     INX* inx = indexVector.getStorage (del);
     // Choose the sort required.
     INX n;
+    // Use a radix sort for large arrays of numbers, unless a specific
+    // comparison sort is requested.
+    int type = opt - (opt&Sort::NoDuplicates);
+    if (RadixSortKey<T>::Supported  &&
+        (type == Sort::RadixSort  ||
+         ((type == Sort::DefaultSort  ||  type == Sort::ParSort)  &&
+          nr >= INX(RadixSort::minSize())))) {
+      opt = opt - type + Sort::RadixSort;
+    }
     // Determine the default sort to use.
     if (opt - (opt&Sort::NoDuplicates) == Sort::DefaultSort) {
         int nthr = 1;
@@ -537,6 +573,8 @@ INX GenSortIndirect<T,INX>::sort (Vector<INX>& indexVector, const T* data,
       n = insSort (inx, data, nr, ord, opt);
     } else if ((opt & Sort::QuickSort) != 0) {
       n = quickSort (inx, data, nr, ord, opt);
+    } else if ((opt & Sort::RadixSort) != 0) {
+      n = radixSort (inx, data, nr, ord, opt, Sort::maxThreads());
     } else {
       n = parSort (inx, data, nr, ord, opt);
     }
@@ -595,6 +633,24 @@ INX GenSortIndirect<T,INX>::heapSort (INX* inx, const T* data, INX nr,
   return n;
 }
 
+template<class T, class INX>
+INX GenSortIndirect<T,INX>::radixSort (INX* inx, const T* data, INX nr,
+                                       Sort::Order ord, int opt, int nthread)
+{
+  if (! RadixSort::sortIndirect (inx, data, nr, std::max(nthread, 0))) {
+    return parSort (inx, data, nr, ord, opt, nthread);
+  }
+  // Skip duplicates if needed (fast, because the array is ordered).
+  if ((opt & Sort::NoDuplicates) != 0) {
+    nr = insSortAscNoDup (inx, data, nr);
+  }
+  // As in parSort, equal values get the reverse index order if descending.
+  if (ord == Sort::Descending) {
+    GenSort<INX>::reverse (inx, inx, nr);
+  }
+  return nr;
+}
+
 template<class T, class INX>
 INX GenSortIndirect<T,INX>::parSort (INX* inx, const T* data, INX nr,
                                      Sort::Order ord, int opt, int nthread)
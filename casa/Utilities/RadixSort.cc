@@ -0,0 +1,43 @@
+//# RadixSort.cc: Radix sort of integer and floating point keys
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/Utilities/RadixSort.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <algorithm>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+uInt RadixSort::nthreads (size_t nr, uInt nthreads)
+{
+  if (nthreads == 0) {
+    nthreads = ThreadPool::concurrency();
+  }
+  // Each thread should handle at least 64K values to be worthwhile.
+  size_t nthr = std::min (size_t(nthreads), nr / 65536);
+  return std::max (nthr, size_t(1));
+}
+
+
+} //# NAMESPACE CASACORE - END
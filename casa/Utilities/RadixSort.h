@@ -0,0 +1,203 @@
+//# RadixSort.h: Radix sort of integer and floating point keys
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_RADIXSORT_H
+#define CASA_RADIXSORT_H
+
+#include <casacore/casa/aips.h>
+#include <cstddef>
+#include <cstring>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Map a value to an unsigned integer key with the same ordering
+// </summary>
+// <use visibility=local>
+// <reviewed reviewer="" date="" tests="tRadixSort" demos="">
+// </reviewed>
+
+// <synopsis>
+// RadixSortKey defines for the standard integer and floating point types
+// an unsigned integer type <src>Key</src> and a function <src>key</src>
+// mapping a value to a key, such that the keys are ordered as the values.
+// <br>For signed integers the sign bit is flipped. For IEEE floating point
+// values the sign bit is flipped for positive values and all bits for
+// negative values. The function <src>key</src> maps -0 to the key of +0,
+// so they are equal (as they compare equal); <src>rawKey</src> does not
+// do that (-0 sorts before +0) and can be converted back to the value using
+// <src>value</src>. NaNs with the sign bit not set sort after +Inf, others
+// before -Inf.
+// <br>The general template has <src>Supported=0</src>, so a radix sort
+// is not possible for other types.
+// </synopsis>
+
+template<typename T> struct RadixSortKey
+{
+  enum {Supported = 0};
+  typedef uChar Key;
+};
+
+// <summary>
+// Radix sort of integer and floating point keys
+// </summary>
+// <use visibility=local>
+// <reviewed reviewer="" date="" tests="tRadixSort" demos="">
+// </reviewed>
+
+// <synopsis>
+// RadixSort does a stable LSD radix sort (8 bits per pass) in ascending
+// order for the types supported by
+// <linkto class=RadixSortKey>RadixSortKey</linkto>.
+// A pass is skipped if all values have the same byte value, which is
+// often the case for the higher bytes of small integers (e.g. antenna
+// numbers) and for the exponent of the times in a MeasurementSet.
+// For large arrays the passes are done in parallel using the global
+// <linkto class=ThreadPool>ThreadPool</linkto>.
+// <br>The sort takes O(n) time, but needs a temporary copy of the keys
+// (and indices), so it is used by <linkto class=GenSort>GenSort</linkto>,
+// <linkto class=GenSortIndirect>GenSortIndirect</linkto>, and
+// <linkto class=Sort>Sort</linkto> for arrays of at least
+// <src>minSize()</src> elements.
+// <br>The functions <src>sort</src> and <src>sortIndirect</src> return
+// False (and do nothing) if the data type is not supported.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   std::vector<Double> times(...);
+//   RadixSort::sort (times.data(), times.size());
+// </srcblock>
+// </example>
+
+class RadixSort
+{
+public:
+  // Sort the values in ascending order.
+  template<typename T>
+  static Bool sort (T* data, size_t nr, uInt nthreads=0);
+
+  // Sort the indices in ascending order of their values (stable).
+  // The index array does not need to be ordered nor complete.
+  template<typename T, typename INX>
+  static Bool sortIndirect (INX* inx, const T* data, size_t nr,
+                            uInt nthreads=0);
+
+  // Sort the keys in ascending order and the indices (if not null)
+  // accordingly. It is stable, so indices with equal keys keep their order.
+  // The key type must be an unsigned integer type.
+  template<typename U, typename INX>
+  static void sortKeys (U* keys, INX* inx, size_t nr, uInt nthreads=0);
+
+  // Get the minimum array size for which GenSort and Sort use a radix sort.
+  static size_t minSize()
+    { return 2048; }
+
+  // Get the number of threads to use for the given number of elements.
+  // 0 means the concurrency of the global ThreadPool.
+  static uInt nthreads (size_t nr, uInt nthreads);
+};
+
+
+//# The specializations of RadixSortKey.
+// <group name=RadixSortKey specializations>
+#define CASA_RADIXSORTKEY_UNSIGNED(T,U) \
+template<> struct RadixSortKey<T> \
+{ \
+  enum {Supported = 1}; \
+  typedef U Key; \
+  static Key key (T v) { return v; } \
+  static Key rawKey (T v) { return v; } \
+  static T value (Key k) { return static_cast<T>(k); } \
+};
+#define CASA_RADIXSORTKEY_SIGNED(T,U) \
+template<> struct RadixSortKey<T> \
+{ \
+  enum {Supported = 1}; \
+  typedef U Key; \
+  static Key key (T v) \
+    { return Key(v) ^ (Key(1) << (8*sizeof(Key)-1)); } \
+  static Key rawKey (T v) { return key(v); } \
+  static T value (Key k) \
+    { return static_cast<T>(k ^ (Key(1) << (8*sizeof(Key)-1))); } \
+};
+#define CASA_RADIXSORTKEY_FLOAT(T,U) \
+template<> struct RadixSortKey<T> \
+{ \
+  enum {Supported = 1}; \
+  typedef U Key; \
+  static Key key (T v) \
+    { return rawKey (v == 0 ? T(0) : v); } \
+  static Key rawKey (T v) \
+  { \
+    Key k; \
+    memcpy (&k, &v, sizeof(Key)); \
+    const Key sign = Key(1) << (8*sizeof(Key)-1); \
+    return ((k & sign) == 0  ?  k | sign : ~k); \
+  } \
+  static T value (Key k) \
+  { \
+    const Key sign = Key(1) << (8*sizeof(Key)-1); \
+    k = ((k & sign) != 0  ?  k & ~sign : ~k); \
+    T v; \
+    memcpy (&v, &k, sizeof(Key)); \
+    return v; \
+  } \
+};
+
+template<> struct RadixSortKey<Bool>
+{
+  enum {Supported = 1};
+  typedef uChar Key;
+  static Key key (Bool v) { return v ? 1 : 0; }
+  static Key rawKey (Bool v) { return key(v); }
+  static Bool value (Key k) { return k != 0; }
+};
+CASA_RADIXSORTKEY_UNSIGNED(uChar, uChar)
+CASA_RADIXSORTKEY_SIGNED(signed char, uChar)
+CASA_RADIXSORTKEY_SIGNED(char, uChar)
+CASA_RADIXSORTKEY_UNSIGNED(uShort, uShort)
+CASA_RADIXSORTKEY_SIGNED(Short, uShort)
+CASA_RADIXSORTKEY_UNSIGNED(uInt, uInt)
+CASA_RADIXSORTKEY_SIGNED(Int, uInt)
+CASA_RADIXSORTKEY_UNSIGNED(unsigned long, unsigned long)
+CASA_RADIXSORTKEY_SIGNED(long, unsigned long)
+CASA_RADIXSORTKEY_UNSIGNED(uInt64, uInt64)
+CASA_RADIXSORTKEY_SIGNED(Int64, uInt64)
+CASA_RADIXSORTKEY_FLOAT(Float, uInt)
+CASA_RADIXSORTKEY_FLOAT(Double, uInt64)
+
+#undef CASA_RADIXSORTKEY_UNSIGNED
+#undef CASA_RADIXSORTKEY_SIGNED
+#undef CASA_RADIXSORTKEY_FLOAT
+// </group>
+
+
+} //# NAMESPACE CASACORE - END
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/casa/Utilities/RadixSort.tcc>
+#endif //# CASACORE_NO_AUTO_TEMPLATES
+#endif
@@ -0,0 +1,200 @@
+//# RadixSort.tcc: Radix sort of integer and floating point keys
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_RADIXSORT_TCC
+#define CASA_RADIXSORT_TCC
+
+#include <casacore/casa/Utilities/RadixSort.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <algorithm>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Helper class to do the sort only for the supported types.
+template<typename T, int SUPPORTED=RadixSortKey<T>::Supported>
+struct RadixSortHelper
+{
+  static Bool sort (T*, size_t, uInt)
+    { return False; }
+  template<typename INX>
+  static Bool sortIndirect (INX*, const T*, size_t, uInt)
+    { return False; }
+};
+
+template<typename T>
+struct RadixSortHelper<T,1>
+{
+  typedef typename RadixSortKey<T>::Key Key;
+
+  static Bool sort (T* data, size_t nr, uInt nthreads)
+  {
+    // Use the raw keys, so they can be converted back to the values.
+    std::vector<Key> keys(nr);
+    uInt nthr = RadixSort::nthreads (nr, nthreads);
+    size_t chunk = (nr + nthr - 1) / nthr;
+    ThreadPool::global().parallelFor (nthr, [&](size_t t) {
+        size_t end = std::min (nr, (t+1)*chunk);
+        for (size_t i=t*chunk; i<end; ++i) {
+          keys[i] = RadixSortKey<T>::rawKey (data[i]);
+        }
+      }, nthr);
+    RadixSort::sortKeys (keys.data(), (uInt*)0, nr, nthr);
+    ThreadPool::global().parallelFor (nthr, [&](size_t t) {
+        size_t end = std::min (nr, (t+1)*chunk);
+        for (size_t i=t*chunk; i<end; ++i) {
+          data[i] = RadixSortKey<T>::value (keys[i]);
+        }
+      }, nthr);
+    return True;
+  }
+
+  template<typename INX>
+  static Bool sortIndirect (INX* inx, const T* data, size_t nr,
+                            uInt nthreads)
+  {
+    std::vector<Key> keys(nr);
+    uInt nthr = RadixSort::nthreads (nr, nthreads);
+    size_t chunk = (nr + nthr - 1) / nthr;
+    ThreadPool::global().parallelFor (nthr, [&](size_t t) {
+        size_t end = std::min (nr, (t+1)*chunk);
+        for (size_t i=t*chunk; i<end; ++i) {
+          keys[i] = RadixSortKey<T>::key (data[inx[i]]);
+        }
+      }, nthr);
+    RadixSort::sortKeys (keys.data(), inx, nr, nthr);
+    return True;
+  }
+};
+
+
+template<typename T>
+Bool RadixSort::sort (T* data, size_t nr, uInt nthreads)
+{
+  return RadixSortHelper<T>::sort (data, nr, nthreads);
+}
+
+template<typename T, typename INX>
+Bool RadixSort::sortIndirect (INX* inx, const T* data, size_t nr,
+                              uInt nthreads)
+{
+  return RadixSortHelper<T>::sortIndirect (inx, data, nr, nthreads);
+}
+
+template<typename U, typename INX>
+void RadixSort::sortKeys (U* keys, INX* inx, size_t nr, uInt nthreads)
+{
+  if (nr < 2) {
+    return;
+  }
+  const uInt nbyte = sizeof(U);
+  uInt nthr = RadixSort::nthreads (nr, nthreads);
+  size_t chunk = (nr + nthr - 1) / nthr;
+  // Count the byte values of each chunk for all bytes at once to find
+  // the passes that can be skipped (all values having the same byte).
+  std::vector<size_t> counts(nthr * nbyte * 256, 0);
+  ThreadPool::global().parallelFor (nthr, [&](size_t t) {
+      size_t* cnt = counts.data() + t*nbyte*256;
+      size_t end = std::min (nr, (t+1)*chunk);
+      for (size_t i=t*chunk; i<end; ++i) {
+        U key = keys[i];
+        for (uInt b=0; b<nbyte; ++b) {
+          cnt[b*256 + ((key >> (8*b)) & 255)]++;
+        }
+      }
+    }, nthr);
+  std::vector<uInt> passes;
+  for (uInt b=0; b<nbyte; ++b) {
+    size_t total = 0;
+    for (uInt t=0; t<nthr; ++t) {
+      total += counts[(t*nbyte + b)*256 + (keys[0] >> (8*b) & 255)];
+    }
+    if (total < nr) {
+      passes.push_back (b);
+    }
+  }
+  if (passes.empty()) {
+    return;
+  }
+  std::vector<U> keyTmp(nr);
+  std::vector<INX> inxTmp(inx == 0 ? 0 : nr);
+  U* srcKey = keys;
+  U* dstKey = keyTmp.data();
+  INX* srcInx = inx;
+  INX* dstInx = inxTmp.data();
+  std::vector<size_t> offsets(nthr * 256);
+  for (uInt p=0; p<passes.size(); ++p) {
+    uInt shift = 8 * passes[p];
+    // The counts of the first pass are known; count the others.
+    if (p > 0) {
+      ThreadPool::global().parallelFor (nthr, [&](size_t t) {
+          size_t* cnt = counts.data() + (t*nbyte + passes[p])*256;
+          std::fill (cnt, cnt+256, 0);
+          size_t end = std::min (nr, (t+1)*chunk);
+          for (size_t i=t*chunk; i<end; ++i) {
+            cnt[(srcKey[i] >> shift) & 255]++;
+          }
+        }, nthr);
+    }
+    // Determine where each chunk has to put its values, so the sort
+    // is stable.
+    size_t offset = 0;
+    for (uInt d=0; d<256; ++d) {
+      for (uInt t=0; t<nthr; ++t) {
+        offsets[t*256 + d] = offset;
+        offset += counts[(t*nbyte + passes[p])*256 + d];
+      }
+    }
+    ThreadPool::global().parallelFor (nthr, [&](size_t t) {
+        size_t* off = offsets.data() + t*256;
+        size_t end = std::min (nr, (t+1)*chunk);
+        if (inx == 0) {
+          for (size_t i=t*chunk; i<end; ++i) {
+            dstKey[off[(srcKey[i] >> shift) & 255]++] = srcKey[i];
+          }
+        } else {
+          for (size_t i=t*chunk; i<end; ++i) {
+            size_t to = off[(srcKey[i] >> shift) & 255]++;
+            dstKey[to] = srcKey[i];
+            dstInx[to] = srcInx[i];
+          }
+        }
+      }, nthr);
+    std::swap (srcKey, dstKey);
+    std::swap (srcInx, dstInx);
+  }
+  // The result must end up in the input arrays.
+  if (srcKey != keys) {
+    std::copy (srcKey, srcKey+nr, keys);
+    if (inx != 0) {
+      std::copy (srcInx, srcInx+nr, inx);
+    }
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -31,10 +31,49 @@
 #include <casacore/casa/stdexcept.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/vector.h>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// A simple regex consists of segments of ordinary characters and any
+// characters (.) separated by .* (thus at least 1 segment).
+struct Regex::Simple
+{
+  struct Segment {
+    String      chars;
+    vector<Bool> any;        // True = . (any character but line terminator)
+  };
+  vector<Segment> segments;
+  Bool literal;              // single segment without . and anchors
+};
+
+namespace {
+  // Like . in std::regex, .* does not match line terminators.
+  inline Bool isLineTerm (Char c)
+    { return c == '\n'  ||  c == '\r'; }
+
+  // Test if a segment matches the string at the given position.
+  // The string must be long enough.
+  inline Bool segmentMatch (const Char* s, const String& chars,
+                            const vector<Bool>& any)
+  {
+    for (uInt i=0; i<chars.size(); ++i) {
+      if (any[i]) {
+        if (isLineTerm(s[i])) return False;
+      } else if (s[i] != chars[i]) {
+        return False;
+      }
+    }
+    return True;
+  }
+}
+
+
 Regex::Regex()
 {}
 
@@ -47,11 +86,9 @@ Regex::Regex(const String& str, Bool fast, Bool toECMAScript)
     if (fast) {
       flags |= std::regex::optimize;
     }
-    if (toECMAScript) {
-      std::regex::operator= (std::regex(toEcma(str), flags));
-    } else {
-      std::regex::operator= (std::regex(str, flags));
-    }
+    String ecma (toECMAScript ? toEcma(str) : str);
+    std::regex::operator= (std::regex(ecma, flags));
+    makeSimple (ecma);
   } catch (const std::exception& x) {
     throw AipsError ("Error in regex " + str + ": " + x.what());
   }
@@ -59,8 +96,138 @@ Regex::Regex(const String& str, Bool fast, Bool toECMAScript)
 
 void Regex::operator=(const String& str)
 {
-  std::regex::operator= (Regex(str));
-  itsStr = str;
+  *this = Regex(str);
+}
+
+Regex Regex::cached (const String& exp, Bool toECMAScript)
+{
+  static std::mutex theirMutex;
+  static std::unordered_map<std::string, Regex> theirCache;
+  std::string key ((toECMAScript ? "E" : "N") + exp);
+  {
+    std::lock_guard<std::mutex> lock(theirMutex);
+    auto iter = theirCache.find (key);
+    if (iter != theirCache.end()) {
+      return iter->second;
+    }
+  }
+  // Compile outside the lock; another thread might do the same.
+  Regex rx(exp, True, toECMAScript);
+  std::lock_guard<std::mutex> lock(theirMutex);
+  // Keep the cache bounded for programs generating many expressions.
+  if (theirCache.size() >= 1000) {
+    theirCache.clear();
+  }
+  theirCache.emplace (key, rx);
+  return rx;
+}
+
+void Regex::makeSimple (const String& ecma)
+{
+  itsSimple.reset();
+  std::shared_ptr<Simple> simple (new Simple);
+  simple->segments.resize (1);
+  Bool anchored = False;
+  uInt n = ecma.size();
+  uInt i = 0;
+  if (n > 0  &&  ecma[0] == '^') {
+    anchored = True;
+    i = 1;
+  }
+  while (i < n) {
+    Simple::Segment& seg = simple->segments.back();
+    Char c = ecma[i];
+    if (c == '\\') {
+      // An escaped non-alphanumeric character is an ordinary character.
+      if (i+1 >= n  ||  isalnum(static_cast<unsigned char>(ecma[i+1]))) {
+        return;
+      }
+      seg.chars.push_back (ecma[i+1]);
+      seg.any.push_back (False);
+      i += 2;
+    } else if (c == '.') {
+      if (i+1 < n  &&  (ecma[i+1] == '*'  ||  ecma[i+1] == '+')) {
+        // .+ is the same as ..*
+        if (ecma[i+1] == '+') {
+          seg.chars.push_back (c);
+          seg.any.push_back (True);
+        }
+        i += 2;
+        // Being non-greedy does not matter for a full match.
+        if (i < n  &&  ecma[i] == '?') {
+          i++;
+        }
+        // Consecutive .* are the same as a single one.
+        if (simple->segments.size() == 1  ||  !seg.chars.empty()) {
+          simple->segments.push_back (Simple::Segment());
+        }
+      } else {
+        seg.chars.push_back (c);
+        seg.any.push_back (True);
+        i++;
+      }
+    } else if (c == '$'  &&  i == n-1) {
+      anchored = True;
+      i++;
+    } else if (c == 0  ||  strchr ("^$*+?()[]{}|", c) != 0) {
+      return;
+    } else {
+      seg.chars.push_back (c);
+      seg.any.push_back (False);
+      i++;
+    }
+  }
+  const Simple::Segment& seg0 = simple->segments[0];
+  simple->literal = (!anchored  &&  simple->segments.size() == 1  &&
+                     std::find (seg0.any.begin(), seg0.any.end(), True) ==
+                     seg0.any.end());
+  itsSimple = simple;
+}
+
+Bool Regex::simpleMatch (const Char* s, String::size_type len) const
+{
+  const vector<Simple::Segment>& segs = itsSimple->segments;
+  const Simple::Segment& first = segs.front();
+  if (segs.size() == 1) {
+    return len == first.chars.size()  &&
+           segmentMatch (s, first.chars, first.any);
+  }
+  // The first and last segment have to match the begin and end.
+  const Simple::Segment& last = segs.back();
+  if (first.chars.size() + last.chars.size() > len  ||
+      !segmentMatch (s, first.chars, first.any)  ||
+      !segmentMatch (s + len - last.chars.size(),
+                     last.chars, last.any)) {
+    return False;
+  }
+  String::size_type pos = first.chars.size();
+  String::size_type end = len - last.chars.size();
+  // Find each middle segment at its first possible position.
+  // That leaves most room for the others, so no backtracking is needed.
+  // The .* before it cannot contain a line terminator.
+  for (uInt k=1; k<segs.size()-1; ++k) {
+    const Simple::Segment& seg = segs[k];
+    String::size_type st = pos;
+    while (True) {
+      if (st + seg.chars.size() > end) {
+        return False;
+      }
+      if (segmentMatch (s+st, seg.chars, seg.any)) {
+        break;
+      }
+      if (isLineTerm(s[st])) {
+        return False;
+      }
+      ++st;
+    }
+    pos = st + seg.chars.size();
+  }
+  for (; pos<end; ++pos) {
+    if (isLineTerm(s[pos])) {
+      return False;
+    }
+  }
+  return True;
 }
 
 String::size_type Regex::match(const Char* s,
@@ -92,6 +259,9 @@ String::size_type Regex::match(const Char* s,
 
 Bool Regex::fullMatch(const Char* s, String::size_type len) const
 {
+  if (itsSimple) {
+    return simpleMatch (s, len);
+  }
   return std::regex_match(s, s+len, *this);
 }
                                
@@ -104,6 +274,16 @@ String::size_type Regex::search(const Char* s, String::size_type len,
     return searchBack (s, len, matchlen, -pos);
   }
   if (pos >= static_cast<Int>(len)) return String::npos;
+  if (itsSimple  &&  itsSimple->literal) {
+    const String& lit = itsSimple->segments[0].chars;
+    const Char* res = std::search (s+pos, s+len, lit.begin(), lit.end());
+    if (res != s+len  ||  lit.empty()) {
+      matchlen = lit.size();
+      return res - s;
+    }
+    matchlen = 0;
+    return String::npos;
+  }
   std::cmatch result;
   if (std::regex_search(s+pos, s+len, result, *this)) {
     matchlen = result.length(0);
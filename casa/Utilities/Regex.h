@@ -30,6 +30,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/iosfwd.h>
 #include <regex>
+#include <memory>
 #include <casacore/casa/BasicSL/String.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -173,6 +174,18 @@ struct re_registers;
 // The static member function <src>makeCaseInsensitive</src> returns a
 // new regular expression string containing the case-insensitive version of
 // the given expression string.
+// <p>
+// std::regex is fairly slow. Therefore the constructor recognizes
+// simple expressions consisting of ordinary characters, <src>.</src> and
+// <src>.*</src> (thus the result of <src>fromPattern</src>,
+// <src>fromSQLPattern</src> and <src>fromString</src> for patterns without
+// brackets and braces). Such an expression is matched by a dedicated
+// algorithm in <src>fullMatch</src> (thus in <src>String::matches</src>).
+// An expression consisting of ordinary characters only is also searched
+// directly. Other expressions and functions use std::regex.
+// <br>The static function <src>cached</src> can be used to get a Regex
+// from a thread-safe cache of compiled expressions, which is useful if
+// the same expression has to be constructed repeatedly (e.g., in TaQL).
 // </synopsis> 
 
 // <example>
@@ -217,6 +230,11 @@ public:
   // Construct a new regex (using the default Regex constructor arguments).
   void operator=(const String& str);
 
+  // Get the regex for the given expression from a cache of compiled
+  // expressions. It is constructed (with fast=True) and added to the cache
+  // if not found. The cache is thread-safe.
+  static Regex cached(const String& exp, Bool toECMAScript=True);
+
   // Convert the possibly old-style regex to the Ecma regex which means
   // that unescaped [ and ] inside a bracket expression will be escaped and
   // that a numeric character after a backreference is enclosed in brackets
@@ -300,6 +318,15 @@ public:
     
 protected:
   String itsStr;                 // the reg. exp. string
+
+private:
+  // Analyze if the Ecma expression is simple and can be matched directly.
+  void makeSimple (const String& ecma);
+  // Match the entire string using the simple expression.
+  Bool simpleMatch (const Char* s, String::size_type len) const;
+
+  struct Simple;
+  std::shared_ptr<const Simple> itsSimple;   // null if not a simple regex
 };
 
 
@@ -29,23 +29,77 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/SortError.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/OS/ThreadPool.h>
 ///#include <casacore/casa/Containers/BlockIO.h>
 
 #include <casacore/casa/stdlib.h>                 // for rand
-#ifdef _OPENMP
-# include <omp.h>
-#endif
+#include <atomic>
+#include <typeinfo>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// Test if the comparison object is an ObjCompare object for the given type
+// (and not a class derived from it).
+template<typename T>
+inline Bool isPlainCompare (const BaseCompare& cmp)
+  { return typeid(cmp) == typeid(ObjCompare<T>); }
+
+// Return the data type if the comparison object is a plain ObjCompare object
+// for a standard scalar type, otherwise TpOther.
+static DataType plainCompareType (const BaseCompare& cmp)
+{
+    Bool plain = False;
+    DataType dtype = cmp.dataType();
+    switch (dtype) {
+    case TpBool:
+        plain = isPlainCompare<Bool> (cmp);
+        break;
+    case TpUChar:
+        plain = isPlainCompare<uChar> (cmp);
+        break;
+    case TpShort:
+        plain = isPlainCompare<Short> (cmp);
+        break;
+    case TpUShort:
+        plain = isPlainCompare<uShort> (cmp);
+        break;
+    case TpInt:
+        plain = isPlainCompare<Int> (cmp);
+        break;
+    case TpUInt:
+        plain = isPlainCompare<uInt> (cmp);
+        break;
+    case TpInt64:
+        plain = isPlainCompare<Int64> (cmp);
+        break;
+    case TpFloat:
+        plain = isPlainCompare<Float> (cmp);
+        break;
+    case TpDouble:
+        plain = isPlainCompare<Double> (cmp);
+        break;
+    case TpString:
+        plain = isPlainCompare<String> (cmp);
+        break;
+    default:
+        break;
+    }
+    return (plain  ?  dtype : TpOther);
+}
+
+// The maximum nr of threads to use; 0 means the default.
+static std::atomic<uInt> theirMaxThreads(0);
+
+
 SortKey::SortKey (const void* dat, const std::shared_ptr<BaseCompare>& cmpobj,
                   uInt inc, int opt)
 : order_p   (opt),
   data_p    (dat),
   incr_p    (inc),
   ccmpObj_p (cmpobj),
-  cmpObj_p  (cmpobj.operator->())
+  cmpObj_p  (cmpobj.operator->()),
+  dtype_p   (plainCompareType (*cmpobj))
 {
     if (order_p != Sort::Descending) {
 	order_p = Sort::Ascending;        // make sure order has correct value
@@ -57,7 +111,8 @@ SortKey::SortKey (const SortKey& that)
   data_p    (that.data_p),
   incr_p    (that.incr_p),
   ccmpObj_p (that.ccmpObj_p),
-  cmpObj_p  (that.cmpObj_p)
+  cmpObj_p  (that.cmpObj_p),
+  dtype_p   (that.dtype_p)
 {}
 
 SortKey::~SortKey()
@@ -71,6 +126,7 @@ SortKey& SortKey::operator= (const SortKey& that)
 	incr_p    = that.incr_p;
         ccmpObj_p = that.ccmpObj_p;
 	cmpObj_p  = that.cmpObj_p;
+	dtype_p   = that.dtype_p;
     }
     return *this;
 }
@@ -267,6 +323,49 @@ uInt64 Sort::sort (Vector<uInt64>& indexVector, uInt64 nrrec,
                    int options, Bool tryGenSort) const
   { return doSort (indexVector, nrrec, options, tryGenSort); }
 
+uInt Sort::partialSort (Vector<uInt>& indexVector, uInt nrrec,
+                        uInt nrfirst) const
+  { return doPartialSort (indexVector, nrrec, nrfirst); }
+
+uInt64 Sort::partialSort (Vector<uInt64>& indexVector, uInt64 nrrec,
+                          uInt64 nrfirst) const
+  { return doPartialSort (indexVector, nrrec, nrfirst); }
+
+Bool Sort::canRadixSort() const
+{
+    for (size_t i=0; i<nrkey_p; i++) {
+        switch (keys_p[i]->dtype_p) {
+        case TpBool:
+        case TpUChar:
+        case TpShort:
+        case TpUShort:
+        case TpInt:
+        case TpUInt:
+        case TpInt64:
+        case TpFloat:
+        case TpDouble:
+            break;
+        default:
+            return False;
+        }
+    }
+    return nrkey_p > 0;
+}
+
+void Sort::setMaxThreads (uInt nthreads)
+{
+    theirMaxThreads = nthreads;
+}
+
+uInt Sort::maxThreads()
+{
+    uInt nthr = theirMaxThreads;
+    if (nthr == 0) {
+        nthr = ThreadPool::concurrency();
+    }
+    return std::max (nthr, 1u);
+}
+
 uInt Sort::unique (Vector<uInt>& uniqueVector, uInt nrrec) const
   { return doUnique (uniqueVector, nrrec); }
 
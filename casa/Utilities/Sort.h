@@ -52,6 +52,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //       stride for keys embedded in a struct;
 //  <li> Sort order -- ascending or descending;
 // </ul>
+// If the comparison object is a plain
+// <linkto class=ObjCompare>ObjCompare</linkto> for a standard scalar type,
+// its data type is remembered, so Sort can compare the keys directly
+// without a virtual function call.
 // </synopsis> 
 
 class SortKey
@@ -93,6 +97,8 @@ protected:
     std::shared_ptr<BaseCompare> ccmpObj_p;
     // comparison object; use raw pointer for performance
     BaseCompare* cmpObj_p;
+    // data type if cmpObj_p is a plain ObjCompare, otherwise TpOther
+    DataType          dtype_p;
 };
 
 
@@ -119,8 +125,16 @@ protected:
 // If sorting on a single key with a standard data type is done,
 // Sort will use GenSortIndirect to speed up the sort.
 // <br>
-// Four sort algorithms are provided:
+// Five sort algorithms are provided:
 // <DL>
+//  <DT> <src>Sort::RadixSort</src>
+//  <DD> A (parallel) LSD radix sort has O(n) behaviour, but can only be
+//       used if all keys are compared with a plain ObjCompare object of a
+//       standard integer or floating point type (thus not String).
+//       It sorts the keys one by one (least significant first) and skips
+//       the bytes having the same value for all records, so small integers
+//       or times close together need few passes.
+//       It needs an extra array of keys and indices.
 //  <DT> <src>Sort::ParSort</src>
 //  <DD> The parallel merge sort is the fastest if it can use multiple threads.
 //       For a single thread it has O(n*log(n)) behaviour, but is slower
@@ -141,6 +155,17 @@ protected:
 // </DL>
 // The default is to use QuickSort for small arrays or if only a single
 // thread can be used. Otherwise ParSort is the default.
+// However, RadixSort is used for DefaultSort and ParSort if possible and if
+// the array has at least <src>RadixSort::minSize()</src> elements.
+// It gives the same result, because all algorithms are stable.
+// <br>ParSort uses at most <src>Sort::maxThreads()</src> threads, where each
+// thread handles at least 1000 records. Both the creation of the ordered
+// parts and their merging are done in parallel; the last merge steps are
+// split over the threads by partitioning the output.
+// <br>Keys compared with a plain ObjCompare object of a standard scalar type
+// (as created when a data type is given to <src>sortKey</src>) are compared
+// directly instead of using the virtual <src>BaseCompare::comp</src>
+// function, which makes multi-key sorts considerably faster.
 // 
 // All sort algorithms are <em>stable</em>, which means that the original
 // order is kept when keys are equal.
@@ -250,7 +275,8 @@ public:
                  InsSort=2,         // use insertion sort algorithm
                  QuickSort=4,       // use Quicksort algorithm
                  ParSort=8,         // use parallel merge sort algorithm
-                 NoDuplicates=16};  // skip data with equal sort keys
+                 NoDuplicates=16,   // skip data with equal sort keys
+                 RadixSort=32};     // use radix sort for numeric keys
 
     // Enumerate the sort order:
     enum Order {Ascending=-1,
@@ -328,6 +354,30 @@ public:
     uInt64 sort (Vector<uInt64>& indexVector, uInt64 nrrec,
                  int options = DefaultSort, Bool tryGenSort = True) const;
 
+    // Determine the first <src>nrfirst</src> records of the sorted data array
+    // of <src>nrrec</src> records (i.e., a top-k selection).
+    // The result is an array of indices giving the order of those records,
+    // which is the same as the first part of the result of <src>sort</src>.
+    // It uses a heap-based partial sort, thus it is much faster than a full
+    // sort if <src>nrfirst</src> is small compared to <src>nrrec</src>.
+    // It returns the number of resulting records (the minimum of nrfirst
+    // and nrrec). The indices array is resized to that number.
+    // Note that the NoDuplicates option cannot be used.
+    // <group>
+    uInt partialSort (Vector<uInt>& indexVector, uInt nrrec,
+                      uInt nrfirst) const;
+    uInt64 partialSort (Vector<uInt64>& indexVector, uInt64 nrrec,
+                        uInt64 nrfirst) const;
+    // </group>
+
+    // Set or get the maximum number of threads used by ParSort.
+    // By default it is the concurrency of the global ThreadPool.
+    // Setting it to 0 restores the default.
+    // <group>
+    static void setMaxThreads (uInt nthreads);
+    static uInt maxThreads();
+    // </group>
+
     // Get all unique records in a sorted array. The array order is
     // given in the indexVector (as possibly returned by the sort function).
     // The default indexVector is 0..nrrec-1.
@@ -364,6 +414,9 @@ private:
     T doSort (Vector<T>& indexVector, T nrrec,
               int options = DefaultSort, Bool tryGenSort = True) const;
 
+    template<typename T>
+    T doPartialSort (Vector<T>& indexVector, T nrrec, T nrfirst) const;
+
     template <typename T>
     T doUnique (Vector<T>& uniqueVector, T nrrec) const;
     template <typename T>
@@ -389,15 +442,37 @@ private:
     T insSortNoDup (T nr, T* indices) const;
     // </group>
 
-    // Do a merge sort, if possible in parallel using OpenMP.
-    // Note that the env.var. OMP_NUM_TRHEADS sets the maximum nr of threads
-    // to use. It defaults to the number of cores.
+    // Tell if a radix sort can be used for the keys.
+    Bool canRadixSort() const;
+
+    // Do a radix sort if possible. It returns False if not possible.
+    template<typename T>
+    Bool radixSort (T nrrec, T* inx) const;
+
+    // Radix sort the indices on the values of the given key.
+    template<typename V, typename T>
+    static void radixSortKey (const SortKey* key, Bool descending,
+                              T nrrec, T* inx);
+
+    // Do a merge sort, if possible in parallel using multiple threads.
+    // The number of threads to use is given by maxThreads().
     template<typename T>
     T parSort (int nthr, T nrrec, T* inx) const;
     template<typename T>
-    void merge (T* inx, T* tmp, T size, T* index,
+    void merge (int nthr, T* inx, T* tmp, T size, T* index,
                 T nparts) const;
 
+    // Merge the ordered arrays f1 and f2 of length na and nb, but only
+    // the output elements kst till kend.
+    template<typename T>
+    void mergePart (const T* f1, T na, const T* f2, T nb, T* to,
+                    T kst, T kend) const;
+
+    // Execute <src>func(i)</src> for i=0..n-1 using at most nthr threads
+    // of the global ThreadPool.
+    template<typename Func>
+    static void parallelDo (int nthr, int n, Func func);
+
     // Do a quicksort, optionally skipping duplicates
     // (qkSort is the actual quicksort function).
     // <group>
@@ -425,6 +500,16 @@ private:
     template<typename T>
     int compare (T index1, T index2) const;
 
+    // Compare the values of a key of a standard data type directly,
+    // giving the same result as ObjCompare.
+    template<typename V, typename T>
+    static int compareKey (const SortKey* key, T index1, T index2)
+    {
+      const V& v1 = *(const V*)((const char*)key->data_p + index1*key->incr_p);
+      const V& v2 = *(const V*)((const char*)key->data_p + index2*key->incr_p);
+      return (v1 < v2  ?  -1 : (v1 == v2  ?  0 : 1));
+    }
+
     // As compare() but it also gives back the index of the first comparison
     // function that didn't match.
     template<typename T>
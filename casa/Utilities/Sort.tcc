@@ -29,11 +29,12 @@
 //# Includes
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Utilities/SortError.h>
+#include <casacore/casa/Utilities/RadixSort.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
-
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <algorithm>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -61,15 +62,26 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     int nodup = opt & NoDuplicates;
     int type  = opt - nodup;
     // Determine default sort to use.
-    int nthr = 1;
-#ifdef _OPENMP
-    nthr = omp_get_max_threads();
-    // Do not use more threads than there are values.
-    if (uInt(nthr) > nrrec) nthr = nrrec;
-#endif
+    // Each thread should handle at least 1000 values.
+    int nthr = std::min (T(maxThreads()), std::max (T(1), T(nrrec/1000)));
     if (type == DefaultSort) {
       type = (nrrec<1000 || nthr==1  ?  QuickSort : ParSort);
     }
+    // Use a radix sort for numeric keys if possible.
+    if ((type == RadixSort  ||
+         ((type == DefaultSort  ||  type == ParSort)  &&
+          nrrec >= T(casacore::RadixSort::minSize())))  &&  canRadixSort()) {
+      radixSort (nrrec, inx);
+      T n = nrrec;
+      if (nodup) {
+        n = insSortNoDup (nrrec, inx);
+      }
+      indexVector.putStorage (inx, del);
+      if (n < nrrec) {
+        indexVector.resize (n, True);
+      }
+      return n;
+    }
     T n = 0;
     switch (type) {
     case QuickSort:
@@ -94,6 +106,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       }
       break;
     case ParSort:
+    case RadixSort:
       n = parSort (nthr, nrrec, inx);
       if (nodup) {
         n = insSortNoDup (nrrec, inx);
@@ -111,6 +124,25 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return n;
   }
 
+  template<typename T>
+  T Sort::doPartialSort (Vector<T>& indexVector, T nrrec, T nrfirst) const
+  {
+    if (nrfirst >= nrrec) {
+      return doSort (indexVector, nrrec);
+    }
+    indexVector.resize (nrrec);
+    indgen (indexVector);
+    Bool del;
+    T* inx = indexVector.getStorage (del);
+    // compare returns >0 if the records are in order. Because compare takes
+    // the index into account for equal keys, the result is stable.
+    std::partial_sort (inx, inx+nrfirst, inx+nrrec,
+                       [this] (T i1, T i2) { return compare(i1, i2) > 0; });
+    indexVector.putStorage (inx, del);
+    indexVector.resize (nrfirst, True);
+    return nrfirst;
+  }
+
   template<typename T>
   T Sort::doUnique (Vector<T>& uniqueVector, T nrrec) const
   {
@@ -174,11 +206,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     int step = nrrec/nthr;
     for (int i=0; i<nthr; ++i) tinx[i] = i*step;
     tinx[nthr] = nrrec;
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for (int i=0; i<nthr; ++i) {
-      int nparts = 1;
+    parallelDo (nthr, nthr, [&] (int i) {
+      T nparts = 1;
       index[tinx[i]] = tinx[i];
       for (T j=tinx[i]+1; j<tinx[i+1]; ++j) {
         if (compare (inx[j-1], inx[j]) <= 0) {
@@ -187,7 +216,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         }
       }
       np[i] = nparts;
-    }
+    });
     // Make index parts consecutive by shifting to the left.
     // See if last and next part can be combined.
     T nparts = np[0];
@@ -208,7 +237,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Merge the array parts. Each part is ordered.
     if (nparts < nrrec) {
       Block<T> inxtmp(nrrec);
-      merge (inx, inxtmp.storage(), nrrec, index.storage(), nparts);
+      merge (nthr, inx, inxtmp.storage(), nrrec, index.storage(), nparts);
     } else {
       // Each part has length 1, so the array is in reversed order.
       for (T i=0; i<nrrec; ++i) inx[i] = nrrec-1-i;
@@ -217,7 +246,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }  
 
   template<typename T>
-  void Sort::merge (T* inx, T* tmp, T nrrec, T* index,
+  void Sort::merge (int nthr, T* inx, T* tmp, T nrrec, T* index,
                     T nparts) const
   {
     T* a = inx;
@@ -228,39 +257,35 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Note that merging the previous part with the last part works fine, even
     // if the last part is in the same buffer.
     T* last = inx + index[np-1];
+    std::vector<const T*> f1(np/2);
+    std::vector<const T*> f2(np/2);
+    std::vector<T*> to(np/2);
     while (np > 1) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic)
-#endif
-      for (int i=0; i<np; i+=2) {
-        if (i < np-1) {
-          // Merge 2 subsequent parts of the array.
-          T* f1 = a+index[i];
-          T* f2 = a+index[i+1];
-          T* to = b+index[i];
-          T na = index[i+1]-index[i];
-          T nb = index[i+2]-index[i+1];
-          if (i == np-2) {
-            //cout<<"swap last np=" <<np<<endl;
-            f2 = last;
-            last = to;
-          }
-          T ia=0, ib=0, k=0;
-          while (ia < na && ib < nb) {
-            if (compare(f1[ia], f2[ib]) > 0) {
-              to[k] = f1[ia++];
-            } else {
-              to[k] = f2[ib++];
-            }
-            k++;
-          }
-          if (ia < na) {
-            for (T p=ia; p<na; p++,k++) to[k] = f1[p];
-          } else {
-            for (T p=ib; p<nb; p++,k++) to[k] = f2[p];
-          }
+      // Determine the pairs of subsequent parts to merge.
+      int npair = np/2;
+      for (int j=0; j<npair; ++j) {
+        int i = 2*j;
+        f1[j] = a+index[i];
+        f2[j] = a+index[i+1];
+        to[j] = b+index[i];
+        if (i == np-2) {
+          f2[j] = last;
+          last = to[j];
         }
       }
+      // If there are fewer pairs than threads (the last merge steps),
+      // the merge of a pair is split into pieces done by different threads.
+      int nsplit = std::max (1, nthr/npair);
+      parallelDo (nthr, npair*nsplit, [&] (int t) {
+        int j = t / nsplit;
+        int i = 2*j;
+        T na = index[i+1]-index[i];
+        T nb = index[i+2]-index[i+1];
+        uInt64 nab = uInt64(na) + nb;
+        int p = t % nsplit;
+        mergePart (f1[j], na, f2[j], nb, to[j],
+                   T(nab*p/nsplit), T(nab*(p+1)/nsplit));
+      });
       // Collapse the index.
       int k=0;
       for (int i=0; i<np; i+=2) index[k++] = index[i];
@@ -277,6 +302,42 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
   }
 
+  template<typename T>
+  void Sort::mergePart (const T* f1, T na, const T* f2, T nb, T* to,
+                        T kst, T kend) const
+  {
+    // Find how many elements of f1 and f2 precede output element kst
+    // using a binary search on the merge path.
+    T lo = (kst > nb  ?  kst-nb : 0);
+    T hi = std::min (kst, na);
+    while (lo < hi) {
+      T mid = lo + (hi-lo)/2;
+      if (compare (f1[mid], f2[kst-mid-1]) > 0) {
+        lo = mid+1;
+      } else {
+        hi = mid;
+      }
+    }
+    T ia = lo;
+    T ib = kst-lo;
+    for (T k=kst; k<kend; ++k) {
+      if (ib >= nb  ||  (ia < na  &&  compare(f1[ia], f2[ib]) > 0)) {
+        to[k] = f1[ia++];
+      } else {
+        to[k] = f2[ib++];
+      }
+    }
+  }
+
+  template<typename Func>
+  void Sort::parallelDo (int nthr, int n, Func func)
+  {
+    // The tasks are handed out dynamically by the global thread pool.
+    // An exception in a task is rethrown when all tasks are done.
+    ThreadPool::global().parallelFor (n, [&func] (size_t i) { func(int(i)); },
+                                      std::max (nthr, 1));
+  }
+
   template<typename T>
   T Sort::insSort (T nrrec, T* inx) const
   {
@@ -336,6 +397,79 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
 
+  template<typename T>
+  Bool Sort::radixSort (T nrrec, T* inx) const
+  {
+    // Sort on the least significant key first. Because each pass is
+    // stable, the result is ordered on all keys.
+    // If all keys are descending, equal keys have to be in descending index
+    // order (see compare), which is the reverse of the ascending sort.
+    Bool reverse = (order_p == Descending);
+    for (size_t i=nrkey_p; i>0; --i) {
+      const SortKey* key = keys_p[i-1];
+      Bool desc = (!reverse  &&  key->order_p == Descending);
+      switch (key->dtype_p) {
+      case TpBool:
+        radixSortKey<Bool> (key, desc, nrrec, inx);
+        break;
+      case TpUChar:
+        radixSortKey<uChar> (key, desc, nrrec, inx);
+        break;
+      case TpShort:
+        radixSortKey<Short> (key, desc, nrrec, inx);
+        break;
+      case TpUShort:
+        radixSortKey<uShort> (key, desc, nrrec, inx);
+        break;
+      case TpInt:
+        radixSortKey<Int> (key, desc, nrrec, inx);
+        break;
+      case TpUInt:
+        radixSortKey<uInt> (key, desc, nrrec, inx);
+        break;
+      case TpInt64:
+        radixSortKey<Int64> (key, desc, nrrec, inx);
+        break;
+      case TpFloat:
+        radixSortKey<Float> (key, desc, nrrec, inx);
+        break;
+      case TpDouble:
+        radixSortKey<Double> (key, desc, nrrec, inx);
+        break;
+      default:
+        return False;
+      }
+    }
+    if (reverse) {
+      std::reverse (inx, inx+nrrec);
+    }
+    return True;
+  }
+
+  template<typename V, typename T>
+  void Sort::radixSortKey (const SortKey* key, Bool descending,
+                           T nrrec, T* inx)
+  {
+    typedef typename RadixSortKey<V>::Key Key;
+    // Get the keys in the current order of the indices.
+    // Inverting the bits gives the descending order.
+    std::vector<Key> keys(nrrec);
+    const char* data = (const char*)key->data_p;
+    uInt incr = key->incr_p;
+    Key mask = (descending  ?  Key(~Key(0)) : Key(0));
+    uInt nthr = casacore::RadixSort::nthreads (nrrec, maxThreads());
+    T chunk = (nrrec + nthr - 1) / nthr;
+    ThreadPool::global().parallelFor (nthr, [&](size_t t) {
+        T end = std::min (nrrec, T((t+1)*chunk));
+        for (T i=t*chunk; i<end; ++i) {
+          keys[i] = RadixSortKey<V>::key (*(const V*)(data + inx[i]*incr))
+                    ^ mask;
+        }
+      }, nthr);
+    casacore::RadixSort::sortKeys (keys.data(), inx, nrrec, nthr);
+  }
+
+
   template<typename T>
   void Sort::qkSort (T nr, T* inx) const
   {
@@ -448,8 +582,42 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     SortKey* skp;
     for (size_t i=0; i<nrkey_p; i++) {
       skp = keys_p[i];
-      seq = skp->cmpObj_p->comp ((char*)skp->data_p + i1*skp->incr_p,
-                                 (char*)skp->data_p + i2*skp->incr_p);
+      // Avoid the virtual function call for the standard types.
+      switch (skp->dtype_p) {
+      case TpBool:
+        seq = compareKey<Bool> (skp, i1, i2);
+        break;
+      case TpUChar:
+        seq = compareKey<uChar> (skp, i1, i2);
+        break;
+      case TpShort:
+        seq = compareKey<Short> (skp, i1, i2);
+        break;
+      case TpUShort:
+        seq = compareKey<uShort> (skp, i1, i2);
+        break;
+      case TpInt:
+        seq = compareKey<Int> (skp, i1, i2);
+        break;
+      case TpUInt:
+        seq = compareKey<uInt> (skp, i1, i2);
+        break;
+      case TpInt64:
+        seq = compareKey<Int64> (skp, i1, i2);
+        break;
+      case TpFloat:
+        seq = compareKey<Float> (skp, i1, i2);
+        break;
+      case TpDouble:
+        seq = compareKey<Double> (skp, i1, i2);
+        break;
+      case TpString:
+        seq = compareKey<String> (skp, i1, i2);
+        break;
+      default:
+        seq = skp->cmpObj_p->comp ((char*)skp->data_p + i1*skp->incr_p,
+                                   (char*)skp->data_p + i2*skp->incr_p);
+      }
       if (seq == skp->order_p)
       {
         idxComp = i;
@@ -0,0 +1,206 @@
+//# tRadixSort.cc: Test program for the radix sort in RadixSort, GenSort and Sort
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/Utilities/RadixSort.h>
+#include <casacore/casa/Utilities/GenSort.h>
+#include <casacore/casa/Utilities/Sort.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Slice.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// Make random values in the range [-range,range) (or [0,range) if unsigned).
+template<typename T>
+std::vector<T> makeData (size_t n, double range)
+{
+  std::vector<T> vec(n);
+  double lower = (std::numeric_limits<T>::is_signed  ?  -range : 0);
+  for (size_t i=0; i<n; ++i) {
+    vec[i] = T(lower + (range-lower) * (rand() / (RAND_MAX+1.)));
+  }
+  return vec;
+}
+
+// Compare the radix sort with the merge sort in GenSort and GenSortIndirect.
+template<typename T>
+void testGenSort (const std::vector<T>& data)
+{
+  uInt n = data.size();
+  for (int opt : {0, int(Sort::NoDuplicates)}) {
+    for (Sort::Order ord : {Sort::Ascending, Sort::Descending}) {
+      std::vector<T> exp(data);
+      std::vector<T> res(data);
+      uInt nexp = GenSort<T>::parSort (exp.data(), n, ord, opt);
+      uInt nres = GenSort<T>::radixSort (res.data(), n, ord, opt);
+      AlwaysAssertExit (nres == nexp);
+      for (uInt i=0; i<nres; ++i) {
+        AlwaysAssertExit (res[i] == exp[i]);
+      }
+      // The default sort uses the radix sort for large arrays.
+      std::vector<T> def(data);
+      AlwaysAssertExit (GenSort<T>::sort (def.data(), n, ord, opt) == nexp);
+      for (uInt i=0; i<nres; ++i) {
+        AlwaysAssertExit (def[i] == exp[i]);
+      }
+      // Indirect sort must give the same indices (it is stable and keeps
+      // the first of duplicates).
+      Vector<uInt> inxExp(n), inxRes;
+      indgen (inxExp);
+      nexp = GenSortIndirect<T>::parSort (inxExp.data(), data.data(), n,
+                                          ord, opt);
+      nres = GenSortIndirect<T>::sort (inxRes, data.data(), n, ord,
+                                       opt | Sort::RadixSort);
+      AlwaysAssertExit (nres == nexp);
+      AlwaysAssertExit (allEQ (inxRes, inxExp(Slice(0,nexp))));
+    }
+  }
+}
+
+// Compare a multi-key radix sort with a heapsort (which, unlike quicksort,
+// keeps the first of duplicates like the radix sort).
+void testSort (uInt n)
+{
+  std::vector<Double> time = makeData<Double> (n, 100);
+  std::vector<Int> ant1 = makeData<Int> (n, 10);
+  std::vector<Short> ant2 = makeData<Short> (n, 5);
+  std::vector<Bool> flag(n);
+  for (uInt i=0; i<n; ++i) {
+    time[i] = Int(time[i]) + 0.5;    // many equal times
+    flag[i] = (i%3 == 0);
+  }
+  Block<Bool> flags(n);
+  for (uInt i=0; i<n; ++i) {
+    flags[i] = flag[i];
+  }
+  for (int i=0; i<4; ++i) {
+    Sort::Order ord1 = (i%2 == 0  ?  Sort::Ascending : Sort::Descending);
+    Sort::Order ord2 = (i/2 == 0  ?  Sort::Ascending : Sort::Descending);
+    Sort sort;
+    sort.sortKey (time.data(), TpDouble, 0, ord1);
+    sort.sortKey (ant1.data(), TpInt, 0, ord2);
+    sort.sortKey (ant2.data(), TpShort, 0, ord1);
+    sort.sortKey (flags.storage(), TpBool, 0, ord1);
+    for (int opt : {0, int(Sort::NoDuplicates)}) {
+      Vector<uInt> inxExp, inxRes, inxDef;
+      uInt nexp = sort.sort (inxExp, n, opt | Sort::HeapSort);
+      uInt nres = sort.sort (inxRes, n, opt | Sort::RadixSort);
+      uInt ndef = sort.sort (inxDef, n, opt);
+      AlwaysAssertExit (nres == nexp  &&  ndef == nexp);
+      AlwaysAssertExit (allEQ (inxRes, inxExp));
+      AlwaysAssertExit (allEQ (inxDef, inxExp));
+      Vector<uInt64> inx64Exp, inx64Res;
+      sort.sort (inx64Exp, uInt64(n), opt | Sort::HeapSort);
+      sort.sort (inx64Res, uInt64(n), opt | Sort::RadixSort);
+      AlwaysAssertExit (allEQ (inx64Res, inx64Exp));
+    }
+  }
+  // A String key cannot be radix sorted, so another sort is used.
+  std::vector<String> names(n);
+  for (uInt i=0; i<n; ++i) {
+    names[i] = String::toString (ant1[i]);
+  }
+  Sort sort;
+  sort.sortKey (time.data(), TpDouble);
+  sort.sortKey (names.data(), TpString);
+  Vector<uInt> inxExp, inxRes;
+  sort.sort (inxExp, n, Sort::QuickSort);
+  sort.sort (inxRes, n, Sort::RadixSort);
+  AlwaysAssertExit (allEQ (inxRes, inxExp));
+}
+
+void testSpecial()
+{
+  // Negative zero and infinities.
+  const Double inf = std::numeric_limits<Double>::infinity();
+  std::vector<Double> vals {0., 3., -0., -inf, -2.5, inf, 1e-300, -1e-300};
+  std::vector<Double> sorted(vals);
+  AlwaysAssertExit (RadixSort::sort (sorted.data(), sorted.size()));
+  std::vector<Double> exp {-inf, -2.5, -1e-300, -0., 0., 1e-300, 3., inf};
+  for (uInt i=0; i<exp.size(); ++i) {
+    AlwaysAssertExit (sorted[i] == exp[i]);
+  }
+  AlwaysAssertExit (std::signbit (sorted[3])  &&  !std::signbit (sorted[4]));
+  // In an indirect sort -0 and 0 are equal, so their order is kept.
+  std::vector<uInt> inx {0,1,2,3,4,5,6,7};
+  AlwaysAssertExit (RadixSort::sortIndirect (inx.data(), vals.data(),
+                                             inx.size()));
+  std::vector<uInt> expInx {3,4,7,0,2,6,1,5};
+  for (uInt i=0; i<expInx.size(); ++i) {
+    AlwaysAssertExit (inx[i] == expInx[i]);
+  }
+  // Extreme integers.
+  std::vector<Int64> ivals {0, std::numeric_limits<Int64>::max(), -1,
+                            std::numeric_limits<Int64>::min(), 1};
+  AlwaysAssertExit (RadixSort::sort (ivals.data(), ivals.size()));
+  AlwaysAssertExit (ivals[0] == std::numeric_limits<Int64>::min()  &&
+                    ivals[1] == -1  &&  ivals[2] == 0  &&  ivals[3] == 1  &&
+                    ivals[4] == std::numeric_limits<Int64>::max());
+  // Unsupported types are not sorted.
+  std::vector<String> strs {"b", "a"};
+  AlwaysAssertExit (! RadixSort::sort (strs.data(), strs.size()));
+  AlwaysAssertExit (strs[0] == "b");
+}
+
+template<typename T>
+void testAll (double range)
+{
+  for (uInt n : {0u, 1u, 100u, 5000u, 300000u}) {
+    testGenSort (makeData<T> (n, range));
+  }
+}
+
+int main()
+{
+  try {
+    testSpecial();
+    // Use multiple threads for the large arrays.
+    ThreadPool::setConcurrency (4);
+    testAll<Int> (1e9);
+    testAll<Int> (100);
+    testAll<uInt> (1e9);
+    testAll<Short> (1000);
+    testAll<uChar> (200);
+    testAll<Int64> (1e18);
+    testAll<uInt64> (1e6);
+    testAll<Float> (1e10);
+    testAll<Double> (1e-10);
+    testAll<Double> (1e300);
+    testSort (5000);
+    testSort (300000);
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
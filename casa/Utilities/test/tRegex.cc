@@ -174,6 +174,32 @@ void testParallel()
   }
 }
 
+void testSimple()
+{
+  // Expressions matched by the simple (non std::regex) algorithm.
+  Regex rx1(Regex::fromPattern("a*b?d"));
+  AlwaysAssertExit (String("abxd").matches(rx1));
+  AlwaysAssertExit (String("axxbbyd").matches(rx1));
+  AlwaysAssertExit (! String("abd").matches(rx1));
+  AlwaysAssertExit (! String("ax\nbyd").matches(rx1));
+  AlwaysAssertExit (! String("xabyd").matches(rx1));
+  Regex rx2(Regex::fromPattern("*ab*ab*"));
+  AlwaysAssertExit (String("abab").matches(rx2));
+  AlwaysAssertExit (String("xabyyabz").matches(rx2));
+  AlwaysAssertExit (! String("aba").matches(rx2));
+  Regex rx3("a\\.b");
+  AlwaysAssertExit (String("a.b").matches(rx3));
+  AlwaysAssertExit (! String("axb").matches(rx3));
+  Int len;
+  AlwaysAssertExit (rx3.search ("xxa.bya.b", 9, len, 0) == 2  &&  len == 3);
+  AlwaysAssertExit (rx3.search ("xxa.bya.b", 9, len, 3) == 6);
+  AlwaysAssertExit (rx3.search ("xxa.bya", 7, len, 3) == String::npos);
+  // The cache returns an equal expression.
+  Regex rx4 = Regex::cached(Regex::fromPattern("a*b?d"));
+  Regex rx5 = Regex::cached(Regex::fromPattern("a*b?d"));
+  AlwaysAssertExit (rx4.regexp() == rx1.regexp());
+  AlwaysAssertExit (String("abxd").matches(rx5));
+}
 
 int main () {
   try {
@@ -188,6 +214,7 @@ int main () {
     testBasic();
     testIO();
     testSearch();
+    testSimple();
   } catch (const std::exception& x) {
     cout << x.what() << endl;
     return 1;
@@ -27,9 +27,11 @@
 
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/stdlib.h>
 #include <casacore/casa/iostream.h>
+#include <vector>
 
 #include <casacore/casa/namespace.h>
 // This program test the class Sort.
@@ -282,6 +284,93 @@ void sort_test_unique()
     cout << endl;
 }
 
+// A copy of ObjCompare<Short> which is not recognized as a standard type.
+class MyCompare : public BaseCompare
+{
+public:
+    virtual int comp (const void* obj1, const void* obj2) const
+      { return ObjCompare<Short>::compare (obj1, obj2); }
+};
+
+// Test the multi-threaded ParSort on multiple keys of different types
+// (also with a user-defined comparison object) by comparing it with QuickSort.
+void sortpar()
+{
+    const uInt nrdata = 100000;
+    std::vector<Int> di(nrdata);
+    std::vector<Double> dd(nrdata);
+    std::vector<String> ds(nrdata);
+    std::vector<Short> dsh(nrdata);
+    for (uInt i=0; i<nrdata; i++) {
+      di[i]  = rand()%10;
+      dd[i]  = (rand()%100) * 0.5;
+      ds[i]  = String::toString (rand()%7);
+      dsh[i] = rand()%5;
+    }
+    Sort::setMaxThreads (4);
+    for (int nodup : {0, int(Sort::NoDuplicates)}) {
+      Sort sort;
+      sort.sortKey (di.data(), TpInt);
+      sort.sortKey (dd.data(), TpDouble, 0, Sort::Descending);
+      sort.sortKey (ds.data(), TpString);
+      sort.sortKey (dsh.data(), std::make_shared<MyCompare>(), sizeof(Short));
+      Vector<uInt> inx1, inx2;
+      uInt nr1 = sort.sort (inx1, nrdata, Sort::ParSort | nodup);
+      uInt nr2 = sort.sort (inx2, nrdata, Sort::QuickSort | nodup);
+      AlwaysAssertExit (nr1 == nr2);
+      // Without duplicates it is undefined which of the equal records is kept.
+      for (uInt i=0; i<nr1; i++) {
+        uInt i1 = inx1[i];
+        uInt i2 = inx2[i];
+        AlwaysAssertExit (di[i1] == di[i2]  &&  dd[i1] == dd[i2]  &&
+                          ds[i1] == ds[i2]  &&  dsh[i1] == dsh[i2]);
+        AlwaysAssertExit (nodup  ||  i1 == i2);
+      }
+      // Also on a single key without GenSort and in descending order.
+      Sort sort2;
+      sort2.sortKey (dd.data(), TpDouble, 0, Sort::Descending);
+      nr1 = sort2.sort (inx1, nrdata, Sort::ParSort | nodup, False);
+      nr2 = sort2.sort (inx2, nrdata, Sort::QuickSort | nodup, False);
+      AlwaysAssertExit (nr1 == nr2);
+      for (uInt i=0; i<nr1; i++) {
+        AlwaysAssertExit (dd[inx1[i]] == dd[inx2[i]]);
+        AlwaysAssertExit (nodup  ||  inx1[i] == inx2[i]);
+      }
+    }
+    Sort::setMaxThreads (0);
+}
+
+// Test the partial (top-k) sort by comparing it with a full sort.
+void sortpartial()
+{
+    const uInt nrdata = 10000;
+    std::vector<Int> di(nrdata);
+    std::vector<Double> dd(nrdata);
+    for (uInt i=0; i<nrdata; i++) {
+      di[i] = rand()%10;
+      dd[i] = (rand()%100) * 0.5;
+    }
+    Sort sort;
+    sort.sortKey (di.data(), TpInt, 0, Sort::Descending);
+    sort.sortKey (dd.data(), TpDouble);
+    Vector<uInt> inx1, inx2;
+    sort.sort (inx1, nrdata);
+    for (uInt nrfirst : {0u, 1u, 10u, 999u, nrdata, nrdata+10}) {
+      uInt nr = sort.partialSort (inx2, nrdata, nrfirst);
+      AlwaysAssertExit (nr == std::min(nrfirst, nrdata));
+      AlwaysAssertExit (inx2.size() == nr);
+      for (uInt i=0; i<nr; i++) {
+        AlwaysAssertExit (inx1[i] == inx2[i]);
+      }
+    }
+    // Also with 64-bit indices.
+    Vector<uInt64> inx3;
+    AlwaysAssertExit (sort.partialSort (inx3, uInt64(nrdata), uInt64(25)) == 25);
+    for (uInt i=0; i<25; i++) {
+      AlwaysAssertExit (inx3[i] == inx1[i]);
+    }
+}
+
 int main()
 {
     sortit (Sort::InsSort);
@@ -308,6 +397,8 @@ int main()
     sortall (Sort::HeapSort | Sort::NoDuplicates, Sort::Descending);
 
     sort_test_unique();
+    sortpar();
+    sortpartial();
 
     return 0;                              // exit with success status
 }
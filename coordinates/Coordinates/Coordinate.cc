@@ -41,9 +41,11 @@
 #include <casacore/casa/Utilities/Regex.h>
 
 #include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/OS/OMP.h>
 
 #include <casacore/casa/iomanip.h>
 #include <casacore/casa/sstream.h>
+#include <exception>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -1044,6 +1046,73 @@ Bool Coordinate::toPixelWCS(Vector<Double> &pixel, const Vector<Double> &world,
 
 
 
+// Apply a wcslib transformation function to a batch of transformations.
+// The function is called as func(wcs, start, n) for the transformations
+// start till start+n and returns the wcslib status.
+// For large batches the transformations are divided over threads, each
+// using its own copy of the wcs struct, because wcslib may write into the
+// struct (e.g. its error info).
+template<typename FUNC>
+static int transformManyWCS (::wcsprm& wcs, uInt nTransforms, FUNC func)
+{
+   // Minimum number of transformations per thread.
+   const uInt minPerThread = 4096;
+   const Int nChunk = std::min(OMP::maxThreads(),
+                               std::max(1u, nTransforms / minPerThread));
+   if (nChunk <= 1) {
+      return func (&wcs, 0, nTransforms);
+   }
+   int iret = 0;
+   std::exception_ptr error;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(nChunk)
+#endif
+   for (Int i=0; i<nChunk; i++) {
+      // Exceptions cannot leave a parallel loop, so the first one is kept
+      // and rethrown afterwards.
+      try {
+         const uInt start = uInt(Int64(i) * nTransforms / nChunk);
+         const uInt end = uInt(Int64(i+1) * nTransforms / nChunk);
+         ::wcsprm wcsCopy;
+         wcsCopy.flag = -1;
+         Coordinate::copy_wcs (wcs, wcsCopy);
+         int ret;
+         try {
+            Coordinate::set_wcs (wcsCopy);
+            ret = func (&wcsCopy, start, end-start);
+         } catch (...) {
+            wcsfree (&wcsCopy);
+            throw;
+         }
+         wcsfree (&wcsCopy);
+#ifdef _OPENMP
+#pragma omp critical(Coordinate_transformManyWCS)
+#endif
+         {
+            // Keep the first error, but prefer a severe one over a failing
+            // transformation (which is not an error of the entire batch).
+            if (ret != 0  &&  (iret == 0  ||  iret == 8  ||  iret == 9)) {
+               iret = ret;
+            }
+         }
+      } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(Coordinate_transformManyWCS)
+#endif
+         {
+            if (! error) {
+               error = std::current_exception();
+            }
+         }
+      }
+   }
+   if (error) {
+      std::rethrow_exception (error);
+   }
+   return iret;
+}
+
+
 Bool Coordinate::toWorldManyWCS (Matrix<Double>& world, const Matrix<Double>& pixel,
                                  Vector<Bool>& failures, ::wcsprm& wcs) const
 {
@@ -1072,7 +1141,14 @@ Bool Coordinate::toWorldManyWCS (Matrix<Double>& world, const Matrix<Double>& pi
     Double* pTheta = theta.getStorage(deleteTheta);
     Int* pStat = stat.getStorage(deleteStat);
 //
-    int iret = wcsp2s (&wcs, nTransforms, nAxes, pPixel, pImgCrd, pPhi, pTheta, pWorld, pStat);
+    int iret = transformManyWCS
+      (wcs, nTransforms,
+       [=] (::wcsprm* pWcs, uInt start, uInt n)
+       {
+          return wcsp2s (pWcs, n, nAxes, pPixel + start*nAxes,
+                         pImgCrd + start*nAxes, pPhi + start, pTheta + start,
+                         pWorld + start*nAxes, pStat + start);
+       });
     for (uInt i=0; i<nTransforms; i++) {
        failures[i] = pStat[i]!=0;
     }
@@ -1124,7 +1200,14 @@ Bool Coordinate::toPixelManyWCS (Matrix<Double>& pixel, const Matrix<Double>& wo
 // Convert from wcs units to pixel
 
     const int nC = nTransforms;
-    int iret = wcss2p (&wcs, nC, nAxes, pWorld, pPhi, pTheta, pImgCrd, pPixel, pStat);
+    int iret = transformManyWCS
+      (wcs, nC,
+       [=] (::wcsprm* pWcs, uInt start, uInt n)
+       {
+          return wcss2p (pWcs, n, nAxes, pWorld + start*nAxes,
+                         pPhi + start, pTheta + start, pImgCrd + start*nAxes,
+                         pPixel + start*nAxes, pStat + start);
+       });
     for (uInt i=0; i<nTransforms; i++) {
        failures[i] = pStat[i]!=0;
     }
@@ -0,0 +1,413 @@
+//# CoordinateGrid.cc: Interpolation grid for fast approximate pixel/world mapping
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/coordinates/Coordinates/CoordinateGrid.h>
+#include <casacore/coordinates/Coordinates/CoordinateSystem.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Quanta/Quantum.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <cmath>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+CoordinateGrid::CoordinateGrid (const CoordinateSystem& cSys,
+                                uInt xAxis, uInt yAxis,
+                                const IPosition& shape, Double tolerance)
+: itsCSys       (cSys),
+  itsShape      (shape),
+  itsTolerance  (tolerance),
+  itsGeneration (0),
+  itsNWorld     (0),
+  itsStep       (0),
+  itsMaxError   (0)
+{
+  if (xAxis >= cSys.nPixelAxes()  ||  yAxis >= cSys.nPixelAxes()  ||
+      xAxis == yAxis) {
+    throw AipsError ("CoordinateGrid: invalid pixel axes given");
+  }
+  if (shape.size() != 2  ||  shape[0] <= 0  ||  shape[1] <= 0) {
+    throw AipsError ("CoordinateGrid: shape must have 2 positive values");
+  }
+  if (tolerance <= 0) {
+    throw AipsError ("CoordinateGrid: tolerance must be positive");
+  }
+  itsAxes[0] = xAxis;
+  itsAxes[1] = yAxis;
+  build();
+}
+
+Bool CoordinateGrid::isValid() const
+{
+  return itsGeneration == itsCSys.generation();
+}
+
+void CoordinateGrid::update()
+{
+  if (! isValid()) {
+    build();
+  }
+}
+
+void CoordinateGrid::build()
+{
+  itsGeneration = itsCSys.generation();
+  itsNWorld = itsCSys.nWorldAxes();
+  for (uInt k=0; k<2; ++k) {
+    itsWorldAxes[k] = itsCSys.pixelAxisToWorldAxis (itsAxes[k]);
+    if (itsWorldAxes[k] < 0) {
+      throw AipsError ("CoordinateGrid: pixel axis has no world axis");
+    }
+  }
+  // Longitudes are unwrapped when interpolating.
+  itsPeriod.assign (itsNWorld, 0.);
+  const Vector<String> units = itsCSys.worldAxisUnits();
+  for (uInt i=0; i<itsNWorld; ++i) {
+    Int coord, axisInCoord;
+    itsCSys.findWorldAxis (coord, axisInCoord, i);
+    if (coord >= 0  &&  axisInCoord == 0  &&
+        itsCSys.type(coord) == Coordinate::DIRECTION) {
+      itsPeriod[i] = Quantity(360., "deg").getValue (units[i]);
+    }
+  }
+  Vector<Double> refPix = itsCSys.referencePixel();
+  itsPixel.assign (refPix.begin(), refPix.end());
+  // Halve the spacing until the interpolation error is small enough.
+  Double step = std::max (1., Double(std::max(itsShape[0], itsShape[1])) / 4);
+  while (True) {
+    makeNodes (step);
+    itsMaxError = cellError();
+    if (itsMaxError <= itsTolerance  ||  step <= 1) {
+      break;
+    }
+    step /= 2;
+  }
+}
+
+void CoordinateGrid::makeNodes (Double step)
+{
+  itsStep = step;
+  for (uInt k=0; k<2; ++k) {
+    itsNNode[k] = uInt(std::ceil (itsShape[k] / step)) + 1;
+  }
+  uInt nnode = itsNNode[0] * itsNNode[1];
+  Matrix<Double> pixel(itsPixel.size(), nnode);
+  for (uInt iy=0; iy<itsNNode[1]; ++iy) {
+    for (uInt ix=0; ix<itsNNode[0]; ++ix) {
+      uInt inx = iy*itsNNode[0] + ix;
+      std::copy (itsPixel.begin(), itsPixel.end(), &pixel(0,inx));
+      pixel(itsAxes[0], inx) = -0.5 + ix*step;
+      pixel(itsAxes[1], inx) = -0.5 + iy*step;
+    }
+  }
+  Matrix<Double> world;
+  Vector<Bool> failures;
+  itsCSys.toWorldMany (world, pixel, failures);
+  itsNodes.assign (world.begin(), world.end());
+  itsValid.resize (nnode);
+  for (uInt i=0; i<nnode; ++i) {
+    itsValid[i] = !failures[i];
+  }
+}
+
+Double CoordinateGrid::cellError()
+{
+  // The interpolation error is largest at the cell centres.
+  uInt ncell = (itsNNode[0] - 1) * (itsNNode[1] - 1);
+  Matrix<Double> world(itsNWorld, ncell);
+  std::vector<Double> xy;
+  xy.reserve (2*ncell);
+  uInt n = 0;
+  for (uInt iy=0; iy<itsNNode[1]-1; ++iy) {
+    for (uInt ix=0; ix<itsNNode[0]-1; ++ix) {
+      Double x = (ix + 0.5) * itsStep - 0.5;
+      Double y = (iy + 0.5) * itsStep - 0.5;
+      if (interpolate (&world(0,n), x, y)) {
+        xy.push_back (x);
+        xy.push_back (y);
+        ++n;
+      }
+    }
+  }
+  if (n == 0) {
+    return 0;
+  }
+  world.resize (itsNWorld, n, True);
+  Matrix<Double> pixel;
+  Vector<Bool> failures;
+  itsCSys.toPixelMany (pixel, world, failures);
+  Double maxErr = 0;
+  for (uInt i=0; i<n; ++i) {
+    if (! failures[i]) {
+      Double err = std::hypot (pixel(itsAxes[0],i) - xy[2*i],
+                               pixel(itsAxes[1],i) - xy[2*i+1]);
+      maxErr = std::max (maxErr, err);
+    }
+  }
+  return maxErr;
+}
+
+Bool CoordinateGrid::findCell (Double x, Double y, uInt& ix, uInt& iy,
+                               Double& tx, Double& ty) const
+{
+  Double fx = (x + 0.5) / itsStep;
+  Double fy = (y + 0.5) / itsStep;
+  // Written such that NaNs are rejected as well.
+  if (!(fx >= 0  &&  fy >= 0  &&
+        fx <= itsNNode[0] - 1  &&  fy <= itsNNode[1] - 1)) {
+    return False;
+  }
+  ix = std::min (uInt(fx), itsNNode[0] - 2);
+  iy = std::min (uInt(fy), itsNNode[1] - 2);
+  tx = fx - ix;
+  ty = fy - iy;
+  uInt inx = iy*itsNNode[0] + ix;
+  return (itsValid[inx]  &&  itsValid[inx+1]  &&
+          itsValid[inx+itsNNode[0]]  &&  itsValid[inx+itsNNode[0]+1]);
+}
+
+Double CoordinateGrid::nodeValue (uInt ix, uInt iy, uInt axis,
+                                  Double ref) const
+{
+  Double v = itsNodes[(iy*itsNNode[0] + ix) * itsNWorld + axis];
+  if (itsPeriod[axis] > 0) {
+    v += itsPeriod[axis] * std::round ((ref - v) / itsPeriod[axis]);
+  }
+  return v;
+}
+
+Bool CoordinateGrid::interpolate (Double* world, Double x, Double y) const
+{
+  uInt ix, iy;
+  Double tx, ty;
+  if (! findCell (x, y, ix, iy, tx, ty)) {
+    return False;
+  }
+  for (uInt i=0; i<itsNWorld; ++i) {
+    Double v00 = itsNodes[(iy*itsNNode[0] + ix) * itsNWorld + i];
+    Double v10 = nodeValue (ix+1, iy, i, v00);
+    Double v01 = nodeValue (ix, iy+1, i, v00);
+    Double v11 = nodeValue (ix+1, iy+1, i, v00);
+    world[i] = ((1-ty) * ((1-tx)*v00 + tx*v10) +
+                ty * ((1-tx)*v01 + tx*v11));
+  }
+  return True;
+}
+
+Bool CoordinateGrid::invert (Double& x, Double& y, const Double* world) const
+{
+  Double xmax = (itsNNode[0] - 1) * itsStep - 0.5;
+  Double ymax = (itsNNode[1] - 1) * itsStep - 0.5;
+  for (uInt iter=0; iter<20; ++iter) {
+    // Keep the position inside the grid while iterating.
+    x = std::max (-0.5, std::min (x, xmax));
+    y = std::max (-0.5, std::min (y, ymax));
+    uInt ix, iy;
+    Double tx, ty;
+    if (! findCell (x, y, ix, iy, tx, ty)) {
+      return False;
+    }
+    // Evaluate the bilinear map and its derivatives.
+    Double r[2], dfdx[2], dfdy[2];
+    for (uInt k=0; k<2; ++k) {
+      uInt axis = itsWorldAxes[k];
+      Double v00 = itsNodes[(iy*itsNNode[0] + ix) * itsNWorld + axis];
+      Double v10 = nodeValue (ix+1, iy, axis, v00);
+      Double v01 = nodeValue (ix, iy+1, axis, v00);
+      Double v11 = nodeValue (ix+1, iy+1, axis, v00);
+      Double f = ((1-ty) * ((1-tx)*v00 + tx*v10) +
+                  ty * ((1-tx)*v01 + tx*v11));
+      dfdx[k] = ((1-ty)*(v10-v00) + ty*(v11-v01)) / itsStep;
+      dfdy[k] = ((1-tx)*(v01-v00) + tx*(v11-v10)) / itsStep;
+      r[k] = world[axis] - f;
+      if (itsPeriod[axis] > 0) {
+        r[k] -= itsPeriod[axis] * std::round (r[k] / itsPeriod[axis]);
+      }
+    }
+    Double det = dfdx[0]*dfdy[1] - dfdy[0]*dfdx[1];
+    if (det == 0) {
+      return False;
+    }
+    Double dx = (dfdy[1]*r[0] - dfdy[0]*r[1]) / det;
+    Double dy = (dfdx[0]*r[1] - dfdx[1]*r[0]) / det;
+    x += dx;
+    y += dy;
+    if (std::abs(dx) < 1e-6  &&  std::abs(dy) < 1e-6) {
+      return (x >= -0.5  &&  x <= xmax  &&  y >= -0.5  &&  y <= ymax);
+    }
+  }
+  return False;
+}
+
+Bool CoordinateGrid::exactWorld (Double* world, Double x, Double y)
+{
+  Vector<Double> pixel(itsPixel.begin(), itsPixel.end());
+  pixel[itsAxes[0]] = x;
+  pixel[itsAxes[1]] = y;
+  Vector<Double> w;
+  if (! itsCSys.toWorld (w, pixel)) {
+    itsErrorMessage = itsCSys.errorMessage();
+    return False;
+  }
+  std::copy (w.begin(), w.end(), world);
+  return True;
+}
+
+Bool CoordinateGrid::exactPixel (Double& x, Double& y, const Double* world)
+{
+  Vector<Double> w(IPosition(1, itsNWorld), const_cast<Double*>(world),
+                   SHARE);
+  Vector<Double> pixel;
+  if (! itsCSys.toPixel (pixel, w)) {
+    itsErrorMessage = itsCSys.errorMessage();
+    return False;
+  }
+  x = pixel[itsAxes[0]];
+  y = pixel[itsAxes[1]];
+  return True;
+}
+
+Bool CoordinateGrid::toWorld (Vector<Double>& world,
+                              const Vector<Double>& pixel)
+{
+  if (pixel.size() != 2) {
+    throw AipsError ("CoordinateGrid::toWorld: pixel must have length 2");
+  }
+  update();
+  world.resize (itsNWorld);
+  return (interpolate (world.data(), pixel[0], pixel[1])  ||
+          exactWorld (world.data(), pixel[0], pixel[1]));
+}
+
+Bool CoordinateGrid::toPixel (Vector<Double>& pixel,
+                              const Vector<Double>& world)
+{
+  if (world.size() != itsCSys.nWorldAxes()) {
+    throw AipsError ("CoordinateGrid::toPixel: world has invalid length");
+  }
+  update();
+  pixel.resize (2);
+  Vector<Double> w = world.copy();
+  pixel[0] = 0.5 * itsShape[0] - 0.5;
+  pixel[1] = 0.5 * itsShape[1] - 0.5;
+  return (invert (pixel[0], pixel[1], w.data())  ||
+          exactPixel (pixel[0], pixel[1], w.data()));
+}
+
+Bool CoordinateGrid::toWorldMany (Matrix<Double>& world,
+                                  const Matrix<Double>& pixel,
+                                  Vector<Bool>& failures)
+{
+  if (pixel.nrow() != 2) {
+    throw AipsError ("CoordinateGrid::toWorldMany: pixel must have 2 rows");
+  }
+  update();
+  uInt n = pixel.ncolumn();
+  world.resize (itsNWorld, n);
+  failures.resize (n);
+  failures = False;
+  // Positions not covered by the grid are converted exactly in one go.
+  std::vector<uInt> exact;
+  for (uInt i=0; i<n; ++i) {
+    if (! interpolate (&world(0,i), pixel(0,i), pixel(1,i))) {
+      exact.push_back (i);
+    }
+  }
+  Bool ok = True;
+  if (! exact.empty()) {
+    Matrix<Double> pixExact(itsPixel.size(), exact.size());
+    for (uInt i=0; i<exact.size(); ++i) {
+      std::copy (itsPixel.begin(), itsPixel.end(), &pixExact(0,i));
+      pixExact(itsAxes[0], i) = pixel(0, exact[i]);
+      pixExact(itsAxes[1], i) = pixel(1, exact[i]);
+    }
+    Matrix<Double> worldExact;
+    Vector<Bool> failExact;
+    ok = itsCSys.toWorldMany (worldExact, pixExact, failExact);
+    if (! ok) {
+      itsErrorMessage = itsCSys.errorMessage();
+    }
+    for (uInt i=0; i<exact.size(); ++i) {
+      world.column(exact[i]) = worldExact.column(i);
+      failures[exact[i]] = failExact[i];
+    }
+  }
+  return ok;
+}
+
+Bool CoordinateGrid::toPixelMany (Matrix<Double>& pixel,
+                                  const Matrix<Double>& world,
+                                  Vector<Bool>& failures)
+{
+  if (world.nrow() != itsCSys.nWorldAxes()) {
+    throw AipsError ("CoordinateGrid::toPixelMany: world has invalid "
+                     "number of rows");
+  }
+  update();
+  uInt n = world.ncolumn();
+  pixel.resize (2, n);
+  failures.resize (n);
+  failures = False;
+  Bool deleteIt;
+  const Double* wdata = world.getStorage (deleteIt);
+  // Start each iteration at the previous solution, because positions
+  // are usually close to each other.
+  Double x = 0.5 * itsShape[0] - 0.5;
+  Double y = 0.5 * itsShape[1] - 0.5;
+  std::vector<uInt> exact;
+  for (uInt i=0; i<n; ++i) {
+    Double xi = x;
+    Double yi = y;
+    if (invert (xi, yi, wdata + i*itsNWorld)) {
+      pixel(0,i) = x = xi;
+      pixel(1,i) = y = yi;
+    } else {
+      exact.push_back (i);
+    }
+  }
+  world.freeStorage (wdata, deleteIt);
+  Bool ok = True;
+  if (! exact.empty()) {
+    Matrix<Double> worldExact(itsNWorld, exact.size());
+    for (uInt i=0; i<exact.size(); ++i) {
+      worldExact.column(i) = world.column(exact[i]);
+    }
+    Matrix<Double> pixExact;
+    Vector<Bool> failExact;
+    ok = itsCSys.toPixelMany (pixExact, worldExact, failExact);
+    if (! ok) {
+      itsErrorMessage = itsCSys.errorMessage();
+    }
+    for (uInt i=0; i<exact.size(); ++i) {
+      pixel(0, exact[i]) = pixExact(itsAxes[0], i);
+      pixel(1, exact[i]) = pixExact(itsAxes[1], i);
+      failures[exact[i]] = failExact[i];
+    }
+  }
+  return ok;
+}
+
+} //# NAMESPACE CASACORE - END
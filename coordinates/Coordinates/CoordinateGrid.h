@@ -0,0 +1,200 @@
+//# CoordinateGrid.h: Interpolation grid for fast approximate pixel/world mapping
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef COORDINATES_COORDINATEGRID_H
+#define COORDINATES_COORDINATEGRID_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+class CoordinateSystem;
+
+
+// <summary>
+// Interpolation grid for fast approximate pixel/world mapping
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tCoordinateGrid">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=CoordinateSystem>CoordinateSystem</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Converting pixel to world coordinates (or vice versa) with a
+// CoordinateSystem can be expensive, in particular for celestial
+// projections and frame conversions. Applications converting many
+// positions in an image plane (e.g. for regridding or display) usually
+// do not need full precision.
+//
+// A CoordinateGrid holds the exact world coordinates on a regular grid of
+// nodes in the plane of two pixel axes of a CoordinateSystem. The other
+// pixel axes are held at their reference pixel. Conversions are done by
+// bilinear interpolation between the nodes (pixel to world) and by Newton
+// iteration on the interpolated map (world to pixel). The grid spacing is
+// halved until the error at the cell centres (where the interpolation
+// error is largest) is below the given tolerance in pixels.
+// Longitude axes are unwrapped when interpolating.
+//
+// Positions outside the grid or in cells containing nodes that could not
+// be converted (e.g. outside the projection) are converted exactly.
+//
+// The CoordinateGrid keeps a reference to the CoordinateSystem, which has
+// to outlive it. Before each conversion the
+// <linkto class=CoordinateSystem>generation</linkto> of the
+// CoordinateSystem is checked and the grid is rebuilt if the system
+// has been changed.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   CoordinateSystem cSys = CoordinateUtil::defaultCoords2D();
+//   CoordinateGrid grid(cSys, 0, 1, IPosition(2,512,512), 0.01);
+//   Matrix<Double> world;
+//   Vector<Bool> failures;
+//   grid.toWorldMany (world, pixel, failures);
+// </srcblock>
+// </example>
+
+// <motivation>
+// Fast coordinate conversions for image regridding and display.
+// </motivation>
+
+class CoordinateGrid
+{
+public:
+    // Create the grid for the given pixel axes of the CoordinateSystem.
+    // The grid covers the pixels [-0.5, shape-0.5] of both axes.
+    // The maximum interpolation error is given in pixels.
+    // An exception is thrown if the axes are invalid or have no world axis.
+    CoordinateGrid (const CoordinateSystem& cSys, uInt xAxis, uInt yAxis,
+                    const IPosition& shape, Double tolerance=0.01);
+
+    // Convert a pixel position (x,y) to the world coordinates of all
+    // world axes. Returns False if it fails with an error message
+    // recoverable with function errorMessage.
+    Bool toWorld (Vector<Double>& world, const Vector<Double>& pixel);
+
+    // Convert the world coordinates of all world axes to the pixel
+    // position (x,y). Only the world axes of the grid's pixel axes are used.
+    Bool toPixel (Vector<Double>& pixel, const Vector<Double>& world);
+
+    // Convert many positions. The pixel matrix has shape [2,n] and the world
+    // matrix has shape [nWorldAxes,n]. The failures vector tells which
+    // conversions failed.
+    // <group>
+    Bool toWorldMany (Matrix<Double>& world, const Matrix<Double>& pixel,
+                      Vector<Bool>& failures);
+    Bool toPixelMany (Matrix<Double>& pixel, const Matrix<Double>& world,
+                      Vector<Bool>& failures);
+    // </group>
+
+    // Is the grid up to date with the CoordinateSystem?
+    Bool isValid() const;
+
+    // Rebuild the grid if the CoordinateSystem has changed.
+    // This is done automatically by the conversion functions.
+    void update();
+
+    // Get the grid spacing in pixels.
+    Double step() const
+      { return itsStep; }
+
+    // Get the maximum error (in pixels) found at the cell centres.
+    Double maxError() const
+      { return itsMaxError; }
+
+    // Get the tolerance.
+    Double tolerance() const
+      { return itsTolerance; }
+
+    // Recover the error message of the conversion functions.
+    const String& errorMessage() const
+      { return itsErrorMessage; }
+
+private:
+    // Build the grid, halving the spacing until within tolerance.
+    void build();
+
+    // Calculate the world coordinates at the nodes for the given spacing.
+    void makeNodes (Double step);
+
+    // Determine the maximum interpolation error at the cell centres.
+    Double cellError();
+
+    // Get the cell and the offsets in it for a pixel position.
+    // Returns False if not inside the grid or if a node is invalid.
+    Bool findCell (Double x, Double y, uInt& ix, uInt& iy,
+                   Double& tx, Double& ty) const;
+
+    // Interpolate the world coordinates at a pixel position.
+    Bool interpolate (Double* world, Double x, Double y) const;
+
+    // Find the pixel position of a world coordinate by Newton iteration.
+    Bool invert (Double& x, Double& y, const Double* world) const;
+
+    // Get a node value of a world axis, unwrapped with respect to ref.
+    Double nodeValue (uInt ix, uInt iy, uInt axis, Double ref) const;
+
+    // Exact conversions of a single position.
+    // <group>
+    Bool exactWorld (Double* world, Double x, Double y);
+    Bool exactPixel (Double& x, Double& y, const Double* world);
+    // </group>
+
+    const CoordinateSystem& itsCSys;
+    uInt     itsAxes[2];
+    Int      itsWorldAxes[2];
+    IPosition itsShape;
+    Double   itsTolerance;
+    uInt64   itsGeneration;
+    uInt     itsNWorld;
+    // Pixel position of all axes (non-grid axes at their reference pixel).
+    std::vector<Double> itsPixel;
+    // Period of each world axis (0 if not a longitude).
+    std::vector<Double> itsPeriod;
+    Double   itsStep;
+    uInt     itsNNode[2];
+    // World values of the nodes as [nworld,nx,ny] and their validity.
+    std::vector<Double> itsNodes;
+    std::vector<Bool>   itsValid;
+    Double   itsMaxError;
+    String   itsErrorMessage;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
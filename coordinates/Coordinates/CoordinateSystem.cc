@@ -59,6 +59,7 @@
 #include <casacore/casa/sstream.h>
 #include <casacore/casa/iomanip.h>
 #include <casacore/casa/iostream.h>
+#include <atomic>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -69,12 +70,12 @@ map<String, String> CoordinateSystem::_friendlyAxisMap = map<String, String>();
 
 
 CoordinateSystem::CoordinateSystem()
-: coordinates_p(0), 
-  world_maps_p(0), world_tmps_p(0), world_replacement_values_p(0),
+: world_maps_p(0), world_tmps_p(0), world_replacement_values_p(0),
   pixel_maps_p(0), pixel_tmps_p(0), pixel_replacement_values_p(0),
   worldAxes_tmps_p(0), pixelAxes_tmps_p(0),
   worldOut_tmps_p(0), pixelOut_tmps_p(0),
-  worldMin_tmps_p(0), worldMax_tmps_p(0)
+  worldMin_tmps_p(0), worldMax_tmps_p(0),
+  generation_p(newGeneration())
 {
    setDefaultWorldMixRanges();
 }
@@ -87,14 +88,18 @@ void CoordinateSystem::copy(const CoordinateSystem &other)
 //
     clear();
 //
+    generation_p = other.generation_p;
     obsinfo_p = other.obsinfo_p;
-    coordinates_p = other.coordinates_p;
-    const uInt n = coordinates_p.nelements();
+    const uInt n = other.coordinates_p.size();
 //
+// Share the coordinates with the other CoordinateSystem.
+// They are only copied when used or changed.
+//
+    coordinates_p.resize(n);
+    shared_coordinates_p.resize(n);
     uInt i;
     for (i=0; i < n; i++) {
-	coordinates_p[i] = coordinates_p[i]->clone();
-	AlwaysAssert(coordinates_p[i], AipsError);
+	shared_coordinates_p[i] = other.sharedCoordinate(i);
     }
 //
     world_maps_p.resize(n);
@@ -143,23 +148,24 @@ void CoordinateSystem::copy(const CoordinateSystem &other)
 
 void CoordinateSystem::clear()
 {
-    const uInt n = coordinates_p.nelements();
+    const uInt n = coordinates_p.size();
 //
     for (uInt i=0; i<n; i++) {
         deleteTemps (i);
-	delete coordinates_p[i]; 
-        coordinates_p[i] = 0;
     }
+    std::lock_guard<std::mutex> lock(coordinates_mutex_p);
+    coordinates_p.clear();
+    shared_coordinates_p.clear();
 }
 
 CoordinateSystem::CoordinateSystem(const CoordinateSystem &other)
     : Coordinate(),
-      coordinates_p(0), 
       world_maps_p(0), world_tmps_p(0), world_replacement_values_p(0),
       pixel_maps_p(0), pixel_tmps_p(0), pixel_replacement_values_p(0),
       worldAxes_tmps_p(0), pixelAxes_tmps_p(0),
       worldOut_tmps_p(0), pixelOut_tmps_p(0),
-      worldMin_tmps_p(0), worldMax_tmps_p(0)
+      worldMin_tmps_p(0), worldMax_tmps_p(0),
+      generation_p(other.generation_p)
 {
     copy(other);
 }
@@ -179,22 +185,72 @@ CoordinateSystem::~CoordinateSystem()
     clear();
 }
 
+uInt64 CoordinateSystem::newGeneration()
+{
+    static std::atomic<uInt64> lastGeneration(0);
+    return ++lastGeneration;
+}
+
+void CoordinateSystem::changed()
+{
+    generation_p = newGeneration();
+}
+
+Coordinate& CoordinateSystem::privateCoordinate(uInt which) const
+{
+    std::lock_guard<std::mutex> lock(coordinates_mutex_p);
+    if (! coordinates_p[which]) {
+	coordinates_p[which].reset (shared_coordinates_p[which]->clone());
+    }
+    return *coordinates_p[which];
+}
+
+Coordinate& CoordinateSystem::changeCoordinate(uInt which)
+{
+    Coordinate& coord = privateCoordinate(which);
+    std::lock_guard<std::mutex> lock(coordinates_mutex_p);
+    shared_coordinates_p[which].reset();
+    return coord;
+}
+
+const Coordinate& CoordinateSystem::peekCoordinate(uInt which) const
+{
+    std::lock_guard<std::mutex> lock(coordinates_mutex_p);
+    if (coordinates_p[which]) {
+	return *coordinates_p[which];
+    }
+    return *shared_coordinates_p[which];
+}
+
+std::shared_ptr<const Coordinate> CoordinateSystem::sharedCoordinate(uInt which) const
+{
+    std::lock_guard<std::mutex> lock(coordinates_mutex_p);
+    if (! shared_coordinates_p[which]) {
+	shared_coordinates_p[which].reset (coordinates_p[which]->clone());
+    }
+    return shared_coordinates_p[which];
+}
+
 void CoordinateSystem::addCoordinate(const Coordinate &coord)
 {
+    changed();
     uInt oldWorldAxes = nWorldAxes();
     uInt oldPixelAxes = nPixelAxes();
 //
 // coordinates_p
 //
-    const uInt n = coordinates_p.nelements(); // "before" n, index of new coord
-    coordinates_p.resize(n+1);
-    coordinates_p[n] = coord.clone();
+    const uInt n = coordinates_p.size(); // "before" n, index of new coord
+    {
+        std::lock_guard<std::mutex> lock(coordinates_mutex_p);
+        coordinates_p.emplace_back (coord.clone());
+        shared_coordinates_p.emplace_back();
+    }
     AlwaysAssert(coordinates_p[n] != 0, AipsError);
 //
 // world_maps_p
 //
     world_maps_p.resize(n+1);
-    world_maps_p[n] = new Block<Int>(coordinates_p[n]->nWorldAxes());
+    world_maps_p[n] = new Block<Int>(peekCoordinate(n).nWorldAxes());
     AlwaysAssert(world_maps_p[n], AipsError);
     uInt i;
     for (i=0; i < world_maps_p[n]->nelements(); i++) {
@@ -204,13 +260,13 @@ void CoordinateSystem::addCoordinate(const Coordinate &coord)
 // world_tmps_p
 //
     world_tmps_p.resize(n+1);
-    world_tmps_p[n] = new Vector<Double>(coordinates_p[n]->nWorldAxes());
+    world_tmps_p[n] = new Vector<Double>(peekCoordinate(n).nWorldAxes());
     AlwaysAssert(world_tmps_p[n], AipsError);
 //
 // pixel_maps_p
 //
     pixel_maps_p.resize(n+1);
-    pixel_maps_p[n] = new Block<Int>(coordinates_p[n]->nPixelAxes());
+    pixel_maps_p[n] = new Block<Int>(peekCoordinate(n).nPixelAxes());
     AlwaysAssert(pixel_maps_p[n], AipsError);
     for (i=0; i < pixel_maps_p[n]->nelements(); i++) {
 	pixel_maps_p[n]->operator[](i) = oldPixelAxes + i;
@@ -219,14 +275,14 @@ void CoordinateSystem::addCoordinate(const Coordinate &coord)
 // pixel_tmps_p
 //
     pixel_tmps_p.resize(n+1);
-    pixel_tmps_p[n] = new Vector<Double>(coordinates_p[n]->nPixelAxes());
+    pixel_tmps_p[n] = new Vector<Double>(peekCoordinate(n).nPixelAxes());
     AlwaysAssert(pixel_tmps_p[n], AipsError);
 //
 // pixel_replacement_values_p
 //
     pixel_replacement_values_p.resize(n+1);
     pixel_replacement_values_p[n] = 
-	new Vector<Double>(coordinates_p[n]->nPixelAxes());
+	new Vector<Double>(peekCoordinate(n).nPixelAxes());
     AlwaysAssert(pixel_replacement_values_p[n], AipsError);
     *(pixel_replacement_values_p[n]) = 0.0;
 //
@@ -234,51 +290,52 @@ void CoordinateSystem::addCoordinate(const Coordinate &coord)
 //
     world_replacement_values_p.resize(n+1);
     world_replacement_values_p[n] = 
-	new Vector<Double>(coordinates_p[n]->nWorldAxes());
+	new Vector<Double>(peekCoordinate(n).nWorldAxes());
     AlwaysAssert(world_replacement_values_p[n], AipsError);
-    coordinates_p[n] -> toWorld(*(world_replacement_values_p[n]),
+    privateCoordinate(n).toWorld(*(world_replacement_values_p[n]),
 				*(pixel_replacement_values_p[n]));
 //
 // worldAxes_tmps_p
 //
     worldAxes_tmps_p.resize(n+1);
-    worldAxes_tmps_p[n] = new Vector<Bool>(coordinates_p[n]->nWorldAxes());
+    worldAxes_tmps_p[n] = new Vector<Bool>(peekCoordinate(n).nWorldAxes());
     AlwaysAssert(worldAxes_tmps_p[n], AipsError);
 //
 // pixelAxes_tmps_p
 //
     pixelAxes_tmps_p.resize(n+1);
-    pixelAxes_tmps_p[n] = new Vector<Bool>(coordinates_p[n]->nPixelAxes());
+    pixelAxes_tmps_p[n] = new Vector<Bool>(peekCoordinate(n).nPixelAxes());
     AlwaysAssert(pixelAxes_tmps_p[n], AipsError);
 //
 // worldOut_tmps_p
 //
     worldOut_tmps_p.resize(n+1);
-    worldOut_tmps_p[n] = new Vector<Double>(coordinates_p[n]->nWorldAxes());
+    worldOut_tmps_p[n] = new Vector<Double>(peekCoordinate(n).nWorldAxes());
     AlwaysAssert(worldOut_tmps_p[n], AipsError);
 //
 // pixelOut_tmps_p
 //
     pixelOut_tmps_p.resize(n+1);
-    pixelOut_tmps_p[n] = new Vector<Double>(coordinates_p[n]->nPixelAxes());
+    pixelOut_tmps_p[n] = new Vector<Double>(peekCoordinate(n).nPixelAxes());
     AlwaysAssert(pixelOut_tmps_p[n], AipsError);
 //
 // worldMin_tmps_p
 //
     worldMin_tmps_p.resize(n+1);
-    worldMin_tmps_p[n] = new Vector<Double>(coordinates_p[n]->nWorldAxes());
+    worldMin_tmps_p[n] = new Vector<Double>(peekCoordinate(n).nWorldAxes());
     AlwaysAssert(worldMin_tmps_p[n], AipsError);
 //
 // worldMax_tmps_p
 //
     worldMax_tmps_p.resize(n+1);
-    worldMax_tmps_p[n] = new Vector<Double>(coordinates_p[n]->nWorldAxes());
+    worldMax_tmps_p[n] = new Vector<Double>(peekCoordinate(n).nWorldAxes());
     AlwaysAssert(worldMax_tmps_p[n], AipsError);
 }
 
 void CoordinateSystem::transpose(const Vector<Int> &newWorldOrder,
 				 const Vector<Int> &newPixelOrder)
 {
+    changed();
     AlwaysAssert(newWorldOrder.nelements() == nWorldAxes(), AipsError);
     AlwaysAssert(newPixelOrder.nelements() == nPixelAxes(), AipsError);
 
@@ -477,6 +534,7 @@ Bool CoordinateSystem::worldMap(Vector<Int>& worldAxisMap,
 
 Bool CoordinateSystem::removeWorldAxis(uInt axis, Double replacement) 
 {
+    changed();
     if (axis >= nWorldAxes()) {
        ostringstream oss;
        oss << "Illegal removal world axis number (" << axis << "), max is ("
@@ -518,6 +576,7 @@ Bool CoordinateSystem::removeWorldAxis(uInt axis, Double replacement)
 
 Bool CoordinateSystem::removePixelAxis(uInt axis, Double replacement) 
 {
+    changed();
     if (axis >= nPixelAxes()) {
        ostringstream oss;
        oss << "Illegal removal pixel axis number (" << axis << "), max is ("
@@ -562,6 +621,7 @@ Bool CoordinateSystem::worldReplacementValue (Double& replacement, uInt axis) co
 
 Bool CoordinateSystem::setWorldReplacementValue (uInt axis, Double replacement) 
 {
+    changed();
    Int coordinate = -1;
    Int axisInCoordinate = -1;
    if (checkWorldReplacementAxis(coordinate, axisInCoordinate, axis)) {
@@ -586,6 +646,7 @@ Bool CoordinateSystem::pixelReplacementValue (Double& replacement, uInt axis) co
 
 Bool CoordinateSystem::setPixelReplacementValue (uInt axis, Double replacement) 
 {
+    changed();
    Int coordinate = -1;
    Int axisInCoordinate = -1;
    if (checkPixelReplacementAxis(coordinate, axisInCoordinate, axis)) {
@@ -612,6 +673,7 @@ void CoordinateSystem::subImageInSitu(const Vector<Float> &originShift,
                                       const Vector<Float> &pixincFac,
                                       const Vector<Int>& newShape)
 {
+    changed();
     AlwaysAssert(originShift.nelements() == nPixelAxes() &&
                  pixincFac.nelements() == nPixelAxes(), AipsError);
     const uInt nShape = newShape.nelements();
@@ -709,13 +771,14 @@ void CoordinateSystem::subImageInSitu(const Vector<Float> &originShift,
 
 void CoordinateSystem::restoreOriginal()
 {
+    changed();
     CoordinateSystem coord;
 
 // Make a copy and then assign it back
 
-    uInt n = coordinates_p.nelements();
+    uInt n = coordinates_p.size();
     for (uInt i=0; i<n; i++) {
-	coord.addCoordinate(*(coordinates_p[i]));
+	coord.addCoordinate(peekCoordinate(i));
     }
 //    
     *this = coord;
@@ -723,39 +786,39 @@ void CoordinateSystem::restoreOriginal()
 
 uInt CoordinateSystem::nCoordinates() const
 {
-    return coordinates_p.nelements();
+    return coordinates_p.size();
 }
 
 Coordinate::Type CoordinateSystem::type(uInt whichCoordinate) const
 {
     AlwaysAssert(whichCoordinate<nCoordinates(), AipsError);
-    return coordinates_p[whichCoordinate]->type();
+    return peekCoordinate(whichCoordinate).type();
 }
 
 String CoordinateSystem::showType(uInt whichCoordinate) const
 {
     AlwaysAssert(whichCoordinate<nCoordinates(), AipsError);
-    return coordinates_p[whichCoordinate]->showType();
+    return peekCoordinate(whichCoordinate).showType();
 }
 
 const Coordinate& CoordinateSystem::coordinate(uInt which) const
 {
     AlwaysAssert(which < nCoordinates(), AipsError);
-    return *(coordinates_p[which]);
+    return privateCoordinate(which);
 }
 
 const LinearCoordinate& CoordinateSystem::linearCoordinate(uInt which) const
 {
     AlwaysAssert(which < nCoordinates() && 
-		 coordinates_p[which]->type() == Coordinate::LINEAR, AipsError);
-    return dynamic_cast<const LinearCoordinate &>(*(coordinates_p[which]));
+		 peekCoordinate(which).type() == Coordinate::LINEAR, AipsError);
+    return dynamic_cast<const LinearCoordinate &>(privateCoordinate(which));
 }
 
 const DirectionCoordinate& CoordinateSystem::directionCoordinate(uInt which) const
 {
     AlwaysAssert(which < nCoordinates() && 
-		 coordinates_p[which]->type() == Coordinate::DIRECTION, AipsError);
-    return dynamic_cast<const DirectionCoordinate &>(*(coordinates_p[which]));
+		 peekCoordinate(which).type() == Coordinate::DIRECTION, AipsError);
+    return dynamic_cast<const DirectionCoordinate &>(privateCoordinate(which));
 }
 
 const DirectionCoordinate& CoordinateSystem::directionCoordinate() const {
@@ -771,8 +834,8 @@ const DirectionCoordinate& CoordinateSystem::directionCoordinate() const {
 const SpectralCoordinate& CoordinateSystem::spectralCoordinate(uInt which) const
 {
     AlwaysAssert(which < nCoordinates() && 
-		 coordinates_p[which]->type() == Coordinate::SPECTRAL, AipsError);
-    return dynamic_cast<const SpectralCoordinate &>(*(coordinates_p[which]));
+		 peekCoordinate(which).type() == Coordinate::SPECTRAL, AipsError);
+    return dynamic_cast<const SpectralCoordinate &>(privateCoordinate(which));
 }
 
 const SpectralCoordinate& CoordinateSystem::spectralCoordinate() const {
@@ -787,8 +850,8 @@ const SpectralCoordinate& CoordinateSystem::spectralCoordinate() const {
 
 const StokesCoordinate& CoordinateSystem::stokesCoordinate(uInt which) const {
     AlwaysAssert(which < nCoordinates() && 
-		 coordinates_p[which]->type() == Coordinate::STOKES, AipsError);
-    return dynamic_cast<const StokesCoordinate &>(*(coordinates_p[which]));
+		 peekCoordinate(which).type() == Coordinate::STOKES, AipsError);
+    return dynamic_cast<const StokesCoordinate &>(privateCoordinate(which));
 }
 
 const StokesCoordinate& CoordinateSystem::stokesCoordinate() const {
@@ -804,37 +867,41 @@ const StokesCoordinate& CoordinateSystem::stokesCoordinate() const {
 
 const QualityCoordinate& CoordinateSystem::qualityCoordinate(uInt which) const {
     AlwaysAssert(which < nCoordinates() &&
-		 coordinates_p[which]->type() == Coordinate::QUALITY, AipsError);
-    return dynamic_cast<const QualityCoordinate &>(*(coordinates_p[which]));
+		 peekCoordinate(which).type() == Coordinate::QUALITY, AipsError);
+    return dynamic_cast<const QualityCoordinate &>(privateCoordinate(which));
 }
 
 const TabularCoordinate& CoordinateSystem::tabularCoordinate(uInt which) const
 {
     AlwaysAssert(which < nCoordinates() && 
-		 coordinates_p[which]->type() == Coordinate::TABULAR, 
+		 peekCoordinate(which).type() == Coordinate::TABULAR, 
 		 AipsError);
-    return dynamic_cast<const TabularCoordinate &>(*(coordinates_p[which]));
+    return dynamic_cast<const TabularCoordinate &>(privateCoordinate(which));
 }
 
 Bool CoordinateSystem::replaceCoordinate(const Coordinate &newCoordinate, uInt which)
 {
+    changed();
 
 // Basic checks.  The number of axes must be the same as this function does not
 // change any of the axis removal or mappings etc.
 
     AlwaysAssert(which < nCoordinates() &&
-		 newCoordinate.nPixelAxes() == coordinates_p[which]->nPixelAxes() &&
-		 newCoordinate.nWorldAxes() == coordinates_p[which]->nWorldAxes(),
+		 newCoordinate.nPixelAxes() == peekCoordinate(which).nPixelAxes() &&
+		 newCoordinate.nWorldAxes() == peekCoordinate(which).nWorldAxes(),
 		 AipsError);
-    Bool typesEqual = newCoordinate.type()==coordinates_p[which]->type();
-    const Vector<String>& oldUnits(coordinates_p[which]->worldAxisUnits());
+    Bool typesEqual = newCoordinate.type()==peekCoordinate(which).type();
+    const Vector<String> oldUnits(peekCoordinate(which).worldAxisUnits().copy());
     const Vector<String>& newUnits(newCoordinate.worldAxisUnits());
 
 // Replace coordinate
 
-    delete coordinates_p[which];
-    coordinates_p[which] = newCoordinate.clone();
-    AlwaysAssert(coordinates_p[which], AipsError);
+    {
+        std::lock_guard<std::mutex> lock(coordinates_mutex_p);
+        coordinates_p[which].reset (newCoordinate.clone());
+        shared_coordinates_p[which].reset();
+    }
+    AlwaysAssert(coordinates_p[which] != 0, AipsError);
 
 // Now, the world replacement values are a bother.  They may well have the wrong
 // units now.    So try to find scale factors if the Coordinates were of
@@ -884,7 +951,7 @@ Int CoordinateSystem::findCoordinate(Coordinate::Type type, Int afterCoord) cons
     Int n = nCoordinates();
     Bool found = False;
     while (++afterCoord < n) {
-	if (coordinates_p[afterCoord]->type() == type) {
+	if (peekCoordinate(afterCoord).type() == type) {
 	    found = True;
 	    break;
 	}
@@ -1065,7 +1132,7 @@ Bool CoordinateSystem::toWorld(Vector<Double> &world,
 
     if (world.nelements()!=nWorldAxes()) world.resize(nWorldAxes());
 
-    const uInt nc = coordinates_p.nelements();
+    const uInt nc = coordinates_p.size();
     Bool ok = True;
     for (uInt i=0; i<nc; i++) {
 
@@ -1089,7 +1156,7 @@ Bool CoordinateSystem::toWorld(Vector<Double> &world,
 	    }
 	}
 	Bool oldok = ok;
-	ok = coordinates_p[i]->toWorld(
+	ok = privateCoordinate(i).toWorld(
 		       *(world_tmps_p[i]), *(pixel_tmps_p[i]), useConversionFrame);
 
 	if (!ok) {
@@ -1098,7 +1165,7 @@ Bool CoordinateSystem::toWorld(Vector<Double> &world,
 // one error message this transfers the last one. I suppose this
 // is as good as any.
 
-	    set_error(coordinates_p[i]->errorMessage());
+	    set_error(peekCoordinate(i).errorMessage());
 	}
 	ok = (ok && oldok);
 	const uInt nwa = world_maps_p[i]->nelements();
@@ -1140,7 +1207,7 @@ Bool CoordinateSystem::toPixel(Vector<Double> &pixel,
     AlwaysAssert(world.nelements() == nWorldAxes(), AipsError);
     if (pixel.nelements()!=nPixelAxes()) pixel.resize(nPixelAxes());
 
-    const uInt nc = coordinates_p.nelements();
+    const uInt nc = coordinates_p.size();
     Bool ok = True;
     Int where;
     for (uInt i=0; i<nc; i++) {
@@ -1160,13 +1227,13 @@ Bool CoordinateSystem::toPixel(Vector<Double> &pixel,
 	    }
 	}
 	Bool oldok = ok;
-	ok = coordinates_p[i]->toPixel(
+	ok = privateCoordinate(i).toPixel(
 			    *(pixel_tmps_p[i]), *(world_tmps_p[i]));
 	if (!ok) {
 	    // Transfer the error message. Note that if there is more than
 	    // one error message this transfers the last one. I suppose this
 	    // is as good as any.
-	    set_error(coordinates_p[i]->errorMessage());
+	    set_error(peekCoordinate(i).errorMessage());
 	}
 	ok = (ok && oldok);
 	const uInt npxa = pixel_maps_p[i]->nelements();
@@ -1194,7 +1261,7 @@ Quantity CoordinateSystem::toWorldLength(
 	Int coord, coordAxis;
 	findWorldAxis(coord, coordAxis, pixelAxis);
 	return Quantity(
-		fabs(nPixels*coordinates_p[coord]->increment()[coordAxis]),
+		fabs(nPixels*peekCoordinate(coord).increment()[coordAxis]),
 		worldAxisUnits()[pixelAxisToWorldAxis(pixelAxis)]
 	);
 }
@@ -1219,7 +1286,7 @@ Bool CoordinateSystem::toWorldMany(Matrix<Double>& world,
     Int where;
     Bool ok = True;
 //
-    const uInt nCoords = coordinates_p.nelements();
+    const uInt nCoords = coordinates_p.size();
     for (k=0; k<nCoords; k++) {
 
 //     Put the appropriate pixel or replacement values in the pixel temporary, call the
@@ -1243,12 +1310,12 @@ Bool CoordinateSystem::toWorldMany(Matrix<Double>& world,
 	const uInt nWorldAxes = world_maps_p[k]->nelements();
         Matrix<Double> worldTmp(nWorldAxes,nTransforms);
         Vector<Bool> failuresTmp;
-	ok = coordinates_p[k]->toWorldMany(worldTmp, pixTmp, failuresTmp);
+	ok = privateCoordinate(k).toWorldMany(worldTmp, pixTmp, failuresTmp);
 
 // We get the last error message from whatever coordinate it is
 
         if (!ok) {
-	    set_error(coordinates_p[k]->errorMessage());
+	    set_error(peekCoordinate(k).errorMessage());
 	}
 
 // Now copy result from temporary into output world matrix
@@ -1293,7 +1360,7 @@ Bool CoordinateSystem::toPixelMany(Matrix<Double>& pixel,
     Int where;
     Bool ok = True;
 //
-    const uInt nCoords = coordinates_p.nelements();
+    const uInt nCoords = coordinates_p.size();
     for (k=0; k<nCoords; k++) {
 	const uInt nWorldAxes = world_maps_p[k]->nelements();
         Matrix<Double> worldTmp(nWorldAxes,nTransforms);
@@ -1312,12 +1379,12 @@ Bool CoordinateSystem::toPixelMany(Matrix<Double>& pixel,
 	const uInt nPixelAxes = pixel_maps_p[k]->nelements();
         Matrix<Double> pixTmp(nPixelAxes,nTransforms);
         Vector<Bool> failuresTmp;
-	ok = coordinates_p[k]->toPixelMany(pixTmp, worldTmp, failuresTmp);
+	ok = privateCoordinate(k).toPixelMany(pixTmp, worldTmp, failuresTmp);
 
 // We get the last error message from whatever coordinate it is
 
 	if (!ok) {
-	    set_error(coordinates_p[k]->errorMessage());
+	    set_error(peekCoordinate(k).errorMessage());
 	}
 
 // Now copy result from temporary into output pixel matrix
@@ -1359,7 +1426,7 @@ Bool CoordinateSystem::toMix(Vector<Double>& worldOut,
    AlwaysAssert(minWorld.nelements()==nWorld, AipsError);
    AlwaysAssert(maxWorld.nelements()==nWorld, AipsError);
 //
-   const uInt nCoord = coordinates_p.nelements();
+   const uInt nCoord = coordinates_p.size();
    if (worldOut.nelements()!=nWorldAxes()) worldOut.resize(nWorldAxes());
    if (pixelOut.nelements()!=nPixelAxes()) pixelOut.resize(nPixelAxes());
 
@@ -1399,12 +1466,12 @@ Bool CoordinateSystem::toMix(Vector<Double>& worldOut,
                Int where2;
                if (j==0) {      // 0 or 1
                   where2 = world_maps_p[i]->operator[](1);
-                  worldMin_tmps_p[i]->operator()(0) = coordinates_p[i]->worldMixMin()(0);
-                  worldMax_tmps_p[i]->operator()(0) = coordinates_p[i]->worldMixMax()(0);
+                  worldMin_tmps_p[i]->operator()(0) = peekCoordinate(i).worldMixMin()(0);
+                  worldMax_tmps_p[i]->operator()(0) = peekCoordinate(i).worldMixMax()(0);
                } else {
                   where2 = world_maps_p[i]->operator[](0);
-                  worldMin_tmps_p[i]->operator()(1) = coordinates_p[i]->worldMixMin()(1);
-                  worldMax_tmps_p[i]->operator()(1) = coordinates_p[i]->worldMixMax()(1);
+                  worldMin_tmps_p[i]->operator()(1) = peekCoordinate(i).worldMixMin()(1);
+                  worldMax_tmps_p[i]->operator()(1) = peekCoordinate(i).worldMixMax()(1);
                }
                if (where2 >= 0) {
                   worldAxes_tmps_p[i]->operator()(j) = worldAxes(where2);
@@ -1443,11 +1510,11 @@ Bool CoordinateSystem::toMix(Vector<Double>& worldOut,
          }
       }
 //
-      if (!coordinates_p[i]->toMix(*(worldOut_tmps_p[i]), *(pixelOut_tmps_p[i]),
+      if (!privateCoordinate(i).toMix(*(worldOut_tmps_p[i]), *(pixelOut_tmps_p[i]),
 		       *(world_tmps_p[i]), *(pixel_tmps_p[i]),
                        *(worldAxes_tmps_p[i]), *(pixelAxes_tmps_p[i]), 
                        *(worldMin_tmps_p[i]), *(worldMax_tmps_p[i]))) {
-         set_error(coordinates_p[i]->errorMessage());
+         set_error(peekCoordinate(i).errorMessage());
          return False;
       }
 //
@@ -1467,7 +1534,7 @@ void CoordinateSystem::makeWorldRelative (Vector<Double>& world) const
 {
     AlwaysAssert(world.nelements() == nWorldAxes(), AipsError);
 //
-    const uInt nc = coordinates_p.nelements();
+    const uInt nc = coordinates_p.size();
     Int where;
     for (uInt i=0; i<nc; i++) {
 	const uInt nwa = world_maps_p[i]->nelements();
@@ -1487,7 +1554,7 @@ void CoordinateSystem::makeWorldRelative (Vector<Double>& world) const
 
 // Convert for this coordinate.  
 
-        coordinates_p[i]->makeWorldRelative(*(world_tmps_p[i]));
+        privateCoordinate(i).makeWorldRelative(*(world_tmps_p[i]));
 
 // Copy to output
 
@@ -1506,7 +1573,7 @@ void CoordinateSystem::makeWorldAbsoluteRef (Vector<Double>& world,
     AlwaysAssert(world.nelements() == nWorldAxes(), AipsError);
     AlwaysAssert(refVal.nelements() == nWorldAxes(), AipsError);
 //
-    const uInt nc = coordinates_p.nelements();
+    const uInt nc = coordinates_p.size();
     Int where;
     for (uInt i=0; i<nc; i++) {
 	const uInt nwa = world_maps_p[i]->nelements();
@@ -1524,13 +1591,13 @@ void CoordinateSystem::makeWorldAbsoluteRef (Vector<Double>& world,
 		world_tmps_p[i]->operator()(j) = 
 		    world_replacement_values_p[i]->operator()(j);
 		worldOut_tmps_p[i]->operator()(j) = 
-		    coordinates_p[i]->referenceValue()(j);  // Use refval
+		    peekCoordinate(i).referenceValue()(j);  // Use refval
 	    }
 	}
 
 // Convert for this coordinate. 
 
-	coordinates_p[i]->makeWorldAbsoluteRef (*(world_tmps_p[i]),
+	privateCoordinate(i).makeWorldAbsoluteRef (*(world_tmps_p[i]),
                                                 *(worldOut_tmps_p[i]));
 
 // Copy to output
@@ -1547,7 +1614,7 @@ void CoordinateSystem::makeWorldAbsolute (Vector<Double>& world) const
 {
     AlwaysAssert(world.nelements() == nWorldAxes(), AipsError);
 //
-    const uInt nc = coordinates_p.nelements();
+    const uInt nc = coordinates_p.size();
     Int where;
     for (uInt i=0; i<nc; i++) {
 	const uInt nwa = world_maps_p[i]->nelements();
@@ -1567,7 +1634,7 @@ void CoordinateSystem::makeWorldAbsolute (Vector<Double>& world) const
 
 // Convert for this coordinate.  Make private temporary to optimize further
 
-	coordinates_p[i]->makeWorldAbsolute(*(world_tmps_p[i]));
+	privateCoordinate(i).makeWorldAbsolute(*(world_tmps_p[i]));
 
 // Copy to output
 
@@ -1583,7 +1650,7 @@ void CoordinateSystem::makePixelRelative (Vector<Double>& pixel) const
 {
     AlwaysAssert(pixel.nelements() == nPixelAxes(), AipsError);
 //
-    const uInt nc = coordinates_p.nelements();
+    const uInt nc = coordinates_p.size();
     Int where;
     for (uInt i=0; i<nc; i++) {
 	const uInt npa = pixel_maps_p[i]->nelements();
@@ -1603,7 +1670,7 @@ void CoordinateSystem::makePixelRelative (Vector<Double>& pixel) const
 
 // Convert for this coordinate.  
 
-        coordinates_p[i]->makePixelRelative(*(pixel_tmps_p[i]));
+        privateCoordinate(i).makePixelRelative(*(pixel_tmps_p[i]));
 
 // Copy to output
 
@@ -1620,7 +1687,7 @@ void CoordinateSystem::makePixelAbsolute (Vector<Double>& pixel) const
 {
     AlwaysAssert(pixel.nelements() == nPixelAxes(), AipsError);
 //
-    const uInt nc = coordinates_p.nelements();
+    const uInt nc = coordinates_p.size();
     Int where;
     for (uInt i=0; i<nc; i++) {
 	const uInt npa = pixel_maps_p[i]->nelements();
@@ -1640,7 +1707,7 @@ void CoordinateSystem::makePixelAbsolute (Vector<Double>& pixel) const
 
 // Convert for this coordinate.  Make private temporary to optimize further
 
-	coordinates_p[i]->makePixelAbsolute(*(pixel_tmps_p[i]));
+	privateCoordinate(i).makePixelAbsolute(*(pixel_tmps_p[i]));
 
 // Copy to output
 
@@ -2095,7 +2162,7 @@ Vector<String> CoordinateSystem::worldAxisNames() const
     for (uInt i=0; i<retval.nelements(); i++) {
 	Int coord, coordAxis;
 	findWorldAxis(coord, coordAxis, i);
-	Vector<String> tmp = coordinates_p[coord]->worldAxisNames();
+	Vector<String> tmp = peekCoordinate(coord).worldAxisNames();
 	retval(i) = tmp(coordAxis);
     }
     return retval;
@@ -2110,7 +2177,7 @@ Vector<String> CoordinateSystem::worldAxisUnits() const
     for (uInt i=0; i<retval.nelements(); i++) {
 	Int coord, coordAxis;
 	findWorldAxis(coord, coordAxis, i);
-	Vector<String> tmp = coordinates_p[coord]->worldAxisUnits();
+	Vector<String> tmp = peekCoordinate(coord).worldAxisUnits();
 	retval(i) = tmp(coordAxis);
     }
     return retval;
@@ -2122,7 +2189,7 @@ Vector<Double> CoordinateSystem::referencePixel() const
     for (uInt i=0; i<retval.nelements(); i++) {
 	Int coord, coordAxis;
 	findPixelAxis(coord, coordAxis, i);
-	Vector<Double> tmp = coordinates_p[coord]->referencePixel();
+	Vector<Double> tmp = peekCoordinate(coord).referencePixel();
 	retval(i) = tmp(coordAxis);
     }
     return retval;
@@ -2144,7 +2211,7 @@ Matrix<Double> CoordinateSystem::linearTransform() const
 	    // By definition, only axes in the same coordinate may be coupled
 	    if (worldCoord == pixelCoord &&
 		worldCoord >= 0 && worldAxis >= 0 && pixelAxis >= 0) {
-		Matrix<Double> tmp(coordinates_p[worldCoord]->linearTransform());
+		Matrix<Double> tmp(peekCoordinate(worldCoord).linearTransform());
 		retval(i,j) = tmp(worldAxis, pixelAxis);
 	    }
 	}
@@ -2158,7 +2225,7 @@ Vector<Double> CoordinateSystem::increment() const
     for (uInt i=0; i<retval.nelements(); i++) {
 	Int coord, coordAxis;
 	findWorldAxis(coord, coordAxis, i);
-	Vector<Double> tmp = coordinates_p[coord]->increment();
+	Vector<Double> tmp = peekCoordinate(coord).increment();
 	retval(i) = tmp(coordAxis);
     }
     return retval;
@@ -2170,7 +2237,7 @@ Vector<Double> CoordinateSystem::referenceValue() const
     for (uInt i=0; i<retval.nelements(); i++) {
 	Int coord, coordAxis;
 	findWorldAxis(coord, coordAxis, i);
-	Vector<Double> tmp = coordinates_p[coord]->referenceValue();
+	Vector<Double> tmp = peekCoordinate(coord).referenceValue();
 	retval(i) = tmp(coordAxis);
     }
     return retval;
@@ -2186,7 +2253,7 @@ Bool CoordinateSystem::setWorldAxisNames(const Vector<String> &names)
 //
     const uInt nc = nCoordinates();
     for (uInt i=0; i<nc; i++) {
-	Vector<String> tmp(coordinates_p[i]->worldAxisNames().copy());
+	Vector<String> tmp(peekCoordinate(i).worldAxisNames().copy());
 	const uInt na = tmp.nelements();
 	for (uInt j=0; j<na; j++) {
 	    Int which = world_maps_p[i]->operator[](j);
@@ -2194,8 +2261,8 @@ Bool CoordinateSystem::setWorldAxisNames(const Vector<String> &names)
 		tmp(j) = names(which);
 	    }
 	}
-	ok = (coordinates_p[i]->setWorldAxisNames(tmp) && ok);
-        if (!ok) set_error (coordinates_p[i]->errorMessage());
+	ok = (changeCoordinate(i).setWorldAxisNames(tmp) && ok);
+        if (!ok) set_error (peekCoordinate(i).errorMessage());
     }
 
     return ok;
@@ -2209,13 +2276,14 @@ Bool CoordinateSystem::setWorldAxisUnits(const Vector<String> &units)
 Bool CoordinateSystem::setWorldAxisUnits(const Vector<String> &units,
                                          Bool throwException)
 {
+    changed();
     String error;
     if (units.nelements() != nWorldAxes()) {
       error = "units vector must be of length nWorldAxes()";
     } else {
       const uInt nc = nCoordinates();
       for (uInt i=0; i<nc; i++) {
-        Vector<String> tmp(coordinates_p[i]->worldAxisUnits().copy());
+        Vector<String> tmp(peekCoordinate(i).worldAxisUnits().copy());
         uInt na = tmp.nelements(); 
         for (uInt j=0; j<na; j++) {
            Int which = world_maps_p[i]->operator[](j);
@@ -2223,8 +2291,8 @@ Bool CoordinateSystem::setWorldAxisUnits(const Vector<String> &units,
         }
 
         // Set new units
-        if  (! coordinates_p[i]->setWorldAxisUnits(tmp)) {
-          error = coordinates_p[i]->errorMessage();
+        if  (! changeCoordinate(i).setWorldAxisUnits(tmp)) {
+          error = peekCoordinate(i).errorMessage();
         }
       }
     }
@@ -2240,6 +2308,7 @@ Bool CoordinateSystem::setWorldAxisUnits(const Vector<String> &units,
 
 Bool CoordinateSystem::setReferencePixel(const Vector<Double> &refPix)
 {
+    changed();
     Bool ok = (refPix.nelements()==nPixelAxes());
     if (!ok) {
       set_error("ref. pix vector must be of length nPixelAxes()");
@@ -2248,7 +2317,7 @@ Bool CoordinateSystem::setReferencePixel(const Vector<Double> &refPix)
 //
     const uInt nc = nCoordinates();
     for (uInt i=0; i<nc; i++) {
-	Vector<Double> tmp(coordinates_p[i]->referencePixel().copy());
+	Vector<Double> tmp(peekCoordinate(i).referencePixel().copy());
 	uInt na = tmp.nelements();
 	for (uInt j=0; j<na; j++) {
 	    Int which = pixel_maps_p[i]->operator[](j);
@@ -2256,8 +2325,8 @@ Bool CoordinateSystem::setReferencePixel(const Vector<Double> &refPix)
 		tmp(j) = refPix(which);
 	    }
 	}
-	ok = (coordinates_p[i]->setReferencePixel(tmp) && ok);
-        if (!ok) set_error (coordinates_p[i]->errorMessage());
+	ok = (changeCoordinate(i).setReferencePixel(tmp) && ok);
+        if (!ok) set_error (peekCoordinate(i).errorMessage());
     }
 
     return ok;
@@ -2265,10 +2334,11 @@ Bool CoordinateSystem::setReferencePixel(const Vector<Double> &refPix)
 
 Bool CoordinateSystem::setLinearTransform(const Matrix<Double> &xform)
 {
+    changed();
     const uInt nc = nCoordinates();
     Bool ok = True;
     for (uInt i=0; i<nc; i++) {
-	Matrix<Double> tmp(coordinates_p[i]->linearTransform().copy());
+	Matrix<Double> tmp(peekCoordinate(i).linearTransform().copy());
 	uInt nrow = tmp.nrow();
 	uInt ncol = tmp.ncolumn();
 	for (uInt j=0; j<nrow; j++) {
@@ -2280,14 +2350,15 @@ Bool CoordinateSystem::setLinearTransform(const Matrix<Double> &xform)
 		}
 	    }
 	}
-	ok = (coordinates_p[i]->setLinearTransform(tmp) && ok);
-        if (!ok) set_error (coordinates_p[i]->errorMessage());
+	ok = (changeCoordinate(i).setLinearTransform(tmp) && ok);
+        if (!ok) set_error (peekCoordinate(i).errorMessage());
     }
     return ok;
 }
 
 Bool CoordinateSystem::setIncrement(const Vector<Double> &inc)
 {
+    changed();
     Bool ok = (inc.nelements()==nWorldAxes());
     if (!ok) {
       set_error("increment vector must be of length nWorldAxes()");
@@ -2296,7 +2367,7 @@ Bool CoordinateSystem::setIncrement(const Vector<Double> &inc)
 //
     const uInt nc = nCoordinates();
     for (uInt i=0; i<nc; i++) {
-	Vector<Double> tmp(coordinates_p[i]->increment().copy());
+	Vector<Double> tmp(peekCoordinate(i).increment().copy());
 	uInt na = tmp.nelements();
 	for (uInt j=0; j<na; j++) {
 	    Int which = world_maps_p[i]->operator[](j);
@@ -2304,14 +2375,15 @@ Bool CoordinateSystem::setIncrement(const Vector<Double> &inc)
 		tmp(j) = inc(which);
 	    }
 	}
-	ok = (coordinates_p[i]->setIncrement(tmp) && ok);
-        if (!ok) set_error (coordinates_p[i]->errorMessage());
+	ok = (changeCoordinate(i).setIncrement(tmp) && ok);
+        if (!ok) set_error (peekCoordinate(i).errorMessage());
     }
     return ok;
 }
 
 Bool CoordinateSystem::setReferenceValue(const Vector<Double> &refval)
 {
+    changed();
     Bool ok = (refval.nelements()==nWorldAxes());
     if (!ok) {
       set_error("ref. val vector must be of length nWorldAxes()");
@@ -2320,7 +2392,7 @@ Bool CoordinateSystem::setReferenceValue(const Vector<Double> &refval)
 //
     const uInt nc = nCoordinates();
     for (uInt i=0; i<nc; i++) {
-	Vector<Double> tmp(coordinates_p[i]->referenceValue().copy());
+	Vector<Double> tmp(peekCoordinate(i).referenceValue().copy());
 	uInt na = tmp.nelements();
 	for (uInt j=0; j<na; j++) {
 	    Int which = world_maps_p[i]->operator[](j);
@@ -2328,8 +2400,8 @@ Bool CoordinateSystem::setReferenceValue(const Vector<Double> &refval)
 		tmp(j) = refval(which);
 	    }
 	}
-	ok = (coordinates_p[i]->setReferenceValue(tmp) && ok);
-        if (!ok) set_error (coordinates_p[i]->errorMessage());
+	ok = (changeCoordinate(i).setReferenceValue(tmp) && ok);
+        if (!ok) set_error (peekCoordinate(i).errorMessage());
     }
 
     return ok;
@@ -2394,7 +2466,7 @@ Bool CoordinateSystem::near(const Coordinate& other,
 // the coordinate comparison routines, we can save ourselves
 // some time by checking here too
 
-      if (coordinate(i).type() != cSys.coordinate(i).type()) {
+      if (peekCoordinate(i).type() != cSys.peekCoordinate(i).type()) {
          oss << "The coordinate types differ for coordinate number " << i;
          set_error(String(oss));
          return False;
@@ -2446,7 +2518,7 @@ Bool CoordinateSystem::near(const Coordinate& other,
 
 // Continue if we have some unremoved world axes in this coordinate
 
-      Int excSize = coordinate(i).nPixelAxes();
+      Int excSize = peekCoordinate(i).nPixelAxes();
       Vector<Int> excludeAxes(excSize);
       if (!allGone) {
 
@@ -2515,8 +2587,8 @@ Bool CoordinateSystem::near(const Coordinate& other,
 // CoordinateSystems except on the specified axes. Leave it
 // this function to set the error message
 
-         if (!coordinate(i).near(cSys.coordinate(i),excludeAxes,tol)) {
-           set_error(coordinate(i).errorMessage());
+         if (!privateCoordinate(i).near(cSys.peekCoordinate(i),excludeAxes,tol)) {
+           set_error(peekCoordinate(i).errorMessage());
            return False;
          }
       }
@@ -2553,8 +2625,8 @@ Bool CoordinateSystem::nearPixel  (const CoordinateSystem& other,
       AlwaysAssert(coord1>=0, AipsError);
       AlwaysAssert(coord2>=0, AipsError);
 //      
-      const Coordinate& c1 = cSys1.coordinate(coord1);
-      const Coordinate& c2 = cSys2.coordinate(coord2);
+      const Coordinate& c1 = cSys1.privateCoordinate(coord1);
+      const Coordinate& c2 = cSys2.peekCoordinate(coord2);
       if (c1.type() != c2.type()) {
          ostringstream oss;
          oss << "The coordinate types differ for pixel axis number " << i;
@@ -2599,7 +2671,7 @@ String CoordinateSystem::format(
     Int coord, axis;
     findWorldAxis(coord, axis, worldAxis);
     AlwaysAssert(coord>=0 && axis >= 0, AipsError);
-    return coordinates_p[coord]->format(
+    return privateCoordinate(coord).format(
     	units, format, worldValue, axis,
     	isAbsolute, showAsAbsolute, precision, usePrecForMixed
     );
@@ -2612,6 +2684,7 @@ ObsInfo CoordinateSystem::obsInfo() const
 
 void CoordinateSystem::setObsInfo(const ObsInfo &obsinfo)
 {
+    changed();
     obsinfo_p = obsinfo;
 }
 
@@ -2620,7 +2693,7 @@ String CoordinateSystem::coordRecordName(uInt which) const
   // Write each string into a field it's type plus coordinate
   // number, e.g. direction0
   string basename = "unknown";
-  switch (coordinates_p[which]->type()) {
+  switch (peekCoordinate(which).type()) {
   case Coordinate::LINEAR:    basename = "linear"; break;
   case Coordinate::DIRECTION: basename = "direction"; break;
   case Coordinate::SPECTRAL:  basename = "spectral"; break;
@@ -2656,7 +2729,7 @@ Bool CoordinateSystem::save(RecordInterface &container,
 // If no coordinates, just run away with the ObsInfo
 // in place
 
-    uInt nc = coordinates_p.nelements();
+    uInt nc = coordinates_p.size();
     if (nc==0) {
        container.defineRecord(fieldName, subrec);
        return True;
@@ -2667,7 +2740,7 @@ Bool CoordinateSystem::save(RecordInterface &container,
 	// Write each string into a field it's type plus coordinate
 	// number, e.g. direction0
 	String basename = "unknown";
-	switch (coordinates_p[i]->type()) {
+	switch (peekCoordinate(i).type()) {
 	case Coordinate::LINEAR:    basename = "linear"; break;
 	case Coordinate::DIRECTION: basename = "direction"; break;
 	case Coordinate::SPECTRAL:  basename = "spectral"; break;
@@ -2680,7 +2753,7 @@ Bool CoordinateSystem::save(RecordInterface &container,
 	onum << i;
 	String num = onum;
 	String name = basename + num;
-	coordinates_p[i]->save(subrec, name);
+	peekCoordinate(i).save(subrec, name);
 	name = String("worldmap") + num;
 	subrec.define(name, Vector<Int>(world_maps_p[i]->begin(), world_maps_p[i]->end()));
 	name = String("worldreplace") + num;
@@ -2872,7 +2945,7 @@ void CoordinateSystem::makeWorldAbsRelMany (Matrix<Double>& world, Bool toAbs) c
     uInt i, k;
     Int where;
 //
-    const uInt nCoords = coordinates_p.nelements();
+    const uInt nCoords = coordinates_p.size();
     for (k=0; k<nCoords; k++) {
 
 // Load
@@ -2891,9 +2964,9 @@ void CoordinateSystem::makeWorldAbsRelMany (Matrix<Double>& world, Bool toAbs) c
 // Do conversion using Coordinate specific implementation
 
         if (toAbs) {
-  	   coordinates_p[k]->makeWorldAbsoluteMany(worldTmp);
+  	   privateCoordinate(k).makeWorldAbsoluteMany(worldTmp);
         } else {
-  	   coordinates_p[k]->makeWorldRelativeMany(worldTmp);
+  	   privateCoordinate(k).makeWorldRelativeMany(worldTmp);
         }
 
 // Unload
@@ -2917,7 +2990,7 @@ void CoordinateSystem::makePixelAbsRelMany (Matrix<Double>& pixel, Bool toAbs) c
     uInt i, k;
     Int where;
 //
-    const uInt nCoords = coordinates_p.nelements();
+    const uInt nCoords = coordinates_p.size();
     for (k=0; k<nCoords; k++) {
 
 // Load
@@ -2936,9 +3009,9 @@ void CoordinateSystem::makePixelAbsRelMany (Matrix<Double>& pixel, Bool toAbs) c
 // Do conversion using Coordinate specific implementation
 
         if (toAbs) {
-  	   coordinates_p[k]->makePixelAbsoluteMany(pixelTmp);
+  	   privateCoordinate(k).makePixelAbsoluteMany(pixelTmp);
         } else {
-  	   coordinates_p[k]->makePixelRelativeMany(pixelTmp);
+  	   privateCoordinate(k).makePixelRelativeMany(pixelTmp);
         }
 
 // Unload
@@ -3997,16 +4070,16 @@ void CoordinateSystem::listPointingCenter (LogIO& os) const
       if (!obsinfo_p.isPointingCenterInitial()) {
          Int prec;
          Coordinate::formatType form(Coordinate::DEFAULT);
-         coordinates_p[iC]->getPrecision(prec, form, True, 6, 6, 6);
+         privateCoordinate(iC).getPrecision(prec, form, True, 6, 6, 6);
 //
          MVDirection pc = obsinfo_p.pointingCenter();
          Quantum<Double> qLon = pc.getLong(Unit(String("deg")));
          Quantum<Double> qLat = pc.getLat(Unit(String("deg")));
 //
          String listUnits;
-         String lon = coordinates_p[iC]->formatQuantity(listUnits, form, qLon,
+         String lon = privateCoordinate(iC).formatQuantity(listUnits, form, qLon,
                                                         0, True, True, prec);
-         String lat  = coordinates_p[iC]->formatQuantity(listUnits, form, qLat,
+         String lat  = privateCoordinate(iC).formatQuantity(listUnits, form, qLat,
                                                         1, True, True, prec);
 //
          ostringstream oss;
@@ -4100,7 +4173,7 @@ Bool CoordinateSystem::setWorldMixRanges (const IPosition& shape)
    for (uInt i=0; i<nCoordinates(); i++) {
       Vector<Int> pA = pixelAxes(i);
       Vector<Int> wA = worldAxes(i);
-      IPosition shape2(coordinates_p[i]->nPixelAxes());
+      IPosition shape2(peekCoordinate(i).nPixelAxes());
       for (uInt j=0; j<shape2.nelements(); j++) {
          if (pA(j) != -1) {
             shape2(j) = shape(pA(j));
@@ -4112,8 +4185,8 @@ Bool CoordinateSystem::setWorldMixRanges (const IPosition& shape)
 // Set range for this coordinate. If both pixel and world
 // axis removed, use reference pixel for centre location
 
-      if (!coordinates_p[i]->setWorldMixRanges (shape2)) {
-         set_error(coordinates_p[i]->errorMessage());
+      if (!changeCoordinate(i).setWorldMixRanges (shape2)) {
+         set_error(peekCoordinate(i).errorMessage());
          return False;
       }
 
@@ -4122,8 +4195,8 @@ Bool CoordinateSystem::setWorldMixRanges (const IPosition& shape)
 // value as the centre value. The DC knows nothing about the removal,
 // its the CS that knows this.
 
-      if (coordinates_p[i]->type()==Coordinate::DIRECTION) {
-         DirectionCoordinate* dC = dynamic_cast<DirectionCoordinate*>(coordinates_p[i]);
+      if (peekCoordinate(i).type()==Coordinate::DIRECTION) {
+         DirectionCoordinate* dC = dynamic_cast<DirectionCoordinate*>(&changeCoordinate(i));
          Vector<Double> pixel(dC->referencePixel().copy());
          Vector<Bool> which(dC->nWorldAxes(), False);
          Bool doit = False;
@@ -4150,7 +4223,7 @@ Bool CoordinateSystem::setWorldMixRanges (const IPosition& shape)
 void CoordinateSystem::setDefaultWorldMixRanges ()
 {
    for (uInt i=0; i<nCoordinates(); i++) {
-      coordinates_p[i]->setDefaultWorldMixRanges ();
+      changeCoordinate(i).setDefaultWorldMixRanges ();
    }
 }
 
@@ -4163,7 +4236,7 @@ Vector<Double> CoordinateSystem::worldMixMin () const
    for (uInt i=0; i<nWorldAxes(); i++) {
       Int coord, coordAxis;
       findWorldAxis(coord, coordAxis, i);
-      Vector<Double> tmp = coordinates_p[coord]->worldMixMin();
+      Vector<Double> tmp = peekCoordinate(coord).worldMixMin();
       wm(i) = tmp(coordAxis);
    }
    return wm;
@@ -4178,7 +4251,7 @@ Vector<Double> CoordinateSystem::worldMixMax () const
    for (uInt i=0; i<nWorldAxes(); i++) {
       Int coord, coordAxis;
       findWorldAxis(coord, coordAxis, i);
-      Vector<Double> tmp = coordinates_p[coord]->worldMixMax();
+      Vector<Double> tmp = peekCoordinate(coord).worldMixMax();
       wm(i) = tmp(coordAxis);
    }
    return wm;
@@ -4745,6 +4818,7 @@ void CoordinateSystem::setSpectralConversion (
 Bool CoordinateSystem::setSpectralConversion (
 	String& errorMsg, const String frequencySystem
 ) {
+    changed();
 	if (! hasSpectralAxis()) {
 		return True;
 	}
@@ -4794,6 +4868,7 @@ Bool CoordinateSystem::setSpectralConversion (
 Bool CoordinateSystem::setRestFrequency (
 	String& errorMsg, const Quantity& freq
 ) {
+    changed();
 	Double value = freq.getValue();
 	if (value < 0.0) {
 		errorMsg = "The rest frequency/wavelength is below zero!";
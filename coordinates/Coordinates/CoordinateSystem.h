@@ -36,6 +36,9 @@
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/measures/Measures/MDoppler.h>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -183,6 +186,19 @@ class LogIO;
 // but for the DirectionCoordinate  you might request a mixed
 // pixel/world conversion. In this case, the extra conversion layer
 // is ill-defined and not active (for the DirectionCoordinate part of it).
+//
+// <p>
+// CoordinateSystem objects are copied a lot (e.g. by SubImage, ImageExpr
+// and the LEL coordinate checks), while making a copy of a Coordinate
+// can be expensive (e.g. the wcslib struct of a DirectionCoordinate).
+// Therefore a copy shares the Coordinates with the original as immutable
+// objects. A CoordinateSystem only makes its private copy of a Coordinate
+// when it is changed, when it is used for a conversion (because that
+// changes the internal state of a Coordinate), or when it is accessed
+// using a function like <src>coordinate</src> or
+// <src>directionCoordinate</src>. The semantics are still copy semantics;
+// a reference returned by these functions stays valid until a non-const
+// function is called on the CoordinateSystem.
 // </synopsis>
 
 // <note role=caution>
@@ -205,7 +221,6 @@ class LogIO;
 // <todo asof="1997/01/13">
 //   <li> Undelete individual removed axes.
 //   <li> Non-integral pixel shifts/decimations in subimage operations?
-//   <li> Copy-on-write for efficiency?
 //   <li> Check if the classes are thread safe in general
 // </todo>
 //
@@ -217,10 +232,12 @@ public:
     // Default constructor.  This is an empty CoordinateSystem.
     CoordinateSystem();
 
-    // Copying constructor (copy semantics)
+    // Copying constructor (copy semantics).
+    // The Coordinates are shared until used or changed (see the synopsis).
     CoordinateSystem(const CoordinateSystem &other);
 
     // Assignment (copy semantics).
+    // The Coordinates are shared until used or changed (see the synopsis).
     CoordinateSystem &operator=(const CoordinateSystem &other);
 
     // Destructor
@@ -868,9 +885,28 @@ public:
     // Returns False if invalid inputs (and CS not changed) and an error message.
     Bool setRestFrequency (String& errorMsg, const Quantity& freq);
 
+    // Get the generation number of this CoordinateSystem. It gets a new,
+    // unique value each time the CoordinateSystem is changed by one of the
+    // set, add, remove, replace or transpose functions. A copy has the same
+    // generation number as the original, so a cached result derived from a
+    // CoordinateSystem is still valid as long as its generation is the same
+    // (see <linkto class=CoordinateGrid>CoordinateGrid</linkto>).
+    uInt64 generation() const
+      { return generation_p; }
+
 private:
     // Where we store copies of the coordinates we are created with.
-    PtrBlock<Coordinate *> coordinates_p;
+    // coordinates_p[i] is the private copy of a coordinate (null if not
+    // made yet); shared_coordinates_p[i] is the immutable copy shared with
+    // copies of this CoordinateSystem (null if not made yet or if the
+    // coordinate was changed). At least one of them is not null.
+    // They are guarded by the mutex, because a const function can make
+    // the private or shared copy.
+    // <group>
+    mutable std::vector<std::unique_ptr<Coordinate>> coordinates_p;
+    mutable std::vector<std::shared_ptr<const Coordinate>> shared_coordinates_p;
+    mutable std::mutex coordinates_mutex_p;
+    // </group>
     
     // For coordinate[i] axis[j], 
     //    world_maps_p[i][j], if >=0 gives the location in the
@@ -899,6 +935,9 @@ private:
     // Coordinate System.
     ObsInfo obsinfo_p;
 
+    // The generation number (see function generation).
+    uInt64 generation_p;
+
     const static String _class;
     static std::mutex _mapInitMutex;
     static std::map<String, String> _friendlyAxisMap;
@@ -915,6 +954,26 @@ private:
 
     void copy(const CoordinateSystem &other);
     void clear();
+
+    // Give the CoordinateSystem a new generation number after a change.
+    void changed();
+
+    // Get the private copy of a coordinate, which is made from the shared
+    // copy if needed. It has to be used for conversions, because they can
+    // change the internal state of a coordinate.
+    Coordinate& privateCoordinate(uInt which) const;
+
+    // Get the private copy of a coordinate in order to change it.
+    // The shared copy is not valid anymore.
+    Coordinate& changeCoordinate(uInt which);
+
+    // Get a coordinate for inspection only, thus not for conversions.
+    // It is the private copy if made, otherwise the shared copy.
+    const Coordinate& peekCoordinate(uInt which) const;
+
+    // Get the copy of a coordinate to be shared by a copy of this object.
+    std::shared_ptr<const Coordinate> sharedCoordinate(uInt which) const;
+    static uInt64 newGeneration();
     Bool checkAxesInThisCoordinate(const Vector<Bool>& axes, uInt which) const;
 
    // Delete some pointer blocks
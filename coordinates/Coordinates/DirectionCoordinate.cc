@@ -53,6 +53,7 @@
 
 #include <casacore/casa/iomanip.h>  
 #include <casacore/casa/sstream.h>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -452,7 +453,9 @@ Bool DirectionCoordinate::toWorldMany (Matrix<Double>& world,
 
 // Convert to specified conversion reference type
 
-       if (pConversionMachineTo_p) convertToMany(world);  
+       if (pConversionMachineTo_p) {
+          convertManyDirections (world, *pConversionMachineTo_p);
+       }
     } else {
        return False;
     }
@@ -473,7 +476,9 @@ Bool DirectionCoordinate::toPixelMany (Matrix<Double>& pixel,
 
 // Convert from specified conversion reference type
 
-    if (pConversionMachineTo_p) convertFromMany (world2);
+    if (pConversionMachineFrom_p) {
+       convertManyDirections (world2, *pConversionMachineFrom_p);
+    }
 
 // Convert from current units  to wcs units (degrees)
 
@@ -2050,6 +2055,39 @@ void DirectionCoordinate::convertFrom (Vector<Double>& world) const
 
 
 
+void DirectionCoordinate::convertManyDirections (Matrix<Double>& world,
+                                                 MDirection::Convert& machine) const
+{
+   AlwaysAssert(world.nrow()==2, AipsError);
+   const size_t n = world.ncolumn();
+   if (n == 0) return;
+   Bool deleteWorld;
+   Double* pWorld = world.getStorage(deleteWorld);
+
+// Convert all directions as direction cosines
+
+   std::vector<Double> xyz(3*n);
+   const Double toLong = to_radians_p[0];
+   const Double toLat = to_radians_p[1];
+   for (size_t i=0; i<n; i++) {
+      const Double lon = pWorld[2*i] * toLong;
+      const Double lat = pWorld[2*i+1] * toLat;
+      const Double cosLat = cos(lat);
+      xyz[3*i]   = cos(lon) * cosLat;
+      xyz[3*i+1] = sin(lon) * cosLat;
+      xyz[3*i+2] = sin(lat);
+   }
+   machine.convert (xyz.data(), xyz.data(), n);
+   for (size_t i=0; i<n; i++) {
+      const Double* v = &xyz[3*i];
+      pWorld[2*i] = (v[0] != 0 || v[1] != 0 ? atan2(v[1], v[0]) : 0.0) / toLong;
+      pWorld[2*i+1] = asin(v[2]) / toLat;
+   }
+   world.putStorage(pWorld, deleteWorld);
+}
+
+
+
 Double DirectionCoordinate::putLongInPiRange (Double lon, const String& unit) const
 {  
    Unit u(unit);
@@ -711,6 +711,11 @@ private:
     virtual void convertFrom (Vector<Double>& world) const;
     // </group>
 
+    // Convert many directions (in current units) in one go with the given
+    // conversion machine, which is used on their direction cosines.
+    void convertManyDirections (Matrix<Double>& world,
+                                MDirection::Convert& machine) const;
+
     // Copy private data
     void copy (const DirectionCoordinate& other);
     
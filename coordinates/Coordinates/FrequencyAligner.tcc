@@ -29,6 +29,7 @@
 #include <casacore/coordinates/Coordinates/FrequencyAligner.h>
 
 #include <casacore/casa/Arrays/ArrayAccessor.h>
+#include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/VectorIter.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Quanta/Unit.h>
@@ -334,19 +335,26 @@ template<class T>
 Double FrequencyAligner<T>::makeAbcissa (Vector<Double>& freq, Bool doDiff)
 {
    const uInt n = freq.nelements();
-   Double world;
    Double maxDiff = -1;
+
+// Convert all channels in one go; for a tabular axis this walks the
+// channel table once instead of searching it per channel.
+
+   Matrix<Double> pixel(1, n), world;
+   Vector<Bool> failures;
+   for (uInt i=0; i<n; i++) {
+      pixel(0,i) = i;
+   }
+   itsSpecCoord.toWorldMany(world, pixel, failures);
    if (doDiff) {
       for (uInt i=0; i<n; i++) {
-         itsSpecCoord.toWorld(world,i); 
-         freq[i] = itsMachine(world).getValue().getValue();
+         freq[i] = itsMachine(world(0,i)).getValue().getValue();
 //
          maxDiff = casacore::max(casacore::abs(freq[i]-itsRefFreqX[i]),maxDiff);
       }
    } else {
       for (uInt i=0; i<n; i++) {
-         itsSpecCoord.toWorld(world,i); 
-         freq[i] = itsMachine(world).getValue().getValue();
+         freq[i] = itsMachine(world(0,i)).getValue().getValue();
       }
    }
    return maxDiff;
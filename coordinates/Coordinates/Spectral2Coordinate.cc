@@ -419,5 +419,25 @@ void SpectralCoordinate::convertFrom (Vector<Double>& world) const
   }
 }
 
+void SpectralCoordinate::convertManyFrequencies (Matrix<Double>& world,
+                                                 MFrequency::Convert& machine) const
+{
+// The machine works on the internal values (Hz), so the conversion
+// is done without units.
+
+  const size_t n = world.nelements();
+  if (n == 0) return;
+  Bool deleteWorld;
+  Double* pWorld = world.getStorage(deleteWorld);
+  for (size_t i=0; i<n; i++) {
+    pWorld[i] *= to_hz_p;
+  }
+  machine.convert (pWorld, pWorld, n);
+  for (size_t i=0; i<n; i++) {
+    pWorld[i] /= to_hz_p;
+  }
+  world.putStorage(pWorld, deleteWorld);
+}
+
 } //# NAMESPACE CASACORE - END
 
@@ -544,7 +544,9 @@ Bool SpectralCoordinate::toWorldMany (Matrix<Double>& world,
 
 // Convert to specified conversion reference type
 
-   if (pConversionMachineTo_p) convertToMany(world);
+   if (pConversionMachineTo_p) {
+      convertManyFrequencies (world, *pConversionMachineTo_p);
+   }
 //
    return True;
 }
@@ -563,7 +565,9 @@ Bool SpectralCoordinate::toPixelMany (Matrix<Double>& pixel,
   
 // Convert from specified conversion reference type
 
-    if (pConversionMachineTo_p) convertFromMany (world2);
+    if (pConversionMachineFrom_p) {
+       convertManyFrequencies (world2, *pConversionMachineFrom_p);
+    }
     
 // Convert from current units to wcs units (Hz)
 
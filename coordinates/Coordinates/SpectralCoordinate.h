@@ -629,6 +629,11 @@ private:
     virtual void convertTo (Vector<Double>& world) const;
     virtual void convertFrom (Vector<Double>& world) const;
 
+// Convert many frequencies (in current units) in one go with the given
+// conversion machine
+    void convertManyFrequencies (Matrix<Double>& world,
+                                 MFrequency::Convert& machine) const;
+
 // Deletes and sets pointer to 0
     void deleteVelocityMachine ();
 
@@ -42,9 +42,72 @@
 #include <casacore/casa/Quanta/Quantum.h>
 
 #include <casacore/casa/sstream.h>
+#include <algorithm>
+#include <functional>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// Apply the channel correction given by the monotonic table x -> y
+// in place to the values. The result for each value is the same as
+// Interpolate1D gives (linear, or the single value for a table of length 1).
+// The bracketing table index of a value is found by walking on from the
+// index of the previous value, so values sorted along the table cost a
+// single table pass. When the values go backwards or jump far, a binary
+// search is done instead. The interpolation itself is done in a separate
+// loop without branches, so the compiler can vectorize it.
+static void correctChannels (Double* values, uInt nValues,
+                             const std::vector<Double>& x,
+                             const std::vector<Double>& y)
+{
+    const uInt n = x.size();
+    if (n == 1) {
+	std::fill (values, values+nValues, y[0]);
+	return;
+    }
+    const Bool ascending = !(x[n-1] < x[0]);
+    const Double* xs = x.data();
+    const Double* ys = y.data();
+    // Index of the first table value not before the given value
+    // (same as binarySearchBrackets).
+    auto lowerBound = [&] (uInt st, uInt end, Double val) -> uInt {
+	const Double* p = ascending
+	    ? std::lower_bound (xs+st, xs+end, val)
+	    : std::lower_bound (xs+st, xs+end, val, std::greater<Double>());
+	return p - xs;
+    };
+    const uInt chunkSize = 1024;
+    uInt seg[chunkSize];
+    uInt where = 0;
+    for (uInt start=0; start<nValues; start+=chunkSize) {
+	const uInt nv = std::min (chunkSize, nValues-start);
+	Double* v = values + start;
+	for (uInt j=0; j<nv; j++) {
+	    const Double val = v[j];
+	    if (where > 0  &&  !(ascending ? xs[where-1] < val
+				           : xs[where-1] > val)) {
+		where = lowerBound (0, where, val);
+	    } else {
+		uInt nstep = 0;
+		while (where < n  &&  (ascending ? xs[where] < val
+					          : xs[where] > val)) {
+		    if (++nstep > 8) {
+			where = lowerBound (where, n, val);
+			break;
+		    }
+		    where++;
+		}
+	    }
+	    seg[j] = (where == 0 ? 1 : (where == n ? n-1 : where));
+	}
+	for (uInt j=0; j<nv; j++) {
+	    const uInt k = seg[j];
+	    const Double x1 = xs[k-1];
+	    const Double y1 = ys[k-1];
+	    v[j] = y1 + ((v[j]-x1)/(xs[k]-x1)) * (ys[k]-y1);
+	}
+    }
+}
+
 
 TabularCoordinate::TabularCoordinate()
 : Coordinate(),
@@ -148,6 +211,29 @@ void TabularCoordinate::clear_self()
 	delete channel_corrector_rev_p;
     }
     channel_corrector_p = channel_corrector_rev_p = 0;
+    table_pixel_p.clear();
+    table_average_p.clear();
+}
+
+void TabularCoordinate::makeBatchTables()
+{
+    table_pixel_p.clear();
+    table_average_p.clear();
+    if (channel_corrector_p == 0) {
+	return;
+    }
+    Vector<Double> pixels (channel_corrector_p->getX());
+    Vector<Double> average (channel_corrector_p->getY());
+    const uInt n = pixels.nelements();
+// Interpolate1D throws for repeated values; leave that to it.
+    for (uInt i=1; i<n; i++) {
+	if (nearAbs(pixels(i-1), pixels(i)) ||
+	    nearAbs(average(i-1), average(i))) {
+	    return;
+	}
+    }
+    table_pixel_p.assign (pixels.begin(), pixels.end());
+    table_average_p.assign (average.begin(), average.end());
 }
 
 
@@ -191,6 +277,7 @@ void TabularCoordinate::copy(const TabularCoordinate &other)
 	AlwaysAssert(channel_corrector_p != 0 &&
 		     channel_corrector_rev_p != 0, AipsError);
     }
+    makeBatchTables();
 }
 
 
@@ -273,7 +360,16 @@ Bool TabularCoordinate::toWorldMany(Matrix<Double>& world,
     Vector<Double> worlds(world.row(0));     // Only 1 axis in TC
     Vector<Double> pixels(pixel.row(0));
 //
-    if (channel_corrector_p) {
+    if (!table_pixel_p.empty()) {
+       Double* w = world.data();
+       for (uInt j=0; j<nTransforms; j++) { 
+          w[j] = pixels[j];
+       }
+       correctChannels (w, nTransforms, table_pixel_p, table_average_p);
+       for (uInt j=0; j<nTransforms; j++) { 
+          w[j] = beta + alpha*w[j];
+       }
+    } else if (channel_corrector_p) {
        for (uInt j=0; j<nTransforms; j++) { 
           worlds[j] = beta + alpha*((*channel_corrector_p)(pixels[j]));
        }
@@ -301,7 +397,13 @@ Bool TabularCoordinate::toPixelMany (Matrix<Double>& pixel,
     Vector<Double> worlds(world.row(0));      // Only 1 axis in TC
     Vector<Double> pixels(pixel.row(0));
 //
-    if (channel_corrector_rev_p) {
+    if (!table_average_p.empty()) {
+       Double* p = pixel.data();
+       for (uInt j=0; j<nTransforms; j++) { 
+          p[j] = worlds[j]/alpha + beta;
+       }
+       correctChannels (p, nTransforms, table_average_p, table_pixel_p);
+    } else if (channel_corrector_rev_p) {
        for (uInt j=0; j<nTransforms; j++) { 
           pixels[j] = worlds[j]/alpha + beta;
           pixels[j] = (*channel_corrector_rev_p)(pixels[j]);
@@ -820,6 +922,7 @@ void TabularCoordinate::makeNonLinearTabularCoordinate(const Vector<Double> &pix
       channel_corrector_rev_p->setMethod(Interpolate1D<Double,Double>::linear);
     } // endif
 
+    makeBatchTables();
 }
 
 
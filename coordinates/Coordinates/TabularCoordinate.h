@@ -31,6 +31,7 @@
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/coordinates/Coordinates/Coordinate.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -192,6 +193,10 @@ public:
     // The <src>failures</src> array (True for fail, False for success)
     // is the length of the number of conversions and
     // holds an error status for each conversion.  
+    // <br>For a non-linear table the channel corrections are done in one
+    // pass over the values: consecutive values that increase along the
+    // table walk it instead of searching it, so sorted (e.g. channel
+    // ordered) input costs one table pass in total.
     // <group>
     virtual Bool toWorldMany(Matrix<Double> &world,
                              const Matrix<Double> &pixel,
@@ -298,6 +303,18 @@ private:
     Interpolate1D<Double,Double> *channel_corrector_rev_p;
     // </group>
 
+    // Copies of the abscissa (pixel) and ordinate (average pixel) of
+    // <src>channel_corrector_p</src> used by the batch conversions.
+    // They are empty if the table cannot be used that way (repeated values),
+    // in which case the Interpolate1D objects are used per value.
+    // <group>
+    std::vector<Double> table_pixel_p;
+    std::vector<Double> table_average_p;
+    // </group>
+
+    // Fill the batch tables from the channel correctors.
+    void makeBatchTables();
+
     // Common for assignment operator and destructor.
     void clear_self();
 
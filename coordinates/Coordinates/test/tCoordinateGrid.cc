@@ -0,0 +1,160 @@
+//# tCoordinateGrid.cc: Test program for class CoordinateGrid
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/coordinates/Coordinates/CoordinateGrid.h>
+#include <casacore/coordinates/Coordinates/CoordinateSystem.h>
+#include <casacore/coordinates/Coordinates/DirectionCoordinate.h>
+#include <casacore/coordinates/Coordinates/SpectralCoordinate.h>
+#include <casacore/coordinates/Coordinates/Projection.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/BasicSL/Constants.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <cmath>
+
+#include <casacore/casa/namespace.h>
+
+// Make a wide field image coordinate system around RA 0 (to test wrapping)
+// with a spectral axis.
+CoordinateSystem makeCoords()
+{
+  Matrix<Double> xform(2,2);
+  xform = 0.;
+  xform.diagonal() = 1.;
+  DirectionCoordinate dc(MDirection::J2000, Projection(Projection::SIN),
+                         0., 0.5, -0.2*C::degree, 0.2*C::degree,
+                         xform, 100., 100.);
+  SpectralCoordinate sc(MFrequency::TOPO, 1.4e9, 1e6, 0., 1.42040575e9);
+  CoordinateSystem cSys;
+  cSys.addCoordinate (dc);
+  cSys.addCoordinate (sc);
+  return cSys;
+}
+
+// Get the exact pixel position of a world coordinate.
+void exactPixel (Double& x, Double& y, const CoordinateSystem& cSys,
+                 const Vector<Double>& world)
+{
+  Vector<Double> pixel;
+  AlwaysAssertExit (cSys.toPixel (pixel, world));
+  x = pixel[0];
+  y = pixel[1];
+}
+
+void checkConversions (CoordinateGrid& grid, const CoordinateSystem& cSys)
+{
+  // Check a set of positions in the image against the exact conversions.
+  Matrix<Double> pixel(2, 400);
+  for (uInt i=0; i<400; ++i) {
+    pixel(0,i) = (i%20) * 10.3;
+    pixel(1,i) = (i/20) * 10.1;
+  }
+  Matrix<Double> world;
+  Vector<Bool> failures;
+  AlwaysAssertExit (grid.toWorldMany (world, pixel, failures));
+  for (uInt i=0; i<400; ++i) {
+    AlwaysAssertExit (! failures[i]);
+    Double x, y;
+    exactPixel (x, y, cSys, world.column(i));
+    AlwaysAssertExit (std::hypot (x - pixel(0,i), y - pixel(1,i)) <=
+                      grid.tolerance());
+    // The single conversion has to give the same result.
+    Vector<Double> w;
+    AlwaysAssertExit (grid.toWorld (w, pixel.column(i)));
+    AlwaysAssertExit (allNearAbs (w, world.column(i), 1e-12));
+  }
+  // Convert the exact world coordinates back.
+  Matrix<Double> exactWorld(cSys.nWorldAxes(), 400);
+  for (uInt i=0; i<400; ++i) {
+    Vector<Double> pix(cSys.referencePixel());
+    pix[0] = pixel(0,i);
+    pix[1] = pixel(1,i);
+    Vector<Double> w;
+    AlwaysAssertExit (cSys.toWorld (w, pix));
+    exactWorld.column(i) = w;
+  }
+  Matrix<Double> pixOut;
+  AlwaysAssertExit (grid.toPixelMany (pixOut, exactWorld, failures));
+  for (uInt i=0; i<400; ++i) {
+    AlwaysAssertExit (! failures[i]);
+    AlwaysAssertExit (std::hypot (pixOut(0,i) - pixel(0,i),
+                                  pixOut(1,i) - pixel(1,i)) <=
+                      2*grid.tolerance());
+    Vector<Double> p;
+    AlwaysAssertExit (grid.toPixel (p, exactWorld.column(i)));
+    AlwaysAssertExit (allNearAbs (p, pixOut.column(i), 1e-5));
+  }
+}
+
+void testGrid()
+{
+  CoordinateSystem cSys = makeCoords();
+  CoordinateGrid grid(cSys, 0, 1, IPosition(2, 201, 201), 0.01);
+  AlwaysAssertExit (grid.isValid());
+  AlwaysAssertExit (grid.maxError() <= 0.01);
+  AlwaysAssertExit (grid.step() >= 1);
+  checkConversions (grid, cSys);
+  // A copy of the CoordinateSystem has the same generation.
+  CoordinateSystem cSys2(cSys);
+  AlwaysAssertExit (cSys2.generation() == cSys.generation());
+  // Changing the CoordinateSystem invalidates the grid.
+  Vector<Double> refVal = cSys.referenceValue();
+  refVal[1] += 0.4;
+  cSys.setReferenceValue (refVal);
+  AlwaysAssertExit (cSys2.generation() != cSys.generation());
+  AlwaysAssertExit (! grid.isValid());
+  checkConversions (grid, cSys);
+  AlwaysAssertExit (grid.isValid());
+  Vector<Double> inc = cSys.increment();
+  inc *= 0.5;
+  cSys.setIncrement (inc);
+  AlwaysAssertExit (! grid.isValid());
+  checkConversions (grid, cSys);
+  // Positions outside the grid are converted exactly.
+  Vector<Double> pixel(2, -10.);
+  Vector<Double> world;
+  AlwaysAssertExit (grid.toWorld (world, pixel));
+  Vector<Double> pix(cSys.referencePixel());
+  pix[0] = pix[1] = -10.;
+  Vector<Double> exactWorld;
+  AlwaysAssertExit (cSys.toWorld (exactWorld, pix));
+  AlwaysAssertExit (allNearAbs (world, exactWorld, 1e-12));
+}
+
+int main()
+{
+  try {
+    testGrid();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
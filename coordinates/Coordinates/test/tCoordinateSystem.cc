@@ -97,6 +97,7 @@ void doit5 ();
 void doit6 ();
 void doit7 ();
 void verifyCAS3264 ();
+void testCopyOnWrite();
 void spectralAxisNumber();
 void polarizationAxisNumber();
 
@@ -304,6 +305,9 @@ int main()
       {
     	  verifyCAS3264();
       }
+      {
+         testCopyOnWrite();
+      }
       {
     	  cout << "*** Test getWorldAxisOrder" << endl;
     	  CoordinateSystem csys = CoordinateUtil::defaultCoords(4);
@@ -2615,3 +2619,46 @@ void doit6 ()
 
      }
 
+void testCopyOnWrite()
+{
+   cout << "*** Test copy-on-write of coordinates" << endl;
+   CoordinateSystem cSys = CoordinateUtil::defaultCoords(4);
+   Vector<Double> pixel(4, 10.0);
+   Vector<Double> world, world2;
+   AlwaysAssert(cSys.toWorld(world, pixel), AipsError);
+   const DirectionCoordinate& dC = cSys.directionCoordinate(0);
+   Vector<Double> refPix = dC.referencePixel().copy();
+// A copy gives the same results.
+   CoordinateSystem cSys2(cSys);
+   AlwaysAssert(cSys2.near(cSys), AipsError);
+   AlwaysAssert(cSys2.toWorld(world2, pixel), AipsError);
+   AlwaysAssert(allNear(world2, world, 1e-13), AipsError);
+// Changing the copy does not change the original and vice versa.
+   Vector<Double> newRefPix = cSys2.referencePixel() + 5.0;
+   AlwaysAssert(cSys2.setReferencePixel(newRefPix), AipsError);
+   AlwaysAssert(allNear(cSys2.referencePixel(), newRefPix, 1e-13), AipsError);
+   AlwaysAssert(allNear(dC.referencePixel(), refPix, 1e-13), AipsError);
+   AlwaysAssert(cSys.toWorld(world2, pixel), AipsError);
+   AlwaysAssert(allNear(world2, world, 1e-13), AipsError);
+   AlwaysAssert(cSys2.toWorld(world2, pixel), AipsError);
+   AlwaysAssert(!allNear(world2, world, 1e-13), AipsError);
+   {
+      CoordinateSystem cSys3;
+      cSys3 = cSys;
+      CoordinateSystem cSys4(cSys3);
+      cSys.setReferencePixel(newRefPix);
+      AlwaysAssert(allNear(dC.referencePixel(), refPix+5.0, 1e-13), AipsError);
+      AlwaysAssert(allNear(cSys3.directionCoordinate(0).referencePixel(),
+                           refPix, 1e-13), AipsError);
+      AlwaysAssert(cSys4.toWorld(world2, pixel), AipsError);
+      AlwaysAssert(allNear(world2, world, 1e-13), AipsError);
+      AlwaysAssert(cSys4.replaceCoordinate(cSys2.spectralCoordinate(1), 1),
+                   AipsError);
+      AlwaysAssert(cSys4.directionCoordinate(0).near
+                   (cSys3.directionCoordinate(0)), AipsError);
+   }
+// The reference obtained before is still valid.
+   AlwaysAssert(allNear(dC.referencePixel(), refPix+5.0, 1e-13), AipsError);
+   AlwaysAssert(cSys.near(cSys2), AipsError);
+}
+
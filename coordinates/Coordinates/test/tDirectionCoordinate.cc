@@ -1444,9 +1444,11 @@ void doit8 ()
                                            proj, crval, crpix,
                                            cdelt, xform);
       lc.setReferenceConversion (MDirection::GALACTIC);
+//
+// Use sufficient coordinates to do the wcs transformations in parallel
 //
       Vector<Bool> failures, failures2;
-      const Int nCoord = 1000;
+      const Int nCoord = 10000;
       Matrix<Double> pixel(2, nCoord), pixel2;
       Matrix<Double> world(2, nCoord);
 //
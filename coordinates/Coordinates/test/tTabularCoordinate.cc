@@ -64,6 +64,8 @@ void doitNonLinear (const Vector<Double>& pixelValues,
                     const Vector<Double>& worldValues,
                     TabularCoordinate& lc);
 
+void doitMany (const TabularCoordinate& lc);
+
 
 int main()
 {
@@ -160,6 +162,20 @@ int main()
          TabularCoordinate lc = makeNonLinearCoordinate(axisName, axisUnit, pixelValues, worldValues);
          doitNonLinear(pixelValues, worldValues, lc);
       }
+      {
+         TabularCoordinate lc = makeNonLinearCoordinate(axisName, axisUnit, pixelValues, worldValues);
+         doitMany(lc);
+         const uInt nv = pixelValues.nelements();
+         Vector<Double> revPixels(nv), revWorlds(nv);
+         for (uInt i=0; i<nv; i++) {
+            revPixels(i) = pixelValues(nv-1-i);
+            revWorlds(i) = worldValues(nv-1-i);
+         }
+         TabularCoordinate lc2(revPixels, worldValues, axisUnit, axisName);
+         doitMany(lc2);
+         TabularCoordinate lc3(pixelValues, revWorlds, axisUnit, axisName);
+         doitMany(lc3);
+      }
 
   } catch (std::exception& x) {
       cerr << "aipserror: error " << x.what() << endl;
@@ -528,3 +544,42 @@ void doitNonLinear (const Vector<Double>& pixelValues,
    }
 }
 
+
+
+void doitMany (const TabularCoordinate& lc)
+//
+// The batch conversions must give exactly the same results
+// as the single ones, for sorted and unsorted input.
+//
+{
+   const uInt n = 500;
+   Matrix<Double> pixel(1, n), world, pixel2;
+   Vector<Bool> failures;
+   for (uInt i=0; i<n; i++) {
+      pixel(0,i) = -10.0 + i*0.25;
+   }
+   for (uInt pass=0; pass<2; pass++) {
+      if (pass == 1) {
+         for (uInt i=0; i<n; i+=2) {
+            std::swap (pixel(0,i), pixel(0,n-1-i));
+         }
+      }
+      if (!lc.toWorldMany(world, pixel, failures)) {
+         throw(AipsError(String("toWorldMany conversion failed because ") + lc.errorMessage()));
+      }
+      if (!lc.toPixelMany(pixel2, world, failures)) {
+         throw(AipsError(String("toPixelMany conversion failed because ") + lc.errorMessage()));
+      }
+      for (uInt i=0; i<n; i++) {
+         Double w, p;
+         lc.toWorld(w, pixel(0,i));
+         lc.toPixel(p, world(0,i));
+         if (w != world(0,i)  ||  p != pixel2(0,i)) {
+            throw(AipsError("Batch conversion differs from single conversion"));
+         }
+      }
+      if (!allNear(pixel2, pixel, 1e-6)) {
+         throw(AipsError("Batch coordinate conversion reflection failed"));
+      }
+   }
+}
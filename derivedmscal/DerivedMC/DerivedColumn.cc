@@ -34,6 +34,18 @@ namespace casacore {
   {
     data = itsEngine->getHA (itsAntNr, rowNr);
   }
+  void HourangleColumn::getScalarColumnV (ArrayBase& data)
+  {
+    if (data.size() > 0) {
+      itsEngine->getHA (itsAntNr, RefRows(0, data.size()-1),
+                     static_cast<Array<Double>&>(data));
+    }
+  }
+  void HourangleColumn::getScalarColumnCellsV (const RefRows& rownrs,
+                                  ArrayBase& data)
+  {
+    itsEngine->getHA (itsAntNr, rownrs, static_cast<Array<Double>&>(data));
+  }
 
   ParAngleColumn::~ParAngleColumn()
   {}
@@ -41,6 +53,18 @@ namespace casacore {
   {
     data = itsEngine->getPA (itsAntNr, rowNr);
   }
+  void ParAngleColumn::getScalarColumnV (ArrayBase& data)
+  {
+    if (data.size() > 0) {
+      itsEngine->getPA (itsAntNr, RefRows(0, data.size()-1),
+                     static_cast<Array<Double>&>(data));
+    }
+  }
+  void ParAngleColumn::getScalarColumnCellsV (const RefRows& rownrs,
+                                  ArrayBase& data)
+  {
+    itsEngine->getPA (itsAntNr, rownrs, static_cast<Array<Double>&>(data));
+  }
 
   LASTColumn::~LASTColumn()
   {}
@@ -48,6 +72,18 @@ namespace casacore {
   {
     data = itsEngine->getLAST (itsAntNr, rowNr);
   }
+  void LASTColumn::getScalarColumnV (ArrayBase& data)
+  {
+    if (data.size() > 0) {
+      itsEngine->getLAST (itsAntNr, RefRows(0, data.size()-1),
+                     static_cast<Array<Double>&>(data));
+    }
+  }
+  void LASTColumn::getScalarColumnCellsV (const RefRows& rownrs,
+                                  ArrayBase& data)
+  {
+    itsEngine->getLAST (itsAntNr, rownrs, static_cast<Array<Double>&>(data));
+  }
 
   HaDecColumn::~HaDecColumn()
   {}
@@ -63,6 +99,17 @@ namespace casacore {
   {
     itsEngine->getHaDec (itsAntNr, rowNr, data);
   }
+  void HaDecColumn::getArrayColumn (Array<Double>& data)
+  {
+    if (data.size() > 0) {
+      itsEngine->getHaDec (itsAntNr, RefRows(0, data.shape().last()-1), data);
+    }
+  }
+  void HaDecColumn::getArrayColumnCells (const RefRows& rownrs,
+                                Array<Double>& data)
+  {
+    itsEngine->getHaDec (itsAntNr, rownrs, data);
+  }
 
   AzElColumn::~AzElColumn()
   {}
@@ -78,6 +125,17 @@ namespace casacore {
   {
     itsEngine->getAzEl (itsAntNr, rowNr, data);
   }
+  void AzElColumn::getArrayColumn (Array<Double>& data)
+  {
+    if (data.size() > 0) {
+      itsEngine->getAzEl (itsAntNr, RefRows(0, data.shape().last()-1), data);
+    }
+  }
+  void AzElColumn::getArrayColumnCells (const RefRows& rownrs,
+                                Array<Double>& data)
+  {
+    itsEngine->getAzEl (itsAntNr, rownrs, data);
+  }
 
   ItrfColumn::~ItrfColumn()
   {}
@@ -93,6 +151,17 @@ namespace casacore {
   {
     itsEngine->getItrf (itsAntNr, rowNr, data);
   }
+  void ItrfColumn::getArrayColumn (Array<Double>& data)
+  {
+    if (data.size() > 0) {
+      itsEngine->getItrf (itsAntNr, RefRows(0, data.shape().last()-1), data);
+    }
+  }
+  void ItrfColumn::getArrayColumnCells (const RefRows& rownrs,
+                                Array<Double>& data)
+  {
+    itsEngine->getItrf (itsAntNr, rownrs, data);
+  }
 
   UVWJ2000Column::~UVWJ2000Column()
   {}
@@ -108,5 +177,16 @@ namespace casacore {
   {
     itsEngine->getNewUVW (False, rowNr, data);
   }
+  void UVWJ2000Column::getArrayColumn (Array<Double>& data)
+  {
+    if (data.size() > 0) {
+      itsEngine->getNewUVW (False, RefRows(0, data.shape().last()-1), data);
+    }
+  }
+  void UVWJ2000Column::getArrayColumnCells (const RefRows& rownrs,
+                                Array<Double>& data)
+  {
+    itsEngine->getNewUVW (False, rownrs, data);
+  }
 
 } //# end namespace
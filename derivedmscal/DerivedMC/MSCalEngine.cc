@@ -36,9 +36,12 @@
 #include <casacore/measures/TableMeasures/ScalarMeasColumn.h>
 #include <casacore/measures/TableMeasures/ArrayMeasColumn.h>
 #include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/OS/Path.h>
+#include <casacore/casa/OS/ThreadPool.h>
 #include <casacore/casa/BasicSL/Constants.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <algorithm>
 
 
 namespace casacore {
@@ -47,7 +50,9 @@ MSCalEngine::MSCalEngine()
   : itsLastCalInx   (-1),
     itsReadFieldDir (True),
     itsDirColName   ("PHASE_DIR")
-{}
+{
+  clearChunks();
+}
 
 MSCalEngine::~MSCalEngine()
 {}
@@ -65,81 +70,147 @@ void MSCalEngine::setTable (const Table& table)
     itsFieldDir.clear();
   }
   itsCalIdMap.clear();
+  itsAntValues.clear();
+  clearChunks();
 }
 
 double MSCalEngine::getHA (Int antnr, rownr_t rownr)
 {
-  setData (antnr, rownr);
-  return itsRADecToHADec().getValue().get()[0];
+  return getRowValues (HADEC, antnr, rownr)[0];
 }
 
 void MSCalEngine::getHaDec (Int antnr, rownr_t rownr, Array<double>& data)
 {
-  setData (antnr, rownr);
-  data = itsRADecToHADec().getValue().get();
+  const Double* values = getRowValues (HADEC, antnr, rownr);
+  data = Vector<Double>(values, values+2);
 }
 
 double MSCalEngine::getPA (Int antnr, rownr_t rownr)
 {
-  Int mount = setData (antnr, rownr);
-  if (mount == 1) {
-    // Do the conversions using the machines.
-    return itsRADecToAzEl().getValue().positionAngle
-      (itsPoleToAzEl().getValue());
-  }
-  return 0.;
+  return getRowValues (PA, antnr, rownr)[0];
 }
 
 double MSCalEngine::getLAST (Int antnr, rownr_t rownr)
 {
-  setData (antnr, rownr);
-  return itsUTCToLAST().getValue().get();
+  return getRowValues (LAST, antnr, rownr)[0];
 }
 
 void MSCalEngine::getAzEl (Int antnr, rownr_t rownr, Array<double>& data)
 {
-  setData (antnr, rownr);
-  data = itsRADecToAzEl().getValue().get();
+  const Double* values = getRowValues (AZEL, antnr, rownr);
+  data = Vector<Double>(values, values+2);
 }
 
 void MSCalEngine::getItrf (Int antnr, rownr_t rownr, Array<double>& data)
 {
-  setData (antnr, rownr);
-  data = itsRADecToItrf().getValue().get();
+  const Double* values = getRowValues (ITRF, antnr, rownr);
+  data = Vector<Double>(values, values+2);
 }
 
 void MSCalEngine::getNewUVW (Bool asApp, rownr_t rownr, Array<double>& data)
 {
   setData (-1, rownr, True);
-  Int ant1 = itsAntCol[0](rownr);
-  Int ant2 = itsAntCol[1](rownr);
+  Vector<Double> uvw(3);
+  calcNewUVW (asApp, itsAntCol[0](rownr), itsAntCol[1](rownr), uvw.data());
+  data = uvw;
+}
+
+void MSCalEngine::getHA (Int antnr, const RefRows& rownrs, Array<Double>& data)
+{
+  getValues (HADEC, antnr, rownrs, 1, data);
+}
+
+void MSCalEngine::getHaDec (Int antnr, const RefRows& rownrs,
+                            Array<Double>& data)
+{
+  getValues (HADEC, antnr, rownrs, 2, data);
+}
+
+void MSCalEngine::getPA (Int antnr, const RefRows& rownrs, Array<Double>& data)
+{
+  getValues (PA, antnr, rownrs, 1, data);
+}
+
+void MSCalEngine::getLAST (Int antnr, const RefRows& rownrs,
+                           Array<Double>& data)
+{
+  getValues (LAST, antnr, rownrs, 1, data);
+}
+
+void MSCalEngine::getAzEl (Int antnr, const RefRows& rownrs,
+                           Array<Double>& data)
+{
+  getValues (AZEL, antnr, rownrs, 2, data);
+}
+
+void MSCalEngine::getItrf (Int antnr, const RefRows& rownrs,
+                           Array<Double>& data)
+{
+  getValues (ITRF, antnr, rownrs, 2, data);
+}
+
+void MSCalEngine::getNewUVW (Bool asApp, const RefRows& rownrs,
+                             Array<Double>& data)
+{
+  if (itsLastCalInx < 0) {
+    init();
+  }
+  // Read the columns needed in one go.
+  Vector<Double> times = itsTimeCol.getColumnCells (rownrs);
+  Vector<Int> ant1s = itsAntCol[0].getColumnCells (rownrs);
+  Vector<Int> ant2s = itsAntCol[1].getColumnCells (rownrs);
+  Vector<Int> calIds, fieldIds;
+  if (! itsCalCol.isNull()) {
+    calIds = itsCalCol.getColumnCells (rownrs);
+  }
+  if (itsReadFieldDir) {
+    fieldIds = itsFieldCol.getColumnCells (rownrs);
+  }
+  RowNumbers rows = rownrs.convert();
+  AlwaysAssert (data.size() == 3*rows.size(), AipsError);
+  Bool deleteIt;
+  Double* dataPtr = data.getStorage (deleteIt);
+  Double* ptr = dataPtr;
+  for (size_t i=0; i<rows.size(); ++i) {
+    setData (-1, rows[i], (calIds.empty() ? 0 : calIds[i]), -1,
+             (fieldIds.empty() ? 0 : fieldIds[i]), times[i], True);
+    calcNewUVW (asApp, ant1s[i], ant2s[i], ptr);
+    ptr += 3;
+  }
+  data.putStorage (dataPtr, deleteIt);
+}
+
+void MSCalEngine::calcNewUVW (Bool asApp, Int ant1, Int ant2, Double* uvw)
+{
   if (ant1 == ant2) {
-    data = 0.;
-  } else {
-    vector<MBaseline>& antMB        = itsAntMB[itsLastCalInx];
-    vector<Vector<Double> >& antUvw = itsAntUvw[itsLastCalInx];
-    Block<Bool>& uvwFilled          = itsUvwFilled[itsLastCalInx];
-    // Calculate UVW per antenna and subtract to get baseline.
-    // Only calculate for an antenna if not done yet.
-    Int ant = ant1;
-    for (int i=0; i<2; ++i) {
-      if (!uvwFilled[ant]) {
-        itsBLToJ2000.setModel (antMB[ant]);
-        MVBaseline bas = itsBLToJ2000().getValue();
-        MVuvw jvguvw(bas, itsLastDirJ2000.getValue());
-        if (asApp) {
-          antUvw[ant] = Muvw::Convert(Muvw(jvguvw, Muvw::J2000),
-                                      Muvw::Ref(Muvw::APP, itsFrame))
-            ().getValue().getVector();
-        } else {
-          antUvw[ant] = Muvw(jvguvw, Muvw::J2000).getValue().getVector();
-        }
-        uvwFilled[ant] = true;
+    uvw[0] = uvw[1] = uvw[2] = 0.;
+    return;
+  }
+  vector<MBaseline>& antMB        = itsAntMB[itsLastCalInx];
+  vector<Vector<Double> >& antUvw = itsAntUvw[itsLastCalInx];
+  Block<Bool>& uvwFilled          = itsUvwFilled[itsLastCalInx];
+  // Calculate UVW per antenna and subtract to get baseline.
+  // Only calculate for an antenna if not done yet.
+  Int ant = ant1;
+  for (int i=0; i<2; ++i) {
+    if (!uvwFilled[ant]) {
+      itsBLToJ2000.setModel (antMB[ant]);
+      MVBaseline bas = itsBLToJ2000().getValue();
+      MVuvw jvguvw(bas, itsLastDirJ2000.getValue());
+      if (asApp) {
+        antUvw[ant] = Muvw::Convert(Muvw(jvguvw, Muvw::J2000),
+                                    Muvw::Ref(Muvw::APP, itsFrame))
+          ().getValue().getVector();
+      } else {
+        antUvw[ant] = Muvw(jvguvw, Muvw::J2000).getValue().getVector();
       }
-      ant = ant2;
+      uvwFilled[ant] = true;
     }
-    // The UVW of the baseline is the difference of the antennae UVW.
-    data = antUvw[ant2] - antUvw[ant1];
+    ant = ant2;
+  }
+  // The UVW of the baseline is the difference of the antennae UVW.
+  for (int i=0; i<3; ++i) {
+    uvw[i] = antUvw[ant2][i] - antUvw[ant1][i];
   }
 }
 
@@ -177,12 +248,15 @@ void MSCalEngine::setDirection (const MDirection& dir)
   itsFieldDir[0].resize (1);
   itsFieldDir[0][0] = dir;
   itsReadFieldDir = False;
+  clearValues();
+  clearChunks();
 }
 
 void MSCalEngine::setDirColName (const String& colName)
 {
   itsDirColName = colName;
   itsReadFieldDir = True;
+  clearChunks();
 }
 
 Int MSCalEngine::setData (Int antnr, rownr_t rownr, Bool fillAnt)
@@ -191,21 +265,30 @@ Int MSCalEngine::setData (Int antnr, rownr_t rownr, Bool fillAnt)
   if (itsLastCalInx < 0) {
     init();
   }
-  // Get the CAL_DESC_ID (if present).
+  Int calDescId = (itsCalCol.isNull()  ?  0 : itsCalCol(rownr));
+  Int antId     = (antnr < 0  ?  antnr : itsAntCol[antnr](rownr));
+  Int fieldId   = (itsReadFieldDir  ?  itsFieldCol(rownr) : 0);
+  return setData (antnr, rownr, calDescId, antId, fieldId, itsTimeCol(rownr),
+                  fillAnt);
+}
+
+Int MSCalEngine::setData (Int antnr, rownr_t rownr, Int calDescId, Int antId,
+                          Int fieldId, Double time, Bool fillAnt,
+                          const MEpoch* epochPtr)
+{
+  // Map the CAL_DESC_ID (if present) to the cal index.
   Int calInx = 0;
-  Int calDescId = 0;
   if (! itsCalCol.isNull()) {
-    calDescId = itsCalCol(rownr);
     // Update the CAL_DESC info if needed.
     if (calDescId >= Int(itsCalIdMap.size())) {
       fillCalDesc();
     }
-    // Map CAL_DESC_ID to the cal index.
     // Initialize other last ids if a new cal index.
     calInx = itsCalIdMap[calDescId];
     if (calInx != itsLastCalInx) {
       itsLastFieldId = -1000;
       itsLastAntId   = -1000;
+      clearValues();
     }
   }
   itsLastCalInx = calInx;
@@ -222,11 +305,9 @@ Int MSCalEngine::setData (Int antnr, rownr_t rownr, Bool fillAnt)
       fillAntPos (calDescId, calInx);
     }
   } else {
-    // Get the antenna id from the table.
     // Update the antenna positions if a higher antenna id is found.
     // In practice this will not happen, but it is possible that the ANTENNA
     // table was not fully filled yet.
-    Int antId = itsAntCol[antnr](rownr);
     if (antId != itsLastAntId) {
       if (itsAntPos[calInx].empty()) {
         fillAntPos (calDescId, calInx);
@@ -238,11 +319,7 @@ Int MSCalEngine::setData (Int antnr, rownr_t rownr, Bool fillAnt)
     mount = itsMount[calInx][antId];
   }
   // If needed, get the direction and put into the measure frame.
-  // Get field id from the table; update the field positions if needed.
-  Int fieldId = 0;
-  if (itsReadFieldDir) {
-    fieldId = itsFieldCol(rownr);
-  }
+  // Update the field positions if needed.
   if (fieldId != itsLastFieldId) {
     if (fieldId >= Int(itsFieldDir[calInx].size())) {
       fillFieldDir (calDescId, calInx);
@@ -264,11 +341,13 @@ Int MSCalEngine::setData (Int antnr, rownr_t rownr, Bool fillAnt)
     }
     /// or better set above models to dir??? Ask Wim. *****
     itsLastFieldId = fieldId;
+    // The cached values and antenna UVWs are for the previous field.
+    clearValues();
+    itsUvwFilled[calInx] = False;
   }
   // Set the epoch in the measure frame.
-  Double time = itsTimeCol(rownr);
   if (time != itsLastTime) {
-    MEpoch epoch = itsTimeMeasCol(rownr);
+    MEpoch epoch = (epochPtr  ?  *epochPtr : itsTimeMeasCol(rownr));
     itsFrame.resetEpoch (epoch);
     if (itsFieldDir[calInx][fieldId].isModel()) {
       itsLastDirJ2000 = itsDirToJ2000();
@@ -279,11 +358,273 @@ Int MSCalEngine::setData (Int antnr, rownr_t rownr, Bool fillAnt)
     }
     itsUTCToLAST.setModel (epoch);
     itsLastTime = time;
+    clearValues();
     itsUvwFilled[calInx] = False;
   }
   return mount;
 }
 
+const Double* MSCalEngine::getValues (ValueType type, Int mount)
+{
+  // The values are stored at index antId+1 (array center at index 0).
+  size_t inx = itsLastAntId + 1;
+  if (inx >= itsAntValues.size()) {
+    AntValues empty;
+    std::fill (empty.filled, empty.filled+NValueType, False);
+    itsAntValues.resize (inx+1, empty);
+  }
+  AntValues& antValues = itsAntValues[inx];
+  Double* values = antValues.values[type];
+  if (! antValues.filled[type]) {
+    // Do the conversions using the machines.
+    Vector<Double> angles;
+    switch (type) {
+    case HADEC:
+      angles.reference (itsRADecToHADec().getValue().get());
+      break;
+    case AZEL:
+      angles.reference (itsRADecToAzEl().getValue().get());
+      break;
+    case ITRF:
+      angles.reference (itsRADecToItrf().getValue().get());
+      break;
+    case PA:
+      values[0] = values[1] = 0.;
+      if (mount == 1) {
+        // Use the (possibly cached) azimuth/elevation of the direction.
+        const Double* azel = getValues (AZEL, mount);
+        values[0] = MVDirection(azel[0], azel[1]).positionAngle
+          (itsPoleToAzEl().getValue());
+      }
+      break;
+    case LAST:
+      values[0] = itsUTCToLAST().getValue().get();
+      values[1] = 0.;
+      break;
+    default:
+      break;
+    }
+    if (angles.size() == 2) {
+      values[0] = angles[0];
+      values[1] = angles[1];
+    }
+    antValues.filled[type] = True;
+  }
+  return values;
+}
+
+const Double* MSCalEngine::getRowValues (ValueType type, Int antnr,
+                                         rownr_t rownr)
+{
+  RowChunk& chunk = itsChunks[antnr+1];
+  Bool inChunk = (rownr >= chunk.first  &&  rownr < chunk.end);
+  if (inChunk  &&  chunk.types[type]) {
+    chunk.lastRow = rownr;
+    return &(chunk.values[((rownr - chunk.first) * NValueType + type) * 2]);
+  }
+  // Calculate ahead if the row follows the previous one. If the type was
+  // not asked for before, the chunk is recalculated from this row on.
+  rownr_t nrow = itsTable.nrow();
+  if ((inChunk  ||  Int64(rownr) == chunk.lastRow + 1)  &&
+      rownr + 1 < nrow  &&  !itsTable.isWritable()) {
+    chunk.types[type] = True;
+    chunk.size  = std::min (2*chunk.size, rownr_t(65536));
+    chunk.first = rownr;
+    chunk.end   = std::min (nrow, rownr + chunk.size);
+    chunk.values.resize ((chunk.end - chunk.first) * NValueType * 2);
+    calcValues (antnr, RefRows(chunk.first, chunk.end-1), chunk.types,
+                chunk.values.data());
+    chunk.lastRow = rownr;
+    return &(chunk.values[type * 2]);
+  }
+  chunk.lastRow = rownr;
+  Int mount = setData (antnr, rownr);
+  return getValues (type, mount);
+}
+
+void MSCalEngine::getValues (ValueType type, Int antnr, const RefRows& rownrs,
+                             uInt nvalues, Array<Double>& data)
+{
+  rownr_t nrow = rownrs.nrow();
+  AlwaysAssert (data.size() == nvalues*nrow, AipsError);
+  Bool types[NValueType];
+  std::fill (types, types+NValueType, False);
+  types[type] = True;
+  std::vector<Double> values (nrow * NValueType * 2);
+  calcValues (antnr, rownrs, types, values.data());
+  Bool deleteIt;
+  Double* dataPtr = data.getStorage (deleteIt);
+  Double* ptr = dataPtr;
+  for (rownr_t i=0; i<nrow; ++i) {
+    const Double* rowValues = &(values[(i * NValueType + type) * 2]);
+    for (uInt j=0; j<nvalues; ++j) {
+      *ptr++ = rowValues[j];
+    }
+  }
+  data.putStorage (dataPtr, deleteIt);
+}
+
+void MSCalEngine::calcValues (Int antnr, const RefRows& rownrs,
+                              const Bool* types, Double* values)
+{
+  if (itsLastCalInx < 0) {
+    init();
+  }
+  // Read the columns needed in one go.
+  Vector<Double> times = itsTimeCol.getColumnCells (rownrs);
+  Vector<Int> calIds, antIds, fieldIds;
+  if (! itsCalCol.isNull()) {
+    calIds = itsCalCol.getColumnCells (rownrs);
+  }
+  if (antnr >= 0) {
+    antIds = itsAntCol[antnr].getColumnCells (rownrs);
+  }
+  if (itsReadFieldDir) {
+    fieldIds = itsFieldCol.getColumnCells (rownrs);
+  }
+  RowNumbers rows = rownrs.convert();
+  // Find the time slots (runs of rows with the same time and field).
+  std::vector<size_t> runStart;
+  for (size_t i=0; i<rows.size(); ++i) {
+    if (i == 0  ||  times[i] != times[i-1]  ||
+        (!fieldIds.empty()  &&  fieldIds[i] != fieldIds[i-1])  ||
+        (!calIds.empty()  &&  calIds[i] != calIds[i-1])) {
+      runStart.push_back (i);
+    }
+  }
+  runStart.push_back (rows.size());
+  size_t nrun = runStart.size() - 1;
+  // Calculate the values of the rows in the given runs using an engine.
+  // The measures conversions are only done for the first row of an
+  // antenna in a time slot; the other rows use the cached values.
+  auto calcRuns = [&] (MSCalEngine& engine, size_t firstRun, size_t endRun,
+                       const MEpoch* epochs)
+  {
+    for (size_t run=firstRun; run<endRun; ++run) {
+      for (size_t i=runStart[run]; i<runStart[run+1]; ++i) {
+        Int mount = engine.setData (antnr, rows[i],
+                                    (calIds.empty() ? 0 : calIds[i]),
+                                    (antIds.empty() ? antnr : antIds[i]),
+                                    (fieldIds.empty() ? 0 : fieldIds[i]),
+                                    times[i], False,
+                                    (epochs ? epochs+run : 0));
+        Double* rowValues = values + i * NValueType * 2;
+        for (uInt type=0; type<NValueType; ++type) {
+          if (types[type]) {
+            const Double* val = engine.getValues (ValueType(type), mount);
+            rowValues[2*type]   = val[0];
+            rowValues[2*type+1] = val[1];
+          }
+        }
+      }
+    }
+  };
+  size_t nthread = std::min (size_t(ThreadPool::concurrency()), nrun);
+  if (nthread > 1  &&  canUseWorkers()) {
+    // The workers cannot read the table, so make sure all antennas and
+    // fields are known and read the epoch of each time slot.
+    if (! antIds.empty()) {
+      AlwaysAssert (max(antIds) < Int(itsAntPos[0].size()), AipsError);
+    }
+    if (! fieldIds.empty()) {
+      if (max(fieldIds) >= Int(itsFieldDir[0].size())) {
+        fillFieldDir (0, 0);
+      }
+      AlwaysAssert (max(fieldIds) < Int(itsFieldDir[0].size()), AipsError);
+    }
+    std::vector<MEpoch> epochs;
+    epochs.reserve (nrun);
+    for (size_t run=0; run<nrun; ++run) {
+      MEpoch epoch = itsTimeMeasCol(rows[runStart[run]]);
+      if (epoch.getRef().offset()) {
+        nthread = 1;
+        break;
+      }
+      // Make a copy with its own reference for use in another thread.
+      epochs.push_back (MEpoch(epoch.getValue(),
+                               MEpoch::Ref(epoch.getRef().getType())));
+    }
+    if (nthread > 1) {
+      size_t chunk = (nrun + nthread - 1) / nthread;
+      ThreadPool::global().parallelFor (nthread, [&] (size_t t)
+        {
+          MSCalEngine worker;
+          worker.initWorker (*this);
+          calcRuns (worker, t*chunk, std::min (nrun, (t+1)*chunk),
+                    epochs.data());
+        }, nthread);
+      return;
+    }
+  }
+  calcRuns (*this, 0, nrun, 0);
+}
+
+Bool MSCalEngine::canUseWorkers() const
+{
+  // Calibration tables can refer to multiple MSs.
+  if (! itsCalCol.isNull()) {
+    return False;
+  }
+  if (itsArrayPos.getRef().offset()) {
+    return False;
+  }
+  for (const MDirection& dir : itsFieldDir[0]) {
+    if (dir.getRef().offset()) {
+      return False;
+    }
+  }
+  return True;
+}
+
+void MSCalEngine::initWorker (const MSCalEngine& that)
+{
+  // Copy the measures, but give them their own reference, because a
+  // reference is shared by copies.
+  itsArrayPos = MPosition (that.itsArrayPos.getValue(),
+                           MPosition::Ref(that.itsArrayPos.getRef().getType()));
+  itsAntPos.resize (1);
+  for (const MPosition& pos : that.itsAntPos[0]) {
+    itsAntPos[0].push_back (MPosition(pos.getValue(),
+                                      MPosition::Ref(pos.getRef().getType())));
+  }
+  itsMount = vector<vector<Int> >(1, that.itsMount[0]);
+  itsFieldDir.resize (1);
+  for (const MDirection& dir : that.itsFieldDir[0]) {
+    itsFieldDir[0].push_back
+      (MDirection(dir.getValue(), MDirection::Ref(dir.getRef().getType())));
+  }
+  itsReadFieldDir = that.itsReadFieldDir;
+  itsAntMB.resize     (1);
+  itsAntUvw.resize    (1);
+  itsUvwFilled.resize (1);
+  itsCalIdMap    = vector<Int>(1,0);
+  itsLastCalInx  = 0;
+  itsLastFieldId = -1000;
+  itsLastAntId   = -1000;
+  itsLastTime    = -1e30;
+  initConverters();
+}
+
+void MSCalEngine::clearValues()
+{
+  for (vector<AntValues>::iterator iter=itsAntValues.begin();
+       iter!=itsAntValues.end(); ++iter) {
+    std::fill (iter->filled, iter->filled+NValueType, False);
+  }
+}
+
+void MSCalEngine::clearChunks()
+{
+  for (RowChunk& chunk : itsChunks) {
+    chunk.first   = 0;
+    chunk.end     = 0;
+    chunk.size    = 512;
+    chunk.lastRow = -1;
+    std::fill (chunk.types, chunk.types+NValueType, False);
+    chunk.values.clear();
+  }
+}
+
 void MSCalEngine::init()
 {
   const TableDesc& td = itsTable.tableDesc();
@@ -355,7 +696,11 @@ void MSCalEngine::init()
   // Convert the antenna position to ITRF (for delay calculations).
   MPosition itrfPos = MPosition::Convert (itsArrayPos, MPosition::ITRF)();
   itsArrayItrf = itrfPos.getValue().getValue();
-  // Initialize the converters.
+  initConverters();
+}
+
+void MSCalEngine::initConverters()
+{
   // Set up the frame for epoch and antenna position.
   itsFrame.set (MEpoch(), MPosition(), MDirection());
   // Make the HADec pole as expressed in HADec. The pole is the default.
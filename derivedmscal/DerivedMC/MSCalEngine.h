@@ -30,6 +30,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/measures/Measures/MDirection.h>
 #include <casacore/measures/Measures/MPosition.h>
 #include <casacore/measures/Measures/MEpoch.h>
@@ -102,6 +103,25 @@ namespace casacore {
 // The engine can also be used for old CASA Calibration Tables. It understands
 // how they reference the MeasurementSets. Because these calibration tables
 // contain no ANTENNA2 columns, columns XX2 are the same as XX1.
+//
+// The values of an antenna (or array center) only depend on time and field,
+// so they are calculated once and cached until the time or field changes.
+// Thus the rows of all baselines in a time slot need the measures
+// conversions only once per antenna. The functions taking a RefRows object
+// get the values for many rows at once, reading the columns needed
+// (TIME, FIELD_ID, etc.) in bulk.
+// <br>Usually rows are accessed in ascending order (e.g., by TaQL).
+// Therefore, if a row directly follows the row asked for before (for the
+// same antenna), the values are calculated ahead for a chunk of rows. They
+// are calculated for all value types asked so far for that antenna, so
+// functions asking for different values (e.g., AZEL1 and PA1) share the
+// conversions. The chunk grows to at most 65536 rows. It is only done for
+// a readonly table, because the chunk would not notice changed TIMEs.
+// <br>The time slots in such a chunk (or in the rows given to the functions
+// taking a RefRows object) are divided over the threads of the global
+// <linkto class=ThreadPool>ThreadPool</linkto>. Each thread uses its own
+// frame and conversion engines. This is not done for old CASA calibration
+// tables and for epochs, positions or directions with an offset.
 // </synopsis>
 
 // <motivation>
@@ -159,6 +179,18 @@ public:
   // Get the delay for the given row.
   double getDelay (Int antnr, rownr_t rownr);
 
+  // Get the values for the given rows. The data array must have the
+  // correct shape (the row axis last).
+  // <group>
+  void getHA    (Int antnr, const RefRows& rownrs, Array<Double>&);
+  void getHaDec (Int antnr, const RefRows& rownrs, Array<Double>&);
+  void getPA    (Int antnr, const RefRows& rownrs, Array<Double>&);
+  void getLAST  (Int antnr, const RefRows& rownrs, Array<Double>&);
+  void getAzEl  (Int antnr, const RefRows& rownrs, Array<Double>&);
+  void getItrf  (Int antnr, const RefRows& rownrs, Array<Double>&);
+  void getNewUVW (Bool asApp, const RefRows& rownrs, Array<Double>&);
+  // </group>
+
 private:
   // Copy constructor cannot be used.
   MSCalEngine (const MSCalEngine& that);
@@ -166,14 +198,80 @@ private:
   // Assignment cannot be used.
   MSCalEngine& operator= (const MSCalEngine& that);
   
+  // The types of the values cached per antenna.
+  enum ValueType {HADEC, AZEL, PA, LAST, ITRF, NValueType};
+
+  // The values of an antenna (or array center) for the current time
+  // and field.
+  struct AntValues {
+    Bool   filled[NValueType];
+    Double values[NValueType][2];
+  };
+
+  // The values calculated ahead for a chunk of rows of an antenna
+  // (or array center).
+  struct RowChunk {
+    rownr_t first;                //# first row in the chunk
+    rownr_t end;                  //# last row in the chunk + 1
+    rownr_t size;                 //# size of the next chunk
+    Int64   lastRow;              //# row last asked for (-1 is none)
+    Bool    types[NValueType];    //# the types asked for (and calculated)
+    std::vector<Double> values;   //# 2 values per type per row
+  };
+
   // Set the data in the measure converter machines.
   // The antenna positions are only filled in antnr>=0 or if fillAnt is set.
   // It returns the mount of the antenna.
   Int setData (Int antnr, rownr_t rownr, Bool fillAnt=False);
 
+  // Idem, but the values of the CAL_DESC_ID, ANTENNA, FIELD_ID and TIME
+  // columns of the row are given. If the epoch is given, it is used
+  // instead of reading it from the TIME column.
+  Int setData (Int antnr, rownr_t rownr, Int calDescId, Int antId,
+               Int fieldId, Double time, Bool fillAnt,
+               const MEpoch* epoch=0);
+
+  // Get the values of the given type for the antenna (or array center)
+  // last set by setData. They are calculated if not cached yet.
+  const Double* getValues (ValueType type, Int mount);
+
+  // Get the values of the given type for the given row. They are taken
+  // from the chunk calculated ahead if the rows are accessed in order.
+  const Double* getRowValues (ValueType type, Int antnr, rownr_t rownr);
+
+  // Get the first nvalues values of the given type for the given rows.
+  void getValues (ValueType type, Int antnr, const RefRows& rownrs,
+                  uInt nvalues, Array<Double>& data);
+
+  // Calculate the values of the types set in <src>types</src> for the
+  // given rows. For each row 2 values per type (thus 2*NValueType
+  // values) are stored in <src>values</src>.
+  void calcValues (Int antnr, const RefRows& rownrs, const Bool* types,
+                   Double* values);
+
+  // Can worker engines be used to calculate values in parallel?
+  Bool canUseWorkers() const;
+
+  // Initialize this engine as a worker of the given engine. It gets copies
+  // of the positions and directions and its own frame and converters.
+  // It cannot read the table.
+  void initWorker (const MSCalEngine& that);
+
+  // Clear the cached antenna values.
+  void clearValues();
+
+  // Clear the chunks of values calculated ahead.
+  void clearChunks();
+
+  // Calculate the UVW of a baseline for the time and field last set.
+  void calcNewUVW (Bool asApp, Int ant1, Int ant2, Double* uvw);
+
   // Initialize the column objects, etc.
   void init();
 
+  // Initialize the frame and the converters.
+  void initConverters();
+
   // Fill the CalDesc info for calibration tables.
   void fillCalDesc();
 
@@ -222,6 +320,8 @@ private:
   MBaseline::Convert          itsBLToJ2000;    //# convert ITRF to J2000
   MeasFrame                   itsFrame;        //# frame used by the converters
   MDirection                  itsLastDirJ2000; //# itsLastFieldId dir in J2000
+  vector<AntValues>           itsAntValues;    //# cached values per antenna
+  RowChunk                    itsChunks[3];    //# chunks for antnr -1, 0, 1
 };
 
 
@@ -94,6 +94,11 @@ void register_derivedmscal()
 }
 
 
+// Register the functions when the library is loaded, so an application
+// linked with it does not need to load it dynamically at first use.
+static UDFRegistrar theirRegistrar_derivedmscal (register_derivedmscal);
+
+
 namespace casacore {
 
   void HelpMsCalUDF::showFuncsDerived (ostream& os)
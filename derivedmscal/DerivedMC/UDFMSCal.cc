@@ -41,23 +41,54 @@
 #include <casacore/tables/TaQL/ExprUnitNode.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/IO/ArrayIO.h>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 namespace casacore {
 
-  UDFMSCal::UDFMSCal (ColType type, Int arg)
-    : itsType (type),
-      itsArg  (arg)
-  {
-    if (itsType == DELAY) {
-      // Default column to use for delays.
-      itsEngine.setDirColName ("DELAY_DIR");
+  namespace {
+    // Get the engine registered for the given key. If there is none, the
+    // given engine is registered and returned.
+    // The key contains the thread id, so an engine is only shared by the
+    // functions used in a thread (thus in the same query).
+    std::shared_ptr<MSCalEngine> shareEngine
+    (const std::shared_ptr<MSCalEngine>& engine, const String& key)
+    {
+      static std::mutex mutex;
+      static std::map<String, std::weak_ptr<MSCalEngine> > engines;
+      std::lock_guard<std::mutex> lock(mutex);
+      // Remove the engines no longer used.
+      for (auto iter=engines.begin(); iter!=engines.end();) {
+        if (iter->second.expired()) {
+          iter = engines.erase (iter);
+        } else {
+          ++iter;
+        }
+      }
+      auto iter = engines.find (key);
+      if (iter != engines.end()) {
+        return iter->second.lock();
+      }
+      engines[key] = engine;
+      return engine;
     }
   }
 
+  UDFMSCal::UDFMSCal (ColType type, Int arg)
+    : itsType       (type),
+      itsArg        (arg),
+      itsDirSet     (False),
+      // Default column to use for delays.
+      itsDirColName (type == DELAY  ?  "DELAY_DIR" : "PHASE_DIR")
+  {}
+
   UDFMSCal::UDFMSCal (const String& funcName)
     : itsType       (GETVALUE),
       itsArg        (0),
-      itsFuncName   (funcName)
+      itsFuncName   (funcName),
+      itsDirSet     (False)
   {}
 
   UDFMSCal::UDFMSCal (const String& funcName, const String& subtabName,
@@ -66,7 +97,8 @@ namespace casacore {
       itsArg        (arg),
       itsFuncName   (funcName),
       itsSubTabName (subtabName),
-      itsIdColName  (idcolName)
+      itsIdColName  (idcolName),
+      itsDirSet     (False)
   {}
 
   UDFMSCal::UDFMSCal (const String& funcName, const String& subtabName,
@@ -76,7 +108,8 @@ namespace casacore {
       itsFuncName   (funcName),
       itsSubTabName (subtabName),
       itsIdColName  (idcolName),
-      itsSubColName (subcolName)
+      itsSubColName (subcolName),
+      itsDirSet     (False)
   {}
 
   UDFBase* UDFMSCal::makeHA (const String&)
@@ -187,7 +220,6 @@ namespace casacore {
     // Most functions are handled by the engine.
     if (itsType != STOKES  &&  itsType != SELECTION  &&  itsType != GETVALUE  &&
         itsType != UVWWVL  &&  itsType != UVWWVLS) {
-      itsEngine.setTable (table);
       if (operands().size() > 1) {
         throw AipsError("More than 1 argument given to MSCAL function");
       }
@@ -195,6 +227,7 @@ namespace casacore {
       if (operands().size() == 1) {
         setupDir (operands()[0]);
       }
+      makeEngine (table);
     }
     setDataType (TableExprNodeRep::NTDouble);
     switch (itsType) {
@@ -283,16 +316,18 @@ namespace casacore {
                          "of 2 values");
       }
       Vector<Double> dirVec(dirs.reform(IPosition(1,dirs.size())));
-      itsEngine.setDirection (MDirection(Quantity(dirVec[0], "rad"),
-                                         Quantity(dirVec[1], "rad"),
-                                         MDirection::J2000));
+      itsDirection = MDirection(Quantity(dirVec[0], "rad"),
+                                Quantity(dirVec[1], "rad"),
+                                MDirection::J2000);
+      itsDirSet = True;
     } else if (operand->dataType() == TableExprNodeRep::NTString) {
       // First try the string as a planetary object.
       // In the future comets can be supported like COMET:cometname.
       String str = operand->getString(0);
       Bool fnd = True;
       try {
-        itsEngine.setDirection (MDirection::makeMDirection(str));
+        itsDirection = MDirection::makeMDirection(str);
+        itsDirSet = True;
       } catch (std::exception&) {
         fnd = False;
       }
@@ -305,7 +340,7 @@ namespace casacore {
         if (str.empty()) {
           throw AipsError ("An empty string given to a MSCAL function");
         }
-        itsEngine.setDirColName (str);
+        itsDirColName = str;
       }
     } else {
       throw AipsError ("Argument to MSCAL function must be double or "
@@ -313,6 +348,34 @@ namespace casacore {
     }
   }
 
+  void UDFMSCal::makeEngine (const Table& table)
+  {
+    itsEngine = std::make_shared<MSCalEngine>();
+    itsEngine->setDirColName (itsDirColName);
+    if (itsDirSet) {
+      itsEngine->setDirection (itsDirection);
+    }
+    itsEngine->setTable (table);
+    // The functions using the same table and direction can share the
+    // engine and its cached values. The UVWs cached in the engine depend
+    // on the UVW frame (J2000 or APP).
+    std::ostringstream key;
+    key.precision (17);
+    key << std::this_thread::get_id() << ' ' << table.tableName() << ' '
+        << table.nrow() << ' ';
+    if (itsDirSet) {
+      key << itsDirection.getRefString() << ' '
+          << itsDirection.getValue().get();
+    } else {
+      key << itsDirColName;
+    }
+    if (itsType == NEWUVW  ||  itsType == NEWUVWWVL  ||
+        itsType == NEWUVWWVLS) {
+      key << " uvw" << itsArg;
+    }
+    itsEngine = shareEngine (itsEngine, key.str());
+  }
+
   void UDFMSCal::setupWvls (const Table& table,
                             vector<TENShPtr>& operands,
                             uInt nargMax)
@@ -684,9 +747,9 @@ namespace casacore {
       Table tab(itsUvwCol.table());
       itsUvwCol.attach (tab(rownrs), "UVW");
     }
-    Table tab(itsEngine.getTable());
-    if (! tab.isNull()) {
-      itsEngine.setTable (tab(rownrs));
+    if (itsEngine) {
+      // Another function can share the engine, so use a new one.
+      makeEngine (itsEngine->getTable()(rownrs));
     }
   }
 
@@ -755,13 +818,13 @@ namespace casacore {
     DebugAssert (id.byRow(), AipsError);
     switch (itsType) {
     case HA:
-      return itsEngine.getHA (itsArg, id.rownr());
+      return itsEngine->getHA (itsArg, id.rownr());
     case PA:
-      return itsEngine.getPA (itsArg, id.rownr());
+      return itsEngine->getPA (itsArg, id.rownr());
     case LAST:
-      return itsEngine.getLAST (itsArg, id.rownr());
+      return itsEngine->getLAST (itsArg, id.rownr());
     case DELAY:
-      return itsEngine.getDelay (itsArg, id.rownr());
+      return itsEngine->getDelay (itsArg, id.rownr());
     case GETVALUE:
       {
         rownr_t rownr = getRowNr(id);
@@ -850,13 +913,13 @@ namespace casacore {
     DebugAssert (id.byRow(), AipsError);
     switch (itsType) {
     case HADEC:
-      itsEngine.getHaDec (itsArg, id.rownr(), itsTmpVector);
+      itsEngine->getHaDec (itsArg, id.rownr(), itsTmpVector);
       return MArray<Double>(itsTmpVector);
     case AZEL:
-      itsEngine.getAzEl (itsArg, id.rownr(), itsTmpVector);
+      itsEngine->getAzEl (itsArg, id.rownr(), itsTmpVector);
       return MArray<Double>(itsTmpVector);
     case ITRF:
-      itsEngine.getItrf (itsArg, id.rownr(), itsTmpVector);
+      itsEngine->getItrf (itsArg, id.rownr(), itsTmpVector);
       return MArray<Double>(itsTmpVector);
     case UVWWVL:
       itsUvwCol.get (id.rownr(), itsTmpVector);
@@ -866,14 +929,14 @@ namespace casacore {
       itsUvwCol.get (id.rownr(), itsTmpVector);
       return MArray<Double>(toWvls (id));
     case NEWUVW:
-      itsEngine.getNewUVW (itsArg, id.rownr(), itsTmpVector);
+      itsEngine->getNewUVW (itsArg, id.rownr(), itsTmpVector);
       return MArray<Double>(itsTmpVector);
     case NEWUVWWVL:
-      itsEngine.getNewUVW (itsArg, id.rownr(), itsTmpVector);
+      itsEngine->getNewUVW (itsArg, id.rownr(), itsTmpVector);
       itsTmpVector *= itsWavel[itsDDIds[itsIdNode.getInt(id)]];
       return MArray<Double>(itsTmpVector);
     case NEWUVWWVLS:
-      itsEngine.getNewUVW (itsArg, id.rownr(), itsTmpVector);
+      itsEngine->getNewUVW (itsArg, id.rownr(), itsTmpVector);
       return MArray<Double>(toWvls (id));
     case STOKES:
       {
@@ -33,6 +33,7 @@
 #include <casacore/ms/MSSel/MSSelectionErrorHandler.h>
 #include <casacore/tables/TaQL/UDFBase.h>
 #include <casacore/tables/TaQL/ExprNode.h>
+#include <memory>
 
 namespace casacore {
 
@@ -105,6 +106,11 @@ namespace casacore {
 // The engine can also be used for a CASA Calibration Table. It understands
 // how it references the MeasurementSets. Because calibration tables contain
 // no ANTENNA2 columns, functions XX2 are the same as XX1.
+// <br>The functions in a query using the same table and direction share
+// their MSCalEngine object, thus the values it calculates and caches per
+// time slot and antenna (see
+// <linkto class=MSCalEngine>MSCalEngine</linkto> for the calculation of
+// the values ahead for chunks of rows in parallel).
 // </synopsis>
 
 // <motivation>
@@ -217,6 +223,10 @@ namespace casacore {
     // Setup direction conversion if a direction is explicitly given.
     void setupDir (TENShPtr& operand);
 
+    // Make the engine for the given table using the direction settings.
+    // It is shared with other functions using the same table and direction.
+    void makeEngine (const Table& table);
+
     // Setup getting column values from a subtable.
     void setupGetValue (const Table& table,
                         std::vector<TENShPtr>& operands);
@@ -234,7 +244,7 @@ namespace casacore {
     Array<Double> toWvls (const TableExprId&);
 
     //# Data members.
-    MSCalEngine     itsEngine;
+    std::shared_ptr<MSCalEngine> itsEngine;
     StokesConverter itsStokesConv;
     TableExprNode   itsDataNode;   //# for stokes, selections and getvalues
     TableExprNode   itsIdNode;     //# node giving rowid for getvalues
@@ -248,6 +258,9 @@ namespace casacore {
     String          itsSubTabName;
     String          itsIdColName;
     String          itsSubColName;
+    Bool            itsDirSet;     //# explicit direction given?
+    MDirection      itsDirection;  //# the explicit direction
+    String          itsDirColName; //# FIELD direction column to use
     //# Preallocate arrays to avoid having to construct them too often.
     //# Makes it thread-unsafe though.
     Vector<Double>  itsTmpVector;
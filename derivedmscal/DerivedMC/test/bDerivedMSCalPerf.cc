@@ -0,0 +1,229 @@
+//# bDerivedMSCalPerf.cc: Benchmark the derived MS value engines
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/derivedmscal/DerivedMC/MSCalEngine.h>
+#include <casacore/ms/MeasurementSets/MeasurementSet.h>
+#include <casacore/ms/MeasurementSets/MSColumns.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableUtil.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/OS/Benchmark.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+
+using namespace casacore;
+using namespace std;
+
+// This program benchmarks the MSCalEngine calculating derived values
+// (hourangle, parallactic angle, LAST, azimuth/elevation, UVW) as used by
+// the DerivedMSCal virtual columns and the mscal TaQL UDFs.
+// The values are calculated for all rows of a synthetic MS, both row by
+// row and in bulk, with the IAU1980 and IAU2000 models.
+// The engine reads the table in a single thread, but the bulk and
+// sequential row calculations split the time slots over the threads of
+// the global ThreadPool (its default concurrency can be set using
+// OMP_NUM_THREADS). Measures conversions are benchmarked by bMeasPerf.
+//
+// It is built by 'make bench'. Run it as:
+//    bDerivedMSCalPerf [ntime [nant]] [benchmark options]
+
+const String msName ("bDerivedMSCalPerf_tmp.ms");
+uInt ntime = 100;
+uInt nant  = 14;
+const Double startTime = 4.5e9;
+const Double interval  = 10.;
+
+uInt64 nrow()
+  { return uInt64(ntime) * nant*(nant-1)/2; }
+
+// Set the use of the IAU2000 precession/nutation models.
+void setIAU2000 (Bool use)
+{
+  static const uInt reg =
+    AipsrcValue<Bool>::registerRC ("measures.iau2000.b_use", False);
+  AipsrcValue<Bool>::set (reg, use);
+}
+
+// Create the synthetic MS with the columns and subtables used by MSCalEngine.
+void makeMS()
+{
+  SetupNewTable newtab(msName, MS::requiredTableDesc(), Table::New);
+  MeasurementSet ms(newtab, nrow());
+  ms.createDefaultSubtables (Table::New);
+  MSColumns mscols(ms);
+  Vector<Double> times(nrow());
+  Vector<Int> ant1(nrow()), ant2(nrow());
+  Matrix<Double> uvw(3, nrow());
+  uInt64 row = 0;
+  for (uInt t=0; t<ntime; ++t) {
+    for (uInt a1=0; a1<nant; ++a1) {
+      for (uInt a2=a1+1; a2<nant; ++a2) {
+        times[row] = startTime + interval*(t+0.5);
+        ant1[row]  = a1;
+        ant2[row]  = a2;
+        uvw(0,row) = 144. * (a2 - a1);
+        uvw(1,row) = 10.;
+        uvw(2,row) = 5.;
+        ++row;
+      }
+    }
+  }
+  mscols.time().putColumn (times);
+  mscols.antenna1().putColumn (ant1);
+  mscols.antenna2().putColumn (ant2);
+  mscols.fieldId().putColumn (Vector<Int>(nrow(), 0));
+  mscols.uvw().putColumn (uvw);
+  ms.antenna().addRow (nant);
+  MSAntennaColumns antcols(ms.antenna());
+  Vector<Double> pos(3);
+  for (uInt i=0; i<nant; ++i) {
+    antcols.name().put (i, "RT" + String::toString(i));
+    antcols.mount().put (i, "equatorial");
+    pos[0] = 3828488.8 + 144.*i;
+    pos[1] = 443253.5;
+    pos[2] = 5064977.2;
+    antcols.position().put (i, pos);
+  }
+  ms.field().addRow (1);
+  MSFieldColumns fieldcols(ms.field());
+  Matrix<Double> dir(2,1);
+  dir(0,0) = 1.1;
+  dir(1,0) = 0.8;
+  fieldcols.delayDir().put (0, dir);
+  fieldcols.phaseDir().put (0, dir);
+  fieldcols.referenceDir().put (0, dir);
+  ms.observation().addRow (1);
+  MSObservationColumns obscols(ms.observation());
+  obscols.telescopeName().put (0, "WSRT");
+}
+
+
+// A Calc function calculates the values of all rows using the engine.
+typedef std::function<void(MSCalEngine&, const Table&)> Calc;
+
+void addBench (Benchmark& bench, const String& name, const Calc& calc)
+{
+  for (const String model : {"IAU1980", "IAU2000"}) {
+    bench.add (name + '/' + model, [calc, model](BenchmarkState& state) {
+        // Use a new engine for each iteration, so no values are cached.
+        state.pauseTiming();
+        setIAU2000 (model == "IAU2000");
+        Table tab(msName);
+        MSCalEngine engine;
+        engine.setTable (tab);
+        state.resumeTiming();
+        calc (engine, tab);
+        state.addItems (tab.nrow());
+      });
+  }
+}
+
+void addBenchmarks (Benchmark& bench)
+{
+  // Bulk calculations.
+  RefRows allRows(0, nrow()-1);
+  addBench (bench, "bulk/HA", [allRows](MSCalEngine& engine, const Table&) {
+      Vector<Double> values(nrow());
+      engine.getHA (-1, allRows, values);
+    });
+  addBench (bench, "bulk/HA1", [allRows](MSCalEngine& engine, const Table&) {
+      Vector<Double> values(nrow());
+      engine.getHA (0, allRows, values);
+    });
+  addBench (bench, "bulk/PA1", [allRows](MSCalEngine& engine, const Table&) {
+      Vector<Double> values(nrow());
+      engine.getPA (0, allRows, values);
+    });
+  addBench (bench, "bulk/LAST", [allRows](MSCalEngine& engine, const Table&) {
+      Vector<Double> values(nrow());
+      engine.getLAST (-1, allRows, values);
+    });
+  addBench (bench, "bulk/AZEL1", [allRows](MSCalEngine& engine, const Table&) {
+      Matrix<Double> values(2, nrow());
+      engine.getAzEl (0, allRows, values);
+    });
+  addBench (bench, "bulk/UVW_J2000",
+            [allRows](MSCalEngine& engine, const Table&) {
+      Matrix<Double> values(3, nrow());
+      engine.getNewUVW (False, allRows, values);
+    });
+  addBench (bench, "bulk/UVW_APP",
+            [allRows](MSCalEngine& engine, const Table&) {
+      Matrix<Double> values(3, nrow());
+      engine.getNewUVW (True, allRows, values);
+    });
+  // Row by row calculations (as done by the virtual columns).
+  addBench (bench, "row/HA1", [](MSCalEngine& engine, const Table& tab) {
+      for (rownr_t row=0; row<tab.nrow(); ++row) {
+        engine.getHA (0, row);
+      }
+    });
+  addBench (bench, "row/PA1", [](MSCalEngine& engine, const Table& tab) {
+      for (rownr_t row=0; row<tab.nrow(); ++row) {
+        engine.getPA (0, row);
+      }
+    });
+  addBench (bench, "row/AZEL1", [](MSCalEngine& engine, const Table& tab) {
+      Array<Double> values;
+      for (rownr_t row=0; row<tab.nrow(); ++row) {
+        engine.getAzEl (0, row, values);
+      }
+    });
+  addBench (bench, "row/UVW_J2000", [](MSCalEngine& engine, const Table& tab) {
+      Array<Double> values;
+      for (rownr_t row=0; row<tab.nrow(); ++row) {
+        engine.getNewUVW (False, row, values);
+      }
+    });
+}
+
+int main (int argc, const char* argv[])
+{
+  try {
+    Benchmark bench(argc, argv);
+    const std::vector<String>& args = bench.arguments();
+    if (args.size() > 0) {
+      ntime = std::max(1, atoi(args[0].chars()));
+    }
+    if (args.size() > 1) {
+      nant = std::max(2, atoi(args[1].chars()));
+    }
+    cout << "bDerivedMSCalPerf: nrow=" << nrow() << " (ntime=" << ntime
+         << " nant=" << nant << ")" << endl;
+    makeMS();
+    addBenchmarks (bench);
+    int status = bench.run();
+    TableUtil::deleteTable (msName, True);
+    return status;
+  } catch (const std::exception& x) {
+    cerr << "Exception: " << x.what() << endl;
+    return 1;
+  }
+}
@@ -36,6 +36,8 @@
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/OS/Timer.h>
 #include <iostream>
@@ -218,6 +220,24 @@ int main(int argc, char* argv[])
         check (i, uvw, uvwJ2000);
       }
     }
+    // Check that getting entire columns gives the same values as per row.
+    {
+      Vector<Double> has = ha1.getColumn();
+      Vector<Double> pas = pa2.getColumn();
+      Array<Double> azels = azel2.getColumn();
+      Array<Double> uvws = uvwJ2000.getColumn();
+      Slicer rowSlicer(IPosition(1,1), IPosition(1,tab.nrow()/2));
+      Vector<Double> pasCells = pa2.getColumnRange (rowSlicer);
+      for (rownr_t i=0; i<tab.nrow(); ++i) {
+        AlwaysAssertExit (has[i] == ha1(i));
+        AlwaysAssertExit (pas[i] == pa2(i));
+        AlwaysAssertExit (allEQ (azels[i], azel2(i)));
+        AlwaysAssertExit (allEQ (uvws[i], uvwJ2000(i)));
+      }
+      for (rownr_t i=0; i<pasCells.size(); ++i) {
+        AlwaysAssertExit (pasCells[i] == pa2(i+1));
+      }
+    }
     // Now time getting the hourangle using DataMan and MSDerivedValues.
     double totha = 0;
     Timer timer;
@@ -225,6 +245,9 @@ int main(int argc, char* argv[])
       totha += ha(i);
     }
     timer.show ("DataMan  ha");
+    timer.mark();
+    totha = sum(ha.getColumn());
+    timer.show ("DataMan hac");
     totha = 0;
     timer.mark();
     for (uInt i=0; i<tab.nrow(); ++i) {
@@ -243,6 +266,9 @@ int main(int argc, char* argv[])
       uvwJ2000(i);
     }
     timer.show ("DataMan uvw");
+    timer.mark();
+    uvwJ2000.getColumn();
+    timer.show ("DataMan uvc");
     if (! uvw.isNull()) {
       timer.mark();
       for (uInt i=0; i<tab.nrow(); ++i) {
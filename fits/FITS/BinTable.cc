@@ -42,10 +42,13 @@
 #include <casacore/tables/Tables/RowCopier.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Utilities/Regex.h>
 #include <casacore/casa/sstream.h>
 #include <casacore/casa/stdio.h>
+#include <algorithm>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -982,18 +985,7 @@ Table BinaryTable::fullTable(const String& tabname,
 
     //		and actually create the table
     Table full(newtab,nrows());
-    RowCopier rowcop(full, *currRowTab);
-    //			loop over all rows remaining
-    for (Int outrow = 0, infitsrow = currrow(); infitsrow < nrows(); 
-	 outrow++, infitsrow++) {
-	rowcop.copy(outrow, 0);
-	//		don't read past the end of the table
-	if ((infitsrow+1) < nrows()) {
-	    if (!theheap_p) read(1);
-	    else ++(*this);
-	    fillRow();
-	}
-    }		// end of loop over rows
+    fillTable(full);
     return full;
 }
 
@@ -1004,7 +996,35 @@ Table BinaryTable::fullTable()
        newtab.bindAll(stman);
     //		and actually create the table
     Table full = Table(newtab,Table::Memory, nrows());
+    fillTable(full);
+    return full;
+}
+
+void BinaryTable::fillTable(Table& full)
+{
     RowCopier rowcop(full, *currRowTab);
+    if (canFillBlocks()) {
+	//		the current row has already been translated
+	rowcop.copy(0, 0);
+	//		read the remaining rows in blocks of about 4 MB
+	Int blockRows = max(1, Int(4*1024*1024 / max(1u, rowsize())));
+	Int nleft = nrows() - currrow() - 1;
+	rownr_t outrow = 1;
+	while (nleft > 0) {
+	    Int n = min(nleft, blockRows);
+	    if (read(n) != 0) {
+		throw AipsError("BinaryTable: error reading FITS table rows");
+	    }
+	    fillBlock(full, outrow, n);
+	    outrow += n;
+	    nleft -= n;
+	}
+	//		the current row is the last one, as in the row-wise copy
+	if (outrow > 1) {
+	    fillRow();
+	}
+	return;
+    }
     //			loop over all rows remaining
     for (Int outrow = 0, infitsrow = currrow(); infitsrow < nrows(); 
 	 outrow++, infitsrow++) {
@@ -1016,7 +1036,165 @@ Table BinaryTable::fullTable()
 	    fillRow();
 	}
     }		// end of loop over rows
-    return full;
+}
+
+Bool BinaryTable::canFillBlocks() const
+{
+    if (theheap_p) return False;
+    for (Int j=0; j<tfields(); j++) {
+	switch (field(j).fieldtype()) {
+	case FITS::BIT:
+	case FITS::ICOMPLEX:
+	case FITS::VADESC:
+	    return False;
+	default:
+	    break;
+	}
+    }
+    return True;
+}
+
+//	Copy a field of a block of rows into a column at once.
+//	The FITS values are already converted to local format.
+template<class T, class FITST>
+static void putFieldBlock (Table& tab, const String& name, Int nelem,
+			   const std::vector<const void*>& ptrs,
+			   rownr_t startRow)
+{
+    Int nrow = ptrs.size();
+    Array<T> arr(nelem == 1 ? IPosition(1, nrow) : IPosition(2, nelem, nrow));
+    T* out = arr.data();
+    for (Int r=0; r<nrow; r++) {
+	const FITST* in = static_cast<const FITST*>(ptrs[r]);
+	for (Int k=0; k<nelem; k++) {
+	    *out++ = T(in[k]);
+	}
+    }
+    Slicer rows(IPosition(1, startRow), IPosition(1, nrow));
+    if (nelem == 1) {
+	ScalarColumn<T>(tab, name).putColumnRange(rows, Vector<T>(arr));
+    } else {
+	ArrayColumn<T>(tab, name).putColumnRange(rows, arr);
+    }
+}
+
+//	Scale a block of values in the same way as fillRow.
+template<class T>
+static void scaleFieldBlock (Array<T>& arr, Double scale, Double zero)
+{
+    if (scale != 1) {
+	for (T& v : arr) v = v*T(scale) + T(zero);
+    } else if (zero != 0) {
+	arr += T(zero);
+    }
+}
+static void scaleFieldBlock (Array<Float>& arr, Double scale, Double zero)
+{
+    if (scale != 1) {
+	for (Float& v : arr) v = Float(v*scale + zero);
+    } else if (zero != 0) {
+	arr += Float(zero);
+    }
+}
+
+template<class T>
+static void putScaledFieldBlock (Table& tab, const String& name, Int nelem,
+				 const std::vector<const void*>& ptrs,
+				 rownr_t startRow, Double scale, Double zero)
+{
+    Int nrow = ptrs.size();
+    Array<T> arr(nelem == 1 ? IPosition(1, nrow) : IPosition(2, nelem, nrow));
+    T* out = arr.data();
+    for (Int r=0; r<nrow; r++) {
+	const T* in = static_cast<const T*>(ptrs[r]);
+	std::copy(in, in+nelem, out);
+	out += nelem;
+    }
+    scaleFieldBlock(arr, scale, zero);
+    Slicer rows(IPosition(1, startRow), IPosition(1, nrow));
+    if (nelem == 1) {
+	ScalarColumn<T>(tab, name).putColumnRange(rows, Vector<T>(arr));
+    } else {
+	ArrayColumn<T>(tab, name).putColumnRange(rows, arr);
+    }
+}
+
+void BinaryTable::fillBlock(Table& full, rownr_t startRow, Int nrow)
+{
+    //		get the address of each field in each row of the block
+    Int begRow = currrow();
+    std::vector<std::vector<const void*> > ptrs(tfields(),
+						 std::vector<const void*>(nrow));
+    for (Int r=0; r<nrow; r++) {
+	(*this)(begRow + r);
+	for (Int j=0; j<tfields(); j++) {
+	    ptrs[j][r] = field(j).data();
+	}
+    }
+    //		and copy the block column by column
+    for (Int j=0; j<tfields(); j++) {
+	const String& name = (*colNames)[j];
+	Int ne = nelem[j];
+	if (ne == 0) continue;
+	switch (field(j).fieldtype()) {
+	case FITS::LOGICAL:
+	    putFieldBlock<Bool,FitsLogical>(full, name, ne, ptrs[j], startRow);
+	    break;
+	case FITS::BYTE:
+	    putFieldBlock<uChar,uChar>(full, name, ne, ptrs[j], startRow);
+	    break;
+	case FITS::SHORT:
+	    putFieldBlock<Short,Short>(full, name, ne, ptrs[j], startRow);
+	    break;
+	case FITS::LONG:
+	    putFieldBlock<Int,FitsLong>(full, name, ne, ptrs[j], startRow);
+	    break;
+	case FITS::FLOAT:
+	    putScaledFieldBlock<Float>(full, name, ne, ptrs[j], startRow,
+				       tscal(j), tzero(j));
+	    break;
+	case FITS::DOUBLE:
+	    putScaledFieldBlock<Double>(full, name, ne, ptrs[j], startRow,
+					tscal(j), tzero(j));
+	    break;
+	case FITS::COMPLEX:
+	    putScaledFieldBlock<Complex>(full, name, ne, ptrs[j], startRow,
+					 tscal(j), tzero(j));
+	    break;
+	case FITS::DCOMPLEX:
+	    putScaledFieldBlock<DComplex>(full, name, ne, ptrs[j], startRow,
+					  tscal(j), tzero(j));
+	    break;
+	case FITS::CHAR:
+	case FITS::STRING:
+	    {
+		Vector<String> vec(nrow);
+		for (Int r=0; r<nrow; r++) {
+		    // look for the true end of the string
+		    const char* cptr = static_cast<const char*>(ptrs[j][r]);
+		    uInt length = field(j).nelements();
+		    while (length > 0 &&
+			   (cptr[length-1] == '\0' || cptr[length-1] == ' ')) {
+			length--;
+		    }
+		    vec(r) = String(cptr, length);
+		}
+		ScalarColumn<String>(full, name).putColumnRange
+		    (Slicer(IPosition(1, startRow), IPosition(1, nrow)), vec);
+	    }
+	    break;
+	default:
+	    throw AipsError("BinaryTable: unexpected field type in block copy");
+	}
+    }
+    //		the virtual columns are constant
+    for (uInt field=0; field<kwSet.nfields(); field++) {
+	TableColumn incol(*currRowTab, kwSet.name(field));
+	TableColumn outcol(full, kwSet.name(field));
+	for (Int r=0; r<nrow; r++) {
+	    outcol.put(startRow + r, incol, rownr_t(0));
+	}
+    }
 }
 
 
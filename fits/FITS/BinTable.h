@@ -175,6 +175,15 @@ private:
 
     // this is the function that fills each row in as needed
     void fillRow();
+
+    // Copy all rows from the current row on into the given table.
+    void fillTable (Table& full);
+
+    // Can rows be copied in blocks (i.e., no variable arrays or bit fields)?
+    Bool canFillBlocks() const;
+
+    // Copy a block of rows (already read) column by column into the table.
+    void fillBlock (Table& full, rownr_t startRow, Int nrow);
 };
 
 
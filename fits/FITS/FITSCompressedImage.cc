@@ -0,0 +1,384 @@
+//# FITSCompressedImage.cc: Access tile-compressed FITS images
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/fits/FITS/FITSCompressedImage.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+Int64 FITSCompressedImage::theirParallelSize = 1024*1024;
+
+
+FITSCompressedImage::FITSCompressedImage (const String& fileName,
+                                          uInt whichHDU)
+  : itsFileName (fileName),
+    itsHDU      (whichHDU),
+    itsFile     (0),
+    itsBitpix   (0)
+{
+  itsFile = openFile (fileName, whichHDU);
+  int status = 0;
+  if (fits_is_compressed_image (itsFile, &status) == 0) {
+    fits_close_file (itsFile, &status);
+    throw AipsError ("HDU " + String::toString(whichHDU) + " in FITS file " +
+                     fileName + " is not a compressed image");
+  }
+  // Get the properties of the uncompressed image.
+  int naxis;
+  fits_get_img_type (itsFile, &itsBitpix, &status);
+  fits_get_img_dim (itsFile, &naxis, &status);
+  checkStatus (status, "reading image parameters of " + fileName);
+  std::vector<LONGLONG> naxes(naxis);
+  fits_get_img_sizell (itsFile, naxis, naxes.data(), &status);
+  checkStatus (status, "reading image shape of " + fileName);
+  itsShape.resize (naxis);
+  itsTileShape.resize (naxis);
+  for (int i=0; i<naxis; ++i) {
+    itsShape[i] = naxes[i];
+    // Default tiles are rows of the image.
+    itsTileShape[i] = (i==0 ? naxes[0] : 1);
+    long tile;
+    String key = "ZTILE" + String::toString(i+1);
+    if (fits_read_key (itsFile, TLONG, key.chars(), &tile, 0, &status) == 0) {
+      itsTileShape[i] = tile;
+    } else if (status == KEY_NO_EXIST) {
+      status = 0;
+      fits_clear_errmsg();
+    }
+  }
+  checkStatus (status, "reading tile shape of " + fileName);
+  // Get the header of the uncompressed image.
+  char* header = 0;
+  int nkeys = 0;
+  fits_convert_hdr2str (itsFile, 0, 0, 0, &header, &nkeys, &status);
+  checkStatus (status, "reading header of " + fileName);
+  itsHeader.resize (nkeys);
+  for (int i=0; i<nkeys; ++i) {
+    itsHeader[i] = String(header + 80*i, 80);
+  }
+  fits_free_memory (header, &status);
+}
+
+FITSCompressedImage::~FITSCompressedImage()
+{
+  int status = 0;
+  fits_close_file (itsFile, &status);
+}
+
+Bool FITSCompressedImage::isCompressed (const String& fileName,
+                                        uInt whichHDU)
+{
+  fitsfile* file;
+  int status = 0;
+  if (fits_open_diskfile (&file, fileName.chars(), READONLY, &status) != 0) {
+    fits_clear_errmsg();
+    return False;
+  }
+  int hduType;
+  Bool compressed = (fits_movabs_hdu (file, whichHDU+1, &hduType,
+                                      &status) == 0  &&
+                     fits_is_compressed_image (file, &status) != 0);
+  status = 0;
+  fits_close_file (file, &status);
+  fits_clear_errmsg();
+  return compressed;
+}
+
+void FITSCompressedImage::setParallelSize (Int64 nrPixels)
+{
+  theirParallelSize = nrPixels;
+}
+
+Int64 FITSCompressedImage::parallelSize()
+{
+  return theirParallelSize;
+}
+
+fitsfile* FITSCompressedImage::openFile (const String& fileName,
+                                         uInt whichHDU)
+{
+  fitsfile* file;
+  int status = 0;
+  fits_open_diskfile (&file, fileName.chars(), READONLY, &status);
+  checkStatus (status, "opening FITS file " + fileName);
+  int hduType;
+  fits_movabs_hdu (file, whichHDU+1, &hduType, &status);
+  if (status != 0) {
+    int st = 0;
+    fits_close_file (file, &st);
+    checkStatus (status, "moving to HDU " + String::toString(whichHDU) +
+                 " in FITS file " + fileName);
+  }
+  return file;
+}
+
+void FITSCompressedImage::checkStatus (int status, const String& message)
+{
+  if (status != 0) {
+    char text[FLEN_STATUS];
+    fits_get_errstatus (status, text);
+    fits_clear_errmsg();
+    throw AipsError ("FITSCompressedImage: error " + message + ": " +
+                     String(text));
+  }
+}
+
+void FITSCompressedImage::readPart (fitsfile* file, const IPosition& start,
+                                    const IPosition& length,
+                                    const IPosition& stride,
+                                    uInt axis, Int64 from, Int64 to,
+                                    Float* data) const
+{
+  // cfitsio uses 1-relative inclusive pixel ranges.
+  uInt ndim = start.size();
+  std::vector<long> fpixel(ndim), lpixel(ndim), inc(ndim);
+  for (uInt i=0; i<ndim; ++i) {
+    fpixel[i] = start[i] + 1;
+    lpixel[i] = start[i] + (length[i] - 1) * stride[i] + 1;
+    inc[i]    = stride[i];
+  }
+  fpixel[axis] = start[axis] + from * stride[axis] + 1;
+  lpixel[axis] = start[axis] + (to - 1) * stride[axis] + 1;
+  Float nullValue = std::numeric_limits<Float>::quiet_NaN();
+  int anyNull;
+  int status = 0;
+  fits_read_subset (file, TFLOAT, fpixel.data(), lpixel.data(), inc.data(),
+                    &nullValue, data, &anyNull, &status);
+  checkStatus (status, "reading data from " + itsFileName);
+}
+
+void FITSCompressedImage::get (Array<Float>& buffer, const Slicer& section)
+{
+  const IPosition& start  = section.start();
+  const IPosition& length = section.length();
+  const IPosition& stride = section.stride();
+  buffer.resize (length);
+  // The section is split along its outermost axis at tile boundaries.
+  uInt axis = length.size() - 1;
+  while (axis > 0  &&  length[axis] == 1) {
+    --axis;
+  }
+  Int64 nrPerIndex = 1;
+  for (uInt i=0; i<axis; ++i) {
+    nrPerIndex *= length[i];
+  }
+  std::vector<Int64> bounds(1, 0);
+  uInt nthread = OMP::maxThreads();
+  if (nthread > 1  &&  length.product() >= theirParallelSize  &&
+      fits_is_reentrant()) {
+    Int64 tile = itsTileShape[axis];
+    Int64 firstTile = start[axis] / tile;
+    Int64 lastTile = (start[axis] + (length[axis] - 1) * stride[axis]) / tile;
+    Int64 ntile = lastTile - firstTile + 1;
+    Int64 nparts = std::min (ntile, Int64(4*nthread));
+    for (Int64 p=1; p<nparts; ++p) {
+      // Find the first index at or after the tile boundary.
+      Int64 pos = (firstTile + p*ntile/nparts) * tile;
+      Int64 inx = (pos - start[axis] + stride[axis] - 1) / stride[axis];
+      if (inx > bounds.back()  &&  inx < length[axis]) {
+        bounds.push_back (inx);
+      }
+    }
+  }
+  bounds.push_back (length[axis]);
+  Int64 nparts = bounds.size() - 1;
+  Bool deleteIt;
+  Float* data = buffer.getStorage (deleteIt);
+  if (nparts == 1) {
+    try {
+      readPart (itsFile, start, length, stride, axis, 0, length[axis], data);
+    } catch (...) {
+      buffer.putStorage (data, deleteIt);
+      throw;
+    }
+  } else {
+    // Each thread uses its own file handle.
+    std::exception_ptr error;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      fitsfile* file = 0;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (Int64 p=0; p<nparts; ++p) {
+        try {
+          if (! file) {
+            file = openFile (itsFileName, itsHDU);
+          }
+          readPart (file, start, length, stride, axis,
+                    bounds[p], bounds[p+1], data + bounds[p]*nrPerIndex);
+        } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(FITSCompressedImage_get)
+#endif
+          {
+            if (! error) {
+              error = std::current_exception();
+            }
+          }
+        }
+      }
+      if (file) {
+        int status = 0;
+        fits_close_file (file, &status);
+      }
+    }
+    if (error) {
+      buffer.putStorage (data, deleteIt);
+      std::rethrow_exception (error);
+    }
+  }
+  buffer.putStorage (data, deleteIt);
+}
+
+
+FITSCompressedImageWriter::FITSCompressedImageWriter
+(const String& fileName, const IPosition& shape, const Vector<String>& header,
+ const String& compression, const IPosition& tileShape, Float quantizeLevel)
+  : itsFile  (0),
+    itsShape (shape)
+{
+  String comp(compression);
+  comp.upcase();
+  int compType;
+  if (comp == "RICE") {
+    compType = RICE_1;
+  } else if (comp == "GZIP") {
+    compType = GZIP_1;
+  } else if (comp == "GZIP2") {
+    compType = GZIP_2;
+  } else if (comp == "HCOMPRESS") {
+    compType = HCOMPRESS_1;
+  } else if (comp == "PLIO") {
+    compType = PLIO_1;
+  } else {
+    throw AipsError ("FITSCompressedImageWriter: unknown compression type " +
+                     compression);
+  }
+  // Only GZIP can compress floating point values losslessly.
+  if (quantizeLevel <= 0  &&  compType != GZIP_1  &&  compType != GZIP_2) {
+    throw AipsError ("FITSCompressedImageWriter: " + compression +
+                     " compression needs a positive quantize level");
+  }
+  if (! (tileShape.empty()  ||  tileShape.size() == shape.size())) {
+    throw AipsError ("FITSCompressedImageWriter: tile shape and image shape "
+                     "differ in length");
+  }
+  int status = 0;
+  fits_create_diskfile (&itsFile, fileName.chars(), &status);
+  if (status != 0) {
+    char text[FLEN_STATUS];
+    fits_get_errstatus (status, text);
+    fits_clear_errmsg();
+    throw AipsError ("FITSCompressedImageWriter: cannot create " + fileName +
+                     ": " + String(text));
+  }
+  // Write an empty primary array, followed by the compressed image.
+  fits_create_img (itsFile, BYTE_IMG, 0, 0, &status);
+  fits_set_compression_type (itsFile, compType, &status);
+  if (! tileShape.empty()) {
+    std::vector<long> tiles(tileShape.begin(), tileShape.end());
+    fits_set_tile_dim (itsFile, tiles.size(), tiles.data(), &status);
+  }
+  fits_set_quantize_level (itsFile, quantizeLevel, &status);
+  std::vector<LONGLONG> naxes(shape.begin(), shape.end());
+  fits_create_imgll (itsFile, FLOAT_IMG, naxes.size(), naxes.data(), &status);
+  // Copy the non-structural keywords.
+  for (uInt i=0; i<header.size()  &&  status==0; ++i) {
+    String name = header[i].before(8 < header[i].size() ? 8 : 0);
+    name.trim();
+    if (name.empty()  ||  name == "SIMPLE"  ||  name == "BITPIX"  ||
+        name.startsWith("NAXIS")  ||  name == "EXTEND"  ||
+        name == "XTENSION"  ||  name == "PCOUNT"  ||  name == "GCOUNT"  ||
+        name == "BSCALE"  ||  name == "BZERO"  ||  name == "BLANK"  ||
+        name == "END") {
+      continue;
+    }
+    fits_write_record (itsFile, header[i].chars(), &status);
+  }
+  if (status != 0) {
+    char text[FLEN_STATUS];
+    fits_get_errstatus (status, text);
+    fits_clear_errmsg();
+    close();
+    throw AipsError ("FITSCompressedImageWriter: error creating image in " +
+                     fileName + ": " + String(text));
+  }
+}
+
+FITSCompressedImageWriter::~FITSCompressedImageWriter()
+{
+  close();
+}
+
+void FITSCompressedImageWriter::close()
+{
+  if (itsFile) {
+    int status = 0;
+    fits_close_file (itsFile, &status);
+    itsFile = 0;
+  }
+}
+
+void FITSCompressedImageWriter::put (const Array<Float>& data,
+                                     const IPosition& blc)
+{
+  AlwaysAssert (itsFile != 0, AipsError);
+  uInt ndim = itsShape.size();
+  if (data.ndim() != ndim  ||  blc.size() != ndim) {
+    throw AipsError ("FITSCompressedImageWriter::put: data or blc has "
+                     "invalid dimensionality");
+  }
+  std::vector<long> fpixel(ndim), lpixel(ndim);
+  for (uInt i=0; i<ndim; ++i) {
+    fpixel[i] = blc[i] + 1;
+    lpixel[i] = blc[i] + data.shape()[i];
+  }
+  Bool deleteIt;
+  const Float* ptr = data.getStorage (deleteIt);
+  int status = 0;
+  fits_write_subset (itsFile, TFLOAT, fpixel.data(), lpixel.data(),
+                     const_cast<Float*>(ptr), &status);
+  data.freeStorage (ptr, deleteIt);
+  if (status != 0) {
+    char text[FLEN_STATUS];
+    fits_get_errstatus (status, text);
+    fits_clear_errmsg();
+    throw AipsError ("FITSCompressedImageWriter: error writing data: " +
+                     String(text));
+  }
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,208 @@
+//# FITSCompressedImage.h: Access tile-compressed FITS images
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef FITS_FITSCOMPRESSEDIMAGE_H
+#define FITS_FITSCOMPRESSEDIMAGE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <fitsio.h>  //# header file from cfitsio
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+class Slicer;
+
+
+// <summary>
+// Read a tile-compressed FITS image.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tFITSCompressedImage">
+// </reviewed>
+
+// <prerequisite>
+//   <li> The FITS tiled image compression convention
+// </prerequisite>
+
+// <synopsis>
+// A tile-compressed FITS image is stored as a binary table (with keyword
+// ZIMAGE=T) in which each row holds a compressed tile of the image
+// (using e.g. Rice, GZIP or HCOMPRESS compression).
+// This class uses cfitsio to decompress the tiles. It gives access to the
+// header of the uncompressed image and to sections of the image data
+// as Floats, where the data are scaled (BSCALE, BZERO) and blanked
+// pixels are set to NaN.
+//
+// Only the tiles overlapping a section are decompressed. A large section
+// is split at tile boundaries and the parts are decompressed in parallel,
+// each using its own cfitsio file handle. That is only done if cfitsio is
+// built thread-safe (see <src>fits_is_reentrant</src>).
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   FITSCompressedImage image("survey.fits", 1);
+//   Array<Float> plane;
+//   image.get (plane, Slicer(IPosition(3,0,0,10),
+//                            IPosition(3,image.shape()[0],image.shape()[1],1)));
+// </srcblock>
+// </example>
+
+class FITSCompressedImage
+{
+public:
+  // Open the compressed image in the given HDU (0 is the primary HDU).
+  // An exception is thrown if the HDU is not a compressed image.
+  FITSCompressedImage (const String& fileName, uInt whichHDU);
+
+  ~FITSCompressedImage();
+
+  // Copying is not possible.
+  // <group>
+  FITSCompressedImage (const FITSCompressedImage&) = delete;
+  FITSCompressedImage& operator= (const FITSCompressedImage&) = delete;
+  // </group>
+
+  // Test if the given HDU in the file contains a compressed image.
+  static Bool isCompressed (const String& fileName, uInt whichHDU);
+
+  // Get the shape of the image.
+  const IPosition& shape() const
+    { return itsShape; }
+
+  // Get the shape of the compression tiles.
+  const IPosition& tileShape() const
+    { return itsTileShape; }
+
+  // Get BITPIX of the uncompressed image.
+  Int bitpix() const
+    { return itsBitpix; }
+
+  // Get the header cards (of 80 characters) of the uncompressed image.
+  const Vector<String>& header() const
+    { return itsHeader; }
+
+  // Get a section of the image. The data are scaled and blanked
+  // pixels are set to NaN.
+  void get (Array<Float>& buffer, const Slicer& section);
+
+  // Set or get the minimum number of pixels in a section for which
+  // tiles are decompressed in parallel. The default is 1048576.
+  // <group>
+  static void setParallelSize (Int64 nrPixels);
+  static Int64 parallelSize();
+  // </group>
+
+private:
+  // Open the file and move to the HDU.
+  static fitsfile* openFile (const String& fileName, uInt whichHDU);
+
+  // Throw an exception if the cfitsio status is not 0.
+  static void checkStatus (int status, const String& message);
+
+  // Read the part [from,to) of the section along the given axis.
+  void readPart (fitsfile* file, const IPosition& start,
+                 const IPosition& length, const IPosition& stride,
+                 uInt axis, Int64 from, Int64 to, Float* data) const;
+
+  String         itsFileName;
+  uInt           itsHDU;
+  fitsfile*      itsFile;
+  IPosition      itsShape;
+  IPosition      itsTileShape;
+  Int            itsBitpix;
+  Vector<String> itsHeader;
+  static Int64   theirParallelSize;
+};
+
+
+// <summary>
+// Write a tile-compressed FITS image.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tFITSCompressedImage">
+// </reviewed>
+
+// <synopsis>
+// This class creates a FITS file with an empty primary array and a
+// tile-compressed image extension holding 32-bit floating point data.
+// The compression type can be RICE, GZIP, GZIP2, HCOMPRESS or PLIO.
+// By default floating point values are compressed losslessly, which is
+// only possible with GZIP or GZIP2. A positive quantize level (as used by
+// cfitsio) quantizes the values to integers before compressing, which is
+// lossy but gives much better compression. It is required for the other
+// compression types.
+//
+// The data should be written in sections containing whole tiles, otherwise
+// cfitsio has to recompress tiles. The default tile shape is a row of the
+// image.
+// </synopsis>
+
+class FITSCompressedImageWriter
+{
+public:
+  // Create the file with the given image shape and header cards
+  // (structural keywords in the header are ignored).
+  // An exception is thrown if the file already exists.
+  FITSCompressedImageWriter (const String& fileName, const IPosition& shape,
+                             const Vector<String>& header,
+                             const String& compression = "GZIP",
+                             const IPosition& tileShape = IPosition(),
+                             Float quantizeLevel = 0);
+
+  // The destructor closes the file.
+  ~FITSCompressedImageWriter();
+
+  // Copying is not possible.
+  // <group>
+  FITSCompressedImageWriter (const FITSCompressedImageWriter&) = delete;
+  FITSCompressedImageWriter& operator= (const FITSCompressedImageWriter&)
+    = delete;
+  // </group>
+
+  // Write the data starting at the given position.
+  void put (const Array<Float>& data, const IPosition& blc);
+
+  // Flush and close the file. It is done by the destructor if not
+  // done explicitly.
+  void close();
+
+private:
+  fitsfile* itsFile;
+  IPosition itsShape;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,157 @@
+//# tFITSCompressedImage.cc: Test program for FITSCompressedImage
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/fits/FITS/FITSCompressedImage.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <cmath>
+#include <limits>
+
+#include <casacore/casa/namespace.h>
+
+Array<Float> makeData (const IPosition& shape)
+{
+  Array<Float> data(shape);
+  indgen (data);
+  data = sin(data * Float(0.01)) * Float(100);
+  // Add a blanked pixel.
+  data(IPosition(3,1,2,3)) = std::numeric_limits<Float>::quiet_NaN();
+  return data;
+}
+
+void writeImage (const String& name, const Array<Float>& data,
+                 const String& compression, Float quantizeLevel)
+{
+  File file(name);
+  if (file.exists()) {
+    RegularFile(name).remove();
+  }
+  Vector<String> header(2);
+  header[0] = "BUNIT   = 'Jy/beam '";
+  header[1] = "OBJECT  = 'test    '";
+  IPosition shape = data.shape();
+  IPosition tileShape(3, shape[0], 4, 1);
+  FITSCompressedImageWriter writer(name, shape, header, compression,
+                                   tileShape, quantizeLevel);
+  // Write per plane.
+  for (Int i=0; i<shape[2]; ++i) {
+    IPosition blc(3, 0, 0, i);
+    IPosition trc(3, shape[0]-1, shape[1]-1, i);
+    writer.put (data(blc, trc), blc);
+  }
+  writer.close();
+}
+
+// Compare values, where NaNs have to match.
+Bool compare (const Array<Float>& result, const Array<Float>& expected,
+              Float tolerance)
+{
+  if (! result.shape().isEqual (expected.shape())) {
+    return False;
+  }
+  Array<Float>::const_iterator iter2 = expected.begin();
+  for (Array<Float>::const_iterator iter1 = result.begin();
+       iter1 != result.end(); ++iter1, ++iter2) {
+    if (std::isnan(*iter1)  ||  std::isnan(*iter2)) {
+      if (! (std::isnan(*iter1)  &&  std::isnan(*iter2))) {
+        return False;
+      }
+    } else if (std::abs(*iter1 - *iter2) > tolerance) {
+      return False;
+    }
+  }
+  return True;
+}
+
+void checkImage (const String& name, const Array<Float>& data,
+                 Float tolerance)
+{
+  AlwaysAssertExit (FITSCompressedImage::isCompressed (name, 1));
+  AlwaysAssertExit (! FITSCompressedImage::isCompressed (name, 0));
+  FITSCompressedImage image(name, 1);
+  AlwaysAssertExit (image.shape().isEqual (data.shape()));
+  AlwaysAssertExit (image.tileShape().isEqual
+                    (IPosition(3, data.shape()[0], 4, 1)));
+  AlwaysAssertExit (image.bitpix() == -32);
+  Bool found = False;
+  for (uInt i=0; i<image.header().size(); ++i) {
+    if (image.header()[i].startsWith ("BUNIT   = 'Jy/beam '")) {
+      found = True;
+    }
+  }
+  AlwaysAssertExit (found);
+  // Read sequentially and in parallel.
+  for (Int64 parallelSize : {Int64(1024*1024), Int64(1)}) {
+    FITSCompressedImage::setParallelSize (parallelSize);
+    Array<Float> result;
+    image.get (result, Slicer(IPosition(3,0), data.shape()));
+    AlwaysAssertExit (compare (result, data, tolerance));
+    // Read a strided section not aligned with the tiles.
+    Slicer section(IPosition(3,1,1,1), IPosition(3,10,9,3),
+                   IPosition(3,2,3,1));
+    image.get (result, section);
+    AlwaysAssertExit (compare (result, data(section), tolerance));
+    // Read a single row.
+    Slicer row(IPosition(3,0,5,2), IPosition(3,data.shape()[0],1,1));
+    image.get (result, row);
+    AlwaysAssertExit (compare (result, data(row), tolerance));
+  }
+  FITSCompressedImage::setParallelSize (1024*1024);
+}
+
+int main()
+{
+  try {
+    Array<Float> data = makeData (IPosition(3, 32, 24, 5));
+    // Lossless compression.
+    writeImage ("tFITSCompressedImage_tmp.fits", data, "GZIP", 0);
+    checkImage ("tFITSCompressedImage_tmp.fits", data, 0);
+    // Quantized compression; the quantization step is noise/level.
+    writeImage ("tFITSCompressedImage_tmp.fits", data, "RICE", 16);
+    checkImage ("tFITSCompressedImage_tmp.fits", data, 10);
+    // Lossless Rice compression of floats is not possible.
+    Bool failed = False;
+    try {
+      writeImage ("tFITSCompressedImage_tmp.fits", data, "RICE", 0);
+    } catch (const AipsError&) {
+      failed = True;
+    }
+    AlwaysAssertExit (failed);
+    AlwaysAssertExit (! File("tFITSCompressedImage_tmp.fits").exists());
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
@@ -29,6 +29,7 @@
 #include <casacore/fits/FITS/hdu.h>
 #include <casacore/fits/FITS/fitsio.h>
 #include <casacore/fits/FITS/FITSKeywordUtil.h>
+#include <casacore/fits/FITS/FITSCompressedImage.h>
 #include <casacore/images/Images/ImageInfo.h>
 #include <casacore/images/Images/ImageFITSConverter.h>
 #include <casacore/images/Images/MaskSpecifier.h>
@@ -43,22 +44,68 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/tables/LogTables/LoggerHolder.h>
 #include <casacore/casa/Logging/LogIO.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/CanonicalConversion.h>
+#include <casacore/casa/IO/FiledesIO.h>
 #include <casacore/casa/Quanta/Unit.h>
 #include <casacore/casa/Utilities/ValType.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Exceptions/Error.h>
 
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <vector>
 
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// The pixel mask of a tile-compressed image. Blanked pixels are returned
+// as NaN by cfitsio, so NaNs (and optionally zeroes) are masked.
+class FITSCompressedMask : public Lattice<Bool>
+{
+public:
+  explicit FITSCompressedMask (FITSCompressedImage* image)
+    : itsImage (image),
+      itsFilterZero (False)
+  {}
+  virtual Lattice<Bool>* clone() const
+    { return new FITSCompressedMask (*this); }
+  virtual Bool isWritable() const
+    { return False; }
+  virtual IPosition shape() const
+    { return itsImage->shape(); }
+  virtual Bool doGetSlice (Array<Bool>& mask, const Slicer& section)
+  {
+    Array<Float> data;
+    itsImage->get (data, section);
+    mask.resize (data.shape());
+    if (itsFilterZero) {
+      mask = !isNaN(data) && data != Float(0);
+    } else {
+      mask = !isNaN(data);
+    }
+    return False;
+  }
+  virtual void doPutSlice (const Array<Bool>&, const IPosition&,
+                           const IPosition&)
+    { throw AipsError ("FITSCompressedMask object is not writable"); }
+  void setFilterZero (Bool filterZero)
+    { itsFilterZero = filterZero; }
+private:
+  FITSCompressedImage* itsImage;
+  Bool itsFilterZero;
+};
+
+
 FITSImage::FITSImage (const String& name, uInt whichRep, uInt whichHDU)
 : ImageInterface<Float>(),
   name_p      (name),
@@ -72,6 +119,7 @@ FITSImage::FITSImage (const String& name, uInt whichRep, uInt whichHDU)
   dataType_p  (TpOther),
   fileOffset_p(0),
   isClosed_p  (True),
+  isCompressed_p (False),
   filterZeroMask_p(False),
   whichRep_p(whichRep),
   whichHDU_p(whichHDU),
@@ -94,6 +142,7 @@ FITSImage::FITSImage (const String& name, const MaskSpecifier& maskSpec, uInt wh
   dataType_p  (TpOther),
   fileOffset_p(0),
   isClosed_p  (True),
+  isCompressed_p (False),
   filterZeroMask_p(False),
   whichRep_p(whichRep),
   whichHDU_p(whichHDU),
@@ -108,6 +157,7 @@ FITSImage::FITSImage (const FITSImage& other)
   fullname_p  (other.fullname_p),
   maskSpec_p  (other.maskSpec_p),
   pTiledFile_p(other.pTiledFile_p),
+  pCompressed_p(other.pCompressed_p),
   shape_p     (other.shape_p),
   scale_p     (other.scale_p),
   offset_p    (other.offset_p),
@@ -118,6 +168,7 @@ FITSImage::FITSImage (const FITSImage& other)
   dataType_p  (other.dataType_p),
   fileOffset_p(other.fileOffset_p),
   isClosed_p  (other.isClosed_p),
+  isCompressed_p (other.isCompressed_p),
   filterZeroMask_p(other.filterZeroMask_p),
   whichRep_p(other.whichRep_p),
   whichHDU_p(other.whichHDU_p),
@@ -138,6 +189,7 @@ FITSImage& FITSImage::operator=(const FITSImage& other)
       ImageInterface<Float>::operator= (other);
 //
       pTiledFile_p = other.pTiledFile_p;             // shared pointer
+      pCompressed_p = other.pCompressed_p;           // shared pointer
 //
       pPixelMask_p.reset();
       if (other.pPixelMask_p) {
@@ -157,6 +209,7 @@ FITSImage& FITSImage::operator=(const FITSImage& other)
       dataType_p  = other.dataType_p;
       fileOffset_p= other.fileOffset_p;
       isClosed_p  = other.isClosed_p;
+      isCompressed_p = other.isCompressed_p;
       filterZeroMask_p = other.filterZeroMask_p;
       whichRep_p = other.whichRep_p;
       whichHDU_p = other.whichHDU_p;
@@ -335,6 +388,18 @@ String FITSImage::className()
     return x;
 }
 
+std::atomic<Int64> FITSImage::theirDirectReadSize (1024*1024);
+
+void FITSImage::setDirectReadSize (Int64 nrPixels)
+{
+    theirDirectReadSize = nrPixels;
+}
+
+Int64 FITSImage::directReadSize()
+{
+    return theirDirectReadSize;
+}
+
 Bool FITSImage::isMasked() const
 {
    return hasBlanks_p;
@@ -365,10 +430,143 @@ void FITSImage::resize(const TiledShape&)
    throw (AipsError ("FITSImage::resize - a FITSImage is not writable"));
 }
 
+// Convert a block of big-endian FITS values to scaled Floats.
+// The loops are kept simple, so the compiler can vectorize them.
+template<typename T>
+void convertFITSBlock (Float* out, const char* raw, std::vector<T>& tmp,
+                       size_t n, Float scale, Float offset,
+                       T blank, Bool checkBlank)
+{
+   tmp.resize (n);
+   CanonicalConversion::toLocal (tmp.data(), raw, n);
+   const T* in = tmp.data();
+   if (checkBlank) {
+      const Float nan = std::numeric_limits<Float>::quiet_NaN();
+      for (size_t i=0; i<n; ++i) {
+         out[i] = (in[i] == blank  ?  nan : in[i] * scale + offset);
+      }
+   } else {
+      for (size_t i=0; i<n; ++i) {
+         out[i] = in[i] * scale + offset;
+      }
+   }
+}
+
+void FITSImage::getSliceDirect (Array<Float>& buffer,
+                                const Slicer& section) const
+{
+// FITS data are stored contiguously in the file (the tile shape used by
+// TiledFileAccess is a contiguous part as well). Determine the length of
+// the contiguous runs of pixels in the section; they are split in blocks
+// which are read and converted in parallel.
+
+   const IPosition& shape = shape_p.shape();
+   const IPosition& start = section.start();
+   const IPosition& length = section.length();
+   const uInt ndim = shape.size();
+   uInt runAxes = 1;
+   Int64 runLength = length[0];
+   while (runAxes < ndim  &&  length[runAxes-1] == shape[runAxes-1]) {
+      runLength *= length[runAxes];
+      ++runAxes;
+   }
+   buffer.resize (length);
+   const Int64 nrun = length.product() / runLength;
+   const Int64 blockSize = 1024*1024;
+   const Int64 nblockPerRun = (runLength + blockSize - 1) / blockSize;
+   const Int64 nblock = nrun * nblockPerRun;
+   const Int64 elemSize = ValType::getCanonicalSize (dataType_p);
+   Bool deleteIt;
+   Float* out = buffer.getStorage (deleteIt);
+   int fd = FiledesIO::open (name_p.chars());
+   FiledesIO file(fd, name_p);
+   std::exception_ptr error;
+#ifdef _OPENMP
+#pragma omp parallel if (nblock > 1)
+#endif
+   {
+      std::vector<char> raw;
+      std::vector<uChar> tmpUChar;
+      std::vector<Short> tmpShort;
+      std::vector<Int> tmpInt;
+      std::vector<Double> tmpDouble;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (Int64 block=0; block<nblock; ++block) {
+         try {
+            // Find the file position of the first pixel of the block.
+            Int64 run = block / nblockPerRun;
+            Int64 first = (block % nblockPerRun) * blockSize;
+            Int64 n = std::min (blockSize, runLength - first);
+            Int64 rest = run;
+            Int64 fileInx = 0;
+            Int64 fileStep = 1;
+            for (uInt i=0; i<ndim; ++i) {
+               Int64 pos = start[i];
+               if (i >= runAxes) {
+                  pos += rest % length[i];
+                  rest /= length[i];
+               }
+               fileInx += pos * fileStep;
+               fileStep *= shape[i];
+            }
+            fileInx += first;
+            raw.resize (n * elemSize);
+            file.pread (n * elemSize, fileOffset_p + fileInx * elemSize,
+                        raw.data());
+            Float* blockOut = out + run * runLength + first;
+            if (dataType_p == TpFloat) {
+               CanonicalConversion::toLocal (blockOut, raw.data(), n);
+            } else if (dataType_p == TpDouble) {
+               convertFITSBlock (blockOut, raw.data(), tmpDouble, n,
+                                 1.0f, 0.0f, 0.0, False);
+            } else if (dataType_p == TpInt) {
+               convertFITSBlock (blockOut, raw.data(), tmpInt, n,
+                                 scale_p, offset_p, longMagic_p, hasBlanks_p);
+            } else if (dataType_p == TpShort) {
+               convertFITSBlock (blockOut, raw.data(), tmpShort, n,
+                                 scale_p, offset_p, shortMagic_p,
+                                 hasBlanks_p);
+            } else {
+               convertFITSBlock (blockOut, raw.data(), tmpUChar, n,
+                                 scale_p, offset_p, uCharMagic_p,
+                                 hasBlanks_p);
+            }
+         } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(FITSImage_getSliceDirect)
+#endif
+            {
+               if (! error) {
+                  error = std::current_exception();
+               }
+            }
+         }
+      }
+   }
+   FiledesIO::close (fd);
+   buffer.putStorage (out, deleteIt);
+   if (error) {
+      std::rethrow_exception (error);
+   }
+}
+
 Bool FITSImage::doGetSlice(Array<Float>& buffer,
                            const Slicer& section)
 {
    reopenIfNeeded();
+// Tile-compressed images are decompressed by cfitsio.
+   if (pCompressed_p) {
+      pCompressed_p->get (buffer, section);
+      return False;
+   }
+// Large sections are read directly from the file using multiple threads.
+   if (section.length().product() >= theirDirectReadSize  &&
+       section.stride().allOne()) {
+      getSliceDirect (buffer, section);
+      return False;
+   }
    if (pTiledFile_p->dataType() == TpFloat) {
       pTiledFile_p->get (buffer, section);
    } else if (pTiledFile_p->dataType() == TpDouble) {
@@ -478,6 +676,7 @@ void FITSImage::tempClose()
    if (! isClosed_p) {
       pPixelMask_p.reset();
       pTiledFile_p.reset();
+      pCompressed_p.reset();
       isClosed_p = True;
    }
 }
@@ -492,12 +691,18 @@ void FITSImage::reopen()
 uInt FITSImage::maximumCacheSize() const
 {
    reopenIfNeeded();
+   if (! pTiledFile_p) {
+      return 0;
+   }
    return pTiledFile_p->maximumCacheSize() / ValType::getTypeSize(dataType_p);
 }
 
 void FITSImage::setMaximumCacheSize (uInt howManyPixels)
 {
    reopenIfNeeded();
+   if (! pTiledFile_p) {
+      return;
+   }
    const uInt sizeInBytes = howManyPixels * ValType::getTypeSize(dataType_p);
    pTiledFile_p->setMaximumCacheSize (sizeInBytes);
 }
@@ -508,6 +713,9 @@ void FITSImage::setCacheSizeFromPath (const IPosition& sliceShape,
 				      const IPosition& axisPath)
 {
    reopenIfNeeded();
+   if (! pTiledFile_p) {
+      return;
+   }
    pTiledFile_p->setCacheSize (sliceShape, windowStart,
 			       windowLength, axisPath);
 }
@@ -515,13 +723,15 @@ void FITSImage::setCacheSizeFromPath (const IPosition& sliceShape,
 void FITSImage::setCacheSizeInTiles (uInt howManyTiles)  
 {  
    reopenIfNeeded();
-   pTiledFile_p->setCacheSize (howManyTiles);
+   if (pTiledFile_p) {
+      pTiledFile_p->setCacheSize (howManyTiles);
+   }
 }
 
 
 void FITSImage::clearCache()
 {
-   if (! isClosed_p) {
+   if (! isClosed_p  &&  pTiledFile_p) {
       pTiledFile_p->clearCache();
    }
 }
@@ -530,7 +740,11 @@ void FITSImage::showCacheStatistics (ostream& os) const
 {
    reopenIfNeeded();
    os << "FITSImage statistics : ";
-   pTiledFile_p->showCacheStatistics (os);
+   if (pTiledFile_p) {
+      pTiledFile_p->showCacheStatistics (os);
+   } else {
+      os << "tile-compressed image is not cached" << endl;
+   }
 }
 
 
@@ -594,7 +808,12 @@ void FITSImage::setup()
 		      uCharMagic_p, shortMagic_p,
                       longMagic_p, hasBlanks_p, fullName,  whichRep_p, whichHDU_p);
    // shape must be set before image info in cases of multiple beams
-   shape_p = TiledShape (shape, TiledFileAccess::makeTileShape(shape));
+   // A compressed image is best accessed per compression tile.
+   if (isCompressed_p) {
+      shape_p = TiledShape (shape, pCompressed_p->tileShape());
+   } else {
+      shape_p = TiledShape (shape, TiledFileAccess::makeTileShape(shape));
+   }
    setMiscInfoMember (miscInfo);
 
 // set ImageInterface data
@@ -657,6 +876,19 @@ void FITSImage::setup()
 
 void FITSImage::open()
 {
+   if (isCompressed_p) {
+      if (! pCompressed_p) {
+         pCompressed_p = std::make_shared<FITSCompressedImage>(name_p,
+                                                               whichHDU_p);
+      }
+      if (hasBlanks_p) {
+         FITSCompressedMask* mask = new FITSCompressedMask(pCompressed_p.get());
+         mask->setFilterZero (filterZeroMask_p);
+         pPixelMask_p.reset (mask);
+      }
+      isClosed_p = False;
+      return;
+   }
    Bool writable = False;
    Bool canonical = True;    
 
@@ -740,6 +972,21 @@ void FITSImage::getImageAttributes (CoordinateSystem& cSys,
         fileOffset_p += infile.getskipsize();
     }
 
+// A tile-compressed image is stored in a binary table. Its header and
+// data are read using cfitsio.
+    if (infile.rectype() == FITS::HDURecord  &&
+        infile.hdutype() == FITS::BinaryTableHDU  &&
+        FITSCompressedImage::isCompressed (name, whichHDU)) {
+       isCompressed_p = True;
+       pCompressed_p = std::make_shared<FITSCompressedImage>(name, whichHDU);
+       crackCompressedHeader (cSys, shape, imageInfo, brightnessUnit,
+                              miscInfo, dataType, hasBlanks, os, whichRep);
+       scale = 1;
+       offset = 0;
+       recordnumber = infile.recno();
+       return;
+    }
+
 // Check type
 	dataType = infile.datatype();
 	if (dataType != FITS::FLOAT &&
@@ -823,12 +1070,115 @@ void FITSImage::getImageAttributes (CoordinateSystem& cSys,
     recordnumber = infile.recno();
 }
 
+void FITSImage::crackCompressedHeader (CoordinateSystem& cSys,
+                                       IPosition& shape, ImageInfo& imageInfo,
+                                       Unit& brightnessUnit,
+                                       RecordInterface& miscInfo,
+                                       FITS::ValueType& dataType,
+                                       Bool& hasBlanks, LogIO& os,
+                                       uInt whichRep)
+{
+// Shape and header of the uncompressed image
+
+    shape = pCompressed_p->shape();
+    const Vector<String>& header = pCompressed_p->header();
+
+// Get Coordinate System.  Return un-used FITS cards in a Record for further use.
+
+    Record headerRec;
+    Bool dropStokes = True;
+    Int stokesFITSValue = 1;
+    cSys = ImageFITSConverter::getCoordinateSystem(stokesFITSValue, headerRec, header,
+                                                   os, whichRep, shape, dropStokes);
+    _hasBeamsTable = headerRec.isDefined(ImageFITSConverter::CASAMBM)
+      && headerRec.asRecord(ImageFITSConverter::CASAMBM).asBool("value");
+
+// BITPIX
+
+    switch (pCompressed_p->bitpix()) {
+    case 8:
+       dataType = FITS::BYTE;
+       break;
+    case 16:
+       dataType = FITS::SHORT;
+       break;
+    case 32:
+       dataType = FITS::LONG;
+       break;
+    case -32:
+       dataType = FITS::FLOAT;
+       break;
+    case -64:
+       dataType = FITS::DOUBLE;
+       break;
+    default:
+       throw AipsError("Compressed FITS image should contain float, double, "
+                       "byte, short or long data");
+    }
+
+// Scaling and blanking are applied by cfitsio which returns blanked
+// pixels as NaN, thus a mask can always be present.
+
+    hasBlanks = True;
+    Vector<String> ignore(13);
+    ignore(0) = "^datamax$";
+    ignore(1) = "^datamin$";
+    ignore(2) = "^origin$";
+    ignore(3) = "^extend$";
+    ignore(4) = "^blocked$";
+    ignore(5) = "^blank$";
+    ignore(6) = "^simple$";
+    ignore(7) = "bscale";
+    ignore(8) = "bzero";
+    ignore(9) = "xtension";
+    ignore(10) = "pcount";
+    ignore(11) = "gcount";
+    ignore(12) = "^bitpix$";
+    FITSKeywordUtil::removeKeywords(headerRec, ignore);
+
+// Brightness Unit
+
+    brightnessUnit = ImageFITSConverter::getBrightnessUnit(headerRec, os);
+
+// ImageInfo
+
+    imageInfo = ImageFITSConverter::getImageInfo(headerRec);
+    if (stokesFITSValue != -1) {
+       ImageInfo::ImageTypes type = ImageInfo::imageTypeFromFITS(stokesFITSValue);
+       if (type!= ImageInfo::Undefined) {
+          imageInfo.setImageType(type);
+       }
+    }
+
+// MiscInfo is whats left
+
+    ImageFITSConverter::extractMiscInfo(miscInfo, headerRec);
+
+// Get and store history.
+
+    FitsKeywordList kwl;
+    for (uInt i=0; i<header.size(); ++i) {
+       kwl.parse (header[i].chars(), 80);
+    }
+    ConstFitsKeywordList kw(kwl);
+    kw.first();
+    LoggerHolder& log = logger();
+    ImageFITSConverter::restoreHistory(log, kw);
+    if (! imageInfo.hasSingleBeam()) {
+       imageInfo.getRestoringBeam(log);
+    }
+}
+
 void FITSImage::setMaskZero(Bool filterZero)
 {
   // set the zero masking on the
   // current mask
   if (pPixelMask_p) {
-    dynamic_cast<FITSMask *>(pPixelMask_p.get())->setFilterZero(True);
+    if (isCompressed_p) {
+      dynamic_cast<FITSCompressedMask*>(pPixelMask_p.get())->setFilterZero(True);
+    } else {
+      dynamic_cast<FITSMask *>(pPixelMask_p.get())->setFilterZero(True);
+    }
   }
   // set the flag, such that an later
   // mask created in 'open()' will be OK
@@ -37,6 +37,7 @@
 #include <casacore/fits/FITS/fits.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/DataType.h>
+#include <atomic>
 
 #ifndef WCSLIB_GETWCSTAB
  #define WCSLIB_GETWCSTAB
@@ -52,6 +53,7 @@ class IPosition;
 class Slicer;
 class CoordinateSystem;
 class FITSMask;
+class FITSCompressedImage;
 class FitsInput;
 
 
@@ -134,6 +136,15 @@ public:
   // Get the extension index for any extension specification given in the full name
   static uInt get_hdunum(const String &fullname);
 
+  // Set or get the minimum number of pixels in a section for which the
+  // data are read directly from the file (bypassing the tile cache),
+  // where blocks of pixels are read and converted by multiple threads.
+  // The default is 1048576 pixels.
+  // <group>
+  static void setDirectReadSize (Int64 nrPixels);
+  static Int64 directReadSize();
+  // </group>
+
   //# ImageInterface virtual functions
   
   // Make a copy of the object with new (reference semantics).
@@ -267,6 +278,7 @@ private:
   String         fullname_p;
   MaskSpecifier  maskSpec_p;
   std::shared_ptr<TiledFileAccess> pTiledFile_p;
+  std::shared_ptr<FITSCompressedImage> pCompressed_p;
   std::unique_ptr<Lattice<Bool>>   pPixelMask_p;
   TiledShape     shape_p;
   Float          scale_p;
@@ -278,10 +290,12 @@ private:
   DataType       dataType_p;
   Int64          fileOffset_p;
   Bool           isClosed_p;
+  Bool           isCompressed_p;
   Bool           filterZeroMask_p;
   uInt           whichRep_p;
   uInt           whichHDU_p;
   Bool           _hasBeamsTable;
+  static std::atomic<Int64> theirDirectReadSize;
 
 // Reopen the image if needed.
    void reopenIfNeeded() const
@@ -293,6 +307,10 @@ private:
 // Open the image (used by setup and reopen).
    void open();
 
+// Read a section with unit strides directly from the file, reading and
+// converting blocks of pixels in parallel.
+   void getSliceDirect (Array<Float>& buffer, const Slicer& section) const;
+
 // Fish things out of the FITS file
    void getImageAttributes (CoordinateSystem& cSys,
                             IPosition& shape, ImageInfo& info,
@@ -304,6 +322,13 @@ private:
                             Int& longMagic, Bool& hasBlanks, const String& name,
                             uInt whichRep, uInt whichHDU);
 
+// Crack the header of a tile-compressed image (read by cfitsio).
+   void crackCompressedHeader (CoordinateSystem& cSys, IPosition& shape,
+                               ImageInfo& imageInfo, Unit& brightnessUnit,
+                               RecordInterface& miscInfo,
+                               FITS::ValueType& dataType, Bool& hasBlanks,
+                               LogIO& os, uInt whichRep);
+
 // Crack a primary header
    template <typename T>
    void crackHeader (CoordinateSystem& cSys, IPosition& shape, ImageInfo& imageInfo,
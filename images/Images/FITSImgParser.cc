@@ -470,7 +470,14 @@ void FITSImgParser::setup(void)
 				isfitsimg = False;
 				break;
 			case FITS::BinaryTableHDU:
-				isfitsimg = False;
+				// a tile-compressed image is stored as a binary table
+				hdu = new BinaryTableExtension(fin);
+				if (hdu->kw("ZIMAGE") && hdu->kw("ZIMAGE")->asBool()) {
+					process_extension(hdu, extindex);
+				} else {
+					isfitsimg = False;
+				}
+				delete hdu;
 				break;
 			case FITS::UnknownExtensionHDU:
 				hdu = new ExtensionHeaderDataUnit(fin);
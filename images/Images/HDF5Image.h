@@ -123,9 +123,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   public: 
     // Construct a new Image from shape and coordinate information. The image
     // will be stored in the named file.
+    // The pixels can be compressed (see class HDF5DataSet for the details).
     HDF5Image (const TiledShape& mapShape,
 	       const CoordinateSystem& coordinateInfo,
-	       const String& nameOfNewFile);
+	       const String& nameOfNewFile,
+	       HDF5DataSet::Compression compression = HDF5DataSet::NoCompression,
+	       uInt compressionLevel = 6);
+
+    // Construct a new Image in an already created HDF5 file.
+    // It can be used to write an image in parallel by opening the file
+    // for MPI-IO (see class HDF5File). In that case all processes have to
+    // construct the image and to set its meta data (coordinates, units,
+    // image info, etc.) collectively, but each process can write its own
+    // part of the pixels.
+    HDF5Image (const TiledShape& mapShape,
+	       const CoordinateSystem& coordinateInfo,
+	       const std::shared_ptr<HDF5File>& file,
+	       HDF5DataSet::Compression compression = HDF5DataSet::NoCompression,
+	       uInt compressionLevel = 6);
   
     // Reconstruct an image from a pre-existing file.
     // By default the default pixelmask (if available) is used.
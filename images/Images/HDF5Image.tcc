@@ -64,11 +64,29 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 template <class T> 
 HDF5Image<T>::HDF5Image (const TiledShape& shape, 
 			 const CoordinateSystem& coordinateInfo, 
-			 const String& fileName)
+			 const String& fileName,
+			 HDF5DataSet::Compression compression,
+			 uInt compressionLevel)
 : ImageInterface<T>(RegionHandlerHDF5(getFile, this)),
   regionPtr_p      (0)
 {
-  map_p = HDF5Lattice<T>(shape, fileName, "map", "/");
+  map_p = HDF5Lattice<T>(shape, fileName, "map", "/",
+                         compression, compressionLevel);
+  attach_logtable();
+  AlwaysAssert(setCoordinateInfo(coordinateInfo), AipsError);
+}
+
+template <class T> 
+HDF5Image<T>::HDF5Image (const TiledShape& shape, 
+			 const CoordinateSystem& coordinateInfo, 
+			 const std::shared_ptr<HDF5File>& file,
+			 HDF5DataSet::Compression compression,
+			 uInt compressionLevel)
+: ImageInterface<T>(RegionHandlerHDF5(getFile, this)),
+  regionPtr_p      (0)
+{
+  map_p = HDF5Lattice<T>(shape, file, "map", "/",
+                         compression, compressionLevel);
   attach_logtable();
   AlwaysAssert(setCoordinateInfo(coordinateInfo), AipsError);
 }
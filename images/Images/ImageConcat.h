@@ -195,6 +195,12 @@ public:
    uInt imageDim() const
      { return latticeConcat_p.latticeDim(); }
 
+// Set the maximum number of threads to use to read the images
+// contributing to a slice concurrently
+// (see <linkto class=LatticeConcat>LatticeConcat</linkto>).
+   void setReadNThreads (Int nthreads)
+     { latticeConcat_p.setReadNThreads (nthreads); }
+
 // Return a reference to the i-th image.
   ImageInterface<T>& image(uInt i) const
     { return dynamic_cast<ImageInterface<T>&>(*(latticeConcat_p.lattice(i))); }
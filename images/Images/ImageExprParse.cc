@@ -41,8 +41,12 @@
 #include <casacore/casa/Arrays/ArrayUtil.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/BasicSL/Constants.h>
+#include <casacore/casa/System/AipsrcValue.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/sstream.h>
+#include <list>
+#include <map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -66,7 +70,37 @@ static Table theLastTable;
 //# Hold a pointer to the last HDF5 file to lookup unqualified region names.
 static std::shared_ptr<HDF5File> theLastHDF5;
 
+//# Hold the nodes of the images and lattices used in the expression, so an
+//# image used multiple times is opened once and shares its node.
+//# It also holds the last table or HDF5 file set when opening the image.
+struct ImageExprParseLeaf
+{
+  LatticeExprNode node;
+  Bool setLast;
+  Table lastTable;
+  std::shared_ptr<HDF5File> lastHDF5;
+};
+static std::map<String,ImageExprParseLeaf> theLeaves;
+
+//# Tell if the last table or HDF5 file is set when opening an image.
+static Bool theSetLast;
+
+//# The parse cache holding the last parsed expressions in order of use.
+//# Each entry also holds the image names and the temporary lattices
+//# (whose addresses are part of the key).
+struct ImageExprParseCached
+{
+  String key;
+  LatticeExprNode node;
+  vector<String> names;
+  Block<LatticeExprNode> tempLattices;
+};
+static std::list<ImageExprParseCached> theCache;
+static std::map<String,std::list<ImageExprParseCached>::iterator> theCacheIndex;
+static Int theCacheSize = -1;
+
 #define SAVE_GLOBALS \
+ std::map<String,ImageExprParseLeaf> savLeaves=theLeaves; \
  const Block<LatticeExprNode>* savTempLattices=theTempLattices; \
  const PtrBlock<const ImageRegion*>* savTempRegions=theTempRegions; \
  String savDirName=theDirName; \
@@ -77,6 +111,7 @@ static std::shared_ptr<HDF5File> theLastHDF5;
  std::shared_ptr<HDF5File> savLastHDF5=theLastHDF5;
 
 #define RESTORE_GLOBALS \
+ theLeaves=savLeaves; \
  theTempLattices=savTempLattices; \
  theTempRegions=savTempRegions; \
  theDirName=savDirName; \
@@ -93,6 +128,65 @@ void imageExprParse_clear()
   theNrNodes   = 0;
   theLastTable = Table();
   theLastHDF5  = 0;
+  theLeaves.clear();
+}
+
+// Find the node of an image already used in the expression.
+// The last table or HDF5 file is set as done when opening the image.
+Bool imageExprParse_findLeaf (const String& key, LatticeExprNode& node)
+{
+  std::map<String,ImageExprParseLeaf>::const_iterator iter =
+    theLeaves.find (key);
+  if (iter == theLeaves.end()) {
+    return False;
+  }
+  node = iter->second.node;
+  if (iter->second.setLast) {
+    theLastTable = iter->second.lastTable;
+    theLastHDF5  = iter->second.lastHDF5;
+  }
+  return True;
+}
+
+// Add the node of an image just opened.
+void imageExprParse_addLeaf (const String& key, const LatticeExprNode& node)
+{
+  ImageExprParseLeaf& leaf = theLeaves[key];
+  leaf.node      = node;
+  leaf.setLast   = theSetLast;
+  leaf.lastTable = theLastTable;
+  leaf.lastHDF5  = theLastHDF5;
+}
+
+// Make the parse cache key from the command, directory and temp lattices.
+String imageExprParse_cacheKey (const String& str, const String& dirName,
+                                const Block<LatticeExprNode>& tempLattices)
+{
+  std::ostringstream os;
+  os << dirName << '\n' << str;
+  for (const LatticeExprNode& node : tempLattices) {
+    os << '\n' << node.dataType() << ':';
+    switch (node.dataType()) {
+    case TpFloat:
+      os << node.makeFloat().get();
+      break;
+    case TpDouble:
+      os << node.makeDouble().get();
+      break;
+    case TpComplex:
+      os << node.makeComplex().get();
+      break;
+    case TpDComplex:
+      os << node.makeDComplex().get();
+      break;
+    case TpBool:
+      os << node.makeBool().get();
+      break;
+    default:
+      break;
+    }
+  }
+  return os.str();
 }
 
 // Is there no last table or HDF5 file?
@@ -107,6 +201,32 @@ vector<String>  ImageExprParse::theirNames;
 Int             ImageExprParse::theirLevel=0;
 
 
+void ImageExprParse::setCacheSize (uInt nexpr)
+{
+    theCacheSize = nexpr;
+    while (theCache.size() > nexpr) {
+        theCacheIndex.erase (theCache.back().key);
+        theCache.pop_back();
+    }
+}
+
+uInt ImageExprParse::cacheSize()
+{
+    if (theCacheSize < 0) {
+        Int nexpr;
+        AipsrcValue<Int>::find (nexpr, "images.expr.parsecache", 0);
+        theCacheSize = std::max (0, nexpr);
+    }
+    return theCacheSize;
+}
+
+void ImageExprParse::clearCache()
+{
+    theCache.clear();
+    theCacheIndex.clear();
+}
+
+
 ImageExprParse::ImageExprParse (Bool value)
 : itsType (TpBool),
   itsBval (value)
@@ -209,6 +329,20 @@ LatticeExprNode ImageExprParse::command
     if (theirLevel == 0) {
         theirNames.clear();
     }
+    // A top level expression can be found in the parse cache.
+    // Use it and make it the most recently used one.
+    String cacheKey;
+    Bool useCache = (theirLevel == 0  &&  tempRegions.nelements() == 0  &&
+                     cacheSize() > 0);
+    if (useCache) {
+        cacheKey = imageExprParse_cacheKey (str, dirName, tempLattices);
+        auto iter = theCacheIndex.find (cacheKey);
+        if (iter != theCacheIndex.end()) {
+            theCache.splice (theCache.begin(), theCache, iter->second);
+            theirNames = theCache.front().names;
+            return theCache.front().node;
+        }
+    }
     // Save the global variables to make it re-entrant.
     // Note that if a persistent ImageExpr is used in another expression,
     // ImageOpener will call ::command recursively.
@@ -248,6 +382,13 @@ LatticeExprNode ImageExprParse::command
     }
     // Restore the global variables to make it re-entrant.
     RESTORE_GLOBALS;
+    // Add the expression to the parse cache.
+    if (useCache) {
+        theCache.push_front (ImageExprParseCached{cacheKey, node, theirNames,
+                                                  tempLattices});
+        theCacheIndex[cacheKey] = theCache.begin();
+        setCacheSize (theCacheSize);
+    }
     return node;
 }
 
@@ -637,17 +778,33 @@ LatticeExprNode ImageExprParse::makeLRNode() const
     }
     // If 1 element is given, try if it is a lattice or image.
     // If that does not succeed, it'll be tried later as a region.
+    // An image already used in the expression is not opened again.
     if (names.size() == 1) {
 	LatticeExprNode node;
-	if (tryLatticeNode (node, addDir(names[0]))) {
+        String name = addDir(names[0]);
+        if (imageExprParse_findLeaf (name, node)) {
+            theirNames.push_back (names[0]);
+	    return node;
+        }
+        theSetLast = False;
+	if (tryLatticeNode (node, name)) {
+            imageExprParse_addLeaf (name, node);
             theirNames.push_back (names[0]);
 	    return node;
 	}
     }
     // If 2 elements given, it should be an image with a mask name.
     if (names.size() == 2) {
+	LatticeExprNode node;
+        String name = addDir(names[0]);
+        String key  = name + "::" + names[1];
         theirNames.push_back (names[0]);
-        return makeImageNode (addDir(names[0]), names[1]);
+        if (! imageExprParse_findLeaf (key, node)) {
+            theSetLast = False;
+            node = makeImageNode (name, names[1]);
+            imageExprParse_addLeaf (key, node);
+        }
+        return node;
     }
     // One or three elements have been given.
     // If the first one is empty, a table must have been used already.
@@ -771,9 +928,11 @@ Bool ImageExprParse::tryLatticeNode (LatticeExprNode& node,
     // Set the last table used (for finding unqualified regions).
     if (type == "PagedImage") {
       theLastTable = Table(name);
+      theSetLast = True;
     } else if (type == "HDF5Image") {
       theLastHDF5 = std::make_shared<HDF5File>(name);
       theLastTable = Table();
+      theSetLast = True;
     }
     delete pLatt;
     return True;
@@ -820,6 +979,7 @@ Bool ImageExprParse::tryLatticeNode (LatticeExprNode& node,
   }
   // This is now the last table used (for finding unqualified regions).
   theLastTable = table;
+  theSetLast = True;
   return True;
 }
 
@@ -895,6 +1055,7 @@ LatticeExprNode ImageExprParse::makeImageNode (const String& name,
     }
     // This is now the last table used (for finding unqualified regions).
     theLastTable = table;
+    theSetLast = True;
     return node;
 }
 
@@ -157,6 +157,19 @@ class Slice;
 // the expression in chunks to avoid having to keep large temporary
 // results. A scalar subexpression is evaluated only once to avoid
 // unnecessary (possibly expensive) calculations.
+// <br>An image used multiple times in an expression is opened only once.
+// Together with the sharing of nodes done by LatticeExprNode, a common
+// subexpression like <src>(a-b)</src> in <src>(a-b)*(a-b)</src> is
+// evaluated only once per chunk.
+// <p>
+// The parser can keep the results of the last parsed expressions in a
+// cache (see function <src>setCacheSize</src>), so an expression given
+// again (e.g. by a viewer redisplaying an expression image) is not parsed
+// again and its images are not reopened. The cache is keyed on the
+// expression, the directory name and the temporary lattices given.
+// Expressions using temporary regions are not cached.
+// Note that a cached expression keeps its images open, so the cache
+// should be cleared if an image used is replaced or resized.
 // <p>
 // Some examples:
 // <dl>
@@ -220,6 +233,18 @@ public:
 				    const String& dirName = String());
     // </group>
 
+    // Set the maximum number of parsed expressions kept in the parse cache.
+    // The least recently used expression is removed if the cache is full.
+    // A size 0 disables the cache. The initial size is given by the aipsrc
+    // variable <src>images.expr.parsecache</src> (default 0).
+    static void setCacheSize (uInt nexpr);
+
+    // Get the maximum number of parsed expressions kept in the parse cache.
+    static uInt cacheSize();
+
+    // Remove all expressions from the parse cache.
+    static void clearCache();
+
     // Construct a literal object for the given type.
     // <group>
     ImageExprParse (Bool value);
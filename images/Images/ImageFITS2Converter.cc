@@ -25,6 +25,8 @@
 
 #include <casacore/images/Images/ImageFITSConverter.h>
 #include <casacore/images/Images/PagedImage.h>
+#include <casacore/images/Images/TempImage.h>
+#include <casacore/images/Images/FITSImage.h>
 #include <casacore/images/Images/ImageInfo.h>
 #include <casacore/images/Images/FITSQualityImage.h>
 #include <casacore/images/Images/SubImage.h>
@@ -37,6 +39,7 @@
 #include <casacore/fits/FITS/FITSDateUtil.h>
 #include <casacore/fits/FITS/FITSKeywordUtil.h>
 #include <casacore/fits/FITS/FITSHistoryUtil.h>
+#include <casacore/fits/FITS/FITSCompressedImage.h>
 #include <casacore/coordinates/Coordinates/LinearCoordinate.h>
 #include <casacore/coordinates/Coordinates/StokesCoordinate.h>
 #include <casacore/coordinates/Coordinates/QualityCoordinate.h>
@@ -49,6 +52,7 @@
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Quanta/UnitMap.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Containers/Record.h>
@@ -67,12 +71,33 @@
 
 #include <casacore/casa/sstream.h>
 #include <casacore/casa/iomanip.h>
+#include <functional>
+#include <future>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   const String ImageFITSConverter::CASAMBM = "casambm";
 
+  // A chunk of image data (and mask) to be converted to FITS.
+  struct ImageFITSChunk {
+    Array<Float> data;
+    Array<Bool>  mask;
+  };
+
+  // Read a chunk of the image; used to read ahead in another thread.
+  static ImageFITSChunk readFITSChunk (const ImageInterface<Float>& image,
+                                       const Slicer& section, Bool getMask)
+  {
+    ImageFITSChunk chunk;
+    chunk.data.reference (image.getSlice (section));
+    if (getMask) {
+      chunk.mask.reference (image.getMaskSlice (section));
+    }
+    return chunk;
+  }
+
   Bool ImageFITSConverter::FITSToImage
   (ImageInterface<Float> *&newImage, String &error,
    const String &imageName, const String &fitsName,
@@ -125,6 +150,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       // look for first readable HDU
       for(Int i=0; i<numHDU; i++){
         os << LogIO::NORMAL << "Processing HDU " << i << LogIO::POST;
+        if (!infile.err() && infile.rectype() == FITS::HDURecord &&
+            infile.hdutype() == FITS::BinaryTableHDU &&
+            FITSCompressedImage::isCompressed (fitsName, i)) {
+          return compressedFITSToImage (newImage, error, imageName, fitsName,
+                                        whichRep, i, zeroBlanks);
+        }
         if (infile.err() ||
             infile.rectype() != FITS::HDURecord ||
             (infile.hdutype() != FITS::PrimaryArrayHDU &&
@@ -150,6 +181,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
           return False;
         }
       }
+      if (infile.rectype() == FITS::HDURecord &&
+          infile.hdutype() == FITS::BinaryTableHDU &&
+          FITSCompressedImage::isCompressed (fitsName, whichHDU)) {
+        return compressedFITSToImage (newImage, error, imageName, fitsName,
+                                      whichRep, whichHDU, zeroBlanks);
+      }
       if (infile.rectype() != FITS::HDURecord ||
           (infile.hdutype() != FITS::PrimaryArrayHDU &&
            infile.hdutype() != FITS::ImageExtensionHDU)) {
@@ -286,6 +323,134 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return True;
   }
 
+  Bool ImageFITSConverter::compressedFITSToImage
+  (ImageInterface<Float>*& newImage, String &error,
+   const String &imageName, const String &fitsName,
+   uInt whichRep, uInt whichHDU, Bool zeroBlanks)
+  {
+    LogIO os(LogOrigin("ImageFITSConverter", "compressedFITSToImage", WHERE));
+    try {
+      // FITSImage does the decompression and header conversion.
+      FITSImage fitsImage(fitsName, whichRep, whichHDU);
+      IPosition shape = fitsImage.shape();
+      if (imageName.empty()) {
+        newImage = new TempImage<Float>(shape, fitsImage.coordinates());
+        os << LogIO::NORMAL << "Created (temp)image of shape " << shape
+           << LogIO::POST;
+      } else {
+        newImage = new PagedImage<Float>(shape, fitsImage.coordinates(),
+                                         imageName);
+        os << LogIO::NORMAL << "Created image of shape " << shape
+           << LogIO::POST;
+      }
+      newImage->setUnits (fitsImage.units());
+      newImage->setMiscInfo (fitsImage.miscInfo());
+      newImage->setImageInfo (fitsImage.imageInfo());
+      newImage->appendLog (fitsImage.logger());
+      // Copy the data per tile row; blanked pixels are NaN.
+      ImageRegion maskReg = newImage->makeMask ("mask0", False, False);
+      LCRegion& mask = maskReg.asMask();
+      IPosition cursorShape = fitsImage.niceCursorShape();
+      LatticeStepper stepper(shape, cursorShape);
+      RO_LatticeIterator<Float> inIter(fitsImage, stepper);
+      LatticeIterator<Float> outIter(*newImage, stepper);
+      LatticeIterator<Bool> maskIter(mask, stepper);
+      Bool hasBlanks = False;
+      for (; !inIter.atEnd(); inIter++, outIter++, maskIter++) {
+        Array<Float>& data = outIter.woCursor();
+        Array<Bool>& maskData = maskIter.woCursor();
+        data = inIter.cursor();
+        Array<Float>::iterator dIter = data.begin();
+        for (Array<Bool>::iterator mIter = maskData.begin();
+             mIter != maskData.end(); ++mIter, ++dIter) {
+          *mIter = ! isNaN(*dIter);
+          if (! *mIter) {
+            hasBlanks = True;
+            if (zeroBlanks) {
+              *dIter = 0;
+            }
+          }
+        }
+      }
+      if (hasBlanks) {
+        os << LogIO::NORMAL << "Storing mask with name 'mask0'" << LogIO::POST;
+        newImage->defineRegion ("mask0", maskReg, RegionHandler::Masks);
+        newImage->setDefaultMask ("mask0");
+      }
+    } catch (const AipsError& x) {
+      delete newImage;
+      newImage = 0;
+      error = "Error converting compressed FITS image " + fitsName + ": " +
+              x.getMesg();
+      return False;
+    }
+    return True;
+  }
+
+  Bool ImageFITSConverter::ImageToCompressedFITS
+  (String &error, const ImageInterface<Float>& image,
+   const String &fitsName, const String &compression,
+   const IPosition &tileShape, Float quantizeLevel, Bool allowOverwrite,
+   Bool preferVelocity, Bool opticalVelocity)
+  {
+    LogIO os(LogOrigin("ImageFITSConverter", "ImageToCompressedFITS", WHERE));
+    File fitsFile(fitsName);
+    if (! removeFile (error, fitsFile, fitsName, allowOverwrite)) {
+      return False;
+    }
+    ImageFITSHeaderInfo fhi;
+    if (! ImageHeaderToFITS (error, fhi, image, preferVelocity,
+                             opticalVelocity, -32, 1.0, -1.0,
+                             False, False)) {
+      return False;
+    }
+    IPosition shape = image.shape();
+    if (fhi.needNonOptimalCursor  ||  ! fhi.newShape.isEqual (shape)) {
+      error = "Image axes would have to be reordered; not supported for "
+              "compressed FITS";
+      return False;
+    }
+    // Split the header into its cards.
+    String header = fhi.kw.toString();
+    Vector<String> cards(header.size() / 80);
+    for (uInt i=0; i<cards.size(); ++i) {
+      cards[i] = header.substr (80*i, 80);
+    }
+    try {
+      FITSCompressedImageWriter writer(fitsName, shape, cards, compression,
+                                       tileShape, quantizeLevel);
+      // Write slabs containing whole tiles along the last axis.
+      uInt ndim = shape.size();
+      IPosition cursorShape(shape);
+      cursorShape[ndim-1] = (tileShape.empty()  ?  1 : tileShape[ndim-1]);
+      if (ndim == 1) {
+        cursorShape[0] = shape[0];
+      }
+      LatticeStepper stepper(shape, cursorShape);
+      RO_MaskedLatticeIterator<Float> iter(image, stepper);
+      for (; !iter.atEnd(); iter++) {
+        Array<Float> data = iter.cursor().copy();
+        if (image.isMasked()) {
+          const Array<Bool> mask = iter.getMask();
+          Array<Float>::iterator dIter = data.begin();
+          for (Array<Bool>::const_iterator mIter = mask.begin();
+               mIter != mask.end(); ++mIter, ++dIter) {
+            if (! *mIter) {
+              setNaN (*dIter);
+            }
+          }
+        }
+        writer.put (data, iter.position());
+      }
+      writer.close();
+    } catch (const AipsError& x) {
+      error = "Error writing compressed FITS file " + fitsName + ": " +
+              x.getMesg();
+      return False;
+    }
+    return True;
+  }
+
   Bool ImageFITSConverter::ImageToFITS
   (String &error, ImageInterface<Float>& image,
    const String &fitsName, uInt memoryInMB,
@@ -1272,10 +1437,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     //
     IPosition shape = image.shape();
     String report;
+    // Two chunks are in memory because the next one is read ahead.
     IPosition newCursorShape =
       ImageFITSConverter::copyCursorShape (report, shape,
                                            sizeof(Float), sizeof(Float),
-                                           memoryInMB);
+                                           (memoryInMB+1)/2);
     if(fhi.needNonOptimalCursor && fhi.newShape.nelements()>0){
       // use cursor the size of one image row in order to enable axis re-ordering
       newCursorShape.resize(1);
@@ -1305,7 +1471,6 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       Double curpixels = 1.0*newCursorShape.product();
       //
       LatticeStepper stepper(shape, newCursorShape, fhi.cursorOrder);
-      RO_MaskedLatticeIterator<Float> iter(image, stepper);
       const Int bufferSize = newCursorShape.product();
 
       PrimaryArray<Float>* fits32 = 0;
@@ -1349,56 +1514,68 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         AlwaysAssert(0, AipsError); // NOTREACHED
       }
 
-      Short *buffer16 = 0; // Use this to write the scaled shorts into
+      // The conversion buffer (shorts or masked floats).
+      std::vector<Short> buffer16;
+      std::vector<Float> buffer32;
       if (fits16) {
-        buffer16 = new Short[bufferSize];
-        AlwaysAssert(buffer16, AipsError);
+        buffer16.resize (bufferSize);
+      } else if (fhi.applyMask) {
+        buffer32.resize (bufferSize);
       }
       //
-      // Iterate through the image.
+      // Iterate through the image. The next chunk is read by another
+      // thread while the current one is converted (using multiple threads)
+      // and written.
       //
-      for (iter.reset(); !iter.atEnd(); iter++) {
-        const Array<Float>& cursor = iter.cursor();
+      std::future<ImageFITSChunk> nextChunk =
+        std::async (std::launch::async, readFITSChunk, std::cref(image),
+                    Slicer(stepper.position(), stepper.endPosition(),
+                           Slicer::endIsLast),
+                    fhi.applyMask);
+      while (True) {
+        ImageFITSChunk chunk = nextChunk.get();
+        stepper++;
+        Bool more = !stepper.atEnd();
+        if (more) {
+          nextChunk = std::async (std::launch::async, readFITSChunk,
+                                  std::cref(image),
+                                  Slicer(stepper.position(),
+                                         stepper.endPosition(),
+                                         Slicer::endIsLast),
+                                  fhi.applyMask);
+        }
         Bool deletePtr;
-        const Float* ptr = cursor.getStorage(deletePtr);
-        //
+        const Float* ptr = chunk.data.getStorage(deletePtr);
         const Bool* maskPtr = 0;
         Bool deleteMaskPtr;
         if (fhi.applyMask) {
-          if (!fhi.pMask->shape().isEqual(cursor.shape())) {
-            fhi.pMask->resize(cursor.shape());
-          }
-          (*fhi.pMask) = iter.getMask(False);
-          maskPtr = fhi.pMask->getStorage(deleteMaskPtr);
+          maskPtr = chunk.mask.getStorage(deleteMaskPtr);
         }
         //
-        //       pMeter->update((count*1.0 - 0.5)*curpixels);
-        //
-        const uInt nPts = cursor.nelements();
+        const Int nPts = chunk.data.nelements();
         error= "";
         Int n = 0;
         if (fits32) {
           if (fhi.applyMask) {
-            Float* ptr2 = new float[nPts];
-            for (uInt j=0; j<nPts; j++) {
-              if (maskPtr[j]) {
-                ptr2[j] = ptr[j];
-              }
-              else {
-                ptr2[j] = ptr[j];
+            Float* ptr2 = buffer32.data();
+#ifdef _OPENMP
+#pragma omp parallel for if (nPts > 65536)
+#endif
+            for (Int j=0; j<nPts; j++) {
+              ptr2[j] = ptr[j];
+              if (!maskPtr[j]) {
                 setNaN(ptr2[j]);
               }
             }
-            fits32->store(ptr2, bufferSize);
-            delete [] ptr2;
+            fits32->store(ptr2, nPts);
           }
           else {
-            fits32->store(ptr, bufferSize);
+            fits32->store(ptr, nPts);
           }
           Int hduErr = 0;
           if (!(hduErr = fits32->err())){
             n = fits32->write(*outfile);
-            if (n != bufferSize) {
+            if (n != nPts) {
               delete outfile;
               error = "Write failed (full disk or tape?)";
               return False;
@@ -1410,45 +1587,29 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
           }
         }
         else if (fits16) {
-          short blankOffset = fhi.hasBlanks ? 1 : 0;
-          //
-          if (fhi.applyMask) {
-            for (Int j=0; j<bufferSize; j++) {
-              //                    if (ptr[j] != ptr[j] || maskPtr[j]) {
-              if (isNaN(ptr[j]) || !maskPtr[j]) {
-                buffer16[j] = fhi.minshort;
+          const short blankOffset = fhi.hasBlanks ? 1 : 0;
+          Short* ptr16 = buffer16.data();
+#ifdef _OPENMP
+#pragma omp parallel for if (nPts > 65536)
+#endif
+          for (Int j=0; j<nPts; j++) {
+            if (isNaN(ptr[j]) || (maskPtr && !maskPtr[j])) {
+              ptr16[j] = fhi.minshort;
+            } else {
+              if (ptr[j] > fhi.maxPix) {
+                ptr16[j] = fhi.maxshort;
+              } else if (ptr[j] < fhi.minPix) {
+                ptr16[j] = fhi.minshort + blankOffset;
               } else {
-                if (ptr[j] > fhi.maxPix) {
-                  buffer16[j] = fhi.maxshort;
-                } else if (ptr[j] < fhi.minPix) {
-                  buffer16[j] = fhi.minshort + blankOffset;
-                } else {
-                  buffer16[j] = Short((ptr[j] - fhi.bzero)/fhi.bscale);
-                }
+                ptr16[j] = Short((ptr[j] - fhi.bzero)/fhi.bscale);
               }
             }
           }
-          else {
-            for (Int j=0; j<bufferSize; j++) {
-              //                    if (ptr[j] != ptr[j]) {
-              if (isNaN(ptr[j])) {
-                buffer16[j] = fhi.minshort;
-              } else {
-                if (ptr[j] > fhi.maxPix) {
-                  buffer16[j] = fhi.maxshort;
-                } else if (ptr[j] < fhi.minPix) {
-                  buffer16[j] = fhi.minshort + blankOffset;
-                } else {
-                  buffer16[j] = Short((ptr[j] - fhi.bzero)/fhi.bscale);
-                }
-              }
-            }
-          }
-          fits16->store(buffer16, bufferSize);
+          fits16->store(ptr16, nPts);
           Int hduErr = 0;
           if (!(hduErr = fits16->err())) {
             n = fits16->write(*outfile);
-            if (n != bufferSize) {
+            if (n != nPts) {
               delete outfile;
               error = "Write failed (full disk or tape?";
               return False;
@@ -1464,8 +1625,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
           AlwaysAssert(0, AipsError); // NOTREACHED
         }
         //
-        cursor.freeStorage(ptr, deletePtr);
-        if (fhi.applyMask) fhi.pMask->freeStorage(maskPtr, deleteMaskPtr);
+        chunk.data.freeStorage(ptr, deletePtr);
+        if (fhi.applyMask) chunk.mask.freeStorage(maskPtr, deleteMaskPtr);
         //
         if ((fits32 && fits32->err()) ||
             (fits16 && fits16->err()) ||
@@ -1476,13 +1637,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         }
         count++;
         if (verbose) pMeter->update(count*curpixels);
+        if (!more) {
+          break;
+        }
       }
       if (fits32) {
         delete fits32; fits32 = 0;
       }
       else if (fits16) {
         delete fits16; fits16 = 0;
-        delete buffer16; buffer16 = 0;
       }
       else {
         AlwaysAssert(0, AipsError); // NOTREACHED
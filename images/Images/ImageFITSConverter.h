@@ -271,6 +271,29 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                                   Bool history=True);
     // </group>
 
+    // Convert a Casacore image to a tile-compressed FITS file (the FITS tiled
+    // image convention), which has an empty primary array and the image in
+    // the first extension. The data are written as 32-bit floats.
+    // <ul>
+    //   <li> <src>compression</src> is RICE, GZIP, GZIP2, HCOMPRESS or PLIO.
+    //   <li> <src>tileShape</src> is the compression tile shape. It
+    //        defaults to a row of the image.
+    //   <li> <src>quantizeLevel</src> 0 means lossless compression (only
+    //        possible for GZIP and GZIP2), otherwise the values are
+    //        quantized as done by cfitsio.
+    // </ul>
+    // Masked pixels are written as NaN. Other parameters are as in
+    // <src>ImageToFITS</src>. The image axes are not reordered.
+    static Bool ImageToCompressedFITS(String &error,
+                                      const ImageInterface<Float> &image,
+                                      const String &fitsName,
+                                      const String &compression = "GZIP",
+                                      const IPosition &tileShape = IPosition(),
+                                      Float quantizeLevel = 0,
+                                      Bool allowOverwrite = False,
+                                      Bool preferVelocity = True,
+                                      Bool opticalVelocity = True);
+
     // Helper function - used to calculate a cursor appropriate for the
     // desired memory use. It's not intended that application programmers
     // call this, but you may if it's useful to you.
@@ -313,6 +336,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   private:
 
+    // Convert the tile-compressed image in the given HDU to a Casacore
+    // image. Parameters as in "FITSToImage".
+    static Bool compressedFITSToImage (ImageInterface<Float>*& newImage,
+                                       String &error,
+                                       const String &imageName,
+                                       const String &fitsName,
+                                       uInt whichRep, uInt whichHDU,
+                                       Bool zeroBlanks);
+
     // Put a CASA image to an opened FITS image
     // Parameters as in "ImageToFITS". In addition:
     // <ul>
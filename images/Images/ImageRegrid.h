@@ -33,6 +33,7 @@
 #include <casacore/measures/Measures/MFrequency.h>
 #include <casacore/scimath/Mathematics/Interpolate2D.h>
 #include <casacore/scimath/Mathematics/NumericTraits.h>
+#include <memory>
 #include <set>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -222,6 +223,26 @@ public:
   Cube<Double> itsUser2DCoordinateGrid;
   Matrix<Bool> itsUser2DCoordinateGridMask;
   Bool itsNotify;
+//
+  // The coordinates, shapes and axes used to make the current coordinate
+  // grid. The grid is reused by a subsequent regrid with the same values
+  // (e.g. when regridding several images on the same grid).
+  std::shared_ptr<Coordinate> itsGridInCoord;
+  std::shared_ptr<Coordinate> itsGridOutCoord;
+  std::shared_ptr<ObsInfo> itsGridInObsInfo;
+  std::shared_ptr<ObsInfo> itsGridOutObsInfo;
+  IPosition itsGridKey;
+  Bool itsGridAllFailed;
+  Bool itsGridMissedIt;
+//
+  // Tell if the current coordinate grid was made for the given
+  // coordinates and key.
+  Bool _canReuseGrid (const Coordinate& inCoord, const Coordinate& outCoord,
+                      const ObsInfo& inObsInfo, const ObsInfo& outObsInfo,
+                      const IPosition& key) const;
+
+  // Tell if the ObsInfo objects have the same telescope, date and position.
+  static Bool _sameObsInfo (const ObsInfo& left, const ObsInfo& right);
 //  
   // Check shape and axes.  Exception if no good.  If pixelAxes
   // of length 0, set to all axes according to shape
@@ -29,10 +29,16 @@
 #include <casacore/images/Images/ImageRegrid.h>
 
 #include <casacore/casa/Arrays/ArrayAccessor.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMathKernels.h>
+#include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/OS/Timer.h>
+#include <casacore/coordinates/Coordinates/CoordinateSystem.h>
 #include <casacore/coordinates/Coordinates/DirectionCoordinate.h>
 #include <casacore/coordinates/Coordinates/LinearCoordinate.h>
+#include <casacore/coordinates/Coordinates/ObsInfo.h>
 #include <casacore/coordinates/Coordinates/SpectralCoordinate.h>
 #include <casacore/images/Images/SubImage.h>
 #include <casacore/images/Images/TempImage.h>
@@ -51,14 +57,18 @@ template<class T>
 ImageRegrid<T>::ImageRegrid()
 : itsShowLevel(0),
   itsDisableConversions(False),
-  itsNotify(False)
+  itsNotify(False),
+  itsGridAllFailed(False),
+  itsGridMissedIt(False)
 {;}
 
 template<class T>
 ImageRegrid<T>::ImageRegrid(const ImageRegrid& other)  
 : itsShowLevel(other.itsShowLevel),
   itsDisableConversions(other.itsDisableConversions),
-  itsNotify(other.itsNotify)
+  itsNotify(other.itsNotify),
+  itsGridAllFailed(False),
+  itsGridMissedIt(False)
 {;}
 
 
@@ -878,6 +888,11 @@ void ImageRegrid<T>::regridTwoAxisCoordinate (
 
 	// Either generate the coordinate grid or use what the user has supplied
 	t1.mark();
+	if (replicate  ||  (itsUser2DCoordinateGrid.nelements() > 0 &&
+			itsUser2DCoordinateGridMask.nelements() > 0)) {
+		// The grid is not made from the coordinates.
+		itsGridInCoord.reset();
+	}
 	if (itsUser2DCoordinateGrid.nelements() > 0 &&
 			itsUser2DCoordinateGridMask.nelements() > 0) {
 		if (itsNotify) {
@@ -924,14 +939,36 @@ void ImageRegrid<T>::regridTwoAxisCoordinate (
 			its2DCoordinateGridMask.set(True);
 		}
 		else {
-			make2DCoordinateGrid (os, allFailed, missedIt, minInX, minInY, maxInX,
-					maxInY,
-					its2DCoordinateGrid, its2DCoordinateGridMask,
-					inCoords, outCoords, inCoordinate, outCoordinate,
-					xInAxis, yInAxis, xOutAxis,
-					yOutAxis,
-					inPixelAxes, outPixelAxes, inShape, outPosFull,
-					outShape, decimate);
+			// Reuse the grid made by a previous regrid if possible.
+			IPosition gridKey = inShape.concatenate(outShape);
+			gridKey.append (IPosition(6, inPixelAxes[0], inPixelAxes[1],
+					outPixelAxes[0], outPixelAxes[1],
+					decimate, itsDisableConversions));
+			if (_canReuseGrid (inCoords.coordinate(inCoordinate),
+					outCoords.coordinate(outCoordinate),
+					inCoords.obsInfo(), outCoords.obsInfo(), gridKey)) {
+				if (itsShowLevel>0) {
+					cerr << "Reusing the coordinate grid" << endl;
+				}
+				allFailed = itsGridAllFailed;
+				missedIt = itsGridMissedIt;
+			} else {
+				make2DCoordinateGrid (os, allFailed, missedIt, minInX, minInY, maxInX,
+						maxInY,
+						its2DCoordinateGrid, its2DCoordinateGridMask,
+						inCoords, outCoords, inCoordinate, outCoordinate,
+						xInAxis, yInAxis, xOutAxis,
+						yOutAxis,
+						inPixelAxes, outPixelAxes, inShape, outPosFull,
+						outShape, decimate);
+				itsGridInCoord.reset (inCoords.coordinate(inCoordinate).clone());
+				itsGridOutCoord.reset (outCoords.coordinate(outCoordinate).clone());
+				itsGridInObsInfo.reset (new ObsInfo(inCoords.obsInfo()));
+				itsGridOutObsInfo.reset (new ObsInfo(outCoords.obsInfo()));
+				itsGridKey = gridKey;
+				itsGridAllFailed = allFailed;
+				itsGridMissedIt = missedIt;
+			}
 		}
 	}
 	s1 += t1.all();
@@ -1574,6 +1611,44 @@ void ImageRegrid<T>::findXYExtent (Bool& missedIt, Bool& allFailed,
    }
 }
 
+template<class T>
+Bool ImageRegrid<T>::_canReuseGrid (const Coordinate& inCoord,
+                                    const Coordinate& outCoord,
+                                    const ObsInfo& inObsInfo,
+                                    const ObsInfo& outObsInfo,
+                                    const IPosition& key) const
+{
+  return itsGridInCoord  &&  key.isEqual (itsGridKey)  &&
+    itsGridInCoord->near (inCoord, 1e-10)  &&
+    itsGridOutCoord->near (outCoord, 1e-10)  &&
+    _sameObsInfo (*itsGridInObsInfo, inObsInfo)  &&
+    _sameObsInfo (*itsGridOutObsInfo, outObsInfo);
+}
+
+template<class T>
+Bool ImageRegrid<T>::_sameObsInfo (const ObsInfo& left, const ObsInfo& right)
+{
+  if (left.telescope() != right.telescope()  ||
+      left.isTelescopePositionSet() != right.isTelescopePositionSet()) {
+    return False;
+  }
+  MEpoch leftDate = left.obsDate();
+  MEpoch rightDate = right.obsDate();
+  if (leftDate.getRef().getType() != rightDate.getRef().getType()  ||
+      leftDate.getValue().get() != rightDate.getValue().get()) {
+    return False;
+  }
+  if (left.isTelescopePositionSet()) {
+    const MPosition& leftPos = left.telescopePosition();
+    const MPosition& rightPos = right.telescopePosition();
+    if (leftPos.getRef().getType() != rightPos.getRef().getType()  ||
+        !allEQ (leftPos.getValue().get(), rightPos.getValue().get())) {
+      return False;
+    }
+  }
+  return True;
+}
+
 template<class T>
 void ImageRegrid<T>::regrid2DMatrix(Lattice<T>& outCursor, 
                                     LatticeIterator<Bool>*& outMaskIterPtr,
@@ -1624,10 +1699,7 @@ void ImageRegrid<T>::regrid2DMatrix(Lattice<T>& outCursor,
   inChunk2DShape[0] = inChunkTrc2D[xInAxis] - inChunkBlc2D[xInAxis] + 1;
   inChunk2DShape[1] = inChunkTrc2D[yInAxis] - inChunkBlc2D[yInAxis] + 1;
   //
-  Vector<Double> pix2DPos2(2);
   IPosition outPos3;
-  Bool interpOK;
-  T result(0);
   //
   for (outCursorIter.reset(); !outCursorIter.atEnd(); outCursorIter++) {
     
@@ -1666,55 +1738,55 @@ void ImageRegrid<T>::regrid2DMatrix(Lattice<T>& outCursor,
       outMaskMCursor = &(outMaskCursorIterPtr->rwMatrixCursor());
     };
     
-    ArrayAccessor<Bool, Axis<0> > sucp0;
-    ArrayAccessor<Bool, Axis<1> > sucp1(succeed);
-    ArrayAccessor<T, Axis<0> > outMp0;
-    ArrayAccessor<T, Axis<1> > outMp1(outMCursor);
-    ArrayAccessor<Bool, Axis<0> > outMaskMp0;
-    ArrayAccessor<Bool, Axis<1> > outMaskMp1;
-    if (outIsMasked) outMaskMp1.init(*outMaskMCursor);
-    uInt dpix2DPos = &pix2DPos(0,0,1) - &pix2DPos(0,0,0);
-
-    for (uInt j=0; j<nCol; j++) {
-      if (outIsMasked) outMaskMp0 = outMaskMp1;
-      sucp0 = sucp1;
-      outMp0 = outMp1;
-      for (uInt i=0; i<nRow; i++) {
-	if (! *sucp0) {
-	  *outMp0 = 0.0;
-	  if (outIsMasked) *outMaskMp0 = False;
-	} else {
-	  
-	  // Now do the interpolation. pix2DPos(i,j,) is the absolute input
-	  // pixel coordinate in the input lattice for the
-	  // current output pixel.
-	  uInt ii = outPos3[xOutAxis] + i;
-	  uInt jj = outPos3[yOutAxis] + j;
-	  const Double *pix2Dp = &pix2DPos(ii,jj,0);
-	  pix2DPos2[0] = *pix2Dp - inChunkBlc[xInAxis];
-	  pix2DPos2[1] = *(pix2Dp + dpix2DPos) - inChunkBlc[yInAxis];
-	  if (inIsMasked) {                     
-	    interpOK = interp.interp(result, pix2DPos2, inDataChunk2D,
-				     *inMaskChunk2DPtr);
-	  } else {
-	    interpOK = interp.interp(result, pix2DPos2, inDataChunk2D);
-	  };
-	  if (interpOK) {
-	    *outMp0 = scale * result;
-	    if (outIsMasked) *outMaskMp0 = True; 
-	  } else {
-	    *outMp0 = 0.0;
-	    if (outIsMasked) *outMaskMp0 = False; 
-	  };
-	};
-	sucp0++;
-	outMp0++;
-	outMaskMp0++;
-      };
-      sucp1++;
-      outMp1++;
-      outMaskMp1++;
-    };
+    // The columns are divided over the threads. Each thread collects the
+    // positions of its pixels to interpolate, so they can be interpolated
+    // in a single call.
+    const Matrix<Bool>* inMaskPtr = (inIsMasked ? inMaskChunk2DPtr : 0);
+    size_t nchunk = 1;
+#ifdef _OPENMP
+    if (size_t(nRow)*nCol >= 4096) {
+      nchunk = std::min (size_t(OMP::nMaxThreads()), size_t(nCol));
+    }
+#endif
+    arrays_internal::parallelChunks
+      (nCol, nchunk, [&](size_t, size_t stCol, size_t nrCol)
+       {
+         size_t nmax = nrCol * nRow;
+         std::vector<Double> xPos(nmax), yPos(nmax);
+         std::vector<uInt> iPos(nmax), jPos(nmax);
+         size_t npts = 0;
+         for (uInt j=stCol; j<stCol+nrCol; j++) {
+           uInt jj = outPos3[yOutAxis] + j;
+           for (uInt i=0; i<nRow; i++) {
+             if (! succeed(i,j)) {
+               outMCursor(i,j) = 0.0;
+               if (outIsMasked) (*outMaskMCursor)(i,j) = False;
+             } else {
+               // pix2DPos(ii,jj,) is the absolute input pixel coordinate
+               // in the input lattice for the current output pixel.
+               uInt ii = outPos3[xOutAxis] + i;
+               xPos[npts] = pix2DPos(ii,jj,0) - inChunkBlc[xInAxis];
+               yPos[npts] = pix2DPos(ii,jj,1) - inChunkBlc[yInAxis];
+               iPos[npts] = i;
+               jPos[npts] = j;
+               npts++;
+             }
+           }
+         }
+         std::vector<T> values(npts);
+         Block<Bool> valid(npts);
+         interp.interp (values.data(), valid.storage(), xPos.data(),
+                        yPos.data(), npts, inDataChunk2D, inMaskPtr);
+         for (size_t k=0; k<npts; k++) {
+           if (valid[k]) {
+             outMCursor(iPos[k],jPos[k]) = scale * values[k];
+             if (outIsMasked) (*outMaskMCursor)(iPos[k],jPos[k]) = True;
+           } else {
+             outMCursor(iPos[k],jPos[k]) = 0.0;
+             if (outIsMasked) (*outMaskMCursor)(iPos[k],jPos[k]) = False;
+           }
+         }
+       });
     //
     if (pProgressMeter) {
       pProgressMeter->update(iPix); 
@@ -50,6 +50,10 @@
 #include <casacore/casa/Logging/LogIO.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/OS/CanonicalConversion.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/IO/MMapIO.h>
 #include <casacore/casa/Quanta/Unit.h>
 #include <casacore/casa/Quanta/UnitMap.h>
 #include <casacore/casa/Utilities/ValType.h>
@@ -60,6 +64,7 @@
 #include <casacore/fits/FITS/FITSSpectralUtil.h>
 
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 #include <casacore/mirlib/maxdimc.h>
 #include <casacore/mirlib/miriad.h>
@@ -101,6 +106,7 @@ MIRIADImage::MIRIADImage (const MIRIADImage& other)
   unit_p      (other.unit_p),
   rec_p       (other.rec_p),
   pTiledFile_p(other.pTiledFile_p),
+  pMapped_p   (other.pMapped_p),
   pPixelMask_p(0),
   shape_p     (other.shape_p),
   hasBlanks_p (other.hasBlanks_p),
@@ -122,6 +128,7 @@ MIRIADImage& MIRIADImage::operator=(const MIRIADImage& other)
       ImageInterface<Float>::operator= (other);
 //
       pTiledFile_p = other.pTiledFile_p;             // Counted pointer
+      pMapped_p    = other.pMapped_p;
 //
       delete pPixelMask_p;
       pPixelMask_p = 0;
@@ -206,9 +213,76 @@ Bool MIRIADImage::doGetSlice(Array<Float>& buffer,
                            const Slicer& section)
 {
    reopenIfNeeded();
-   pTiledFile_p->get (buffer, section);
+   getSliceMapped (buffer, section);
    return False;                            // Not a reference
 } 
+
+void MIRIADImage::getSliceMapped (Array<Float>& buffer,
+                                  const Slicer& section) const
+{
+// Determine the length of the runs of pixels to convert at once. With unit
+// strides the leading axes covering the full image axis are contiguous.
+
+   const IPosition& shape = shape_p.shape();
+   const IPosition& start = section.start();
+   const IPosition& length = section.length();
+   const IPosition& stride = section.stride();
+   const uInt ndim = shape.size();
+   const Bool contiguous = stride.allOne();
+   uInt runAxes = 1;
+   Int64 runLength = length[0];
+   while (contiguous  &&  runAxes < ndim  &&
+          length[runAxes-1] == shape[runAxes-1]) {
+      runLength *= length[runAxes];
+      ++runAxes;
+   }
+   buffer.resize (length);
+   if (buffer.empty()) {
+      return;
+   }
+   const Int64 nrun = length.product() / runLength;
+   const Int64 blockSize = 256*1024;
+   const Int64 nblockPerRun = (runLength + blockSize - 1) / blockSize;
+   const Int64 nblock = nrun * nblockPerRun;
+   const Int64 elemSize = sizeof(Float);
+   const char* data = static_cast<const char*>
+     (pMapped_p->getReadPointer (fileOffset_p));
+   Bool deleteIt;
+   Float* out = buffer.getStorage (deleteIt);
+// Small slices are done by the calling thread only.
+   uInt maxThreads = (length.product() < blockSize  ?  1 : 0);
+   ThreadPool::global().parallelFor (nblock, [&](size_t block) {
+      // Find the file position of the first pixel of the block.
+      Int64 run = block / nblockPerRun;
+      Int64 first = (block % nblockPerRun) * blockSize;
+      Int64 n = std::min (blockSize, runLength - first);
+      Int64 rest = run;
+      Int64 fileInx = 0;
+      Int64 fileStep = 1;
+      for (uInt i=0; i<ndim; ++i) {
+         Int64 pos = start[i];
+         if (i >= runAxes) {
+            pos += (rest % length[i]) * stride[i];
+            rest /= length[i];
+         }
+         fileInx += pos * fileStep;
+         fileStep *= shape[i];
+      }
+      Float* blockOut = out + run * runLength + first;
+      if (contiguous) {
+         CanonicalConversion::toLocal (blockOut,
+                                       data + (fileInx + first) * elemSize, n);
+      } else {
+         const Int64 step = stride[0] * elemSize;
+         const char* in = data + (fileInx + first * stride[0]) * elemSize;
+         for (Int64 i=0; i<n; ++i) {
+            CanonicalConversion::toLocal (blockOut[i], in);
+            in += step;
+         }
+      }
+   }, maxThreads);
+   buffer.putStorage (out, deleteIt);
+}
    
 
 void MIRIADImage::doPutSlice (const Array<Float>&, const IPosition&,
@@ -317,6 +391,7 @@ void MIRIADImage::tempClose()
    if (! isClosed_p) {
       delete pPixelMask_p;
       pTiledFile_p.reset();
+      pMapped_p.reset();
       isClosed_p = True;
    }
 }
@@ -441,6 +516,16 @@ void MIRIADImage::open()
                                                     dataType_p, TSMOption(),
                                                     writable, canonical);
 
+   // Map the image file for reading the pixels.
+
+   pMapped_p = std::make_shared<MMapIO>(RegularFile(iname));
+   Int64 fileSize = fileOffset_p + shape_p.shape().product() * Int64(sizeof(Float));
+   if (pMapped_p->getFileSize() < fileSize) {
+      pMapped_p.reset();
+      pTiledFile_p.reset();
+      throw AipsError ("MIRIADImage: image file " + iname + " is too small");
+   }
+
    // Shares the pTiledFile_p pointer. 
 
    if (hasBlanks_p) {
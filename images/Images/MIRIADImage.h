@@ -43,6 +43,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
 template <class T> class Lattice;
+class MMapIO;
 //
 class MaskSpecifier;
 class IPosition;
@@ -75,6 +76,12 @@ class FitsInput;
 //  with the TiledFileAccess class.  -- or -- the native miriad I/O routines.
 //  The MIRIADImage is read only. -- really -- ??
 //
+//  The pixel data are read from the memory-mapped image file, which
+//  holds the pixels contiguously as big-endian floats. Large slices are
+//  read by multiple threads, each converting a part of the slice. Because
+//  the mapped file is only read, different threads can also get slices
+//  (e.g. different planes) from the same image at the same time.
+//  The TiledFileAccess object is only used for its cache functions.
 // </synopsis> 
 
 // <example>
@@ -259,6 +266,7 @@ private:
   Unit           unit_p;
   Record         rec_p;
   std::shared_ptr<TiledFileAccess> pTiledFile_p;
+  std::shared_ptr<MMapIO> pMapped_p;              // mapped image file
   Lattice<Bool>* pPixelMask_p;
   //  Float          scale_p;
   //  Float          offset_p;
@@ -279,6 +287,10 @@ private:
 // Open the image (used by setup and reopen).
    void open();
 
+// Read a slice from the mapped image file. The contiguous runs of
+// pixels in the slice are split into blocks which are converted in parallel.
+   void getSliceMapped (Array<Float>& buffer, const Slicer& section) const;
+
 // Fish things out of the MIRIAD file
    void getImageAttributes (CoordinateSystem& cSys,
                             IPosition& shape, ImageInfo& info,
@@ -364,6 +364,13 @@ public:
   // unchanged from when setCacheSize was called
   virtual void clearCache();
 
+  // Let <src>getSlice</src> return a reference to the image data in a
+  // memory-mapped file instead of a copy if possible.
+  // See <linkto class=PagedArray>PagedArray::useMappedTiles</linkto>
+  // for the conditions and the restrictions on the returned array.
+  void useMappedTiles (Bool useMapped)
+    { map_p.useMappedTiles (useMapped); }
+
   // Report on cache success.
   virtual void showCacheStatistics (ostream& os) const;
 
@@ -147,6 +147,10 @@ public:
   // It is if its parent image or its region is masked.
   virtual Bool isMasked() const;
 
+  // Is it cheaply known that the mask is False for the section?
+  // It is if its parent image or its region tells so.
+  virtual Bool isMaskedOut (const Slicer& section) const;
+
   // Does the image object have a pixelmask?
   // It does if its parent has a pixelmask.
   virtual Bool hasPixelMask() const;
@@ -172,6 +176,13 @@ public:
   // Is the SubImage writable?
   virtual Bool isWritable() const;
 
+  // Set or get the switch telling if data masked out by the region
+  // should not be read (see <linkto class=SubLattice>SubLattice</linkto>).
+  // <group>
+  void setSkipMasked (Bool skip);
+  Bool skipMasked() const;
+  // </group>
+
   // Get the region/mask object describing this subImage.
   virtual const LatticeRegion* getRegionPtr() const;
 
@@ -259,6 +259,12 @@ Bool SubImage<T>::isMasked() const
   return itsSubLatPtr->isMasked();
 }
 
+template<class T>
+Bool SubImage<T>::isMaskedOut (const Slicer& section) const
+{
+  return itsSubLatPtr->isMaskedOut (section);
+}
+
 template<class T>
 Bool SubImage<T>::isPersistent() const
 {
@@ -300,6 +306,17 @@ Lattice<Bool>& SubImage<T>::pixelMask()
   return itsSubLatPtr->pixelMask();
 }
 
+template<class T>
+void SubImage<T>::setSkipMasked (Bool skip)
+{
+  itsSubLatPtr->setSkipMasked (skip);
+}
+template<class T>
+Bool SubImage<T>::skipMasked() const
+{
+  return itsSubLatPtr->skipMasked();
+}
+
 template<class T>
 const LatticeRegion* SubImage<T>::getRegionPtr() const
 {
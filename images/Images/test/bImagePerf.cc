@@ -0,0 +1,299 @@
+//# bImagePerf.cc: Benchmark lattice and image access patterns
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/images/Images/PagedImage.h>
+#include <casacore/images/Images/HDF5Image.h>
+#include <casacore/images/Images/FITSImage.h>
+#include <casacore/images/Images/ImageFITSConverter.h>
+#include <casacore/lattices/Lattices/PagedArray.h>
+#include <casacore/lattices/Lattices/LatticeIterator.h>
+#include <casacore/lattices/Lattices/LatticeStepper.h>
+#include <casacore/lattices/Lattices/TiledLineStepper.h>
+#include <casacore/lattices/Lattices/TileStepper.h>
+#include <casacore/lattices/Lattices/TiledShape.h>
+#include <casacore/coordinates/Coordinates/CoordinateUtil.h>
+#include <casacore/tables/Tables/TableUtil.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/HDF5/HDF5Object.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/OS/Benchmark.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+
+using namespace casacore;
+using namespace std;
+
+// This program benchmarks reading a 3-dim lattice (RA,DEC,FREQ) stored as
+// PagedArray, PagedImage, HDF5Image and FITSImage using three access
+// patterns: planes, spectra and tiles. For the tiled formats a set of
+// tile shapes and maximum cache sizes is used, so it can also be used to
+// choose a tile shape for new images. For the table-based formats the
+// number of tile accesses and reads and the resulting cache hit rate are
+// reported as counters.
+// HDF5Image is skipped if casacore is built without HDF5.
+//
+// It is built by 'make bench'. Run it as:
+//    bImagePerf [nx [ny [nz]]] [benchmark options]
+// E.g., to only run the spectrum access of a PagedArray:
+//    bImagePerf --benchmark_filter='PagedArray.*spectrum'
+
+uInt nx = 256;
+uInt ny = 256;
+uInt nz = 64;
+
+IPosition latShape()
+  { return IPosition(3, nx, ny, nz); }
+
+// A lattice stored in a file with a given tile shape.
+struct LatticeCase
+{
+  String name;                 // type and tile shape
+  String fileName;
+  IPosition tileShape;         // empty means default
+  Bool isTable;                // can the file be deleted as a table?
+  Bool cacheSweep;             // use various maximum cache sizes?
+  std::function<Lattice<Float>*()> open;
+};
+
+// Fill a lattice plane by plane with some values.
+void fill (Lattice<Float>& lat)
+{
+  Array<Float> plane(IPosition(3, nx, ny, 1));
+  for (uInt z=0; z<nz; ++z) {
+    indgen (plane, Float(z));
+    lat.putSlice (plane, IPosition(3, 0, 0, z));
+  }
+}
+
+String tileName (const IPosition& tileShape)
+{
+  if (tileShape.empty()) {
+    return "tile=default";
+  }
+  ostringstream oss;
+  oss << "tile=" << tileShape;
+  return oss.str();
+}
+
+// Create the lattice files for all cases.
+std::vector<LatticeCase> makeCases()
+{
+  // Tile shapes good for plane, spectrum, and mixed access.
+  std::vector<IPosition> tileShapes {
+    IPosition(),
+    IPosition(3, std::min(nx,256u), std::min(ny,256u), 1),
+    IPosition(3, std::min(nx,8u), std::min(ny,8u), nz),
+    IPosition(3, std::min(nx,32u), std::min(ny,32u), std::min(nz,32u))};
+  CoordinateSystem csys = CoordinateUtil::defaultCoords3D();
+  std::vector<LatticeCase> cases;
+  uInt i = 0;
+  for (const IPosition& tileShape : tileShapes) {
+    TiledShape tshape = (tileShape.empty()  ?  TiledShape(latShape()) :
+                         TiledShape(latShape(), tileShape));
+    String fileName = "bImagePerf_tmp.pa" + String::toString(i);
+    {
+      PagedArray<Float> pa(tshape, fileName);
+      fill (pa);
+    }
+    cases.push_back (LatticeCase {"PagedArray/" + tileName(tileShape),
+          fileName, tileShape, True, True,
+          [fileName]() { return new PagedArray<Float>(fileName); }});
+    if (HDF5Object::hasHDF5Support()) {
+      fileName = "bImagePerf_tmp.h5_" + String::toString(i);
+      {
+        HDF5Image<Float> img(tshape, csys, fileName);
+        fill (img);
+      }
+      cases.push_back (LatticeCase {"HDF5Image/" + tileName(tileShape),
+            fileName, tileShape, False, True,
+            [fileName]() { return new HDF5Image<Float>(fileName); }});
+    }
+    ++i;
+  }
+  // A PagedImage and FITSImage with the default tiling.
+  String imgName ("bImagePerf_tmp.img");
+  {
+    PagedImage<Float> img(TiledShape(latShape()), csys, imgName);
+    fill (img);
+    String error;
+    if (! ImageFITSConverter::ImageToFITS (error, img, "bImagePerf_tmp.fits",
+                                           64, True, True, -32, 1, -1,
+                                           True, False, False)) {
+      throw AipsError ("Could not create FITS file: " + error);
+    }
+  }
+  cases.push_back (LatticeCase {"PagedImage/" + tileName(IPosition()),
+        imgName, IPosition(), True, True,
+        [imgName]() { return new PagedImage<Float>(imgName); }});
+  cases.push_back (LatticeCase {"FITSImage", "bImagePerf_tmp.fits",
+        IPosition(), False, False,
+        []() { return new FITSImage("bImagePerf_tmp.fits"); }});
+  return cases;
+}
+
+void removeCases (const std::vector<LatticeCase>& cases)
+{
+  for (const LatticeCase& lc : cases) {
+    if (lc.isTable) {
+      TableUtil::deleteTable (lc.fileName, True);
+    } else if (File(lc.fileName).exists()) {
+      RegularFile(lc.fileName).remove();
+    }
+  }
+}
+
+// Get the tile cache statistics of a table-based lattice.
+// False is returned if not table-based.
+Bool cacheCounts (Lattice<Float>& lat, Int64& naccess, Int64& nread)
+{
+  Table tab;
+  if (auto pa = dynamic_cast<PagedArray<Float>*>(&lat)) {
+    tab = pa->table();
+  } else if (auto img = dynamic_cast<PagedImage<Float>*>(&lat)) {
+    tab = img->table();
+  } else {
+    return False;
+  }
+  naccess = nread = 0;
+  Record dms = tab.ioStatistics().subRecord ("DATAMANAGERS");
+  for (uInt i=0; i<dms.nfields(); ++i) {
+    const Record& caches = dms.subRecord(i).subRecord ("CACHE");
+    for (uInt j=0; j<caches.nfields(); ++j) {
+      if (caches.dataType(j) == TpRecord) {
+        const Record& cache = caches.subRecord(j);
+        if (cache.isDefined ("NACCESS")) {
+          naccess += cache.asInt64 ("NACCESS");
+          nread   += cache.asInt64 ("NREAD");
+        }
+      }
+    }
+  }
+  return True;
+}
+
+// Read the lattice with the given access pattern.
+// It returns the sum of the values to avoid the reads being optimized away.
+Double readLattice (Lattice<Float>& lat, const String& pattern)
+{
+  IPosition shape = lat.shape();
+  IPosition tileShape = lat.niceCursorShape();
+  std::unique_ptr<LatticeNavigator> nav;
+  if (pattern == "plane") {
+    nav.reset (new LatticeStepper(shape, IPosition(3, nx, ny, 1)));
+  } else if (pattern == "spectrum") {
+    nav.reset (new TiledLineStepper(shape, tileShape, 2));
+  } else {
+    nav.reset (new TileStepper(shape, tileShape));
+  }
+  Double sum = 0;
+  RO_LatticeIterator<Float> iter(lat, *nav);
+  for (iter.reset(); !iter.atEnd(); iter++) {
+    sum += iter.cursor().data()[0];
+  }
+  return sum;
+}
+
+void addBenchmarks (Benchmark& bench, const LatticeCase& lc)
+{
+  // Maximum cache size in pixels (0 is unlimited).
+  std::vector<uInt> cacheSizes(1, 0);
+  if (lc.cacheSweep) {
+    cacheSizes = std::vector<uInt> {0, 256*1024, 4*1024*1024};
+  }
+  for (uInt cacheSize : cacheSizes) {
+    String cacheName;
+    if (lc.cacheSweep) {
+      cacheName = "/cache=" + (cacheSize == 0  ?  String("unlimited") :
+                               String::toString(cacheSize*4/(1024*1024)) +
+                               "MiB");
+    }
+    for (const String pattern : {"plane", "spectrum", "tile"}) {
+      auto open = lc.open;
+      bench.add (lc.name + cacheName + '/' + pattern,
+                 [open, cacheSize, pattern](BenchmarkState& state) {
+          // Open the lattice for each iteration, so the cache is empty.
+          state.pauseTiming();
+          std::unique_ptr<Lattice<Float>> lat (open());
+          if (cacheSize > 0) {
+            lat->setMaximumCacheSize (cacheSize);
+          }
+          state.resumeTiming();
+          Double sum = readLattice (*lat, pattern);
+          state.pauseTiming();
+          Int64 naccess, nread;
+          if (cacheCounts (*lat, naccess, nread)) {
+            state.addCounter ("naccess", naccess);
+            state.addCounter ("nread", nread);
+            state.addCounter ("hit_pct", naccess == 0  ?  0. :
+                              100. * (naccess - nread) / naccess);
+          }
+          state.setLabel ("tile=" +
+                          String::toString(lat->niceCursorShape()));
+          lat.reset();
+          state.resumeTiming();
+          state.addBytes (uInt64(nx)*ny*nz * sizeof(Float));
+          state.addItems (uInt64(nx)*ny*nz);
+          if (sum < 0) {
+            cout << sum << endl;
+          }
+        });
+    }
+  }
+}
+
+int main (int argc, const char* argv[])
+{
+  std::vector<LatticeCase> cases;
+  try {
+    Benchmark bench(argc, argv);
+    const std::vector<String>& args = bench.arguments();
+    if (args.size() > 0) {
+      nx = std::max(1, atoi(args[0].chars()));
+    }
+    if (args.size() > 1) {
+      ny = std::max(1, atoi(args[1].chars()));
+    }
+    if (args.size() > 2) {
+      nz = std::max(1, atoi(args[2].chars()));
+    }
+    cout << "bImagePerf: shape=" << latShape() << " Float" << endl;
+    cases = makeCases();
+    for (const LatticeCase& lc : cases) {
+      addBenchmarks (bench, lc);
+    }
+    int status = bench.run();
+    removeCases (cases);
+    return status;
+  } catch (const std::exception& x) {
+    cerr << "Exception: " << x.what() << endl;
+    removeCases (cases);
+    return 1;
+  }
+}
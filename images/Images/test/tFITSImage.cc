@@ -25,6 +25,7 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Inputs/Input.h>
@@ -157,6 +158,46 @@ try {
    AlwaysAssert(allNear(pLoadImage->get(), pLoadImage->getMask(), fitsArray2, fitsMask2, 0.0, 0.001), AipsError);
    delete pLoadImage;
 
+// Reading directly from the file must give the same result as
+// reading through the tile cache (for float and scaled short data).
+   for (uInt i=0; i<2; i++) {
+      FITSImage img(i==0 ? in : file);
+      Array<Float> tiled = img.get();
+      Int64 directSize = FITSImage::directReadSize();
+      FITSImage::setDirectReadSize (1);
+      AlwaysAssert(allNear(img.get(), img.getMask(), tiled, img.getMask(),
+                           0.0, 0.0), AipsError);
+      IPosition blc(img.ndim(), 0);
+      IPosition len(img.shape());
+      blc(0) = 1;
+      len(0) -= 1;
+      Slicer slicer(blc, len);
+      AlwaysAssert(allNear(img.getSlice(slicer), img.getMaskSlice(slicer),
+                           tiled(slicer), img.getMaskSlice(slicer),
+                           0.0, 0.0), AipsError);
+      FITSImage::setDirectReadSize (directSize);
+   }
+
+// Write and read back a lossless tile-compressed image.
+   String compFile = "imagetestimage3.fits";
+   AlwaysAssert(ImageFITSConverter::ImageToCompressedFITS
+                (error, fitsImage, compFile, "GZIP", IPosition(), 0, True),
+                AipsError);
+   {
+      FITSImage compImage(compFile, 0, 1);
+      AlwaysAssert(compImage.shape() == fitsImage.shape(), AipsError);
+      AlwaysAssert(compImage.coordinates().near(fitsCS), AipsError);
+      AlwaysAssert(allNear(compImage.get(), compImage.getMask(),
+                           fitsArray2, fitsMask2, 0.0, 0.0), AipsError);
+      ImageInterface<Float>* pCompImage = 0;
+      AlwaysAssert(ImageFITSConverter::FITSToImage(pCompImage, error,
+                                                   imageName, compFile,
+                                                   0, 1), AipsError);
+      AlwaysAssert(allNear(pCompImage->get(), pCompImage->getMask(),
+                           fitsArray2, fitsMask2, 0.0, 0.0), AipsError);
+      delete pCompImage;
+   }
+
 
 } catch (std::exception& x) {
    cout << "aipserror: error " << x.what() << endl;
@@ -24,10 +24,62 @@
 //#                        Charlottesville, VA 22903-2475 USA
 
 #include <casacore/images/Images/ImageExprParse.h>
+#include <casacore/lattices/LEL/LatticeExpr.h>
+#include <casacore/lattices/Lattices/PagedArray.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/namespace.h>
 
+// Test an expression using an image multiple times and the parse cache.
+void testCache()
+{
+    IPosition shape(2, 20, 10);
+    Array<Float> arra(shape);
+    Array<Float> arrb(shape);
+    indgen (arra);
+    indgen (arrb, Float(3), Float(-0.5));
+    {
+        PagedArray<Float> a(shape, "tImageExprParse_tmp.a");
+        PagedArray<Float> b(shape, "tImageExprParse_tmp.b");
+        a.put (arra);
+        b.put (arrb);
+    }
+    String expr("(tImageExprParse_tmp.a - tImageExprParse_tmp.b) * "
+                "(tImageExprParse_tmp.a - tImageExprParse_tmp.b)");
+    ImageExprParse::setCacheSize (0);
+    AlwaysAssertExit (ImageExprParse::cacheSize() == 0);
+    LatticeExprNode node1 = ImageExprParse::command (expr);
+    AlwaysAssertExit (ImageExprParse::getImageNames().size() == 4);
+    AlwaysAssertExit (allNear (LatticeExpr<Float>(node1).get(),
+                               (arra-arrb) * (arra-arrb), 1e-5));
+    // Without cache the expression is parsed again.
+    LatticeExprNode node2 = ImageExprParse::command (expr);
+    AlwaysAssertExit (node1.makeFloat() != node2.makeFloat());
+    // With cache the parsed expression is reused.
+    ImageExprParse::setCacheSize (2);
+    AlwaysAssertExit (ImageExprParse::cacheSize() == 2);
+    node1 = ImageExprParse::command (expr);
+    node2 = ImageExprParse::command (expr);
+    AlwaysAssertExit (node1.makeFloat() == node2.makeFloat());
+    AlwaysAssertExit (ImageExprParse::getImageNames().size() == 4);
+    AlwaysAssertExit (allNear (LatticeExpr<Float>(node2).get(),
+                               (arra-arrb) * (arra-arrb), 1e-5));
+    // Another directory is another key.
+    node2 = ImageExprParse::command (expr, ".");
+    AlwaysAssertExit (node1.makeFloat() != node2.makeFloat());
+    // The least recently used expression is removed.
+    ImageExprParse::command ("tImageExprParse_tmp.a + 1");
+    node2 = ImageExprParse::command (expr);
+    AlwaysAssertExit (node1.makeFloat() != node2.makeFloat());
+    ImageExprParse::clearCache();
+    node1 = ImageExprParse::command (expr);
+    AlwaysAssertExit (node1.makeFloat() != node2.makeFloat());
+    ImageExprParse::setCacheSize (0);
+}
+
 int main() {
     try {
         Bool thrown = False;
@@ -38,6 +90,9 @@ int main() {
             thrown = True;
         }
         AlwaysAssert(thrown, AipsError);
+        testCache();
+        Table::deleteTable ("tImageExprParse_tmp.a");
+        Table::deleteTable ("tImageExprParse_tmp.b");
         cout<< "ok"<< endl;
     }
     catch (const std::exception& x) {
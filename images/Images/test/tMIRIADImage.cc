@@ -25,6 +25,8 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Inputs/Input.h>
@@ -41,6 +43,11 @@
 #include <casacore/coordinates/Coordinates/CoordinateSystem.h>
 
 #include <casacore/casa/iostream.h>
+#if defined(USE_THREADS)
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
 
 #include <casacore/casa/namespace.h>
 Bool allNear (const Array<Float>& data, const Array<Bool>& dataMask,
@@ -138,6 +145,55 @@ try {
    delete pTempImage;
 //
    AlwaysAssert(allNear(dataArray, dataMask, mirArray, mirMask), AipsError);
+
+// Strided and partial slices give the same values as the full array.
+
+   {
+      const IPosition& mirShape = mirImage.shape();
+      IPosition stride (mirImage.ndim(), 2);
+      Slicer strided (IPosition(mirImage.ndim(), 0), (mirShape+1)/2, stride);
+      AlwaysAssert(allEQ(mirImage.getSlice(strided), mirArray(strided)),
+                   AipsError);
+      Slicer part (mirShape/4, mirShape/2);
+      AlwaysAssert(allEQ(mirImage.getSlice(part), mirArray(part)), AipsError);
+   }
+#if defined(USE_THREADS)
+
+// Planes read by several threads at the same time give the same values
+// as the full array read serially.
+
+   {
+      const IPosition& mirShape = mirImage.shape();
+      const uInt ndim = mirImage.ndim();
+      const Int64 nplane = ndim < 2 ? 1 : mirShape.product() /
+                                          (mirShape[0] * mirShape[1]);
+      const uInt nthread = 4;
+      std::atomic<uInt> nerr(0);
+      std::vector<std::thread> threads;
+      for (uInt t=0; t<nthread; ++t) {
+         threads.push_back (std::thread([&, t]() {
+            for (Int64 plane=t; plane<nplane; plane+=nthread) {
+               IPosition start(ndim, 0);
+               IPosition length(mirShape);
+               Int64 rest = plane;
+               for (uInt i=2; i<ndim; ++i) {
+                  start[i] = rest % mirShape[i];
+                  rest /= mirShape[i];
+                  length[i] = 1;
+               }
+               Slicer slicer(start, length);
+               if (! allEQ(mirImage.getSlice(slicer), mirArray(slicer))) {
+                  nerr++;
+               }
+            }
+         }));
+      }
+      for (std::thread& thr : threads) {
+         thr.join();
+      }
+      AlwaysAssert(nerr == 0, AipsError);
+   }
+#endif
    AlwaysAssert(mirCS.near(dataCS), AipsError);
 
 // Test Clone
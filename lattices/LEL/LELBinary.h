@@ -120,6 +120,9 @@ public:
 // Recursively efvaluate the scalar expression 
    virtual LELScalar<T> getScalar() const;
 
+// Add the operands and operation to a fused program.
+   virtual void fuse (LELFused<T>& fused) const;
+
 // Do further preparations (e.g. optimization) on the expression.
    virtual Bool prepareScalarExpr();
 
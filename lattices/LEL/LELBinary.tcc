@@ -29,6 +29,7 @@
 #include <casacore/lattices/LEL/LELBinary.h>
 #include <casacore/lattices/LEL/LELScalar.h>
 #include <casacore/lattices/LEL/LELArray.h>
+#include <casacore/lattices/LEL/LELFused.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
@@ -83,13 +84,13 @@ void LELBinary<T>::eval(LELArray<T>& result,
    switch(op_p) {
    case LELBinaryEnums::ADD :
        if (pLeftExpr_p->isScalar()) {
-	  pRightExpr_p->eval(result, section);
+	  pRightExpr_p->evalCached (result, section);
 	  result.value() += pLeftExpr_p->getScalar().value();
        } else if (pRightExpr_p->isScalar()) {
-	  pLeftExpr_p->eval(result, section);
+	  pLeftExpr_p->evalCached (result, section);
 	  result.value() += pRightExpr_p->getScalar().value();
        } else {
-	  pLeftExpr_p->eval(result, section);
+	  pLeftExpr_p->evalCached (result, section);
 	  LELArrayRef<T> temp(result.shape());
 	  pRightExpr_p->evalRef(temp, section);
 	  result.value() += temp.value();
@@ -99,13 +100,13 @@ void LELBinary<T>::eval(LELArray<T>& result,
 
    case LELBinaryEnums::SUBTRACT:
        if (pLeftExpr_p->isScalar()) {
-          pRightExpr_p->eval(result, section);
+          pRightExpr_p->evalCached (result, section);
 	  result.value() = pLeftExpr_p->getScalar().value() - result.value();
        } else if (pRightExpr_p->isScalar()) {
-          pLeftExpr_p->eval(result, section);
+          pLeftExpr_p->evalCached (result, section);
 	  result.value() -= pRightExpr_p->getScalar().value();
        } else {
-	  pLeftExpr_p->eval(result, section);
+	  pLeftExpr_p->evalCached (result, section);
           LELArrayRef<T> temp(result.shape());
 	  pRightExpr_p->evalRef(temp, section);
 	  result.value() -= temp.value();
@@ -114,13 +115,13 @@ void LELBinary<T>::eval(LELArray<T>& result,
        break;
    case LELBinaryEnums::MULTIPLY:
        if (pLeftExpr_p->isScalar()) {
-	  pRightExpr_p->eval(result, section);
+	  pRightExpr_p->evalCached (result, section);
 	  result.value() *= pLeftExpr_p->getScalar().value();
        } else if (pRightExpr_p->isScalar()) {
-	  pLeftExpr_p->eval(result, section);
+	  pLeftExpr_p->evalCached (result, section);
 	  result.value() *= pRightExpr_p->getScalar().value();
        } else {
-	  pLeftExpr_p->eval(result, section);
+	  pLeftExpr_p->evalCached (result, section);
 	  LELArrayRef<T> temp(result.shape());
 	  pRightExpr_p->evalRef(temp, section);
 	  result.value() *= temp.value();
@@ -129,13 +130,13 @@ void LELBinary<T>::eval(LELArray<T>& result,
        break;
    case LELBinaryEnums::DIVIDE:
        if (pLeftExpr_p->isScalar()) {
-          pRightExpr_p->eval(result, section);
+          pRightExpr_p->evalCached (result, section);
 	  result.value() = pLeftExpr_p->getScalar().value() / result.value();
        } else if (pRightExpr_p->isScalar()) {
-          pLeftExpr_p->eval(result, section);
+          pLeftExpr_p->evalCached (result, section);
 	  result.value() /= pRightExpr_p->getScalar().value();
        } else {
-	  pLeftExpr_p->eval(result, section);
+	  pLeftExpr_p->evalCached (result, section);
           LELArrayRef<T> temp(result.shape());
 	  pRightExpr_p->evalRef(temp, section);
 	  result.value() /= temp.value();
@@ -176,6 +177,32 @@ LELScalar<T> LELBinary<T>::getScalar() const
    return temp;
 }
 
+template <class T>
+void LELBinary<T>::fuse (LELFused<T>& fused) const
+{
+   typename LELFused<T>::Operation oper;
+   switch(op_p) {
+   case LELBinaryEnums::ADD :
+      oper = LELFused<T>::ADD;
+      break;
+   case LELBinaryEnums::SUBTRACT :
+      oper = LELFused<T>::SUBTRACT;
+      break;
+   case LELBinaryEnums::MULTIPLY :
+      oper = LELFused<T>::MULTIPLY;
+      break;
+   case LELBinaryEnums::DIVIDE :
+      oper = LELFused<T>::DIVIDE;
+      break;
+   default:
+      fused.addLeaf (*this);
+      return;
+   }
+   fused.add (*pLeftExpr_p);
+   fused.add (*pRightExpr_p);
+   fused.addOperation (oper);
+}
+
 
 template <class T>
 Bool LELBinary<T>::prepareScalarExpr()
@@ -107,7 +107,7 @@ void LELBinaryBool::eval(LELArray<Bool>& result,
 	     result.value() = True;
 	     result.removeMask();
           } else {
-	     pRightExpr_p->eval(result, section);
+	     pRightExpr_p->evalCached (result, section);
 	     // If False scalar value, result array is same as original.
 	     // If Unknown scalar, result is Unknown where not True.
 	     if (! temp.mask()) {
@@ -120,14 +120,14 @@ void LELBinaryBool::eval(LELArray<Bool>& result,
 	     result.value() = True;
 	     result.removeMask();
           } else {
-	     pLeftExpr_p->eval(result, section);
+	     pLeftExpr_p->evalCached (result, section);
 	     if (! temp.mask()) {
 		result.combineOrAnd (True, result.value());
 	     }
 	  }
        } else {
           LELArrayRef<Bool> temp(result.shape());
-	  pLeftExpr_p->eval(result, section);
+	  pLeftExpr_p->evalCached (result, section);
 	  pRightExpr_p->evalRef(temp, section);
 	  if (temp.isMasked()) {
 	     result.combineOrAnd (True, result.value(), temp.value(),
@@ -146,7 +146,7 @@ void LELBinaryBool::eval(LELArray<Bool>& result,
 	     result.value() = False;
 	     result.removeMask();
           } else {
-	     pRightExpr_p->eval(result, section);
+	     pRightExpr_p->evalCached (result, section);
 	     // If True scalar value, result array is same as original.
 	     // If Unknown scalar, result is Unknown where not False.
 	     if (! temp.mask()) {
@@ -159,14 +159,14 @@ void LELBinaryBool::eval(LELArray<Bool>& result,
 	     result.value() = False;
 	     result.removeMask();
           } else {
-	     pLeftExpr_p->eval(result, section);
+	     pLeftExpr_p->evalCached (result, section);
 	     if (! temp.mask()) {
 		result.combineOrAnd (False, result.value());
 	     }
 	  }
        } else {
           LELArrayRef<Bool> temp(result.shape());
-	  pLeftExpr_p->eval(result, section);
+	  pLeftExpr_p->evalCached (result, section);
 	  pRightExpr_p->evalRef(temp, section);
 	  if (temp.isMasked()) {
 	     result.combineOrAnd (False, result.value(), temp.value(),
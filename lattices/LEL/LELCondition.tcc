@@ -78,7 +78,7 @@ void LELCondition<T>::eval (LELArray<T>& result,
 #endif
 
    LELArrayRef<Bool> condval(result.shape());
-   pExpr_p->eval (result, section);
+   pExpr_p->evalCached (result, section);
    pCond_p->evalRef (condval, section);
    result.combineMask (condval);
    result.combineMask (condval.value());
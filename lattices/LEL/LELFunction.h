@@ -120,6 +120,9 @@ public:
 // Recursively evaluate the scalar expression.
    virtual LELScalar<T> getScalar() const;
 
+// Add the operand and function to a fused program.
+   virtual void fuse (LELFused<T>& fused) const;
+
 // Do further preparations (e.g. optimization) on the expression.
    virtual Bool prepareScalarExpr();
 
@@ -222,6 +225,9 @@ public:
 // Recursively evaluate the scalar expression 
    virtual LELScalar<T> getScalar() const;
 
+// Add the operand and function to a fused program.
+   virtual void fuse (LELFused<T>& fused) const;
+
 // Do further preparations (e.g. optimization) on the expression.
    virtual Bool prepareScalarExpr();
 
@@ -433,6 +439,9 @@ public:
 // Recursively evaluate the scalar expression 
    virtual LELScalar<Float> getScalar() const;
 
+// Add the operands and function to a fused program.
+   virtual void fuse (LELFused<Float>& fused) const;
+
 // Do further preparations (e.g. optimization) on the expression.
    virtual Bool prepareScalarExpr();
 
@@ -545,6 +554,9 @@ public:
 // Recursively evaluate the scalar expression 
    virtual LELScalar<Double> getScalar() const;
 
+// Add the operands and function to a fused program.
+   virtual void fuse (LELFused<Double>& fused) const;
+
 // Do further preparations (e.g. optimization) on the expression.
    virtual Bool prepareScalarExpr();
 
@@ -31,6 +31,7 @@
 #include <casacore/lattices/LEL/LELFunctionEnums.h>
 #include <casacore/lattices/LEL/LELScalar.h>
 #include <casacore/lattices/LEL/LELArray.h>
+#include <casacore/lattices/LEL/LELFused.h>
 #include <casacore/lattices/LatticeMath/LatticeFractile.h>
 #include <casacore/lattices/LEL/LatticeExpr.h>
 #include <casacore/lattices/Lattices/MaskedLatticeIterator.h>
@@ -98,7 +99,7 @@ void LELFunction1D<T>::eval(LELArray<T>& result,
 #endif
 
 // Evaluate the expression
-   pExpr_p->eval(result, section);
+   pExpr_p->evalCached (result, section);
 
 // Apply the 1D function
    switch(function_p) {
@@ -395,6 +396,44 @@ LELScalar<T> LELFunction1D<T>::getScalar() const
    return pExpr_p->getScalar();         // to make compiler happy
 }
 
+template <class T>
+void LELFunction1D<T>::fuse (LELFused<T>& fused) const
+{
+   typename LELFused<T>::Operation oper;
+   switch (function_p) {
+   case LELFunctionEnums::SIN :
+      oper = LELFused<T>::SIN;
+      break;
+   case LELFunctionEnums::SINH :
+      oper = LELFused<T>::SINH;
+      break;
+   case LELFunctionEnums::COS :
+      oper = LELFused<T>::COS;
+      break;
+   case LELFunctionEnums::COSH :
+      oper = LELFused<T>::COSH;
+      break;
+   case LELFunctionEnums::EXP :
+      oper = LELFused<T>::EXP;
+      break;
+   case LELFunctionEnums::LOG :
+      oper = LELFused<T>::LOG;
+      break;
+   case LELFunctionEnums::LOG10 :
+      oper = LELFused<T>::LOG10;
+      break;
+   case LELFunctionEnums::SQRT :
+      oper = LELFused<T>::SQRT;
+      break;
+   default:
+      // VALUE removes the mask, so its operand cannot be fused.
+      fused.addLeaf (*this);
+      return;
+   }
+   fused.add (*pExpr_p);
+   fused.addOperation (oper);
+}
+
 template <class T>
 Bool LELFunction1D<T>::prepareScalarExpr()
 {
@@ -476,7 +515,7 @@ void LELFunctionReal1D<T>::eval(LELArray<T>& result,
 #endif
 
 // Evaluate the expression
-   pExpr_p->eval(result, section);
+   pExpr_p->evalCached (result, section);
 
 // Apply the Real1D function
    switch(function_p) {
@@ -593,6 +632,34 @@ LELScalar<T> LELFunctionReal1D<T>::getScalar() const
    return pExpr_p->getScalar();         // to make compiler happy
 }
 
+template <class T>
+void LELFunctionReal1D<T>::fuse (LELFused<T>& fused) const
+{
+   typename LELFused<T>::Operation oper;
+   switch (function_p) {
+   case LELFunctionEnums::ASIN :
+      oper = LELFused<T>::ASIN;
+      break;
+   case LELFunctionEnums::ACOS :
+      oper = LELFused<T>::ACOS;
+      break;
+   case LELFunctionEnums::TAN :
+      oper = LELFused<T>::TAN;
+      break;
+   case LELFunctionEnums::TANH :
+      oper = LELFused<T>::TANH;
+      break;
+   case LELFunctionEnums::ATAN :
+      oper = LELFused<T>::ATAN;
+      break;
+   default:
+      fused.addLeaf (*this);
+      return;
+   }
+   fused.add (*pExpr_p);
+   fused.addOperation (oper);
+}
+
 template <class T>
 Bool LELFunctionReal1D<T>::prepareScalarExpr()
 {
@@ -26,6 +26,7 @@
 #include <casacore/lattices/LEL/LELFunction.h>
 #include <casacore/lattices/LEL/LELFunctionEnums.h>
 #include <casacore/lattices/LEL/LELArray.h>
+#include <casacore/lattices/LEL/LELFused.h>
 #include <casacore/lattices/LEL/LELScalar.h>
 #include <casacore/lattices/LatticeMath/LatticeFractile.h>
 #include <casacore/lattices/LEL/LatticeExpr.h>
@@ -455,6 +456,53 @@ LELScalar<Float> LELFunctionFloat::getScalar() const
    return LELScalar<Float>();
 }
 
+void LELFunctionFloat::fuse (LELFused<Float>& fused) const
+{
+   if (arg_p.nelements() == 1) {
+      if (function_p == LELFunctionEnums::ABS  &&
+          arg_p[0].dataType() == TpFloat) {
+         arg_p[0].fuse (fused);
+         fused.addOperation (LELFused<Float>::ABS);
+         return;
+      }
+   } else if (arg_p.nelements() == 2  &&
+              arg_p[0].dataType() == TpFloat  &&
+              arg_p[1].dataType() == TpFloat) {
+      LELFused<Float>::Operation oper;
+      switch (function_p) {
+      case LELFunctionEnums::ATAN2 :
+         oper = LELFused<Float>::ATAN2;
+         break;
+      case LELFunctionEnums::POW :
+         oper = LELFused<Float>::POW;
+         break;
+      case LELFunctionEnums::FMOD :
+         oper = LELFused<Float>::FMOD;
+         break;
+      case LELFunctionEnums::MIN :
+         oper = LELFused<Float>::MIN;
+         break;
+      case LELFunctionEnums::MAX :
+         oper = LELFused<Float>::MAX;
+         break;
+      default:
+         fused.addLeaf (*this);
+         return;
+      }
+      arg_p[0].fuse (fused);
+// Squaring is done by a multiplication (as in eval).
+      if (oper == LELFused<Float>::POW  &&  arg_p[1].isScalar()  &&
+          !arg_p[1].isInvalidScalar()  &&  arg_p[1].getFloat() == 2) {
+         fused.addOperation (LELFused<Float>::SQUARE);
+      } else {
+         arg_p[1].fuse (fused);
+         fused.addOperation (oper);
+      }
+      return;
+   }
+   fused.addLeaf (*this);
+}
+
 Bool LELFunctionFloat::prepareScalarExpr()
 {
 #if defined(AIPS_TRACE)
@@ -1039,6 +1087,53 @@ uInt LELFunctionDouble::nMaskedOn (const Array<Bool>& mask) const
    return nelem;
 }
 
+void LELFunctionDouble::fuse (LELFused<Double>& fused) const
+{
+   if (arg_p.nelements() == 1) {
+      if (function_p == LELFunctionEnums::ABS  &&
+          arg_p[0].dataType() == TpDouble) {
+         arg_p[0].fuse (fused);
+         fused.addOperation (LELFused<Double>::ABS);
+         return;
+      }
+   } else if (arg_p.nelements() == 2  &&
+              arg_p[0].dataType() == TpDouble  &&
+              arg_p[1].dataType() == TpDouble) {
+      LELFused<Double>::Operation oper;
+      switch (function_p) {
+      case LELFunctionEnums::ATAN2 :
+         oper = LELFused<Double>::ATAN2;
+         break;
+      case LELFunctionEnums::POW :
+         oper = LELFused<Double>::POW;
+         break;
+      case LELFunctionEnums::FMOD :
+         oper = LELFused<Double>::FMOD;
+         break;
+      case LELFunctionEnums::MIN :
+         oper = LELFused<Double>::MIN;
+         break;
+      case LELFunctionEnums::MAX :
+         oper = LELFused<Double>::MAX;
+         break;
+      default:
+         fused.addLeaf (*this);
+         return;
+      }
+      arg_p[0].fuse (fused);
+// Squaring is done by a multiplication (as in eval).
+      if (oper == LELFused<Double>::POW  &&  arg_p[1].isScalar()  &&
+          !arg_p[1].isInvalidScalar()  &&  arg_p[1].getDouble() == 2) {
+         fused.addOperation (LELFused<Double>::SQUARE);
+      } else {
+         arg_p[1].fuse (fused);
+         fused.addOperation (oper);
+      }
+      return;
+   }
+   fused.addLeaf (*this);
+}
+
 Bool LELFunctionDouble::prepareScalarExpr()
 {
 #if defined(AIPS_TRACE)
@@ -0,0 +1,209 @@
+//# LELFused.h: Evaluate a lattice expression in a single pass per chunk
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef LATTICES_LELFUSED_H
+#define LATTICES_LELFUSED_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+template <class T> class LELInterface;
+template <class T> class LELArray;
+class Slicer;
+
+
+// <summary>
+// Evaluate a lattice expression in a single pass per chunk
+// </summary>
+//
+// <use visibility=local>
+//
+// <reviewed reviewer="" date="" tests="tLatticeExpr">
+// </reviewed>
+//
+// <prerequisite>
+//   <li> <linkto class="LatticeExpr"> LatticeExpr</linkto>
+//   <li> <linkto class="LELInterface"> LELInterface</linkto>
+// </prerequisite>
+//
+// <synopsis>
+// Normally a lattice expression is evaluated by the <src>eval</src>
+// functions of the LEL letter classes, where each node of the expression
+// tree fills an array for the entire chunk. Thus an expression like
+// <src>sqrt(a^2+b^2)</src> makes several passes over the chunk and
+// allocates a temporary array for each subexpression.
+// <p>
+// LELFused compiles the element-wise numerical part of an expression
+// tree into a small stack program. The operands of that part (the leaves)
+// are the lattices and other subexpressions which cannot be fused
+// (e.g. reductions or masked subexpressions); they are evaluated for the
+// chunk using their normal <src>eval</src> function.
+// Thereafter the program is executed in blocks of a few thousand elements,
+// so all intermediate results stay in the cache. The blocks are
+// independent and are executed in parallel (using OpenMP) for large chunks.
+// Each block writes its own part of the result, so the result does not
+// depend on the number of threads.
+// <p>
+// A program is built by calling <src>add</src> for the root node of the
+// expression. It calls the virtual function <src>LELInterface::fuse</src>
+// which adds the operands and operation of a node. By default a node is
+// added as a leaf.
+// <br>Fusion is only supported for Float and Double expressions without
+// a mask; <src>isSupported</src> tells if it can be used for the data type.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   LELFused<Float> fused;
+//   fused.add (*expr);
+//   if (fused.isUseful()) {
+//     fused.eval (result, section);
+//   }
+// </srcblock>
+// </example>
+//
+// <motivation>
+// Evaluating large expressions node by node makes many passes over memory.
+// </motivation>
+
+template <class T> class LELFused
+{
+public:
+  // The operations in the program.
+  // The unary operations work on the top of the stack, the binary
+  // operations on the top two values (where the top one is the right
+  // operand) and replace them by the result.
+  enum Operation {
+    LEAF, SCALAR,
+    NEGATE, ADD, SUBTRACT, MULTIPLY, DIVIDE,
+    SQUARE, POW, MIN, MAX, ATAN2, FMOD, ABS,
+    SIN, SINH, ASIN, COS, COSH, ACOS, TAN, TANH, ATAN,
+    EXP, LOG, LOG10, SQRT
+  };
+
+  // Create an empty program.
+  LELFused();
+
+  // Tell if fused evaluation is supported for the data type.
+  static Bool isSupported();
+
+  // Add the node of an expression. A valid scalar node is added as a
+  // scalar, otherwise its <src>fuse</src> function is called.
+  void add (const LELInterface<T>& node);
+
+  // Add a node as a leaf. A node used multiple times is evaluated once.
+  void addLeaf (const LELInterface<T>& node);
+
+  // Add a scalar value.
+  void addScalar (const T& value);
+
+  // Add an operation.
+  void addOperation (Operation oper);
+
+  // Mark the program as invalid (e.g. if an invalid scalar is used).
+  void setInvalid()
+    { itsValid = False; }
+
+  // Is the program valid and does it contain at least one operation?
+  // If not, the expression can better be evaluated in the normal way.
+  Bool isUseful() const;
+
+  // Get the number of leaves.
+  uInt nleaves() const
+    { return itsLeaves.size(); }
+
+  // Evaluate the program for the given section.
+  // The result is not masked.
+  void eval (LELArray<T>& result, const Slicer& section) const;
+
+private:
+  struct Instruction {
+    Operation oper;
+    uInt      index;     //# leaf index
+    T         value;     //# scalar value
+  };
+
+  // Execute the program for the elements [start,start+n) using
+  // the stack buffer which can contain itsMaxDepth blocks.
+  void execute (T* result, const std::vector<const T*>& leaves,
+                size_t start, size_t n, T* stack) const;
+
+  std::vector<Instruction>            itsProgram;
+  std::vector<const LELInterface<T>*> itsLeaves;
+  uInt itsDepth;
+  uInt itsMaxDepth;
+  uInt itsNOper;
+  Bool itsValid;
+};
+
+
+// <summary>
+// Helper class for LELFused to evaluate the element-wise operations
+// </summary>
+// <synopsis>
+// The class is specialized for the data types for which fusion is
+// supported. Other types only get the default which does nothing.
+// </synopsis>
+template <class T> struct LELFusedMath
+{
+  static Bool isSupported()
+    { return False; }
+  static void unary (int, T*, size_t)
+    {}
+  static void binary (int, T*, const T*, size_t)
+    {}
+};
+
+// <summary>
+// Evaluate the element-wise operations for a real data type
+// </summary>
+template <class T> struct LELFusedRealMath
+{
+  static Bool isSupported()
+    { return True; }
+  // Apply a unary operation in place.
+  static void unary (int oper, T* data, size_t n);
+  // Apply a binary operation in place on the left operand.
+  static void binary (int oper, T* left, const T* right, size_t n);
+};
+
+template<> struct LELFusedMath<Float> : public LELFusedRealMath<Float>
+{};
+template<> struct LELFusedMath<Double> : public LELFusedRealMath<Double>
+{};
+
+
+
+} //# NAMESPACE CASACORE - END
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/lattices/LEL/LELFused.tcc>
+#endif //# CASACORE_NO_AUTO_TEMPLATES
+#endif
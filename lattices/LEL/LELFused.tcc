@@ -0,0 +1,329 @@
+//# LELFused.tcc: Evaluate a lattice expression in a single pass per chunk
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef LATTICES_LELFUSED_TCC
+#define LATTICES_LELFUSED_TCC
+
+#include <casacore/lattices/LEL/LELFused.h>
+#include <casacore/lattices/LEL/LELInterface.h>
+#include <casacore/lattices/LEL/LELArray.h>
+#include <casacore/lattices/LEL/LELScalar.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMathKernels.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <cmath>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# The number of elements processed at a time by the program.
+//# It is small enough to keep the stack in the cache.
+const size_t LELFusedBlockSize = 4096;
+
+
+template<class T>
+LELFused<T>::LELFused()
+: itsDepth    (0),
+  itsMaxDepth (0),
+  itsNOper    (0),
+  itsValid    (True)
+{}
+
+template<class T>
+Bool LELFused<T>::isSupported()
+{
+  return LELFusedMath<T>::isSupported();
+}
+
+template<class T>
+void LELFused<T>::add (const LELInterface<T>& node)
+{
+  if (node.isScalar()) {
+    LELScalar<T> scalar = node.getScalar();
+    if (scalar.mask()) {
+      addScalar (scalar.value());
+    } else {
+      setInvalid();
+    }
+  } else {
+    node.fuse (*this);
+  }
+}
+
+template<class T>
+void LELFused<T>::addLeaf (const LELInterface<T>& node)
+{
+  // Evaluate a leaf only once if used multiple times.
+  uInt index = std::find (itsLeaves.begin(), itsLeaves.end(), &node) -
+               itsLeaves.begin();
+  if (index == itsLeaves.size()) {
+    itsLeaves.push_back (&node);
+  }
+  Instruction instr;
+  instr.oper  = LEAF;
+  instr.index = index;
+  instr.value = T();
+  itsProgram.push_back (instr);
+  itsDepth++;
+  itsMaxDepth = std::max (itsMaxDepth, itsDepth);
+}
+
+template<class T>
+void LELFused<T>::addScalar (const T& value)
+{
+  Instruction instr;
+  instr.oper  = SCALAR;
+  instr.index = 0;
+  instr.value = value;
+  itsProgram.push_back (instr);
+  itsDepth++;
+  itsMaxDepth = std::max (itsMaxDepth, itsDepth);
+}
+
+template<class T>
+void LELFused<T>::addOperation (Operation oper)
+{
+  uInt nargs = 1;
+  switch (oper) {
+  case LEAF:
+  case SCALAR:
+    throw AipsError ("LELFused::addOperation - use addLeaf or addScalar");
+  case ADD:
+  case SUBTRACT:
+  case MULTIPLY:
+  case DIVIDE:
+  case POW:
+  case MIN:
+  case MAX:
+  case ATAN2:
+  case FMOD:
+    nargs = 2;
+    break;
+  default:
+    break;
+  }
+  if (itsDepth < nargs) {
+    throw AipsError ("LELFused::addOperation - too few operands");
+  }
+  Instruction instr;
+  instr.oper  = oper;
+  instr.index = 0;
+  instr.value = T();
+  itsProgram.push_back (instr);
+  itsDepth -= nargs - 1;
+  itsNOper++;
+}
+
+template<class T>
+Bool LELFused<T>::isUseful() const
+{
+  return itsValid  &&  itsNOper > 0  &&  itsDepth == 1  &&  isSupported();
+}
+
+template<class T>
+void LELFused<T>::eval (LELArray<T>& result, const Slicer& section) const
+{
+  if (!isUseful()) {
+    throw AipsError ("LELFused::eval - the program cannot be evaluated");
+  }
+  // First evaluate the leaves for the section. It is done sequentially,
+  // because lattice access is not thread-safe.
+  // Use references to the lattice data if possible.
+  const IPosition& shape = result.shape();
+  std::vector<Array<T> > leafArrays;
+  std::vector<const T*> leafData;
+  leafArrays.reserve (itsLeaves.size());
+  for (const LELInterface<T>* leaf : itsLeaves) {
+    LELArrayRef<T> tmp(shape);
+    leaf->evalRef (tmp, section);
+    if (tmp.value().contiguousStorage()) {
+      leafArrays.push_back (tmp.value());
+    } else {
+      leafArrays.push_back (tmp.value().copy());
+    }
+    leafData.push_back (leafArrays.back().data());
+  }
+  // Execute the program block by block. The blocks are divided over
+  // the threads, where each thread writes its own part of the result.
+  Array<T>& arr = result.value();
+  Bool deleteIt;
+  T* out = arr.getStorage (deleteIt);
+  size_t n = arr.nelements();
+  size_t nblock = (n + LELFusedBlockSize - 1) / LELFusedBlockSize;
+  size_t nchunk = std::min (arrays_internal::parallelNChunk(n), nblock);
+  arrays_internal::parallelChunks
+    (nblock, nchunk, [&](size_t, size_t stBlock, size_t nrBlock)
+     {
+       Block<T> stack(itsMaxDepth * LELFusedBlockSize);
+       for (size_t i=stBlock; i<stBlock+nrBlock; ++i) {
+         size_t st = i * LELFusedBlockSize;
+         execute (out, leafData, st,
+                  std::min (LELFusedBlockSize, n-st), stack.storage());
+       }
+     });
+  arr.putStorage (out, deleteIt);
+}
+
+template<class T>
+void LELFused<T>::execute (T* result, const std::vector<const T*>& leaves,
+                           size_t start, size_t n, T* stack) const
+{
+  // The value at the top of the stack is at (depth-1)*LELFusedBlockSize.
+  uInt depth = 0;
+  for (const Instruction& instr : itsProgram) {
+    T* next = stack + depth*LELFusedBlockSize;
+    switch (instr.oper) {
+    case LEAF:
+      std::copy (leaves[instr.index] + start,
+                 leaves[instr.index] + start + n, next);
+      depth++;
+      break;
+    case SCALAR:
+      std::fill (next, next+n, instr.value);
+      depth++;
+      break;
+    case ADD:
+    case SUBTRACT:
+    case MULTIPLY:
+    case DIVIDE:
+    case POW:
+    case MIN:
+    case MAX:
+    case ATAN2:
+    case FMOD:
+      LELFusedMath<T>::binary (instr.oper, next - 2*LELFusedBlockSize,
+                               next - LELFusedBlockSize, n);
+      depth--;
+      break;
+    default:
+      LELFusedMath<T>::unary (instr.oper, next - LELFusedBlockSize, n);
+      break;
+    }
+  }
+  std::copy (stack, stack+n, result+start);
+}
+
+
+template<class T>
+void LELFusedRealMath<T>::unary (int oper, T* data, size_t n)
+{
+  switch (oper) {
+  case LELFused<T>::NEGATE:
+    for (size_t i=0; i<n; ++i) data[i] = -data[i];
+    break;
+  case LELFused<T>::SQUARE:
+    for (size_t i=0; i<n; ++i) data[i] *= data[i];
+    break;
+  case LELFused<T>::ABS:
+    for (size_t i=0; i<n; ++i) data[i] = std::abs(data[i]);
+    break;
+  case LELFused<T>::SIN:
+    for (size_t i=0; i<n; ++i) data[i] = std::sin(data[i]);
+    break;
+  case LELFused<T>::SINH:
+    for (size_t i=0; i<n; ++i) data[i] = std::sinh(data[i]);
+    break;
+  case LELFused<T>::ASIN:
+    for (size_t i=0; i<n; ++i) data[i] = std::asin(data[i]);
+    break;
+  case LELFused<T>::COS:
+    for (size_t i=0; i<n; ++i) data[i] = std::cos(data[i]);
+    break;
+  case LELFused<T>::COSH:
+    for (size_t i=0; i<n; ++i) data[i] = std::cosh(data[i]);
+    break;
+  case LELFused<T>::ACOS:
+    for (size_t i=0; i<n; ++i) data[i] = std::acos(data[i]);
+    break;
+  case LELFused<T>::TAN:
+    for (size_t i=0; i<n; ++i) data[i] = std::tan(data[i]);
+    break;
+  case LELFused<T>::TANH:
+    for (size_t i=0; i<n; ++i) data[i] = std::tanh(data[i]);
+    break;
+  case LELFused<T>::ATAN:
+    for (size_t i=0; i<n; ++i) data[i] = std::atan(data[i]);
+    break;
+  case LELFused<T>::EXP:
+    for (size_t i=0; i<n; ++i) data[i] = std::exp(data[i]);
+    break;
+  case LELFused<T>::LOG:
+    for (size_t i=0; i<n; ++i) data[i] = std::log(data[i]);
+    break;
+  case LELFused<T>::LOG10:
+    for (size_t i=0; i<n; ++i) data[i] = std::log10(data[i]);
+    break;
+  case LELFused<T>::SQRT:
+    for (size_t i=0; i<n; ++i) data[i] = std::sqrt(data[i]);
+    break;
+  default:
+    throw AipsError ("LELFused::execute - unknown unary operation");
+  }
+}
+
+template<class T>
+void LELFusedRealMath<T>::binary (int oper, T* left, const T* right,
+                                  size_t n)
+{
+  switch (oper) {
+  case LELFused<T>::ADD:
+    for (size_t i=0; i<n; ++i) left[i] += right[i];
+    break;
+  case LELFused<T>::SUBTRACT:
+    for (size_t i=0; i<n; ++i) left[i] -= right[i];
+    break;
+  case LELFused<T>::MULTIPLY:
+    for (size_t i=0; i<n; ++i) left[i] *= right[i];
+    break;
+  case LELFused<T>::DIVIDE:
+    for (size_t i=0; i<n; ++i) left[i] /= right[i];
+    break;
+  case LELFused<T>::POW:
+    for (size_t i=0; i<n; ++i) left[i] = std::pow(left[i], right[i]);
+    break;
+  case LELFused<T>::MIN:
+    for (size_t i=0; i<n; ++i) left[i] = left[i]<right[i] ? left[i]:right[i];
+    break;
+  case LELFused<T>::MAX:
+    for (size_t i=0; i<n; ++i) left[i] = left[i]<right[i] ? right[i]:left[i];
+    break;
+  case LELFused<T>::ATAN2:
+    for (size_t i=0; i<n; ++i) left[i] = std::atan2(left[i], right[i]);
+    break;
+  case LELFused<T>::FMOD:
+    for (size_t i=0; i<n; ++i) left[i] = std::fmod(left[i], right[i]);
+    break;
+  default:
+    throw AipsError ("LELFused::execute - unknown binary operation");
+  }
+}
+
+} //# NAMESPACE CASACORE - END
+
+
+#endif
@@ -33,6 +33,7 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/IO/FileLocker.h>
+#include <atomic>
 #include <memory>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -41,6 +42,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 template <class T> class LELScalar;
 template <class T> class LELArray;
 template <class T> class LELArrayRef;
+template <class T> class LELFused;
+template <class T> struct LELEvalCache;
 class Slicer;
 
 
@@ -133,6 +136,13 @@ class Slicer;
 //  pixels from the Lattice.  The rest only care about the shape of the
 //  buffer in the <src>eval</src> call.
 //
+//  A subexpression can be used several times in an expression tree
+//  (LatticeExprNode shares nodes created for the same operation on the
+//  same operands). Such a node is marked as shared. Parents evaluate their
+//  operands using <src>evalCached</src>, which keeps the result of a shared
+//  node for the last section evaluated in the current evaluation pass
+//  (see class LELEvalPass), so the node is evaluated only once per section.
+//
 // </synopsis> 
 //
 // <motivation>
@@ -158,9 +168,28 @@ public:
    virtual void evalRef (LELArrayRef<T>& result,
 			 const Slicer& section) const;
 
+// Evaluate the expression like <src>eval</src>. If the node is shared and
+// an evaluation pass is active, the result for the section is evaluated
+// only once per pass and copied from the cache for subsequent calls.
+// Parents use this function to evaluate their operands.
+   void evalCached (LELArray<T>& result, const Slicer& section) const;
+
+// Mark the node as shared, i.e. used more than once in expression trees.
+   void setShared();
+
+// Is the node shared?
+   Bool isShared() const
+     { return Bool(cache_p); }
+
 // Get the result of a scalar subexpression.
    virtual LELScalar<T> getScalar() const = 0;
 
+// Add the expression to a program for fused evaluation (see LELFused).
+// By default the expression is added as a leaf, i.e. it is evaluated
+// using its <src>eval</src> function. Element-wise operations override
+// it to add their operands and operation.
+   virtual void fuse (LELFused<T>& fused) const;
+
 // Get the result of an array subexpression.
 // It does eval for the entire array.
 // An exception is thrown if the shape of the subexpression is unknown.
@@ -206,10 +235,51 @@ protected:
 
 private:
    LELAttribute attr_p;
+   std::shared_ptr<LELEvalCache<T>> cache_p;
 };
 
 
 
+// <summary>
+// Define a pass in which shared LEL nodes are evaluated only once
+// </summary>
+
+// <use visibility=local>
+
+// <synopsis>
+// An LELEvalPass object defines the period in which the results cached by
+// <linkto class=LELInterface>LELInterface::evalCached</linkto> are valid.
+// The constructor starts a new pass in the current thread, unless a pass is
+// already active in that thread. The destructor ends the pass it started.
+// LatticeExprNode and LatticeExpr start a pass when evaluating a section,
+// so the lattices used in an expression cannot change during a pass.
+// </synopsis>
+
+class LELEvalPass
+{
+public:
+  // Start a pass if none is active in the current thread.
+  LELEvalPass();
+
+  // End the pass if started by this object.
+  ~LELEvalPass();
+
+  // Get the id of the pass active in the current thread (0 is no pass).
+  static uInt64 current();
+
+private:
+  // Forbid copy.
+  LELEvalPass (const LELEvalPass&);
+  LELEvalPass& operator= (const LELEvalPass&);
+
+  Bool started_p;
+  static thread_local uInt64 theirCurrent;
+  static std::atomic<uInt64> theirCounter;
+};
+
+
+
+
 } //# NAMESPACE CASACORE - END
 
 //# There is a problem in including LELInterface.tcc, because it needs
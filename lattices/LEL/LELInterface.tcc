@@ -29,8 +29,10 @@
 #include <casacore/lattices/LEL/LELInterface.h>
 #include <casacore/lattices/LEL/LELUnary.h>
 #include <casacore/lattices/LEL/LELArray.h>
+#include <casacore/lattices/LEL/LELFused.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <mutex>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -51,7 +53,64 @@ void LELInterface<T>::evalRef (LELArrayRef<T>& result,
 {
     // For one reason or another gcc requires an explicit cast
     // for LELInterface<Bool>.
-    eval ((LELArray<T>&)result, section);
+    evalCached ((LELArray<T>&)result, section);
+}
+
+// The result of a shared node for the last section evaluated.
+template<class T>
+struct LELEvalCache
+{
+  std::mutex mutex;
+  uInt64 pass = 0;
+  Slicer section;
+  LELArray<T> result = LELArray<T>(IPosition());
+};
+
+template<class T>
+void LELInterface<T>::setShared()
+{
+    if (!cache_p) {
+        cache_p = std::make_shared<LELEvalCache<T>>();
+    }
+}
+
+template<class T>
+void LELInterface<T>::evalCached (LELArray<T>& result,
+				  const Slicer& section) const
+{
+    uInt64 pass = LELEvalPass::current();
+    if (!cache_p  ||  pass == 0) {
+        eval (result, section);
+        return;
+    }
+    // The result is copied, because parents change their operand arrays.
+    {
+        std::lock_guard<std::mutex> lock(cache_p->mutex);
+        if (cache_p->pass == pass  &&  cache_p->section == section) {
+            result.value() = cache_p->result.value();
+            if (cache_p->result.isMasked()) {
+                result.setMask (cache_p->result.mask().copy());
+            } else {
+                result.removeMask();
+            }
+            return;
+        }
+    }
+    eval (result, section);
+    LELArray<T> copy (result.value().copy());
+    if (result.isMasked()) {
+        copy.setMask (result.mask().copy());
+    }
+    std::lock_guard<std::mutex> lock(cache_p->mutex);
+    cache_p->pass    = pass;
+    cache_p->section = section;
+    cache_p->result  = copy;
+}
+
+template<class T>
+void LELInterface<T>::fuse (LELFused<T>& fused) const
+{
+    fused.addLeaf (*this);
 }
 
 template<class T>
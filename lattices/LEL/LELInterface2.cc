@@ -0,0 +1,54 @@
+//# LELInterface2.cc: Non-templated parts of the LEL interface
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/lattices/LEL/LELInterface.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+thread_local uInt64 LELEvalPass::theirCurrent = 0;
+std::atomic<uInt64> LELEvalPass::theirCounter (0);
+
+LELEvalPass::LELEvalPass()
+: started_p (theirCurrent == 0)
+{
+  if (started_p) {
+    theirCurrent = ++theirCounter;
+  }
+}
+
+LELEvalPass::~LELEvalPass()
+{
+  if (started_p) {
+    theirCurrent = 0;
+  }
+}
+
+uInt64 LELEvalPass::current()
+{
+  return theirCurrent;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -200,6 +200,9 @@ public:
 // Recursively evaluate the scalar expression.
    virtual LELScalar<T> getScalar() const;
 
+// Add the operand and operation to a fused program.
+   virtual void fuse (LELFused<T>& fused) const;
+
 // Do further preparations (e.g. optimization) on the expression.
    virtual Bool prepareScalarExpr();
 
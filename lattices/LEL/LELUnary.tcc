@@ -29,6 +29,7 @@
 #include <casacore/lattices/LEL/LELUnary.h>
 #include <casacore/lattices/LEL/LELScalar.h>
 #include <casacore/lattices/LEL/LELArray.h>
+#include <casacore/lattices/LEL/LELFused.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
@@ -124,7 +125,7 @@ void LELUnary<T>::eval(LELArray<T>& result,
 #endif
 
 // Get the value and apply the unary operation
-   pExpr_p->eval(result, section);
+   pExpr_p->evalCached (result, section);
    switch(op_p) {
    case LELUnaryEnums::MINUS :
    {
@@ -155,6 +156,19 @@ LELScalar<T> LELUnary<T>::getScalar() const
    return temp;
 }
 
+template <class T>
+void LELUnary<T>::fuse (LELFused<T>& fused) const
+{
+   switch(op_p) {
+   case LELUnaryEnums::MINUS :
+      fused.add (*pExpr_p);
+      fused.addOperation (LELFused<T>::NEGATE);
+      break;
+   default:
+      fused.addLeaf (*this);
+   }
+}
+
 template <class T>
 Bool LELUnary<T>::prepareScalarExpr()
 {
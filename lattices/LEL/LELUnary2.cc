@@ -60,7 +60,7 @@ void LELUnaryBool::eval(LELArray<Bool>& result,
 #endif
 
 // Get the value and apply the unary operation
-   pExpr_p->eval(result, section);
+   pExpr_p->evalCached (result, section);
    switch(op_p) {
    case LELUnaryEnums::NOT :
    {
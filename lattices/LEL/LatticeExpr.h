@@ -34,11 +34,13 @@
 #include <casacore/lattices/LRegions/LatticeRegion.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
+#include <memory>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
 template <class T> class LELArray;
+template <class T> class LELFused;
 
 
 // <summary> Class to allow C++ expressions involving lattices </summary>
@@ -76,6 +78,12 @@ template <class T> class LELArray;
 //    operations are defined, so you should look there to see what 
 //    functionality is available.
 //
+//    An unmasked Float or Double expression is evaluated in a fused way
+//    (see class LELFused). Its element-wise operations are done in a
+//    single pass over each chunk without temporary arrays for the
+//    subexpressions, where large chunks are divided over multiple threads.
+//    The result is the same as when evaluated node by node.
+//
 //    A description of the implementation details of these classes can
 //    be found in
 //    <a href="../notes/216.html">Note 216</a>
@@ -194,6 +202,10 @@ public:
   // <br>By default the function does not do anything at all.
   virtual void resync();
 
+  // Enable or disable fused evaluation of the expression (default enabled).
+  // It is only used if possible.
+   void setFusedEval (Bool fusedEval);
+
   // Returns the shape of the Lattice including all degenerate axes
   // (i.e. axes with a length of one)
    virtual IPosition shape() const;
@@ -231,11 +243,18 @@ private:
    // Initialize the object from the expression.
    void init (const LatticeExprNode& expr);
 
+   // Evaluate the expression for the section into lastChunkPtr_p.
+   // A fused program is used if possible, which is made the first time.
+   void evalChunk (const Slicer& section);
+
 
    LatticeExprNode expr_p;     //# its shape can be undefined
    IPosition       shape_p;    //# this shape is always defined
    LELArray<T>*    lastChunkPtr_p;
    Slicer          lastSlicer_p;
+   std::shared_ptr<LELFused<T>> fused_p;
+   Bool            fusedEval_p;
+   Bool            fusedDone_p;
 };
 
 
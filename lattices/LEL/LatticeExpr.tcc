@@ -28,6 +28,7 @@
 
 #include <casacore/lattices/LEL/LatticeExpr.h>
 #include <casacore/lattices/LEL/LELArray.h>
+#include <casacore/lattices/LEL/LELFused.h>
 #include <casacore/lattices/Lattices/LatticeIterator.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Slicer.h>
@@ -40,13 +41,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 template <class T>
 LatticeExpr<T>::LatticeExpr()
-: lastChunkPtr_p (0)
+: lastChunkPtr_p (0),
+  fusedEval_p    (True),
+  fusedDone_p    (False)
 {}
 
 template <class T>
 LatticeExpr<T>::LatticeExpr (const LatticeExprNode& expr)
 : shape_p        (expr.shape()),
-  lastChunkPtr_p (0)
+  lastChunkPtr_p (0),
+  fusedEval_p    (True),
+  fusedDone_p    (False)
 {
     // Check if an expression array has a shape.
     if (!expr.isScalar()  &&  shape_p.nelements() == 0) {
@@ -60,7 +65,9 @@ template <class T>
 LatticeExpr<T>::LatticeExpr (const LatticeExprNode& expr,
 			     const IPosition& latticeShape)
 : shape_p        (latticeShape),
-  lastChunkPtr_p (0)
+  lastChunkPtr_p (0),
+  fusedEval_p    (True),
+  fusedDone_p    (False)
 //
 // Construct from a LatticeExprNode object.  The LEN type is
 // converted to match the template type if possible
@@ -118,7 +125,9 @@ LatticeExpr<T>::LatticeExpr (const LatticeExpr<T>& other)
 : MaskedLattice<T>(),
   expr_p          (other.expr_p),
   shape_p         (other.shape_p),
-  lastChunkPtr_p  (0)
+  lastChunkPtr_p  (0),
+  fusedEval_p     (other.fusedEval_p),
+  fusedDone_p     (False)
 {}
 
 template <class T>
@@ -130,6 +139,9 @@ LatticeExpr<T>& LatticeExpr<T>::operator=(const LatticeExpr<T>& other)
       delete lastChunkPtr_p;
       lastChunkPtr_p = 0;
       lastSlicer_p = Slicer();
+      fused_p.reset();
+      fusedEval_p = other.fusedEval_p;
+      fusedDone_p = False;
    }
    return *this;
 }
@@ -207,12 +219,44 @@ Bool LatticeExpr<T>::doGetSlice (Array<T>& buffer,
       delete lastChunkPtr_p;
       lastChunkPtr_p = new LELArray<T> (section.length());
       lastSlicer_p = section;
-      expr_p.eval (*lastChunkPtr_p, section);
+      evalChunk (section);
    }
    buffer.reference (lastChunkPtr_p->value());
    return True;
 }
 
+template <class T>
+void LatticeExpr<T>::evalChunk (const Slicer& section)
+{
+// Try to make a fused program the first time.
+// It cannot be used for a masked expression.
+   if (!fusedDone_p) {
+      fusedDone_p = True;
+      if (fusedEval_p  &&  LELFused<T>::isSupported()
+      &&  !expr_p.isScalar()  &&  !expr_p.isMasked()) {
+	 std::shared_ptr<LELFused<T>> fused = std::make_shared<LELFused<T>>();
+	 expr_p.fuse (*fused);
+	 if (fused->isUseful()) {
+	    fused_p = fused;
+	 }
+      }
+   }
+   if (fused_p) {
+      LELEvalPass pass;
+      fused_p->eval (*lastChunkPtr_p, section);
+   } else {
+      expr_p.eval (*lastChunkPtr_p, section);
+   }
+}
+
+template <class T>
+void LatticeExpr<T>::setFusedEval (Bool fusedEval)
+{
+   fusedEval_p = fusedEval;
+   fused_p.reset();
+   fusedDone_p = False;
+}
+
 template <class T>
 Bool LatticeExpr<T>::doGetMaskSlice (Array<Bool>& buffer,
 				     const Slicer& section)
@@ -36,6 +36,7 @@
 #include <casacore/lattices/LEL/LELFunction.h>
 #include <casacore/lattices/LEL/LELSpectralIndex.h>
 #include <casacore/lattices/LEL/LELArray.h>
+#include <casacore/lattices/LEL/LELFused.h>
 #include <casacore/lattices/LEL/LELRegion.h>
 #include <casacore/lattices/LRegions/LCRegion.h>
 #include <casacore/lattices/LRegions/LCSlicer.h>
@@ -48,11 +49,173 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h> 
 #include <casacore/casa/iostream.h>
+#include <casacore/casa/sstream.h>
+#include <map>
+#include <mutex>
+#include <typeinfo>
 
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+//# The nodes made by the operators and functions below are registered with
+//# a key made of the node type, the operation and the addresses of the
+//# operands (or the value of a constant). Making the same operation on the
+//# same operands again returns the registered node, which is marked as
+//# shared. In this way a common subexpression like (a-b) used twice is a
+//# single node and is evaluated once per section (see LELEvalPass).
+//# The registry holds weak pointers, so it does not keep nodes alive.
+//# An entry can only be found while the node lives, thus while its operands
+//# live, so the addresses in a key cannot have been reused.
+namespace {
+
+  template<typename T>
+  struct LELNodeRegistry
+  {
+    std::mutex mutex;
+    std::map<String, std::weak_ptr<LELInterface<T>>> nodes;
+    size_t pruneSize = 256;
+  };
+
+  template<typename T>
+  LELNodeRegistry<T>& lelNodeRegistry()
+  {
+    static LELNodeRegistry<T> registry;
+    return registry;
+  }
+
+  // Get the node with the given key from the registry, or make it using
+  // the given function and register it.
+  template<typename T, typename MakeFunc>
+  std::shared_ptr<LELInterface<T>> lelShareNode (const String& key,
+                                                 MakeFunc makeNode)
+  {
+    LELNodeRegistry<T>& reg = lelNodeRegistry<T>();
+    {
+      std::lock_guard<std::mutex> lock(reg.mutex);
+      auto iter = reg.nodes.find (key);
+      if (iter != reg.nodes.end()) {
+        std::shared_ptr<LELInterface<T>> node = iter->second.lock();
+        if (node) {
+          // A scalar is evaluated once anyway.
+          if (! node->isScalar()) {
+            node->setShared();
+          }
+          return node;
+        }
+      }
+    }
+    std::shared_ptr<LELInterface<T>> node = makeNode();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    // Remove the expired entries when the registry has grown.
+    if (reg.nodes.size() >= reg.pruneSize) {
+      for (auto iter=reg.nodes.begin(); iter!=reg.nodes.end();) {
+        if (iter->second.expired()) {
+          iter = reg.nodes.erase (iter);
+        } else {
+          ++iter;
+        }
+      }
+      reg.pruneSize = std::max (size_t(256), 2*reg.nodes.size());
+    }
+    reg.nodes[key] = node;
+    return node;
+  }
+
+  // Make the key of a node from its type, operation and operands.
+  template<typename Node>
+  String lelNodeKey (Int oper, const std::vector<const void*>& operands)
+  {
+    std::ostringstream os;
+    os << typeid(Node).name() << ':' << oper;
+    for (const void* ptr : operands) {
+      os << ':' << ptr;
+    }
+    return os.str();
+  }
+
+  // Get the addresses of the expressions in the function arguments.
+  std::vector<const void*> lelArgAddr (const Block<LatticeExprNode>& arg)
+  {
+    std::vector<const void*> addr;
+    addr.reserve (arg.nelements());
+    for (const LatticeExprNode& node : arg) {
+      switch (node.dataType()) {
+      case TpFloat:
+        addr.push_back (node.makeFloat().get());
+        break;
+      case TpDouble:
+        addr.push_back (node.makeDouble().get());
+        break;
+      case TpComplex:
+        addr.push_back (node.makeComplex().get());
+        break;
+      case TpDComplex:
+        addr.push_back (node.makeDComplex().get());
+        break;
+      default:
+        addr.push_back (node.makeBool().get());
+        break;
+      }
+    }
+    return addr;
+  }
+
+  // Get the shared node for an operation on one or two operands.
+  // <group>
+  template<typename T, typename Node, typename Oper, typename Arg>
+  std::shared_ptr<LELInterface<T>> lelNode (Oper oper, const Arg& arg)
+  {
+    return lelShareNode<T>
+      (lelNodeKey<Node> (oper, {arg.get()}),
+       [&]() { return std::make_shared<Node>(oper, arg); });
+  }
+  template<typename T, typename Node, typename Oper, typename Arg>
+  std::shared_ptr<LELInterface<T>> lelNode (Oper oper, const Arg& arg0,
+                                            const Arg& arg1)
+  {
+    return lelShareNode<T>
+      (lelNodeKey<Node> (oper, {arg0.get(), arg1.get()}),
+       [&]() { return std::make_shared<Node>(oper, arg0, arg1); });
+  }
+  template<typename T, typename Node, typename Oper>
+  std::shared_ptr<LELInterface<T>> lelNode (Oper oper,
+                                            const Block<LatticeExprNode>& arg)
+  {
+    return lelShareNode<T>
+      (lelNodeKey<Node> (oper, lelArgAddr(arg)),
+       [&]() { return std::make_shared<Node>(oper, arg); });
+  }
+  // </group>
+
+  // Get the shared node for the conversion of an expression.
+  template<typename T, typename F>
+  std::shared_ptr<LELInterface<T>> lelConvertNode
+  (const std::shared_ptr<LELInterface<F>>& expr)
+  {
+    return lelShareNode<T>
+      (lelNodeKey<LELConvert<T,F>> (0, {expr.get()}),
+       [&]() { return std::make_shared<LELConvert<T,F>>(expr); });
+  }
+
+  // Get the shared node for a constant.
+  // Its key contains the bytes of the value, so also NaNs are matched.
+  template<typename T>
+  std::shared_ptr<LELInterface<T>> lelConstNode (const T& value)
+  {
+    std::ostringstream os;
+    os << typeid(LELUnaryConst<T>).name() << ':' << std::hex;
+    const uChar* bytes = reinterpret_cast<const uChar*>(&value);
+    for (size_t i=0; i<sizeof(T); ++i) {
+      os << Int(bytes[i]) << '.';
+    }
+    return lelShareNode<T>
+      (os.str(), [&]() { return std::make_shared<LELUnaryConst<T>>(value); });
+  }
+
+}
+
+
 // Default constructor
 LatticeExprNode::LatticeExprNode()
 : donePrepare_p   (False),
@@ -213,7 +376,7 @@ LatticeExprNode::LatticeExprNode (Int64 constant)
 : donePrepare_p   (False),
   dtype_p         (TpFloat),
   isInvalid_p     (False),
-  pExprFloat_p    (std::make_shared<LELUnaryConst<Float>>(constant))
+  pExprFloat_p    (lelConstNode<Float> (constant))
 { 
    pAttr_p = &pExprFloat_p->getAttribute();
 
@@ -227,7 +390,7 @@ LatticeExprNode::LatticeExprNode (Int constant)
 : donePrepare_p   (False),
   dtype_p         (TpFloat),
   isInvalid_p     (False),
-  pExprFloat_p    (std::make_shared<LELUnaryConst<Float>>(constant))
+  pExprFloat_p    (lelConstNode<Float> (constant))
 { 
    pAttr_p = &pExprFloat_p->getAttribute();
 
@@ -241,7 +404,7 @@ LatticeExprNode::LatticeExprNode (uInt constant)
 : donePrepare_p   (False),
   dtype_p         (TpFloat),
   isInvalid_p     (False),
-  pExprFloat_p    (std::make_shared<LELUnaryConst<Float>>(constant))
+  pExprFloat_p    (lelConstNode<Float> (constant))
 { 
    pAttr_p = &pExprFloat_p->getAttribute();
 
@@ -255,7 +418,7 @@ LatticeExprNode::LatticeExprNode (Long constant)
 : donePrepare_p   (False),
   dtype_p         (TpFloat),
   isInvalid_p     (False),
-  pExprFloat_p    (std::make_shared<LELUnaryConst<Float>>(constant))
+  pExprFloat_p    (lelConstNode<Float> (constant))
 { 
    pAttr_p = &pExprFloat_p->getAttribute();
 
@@ -269,7 +432,7 @@ LatticeExprNode::LatticeExprNode (Float constant)
 : donePrepare_p   (False),
   dtype_p         (TpFloat),
   isInvalid_p     (False),
-  pExprFloat_p    (std::make_shared<LELUnaryConst<Float>>(constant))
+  pExprFloat_p    (lelConstNode<Float> (constant))
 { 
    pAttr_p = &pExprFloat_p->getAttribute();
 
@@ -283,7 +446,7 @@ LatticeExprNode::LatticeExprNode (Double constant)
 : donePrepare_p   (False),
   dtype_p         (TpDouble),
   isInvalid_p     (False),
-  pExprDouble_p   (std::make_shared<LELUnaryConst<Double>>(constant))
+  pExprDouble_p   (lelConstNode<Double> (constant))
 { 
    pAttr_p = &pExprDouble_p->getAttribute();
 
@@ -297,7 +460,7 @@ LatticeExprNode::LatticeExprNode (const Complex& constant)
 : donePrepare_p   (False),
   dtype_p         (TpComplex),
   isInvalid_p     (False),
-  pExprComplex_p  (std::make_shared<LELUnaryConst<Complex>>(constant))
+  pExprComplex_p  (lelConstNode<Complex> (constant))
 { 
    pAttr_p = &pExprComplex_p->getAttribute();
 
@@ -311,7 +474,7 @@ LatticeExprNode::LatticeExprNode (const DComplex& constant)
 : donePrepare_p   (False),
   dtype_p         (TpDComplex),
   isInvalid_p     (False),
-  pExprDComplex_p (std::make_shared<LELUnaryConst<DComplex>>(constant))
+  pExprDComplex_p (lelConstNode<DComplex> (constant))
 { 
    pAttr_p = &pExprDComplex_p->getAttribute();
 
@@ -325,7 +488,7 @@ LatticeExprNode::LatticeExprNode (Bool constant)
 : donePrepare_p   (False),
   dtype_p         (TpBool),
   isInvalid_p     (False),
-  pExprBool_p     (std::make_shared<LELUnaryConst<Bool>>(constant))
+  pExprBool_p     (lelConstNode<Bool> (constant))
 { 
    pAttr_p = &pExprBool_p->getAttribute();
 
@@ -721,7 +884,8 @@ void LatticeExprNode::eval (LELArray<Float>& result,
 	 result.setMask (mask);
       }
    } else {
-      pExprFloat_p->eval (result, section);
+      LELEvalPass pass;
+      pExprFloat_p->evalCached (result, section);
    }
 }
 
@@ -749,7 +913,8 @@ void LatticeExprNode::eval (LELArray<Double>& result,
 	 result.setMask (mask);
       }
    } else {
-      pExprDouble_p->eval (result, section);
+      LELEvalPass pass;
+      pExprDouble_p->evalCached (result, section);
    }
 }
 
@@ -777,7 +942,8 @@ void LatticeExprNode::eval (LELArray<Complex>& result,
 	 result.setMask (mask);
       }
    } else {
-      pExprComplex_p->eval (result, section);
+      LELEvalPass pass;
+      pExprComplex_p->evalCached (result, section);
    }
 }
 
@@ -805,7 +971,8 @@ void LatticeExprNode::eval (LELArray<DComplex>& result,
 	 result.setMask (mask);
       }
    } else {
-      pExprDComplex_p->eval (result, section);
+      LELEvalPass pass;
+      pExprDComplex_p->evalCached (result, section);
    }
 }
 
@@ -833,8 +1000,54 @@ void LatticeExprNode::eval (LELArray<Bool>& result,
 	 result.setMask (mask);
       }
    } else {
-      pExprBool_p->eval (result, section);
+      LELEvalPass pass;
+      pExprBool_p->evalCached (result, section);
+   }
+}
+
+void LatticeExprNode::fuse (LELFused<Float>& fused) const
+{
+   DebugAssert (dataType() == TpFloat, AipsError);
+   if (!donePrepare_p) {
+      doPrepare();
+   }
+   fused.add (*pExprFloat_p);
+}
+
+void LatticeExprNode::fuse (LELFused<Double>& fused) const
+{
+   DebugAssert (dataType() == TpDouble, AipsError);
+   if (!donePrepare_p) {
+      doPrepare();
+   }
+   fused.add (*pExprDouble_p);
+}
+
+void LatticeExprNode::fuse (LELFused<Complex>& fused) const
+{
+   DebugAssert (dataType() == TpComplex, AipsError);
+   if (!donePrepare_p) {
+      doPrepare();
+   }
+   fused.add (*pExprComplex_p);
+}
+
+void LatticeExprNode::fuse (LELFused<DComplex>& fused) const
+{
+   DebugAssert (dataType() == TpDComplex, AipsError);
+   if (!donePrepare_p) {
+      doPrepare();
    }
+   fused.add (*pExprDComplex_p);
+}
+
+void LatticeExprNode::fuse (LELFused<Bool>& fused) const
+{
+   DebugAssert (dataType() == TpBool, AipsError);
+   if (!donePrepare_p) {
+      doPrepare();
+   }
+   fused.add (*pExprBool_p);
 }
 
 
@@ -1634,7 +1847,7 @@ LatticeExprNode operator! (const LatticeExprNode& expr)
       return LELRegion::makeComplement (*expr.pExprBool_p);
    }
    return LatticeExprNode
-     (std::make_shared<LELUnaryBool>(LELUnaryEnums::NOT, expr.pExprBool_p));
+     (lelNode<Bool,LELUnaryBool> (LELUnaryEnums::NOT, expr.pExprBool_p));
 }
 
 LatticeExprNode LatticeExprNode::operator[] (const LatticeExprNode& cond) const
@@ -1910,16 +2123,16 @@ LatticeExprNode LatticeExprNode::newNumUnary (LELUnaryEnums::Operation oper,
    switch (expr.dataType()) {
    case TpFloat:
       return LatticeExprNode
-        (std::make_shared<LELUnary<Float>>(oper, expr.pExprFloat_p));
+        (lelNode<Float,LELUnary<Float>> (oper, expr.pExprFloat_p));
    case TpDouble:
       return LatticeExprNode
-        (std::make_shared<LELUnary<Double>>(oper, expr.pExprDouble_p));
+        (lelNode<Double,LELUnary<Double>> (oper, expr.pExprDouble_p));
    case TpComplex:
       return LatticeExprNode
-        (std::make_shared<LELUnary<Complex>>(oper, expr.pExprComplex_p));
+        (lelNode<Complex,LELUnary<Complex>> (oper, expr.pExprComplex_p));
    case TpDComplex:
       return LatticeExprNode
-        (std::make_shared<LELUnary<DComplex>>(oper, expr.pExprDComplex_p));
+        (lelNode<DComplex,LELUnary<DComplex>> (oper, expr.pExprDComplex_p));
    default:
       throw (AipsError ("LatticeExprNode::newNumUnary - "
 			"Bool argument used in numerical unary operation"));
@@ -1938,16 +2151,16 @@ LatticeExprNode LatticeExprNode::newNumFunc1D (LELFunctionEnums::Function func,
    switch (expr.dataType()) {
    case TpFloat:
      return LatticeExprNode
-       (std::make_shared<LELFunction1D<Float>>(func, expr.pExprFloat_p));
+       (lelNode<Float,LELFunction1D<Float>> (func, expr.pExprFloat_p));
    case TpDouble:
      return LatticeExprNode
-       (std::make_shared<LELFunction1D<Double>>(func, expr.pExprDouble_p));
+       (lelNode<Double,LELFunction1D<Double>> (func, expr.pExprDouble_p));
    case TpComplex:
      return LatticeExprNode
-       (std::make_shared<LELFunction1D<Complex>>(func, expr.pExprComplex_p));
+       (lelNode<Complex,LELFunction1D<Complex>> (func, expr.pExprComplex_p));
    case TpDComplex:
      return LatticeExprNode
-       (std::make_shared<LELFunction1D<DComplex>>(func, expr.pExprDComplex_p));
+       (lelNode<DComplex,LELFunction1D<DComplex>> (func, expr.pExprDComplex_p));
    default:
      throw (AipsError ("LatticeExprNode::newNumFunc1D - "
 			"Bool argument used in numerical function"));
@@ -1964,10 +2177,10 @@ LatticeExprNode LatticeExprNode::newRealFunc1D (LELFunctionEnums::Function func,
    switch (expr.dataType()) {
    case TpFloat:
      return LatticeExprNode
-       (std::make_shared<LELFunctionReal1D<Float>>(func, expr.pExprFloat_p));
+       (lelNode<Float,LELFunctionReal1D<Float>> (func, expr.pExprFloat_p));
    case TpDouble:
      return LatticeExprNode
-       (std::make_shared<LELFunctionReal1D<Double>>(func, expr.pExprDouble_p));
+       (lelNode<Double,LELFunctionReal1D<Double>> (func, expr.pExprDouble_p));
    default:
      throw (AipsError ("LatticeExprNode::newRealFunc1D - "
                        "Bool or complex argument used in real "
@@ -1986,10 +2199,10 @@ LatticeExprNode LatticeExprNode::newComplexFunc1D (LELFunctionEnums::Function fu
    switch (expr.dataType()) {
    case TpComplex:
      return LatticeExprNode
-       (std::make_shared<LELFunctionComplex>(func, arg));
+       (lelNode<Complex,LELFunctionComplex> (func, arg));
    case TpDComplex:
      return LatticeExprNode
-       (std::make_shared<LELFunctionDComplex>(func, arg));
+       (lelNode<DComplex,LELFunctionDComplex> (func, arg));
    default:
      throw (AipsError ("LatticeExprNode::newComplexFunc1D - "
                        "only complex arguments allowed"));
@@ -2011,11 +2224,11 @@ LatticeExprNode LatticeExprNode::newNumReal1D (LELFunctionEnums::Function func,
    case TpFloat:
    case TpComplex:
      return  LatticeExprNode
-       (std::make_shared<LELFunctionFloat>(func, arg));
+       (lelNode<Float,LELFunctionFloat> (func, arg));
    case TpDouble:
    case TpDComplex:
      return  LatticeExprNode
-       (std::make_shared<LELFunctionDouble>(func, arg));
+       (lelNode<Double,LELFunctionDouble> (func, arg));
    default:
      throw (AipsError ("LatticeExprNode::newNumReal1D - "
                        "output type must be real and numeric"));
@@ -2042,22 +2255,22 @@ LatticeExprNode LatticeExprNode::newNumFunc2D (LELFunctionEnums::Function func,
        arg[0] = left.makeFloat();
        arg[1] = right.makeFloat();
        return LatticeExprNode
-         (std::make_shared<LELFunctionFloat>(func, arg));
+         (lelNode<Float,LELFunctionFloat> (func, arg));
    case TpDouble:
        arg[0] = left.makeDouble();
        arg[1] = right.makeDouble();
        return LatticeExprNode
-         (std::make_shared<LELFunctionDouble>(func, arg));
+         (lelNode<Double,LELFunctionDouble> (func, arg));
    case TpComplex:
        arg[0] = left.makeComplex();
        arg[1] = right.makeComplex();
        return LatticeExprNode
-         (std::make_shared<LELFunctionComplex>(func, arg));
+         (lelNode<Complex,LELFunctionComplex> (func, arg));
    case TpDComplex:
        arg[0] = left.makeDComplex();
        arg[1] = right.makeDComplex();
        return LatticeExprNode
-         (std::make_shared<LELFunctionDComplex>(func, arg));
+         (lelNode<DComplex,LELFunctionDComplex> (func, arg));
    default:
        throw (AipsError ("LatticeExprNode::newNumFunc2D - "
                          "Bool argument used in numerical function"));
@@ -2103,20 +2316,20 @@ LatticeExprNode LatticeExprNode::newNumBinary (LELBinaryEnums::Operation oper,
   switch (dtype) {
   case TpFloat:
     return LatticeExprNode
-      (std::make_shared<LELBinary<Float>>(oper, expr0.pExprFloat_p,
-                                          expr1.pExprFloat_p));
+      (lelNode<Float,LELBinary<Float>> (oper, expr0.pExprFloat_p,
+                                        expr1.pExprFloat_p));
   case TpDouble:
     return LatticeExprNode
-      (std::make_shared<LELBinary<Double>>(oper, expr0.pExprDouble_p,
-                                           expr1.pExprDouble_p));
+      (lelNode<Double,LELBinary<Double>> (oper, expr0.pExprDouble_p,
+                                          expr1.pExprDouble_p));
   case TpComplex:
     return LatticeExprNode
-      (std::make_shared<LELBinary<Complex>>(oper, expr0.pExprComplex_p,
+      (lelNode<Complex,LELBinary<Complex>> (oper, expr0.pExprComplex_p,
                                             expr1.pExprComplex_p));
   default:
     return LatticeExprNode
-      (std::make_shared<LELBinary<DComplex>>(oper, expr0.pExprDComplex_p,
-                                             expr1.pExprDComplex_p));
+      (lelNode<DComplex,LELBinary<DComplex>> (oper, expr0.pExprDComplex_p,
+                                              expr1.pExprDComplex_p));
   }
   return LatticeExprNode();
 }
@@ -2145,8 +2358,8 @@ LatticeExprNode LatticeExprNode::newLogBinary (LELBinaryEnums::Operation oper,
   // Make the operands the same dimensionality (if needed and possible).
   makeEqualDim (expr0, expr1);
   return LatticeExprNode
-    (std::make_shared<LELBinaryBool>(oper, expr0.pExprBool_p,
-                                     expr1.pExprBool_p));
+    (lelNode<Bool,LELBinaryBool> (oper, expr0.pExprBool_p,
+                                  expr1.pExprBool_p));
 }
 
 
@@ -2196,24 +2409,24 @@ LatticeExprNode LatticeExprNode::newBinaryCmp (LELBinaryEnums::Operation oper,
   switch (dtype) {
   case TpFloat:
     return LatticeExprNode
-      (std::make_shared<LELBinaryCmp<Float>>(oper, expr0.pExprFloat_p,
-                                             expr1.pExprFloat_p));
+      (lelNode<Bool,LELBinaryCmp<Float>> (oper, expr0.pExprFloat_p,
+                                          expr1.pExprFloat_p));
   case TpDouble:
     return LatticeExprNode
-      (std::make_shared<LELBinaryCmp<Double>>(oper, expr0.pExprDouble_p,
-                                              expr1.pExprDouble_p));
+      (lelNode<Bool,LELBinaryCmp<Double>> (oper, expr0.pExprDouble_p,
+                                           expr1.pExprDouble_p));
   case TpComplex:
     return LatticeExprNode
-      (std::make_shared<LELBinaryCmp<Complex>>(oper, expr0.pExprComplex_p,
-                                               expr1.pExprComplex_p));
+      (lelNode<Bool,LELBinaryCmp<Complex>> (oper, expr0.pExprComplex_p,
+                                            expr1.pExprComplex_p));
   case TpDComplex:
     return LatticeExprNode
-      (std::make_shared<LELBinaryCmp<DComplex>>(oper, expr0.pExprDComplex_p,
-                                                expr1.pExprDComplex_p));
+      (lelNode<Bool,LELBinaryCmp<DComplex>> (oper, expr0.pExprDComplex_p,
+                                             expr1.pExprDComplex_p));
   default:
     return LatticeExprNode
-      (std::make_shared<LELBinaryBool>(oper, expr0.pExprBool_p,
-                                       expr1.pExprBool_p));
+      (lelNode<Bool,LELBinaryBool> (oper, expr0.pExprBool_p,
+                                    expr1.pExprBool_p));
   }
   return LatticeExprNode();
 }
@@ -2290,7 +2503,7 @@ std::shared_ptr<LELInterface<Float>> LatticeExprNode::makeFloat() const
     case TpFloat:
       return pExprFloat_p;
     case TpDouble:
-      return std::make_shared<LELConvert<Float,Double>>(pExprDouble_p);
+      return lelConvertNode<Float,Double> (pExprDouble_p);
     default:
       throw (AipsError ("LatticeExprNode::makeFloat - "
                         "conversion to Float not possible"));
@@ -2301,7 +2514,7 @@ std::shared_ptr<LELInterface<Double>> LatticeExprNode::makeDouble() const
 {
     switch (dataType()) {
     case TpFloat:
-      return std::make_shared<LELConvert<Double,Float>>(pExprFloat_p);
+      return lelConvertNode<Double,Float> (pExprFloat_p);
     case TpDouble:
       return pExprDouble_p;
     default:
@@ -2314,13 +2527,13 @@ std::shared_ptr<LELInterface<Complex>> LatticeExprNode::makeComplex() const
 {
     switch (dataType()) {
     case TpFloat:
-      return std::make_shared<LELConvert<Complex,Float>>(pExprFloat_p);
+      return lelConvertNode<Complex,Float> (pExprFloat_p);
     case TpDouble:
-      return std::make_shared<LELConvert<Complex,Double>>(pExprDouble_p);
+      return lelConvertNode<Complex,Double> (pExprDouble_p);
     case TpComplex:
       return pExprComplex_p;
     case TpDComplex:
-      return std::make_shared<LELConvert<Complex,DComplex>>(pExprDComplex_p);
+      return lelConvertNode<Complex,DComplex> (pExprDComplex_p);
     default:
       throw (AipsError ("LatticeExprNode::makeComplex - "
                         "conversion to Complex not possible"));
@@ -2331,11 +2544,11 @@ std::shared_ptr<LELInterface<DComplex>> LatticeExprNode::makeDComplex() const
 {
     switch (dataType()) {
     case TpFloat:
-      return std::make_shared<LELConvert<DComplex,Float>>(pExprFloat_p);
+      return lelConvertNode<DComplex,Float> (pExprFloat_p);
     case TpDouble:
-      return std::make_shared<LELConvert<DComplex,Double>>(pExprDouble_p);
+      return lelConvertNode<DComplex,Double> (pExprDouble_p);
     case TpComplex:
-      return std::make_shared<LELConvert<DComplex,Complex>>(pExprComplex_p);
+      return lelConvertNode<DComplex,Complex> (pExprComplex_p);
     case TpDComplex:
       return pExprDComplex_p;
     default:
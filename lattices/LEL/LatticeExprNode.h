@@ -650,6 +650,17 @@ public:
     { pExprBool_p->evalRef (result, section); }
 // </group>
 
+// Add the expression to a program for fused evaluation.
+// This function is meant for internal use by the LEL classes and
+// LatticeExpr.
+// <group>
+   void fuse (LELFused<Float>& fused) const;
+   void fuse (LELFused<Double>& fused) const;
+   void fuse (LELFused<Complex>& fused) const;
+   void fuse (LELFused<DComplex>& fused) const;
+   void fuse (LELFused<Bool>& fused) const;
+// </group>
+
 // Evaluate the expression (in case it is a scalar).  The "eval"
 // and "get*" functions do the same thing, they just have
 // a slightly different interface.
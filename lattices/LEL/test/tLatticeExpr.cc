@@ -27,6 +27,7 @@
 #include <casacore/lattices/Lattices/ArrayLattice.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/BasicSL/Constants.h>
@@ -58,6 +59,8 @@ Bool checkDComplex(Lattice<DComplex>& expr,
                 const IPosition shape,
                 const Bool supress);
 
+Bool checkFused(Bool supress);
+Bool checkShared(Bool supress);
 Bool checkBool(Lattice<Bool>& expr, 
                 const Bool result,
                 const IPosition shape,
@@ -227,6 +230,9 @@ int main (int argc, const char* argv[])
 
 
 
+    if (!checkFused(supress)) ok = False;
+    if (!checkShared(supress)) ok = False;
+
   cout << endl;
   if (!ok) {
      cout << "not ok" << endl;
@@ -674,3 +680,123 @@ Bool checkBool(Lattice<Bool>& expr,
 
 
 
+
+
+// Compare the fused evaluation of some expressions with the evaluation
+// node by node.
+template<class T>
+Bool checkFusedExpr (const LatticeExprNode& node, const String& name,
+                     Bool supress)
+{
+   LatticeExpr<T> expr(node);
+   LatticeExpr<T> exprNode(node);
+   exprNode.setFusedEval (False);
+   ArrayLattice<T> fused(expr.shape());
+   ArrayLattice<T> unfused(expr.shape());
+   fused.copyData (expr);
+   unfused.copyData (exprNode);
+   if (! allNear (fused.get(), unfused.get(), 1e-5)) {
+      if (!supress) {
+         cout << "   fused result of " << name << " differs" << endl;
+      }
+      return False;
+   }
+   return True;
+}
+
+Bool checkFused (Bool supress)
+{
+   cout << "Fused" << endl;
+   Bool ok = True;
+   IPosition shape(2, 300, 250);
+   ArrayLattice<Float> a(shape);
+   ArrayLattice<Float> b(shape);
+   Array<Float> arr(shape);
+   indgen (arr, Float(1), Float(0.001));
+   a.put (arr);
+   indgen (arr, Float(-10), Float(0.003));
+   b.put (arr);
+   LatticeExprNode na(a);
+   LatticeExprNode nb(b);
+   if (!checkFusedExpr<Float> (sqrt(pow(na,2) + pow(nb,2)),
+                               "sqrt(a^2+b^2)", supress)) ok = False;
+   if (!checkFusedExpr<Float> (-min(na,nb)*3 - max(sin(nb),cos(na)) / na,
+                               "min,max,sin,cos", supress)) ok = False;
+   if (!checkFusedExpr<Float> (atan2(nb,na) + fmod(na,2) + abs(nb) +
+                               pow(na, nb/100),
+                               "atan2,fmod,abs,pow", supress)) ok = False;
+   // Expression with a non-fusable part (a reduction) and a double part.
+   if (!checkFusedExpr<Float> (na*na + sum(nb) - log(na),
+                               "sum", supress)) ok = False;
+   if (!checkFusedExpr<Double> (sqrt(toDouble(na)) * exp(toDouble(nb)/100),
+                                "double", supress)) ok = False;
+   // A masked expression cannot be fused, but must give the right result.
+   if (!checkFusedExpr<Float> ((na+nb)[nb>0], "masked", supress)) ok = False;
+   return ok;
+}
+
+// Check that a common subexpression is a single shared node and that
+// it gives the correct result, also after the lattice data have changed.
+Bool checkShared (Bool supress)
+{
+   cout << "Shared" << endl;
+   Bool ok = True;
+   IPosition shape(2, 60, 50);
+   ArrayLattice<Float> a(shape);
+   ArrayLattice<Float> b(shape);
+   Array<Float> arra(shape);
+   Array<Float> arrb(shape);
+   indgen (arra, Float(1), Float(0.01));
+   indgen (arrb, Float(-10), Float(0.03));
+   a.put (arra);
+   b.put (arrb);
+   LatticeExprNode na(a);
+   LatticeExprNode nb(b);
+   LatticeExprNode diff1 = na-nb;
+   LatticeExprNode diff2 = na-nb;
+   if (diff1.makeFloat() != diff2.makeFloat()  ||
+       !diff1.makeFloat()->isShared()) {
+      if (!supress) {
+         cout << "   (a-b) is not shared" << endl;
+      }
+      ok = False;
+   }
+   // Also the constant makes no difference.
+   if ((na-2).makeFloat() != (na-2).makeFloat()) {
+      if (!supress) {
+         cout << "   (a-2) is not shared" << endl;
+      }
+      ok = False;
+   }
+   for (uInt i=0; i<2; ++i) {
+      LatticeExpr<Float> expr ((na-nb) * (na-nb) + sin(na-nb));
+      expr.setFusedEval (False);
+      ArrayLattice<Float> result(shape);
+      result.copyData (expr);
+      Array<Float> expected = (arra-arrb) * (arra-arrb) + sin(arra-arrb);
+      if (! allNear (result.get(), expected, 1e-5)) {
+         if (!supress) {
+            cout << "   result of shared (a-b) differs" << endl;
+         }
+         ok = False;
+      }
+      // A masked common subexpression.
+      LatticeExprNode masked = (na-nb)[nb>0];
+      LatticeExpr<Float> mexpr (masked * masked);
+      Array<Float> mvalue;
+      Array<Bool> mmask;
+      mexpr.getSlice (mvalue, IPosition(2,0), shape, IPosition(2,1));
+      mexpr.getMaskSlice (mmask, IPosition(2,0), shape, IPosition(2,1));
+      if (! allEQ (mmask, arrb>Float(0))  ||
+          ! allNear (mvalue, (arra-arrb) * (arra-arrb), 1e-5)) {
+         if (!supress) {
+            cout << "   result of shared masked (a-b) differs" << endl;
+         }
+         ok = False;
+      }
+      // Change the data; the next evaluation must use the new values.
+      arra += Float(1);
+      a.put (arra);
+   }
+   return ok;
+}
@@ -25,6 +25,7 @@
 
 
 #include <casacore/lattices/LRegions/LCComplement.h>
+#include <casacore/lattices/LRegions/MaskRuns.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Exceptions/Error.h>
@@ -117,6 +118,12 @@ void LCComplement::defineBox()
 }
 
 
+MaskRuns LCComplement::makeMaskRuns() const
+{
+    return regionRuns(0).complement();
+}
+
+
 void LCComplement::multiGetSlice (Array<Bool>& buffer,
 				  const Slicer& section)
 {
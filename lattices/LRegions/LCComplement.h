@@ -114,6 +114,9 @@ protected:
     // Do the actual getting of the mask.
     virtual void multiGetSlice (Array<Bool>& buffer, const Slicer& section);
 
+    // Make the mask runs by taking the complement of those of the region.
+    virtual MaskRuns makeMaskRuns() const;
+
 private:
     // Make the bounding box and determine the offsets.
     void defineBox();
@@ -25,6 +25,7 @@
 
 
 #include <casacore/lattices/LRegions/LCDifference.h>
+#include <casacore/lattices/LRegions/MaskRuns.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Utilities/Assert.h>
@@ -116,6 +117,12 @@ void LCDifference::defineBox()
 }
 
 
+MaskRuns LCDifference::makeMaskRuns() const
+{
+    return regionRuns(0).combine (regionRuns(1), MaskRuns::Difference);
+}
+
+
 void LCDifference::multiGetSlice (Array<Bool>& buffer,
 				  const Slicer& section)
 {
@@ -117,6 +117,9 @@ protected:
     // Do the actual getting of the mask.
     virtual void multiGetSlice (Array<Bool>& buffer, const Slicer& section);
 
+    // Make the mask runs by combining those of the regions.
+    virtual MaskRuns makeMaskRuns() const;
+
 private:
     // Make the bounding box and determine the offsets.
     void defineBox();
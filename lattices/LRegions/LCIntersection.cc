@@ -25,6 +25,7 @@
 
 
 #include <casacore/lattices/LRegions/LCIntersection.h>
+#include <casacore/lattices/LRegions/MaskRuns.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Exceptions/Error.h>
@@ -165,6 +166,17 @@ void LCIntersection::defineBox()
 }
 
 
+MaskRuns LCIntersection::makeMaskRuns() const
+{
+    MaskRuns runs = regionRuns (0);
+    uInt nr = regions().nelements();
+    for (uInt i=1; i<nr  &&  !runs.empty(); i++) {
+	runs = runs.combine (regionRuns(i), MaskRuns::Intersection);
+    }
+    return runs;
+}
+
+
 void LCIntersection::multiGetSlice (Array<Bool>& buffer,
 				    const Slicer& section)
 {
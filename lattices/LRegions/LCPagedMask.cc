@@ -24,6 +24,7 @@
 //#                        Charlottesville, VA 22903-2475 USA
 
 #include <casacore/lattices/LRegions/LCPagedMask.h>
+#include <casacore/lattices/LRegions/MaskOccupancy.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/Tables/TableAttr.h>
 #include <casacore/casa/Arrays/Vector.h>
@@ -129,6 +130,11 @@ IPosition LCPagedMask::doNiceCursorShape (uInt maxPixels) const
     return itsMask.niceCursorShape (maxPixels);
 }
 
+MaskOccupancy LCPagedMask::makeOccupancy() const
+{
+    return MaskOccupancy (itsMask, itsMask.tileShape());
+}
+
 uInt LCPagedMask::maximumCacheSize() const
 {
     return itsMask.maximumCacheSize();
@@ -213,6 +219,7 @@ Bool LCPagedMask::hasLock (FileLocker::LockType type) const
 void LCPagedMask::resync()
 {
     itsMask.resync();
+    maskChanged();
 }
 
 void LCPagedMask::flush()
@@ -151,6 +151,7 @@ public:
     // if the table lock option is UserNoReadLocking or AutoNoReadLocking.
     // In that cases the table system does not acquire a read-lock, thus
     // does not synchronize itself automatically.
+    // The occupancy summary of the mask will be made again.
     virtual void resync();
 
     // Flush the data (but do not unlock).
@@ -186,6 +187,9 @@ protected:
     virtual LCRegion* doTranslate (const Vector<Float>& translateVector,
 				   const IPosition& newLatticeShape) const;
 
+    // Make the occupancy summary by reading the mask using its tile shape.
+    virtual MaskOccupancy makeOccupancy() const;
+
 private:
     // Create the object from a record (for an existing mask).
     LCPagedMask (PagedArray<Bool>& mask,
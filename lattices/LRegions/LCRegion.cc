@@ -25,27 +25,44 @@
 
 #include <casacore/lattices/LRegions/LCRegion.h>
 #include <casacore/lattices/LRegions/RegionType.h>
+#include <casacore/lattices/LRegions/MaskRuns.h>
+#include <casacore/lattices/LRegions/MaskOccupancy.h>
+#include <casacore/lattices/Lattices/TiledShape.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <mutex>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// The occupancy summary is made on demand, possibly by multiple threads
+// using copies of the region.
+struct LCRegion::OccupancyCache
+{
+    std::mutex mutex;
+    std::shared_ptr<const MaskOccupancy> occupancy;
+};
+
+
 LCRegion::LCRegion()
+: itsOccupancy (std::make_shared<OccupancyCache>())
 {}
 
 LCRegion::LCRegion (const IPosition& latticeShape)
-: itsShape (latticeShape)
+: itsShape     (latticeShape),
+  itsOccupancy (std::make_shared<OccupancyCache>())
 {}
 
 LCRegion::LCRegion (const LCRegion& other)
 : Lattice<Bool>(),
   itsShape       (other.itsShape),
   itsBoundingBox (other.itsBoundingBox),
-  itsComment     (other.itsComment)
+  itsComment     (other.itsComment),
+  itsMaskRuns    (other.itsMaskRuns),
+  itsOccupancy   (other.itsOccupancy)
 {}
 
 LCRegion& LCRegion::operator= (const LCRegion& other)
@@ -55,6 +72,8 @@ LCRegion& LCRegion::operator= (const LCRegion& other)
 	itsShape       = other.itsShape;
 	itsBoundingBox = other.itsBoundingBox;
 	itsComment     = other.itsComment;
+	itsMaskRuns    = other.itsMaskRuns;
+	itsOccupancy   = other.itsOccupancy;
     }
     return *this;
 }
@@ -83,6 +102,44 @@ Lattice<Bool>* LCRegion::clone() const
     return cloneRegion();
 }
 
+const MaskRuns& LCRegion::maskRuns() const
+{
+    // The mask of a writable region can change, so make the runs again.
+    if (!itsMaskRuns  ||  isWritable()) {
+	itsMaskRuns.reset (new MaskRuns (makeMaskRuns()));
+    }
+    return *itsMaskRuns;
+}
+
+MaskRuns LCRegion::makeMaskRuns() const
+{
+    if (! hasMask()) {
+	return MaskRuns (shape(), True);
+    }
+    return MaskRuns (*this);
+}
+
+std::shared_ptr<const MaskOccupancy> LCRegion::occupancy() const
+{
+    std::lock_guard<std::mutex> lock(itsOccupancy->mutex);
+    if (! itsOccupancy->occupancy) {
+	itsOccupancy->occupancy =
+	    std::make_shared<const MaskOccupancy> (makeOccupancy());
+    }
+    return itsOccupancy->occupancy;
+}
+
+MaskOccupancy LCRegion::makeOccupancy() const
+{
+    return MaskOccupancy (maskRuns(), TiledShape(shape()).tileShape(4096));
+}
+
+void LCRegion::maskChanged()
+{
+    std::lock_guard<std::mutex> lock(itsOccupancy->mutex);
+    itsOccupancy->occupancy.reset();
+}
+
 void LCRegion::handleDelete()
 {}
 void LCRegion::handleRename (const String&, Bool)
@@ -119,6 +176,8 @@ void LCRegion::setBoundingBox (const Slicer& box)
     IPosition blc, trc, inc;
     box.inferShapeFromSource (itsShape, blc, trc, inc);
     itsBoundingBox = Slicer (blc, trc, inc, Slicer::endIsLast);
+    itsMaskRuns.reset();
+    itsOccupancy = std::make_shared<OccupancyCache>();
 }
 void LCRegion::setShapeAndBoundingBox (const IPosition& latticeShape,
 				       const Slicer& boundingBox)
@@ -31,12 +31,15 @@
 #include <casacore/lattices/Lattices/Lattice.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Arrays/Slicer.h>
+#include <memory>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
 class TableRecord;
 class RecordInterface;
+class MaskRuns;
+class MaskOccupancy;
 
 
 // <summary>
@@ -132,6 +135,18 @@ public:
     // Does the region have a mask?
     virtual Bool hasMask() const = 0;
 
+    // Get the mask of the region (i.e. of its bounding box) as runs of
+    // True values (see class <linkto class=MaskRuns>MaskRuns</linkto>).
+    // The runs are made once and kept, unless the region is writable.
+    const MaskRuns& maskRuns() const;
+
+    // Get the tile-level occupancy summary of the mask of the region
+    // (see class <linkto class=MaskOccupancy>MaskOccupancy</linkto>).
+    // It is made once and shared by the copies of the region. It is made
+    // again after the mask has been changed through this region or one
+    // of its copies, or after a resync of a paged mask.
+    std::shared_ptr<const MaskOccupancy> occupancy() const;
+
     // Construct another LCRegion (for e.g. another lattice) by moving
     // this one. It recalculates the bounding box and mask.
     // A positive translation value indicates "to right".
@@ -207,6 +222,20 @@ protected:
 				 const Slicer& boundingBox);
     // </group>
 
+    // Make the runs of the mask.
+    // The default implementation reads the mask.
+    virtual MaskRuns makeMaskRuns() const;
+
+    // Make the occupancy summary of the mask.
+    // The default implementation makes it from the mask runs using a
+    // tile shape of about 4096 pixels (see class
+    // <linkto class=TiledShape>TiledShape</linkto>). The summary is kept
+    // in memory, so its tiles can be smaller than tiles on disk.
+    virtual MaskOccupancy makeOccupancy() const;
+
+    // Tell that the mask has changed, so its occupancy summary is outdated.
+    void maskChanged();
+
     // Do the actual translate in a derived class.
     virtual LCRegion* doTranslate (const Vector<Float>& translateVector,
 				   const IPosition& newLatticeShape) const = 0;
@@ -219,6 +248,10 @@ private:
     IPosition itsShape;
     Slicer    itsBoundingBox;
     String    itsComment;
+    mutable std::shared_ptr<MaskRuns> itsMaskRuns;
+    // The occupancy summary (made on demand) is shared with copies.
+    struct OccupancyCache;
+    std::shared_ptr<OccupancyCache> itsOccupancy;
 };
 
 
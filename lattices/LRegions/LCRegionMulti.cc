@@ -26,6 +26,7 @@
 
 #include <casacore/lattices/LRegions/LCRegionMulti.h>
 #include <casacore/lattices/LRegions/LCBox.h>
+#include <casacore/lattices/LRegions/MaskRuns.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
@@ -208,6 +209,15 @@ void LCRegionMulti::fillHasMask()
     }
 }
 
+MaskRuns LCRegionMulti::regionRuns (uInt regNr) const
+{
+    DebugAssert (regNr < itsRegions.nelements(), AipsError);
+    const LCRegion& region = *itsRegions[regNr];
+    return region.maskRuns().reposition
+                  (shape(),
+                   region.boundingBox().start() - boundingBox().start());
+}
+
 Bool LCRegionMulti::findAreas (IPosition& bufStart, IPosition& bufEnd,
 			       IPosition& regStart, IPosition& regEnd,
 			       const Slicer& section, uInt regNr) const
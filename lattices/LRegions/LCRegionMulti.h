@@ -135,6 +135,10 @@ protected:
 
     // Get the contributing regions.
     const PtrBlock<const LCRegion*>& regions() const;
+
+    // Get the mask runs of a contributing region positioned in the
+    // bounding box of this region.
+    MaskRuns regionRuns (uInt regNr) const;
     
 protected:
     // Construct from lattice shape and region pointer, which is
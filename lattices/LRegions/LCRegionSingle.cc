@@ -157,36 +157,43 @@ void LCRegionSingle::doPutSlice (const Array<Bool>& sourceBuffer,
 {
     AlwaysAssert (hasMask() && isWritable(), AipsError);
     itsMaskPtr->putSlice (sourceBuffer, where, stride);
+    maskChanged();
 }
 void LCRegionSingle::set (const Bool& value)
 {
     AlwaysAssert (hasMask() && isWritable(), AipsError);
     itsMaskPtr->set (value);
+    maskChanged();
 }
 void LCRegionSingle::apply (Bool (*function)(Bool))
 {
     AlwaysAssert (hasMask() && isWritable(), AipsError);
     itsMaskPtr->apply (function);
+    maskChanged();
 }
 void LCRegionSingle::apply (Bool (*function)(const Bool&))
 {
     AlwaysAssert (hasMask() && isWritable(), AipsError);
     itsMaskPtr->apply (function);
+    maskChanged();
 }
 void LCRegionSingle::apply (const Functional<Bool,Bool>& function)
 {
     AlwaysAssert (hasMask() && isWritable(), AipsError);
     itsMaskPtr->apply (function);
+    maskChanged();
 }
 void LCRegionSingle::putAt (const Bool& value, const IPosition& where)
 {
     AlwaysAssert (hasMask() && isWritable(), AipsError);
     itsMaskPtr->putAt (value, where);
+    maskChanged();
 }
 void LCRegionSingle::copyData (const Lattice<Bool>& from)
 {
     AlwaysAssert (hasMask() && isWritable(), AipsError);
     itsMaskPtr->copyData (from);
+    maskChanged();
 }
 
 } //# NAMESPACE CASACORE - END
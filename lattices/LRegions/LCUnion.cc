@@ -25,6 +25,7 @@
 
 
 #include <casacore/lattices/LRegions/LCUnion.h>
+#include <casacore/lattices/LRegions/MaskRuns.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Utilities/Assert.h>
@@ -151,6 +152,17 @@ void LCUnion::defineBox()
 }
 
 
+MaskRuns LCUnion::makeMaskRuns() const
+{
+    MaskRuns runs = regionRuns (0);
+    uInt nr = regions().nelements();
+    for (uInt i=1; i<nr; i++) {
+	runs = runs.combine (regionRuns(i), MaskRuns::Union);
+    }
+    return runs;
+}
+
+
 void LCUnion::multiGetSlice (Array<Bool>& buffer,
 			     const Slicer& section)
 {
@@ -0,0 +1,227 @@
+//# MaskOccupancy.cc: Tile-level occupancy summary of a mask
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/lattices/LRegions/MaskOccupancy.h>
+#include <casacore/lattices/LRegions/MaskRuns.h>
+#include <casacore/lattices/Lattices/Lattice.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// Step to the next position in [blc,trc] for the axes from the given
+// first axis on. False is returned if at the end.
+static Bool nextGridPos (IPosition& pos, const IPosition& blc,
+                         const IPosition& trc, uInt firstAxis)
+{
+  for (uInt i=firstAxis; i<pos.nelements(); ++i) {
+    if (++pos[i] <= trc[i]) {
+      return True;
+    }
+    pos[i] = blc[i];
+  }
+  return False;
+}
+
+
+MaskOccupancy::MaskOccupancy()
+{}
+
+MaskOccupancy::MaskOccupancy (const MaskRuns& runs,
+                              const IPosition& tileShape)
+{
+  init (runs.shape(), tileShape);
+  if (itsCount.empty()) {
+    return;
+  }
+  uInt ndim = itsShape.nelements();
+  Int64 tile0 = itsTileShape[0];
+  IPosition pos(ndim, 0);
+  IPosition blc(ndim, 0);
+  IPosition trc(itsShape - 1);
+  Int64 nrl = runs.nrLines();
+  for (Int64 line=0; line<nrl; ++line) {
+    // Get the offset of the first tile containing this line.
+    Int64 offset = 0;
+    Int64 step = itsGridShape[0];
+    for (uInt i=1; i<ndim; ++i) {
+      offset += (pos[i] / itsTileShape[i]) * step;
+      step *= itsGridShape[i];
+    }
+    const Int64* run = runs.runs(line);
+    for (uInt j=0; j<runs.nrRuns(line); ++j) {
+      Int64 st = run[2*j];
+      Int64 end = run[2*j+1];
+      for (Int64 t=st/tile0; t*tile0<end; ++t) {
+        itsCount[offset+t] += std::min(end, (t+1)*tile0) - std::max(st, t*tile0);
+      }
+    }
+    nextGridPos (pos, blc, trc, 1);
+  }
+}
+
+MaskOccupancy::MaskOccupancy (const Lattice<Bool>& mask,
+                              const IPosition& tileShape)
+{
+  init (mask.shape(), tileShape);
+  if (itsCount.empty()) {
+    return;
+  }
+  // Read a row of tiles along the first axis at a time.
+  uInt ndim = itsShape.nelements();
+  Int64 len = itsShape[0];
+  Int64 tile0 = itsTileShape[0];
+  IPosition gridPos(ndim, 0);
+  IPosition gridBlc(ndim, 0);
+  IPosition gridTrc(itsGridShape - 1);
+  IPosition blc(ndim), trc(ndim);
+  Int64 offset = 0;
+  do {
+    for (uInt i=1; i<ndim; ++i) {
+      blc[i] = gridPos[i] * itsTileShape[i];
+      trc[i] = std::min(blc[i] + itsTileShape[i], itsShape[i]) - 1;
+    }
+    blc[0] = 0;
+    trc[0] = len - 1;
+    Array<Bool> chunk = mask.getSlice (Slicer(blc, trc, Slicer::endIsLast));
+    Int64 nrl = chunk.nelements() / len;
+    Bool deleteIt;
+    const Bool* data = chunk.getStorage (deleteIt);
+    for (Int64 line=0; line<nrl; ++line) {
+      const Bool* ptr = data + line*len;
+      for (Int64 t=0; t<itsGridShape[0]; ++t) {
+        Int64 end = std::min((t+1)*tile0, len);
+        Int64 n = 0;
+        for (Int64 i=t*tile0; i<end; ++i) {
+          n += ptr[i];
+        }
+        itsCount[offset+t] += n;
+      }
+    }
+    chunk.freeStorage (data, deleteIt);
+    offset += itsGridShape[0];
+  } while (nextGridPos (gridPos, gridBlc, gridTrc, 1));
+}
+
+void MaskOccupancy::init (const IPosition& shape, const IPosition& tileShape)
+{
+  uInt ndim = shape.nelements();
+  if (tileShape.nelements() != ndim) {
+    throw AipsError ("MaskOccupancy: tile shape " + tileShape.toString() +
+                     " and mask shape " + shape.toString() +
+                     " have different dimensionality");
+  }
+  itsShape.resize (ndim);
+  itsShape = shape;
+  itsTileShape.resize (ndim);
+  itsGridShape.resize (ndim);
+  for (uInt i=0; i<ndim; ++i) {
+    itsTileShape[i] = std::max(ssize_t(1), std::min(tileShape[i], shape[i]));
+    itsGridShape[i] = (shape[i] + itsTileShape[i] - 1) / itsTileShape[i];
+  }
+  itsCount.clear();
+  if (ndim > 0) {
+    itsCount.resize (itsGridShape.product(), 0);
+  }
+}
+
+Int64 MaskOccupancy::tileSize (const IPosition& gridPos) const
+{
+  Int64 size = 1;
+  for (uInt i=0; i<itsShape.nelements(); ++i) {
+    Int64 st = gridPos[i] * itsTileShape[i];
+    size *= std::min(st + itsTileShape[i], Int64(itsShape[i])) - st;
+  }
+  return size;
+}
+
+Int64 MaskOccupancy::gridOffset (const IPosition& gridPos) const
+{
+  Int64 offset = 0;
+  Int64 step = 1;
+  for (uInt i=0; i<itsGridShape.nelements(); ++i) {
+    offset += gridPos[i] * step;
+    step *= itsGridShape[i];
+  }
+  return offset;
+}
+
+Int64 MaskOccupancy::nrTrue (const IPosition& gridPos) const
+{
+  return itsCount[gridOffset (gridPos)];
+}
+
+Int64 MaskOccupancy::nrEmptyTiles() const
+{
+  return std::count (itsCount.begin(), itsCount.end(), Int64(0));
+}
+
+Bool MaskOccupancy::allFalse (const Slicer& section) const
+{
+  return checkTiles (section, False);
+}
+
+Bool MaskOccupancy::allTrue (const Slicer& section) const
+{
+  return checkTiles (section, True);
+}
+
+Bool MaskOccupancy::checkTiles (const Slicer& section, Bool full) const
+{
+  uInt ndim = itsShape.nelements();
+  if (section.ndim() != ndim) {
+    throw AipsError ("MaskOccupancy: section " + section.start().toString() +
+                     " and mask shape " + itsShape.toString() +
+                     " have different dimensionality");
+  }
+  if (ndim == 0) {
+    return False;
+  }
+  // Get the tiles overlapping the section.
+  IPosition blc(ndim), trc(ndim);
+  for (uInt i=0; i<ndim; ++i) {
+    Int64 st = std::max(section.start()[i], ssize_t(0));
+    Int64 end = std::min(section.end()[i], itsShape[i] - 1);
+    if (st > end) {
+      return True;
+    }
+    blc[i] = st / itsTileShape[i];
+    trc[i] = end / itsTileShape[i];
+  }
+  IPosition gridPos(blc);
+  do {
+    Int64 nr = itsCount[gridOffset (gridPos)];
+    if (full ? nr != tileSize(gridPos) : nr != 0) {
+      return False;
+    }
+  } while (nextGridPos (gridPos, blc, trc, 0));
+  return True;
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,149 @@
+//# MaskOccupancy.h: Tile-level occupancy summary of a mask
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef LATTICES_MASKOCCUPANCY_H
+#define LATTICES_MASKOCCUPANCY_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Slicer;
+class MaskRuns;
+template<class T> class Lattice;
+
+
+// <summary>
+// Tile-level occupancy summary of a mask.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tMaskOccupancy">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=MaskRuns>MaskRuns</linkto>
+// </prerequisite>
+
+// <synopsis>
+// A MaskOccupancy object divides a Bool mask into tiles of a given shape
+// and holds the number of True values in each tile. The tiles at the
+// upper edges can be smaller than the tile shape.
+// <p>
+// It makes it possible to find out cheaply if a section of the mask is
+// entirely False or entirely True: a section is entirely False if all
+// tiles it overlaps have no True value, and entirely True if all these
+// tiles are entirely True. The answer is exact for sections aligned with
+// the tiles; for other sections a False answer only means that it is not
+// known from the summary.
+// <p>
+// It is used by <linkto class=LCRegion>LCRegion</linkto>::occupancy
+// (and thereby by <linkto class=SubLattice>SubLattice</linkto> and
+// <src>PagedImage</src>) to tell a
+// <linkto class=RO_MaskedLatticeIterator>RO_MaskedLatticeIterator</linkto>
+// that a cursor is fully masked, so that neither its data nor its mask
+// have to be read.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   PagedArray<Bool> mask ("mask.tab");
+//   MaskOccupancy occ (mask, mask.niceCursorShape());
+//   if (occ.allFalse (Slicer(IPosition(3,0,0,10), IPosition(3,100,100,1)))) {
+//     // Plane 10 is fully masked.
+//   }
+// </srcblock>
+// </example>
+
+class MaskOccupancy
+{
+public:
+  // Create an empty summary with a 0-dim shape.
+  MaskOccupancy();
+
+  // Make the summary from the runs of a mask.
+  MaskOccupancy (const MaskRuns& runs, const IPosition& tileShape);
+
+  // Make the summary by reading the mask in the lattice.
+  // It is read in chunks of a row of tiles.
+  MaskOccupancy (const Lattice<Bool>& mask, const IPosition& tileShape);
+
+  // Get the shape of the mask.
+  const IPosition& shape() const
+    { return itsShape; }
+
+  // Get the shape of the tiles.
+  const IPosition& tileShape() const
+    { return itsTileShape; }
+
+  // Get the number of tiles along each axis.
+  const IPosition& gridShape() const
+    { return itsGridShape; }
+
+  // Get the number of True values in the tile at the given grid position.
+  Int64 nrTrue (const IPosition& gridPos) const;
+
+  // Get the number of tiles without any True value.
+  Int64 nrEmptyTiles() const;
+
+  // Is the part [start,end] of the section entirely False or entirely True?
+  // The stride is ignored.
+  // As explained in the synopsis, a False result for a section not aligned
+  // with the tiles only means that the summary cannot tell.
+  // <group>
+  Bool allFalse (const Slicer& section) const;
+  Bool allTrue (const Slicer& section) const;
+  // </group>
+
+private:
+  // Initialize for the given shapes with all counts zero.
+  void init (const IPosition& shape, const IPosition& tileShape);
+
+  // Get the index of the tile at the given grid position.
+  Int64 gridOffset (const IPosition& gridPos) const;
+
+  // Get the number of elements in the tile at the given grid position.
+  Int64 tileSize (const IPosition& gridPos) const;
+
+  // Check if all tiles overlapping the section are empty (full=False)
+  // or full (full=True).
+  Bool checkTiles (const Slicer& section, Bool full) const;
+
+  IPosition           itsShape;
+  IPosition           itsTileShape;
+  IPosition           itsGridShape;
+  // Number of True values per tile (in storage order of the grid).
+  std::vector<Int64>  itsCount;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
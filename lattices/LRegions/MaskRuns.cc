@@ -0,0 +1,445 @@
+//# MaskRuns.cc: Run-length encoded region mask
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/lattices/LRegions/MaskRuns.h>
+#include <casacore/lattices/Lattices/Lattice.h>
+#include <casacore/lattices/Lattices/LatticeIterator.h>
+#include <casacore/lattices/Lattices/LatticeStepper.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// Step to the next position in [blc,trc] with increment inc for the axes
+// after the first one. False is returned if at the end.
+static Bool nextLinePos (IPosition& pos, const IPosition& blc,
+                         const IPosition& trc, const IPosition& inc)
+{
+  for (uInt i=1; i<pos.nelements(); ++i) {
+    pos[i] += inc[i];
+    if (pos[i] <= trc[i]) {
+      return True;
+    }
+    pos[i] = blc[i];
+  }
+  return False;
+}
+
+
+MaskRuns::MaskRuns()
+: itsLineStart (1, 0)
+{}
+
+MaskRuns::MaskRuns (const IPosition& shape, Bool value)
+{
+  Int64 nrl = init (shape);
+  Bool fill = value  &&  shape.nelements() > 0  &&  shape[0] > 0;
+  for (Int64 i=0; i<nrl; ++i) {
+    if (fill) {
+      itsRuns.push_back (0);
+      itsRuns.push_back (shape[0]);
+    }
+    itsLineStart.push_back (itsRuns.size() / 2);
+  }
+}
+
+MaskRuns::MaskRuns (const Array<Bool>& mask)
+{
+  init (mask.shape());
+  if (itsShape.nelements() > 0) {
+    addLines (mask);
+  }
+}
+
+MaskRuns::MaskRuns (const Lattice<Bool>& mask)
+{
+  Int64 nrl = init (mask.shape());
+  if (itsShape.nelements() == 0) {
+    return;
+  }
+  if (itsShape.product() == 0) {
+    itsLineStart.resize (nrl+1, 0);
+    return;
+  }
+  // Read chunks of whole lines of at most about 1M elements.
+  uInt ndim = itsShape.nelements();
+  IPosition cursorShape(ndim, 1);
+  cursorShape[0] = itsShape[0];
+  Int64 size = itsShape[0];
+  for (uInt i=1; i<ndim; ++i) {
+    if (size * itsShape[i] > 1024*1024) {
+      break;
+    }
+    cursorShape[i] = itsShape[i];
+    size *= itsShape[i];
+  }
+  RO_LatticeIterator<Bool> iter (mask, LatticeStepper(itsShape, cursorShape));
+  for (iter.reset(); !iter.atEnd(); iter++) {
+    addLines (iter.cursor());
+  }
+}
+
+Int64 MaskRuns::init (const IPosition& shape)
+{
+  itsShape.resize (shape.nelements());
+  itsShape = shape;
+  Int64 nrl = 0;
+  if (shape.nelements() > 0) {
+    nrl = 1;
+    for (uInt i=1; i<shape.nelements(); ++i) {
+      nrl *= shape[i];
+    }
+  }
+  itsLineStart.clear();
+  itsLineStart.reserve (nrl+1);
+  itsLineStart.push_back (0);
+  itsRuns.clear();
+  return nrl;
+}
+
+void MaskRuns::addLines (const Array<Bool>& mask)
+{
+  Int64 len = itsShape[0];
+  Int64 nrl = 1;
+  for (uInt i=1; i<mask.ndim(); ++i) {
+    nrl *= mask.shape()[i];
+  }
+  Bool deleteIt;
+  const Bool* data = mask.getStorage (deleteIt);
+  for (Int64 line=0; line<nrl; ++line) {
+    const Bool* ptr = data + line*len;
+    Int64 i = 0;
+    while (i < len) {
+      while (i < len  &&  !ptr[i]) ++i;
+      if (i == len) {
+        break;
+      }
+      Int64 st = i;
+      while (i < len  &&  ptr[i]) ++i;
+      itsRuns.push_back (st);
+      itsRuns.push_back (i);
+    }
+    itsLineStart.push_back (itsRuns.size() / 2);
+  }
+  mask.freeStorage (data, deleteIt);
+}
+
+Int64 MaskRuns::lineNr (const IPosition& pos) const
+{
+  Int64 line = 0;
+  Int64 mult = 1;
+  for (uInt i=1; i<itsShape.nelements(); ++i) {
+    line += pos[i] * mult;
+    mult *= itsShape[i];
+  }
+  return line;
+}
+
+Int64 MaskRuns::nrTrue() const
+{
+  Int64 nr = 0;
+  for (size_t i=0; i<itsRuns.size(); i+=2) {
+    nr += itsRuns[i+1] - itsRuns[i];
+  }
+  return nr;
+}
+
+MaskRuns MaskRuns::combine (const MaskRuns& other, Operation operation) const
+{
+  if (! itsShape.isEqual (other.itsShape)) {
+    throw AipsError ("MaskRuns::combine - masks have different shapes");
+  }
+  MaskRuns result;
+  result.init (itsShape);
+  std::vector<Int64>& out = result.itsRuns;
+  Int64 nrl = nrLines();
+  for (Int64 line=0; line<nrl; ++line) {
+    const Int64* a = runs(line);
+    const Int64* b = other.runs(line);
+    uInt na = nrRuns(line);
+    uInt nb = other.nrRuns(line);
+    uInt i = 0;
+    uInt j = 0;
+    switch (operation) {
+    case Union:
+      {
+        Bool hasCur = False;
+        Int64 curSt = 0;
+        Int64 curEnd = 0;
+        while (i < na  ||  j < nb) {
+          Int64 st, end;
+          if (j >= nb  ||  (i < na  &&  a[2*i] <= b[2*j])) {
+            st  = a[2*i];
+            end = a[2*i+1];
+            ++i;
+          } else {
+            st  = b[2*j];
+            end = b[2*j+1];
+            ++j;
+          }
+          if (hasCur  &&  st <= curEnd) {
+            curEnd = std::max (curEnd, end);
+          } else {
+            if (hasCur) {
+              out.push_back (curSt);
+              out.push_back (curEnd);
+            }
+            curSt  = st;
+            curEnd = end;
+            hasCur = True;
+          }
+        }
+        if (hasCur) {
+          out.push_back (curSt);
+          out.push_back (curEnd);
+        }
+      }
+      break;
+    case Intersection:
+      while (i < na  &&  j < nb) {
+        Int64 st  = std::max (a[2*i], b[2*j]);
+        Int64 end = std::min (a[2*i+1], b[2*j+1]);
+        if (st < end) {
+          out.push_back (st);
+          out.push_back (end);
+        }
+        if (a[2*i+1] < b[2*j+1]) {
+          ++i;
+        } else {
+          ++j;
+        }
+      }
+      break;
+    case Difference:
+      for (; i<na; ++i) {
+        Int64 cur = a[2*i];
+        Int64 end = a[2*i+1];
+        while (j < nb  &&  b[2*j+1] <= cur) ++j;
+        for (uInt k=j; k<nb  &&  b[2*k] < end; ++k) {
+          if (b[2*k] > cur) {
+            out.push_back (cur);
+            out.push_back (b[2*k]);
+          }
+          cur = std::max (cur, b[2*k+1]);
+        }
+        if (cur < end) {
+          out.push_back (cur);
+          out.push_back (end);
+        }
+      }
+      break;
+    }
+    result.itsLineStart.push_back (out.size() / 2);
+  }
+  return result;
+}
+
+MaskRuns MaskRuns::complement() const
+{
+  MaskRuns result;
+  result.init (itsShape);
+  Int64 nrl = nrLines();
+  Int64 len = (nrl == 0  ?  0 : itsShape[0]);
+  for (Int64 line=0; line<nrl; ++line) {
+    const Int64* r = runs(line);
+    uInt nr = nrRuns(line);
+    Int64 cur = 0;
+    for (uInt i=0; i<nr; ++i) {
+      if (r[2*i] > cur) {
+        result.itsRuns.push_back (cur);
+        result.itsRuns.push_back (r[2*i]);
+      }
+      cur = r[2*i+1];
+    }
+    if (cur < len) {
+      result.itsRuns.push_back (cur);
+      result.itsRuns.push_back (len);
+    }
+    result.itsLineStart.push_back (result.itsRuns.size() / 2);
+  }
+  return result;
+}
+
+MaskRuns MaskRuns::reposition (const IPosition& shape,
+                               const IPosition& offset) const
+{
+  uInt ndim = itsShape.nelements();
+  if (shape.nelements() != ndim  ||  offset.nelements() != ndim) {
+    throw AipsError ("MaskRuns::reposition - shape and offset must have "
+                     "the dimensionality of the mask");
+  }
+  MaskRuns result;
+  Int64 nrl = result.init (shape);
+  if (nrl == 0) {
+    return result;
+  }
+  IPosition pos(ndim, 0);
+  IPosition oldPos(ndim, 0);
+  IPosition trc(shape - 1);
+  IPosition inc(ndim, 1);
+  for (Int64 line=0; line<nrl; ++line) {
+    Bool inside = True;
+    for (uInt i=1; i<ndim; ++i) {
+      oldPos[i] = pos[i] - offset[i];
+      if (oldPos[i] < 0  ||  oldPos[i] >= itsShape[i]) {
+        inside = False;
+        break;
+      }
+    }
+    if (inside) {
+      Int64 oldLine = lineNr (oldPos);
+      const Int64* r = runs(oldLine);
+      uInt nr = nrRuns(oldLine);
+      for (uInt i=0; i<nr; ++i) {
+        Int64 st  = std::max (r[2*i] + offset[0], Int64(0));
+        Int64 end = std::min (r[2*i+1] + offset[0], Int64(shape[0]));
+        if (st < end) {
+          result.itsRuns.push_back (st);
+          result.itsRuns.push_back (end);
+        }
+      }
+    }
+    result.itsLineStart.push_back (result.itsRuns.size() / 2);
+    nextLinePos (pos, IPosition(ndim, 0), trc, inc);
+  }
+  return result;
+}
+
+Array<Bool> MaskRuns::toArray() const
+{
+  Array<Bool> arr(itsShape, False);
+  Int64 nrl = nrLines();
+  if (nrl > 0) {
+    Bool deleteIt;
+    Bool* data = arr.getStorage (deleteIt);
+    for (Int64 line=0; line<nrl; ++line) {
+      Bool* ptr = data + line*itsShape[0];
+      const Int64* r = runs(line);
+      for (uInt i=0; i<nrRuns(line); ++i) {
+        std::fill (ptr + r[2*i], ptr + r[2*i+1], True);
+      }
+    }
+    arr.putStorage (data, deleteIt);
+  }
+  return arr;
+}
+
+void MaskRuns::getSlice (Array<Bool>& buffer, const Slicer& section) const
+{
+  IPosition blc, trc, inc;
+  IPosition shp = section.inferShapeFromSource (itsShape, blc, trc, inc);
+  buffer.resize (shp);
+  buffer = False;
+  if (shp.product() == 0) {
+    return;
+  }
+  Bool deleteIt;
+  Bool* data = buffer.getStorage (deleteIt);
+  Bool* ptr = data;
+  IPosition pos(blc);
+  do {
+    Int64 line = lineNr (pos);
+    const Int64* r = runs(line);
+    for (uInt i=0; i<nrRuns(line); ++i) {
+      Int64 st  = std::max (r[2*i], Int64(blc[0]));
+      Int64 end = std::min (r[2*i+1], Int64(trc[0]) + 1);
+      if (st < end) {
+        if (inc[0] == 1) {
+          std::fill (ptr + st - blc[0], ptr + end - blc[0], True);
+        } else {
+          // Start at the first strided position in the run.
+          Int64 first = (st - blc[0] + inc[0] - 1) / inc[0];
+          for (Int64 j=first; blc[0] + j*inc[0] < end; ++j) {
+            ptr[j] = True;
+          }
+        }
+      }
+    }
+    ptr += shp[0];
+  } while (nextLinePos (pos, blc, trc, inc));
+  buffer.putStorage (data, deleteIt);
+}
+
+Bool MaskRuns::findBox (IPosition& blc, IPosition& trc,
+                        const Slicer& section) const
+{
+  IPosition sblc, strc, sinc;
+  IPosition shp = section.inferShapeFromSource (itsShape, sblc, strc, sinc);
+  uInt ndim = itsShape.nelements();
+  if (ndim == 0  ||  shp.product() == 0) {
+    return False;
+  }
+  blc.resize (ndim);
+  trc.resize (ndim);
+  Bool found = False;
+  IPosition pos(sblc);
+  IPosition unit(ndim, 1);
+  do {
+    Int64 line = lineNr (pos);
+    const Int64* r = runs(line);
+    uInt nr = nrRuns(line);
+    // Find the first and last run overlapping [sblc,strc] in this line.
+    Int64 st = -1;
+    Int64 end = -1;
+    for (uInt i=0; i<nr  &&  r[2*i] <= strc[0]; ++i) {
+      if (r[2*i+1] > sblc[0]) {
+        if (st < 0) {
+          st = std::max (r[2*i], Int64(sblc[0]));
+        }
+        end = std::min (r[2*i+1] - 1, Int64(strc[0]));
+      }
+    }
+    if (st >= 0) {
+      if (!found) {
+        blc = pos;
+        trc = pos;
+        blc[0] = st;
+        trc[0] = end;
+        found = True;
+      } else {
+        for (uInt i=1; i<ndim; ++i) {
+          blc[i] = std::min (blc[i], pos[i]);
+          trc[i] = std::max (trc[i], pos[i]);
+        }
+        blc[0] = std::min (Int64(blc[0]), st);
+        trc[0] = std::max (Int64(trc[0]), end);
+      }
+    }
+  } while (nextLinePos (pos, sblc, strc, unit));
+  return found;
+}
+
+Bool MaskRuns::operator== (const MaskRuns& other) const
+{
+  return itsShape.isEqual (other.itsShape)  &&
+         itsLineStart == other.itsLineStart  &&
+         itsRuns == other.itsRuns;
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,191 @@
+//# MaskRuns.h: Run-length encoded region mask
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef LATTICES_MASKRUNS_H
+#define LATTICES_MASKRUNS_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Slicer;
+template<class T> class Lattice;
+
+
+// <summary>
+// Run-length encoded region mask.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tMaskRuns">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=LCRegion>LCRegion</linkto>
+// </prerequisite>
+
+// <synopsis>
+// A MaskRuns object holds a Bool mask as the runs of True values along
+// the first axis. The mask is divided into lines (the vectors along the
+// first axis); for each line the runs are stored as sorted, disjoint
+// half-open intervals <src>[start,end)</src>. Lines are numbered in
+// storage order, so line <src>i</src> starts at element
+// <src>i*shape[0]</src> of the mask.
+// <p>
+// For the thin or irregular masks of typical regions (polygons, ellipsoids,
+// sparse pixel sets) this is much smaller than a Bool array of the bounding
+// box. The set operations work per line on the intervals, so their cost
+// is proportional to the number of runs instead of the number of pixels.
+// Furthermore, it is cheap to find out if (and where) a section of the
+// mask contains True values, which is used by
+// <linkto class=SubLattice>SubLattice</linkto> to avoid reading data
+// that are masked out by its region.
+// <p>
+// <linkto class=LCRegion>LCRegion</linkto>::maskRuns gives the runs of
+// a region.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   LCEllipsoid ellipse (IPosition(2,500,500), 100, 10, 0.5,
+//                        IPosition(2,1000,1000));
+//   const MaskRuns& runs = ellipse.maskRuns();
+//   for (Int64 line=0; line<runs.nrLines(); ++line) {
+//     const Int64* run = runs.runs(line);
+//     for (uInt i=0; i<runs.nrRuns(line); ++i) {
+//       // Pixels run[2*i] till run[2*i+1] in this line are in the region.
+//     }
+//   }
+// </srcblock>
+// </example>
+
+class MaskRuns
+{
+public:
+  // The set operations that can be done on two masks.
+  enum Operation {
+    // True if True in either mask.
+    Union,
+    // True if True in both masks.
+    Intersection,
+    // True if True in the first mask and False in the second.
+    Difference
+  };
+
+  // Create an empty mask with a 0-dim shape.
+  MaskRuns();
+
+  // Create a mask of the given shape with all elements set to the value.
+  explicit MaskRuns (const IPosition& shape, Bool value=False);
+
+  // Encode the given mask.
+  explicit MaskRuns (const Array<Bool>& mask);
+
+  // Encode the mask in the lattice. It is read in chunks of whole lines.
+  explicit MaskRuns (const Lattice<Bool>& mask);
+
+  // Get the shape of the mask.
+  const IPosition& shape() const
+    { return itsShape; }
+
+  // Get the number of lines (i.e. the product of the shape without the
+  // first axis).
+  Int64 nrLines() const
+    { return Int64(itsLineStart.size()) - 1; }
+
+  // Get the number of runs in a line.
+  uInt nrRuns (Int64 line) const
+    { return itsLineStart[line+1] - itsLineStart[line]; }
+
+  // Get the runs in a line as <src>nrRuns(line)</src> pairs of start and
+  // end (exclusive) position.
+  const Int64* runs (Int64 line) const
+    { return itsRuns.data() + 2*itsLineStart[line]; }
+
+  // Get the total number of runs.
+  Int64 nrRuns() const
+    { return itsRuns.size() / 2; }
+
+  // Get the number of True elements.
+  Int64 nrTrue() const;
+
+  // Are all elements False?
+  Bool empty() const
+    { return itsRuns.empty(); }
+
+  // Combine this mask with another mask of the same shape.
+  MaskRuns combine (const MaskRuns& other, Operation operation) const;
+
+  // Get the complement of the mask.
+  MaskRuns complement() const;
+
+  // Place the mask in a mask with another shape, where <src>offset</src>
+  // gives the position of the first element of this mask in the new mask.
+  // The offset can be negative. Parts outside the new shape are discarded,
+  // other parts of the new mask are False.
+  MaskRuns reposition (const IPosition& shape, const IPosition& offset) const;
+
+  // Decode the mask into a Bool array.
+  Array<Bool> toArray() const;
+
+  // Decode a section of the mask. The buffer is resized as needed.
+  void getSlice (Array<Bool>& buffer, const Slicer& section) const;
+
+  // Find the smallest box containing all True elements in the part
+  // [start,end] of the section (the stride is ignored).
+  // False is returned if that part has no True elements.
+  Bool findBox (IPosition& blc, IPosition& trc, const Slicer& section) const;
+
+  // Are the masks equal?
+  Bool operator== (const MaskRuns& other) const;
+
+private:
+  // Initialize for the given shape without any line.
+  // It returns the number of lines for that shape.
+  Int64 init (const IPosition& shape);
+
+  // Append the lines of a mask chunk consisting of whole lines.
+  void addLines (const Array<Bool>& mask);
+
+  // Get the line number of a position.
+  Int64 lineNr (const IPosition& pos) const;
+
+  IPosition           itsShape;
+  // Index of the first run of each line (and the total number of runs).
+  std::vector<Int64>  itsLineStart;
+  // Start and end of the runs.
+  std::vector<Int64>  itsRuns;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,215 @@
+//# tMaskOccupancy.cc: Test program for class MaskOccupancy
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/lattices/LRegions/MaskOccupancy.h>
+#include <casacore/lattices/LRegions/MaskRuns.h>
+#include <casacore/lattices/LRegions/LCEllipsoid.h>
+#include <casacore/lattices/LRegions/LCPagedMask.h>
+#include <casacore/lattices/LRegions/LCPixelSet.h>
+#include <casacore/lattices/LRegions/LCBox.h>
+#include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/lattices/Lattices/SubLattice.h>
+#include <casacore/lattices/Lattices/MaskedLatticeIterator.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Make a pseudo-random mask with some empty and some full blocks.
+Array<Bool> makeMask (const IPosition& shape, uInt seed)
+{
+  Array<Bool> mask(shape);
+  uInt val = seed;
+  Bool flag = False;
+  for (Array<Bool>::iterator iter=mask.begin(); iter!=mask.end(); ++iter) {
+    val = val*1103515245 + 12345;
+    if ((val>>16) % 5 == 0) {
+      flag = !flag;
+    }
+    *iter = flag;
+  }
+  mask(IPosition(3,0,0,0), IPosition(3,15,9,3)) = False;
+  mask(IPosition(3,16,10,2), IPosition(3,31,14,4)) = True;
+  return mask;
+}
+
+// Check the counts and the answers for sections against the mask.
+void checkOccupancy (const MaskOccupancy& occ, const Array<Bool>& mask)
+{
+  AlwaysAssertExit (occ.shape().isEqual (mask.shape()));
+  const IPosition& tile = occ.tileShape();
+  const IPosition& grid = occ.gridShape();
+  Int64 nempty = 0;
+  for (Int64 i=0; i<grid.product(); ++i) {
+    IPosition gridPos = toIPositionInArray (i, grid);
+    IPosition blc = gridPos * tile;
+    IPosition trc = min(blc + tile, mask.shape()) - 1;
+    Int64 nr = ntrue (mask(blc, trc));
+    AlwaysAssertExit (occ.nrTrue(gridPos) == nr);
+    if (nr == 0) ++nempty;
+    // The answers are exact for a tile.
+    Slicer sect(blc, trc, Slicer::endIsLast);
+    AlwaysAssertExit (occ.allFalse(sect) == (nr == 0));
+    AlwaysAssertExit (occ.allTrue(sect) == allTrue(mask(blc, trc)));
+  }
+  AlwaysAssertExit (occ.nrEmptyTiles() == nempty);
+  // For other sections a True answer must be right.
+  IPosition shape = mask.shape();
+  for (Int64 st0=0; st0<shape[0]; st0+=5) {
+    for (Int64 st1=0; st1<shape[1]; st1+=3) {
+      for (Int64 st2=0; st2<shape[2]; ++st2) {
+        IPosition blc(3, st0, st1, st2);
+        IPosition trc = min(blc + IPosition(3,9,4,2), shape - 1);
+        Slicer sect(blc, trc, Slicer::endIsLast);
+        if (occ.allFalse(sect)) {
+          AlwaysAssertExit (! anyTrue (mask(blc, trc)));
+        }
+        if (occ.allTrue(sect)) {
+          AlwaysAssertExit (allTrue (mask(blc, trc)));
+        }
+      }
+    }
+  }
+}
+
+void testBasic()
+{
+  IPosition shape(3, 37, 22, 5);
+  IPosition tileShape(3, 8, 5, 2);
+  Array<Bool> mask = makeMask (shape, 3);
+  MaskOccupancy occ1 (MaskRuns(mask), tileShape);
+  AlwaysAssertExit (occ1.gridShape() == IPosition(3,5,5,3));
+  checkOccupancy (occ1, mask);
+  MaskOccupancy occ2 (ArrayLattice<Bool>(mask), tileShape);
+  checkOccupancy (occ2, mask);
+  // The block set to False makes an empty tile, the one set to True
+  // makes full tiles.
+  AlwaysAssertExit (occ1.allFalse (Slicer(IPosition(3,0,0,2),
+                                          IPosition(3,8,5,1))));
+  AlwaysAssertExit (occ1.allTrue (Slicer(IPosition(3,16,10,2),
+                                         IPosition(3,16,5,3))));
+  // The tile shape is limited to the shape.
+  MaskOccupancy occ3 (MaskRuns(mask), IPosition(3,100,3,100));
+  AlwaysAssertExit (occ3.tileShape() == IPosition(3,37,3,5));
+  checkOccupancy (occ3, mask);
+  checkOccupancy (MaskOccupancy(MaskRuns(shape, False), tileShape),
+                  Array<Bool>(shape, False));
+  checkOccupancy (MaskOccupancy(MaskRuns(shape, True), tileShape),
+                  Array<Bool>(shape, True));
+}
+
+void testRegions()
+{
+  IPosition latShape(3, 200, 150, 10);
+  LCEllipsoid ell (IPosition(3,100,75,5), 30, latShape);
+  std::shared_ptr<const MaskOccupancy> occ = ell.occupancy();
+  checkOccupancy (*occ, ell.get());
+  // A copy shares the summary.
+  LCRegion* copy = ell.cloneRegion();
+  AlwaysAssertExit (copy->occupancy() == occ);
+  delete copy;
+  // A paged mask uses its tile shape and is summarized again after
+  // a change.
+  {
+    LCPagedMask pmask (TiledShape(IPosition(2,64,48), IPosition(2,16,16)),
+                       "tMaskOccupancy_tmp.mask");
+    pmask.set (False);
+    LCPagedMask pcopy (pmask);
+    AlwaysAssertExit (pmask.occupancy()->tileShape() == IPosition(2,16,16));
+    AlwaysAssertExit (pmask.occupancy()->nrEmptyTiles() == 12);
+    pmask.putAt (True, IPosition(2,20,40));
+    AlwaysAssertExit (pmask.occupancy()->nrEmptyTiles() == 11);
+    AlwaysAssertExit (pcopy.occupancy()->nrEmptyTiles() == 11);
+    AlwaysAssertExit (! pcopy.occupancy()->allFalse
+                      (Slicer(IPosition(2,16,32), IPosition(2,16,16))));
+    pmask.handleDelete();
+  }
+}
+
+void testIterator()
+{
+  // A sparse region on a lattice.
+  IPosition latShape(3, 400, 300, 6);
+  Array<Float> data(latShape);
+  indgen (data);
+  ArrayLattice<Float> lattice(data);
+  Array<Bool> mask(latShape, False);
+  mask(IPosition(3,40,30,2), IPosition(3,49,39,3)) = True;
+  mask(IPosition(3,350,200,5)) = True;
+  LCPixelSet pixels (mask, LCBox(latShape));
+  SubLattice<Float> sub(lattice, pixels);
+  // Iterate with a small cursor; the skipped cursors must be fully masked
+  // and the sum of the unmasked values must be right.
+  RO_MaskedLatticeIterator<Float> iter(sub, IPosition(3,20,20,1));
+  RO_MaskedLatticeIterator<Float> iterAll(sub, IPosition(3,20,20,1));
+  Double total = 0;
+  Int nstep = 0;
+  for (iter.skipMaskedOut(); !iter.atEnd(); iter++, iter.skipMaskedOut()) {
+    for (; iterAll.position() != iter.position(); iterAll++) {
+      AlwaysAssertExit (iterAll.isMaskedOut());
+      AlwaysAssertExit (! anyTrue (iterAll.getMask()));
+    }
+    iterAll++;
+    Array<Bool> msk;
+    iter.getMask (msk);
+    total += sum (iter.cursor()(msk).getCompressedArray());
+    nstep++;
+  }
+  AlwaysAssertExit (nstep < 20*15*6 / 20);
+  AlwaysAssertExit (near (total, Double(sum(data(mask).getCompressedArray())),
+                          1e-5));
+  // A plane of the sublattice with the axis removed, thus with a masked
+  // parent.
+  SubLattice<Float> plane (sub, LCBox(IPosition(3,0,0,5),
+                                      IPosition(3,399,299,5), latShape),
+                           False, AxesSpecifier(False));
+  AlwaysAssertExit (plane.ndim() == 2);
+  AlwaysAssertExit (plane.isMaskedOut (Slicer(IPosition(2,0,0),
+                                              IPosition(2,20,20))));
+  AlwaysAssertExit (! plane.isMaskedOut (Slicer(IPosition(2,340,190),
+                                                IPosition(2,20,20))));
+  // A lattice without a mask is never masked out.
+  SubLattice<Float> all (lattice);
+  AlwaysAssertExit (! all.isMaskedOut (Slicer(IPosition(3,0),
+                                              IPosition(3,1))));
+}
+
+int main()
+{
+  try {
+    testBasic();
+    testRegions();
+    testIterator();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
@@ -0,0 +1,214 @@
+//# tMaskRuns.cc: Test program for class MaskRuns
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/lattices/LRegions/MaskRuns.h>
+#include <casacore/lattices/LRegions/LCBox.h>
+#include <casacore/lattices/LRegions/LCEllipsoid.h>
+#include <casacore/lattices/LRegions/LCUnion.h>
+#include <casacore/lattices/LRegions/LCIntersection.h>
+#include <casacore/lattices/LRegions/LCDifference.h>
+#include <casacore/lattices/LRegions/LCComplement.h>
+#include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/lattices/Lattices/SubLattice.h>
+#include <casacore/lattices/Lattices/LatticeIterator.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Make a pseudo-random mask with runs of various lengths.
+Array<Bool> makeMask (const IPosition& shape, uInt seed)
+{
+  Array<Bool> mask(shape);
+  uInt val = seed;
+  Bool flag = False;
+  for (Array<Bool>::iterator iter=mask.begin(); iter!=mask.end(); ++iter) {
+    val = val*1103515245 + 12345;
+    if ((val>>16) % 5 == 0) {
+      flag = !flag;
+    }
+    *iter = flag;
+  }
+  return mask;
+}
+
+void checkRuns (const MaskRuns& runs, const Array<Bool>& mask)
+{
+  AlwaysAssertExit (runs.shape().isEqual (mask.shape()));
+  AlwaysAssertExit (allEQ (runs.toArray(), mask));
+  AlwaysAssertExit (runs.nrTrue() == Int64(ntrue(mask)));
+  AlwaysAssertExit (runs.empty() == !anyTrue(mask));
+}
+
+void testBasic()
+{
+  IPosition shape(3, 17, 6, 4);
+  Array<Bool> m1 = makeMask (shape, 1);
+  Array<Bool> m2 = makeMask (shape, 7);
+  MaskRuns r1(m1);
+  MaskRuns r2(m2);
+  checkRuns (r1, m1);
+  checkRuns (r2, m2);
+  AlwaysAssertExit (r1.nrLines() == 24);
+  AlwaysAssertExit (r1 == MaskRuns(m1));
+  AlwaysAssertExit (! (r1 == r2));
+  checkRuns (MaskRuns(shape, True), Array<Bool>(shape, True));
+  checkRuns (MaskRuns(shape, False), Array<Bool>(shape, False));
+  // Set operations.
+  checkRuns (r1.combine (r2, MaskRuns::Union), m1 || m2);
+  checkRuns (r1.combine (r2, MaskRuns::Intersection), m1 && m2);
+  checkRuns (r1.combine (r2, MaskRuns::Difference), m1 && !m2);
+  checkRuns (r1.complement(), !m1);
+  // Encoding a lattice in several chunks.
+  IPosition bigShape(3, 1100, 1000, 2);
+  Array<Bool> big = makeMask (bigShape, 3);
+  checkRuns (MaskRuns(ArrayLattice<Bool>(big)), big);
+  // Get sections.
+  Array<Bool> buf;
+  Slicer sect1(IPosition(3,2,1,0), IPosition(3,10,4,3));
+  r1.getSlice (buf, sect1);
+  AlwaysAssertExit (allEQ (buf, m1(sect1)));
+  Slicer sect2(IPosition(3,1,0,1), IPosition(3,6,3,2), IPosition(3,3,2,2));
+  r1.getSlice (buf, sect2);
+  AlwaysAssertExit (allEQ (buf, m1(sect2)));
+  // Find the box of the True values.
+  IPosition blc, trc;
+  MaskRuns box(IPosition(3,10,8,6), False);
+  box = box.combine (MaskRuns(IPosition(3,2,3,1), True).reposition
+                     (IPosition(3,10,8,6), IPosition(3,4,2,3)),
+                     MaskRuns::Union);
+  AlwaysAssertExit (box.nrTrue() == 6);
+  AlwaysAssertExit (box.findBox (blc, trc, Slicer(IPosition(3,0),
+                                                  IPosition(3,10,8,6))));
+  AlwaysAssertExit (blc == IPosition(3,4,2,3));
+  AlwaysAssertExit (trc == IPosition(3,5,4,3));
+  AlwaysAssertExit (box.findBox (blc, trc, Slicer(IPosition(3,5,3,0),
+                                                  IPosition(3,5,5,6))));
+  AlwaysAssertExit (blc == IPosition(3,5,3,3));
+  AlwaysAssertExit (trc == IPosition(3,5,4,3));
+  AlwaysAssertExit (! box.findBox (blc, trc, Slicer(IPosition(3,0),
+                                                    IPosition(3,4,8,6))));
+  // Reposition with a negative offset.
+  MaskRuns moved = r1.reposition (IPosition(3,20,5,4), IPosition(3,-2,1,0));
+  Array<Bool> expMoved(IPosition(3,20,5,4), False);
+  expMoved(IPosition(3,0,1,0), IPosition(3,14,4,3)) =
+    m1(IPosition(3,2,0,0), IPosition(3,16,3,3));
+  checkRuns (moved, expMoved);
+}
+
+void testRegions()
+{
+  IPosition latShape(2, 40, 30);
+  LCEllipsoid ell1 (IPosition(2,12,12), 9, latShape);
+  LCEllipsoid ell2 (IPosition(2,20,15), 8, latShape);
+  LCBox box (IPosition(2,5,10), IPosition(2,30,20), latShape);
+  LCUnion uni (ell1, ell2);
+  LCIntersection inters (ell1, ell2);
+  LCDifference diff (ell1, ell2);
+  LCComplement comp (ell1);
+  LCIntersection inters2 (box, uni);
+  const LCRegion* regions[] = {&ell1, &box, &uni, &inters, &diff, &comp,
+                               &inters2};
+  for (const LCRegion* reg : regions) {
+    checkRuns (reg->maskRuns(), reg->get());
+    // A copy shares the runs.
+    LCRegion* copy = reg->cloneRegion();
+    AlwaysAssertExit (&(copy->maskRuns()) == &(reg->maskRuns()));
+    delete copy;
+  }
+}
+
+void testSubLattice()
+{
+  IPosition latShape(3, 60, 50, 8);
+  Array<Float> data(latShape);
+  indgen (data);
+  ArrayLattice<Float> lattice(data);
+  LCEllipsoid ell (IPosition(3,30,25,4), 6, latShape);
+  SubLattice<Float> sub1(lattice, ell);
+  SubLattice<Float> sub2(lattice, ell);
+  sub2.setSkipMasked (True);
+  AlwaysAssertExit (sub2.skipMasked());
+  Array<Bool> mask = ell.get();
+  // Iterate with a small cursor to get sections without any True value,
+  // sections partly filled and full ones.
+  RO_LatticeIterator<Float> iter1(sub1, IPosition(3,4,3,1));
+  RO_LatticeIterator<Float> iter2(sub2, IPosition(3,4,3,1));
+  for (; !iter1.atEnd(); iter1++, iter2++) {
+    // The cursor can extend beyond the edge, so only compare the valid part.
+    IPosition len = iter1.endPosition() - iter1.position() + 1;
+    Slicer sect(iter1.position(), len);
+    Slicer part(IPosition(3,0), len);
+    Array<Bool> msk = mask(sect);
+    // Data outside the box enclosing the True mask values are zero.
+    Array<Float> exp = iter1.cursor()(part).copy();
+    Array<Float> res = iter2.cursor()(part).copy();
+    if (! anyTrue(msk)) {
+      AlwaysAssertExit (allEQ (res, Float(0)));
+    }
+    exp(!msk) = 0;
+    res(!msk) = 0;
+    AlwaysAssertExit (allEQ (res, exp));
+  }
+  // Get the entire sublattice.
+  Array<Float> exp = sub1.get();
+  Array<Float> res = sub2.get();
+  exp(!mask) = 0;
+  res(!mask) = 0;
+  AlwaysAssertExit (allEQ (res, exp));
+  // Also with a removed axis.
+  LCEllipsoid ell2 (IPosition(3,30,25,0), 6, IPosition(3,60,50,1));
+  ArrayLattice<Float> lattice2(data(IPosition(3,0), IPosition(3,59,49,0)));
+  SubLattice<Float> sub3(lattice2, ell2, False,
+                         AxesSpecifier(False));
+  AlwaysAssertExit (sub3.ndim() == 2);
+  Array<Float> full = sub3.get();
+  sub3.setSkipMasked (True);
+  Array<Float> part = sub3.getSlice (IPosition(2,0), IPosition(2,6,13));
+  Array<Bool> msk2 = ell2.get().nonDegenerate()(IPosition(2,0),
+                                                IPosition(2,5,12));
+  Array<Float> exp2 = full(IPosition(2,0), IPosition(2,5,12)).copy();
+  exp2(!msk2) = 0;
+  part(!msk2) = 0;
+  AlwaysAssertExit (allEQ (part, exp2));
+}
+
+int main()
+{
+  try {
+    testBasic();
+    testRegions();
+    testSubLattice();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
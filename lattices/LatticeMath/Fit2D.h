@@ -33,6 +33,7 @@
 #include <casacore/casa/BasicSL/Constants.h>
 #include <casacore/scimath/Fitting/NonLinearFitLM.h>
 #include <casacore/casa/Logging/LogIO.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -207,6 +208,23 @@ public:
                           const Array<T>& sigma);
     //</group>
 
+    // Fit the models to each plane of a 3-D array, where the planes are
+    // along the last axis (e.g. the channels of a cube). The mask and
+    // sigma arrays can be empty or have the shape of the data.
+    // The first plane is fitted with the initial guesses given to
+    // addModel. If successful, its solution is used as initial guess
+    // for the other planes, which are fitted in parallel (each with its
+    // own copy of the models and fitter).
+    // The available solution and errors of plane i are returned in
+    // column i of <src>solutions</src> and <src>errors</src> (zero if the
+    // fit failed) and its chi squared in <src>chiSquared[i]</src>.
+    // The status of each plane is returned.
+    // Afterwards this object holds the result of the first plane.
+    template <class T> std::vector<Fit2D::ErrorTypes> fitPlanes(
+        Matrix<Double>& solutions, Matrix<Double>& errors,
+        Vector<Double>& chiSquared, const Array<T>& data,
+        const Array<Bool>& mask, const Array<T>& sigma);
+
     // Find the residuals to the fit. xOffset and yOffset allow one to provide a data
     // array that is offset in space from the grid that was fit. In this way, one
     // can fill out a larger image than the subimage that was fit, for example. A negative
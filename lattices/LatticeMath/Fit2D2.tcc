@@ -31,6 +31,7 @@
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/MaskArrMath.h>
+#include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/lattices/Lattices/MaskedLattice.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -310,6 +311,79 @@ template <class T> Fit2D::ErrorTypes Fit2D::fit(const Array<T>& data,
 
 }
 
+template <class T> std::vector<Fit2D::ErrorTypes> Fit2D::fitPlanes(
+    Matrix<Double>& solutions, Matrix<Double>& errors,
+    Vector<Double>& chiSquared, const Array<T>& data,
+    const Array<Bool>& mask, const Array<T>& sigma
+) {
+   ThrowIf(
+      ! itsValid,
+      "No models have been set - use function addModel"
+   );
+   ThrowIf(data.ndim() != 3, "Array must be 3-dimensional");
+   ThrowIf(
+      mask.nelements() != 0 && ! data.shape().isEqual(mask.shape()),
+      "Mask and pixel arrays must have the same shape"
+   );
+   ThrowIf(
+      sigma.nelements() != 0 && ! data.shape().isEqual(sigma.shape()),
+      "Sigma and pixel arrays must have the same shape"
+   );
+   const IPosition& shape = data.shape();
+   const Int nPlanes = shape[2];
+   const uInt nPar = itsFunction.nparameters();
+   solutions.resize(nPar, nPlanes);
+   errors.resize(nPar, nPlanes);
+   chiSquared.resize(nPlanes);
+   solutions = 0;
+   errors = 0;
+   chiSquared = 0;
+   std::vector<Fit2D::ErrorTypes> status(nPlanes, Fit2D::FAILED);
+// Make the planes beforehand, so the parallel loop only reads them.
+   std::vector<Array<T>> dataPlanes(nPlanes);
+   std::vector<Array<Bool>> maskPlanes(nPlanes);
+   std::vector<Array<T>> sigmaPlanes(nPlanes);
+   for (Int p=0; p<nPlanes; ++p) {
+      IPosition blc(3, 0, 0, p);
+      IPosition trc(3, shape[0]-1, shape[1]-1, p);
+      dataPlanes[p].reference (data(blc, trc).nonDegenerate(2));
+      if (mask.nelements() != 0) {
+         maskPlanes[p].reference (mask(blc, trc).nonDegenerate(2));
+      }
+      if (sigma.nelements() != 0) {
+         sigmaPlanes[p].reference (sigma(blc, trc).nonDegenerate(2));
+      }
+   }
+   if (nPlanes == 0) {
+      return status;
+   }
+// Fit the first plane and use its solution as start for the others.
+   status[0] = fit(dataPlanes[0], maskPlanes[0], sigmaPlanes[0]);
+   Vector<Double> start;
+   if (itsValidSolution) {
+      solutions.column(0) = availableSolution();
+      errors.column(0) = availableErrors();
+      chiSquared[0] = itsChiSquared;
+      start = itsSolution;
+   }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+   for (Int p=1; p<nPlanes; ++p) {
+      Fit2D fitter(*this);
+      for (uInt i=0; i<start.nelements(); ++i) {
+         fitter.itsFunction[i].value() = start[i];
+      }
+      status[p] = fitter.fit(dataPlanes[p], maskPlanes[p], sigmaPlanes[p]);
+      if (fitter.itsValidSolution) {
+         solutions.column(p) = fitter.availableSolution();
+         errors.column(p) = fitter.availableErrors();
+         chiSquared[p] = fitter.itsChiSquared;
+      }
+   }
+   return status;
+}
+
 template <class T> Fit2D::ErrorTypes Fit2D::residual(
         Array<T>& resid, Array<T>& model,
         const Array<T>& data, Int xOffset, int yOffset
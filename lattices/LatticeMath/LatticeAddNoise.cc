@@ -40,7 +40,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 LatticeAddNoise::LatticeAddNoise()
 : itsParameters(0),
-  itsNoise(0)
+  itsNoise(0),
+  itsPhilox(1),
+  itsNext(0)
 {}
    
 LatticeAddNoise::LatticeAddNoise(
@@ -50,14 +52,17 @@ LatticeAddNoise::LatticeAddNoise(
 : itsType(type),
   itsParameters(parameters.copy()),
   itsGen(seed1, seed2),
-  itsNoise(NULL) {
+  itsNoise(NULL),
+  itsPhilox((uInt64(uInt(seed1)) << 32) | uInt(seed2)),
+  itsNext(0) {
    makeDistribution();
 }
   
 LatticeAddNoise::LatticeAddNoise (const LatticeAddNoise& other)
 : itsType(other.itsType),
   itsParameters(other.itsParameters.copy()),
-  itsGen(other.itsGen), itsNoise(NULL) {
+  itsGen(other.itsGen), itsNoise(NULL),
+  itsPhilox(other.itsPhilox), itsNext(other.itsNext) {
    makeDistribution();
 }
  
@@ -68,6 +73,8 @@ LatticeAddNoise& LatticeAddNoise::operator=(const LatticeAddNoise& other)
       itsParameters.resize(0);
       itsParameters = other.itsParameters;
       itsGen = other.itsGen;
+      itsPhilox = other.itsPhilox;
+      itsNext = other.itsNext;
       makeDistribution();
    }
    return *this;
@@ -140,6 +147,16 @@ void LatticeAddNoise::addNoiseToArray (Array<DComplex>& data)
    data.putStorage(p, deleteIt);
 }
 
+void LatticeAddNoise::counterNoise (Double* out, size_t n,
+                                    uInt64 first) const
+{
+   if (itsType == Random::NORMAL) {
+      itsPhilox.normal (out, n, first, itsParameters(0), itsParameters(1));
+   } else {
+      itsPhilox.uniform (out, n, first, itsParameters(0), itsParameters(1));
+   }
+}
+
 void LatticeAddNoise::makeDistribution ()
 {
    if (itsNoise) {
@@ -30,6 +30,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicMath/Philox.h>
 #include <casacore/casa/BasicMath/Random.h>
 #include <casacore/casa/BasicSL/Complex.h>
 
@@ -59,6 +60,16 @@ template <class T> class Lattice;
 // This class allows you to add noise from one of many enumerated
 // types to a Lattice.  If the Lattice is Complex, then the noise
 // is added to real and imaginary separately.
+//
+// Normal and uniform noise are generated with the counter-based
+// <linkto class="Philox">Philox</linkto> generator. The noise value
+// of a pixel is determined by the seeds and the pixel's position, so
+// it is computed in parallel (using the global
+// <linkto class="ThreadPool">ThreadPool</linkto>) and the result
+// does not depend on the number of threads or on the order in which
+// the lattice is traversed. Each call of <src>add</src> continues the
+// noise stream, so adding twice gives independent noise.
+// Other distributions are generated serially with an MLCG generator.
 // </synopsis>
 
 // <example>
@@ -84,7 +95,7 @@ public:
 
 // Constructor. An exception will occur if we cannot generate 
 // the distribution (e.g. illegal parameters).  seed1 and seed2
-   // are used to seed the MLCG object.
+   // are used to seed the MLCG and Philox objects.
    LatticeAddNoise (
 		 Random::Types type,
          const Vector<Double>& parameters,
@@ -119,6 +130,8 @@ private:
    Vector<Double> itsParameters;
    MLCG itsGen;
    Random* itsNoise;
+   Philox itsPhilox;
+   uInt64 itsNext;      //# first value of the Philox stream for next add
 
 // Add noise to array.  For Complex, noise is added to
 // real and imaginary separately.
@@ -129,6 +142,22 @@ private:
    void addNoiseToArray (Array<DComplex>& data);
 // </group>
 
+// Add Philox noise to the cursor at the given lattice position.
+// Each pixel gets the noise values with its linear lattice index
+// (one value per real, two per complex pixel).
+   template <class T> void addCounterNoise (Array<T>& data,
+                                            const IPosition& start,
+                                            const IPosition& cursorShape,
+                                            const IPosition& latticeShape) const;
+
+// Fill with values <src>first ... first+n-1</src> of the Philox stream.
+   void counterNoise (Double* out, size_t n, uInt64 first) const;
+
+// Can the distribution be generated with Philox?
+   Bool useCounter() const
+      { return itsNoise  &&  (itsType == Random::NORMAL ||
+                              itsType == Random::UNIFORM); }
+
 // Make noise generator
    void makeDistribution ();
 };
@@ -36,14 +36,29 @@
 #include <casacore/casa/BasicSL/Complex.h> 
 #include <casacore/casa/BasicMath/Random.h> 
 #include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/scimath/Mathematics/NumericTraits.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
  
 template <class T> void LatticeAddNoise::add (MaskedLattice<T>& lattice) {
     ThrowIf(! itsNoise, "You have not yet called function 'set'");
     LatticeIterator<T> it(lattice);
-    for (it.reset(); !it.atEnd(); it++) {
-        addNoiseToArray(it.rwCursor());
+    if (useCounter()) {
+        typedef typename NumericTraits<T>::BaseType BaseType;
+        const IPosition latShape = lattice.shape();
+        for (it.reset(); !it.atEnd(); it++) {
+            addCounterNoise (it.rwCursor(), it.position(), it.cursorShape(),
+                             latShape);
+        }
+        itsNext += uInt64(latShape.product()) * (sizeof(T) / sizeof(BaseType));
+    } else {
+        for (it.reset(); !it.atEnd(); it++) {
+            addNoiseToArray(it.rwCursor());
+        }
     }
 }
 
@@ -52,5 +67,67 @@ template <class T> void LatticeAddNoise::add (Lattice<T>& lattice) {
     add(ml);
 }
 
+template <class T>
+void LatticeAddNoise::addCounterNoise (Array<T>& data,
+                                       const IPosition& start,
+                                       const IPosition& cursorShape,
+                                       const IPosition& latticeShape) const
+{
+    // Complex values get two noise values (real and imaginary).
+    typedef typename NumericTraits<T>::BaseType BaseType;
+    const size_t nper = sizeof(T) / sizeof(BaseType);
+    const uInt ndim = latticeShape.size();
+    // The cursor can hang over the lattice edges; only the pixels
+    // inside the lattice get noise.
+    const size_t rowLen = cursorShape[0];
+    const size_t len = std::min (cursorShape[0], latticeShape[0] - start[0]);
+    const size_t nrow = cursorShape.product() / rowLen;
+    IPosition latStride(ndim);
+    ssize_t stride = 1;
+    for (uInt i=0; i<ndim; ++i) {
+        latStride[i] = stride;
+        stride *= latticeShape[i];
+    }
+    Bool deleteIt;
+    T* ptr = data.getStorage (deleteIt);
+    BaseType* basePtr = reinterpret_cast<BaseType*>(ptr);
+    auto doRows = [&] (size_t stRow, size_t endRow) {
+        std::vector<Double> noise(len * nper);
+        for (size_t r=stRow; r<endRow; ++r) {
+            size_t rem = r;
+            uInt64 offset = start[0];
+            Bool inside = True;
+            for (uInt i=1; i<ndim; ++i) {
+                const ssize_t pos = start[i] + ssize_t(rem % cursorShape[i]);
+                rem /= cursorShape[i];
+                if (pos >= latticeShape[i]) {
+                    inside = False;
+                    break;
+                }
+                offset += pos * latStride[i];
+            }
+            if (inside) {
+                counterNoise (noise.data(), noise.size(),
+                              itsNext + offset * nper);
+                BaseType* rowPtr = basePtr + r * rowLen * nper;
+                for (size_t j=0; j<noise.size(); ++j) {
+                    rowPtr[j] += noise[j];
+                }
+            }
+        }
+    };
+    // Only use multiple threads if there is enough work.
+    const size_t nthread = std::min (size_t(ThreadPool::concurrency()), nrow);
+    if (nthread > 1  &&  nrow * len * nper >= 65536) {
+        const size_t nchunk = std::min (nrow, 4 * nthread);
+        ThreadPool::global().parallelFor (nchunk, [&] (size_t chunk) {
+            doRows (chunk * nrow / nchunk, (chunk + 1) * nrow / nchunk);
+        }, nthread);
+    } else {
+        doRows (0, nrow);
+    }
+    data.putStorage (ptr, deleteIt);
+}
+
 } //# NAMESPACE CASACORE - END
 
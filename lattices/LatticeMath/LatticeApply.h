@@ -29,7 +29,10 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Arrays/Array.h>
 #include <casacore/scimath/Mathematics/NumericTraits.h>
+#include <memory>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -188,6 +191,11 @@ public:
 // be supplied with the correct shape (the shape of the supplied region
 // plus the number of values resulting from the collapse).
 // The default region is the entire input lattice.
+// <br>If the collapser can be cloned (see
+// <linkto class=TiledCollapser>TiledCollapser::clone</linkto>) and if
+// OpenMP can use multiple threads, the tiles are collapsed in parallel
+// by clones of the collapser, which are merged into the collapser before
+// the result of a chunk is written. The tiles are read sequentially.
 // <group>
     static void tiledApply (MaskedLattice<U>& latticeOut,
 			    const MaskedLattice<T>& latticeIn,
@@ -245,6 +253,24 @@ private:
 			      const IPosition& collapseAxes,
 			      Int newOutAxis);
 
+    // Collapse the data of a single tile (cursor) at lattice position pos.
+    static void collapseTile (TiledCollapser<T,U>& collapser,
+                              const Array<T>& cursor,
+                              const Array<Bool>& mask, Bool useMask,
+                              const IPosition& pos,
+                              const IPosition& collapseAxes, uInt collStart,
+                              const IPosition& iterAxes,
+                              const IPosition& ioMap, uInt resultAxis);
+
+    // Collapse the collected tiles in parallel, tile i with clone i.
+    // The vectors of tiles are cleared thereafter.
+    static void collapseParallel
+    (std::vector<std::unique_ptr<TiledCollapser<T,U>>>& clones,
+     std::vector<Array<T>>& cursors, std::vector<Array<Bool>>& masks,
+     std::vector<IPosition>& positions, Bool useMask,
+     const IPosition& collapseAxes, uInt collStart,
+     const IPosition& iterAxes, const IPosition& ioMap, uInt resultAxis);
+
     static IPosition _chunkShape(
         uInt axis, const MaskedLattice<T>& latticeIn
     );
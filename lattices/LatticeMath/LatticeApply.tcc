@@ -42,9 +42,11 @@
 #include <casacore/casa/Arrays/ArrayPosIter.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <exception>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -465,6 +467,31 @@ void LatticeApply<T,U>::tiledApply (
 	    }
     }
 
+    // If the collapser can be cloned, the tiles are collapsed in parallel.
+    // Each thread uses its own clone; the clones are merged into the
+    // collapser when all tiles of an output chunk are processed.
+    // The tiles are read sequentially, because reading a lattice is not
+    // thread-safe.
+    std::vector<std::unique_ptr<TiledCollapser<T,U>>> clones;
+    const uInt nthreads = OMP::nMaxThreads();
+    if (nthreads > 1  &&  nsteps > 1) {
+        for (uInt t=0; t<nthreads; ++t) {
+            TiledCollapser<T,U>* clone = collapser.clone();
+            if (clone == 0) {
+                clones.clear();
+                break;
+            }
+            clones.push_back (std::unique_ptr<TiledCollapser<T,U>>(clone));
+            clone->init (outShape.product());
+        }
+    }
+    std::vector<Array<T>> cursors;
+    std::vector<Array<Bool>> masks;
+    std::vector<IPosition> positions;
+    cursors.reserve (clones.size());
+    masks.reserve (clones.size());
+    positions.reserve (clones.size());
+
     // Iterate through all the tiles.
     // TileStepper is set up in such a way that the collapse axes are iterated
     // fastest. When all collapse axes are handled, thus when the iter axes
@@ -483,14 +510,16 @@ void LatticeApply<T,U>::tiledApply (
 	    // In order to use the pointers-to-array-data below, the array *must*
 	    // be contiguous or the results will in general be incorrect.
 	    // Ditto for the mask
-	    const Array<T>& cursor = iterCursor.contiguousStorage()
+	    // When collapsing in parallel a copy is needed anyway, because the
+	    // iterator reuses its cursor buffer.
+	    const Array<T>& cursor = iterCursor.contiguousStorage()  &&
+	                             clones.empty()
 	    	? iterCursor : iterCursor.copy();
 	    ThrowIf(
 	    	! cursor.contiguousStorage(), "cursor array is not contiguous"
 	    );
 	    const IPosition& cursorShape = cursor.shape();
 	    IPosition pos = inIter.position();
-	    IPosition latPos = pos;
 	    Array<Bool> mask;
 	    if (useMask) {
 	        // Casting const away is innocent.
@@ -510,6 +539,12 @@ void LatticeApply<T,U>::tiledApply (
 	    }
 	    if (firstTime  ||  outPos != iterPos) {
 	        if (!firstTime) {
+	            collapseParallel (clones, cursors, masks, positions, useMask,
+	                              collapseAxes, collStart, iterAxes, ioMap,
+	                              resultAxis);
+	            for (const auto& clone : clones) {
+	                collapser.merge (*clone);
+	            }
 		        Array<U> result;
 		        Array<Bool> resultMask;
 		        collapser.endAccumulator (result, resultMask, outShape);
@@ -534,86 +569,23 @@ void LatticeApply<T,U>::tiledApply (
 		        }
 	        }
 	        collapser.initAccumulator (n1, n3);
-	    }
-
-        // Put the collapsed lines into an output buffer
-        // Initialize the cursor position needed in the loop.
-
-	    IPosition curPos (inDim, 0);
-
-        // Determine the increment for the first collapse axes.
-        // This is done by taking the difference between the adresses of two pixels
-        // in the cursor (if there are 2 pixels).
-
-	    IPosition chunkShape (inDim, 1);
-	    for (j=0; j<collStart; ++j) {
-	        const uInt axis = collapseAxes(j);
-	        chunkShape(axis) = cursorShape(axis);
-	    }
-	    uInt nval = chunkShape.product();
-	    const uInt axis = collapseAxes(0);
-
-    	IPosition p0(inDim, 0);
-	    IPosition p1(inDim, 0);
-	    p1[axis] = 1;
-	    // general for Arrays with contiguous or non-contiguous storage.
-	    uInt dataIncr = &(cursor(p1)) - &(cursor(p0));
-	    uInt maskIncr = useMask ? &(mask(p1)) - &(mask(p0)) : 0;
-
-        // Iterate in the outer loop through the iterator axes.
-        // Iterate in the inner loop through the collapse axes.
-
-	    uInt index1 = 0;
-	    uInt index3 = 0;
-	    for (;;) {
-	        for (;;) {
-		        if (useMask) {
-		            collapser.process (
-                        index1, index3, &(cursor(curPos)), &(mask(curPos)),
-				        dataIncr, maskIncr, nval, latPos, chunkShape
-                    );
-		        }
-                else {
-		            collapser.process(
-                        index1, index3,
-				        &(cursor(curPos)), 0,
-				        dataIncr, maskIncr, nval, latPos, chunkShape
-                    );
-		        }
-		        // Increment a collapse axis until all axes are handled.
-		        for (j=collStart; j<collDim; ++j) {
-		            uInt axis = collapseAxes(j);
-		            if (++curPos(axis) < cursorShape(axis)) {
-			            break;
-		            }
-		            curPos(axis) = 0;               // restart this axis
-		        }
-		        if (j == collDim) {
-		            break;                          // all axes are handled
-		        }
+	        for (const auto& clone : clones) {
+	            clone->initAccumulator (n1, n3);
 	        }
-	
-            // Increment an iteration axis until all iteration axes are handled.
-	
-	        for (j=0; j<iterDim; ++j) {
-		        uInt arraxis = iterAxes(j);
-		        uInt axis = ioMap(arraxis);
-		        ++latPos(axis);
-		        if (++curPos(axis) < cursorShape(axis)) {
-		            if (arraxis < resultAxis) {
-		                ++index1;
-		            }
-                    else {
-		                ++index3;
-			            index1 = 0;
-		            }
-		            break;
-		        }
-		        curPos(axis) = 0;
-		        latPos(axis) = pos(axis);
-	        }
-	        if (j == iterDim) {
-		        break;
+	    }
+	    if (clones.empty()) {
+	        collapseTile (collapser, cursor, mask, useMask, pos,
+	                      collapseAxes, collStart, iterAxes, ioMap,
+	                      resultAxis);
+	    } else {
+	        // Collect the tiles until there is one for each thread.
+	        cursors.push_back (cursor);
+	        masks.push_back (mask);
+	        positions.push_back (pos);
+	        if (cursors.size() == clones.size()) {
+	            collapseParallel (clones, cursors, masks, positions, useMask,
+	                              collapseAxes, collStart, iterAxes, ioMap,
+	                              resultAxis);
 	        }
 	    }
 	    ++inIter;
@@ -623,6 +595,11 @@ void LatticeApply<T,U>::tiledApply (
     }
 
     // Write out the last output array.
+    collapseParallel (clones, cursors, masks, positions, useMask,
+                      collapseAxes, collStart, iterAxes, ioMap, resultAxis);
+    for (const auto& clone : clones) {
+        collapser.merge (*clone);
+    }
     Array<U> result;
     Array<Bool> resultMask;
     collapser.endAccumulator (result, resultMask, outShape);
@@ -633,6 +610,135 @@ void LatticeApply<T,U>::tiledApply (
     if (tellProgress != 0) tellProgress->done();
 }
 
+template <class T, class U>
+void LatticeApply<T,U>::collapseTile (
+    TiledCollapser<T,U>& collapser,
+    const Array<T>& cursor, const Array<Bool>& mask, Bool useMask,
+    const IPosition& pos, const IPosition& collapseAxes, uInt collStart,
+    const IPosition& iterAxes, const IPosition& ioMap, uInt resultAxis
+) {
+    uInt j;
+    const uInt inDim = pos.nelements();
+    const uInt collDim = collapseAxes.nelements();
+    const uInt iterDim = iterAxes.nelements();
+    const IPosition& cursorShape = cursor.shape();
+    IPosition latPos = pos;
+
+    // Put the collapsed lines into an output buffer
+    // Initialize the cursor position needed in the loop.
+
+    IPosition curPos (inDim, 0);
+
+    // Determine the increment for the first collapse axes.
+    // This is done by taking the difference between the adresses of two pixels
+    // in the cursor (if there are 2 pixels).
+
+    IPosition chunkShape (inDim, 1);
+    for (j=0; j<collStart; ++j) {
+        const uInt axis = collapseAxes(j);
+        chunkShape(axis) = cursorShape(axis);
+    }
+    uInt nval = chunkShape.product();
+    const uInt axis = collapseAxes(0);
+
+    IPosition p0(inDim, 0);
+    IPosition p1(inDim, 0);
+    p1[axis] = 1;
+    // general for Arrays with contiguous or non-contiguous storage.
+    uInt dataIncr = &(cursor(p1)) - &(cursor(p0));
+    uInt maskIncr = useMask ? &(mask(p1)) - &(mask(p0)) : 0;
+
+    // Iterate in the outer loop through the iterator axes.
+    // Iterate in the inner loop through the collapse axes.
+
+    uInt index1 = 0;
+    uInt index3 = 0;
+    for (;;) {
+        for (;;) {
+	        if (useMask) {
+	            collapser.process (
+                    index1, index3, &(cursor(curPos)), &(mask(curPos)),
+			        dataIncr, maskIncr, nval, latPos, chunkShape
+                );
+	        }
+            else {
+	            collapser.process(
+                    index1, index3,
+			        &(cursor(curPos)), 0,
+			        dataIncr, maskIncr, nval, latPos, chunkShape
+                );
+	        }
+	        // Increment a collapse axis until all axes are handled.
+	        for (j=collStart; j<collDim; ++j) {
+	            uInt axis = collapseAxes(j);
+	            if (++curPos(axis) < cursorShape(axis)) {
+		            break;
+	            }
+	            curPos(axis) = 0;               // restart this axis
+	        }
+	        if (j == collDim) {
+	            break;                          // all axes are handled
+	        }
+        }
+
+        // Increment an iteration axis until all iteration axes are handled.
+
+        for (j=0; j<iterDim; ++j) {
+	        uInt arraxis = iterAxes(j);
+	        uInt axis = ioMap(arraxis);
+	        ++latPos(axis);
+	        if (++curPos(axis) < cursorShape(axis)) {
+	            if (arraxis < resultAxis) {
+	                ++index1;
+	            }
+                else {
+	                ++index3;
+		            index1 = 0;
+	            }
+	            break;
+	        }
+	        curPos(axis) = 0;
+	        latPos(axis) = pos(axis);
+        }
+        if (j == iterDim) {
+	        break;
+        }
+    }
+}
+
+template <class T, class U>
+void LatticeApply<T,U>::collapseParallel (
+    std::vector<std::unique_ptr<TiledCollapser<T,U>>>& clones,
+    std::vector<Array<T>>& cursors, std::vector<Array<Bool>>& masks,
+    std::vector<IPosition>& positions, Bool useMask,
+    const IPosition& collapseAxes, uInt collStart,
+    const IPosition& iterAxes, const IPosition& ioMap, uInt resultAxis
+) {
+    // Tile i is collapsed by clone i, so no clone is used by two threads.
+    const Int ntile = cursors.size();
+    std::vector<std::exception_ptr> errors(ntile);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(ntile) schedule(static, 1)
+#endif
+    for (Int i=0; i<ntile; ++i) {
+        try {
+            collapseTile (*clones[i], cursors[i], masks[i], useMask,
+                          positions[i], collapseAxes, collStart, iterAxes,
+                          ioMap, resultAxis);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    }
+    cursors.clear();
+    masks.clear();
+    positions.clear();
+    for (const auto& err : errors) {
+        if (err) {
+            std::rethrow_exception (err);
+        }
+    }
+}
+
 
 
 template <class T, class U>
@@ -229,6 +229,11 @@ public:
   // Helper function to optimize adding
   static void addTo(Lattice<T>& to, const Lattice<T>& add);
 
+  // Add <src>factor*add</src> to <src>to</src>.
+  // If both lattices are in memory, the arrays are updated in place
+  // using multiple threads.
+  static void addScaled(Lattice<T>& to, const Lattice<T>& add, T factor);
+
 protected:
   // Make sure that the peak of the Psf is within the image
   Bool validatePsf(const Lattice<T> & psf);
@@ -247,6 +252,39 @@ protected:
   Bool findMaxAbsMaskLattice(const Lattice<T>& lattice, const Lattice<T>& mask,
                              T& maxAbs, IPosition& posMax);
 
+  // The ways <src>findPeakArray</src> can determine the peak.
+  enum PeakMode {
+    // Largest absolute value of data*weight (or data if no weight).
+    ABSPRODUCT,
+    // As ABSPRODUCT, but the data value is used to compare the candidates
+    // of the lines (as done for a weighted mask).
+    ABSDATA,
+    // Largest positive value of data*weight.
+    MAXPRODUCT,
+    // Largest positive value of data*(1-weight).
+    MAXFLIPPED
+  };
+
+  // Find the peak in an array (with an optional weight array of the same
+  // shape) in the way a lattice iterator over the lines would find it
+  // using <src>minMax</src> or <src>minMaxMasked</src>. The search starts
+  // with a peak value 0 at position 0.
+  // <br>The lines are searched in parallel using OpenMP. The result does
+  // not depend on the number of threads.
+  static void findPeakArray(const Array<T>& data, const Array<T>* weight,
+                            PeakMode mode, T& peak, IPosition& posPeak);
+
+  // Get the offset of a line (along the first axis) in an array.
+  static size_t lineOffset(size_t line, const IPosition& shape,
+                           const IPosition& steps);
+
+  // Find the first minimum and maximum in a line of data*weight or
+  // data*(1-weight) if flip is True. The weight can be a null pointer.
+  static void lineMinMax(T& minVal, T& maxVal, size_t& minPos, size_t& maxPos,
+                         const T* data, ssize_t dataStep,
+                         const T* weight, ssize_t weightStep,
+                         Bool flip, size_t n);
+
   // Helper function to reduce the box sizes until the have the same   
   // size keeping the centers intact  
   static void makeBoxesSameSize(IPosition& blc1, IPosition& trc1,                               
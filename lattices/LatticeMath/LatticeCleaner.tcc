@@ -27,6 +27,8 @@
 
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayMathKernels.h>
+#include <casacore/casa/Utilities/COWPtr.h>
 
 #include <casacore/casa/Logging/LogIO.h>
 #include <casacore/casa/OS/File.h>
@@ -619,8 +621,7 @@ Int LatticeCleaner<T>::clean(Lattice<T>& model,
     SubLattice<T> scaleSub(*itsScales[optimumScale], subRegionPsf, True);
     
     // Now do the addition of this scale to the model image....
-    LatticeExpr<T> add(scaleFactor*scaleSub);
-    addTo(modelSub, add);
+    addScaled(modelSub, scaleSub, scaleFactor);
 
     // and then subtract the effects of this scale from all the precomputed
     // dirty convolutions.
@@ -629,8 +630,7 @@ Int LatticeCleaner<T>::clean(Lattice<T>& model,
       AlwaysAssert(itsPsfConvScales[index(scale,optimumScale)], AipsError);
       SubLattice<T> psfSub(*itsPsfConvScales[index(scale,optimumScale)],
 			   subRegionPsf, True);
-      LatticeExpr<T> sub((-scaleFactor)*psfSub);
-      addTo(dirtySub, sub);
+      addScaled(dirtySub, psfSub, -scaleFactor);
     }
   }
   // End of iteration
@@ -670,6 +670,13 @@ Bool LatticeCleaner<T>::findMaxAbsLattice(const Lattice<T>& lattice,
 					  IPosition& posMaxAbs)
 {
 
+  // A lattice in memory is searched directly in its array.
+  if (!lattice.isPaged()) {
+    COWPtr<Array<T>> arr;
+    lattice.get (arr);
+    findPeakArray (*arr, 0, ABSPRODUCT, maxAbs, posMaxAbs);
+    return True;
+  }
   posMaxAbs = IPosition(lattice.shape().nelements(), 0);
   maxAbs=0.0;
   const IPosition tileShape = lattice.niceCursorShape();
@@ -708,6 +715,15 @@ Bool LatticeCleaner<T>::findMaxAbsMaskLattice(const Lattice<T>& lattice,
 					      IPosition& posMaxAbs)
 {
 
+  if (!lattice.isPaged()  &&  !mask.isPaged()) {
+    COWPtr<Array<T>> arr;
+    COWPtr<Array<T>> marr;
+    lattice.get (arr);
+    mask.get (marr);
+    findPeakArray (*arr, &(*marr), (itsMaskThreshold<0 ? ABSDATA : ABSPRODUCT),
+                   maxAbs, posMaxAbs);
+    return True;
+  }
   posMaxAbs = IPosition(lattice.shape().nelements(), 0);
   maxAbs=0.0;
   const IPosition tileShape = lattice.niceCursorShape();
@@ -750,6 +766,136 @@ Bool LatticeCleaner<T>::findMaxAbsMaskLattice(const Lattice<T>& lattice,
 
 
 
+template<class T>
+void LatticeCleaner<T>::findPeakArray(const Array<T>& data,
+                                      const Array<T>* weight,
+                                      PeakMode mode,
+                                      T& peak, IPosition& posPeak)
+{
+  const IPosition& shape = data.shape();
+  const uInt ndim = shape.nelements();
+  peak = T(0);
+  posPeak = IPosition(ndim, 0);
+  if (data.nelements() == 0) {
+    return;
+  }
+  AlwaysAssert (weight==0  ||  weight->shape().isEqual(shape), AipsError);
+  const Bool absMode = (mode == ABSPRODUCT  ||  mode == ABSDATA);
+  const size_t nx = shape[0];
+  const size_t nlines = data.nelements() / nx;
+  const T* dataPtr = data.data();
+  const T* weightPtr = (weight ? weight->data() : 0);
+  // Each thread searches a range of lines. The results are combined in
+  // line order using the same comparisons as done for the candidates
+  // of a line, so the outcome is the same as for a sequential search.
+  size_t nchunk = std::min (arrays_internal::parallelNChunk(data.nelements()),
+                            nlines);
+  std::vector<T> peaks(std::max(nchunk, size_t(1)), T(0));
+  std::vector<size_t> peakLine(peaks.size(), 0);
+  std::vector<size_t> peakX(peaks.size(), 0);
+  arrays_internal::parallelChunks
+    (nlines, nchunk, [&](size_t c, size_t st, size_t n)
+     {
+       T best(0);
+       for (size_t line=st; line<st+n; ++line) {
+         const T* d = dataPtr + lineOffset(line, shape, data.steps());
+         const T* w = 0;
+         if (weightPtr) {
+           w = weightPtr + lineOffset(line, shape, weight->steps());
+         }
+         T minVal, maxVal;
+         size_t minPos, maxPos;
+         lineMinMax (minVal, maxVal, minPos, maxPos, d, data.steps()[0],
+                     w, (w ? weight->steps()[0] : 0), mode==MAXFLIPPED, nx);
+         if (absMode) {
+           if (mode == ABSDATA) {
+             minVal = d[minPos * data.steps()[0]];
+             maxVal = d[maxPos * data.steps()[0]];
+           }
+           if (std::abs(minVal) > std::abs(best)) {
+             best = minVal;
+             peakLine[c] = line;
+             peakX[c] = minPos;
+           }
+           if (std::abs(maxVal) > std::abs(best)) {
+             best = maxVal;
+             peakLine[c] = line;
+             peakX[c] = maxPos;
+           }
+         } else if (maxVal > best) {
+           best = maxVal;
+           peakLine[c] = line;
+           peakX[c] = maxPos;
+         }
+       }
+       peaks[c] = best;
+     });
+  size_t bestLine = 0;
+  size_t bestX = 0;
+  for (size_t c=0; c<peaks.size(); ++c) {
+    if (absMode ? std::abs(peaks[c]) > std::abs(peak) : peaks[c] > peak) {
+      peak = peaks[c];
+      bestLine = peakLine[c];
+      bestX = peakX[c];
+    }
+  }
+  posPeak[0] = bestX;
+  for (uInt k=1; k<ndim; ++k) {
+    posPeak[k] = bestLine % shape[k];
+    bestLine /= shape[k];
+  }
+}
+
+template<class T>
+size_t LatticeCleaner<T>::lineOffset(size_t line, const IPosition& shape,
+                                     const IPosition& steps)
+{
+  size_t offset = 0;
+  for (uInt k=1; k<shape.nelements(); ++k) {
+    offset += (line % shape[k]) * steps[k];
+    line /= shape[k];
+  }
+  return offset;
+}
+
+template<class T>
+void LatticeCleaner<T>::lineMinMax(T& minVal, T& maxVal,
+                                   size_t& minPos, size_t& maxPos,
+                                   const T* data, ssize_t dataStep,
+                                   const T* weight, ssize_t weightStep,
+                                   Bool flip, size_t n)
+{
+  // Find the first minimum and maximum like minMax and minMaxMasked do.
+  minPos = maxPos = 0;
+  if (weight == 0) {
+    minVal = maxVal = data[0];
+    for (size_t i=1; i<n; ++i) {
+      T tmp = data[i*dataStep];
+      if (tmp < minVal) {
+        minVal = tmp;
+        minPos = i;
+      } else if (tmp > maxVal) {
+        maxVal = tmp;
+        maxPos = i;
+      }
+    }
+  } else {
+    minVal = maxVal = data[0] * (flip ? T(1)-weight[0] : weight[0]);
+    for (size_t i=1; i<n; ++i) {
+      T w = weight[i*weightStep];
+      T tmp = data[i*dataStep] * (flip ? T(1)-w : w);
+      if (tmp < minVal) {
+        minVal = tmp;
+        minPos = i;
+      } else if (tmp > maxVal) {
+        maxVal = tmp;
+        maxPos = i;
+      }
+    }
+  }
+}
+
+
 template<class T>
 Bool LatticeCleaner<T>::setscales(const Int nscales, const Float scaleInc)
 {
@@ -1188,6 +1334,62 @@ void LatticeCleaner<T>::addTo(Lattice<T>& to, const Lattice<T>& add)
   }
 }
 
+template<class T>
+void LatticeCleaner<T>::addScaled(Lattice<T>& to, const Lattice<T>& add,
+                                  T factor)
+{
+  AlwaysAssert (to.isWritable(), AipsError);
+  const IPosition shape = to.shape();
+  AlwaysAssert (add.shape().isEqual (shape), AipsError);
+  if (to.isPaged()  ||  add.isPaged()) {
+    // Step through paged lattices to limit the memory usage.
+    LatticeStepper stepper (shape, to.niceCursorShape(),
+                            LatticeStepper::RESIZE);
+    LatticeIterator<T> toIter(to, stepper);
+    RO_LatticeIterator<T> addIter(add, stepper);
+    for (addIter.reset(), toIter.reset(); !addIter.atEnd();
+         addIter++, toIter++) {
+      toIter.rwCursor() += addIter.cursor() * factor;
+    }
+    return;
+  }
+  // The lattices are in memory, so normally references to their arrays
+  // are obtained. The lines are updated in parallel.
+  IPosition start(shape.nelements(), 0);
+  Array<T> toArr;
+  Bool isRef = to.getSlice (toArr, start, shape);
+  COWPtr<Array<T>> addArr;
+  add.getSlice (addArr, start, shape);
+  T* toPtr = toArr.data();
+  const T* addPtr = addArr->data();
+  const ssize_t toStep  = toArr.steps()[0];
+  const ssize_t addStep = addArr->steps()[0];
+  const size_t nx = shape[0];
+  const size_t nlines = (nx == 0 ? 0 : toArr.nelements() / nx);
+  size_t nchunk = std::min (arrays_internal::parallelNChunk(toArr.nelements()),
+                            nlines);
+  arrays_internal::parallelChunks
+    (nlines, nchunk, [&](size_t, size_t st, size_t n)
+     {
+       for (size_t line=st; line<st+n; ++line) {
+         T* t = toPtr + lineOffset(line, shape, toArr.steps());
+         const T* a = addPtr + lineOffset(line, shape, addArr->steps());
+         if (toStep == 1  &&  addStep == 1) {
+           for (size_t i=0; i<nx; ++i) {
+             t[i] += a[i] * factor;
+           }
+         } else {
+           for (size_t i=0; i<nx; ++i) {
+             t[i*toStep] += a[i*addStep] * factor;
+           }
+         }
+       }
+     });
+  if (!isRef) {
+    to.putSlice (toArr, start);
+  }
+}
+
 template <class T>
 void LatticeCleaner<T>::makeBoxesSameSize(IPosition& blc1, IPosition& trc1, 
                   IPosition &blc2, IPosition& trc2)
@@ -31,12 +31,14 @@
 #include <casacore/scimath/Mathematics/NumericTraits.h>
 #include <casacore/lattices/Lattices/TempLattice.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
 //template <class T> class LatticeConvolver;
 class IPosition;
+template<class T, class S> class FFTServer;
 
 // <summary>Lists the different types of Convolutions that can be done</summary>
 // <synopsis>This enumerator is brought out as a separate class because g++
@@ -218,6 +220,16 @@ private:
   //# because all information must be suplied in the input arguments
   static void pad(Lattice<T> & paddedLat, const Lattice<T> & inLat);
   static void unpad(Lattice<T> & result, const Lattice<T> & paddedResult);
+  // Convolve the planes of the model in memory, where multiple planes are
+  // done in parallel using the transfer function held in memory. It returns
+  // False (without doing anything) if not enough memory is available.
+  Bool convolvePlanes(Lattice<T> & result, const Lattice<T> & model,
+		      const IPosition & sliceShape) const;
+  static Array<T> convolvePlane
+    (FFTServer<T,typename NumericTraits<T>::ConjugateType> & server,
+     const Array<T> & plane,
+     const Array<typename NumericTraits<T>::ConjugateType> & xfr,
+     const IPosition & fftShape, Bool doFast);
   void makeXfr(const Lattice<T> & psf);
   void makePsf(Lattice<T> & psf) const;
   static IPosition calcFFTShape(const IPosition & psfShape, 
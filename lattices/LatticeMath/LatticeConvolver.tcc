@@ -36,7 +36,12 @@
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/scimath/Mathematics/FFTServer.h>
 #include <casacore/casa/iostream.h>
+#include <exception>
+#include <memory>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -52,7 +57,10 @@ LatticeConvolver()
    itsPsf(0),
    itsCachedPsf(False)
 {
+  itsXfr = new TempLattice<typename NumericTraits<T>::ConjugateType>
+    (itsFFTShape, maxLatSize);
   itsXfr->set(typename NumericTraits<T>::ConjugateType(1));
+  itsPsf = new TempLattice<T>();
   doFast_p=False;
 } 
 
@@ -195,6 +203,16 @@ convolve(Lattice<T> & result, const Lattice<T> & model) const {
   const IPosition modelShape = model.shape();
   DebugAssert(result.shape() == modelShape, AipsError);
   DebugAssert(modelShape == itsModelShape, AipsError);
+  IPosition sliceShape(ndim,1);
+  for (uInt n = 0; n < ndim; n++) {
+    if (itsFFTShape(n) > 1) {
+      sliceShape(n) = modelShape(n);
+    }
+  }
+  // Convolve the planes in memory if possible.
+  if (convolvePlanes(result, model, sliceShape)) {
+    return;
+  }
   // Create a lattice that will hold the transform. Do this before creating the
   // paddedModel TempLattice so that it is more likely to be memory based.
   IPosition XFRShape(itsFFTShape);
@@ -212,12 +230,6 @@ convolve(Lattice<T> & result, const Lattice<T> & model) const {
     modelPtr = resultPtr;
   } 
 
-  IPosition sliceShape(ndim,1);
-  for (uInt n = 0; n < ndim; n++) {
-    if (itsFFTShape(n) > 1) {
-      sliceShape(n) = modelShape(n);
-    }
-  }
   LatticeStepper ls(modelShape, sliceShape);
   for (ls.reset(); !ls.atEnd(); ls++) {
     const Slicer sl(ls.position(), sliceShape);
@@ -287,6 +299,112 @@ convolve(Lattice<T> & result, const Lattice<T> & model) const {
   //  cerr << "convolve" << endl;
 }
 
+template<class T> Bool LatticeConvolver<T>::
+convolvePlanes(Lattice<T> & result, const Lattice<T> & model,
+	       const IPosition & sliceShape) const {
+  typedef typename NumericTraits<T>::ConjugateType CType;
+  // A transform with length 1 on the first axis is not done by LatticeFFT,
+  // so leave it to the lattice based convolution.
+  if (itsFFTShape(0) <= 1) {
+    return False;
+  }
+  const Int nplanes = model.shape().product() / sliceShape.product();
+  uInt nthreads = 1;
+#ifdef _OPENMP
+  nthreads = std::max(1, std::min(Int(OMP::nMaxThreads()), nplanes));
+#endif
+  // The transfer function, and for each thread the in- and output plane and
+  // its padded version and transform must fit in memory.
+  const Double nbytes = itsXfr->shape().product() * sizeof(CType) *
+                          (1 + nthreads) +
+                        (itsFFTShape.product() + 2*sliceShape.product()) *
+                          sizeof(T) * nthreads;
+  if (nbytes > Double(maxLatSize) * 1024 * 1024) {
+    return False;
+  }
+  const Array<CType> xfr = itsXfr->get();
+  std::vector<IPosition> positions;
+  LatticeStepper ls(model.shape(), sliceShape);
+  for (ls.reset(); !ls.atEnd(); ls++) {
+    positions.push_back(ls.position());
+  }
+  std::vector<std::unique_ptr<FFTServer<T,CType> > > servers;
+  for (uInt i = 0; i < nthreads; i++) {
+    servers.push_back(std::unique_ptr<FFTServer<T,CType> >
+		      (new FFTServer<T,CType>()));
+  }
+  // Process the planes in batches of nthreads planes. Reading and writing
+  // is done sequentially, because lattices are not thread-safe.
+  std::vector<Array<T> > planes(nthreads);
+  std::vector<std::exception_ptr> errors(nthreads);
+  for (uInt first = 0; first < positions.size(); first += nthreads) {
+    const Int n = std::min(size_t(nthreads), positions.size() - first);
+    for (Int i = 0; i < n; i++) {
+      planes[i].reference(model.getSlice(positions[first+i], sliceShape));
+    }
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(n) schedule(static, 1)
+#endif
+    for (Int i = 0; i < n; i++) {
+      try {
+	planes[i].reference(convolvePlane(*servers[i], planes[i], xfr,
+					  itsFFTShape, doFast_p));
+      } catch (...) {
+	errors[i] = std::current_exception();
+      }
+    }
+    for (const std::exception_ptr& err : errors) {
+      if (err) {
+	std::rethrow_exception(err);
+      }
+    }
+    for (Int i = 0; i < n; i++) {
+      result.putSlice(planes[i], positions[first+i]);
+    }
+  }
+  return True;
+}
+
+template<class T> Array<T> LatticeConvolver<T>::
+convolvePlane(FFTServer<T,typename NumericTraits<T>::ConjugateType> & server,
+	      const Array<T> & plane,
+	      const Array<typename NumericTraits<T>::ConjugateType> & xfr,
+	      const IPosition & fftShape, Bool doFast) {
+  // Pad the plane in the same way as the pad function does.
+  const uInt ndim = plane.ndim();
+  const IPosition planeShape = plane.shape();
+  Array<T> padded(fftShape);
+  padded = T(0);
+  IPosition inBlc(ndim, 0);
+  IPosition patchShape(planeShape);
+  for (uInt k = 0; k < ndim; k++) {
+    if (fftShape(k) < planeShape(k)) {
+      inBlc(k) = planeShape(k)/2 - fftShape(k)/2;
+      patchShape(k) = fftShape(k);
+    }
+  }
+  const IPosition outBlc = fftShape/2 - patchShape/2;
+  padded(outBlc, outBlc+patchShape-1) = plane(inBlc, inBlc+patchShape-1);
+  // Transform, multiply with the transfer function and transform back,
+  // in the same way as LatticeFFT::rcfft and crfft do.
+  Array<typename NumericTraits<T>::ConjugateType> fftPlane;
+  if (doFast) {
+    server.fft0(fftPlane, padded, False);
+  } else {
+    server.fft(fftPlane, padded, False);
+  }
+  fftPlane *= xfr;
+  if (doFast) {
+    server.fft0(padded, fftPlane, False);
+    server.flip(padded, False, False);
+  } else {
+    server.fft(padded, fftPlane, False);
+  }
+  // Unpad the result.
+  const IPosition blc = fftShape/2 - planeShape/2;
+  return padded(blc, blc+planeShape-1).copy();
+}
+
 template<class T> void LatticeConvolver<T>::
 convolve(Lattice<T> & modelAndResult) const {
   convolve(modelAndResult, modelAndResult);
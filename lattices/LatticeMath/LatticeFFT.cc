@@ -0,0 +1,85 @@
+//# LatticeFFT.cc: functions for doing FFT's on Lattices
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/lattices/LatticeMath/LatticeFFT.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <algorithm>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+std::vector<Slicer> LatticeFFT::makeChunks (const IPosition& shape,
+                                            const IPosition& tileShape,
+                                            uInt axis)
+{
+  const Int64 maxChunkSize = 4*1024*1024;
+  const uInt ndim = shape.nelements();
+  // Start with a pencil of one tile containing complete lines.
+  IPosition tile(ndim);
+  for (uInt i=0; i<ndim; ++i) {
+    tile[i] = 1;
+    if (i < tileShape.nelements()) {
+      tile[i] = std::max (ssize_t(1), std::min (tileShape[i], shape[i]));
+    }
+  }
+  IPosition cursor(tile);
+  cursor[axis] = shape[axis];
+  // Extend it with whole tiles in the other axes to form a slab
+  // as long as it does not get too large.
+  for (uInt i=0; i<ndim; ++i) {
+    if (i != axis) {
+      Int64 maxFactor = maxChunkSize / cursor.product();
+      Int64 ntile = (shape[i] + tile[i] - 1) / tile[i];
+      Int64 factor = std::min<Int64> (maxFactor, ntile);
+      if (factor > 1) {
+        cursor[i] = std::min<Int64> (factor*tile[i], shape[i]);
+      }
+    }
+  }
+  // Make the slicers by stepping through the lattice.
+  std::vector<Slicer> chunks;
+  IPosition pos(ndim, 0);
+  IPosition length(ndim);
+  while (True) {
+    for (uInt i=0; i<ndim; ++i) {
+      length[i] = std::min (cursor[i], shape[i] - pos[i]);
+    }
+    chunks.push_back (Slicer(pos, length));
+    uInt i = 0;
+    for (; i<ndim; ++i) {
+      pos[i] += cursor[i];
+      if (pos[i] < shape[i]) {
+        break;
+      }
+      pos[i] = 0;
+    }
+    if (i == ndim) {
+      break;
+    }
+  }
+  return chunks;
+}
+
+} //# NAMESPACE CASACORE - END
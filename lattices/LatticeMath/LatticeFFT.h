@@ -31,10 +31,15 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/scimath/Mathematics/NumericTraits.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
+#include <memory>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 template <class T> class Lattice;
+template <class T, class S> class FFTServer;
+class IPosition;
+class Slicer;
 
 // <summary>Functions for Fourier transforming Lattices</summary>
 
@@ -48,6 +53,18 @@ template <class T> class Lattice;
 // </etymology>
 
 // <synopsis> 
+// The functions in this class Fourier transform a lattice axis by axis.
+// A lattice can be much larger than the available memory, so for each
+// axis it is transformed in chunks. A chunk contains complete lines along
+// the axis and whole tiles in the other axes (a pencil or slab, depending
+// on the tile shape), so each tile is read and written only once per axis.
+// For a lattice on disk the next chunk is read in a separate thread while
+// the current chunk is transformed.
+// All lines in a chunk are transformed at once (complex to complex) or
+// are divided over multiple threads (real to complex and vice-versa).
+// <br><src>cfft2d</src> transforms chunks of complete planes if a plane fits
+// in memory, so a cube of small planes is transformed in a few batched
+// calls instead of plane by plane.
 // </synopsis> 
 
 // <example>
@@ -144,6 +161,49 @@ public:
         const Bool doShift=True, Bool doFast=False
     );
   // </group>
+
+private:
+  // Get the chunks in which a lattice is transformed along the given axis.
+  // A chunk contains complete lines along the axis and an integral number
+  // of tiles in the other axes, where the number of tiles is limited to
+  // keep a chunk at about 4 million elements.
+  static std::vector<Slicer> makeChunks (const IPosition& shape,
+                                         const IPosition& tileShape,
+                                         uInt axis);
+
+  // Transform a lattice along the axis chunk by chunk, where the chunks
+  // are made using the tile shape of the output lattice. The chunk of the
+  // input has the full input length along the axis. The function
+  // <src>func(outChunk, inChunk)</src> has to fill the output chunk,
+  // which can be done by referencing the input chunk (for in-place
+  // transforms). The input and output lattice can be the same object.
+  // <br>If the input lattice is paged, the next chunk is read by another
+  // thread while the current chunk is transformed. The lattice objects
+  // are never accessed concurrently.
+  template <class InType, class OutType, class Func>
+  static void transformChunks (Lattice<OutType>& out,
+                               const Lattice<InType>& in,
+                               uInt axis, Func func);
+
+  // Transform the lattice using the given output chunks and corresponding
+  // input chunks as done by <src>transformChunks</src>.
+  template <class InType, class OutType, class Func>
+  static void transformSlices (Lattice<OutType>& out,
+                               const Lattice<InType>& in,
+                               const std::vector<Slicer>& chunks,
+                               const std::vector<Slicer>& inChunks,
+                               Func func);
+
+  // Transform all lines along the axis of an in-memory chunk by calling
+  // <src>func(server, outLine, inLine)</src> for each line.
+  // The lines are divided over multiple threads, each using its own
+  // FFTServer object.
+  template <class ComplexType, class InType, class OutType, class Func>
+  static void transformLines
+    (std::vector<std::unique_ptr<FFTServer
+       <typename NumericTraits<ComplexType>::ConjugateType,
+        ComplexType>>>& servers,
+     Array<OutType>& out, const Array<InType>& in, uInt axis, Func func);
 };
 
 // implement template specializations to throw exceptions in the relevant cases.
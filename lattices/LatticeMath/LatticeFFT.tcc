@@ -42,7 +42,11 @@
 #include <casacore/lattices/Lattices/TempLattice.h>
 #include <casacore/lattices/Lattices/TiledLineStepper.h>
 #include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/iostream.h>
+#include <exception>
+#include <future>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -60,15 +64,18 @@ template <class ComplexType> void LatticeFFT::cfft2d(
   //use memory Free  and use a quarter of that
   Long cacheSize = (HostInfo::memoryFree()/(sizeof(ComplexType)*4))*1024;
 
-  // For small transforms, we do everything in one plane
+  // For small transforms, we do entire planes. As many planes as fit in
+  // a chunk are transformed at once, so FFTW can divide them over its
+  // threads, while the next chunk is read ahead.
   if (((Long)(nx)*(Long)(ny)) <= cacheSize) {
-    const IPosition cursorShape(2, nx, ny);
-    LatticeStepper ls(latticeShape, cursorShape);
-    LatticeIterator<ComplexType> li(cLattice, ls);
-    FFTServer<typename NumericTraits<ComplexType>::ConjugateType,ComplexType> ffts(cursorShape);
-    for (li.reset(); !li.atEnd(); li++) {
-      ffts.fft(li.rwMatrixCursor(), toFrequency);
-    }
+    const std::vector<Slicer> chunks = makeChunks (latticeShape,
+                                                   IPosition(2, nx, ny), 0);
+    FFTServer<typename NumericTraits<ComplexType>::ConjugateType,ComplexType> ffts;
+    transformSlices (cLattice, cLattice, chunks, chunks,
+                     [&](Array<ComplexType>& out, Array<ComplexType>& chunk)
+                     { ffts.fftAxis(chunk, 0, toFrequency);
+                       ffts.fftAxis(chunk, 1, toFrequency);
+                       out.reference(chunk); });
   } // For large transforms , we do line by line FFT's
   else {
     Vector<Bool> whichAxes(ndim, False);
@@ -84,16 +91,14 @@ template <class ComplexType> void LatticeFFT::cfft(Lattice<ComplexType>& cLattic
   DebugAssert(ndim > 0, AipsError);
   DebugAssert(ndim == whichAxes.nelements(), AipsError);
   FFTServer<typename NumericTraits<ComplexType>::ConjugateType,ComplexType> ffts;
-  const IPosition latticeShape = cLattice.shape();
-  const IPosition tileShape = cLattice.niceCursorShape();
 
   for (uInt dim = 0; dim < ndim; dim++) {
     if (whichAxes(dim) == True) {
-      TiledLineStepper ts(latticeShape, tileShape, dim);
-      LatticeIterator<ComplexType> li(cLattice, ts);
-      for (li.reset(); !li.atEnd(); li++) {
-	ffts.fft(li.rwVectorCursor(), toFrequency);
-      }
+      // Transform all lines in a chunk at once.
+      transformChunks (cLattice, cLattice, dim,
+                       [&](Array<ComplexType>& out, Array<ComplexType>& chunk)
+                       { ffts.fftAxis(chunk, dim, toFrequency);
+                         out.reference(chunk); });
     }
   }
 }
@@ -104,16 +109,14 @@ template <class ComplexType> void LatticeFFT::cfft0(Lattice<ComplexType>& cLatti
   DebugAssert(ndim > 0, AipsError);
   DebugAssert(ndim == whichAxes.nelements(), AipsError);
   FFTServer<typename NumericTraits<ComplexType>::ConjugateType,ComplexType> ffts;
-  const IPosition latticeShape = cLattice.shape();
-  const IPosition tileShape = cLattice.niceCursorShape();
 
   for (uInt dim = 0; dim < ndim; dim++) {
     if (whichAxes(dim) == True) {
-      TiledLineStepper ts(latticeShape, tileShape, dim);
-      LatticeIterator<ComplexType> li(cLattice, ts);
-      for (li.reset(); !li.atEnd(); li++) {
-	ffts.fft0(li.rwVectorCursor(), toFrequency);
-      }
+      // Transform all lines in a chunk at once.
+      transformChunks (cLattice, cLattice, dim,
+                       [&](Array<ComplexType>& out, Array<ComplexType>& chunk)
+                       { ffts.fft0Axis(chunk, dim, toFrequency);
+                         out.reference(chunk); });
     }
   }
 }
@@ -130,6 +133,7 @@ template <class ComplexType> void LatticeFFT::rcfft(
     const Lattice<typename NumericTraits<ComplexType>::ConjugateType>& in,
 		       const Vector<Bool>& whichAxes, const Bool doShift,
 		       Bool doFast){
+  typedef typename NumericTraits<ComplexType>::ConjugateType RealType;
   const uInt ndim = in.ndim();
   DebugAssert(ndim > 0, AipsError);
   DebugAssert(ndim == whichAxes.nelements(), AipsError);
@@ -146,65 +150,60 @@ template <class ComplexType> void LatticeFFT::rcfft(
   outShape(firstAxis) = (outShape(firstAxis)+2)/2;
   DebugAssert(outShape.isEqual(out.shape()), AipsError);
 
+  // Copy the input tile by tile into a lattice with the output tiling.
   const IPosition tileShape = out.niceCursorShape();
-  TempLattice<typename NumericTraits<ComplexType>::ConjugateType> inlocal(
-      TiledShape(in.shape(), tileShape)
-  );
-  inlocal.put(in.get());
-  FFTServer<typename NumericTraits<ComplexType>::ConjugateType,ComplexType> ffts;
+  TempLattice<RealType> inlocal(TiledShape(in.shape(), tileShape));
+  inlocal.copyData(in);
+  FFTServer<RealType,ComplexType> ffts;
+  std::vector<std::unique_ptr<FFTServer<RealType,ComplexType>>> servers;
+  // The origin is shifted if the transform is not fast.
+  const Bool shift = doShift && !doFast;
 
-    {
-      for (uInt dim = 0; dim < ndim; dim++) {
-	if (whichAxes(dim) == True) {
-	  if (dim == firstAxis) { 
-	    if (inShape(dim) != 1) { // Do real->complex Transforms
-	      LatticeIterator<typename NumericTraits<ComplexType>::ConjugateType> inIter(inlocal,
-					       TiledLineStepper(inShape,
-								tileShape,dim));
-	      LatticeIterator<ComplexType> outIter(out,
-					       TiledLineStepper(outShape,
-								tileShape,dim));
-	      for (inIter.reset(), outIter.reset();
-		   !inIter.atEnd() && !outIter.atEnd(); inIter++, outIter++) {
-		if (doShift) {
-		  if(doFast){
-		    // ffts.flip(inIter.rwVectorCursor(), True, False);
-		    ffts.fft0(outIter.woVectorCursor(), inIter.vectorCursor());
-		  }
-		  else{
-		    ffts.fft(outIter.woVectorCursor(), inIter.vectorCursor());
-		  }
-		    
-		} else {
-		  ffts.fft0(outIter.woVectorCursor(), inIter.vectorCursor());
-		}
-	      }
-	    } else { // just copy the data
-	      out.copyData(LatticeExpr<ComplexType>(in));
-	    }
-	  }
-	  else { // Do complex->complex transforms
-	    if (inShape(dim) != 1) { 
-	      LatticeIterator<ComplexType> iter(out,
-					    TiledLineStepper(outShape,
-							     tileShape, dim));
-	      for (iter.reset(); !iter.atEnd(); iter++) {
-		if (doShift) {
-		  if(doFast){
-		    ffts.fft0(iter.rwVectorCursor(),True);
-		  }
-		  else{
-		    ffts.fft(iter.rwVectorCursor(),True);
-		  }
-		} else {
-		  ffts.fft0(iter.rwVectorCursor(), True);
-		}
-	      }
-	    }
-	  }
+  for (uInt dim = 0; dim < ndim; dim++) {
+    if (whichAxes(dim) == True) {
+      if (dim == firstAxis) { 
+	if (inShape(dim) != 1) { // Do real->complex Transforms
+	  transformChunks
+	    (out, inlocal, dim,
+	     [&](Array<ComplexType>& outChunk, Array<RealType>& inChunk)
+	     {
+	       IPosition chunkShape = inChunk.shape();
+	       chunkShape(dim) = outShape(dim);
+	       outChunk.resize(chunkShape);
+	       transformLines<ComplexType>
+		 (servers, outChunk, inChunk, dim,
+		  [shift](FFTServer<RealType,ComplexType>& server,
+			  Vector<ComplexType>& outLine,
+			  Vector<RealType>& inLine)
+		  {
+		    if (shift) {
+		      server.fft(outLine, inLine);
+		    } else {
+		      server.fft0(outLine, inLine);
+		    }
+		  });
+	     });
+	} else { // just copy the data
+	  out.copyData(LatticeExpr<ComplexType>(in));
+	}
+      }
+      else { // Do complex->complex transforms
+	if (inShape(dim) != 1) { 
+	  transformChunks (out, out, dim,
+			   [&](Array<ComplexType>& outChunk,
+			       Array<ComplexType>& chunk)
+			   {
+			     if (shift) {
+			       ffts.fftAxis(chunk, dim, True);
+			     } else {
+			       ffts.fft0Axis(chunk, dim, True);
+			     }
+			     outChunk.reference(chunk);
+			   });
 	}
       }
     }
+  }
 }
 //
 // ----------------MYRCFFT--------------------------------------
@@ -299,6 +298,7 @@ template <class ComplexType> void LatticeFFT::crfft(
     Lattice<ComplexType>& in,
 		       const Vector<Bool>& whichAxes, const Bool doShift, 
 		       Bool doFast){
+  typedef typename NumericTraits<ComplexType>::ConjugateType RealType;
   const uInt ndim = in.ndim();
   DebugAssert(ndim > 0, AipsError);
   DebugAssert(ndim == whichAxes.nelements(), AipsError);
@@ -314,14 +314,8 @@ template <class ComplexType> void LatticeFFT::crfft(
   outShape(firstAxis) = outShape(firstAxis)*2 - 2;
   if (!outShape.isEqual(out.shape())) outShape(firstAxis) += 1;
   DebugAssert(outShape.isEqual(out.shape()), AipsError);
-//   if (outShape.product() == 1) {
-//     const IPosition origin(ndim, 0);
-//     const Complex val = in.getAt(origin);
-//     out.set(val.re);
-//     return;
-//   }
-  const IPosition tileShape = in.niceCursorShape();
-  FFTServer<typename NumericTraits<ComplexType>::ConjugateType,ComplexType> ffts;
+  FFTServer<RealType,ComplexType> ffts;
+  std::vector<std::unique_ptr<FFTServer<RealType,ComplexType>>> servers;
 
   uInt dim = ndim;
   while (dim != 0) {
@@ -329,46 +323,67 @@ template <class ComplexType> void LatticeFFT::crfft(
     if (whichAxes(dim) == True) {
       if (dim != firstAxis) { // Do complex->complex Transforms
 	if (inShape(dim) != 1) { // no need to do anything unless len > 1
-	  LatticeIterator<ComplexType> iter(in, TiledLineStepper(inShape,
-							     tileShape, dim));
-	  for (iter.reset(); !iter.atEnd(); iter++) {
-	    if (doShift) {
-	      if(doFast){
-		ffts.fft0(iter.rwVectorCursor(), False);
-		ffts.flip(iter.rwVectorCursor(), False, False);
-	      }
-	      else{
-	      //	      ffts.fft(iter.rwVectorCursor(), 2, False);
-	      ffts.fft(iter.rwVectorCursor(),False);
-	      }
-	    } else {
-	      ffts.fft0(iter.rwVectorCursor(), False);
-	    }
+	  if (doShift && doFast) {
+	    // Only the output is flipped, so do it line by line.
+	    transformChunks
+	      (in, in, dim,
+	       [&](Array<ComplexType>& outChunk, Array<ComplexType>& chunk)
+	       {
+		 outChunk.resize(chunk.shape());
+		 transformLines<ComplexType>
+		   (servers, outChunk, chunk, dim,
+		    [](FFTServer<RealType,ComplexType>& server,
+		       Vector<ComplexType>& outLine,
+		       Vector<ComplexType>& inLine)
+		    {
+		      outLine = inLine;
+		      server.fft0(outLine, False);
+		      server.flip(outLine, False, False);
+		    });
+	       });
+	  } else {
+	    transformChunks (in, in, dim,
+			     [&](Array<ComplexType>& outChunk,
+				 Array<ComplexType>& chunk)
+			     {
+			       if (doShift) {
+				 ffts.fftAxis(chunk, dim, False);
+			       } else {
+				 ffts.fft0Axis(chunk, dim, False);
+			       }
+			       outChunk.reference(chunk);
+			     });
 	  }
 	}
       } else { // the first axis is treated specially
 	if (inShape(dim) != 1) { // Do complex->real transforms
-	  RO_LatticeIterator<ComplexType> inIter(in,
-					     TiledLineStepper(inShape,
-							      tileShape, dim));
-	  LatticeIterator<typename NumericTraits<ComplexType>::ConjugateType> outIter(out,
-					 TiledLineStepper(outShape,
-							  tileShape, dim));
-	  for (inIter.reset(), outIter.reset(); 
-	       !inIter.atEnd() && !outIter.atEnd(); inIter++, outIter++) {
-	    if (doShift) {
-	      if(doFast){
-	       ffts.fft0(outIter.woVectorCursor(), inIter.vectorCursor());
-	       ffts.flip(outIter.rwVectorCursor(), False, False);
-	      }else{
-		ffts.fft(outIter.woVectorCursor(), inIter.vectorCursor());
-	      }
-	    } else {
-	      ffts.fft0(outIter.woVectorCursor(), inIter.vectorCursor());
-	    }
-	  }
+	  transformChunks
+	    (out, in, dim,
+	     [&](Array<RealType>& outChunk, Array<ComplexType>& inChunk)
+	     {
+	       IPosition chunkShape = inChunk.shape();
+	       chunkShape(dim) = outShape(dim);
+	       outChunk.resize(chunkShape);
+	       transformLines<ComplexType>
+		 (servers, outChunk, inChunk, dim,
+		  [doShift,doFast](FFTServer<RealType,ComplexType>& server,
+				   Vector<RealType>& outLine,
+				   Vector<ComplexType>& inLine)
+		  {
+		    if (doShift) {
+		      if (doFast) {
+			server.fft0(outLine, inLine);
+			server.flip(outLine, False, False);
+		      } else {
+			server.fft(outLine, inLine);
+		      }
+		    } else {
+		      server.fft0(outLine, inLine);
+		    }
+		  });
+	     });
 	} else { // just copy the data truncating the imaginary parts.
-	  out.copyData(LatticeExpr<typename NumericTraits<ComplexType>::ConjugateType>(real(in)));
+	  out.copyData(LatticeExpr<RealType>(real(in)));
 	}
       }
     }
@@ -391,6 +406,128 @@ template <class ComplexType> void LatticeFFT::crfft(
  inCopy.copyData(in);
  LatticeFFT::crfft(out, inCopy, doShift, doFast);
 }
+template <class InType, class OutType, class Func>
+void LatticeFFT::transformChunks (Lattice<OutType>& out,
+                                  const Lattice<InType>& in,
+                                  uInt axis, Func func)
+{
+  const std::vector<Slicer> chunks = makeChunks (out.shape(),
+                                                 out.niceCursorShape(),
+                                                 axis);
+  const Int64 inLength = in.shape()(axis);
+  std::vector<Slicer> inChunks;
+  inChunks.reserve (chunks.size());
+  for (const Slicer& chunk : chunks) {
+    IPosition length = chunk.length();
+    length(axis) = inLength;
+    inChunks.push_back (Slicer(chunk.start(), length));
+  }
+  transformSlices (out, in, chunks, inChunks, func);
+}
+
+template <class InType, class OutType, class Func>
+void LatticeFFT::transformSlices (Lattice<OutType>& out,
+                                  const Lattice<InType>& in,
+                                  const std::vector<Slicer>& chunks,
+                                  const std::vector<Slicer>& inChunks,
+                                  Func func)
+{
+  // Only read ahead for a lattice on disk.
+  const Bool readAhead = in.isPaged()  &&  chunks.size() > 1;
+  Array<InType> inChunk = in.getSlice (inChunks[0]);
+  for (size_t i=0; i<chunks.size(); ++i) {
+    std::future<Array<InType>> next;
+    if (readAhead  &&  i+1 < chunks.size()) {
+      const Slicer nextSlicer = inChunks[i+1];
+      next = std::async (std::launch::async,
+                         [&in, nextSlicer]() { return in.getSlice (nextSlicer); });
+    }
+    Array<OutType> outChunk;
+    func (outChunk, inChunk);
+    // Wait for the read before writing, so the lattices are not
+    // accessed concurrently.
+    Array<InType> nextChunk;
+    if (next.valid()) {
+      nextChunk.reference (next.get());
+    } else if (i+1 < chunks.size()) {
+      nextChunk.reference (in.getSlice (inChunks[i+1]));
+    }
+    out.putSlice (outChunk, chunks[i].start());
+    inChunk.reference (nextChunk);
+  }
+}
+
+template <class ComplexType, class InType, class OutType, class Func>
+void LatticeFFT::transformLines
+  (std::vector<std::unique_ptr<FFTServer
+     <typename NumericTraits<ComplexType>::ConjugateType,
+      ComplexType>>>& servers,
+   Array<OutType>& out, const Array<InType>& in, uInt axis, Func func)
+{
+  typedef FFTServer<typename NumericTraits<ComplexType>::ConjugateType,
+                    ComplexType> Server;
+  // Lines are accessed directly in the (contiguous) storage.
+  Bool deleteIn, deleteOut;
+  const InType* inData = in.getStorage (deleteIn);
+  OutType* outData = out.getStorage (deleteOut);
+  const IPosition& inShape = in.shape();
+  const Int64 inLength = inShape(axis);
+  const Int64 outLength = out.shape()(axis);
+  Int64 stride = 1;
+  for (uInt i=0; i<axis; ++i) {
+    stride *= inShape(i);
+  }
+  const Int64 nlines = in.nelements() / inLength;
+  uInt nthreads = 1;
+#ifdef _OPENMP
+  nthreads = std::max (1u, std::min (OMP::nMaxThreads(), uInt(nlines/16)));
+#endif
+  while (servers.size() < nthreads) {
+    servers.push_back (std::unique_ptr<Server>(new Server()));
+  }
+  std::vector<std::exception_ptr> errors(nthreads);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+  {
+    uInt thr = 0;
+#ifdef _OPENMP
+    thr = omp_get_thread_num();
+#endif
+    Vector<InType> inLine(inLength);
+    Vector<OutType> outLine(outLength);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (Int64 line=0; line<nlines; ++line) {
+      if (!errors[thr]) {
+        try {
+          const Int64 inner = line % stride;
+          const Int64 outer = line / stride;
+          const InType* inPtr = inData + inner + outer*stride*inLength;
+          OutType* outPtr = outData + inner + outer*stride*outLength;
+          for (Int64 i=0; i<inLength; ++i) {
+            inLine[i] = inPtr[i*stride];
+          }
+          func (*servers[thr], outLine, inLine);
+          for (Int64 i=0; i<outLength; ++i) {
+            outPtr[i*stride] = outLine[i];
+          }
+        } catch (...) {
+          errors[thr] = std::current_exception();
+        }
+      }
+    }
+  }
+  in.freeStorage (inData, deleteIn);
+  out.putStorage (outData, deleteOut);
+  for (const std::exception_ptr& err : errors) {
+    if (err) {
+      std::rethrow_exception (err);
+    }
+  }
+}
+
 // Local Variables: 
 // compile-command: "gmake OPTLIB=1 LatticeFFT"
 // End: 
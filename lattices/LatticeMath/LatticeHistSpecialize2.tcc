@@ -29,6 +29,7 @@
 
 #include <casacore/lattices/LatticeMath/LatticeHistSpecialize.h>
 #include <casacore/lattices/LatticeMath/LattStatsSpecialize.h>
+#include <algorithm>
 
 namespace casacore {
       
@@ -61,34 +62,44 @@ template <class T> void LatticeHistSpecialize::process(
     uInt nrval, uInt nBins,
     uInt dataIncr, uInt maskIncr
 ) {
-   T datum;
-   uInt rBin;
-   uInt index;
-//
-   if (pInMask==0) {
-      for (uInt i=0; i<nrval; i++) {
-         datum = *pInData;
-         if (LattStatsSpecialize::usePixelInc(clip(0), clip(1), datum) > 0.5) {
-            rBin = bin(datum, clip(0), binWidth, nBins);
-            index = rBin + offset;
-            auto& hist = (*pHist)[index];
-            hist += 1.0;
+// The bin indices are calculated for a block of values by a loop
+// without branches, which the compiler can vectorize. Values outside
+// the clip range or masked off get index nBins and are not counted.
+// A value is in the last bin if the division gives nBins-1 or more.
+   const uInt blockSize = 256;
+   uInt indices[blockSize];
+   const T dmin = clip(0);
+   const T dmax = clip(1);
+   const T lastBin = nBins-1;
+   T* hist = pHist->storage() + offset;
+   while (nrval > 0) {
+      const uInt n = std::min(nrval, blockSize);
+      if (pInMask==0) {
+         for (uInt i=0; i<n; i++) {
+            const T datum = pInData[i*dataIncr];
+            const Bool use = datum >= dmin && datum <= dmax;
+            const T rBin = use ? (datum-dmin)/binWidth : T(0);
+            const uInt index = rBin < lastBin ? uInt(rBin) : nBins-1;
+            indices[i] = use ? index : nBins;
+         }
+      } else {
+         for (uInt i=0; i<n; i++) {
+            const T datum = pInData[i*dataIncr];
+            const Bool use = pInMask[i*maskIncr] &&
+                             datum >= dmin && datum <= dmax;
+            const T rBin = use ? (datum-dmin)/binWidth : T(0);
+            const uInt index = rBin < lastBin ? uInt(rBin) : nBins-1;
+            indices[i] = use ? index : nBins;
          }
-         pInData += dataIncr;
+         pInMask += n*maskIncr;
       }
-   } else {
-      for (uInt i=0; i<nrval; i++) {
-         datum = *pInData;
-         if (*pInMask &&
-             (LattStatsSpecialize::usePixelInc(clip(0), clip(1), datum) > 0.5)) {
-            rBin = bin(datum, clip(0), binWidth, nBins);
-            index = rBin + offset;
-            auto& hist = (*pHist)[index];
-            hist += 1.0;
+      for (uInt i=0; i<n; i++) {
+         if (indices[i] < nBins) {
+            hist[indices[i]] += 1.0;
          }
-         pInData += dataIncr;
-         pInMask += maskIncr;
       }
+      pInData += n*dataIncr;
+      nrval -= n;
    }
 }
 
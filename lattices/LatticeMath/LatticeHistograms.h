@@ -37,6 +37,9 @@
 #include <casacore/casa/System/PGPlotter.h>
 #include <casacore/scimath/Mathematics/NumericTraits.h>
 #include <casacore/casa/iosfwd.h>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -420,6 +423,11 @@ private:
 // <src>LatticeApply::tiledApply</src> for digestion.  After it has
 // done its work, <src>LatticeHistograms</src> then accesses the output
 // <src>Lattice</src> that it made.
+// <br>The collapser can be cloned, so <src>tiledApply</src> fills
+// histograms of different tiles in parallel, each thread in its own
+// clone. The histograms of the clones are added when a chunk is done.
+// The clip range of a histogram is obtained from the statistics object
+// once per output position (serialized over the clones).
 // </synopsis>
 //
 // <example>
@@ -492,12 +500,26 @@ public:
 // Can handle null mask
    virtual Bool canHandleNullMask() const {return True;};
 
+// Clone the collapser, so LatticeApply can use it in parallel.
+    virtual TiledCollapser<T,T>* clone() const;
+
+// Add the histograms of a clone to the histograms of this object.
+    virtual void merge (const TiledCollapser<T,T>& other);
+
 private:
+// Get the clip range for the histogram at the given output index.
+    const T* getClip (uInt64 index, const IPosition& startPos);
+
     LatticeStatistics<T>* pStats_p;
     Block<T>* pHist_p;
     uInt nBins_p;
     uInt64 n1_p;
     uInt64 n3_p;
+    // The clip range (min,max) per output index and if it is known.
+    std::vector<T> clip_p;
+    std::vector<Bool> haveClip_p;
+    // Serializes the use of the statistics object by the clones.
+    std::shared_ptr<std::mutex> statsMutex_p;
 };
  
 
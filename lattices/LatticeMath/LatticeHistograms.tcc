@@ -1235,11 +1235,18 @@ void LatticeHistograms<T>::setStream (ostream& os, Int oPrec)
 template <class T>
 HistTiledCollapser<T>::HistTiledCollapser(LatticeStatistics<T>* pStats, uInt nBins)
 : pStats_p(pStats),
-  nBins_p(nBins)
+  pHist_p(0),
+  nBins_p(nBins),
+  n1_p(0),
+  n3_p(0),
+  statsMutex_p(new std::mutex())
 {;}
    
 template <class T>
-HistTiledCollapser<T>::~HistTiledCollapser<T>() {}
+HistTiledCollapser<T>::~HistTiledCollapser<T>()
+{
+   delete pHist_p;
+}
 
 template <class T>
 void HistTiledCollapser<T>::init (uInt nOutPixelsPerCollapse)
@@ -1253,13 +1260,65 @@ void HistTiledCollapser<T>::initAccumulator (uInt64 n1, uInt64 n3)
 // pHist_p contains the histograms for each chunk
 // It is T not uInt so we can handle Complex types
 {
+   delete pHist_p;
    pHist_p = new Block<T>(nBins_p*n1*n3);
    pHist_p->set(0);
 //          
    n1_p = n1;
    n3_p = n3;
+   clip_p.resize (2*n1*n3);
+   haveClip_p.assign (n1*n3, False);
+}
+
+template <class T>
+TiledCollapser<T,T>* HistTiledCollapser<T>::clone() const
+{
+// The clone shares the statistics object and its mutex, but gets its
+// own histograms in initAccumulator.
+   HistTiledCollapser<T>* coll = new HistTiledCollapser<T>(pStats_p, nBins_p);
+   coll->statsMutex_p = statsMutex_p;
+   return coll;
 }
 
+template <class T>
+void HistTiledCollapser<T>::merge (const TiledCollapser<T,T>& other)
+{
+   const HistTiledCollapser<T>& that =
+       dynamic_cast<const HistTiledCollapser<T>&>(other);
+   AlwaysAssert (that.n1_p == n1_p  &&  that.n3_p == n3_p, AipsError);
+   T* hist = pHist_p->storage();
+   const T* thatHist = that.pHist_p->storage();
+   const uInt64 n = nBins_p*n1_p*n3_p;
+   for (uInt64 i=0; i<n; ++i) {
+      hist[i] += thatHist[i];
+   }
+}
+
+template <class T>
+const T* HistTiledCollapser<T>::getClip (uInt64 index,
+                                         const IPosition& startPos)
+{
+// Fish out the min and max for this chunk of the data 
+// from the statistics object
+
+   if (! haveClip_p[index]) {
+      typedef typename NumericTraits<T>::PrecisionType AccumType; 
+      Vector<AccumType> stats;
+      {
+         std::lock_guard<std::mutex> lock(*statsMutex_p);
+         pStats_p->getStats(stats, startPos, True);
+      }
+      ThrowIf(
+		   stats.empty(),
+		   "Failed to compute statistics, if you set a range you have likely excluded all valid pixels"
+      );
+// Assignment from AccumType to T ok (e.g. Double to FLoat)
+      clip_p[2*index]   = stats(LatticeStatsBase::MIN);
+      clip_p[2*index+1] = stats(LatticeStatsBase::MAX);
+      haveClip_p[index] = True;
+   }
+   return &(clip_p[2*index]);
+}
 
 template <class T>
 void HistTiledCollapser<T>::process (
@@ -1272,21 +1331,10 @@ void HistTiledCollapser<T>::process (
 // chunk belongs in one output location in the accumulation
 // lattices
 
-// Fish out the min and max for this chunk of the data 
-// from the statistics object
-
-   typedef typename NumericTraits<T>::PrecisionType AccumType; 
-   Vector<AccumType> stats;
-   pStats_p->getStats(stats, startPos, True);
-   ThrowIf(
-		   stats.empty(),
-		   "Failed to compute statistics, if you set a range you have likely excluded all valid pixels"
-   );
-
-// Assignment from AccumType to T ok (e.g. Double to FLoat)
+   const T* pClip = getClip (index1 + n1_p*index3, startPos);
    Vector<T> clip(2);
-   clip(0) = stats(LatticeStatsBase::MIN);
-   clip(1) = stats(LatticeStatsBase::MAX);
+   clip(0) = pClip[0];
+   clip(1) = pClip[1];
 // Set histogram bin width
    
    const T binWidth = LatticeHistSpecialize::setBinWidth(clip(0), clip(1), nBins_p);
@@ -1333,6 +1381,7 @@ void HistTiledCollapser<T>::endAccumulator(Array<T>& result,
     
     result.putStorage (res, deleteRes);
     delete pHist_p;
+    pHist_p = 0;
 }      
 
 } //# NAMESPACE CASACORE - END
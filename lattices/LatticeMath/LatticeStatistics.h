@@ -401,6 +401,15 @@ public:
            Double zscore=-1, Int maxIterations=-1
    );
 
+   // Compute the quantile-like statistics (median, quartiles, medabsdevmed)
+   // approximately when the stats framework is used, with the given maximum
+   // error in the rank of the values as a fraction of the number of points
+   // (eg 0.001). They are then computed in a single pass per statistic
+   // using a mergeable sketch with bounded memory instead of (possibly
+   // multiple passes of) histogram refinement. The default 0 means that they
+   // are computed exactly. It can be used with all algorithms.
+   Bool configureQuantileError(Double error);
+
    // <group>
    // The force* methods are really only for testing. They in general shouldn't
    // be called in production code. The last one to be called will be the one to
@@ -755,6 +755,16 @@ Bool LatticeStatistics<T>::configureClassical(
     return reconfig;
 }
 
+template <class T>
+Bool LatticeStatistics<T>::configureQuantileError(Double error) {
+    Bool reconfig = ! near(error, _saf.quantileError());
+    if (reconfig) {
+        _saf.setQuantileError(error);
+        needStorageLattice_p = True;
+    }
+    return reconfig;
+}
+
 template <class T>
 Bool LatticeStatistics<T>::configureHingesFences(Double f) {
     Bool reconfig = False;
@@ -0,0 +1,232 @@
+//# LatticeTileStats.h: Persistent statistics per tile of a lattice
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef LATTICES_LATTICETILESTATS_H
+#define LATTICES_LATTICETILESTATS_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/lattices/Lattices/MaskedLattice.h>
+#include <casacore/scimath/StatsFramework/StatisticsTypes.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <memory>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Slicer;
+class Table;
+
+
+// <summary>
+// Persistent statistics per tile of a lattice
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tLatticeTileStats.cc">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=MaskedLattice>MaskedLattice</linkto>
+//   <li> <linkto class=LatticeStatistics>LatticeStatistics</linkto>
+// </prerequisite>
+
+// <synopsis>
+// LatticeTileStats divides a lattice into tiles (by default the tile shape
+// of the lattice) and keeps the partial statistics of each tile:
+// the number of points, sum, sum of squares, mean, variance (times the
+// number of points), minimum and maximum. Optionally a histogram with a
+// fixed binning is kept per tile as well. Masked-off elements are ignored.
+// <p>
+// The statistics of a box aligned with the tile boundaries (thus whose
+// start is a multiple of the tile shape and whose end is the end of a tile
+// or of the lattice) are obtained by combining the statistics of the tiles
+// in it, so without reading any pixel. This is much faster than
+// <linkto class=LatticeStatistics>LatticeStatistics</linkto> for images
+// of which the statistics of many (tile-aligned) regions are needed.
+// <p>
+// The tile statistics can be stored in a subtable of the table holding
+// the lattice (e.g. the table of a PagedImage or PagedArray), so later
+// runs can use them without reading the lattice again.
+// The statistics are updated incrementally. After data in the lattice has
+// been changed, <src>update(section)</src> recomputes the statistics of the
+// tiles overlapping the changed section only. If the lattice has been
+// extended along its last axis (e.g. by appending planes), the statistics
+// restored from the table remain valid for all tiles not changed, so only
+// the new (and the last partial) tiles are computed.
+// <br>It is the responsibility of the user to call <src>update</src> after
+// changing the data, because the class cannot detect such changes.
+// <p>
+// Only real data types (Float and Double) are supported. All statistics
+// are accumulated in Double precision.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   PagedImage<Float> image("my.image");
+//   LatticeTileStats<Float> tileStats(image);
+//   tileStats.save (image.table());
+//   // Get the statistics of the first plane (if tile-aligned).
+//   Slicer plane(IPosition(3,0), IPosition(3,shp[0],shp[1],1));
+//   StatsData<Double> stats = tileStats.statistics (plane);
+//   ...
+//   // A later run only computes tiles of planes added to the image.
+//   LatticeTileStats<Float> tileStats2(image, image.table());
+// </srcblock>
+// </example>
+
+// <motivation>
+// Statistics of large images are often requested repeatedly for the full
+// image and for regions of it, while each request rereads all pixels.
+// </motivation>
+
+template<class T> class LatticeTileStats
+{
+public:
+  // Create the statistics object for the given lattice (which is cloned).
+  // The statistics are kept per tile of the given shape. If empty, the
+  // nice cursor shape of the lattice (usually its tile shape) is used.
+  // No statistics are computed yet.
+  explicit LatticeTileStats (const MaskedLattice<T>& lattice,
+                             const IPosition& tileShape = IPosition());
+
+  // Create the statistics object for the given lattice from the statistics
+  // stored in the subtable with the given name of the table.
+  // If the lattice shape differs from the stored one, only the statistics
+  // of the tiles which have not changed are used (see the synopsis).
+  // An exception is thrown if the subtable does not exist.
+  LatticeTileStats (const MaskedLattice<T>& lattice, const Table& table,
+                    const String& name = "statistics");
+
+  ~LatticeTileStats();
+
+  // Keep a histogram per tile with the given number of bins between the
+  // given minimum and maximum. Values outside this range are not counted.
+  // Setting it (with other values than before) invalidates all tiles.
+  // A number of bins of 0 means no histogram.
+  void setHistogram (uInt nbins, Double minValue, Double maxValue);
+
+  // Get the tile shape used.
+  const IPosition& tileShape() const
+    { return itsTileShape; }
+
+  // Get the number of tiles.
+  uInt nTiles() const
+    { return itsValid.nelements(); }
+
+  // Get the number of tiles computed by the last update.
+  uInt nComputed() const
+    { return itsNComputed; }
+
+  // Compute the statistics of all tiles not computed yet.
+  void update();
+
+  // Recompute the statistics of the tiles overlapping the section,
+  // for instance after the data in the section have been changed.
+  void update (const Slicer& section);
+
+  // Tell if the section is aligned with the tile boundaries.
+  Bool isAligned (const Slicer& section) const;
+
+  // Get the statistics of the full lattice or a section of it by combining
+  // the statistics of the tiles. Tiles not computed yet are computed first.
+  // An exception is thrown if the section is not aligned with the tiles.
+  // If the section does not contain unmasked elements, the min and max
+  // pointers in the result are null.
+  // <group>
+  StatsData<Double> statistics();
+  StatsData<Double> statistics (const Slicer& section);
+  // </group>
+
+  // Get the histogram of the full lattice or a section of it in the same
+  // way as the statistics.
+  // An exception is thrown if no histogram is kept.
+  // <group>
+  Vector<Int64> histogram();
+  Vector<Int64> histogram (const Slicer& section);
+  // </group>
+
+  // Store the statistics in a subtable with the given name of the table,
+  // which is the table containing the lattice. A keyword with that name
+  // refers to the subtable. An existing subtable is replaced.
+  // Tiles not computed yet are computed first.
+  void save (Table& table, const String& name = "statistics");
+
+private:
+  // Initialize for the shape of the lattice.
+  void init();
+
+  // Get the slicer of the given tile.
+  Slicer tileSlicer (uInt tile) const;
+
+  // Get the first and last tile (on each axis) of an aligned section.
+  void tileRange (IPosition& blc, IPosition& trc,
+                  const Slicer& section) const;
+
+  // Compute the statistics of the given tile.
+  void computeTile (uInt tile);
+
+  // Step to the next tile position in the range (first axis fastest).
+  // It returns False if the end of the range has been reached.
+  static Bool nextTile (IPosition& pos, const IPosition& blc,
+                        const IPosition& trc);
+
+  // Mark the tiles overlapping the (inclusive) element range as invalid.
+  void invalidate (const IPosition& start, const IPosition& end);
+
+
+  std::unique_ptr<MaskedLattice<T> > itsLattice;
+  IPosition      itsShape;
+  IPosition      itsTileShape;
+  IPosition      itsNTiles;
+  uInt           itsNComputed;
+  Vector<Bool>   itsValid;
+  Vector<Double> itsNpts;
+  Vector<Double> itsSum;
+  Vector<Double> itsSumsq;
+  Vector<Double> itsMean;
+  Vector<Double> itsNvariance;
+  Vector<Double> itsMin;
+  Vector<Double> itsMax;
+  uInt           itsNBins;
+  Double         itsHistMin;
+  Double         itsHistMax;
+  // The histogram of each tile is a column in the matrix.
+  Matrix<Int64>  itsHist;
+};
+
+
+
+} //# NAMESPACE CASACORE - END
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/lattices/LatticeMath/LatticeTileStats.tcc>
+#endif //# CASACORE_NO_AUTO_TEMPLATES
+#endif
@@ -0,0 +1,437 @@
+//# LatticeTileStats.tcc: Persistent statistics per tile of a lattice
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef LATTICES_LATTICETILESTATS_TCC
+#define LATTICES_LATTICETILESTATS_TCC
+
+#include <casacore/lattices/LatticeMath/LatticeTileStats.h>
+#include <casacore/scimath/StatsFramework/StatisticsUtilities.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+template<class T>
+LatticeTileStats<T>::LatticeTileStats (const MaskedLattice<T>& lattice,
+                                       const IPosition& tileShape)
+: itsLattice   (lattice.cloneML()),
+  itsTileShape (tileShape),
+  itsNComputed (0),
+  itsNBins     (0),
+  itsHistMin   (0),
+  itsHistMax   (0)
+{
+  if (itsTileShape.empty()) {
+    itsTileShape = itsLattice->niceCursorShape();
+  }
+  init();
+}
+
+template<class T>
+LatticeTileStats<T>::LatticeTileStats (const MaskedLattice<T>& lattice,
+                                       const Table& table,
+                                       const String& name)
+: itsLattice   (lattice.cloneML()),
+  itsNComputed (0),
+  itsNBins     (0),
+  itsHistMin   (0),
+  itsHistMax   (0)
+{
+  if (! table.keywordSet().isDefined (name)) {
+    throw AipsError ("LatticeTileStats: table " + table.tableName() +
+                     " has no statistics subtable " + name);
+  }
+  Table tab (table.keywordSet().asTable (name));
+  const TableRecord& keys = tab.keywordSet();
+  IPosition oldShape (keys.asArrayInt ("SHAPE"));
+  itsTileShape = IPosition (keys.asArrayInt ("TILESHAPE"));
+  itsNBins   = keys.asuInt ("HISTNBINS");
+  itsHistMin = keys.asDouble ("HISTMIN");
+  itsHistMax = keys.asDouble ("HISTMAX");
+  init();
+  // The stored statistics can only be used if the lattice has the same
+  // shape or is extended along the last axis only. In that case the tile
+  // numbers are the same, because the last axis varies slowest.
+  uInt nd = itsShape.size();
+  if (oldShape.size() != nd  ||  itsTileShape.size() != nd  ||
+      (nd > 0  &&  (oldShape.getFirst(nd-1) != itsShape.getFirst(nd-1)  ||
+                    oldShape[nd-1] > itsShape[nd-1]))) {
+    return;
+  }
+  uInt nrow = std::min (uInt(tab.nrow()), nTiles());
+  ScalarColumn<Bool>   validCol (tab, "VALID");
+  ScalarColumn<Double> nptsCol  (tab, "NPTS");
+  ScalarColumn<Double> sumCol   (tab, "SUM");
+  ScalarColumn<Double> sumsqCol (tab, "SUMSQ");
+  ScalarColumn<Double> meanCol  (tab, "MEAN");
+  ScalarColumn<Double> nvarCol  (tab, "NVARIANCE");
+  ScalarColumn<Double> minCol   (tab, "MIN");
+  ScalarColumn<Double> maxCol   (tab, "MAX");
+  ArrayColumn<Int64>   histCol;
+  if (itsNBins > 0) {
+    histCol.attach (tab, "HISTOGRAM");
+  }
+  ssize_t tileLen = itsTileShape[nd-1];
+  for (uInt i=0; i<nrow; ++i) {
+    // A tile is only unchanged if its extent on the last axis is the same.
+    ssize_t tileEnd = (toIPositionInArray(i, itsNTiles)[nd-1] + 1) * tileLen;
+    if (std::min(tileEnd, oldShape[nd-1]) == std::min(tileEnd, itsShape[nd-1])
+        &&  validCol(i)) {
+      itsValid[i]     = True;
+      itsNpts[i]      = nptsCol(i);
+      itsSum[i]       = sumCol(i);
+      itsSumsq[i]     = sumsqCol(i);
+      itsMean[i]      = meanCol(i);
+      itsNvariance[i] = nvarCol(i);
+      itsMin[i]       = minCol(i);
+      itsMax[i]       = maxCol(i);
+      if (itsNBins > 0) {
+        Vector<Int64> hist(itsHist.column(i));
+        histCol.get (i, hist);
+      }
+    }
+  }
+}
+
+template<class T>
+LatticeTileStats<T>::~LatticeTileStats()
+{}
+
+template<class T>
+void LatticeTileStats<T>::init()
+{
+  itsShape = itsLattice->shape();
+  if (itsTileShape.size() != itsShape.size()  ||  itsTileShape.product() <= 0) {
+    throw AipsError ("LatticeTileStats: tile shape " +
+                     itsTileShape.toString() +
+                     " does not match lattice shape " + itsShape.toString());
+  }
+  itsNTiles = (itsShape + itsTileShape - 1) / itsTileShape;
+  uInt ntiles = itsNTiles.product();
+  itsValid.resize (ntiles);
+  itsValid = False;
+  itsNpts.resize (ntiles);
+  itsSum.resize (ntiles);
+  itsSumsq.resize (ntiles);
+  itsMean.resize (ntiles);
+  itsNvariance.resize (ntiles);
+  itsMin.resize (ntiles);
+  itsMax.resize (ntiles);
+  itsHist.resize (itsNBins, ntiles);
+  itsHist = 0;
+}
+
+template<class T>
+void LatticeTileStats<T>::setHistogram (uInt nbins,
+                                        Double minValue, Double maxValue)
+{
+  if (nbins > 0  &&  maxValue <= minValue) {
+    throw AipsError ("LatticeTileStats::setHistogram - "
+                     "maximum must exceed minimum");
+  }
+  if (nbins != itsNBins  ||
+      (nbins > 0  &&  (minValue != itsHistMin  ||  maxValue != itsHistMax))) {
+    itsNBins   = nbins;
+    itsHistMin = minValue;
+    itsHistMax = maxValue;
+    itsHist.resize (itsNBins, nTiles());
+    itsHist  = 0;
+    itsValid = False;
+  }
+}
+
+template<class T>
+Slicer LatticeTileStats<T>::tileSlicer (uInt tile) const
+{
+  IPosition start = toIPositionInArray (tile, itsNTiles) * itsTileShape;
+  IPosition end   = start + itsTileShape - 1;
+  for (uInt i=0; i<end.size(); ++i) {
+    if (end[i] >= itsShape[i]) {
+      end[i] = itsShape[i] - 1;
+    }
+  }
+  return Slicer (start, end, Slicer::endIsLast);
+}
+
+template<class T>
+void LatticeTileStats<T>::computeTile (uInt tile)
+{
+  Slicer section = tileSlicer (tile);
+  Array<T> data = itsLattice->getSlice (section);
+  Array<Bool> mask;
+  if (itsLattice->isMasked()) {
+    mask = itsLattice->getMaskSlice (section);
+  }
+  Bool deleteData, deleteMask;
+  const T* dataPtr = data.getStorage (deleteData);
+  const Bool* maskPtr = mask.empty() ? 0 : mask.getStorage (deleteMask);
+  size_t n = data.nelements();
+  // Use two passes to calculate the variance accurately.
+  Double npts = 0;
+  Double sum  = 0;
+  Double sumsq = 0;
+  Double minv = 0;
+  Double maxv = 0;
+  for (size_t i=0; i<n; ++i) {
+    if (maskPtr == 0  ||  maskPtr[i]) {
+      Double v = dataPtr[i];
+      if (npts == 0) {
+        minv = maxv = v;
+      } else if (v < minv) {
+        minv = v;
+      } else if (v > maxv) {
+        maxv = v;
+      }
+      npts  += 1;
+      sum   += v;
+      sumsq += v*v;
+    }
+  }
+  Double mean = npts == 0 ? 0 : sum/npts;
+  Double nvariance = 0;
+  Int64* hist = itsNBins == 0 ? 0 : itsHist.data() + size_t(tile)*itsNBins;
+  if (hist) {
+    std::fill (hist, hist+itsNBins, Int64(0));
+  }
+  Double binWidth = (itsHistMax - itsHistMin) / std::max(itsNBins, 1u);
+  for (size_t i=0; i<n; ++i) {
+    if (maskPtr == 0  ||  maskPtr[i]) {
+      Double v = dataPtr[i];
+      nvariance += (v-mean) * (v-mean);
+      if (hist  &&  v >= itsHistMin  &&  v <= itsHistMax) {
+        uInt bin = std::min (uInt((v - itsHistMin) / binWidth), itsNBins-1);
+        hist[bin]++;
+      }
+    }
+  }
+  data.freeStorage (dataPtr, deleteData);
+  if (maskPtr) {
+    mask.freeStorage (maskPtr, deleteMask);
+  }
+  itsNpts[tile]      = npts;
+  itsSum[tile]       = sum;
+  itsSumsq[tile]     = sumsq;
+  itsMean[tile]      = mean;
+  itsNvariance[tile] = nvariance;
+  itsMin[tile]       = minv;
+  itsMax[tile]       = maxv;
+  itsValid[tile]     = True;
+}
+
+template<class T>
+void LatticeTileStats<T>::update()
+{
+  itsNComputed = 0;
+  for (uInt i=0; i<nTiles(); ++i) {
+    if (! itsValid[i]) {
+      computeTile (i);
+      itsNComputed++;
+    }
+  }
+}
+
+template<class T>
+void LatticeTileStats<T>::update (const Slicer& section)
+{
+  IPosition start, end, stride;
+  section.inferShapeFromSource (itsShape, start, end, stride);
+  invalidate (start, end);
+  update();
+}
+
+template<class T>
+void LatticeTileStats<T>::invalidate (const IPosition& start,
+                                      const IPosition& end)
+{
+  IPosition blc = start / itsTileShape;
+  IPosition trc = end / itsTileShape;
+  IPosition pos (blc);
+  do {
+    itsValid[toOffsetInArray (pos, itsNTiles)] = False;
+  } while (nextTile (pos, blc, trc));
+}
+
+template<class T>
+Bool LatticeTileStats<T>::nextTile (IPosition& pos, const IPosition& blc,
+                                    const IPosition& trc)
+{
+  for (uInt ax=0; ax<pos.size(); ++ax) {
+    if (++pos[ax] <= trc[ax]) {
+      return True;
+    }
+    pos[ax] = blc[ax];
+  }
+  return False;
+}
+
+template<class T>
+Bool LatticeTileStats<T>::isAligned (const Slicer& section) const
+{
+  IPosition start, end, stride;
+  section.inferShapeFromSource (itsShape, start, end, stride);
+  for (uInt i=0; i<start.size(); ++i) {
+    if (stride[i] != 1  ||  start[i] % itsTileShape[i] != 0  ||
+        ((end[i] + 1) % itsTileShape[i] != 0  &&  end[i] + 1 != itsShape[i])) {
+      return False;
+    }
+  }
+  return True;
+}
+
+template<class T>
+void LatticeTileStats<T>::tileRange (IPosition& blc, IPosition& trc,
+                                     const Slicer& section) const
+{
+  if (! isAligned (section)) {
+    throw AipsError ("LatticeTileStats: section " + section.start().toString()
+                     + " - " + section.end().toString() +
+                     " is not aligned with tiles " + itsTileShape.toString());
+  }
+  IPosition start, end, stride;
+  section.inferShapeFromSource (itsShape, start, end, stride);
+  blc = start / itsTileShape;
+  trc = end / itsTileShape;
+}
+
+template<class T>
+StatsData<Double> LatticeTileStats<T>::statistics()
+{
+  return statistics (Slicer (IPosition(itsShape.size(), 0), itsShape));
+}
+
+template<class T>
+StatsData<Double> LatticeTileStats<T>::statistics (const Slicer& section)
+{
+  IPosition blc, trc;
+  tileRange (blc, trc, section);
+  update();
+  std::vector<StatsData<Double> > tileStats;
+  IPosition pos (blc);
+  do {
+    uInt tile = toOffsetInArray (pos, itsNTiles);
+    if (itsNpts[tile] > 0) {
+      StatsData<Double> stats = initializeStatsData<Double>();
+      stats.masked     = itsLattice->isMasked();
+      stats.npts       = itsNpts[tile];
+      stats.sum        = itsSum[tile];
+      stats.sumsq      = itsSumsq[tile];
+      stats.mean       = itsMean[tile];
+      stats.nvariance  = itsNvariance[tile];
+      stats.sumweights = itsNpts[tile];
+      stats.min.reset (new Double(itsMin[tile]));
+      stats.max.reset (new Double(itsMax[tile]));
+      tileStats.push_back (stats);
+    }
+  } while (nextTile (pos, blc, trc));
+  return StatisticsUtilities<Double>::combine (tileStats);
+}
+
+template<class T>
+Vector<Int64> LatticeTileStats<T>::histogram()
+{
+  return histogram (Slicer (IPosition(itsShape.size(), 0), itsShape));
+}
+
+template<class T>
+Vector<Int64> LatticeTileStats<T>::histogram (const Slicer& section)
+{
+  if (itsNBins == 0) {
+    throw AipsError ("LatticeTileStats::histogram - no histogram is kept");
+  }
+  IPosition blc, trc;
+  tileRange (blc, trc, section);
+  update();
+  Vector<Int64> hist (itsNBins, 0);
+  IPosition pos (blc);
+  do {
+    hist += itsHist.column (toOffsetInArray (pos, itsNTiles));
+  } while (nextTile (pos, blc, trc));
+  return hist;
+}
+
+template<class T>
+void LatticeTileStats<T>::save (Table& table, const String& name)
+{
+  update();
+  table.reopenRW();
+  // Remove an existing subtable; it is deleted when the keyword is removed.
+  if (table.keywordSet().isDefined (name)) {
+    Table old (table.keywordSet().asTable (name));
+    old.markForDelete();
+    table.rwKeywordSet().removeField (name);
+  }
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Bool>   ("VALID"));
+  td.addColumn (ScalarColumnDesc<Double> ("NPTS"));
+  td.addColumn (ScalarColumnDesc<Double> ("SUM"));
+  td.addColumn (ScalarColumnDesc<Double> ("SUMSQ"));
+  td.addColumn (ScalarColumnDesc<Double> ("MEAN"));
+  td.addColumn (ScalarColumnDesc<Double> ("NVARIANCE"));
+  td.addColumn (ScalarColumnDesc<Double> ("MIN"));
+  td.addColumn (ScalarColumnDesc<Double> ("MAX"));
+  if (itsNBins > 0) {
+    td.addColumn (ArrayColumnDesc<Int64> ("HISTOGRAM",
+                                          IPosition(1, itsNBins),
+                                          ColumnDesc::FixedShape));
+  }
+  SetupNewTable newtab (table.tableName() + "/" + name, td, Table::New);
+  Table tab (newtab, nTiles());
+  TableRecord& keys = tab.rwKeywordSet();
+  keys.define ("SHAPE", itsShape.asVector());
+  keys.define ("TILESHAPE", itsTileShape.asVector());
+  keys.define ("HISTNBINS", itsNBins);
+  keys.define ("HISTMIN", itsHistMin);
+  keys.define ("HISTMAX", itsHistMax);
+  ScalarColumn<Bool>(tab, "VALID").putColumn (itsValid);
+  ScalarColumn<Double>(tab, "NPTS").putColumn (itsNpts);
+  ScalarColumn<Double>(tab, "SUM").putColumn (itsSum);
+  ScalarColumn<Double>(tab, "SUMSQ").putColumn (itsSumsq);
+  ScalarColumn<Double>(tab, "MEAN").putColumn (itsMean);
+  ScalarColumn<Double>(tab, "NVARIANCE").putColumn (itsNvariance);
+  ScalarColumn<Double>(tab, "MIN").putColumn (itsMin);
+  ScalarColumn<Double>(tab, "MAX").putColumn (itsMax);
+  if (itsNBins > 0) {
+    ArrayColumn<Int64>(tab, "HISTOGRAM").putColumn (itsHist);
+  }
+  tab.flush();
+  table.rwKeywordSet().defineTable (name, tab);
+}
+
+
+} //# NAMESPACE CASACORE - END
+
+
+#endif
@@ -62,6 +62,17 @@ class String;
 // The structure function is
 // <src>S(x,y) = < [lat(i,j) - lat(i+x,j+y)]**2 ></src>
 // where x and y are absolute integer shifts (or lags).
+//
+// By default the structure function is calculated using FFTs. Writing
+// the square as <src>d1**2 + d2**2 - 2*d1*d2</src>, all terms are
+// (cross) correlations of the data, squared data and mask, which are
+// calculated by multiplication in the Fourier domain. Masked off pixels
+// get weight 0, so the number of pixel pairs per lag is the
+// autocorrelation of the mask. This takes O(N log N) instead of the
+// O(N**2) of the direct summation over all pixel pairs, which can still
+// be used for small planes. The FFTs are done in double precision on
+// planes padded to about twice the input size in each dimension, so it
+// needs about 32 times the memory of an input plane of Floats.
 // </synopsis>
 // <example>
 // <srcblock>
@@ -104,10 +115,12 @@ enum Method {
 // If the output lattice has a mask, it will first be set to False (bad)
 // and then any output pixel with some contributing values will be set to
 // True (good).
+// If <src>useFFT=False</src>, the function is calculated by direct
+// summation over all pixel pairs.
 // <group>
    void autoCorrelation (MaskedLattice<T>& out, const MaskedLattice<T>& in,
                          const IPosition& axes, Method method,
-                         Bool showProgress=True) const;
+                         Bool showProgress=True, Bool useFFT=True) const;
 // </group>
 
 // Helper function to provide output lattice shape give the input shape
@@ -130,6 +143,15 @@ private:
                          FuncPtr,                
                          Bool showProgress) const;
 
+// Compute the structure function using FFTs.
+   void structureFunctionFFT (MaskedLattice<T>& out,
+                              const MaskedLattice<T>& in,
+                              const IPosition& axes,
+                              Bool showProgress) const;
+
+// Get the smallest FFT size >= n with only factors 2, 3 and 5.
+   static Int fftSize (Int n);
+
 // Check Output lattice shape
    void check (LogIO& os, const MaskedLattice<T>& latOut,
                const MaskedLattice<T>& latIn,
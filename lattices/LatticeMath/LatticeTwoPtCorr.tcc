@@ -42,6 +42,8 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/scimath/Mathematics/FFTServer.h>
+#include <casacore/casa/BasicSL/Complex.h>
 
 /*
 #include <casacore/casa/Arrays/ArrayIO.h>
@@ -55,10 +57,16 @@ void LatticeTwoPtCorr<T>::autoCorrelation (MaskedLattice<T>& latOut,
                                            const MaskedLattice<T>& latIn,
                                            const IPosition& axes, 
                                            Method method,
-                                           Bool showProgress) const
+                                           Bool showProgress,
+                                           Bool useFFT) const
 { 
    LogIO os(LogOrigin("LatticeTwoPtCorr", "autoCorrelation(...)", WHERE));
 
+   if (useFFT  &&  method==STRUCTUREFUNCTION) {
+      structureFunctionFFT (latOut, latIn, axes, showProgress);
+      return;
+   }
+
 // Set up function pointer
 
    FuncPtr funcPtr=0;
@@ -305,6 +313,160 @@ void LatticeTwoPtCorr<T>::autoCorrelation  (MaskedLattice<T>& latOut,
 
 
 
+template <class T> 
+void LatticeTwoPtCorr<T>::structureFunctionFFT (MaskedLattice<T>& latOut, 
+                                                const MaskedLattice<T>& latIn,
+                                                const IPosition& axes, 
+                                                Bool showProgress) const
+{ 
+   LogIO os(LogOrigin("LatticeTwoPtCorr", "structureFunctionFFT(...)", WHERE));
+   check (os, latOut, latIn, axes);
+//
+   IPosition shapeIn = latIn.shape();
+   IPosition shapeOut = latOut.shape();
+   uInt nDim = shapeIn.nelements();
+   IPosition axisPath = IPosition::makeAxisPath (nDim, axes);
+   Int nxIn = shapeIn(axes(0));
+   Int nyIn = shapeIn(axes(1));
+   LatticeStepper stepIn(shapeIn, IPosition(2, nxIn, nyIn), axes, axisPath);
+   RO_MaskedLatticeIterator<T> itIn(latIn, stepIn);
+   Bool inIsMasked = latIn.isMasked();
+//
+   Int nxOut = shapeOut(axes(0));
+   Int nyOut = shapeOut(axes(1));
+   LatticeStepper stepOut(shapeOut, IPosition(2, nxOut, nyOut), axes, axisPath);
+   LatticeIterator<T> itOut(latOut, stepOut);
+   Bool outIsMasked = latOut.hasPixelMask() && latOut.pixelMask().isWritable();
+   LatticeIterator<Bool>* itOutMaskPtr = 0;
+   if (outIsMasked) {
+      itOutMaskPtr = new LatticeIterator<Bool>(latOut.pixelMask(), stepOut);
+   }
+
+// The planes are zero padded to at least the output size, so the
+// circular correlations do not wrap around.
+
+   Int nxFFT = fftSize (nxOut);
+   Int nyFFT = fftSize (nyOut);
+   Int lxOff = (nxOut-1) / 2; 
+   Int lyOff = (nyOut-1) / 2;
+   FFTServer<Double,DComplex> server;
+   Matrix<Double> plane(nxFFT, nyFFT);
+   Matrix<Double> weight(nxIn, nyIn);
+   Matrix<Double> data(nxIn, nyIn);
+   Array<DComplex> wFFT, dFFT, aFFT;
+   Matrix<Bool> maskOut(nxOut, nyOut);
+//
+   for (itIn.reset(),itOut.reset(); !itIn.atEnd(); itIn++,itOut++) {
+     if (showProgress) {
+        os << LogIO::NORMAL << "Processing position " << itIn.position() << LogIO::POST;
+     }
+     const Matrix<T>& dataIn(itIn.matrixCursor());
+
+// Get the weights and the weighted data. The structure function does not
+// change by subtracting a constant, so the mean is subtracted to reduce
+// the rounding errors of the FFTs.
+
+     if (inIsMasked) {
+        const Matrix<Bool>& maskIn(itIn.getMask(True));
+        for (Int j=0; j<nyIn; ++j) {
+           for (Int i=0; i<nxIn; ++i) {
+              weight(i,j) = maskIn(i,j) ? 1.0 : 0.0;
+           }
+        }
+     } else {
+        weight = 1.0;
+     }
+     Double sumw = 0;
+     Double sumd = 0;
+     for (Int j=0; j<nyIn; ++j) {
+        for (Int i=0; i<nxIn; ++i) {
+           data(i,j) = weight(i,j) * Double(dataIn(i,j));
+           sumw += weight(i,j);
+           sumd += data(i,j);
+        }
+     }
+     Double mean = (sumw > 0  ?  sumd / sumw : 0);
+
+// Transform the weights (w), weighted data (w*d) and weighted squared
+// data (w*d*d).
+
+     plane = 0.0;
+     plane(IPosition(2,0,0), IPosition(2,nxIn-1,nyIn-1)) = weight;
+     server.fft0 (wFFT, plane, False);
+     plane = 0.0;
+     for (Int j=0; j<nyIn; ++j) {
+        for (Int i=0; i<nxIn; ++i) {
+           data(i,j) -= weight(i,j) * mean;
+           plane(i,j) = data(i,j);
+        }
+     }
+     server.fft0 (dFFT, plane, False);
+     plane = 0.0;
+     for (Int j=0; j<nyIn; ++j) {
+        for (Int i=0; i<nxIn; ++i) {
+           plane(i,j) = weight(i,j) * data(i,j) * data(i,j);
+        }
+     }
+     server.fft0 (aFFT, plane, False);
+
+// sum(w1*w2*(d1-d2)**2) = corr(w*d*d,w) + corr(w,w*d*d) - 2*corr(w*d,w*d).
+// The number of pixel pairs is corr(w,w).
+
+     typename Array<DComplex>::iterator wIter = wFFT.begin();
+     typename Array<DComplex>::iterator dIter = dFFT.begin();
+     typename Array<DComplex>::iterator aIter = aFFT.begin();
+     typename Array<DComplex>::iterator aEnd = aFFT.end();
+     for (; aIter!=aEnd; ++aIter,++wIter,++dIter) {
+        Double cross = aIter->real()*wIter->real() + aIter->imag()*wIter->imag();
+        *aIter = DComplex(2*cross - 2*norm(*dIter), 0);
+        *wIter = DComplex(norm(*wIter), 0);
+     }
+     dFFT.resize();
+     Matrix<Double>& sum = plane;
+     Matrix<Double> nPts(nxFFT, nyFFT);
+     server.fft0 (sum, aFFT, False);
+     server.fft0 (nPts, wFFT, False);
+
+// Lag (lx,ly) is at position (lx,ly) modulo the FFT size.
+
+     Matrix<T> out(itOut.rwMatrixCursor());
+     for (Int ly=-lyOff; ly<=lyOff; ++ly) {
+        Int iy = ly<0 ? ly+nyFFT : ly;
+        for (Int lx=-lxOff; lx<=lxOff; ++lx) {
+           Int ix = lx<0 ? lx+nxFFT : lx;
+           Double n = nPts(ix, iy);
+           Bool good = n > 0.5;
+           maskOut(lx+lxOff, ly+lyOff) = good;
+           if (good) {
+              // Rounding errors can make a zero sum slightly negative.
+              out(lx+lxOff, ly+lyOff) = max(0.0, sum(ix, iy)) / floor(n+0.5);
+           }
+        }
+     }
+     if (itOutMaskPtr) {
+        itOutMaskPtr->rwMatrixCursor() = maskOut;
+        (*itOutMaskPtr)++;
+     }
+  }
+  if (itOutMaskPtr) delete itOutMaskPtr;
+}
+
+template <class T>
+Int LatticeTwoPtCorr<T>::fftSize (Int n)
+{
+   for (Int size=max(n,1); ; ++size) {
+      Int rest = size;
+      for (Int factor=2; factor<=5; ++factor) {
+         while (rest % factor == 0) {
+            rest /= factor;
+         }
+      }
+      if (rest == 1) {
+         return size;
+      }
+   }
+}
+
 template <class T>
 void LatticeTwoPtCorr<T>::check (LogIO& os, const MaskedLattice<T>& latOut,   
                                  const MaskedLattice<T>& latIn,
@@ -35,6 +35,8 @@
 namespace casacore {
 
 // Data provider which allows stats framework to iterate through a masked lattice.
+// When iterating, chunks known to be fully masked (see
+// MaskedLattice::isMaskedOut) are skipped without reading them.
 
 template <class T> class MaskedLatticeStatsDataProvider
 	: public LatticeStatsDataProviderBase<T> {
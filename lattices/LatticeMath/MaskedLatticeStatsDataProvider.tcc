@@ -56,6 +56,7 @@ void MaskedLatticeStatsDataProvider<T>::operator++() {
     }
     else {
         ++(*_iter);
+        _iter->skipMaskedOut();
     }
     this->_updateProgress();
 }
@@ -142,6 +143,7 @@ void MaskedLatticeStatsDataProvider<T>::reset() {
     LatticeStatsDataProviderBase<T>::reset();
     if (_iter) {
         _iter->reset();
+        _iter->skipMaskedOut();
     }
 }
 
@@ -157,6 +159,7 @@ void MaskedLatticeStatsDataProvider<T>::setLattice(
             )
         );
         _iter = std::make_shared<RO_MaskedLatticeIterator<T>>(lattice, stepper);
+        _iter->skipMaskedOut();
     }
     else {
         _iter = NULL;
@@ -195,6 +195,7 @@ private:
   Int computeRHS();
   Int solveMatrixEqn(Int scale);
   Int computePenaltyFunction(Int scale, Float &loopgain, Bool choosespec);
+  Bool computePenaltyArrays(Int scale, Float &loopgain, Bool choosespec);
   Int updateSolution(IPosition globalmaxpos, Int maxscaleindex, Float loopgain);
   Int checkConvergence(Bool choosespec, Float thresh, Float fluxlimit); 
   
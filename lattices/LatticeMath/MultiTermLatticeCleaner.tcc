@@ -28,6 +28,8 @@
 
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayMathKernels.h>
+#include <casacore/casa/Utilities/COWPtr.h>
 
 #include <casacore/casa/Logging/LogIO.h>
 #include <casacore/casa/OS/File.h>
@@ -633,18 +635,8 @@ Int MultiTermLatticeCleaner<T>::addTo(Lattice<Float>& to, const Lattice<Float>&
 {
 	// Check the lattice is writable.
 	// Check the shape conformance.
-	AlwaysAssert (to.isWritable(), AipsError);
-	const IPosition shapeIn  = add.shape();
-	const IPosition shapeOut = to.shape();
-	AlwaysAssert (shapeIn.isEqual (shapeOut), AipsError);
-	IPosition cursorShape = to.niceCursorShape();
-	LatticeStepper stepper (shapeOut, cursorShape, LatticeStepper::RESIZE);
-	LatticeIterator<Float> toIter(to, stepper);
-	RO_LatticeIterator<Float> addIter(add, stepper);
-	for (addIter.reset(), toIter.reset(); !addIter.atEnd();addIter++, toIter++) 
-	{
-		toIter.rwCursor()+=addIter.cursor()*multiplier;
-	}
+	// It updates lattices in memory in parallel.
+	LatticeCleaner<Float>::addScaled(to, add, multiplier);
 	return 0;
 }
 
@@ -1026,6 +1018,9 @@ Int MultiTermLatticeCleaner<T>::solveMatrixEqn(Int scale)
 template <class T>
 Int MultiTermLatticeCleaner<T>::computePenaltyFunction(Int scale, Float &loopgain, Bool choosespec)
 {
+	if (computePenaltyArrays(scale,loopgain,choosespec)) {
+		return 0;
+	}
 	tWork_p->set(0.0);
 	
 	for(Int i=0;i<(Int)itermatCoeffs_p.nelements();i++) itermatCoeffs_p[i]->reset();
@@ -1059,6 +1054,79 @@ Int MultiTermLatticeCleaner<T>::computePenaltyFunction(Int scale, Float &loopgai
 	return 0;
 }/* end of computePenaltyFunction() */
 
+/***************************************
+ *  Compute the penalty function directly on the arrays of the
+ *  lattices if they are all in memory, using multiple threads.
+ *  It returns False if the lattices are not in memory.
+ ****************************************/
+template <class T>
+Bool MultiTermLatticeCleaner<T>::computePenaltyArrays(Int scale, Float &loopgain, Bool choosespec)
+{
+	if (tWork_p->isPaged()) return False;
+	for(Int i=0;i<(Int)matCoeffs_p.nelements();i++) if (matCoeffs_p[i]->isPaged()) return False;
+	for(Int i=0;i<(Int)cubeA_p.nelements();i++) if (cubeA_p[i]->isPaged()) return False;
+	for(Int i=0;i<(Int)matR_p.nelements();i++) if (matR_p[i]->isPaged()) return False;
+	
+	Array<Float> work;
+	Bool isRef = tWork_p->get(work);
+	if (!work.contiguousStorage()) return False;
+	// Get the data pointers of the arrays used.
+	std::vector<COWPtr<Array<Float>>> arrays;
+	std::vector<const Float*> coeffs(ntaylor_p), resids(ntaylor_p);
+	std::vector<const Float*> cubes(ntaylor_p*ntaylor_p);
+	arrays.reserve(2*ntaylor_p + ntaylor_p*ntaylor_p);
+	for(Int taylor1=0;taylor1<ntaylor_p;taylor1++)
+	{
+		arrays.push_back(COWPtr<Array<Float>>());
+		matCoeffs_p[IND2(taylor1,scale)]->get(arrays.back());
+		coeffs[taylor1] = arrays.back()->data();
+		arrays.push_back(COWPtr<Array<Float>>());
+		matR_p[IND2(taylor1,scale)]->get(arrays.back());
+		resids[taylor1] = arrays.back()->data();
+		for(Int taylor2=0;taylor2<ntaylor_p;taylor2++)
+		{
+			arrays.push_back(COWPtr<Array<Float>>());
+			cubeA_p[IND4(taylor1,taylor2,scale,scale)]->get(arrays.back());
+			cubes[taylor1*ntaylor_p+taylor2] = arrays.back()->data();
+		}
+	}
+	for(const COWPtr<Array<Float>>& arr : arrays) if (!arr->contiguousStorage()) return False;
+	
+	Float norm = 0;
+	if(!choosespec)
+	{
+		if(loopgain > 0.5) loopgain*=0.5;
+		norm = sqrt((1.0/(*matA_p[scale])(0,0)));
+	}
+	Float* workPtr = work.data();
+	const Int ntaylor = ntaylor_p;
+	size_t n = work.nelements();
+	arrays_internal::parallelChunks
+	  (n, arrays_internal::parallelNChunk(n), [&](size_t, size_t st, size_t nr)
+	   {
+		   for (size_t i=st; i<st+nr; ++i)
+		   {
+			   Float val = 0;
+			   if(choosespec)
+			   {
+				   for(Int taylor1=0;taylor1<ntaylor;taylor1++)
+				   {
+					   val += (Float)2.0*coeffs[taylor1][i]*resids[taylor1][i];
+					   for(Int taylor2=0;taylor2<ntaylor;taylor2++)
+						   val -= coeffs[taylor1][i]*coeffs[taylor2][i]*cubes[taylor1*ntaylor+taylor2][i];
+				   }
+			   }
+			   else
+			   {
+				   val += norm*resids[0][i];
+			   }
+			   workPtr[i] = val;
+		   }
+	   });
+	if (!isRef) tWork_p->put(work);
+	return True;
+}/* end of computePenaltyArrays() */
+
 /***************************************
  *  Update the model images and the convolved residuals
  ****************************************/
@@ -1191,6 +1259,18 @@ Bool MultiTermLatticeCleaner<T>::findMaxAbsLattice(const TempLattice<Float>& mas
 
   Array<Float> msk;
   
+  // Lattices in memory are searched directly in their arrays.
+  if (!lattice.isPaged()  &&  !masklat.isPaged()) {
+    COWPtr<Array<Float>> arr;
+    COWPtr<Array<Float>> marr;
+    lattice.get (arr);
+    masklat.get (marr);
+    LatticeCleaner<T>::findPeakArray (*arr, &(*marr),
+                                      (flip ? LatticeCleaner<T>::MAXFLIPPED :
+                                              LatticeCleaner<T>::MAXPRODUCT),
+                                      maxAbs, posMaxAbs);
+    return True;
+  }
   posMaxAbs = IPosition(lattice.shape().nelements(), 0);
   maxAbs=0.0;
   //maxAbs=-1.0e+10;
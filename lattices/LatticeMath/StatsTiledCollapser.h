@@ -145,6 +145,13 @@ public:
     // Can handle null mask
     virtual Bool canHandleNullMask() const {return True;};
 
+    // Clone the collapser, so LatticeApply can use it in parallel.
+    virtual TiledCollapser<T,U>* clone() const;
+
+    // Merge the accumulated statistics of a clone into this object.
+    // Mean and variance are combined using the pairwise update formulae.
+    virtual void merge (const TiledCollapser<T,U>& other);
+
     // Find the location of the minimum and maximum data values
     // in the input lattice.
      void minMaxPos(IPosition& minPos, IPosition& maxPos);
@@ -271,6 +271,60 @@ void StatsTiledCollapser<T,U>::endAccumulator(
     result.putStorage (res, deleteRes);
 }
 
+template <class T, class U>
+TiledCollapser<T,U>* StatsTiledCollapser<T,U>::clone() const {
+    // The accumulators are shared until the clone's initAccumulator
+    // is called, which LatticeApply does before using it.
+    StatsTiledCollapser<T,U>* coll = new StatsTiledCollapser<T,U>(*this);
+    coll->_minpos.resize(0);
+    coll->_maxpos.resize(0);
+    return coll;
+}
+
+template <class T, class U>
+void StatsTiledCollapser<T,U>::merge (const TiledCollapser<T,U>& other) {
+    const StatsTiledCollapser<T,U>& that =
+        dynamic_cast<const StatsTiledCollapser<T,U>&>(other);
+    AlwaysAssert (that._n1 == _n1  &&  that._n3 == _n3, AipsError);
+    for (uInt64 i=0; i<_n1*_n3; ++i) {
+        const Double nb = (*that._npts)[i];
+        if (nb == 0) {
+            continue;
+        }
+        const Double na = (*_npts)[i];
+        Bool newMin = na == 0  ||  (*that._min)[i] < (*_min)[i];
+        Bool newMax = na == 0  ||  (*that._max)[i] > (*_max)[i];
+        if (na == 0) {
+            (*_mean)[i] = (*that._mean)[i];
+            (*_nvariance)[i] = (*that._nvariance)[i];
+        } else {
+            const Double n = na + nb;
+            const U delta = (*that._mean)[i] - (*_mean)[i];
+            (*_mean)[i] += delta * U(nb / n);
+            (*_nvariance)[i] += (*that._nvariance)[i] +
+                                delta * delta * U(na * nb / n);
+        }
+        (*_npts)[i] = na + nb;
+        (*_sum)[i] += (*that._sum)[i];
+        (*_sumSq)[i] += (*that._sumSq)[i];
+        if (newMin) {
+            (*_min)[i] = (*that._min)[i];
+            if (! that._minpos.empty()) {
+                _minpos = that._minpos;
+            }
+        }
+        if (newMax) {
+            (*_max)[i] = (*that._max)[i];
+            if (! that._maxpos.empty()) {
+                _maxpos = that._maxpos;
+            }
+        }
+        const Double n = (*_npts)[i];
+        (*_variance)[i] = n > 1 ? (*_nvariance)[i] / U(n - 1) : U(0);
+        (*_sigma)[i] = sqrt((*_variance)[i]);
+    }
+}
+
 template <class T, class U>
 void StatsTiledCollapser<T,U>::_convertNPts(
     Double*& nptsPtr, std::shared_ptr<Block<Double>> npts,
@@ -152,6 +152,22 @@ public:
     virtual void endAccumulator (Array<U>& result, 
                                  Array<Bool>& resultMask,
 				 const IPosition& shape) = 0;
+
+// Make a copy of the collapser with the same settings, which will get its
+// own accumulator by a call to <src>initAccumulator</src>.
+// It makes it possible for LatticeApply to collapse tiles in parallel,
+// each thread using its own clone. The clone's <src>process</src> function
+// must not use objects shared with other clones in a thread-unsafe way.
+// <br>The default implementation returns a null pointer meaning that the
+// collapser cannot be cloned, so the tiles are collapsed sequentially.
+    virtual TiledCollapser<T,U>* clone() const;
+
+// Merge the accumulator of a clone into the accumulator of this object.
+// Both accumulators have been initialized with the same <src>n1</src>
+// and <src>n3</src>, but the clone has processed other parts of the chunk.
+// It is only called if <src>clone</src> returns a non-null pointer.
+// <br>The default implementation throws an exception.
+    virtual void merge (const TiledCollapser<T,U>& other);
 };
 
 
@@ -337,6 +337,48 @@ int main(int argc, const char *argv[])
    cout << "Number of iterations = " << fitter4.numberIterations() << endl;
    cout << "Number of points     = " << fitter4.numberPoints() << endl;
 
+// Fit all planes of a cube in one go and compare with fitting
+// each plane separately.
+   {
+      const Int nPlanes = 5;
+      Array<Float> cube(IPosition(3, nx, ny, nPlanes), 0.0f);
+      Array<Float> cubeSigma(cube.shape(), 1.0f);
+      for (Int p=0; p<nPlanes; ++p) {
+         Array<Float> plane = cube(IPosition(3,0,0,p),
+                                   IPosition(3,nx-1,ny-1,p)).nonDegenerate(2);
+         addModel (plane, 10.0+p, nx/2+0.3*p, ny/2-0.2*p, 10.0, 5.0, pa);
+      }
+      Vector<Double> start(6);
+      start(0) = 9.0;
+      start(1) = nx/2 + 1.0;
+      start(2) = ny/2 - 1.0;
+      start(3) = 11.0;
+      start(4) = 4.5;
+      start(5) = pa + 0.1;
+      Fit2D cubeFitter(logger);
+      cubeFitter.addModel (Fit2D::GAUSSIAN, start);
+      Matrix<Double> solutions, errors;
+      Vector<Double> chi2;
+      std::vector<Fit2D::ErrorTypes> status =
+         cubeFitter.fitPlanes (solutions, errors, chi2, cube,
+                               Array<Bool>(), cubeSigma);
+      AlwaysAssertExit (status.size() == uInt(nPlanes));
+      AlwaysAssertExit (solutions.shape() == IPosition(2, 6, nPlanes));
+      for (Int p=0; p<nPlanes; ++p) {
+         AlwaysAssertExit (status[p] == Fit2D::OK);
+         Fit2D planeFitter(logger);
+         planeFitter.addModel (Fit2D::GAUSSIAN, start);
+         Array<Float> plane = cube(IPosition(3,0,0,p),
+                                   IPosition(3,nx-1,ny-1,p)).nonDegenerate(2);
+         Array<Float> planeSigma(plane.shape(), 1.0f);
+         AlwaysAssertExit (planeFitter.fit(plane, planeSigma) == Fit2D::OK);
+         AlwaysAssertExit (allNearAbs(solutions.column(p),
+                                      planeFitter.availableSolution(), 1e-4));
+         AlwaysAssertExit (near(solutions(0,p), 10.0+p, 1e-4));
+      }
+      cout << endl << "Fit of cube planes ok" << endl;
+   }
+
 
 /*
    fitter.addModel(Fit2D::LEVEL, Vector<Double>(1, 4.5));
@@ -25,6 +25,7 @@
 
 #include <casacore/lattices/LatticeMath/LatticeAddNoise.h>
 #include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/lattices/Lattices/PagedArray.h>
 #include <casacore/lattices/Lattices/LatticeIterator.h>
 #include <casacore/lattices/Lattices/LatticeStepper.h>
 #include <casacore/casa/Logging/LogIO.h>
@@ -36,6 +37,7 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/OS/ThreadPool.h>
 #include <casacore/casa/iostream.h>
 
 #include <casacore/casa/namespace.h>
@@ -43,6 +45,7 @@ void test0 ();
 void test0Complex ();
 void test1 (Random::Types type);
 void test1Complex (Random::Types type);
+void test2 ();
 void checkStats (Float av0, const Lattice<Float>& data,
                  Random::Types type);
 void checkStatsComplex (Float av0, const Lattice<Complex>& data,
@@ -82,6 +85,9 @@ int main ()
          if (type!=Random::GEOMETRIC &&
              type!=Random::UNKNOWN) test1Complex (type);
       }
+//
+      cerr << "Test 2" << endl;
+      test2();
   } catch (std::exception& x) {
     cerr << "Caught exception: " << x.what() << endl;
     cout << "FAIL" << endl;
@@ -204,6 +210,76 @@ void test1Complex (Random::Types type)
 
 
 
+void test2 ()
+{
+// The Philox noise of a pixel only depends on the seeds and its position,
+// so it does not depend on the number of threads or the cursor shape.
+
+   IPosition shape(3, 301, 203, 3);
+   Vector<Double> pars(2);
+   pars(0) = 0.5;
+   pars(1) = 2.0;
+   uInt concurrency = ThreadPool::concurrency();
+   ArrayLattice<Float> lat1(shape);
+   lat1.set(0.0);
+   ThreadPool::setConcurrency (1);
+   LatticeAddNoise lan1(Random::NORMAL, pars, 3, 4);
+   lan1.add(lat1);
+   ThreadPool::setConcurrency (4);
+   ArrayLattice<Float> lat2(shape);
+   lat2.set(0.0);
+   LatticeAddNoise lan2(Random::NORMAL, pars, 3, 4);
+   lan2.add(lat2);
+   AlwaysAssertExit (allEQ(lat1.get(), lat2.get()));
+
+// Same for a tiled lattice, where the cursor hangs over the edges.
+
+   {
+      PagedArray<Float> lat3(TiledShape(shape, IPosition(3, 64, 50, 2)),
+                             "tLatticeAddNoise_tmp.pa");
+      lat3.table().markForDelete();
+      lat3.set(0.0);
+      AlwaysAssertExit (lat3.niceCursorShape() == IPosition(3, 64, 50, 2));
+      LatticeAddNoise lan3(Random::NORMAL, pars, 3, 4);
+      lan3.add(lat3);
+      AlwaysAssertExit (allEQ(lat1.get(), lat3.get()));
+   }
+
+// The values are those of the Philox stream, in linear lattice order.
+
+   {
+      Philox gen((uInt64(3) << 32) | 4);
+      Vector<Double> expected(shape.product());
+      gen.normal (expected.data(), expected.size(), 0, pars(0), pars(1));
+      Array<Float> arr1 = lat1.get();
+      Vector<Float> vec1(arr1.reform(IPosition(1, shape.product())));
+      for (uInt i=0; i<vec1.size(); ++i) {
+         AlwaysAssertExit (vec1(i) == Float(expected(i)));
+      }
+
+// A second add continues the stream; complex uses two values per pixel.
+
+      ArrayLattice<Complex> clat(IPosition(2, 100, 37));
+      clat.set(Complex(0,0));
+      LatticeAddNoise lan4(Random::UNIFORM, pars, 3, 4);
+      lan4.add(clat);
+      lan4.add(clat);
+      Vector<Double> first(2*3700), second(2*3700);
+      gen.uniform (first.data(), first.size(), 0, pars(0), pars(1));
+      gen.uniform (second.data(), second.size(), 2*3700, pars(0), pars(1));
+      Array<Complex> carr = clat.get();
+      Vector<Complex> cvec(carr.reform(IPosition(1, 3700)));
+      for (uInt i=0; i<cvec.size(); ++i) {
+         Float re = Float(first(2*i)) + Float(second(2*i));
+         Float im = Float(first(2*i+1)) + Float(second(2*i+1));
+         AlwaysAssertExit (near(real(cvec(i)), re, 1e-6));
+         AlwaysAssertExit (near(imag(cvec(i)), im, 1e-6));
+      }
+   }
+   ThreadPool::setConcurrency (concurrency);
+}
+
+
 void checkStats (Float av0,  const Lattice<Float>& data,
                  Random::Types type)
 {
@@ -130,6 +130,8 @@ public:
     virtual void endAccumulator (Array<Int>& result,
 				 Array<Bool>& resultMask,
 				 const IPosition& shape);
+    virtual TiledCollapser<Int>* clone() const;
+    virtual void merge (const TiledCollapser<Int>& other);
 private:
     Matrix<uInt>* itsSum1;
     Block<Int>*   itsSum2;
@@ -149,6 +151,10 @@ void MyTiledCollapser::init (uInt nOutPixelsPerCollapse)
 }
 void MyTiledCollapser::initAccumulator (uInt64 n1, uInt64 n3)
 {
+    // A clone is initialized again without endAccumulator being called.
+    delete itsSum1;
+    delete itsSum2;
+    delete itsNpts;
     itsSum1 = new Matrix<uInt> (n1, n3);
     itsSum2 = new Block<Int> (n1*n3);
     itsNpts = new Matrix<uInt> (n1, n3);
@@ -221,6 +227,21 @@ void MyTiledCollapser::endAccumulator (Array<Int>& result,
     itsNpts = 0;
 }
 
+TiledCollapser<Int>* MyTiledCollapser::clone() const
+{
+    return new MyTiledCollapser();
+}
+void MyTiledCollapser::merge (const TiledCollapser<Int>& other)
+{
+    const MyTiledCollapser& that = dynamic_cast<const MyTiledCollapser&>(other);
+    AlwaysAssert (that.itsn1 == itsn1  &&  that.itsn3 == itsn3, AipsError);
+    *itsSum1 += *that.itsSum1;
+    *itsNpts += *that.itsNpts;
+    for (uInt i=0; i<itsn1*itsn3; i++) {
+	(*itsSum2)[i] += (*that.itsSum2)[i];
+    }
+}
+
 
 class MyLatticeProgress : public LatticeProgress
 {
@@ -32,11 +32,112 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/lattices/LatticeMath/LatticeFFT.h>
+#include <casacore/scimath/Mathematics/FFTServer.h>
+#include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/lattices/Lattices/LatticeIterator.h>
 #include <casacore/lattices/Lattices/PagedArray.h>
+#include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/BasicMath/Random.h>
 #include <casacore/casa/iostream.h>
 
 #include <casacore/casa/namespace.h>
+// An ArrayLattice pretending to be a tiled lattice on disk,
+// so LatticeFFT transforms it in multiple chunks and reads ahead.
+template<class T> class TiledArrayLattice : public ArrayLattice<T>
+{
+public:
+  TiledArrayLattice (const IPosition& shape, const IPosition& tileShape)
+    : ArrayLattice<T>(shape), itsTileShape(tileShape) {}
+  virtual Bool isPaged() const
+    { return True; }
+  virtual IPosition doNiceCursorShape (uInt) const
+    { return itsTileShape; }
+private:
+  IPosition itsTileShape;
+};
+
+// Check that transforming a lattice in chunks gives the same result as
+// transforming it at once.
+void testChunked()
+{
+  const IPosition rShape(3, 20, 12, 7);
+  const IPosition cShape(3, 11, 12, 7);
+  const IPosition tileShape(3, 4, 5, 2);
+  Array<Float> data(rShape);
+  MLCG gen(1, 2);
+  Normal noise(&gen, 0.0, 1.0);
+  for (Array<Float>::iterator iter=data.begin(); iter!=data.end(); ++iter) {
+    *iter = noise();
+  }
+  Vector<Bool> whichAxes(3, True);
+  whichAxes(1) = False;
+  for (Int shift=0; shift<2; ++shift) {
+    for (Int fast=0; fast<2; ++fast) {
+      ArrayLattice<Float> rArr(data);
+      TiledArrayLattice<Float> rTiled(rShape, tileShape);
+      rTiled.put (data);
+      ArrayLattice<Complex> cArr(cShape);
+      TiledArrayLattice<Complex> cTiled(cShape, tileShape);
+      LatticeFFT::rcfft(cArr, rArr, whichAxes, shift, fast);
+      LatticeFFT::rcfft(cTiled, rTiled, whichAxes, shift, fast);
+      AlwaysAssertExit(allNearAbs(cArr.get(), cTiled.get(), 1e-4));
+      LatticeFFT::cfft(cArr, True);
+      LatticeFFT::cfft(cTiled, True);
+      AlwaysAssertExit(allNearAbs(cArr.get(), cTiled.get(), 1e-3));
+      LatticeFFT::cfft0(cArr, whichAxes, False);
+      LatticeFFT::cfft0(cTiled, whichAxes, False);
+      AlwaysAssertExit(allNearAbs(cArr.get(), cTiled.get(), 1e-3));
+      // Transform back to the original data (not possible if fast,
+      // because crfft then flips the result).
+      LatticeFFT::cfft0(cArr, whichAxes, True);
+      LatticeFFT::cfft0(cTiled, whichAxes, True);
+      LatticeFFT::cfft(cArr, False);
+      LatticeFFT::cfft(cTiled, False);
+      LatticeFFT::crfft(rArr, cArr, whichAxes, shift, fast);
+      LatticeFFT::crfft(rTiled, cTiled, whichAxes, shift, fast);
+      AlwaysAssertExit(allNearAbs(rArr.get(), rTiled.get(), 1e-4));
+      if (!(shift && fast)) {
+        AlwaysAssertExit(allNearAbs(rTiled.get(), data, 1e-4));
+      }
+    }
+  }
+}
+
+// Check that cfft2d transforming chunks of planes gives the same result
+// as transforming the planes one by one.
+void testPlanes()
+{
+  const IPosition shape(4, 9, 6, 5, 3);
+  Array<Complex> data(shape);
+  MLCG gen(3, 4);
+  Normal noise(&gen, 0.0, 1.0);
+  for (Array<Complex>::iterator iter=data.begin(); iter!=data.end(); ++iter) {
+    *iter = Complex(noise(), noise());
+  }
+  for (Int dir=0; dir<2; ++dir) {
+    Array<Complex> expected(data.copy());
+    FFTServer<Float,Complex> ffts(IPosition(2, 9, 6));
+    for (Int p=0; p<5; ++p) {
+      for (Int q=0; q<3; ++q) {
+        Matrix<Complex> plane(expected(IPosition(4,0,0,p,q),
+                                       IPosition(4,8,5,p,q)).
+                              reform(IPosition(2,9,6)));
+        ffts.fft(plane, dir==0);
+      }
+    }
+    Array<Complex> work(data.copy());
+    ArrayLattice<Complex> arr(work);
+    LatticeFFT::cfft2d(arr, dir==0);
+    AlwaysAssertExit(allNearAbs(arr.get(), expected, 1e-5));
+    TiledArrayLattice<Complex> tiled(shape, IPosition(4, 3, 2, 2, 1));
+    tiled.put (data);
+    LatticeFFT::cfft2d(tiled, dir==0);
+    AlwaysAssertExit(allNearAbs(tiled.get(), expected, 1e-5));
+  }
+}
+
 int main() {
   try {
     {
@@ -174,6 +275,8 @@ int main() {
  	}
       }
     }
+    testChunked();
+    testPlanes();
     cout<< "OK"<< endl;
     return 0;
   } catch (std::exception& x) {
@@ -36,6 +36,7 @@
 #include <casacore/lattices/Lattices/ArrayLattice.h>
 #include <casacore/lattices/LatticeMath/LatticeHistograms.h>
 #include <casacore/lattices/Lattices/SubLattice.h>
+#include <casacore/lattices/Lattices/TempLattice.h>
 #include <casacore/lattices/LatticeMath/LatticeStatsBase.h>
 #include <casacore/lattices/Lattices/LatticeUtilities.h>
 #include <casacore/lattices/LRegions/LCSlicer.h>
@@ -151,6 +152,41 @@ int main() {
                 }
             }
         }
+        {
+            // A tiled lattice with many tiles (which are filled in parallel
+            // if multiple threads can be used).
+            // The values 0..9 fall in the bins 0..9, so each bin must count
+            // the number of times its value occurs.
+            TempLattice<Float> latt(TiledShape(IPosition(3, 40, 30, 20),
+                                               IPosition(3, 8, 6, 4)), 0);
+            Array<Float> arr(latt.shape());
+            Vector<Float> expCounts(10, 0.0f);
+            uInt v = 0;
+            for (Array<Float>::iterator iter=arr.begin();
+                 iter!=arr.end(); ++iter) {
+                *iter = v % 10;
+                expCounts[v % 10] += 1;
+                v = v*7 + 3;
+            }
+            latt.put(arr);
+            SubLattice<Float> subLatt(latt);
+            LatticeHistograms<Float> lh(subLatt);
+            lh.setNBins(10);
+            Array<Float> values, counts;
+            lh.getHistograms(values, counts);
+            AlwaysAssert(counts.shape() == IPosition(1, 10), AipsError);
+            for (uInt i=0; i<10; ++i) {
+                AlwaysAssert(counts(IPosition(1, i)) == expCounts[i],
+                             AipsError);
+            }
+            // Per plane along the last axis.
+            Vector<Int> axes(2, 0);
+            axes[1] = 1;
+            lh.setAxes(axes);
+            lh.getHistograms(values, counts);
+            AlwaysAssert(counts.shape() == IPosition(2, 10, 20), AipsError);
+            AlwaysAssert(sum(counts) == arr.nelements(), AipsError);
+        }
     }
     catch (const std::exception& x) {
         cerr << "aipserror: error " << x.what() << endl;
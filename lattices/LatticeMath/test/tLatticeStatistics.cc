@@ -868,6 +868,28 @@ int main()
                 AlwaysAssert(minPos.empty(), AipsError);
                 AlwaysAssert(maxPos.empty(), AipsError);
             }
+            // approximate quantiles have a rank error of at most 0.1%,
+            // which is 1000 for these data
+            for (uInt i=0; i<2; ++i) {
+                LatticeStatistics<Float> stats(subLatt, log);
+                stats.setComputeQuantiles(True);
+                AlwaysAssert(stats.configureQuantileError(0.001), AipsError);
+                AlwaysAssert(! stats.configureQuantileError(0.001), AipsError);
+                if (i == 0) {
+                    stats.forceUseStatsFrameworkUsingArrays();
+                } else {
+                    stats.forceUseStatsFrameworkUsingDataProviders();
+                }
+                Array<Double> stat;
+                stats.getStatistic(stat, LatticeStatsBase::MEDIAN);
+                AlwaysAssert(abs(*stat.begin() - 499999.5) <= 1000, AipsError);
+                stats.getStatistic(stat, LatticeStatsBase::Q1);
+                AlwaysAssert(abs(*stat.begin() - 249999) <= 1000, AipsError);
+                stats.getStatistic(stat, LatticeStatsBase::Q3);
+                AlwaysAssert(abs(*stat.begin() - 749999) <= 1000, AipsError);
+                stats.getStatistic(stat, LatticeStatsBase::MEDABSDEVMED);
+                AlwaysAssert(abs(*stat.begin() - 250000) <= 2000, AipsError);
+            }
         }
     }
     catch (const std::exception& x) {
@@ -0,0 +1,145 @@
+//# tLatticeTileStats.cc: Test program for class LatticeTileStats
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/lattices/LatticeMath/LatticeTileStats.h>
+#include <casacore/lattices/Lattices/PagedArray.h>
+#include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/lattices/Lattices/SubLattice.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+
+#include <casacore/casa/namespace.h>
+
+// Check the statistics against the values calculated directly.
+void checkStats (const StatsData<Double>& stats, const Array<Float>& arr)
+{
+  Array<Double> darr(arr.shape());
+  convertArray (darr, arr);
+  AlwaysAssertExit (stats.npts == darr.nelements());
+  AlwaysAssertExit (nearAbs (stats.sum, sum(darr), 1e-8));
+  AlwaysAssertExit (nearAbs (stats.mean, mean(darr), 1e-10));
+  AlwaysAssertExit (near (stats.variance, variance(darr), 1e-10));
+  AlwaysAssertExit (*stats.min == min(arr));
+  AlwaysAssertExit (*stats.max == max(arr));
+}
+
+int main()
+{
+  try {
+    IPosition tileShape(3, 4, 4, 2);
+    Array<Float> arr(IPosition(3, 8, 8, 6));
+    indgen (arr);
+    arr = sin(arr) * Float(10);
+    {
+      // Compute the statistics and store them.
+      PagedArray<Float> lat(TiledShape(IPosition(3,8,8,5), tileShape),
+                            "tLatticeTileStats_tmp.data");
+      lat.put (arr(IPosition(3,0), IPosition(3,7,7,4)));
+      LatticeTileStats<Float> stats(SubLattice<Float>(lat, True));
+      AlwaysAssertExit (stats.tileShape() == tileShape);
+      AlwaysAssertExit (stats.nTiles() == 12);
+      stats.setHistogram (20, -10, 10);
+      checkStats (stats.statistics(),
+                  arr(IPosition(3,0), IPosition(3,7,7,4)));
+      AlwaysAssertExit (stats.nComputed() == 12);
+      // A tile-aligned box; the statistics are not computed again.
+      Slicer box(IPosition(3,4,0,2), IPosition(3,7,7,4), Slicer::endIsLast);
+      AlwaysAssertExit (stats.isAligned (box));
+      checkStats (stats.statistics(box), arr(box));
+      AlwaysAssertExit (stats.nComputed() == 0);
+      Vector<Int64> hist = stats.histogram();
+      AlwaysAssertExit (sum(hist) == 8*8*5);
+      Slicer notAligned(IPosition(3,1,0,0), IPosition(3,4,4,2));
+      AlwaysAssertExit (! stats.isAligned (notAligned));
+      Bool thrown = False;
+      try {
+        stats.statistics (notAligned);
+      } catch (const AipsError&) {
+        thrown = True;
+      }
+      AlwaysAssertExit (thrown);
+      // Change some data; only the tiles containing it are recomputed.
+      Slicer changed(IPosition(3,0,0,0), IPosition(3,5,2,1));
+      Array<Float> part(changed.length());
+      part = 20;
+      lat.putSlice (part, changed.start());
+      stats.update (changed);
+      AlwaysAssertExit (stats.nComputed() == 2);
+      Array<Float> expected = arr(IPosition(3,0), IPosition(3,7,7,4)).copy();
+      expected(changed) = Float(20);
+      checkStats (stats.statistics(), expected);
+      AlwaysAssertExit (sum(stats.histogram()) == 8*8*5 - 5*2*1);
+      // Restore the original data and save the statistics.
+      lat.putSlice (arr(changed), changed.start());
+      stats.update (changed);
+      stats.save (lat.table());
+      stats.save (lat.table());
+    }
+    {
+      // Extend the lattice with a plane; only the tiles of the last
+      // (partial) tile plane are computed.
+      PagedArray<Float> lat("tLatticeTileStats_tmp.data");
+      PagedArray<Float> ext(TiledShape(arr.shape(), tileShape),
+                            "tLatticeTileStats_tmp.ext");
+      ext.put (arr);
+      LatticeTileStats<Float> stats(SubLattice<Float>(ext), lat.table());
+      checkStats (stats.statistics(), arr);
+      AlwaysAssertExit (stats.nComputed() == 4);
+      AlwaysAssertExit (sum(stats.histogram()) == 8*8*6);
+      // Use the stored statistics of the original lattice.
+      LatticeTileStats<Float> stats2(SubLattice<Float>(lat), lat.table());
+      checkStats (stats2.statistics(), arr(IPosition(3,0), IPosition(3,7,7,4)));
+      AlwaysAssertExit (stats2.nComputed() == 0);
+      lat.table().markForDelete();
+      ext.table().markForDelete();
+    }
+    {
+      // A masked lattice.
+      ArrayLattice<Float> lat(arr);
+      Array<Bool> maskArr(arr.shape());
+      maskArr = arr > Float(0);
+      SubLattice<Float> sub(lat, True);
+      sub.setPixelMask (ArrayLattice<Bool>(maskArr), False);
+      LatticeTileStats<Float> stats(sub, tileShape);
+      StatsData<Double> result = stats.statistics();
+      AlwaysAssertExit (result.npts == ntrue(maskArr));
+      Array<Double> darr(arr.shape());
+      convertArray (darr, arr);
+      Double expSum = sum(darr(maskArr).getCompressedArray());
+      AlwaysAssertExit (nearAbs (result.sum, expSum, 1e-8));
+      AlwaysAssertExit (*result.min > 0);
+    }
+  } catch (const std::exception& x) {
+    cout << "Caught exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -33,6 +33,7 @@
 #include <casacore/casa/Logging/LogIO.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
@@ -114,6 +115,54 @@ int main ()
                                 False);
       }
 
+// Compare the FFT results with the direct summation, without and with
+// a mask.
+
+      {
+         cerr << "FFT versus direct" << endl;
+         IPosition shape2(3, 13, 3, 9);
+         Array<Float> arr(shape2);
+         Array<Bool> mask(shape2);
+         uInt v = 1;
+         Array<Float>::iterator aiter = arr.begin();
+         for (Array<Bool>::iterator miter=mask.begin();
+              miter!=mask.end(); ++miter, ++aiter) {
+           v = (v*1103515245 + 12345) % 2147483648u;
+           *aiter = 100 + (v % 1000) / 10.;
+           *miter = (v % 7 != 0);
+         }
+         IPosition axes(2, 0, 2);
+         IPosition shapeOut = LatticeTwoPtCorr<Float>::setUpShape (shape2, axes);
+         LatticeTwoPtCorr<Float> twoPt;
+         for (uInt useMask=0; useMask<2; ++useMask) {
+           ArrayLattice<Float> lat(arr);
+           SubLattice<Float> mLat(lat);
+           if (useMask) {
+             mLat.setPixelMask (ArrayLattice<Bool>(mask), False);
+           }
+           ArrayLattice<Float> out1(shapeOut);
+           ArrayLattice<Float> out2(shapeOut);
+           ArrayLattice<Bool> mask1(shapeOut);
+           ArrayLattice<Bool> mask2(shapeOut);
+           out1.set(0);
+           out2.set(0);
+           SubLattice<Float> mOut1(out1, True);
+           SubLattice<Float> mOut2(out2, True);
+           mOut1.setPixelMask (mask1, False);
+           mOut2.setPixelMask (mask2, False);
+           twoPt.autoCorrelation (mOut1, mLat, axes,
+                                  LatticeTwoPtCorr<Float>::STRUCTUREFUNCTION,
+                                  False, False);
+           twoPt.autoCorrelation (mOut2, mLat, axes,
+                                  LatticeTwoPtCorr<Float>::STRUCTUREFUNCTION,
+                                  False, True);
+           AlwaysAssertExit (allEQ (mask1.get(), mask2.get()));
+           AlwaysAssertExit (allNearAbs (out1.get(), out2.get(), 1e-2));
+           AlwaysAssertExit (useMask  ||  allTrue (mask1.get()));
+           AlwaysAssertExit (max(out1.get()) > 100);
+         }
+      }
+
 // Copy Constructor
 
       {
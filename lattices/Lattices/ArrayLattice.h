@@ -197,6 +197,11 @@ public:
   // IPosition.  
   // Note that operator() (defined in the base class) can also be used.
   virtual T getAt (const IPosition& where) const;
+
+  // Get a copy of a section in a thread-safe way. It is done without
+  // serializing, because reading an array is thread-safe.
+  virtual void getSliceConcurrent (Array<T>& buffer,
+                                   const Slicer& section) const;
   
   // Put the value of a single element.
   virtual void putAt (const T& value, const IPosition& where);
@@ -118,6 +118,16 @@ Bool ArrayLattice<T>::doGetSlice (Array<T>& buffer, const Slicer& section)
   return True;
 }
 
+template<class T>
+void ArrayLattice<T>::getSliceConcurrent (Array<T>& buffer,
+                                          const Slicer& section) const
+{
+  IPosition blc, trc, inc;
+  section.inferShapeFromSource (itsData.shape(), blc, trc, inc);
+  Array<T> tmp = itsData(blc, trc, inc).copy();
+  buffer.reference (tmp);
+}
+
 template<class T>
 void ArrayLattice<T>::doPutSlice (const Array<T>& sourceBuffer,
 				  const IPosition& where, 
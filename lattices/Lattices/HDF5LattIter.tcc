@@ -83,7 +83,8 @@ LatticeIterInterface<T>* HDF5LattIter<T>::clone() const
 template<class T>
 void HDF5LattIter<T>::setupTileCache()
 {
-  const IPosition& tileShape = itsData.niceCursorShape();
+  // The cache size is expressed in tiles, so use the real tile shape.
+  const IPosition& tileShape = itsData.tileShape();
   uInt cacheSize = itsNavPtr->calcCacheSize (itsData.shape(),
                                              tileShape,
                                              0,
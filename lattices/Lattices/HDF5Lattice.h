@@ -122,9 +122,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // out of scope or is deleted.
     // Optionally the name of an HDF5 group can be given to create the array in.
     // The group is created if not existing yet.
+    // The array can be compressed (see class HDF5DataSet for the details).
     HDF5Lattice (const TiledShape& shape, const String& filename,
 		 const String& arrayName = "array",
-		 const String& groupName = String());
+		 const String& groupName = String(),
+		 HDF5DataSet::Compression compression = HDF5DataSet::NoCompression,
+		 uInt compressionLevel = 6);
 
     // Construct a temporary HDF5Lattice with the specified shape.
     // A scratch file is created in the current working directory to hold
@@ -136,8 +139,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // HDF5 file. The array gets the given name.
     // Optionally the name of an HDF5 group can be given to create the array in.
     // The group is created if not existing yet.
+    // The array can be compressed (see class HDF5DataSet for the details).
+    // <br>If the file is opened for parallel access (using MPI-IO), all
+    // processes have to create the lattice collectively.
     HDF5Lattice (const TiledShape& shape, const std::shared_ptr<HDF5File>& file,
-		 const String& arrayName, const String& groupName = String());
+		 const String& arrayName, const String& groupName = String(),
+		 HDF5DataSet::Compression compression = HDF5DataSet::NoCompression,
+		 uInt compressionLevel = 6);
 
     // Reconstruct from a pre-existing HDF5Lattice in the HDF5 file and group
     // with the given names.
@@ -254,9 +262,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   private:
     // Make the Array in the HDF5 file and group.
     void makeArray (const TiledShape& shape, const String& arrayName,
-		    const String& groupName);
+		    const String& groupName,
+		    HDF5DataSet::Compression compression, uInt compressionLevel);
     // Open the Array in the HDF5 file and group.
     void openArray (const String& arrayName, const String& groupName);
+    // Set the tile shape and the default chunk cache, which holds a row of
+    // tiles along the first axis (instead of HDF5's default of 1 MB).
+    void initTiling();
     // Check if the file is writable.
     void checkWritable() const;
 
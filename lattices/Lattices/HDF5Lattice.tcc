@@ -51,10 +51,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   template<typename T>
   HDF5Lattice<T>::HDF5Lattice (const TiledShape& shape, const String& fileName,
-			       const String& arrayName, const String& groupName)
+			       const String& arrayName, const String& groupName,
+			       HDF5DataSet::Compression compression,
+			       uInt compressionLevel)
   {
     itsFile = std::make_shared<HDF5File>(fileName, ByteIO::New);
-    makeArray (shape, arrayName, groupName);
+    makeArray (shape, arrayName, groupName, compression, compressionLevel);
     DebugAssert (ok(), AipsError);
   }
 
@@ -63,17 +65,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     Path fileName = File::newUniqueName(String("./"), String("HDF5Lattice"));
     itsFile = std::make_shared<HDF5File>(fileName.absoluteName(), ByteIO::Scratch);
-    makeArray (shape, "array", String());
+    makeArray (shape, "array", String(), HDF5DataSet::NoCompression, 0);
     DebugAssert (ok(), AipsError);
   }
 
   template<typename T>
   HDF5Lattice<T>::HDF5Lattice (const TiledShape& shape,
 			       const std::shared_ptr<HDF5File>& file,
-			       const String& arrayName, const String& groupName)
+			       const String& arrayName, const String& groupName,
+			       HDF5DataSet::Compression compression,
+			       uInt compressionLevel)
   : itsFile (file)
   {
-    makeArray (shape, arrayName, groupName);
+    makeArray (shape, arrayName, groupName, compression, compressionLevel);
     DebugAssert (ok(), AipsError);
   }
 
@@ -295,17 +299,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
     // Open the data set.
     itsDataSet = std::make_shared<HDF5DataSet>(*itsGroup, arrayName, (const T*)0);
-    // Calculate tile shape if default tile shape is empty
-    itsTileShape = itsDataSet->tileShape();
-    if (itsTileShape.empty()) {
-      itsTileShape = TiledFileAccess::makeTileShape(itsDataSet->shape());
-    }
+    initTiling();
   }
 
   template <typename T>
   void HDF5Lattice<T>::makeArray (const TiledShape& shape,
 				  const String& arrayName,
-				  const String& groupName)
+				  const String& groupName,
+				  HDF5DataSet::Compression compression,
+				  uInt compressionLevel)
   {
     // Make sure the table is writable.
     checkWritable();
@@ -318,11 +320,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
     // Create the data set.
     itsDataSet = std::make_shared<HDF5DataSet>(*itsGroup, arrayName, shape.shape(),
-                                               shape.tileShape(), (const T*)0);
+                                               shape.tileShape(), (const T*)0,
+                                               compression, compressionLevel);
+    initTiling();
+  }
+
+  template <typename T>
+  void HDF5Lattice<T>::initTiling()
+  {
     // Calculate tile shape if default tile shape is empty
     itsTileShape = itsDataSet->tileShape();
     if (itsTileShape.empty()) {
       itsTileShape = TiledFileAccess::makeTileShape(itsDataSet->shape());
+    } else {
+      // A chunked data set gets a cache holding all tiles along the first
+      // axis, so iterating line by line does not read a tile repeatedly.
+      const IPosition& shp = itsDataSet->shape();
+      uInt ntiles = (shp[0] + itsTileShape[0] - 1) / itsTileShape[0];
+      itsDataSet->setCacheSize (std::max(ntiles, 1u));
     }
   }
 
@@ -316,6 +316,20 @@ public:
 		     const IPosition& shape, const IPosition& stride,
 		     Bool removeDegenerateAxes=False) const;
   // </group>
+
+  // Get a copy of a section of the lattice in a thread-safe way, so
+  // multiple threads can read the lattice at the same time using their
+  // own navigators (e.g. made by
+  // <linkto class=LatticeNavigator>LatticeNavigator::split</linkto>).
+  // The buffer never references the lattice data.
+  // <br>The default implementation serializes the reads of all lattices
+  // of type T, because reading a lattice (e.g. a PagedArray) can change
+  // its internal state (caches, locks). Lattices that can be read
+  // concurrently (e.g. ArrayLattice) do not serialize.
+  // It must not be mixed with other (non-const) use of the lattice at
+  // the same time.
+  virtual void getSliceConcurrent (Array<T>& buffer,
+                                   const Slicer& section) const;
   
   // A function which places an Array of values within this instance of the
   // Lattice at the location specified by the IPosition "where", incrementing 
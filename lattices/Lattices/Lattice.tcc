@@ -38,6 +38,7 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/COWPtr.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <mutex>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -203,6 +204,23 @@ Array<T> Lattice<T>::getSlice (const Slicer& section,
   return tmp;
 }
 
+template<class T>
+void Lattice<T>::getSliceConcurrent (Array<T>& buffer,
+                                     const Slicer& section) const
+{
+  static std::mutex mutex;
+  Array<T> arr;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    Bool isARef = const_cast<Lattice<T>*>(this)->getSlice (arr, section);
+    // A reference (e.g. to a mapped tile) is copied while locked.
+    if (isARef) {
+      arr.reference (arr.copy());
+    }
+  }
+  buffer.reference (arr);
+}
+
 
 template<class T>
 void Lattice<T>::putSlice (const Array<T>& sourceBuffer,
@@ -31,12 +31,14 @@
 #include <casacore/casa/aips.h>
 #include <casacore/lattices/Lattices/MaskedLattice.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
 class IPosition;
-class Slicer;
 
 
 // <summary>
@@ -73,6 +75,12 @@ class Slicer;
 //
 // If you use the putSlice function, be aware that it will change the
 // underlying lattices if they are writable.
+//
+// The start of each lattice along the concatenation axis is kept, so
+// getting a slice only accesses the lattices contributing to it.
+// The contributing lattices can be read concurrently (see function
+// <src>setReadNThreads</src>), which is useful if they are stored in
+// different files, possibly on different file systems.
 // </synopsis>
 //
 // <example>
@@ -167,6 +175,20 @@ public:
    Bool isTempClose () const 
      {return tempClose_p;} 
 
+// Set the maximum number of threads to use to read the lattices
+// contributing to a slice concurrently. A negative value means that
+// the aipsrc variable <src>lattice.concat.nthreads</src> (default 1)
+// is used; 0 means the concurrency of the global ThreadPool.
+   void setReadNThreads (Int nthreads)
+     { readNThreads_p = nthreads; }
+
+// Get the number of threads to use to read the lattices concurrently
+// (see <src>setReadNThreads</src>). It is limited to the number of
+// lattices. It is 1 if a lattice has no name (e.g., is in memory) or
+// if lattices have the same name, because reading the same file from
+// multiple threads is not safe.
+   uInt readNThreads() const;
+
 // Returns the number of dimensions of the *input* lattices (may be different 
 // by one from output lattice).  Returns 0 if none yet set.
    uInt latticeDim() const;
@@ -250,34 +272,35 @@ public:
 
  
 private:
+// The part of a lattice contributing to a slice.
+   struct SlicePart {
+      uInt lattice;         //# index of the lattice
+      Slicer section;       //# section in the lattice
+      IPosition blc, trc;   //# section in the buffer
+   };
+
    PtrBlock<MaskedLattice<T>* > lattices_p;
    uInt axis_p;
    IPosition shape_p;
    Bool isMasked_p, dimUpOne_p, tempClose_p;
    LatticeConcat<Bool>* pPixelMask_p;
+// The start of each lattice along the concatenation axis (and the end of
+// the last lattice), so partStart_p[i+1]-partStart_p[i] is its length.
+   std::vector<Int> partStart_p;
+// The names of the lattices.
+   std::vector<String> partNames_p;
+   Int readNThreads_p;
 //
    void checkAxis(uInt axis, uInt ndim) const;
 //
-   void setup1 (IPosition& blc, IPosition& trc, IPosition& stride,
-                IPosition& blc2, IPosition& trc2,
-                IPosition& blc3, IPosition& trc3, IPosition& stride3,
-                const Slicer& section);
-   Slicer setup2 (Bool& first, IPosition& blc2, IPosition& trc2,
-                  Int shape2, Int axis, const IPosition& blc,
-                  const IPosition& trc, const IPosition& stride, Int start);
-   Bool getSlice1 (Array<T>& buffer, const Slicer& section,
-                   uInt nLattices);
-   Bool getSlice2 (Array<T>& buffer, const Slicer& section,
-                   uInt nLattices);
-   Bool putSlice1 (const Array<T>& buffer, const IPosition& where,
-                   const IPosition& stride, uInt nLattices);
-
-   Bool putSlice2 (const Array<T>& buffer, const IPosition& where,
-                   const IPosition& stride, uInt nLattices);
-   Bool getMaskSlice1 (Array<Bool>& buffer, const Slicer& section,
-                       uInt nLattices);
-   Bool getMaskSlice2 (Array<Bool>& buffer, const Slicer& section,
-                       uInt nLattices);
+// Find the parts of the lattices contributing to the section, using the
+// start of each lattice to locate the first one.
+   std::vector<SlicePart> findParts (const Slicer& section) const;
+//
+// Read the parts of the section into the buffer (possibly concurrently).
+// Function <src>get(i,section)</src> gets the data of lattice i.
+   template <class U, class GetFunc>
+   void getParts (Array<U>& buffer, const Slicer& section, GetFunc get);
 };
 
 
@@ -39,6 +39,9 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -50,7 +53,8 @@ LatticeConcat<T>::LatticeConcat()
   isMasked_p(False),
   dimUpOne_p(False),
   tempClose_p(True),
-  pPixelMask_p(0)
+  pPixelMask_p(0),
+  readNThreads_p(-1)
 {
 }
 
@@ -61,7 +65,8 @@ LatticeConcat<T>::LatticeConcat(uInt axis, Bool tempClose)
   isMasked_p(False),
   dimUpOne_p(False),
   tempClose_p(tempClose),
-  pPixelMask_p(0)
+  pPixelMask_p(0),
+  readNThreads_p(-1)
 {
 }
 
@@ -74,7 +79,10 @@ LatticeConcat<T>::LatticeConcat (const LatticeConcat<T>&other)
   isMasked_p(other.isMasked_p),
   dimUpOne_p(other.dimUpOne_p),
   tempClose_p(other.tempClose_p),
-  pPixelMask_p(0)
+  pPixelMask_p(0),
+  partStart_p(other.partStart_p),
+  partNames_p(other.partNames_p),
+  readNThreads_p(other.readNThreads_p)
 {
    const uInt n = lattices_p.nelements();
    for (uInt i=0; i<n; i++) {
@@ -106,6 +114,9 @@ LatticeConcat<T>& LatticeConcat<T>::operator= (const LatticeConcat<T>& other)
     isMasked_p     = other.isMasked_p;
     dimUpOne_p     = other.dimUpOne_p;
     tempClose_p    = other.tempClose_p;
+    partStart_p    = other.partStart_p;
+    partNames_p    = other.partNames_p;
+    readNThreads_p = other.readNThreads_p;
 //
     uInt n = lattices_p.nelements();
     for (uInt j=0; j<n; j++) {
@@ -190,6 +201,12 @@ void LatticeConcat<T>::setLattice(MaskedLattice<T>& lattice)
 
    lattices_p.resize(n+1, True);
    lattices_p[n] = lattice.cloneML();
+   if (partStart_p.empty()) {
+      partStart_p.push_back (0);
+   }
+   partStart_p.push_back (partStart_p.back() +
+                          (dimUpOne_p ? 1 : lattice.shape()(axis_p)));
+   partNames_p.push_back (lattice.name());
 
 // If any lattice is masked, the whole thing is masked
 
@@ -324,25 +341,16 @@ template <class T>
 Bool LatticeConcat<T>::doGetSlice (Array<T>& buffer,
                                    const Slicer& section)
 {
-   const uInt nLattices = lattices_p.nelements();
-   if (nLattices==0) {
+   if (lattices_p.nelements()==0) {
       throw (AipsError("No lattices set - use function setLattice"));
    }
-//
-   Bool ok = False;
-   if (dimUpOne_p) {
-
-// Increase dimensionality by one
-
-     ok = getSlice1 (buffer, section, nLattices);
-   } else {
+   getParts (buffer, section,
+             [this] (uInt i, const Slicer& section2)
+               { return lattices_p[i]->getSlice (section2); });
 
-// No dimensionality increase
+// Result is a copy
 
-     ok = getSlice2(buffer, section, nLattices);
-   }
-//
-   return ok;
+   return False;
 }
  
 
@@ -350,31 +358,22 @@ template <class T>
 Bool LatticeConcat<T>::doGetMaskSlice (Array<Bool>& buffer,
                                        const Slicer& section)
 {
-   const uInt nLattices = lattices_p.nelements();
-   if (nLattices==0) {
+   if (lattices_p.nelements()==0) {
       throw (AipsError("No lattices set - use function setLattice"));
    }
 //
-   Bool ok = False;
    if (isMasked_p) {
-      if (dimUpOne_p) {
-
-// Increase dimensionality by one
-
-        ok = getMaskSlice1 (buffer, section, nLattices);
-      } else {
-
-// No dimensionality increase
-
-        ok = getMaskSlice2 (buffer, section, nLattices);
-      }
+      getParts (buffer, section,
+                [this] (uInt i, const Slicer& section2)
+                  { return lattices_p[i]->getMaskSlice (section2); });
    } else {
       buffer.resize (section.length());
       buffer = True;
-      ok = True;
    }
-//
-   return ok;   
+
+// Result is a copy
+
+   return False;
 }
 
 
@@ -382,8 +381,7 @@ template <class T>
 void LatticeConcat<T>::doPutSlice (const Array<T>& buffer, const IPosition& where,
                                    const IPosition& stride)
 {      
-   const uInt nLattices = lattices_p.nelements();
-   if (nLattices==0) {
+   if (lattices_p.nelements()==0) {
       throw (AipsError("No lattices set - use function setLattice"));
    }
 //
@@ -391,20 +389,47 @@ void LatticeConcat<T>::doPutSlice (const Array<T>& buffer, const IPosition& wher
       throw(AipsError("Some of the underlying lattices are not writable"));
    }
 //
-   if (dimUpOne_p) {
-
-// Increase dimensionality by one
-
-     putSlice1 (buffer, where, stride, nLattices);
-   } else {
-
-// No dimensionality increase
-
-     putSlice2 (buffer, where, stride, nLattices);
+   Slicer section(where, buffer.shape(), stride, Slicer::endIsLength);
+   const std::vector<SlicePart> parts = findParts (section);
+   Array<T> buf(buffer);
+   for (const SlicePart& part : parts) {
+      Array<T> data(buf(part.blc, part.trc));
+      if (dimUpOne_p) {
+         data.reference (data.nonDegenerate(axis_p));
+      }
+      lattices_p[part.lattice]->putSlice (data, part.section.start(),
+                                          part.section.stride());
+      if (tempClose_p) lattices_p[part.lattice]->tempClose();
    }
 }        
 
 
+template <class T>
+uInt LatticeConcat<T>::readNThreads() const
+{
+   Int nthread = readNThreads_p;
+   if (nthread < 0) {
+      AipsrcValue<Int>::find (nthread, "lattice.concat.nthreads", 1);
+   }
+   if (nthread == 0) {
+      nthread = ThreadPool::concurrency();
+   }
+   nthread = min (nthread, Int(lattices_p.nelements()));
+   if (nthread > 1) {
+      for (uInt i=0; i<partNames_p.size(); i++) {
+         if (partNames_p[i].empty()) {
+            return 1;
+         }
+         for (uInt j=0; j<i; j++) {
+            if (partNames_p[i] == partNames_p[j]) {
+               return 1;
+            }
+         }
+      }
+   }
+   return max (1, nthread);
+}
+
 
 template <class T>
 Bool LatticeConcat<T>::lock (FileLocker::LockType type, uInt nattempts)
@@ -528,354 +553,102 @@ void LatticeConcat<T>::checkAxis(uInt axis, uInt ndim) const
 
 
 template <class T>
-void LatticeConcat<T>::setup1 (IPosition& blc, IPosition& trc, IPosition& stride,
-                               IPosition& blc2, IPosition& trc2, 
-                               IPosition& blc3, IPosition& trc3, IPosition& stride3, 
-                               const Slicer& section)
-{
-// The Slicer section for the whole concatenated lattice
-
-   blc = section.start();
-   trc = section.end();
-   stride = section.stride();
-
-// The Slicer section for an individual lattice contribution
-// in coordinates of that lattice
-
-   blc2 = blc;
-   trc2 = trc;
-
-// The Slicer section for an individual lattice contribution
-// in the output Array coordinates
-
-   blc3 = blc;
-   blc3 = 0;
-   trc3 = section.length() - 1;
-   stride3 = stride;
-   stride3 = 1;
-}
-
-template<class T>
-Slicer LatticeConcat<T>::setup2 (Bool& first, IPosition& blc2, IPosition& trc2, 
-                                 Int shape2, Int axis, const IPosition& blc, 
-                                 const IPosition& trc, const IPosition& stride, Int start)
-{
-
-// This lattice contributes to the slice.  Find section
-// in local lattice[i] coordinates 
-
-   blc2(axis) = max(0,blc(axis)-start);
-   trc2(axis) = min(trc(axis)-start,shape2-1);
-
-// Adjust blc for stride if not first lattice
-
-   if (!first) {
-      blc2(axis) += (start-blc(axis))%stride(axis);
-   }
-   first = False;
-//
-   return Slicer(blc2, trc2, stride, Slicer::endIsLast);
-}
-
-template <class T>
-Bool LatticeConcat<T>::getSlice1 (Array<T>& buffer,
-                                  const Slicer& section,
-                                  uInt nLattices)
-{
-   const uInt dimIn = axis_p;
-
-// The concatenated lattice section
-
-   if (section.end()(axis_p)+1 > Int(nLattices)) {
-      throw(AipsError("Number of lattices and requested slice are inconsistent"));      
-   }
-   IPosition blc3(dimIn+1,0);
-   IPosition trc3(section.length()-1);
-   IPosition stride3(dimIn+1,1);
-
-
-// The underlying lattice section - it never changes
-
-   Slicer section2(section.start().getFirst(dimIn), section.end().getFirst(dimIn), 
-                   section.stride().getFirst(dimIn), Slicer::endIsLast);
-//
-   buffer.resize(section.length());
-
-// We are looping over the last axis of the concatenated lattice
-// Each input lattice contributes just one pixel to that axis
-
-   uInt k = 0;
-   for (Int i=section.start()(axis_p); i<=section.end()(axis_p); i+=section.stride()(axis_p)) {
-       Array<T> buf = lattices_p[i]->getSlice(section2);
-//
-       blc3(axis_p) = k;
-       trc3(axis_p) = k;
-       buffer(blc3, trc3, stride3) = buf.addDegenerate(1);
-       if (tempClose_p) lattices_p[i]->tempClose();
-       k++;
-   }
-
-// Result is a copy
-
-   return False;
-}
-
-
-template <class T>
-Bool LatticeConcat<T>::getSlice2 (Array<T>& buffer,
-                                  const Slicer& section,
-                                  uInt nLattices)
-{
-//cout << "blc, trc, stride=" << section.start() << section.end() << section.stride() << endl;
-
-// Setup positions
-
-   IPosition blc, trc, stride;   
-   IPosition blc2, trc2;
-   IPosition blc3, trc3, stride3;
-   setup1 (blc, trc, stride, blc2, trc2, blc3, trc3, stride3, section);
-//
-   buffer.resize(section.length());
-//cout << "Buffer shape = " << buffer.shape() << endl;
-//
-   Int start = 0;
-   Bool first = True;
-   Slicer section2;
-//
-   for (uInt i=0; i<nLattices; i++) {
-
-//cout << "Lattice shape = " << lattices_p[i]->shape() << endl;
-
-// Find start and end of this lattice inside the concatenated lattice
-
-      Int shape2 = lattices_p[i]->shape()(axis_p);
-      Int end = start + shape2 - 1;
-//
-      if (! (blc(axis_p)>end || trc(axis_p)<start)) {
-
-// Find section of input Lattice to copy
-
-         section2 = setup2(first, blc2, trc2, shape2, axis_p, blc, trc, 
-                           stride, start);
-
-// Put it in output buffer
-
-//cout << "blc2, trc2, stride2, shape = " 
-//     << section2.start() << section2.end() << section2.stride() << section2.length() << endl;
-
-         trc3(axis_p) = blc3(axis_p) + section2.length()(axis_p) - 1;
+std::vector<typename LatticeConcat<T>::SlicePart>
+LatticeConcat<T>::findParts (const Slicer& section) const
+{
+   const IPosition& blc = section.start();
+   const IPosition& trc = section.end();
+   const IPosition& stride = section.stride();
+   std::vector<SlicePart> parts;
+   SlicePart part;
+   part.blc = IPosition(blc.nelements(), 0);
+   part.trc = section.length() - 1;
+   if (dimUpOne_p) {
 
-//IPosition sh(Slicer(blc3, trc3, stride3, Slicer::endIsLast).length());
-//cout << "blc3, trc3, stride3, shape = " << blc3 << trc3 << stride3  << sh << endl << endl;
+// Each lattice contributes one pixel to the last axis of the concatenated
+// lattice. The section in the lattices is the same for all of them.
 
-         buffer(blc3, trc3, stride3) = lattices_p[i]->getSlice(section2);
-         blc3(axis_p) += section2.length()(axis_p);
+      if (trc(axis_p)+1 > Int(lattices_p.nelements())) {
+         throw(AipsError("Number of lattices and requested slice are inconsistent"));      
       }
-      start += shape2;
-      if (tempClose_p) lattices_p[i]->tempClose();
-   }
-
-// Result is a copy
-
-   return False;
-}
-
-
-template <class T>
-Bool LatticeConcat<T>::putSlice1 (const Array<T>& buffer, const IPosition& where,
-                                  const IPosition& stride, uInt nLattices)
-{
-   const uInt dimIn = axis_p;
-
-// The concatenated Lattice section
-
-   Slicer section(where, buffer.shape(), stride, Slicer::endIsLength);
-   if (section.end()(axis_p)+1 > Int(nLattices)) {
-      throw(AipsError("Number of lattices and given data buffer are inconsistent"));
-   }
-//      
-   IPosition blc3(dimIn+1,0);
-   IPosition trc3(section.length()-1);
-   IPosition stride3(dimIn+1,1);
-
-// The underlying Lattice section. It never changes
-   
-   Slicer section2(section.start().getFirst(dimIn), section.end().getFirst(dimIn),
-                   section.stride().getFirst(dimIn), Slicer::endIsLast);
-
-// We are looping over the last axis of the concatenated lattice
-// Each input lattice contributes just one pixel to that axis
-                                  
-   uInt k = 0;
-   for (Int i=section.start()(axis_p); i<=section.end()(axis_p); i+=section.stride()(axis_p)) {
-      blc3(axis_p) = k;
-      trc3(axis_p) = k;
-      Array<T> buf0(buffer);
-      lattices_p[i]->putSlice(buf0(blc3, trc3, stride3).nonDegenerate(axis_p-1), 
-                              section2.start(), section2.stride());
-      if (tempClose_p) lattices_p[i]->tempClose();
-      k++;
-   }
-//  
-   return True;
-}
-
-
-template <class T>
-Bool LatticeConcat<T>::putSlice2 (const Array<T>& buffer, const IPosition& where,
-                                  const IPosition& strider, uInt nLattices)
-{
-
-// Make a Slicer for the region to be put so we can reuse the functions
-// for setting locations used in the getSlice functions
-// Objects blc and stride will duplicate where and strider respectively
-
-//cout << "Buffer shape = " << buffer.shape() << endl;
-
-   Slicer section(where, buffer.shape(), strider, Slicer::endIsLength);
-
-//cout << "Section = " << section << endl;
-
-// Setup positions
-
-   IPosition blc, trc, stride;   
-   IPosition blc2, trc2;
-   IPosition blc3, trc3, stride3;
-   setup1 (blc, trc, stride, blc2, trc2, blc3, trc3, stride3, section);
-//
-   Int start = 0;
-   Bool first = True;
-   Slicer section2;
-//
-   for (uInt i=0; i<nLattices; i++) {
-//cout << "Lattice " << i << " shape = " << lattices_p[i]->shape() << endl;
-
-// Find start and end of this lattice inside the concatenated lattice
-
-      Int shape2 = lattices_p[i]->shape()(axis_p);
-      Int end = start + shape2 - 1;
-//
-      if (! (blc(axis_p)>end || trc(axis_p)<start)) {
-
-//cout << "Lattice included" << endl;
-
-// Find section of input Lattice to put in coordinates of that lattice
-
-         section2 = setup2(first, blc2, trc2, shape2, axis_p, blc, trc, 
-                           stride, start);
-
-// Put it in lattice
-
-//cout << "blc2, trc2, stride2, shape = " 
-//     << section2.start() << section2.end() << section2.stride() << section2.length() << endl;
-
-         trc3(axis_p) = blc3(axis_p) + section2.length()(axis_p) - 1;
-
-//IPosition sh(Slicer(blc3, trc3, stride3, Slicer::endIsLast).length());
-//cout << "blc3, trc3, stride3, shape = " << blc3 << trc3 << stride3  << sh << endl << endl;
-
-         Array<T> buf(buffer);
-         lattices_p[i]->putSlice(buf(blc3, trc3, stride3), blc2, stride);
-         if (tempClose_p) lattices_p[i]->tempClose();
-//
-         blc3(axis_p) += section2.length()(axis_p);
+      part.section = Slicer(blc.getFirst(axis_p), trc.getFirst(axis_p),
+                            stride.getFirst(axis_p), Slicer::endIsLast);
+      Int k = 0;
+      for (Int i=blc(axis_p); i<=trc(axis_p); i+=stride(axis_p)) {
+         part.lattice = i;
+         part.blc(axis_p) = k;
+         part.trc(axis_p) = k;
+         parts.push_back (part);
+         k++;
       }
-      start += shape2;
+      return parts;
    }
-//
-   return True;
-}
-
 
-template <class T>
-Bool LatticeConcat<T>::getMaskSlice1 (Array<Bool>& buffer,
-                                      const Slicer& section,
-                                      uInt nLattices)
-{
-   const uInt dimIn = axis_p;
-
-// The concatenated lattice section
+// Find the lattice containing the first pixel and step through the
+// lattices until the last pixel.
 
-   if (section.end()(axis_p)+1 > Int(nLattices)) {
-      throw(AipsError("Number of lattices and requested slice are inconsistent"));
-   }
-   IPosition blc3(dimIn+1,0);
-   IPosition trc3(section.length()-1);
-   IPosition stride3(dimIn+1,1);
+   uInt i = std::upper_bound (partStart_p.begin(), partStart_p.end(),
+                              blc(axis_p)) - partStart_p.begin() - 1;
+   IPosition blc2(blc);
+   IPosition trc2(trc);
+   Int pos = 0;
+   for (; i<lattices_p.nelements() && partStart_p[i]<=trc(axis_p); i++) {
+      const Int start = partStart_p[i];
 
+// The first pixel in this lattice taking the stride into account.
 
-// The underlying lattice section - it never changes
-   
-   Slicer section2(section.start().getFirst(dimIn), section.end().getFirst(dimIn),
-                   section.stride().getFirst(dimIn), Slicer::endIsLast);
-//
-   buffer.resize(section.length());
-
-// We are looping over the last axis of the concatenated lattice
-// Each input lattice contributes just one pixel to that axis
-                                  
-   uInt k = 0;
-   for (Int i=section.start()(axis_p); i<=section.end()(axis_p); i+=section.stride()(axis_p)) {
-       blc3(axis_p) = k;
-       trc3(axis_p) = k;
-       Array<Bool> buf = lattices_p[i]->getMaskSlice(section2);
-       buffer(blc3, trc3, stride3) = buf.addDegenerate(1);
-       if (tempClose_p) lattices_p[i]->tempClose();
-       k++;
+      Int first = blc(axis_p);
+      if (first < start) {
+         first += (start - first + stride(axis_p) - 1) / stride(axis_p) *
+                  stride(axis_p);
+      }
+      const Int last = min(trc(axis_p), partStart_p[i+1] - 1);
+      if (first <= last) {
+         blc2(axis_p) = first - start;
+         trc2(axis_p) = last - start;
+         part.lattice = i;
+         part.section = Slicer(blc2, trc2, stride, Slicer::endIsLast);
+         const Int n = (last - first) / stride(axis_p) + 1;
+         part.blc(axis_p) = pos;
+         part.trc(axis_p) = pos + n - 1;
+         pos += n;
+         parts.push_back (part);
+      }
    }
-
-// Result is a copy
-
-   return False;
+   return parts;
 }
- 
-
 
 template <class T>
-Bool LatticeConcat<T>::getMaskSlice2 (Array<Bool>& buffer,
-                                      const Slicer& section,
-                                      uInt nLattices)
+template <class U, class GetFunc>
+void LatticeConcat<T>::getParts (Array<U>& buffer, const Slicer& section,
+                                 GetFunc get)
 {
+   const std::vector<SlicePart> parts = findParts (section);
+   buffer.resize (section.length());
 
-// Setup positions
-
-   IPosition blc, trc, stride;   
-   IPosition blc2, trc2;
-   IPosition blc3, trc3, stride3;
-   setup1 (blc, trc, stride, blc2, trc2, blc3, trc3, stride3, section);
-//
-   buffer.resize(section.length());
-//
-   Int start = 0;
-   Bool first = True;
-   Slicer section2;
-//
-   for (uInt i=0; i<nLattices; i++) {
-
-// Find start and end of this lattice inside the concatenated lattice
-
-      Int shape2 = lattices_p[i]->shape()(axis_p);
-      Int end = start + shape2 - 1;
-//
-      if (! (blc(axis_p)>end || trc(axis_p)<start)) {
-
-// Whack slice into the output
+// Each part is read into its own section of the buffer, so the parts
+// can be read by different threads.
 
-         section2 = setup2(first, blc2, trc2, shape2, axis_p, blc, trc, 
-                           stride, start);
-//
-         trc3(axis_p) = blc3(axis_p) + section2.length()(axis_p) - 1;
-         buffer(blc3, trc3, stride3) = lattices_p[i]->getMaskSlice(section2);
-         if (tempClose_p) lattices_p[i]->tempClose();
-//
-         blc3(axis_p) += section2.length()(axis_p);
+   auto getPart = [&] (size_t j)
+   {
+      const SlicePart& part = parts[j];
+      Array<U> data = get (part.lattice, part.section);
+      Array<U> out(buffer(part.blc, part.trc));
+      if (dimUpOne_p) {
+         out = data.addDegenerate(1);
+      } else {
+         out = data;
+      }
+      if (tempClose_p) lattices_p[part.lattice]->tempClose();
+   };
+   const uInt nthread = (parts.size() > 1  ?  readNThreads() : 1);
+   if (nthread <= 1) {
+      for (size_t j=0; j<parts.size(); j++) {
+         getPart (j);
       }
-      start += shape2;
+   } else {
+      ThreadPool::global().parallelFor (parts.size(), getPart, nthread);
    }
-
-// Result is a copy
-
-   return False;
 }
 
 } //# NAMESPACE CASACORE - END
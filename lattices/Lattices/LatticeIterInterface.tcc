@@ -33,6 +33,7 @@
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/Cube.h>
 #include <casacore/casa/Utilities/DefaultValue.h>
+#include <casacore/casa/OS/ProfileRegistry.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 
@@ -135,6 +136,9 @@ LatticeIterInterface<T>* LatticeIterInterface<T>::clone() const
 template<class T>
 Bool LatticeIterInterface<T>::operator++(int)
 {
+  static ProfileCounter& moveCounter =
+    ProfileRegistry::counter ("LatticeIterator.move");
+  ProfileTimer timer(moveCounter);
   if (itsRewrite) {
     rewriteData();
   }
@@ -149,6 +153,9 @@ Bool LatticeIterInterface<T>::operator++(int)
 template<class T>
 Bool LatticeIterInterface<T>::operator--(int)
 {
+  static ProfileCounter& moveCounter =
+    ProfileRegistry::counter ("LatticeIterator.move");
+  ProfileTimer timer(moveCounter);
   if (itsRewrite) {
     rewriteData();
   }
@@ -328,6 +328,14 @@ public:
   const Cube<T>& cubeCursor() const; 
   const Array<T>& cursor() const; 
   // </group>
+
+  // Return the cursor as a non-owning
+  // <linkto class=ArrayView>ArrayView</linkto> with N dimensions,
+  // which can be passed around without reference counting.
+  // An exception is thrown if the cursor does not have N dimensions.
+  // The view is valid until the iterator is moved.
+  template<size_t N>
+  ArrayView<const T,N> cursorView() const;
   
   // Function which checks the internals of the class for consistency.
   // Returns True if everything is fine otherwise returns False.
@@ -496,6 +504,13 @@ public:
   Cube<T>&   woCubeCursor();
   Array<T>&  woCursor();
   //</group>
+
+  // Return the cursor as a non-owning writable
+  // <linkto class=ArrayView>ArrayView</linkto> with N dimensions.
+  // As <src>rwCursor</src>, it reads the data if needed, and marks the
+  // cursor as changed so it gets written when the iterator is moved.
+  template<size_t N>
+  ArrayView<T,N> rwCursorView();
   
   // Function which checks the internals of the class for consistency.
   // Returns True if everything is fine. Otherwise returns False.
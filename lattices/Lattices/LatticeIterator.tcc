@@ -36,6 +36,7 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/ArrayView.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Utilities/Assert.h> 
 #include <casacore/casa/Exceptions/Error.h>
@@ -208,6 +209,13 @@ const Array<T>& RO_LatticeIterator<T>::cursor() const
   return itsIterPtr->cursor (True, False);
 }
 
+template <class T>
+template <size_t N>
+ArrayView<const T,N> RO_LatticeIterator<T>::cursorView() const
+{
+  return ArrayView<const T,N> (cursor());
+}
+
 
 template <class T>
 Bool RO_LatticeIterator<T>::ok() const
@@ -313,6 +321,13 @@ Array<T>& LatticeIterator<T>::rwCursor()
   return itsIterPtr->cursor (True, True);
 }
 
+template <class T>
+template <size_t N>
+ArrayView<T,N> LatticeIterator<T>::rwCursorView()
+{
+  return ArrayView<T,N> (rwCursor());
+}
+
 template <class T>
 Vector<T>& LatticeIterator<T>::woVectorCursor()
 {
@@ -27,6 +27,7 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <algorithm>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -106,5 +107,72 @@ Bool LatticeNavigator::ok() const
   return True;
 }
 
+std::vector<std::unique_ptr<LatticeNavigator>>
+LatticeNavigator::split (uInt n) const
+{
+  std::vector<std::unique_ptr<LatticeNavigator>> parts;
+  // Find the axis to split; prefer the slowest varying one.
+  const IPosition& path = axisPath();
+  std::vector<Int64> starts;
+  Int64 splitAxis = -1;
+  for (Int i=path.nelements()-1; i>=0  &&  n>1; --i) {
+    std::vector<Int64> st = stepStarts (path[i]);
+    if (st.size() > starts.size()) {
+      starts.swap (st);
+      splitAxis = path[i];
+      if (starts.size() > n) {
+        break;
+      }
+    }
+  }
+  if (splitAxis < 0  ||  starts.size() <= 2) {
+    parts.push_back (std::unique_ptr<LatticeNavigator>(clone()));
+    return parts;
+  }
+  // Divide the steps evenly over the parts.
+  const Int64 nstep = starts.size() - 1;
+  const Int64 npart = std::min (Int64(n), nstep);
+  const IPosition subBlc = blc();
+  const IPosition subInc = increment();
+  for (Int64 i=0; i<npart; ++i) {
+    IPosition partBlc = subBlc;
+    IPosition partTrc = trc();
+    partBlc[splitAxis] = subBlc[splitAxis] +
+                         starts[i*nstep/npart] * subInc[splitAxis];
+    partTrc[splitAxis] = subBlc[splitAxis] +
+                         (starts[(i+1)*nstep/npart] - 1) * subInc[splitAxis];
+    LatticeNavigator* part = clone();
+    parts.push_back (std::unique_ptr<LatticeNavigator>(part));
+    part->subSection (partBlc, partTrc, subInc);
+  }
+  return parts;
+}
+
+std::vector<Int64> LatticeNavigator::stepStarts (uInt axis) const
+{
+  return std::vector<Int64> {0, subLatticeShape()[axis]};
+}
+
+std::vector<Int64> LatticeNavigator::tileStepStarts (Int64 blc, Int64 inc,
+                                                     Int64 length,
+                                                     Int64 tileLength)
+{
+  // A tile starts at a multiple of the tile length in the main Lattice.
+  // Its first pixel in the sub-Lattice is the first one not before it.
+  std::vector<Int64> starts(1, 0);
+  for (Int64 tileStart = (blc/tileLength + 1) * tileLength; ;
+       tileStart += tileLength) {
+    Int64 start = (tileStart - blc + inc - 1) / inc;
+    if (start >= length) {
+      break;
+    }
+    if (start > starts.back()) {
+      starts.push_back (start);
+    }
+  }
+  starts.push_back (length);
+  return starts;
+}
+
 } //# NAMESPACE CASACORE - END
 
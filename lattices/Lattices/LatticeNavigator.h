@@ -29,6 +29,8 @@
 
 //# Includes
 #include <casacore/casa/aips.h>
+#include <memory>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -151,6 +153,16 @@ class ROTiledStManAccessor;
 // LatticeNavigator->operator++() which might resolve to
 // LatticeStepper->operator++(). Other functions like this are documented in
 // the <linkto class="LatticeIterator">LatticeIterator</linkto> class.
+//
+// A traversal can be split into a number of disjoint parts using the
+// <src>split</src> function. Each part is traversed by its own navigator
+// (a clone of this one restricted to a part of the sub-Lattice), so the
+// parts can be processed in parallel by different threads. The parts are
+// aligned with the cursor steps (thus with the tiles for a TileStepper
+// or TiledLineStepper), so together the parts give exactly the cursor
+// positions of the original traversal. The data of the parts can be read
+// from threads using
+// <linkto class=Lattice>Lattice::getSliceConcurrent</linkto>.
 // </synopsis> 
 
 // <example>
@@ -337,6 +349,15 @@ public:
                               const IPosition& tileShape,
                               uInt maxCacheSize, uInt bucketSize) const = 0;
 
+  // Split the traversal into at most <src>n</src> disjoint parts with
+  // about the same number of cursor steps. Each part is traversed by a
+  // new navigator, which is a clone of this one with its sub-Lattice
+  // restricted to a range of cursor steps on a single axis.
+  // The axis is the slowest varying axis having at least n steps or,
+  // if no such axis, the axis with the most steps.
+  // A single part (a clone) is returned if the traversal cannot be split.
+  std::vector<std::unique_ptr<LatticeNavigator>> split (uInt n) const;
+
   // Function which returns a pointer to dynamic memory of an exact copy 
   // of this LatticeNavigator. It is the responsibility of the caller to
   // release this memory. 
@@ -346,6 +367,19 @@ public:
   // Returns True if everything is fine otherwise returns False. The default
   // implementation always returns True.
   virtual Bool ok() const;
+
+protected:
+  // Get the start positions (relative to the sub-Lattice) of the cursor
+  // steps along the given axis, followed by the length of the axis.
+  // It is used by <src>split</src>. The default implementation returns
+  // a single step, so the axis cannot be split.
+  virtual std::vector<Int64> stepStarts (uInt axis) const;
+
+  // Get the step starts along an axis of a sub-Lattice traversed in tiles,
+  // where <src>blc</src> and <src>inc</src> are the start and increment
+  // of the sub-Lattice in the main Lattice.
+  static std::vector<Int64> tileStepStarts (Int64 blc, Int64 inc,
+                                            Int64 length, Int64 tileLength);
 };
 
 
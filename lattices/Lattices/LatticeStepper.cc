@@ -146,15 +146,7 @@ Bool LatticeStepper::operator++(int)
   if (successful) {
     // test for hang over since cursor has moved.
     if (itsNiceFit == False) {
-      const IPosition curPos(itsCursorPos);
-      const IPosition curEndPos(itsCursorPos+itsCursorShape-1);
-      const IPosition latShape(itsIndexer.shape());
-      const uInt ndim = itsIndexer.ndim();
-      uInt i = 0;
-      while (i < ndim  &&  curEndPos(i) < latShape(i)  &&  curPos(i) >= 0) {
-	i++;
-      }
-      itsHangover =  (i != ndim);
+      itsHangover = hasHangover (1);
     }
   } else {
     itsEnd = True;
@@ -163,6 +155,20 @@ Bool LatticeStepper::operator++(int)
   return successful;
 }
 
+Bool LatticeStepper::hasHangover (Int endOffset) const
+{
+  // Test directly on the IPosition data to avoid creating temporaries.
+  const IPosition& latShape = itsIndexer.shape();
+  const uInt ndim = itsIndexer.ndim();
+  for (uInt i=0; i<ndim; ++i) {
+    if (itsCursorPos[i] < 0  ||
+        itsCursorPos[i] + itsCursorShape[i] - endOffset >= latShape[i]) {
+      return True;
+    }
+  }
+  return False;
+}
+
 Bool LatticeStepper::operator--(int)
 {
   DebugAssert (ok() == True, AipsError);
@@ -177,16 +183,8 @@ Bool LatticeStepper::operator--(int)
 						itsCursorShape, itsAxisPath);
   if (successful) {
     // test for hang over since cursor has moved
-    const IPosition curPos(itsCursorPos);
-    const uInt ndim = itsIndexer.ndim();
     if (itsNiceFit == False) {
-      const IPosition curEndPos(itsCursorPos+itsCursorShape);
-      const IPosition latShape(itsIndexer.shape());
-      uInt i = 0;
-      while (i < ndim  &&  curPos(i) >= 0  &&  curEndPos(i) < latShape(i)) {
-	i++;
-      }
-      itsHangover =  (i != ndim);
+      itsHangover = hasHangover (0);
     }
   } else {
     itsStart = True;
@@ -560,5 +558,17 @@ Bool LatticeStepper::ok() const
   return True;
 }
 
-} //# NAMESPACE CASACORE - END
+std::vector<Int64> LatticeStepper::stepStarts (uInt axis) const
+{
+  // The cursor steps are relative to the blc of the sub-Lattice.
+  const Int64 length = itsIndexer.shape()[axis];
+  const Int64 step = itsCursorShape[axis];
+  std::vector<Int64> starts;
+  for (Int64 start=0; start<length; start+=step) {
+    starts.push_back (start);
+  }
+  starts.push_back (length);
+  return starts;
+}
 
+} //# NAMESPACE CASACORE - END
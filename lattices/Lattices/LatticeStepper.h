@@ -442,6 +442,11 @@ public:
                               const IPosition& tileShape,
                               uInt maxCacheSize, uInt bucketSize) const;
 
+protected:
+  // Get the starts of the cursor steps along an axis (used by
+  // <src>split</src>).
+  virtual std::vector<Int64> stepStarts (uInt axis) const;
+
 private:
   // Prevent the default constructor from being used.
   LatticeStepper();
@@ -449,6 +454,9 @@ private:
   void padCursor();
   // Check if the cursor shape is a factor of the Lattice shape.
   Bool niceFit() const;
+  // Check if the cursor (with its end shifted by -endOffset) hangs over
+  // an edge of the (sub-)Lattice.
+  Bool hasHangover (Int endOffset) const;
 
 
   LatticeIndexer itsIndexer;//# Knows about the (sub)-Lattice shape and how
@@ -242,6 +242,15 @@ public:
   // a region with a mask.
   virtual Bool isMasked() const;
 
+  // Is it cheaply known that the mask is False for the part [start,end]
+  // of the section (the stride is ignored)? If so, the data and mask
+  // of the section need not be read.
+  // False is returned if that is not known.
+  // The default implementation looks at the occupancy summary of the
+  // region (see <linkto class=LCRegion>LCRegion::occupancy</linkto>),
+  // so it handles for example the pixelmask of a <src>PagedImage</src>.
+  virtual Bool isMaskedOut (const Slicer& section) const;
+
   // Does the lattice have a pixelmask?
   // The default implementation returns False.
   virtual Bool hasPixelMask() const;
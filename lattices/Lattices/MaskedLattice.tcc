@@ -30,6 +30,7 @@
 #include <casacore/lattices/Lattices/MaskedLattice.h>
 #include <casacore/lattices/LRegions/LatticeRegion.h>
 #include <casacore/lattices/LRegions/LCBox.h>
+#include <casacore/lattices/LRegions/MaskOccupancy.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Utilities/COWPtr.h>
@@ -83,6 +84,17 @@ Bool MaskedLattice<T>::isMasked() const
   return ptr->hasMask();
 }
 
+template <class T>
+Bool MaskedLattice<T>::isMaskedOut (const Slicer& section) const
+{
+  const LatticeRegion* ptr = getRegionPtr();
+  if (ptr == 0  ||  !ptr->hasMask()
+  ||  section.ndim() != ptr->region().ndim()) {
+    return False;
+  }
+  return ptr->region().occupancy()->allFalse (section);
+}
+
 
 template<class T>
 Bool MaskedLattice<T>::hasPixelMask() const
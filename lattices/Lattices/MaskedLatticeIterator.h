@@ -98,6 +98,23 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // Hence, the optimization put in LatticeExpr is not used.
 // When using a MaskedLatticeIterator the same lattice object is used
 // to get data and mask.
+// <p>
+// Furthermore, the iterator can tell if the mask at the current position
+// is known to be entirely False (see
+// <linkto class=MaskedLattice>MaskedLattice::isMaskedOut</linkto>).
+// Because the data of a cursor are only read when accessed, such
+// cursors can be skipped without any I/O:
+// <srcblock>
+//   RO_MaskedLatticeIterator<Float> iter(lattice);
+//   for (iter.skipMaskedOut(); !iter.atEnd(); iter++, iter.skipMaskedOut()) {
+//     const Array<Float>& array = iter.cursor();
+//     Array<Bool> mask = iter.getMask();
+//   }
+// </srcblock>
+// For a sparse region or pixelmask on a large lattice this avoids most
+// of the reading. Note that the cursors in the skipped part are not
+// processed at all, so it can only be used if fully masked cursors do
+// not contribute to the result.
 // </synopsis>
 
 // <motivation>
@@ -118,6 +135,7 @@ public:
   using RO_LatticeIterator<T>::position;
   using RO_LatticeIterator<T>::endPosition;
   using RO_LatticeIterator<T>::cursorShape;
+  using RO_LatticeIterator<T>::atEnd;
 
 public:
   // The default constructor creates an empty object which is practically
@@ -177,9 +195,18 @@ public:
   Bool isMasked() const
     { return itsMaskLattPtr->isMasked(); }
 
+  // Is the mask for the current position known to be entirely False?
+  Bool isMaskedOut() const;
+
+  // Move forward to the first position (starting at the current one)
+  // whose mask is not known to be entirely False, or to the end.
+  // Neither data nor mask of the skipped positions are read.
+  void skipMaskedOut();
+
   // Get the mask for the current position.
   // It returns the same flag as
   // <linkto class=MaskedLattice>MaskedLattice::getMaskSlice</linkto>.
+  // If the mask is known to be entirely False, it is not read.
   // <group>
   Bool getMask (COWPtr<Array<Bool>>&, Bool removeDegenerateAxes=False) const;
   Bool getMask (Array<Bool>&, Bool removeDegenerateAxes=False) const;
@@ -201,6 +228,9 @@ private:
   // In that case a clone of the original MaskedLattice is used.
   void fillPtr (const MaskedLattice<T>& mlattice);
 
+  // Get the shape of the mask array at the current position.
+  IPosition maskShape (Bool removeDegenerateAxes) const;
+
   // The shared pointer is used for automatic deletion.
   // If not null, it is the same as the normal pointer below.
   std::shared_ptr<MaskedLattice<T>> itsMaskLattShrPtr;
@@ -31,6 +31,8 @@
 #include <casacore/lattices/Lattices/MaskedLatticeIterator.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Utilities/COWPtr.h>
 #include <casacore/casa/Utilities/Assert.h> 
 #include <casacore/casa/Exceptions/Error.h>
 
@@ -129,10 +131,36 @@ void RO_MaskedLatticeIterator<T>::fillPtr (const MaskedLattice<T>& mlattice)
   }
 }
 
+template <class T>
+Bool RO_MaskedLatticeIterator<T>::isMaskedOut() const
+{
+  return itsMaskLattPtr->isMaskedOut (Slicer(position(), endPosition(),
+                                             Slicer::endIsLast));
+}
+
+template <class T>
+void RO_MaskedLatticeIterator<T>::skipMaskedOut()
+{
+  while (!atEnd()  &&  isMaskedOut()) {
+    RO_LatticeIterator<T>::operator++();
+  }
+}
+
+template <class T>
+IPosition RO_MaskedLatticeIterator<T>::maskShape
+                                         (Bool removeDegenerateAxes) const
+{
+  IPosition shape (endPosition() - position() + 1);
+  return removeDegenerateAxes  ?  shape.nonDegenerate() : shape;
+}
+
 template <class T>
 Array<Bool> RO_MaskedLatticeIterator<T>::getMask
                                          (Bool removeDegenerateAxes) const
 {
+  if (isMaskedOut()) {
+    return Array<Bool> (maskShape(removeDegenerateAxes), False);
+  }
   return itsMaskLattPtr->getMaskSlice (Slicer(position(),
 					      endPosition(),
 					      Slicer::endIsLast),
@@ -143,6 +171,11 @@ template <class T>
 Bool RO_MaskedLatticeIterator<T>::getMask (COWPtr<Array<Bool>>& arr,
 					   Bool removeDegenerateAxes) const
 {
+  if (isMaskedOut()) {
+    arr = COWPtr<Array<Bool>> (new Array<Bool>
+                               (maskShape(removeDegenerateAxes), False));
+    return False;
+  }
   return itsMaskLattPtr->getMaskSlice (arr, position(), cursorShape(),
 				       removeDegenerateAxes);
 }
@@ -151,6 +184,11 @@ template <class T>
 Bool RO_MaskedLatticeIterator<T>::getMask (Array<Bool>& arr,
 					   Bool removeDegenerateAxes) const
 {
+  if (isMaskedOut()) {
+    arr.resize (maskShape(removeDegenerateAxes));
+    arr = False;
+    return False;
+  }
   return itsMaskLattPtr->getMaskSlice (arr, position(), cursorShape(),
 				       removeDegenerateAxes);
 }
@@ -90,6 +90,10 @@ void PagedArrIter<T>::setupTileCache()
                                              acc.maximumCacheSize(),
                                              acc.bucketSize(rownr));
   itsData.setCacheSizeInTiles (cacheSize);
+  // Tell how the tiles will be traversed (used for memory-mapped tables).
+  const IPosition blc = itsNavPtr->blc();
+  itsData.adviseAccess (itsNavPtr->cursorShape(), blc,
+                        itsNavPtr->trc() - blc + 1, itsNavPtr->axisPath());
 }
 
 } //# NAMESPACE CASACORE - END
@@ -508,6 +508,29 @@ public:
 				     const IPosition& windowLength,
 				     const IPosition& axisPath);
 
+  // Tell the storage manager how the data will be accessed, so it can
+  // give read-ahead hints if the table uses memory-mapped IO. The arguments
+  // are the same as for <src>setCacheSizeFromPath</src>.
+  // It is done by the PagedArray iterator using its navigator.
+  void adviseAccess (const IPosition& sliceShape,
+                     const IPosition& windowStart,
+                     const IPosition& windowLength,
+                     const IPosition& axisPath);
+
+  // Let <src>getSlice</src> return a reference to the data in the file
+  // instead of a copy if possible (default False).
+  // It is only possible if the table is opened with memory-mapped IO
+  // for the tiled storage manager (see
+  // <linkto class=TSMOption>TSMOption</linkto>), the section is exactly
+  // one tile, and the data are stored in the local format (e.g. big-endian
+  // data on a little-endian machine need conversion).
+  // <br>The returned array must be treated as read-only and must not be
+  // used anymore after the PagedArray is closed or resized.
+  // Note that the COWPtr and by-value versions of <src>getSlice</src>
+  // make a copy when needed, so only the version taking a reference to
+  // an Array is affected.
+  void useMappedTiles (Bool useMapped);
+
   // Clears and frees up the tile cache. The maximum allowed cache size is
   // unchanged from when <src>setMaximumCacheSize</src> was last called.
   virtual void clearCache();
@@ -587,6 +610,8 @@ private:
   void doReopen() const;
   void tempReopen() const;
   // </group>
+  // Tell if the data of the buffer are in a mapped tile.
+  Bool isMappedData (const Array<T>& buffer) const;
 
   mutable Table     itsTable;
           String    itsColumnName;
@@ -598,6 +623,7 @@ private:
           TableLock itsLockOpt;
   mutable ArrayColumn<T>       itsArray;
   mutable ROTiledStManAccessor itsAccessor;
+          Bool      itsUseMapped;
 };
 
 
@@ -56,7 +56,8 @@ template<class T>
 PagedArray<T>::PagedArray()
 : itsIsClosed   (True),
   itsMarkDelete (False),
-  itsWritable   (False)
+  itsWritable   (False),
+  itsUseMapped  (False)
 {
   // Initializes all private data using their default consructor
 }
@@ -65,7 +66,8 @@ template<class T>
 PagedArray<T>::PagedArray (const TiledShape& shape, const String& filename) 
 : itsColumnName (defaultColumn()),
   itsRowNumber  (defaultRow()),
-  itsIsClosed   (True)
+  itsIsClosed   (True),
+  itsUseMapped  (False)
 {
   makeTable(filename, Table::New);
   makeArray (shape);
@@ -77,7 +79,8 @@ template<class T>
 PagedArray<T>::PagedArray (const TiledShape& shape)
 : itsColumnName (defaultColumn()),
   itsRowNumber  (defaultRow()),
-  itsIsClosed   (True)
+  itsIsClosed   (True),
+  itsUseMapped  (False)
 {
   Path filename=File::newUniqueName(String("./"), String("pagedArray"));
   makeTable (filename.absoluteName(), Table::Scratch);
@@ -93,7 +96,8 @@ PagedArray<T>::PagedArray (const TiledShape& shape, Table& file)
   itsRowNumber  (defaultRow()),
   itsIsClosed   (False),
   itsMarkDelete (False),
-  itsWritable   (file.isWritable())
+  itsWritable   (file.isWritable()),
+  itsUseMapped  (False)
 {
   makeArray (shape);
   setTableType();
@@ -108,7 +112,8 @@ PagedArray<T>::PagedArray (const TiledShape& shape, Table& file,
   itsRowNumber  (rowNumber),
   itsIsClosed   (False),
   itsMarkDelete (False),
-  itsWritable   (file.isWritable())
+  itsWritable   (file.isWritable()),
+  itsUseMapped  (False)
 {
   makeArray (shape);
   setTableType();
@@ -124,7 +129,8 @@ PagedArray<T>::PagedArray (const String& filename)
   itsMarkDelete (False),
   itsWritable   (False),
   itsArray      (itsTable, itsColumnName),
-  itsAccessor   (itsTable, itsColumnName)
+  itsAccessor   (itsTable, itsColumnName),
+  itsUseMapped  (False)
 {
   DebugAssert (ok(), AipsError);
 }
@@ -137,7 +143,8 @@ template<class T> PagedArray<T>::PagedArray (Table& file)
   itsMarkDelete (False),
   itsWritable   (False),
   itsArray      (itsTable, itsColumnName),
-  itsAccessor   (itsTable, itsColumnName)
+  itsAccessor   (itsTable, itsColumnName),
+  itsUseMapped  (False)
 {
   DebugAssert (ok(), AipsError);
 }
@@ -152,7 +159,8 @@ PagedArray<T>::PagedArray (Table& file, const String& columnName,
   itsMarkDelete (False),
   itsWritable   (False),
   itsArray      (itsTable, itsColumnName),
-  itsAccessor   (itsTable, itsColumnName)
+  itsAccessor   (itsTable, itsColumnName),
+  itsUseMapped  (False)
 {
   DebugAssert (ok(), AipsError);
 }
@@ -169,7 +177,8 @@ PagedArray<T>::PagedArray (const PagedArray<T>& other)
   itsWritable   (other.itsWritable),
   itsLockOpt    (other.itsLockOpt),
   itsArray      (other.itsArray),
-  itsAccessor   (other.itsAccessor)
+  itsAccessor   (other.itsAccessor),
+  itsUseMapped  (other.itsUseMapped)
 {
   DebugAssert (ok(), AipsError);
 }
@@ -197,6 +206,7 @@ PagedArray<T>& PagedArray<T>::operator= (const PagedArray<T>& other)
     itsLockOpt    = other.itsLockOpt;
     itsArray.reference(other.itsArray);
     itsAccessor   = other.itsAccessor;
+    itsUseMapped  = other.itsUseMapped;
   }
   DebugAssert (ok(), AipsError);
   return *this;
@@ -270,10 +280,52 @@ template<class T>
 Bool PagedArray<T>::doGetSlice (Array<T>& buffer, const Slicer& section)
 {
   doReopen();
+  // A section of exactly one tile can be referenced in the mapped file.
+  if (itsUseMapped) {
+    if (section.stride().allOne()) {
+      const void* data = itsAccessor.mappedCellSlice (itsColumnName,
+                                                      itsRowNumber,
+                                                      section.start(),
+                                                      section.end());
+      if (data != 0) {
+        buffer.takeStorage (section.length(),
+                            static_cast<T*>(const_cast<void*>(data)), SHARE);
+        return True;
+      }
+    }
+    // The buffer can reference a mapped tile returned by a previous call.
+    // Its data must not be overwritten, so use a new buffer instead.
+    if (isMappedData (buffer)) {
+      buffer.resize();
+    }
+  }
   itsArray.getSlice (itsRowNumber, section, buffer, True);
   return False;
 }
 
+template<class T>
+Bool PagedArray<T>::isMappedData (const Array<T>& buffer) const
+{
+  if (buffer.nelements() == 0) {
+    return False;
+  }
+  // The tiles are mapped in order, so the data are mapped if they are
+  // between the first and last mapped tile.
+  const IPosition shp = shape();
+  const IPosition tileShp = tileShape();
+  const IPosition lastStart = (shp - 1) / tileShp * tileShp;
+  const T* first = static_cast<const T*>
+    (itsAccessor.mappedCellSlice (itsColumnName, itsRowNumber,
+                                  IPosition(shp.nelements(), 0),
+                                  tileShp - 1));
+  const T* last = static_cast<const T*>
+    (itsAccessor.mappedCellSlice (itsColumnName, itsRowNumber,
+                                  lastStart, lastStart + tileShp - 1));
+  const T* data = buffer.data();
+  return first != 0  &&  last != 0  &&  data >= first
+    &&  data < last + tileShp.product();
+}
+
 template<class T>
 void PagedArray<T>::doPutSlice (const Array<T>& sourceArray, 
 				const IPosition& where,
@@ -350,6 +402,23 @@ void PagedArray<T>::setCacheSizeFromPath (const IPosition& sliceShape,
 			    windowLength, axisPath, True);
 }
 
+template<class T>
+void PagedArray<T>::useMappedTiles (Bool useMapped)
+{
+  itsUseMapped = useMapped;
+}
+
+template<class T>
+void PagedArray<T>::adviseAccess (const IPosition& sliceShape,
+                                  const IPosition& windowStart,
+                                  const IPosition& windowLength,
+                                  const IPosition& axisPath)
+{
+  doReopen();
+  itsAccessor.adviseAccess (itsRowNumber, sliceShape, windowStart,
+                            windowLength, axisPath);
+}
+
 template<class T>
 void PagedArray<T>::clearCache()
 {
@@ -56,6 +56,13 @@ class IPosition;
 // <synopsis>
 //  This class enables you to rebin (data are averaged over bin) a MaskedLattice by 
 //  a given factor per axis
+//
+//  The pixels are binned line by line along the first axis. Bin factors 1,
+//  2, 4 and 8 along that axis use specialized kernels the compiler can
+//  unroll and vectorize; masked pixels are excluded by selection instead of
+//  branching. The output pixels of a large section are calculated in
+//  parallel chunks along its outermost axis using the global
+//  <linkto class=ThreadPool>ThreadPool</linkto>.
 // </synopsis>
 
 // <example>
@@ -176,8 +183,24 @@ public:
 private:
   Slicer findOriginalSlicer (const Slicer& section) const;
   void getDataAndMask (const Slicer& section);
-  void bin(const Array<T>& dataIn);
-  void bin(const Array<T>& dataIn, const Array<Bool>& maskIn);
+  // Bin the data (and mask if not null) of the input section into
+  // itsData (and itsMask).
+  void bin (const Array<T>& dataIn, const Array<Bool>* maskIn);
+  // Add the sum and count of the pixels in a line along the first axis
+  // to the output line, where each output pixel gets <src>bin</src> input
+  // pixels (the last one possibly fewer). The kernels have the bin size as
+  // template argument (0 means the run-time size) to make it possible to
+  // unroll and vectorize the loops.
+  // <group>
+  static void binLine (T* sum, uInt* count, const T* data, const Bool* mask,
+                       size_t n, Int bin);
+  template<Int B>
+  static void binLineKernel (T* sum, uInt* count, const T* data,
+                             size_t n, Int bin);
+  template<Int B>
+  static void binLineMaskedKernel (T* sum, uInt* count, const T* data,
+                                   const Bool* mask, size_t n, Int bin);
+  // </group>
 //
   MaskedLattice<T>* itsLatticePtr;
   IPosition itsBin;
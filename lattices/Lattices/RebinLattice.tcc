@@ -29,13 +29,13 @@
 #include <casacore/lattices/Lattices/RebinLattice.h>
 
 #include <casacore/casa/Arrays/ArrayMath.h>
-#include <casacore/lattices/Lattices/ArrayLattice.h>
-#include <casacore/lattices/Lattices/LatticeStepper.h>
-#include <casacore/lattices/Lattices/LatticeIterator.h>
 #include <casacore/casa/Logging/LogIO.h>
+#include <casacore/casa/OS/ThreadPool.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h> 
+#include <algorithm>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -291,9 +291,9 @@ void RebinLattice<T>::getDataAndMask (const Slicer& section)
    if (itsLatticePtr->isMasked()) {
       itsLatticePtr->getMaskSlice(mask, sectionIn);
       itsMask.resize (section.length());
-      bin (data, mask);
+      bin (data, &mask);
    } else {
-      bin (data);
+      bin (data, 0);
    }     
 
 // Remember what is in cache
@@ -303,82 +303,202 @@ void RebinLattice<T>::getDataAndMask (const Slicer& section)
 
 
 template <class T>
-void RebinLattice<T>::bin (const Array<T>& dataIn)
+void RebinLattice<T>::bin (const Array<T>& dataIn, const Array<Bool>* maskIn)
 {
+   const IPosition& shapeIn = dataIn.shape();
+   const IPosition& shapeOut = itsData.shape();
+   const uInt nDim = shapeIn.nelements();
+   Bool deleteData, deleteMask, deleteSum, deleteOutMask;
+   const T* dataPtr = dataIn.getStorage (deleteData);
+   const Bool* maskPtr = 0;
+   if (maskIn) {
+      maskPtr = maskIn->getStorage (deleteMask);
+   }
+   itsData = T(0);
+   T* sumPtr = itsData.getStorage (deleteSum);
+   Bool* outMaskPtr = 0;
+   if (maskIn) {
+      outMaskPtr = itsMask.getStorage (deleteOutMask);
+   }
+   std::vector<uInt> counts (shapeOut.product(), 0);
+   IPosition strideIn (nDim, 1);
+   IPosition strideOut (nDim, 1);
+   for (uInt i=1; i<nDim; i++) {
+      strideIn[i]  = strideIn[i-1] * shapeIn[i-1];
+      strideOut[i] = strideOut[i-1] * shapeOut[i-1];
+   }
 
-// Make Lattice from Array to get decent iterators
-
-   const uInt nDim = dataIn.ndim();
-   LatticeStepper stepper (dataIn.shape(), itsBin, LatticeStepper::RESIZE);
-   ArrayLattice<T> latIn (dataIn);
-   RO_LatticeIterator<T> inIter(latIn, stepper);
-
-// Do it
+// Split the output in chunks along its outermost (non-degenerate) axis.
+// Axis 0 is never split, because the lines are binned along it.
+// Use a thread per 256K input pixels at most.
 
-   IPosition outPos(nDim);
-//
-   for (inIter.reset(); !inIter.atEnd(); inIter++) {
-      const Array<T>& cursor(inIter.cursor());
-      const uInt nSum = cursor.nelements();
-      T sumData = sum(cursor);
-      if (nSum>0) sumData /= nSum;
+   uInt splitAxis = 0;
+   for (uInt i=1; i<nDim; i++) {
+      if (shapeOut[i] > 1) {
+         splitAxis = i;
+      }
+   }
+   size_t nthread = std::min (size_t(ThreadPool::concurrency()),
+                              size_t(shapeIn.product() / 262144));
+   size_t nchunk = 1;
+   if (splitAxis > 0) {
+      nchunk = std::max (size_t(1),
+                         std::min (nthread, size_t(shapeOut[splitAxis])));
+   }
+   const ssize_t nOutSplit = shapeOut[splitAxis];
+   auto doChunk = [&](size_t chunk) {
+      ssize_t outStart = ssize_t(chunk) * nOutSplit / ssize_t(nchunk);
+      ssize_t outEnd   = ssize_t(chunk+1) * nOutSplit / ssize_t(nchunk);
+      IPosition start (nDim, 0);
+      IPosition end (shapeIn);
+      if (splitAxis > 0) {
+         start[splitAxis] = outStart * itsBin[splitAxis];
+         end[splitAxis]   = std::min (outEnd * itsBin[splitAxis],
+                                      shapeIn[splitAxis]);
+      }
+      IPosition pos (start);
+      while (True) {
+         size_t offIn  = 0;
+         size_t offOut = 0;
+         for (uInt i=1; i<nDim; i++) {
+            offIn  += pos[i] * strideIn[i];
+            offOut += pos[i] / itsBin[i] * strideOut[i];
+         }
+         binLine (sumPtr + offOut, counts.data() + offOut, dataPtr + offIn,
+                  (maskPtr ? maskPtr + offIn : 0), shapeIn[0], itsBin[0]);
+         uInt i = 1;
+         for (; i<nDim; i++) {
+            if (++pos[i] < end[i]) {
+               break;
+            }
+            pos[i] = start[i];
+         }
+         if (i >= nDim) {
+            break;
+         }
+      }
 
-// Write output
+// Average. The output pixels of the chunk are contiguous, because the
+// axes after the split axis have length 1.
 
-      const IPosition& inPos = inIter.position();
-      outPos = inPos / itsBin;
-      itsData(outPos) = sumData;
+      size_t stOut = (splitAxis > 0  ?  outStart * strideOut[splitAxis] : 0);
+      size_t endOut = (splitAxis > 0  ?  outEnd * strideOut[splitAxis]
+                                      :  counts.size());
+      for (size_t j=stOut; j<endOut; j++) {
+         if (counts[j] > 0) {
+            sumPtr[j] /= counts[j];
+         }
+         if (outMaskPtr) {
+            outMaskPtr[j] = counts[j] > 0;
+         }
+      }
+   };
+   if (nchunk > 1) {
+      ThreadPool::global().parallelFor (nchunk, doChunk, nthread);
+   } else {
+      doChunk (0);
+   }
+   itsData.putStorage (sumPtr, deleteSum);
+   if (maskIn) {
+      itsMask.putStorage (outMaskPtr, deleteOutMask);
+      maskIn->freeStorage (maskPtr, deleteMask);
    }
+   dataIn.freeStorage (dataPtr, deleteData);
 }
 
-
 template <class T>
-void RebinLattice<T>::bin (const Array<T>& dataIn, const Array<Bool>& maskIn)
+void RebinLattice<T>::binLine (T* sum, uInt* count, const T* data,
+                               const Bool* mask, size_t n, Int bin)
 {
-
-// Make Lattice from Array to get decent iterators
-
-   const uInt nDim = dataIn.ndim();
-   ArrayLattice<T> latIn (dataIn);
-   Array<Bool> maskInRef(maskIn);
-
-// Make Lattice iterators
-
-   LatticeStepper stepper (latIn.shape(), itsBin, LatticeStepper::RESIZE);
-   RO_LatticeIterator<T> inIter(latIn, stepper);
-
-// Do it
-
-   IPosition outPos(nDim);
-   Array<Bool> cursorMask;
-//
-   for (inIter.reset(); !inIter.atEnd(); inIter++) {
-      const Array<T>& cursor(inIter.cursor());
-      Array<Bool> cursorMask (maskInRef(inIter.position(),
-                                        inIter.endPosition()));
-
-// Iterate through cursor with STL iterators
-
-      T sumData = 0;
-      Int nSum = 0;
-      typename Array<T>::const_iterator dataIterEnd = cursor.end();
-      typename Array<T>::const_iterator dataIter;
-      typename Array<Bool>::const_iterator maskIter;
-      for (dataIter=cursor.begin(),maskIter=cursorMask.begin();
-           dataIter!=dataIterEnd; ++dataIter,++maskIter) {
-         if (*maskIter) {
-            sumData += *dataIter;
-            nSum++;
-         }
+   if (mask) {
+      switch (bin) {
+      case 1:
+         binLineMaskedKernel<1> (sum, count, data, mask, n, bin);
+         break;
+      case 2:
+         binLineMaskedKernel<2> (sum, count, data, mask, n, bin);
+         break;
+      case 4:
+         binLineMaskedKernel<4> (sum, count, data, mask, n, bin);
+         break;
+      case 8:
+         binLineMaskedKernel<8> (sum, count, data, mask, n, bin);
+         break;
+      default:
+         binLineMaskedKernel<0> (sum, count, data, mask, n, bin);
       }
-      if (nSum>0) sumData /= nSum;
+   } else {
+      switch (bin) {
+      case 1:
+         binLineKernel<1> (sum, count, data, n, bin);
+         break;
+      case 2:
+         binLineKernel<2> (sum, count, data, n, bin);
+         break;
+      case 4:
+         binLineKernel<4> (sum, count, data, n, bin);
+         break;
+      case 8:
+         binLineKernel<8> (sum, count, data, n, bin);
+         break;
+      default:
+         binLineKernel<0> (sum, count, data, n, bin);
+      }
+   }
+}
 
-// Write output (perhaps could redo this with an iterator)
+// The values are added in the same order as a sequential sum over the
+// bin, so the result does not depend on the kernel used.
+template <class T>
+template <Int B>
+void RebinLattice<T>::binLineKernel (T* sum, uInt* count, const T* data,
+                                     size_t n, Int bin)
+{
+   const size_t nb = (B > 0  ?  B : bin);
+   const size_t nfull = n / nb;
+   for (size_t j=0; j<nfull; j++) {
+      const T* d = data + j*nb;
+      T acc = sum[j];
+      for (size_t k=0; k<nb; k++) {
+         acc += d[k];
+      }
+      sum[j] = acc;
+      count[j] += nb;
+   }
+   if (nfull*nb < n) {
+      for (size_t k=nfull*nb; k<n; k++) {
+         sum[nfull] += data[k];
+      }
+      count[nfull] += n - nfull*nb;
+   }
+}
 
-      const IPosition& inPos = inIter.position();
-      outPos = inPos / itsBin;
-      itsData(outPos) = sumData;
-      itsMask(outPos) = nSum>0;
+template <class T>
+template <Int B>
+void RebinLattice<T>::binLineMaskedKernel (T* sum, uInt* count,
+                                           const T* data, const Bool* mask,
+                                           size_t n, Int bin)
+{
+   const size_t nb = (B > 0  ?  B : bin);
+   const size_t nfull = n / nb;
+   const T zero(0);
+   for (size_t j=0; j<nfull; j++) {
+      const T* d = data + j*nb;
+      const Bool* m = mask + j*nb;
+      T acc = sum[j];
+      uInt cnt = count[j];
+      for (size_t k=0; k<nb; k++) {
+         acc += (m[k]  ?  d[k] : zero);
+         cnt += m[k];
+      }
+      sum[j] = acc;
+      count[j] = cnt;
+   }
+   for (size_t k=nfull*nb; k<n; k++) {
+      if (mask[k]) {
+         sum[nfull] += data[k];
+         count[nfull]++;
+      }
    }
 }
 
@@ -164,6 +164,11 @@ public:
   // It is if its parent lattice or its region is masked.
   virtual Bool isMasked() const;
 
+  // Is it cheaply known that the mask is False for the section?
+  // It uses the occupancy summary of the region and asks the underlying
+  // lattice if it is a MaskedLattice.
+  virtual Bool isMaskedOut (const Slicer& section) const;
+
   // A SubLattice is persistent if no region is applied to the parent lattice.
   // That is true if the region has the same shape as the parent lattice
   // and the region has no mask.
@@ -226,6 +231,21 @@ public:
   // AND of the given pixelmask and the pixelmask of the underlying lattice.
   void setPixelMask (const Lattice<Bool>& pixelMask, Bool mayExist);
 
+  // Set or get the switch telling if data masked out by the region
+  // should not be read. If set, only the part of a section inside the
+  // box enclosing the True region mask values in the section is read
+  // (using <linkto class=MaskRuns>MaskRuns</linkto>). Other data values
+  // are set to zero. It saves a lot of I/O for statistics and other
+  // masked operations on thin or irregular regions in large lattices.
+  // It is off by default, because the data values under the mask
+  // are not retained.
+  // <group>
+  void setSkipMasked (Bool skip)
+    { itsSkipMasked = skip; }
+  Bool skipMasked() const
+    { return itsSkipMasked; }
+  // </group>
+
   // Get a pointer the region/mask object describing this sublattice.
   virtual const LatticeRegion* getRegionPtr() const;
 
@@ -314,6 +334,9 @@ protected:
 
 
 private:
+  // Get data from the lattice.
+  Bool getLatticeSlice (Array<T>& buffer, const Slicer& section);
+
   // Get mask data from region and mask.
   // <group>
   Bool getRegionDataSlice (Array<Bool>& buffer, const Slicer& section);
@@ -329,6 +352,7 @@ private:
   LatticeRegion     itsRegion;
   Bool              itsWritable;
   Bool              itsHasLattPMask;   //# has underlying lattice a pixelmask?
+  Bool              itsSkipMasked;     //# do not read masked out data?
   Lattice<Bool>*    itsPixelMask;      //# AND of lattice and own pixelmask
   Lattice<Bool>*    itsOwnPixelMask;   //# own pixelmask
   AxesSpecifier     itsAxesSpec;
@@ -30,6 +30,8 @@
 #include <casacore/lattices/Lattices/LatticeIterInterface.h>
 #include <casacore/lattices/LEL/LatticeExpr.h>
 #include <casacore/lattices/LRegions/LCRegion.h>
+#include <casacore/lattices/LRegions/MaskRuns.h>
+#include <casacore/lattices/LRegions/MaskOccupancy.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
@@ -43,6 +45,7 @@ SubLattice<T>::SubLattice()
   itsMaskLatPtr   (0),
   itsWritable     (False),
   itsHasLattPMask (False),
+  itsSkipMasked   (False),
   itsPixelMask    (0),
   itsOwnPixelMask (0)
 {}
@@ -174,6 +177,7 @@ SubLattice<T>::SubLattice (const SubLattice<T>& other)
 : MaskedLattice<T>(),
   itsLatticePtr   (0),
   itsMaskLatPtr   (0),
+  itsSkipMasked   (False),
   itsPixelMask    (0),
   itsOwnPixelMask (0)
 {
@@ -213,6 +217,7 @@ SubLattice<T>& SubLattice<T>::operator= (const SubLattice<T>& other)
       itsOwnPixelMask = other.itsOwnPixelMask->clone();
     }
     itsHasLattPMask = other.itsHasLattPMask;
+    itsSkipMasked = other.itsSkipMasked;
     itsAxesMap = other.itsAxesMap;
   }
   return *this;
@@ -230,6 +235,7 @@ void SubLattice<T>::setPtr (Lattice<T>* latticePtr,
 			    Bool writableIfPossible)
 {
   itsHasLattPMask = False;
+  itsSkipMasked   = False;
   itsPixelMask    = 0;
   itsOwnPixelMask = 0;
   if (maskLatPtr == 0) {
@@ -411,6 +417,19 @@ void SubLattice<T>::setPixelMask (const Lattice<Bool>& pixelMask,
   itsOwnPixelMask = pixelMask.clone();
 }
 
+template<class T>
+Bool SubLattice<T>::isMaskedOut (const Slicer& section) const
+{
+  Slicer regSect (itsAxesMap.isRemoved()  ?
+                  itsAxesMap.slicerToOld (section) : section);
+  if (itsRegion.hasMask()
+  &&  itsRegion.region().occupancy()->allFalse (regSect)) {
+    return True;
+  }
+  return (itsMaskLatPtr != 0
+          &&  itsMaskLatPtr->isMaskedOut (itsRegion.convert (regSect)));
+}
+
 template<class T>
 const LatticeRegion* SubLattice<T>::getRegionPtr() const
 {
@@ -432,6 +451,42 @@ String SubLattice<T>::name (Bool stripPath) const
 template<class T>
 Bool SubLattice<T>::doGetSlice (Array<T>& buffer,
 				const Slicer& section)
+{
+  if (itsSkipMasked  &&  itsRegion.hasMask()) {
+    // Find the part of the section containing data inside the region.
+    Slicer regSect (itsAxesMap.isRemoved()  ?
+                    itsAxesMap.slicerToOld (section) : section);
+    if (regSect.stride().allOne()) {
+      IPosition blc, trc;
+      if (! itsRegion.region().maskRuns().findBox (blc, trc, regSect)) {
+        buffer.resize (section.length());
+        buffer = T();
+        return False;
+      }
+      IPosition partShape (trc - blc + 1);
+      if (partShape.product() < regSect.length().product()) {
+        blc -= regSect.start();
+        trc -= regSect.start();
+        if (itsAxesMap.isRemoved()) {
+          blc = itsAxesMap.posToNew (blc);
+          trc = itsAxesMap.posToNew (trc);
+        }
+        buffer.resize (section.length());
+        buffer = T();
+        Array<T> part (buffer(blc, trc));
+        Array<T> tmp;
+        getLatticeSlice (tmp, Slicer(section.start() + blc, part.shape()));
+        part = tmp;
+        return False;
+      }
+    }
+  }
+  return getLatticeSlice (buffer, section);
+}
+
+template<class T>
+Bool SubLattice<T>::getLatticeSlice (Array<T>& buffer,
+				     const Slicer& section)
 {
   if (! itsAxesMap.isRemoved()) {
     return itsLatticePtr->getSlice (buffer, itsRegion.convert (section));
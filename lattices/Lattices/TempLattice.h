@@ -140,6 +140,11 @@ public:
   // it can use up to 25% of the memory on your machine as defined in aipsrc
   // (this algorithm may change). Setting maxMemoryInMB to zero will force
   // the lattice to disk.
+  // <br>If maxMemoryInMB is negative and a process-wide
+  // <linkto class=TempLatticeBudget>TempLatticeBudget</linkto> is set,
+  // the lattice starts in memory if it fits in the budget. Its data can be
+  // moved to disk later when memory is needed for other temporary lattices,
+  // and back into memory when memory has become free again.
   // <group>
   explicit TempLattice (const TiledShape& shape, Int maxMemoryInMB=-1)
     : itsImpl (new TempLatticeImpl<T>(shape, maxMemoryInMB)) {}
@@ -0,0 +1,210 @@
+//# TempLatticeBudget.cc: Process-wide memory budget for temporary lattices
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/lattices/Lattices/TempLatticeBudget.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+std::atomic<uInt64> TempLatticeBudget::theirReleaseCount (0);
+
+// The budget is initialized from aipsrc at first use.
+static std::atomic<uInt> theirBudget (0);
+static std::once_flag theirInitFlag;
+// The clock used to order the accesses of the lattices.
+static std::atomic<uInt64> theirClock (0);
+// The mutex guards the set of lattices, the used size and the sizes
+// accounted for the lattices.
+static std::mutex theirMutex;
+static std::set<TempLatticeBudgetEntry*> theirEntries;
+static uInt64 theirUsed = 0;
+
+static void initBudget()
+{
+  Int nMiB;
+  AipsrcValue<Int>::find (nMiB, "lattice.templattice.budget", 0);
+  theirBudget = std::max (nMiB, 0);
+}
+
+
+TempLatticeBudgetEntry::TempLatticeBudgetEntry()
+  : itsOwner          (std::this_thread::get_id()),
+    itsBudgetBytes    (0),
+    itsSpillRequested (False)
+{
+  itsAccessTime[0] = 0;
+  itsAccessTime[1] = 0;
+}
+
+TempLatticeBudgetEntry::~TempLatticeBudgetEntry()
+{}
+
+
+void TempLatticeBudget::account (TempLatticeBudgetEntry* entry, uInt64 nbytes)
+{
+  theirUsed -= entry->itsBudgetBytes;
+  entry->itsBudgetBytes = nbytes;
+  theirUsed += nbytes;
+}
+
+uInt64 TempLatticeBudget::reclaim (uInt64 needed,
+                                   TempLatticeBudgetEntry* requester,
+                                   Bool colderOnly)
+{
+  uInt64 key = std::numeric_limits<uInt64>::max();
+  if (requester  &&  colderOnly) {
+    key = requester->itsAccessTime[1];
+  }
+  std::vector<TempLatticeBudgetEntry*> victims;
+  for (TempLatticeBudgetEntry* entry : theirEntries) {
+    if (entry != requester  &&  entry->itsBudgetBytes > 0  &&
+        entry->itsAccessTime[1] < key) {
+      victims.push_back (entry);
+    }
+  }
+  // Coldest first; the most recent access decides for equal lattices.
+  std::sort (victims.begin(), victims.end(),
+             [] (const TempLatticeBudgetEntry* a,
+                 const TempLatticeBudgetEntry* b)
+             { return a->itsAccessTime[1] < b->itsAccessTime[1]  ||
+                 (a->itsAccessTime[1] == b->itsAccessTime[1]  &&
+                  a->itsAccessTime[0] < b->itsAccessTime[0]); });
+  uInt64 freed = 0;
+  std::thread::id self = std::this_thread::get_id();
+  for (TempLatticeBudgetEntry* entry : victims) {
+    // A lattice of this thread can be moved immediately if not referenced.
+    // Otherwise it is moved at its next access.
+    if (entry->itsOwner == self  &&  entry->spillToDisk()) {
+      freed += entry->itsBudgetBytes;
+      account (entry, 0);
+      entry->itsSpillRequested = False;
+      if (freed >= needed) {
+        break;
+      }
+    } else {
+      entry->itsSpillRequested = True;
+    }
+  }
+  return freed;
+}
+
+void TempLatticeBudget::setBudget (uInt nMiB)
+{
+  std::call_once (theirInitFlag, initBudget);
+  theirBudget = nMiB;
+  if (nMiB > 0) {
+    std::lock_guard<std::mutex> lock(theirMutex);
+    uInt64 budgetBytes = uInt64(nMiB) * 1024 * 1024;
+    if (theirUsed > budgetBytes) {
+      reclaim (theirUsed - budgetBytes, 0, False);
+    }
+  }
+  // A higher budget might let lattices on disk move into memory.
+  theirReleaseCount++;
+}
+
+uInt TempLatticeBudget::budget()
+{
+  std::call_once (theirInitFlag, initBudget);
+  return theirBudget;
+}
+
+uInt64 TempLatticeBudget::usedBytes()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  return theirUsed;
+}
+
+Bool TempLatticeBudget::add (TempLatticeBudgetEntry* entry, uInt64 nbytes)
+{
+  uInt64 budgetBytes = uInt64(budget()) * 1024 * 1024;
+  std::lock_guard<std::mutex> lock(theirMutex);
+  theirEntries.insert (entry);
+  touch (*entry);
+  // A new lattice is the hottest one, so others can be moved for it.
+  if (budgetBytes > 0  &&  theirUsed + nbytes > budgetBytes) {
+    if (nbytes > budgetBytes) {
+      return False;
+    }
+    reclaim (theirUsed + nbytes - budgetBytes, entry, False);
+    if (theirUsed + nbytes > budgetBytes) {
+      return False;
+    }
+  }
+  account (entry, nbytes);
+  return True;
+}
+
+void TempLatticeBudget::remove (TempLatticeBudgetEntry* entry)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  if (theirEntries.erase (entry) > 0  &&  entry->itsBudgetBytes > 0) {
+    account (entry, 0);
+    theirReleaseCount++;
+  }
+}
+
+void TempLatticeBudget::touch (TempLatticeBudgetEntry& entry)
+{
+  entry.itsAccessTime[1] = entry.itsAccessTime[0].load();
+  entry.itsAccessTime[0] = ++theirClock;
+}
+
+Bool TempLatticeBudget::acquire (TempLatticeBudgetEntry* entry, uInt64 nbytes)
+{
+  uInt64 budgetBytes = uInt64(budget()) * 1024 * 1024;
+  std::lock_guard<std::mutex> lock(theirMutex);
+  if (theirEntries.find (entry) == theirEntries.end()) {
+    return False;
+  }
+  if (budgetBytes > 0  &&  theirUsed + nbytes > budgetBytes) {
+    if (nbytes > budgetBytes) {
+      return False;
+    }
+    reclaim (theirUsed + nbytes - budgetBytes, entry, True);
+    if (theirUsed + nbytes > budgetBytes) {
+      return False;
+    }
+  }
+  account (entry, nbytes);
+  entry->itsSpillRequested = False;
+  return True;
+}
+
+void TempLatticeBudget::release (TempLatticeBudgetEntry* entry)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  account (entry, 0);
+  entry->itsSpillRequested = False;
+}
+
+} //# NAMESPACE CASACORE - END
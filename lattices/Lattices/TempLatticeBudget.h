@@ -0,0 +1,193 @@
+//# TempLatticeBudget.h: Process-wide memory budget for temporary lattices
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef LATTICES_TEMPLATTICEBUDGET_H
+#define LATTICES_TEMPLATTICEBUDGET_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <atomic>
+#include <thread>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class TempLatticeBudgetEntry;
+
+
+// <summary>
+// Process-wide memory budget for temporary lattices
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tTempLattice">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TempLattice>TempLattice</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Without a budget a TempLattice decides once at construction if it is
+// held in memory or in a scratch table on disk, depending on the free
+// memory at that moment. Thus many temporary lattices made at about the
+// same time can all decide to be held in memory, while a lattice made
+// when memory is used by others is put on disk forever.
+// <p>
+// TempLatticeBudget limits the total memory used by all temporary lattices
+// in the process. A new TempLattice is held in memory if it fits in the
+// budget, where memory is freed by moving the data of the least recently
+// used lattices to disk (using an LRU-2 policy as in
+// <linkto class=TSMCacheBudget>TSMCacheBudget</linkto>).
+// When memory becomes free again (because a lattice is deleted), a lattice
+// moved to disk is brought back into memory at its next access if it fits
+// without having to move hotter lattices to disk.
+// <p>
+// The data of a lattice can only be moved if it is not referenced
+// (e.g. by an iterator cursor or an array obtained with getSlice).
+// Furthermore, a lattice is only moved by the thread that created it,
+// because a TempLattice is not thread-safe. Therefore a lattice that
+// cannot be moved immediately is marked and moved at its next access
+// (if possible). Until then the budget can be exceeded.
+// <p>
+// The budget (in MiB) can be set using <src>setBudget</src> or the aipsrc
+// variable <src>lattice.templattice.budget</src>. The default 0 means that
+// no budget is used, so a TempLattice decides as before.
+// A budget is only applied to a TempLattice not given an explicit
+// maximum memory size.
+// </synopsis>
+
+// <motivation>
+// Image analysis jobs running in a container with a memory limit get
+// killed if too many temporary lattices are held in memory, while
+// forcing them to disk makes them slow.
+// </motivation>
+
+class TempLatticeBudget
+{
+public:
+  // Set the budget in MiB. 0 means no budget.
+  // If lowered, colder lattices are moved to disk as needed.
+  static void setBudget (uInt nMiB);
+
+  // Get the budget in MiB. The initial value is given by the aipsrc
+  // variable <src>lattice.templattice.budget</src> (default 0).
+  static uInt budget();
+
+  // Get the total size (in bytes) of the temporary lattices in memory.
+  static uInt64 usedBytes();
+
+  // Add a lattice needing the given number of bytes in memory.
+  // If needed, memory is freed by moving colder lattices to disk.
+  // It returns False if the lattice does not fit in the budget, in which
+  // case the caller has to put it on disk.
+  static Bool add (TempLatticeBudgetEntry* entry, uInt64 nbytes);
+
+  // Remove a lattice (when it is deleted).
+  static void remove (TempLatticeBudgetEntry* entry);
+
+  // Register an access to the lattice for the LRU-2 policy.
+  static void touch (TempLatticeBudgetEntry& entry);
+
+  // Tell if a lattice on disk might fit in memory again, because memory
+  // has been released since the given release count.
+  static Bool mightFit (uInt64 releaseCount)
+    { return releaseCount != theirReleaseCount; }
+
+  // Get the current release count.
+  static uInt64 releaseCount()
+    { return theirReleaseCount; }
+
+  // Try to get room for a lattice on disk to be moved into memory.
+  // It only succeeds if no hotter lattices have to be moved to disk.
+  static Bool acquire (TempLatticeBudgetEntry* entry, uInt64 nbytes);
+
+  // Tell that the data of a lattice have been moved to disk.
+  static void release (TempLatticeBudgetEntry* entry);
+
+private:
+  // Free at least the given number of bytes by moving other lattices than
+  // the requesting one (which can be null) to disk. If <src>colderOnly</src>
+  // is set, only lattices colder than the requesting one are moved.
+  // It returns the number of bytes actually freed.
+  // The mutex must be locked by the caller.
+  static uInt64 reclaim (uInt64 needed, TempLatticeBudgetEntry* requester,
+                         Bool colderOnly);
+
+  // Set the number of bytes accounted for a lattice.
+  // The mutex must be locked by the caller.
+  static void account (TempLatticeBudgetEntry* entry, uInt64 nbytes);
+
+  // The number of times memory has been released.
+  static std::atomic<uInt64> theirReleaseCount;
+};
+
+
+// <summary>
+// Base class of a temporary lattice managed by TempLatticeBudget
+// </summary>
+
+// <use visibility=local>
+
+// <synopsis>
+// This class holds the information TempLatticeBudget needs about a
+// lattice. The lattice implements <src>spillToDisk</src>.
+// </synopsis>
+
+class TempLatticeBudgetEntry
+{
+public:
+  TempLatticeBudgetEntry();
+
+  virtual ~TempLatticeBudgetEntry();
+
+  // Has TempLatticeBudget asked to move the data to disk?
+  Bool spillRequested() const
+    { return itsSpillRequested; }
+
+protected:
+  // Move the data to disk. It should return False if not possible
+  // (e.g. because the data are referenced).
+  virtual Bool spillToDisk() = 0;
+
+private:
+  friend class TempLatticeBudget;
+
+  // The thread that created the lattice.
+  std::thread::id     itsOwner;
+  // The clock values of the last two accesses.
+  std::atomic<uInt64> itsAccessTime[2];
+  // The number of bytes accounted in the budget.
+  uInt64              itsBudgetBytes;
+  // Has moving the data to disk been requested?
+  std::atomic<Bool>   itsSpillRequested;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
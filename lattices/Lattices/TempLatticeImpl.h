@@ -31,6 +31,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/lattices/Lattices/Lattice.h>
 #include <casacore/lattices/Lattices/TiledShape.h>
+#include <casacore/lattices/Lattices/TempLatticeBudget.h>
 #include <casacore/tables/Tables/Table.h>
 #include <memory>
 
@@ -60,10 +61,18 @@ class Table;
 // This was needed to have a correct implementation of tempClose. Otherwise
 // when deleting a copy of a TempLattice, that destructor would delete the
 // underlying table and the original TempLattice could not reopen it.
+// <p>
+// If a <linkto class=TempLatticeBudget>TempLatticeBudget</linkto> is used
+// and no maximum memory size is given, the lattice is managed by the budget.
+// In that case the data can be moved to disk when memory is needed by
+// other temporary lattices, and moved back into memory when memory has
+// been freed. Data are only moved back if no iterator was made for the
+// lattice while on disk, because such an iterator would continue to use
+// the disk version.
 // </synopsis>
 
 
-template<class T> class TempLatticeImpl
+template<class T> class TempLatticeImpl : public TempLatticeBudgetEntry
 {
 public:
   // The default constructor creates a TempLatticeImpl containing a
@@ -76,6 +85,9 @@ public:
   // it can use up to 25% of the memory on your machine as defined in aipsrc
   // (this algorithm may change). Setting maxMemoryInMB to zero will force
   // the lattice to disk.
+  // If maxMemoryInMB is negative and a
+  // <linkto class=TempLatticeBudget>TempLatticeBudget</linkto> is set,
+  // the budget decides and can move the data later.
   // <group>
   TempLatticeImpl (const TiledShape& shape, Int maxMemoryInMB);
   TempLatticeImpl (const TiledShape& shape, Double maxMemoryInMB);
@@ -197,7 +209,9 @@ public:
   // for general use. 
   LatticeIterInterface<T>* makeIter (const LatticeNavigator& navigator,
                                      Bool useRef) const
-    { doReopen(); return itsLatticePtr->makeIter (navigator, useRef); }
+    { doReopen();
+      itsIterMade = isPaged();
+      return itsLatticePtr->makeIter (navigator, useRef); }
 
   // Do the actual getting of an array of values.
   Bool doGetSlice (Array<T>& buffer, const Slicer& section)
@@ -210,8 +224,10 @@ public:
     { doReopen(); itsLatticePtr->putSlice (sourceBuffer, where, stride); }
   
   // Do the reopen of the table (if not open already).
+  // If managed by the budget, the access is registered and the data are
+  // moved to or from disk if needed.
   void doReopen() const
-    { if (itsIsClosed) tempReopen(); }
+    { if (itsIsClosed || itsUseBudget) tempReopen(); }
 
 private:
   // The copy constructor cannot be used.
@@ -224,16 +240,35 @@ private:
   void init (const TiledShape& shape, Double maxMemoryInMB=-1);
 
   // Do the actual reopen of the temporarily closed table (if not open already).
+  // Also handle the budget.
   void tempReopen() const;
 
+  // Create the scratch table and PagedArray.
+  void makePagedArray (const TiledShape& shape) const;
+
+  // Move the data from memory to disk if not referenced.
+  // It returns False if not possible.
+  // <group>
+  virtual Bool spillToDisk();
+  Bool doSpill() const;
+  // </group>
+
+  // Move the data from disk to memory if not referenced.
+  // It returns False if not possible.
+  Bool doLoad() const;
+
   // Make sure that the temporary table gets deleted.
   void deleteTable();
 
 
   mutable Table                       itsTable;
   mutable std::shared_ptr<Lattice<T>> itsLatticePtr;
-          String                      itsTableName;
+  mutable String                      itsTableName;
   mutable Bool                        itsIsClosed;
+          TiledShape                  itsShape;
+          Bool                        itsUseBudget;
+  mutable Bool                        itsIterMade;     //# iterator on disk data
+  mutable uInt64                      itsReleaseCount; //# last seen by budget
 };
 
 
@@ -29,6 +29,7 @@
 #include <casacore/lattices/Lattices/TempLatticeImpl.h>
 #include <casacore/lattices/Lattices/PagedArray.h>
 #include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/lattices/Lattices/TempLatticeBudget.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/SetupNewTab.h>
 #include <casacore/tables/Tables/TableDesc.h>
@@ -41,20 +42,29 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 template<class T>
 TempLatticeImpl<T>::TempLatticeImpl() 
-  : itsLatticePtr (std::make_shared<ArrayLattice<T>>()),
-    itsIsClosed   (False)
+  : itsLatticePtr   (std::make_shared<ArrayLattice<T>>()),
+    itsIsClosed     (False),
+    itsUseBudget    (False),
+    itsIterMade     (False),
+    itsReleaseCount (0)
 {}
 
 template<class T>
 TempLatticeImpl<T>::TempLatticeImpl (const TiledShape& shape, Int maxMemoryInMB)
-  : itsIsClosed (False)
+  : itsIsClosed     (False),
+    itsUseBudget    (False),
+    itsIterMade     (False),
+    itsReleaseCount (0)
 {
   init (shape, Double(maxMemoryInMB));
 }
 
 template<class T>
 TempLatticeImpl<T>::TempLatticeImpl (const TiledShape& shape, Double maxMemoryInMB)
-  : itsIsClosed (False)
+  : itsIsClosed     (False),
+    itsUseBudget    (False),
+    itsIterMade     (False),
+    itsReleaseCount (0)
 {
   init(shape, maxMemoryInMB);
 }
@@ -62,6 +72,10 @@ TempLatticeImpl<T>::TempLatticeImpl (const TiledShape& shape, Double maxMemoryIn
 template<class T>
 TempLatticeImpl<T>::~TempLatticeImpl()
 {
+  if (itsUseBudget) {
+    TempLatticeBudget::remove (this);
+    itsUseBudget = False;
+  }
   // Reopen to make sure that temporary table gets deleted.
   doReopen();
 }
@@ -69,7 +83,19 @@ TempLatticeImpl<T>::~TempLatticeImpl()
 template<class T>
 void TempLatticeImpl<T>::init (const TiledShape& shape, Double maxMemoryInMB) 
 {
+  itsShape = shape;
   Double memoryReq = Double(shape.shape().product()*sizeof(T))/(1024.0*1024.0);
+  // Without an explicit maximum the budget decides (if used).
+  if (maxMemoryInMB < 0.0  &&  TempLatticeBudget::budget() > 0) {
+    itsUseBudget = True;
+    itsReleaseCount = TempLatticeBudget::releaseCount();
+    if (TempLatticeBudget::add (this, shape.shape().product()*sizeof(T))) {
+      itsLatticePtr = std::make_shared<ArrayLattice<T>>(shape.shape());
+    } else {
+      makePagedArray (shape);
+    }
+    return;
+  }
   Double memoryAvail;
   // maxMemoryInMb = 0.0 forces disk.
   if (maxMemoryInMB < 0.0) {
@@ -78,17 +104,68 @@ void TempLatticeImpl<T>::init (const TiledShape& shape, Double maxMemoryInMB)
     memoryAvail = maxMemoryInMB;
   }
   if (memoryReq > memoryAvail) {
-    // Create a table with a unique name in a work directory.
-    // We can use exclusive locking, since nobody else should use the table.
-    itsTableName = AppInfo::workFileName (Int(memoryReq), "TempLattice");
-    SetupNewTable newtab (itsTableName, TableDesc(), Table::Scratch);
-    itsTable = Table(newtab, TableLock::PermanentLockingWait);
-    itsLatticePtr = std::make_shared<PagedArray<T>>(shape, itsTable);
+    makePagedArray (shape);
   } else {
     itsLatticePtr = std::make_shared<ArrayLattice<T>>(shape.shape());
   }
 }
 
+template<class T>
+void TempLatticeImpl<T>::makePagedArray (const TiledShape& shape) const
+{
+  // Create a table with a unique name in a work directory.
+  // We can use exclusive locking, since nobody else should use the table.
+  Double memoryReq = Double(shape.shape().product()*sizeof(T))/(1024.0*1024.0);
+  String tableName = AppInfo::workFileName (Int(memoryReq), "TempLattice");
+  SetupNewTable newtab (tableName, TableDesc(), Table::Scratch);
+  Table table(newtab, TableLock::PermanentLockingWait);
+  itsLatticePtr = std::make_shared<PagedArray<T>>(shape, table);
+  itsTable      = table;
+  itsTableName  = tableName;
+  itsIterMade   = False;
+}
+
+template<class T>
+Bool TempLatticeImpl<T>::spillToDisk()
+{
+  return doSpill();
+}
+
+template<class T>
+Bool TempLatticeImpl<T>::doSpill() const
+{
+  if (isPaged()  ||  itsLatticePtr.use_count() != 1) {
+    return False;
+  }
+  // The data cannot be moved if referenced by an iterator or array.
+  const ArrayLattice<T>* arrLat =
+    dynamic_cast<const ArrayLattice<T>*>(itsLatticePtr.get());
+  if (arrLat == 0  ||  arrLat->asArray().nrefs() != 1) {
+    return False;
+  }
+  std::shared_ptr<Lattice<T>> arrPtr = itsLatticePtr;
+  makePagedArray (itsShape);
+  itsLatticePtr->put (arrLat->asArray());
+  return True;
+}
+
+template<class T>
+Bool TempLatticeImpl<T>::doLoad() const
+{
+  if (!isPaged()  ||  itsIsClosed  ||  itsIterMade  ||
+      itsLatticePtr.use_count() != 1) {
+    return False;
+  }
+  std::shared_ptr<Lattice<T>> arrPtr =
+    std::make_shared<ArrayLattice<T>>(itsLatticePtr->get());
+  // The table gets deleted when the PagedArray and Table are destructed.
+  itsTable.markForDelete();
+  itsLatticePtr = arrPtr;
+  itsTable = Table();
+  itsTableName = String();
+  return True;
+}
+
 template<class T>
 void TempLatticeImpl<T>::tempClose()
 {
@@ -104,15 +181,38 @@ void TempLatticeImpl<T>::tempClose()
 template<class T>
 void TempLatticeImpl<T>::tempReopen() const
 {
-  if (itsIsClosed && isPaged()) {
-    itsTable = Table(itsTableName,
-                     TableLock(TableLock::PermanentLockingWait),
-                     Table::Update);
-    itsLatticePtr = std::make_shared<PagedArray<T>>(itsTable);
-    itsIsClosed = False;
+  if (itsIsClosed) {
+    if (isPaged()) {
+      itsTable = Table(itsTableName,
+                       TableLock(TableLock::PermanentLockingWait),
+                       Table::Update);
+      itsLatticePtr = std::make_shared<PagedArray<T>>(itsTable);
+      itsIsClosed = False;
+    }
+    if (!itsTable.isNull()) {
+      itsTable.markForDelete();
+    }
   }
-  if (!itsTable.isNull()) {
-    itsTable.markForDelete();
+  if (itsUseBudget) {
+    TempLatticeImpl<T>* This = const_cast<TempLatticeImpl<T>*>(this);
+    TempLatticeBudget::touch (*This);
+    if (spillRequested()) {
+      // Memory is needed by another lattice.
+      if (isPaged()  ||  doSpill()) {
+        TempLatticeBudget::release (This);
+      }
+    } else if (isPaged()  &&  !itsIterMade  &&
+               TempLatticeBudget::mightFit (itsReleaseCount)) {
+      // Memory has been freed, so try to move the data back.
+      itsReleaseCount = TempLatticeBudget::releaseCount();
+      uInt64 nbytes = itsShape.shape().product() * sizeof(T);
+      if (itsLatticePtr.use_count() == 1  &&
+          TempLatticeBudget::acquire (This, nbytes)) {
+        if (!doLoad()) {
+          TempLatticeBudget::release (This);
+        }
+      }
+    }
   }
 }
 
@@ -342,6 +342,7 @@ Bool TileStepper::hangOver() const
 void TileStepper::subSection (const IPosition& blc, const IPosition& trc, 
 			      const IPosition& inc)
 {
+  itsSubSection.fullSize();
   itsSubSection.subSection (blc, trc, inc);
   itsBlc = itsSubSection.offset();
   itsInc = itsSubSection.increment();
@@ -485,5 +486,10 @@ Bool TileStepper::ok() const
   return True;
 }
 
-} //# NAMESPACE CASACORE - END
+std::vector<Int64> TileStepper::stepStarts (uInt axis) const
+{
+  return tileStepStarts (itsBlc[axis], itsInc[axis],
+                         itsSubSection.shape()[axis], itsTileShape[axis]);
+}
 
+} //# NAMESPACE CASACORE - END
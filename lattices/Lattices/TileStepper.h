@@ -261,6 +261,11 @@ public:
                               const IPosition& tileShape,
                               uInt maxCacheSize, uInt bucketSize) const;
 
+protected:
+  // Get the starts of the cursor steps along an axis (used by
+  // <src>split</src>).
+  virtual std::vector<Int64> stepStarts (uInt axis) const;
+
 private:
   // Prevent the default constructor from being used.
   TileStepper();
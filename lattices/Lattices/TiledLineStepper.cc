@@ -377,6 +377,7 @@ void TiledLineStepper::subSection (const IPosition& blc,
 				   const IPosition& trc, 
 				   const IPosition& inc)
 {
+  itsSubSection.fullSize();
   itsSubSection.subSection (blc, trc, inc);
   itsBlc = itsSubSection.offset();
   itsInc = itsSubSection.increment();
@@ -572,5 +573,15 @@ Bool TiledLineStepper::ok() const
   return True;
 }
 
-} //# NAMESPACE CASACORE - END
+std::vector<Int64> TiledLineStepper::stepStarts (uInt axis) const
+{
+  // The line axis is a single step.
+  const Int64 length = itsSubSection.shape()[axis];
+  if (axis == itsAxis) {
+    return std::vector<Int64> {0, length};
+  }
+  return tileStepStarts (itsBlc[axis], itsInc[axis], length,
+                         itsTileShape[axis]);
+}
 
+} //# NAMESPACE CASACORE - END
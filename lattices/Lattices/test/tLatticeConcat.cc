@@ -36,6 +36,7 @@
 #include <casacore/lattices/Lattices/ArrayLattice.h>
 #include <casacore/lattices/LRegions/LCBox.h>
 #include <casacore/lattices/Lattices/LatticeConcat.h>
+#include <casacore/lattices/Lattices/PagedArray.h>
 #include <casacore/lattices/Lattices/SubLattice.h>
 #include <casacore/casa/iostream.h>
 
@@ -714,6 +715,49 @@ int main() {
          check (0, lc, ml1, ml2);
      }
 
+// Read paged lattices in different files concurrently, also with strides
+// not dividing the lattice lengths.
+
+     {
+         cout << "Testing concurrent reads " << endl;
+         IPosition shapeAll(3, 6, 5, 23);
+         Array<Float> arr(shapeAll);
+         indgen(arr);
+         LatticeConcat<Float> lc (2);
+         Int lengths[] = {4, 1, 7, 2, 9};
+         IPosition blc(3, 0);
+         for (uInt i=0; i<5; i++) {
+            IPosition trc(shapeAll-1);
+            trc(2) = blc(2) + lengths[i] - 1;
+            PagedArray<Float> pa(TiledShape(trc-blc+1),
+                                 "tLatticeConcat_tmp.pa" + String::toString(i));
+            pa.put (arr(blc, trc));
+            SubLattice<Float> ml(pa);
+            lc.setLattice(ml);
+            blc(2) = trc(2) + 1;
+         }
+         AlwaysAssert(lc.shape()==shapeAll, AipsError);
+         AlwaysAssert(lc.readNThreads()==1, AipsError);
+         lc.setReadNThreads (3);
+         AlwaysAssert(lc.readNThreads()==3, AipsError);
+         for (Int st=1; st<5; st++) {
+            for (Int start=0; start<5; start++) {
+               Slicer sl(IPosition(3, 1, 0, start), IPosition(3, 5, 4, 21),
+                         IPosition(3, 2, 1, st), Slicer::endIsLast);
+               AlwaysAssert(allEQ(lc.getSlice(sl), arr(sl)), AipsError);
+            }
+         }
+         AlwaysAssert(allEQ(lc.get(), arr), AipsError);
+         Array<Bool> mask = lc.getMask();
+         AlwaysAssert(mask.shape()==shapeAll && allTrue(mask), AipsError);
+
+// The same lattice twice cannot be read concurrently.
+
+         LatticeConcat<Float> lc2 (lc);
+         lc2.setLattice (*lc.lattice(0));
+         AlwaysAssert(lc2.readNThreads()==1, AipsError);
+     }
+
 // Some forced errors
 
       {
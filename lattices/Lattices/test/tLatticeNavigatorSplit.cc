@@ -0,0 +1,200 @@
+//# tLatticeNavigatorSplit.cc: Test program for LatticeNavigator::split
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/lattices/Lattices/LatticeStepper.h>
+#include <casacore/lattices/Lattices/TileStepper.h>
+#include <casacore/lattices/Lattices/TiledLineStepper.h>
+#include <casacore/lattices/Lattices/ArrayLattice.h>
+#include <casacore/lattices/Lattices/PagedArray.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// The cursor positions (blc and trc) of a traversal.
+typedef std::vector<std::vector<Int64>> Cursors;
+
+void addCursors (LatticeNavigator& nav, Cursors& cursors)
+{
+  for (nav.reset(); !nav.atEnd(); nav++) {
+    IPosition pos = nav.position();
+    IPosition end = nav.endPosition();
+    std::vector<Int64> cursor(pos.begin(), pos.end());
+    cursor.insert (cursor.end(), end.begin(), end.end());
+    cursors.push_back (cursor);
+  }
+}
+
+// Check that the parts together give the cursors of the full traversal.
+void checkSplit (const LatticeNavigator& nav, uInt n, uInt nexpect)
+{
+  Cursors full;
+  std::unique_ptr<LatticeNavigator> copy(nav.clone());
+  addCursors (*copy, full);
+  std::vector<std::unique_ptr<LatticeNavigator>> parts = nav.split (n);
+  AlwaysAssertExit (parts.size() == nexpect);
+  Cursors all;
+  for (auto& part : parts) {
+    Cursors cursors;
+    addCursors (*part, cursors);
+    AlwaysAssertExit (cursors.size() > 0);
+    all.insert (all.end(), cursors.begin(), cursors.end());
+  }
+  std::sort (full.begin(), full.end());
+  std::sort (all.begin(), all.end());
+  AlwaysAssertExit (all == full);
+}
+
+void testLatticeStepper()
+{
+  IPosition shape(3, 32, 20, 17);
+  // Cursor with a hangover on all axes.
+  LatticeStepper nav1(shape, IPosition(3, 8, 6, 4));
+  checkSplit (nav1, 1, 1);
+  checkSplit (nav1, 3, 3);
+  checkSplit (nav1, 5, 5);
+  // No axis has 6 steps, so the last axis (5 steps) is used.
+  checkSplit (nav1, 6, 5);
+  // Planes can only be split on the last axis.
+  LatticeStepper nav2(shape, IPosition(3, 32, 20, 1));
+  checkSplit (nav2, 4, 4);
+  checkSplit (nav2, 40, 17);
+  // A single cursor cannot be split.
+  LatticeStepper nav3(shape, shape);
+  checkSplit (nav3, 4, 1);
+  // A sub-Lattice with an increment and another axis path.
+  LatticeStepper nav4(shape, IPosition(3, 3, 2, 2), IPosition(3, 2, 0, 1));
+  nav4.subSection (IPosition(3, 3, 2, 1), IPosition(3, 30, 18, 16),
+                   IPosition(3, 2, 1, 3));
+  checkSplit (nav4, 4, 4);
+  checkSplit (nav4, 7, 7);
+}
+
+void testTileStepper()
+{
+  IPosition shape(3, 32, 20, 17);
+  TileStepper nav1(shape, IPosition(3, 8, 6, 5));
+  checkSplit (nav1, 2, 2);
+  checkSplit (nav1, 4, 4);
+  checkSplit (nav1, 9, 4);
+  TileStepper nav2(shape, IPosition(3, 8, 6, 5), IPosition(3, 2, 0, 1));
+  nav2.subSection (IPosition(3, 3, 2, 1), IPosition(3, 30, 18, 16),
+                   IPosition(3, 2, 1, 3));
+  checkSplit (nav2, 3, 3);
+  // The increment exceeds the tile size on the first axis.
+  TileStepper nav3(shape, IPosition(3, 4, 4, 4));
+  nav3.subSection (IPosition(3, 1, 0, 0), IPosition(3, 31, 19, 16),
+                   IPosition(3, 7, 1, 1));
+  checkSplit (nav3, 2, 2);
+  checkSplit (nav3, 10, 5);
+}
+
+void testTiledLineStepper()
+{
+  IPosition shape(3, 32, 20, 17);
+  TiledLineStepper nav1(shape, IPosition(3, 8, 6, 5), 2);
+  checkSplit (nav1, 3, 3);
+  checkSplit (nav1, 8, 4);
+  TiledLineStepper nav2(shape, IPosition(3, 8, 6, 5), 0);
+  nav2.subSection (IPosition(3, 3, 2, 1), IPosition(3, 30, 18, 16),
+                   IPosition(3, 2, 1, 3));
+  checkSplit (nav2, 2, 2);
+  // Lines along the only split axis cannot be split.
+  TiledLineStepper nav3(IPosition(2, 32, 1), IPosition(2, 8, 1), 0);
+  checkSplit (nav3, 4, 1);
+}
+
+// Sum the lattice in parallel using the split navigator.
+void testConcurrentRead (const Lattice<Float>& lattice,
+                         const LatticeNavigator& nav, Float expect)
+{
+  std::vector<std::unique_ptr<LatticeNavigator>> parts = nav.split (4);
+  std::vector<Double> sums(parts.size(), 0.);
+  ThreadPool::global().parallelFor (parts.size(), [&](size_t i) {
+      LatticeNavigator& part = *parts[i];
+      Array<Float> buffer;
+      for (part.reset(); !part.atEnd(); part++) {
+        lattice.getSliceConcurrent (buffer,
+                                    Slicer(part.position(),
+                                           part.hangOverTrc() + part.blc(),
+                                           Slicer::endIsLast));
+        sums[i] += sum(buffer);
+      }
+    }, parts.size());
+  Double total = 0;
+  for (Double s : sums) {
+    total += s;
+  }
+  AlwaysAssertExit (total == expect);
+}
+
+void testConcurrent()
+{
+  IPosition shape(3, 64, 48, 16);
+  // Use small integer values, so the sums are exact.
+  Array<Float> data(shape);
+  Int v = 0;
+  for (Float& value : data) {
+    value = v++ % 7;
+  }
+  const Float expect = sum(data);
+  {
+    ArrayLattice<Float> lattice(data);
+    testConcurrentRead (lattice, LatticeStepper(shape, IPosition(3,64,48,1)),
+                        expect);
+  }
+  {
+    PagedArray<Float> lattice(TiledShape(shape, IPosition(3,16,16,4)),
+                              "tLatticeNavigatorSplit_tmp.data");
+    lattice.put (data);
+    testConcurrentRead (lattice, TileStepper(shape, IPosition(3,16,16,4)),
+                        expect);
+    testConcurrentRead (lattice,
+                        TiledLineStepper(shape, IPosition(3,16,16,4), 1),
+                        expect);
+    lattice.table().markForDelete();
+  }
+}
+
+int main()
+{
+  try {
+    testLatticeStepper();
+    testTileStepper();
+    testTiledLineStepper();
+    testConcurrent();
+  } catch (std::exception& x) {
+    cout << "Caught exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -38,6 +38,7 @@
 #include <casacore/tables/Tables/SetupNewTab.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/DataMan/TSMOption.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Utilities/COWPtr.h>
 #include <casacore/casa/BasicSL/String.h>
@@ -92,6 +93,43 @@ void testTempClose()
   AlwaysAssert(scratch.getAt(IPosition(3,7)) == 7, AipsError);
 }
 
+// Test getting a slice referencing the memory-mapped file.
+void testMapped()
+{
+  IPosition shape(3,32,32,4);
+  Array<Float> expected(shape);
+  indgen (expected);
+  {
+    PagedArray<Float> pa(TiledShape(shape, IPosition(3,16,16,1)),
+                         "tPagedArray_tmp.map");
+    pa.put (expected);
+  }
+  Table tab("tPagedArray_tmp.map", TableLock(), Table::Old,
+            TSMOption(TSMOption::MMap, 0, 0));
+  PagedArray<Float> pa(tab);
+  Slicer tile(IPosition(3,16,0,2), IPosition(3,16,16,1));
+  Array<Float> buf;
+  AlwaysAssertExit (! pa.getSlice (buf, tile));
+  AlwaysAssertExit (allEQ (buf, expected(tile)));
+  pa.useMappedTiles (True);
+  AlwaysAssertExit (pa.getSlice (buf, tile));
+  AlwaysAssertExit (allEQ (buf, expected(tile)));
+  // A section not matching a tile is copied.
+  Slicer sect(IPosition(3,8,0,2), IPosition(3,16,16,1));
+  AlwaysAssertExit (! pa.getSlice (buf, sect));
+  AlwaysAssertExit (allEQ (buf, expected(sect)));
+  // The by-value version makes a copy.
+  Array<Float> copy = pa.getSlice (tile);
+  copy = 0;
+  AlwaysAssertExit (allEQ (pa.getSlice(tile), expected(tile)));
+  // Iterate over the planes (which advises the access pattern).
+  LatticeIterator<Float> iter(pa, IPosition(3,32,32,1));
+  for (iter.reset(); !iter.atEnd(); iter++) {
+    Slicer plane(iter.position(), iter.cursorShape());
+    AlwaysAssertExit (allEQ (iter.cursor(), expected(plane)));
+  }
+}
+
 
 int main() {
   try {
@@ -270,6 +308,7 @@ int main() {
       AlwaysAssertExit (allEQ(pa.get(), float(2)*arr));
     }
     testTempClose();
+    testMapped();
   } catch (std::exception& x) {
     cerr << x.what() << endl;
     return 1;
@@ -31,11 +31,13 @@
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/lattices/Lattices/MaskedLattice.h> 
 #include <casacore/lattices/Lattices/RebinLattice.h> 
+#include <casacore/lattices/Lattices/ArrayLattice.h>
 #include <casacore/lattices/Lattices/SubLattice.h>
 #include <casacore/lattices/Lattices/TempLattice.h>
 #include <casacore/lattices/Lattices/TiledShape.h>
 #include <casacore/lattices/Lattices/LatticeUtilities.h>
 #include <casacore/casa/Logging/LogIO.h>
+#include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/iostream.h>
@@ -47,6 +49,7 @@ void doit2 ();
 void doit3 ();
 void doit4 (RebinLattice<Float>& rb, const IPosition& shape, 
             const IPosition& factors);
+void doit5 (const IPosition& shape, const IPosition& factors);
 
 
 
@@ -183,6 +186,15 @@ try {
 
    doit3();
 
+// Compare the binning kernels with a straightforward calculation.
+// The larger shapes are binned in parallel chunks.
+
+   doit5 (IPosition(3,17,9,5), IPosition(3,2,3,2));
+   doit5 (IPosition(3,64,11,4), IPosition(3,4,2,3));
+   doit5 (IPosition(3,64,96,100), IPosition(3,8,4,3));
+   doit5 (IPosition(3,130,80,60), IPosition(3,5,1,7));
+   doit5 (IPosition(2,1000,700), IPosition(2,1,4));
+
 
 } catch (std::exception& x) {
      cerr << "aipserror: error " << x.what() << endl;
@@ -378,3 +390,83 @@ void doit4 (RebinLattice<Float>& rb, const IPosition& shape,
    AlwaysAssert(rb.ok(), AipsError);
 }
 
+
+void doit5 (const IPosition& shape, const IPosition& factors)
+{
+   AlwaysAssert (shape.nelements() <= 3, AipsError);
+   IPosition shp3(3, 1);
+   IPosition fac3(3, 1);
+   for (uInt i=0; i<shape.nelements(); i++) {
+      shp3[i] = shape[i];
+      fac3[i] = factors[i];
+   }
+   Array<Float> dataIn(shape);
+   Array<Bool> maskIn(shape);
+   Float* data = dataIn.data();
+   Bool* mask = maskIn.data();
+   for (size_t i=0; i<dataIn.nelements(); i++) {
+      data[i] = Float(i%97) * 0.25 - 5;
+      mask[i] = (i%7 != 3);
+   }
+   // Mask out a part entirely.
+   for (Int i=0; i<std::min(shp3[0], ssize_t(10)); i++) {
+      mask[i] = False;
+   }
+   ArrayLattice<Float> inLat(dataIn);
+   ArrayLattice<Bool> inMask(maskIn);
+   SubLattice<Float> inML(inLat);
+   RebinLattice<Float> rbUnmasked(inML, factors);
+   SubLattice<Float> inMaskedML(inLat);
+   inMaskedML.setPixelMask (inMask, True);
+   RebinLattice<Float> rbMasked(inMaskedML, factors);
+   IPosition shapeOut = RebinLattice<Float>::rebinShape (shape, factors);
+   Array<Float> dataOut = rbUnmasked.get();
+   Array<Float> dataOutM = rbMasked.get();
+   Array<Bool> maskOutM = rbMasked.getMask();
+   AlwaysAssert (dataOut.shape().isEqual(shapeOut), AipsError);
+   AlwaysAssert (dataOutM.shape().isEqual(shapeOut), AipsError);
+   const Float* out = dataOut.data();
+   const Float* outM = dataOutM.data();
+   const Bool* maskOut = maskOutM.data();
+   size_t inx = 0;
+   for (Int k=0; k<(shp3[2]+fac3[2]-1)/fac3[2]; k++) {
+      for (Int j=0; j<(shp3[1]+fac3[1]-1)/fac3[1]; j++) {
+         for (Int i=0; i<(shp3[0]+fac3[0]-1)/fac3[0]; i++) {
+            Double sum = 0;
+            Double sumM = 0;
+            Int n = 0;
+            Int nM = 0;
+            for (Int k1=k*fac3[2]; k1<std::min((k+1)*fac3[2],shp3[2]); k1++) {
+               for (Int j1=j*fac3[1]; j1<std::min((j+1)*fac3[1],shp3[1]); j1++) {
+                  for (Int i1=i*fac3[0]; i1<std::min((i+1)*fac3[0],shp3[0]); i1++) {
+                     size_t off = (k1*shp3[1] + j1)*shp3[0] + i1;
+                     sum += data[off];
+                     n++;
+                     if (mask[off]) {
+                        sumM += data[off];
+                        nM++;
+                     }
+                  }
+               }
+            }
+            AlwaysAssert (near(out[inx], Float(sum/n), 1e-5), AipsError);
+            AlwaysAssert (maskOut[inx] == (nM > 0), AipsError);
+            if (nM > 0) {
+               AlwaysAssert (near(outM[inx], Float(sumM/nM), 1e-5), AipsError);
+            } else {
+               AlwaysAssert (outM[inx] == 0, AipsError);
+            }
+            inx++;
+         }
+      }
+   }
+   AlwaysAssert (inx == dataOut.nelements(), AipsError);
+   // Check a section (which uses non-contiguous input data).
+   IPosition blc(shape.nelements(), 1);
+   IPosition len(shapeOut - 1);
+   Slicer section(blc, len);
+   AlwaysAssert (allEQ (rbMasked.getSlice(section), dataOutM(section)),
+                 AipsError);
+   AlwaysAssert (allEQ (rbMasked.getMaskSlice(section), maskOutM(section)),
+                 AipsError);
+}
@@ -25,6 +25,7 @@
 
 
 #include <casacore/lattices/Lattices/TempLattice.h>
+#include <casacore/lattices/Lattices/TempLatticeBudget.h>
 #include <casacore/lattices/Lattices/LatticeIterator.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
@@ -71,6 +72,49 @@ void doIt (TempLattice<Int>& scratch)
     AlwaysAssert(scratch.getAt(IPosition(3,7)) == 7, AipsError);
 }
 
+// Test moving lattices to disk and back using a budget of 1 MiB.
+void testBudget()
+{
+  TempLatticeBudget::setBudget (1);
+  {
+    TempLattice<Float> lat1(IPosition(2,256,256));   // 256 KiB
+    lat1.set (1);
+    TempLattice<Float> lat2(IPosition(2,256,512));   // 512 KiB
+    lat2.set (2);
+    AlwaysAssertExit (!lat1.isPaged()  &&  !lat2.isPaged());
+    AlwaysAssertExit (TempLatticeBudget::usedBytes() == 768*1024);
+    {
+      // Does not fit, so the coldest lattice (lat1) is moved to disk.
+      TempLattice<Float> lat3(IPosition(2,256,512));
+      AlwaysAssertExit (!lat3.isPaged()  &&  lat1.isPaged());
+      AlwaysAssertExit (!lat2.isPaged());
+      lat3.set (3);
+      AlwaysAssertExit (allEQ (lat1.get(), Float(1)));
+      // A lattice larger than the budget is put on disk.
+      TempLattice<Float> lat4(IPosition(2,1024,512));
+      AlwaysAssertExit (lat4.isPaged());
+    }
+    // Memory has been freed, so lat1 is moved back at its next access.
+    AlwaysAssertExit (lat1.getAt(IPosition(2,3,4)) == 1);
+    AlwaysAssertExit (!lat1.isPaged());
+    AlwaysAssertExit (allEQ (lat1.get(), Float(1)));
+    // A referenced lattice is not moved.
+    {
+      LatticeIterator<Float> iter(lat1);
+      TempLattice<Float> lat5(IPosition(2,256,512));
+      AlwaysAssertExit (!lat5.isPaged()  &&  !lat1.isPaged());
+      AlwaysAssertExit (lat2.isPaged());
+      AlwaysAssertExit (allEQ (iter.cursor(), Float(1)));
+      AlwaysAssertExit (allEQ (lat2.get(), Float(2)));
+    }
+    // An explicit maximum size is not managed by the budget.
+    TempLattice<Float> lat6(IPosition(2,1024,1024), 100);
+    AlwaysAssertExit (!lat6.isPaged());
+  }
+  AlwaysAssertExit (TempLatticeBudget::usedBytes() == 0);
+  TempLatticeBudget::setBudget (0);
+}
+
 int main() {
   try {
     {
@@ -84,6 +128,7 @@ int main() {
       AlwaysAssertExit (! small.isPaged());
       doIt (small);
     }
+    testBudget();
   } catch (std::exception& x) {
     cerr << x.what() << endl;
     cout << "FAIL" << endl;
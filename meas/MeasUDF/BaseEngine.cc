@@ -109,4 +109,22 @@ namespace casacore {
     return type;
   }
 
+  Bool BaseEngine::getCachedResult (const std::vector<Double>& key,
+                                    Array<Double>& result) const
+  {
+    if (itsCacheKey.empty()  ||  key != itsCacheKey) {
+      return False;
+    }
+    // Return a copy, because the caller might change the result in place.
+    result.reference (itsCacheResult.copy());
+    return True;
+  }
+
+  void BaseEngine::setCachedResult (std::vector<Double>& key,
+                                    const Array<Double>& result)
+  {
+    itsCacheKey.swap (key);
+    itsCacheResult.reference (result.copy());
+  }
+
 }
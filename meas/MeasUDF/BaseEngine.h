@@ -32,6 +32,7 @@
 #include <casacore/measures/TableMeasures/ScalarMeasColumn.h>
 #include <casacore/measures/TableMeasures/ArrayMeasColumn.h>
 #include <casacore/casa/Arrays/Array.h>
+#include <vector>
 
 namespace casacore {
 
@@ -142,6 +143,56 @@ namespace casacore {
     // The default implementation returns the full type string.
     virtual String stripMeasType (const String& type);
 
+    // Tell if the result for the given key is the result cached for the
+    // previous row. If so, a copy of it is returned in <src>result</src>.
+    // <br>Consecutive rows in a table often have the same input values
+    // (e.g., the TIME of all baselines in a time slot of a MeasurementSet),
+    // so this avoids repeating the conversions for them.
+    Bool getCachedResult (const std::vector<Double>& key,
+                          Array<Double>& result) const;
+
+    // Cache the result for the given key, which is swapped into the cache.
+    void setCachedResult (std::vector<Double>& key,
+                          const Array<Double>& result);
+
+    // Add the shape, reference types and values of the measures to a key.
+    // It returns False if a measure has an offset, which is not part of
+    // the key, so the result cannot be cached.
+    template<typename M>
+    static Bool addToKey (std::vector<Double>& key, const Array<M>& values)
+    {
+      key.push_back (values.ndim());
+      for (uInt i=0; i<values.ndim(); ++i) {
+        key.push_back (values.shape()[i]);
+      }
+      for (typename Array<M>::const_contiter iter = values.cbegin();
+           iter != values.cend(); ++iter) {
+        if (iter->getRefPtr()->offset()) {
+          return False;
+        }
+        key.push_back (iter->getRefPtr()->getType());
+        const Vector<Double> vec = iter->getValue().getVector();
+        key.insert (key.end(), vec.begin(), vec.end());
+      }
+      return True;
+    }
+
+    // Tell if all measures have the same reference type without an offset,
+    // so they can be converted in one go using MeasConvert::convert.
+    template<typename M>
+    static Bool sameRefType (const Array<M>& values)
+    {
+      uInt refType = values.cbegin()->getRefPtr()->getType();
+      for (typename Array<M>::const_contiter iter = values.cbegin();
+           iter != values.cend(); ++iter) {
+        if (iter->getRefPtr()->getType() != refType  ||
+            iter->getRefPtr()->offset()) {
+          return False;
+        }
+      }
+      return True;
+    }
+
     
     //# Data members.
     Bool          itsIsConst;
@@ -150,6 +201,8 @@ namespace casacore {
     Unit          itsInUnit;
     Unit          itsOutUnit;
     TableExprNode itsExprNode;
+    std::vector<Double> itsCacheKey;    // input values of cached result
+    Array<Double>       itsCacheResult;
   };
 
 } //end namespace
@@ -310,15 +310,21 @@ namespace casacore {
     // Get epochs and positions if given.
     Array<MEpoch> eps(IPosition(1,1));
     if (itsEpochEngine) {
-      Array<MEpoch> arr = itsEpochEngine->getEpochs (id);
       eps.reference (itsEpochEngine->getEpochs (id));
     }
     Array<MPosition> pos(IPosition(1,1));
     if (itsPositionEngine) {
       pos.reference (itsPositionEngine->getPositions (id));
     }
+    // Use the result of the previous row if it has the same input values.
+    std::vector<Double> key(1, riseSet + 2*asDirCos);
+    Bool useCache = (addToKey (key, res)  &&  addToKey (key, eps)  &&
+                     addToKey (key, pos));
     // Convert the direction to the given type for all epochs and positions.
     Array<Double> out;
+    if (useCache  &&  getCachedResult (key, out)) {
+      return out;
+    }
     if (res.size() > 0  &&  eps.size() > 0  &&  pos.size() > 0) {
       // 2 or 3 values per MDirection
       IPosition shape(1, asDirCos ? 3:2);
@@ -330,6 +336,23 @@ namespace casacore {
       }
       out.resize (shape);
       double* outPtr = out.data();
+      // Directions with the same reference type are converted in one go
+      // for each epoch and position. This cannot be done for planets.
+      Bool convertAll = (!riseSet  &&  sameRefType(res)  &&
+                         res.cbegin()->getRefPtr()->getType() <
+                         MDirection::N_Types);
+      std::vector<Double> dirCos;
+      std::vector<Double> convDirCos;
+      if (convertAll) {
+        dirCos.reserve (3*res.size());
+        for (Array<MDirection>::const_contiter resIter = res.cbegin();
+             resIter != res.cend(); ++resIter) {
+          const Vector<Double>& dc = resIter->getValue().getValue();
+          dirCos.insert (dirCos.end(), dc.begin(), dc.end());
+        }
+        convDirCos.resize (dirCos.size());
+        itsConverter.setModel (*res.cbegin());
+      }
       for (Array<MPosition>::const_contiter posIter = pos.cbegin();
            posIter != pos.cend(); ++posIter) {
         // Convert to desired position.
@@ -342,34 +365,54 @@ namespace casacore {
           if (itsEpochEngine) {
             itsFrame.resetEpoch (*epsIter);
           }
-          uInt hIndex = 0;
-          for (Array<MDirection>::const_contiter resIter = res.cbegin();
-               resIter != res.cend(); ++resIter, ++hIndex) {
-            if (riseSet) {
-              calcRiseSet (*resIter, *posIter, *epsIter,
-                           (hIndex<itsH.size() ? itsH[hIndex] : 0),
-                           outPtr[0], outPtr[1]);
-              outPtr += 2;
-            } else {
-              itsConverter.setModel (*resIter);
-              MDirection mdir = itsConverter();
+          if (convertAll) {
+            itsConverter.convert (dirCos.data(), convDirCos.data(),
+                                  res.size());
+            const Double* dc = convDirCos.data();
+            for (uInt i=0; i<res.size(); ++i, dc+=3) {
               if (asDirCos) {
-                // Get direction cosines.
-                Vector<Double> md (mdir.getValue().getValue());
-                *outPtr++ = md[0];
-                *outPtr++ = md[1];
-                *outPtr++ = md[2];
+                *outPtr++ = dc[0];
+                *outPtr++ = dc[1];
+                *outPtr++ = dc[2];
               } else {
-                // Get angles as radians.
-                Vector<Double> md (mdir.getValue().get());
+                Vector<Double> md (MVDirection(dc[0], dc[1], dc[2]).get());
                 *outPtr++ = md[0];
                 *outPtr++ = md[1];
               }
             }
+          } else {
+            uInt hIndex = 0;
+            for (Array<MDirection>::const_contiter resIter = res.cbegin();
+                 resIter != res.cend(); ++resIter, ++hIndex) {
+              if (riseSet) {
+                calcRiseSet (*resIter, *posIter, *epsIter,
+                             (hIndex<itsH.size() ? itsH[hIndex] : 0),
+                             outPtr[0], outPtr[1]);
+                outPtr += 2;
+              } else {
+                itsConverter.setModel (*resIter);
+                MDirection mdir = itsConverter();
+                if (asDirCos) {
+                  // Get direction cosines.
+                  Vector<Double> md (mdir.getValue().getValue());
+                  *outPtr++ = md[0];
+                  *outPtr++ = md[1];
+                  *outPtr++ = md[2];
+                } else {
+                  // Get angles as radians.
+                  Vector<Double> md (mdir.getValue().get());
+                  *outPtr++ = md[0];
+                  *outPtr++ = md[1];
+                }
+              }
+            }
           }
         }
       }
     }
+    if (useCache) {
+      setCachedResult (key, out);
+    }
     return out;
   }
 
@@ -166,8 +166,14 @@ namespace casacore {
     if (itsPositionEngine) {
       pos.reference (itsPositionEngine->getPositions (id));
     }
+    // Use the result of the previous row if it has the same input values.
+    std::vector<Double> key;
+    Bool useCache = (addToKey (key, res)  &&  addToKey (key, pos));
     // Convert the epoch to the given type for all positions.
     Array<Double> out;
+    if (useCache  &&  getCachedResult (key, out)) {
+      return out;
+    }
     if (res.size() > 0  &&  pos.size() > 0) {
       IPosition shape = res.shape();
       if (pos.size() > 1) {
@@ -195,6 +201,9 @@ namespace casacore {
         }
       }
     }
+    if (useCache) {
+      setCachedResult (key, out);
+    }
     return out;
   }
 
@@ -186,7 +186,15 @@ namespace casacore {
     if (itsDopplerEngine) {
       dop.reference (itsDopplerEngine->getDopplers (id));
     }
+    // Use the result of the previous row if it has the same input values.
+    std::vector<Double> key(1, type);
+    Bool useCache = (addToKey (key, res)  &&  addToKey (key, dir)  &&
+                     addToKey (key, eps)  &&  addToKey (key, pos)  &&
+                     addToKey (key, rv)   &&  addToKey (key, dop));
     Array<Double> out;
+    if (useCache  &&  getCachedResult (key, out)) {
+      return out;
+    }
     if (! (res.empty()  ||  dir.empty()  ||  eps.empty()  ||
            pos.empty()  ||  rv.empty()   ||  dop.empty())) {
       IPosition shape;
@@ -210,6 +218,18 @@ namespace casacore {
       // Convert the frequency to the given type for all radvel/doppler,dir,epoch,pos.
       out.resize (shape);
       double* outPtr = out.data();
+      // Frequencies with the same reference type are converted in one go
+      // for each frame.
+      Bool convertAll = (!itsDopplerEngine  &&  sameRefType(res));
+      std::vector<Double> freqValues;
+      if (convertAll) {
+        freqValues.reserve (res.size());
+        for (Array<MFrequency>::const_contiter resIter = res.cbegin();
+             resIter != res.cend(); ++resIter) {
+          freqValues.push_back (resIter->getValue().getValue());
+        }
+        itsConverter.setModel (*res.cbegin());
+      }
       for (Array<MPosition>::const_contiter posIter = pos.cbegin();
            posIter != pos.cend(); ++posIter) {
         if (itsPositionEngine) {
@@ -237,25 +257,31 @@ namespace casacore {
                 MRadialVelocity radvel(rvIter->getValue(), mr);
                 itsFrame.resetRadialVelocity (radvel);
               }
-              for (Array<MDoppler>::const_contiter dopIter = dop.cbegin();
-                   dopIter != dop.cend(); ++dopIter) {
-                for (Array<MFrequency>::const_contiter resIter = res.cbegin();
-                     resIter != res.cend(); ++resIter) {
-                  itsConverter.setModel (*resIter);
-                  if (itsDopplerEngine) {
-                    Vector<Double> freqs(1, resIter->getValue().getValue());
-                    if (type == FrequencyUDF::SHIFT) {
-                      // Shift has to use a BETA Doppler, so convert.
-                      // Note that it does the same as MFrequency::fromDoppler.
-                      MDoppler tmp = MDoppler::Convert(*dopIter, MDoppler::BETA)();
-                      *outPtr++ = tmp.shiftFrequency (freqs)[0];
+              if (convertAll) {
+                itsConverter.convert (freqValues.data(), outPtr,
+                                      freqValues.size());
+                outPtr += freqValues.size();
+              } else {
+                for (Array<MDoppler>::const_contiter dopIter = dop.cbegin();
+                     dopIter != dop.cend(); ++dopIter) {
+                  for (Array<MFrequency>::const_contiter resIter = res.cbegin();
+                       resIter != res.cend(); ++resIter) {
+                    itsConverter.setModel (*resIter);
+                    if (itsDopplerEngine) {
+                      Vector<Double> freqs(1, resIter->getValue().getValue());
+                      if (type == FrequencyUDF::SHIFT) {
+                        // Shift has to use a BETA Doppler, so convert.
+                        // Note that it does the same as MFrequency::fromDoppler.
+                        MDoppler tmp = MDoppler::Convert(*dopIter, MDoppler::BETA)();
+                        *outPtr++ = tmp.shiftFrequency (freqs)[0];
+                      } else {
+                        *outPtr++ = resIter->toRest (*dopIter).getValue().getValue();
+                      }
                     } else {
-                      *outPtr++ = resIter->toRest (*dopIter).getValue().getValue();
+                      // Convert frequency to desired reference type.
+                      MFrequency mf = itsConverter();
+                      *outPtr++ = mf.getValue().getValue();
                     }
-                  } else {
-                    // Convert frequency to desired reference type.
-                    MFrequency mf = itsConverter();
-                    *outPtr++ = mf.getValue().getValue();
                   }
                 }
               }
@@ -264,6 +290,9 @@ namespace casacore {
         }
       }
     }
+    if (useCache) {
+      setCachedResult (key, out);
+    }
     return out;
   }
 
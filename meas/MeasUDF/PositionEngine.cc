@@ -478,7 +478,14 @@ namespace casacore {
   {
     DebugAssert (id.byRow(), AipsError);
     Array<MPosition> res (getPositions(id));
+    // Use the result of the previous row if it has the same input values.
+    std::vector<Double> key(1, toRefType);
+    key.push_back (toValueType);
+    Bool useCache = addToKey (key, res);
     Array<Double> out;
+    if (useCache  &&  getCachedResult (key, out)) {
+      return out;
+    }
     if (res.size() > 0) {
       if (toValueType == 1) {
         out.resize (res.shape());
@@ -516,6 +523,9 @@ namespace casacore {
         }
       }
     }
+    if (useCache) {
+      setCachedResult (key, out);
+    }
     return out;
   }
 
@@ -119,6 +119,11 @@ void register_meas()
 }
 
 
+// Register the functions when the library is loaded, so an application
+// linked with it does not need to load it dynamically at first use.
+static UDFRegistrar theirRegistrar_meas (register_meas);
+
+
 namespace casacore {
 
   void HelpMeasUDF::showFuncsEpoch (ostream& os, Bool showTypes)
@@ -32,6 +32,8 @@
 #include <casacore/measures/Measures/MeasFrame.h>
 #include <casacore/measures/Measures/MeasConvert.h>
 #include <casacore/measures/Measures/MeasTable.h>
+#include <casacore/measures/TableMeasures/ArrayMeasColumn.h>
+#include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/TaQL/TableParse.h>
 #include <casacore/casa/Arrays/VectorIter.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
@@ -356,6 +358,48 @@ void testRiset()
   AlwaysAssertExit (arr.data()[3] == "2010/08/10/18:59:10");
 }
 
+void testRepeatedRows()
+{
+  cout << "test repeated rows ..." << endl;
+  // Consecutive rows with the same values reuse the previous result,
+  // so evaluate rows several times in a different order.
+  TableExprNode node1(tableCommand
+                      ("using style python calc meas.app("
+                       "DIR[0,],TIME,POS1)deg "
+                       "from tDirectionEngine_tmp.tab").node());
+  // All directions in a row are converted in one go.
+  TableExprNode node2(tableCommand
+                      ("using style python calc meas.galactic(DIR)deg "
+                       "from tDirectionEngine_tmp.tab").node());
+  Vector<Array<Double> > res1(3), res2(3);
+  for (uInt i=0; i<3; ++i) {
+    res1[i] = node1.getArrayDouble(i);
+    res2[i] = node2.getArrayDouble(i);
+  }
+  uInt rows[] = {0, 0, 1, 1, 1, 2, 0, 2};
+  for (uInt i=0; i<8; ++i) {
+    Array<Double> arr1 = node1.getArrayDouble(rows[i]);
+    Array<Double> arr2 = node2.getArrayDouble(rows[i]);
+    AlwaysAssertExit (allEQ(arr1, res1[rows[i]]));
+    AlwaysAssertExit (allEQ(arr2, res2[rows[i]]));
+    // Changing the result should not change the next result.
+    arr1 = 0.;
+  }
+  // Check the bulk conversion with Measures.
+  ArrayMeasColumn<MDirection> dirCol(Table("tDirectionEngine_tmp.tab"),
+                                     "DIR");
+  for (uInt i=0; i<3; ++i) {
+    Vector<MDirection> dirs = dirCol(i);
+    AlwaysAssertExit (res2[i].shape() == IPosition(2,2,2));
+    for (uInt j=0; j<2; ++j) {
+      Vector<Double> dir = MDirection::Convert
+        (dirs[j], MDirection::GALACTIC)()
+        .getValue().getAngle("deg").getValue();
+      AlwaysAssertExit (allNear(dir, res2[i][j], 1e-8));
+    }
+  }
+}
+
 int checkErr (const String& command)
 {
   Bool fail = False;
@@ -408,6 +452,7 @@ int main()
     testColumn(True);
     testName();
     testRiset();
+    testRepeatedRows();
   } catch (const std::exception& x) {
     cerr << "Unexpected exception: " << x.what() << endl;
     return 1;
@@ -773,6 +773,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //	(static) class to converse with the IERS database(s)
 //  <li> <linkto class=MeasJPL>MeasJPL</linkto>:
 //	(static) class to converse with the JPL DE database(s)
+//  <li> <linkto class=MeasTableCache>MeasTableCache</linkto>:
+//	memory-mapped cache of the data of the IERS and JPL tables
 //  <li> <linkto class=Precession>Precession</linkto>:
 //	 all precession related calculations
 //  <li> <linkto class=Nutation>Nutation</linkto>
@@ -38,6 +38,9 @@ const Double Aberration::INTV = 0.04;
 //# Static data
 uInt Aberration::interval_reg = 0;
 uInt Aberration::usejpl_reg = 0;
+std::vector<Aberration::CacheEntry> Aberration::theirCache;
+uInt Aberration::theirCacheNext = 0;
+std::mutex Aberration::theirCacheMutex;
 
 //# Constructors
 Aberration::Aberration() : method(Aberration::STANDARD), lres(0) {
@@ -135,13 +138,53 @@ void Aberration::fill() {
 
 void Aberration::refresh() {
     checkEpoch = 1e30;
+    // Clear the shared calculations as well.
+    std::lock_guard<std::mutex> lock(theirCacheMutex);
+    theirCache.clear();
+    theirCacheNext = 0;
+}
+
+Bool Aberration::getCached(Double time, Double epsilon) {
+  std::lock_guard<std::mutex> lock(theirCacheMutex);
+  for (std::vector<CacheEntry>::const_iterator iter = theirCache.begin();
+       iter != theirCache.end(); ++iter) {
+    if (iter->method == method && nearAbs(time, iter->epoch, epsilon)) {
+      checkEpoch = iter->epoch;
+      for (Int i=0; i<3; i++) {
+	aval[i] = iter->aval[i];
+	dval[i] = iter->dval[i];
+      }
+      return True;
+    }
+  }
+  return False;
+}
+
+void Aberration::putCached() {
+  CacheEntry entry;
+  entry.method = method;
+  entry.epoch = checkEpoch;
+  for (Int i=0; i<3; i++) {
+    entry.aval[i] = aval[i];
+    entry.dval[i] = dval[i];
+  }
+  std::lock_guard<std::mutex> lock(theirCacheMutex);
+  // Add the entry, replacing the oldest one if the cache is full.
+  if (theirCache.size() < theirCacheSize) {
+    theirCache.push_back(entry);
+  } else {
+    theirCache[theirCacheNext] = entry;
+    theirCacheNext = (theirCacheNext+1) % theirCache.size();
+  }
 }
 
 void Aberration::calcAber(Double t) {
-  if (!nearAbs(t, checkEpoch,
-	       AipsrcValue<Double>::get(Aberration::interval_reg)) ||
-      (AipsrcValue<Bool>::get(Aberration::usejpl_reg) &&
-       method != B1950) ) {
+  // The JPL values are not interpolated, thus not cached.
+  Bool usejpl = (AipsrcValue<Bool>::get(Aberration::usejpl_reg) &&
+		 method != B1950);
+  Double epsilon = AipsrcValue<Double>::get(Aberration::interval_reg);
+  if (usejpl ||
+      (!nearAbs(t, checkEpoch, epsilon) && !getCached(t, epsilon))) {
     checkEpoch = t;
     switch (method) {
     case B1950:
@@ -286,6 +329,9 @@ void Aberration::calcAber(Double t) {
       }
       break;
     }
+    if (!usejpl) {
+      putCached();
+    }
   }
 }
 
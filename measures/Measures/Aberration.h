@@ -29,6 +29,8 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Quanta/MVPosition.h>
+#include <mutex>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -75,6 +77,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // MVPosition.<br>
 // The derivative (d<sup>-1</sup>) can be obtained as well by
 // derivative(epoch).<br>
+// The calculated values are kept in a small process-wide cache shared by
+// all Aberration objects (see <linkto class=Nutation>Nutation</linkto>),
+// so conversion engines in different threads converting for the same
+// times do the series calculation only once per interpolation interval.<br>
 // The following details can be set with the 
 // <linkto class=Aipsrc>Aipsrc</linkto> mechanism:
 // <ul>
@@ -164,6 +170,20 @@ private:
     static uInt interval_reg;
 // JPL use
     static uInt usejpl_reg;
+// An entry in the process-wide cache of calculations
+    struct CacheEntry {
+      AberrationTypes method;
+      Double epoch;
+      Double aval[3];
+      Double dval[3];
+    };
+// The process-wide cache and the mutex protecting it
+// <group>
+    static const uInt theirCacheSize = 256;
+    static std::vector<CacheEntry> theirCache;
+    static uInt theirCacheNext;
+    static std::mutex theirCacheMutex;
+// </group>
 
 //# Member functions
 // Copy
@@ -172,6 +192,11 @@ private:
     void fill();
 // Calculate Aberration angles for time t
     void calcAber(Double t);
+// Get the calculation for an epoch within epsilon of time from the cache.
+// It returns False if not found.
+    Bool getCached(Double time, Double epsilon);
+// Put the current calculation into the cache.
+    void putCached();
 };
 
 
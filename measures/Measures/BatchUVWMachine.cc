@@ -0,0 +1,238 @@
+//# BatchUVWMachine.cc: Calculate the UVW coordinates of many baselines and times
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/measures/Measures/BatchUVWMachine.h>
+#include <casacore/measures/Measures/MBaseline.h>
+#include <casacore/measures/Measures/MCBaseline.h>
+#include <casacore/measures/Measures/MCDirection.h>
+#include <casacore/measures/Measures/MCPosition.h>
+#include <casacore/measures/Measures/MeasConvert.h>
+#include <casacore/measures/Measures/MeasFrame.h>
+#include <casacore/casa/Quanta/MVBaseline.h>
+#include <casacore/casa/Quanta/Euler.h>
+#include <casacore/casa/Quanta/RotMatrix.h>
+#include <casacore/casa/BasicSL/Constants.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// The frame and conversion engines used by a thread.
+class BatchUVWMachine::Converter
+{
+public:
+  Converter (const MPosition& position, const MDirection& phaseCenter,
+             MEpoch::Types timeType)
+    : itsFrame  (position, MEpoch(MVEpoch(), timeType)),
+      itsBlConv (MBaseline(MVBaseline(),
+                           MBaseline::Ref(MBaseline::ITRF, itsFrame)),
+                 MBaseline::Ref(MBaseline::J2000)),
+      itsDirConv (phaseCenter, MDirection::Ref(MDirection::J2000, itsFrame))
+  {
+    // The baseline conversion needs a direction in the frame.
+    itsFrame.set (phaseCenter);
+  }
+
+  // Calculate the rotation from ITRF baselines to J2000 UVW for the time.
+  void rotation (Double time, Double rot[9])
+  {
+    itsFrame.resetEpoch (MVEpoch(Quantity(time, "s")));
+    // The columns of the rotation from ITRF to J2000 baselines are the
+    // converted unit vectors.
+    Double bl[3][3];
+    for (uInt j=0; j<3; ++j) {
+      MVBaseline unit(j==0 ? 1. : 0., j==1 ? 1. : 0., j==2 ? 1. : 0.);
+      const Vector<Double>& v = itsBlConv(unit).getValue().getValue();
+      for (uInt i=0; i<3; ++i) {
+        bl[i][j] = v[i];
+      }
+    }
+    // The rotation from J2000 baselines to UVW (as done in MVuvw).
+    MVDirection dir = itsDirConv().getValue();
+    dir.adjust();
+    RotMatrix uvwRot(Euler(dir.getLat() - C::pi_2, 1u,
+                           -dir.getLong() - C::pi_2, 3u));
+    for (uInt i=0; i<3; ++i) {
+      for (uInt j=0; j<3; ++j) {
+        rot[3*i+j] = (uvwRot(i,0)*bl[0][j] + uvwRot(i,1)*bl[1][j] +
+                      uvwRot(i,2)*bl[2][j]);
+      }
+    }
+  }
+
+private:
+  MeasFrame           itsFrame;
+  MBaseline::Convert  itsBlConv;
+  MDirection::Convert itsDirConv;
+};
+
+
+BatchUVWMachine::BatchUVWMachine (const Vector<MPosition>& antennaPositions,
+                                  const MDirection& phaseCenter)
+{
+  if (antennaPositions.empty()) {
+    throw AipsError ("BatchUVWMachine: no antenna positions given");
+  }
+  // Use the positions relative to the first antenna to keep precision.
+  uInt nant = antennaPositions.size();
+  itsPositions.resize (3, nant);
+  itsRefPosition = MPosition::Convert (antennaPositions[0],
+                                       MPosition::ITRF)();
+  const Vector<Double>& ref = itsRefPosition.getValue().getValue();
+  for (uInt i=0; i<nant; ++i) {
+    Vector<Double> pos = MPosition::Convert (antennaPositions[i],
+                                             MPosition::ITRF)()
+      .getValue().getValue();
+    for (uInt j=0; j<3; ++j) {
+      itsPositions(j,i) = pos[j] - ref[j];
+    }
+  }
+  // Only keep the direction type, so no frame is shared between threads.
+  itsPhaseCenter = MDirection (phaseCenter.getValue(),
+                               MDirection::castType
+                               (phaseCenter.getRef().getType()));
+}
+
+void BatchUVWMachine::rotation (Double time, Double rot[9],
+                                MEpoch::Types timeType) const
+{
+  Converter conv(itsRefPosition, itsPhaseCenter, timeType);
+  conv.rotation (time, rot);
+}
+
+void BatchUVWMachine::applyRotation (const Double rot[9], Double* uvw) const
+{
+  const Double* pos = itsPositions.data();
+  uInt nant = nantenna();
+  for (uInt i=0; i<nant; ++i) {
+    const Double* p = pos + 3*i;
+    Double* u = uvw + 3*i;
+    u[0] = rot[0]*p[0] + rot[1]*p[1] + rot[2]*p[2];
+    u[1] = rot[3]*p[0] + rot[4]*p[1] + rot[5]*p[2];
+    u[2] = rot[6]*p[0] + rot[7]*p[1] + rot[8]*p[2];
+  }
+}
+
+template<typename STORE>
+void BatchUVWMachine::calcUVW (const Vector<Double>& times,
+                               MEpoch::Types timeType, STORE store) const
+{
+  Int64 ntime = times.size();
+  std::exception_ptr error;
+  // Setting up the conversion engines takes some time, so only use
+  // multiple threads if there are sufficient times.
+#ifdef _OPENMP
+#pragma omp parallel if (ntime > 16)
+#endif
+  {
+    // Exceptions cannot leave a parallel loop, so the first one is kept
+    // and rethrown afterwards.
+    std::unique_ptr<Converter> conv;
+    std::vector<Double> antUVW(3*nantenna());
+    Double rot[9];
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (Int64 i=0; i<ntime; ++i) {
+      try {
+        if (! conv) {
+          conv.reset (new Converter(itsRefPosition, itsPhaseCenter,
+                                    timeType));
+        }
+        conv->rotation (times[i], rot);
+        applyRotation (rot, antUVW.data());
+        store (i, antUVW.data());
+      } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(BatchUVWMachine_calcUVW)
+#endif
+        {
+          if (! error) {
+            error = std::current_exception();
+          }
+        }
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception (error);
+  }
+}
+
+void BatchUVWMachine::antennaUVW (const Vector<Double>& times,
+                                  Cube<Double>& uvw,
+                                  MEpoch::Types timeType) const
+{
+  uInt nant = nantenna();
+  uvw.resize (3, nant, times.size());
+  Double* out = uvw.data();
+  calcUVW (times, timeType,
+           [out, nant] (Int64 timeIndex, const Double* antUVW)
+           {
+             std::copy (antUVW, antUVW + 3*nant, out + timeIndex*3*nant);
+           });
+}
+
+void BatchUVWMachine::baselineUVW (const Vector<Double>& times,
+                                   const Vector<Int>& antenna1,
+                                   const Vector<Int>& antenna2,
+                                   Cube<Double>& uvw,
+                                   MEpoch::Types timeType) const
+{
+  if (antenna1.size() != antenna2.size()) {
+    throw AipsError ("BatchUVWMachine: antenna1 and antenna2 "
+                     "differ in size");
+  }
+  Int nant = nantenna();
+  size_t nbl = antenna1.size();
+  std::vector<Int> ant1(antenna1.begin(), antenna1.end());
+  std::vector<Int> ant2(antenna2.begin(), antenna2.end());
+  for (size_t i=0; i<nbl; ++i) {
+    if (ant1[i] < 0  ||  ant1[i] >= nant  ||
+        ant2[i] < 0  ||  ant2[i] >= nant) {
+      throw AipsError ("BatchUVWMachine: invalid antenna number");
+    }
+  }
+  uvw.resize (3, nbl, times.size());
+  Double* out = uvw.data();
+  calcUVW (times, timeType,
+           [out, nbl, &ant1, &ant2] (Int64 timeIndex, const Double* antUVW)
+           {
+             Double* blUVW = out + timeIndex*3*nbl;
+             for (size_t i=0; i<nbl; ++i) {
+               const Double* u1 = antUVW + 3*ant1[i];
+               const Double* u2 = antUVW + 3*ant2[i];
+               blUVW[3*i]   = u2[0] - u1[0];
+               blUVW[3*i+1] = u2[1] - u1[1];
+               blUVW[3*i+2] = u2[2] - u1[2];
+             }
+           });
+}
+
+} //# NAMESPACE CASACORE - END
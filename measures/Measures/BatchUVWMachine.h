@@ -0,0 +1,158 @@
+//# BatchUVWMachine.h: Calculate the UVW coordinates of many baselines and times
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef MEASURES_BATCHUVWMACHINE_H
+#define MEASURES_BATCHUVWMACHINE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/measures/Measures/MDirection.h>
+#include <casacore/measures/Measures/MEpoch.h>
+#include <casacore/measures/Measures/MPosition.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Calculate the UVW coordinates of many baselines and times
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tBatchUVWMachine.cc" demos="">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=UVWMachine>UVWMachine</linkto> class
+//   <li> <linkto class=MBaseline>MBaseline</linkto> class
+// </prerequisite>
+//
+// <etymology>
+// From UVW machine for batches of baselines and times
+// </etymology>
+//
+// <synopsis>
+// A BatchUVWMachine calculates the J2000 UVW coordinates of the antennae
+// of an array for a series of times and a given phase center.
+// The UVW coordinates of a baseline are the difference of the UVW
+// coordinates of its antennae (antenna2 - antenna1).
+// <br>For each time the rotation from ITRF baseline coordinates to J2000
+// UVW coordinates is calculated once using the Measures conversions
+// (i.e., precession, nutation, earth rotation and polar motion). It is
+// applied to the ITRF positions of all antennae (relative to the first
+// antenna), so the cost per baseline is a few multiplications.
+// <br>The phase center can be given in any direction type; it is
+// converted to J2000 for each time using a frame containing the time and
+// the position of the first antenna.
+// <p>
+// If compiled with OpenMP, the times are divided over the threads. Each
+// thread uses its own frame and conversion engines.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   // Get the antenna positions and the phase center.
+//   MSAntennaColumns antCols(ms.antenna());
+//   Vector<MPosition> antPos(antCols.nrow());
+//   for (uInt i=0; i<antPos.size(); ++i) {
+//     antPos[i] = antCols.positionMeas()(i);
+//   }
+//   MSFieldColumns fieldCols(ms.field());
+//   BatchUVWMachine machine(antPos, fieldCols.phaseDirMeas(0));
+//   // Calculate the UVW for the baselines and times (in MJD seconds).
+//   Cube<Double> uvw;
+//   machine.baselineUVW (times, ant1, ant2, uvw);    // [3,nbaseline,ntime]
+// </srcblock>
+// </example>
+//
+// <motivation>
+// The typical use of UVWMachine or MBaseline conversions (per baseline and
+// time) repeats the expensive conversion setup for each time, which made
+// recalculating the UVW coordinates of a large data set slow.
+// </motivation>
+
+class BatchUVWMachine
+{
+public:
+  // Create the machine for the given antenna positions (in any reference
+  // type) and phase center.
+  BatchUVWMachine (const Vector<MPosition>& antennaPositions,
+                   const MDirection& phaseCenter);
+
+  // Get the number of antennae.
+  uInt nantenna() const
+    { return itsPositions.ncolumn(); }
+
+  // Get the J2000 rotation matrix (row major) converting an ITRF baseline
+  // to UVW coordinates for the given time.
+  // The time is given in seconds (MJD) in the given reference type.
+  void rotation (Double time, Double rot[9],
+                 MEpoch::Types timeType = MEpoch::UTC) const;
+
+  // Calculate the UVW coordinates of all antennae for the given times
+  // (in MJD seconds in the given reference type).
+  // The result has shape [3,nantenna,ntime].
+  void antennaUVW (const Vector<Double>& times, Cube<Double>& uvw,
+                   MEpoch::Types timeType = MEpoch::UTC) const;
+
+  // Calculate the UVW coordinates of the given baselines for the given
+  // times (in MJD seconds in the given reference type).
+  // The result has shape [3,nbaseline,ntime].
+  // <thrown>
+  //   <li> AipsError if the antenna vectors differ in size or contain
+  //        an invalid antenna number
+  // </thrown>
+  void baselineUVW (const Vector<Double>& times,
+                    const Vector<Int>& antenna1, const Vector<Int>& antenna2,
+                    Cube<Double>& uvw,
+                    MEpoch::Types timeType = MEpoch::UTC) const;
+
+private:
+  // Helper class holding a frame and the conversion engines for a thread.
+  class Converter;
+
+  // Calculate the UVW of all antennae for the given times, using the
+  // given function to store the UVW of a time.
+  template<typename STORE>
+  void calcUVW (const Vector<Double>& times, MEpoch::Types timeType,
+                STORE store) const;
+
+  // Apply the rotation to the antenna positions.
+  void applyRotation (const Double rot[9], Double* uvw) const;
+
+  //# Data members
+  // ITRF position of the first antenna.
+  MPosition   itsRefPosition;
+  // ITRF antenna positions relative to the first antenna.
+  Matrix<Double> itsPositions;
+  MDirection  itsPhaseCenter;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -30,6 +30,11 @@
 #include <casacore/measures/Measures/MCPosition.h>
 #include <casacore/measures/Measures/MCEpoch.h>
 #include <casacore/measures/Measures/MeasConvert.h>
+#include <casacore/measures/Measures/MeasFrame.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <exception>
+#include <memory>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -360,16 +365,91 @@ void EarthMagneticMachine::copy(const EarthMagneticMachine &other) {
 
 void EarthMagneticMachine::calculate() {
   init();
-  // Angle between direction and Earth radius
-  Double an = pos_p * in_p;
-  Double x = sqrt(abs(an*an + subl_p));
-  x = min(abs(-an + x), abs(-an - x));
-  sub_p = pos_p + (x*in_p);
+  sub_p = subPoint(pos_p, in_p, subl_p);
   fld_p = fldc_p(sub_p);
   pex_p = False;
   fex_p = False;
   clx_p = True;
 }
 
+MVPosition EarthMagneticMachine::subPoint(const MVPosition &pos,
+                                          const MVDirection &in,
+                                          Double subl) {
+  // Angle between direction and Earth radius
+  Double an = pos * in;
+  Double x = sqrt(abs(an*an + subl));
+  x = min(abs(-an + x), abs(-an - x));
+  return pos + (x*in);
+}
+
+Matrix<Double>
+EarthMagneticMachine::getLOSFields(const MVDirection &in,
+                                   const Vector<MEpoch> &epochs,
+                                   const Vector<MPosition> &positions) const {
+  if (!(cumf_p & 2)) {
+    throw(AipsError("No height set for EarthMagneticMachine"));
+  }
+  const Int64 npos = positions.nelements();
+  const Int64 nep = epochs.nelements();
+  Matrix<Double> res(npos, nep);
+  if (npos == 0) return res;
+  std::vector<MVPosition> pos(npos);
+  for (Int64 p=0; p<npos; ++p) {
+    pos[p] = MPosition::Convert(positions[p], MPosition::ITRF)().getValue();
+  }
+  MVDirection dir(in);
+  dir.adjust();
+  // Only keep the direction type, so no frame is shared between threads.
+  const MDirection::Types dirType = MDirection::castType(inref_p.getType());
+  Double* out = res.data();
+  std::exception_ptr error;
+#ifdef _OPENMP
+#pragma omp parallel if (nep > 1)
+#endif
+  {
+    std::unique_ptr<MeasFrame> frame;
+    std::unique_ptr<MDirection::Convert> conv;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for (Int64 i=0; i<nep; ++i) {
+      // Exceptions cannot leave a parallel loop, so the first one is kept
+      // and rethrown afterwards.
+      try {
+        if (!frame) {
+          frame.reset(new MeasFrame(epochs[i],
+                                    MPosition(pos[0], MPosition::ITRF)));
+          conv.reset(new MDirection::Convert
+                     (MDirection::Ref(dirType, *frame), MDirection::ITRF));
+        } else {
+          frame->set(epochs[i]);
+        }
+        EarthField fldc(EarthField::STANDARD,
+                        MEpoch::Convert(epochs[i], MEpoch::TDB)().
+                        getValue().get());
+        for (Int64 p=0; p<npos; ++p) {
+          frame->resetPosition(pos[p]);
+          MVDirection itrfDir((*conv)(dir).getValue());
+          Double subl = hgt_p*(hgt_p + 2*pos[p].radius());
+          out[i*npos + p] = fldc(subPoint(pos[p], itrfDir, subl)) * itrfDir;
+        }
+      } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(EarthMagneticMachine_getLOSFields)
+#endif
+        {
+          if (! error) {
+            error = std::current_exception();
+          }
+        }
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception (error);
+  }
+  return res;
+}
+
 } //# NAMESPACE CASACORE - END
 
@@ -206,6 +206,19 @@ public:
   const MVPosition &getPosition(const MVDirection &in);
   // </group>
   // </group>
+  // Return the line-of-sight fields (nT) in the given direction for all
+  // epochs and positions (e.g. antennae) as a matrix with shape
+  // [npos,nepoch]. The direction is interpreted with the type of the
+  // machine's direction reference; the height of the machine is used.
+  // The field model is calculated once per epoch and shared by all
+  // positions. The epochs are done in parallel (if OpenMP is used), where
+  // each thread uses its own frame, so the machine is not changed.
+  // <thrown>
+  //   <li> AipsError if no height has been set
+  // </thrown>
+  Matrix<Double> getLOSFields(const MVDirection &in,
+                              const Vector<MEpoch> &epochs,
+                              const Vector<MPosition> &positions) const;
   // Recalculate the machinery
   void reCalculate();
 
@@ -259,6 +272,11 @@ private:
   void copy(const EarthMagneticMachine &other);
   // Calculate field
   void calculate();
+  // Calculate the point at the height in the ITRF direction as seen from
+  // the position. subl is the squared difference between the distances of
+  // that point and the position to the Earth centre.
+  static MVPosition subPoint(const MVPosition &pos, const MVDirection &in,
+                             Double subl);
 };
 
 
@@ -39,6 +39,10 @@ MCBase::~MCBase() {}
 //# Operators
 
 //# Member functions
+Bool MCBase::isLinear(const MConvertBase &) const {
+  return False;
+}
+
 void MCBase::makeState(uInt *state,
 		       const uInt ntyp, const uInt nrout,
 		       const uInt list[][3]) {
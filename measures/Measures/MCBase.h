@@ -150,6 +150,11 @@ public:
 			 MRBase &inref,
 			 MRBase &outref,
 			 const MConvertBase &mc) = 0;
+
+  // Tell if the conversion chain is a linear transformation of the internal
+  // value vector for a fixed frame, thus can be done as a matrix
+  // multiplication. The default implementation returns False.
+  virtual Bool isLinear(const MConvertBase &mc) const;
   // </group>
 
 protected:
@@ -614,6 +614,45 @@ void MCDirection::doConvert(MVDirection &in,
   }	// for
 }
 
+Bool MCDirection::isLinear(const MConvertBase &mc) const {
+  for (Int i=0; i<mc.nMethod(); i++) {
+    switch (mc.getMethod(i)) {
+    case GAL_J2000:
+    case GAL_B1950:
+    case J2000_GAL:
+    case B1950_GAL:
+    case J2000_JMEAN:
+    case JMEAN_J2000:
+    case JMEAN_JTRUE:
+    case JTRUE_JMEAN:
+    case HADEC_AZEL:
+    case HADEC_AZELGEO:
+    case AZEL_HADEC:
+    case AZELGEO_HADEC:
+    case AZEL_AZELSW:
+    case AZELGEO_AZELSWGEO:
+    case AZELSW_AZEL:
+    case AZELSWGEO_AZELGEO:
+    case J2000_ECLIP:
+    case ECLIP_J2000:
+    case JMEAN_MECLIP:
+    case MECLIP_JMEAN:
+    case JTRUE_TECLIP:
+    case TECLIP_JTRUE:
+    case GAL_SUPERGAL:
+    case SUPERGAL_GAL:
+    case ITRF_HADEC:
+    case HADEC_ITRF:
+    case ICRS_J2000:
+    case J2000_ICRS:
+      break;
+    default:
+      return False;
+    }
+  }
+  return True;
+}
+
 String MCDirection::showState() {
   std::call_once(theirInitOnceFlag, doFillState);
   return MCBase::showState(MCDirection::FromTo_p[0],
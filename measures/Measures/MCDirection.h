@@ -223,6 +223,11 @@ private:
 		 MRBase &inref,
 		 MRBase &outref,
 		 const MConvertBase &mc);
+
+  // The conversion is linear if all steps are rotations (or reflections),
+  // thus do not involve aberration, light deflection, parallax, E-terms or
+  // planetary positions.
+  virtual Bool isLinear(const MConvertBase &mc) const;
   
 private:
   // Fill the global state. Called using theirInitOnce.
@@ -426,6 +426,10 @@ void MCFrequency::doConvert(MVFrequency &in,
   } //for
 }
 
+Bool MCFrequency::isLinear(const MConvertBase &) const {
+  return True;
+}
+
 String MCFrequency::showState() {
   std::call_once(theirInitOnceFlag, doFillState);
   return MCBase::showState(MCFrequency::FromTo_p[0],
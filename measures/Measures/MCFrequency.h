@@ -180,6 +180,10 @@ private:
 		 MRBase &inref,
 		 MRBase &outref,
 		 const MConvertBase &mc);
+
+  // All frequency conversions are a multiplication with a Doppler factor
+  // depending on the frame only, thus are linear.
+  virtual Bool isLinear(const MConvertBase &mc) const;
   
 private:
   // Fill the global state. Called using theirInitOnce.
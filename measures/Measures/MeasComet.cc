@@ -33,6 +33,7 @@
 #include <casacore/casa/System/Aipsrc.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/casa/System/Aipsrc.h>
 #include <casacore/casa/OS/Path.h>
 
@@ -90,12 +91,16 @@ MeasComet::MeasComet(const MeasComet &other) :
 {
   initMeas(other.tp_p);
   for (uInt i=0; i<2; i++) lnr_p[i] = -1;
+  splineMjd_p = other.splineMjd_p;
+  spline_p = other.spline_p;
 }
 
 MeasComet &MeasComet::operator=(const MeasComet &other) {
   if (this != &other) {
     initMeas(other.tp_p);
     for (uInt i=0; i<2; i++) lnr_p[i] = -1;
+    splineMjd_p = other.splineMjd_p;
+    spline_p = other.spline_p;
   }
   return *this;
 }
@@ -136,6 +141,19 @@ Int MeasComet::nelements() const {
   }
 
 Bool MeasComet::get(MVPosition &returnValue, Double date) const {
+  if (!spline_p.empty()) {
+    Int index;
+    Double f;
+    if (!getInterval(index, f, date)) {
+      returnValue = MVPosition();
+      return False;
+    }
+    const Double *c = &spline_p[16*index];
+    returnValue = MVPosition(c[0] + f*(c[1] + f*(c[2] + f*c[3])),
+			     c[4] + f*(c[5] + f*(c[6] + f*c[7])),
+			     c[8] + f*(c[9] + f*(c[10] + f*c[11])));
+    return True;
+  }
   if(!fillMeas(date)){
     returnValue = MVPosition();
     return False;
@@ -150,6 +168,16 @@ Bool MeasComet::get(MVPosition &returnValue, Double date) const {
   return True;
 }
 
+Bool MeasComet::get(Vector<MVPosition> &returnValues,
+		    const Vector<Double> &dates) const {
+  returnValues.resize(dates.nelements());
+  Bool ok = True;
+  for (uInt i=0; i<dates.nelements(); ++i) {
+    if (!get(returnValues[i], dates[i])) ok = False;
+  }
+  return ok;
+}
+
 MVPosition MeasComet::getRelPosition(const uInt index) const
 {
   return MVPosition(Quantity(ldat_p[index][MeasComet::RHO], "AU"),
@@ -181,6 +209,16 @@ MVDirection MeasComet::getDiskLongLat(const uInt index) const
 
 Bool MeasComet::getRadVel(MVRadialVelocity &returnValue, Double date) const {
   returnValue = 0.0;
+  if (!spline_p.empty()) {
+    Int index;
+    Double f;
+    if (!getInterval(index, f, date)) return False;
+    const Double *c = &spline_p[16*index + 12];
+    returnValue = MVRadialVelocity(Quantity(c[0] + f*(c[1] + f*(c[2] +
+							       f*c[3])),
+					    "AU/d"));
+    return True;
+  }
   if (!fillMeas(date)) return False;
   Double f = (date - ldat_p[0][0])/dmjd_p;
   Double radvel = ldat_p[0][MeasComet::RADVEL];
@@ -191,6 +229,61 @@ Bool MeasComet::getRadVel(MVRadialVelocity &returnValue, Double date) const {
   return True;
 }
 
+Bool MeasComet::loadSplines() {
+  if (!measured_p) return False;
+  spline_p.clear();
+  splineMjd_p.clear();
+  if (nrow_p < 2) return True;
+  Vector<Double> mjd  = ScalarColumn<Double>(tab_p, "MJD").getColumn();
+  Vector<Double> ra   = ScalarColumn<Double>(tab_p, "RA").getColumn();
+  Vector<Double> dec  = ScalarColumn<Double>(tab_p, "DEC").getColumn();
+  Vector<Double> rho  = ScalarColumn<Double>(tab_p, "Rho").getColumn();
+  Vector<Double> rv   = ScalarColumn<Double>(tab_p, "RadVel").getColumn();
+  // Interpolate the positions as x,y,z like the linear interpolation does.
+  Vector<Double> xyz[3];
+  for (uInt j=0; j<3; ++j) xyz[j].resize(nrow_p);
+  for (Int i=0; i<nrow_p; ++i) {
+    const MVPosition pos(Quantity(rho[i], "AU"), Quantity(ra[i], "deg"),
+			 Quantity(dec[i], "deg"));
+    for (uInt j=0; j<3; ++j) xyz[j][i] = pos(j);
+  }
+  splineMjd_p.assign(mjd.begin(), mjd.end());
+  spline_p.resize(16*(nrow_p-1));
+  for (uInt j=0; j<3; ++j) makeSpline(xyz[j], 4*j);
+  makeSpline(rv, 12);
+  return True;
+}
+
+void MeasComet::makeSpline(const Vector<Double> &y, uInt offset) {
+  // Solve the tridiagonal system for the second derivatives of a natural
+  // spline with unit spacing: m[i-1] + 4m[i] + m[i+1] = 6(y[i+1]-2y[i]+y[i-1]).
+  const Int n = y.nelements();
+  std::vector<Double> m(n, 0.0);
+  std::vector<Double> c(n, 0.0);
+  for (Int i=1; i<n-1; ++i) {
+    const Double rhs = 6*(y[i+1] - 2*y[i] + y[i-1]);
+    const Double div = 4 - c[i-1];
+    c[i] = 1/div;
+    m[i] = (rhs - m[i-1]) / div;
+  }
+  for (Int i=n-3; i>0; --i) m[i] -= c[i]*m[i+1];
+  // Polynomial coefficients in the fraction of each interval.
+  for (Int i=0; i<n-1; ++i) {
+    Double *coeff = &spline_p[16*i + offset];
+    coeff[0] = y[i];
+    coeff[1] = y[i+1] - y[i] - (2*m[i] + m[i+1])/6;
+    coeff[2] = m[i]/2;
+    coeff[3] = (m[i+1] - m[i])/6;
+  }
+}
+
+Bool MeasComet::getInterval(Int &index, Double &fraction, Double date) const {
+  index = ifloor((date-mjd0_p)/dmjd_p)-1;
+  if (index<0 || index >= nrow_p-1) return False;
+  fraction = (date - splineMjd_p[index])/dmjd_p;
+  return True;
+}
+
 MeasComet *MeasComet::clone() const {
   return (new MeasComet(*this));
 }
@@ -399,6 +492,8 @@ void MeasComet::closeMeas() {
     for (uInt i=0; i<2; ++i)  lnr_p[i] = -1;
     row_p = ROTableRow();
     tab_p = Table();
+    splineMjd_p.clear();
+    spline_p.clear();
   }
 }
 
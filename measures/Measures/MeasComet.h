@@ -35,6 +35,7 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Quanta/MVPosition.h>
 #include <casacore/measures/Measures/MDirection.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -76,6 +77,17 @@ class MVDirection;
 // The <src>get()</src> method will obtain data from the cometary
 // tables. The data obtained will be in the specified frame.
 // Note that the normal usage of these tables is through the Measures system.
+//
+// By default the positions and radial velocities are linearly interpolated
+// between the two table rows around the requested date. After calling
+// <src>loadSplines()</src> the entire table is held in memory as the
+// coefficients of natural cubic splines through the (x,y,z) positions and
+// radial velocities. A date is then evaluated without table access using
+// the polynomial of its interval. This is more accurate for the typical
+// ephemeris spacing and much faster if many dates are requested (e.g.,
+// per row and antenna of a MeasurementSet). In that mode the
+// <src>get</src> and <src>getRadVel</src> functions do not change the
+// object, so they can be used by multiple threads simultaneously.
 // 
 // <note>
 //	A message is logged (once) if a date outside the range in
@@ -153,6 +165,11 @@ class MeasComet {
   Int nelements() const;
   // Get a comet position
   Bool get(MVPosition &returnValue, Double date) const;
+  // Get the comet positions for the given dates (in MJD(TDB)).
+  // A position outside the range of the table is set to zero, in which
+  // case False is returned.
+  Bool get(Vector<MVPosition> &returnValues,
+	   const Vector<Double> &dates) const;
   // Get the local on-disk direction.  Returns False if the time or sub-observer
   // longitude and latitude are unavailable, True on success.
   Bool getDisk(MVDirection &returnValue, Double date) const;
@@ -167,6 +184,12 @@ class MeasComet {
   // If squawk is true an error message will also be posted.
   Double getMeanRad(const Bool squawk);  
 
+  // Load all positions and radial velocities into memory and use cubic
+  // spline interpolation instead of linear interpolation from now on.
+  // It returns False if the object is not valid.
+  Bool loadSplines();
+  // Tell if cubic spline interpolation is used.
+  Bool usesSplines() const {return !spline_p.empty();} ;
   // Create a clone
   MeasComet *clone() const;
 
@@ -206,6 +229,13 @@ class MeasComet {
   // It sets haveTriedExtras_p to true and will return right away if it is
   // already true.
   Bool getExtras();
+  // Get the spline interval of a date and the fraction of the date in it.
+  // It returns False if the date is outside the table.
+  Bool getInterval(Int &index, Double &fraction, Double date) const;
+  // Calculate the natural cubic spline coefficients (4 per interval) of
+  // the values given for the rows. They are stored in the coefficients of
+  // each interval with the given offset.
+  void makeSpline(const Vector<Double> &values, uInt offset);
 
   //# Data members
 
@@ -258,6 +288,11 @@ class MeasComet {
   Double mean_rad_p;
   Bool hasPosrefsys_p;
   MDirection::Types posrefsystype_p;
+  // MJD of the rows if spline interpolation is used
+  std::vector<Double> splineMjd_p;
+  // Spline coefficients per interval for x, y, z (m) and radial
+  // velocity (AU/d); empty if linear interpolation is used
+  std::vector<Double> spline_p;
 };
 
 //# Inline Implementations
@@ -114,6 +114,14 @@ class MeasVal;
 //		 to be converted
 //    <li> (Vector<Double> >): as previous
 // </ul>
+// Many values can be converted in one go with the
+// <src>convert(const Double*, Double*, size_t)</src> function. The values
+// are given in contiguous arrays of their internal representation
+// (e.g. 3 direction cosines per MVDirection). No Measure is created per
+// value. Moreover, if the conversion chain is linear for the fixed frame
+// (e.g. the rotations between J2000, GALACTIC, HADEC, AZEL and ITRF, or the
+// Doppler factors of frequency conversions), the chain is applied only to
+// the unit vectors to form a matrix which is applied to all values.<br>
 // Float versions will be produced if necessary.<br>
 // The conversion analyser expects that all Measure classes have a set
 // of routines to do the actual analysing and conversion.
@@ -196,6 +204,14 @@ public:
   const M &operator()(const typename M::Ref &mr);
   const M &operator()(typename M::Types mr);
   // </group>
+
+  // Convert <src>n</src> values from the model reference to the output
+  // reference. Each value is given and returned as the vector of its
+  // internal representation (as in <src>MVType::getVector()</src>), thus
+  // as 3 direction cosines for an MVDirection, 2 values (day, fraction) for
+  // an MVEpoch and one value (in Hz) for an MVFrequency.
+  // The output array can be the same as the input array.
+  void convert(const Double *in, Double *out, size_t n);
   
   //# General Member Functions
   // Set a new model for the conversion
@@ -28,6 +28,7 @@
 
 //# Includes
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/OS/ProfileRegistry.h>
 #include <casacore/measures/Measures/MeasBase.h>
 #include <casacore/measures/Measures/MeasConvert.h>
 #include <casacore/measures/Measures/MeasFrame.h>
@@ -409,12 +410,79 @@ const typename M::MVType &MeasConvert<M>::convert() {
 template<class M>
 const typename M::MVType &MeasConvert<M>::
 convert(const typename M::MVType &val) {
+  static ProfileCounter& convCounter =
+    ProfileRegistry::counter ("MeasConvert.convert");
+  ProfileTimer timer(convCounter);
   *locres = val;
   if (offin) *locres += *offin;
   cvdat->doConvert(*locres, *model->getRefPtr(), outref, *this);
   return *locres;
 }
 
+template<class M>
+void MeasConvert<M>::convert(const Double *in, Double *out, size_t n) {
+  if (!model) {
+    throw(AipsError("MeasConvert::convert: no model Measure defined"));
+  }
+  const uInt nval = locres->getVector().nelements();
+  Vector<Double> val(nval);
+  if (!offin && !offout && cvdat->isLinear(*this)) {
+    // Apply the chain to the unit vectors to get the conversion matrix,
+    // which is applied to all values.
+    Vector<Double> mat(nval*nval);
+    for (uInt j=0; j<nval; j++) {
+      val = 0.0;
+      val[j] = 1.0;
+      locres->putVector(val);
+      cvdat->doConvert(*locres, *model->getRefPtr(), outref, *this);
+      Vector<Double> col(locres->getVector());
+      for (uInt i=0; i<nval; i++) mat[i*nval + j] = col[i];
+    }
+    const Double *m = mat.data();
+    if (nval == 1) {
+      // A single factor (e.g. the Doppler factor of a frequency).
+      const Double f = m[0];
+      for (size_t k=0; k<n; k++) {
+	out[k] = f * in[k];
+      }
+    } else if (nval == 3) {
+      for (size_t k=0; k<n; k++) {
+	const Double x = in[0];
+	const Double y = in[1];
+	const Double z = in[2];
+	out[0] = m[0]*x + m[1]*y + m[2]*z;
+	out[1] = m[3]*x + m[4]*y + m[5]*z;
+	out[2] = m[6]*x + m[7]*y + m[8]*z;
+	in += 3;
+	out += 3;
+      }
+    } else {
+      for (size_t k=0; k<n; k++) {
+	for (uInt i=0; i<nval; i++) {
+	  val[i] = 0;
+	  for (uInt j=0; j<nval; j++) val[i] += m[i*nval + j] * in[j];
+	}
+	for (uInt i=0; i<nval; i++) out[i] = val[i];
+	in += nval;
+	out += nval;
+      }
+    }
+  } else {
+    // Convert the values one by one.
+    for (size_t k=0; k<n; k++) {
+      for (uInt i=0; i<nval; i++) val[i] = in[i];
+      locres->putVector(val);
+      if (offin) *locres += *offin;
+      cvdat->doConvert(*locres, *model->getRefPtr(), outref, *this);
+      if (offout) *locres -= *offout;
+      Vector<Double> res(locres->getVector());
+      for (uInt i=0; i<nval; i++) out[i] = res[i];
+      in += nval;
+      out += nval;
+    }
+  }
+}
+
 template<class M>
 void MeasConvert<M>::setModel(const Measure &val) {
   delete model; model = 0;
@@ -35,6 +35,7 @@
 #include <casacore/measures/Measures/MRadialVelocity.h>
 #include <casacore/measures/Measures/MeasComet.h>
 #include <casacore/casa/iostream.h>
+#include <atomic>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -69,8 +70,9 @@ public:
   MeasComet *comval;
   // Pointer to belonging conversion frame
   MCFrame *mymcf;
-  // Usage count
-  Int cnt;
+  // Usage count (atomic, so frames sharing the representation can be
+  // copied and destructed in different threads)
+  std::atomic<Int> cnt;
 };
 
 // MeasFrame class
@@ -104,6 +106,18 @@ MeasFrame::MeasFrame(const MeasFrame &other) {
   if (rep) rep->cnt++;
 }
 
+MeasFrame MeasFrame::copy() const {
+  MeasFrame frame;
+  if (rep) {
+    frame.fill(rep->epval);
+    frame.fill(rep->posval);
+    frame.fill(rep->dirval);
+    frame.fill(rep->radval);
+    frame.fill(rep->comval);
+  }
+  return frame;
+}
+
 // Destructor
 MeasFrame::~MeasFrame() {
   if (rep && rep->cnt && --rep->cnt == 0) delete rep;
@@ -114,6 +114,12 @@ template <class Qtype> class Quantum;
 // <note role=caution> An explicit (or implicit) call to MCFrame::make will
 // load the whole conversion machinery (including Tables) into your
 // linked module).</note><br>
+// A frame caches its calculations, so it is not thread-safe to use the same
+// frame (or copies of it sharing the same representation) in conversions
+// done in parallel. Instead, each thread should use its own frame
+// created with <src>copy()</src>, which makes a deep copy. The underlying
+// IERS and JPL tables are shared by all threads; once the data needed are
+// read, they are accessed without locking.<br>
 // <linkto class=Aipsrc>Aipsrc keywords</linkto> can be used for additional
 // (highly specialised) additional internal conversion parameters.
 // </synopsis>
@@ -123,6 +129,15 @@ template <class Qtype> class Quantum;
 //	MEpoch my_epoch(Quantity(MeasData::MJDB1950,"d")); // an epoch
 //	MeasFrame frame(my_epoch);	// used in a frame
 // </srcblock>
+// Use a conversion engine with its own frame in each thread:
+// <srcblock>
+//	MeasFrame frame(MPosition(...));	// shared frame
+//	// In each thread:
+//	MeasFrame myFrame(frame.copy());
+//	myFrame.set(MEpoch(...));
+//	MDirection::Convert conv(MDirection::J2000,
+//				 MDirection::Ref(MDirection::AZEL, myFrame));
+// </srcblock>
 // </example>
 //
 // <motivation>
@@ -177,6 +192,10 @@ class MeasFrame {
   MeasFrame(const MeasFrame &other);
   // Copy assignment (reference semantics)
   MeasFrame &operator=(const MeasFrame &other);
+  // Make a deep copy of the frame. It contains copies of the frame
+  // measures (and comet), but has its own calculation state, so it can be
+  // used independently of the original (e.g. in another thread).
+  MeasFrame copy() const;
   // Destructor
   ~MeasFrame();
   
@@ -52,15 +52,19 @@ const Double MeasIERS::INTV = 5;
 
 //# Static data
 std::once_flag MeasIERS::theirCallOnceFlag;
+std::once_flag MeasIERS::theirFileOnceFlags[MeasIERS::N_Files];
 uInt MeasIERS::predicttime_reg = 0;
 uInt MeasIERS::notable_reg = 0;
 uInt MeasIERS::forcepredict_reg = 0;
 Double MeasIERS::dateNow = 0.0;
 Vector<Double> MeasIERS::ldat[MeasIERS::N_Files][MeasIERS::N_Types];
+std::unique_ptr<MeasTableCache> MeasIERS::cache[MeasIERS::N_Files];
 const String MeasIERS::tp[MeasIERS::N_Files] = {"IERSeop97", "IERSpredict"};
 uInt MeasIERS::sizeNote = 0;
 uInt MeasIERS::nNote = 0;
 MeasIERS::CLOSEFUN *MeasIERS::toclose = 0;
+std::map<String, Double> MeasIERS::theirLoadTimes;
+std::mutex MeasIERS::theirLoadTimesMutex;
 
 
 //# Member functions
@@ -76,13 +80,18 @@ Bool MeasIERS::get(Double &returnValue,
     return True;
   }
 
-  // Test if PREDICTED has to be used.
+  // Test if PREDICTED has to be used. The MEASURED table is only read
+  // if it might be used.
   Int which = MEASURED;
   if (file == PREDICTED ||
-      ldat[MEASURED][0].empty() ||
       AipsrcValue<Bool>::get(MeasIERS::forcepredict_reg) ||
       (dateNow-date) <= AipsrcValue<Double>::get(MeasIERS::predicttime_reg)) {
     which = PREDICTED;
+  } else {
+    std::call_once(theirFileOnceFlags[MEASURED], initFile, MEASURED);
+    if (ldat[MEASURED][0].empty()) {
+      which = PREDICTED;
+    }
   }
 
   Int ut = ifloor(date);
@@ -94,6 +103,7 @@ Bool MeasIERS::get(Double &returnValue,
   }
 
   if (which == PREDICTED) {
+    std::call_once(theirFileOnceFlags[PREDICTED], initFile, PREDICTED);
 #if defined(USE_THREADS)
     static std::atomic<Bool> msgDone;
 #else
@@ -154,6 +164,20 @@ Bool MeasIERS::get(Double &returnValue,
 
 
 void MeasIERS::initMeas() {
+  predicttime_reg = 
+    AipsrcValue<Double>::registerRC(String("measures.measiers.d_predicttime"),
+                                    Unit("d"), Unit("d"),
+                                    MeasIERS::INTV);
+  notable_reg = 
+    AipsrcValue<Bool>::registerRC(String("measures.measiers.b_notable"),
+                                  False);
+  forcepredict_reg = 
+    AipsrcValue<Bool>::registerRC(String("measures.measiers.b_forcepredict"),
+                                  False);
+  dateNow = Time().modifiedJulianDay();
+}
+
+void MeasIERS::initFile(MeasIERS::Files which) {
   static const String names[MeasIERS::N_Types] = {
     "MJD",
     "x",
@@ -171,50 +195,51 @@ void MeasIERS::initMeas() {
   static const String tplc[N_Files] = {"measures.ierseop97.directory",
                                        "measures.ierspredict.directory"};
 
-  predicttime_reg = 
-    AipsrcValue<Double>::registerRC(String("measures.measiers.d_predicttime"),
-                                    Unit("d"), Unit("d"),
-                                    MeasIERS::INTV);
-  notable_reg = 
-    AipsrcValue<Bool>::registerRC(String("measures.measiers.b_notable"),
-                                  False);
-  forcepredict_reg = 
-    AipsrcValue<Bool>::registerRC(String("measures.measiers.b_forcepredict"),
-                                  False);
-  dateNow = Time().modifiedJulianDay();
-
+  LoadTimer timer(tp[which]);
   TableRecord kws;
   Table tab;
   TableRow row;
   RORecordFieldPtr<Double> rfp[N_Types];
   Double dt;
   String vs;
-  for (Int which=0; which<N_Files; ++which) {
-    if (!MeasIERS::getTable(tab, kws, row,
-                            rfp, vs, dt, 
-                            N_Types, names, tp[which],
-                            tplc[which],
-                            "geodetic")) {
-      LogIO os(LogOrigin("MeasIERS", "initMeas(MeasIERS::Files)", WHERE));
-      os << LogIO::NORMAL1
-         << "Cannot read IERS (Earth axis data) table " << tp[which]
-         << "\nCalculations will proceed with lower precision"
-         << LogIO::POST;
-    } else {
-      MeasIERS::openNote(&MeasIERS::closeMeas);
-      // Read the entire file.
-      for (Int i=0; i<MeasIERS::N_Types; ++i) {
+  if (!MeasIERS::getTable(tab, kws, row,
+                          rfp, vs, dt, 
+                          N_Types, names, tp[which],
+                          tplc[which],
+                          "geodetic")) {
+    LogIO os(LogOrigin("MeasIERS", "initFile(MeasIERS::Files)", WHERE));
+    os << LogIO::NORMAL1
+       << "Cannot read IERS (Earth axis data) table " << tp[which]
+       << "\nCalculations will proceed with lower precision"
+       << LogIO::POST;
+  } else {
+    MeasIERS::openNote(&MeasIERS::closeMeas);
+    // Use the cached data if available. Otherwise create the cache
+    // for the next time.
+    cache[which].reset (new MeasTableCache(tab));
+    if (cache[which]->empty()  &&  MeasTableCache::create (tab)) {
+      cache[which].reset (new MeasTableCache(tab));
+    }
+    // Reference the cached data or read the entire column.
+    for (Int i=0; i<MeasIERS::N_Types; ++i) {
+      uInt64 nvalues;
+      const Double* data = cache[which]->data (names[i], nvalues);
+      if (data  &&  nvalues == 1) {
+        ldat[which][i].reference
+          (Vector<Double>(IPosition(1, cache[which]->nrow()),
+                          const_cast<Double*>(data), SHARE));
+      } else {
         ScalarColumn<Double>(tab, names[i]).getColumn (ldat[which][i]);
       }
-      // Check if MJD in first and last row match and have step 1.
-      const Vector<Double>& mjds = ldat[which][0];
-      if (mjds[mjds.size()-1] != mjds[0] + mjds.size()-1) {
-        LogIO os(LogOrigin("MeasIERS",
-                           "initMeas(MeasIERS::Files)",
-                           WHERE));
-        os << "IERS table " << tp[which]
-           << " seems to be corrupted (time step not 1)" << LogIO::EXCEPTION;
-      }
+    }
+    // Check if MJD in first and last row match and have step 1.
+    const Vector<Double>& mjds = ldat[which][0];
+    if (mjds[mjds.size()-1] != mjds[0] + mjds.size()-1) {
+      LogIO os(LogOrigin("MeasIERS",
+                         "initFile(MeasIERS::Files)",
+                         WHERE));
+      os << "IERS table " << tp[which]
+         << " seems to be corrupted (time step not 1)" << LogIO::EXCEPTION;
     }
   }
 }
@@ -228,11 +253,29 @@ void MeasIERS::closeMeas() {
     for (uInt j=0; j<N_Types; ++j) {
       ldat[i][j].resize();
     }
+    cache[i].reset();
   }
 #if defined(USE_THREADS)
   std::atomic_thread_fence(std::memory_order_release); // pray
 #endif
   new (&theirCallOnceFlag) std::once_flag; // HACK
+  for (uInt i=0; i<N_Files; ++i) {
+    new (&theirFileOnceFlags[i]) std::once_flag; // HACK
+  }
+}
+
+Record MeasIERS::loadTimes() {
+  std::lock_guard<std::mutex> lock(theirLoadTimesMutex);
+  Record rec;
+  for (const auto& entry : theirLoadTimes) {
+    rec.define (entry.first, entry.second);
+  }
+  return rec;
+}
+
+void MeasIERS::noteLoadTime(const String &name, Double seconds) {
+  std::lock_guard<std::mutex> lock(theirLoadTimesMutex);
+  theirLoadTimes[name] += seconds;
 }
 
 void MeasIERS::openNote(CLOSEFUN fun) {
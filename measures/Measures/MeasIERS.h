@@ -32,7 +32,12 @@
 #include <casacore/tables/Tables/TableRow.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Containers/RecordField.h>
+#include <casacore/measures/Measures/MeasTableCache.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/OS/Timer.h>
 
+#include <map>
+#include <memory>
 #include <mutex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -93,6 +98,11 @@ class String;
 // </ul>
 // These values can be set in aipsrc as well as using 
 // <linkto class=AipsrcValue>AipsrcValue</linkto> set() methods.
+//
+// The data of the IERS tables are taken from their memory-mapped
+// <linkto class=MeasTableCache>MeasTableCache</linkto> if available.
+// Otherwise they are read from the table and the cache is created
+// (if possible) to be used next time.
 // <note>
 // 	A message is Logged (once) if an IERS table cannot be found.
 //	A message is logged (once) if a date outside the range in
@@ -228,6 +238,29 @@ public:
   // Notify that a table has successfully been opened with getTable()
   static void openNote(CLOSEFUN fun);
 
+  // Get the time (in seconds) it took to load each of the measures data
+  // tables loaded so far, as a record with a field per table name.
+  // The tables are loaded lazily when first needed by a conversion, so it
+  // shows which tables the conversions done so far required and what it
+  // cost to load them.
+  static Record loadTimes();
+
+  // Add the time (in seconds) it took to load a measures data table.
+  static void noteLoadTime(const String &name, Double seconds);
+
+  // Helper class to note the time between its construction and destruction
+  // as the load time of the given measures data table.
+  class LoadTimer {
+  public:
+    explicit LoadTimer(const String &name)
+      : itsName(name) {}
+    ~LoadTimer()
+      { MeasIERS::noteLoadTime(itsName, itsTimer.real()); }
+  private:
+    String itsName;
+    Timer  itsTimer;
+  };
+
   // Make sure all static tables are closed that were opened with getTable
   // (like JPL, IERS). This is the preferred way to close the
   // Measures related data tables. Only call it last at end of program.
@@ -250,9 +283,12 @@ private:
   // ~MeasIERS();
   
   //# General member functions
-  // Initialise tables
+  // Initialise the general settings
   static void initMeas();
 
+  // Read the given IERS table. Each table is only read when first needed.
+  static void initFile(Files which);
+
   // A helper function for getTable() which is not likely usable outside it.
   // Sets dt and vs (the table version), and checks that 
   //  ks has VS_DATE, VS_VERSION, VS_CREATE, and VS_TYPE,
@@ -264,10 +300,13 @@ private:
   //# Data members
   // Object to ensure safe multi-threaded lazy single initialization
   static std::once_flag theirCallOnceFlag;
+  static std::once_flag theirFileOnceFlags[N_Files];
   // Current date
   static Double dateNow;
   // Read data (meas - predict)
   static Vector<Double> ldat[N_Files][N_Types];
+  // Cache of the tables (ldat can reference its data)
+  static std::unique_ptr<MeasTableCache> cache[N_Files];
   // File names
   static const String tp[N_Files];
   // Check prediction interval
@@ -282,6 +321,9 @@ private:
   static CLOSEFUN *toclose;
   // Number of close notifications
   static uInt nNote;
+  // Load times of the data tables
+  static std::map<String, Double> theirLoadTimes;
+  static std::mutex theirLoadTimesMutex;
 };
 
 //# Inline Implementations
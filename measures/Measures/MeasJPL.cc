@@ -50,8 +50,8 @@ Bool MeasJPL::get(Vector<Double> &returnValue,
     return False;
   }
   // Get or read the correct data if needed.
-  // Note that fillMeas uses locks to be thread-safe. The pointer returned
-  // will never change, even if fillMeas has to extend the buffer.
+  // Note that fillMeas is thread-safe; it only locks when data have to be
+  // read. The pointer returned will never change.
   Double intv;
   const Double* dta = fillMeas(intv, file, date);
   if (!dta) {
@@ -151,6 +151,7 @@ void MeasJPL::doInitMeas(MeasJPL::Files which) {
   static const String tplc[N_Files] = {"measures.DE200.directory",
                                        "measures.DE405.directory"};
 
+  MeasIERS::LoadTimer timer(tp[which]);
   TableRecord kws;
   TableRow row;
   RORecordFieldPtr<Double> rfp[MeasJPL::N_Types];
@@ -200,6 +201,7 @@ void MeasJPL::doInitMeas(MeasJPL::Files which) {
       ok = False;
     } else {
       mjdl[which] = mjd0[which] + n*dmjd[which];
+      dptr[which] = vector<std::atomic<const Double*> >(n);
     }
   }
   if (ok) {
@@ -217,6 +219,12 @@ void MeasJPL::doInitMeas(MeasJPL::Files which) {
         }
       }
       acc[Int(which)].attach(t[which], "x");
+      // Use the cache if available; otherwise try to create it.
+      cache[which].reset (new MeasTableCache(t[which]));
+      if (cache[which]->empty()  &&  MeasTableCache::create (t[which])) {
+        cache[which].reset (new MeasTableCache(t[which]));
+      }
+      cdata[which] = cache[which]->data ("x", cnval[which]);
     }
   }
   if (!ok) {
@@ -240,8 +248,11 @@ void MeasJPL::closeMeas() {
       mjd0[i] = 0;
       mjdl[i] = 0;
       dmjd[i] = 0;
-      curDate[i].resize (0);
-      dval[i].resize (0);
+      dptr[i].clear();
+      dval[i].clear();
+      cdata[i] = 0;
+      cnval[i] = 0;
+      cache[i].reset();
       t[i] = Table();
     }
 #if defined(USE_THREADS)
@@ -262,18 +273,26 @@ const Double* MeasJPL::fillMeas(Double &intv, MeasJPL::Files which,
   ut = (ut-mjd0[which])/dmjd[which];
   intv = ((utf.getDay() - (ut*dmjd[which] + mjd0[which]))
 	   + utf.getDayFraction()) / dmjd[which];
-  // If needed, read the data of this interval.
+  // Use the cached data if available.
+  if (cdata[which]) {
+    return cdata[which] + (ut-1)*cnval[which];
+  }
+  // Use the data of this interval if already read.
+  std::atomic<const Double*>& ptr = dptr[which][ut-1];
+  const Double* dta = ptr.load (std::memory_order_acquire);
+  if (dta) {
+    return dta;
+  }
+  // Read the data (if not done by another thread in the meantime).
   std::lock_guard<std::mutex> locker(theirMutex);
-  for (size_t i=0; i<curDate[which].size(); ++i) {
-    if (ut == curDate[which][i]) {
-      return dval[which][i].data();
-    }
+  dta = ptr.load (std::memory_order_relaxed);
+  if (!dta) {
+    Array<Double> data (acc[Int(which)](ut-1));
+    dval[which].push_back (data);
+    dta = data.data();
+    ptr.store (dta, std::memory_order_release);
   }
-  // Read the data for this date and add to the buffers.
-  Array<Double> data (acc[Int(which)](ut-1));
-  dval[which].push_back (data);
-  curDate[which].push_back (ut);
-  return data.data();
+  return dta;
 }
 
 void MeasJPL::interMeas(Double res[], MeasJPL::Files, Double intv, 
@@ -325,8 +344,11 @@ Int MeasJPL::mjdl[MeasJPL::N_Files] = {0, 0};
 Int MeasJPL::dmjd[MeasJPL::N_Files] = {0, 0};
 const String MeasJPL::tp[MeasJPL::N_Files] = {"DE200", "DE405"};
 Int MeasJPL::idx[MeasJPL::N_Files][3][13];
-vector<Int> MeasJPL::curDate[MeasJPL::N_Files];
+vector<std::atomic<const Double*> > MeasJPL::dptr[MeasJPL::N_Files];
 vector<Vector<Double> > MeasJPL::dval[MeasJPL::N_Files];
+std::unique_ptr<MeasTableCache> MeasJPL::cache[MeasJPL::N_Files];
+const Double* MeasJPL::cdata[MeasJPL::N_Files] = {0, 0};
+uInt64 MeasJPL::cnval[MeasJPL::N_Files] = {0, 0};
 Double MeasJPL::aufac[MeasJPL::N_Files];
 Double MeasJPL::emrat[MeasJPL::N_Files];
 Double MeasJPL::cn[MeasJPL::N_Files][MeasJPL::N_Codes];
@@ -33,7 +33,10 @@
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/casa/Containers/RecordField.h>
+#include <casacore/measures/Measures/MeasTableCache.h>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -78,6 +81,11 @@ class MVEpoch;
 // E.M. Standish et al., JPL IOM 314.10 - 127 for further details.
 // <br>
 // Note that the normal usage of these tables is through the Measures system.
+// <br>
+// The data are taken from the memory-mapped
+// <linkto class=MeasTableCache>MeasTableCache</linkto> of a table if
+// available, so they do not need to be read. Otherwise they are read when
+// needed and the cache is created (if possible) to be used next time.
 // 
 // <note>
 // 	A message is Logged (once) if a table cannot be found.
@@ -223,7 +231,7 @@ private:
   //# Data members
   // Object to ensure safe multi-threaded lazy single initialization
   static std::once_flag theirCallOnceFlags[N_Files];
-  // Mutex for thread-safety (other than initialization).
+  // Mutex for thread-safety when reading data (other than initialization).
   static std::mutex theirMutex;
   // Tables present
   static Table t[N_Files];
@@ -239,10 +247,19 @@ private:
   static const String tp[N_Files];
   // Index in record
   static Int idx[N_Files][3][13];
-  // Dates of the data read in buffer.
-  static vector<Int> curDate[N_Files];
-  // Data read in.
+  // Pointer to the data read per interval (0 if not read yet).
+  // Once set, a pointer does not change, so it can be used without locking.
+  static vector<std::atomic<const Double*> > dptr[N_Files];
+  // Data read in (owning the data the pointers point to).
   static vector<Vector<Double> > dval[N_Files];
+  // Cache of the tables
+  static std::unique_ptr<MeasTableCache> cache[N_Files];
+  // Pointer to the cached data and the number of values per interval
+  // (0 if no cache)
+  // <group>
+  static const Double* cdata[N_Files];
+  static uInt64 cnval[N_Files];
+  // </group>
   // Some helper data read from the table keywords
   // <group>
   static Double aufac[N_Files];
@@ -2853,6 +2853,7 @@ void MeasTable::initObservatories() {
 
 void MeasTable::doInitObservatories()
 {
+  MeasIERS::LoadTimer timer("Observatories");
   Table t;
   ROTableRow row;
   TableRecord kws;
@@ -2962,6 +2963,7 @@ void MeasTable::initLines() {
 
 void MeasTable::doInitLines()
 {
+  MeasIERS::LoadTimer timer("Lines");
   Table t;
   ROTableRow row;
   TableRecord kws;
@@ -3013,6 +3015,7 @@ void MeasTable::initSources() {
 
 void MeasTable::doInitSources()
 {
+  MeasIERS::LoadTimer timer("Sources");
   Table t;
   ROTableRow row;
   TableRecord kws;
@@ -3083,6 +3086,7 @@ void MeasTable::initIGRF() {
 
 void MeasTable::doInitIGRF()
 {
+  MeasIERS::LoadTimer timer("IGRF");
   Table t;
   TableRecord kws;
   ROTableRow row;
@@ -4269,6 +4273,7 @@ Double MeasTable::dUTC(Double utc) {
 MeasTable::Statics_dUTC MeasTable::calc_dUTC() {
   Statics_dUTC rv;
 
+  MeasIERS::LoadTimer timer("TAI_UTC");
   Table t;
   ROTableRow row;
   TableRecord kws;
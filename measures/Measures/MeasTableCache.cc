@@ -0,0 +1,212 @@
+//# MeasTableCache.cc: Memory-mapped cache of the data columns of a measures table
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/measures/Measures/MeasTableCache.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/IO/RegularFileIO.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <cstring>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Layout of the cache file (all header values are uInt64):
+//#   magic, version, byte order marker, mtime and size of table.dat,
+//#   nrow, ncolumn, followed per column by its name (NameSize bytes),
+//#   number of values per row and offset of its data in the file.
+static const char   theMagic[8] = {'M','E','A','S','C','A','C','H'};
+static const uInt64 theVersion  = 1;
+static const uInt64 theMarker   = 0x0102030405060708ULL;
+static const uInt64 theNameSize = 32;
+static const uInt64 theHeaderSize = 7*sizeof(uInt64);
+static const uInt64 theColumnSize = theNameSize + 2*sizeof(uInt64);
+
+MeasTableCache::MeasTableCache (const Table& table)
+  : itsNrow (0)
+{
+  String name = fileName (table);
+  if (! File(name).isReadable()) {
+    return;
+  }
+  try {
+    std::unique_ptr<MMapIO> file (new MMapIO (RegularFile(name)));
+    uInt64 fileSize = file->getFileSize();
+    if (fileSize < theHeaderSize) {
+      return;
+    }
+    const char* base = static_cast<const char*>(file->getReadPointer (0));
+    const uInt64* hdr = reinterpret_cast<const uInt64*>(base);
+    if (memcmp (base, theMagic, sizeof(theMagic)) != 0  ||
+        hdr[1] != theVersion  ||  hdr[2] != theMarker) {
+      return;
+    }
+    uInt mtime;
+    Int64 size;
+    tableFileInfo (table, mtime, size);
+    if (hdr[3] != mtime  ||  hdr[4] != uInt64(size)  ||
+        hdr[5] != table.nrow()) {
+      return;
+    }
+    uInt64 nrow = hdr[5];
+    uInt64 ncol = hdr[6];
+    if (fileSize < theHeaderSize + ncol*theColumnSize) {
+      return;
+    }
+    for (uInt64 i=0; i<ncol; ++i) {
+      const char* col = base + theHeaderSize + i*theColumnSize;
+      const uInt64* info = reinterpret_cast<const uInt64*>(col + theNameSize);
+      uInt64 nvalues = info[0];
+      uInt64 offset  = info[1];
+      if (offset % sizeof(Double) != 0  ||
+          offset + nrow*nvalues*sizeof(Double) > fileSize) {
+        itsColumns.clear();
+        return;
+      }
+      String colName (col, strnlen (col, theNameSize));
+      itsColumns[colName] = std::make_pair
+        (reinterpret_cast<const Double*>(base + offset), nvalues);
+    }
+    itsFile = std::move (file);
+    itsNrow = nrow;
+  } catch (const std::exception&) {
+    // An unusable cache is ignored.
+    itsColumns.clear();
+  }
+}
+
+const Double* MeasTableCache::data (const String& column,
+                                    uInt64& nvalues) const
+{
+  std::map<String, std::pair<const Double*, uInt64> >::const_iterator iter =
+    itsColumns.find (column);
+  if (iter == itsColumns.end()) {
+    nvalues = 0;
+    return 0;
+  }
+  nvalues = iter->second.second;
+  return iter->second.first;
+}
+
+Bool MeasTableCache::create (const Table& table)
+{
+  String tmpName;
+  try {
+    // Read the data of all Double columns.
+    const TableDesc& td = table.tableDesc();
+    std::vector<String> names;
+    std::vector<Array<Double> > data;
+    for (uInt i=0; i<td.ncolumn(); ++i) {
+      const ColumnDesc& cd = td[i];
+      if (cd.dataType() != TpDouble  ||  cd.name().size() >= theNameSize) {
+        continue;
+      }
+      if (cd.isScalar()) {
+        data.push_back (ScalarColumn<Double>(table, cd.name()).getColumn());
+      } else {
+        try {
+          data.push_back (ArrayColumn<Double>(table, cd.name()).getColumn());
+        } catch (const AipsError&) {
+          // Shape varies or undefined cells; do not cache this column.
+          continue;
+        }
+      }
+      names.push_back (cd.name());
+    }
+    // Make the header.
+    uInt64 nrow = table.nrow();
+    uInt mtime;
+    Int64 size;
+    tableFileInfo (table, mtime, size);
+    std::vector<char> hdr(theHeaderSize + names.size()*theColumnSize, 0);
+    uInt64* hdrv = reinterpret_cast<uInt64*>(hdr.data());
+    memcpy (hdr.data(), theMagic, sizeof(theMagic));
+    hdrv[1] = theVersion;
+    hdrv[2] = theMarker;
+    hdrv[3] = mtime;
+    hdrv[4] = size;
+    hdrv[5] = nrow;
+    hdrv[6] = names.size();
+    uInt64 offset = hdr.size();
+    for (size_t i=0; i<names.size(); ++i) {
+      char* col = hdr.data() + theHeaderSize + i*theColumnSize;
+      memcpy (col, names[i].chars(), names[i].size());
+      uInt64* info = reinterpret_cast<uInt64*>(col + theNameSize);
+      info[0] = (nrow == 0  ?  0 : data[i].size() / nrow);
+      info[1] = offset;
+      offset += data[i].size() * sizeof(Double);
+    }
+    // Write into a temporary file and rename it, so other processes
+    // never see a partly written cache.
+    tmpName = File::newUniqueName (table.tableName(),
+                                   "table.measurescache_").absoluteName();
+    {
+      RegularFileIO file (RegularFile(tmpName), ByteIO::New);
+      file.write (hdr.size(), hdr.data());
+      for (size_t i=0; i<data.size(); ++i) {
+        Bool deleteIt;
+        const Double* ptr = data[i].getStorage (deleteIt);
+        file.write (data[i].size() * sizeof(Double), ptr);
+        data[i].freeStorage (ptr, deleteIt);
+      }
+    }
+    RegularFile(tmpName).move (fileName(table));
+  } catch (const std::exception&) {
+    // The cache could not be created (e.g. directory not writable).
+    if (! tmpName.empty()) {
+      RegularFile tmpFile(tmpName);
+      if (tmpFile.exists()) {
+        try {
+          tmpFile.remove();
+        } catch (const std::exception&) {
+        }
+      }
+    }
+    return False;
+  }
+  return True;
+}
+
+String MeasTableCache::fileName (const Table& table)
+{
+  return table.tableName() + "/table.measurescache";
+}
+
+void MeasTableCache::tableFileInfo (const Table& table,
+                                    uInt& mtime, Int64& size)
+{
+  RegularFile file(table.tableName() + "/table.dat");
+  mtime = file.modifyTime();
+  size  = file.size();
+}
+
+} //# NAMESPACE CASACORE - END
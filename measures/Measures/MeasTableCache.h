@@ -0,0 +1,148 @@
+//# MeasTableCache.h: Memory-mapped cache of the data columns of a measures table
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef MEASURES_MEASTABLECACHE_H
+#define MEASURES_MEASTABLECACHE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/IO/MMapIO.h>
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Table;
+
+// <summary>
+// Memory-mapped cache of the data columns of a measures table
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tMeasIERS" demos="">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=MeasIERS>MeasIERS</linkto> class
+//   <li> <linkto class=MeasJPL>MeasJPL</linkto> class
+// </prerequisite>
+//
+// <etymology>
+// From Measure, Table and cache
+// </etymology>
+//
+// <synopsis>
+// Opening the IERS and JPL tables and reading their data through the
+// Table system takes a noticeable amount of time, which dominates the
+// first conversion in short-lived processes. Therefore the Double columns
+// of such a table can be stored in a compact binary file
+// <src>table.measurescache</src> in the table directory. This file is
+// memory-mapped, so the data of a column are directly available (and
+// shared between processes) without reading them.
+// <br>The values of a scalar column are stored consecutively. An array
+// column (which must have the same shape in all rows) is stored as
+// the values of row 0, row 1, etc.
+// <br>The cache is only used if it matches the table, i.e., if the table
+// has the same number of rows and its <src>table.dat</src> file has the
+// same modification time and size as when the cache was created.
+// The file is in native byte order; a cache in another byte order is
+// not used.
+// <p>
+// The cache is created by the <src>measuresdata</src> program when
+// creating or updating a table and by MeasIERS when it reads a table
+// for which no valid cache exists. The cache file is written under a
+// temporary name and renamed, so other processes never see a partly
+// written file. Failure to create the cache (e.g. because the directory
+// is not writable) is not an error; the table is used instead.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   Table tab("DE405");
+//   MeasTableCache cache(tab);
+//   uInt64 nvalues;
+//   const Double* data = cache.data ("x", nvalues);
+//   if (data) {
+//     // the values of row i start at data + i*nvalues
+//   }
+// </srcblock>
+// </example>
+//
+// <motivation>
+// To reduce the startup time of processes using the Measures tables.
+// </motivation>
+
+class MeasTableCache
+{
+public:
+  // Open the cache of the given table. The cache is empty if it does not
+  // exist or does not match the table.
+  explicit MeasTableCache (const Table& table);
+
+  // Forbid copy constructor and assignment.
+  // <group>
+  MeasTableCache (const MeasTableCache&) = delete;
+  MeasTableCache& operator= (const MeasTableCache&) = delete;
+  // </group>
+
+  // Is the cache empty?
+  Bool empty() const
+    { return !itsFile; }
+
+  // Get the number of rows.
+  uInt64 nrow() const
+    { return itsNrow; }
+
+  // Get a pointer to the data of the given column and the number of
+  // values per row. A null pointer is returned if the column is not cached.
+  const Double* data (const String& column, uInt64& nvalues) const;
+
+  // Create the cache of all Double columns of the table (array columns
+  // only if they have the same shape in all rows).
+  // It returns False if the cache could not be created.
+  static Bool create (const Table& table);
+
+  // Get the name of the cache file of a table.
+  static String fileName (const Table& table);
+
+private:
+  // Get the modification time and size of the table.dat file.
+  static void tableFileInfo (const Table& table, uInt& mtime, Int64& size);
+
+  //# Data members
+  std::unique_ptr<MMapIO> itsFile;
+  uInt64 itsNrow;
+  // Pointer to the data and number of values per row per column.
+  std::map<String, std::pair<const Double*, uInt64> > itsColumns;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -41,6 +41,9 @@ const Double Nutation::INTV = 0.04;
 uInt Nutation::myInterval_reg = 0;
 uInt Nutation::myUseiers_reg = 0;
 uInt Nutation::myUsejpl_reg = 0;
+std::vector<Nutation::CacheEntry> Nutation::theirCache;
+uInt Nutation::theirCacheNext = 0;
+std::mutex Nutation::theirCacheMutex;
 
 //# Constructors
 Nutation::Nutation() :
@@ -140,6 +143,69 @@ void Nutation::fill() {
 void Nutation::refresh() {
   checkEpoch_p = 1e30;
   checkDerEpoch_p = 1e30;
+  // Clear the shared calculations as well.
+  std::lock_guard<std::mutex> lock(theirCacheMutex);
+  theirCache.clear();
+  theirCacheNext = 0;
+}
+
+Bool Nutation::getCached(Double time, Double epsilon) {
+  Bool useiers = AipsrcValue<Bool>::get(Nutation::myUseiers_reg);
+  Bool usejpl  = AipsrcValue<Bool>::get(Nutation::myUsejpl_reg);
+  std::lock_guard<std::mutex> lock(theirCacheMutex);
+  for (std::vector<CacheEntry>::const_iterator iter = theirCache.begin();
+       iter != theirCache.end(); ++iter) {
+    if (iter->method == method_p && iter->useiers == useiers &&
+	iter->usejpl == usejpl && nearAbs(time, iter->epoch, epsilon)) {
+      checkEpoch_p = iter->epoch;
+      checkDerEpoch_p = 1e30;
+      for (uInt i=0; i<3; ++i) nval_p[i] = iter->nval[i];
+      eqeq_p = iter->eqeq;
+      neval_p = iter->neval;
+      if (iter->hasDer) {
+	checkDerEpoch_p = iter->epoch;
+	for (uInt i=0; i<3; ++i) dval_p[i] = iter->dval[i];
+	deqeq_p = iter->deqeq;
+	deval_p = iter->deval;
+      }
+      return True;
+    }
+  }
+  return False;
+}
+
+void Nutation::putCached() {
+  CacheEntry entry;
+  entry.method = method_p;
+  entry.useiers = AipsrcValue<Bool>::get(Nutation::myUseiers_reg);
+  entry.usejpl = AipsrcValue<Bool>::get(Nutation::myUsejpl_reg);
+  entry.hasDer = (checkDerEpoch_p == checkEpoch_p);
+  entry.epoch = checkEpoch_p;
+  for (uInt i=0; i<3; ++i) {
+    entry.nval[i] = nval_p[i];
+    entry.dval[i] = dval_p[i];
+  }
+  entry.eqeq = eqeq_p;
+  entry.deqeq = deqeq_p;
+  entry.neval = neval_p;
+  entry.deval = deval_p;
+  std::lock_guard<std::mutex> lock(theirCacheMutex);
+  // Replace the entry for this calculation if already present.
+  for (std::vector<CacheEntry>::iterator iter = theirCache.begin();
+       iter != theirCache.end(); ++iter) {
+    if (iter->method == entry.method && iter->useiers == entry.useiers &&
+	iter->usejpl == entry.usejpl && iter->epoch == entry.epoch) {
+      *iter = entry;
+      return;
+    }
+  }
+  // Otherwise add it, replacing the oldest entry if the cache is full.
+  if (theirCache.size() < theirCacheSize) {
+    theirCache.push_back(entry);
+  } else {
+    theirCache[theirCacheNext] = entry;
+    theirCacheNext = (theirCacheNext+1) % theirCache.size();
+  }
 }
 
 Double Nutation::eqox(Double epoch) {
@@ -182,7 +248,8 @@ void Nutation::calcNut(Double time, Bool calcDer) {
     epsilon = AipsrcValue<Double>::get(Nutation::myInterval_reg);
   }
   Bool renew = False;
-  if (!nearAbs(time, checkEpoch_p, epsilon)) {
+  Bool derCalc = False;
+  if (!nearAbs(time, checkEpoch_p, epsilon) && !getCached(time, epsilon)) {
     checkEpoch_p = time;
     renew = True;
     Double dEps = 0;
@@ -348,6 +415,7 @@ void Nutation::calcNut(Double time, Bool calcDer) {
        checkEpoch_p != checkDerEpoch_p)) {
     t = checkEpoch_p;
     checkDerEpoch_p = t;
+    derCalc = True;
     switch (method_p) {
     case B1950:
       t = (t - MeasData::MJDB1900)/MeasData::JDCEN;
@@ -505,6 +573,9 @@ void Nutation::calcNut(Double time, Bool calcDer) {
       break;
     }
   }
+  if (renew || derCalc) {
+    putCached();
+  }
 }
 
 
@@ -30,6 +30,8 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Quanta/Quantum.h>
 #include <casacore/casa/Quanta/Euler.h>
+#include <mutex>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -90,6 +92,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // using the derivative if within about 2 hours (error less than about
 // 10<sup>-5</sup> mas). A call to refresh() will re-initiate calculations
 // from scratch.<br>
+// The calculated values (and derivatives) are kept in a small
+// process-wide cache shared by all Nutation objects. If an object needs a
+// new calculation, it first looks in the cache for a calculation of the
+// same type within the interpolation interval. Thus the many conversion
+// engines (e.g. one per thread) converting for the same times calculate
+// the expensive series (in particular the 1365 terms of IAU2000A) only once.
+// The cache is thread-safe.<br>
 // The following details can be set with the 
 // <linkto class=Aipsrc>Aipsrc</linkto> mechanism:
 // <ul>
@@ -223,6 +232,27 @@ class Nutation {
   static uInt myUseiers_reg;
   // JPL use
   static uInt myUsejpl_reg;
+  // An entry in the process-wide cache of calculations
+  struct CacheEntry {
+    NutationTypes method;
+    Bool   useiers;
+    Bool   usejpl;
+    Bool   hasDer;
+    Double epoch;
+    Double nval[3];
+    Double dval[3];
+    Double eqeq;
+    Double deqeq;
+    Double neval;
+    Double deval;
+  };
+  // The process-wide cache and the mutex protecting it
+  // <group>
+  static const uInt theirCacheSize = 256;
+  static std::vector<CacheEntry> theirCache;
+  static uInt theirCacheNext;
+  static std::mutex theirCacheMutex;
+  // </group>
   //# Member functions
   // Make a copy
   void copy(const Nutation &other);
@@ -230,6 +260,11 @@ class Nutation {
   void fill();
   // Calculate Nutation angles for time t; also derivatives if True given
   void calcNut(Double t, Bool calcDer = False);
+  // Get the calculation for an epoch within epsilon of time from the cache.
+  // It returns False if not found.
+  Bool getCached(Double time, Double epsilon);
+  // Put the current calculation into the cache.
+  void putCached();
 };
 
 
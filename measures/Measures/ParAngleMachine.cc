@@ -34,6 +34,7 @@
 #include <casacore/casa/BasicSL/Constants.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Quanta/Unit.h>
+#include <exception>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -162,6 +163,61 @@ ParAngleMachine::operator()(const Vector<MEpoch> &ep) const {
   return Quantum<Vector<Double> >(res, un);
 }
 
+Matrix<Double>
+ParAngleMachine::operator()(const Vector<Double> &ep,
+                            const Vector<MPosition> &pos) const {
+  if (!indir_p) throw(AipsError("A ParAngleMachine must have a Direction"));
+  MEpoch::Types timeType = MEpoch::UTC;
+  if (frame_p && frame_p->epoch()) {
+    timeType = MEpoch::castType(frame_p->epoch()->getRefPtr()->getType());
+  }
+  // Only keep the direction type, so no frame is shared between threads.
+  const MDirection dir(indir_p->getValue(),
+                       MDirection::castType(indir_p->getRef().getType()));
+  const Int64 npos = pos.nelements();
+  const Int64 nep = ep.nelements();
+  Matrix<Double> res(npos, nep);
+  // The epochs of a position are done in blocks, each by its own machine,
+  // so the simple formula can be used for the subsequent epochs in a block.
+  const Int64 blockSize = 256;
+  const Int64 nblock = (nep + blockSize - 1) / blockSize;
+  const Int64 nwork = npos * nblock;
+  const Double* epoch = ep.data();
+  Double* out = res.data();
+  std::exception_ptr error;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (nwork > 1)
+#endif
+  for (Int64 w=0; w<nwork; ++w) {
+    // Exceptions cannot leave a parallel loop, so the first one is kept
+    // and rethrown afterwards.
+    try {
+      const Int64 p = w / nblock;
+      const Int64 st = (w % nblock) * blockSize;
+      const Int64 end = std::min(st + blockSize, nep);
+      ParAngleMachine pam(dir);
+      pam.set(MeasFrame(MEpoch(MVEpoch(), timeType), pos[p]));
+      pam.setInterval(defintvl_p);
+      for (Int64 i=st; i<end; ++i) {
+        out[i*npos + p] = pam(epoch[i]);
+      }
+    } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(ParAngleMachine_operator)
+#endif
+      {
+        if (! error) {
+          error = std::current_exception();
+        }
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception (error);
+  }
+  return res;
+}
+
 //# Member functions
 void ParAngleMachine::set(const MDirection &in) {
   delete indir_p; indir_p = 0;
@@ -32,10 +32,12 @@
 #include <casacore/measures/Measures/MDirection.h>
 #include <casacore/measures/Measures/MCEpoch.h>
 #include <casacore/measures/Measures/MEpoch.h>
+#include <casacore/measures/Measures/MPosition.h>
 #include <casacore/casa/Quanta/Quantum.h>
 #include <casacore/casa/Quanta/MVDirection.h>
 #include <casacore/casa/Quanta/MVEpoch.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -140,6 +142,18 @@ class ParAngleMachine {
   Vector<Double> operator()(const Vector<Double> &ep) const;
   // </group>
 
+  // Return the parallactic angles (rad) for all epochs (in days) and
+  // positions (e.g. antennae) as a matrix with shape [npos,nepoch].
+  // The epochs are of the type of the epoch in the frame (UTC if none).
+  // The calculations are done in parallel (if OpenMP is used), where each
+  // thread uses its own machine with its own frame. Therefore this machine
+  // is not changed and the function can be used by multiple threads.
+  // <thrown>
+  // <li> AipsError if the machine has no direction
+  // </thrown>
+  Matrix<Double> operator()(const Vector<Double> &ep,
+                            const Vector<MPosition> &pos) const;
+
   //# Member functions
   // Will have a group of set methods (in direction; reference time; a frame;
   // a reference time valid period
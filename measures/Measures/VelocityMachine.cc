@@ -153,12 +153,32 @@ const Quantum<Double> &VelocityMachine::makeFrequency(Double in) {
 const Quantum<Vector<Double> > &VelocityMachine::
 makeVelocity(const Vector<Double> &in) {
   uInt n = in.nelements();
-  vresv_p.getValue().resize(n);
+  Vector<Double>& res = vresv_p.getValue();
+  res.resize(n);
+  if (useFactor()) {
+    // A frequency frame conversion is a multiplication with a Doppler factor
+    // depending on the frame only, so it is calculated once.
+    const Double fac = cvfv_p(MVFrequency(ffac_p)).getValue().getValue() /
+      rest_p.getValue();
+    const Double* inp = in.data();
+    Double* out = res.data();
+    for (uInt i=0; i<n; ++i) {
+      Double t = inp[i] * fac;
+      t *= t;
+      out[i] = (1-t)/(1+t);
+    }
+    cvvo_p.convert(out, out, n);
+    const Double vfac = C::c / vfac_p;
+    for (uInt i=0; i<n; ++i) {
+      out[i] *= vfac;
+    }
+    return vresv_p;
+  }
   for (uInt i=0; i<n; ++i) {
     Double t = cvfv_p(in[i]).getValue();
     t /= rest_p.getValue();
     t *= t;
-    vresv_p.getValue()[i] = cvvo_p(MVDoppler((1-t)/(1+t))).
+    res[i] = cvvo_p(MVDoppler((1-t)/(1+t))).
       getValue().getValue()* C::c / vfac_p;
   }
   return vresv_p;
@@ -167,14 +187,29 @@ makeVelocity(const Vector<Double> &in) {
 const Quantum<Vector<Double> > &VelocityMachine::
 makeFrequency(const Vector<Double> &in) {
   uInt n = in.nelements();
-  vresf_p.getValue().resize(n);
+  Vector<Double>& res = vresf_p.getValue();
+  res.resize(n);
+  if (useFactor()) {
+    const Double vfac = vfac_p / C::c;
+    const Double* inp = in.data();
+    Double* out = res.data();
+    for (uInt i=0; i<n; ++i) {
+      out[i] = inp[i] * vfac;
+    }
+    cvov_p.convert(out, out, n);
+    const Double fac = cvvf_p(MVFrequency(1.)).getValue().getValue() *
+      rest_p.getValue() / ffac_p;
+    for (uInt i=0; i<n; ++i) {
+      out[i] = sqrt((1-out[i])/(1+out[i])) * fac;
+    }
+    return vresf_p;
+  }
   for (uInt i=0; i<n; i++) {
-    vresf_p.getValue()(i) = MVFrequency(cvvf_p(MFrequency::
-					       fromDoppler(cvov_p(in(i)),
-							   rest_p, vfm_p).
-					       getValue()).
-					getValue().getValue()).get(fun_p).
-      getValue();
+    res(i) = MVFrequency(cvvf_p(MFrequency::
+                                fromDoppler(cvov_p(in(i)),
+                                            rest_p, vfm_p).
+                                getValue()).
+                         getValue().getValue()).get(fun_p).getValue();
   }
   return vresf_p;
 }
@@ -248,6 +283,12 @@ const MFrequency::Types &VelocityMachine::getConversionReference() const {
 void VelocityMachine::init() {
   // Get factor to convert user velocity units to base units
   vfac_p = MVDoppler(Quantity(1, vun_p)).get().getValue();
+  // Get factor to convert user frequency units to Hz if proportional
+  static const UnitVal InvTime = UnitVal::NODIM/UnitVal::TIME;
+  ffac_p = 0;
+  if (fun_p.getValue() == InvTime) {
+    ffac_p = fun_p.getValue().getFac();
+  }
   // Set the velocity and frequency units the user wants in the output
   resv_p.setUnit(vun_p);
   resf_p.setUnit(fun_p);
@@ -263,6 +304,10 @@ void VelocityMachine::init() {
   cvov_p.set(vun_p);
 }
 
+Bool VelocityMachine::useFactor() const {
+  return ffac_p != 0  &&  !fref_p.offset();
+}
+
 void VelocityMachine::copy(const VelocityMachine &other) {
   fref_p = other.fref_p;
   fun_p = other.fun_p;
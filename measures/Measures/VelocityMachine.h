@@ -290,6 +290,9 @@ private:
   Unit vun_p;
   Double vfac_p;
   // </group>
+  // Factor to convert user frequency units to Hz (0 if the units are not
+  // proportional to frequency, e.g. a wavelength)
+  Double ffac_p;
   // Frequency conversion forward
   MFrequency::Convert cvfv_p;
   // Frequency conversion backward
@@ -309,6 +312,9 @@ private:
   //# Private Member Functions
   // Initialise machinery
   void init();
+  // Can the vector conversions use a single Doppler factor for the
+  // frequency frame conversion?
+  Bool useFactor() const;
   // Copy data members
   void copy(const VelocityMachine &other);
 };
@@ -0,0 +1,381 @@
+//# bMeasPerf.cc: Benchmark Measures conversions and machines
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/measures/Measures/MEpoch.h>
+#include <casacore/measures/Measures/MPosition.h>
+#include <casacore/measures/Measures/MDirection.h>
+#include <casacore/measures/Measures/MFrequency.h>
+#include <casacore/measures/Measures/MRadialVelocity.h>
+#include <casacore/measures/Measures/MDoppler.h>
+#include <casacore/measures/Measures/MBaseline.h>
+#include <casacore/measures/Measures/Muvw.h>
+#include <casacore/measures/Measures/MEarthMagnetic.h>
+#include <casacore/measures/Measures/MCEpoch.h>
+#include <casacore/measures/Measures/MCPosition.h>
+#include <casacore/measures/Measures/MCDirection.h>
+#include <casacore/measures/Measures/MCFrequency.h>
+#include <casacore/measures/Measures/MCRadialVelocity.h>
+#include <casacore/measures/Measures/MCDoppler.h>
+#include <casacore/measures/Measures/MCBaseline.h>
+#include <casacore/measures/Measures/MCuvw.h>
+#include <casacore/measures/Measures/MCEarthMagnetic.h>
+#include <casacore/measures/Measures/MeasConvert.h>
+#include <casacore/measures/Measures/MeasFrame.h>
+#include <casacore/measures/Measures/UVWMachine.h>
+#include <casacore/measures/Measures/BatchUVWMachine.h>
+#include <casacore/measures/Measures/ParAngleMachine.h>
+#include <casacore/measures/Measures/VelocityMachine.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/Benchmark.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+using namespace casacore;
+using namespace std;
+
+// This program benchmarks MeasConvert for all measure types, the
+// UVWMachine, BatchUVWMachine, ParAngleMachine and VelocityMachine.
+// Each iteration converts a number of values at consecutive times, so the
+// frame changes for each value as in a typical pipeline step.
+// Conversions depending on precession and nutation are run with the
+// IAU1980 and the IAU2000 models.
+// All benchmarks are run single-threaded and multi-threaded, where each
+// thread uses its own conversion engine and frame.
+// The derivedmscal engines are benchmarked by bDerivedMSCalPerf.
+//
+// It is built by 'make bench'. Run it as:
+//    bMeasPerf [nvalue [nthread]] [benchmark options]
+// nvalue is the number of values converted per iteration (default 1000).
+// nthread is the number of threads used in the multi-threaded runs
+// (default the number of cores).
+// E.g., to compare two releases (using Google Benchmark's compare.py):
+//    bMeasPerf --benchmark_out=new.json
+//    compare.py benchmarks old.json new.json
+
+uInt nvalue  = 1000;
+uInt nthread = 1;
+const uInt nantenna = 14;
+const Double startMJD = 58000.;          // start time in days
+const Double timeStep = 10./86400.;      // time step in days
+
+// Set the use of the IAU2000 precession/nutation models.
+void setIAU2000 (Bool use)
+{
+  static const uInt reg =
+    AipsrcValue<Bool>::registerRC ("measures.iau2000.b_use", False);
+  AipsrcValue<Bool>::set (reg, use);
+}
+
+// The observatory position (WSRT) and a source direction.
+MPosition obsPosition()
+{
+  return MPosition (MVPosition(3828488.8, 443253.5, 5064977.2),
+                    MPosition::ITRF);
+}
+
+MDirection srcDirection (MDirection::Types type = MDirection::J2000)
+{
+  return MDirection (Quantity(30., "deg"), Quantity(50., "deg"), type);
+}
+
+// Get the epoch (in days) of the i-th value.
+inline Double epoch (uInt i)
+  { return startMJD + i*timeStep; }
+
+
+// A work function converts nvalue values using its own engines.
+// A MakeWork function creates such a work function, so each thread can
+// have its own engines.
+typedef std::function<void()> Work;
+typedef std::function<Work()> MakeWork;
+
+// Add a benchmark single-threaded and multi-threaded.
+// If iau is True, it is done for the IAU1980 and IAU2000 models.
+void addBench (Benchmark& bench, const String& name, const MakeWork& make,
+               Bool iau)
+{
+  std::vector<uInt> nthreads(1, 1);
+  if (nthread > 1) {
+    nthreads.push_back (nthread);
+  }
+  std::vector<String> models(1, String());
+  if (iau) {
+    models = std::vector<String> {"IAU1980", "IAU2000"};
+  }
+  for (const String& model : models) {
+    for (uInt nthr : nthreads) {
+      String fullName = name + (model.empty() ? "" : '/' + model) +
+                        "/threads:" + String::toString(nthr);
+      auto works = std::make_shared<std::vector<Work>>();
+      bench.add (fullName, [make, model, nthr, works](BenchmarkState& state) {
+          if (state.iterations() == 0) {
+            // Create the engines outside the timing.
+            state.pauseTiming();
+            if (! model.empty()) {
+              setIAU2000 (model == "IAU2000");
+            }
+            works->clear();
+            for (uInt i=0; i<nthr; ++i) {
+              works->push_back (make());
+            }
+            state.resumeTiming();
+          }
+          if (nthr == 1) {
+            (*works)[0]();
+          } else {
+            std::vector<std::thread> threads;
+            for (uInt i=0; i<nthr; ++i) {
+              threads.emplace_back ((*works)[i]);
+            }
+            for (std::thread& thr : threads) {
+              thr.join();
+            }
+          }
+          state.addItems (uInt64(nthr) * nvalue);
+        });
+    }
+  }
+}
+
+
+// Make a work function converting nvalue measures of type M.
+// The frame epoch is set to the time of each value; the value to convert
+// is made by the makeValue function.
+template<typename M>
+MakeWork makeConvert (typename M::Types inType,
+                      typename M::Types outType,
+                      std::function<typename M::MVType(uInt)> makeValue)
+{
+  return [inType, outType, makeValue]() -> Work {
+    auto frame = std::make_shared<MeasFrame>
+      (MEpoch(Quantity(startMJD, "d"), MEpoch::UTC), obsPosition(),
+       srcDirection());
+    auto conv = std::make_shared<typename M::Convert>
+      (typename M::Ref(inType, *frame), typename M::Ref(outType, *frame));
+    return [frame, conv, makeValue]() {
+      for (uInt i=0; i<nvalue; ++i) {
+        frame->resetEpoch (epoch(i));
+        (*conv)(makeValue(i));
+      }
+    };
+  };
+}
+
+void addConversions (Benchmark& bench)
+{
+  // Epochs.
+  std::function<MVEpoch(uInt)> epochValue = [](uInt i) {
+    return MVEpoch(epoch(i));
+  };
+  addBench (bench, "MEpoch/UTC->TAI",
+            makeConvert<MEpoch> (MEpoch::UTC, MEpoch::TAI, epochValue), False);
+  addBench (bench, "MEpoch/UTC->TDB",
+            makeConvert<MEpoch> (MEpoch::UTC, MEpoch::TDB, epochValue), False);
+  addBench (bench, "MEpoch/UTC->LAST",
+            makeConvert<MEpoch> (MEpoch::UTC, MEpoch::LAST, epochValue), True);
+  // Positions.
+  std::function<MVPosition(uInt)> posValue = [](uInt i) {
+    return MVPosition(3828488.8 + i, 443253.5 - i, 5064977.2);
+  };
+  addBench (bench, "MPosition/ITRF->WGS84",
+            makeConvert<MPosition> (MPosition::ITRF, MPosition::WGS84,
+                                    posValue), False);
+  // Directions.
+  std::function<MVDirection(uInt)> dirValue = [](uInt i) {
+    return MVDirection(Quantity(30. + 1e-3*i, "deg"), Quantity(50., "deg"));
+  };
+  addBench (bench, "MDirection/J2000->APP",
+            makeConvert<MDirection> (MDirection::J2000, MDirection::APP,
+                                     dirValue), True);
+  addBench (bench, "MDirection/J2000->AZEL",
+            makeConvert<MDirection> (MDirection::J2000, MDirection::AZEL,
+                                     dirValue), True);
+  addBench (bench, "MDirection/J2000->HADEC",
+            makeConvert<MDirection> (MDirection::J2000, MDirection::HADEC,
+                                     dirValue), True);
+  addBench (bench, "MDirection/B1950->J2000",
+            makeConvert<MDirection> (MDirection::B1950, MDirection::J2000,
+                                     dirValue), True);
+  addBench (bench, "MDirection/J2000->GALACTIC",
+            makeConvert<MDirection> (MDirection::J2000, MDirection::GALACTIC,
+                                     dirValue), False);
+  // Frequencies and velocities.
+  std::function<MVFrequency(uInt)> freqValue = [](uInt i) {
+    return MVFrequency(1.4e9 + 1e4*i);
+  };
+  addBench (bench, "MFrequency/TOPO->LSRK",
+            makeConvert<MFrequency> (MFrequency::TOPO, MFrequency::LSRK,
+                                     freqValue), True);
+  addBench (bench, "MFrequency/LSRK->BARY",
+            makeConvert<MFrequency> (MFrequency::LSRK, MFrequency::BARY,
+                                     freqValue), False);
+  std::function<MVRadialVelocity(uInt)> velValue = [](uInt i) {
+    return MVRadialVelocity(1e4 + i);
+  };
+  addBench (bench, "MRadialVelocity/TOPO->LSRK",
+            makeConvert<MRadialVelocity> (MRadialVelocity::TOPO,
+                                          MRadialVelocity::LSRK,
+                                          velValue), True);
+  std::function<MVDoppler(uInt)> dopValue = [](uInt i) {
+    return MVDoppler(1e-4 * (i+1));
+  };
+  addBench (bench, "MDoppler/RADIO->Z",
+            makeConvert<MDoppler> (MDoppler::RADIO, MDoppler::Z,
+                                   dopValue), False);
+  // Baselines, UVW and earth magnetic field.
+  std::function<MVBaseline(uInt)> blValue = [](uInt i) {
+    return MVBaseline(144.*(i%nantenna+1), 10., 5.);
+  };
+  addBench (bench, "MBaseline/ITRF->J2000",
+            makeConvert<MBaseline> (MBaseline::ITRF, MBaseline::J2000,
+                                    blValue), True);
+  std::function<MVuvw(uInt)> uvwValue = [](uInt i) {
+    return MVuvw(144.*(i%nantenna+1), 10., 5.);
+  };
+  addBench (bench, "Muvw/ITRF->J2000",
+            makeConvert<Muvw> (Muvw::ITRF, Muvw::J2000, uvwValue), True);
+  std::function<MVEarthMagnetic(uInt)> emValue = [](uInt i) {
+    return MVEarthMagnetic(2e-5 + 1e-9*i, 1e-6, 4e-5);
+  };
+  addBench (bench, "MEarthMagnetic/ITRF->J2000",
+            makeConvert<MEarthMagnetic> (MEarthMagnetic::ITRF,
+                                         MEarthMagnetic::J2000,
+                                         emValue), True);
+}
+
+
+void addMachines (Benchmark& bench)
+{
+  // UVWMachine converting the UVW of all baselines to another phase center
+  // for each time (a new machine per time, because the frame changes).
+  addBench (bench, "UVWMachine/J2000->APP", []() -> Work {
+      uInt nbl = nantenna*(nantenna-1)/2;
+      auto uvw = std::make_shared<Vector<MVPosition>>(nbl);
+      for (uInt i=0; i<nbl; ++i) {
+        (*uvw)[i] = MVPosition(100.+i, 50.-i, 10.);
+      }
+      return [uvw, nbl]() {
+        MeasFrame frame(MEpoch(Quantity(startMJD, "d")), obsPosition());
+        Vector<Double> phase(nbl);
+        // Each time handles nbl values.
+        for (uInt i=0; i<nvalue; i+=nbl) {
+          frame.resetEpoch (epoch(i));
+          UVWMachine machine(MDirection::Ref(MDirection::APP), srcDirection(),
+                             frame);
+          Vector<MVPosition> newUVW(uvw->copy());
+          machine.convertUVW (phase, newUVW);
+        }
+      };
+    }, True);
+  // BatchUVWMachine calculating the UVW of all baselines for nvalue/nbl
+  // times (so nvalue values in total).
+  addBench (bench, "BatchUVWMachine", []() -> Work {
+      Vector<MPosition> antPos(nantenna);
+      Vector<Int> ant1, ant2;
+      std::vector<Int> a1, a2;
+      for (uInt i=0; i<nantenna; ++i) {
+        antPos[i] = MPosition(MVPosition(3828488.8 + 144.*i, 443253.5,
+                                         5064977.2), MPosition::ITRF);
+        for (uInt j=i+1; j<nantenna; ++j) {
+          a1.push_back (i);
+          a2.push_back (j);
+        }
+      }
+      ant1 = Vector<Int>(a1);
+      ant2 = Vector<Int>(a2);
+      auto machine = std::make_shared<BatchUVWMachine>(antPos, srcDirection());
+      Vector<Double> times(std::max(1u, nvalue / uInt(a1.size())));
+      for (uInt i=0; i<times.size(); ++i) {
+        times[i] = epoch(i) * 86400.;
+      }
+      return [machine, times, ant1, ant2]() {
+        Cube<Double> uvw;
+        machine->baselineUVW (times, ant1, ant2, uvw);
+      };
+    }, True);
+  // ParAngleMachine calculating nvalue parallactic angles.
+  addBench (bench, "ParAngleMachine", []() -> Work {
+      auto machine = std::make_shared<ParAngleMachine>(srcDirection());
+      machine->set (MeasFrame(MEpoch(Quantity(startMJD, "d")),
+                              obsPosition()));
+      Vector<Double> times(nvalue);
+      for (uInt i=0; i<nvalue; ++i) {
+        times[i] = epoch(i);
+      }
+      return [machine, times]() {
+        (*machine)(times);
+      };
+    }, True);
+  // VelocityMachine converting nvalue frequencies to velocities,
+  // where the epoch changes every 100 values.
+  addBench (bench, "VelocityMachine", []() -> Work {
+      auto frame = std::make_shared<MeasFrame>
+        (MEpoch(Quantity(startMJD, "d")), obsPosition(), srcDirection());
+      auto machine = std::make_shared<VelocityMachine>
+        (MFrequency::Ref(MFrequency::TOPO), Unit("Hz"),
+         MVFrequency(Quantity(1420.405752, "MHz")), MFrequency::LSRK,
+         MDoppler::Ref(MDoppler::RADIO), Unit("km/s"), *frame);
+      const uInt nchan = 100;
+      Vector<Double> freqs(nchan);
+      indgen (freqs, 1.42e9, 1e4);
+      return [frame, machine, freqs, nchan]() {
+        for (uInt i=0; i<nvalue; i+=nchan) {
+          frame->resetEpoch (epoch(i));
+          machine->reCalculate();
+          machine->makeVelocity (freqs);
+        }
+      };
+    }, True);
+}
+
+int main (int argc, const char* argv[])
+{
+  try {
+    Benchmark bench(argc, argv);
+    nthread = std::max(1, HostInfo::numCPUs());
+    const std::vector<String>& args = bench.arguments();
+    if (args.size() > 0) {
+      nvalue = std::max(1, atoi(args[0].chars()));
+    }
+    if (args.size() > 1) {
+      nthread = std::max(1, atoi(args[1].chars()));
+    }
+    cout << "bMeasPerf: nvalue=" << nvalue << " nthread=" << nthread << endl;
+    addConversions (bench);
+    addMachines (bench);
+    return bench.run();
+  } catch (const std::exception& x) {
+    cerr << "Exception: " << x.what() << endl;
+    return 1;
+  }
+}
@@ -0,0 +1,121 @@
+//# tBatchUVWMachine.cc: Test program for class BatchUVWMachine
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/measures/Measures/BatchUVWMachine.h>
+#include <casacore/measures/Measures/MBaseline.h>
+#include <casacore/measures/Measures/MCBaseline.h>
+#include <casacore/measures/Measures/MCDirection.h>
+#include <casacore/measures/Measures/MeasConvert.h>
+#include <casacore/measures/Measures/MeasFrame.h>
+#include <casacore/casa/Quanta/MVuvw.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Calculate the antenna UVW for a time in the usual way by converting
+// the baselines (relative to the first antenna) to J2000.
+Matrix<Double> refUVW (const Vector<MPosition>& pos, const MDirection& dir,
+                       Double time)
+{
+  MeasFrame frame(pos[0], MEpoch(Quantity(time, "s"), MEpoch::UTC), dir);
+  MDirection dirJ2000 = MDirection::Convert
+    (dir, MDirection::Ref(MDirection::J2000, frame))();
+  MBaseline::Convert conv(MBaseline(MVBaseline(),
+                                    MBaseline::Ref(MBaseline::ITRF, frame)),
+                          MBaseline::Ref(MBaseline::J2000));
+  Matrix<Double> uvw(3, pos.size());
+  for (uInt i=0; i<pos.size(); ++i) {
+    MVBaseline bl(pos[i].getValue() - pos[0].getValue());
+    MVuvw mvuvw(conv(bl).getValue(), dirJ2000.getValue());
+    uvw.column(i) = mvuvw.getValue();
+  }
+  return uvw;
+}
+
+void testUVW (const MDirection& dir)
+{
+  // Some antennae around the WSRT.
+  Vector<MPosition> pos(4);
+  MVPosition ref(3828763., 442449., 5064923.);
+  pos[0] = MPosition(ref, MPosition::ITRF);
+  pos[1] = MPosition(ref + MVPosition(144., 0., 0.), MPosition::ITRF);
+  pos[2] = MPosition(ref + MVPosition(-20., 1500., 30.), MPosition::ITRF);
+  pos[3] = MPosition(ref + MVPosition(2000., -300., -700.), MPosition::ITRF);
+  Vector<Double> times(40);
+  indgen (times, 4.8e9, 600.);
+  BatchUVWMachine machine(pos, dir);
+  AlwaysAssertExit (machine.nantenna() == 4);
+  Cube<Double> antUVW;
+  machine.antennaUVW (times, antUVW);
+  AlwaysAssertExit (antUVW.shape() == IPosition(3, 3, 4, 40));
+  for (uInt i=0; i<times.size(); ++i) {
+    AlwaysAssertExit (allNearAbs (antUVW.xyPlane(i),
+                                  refUVW(pos, dir, times[i]), 1e-6));
+  }
+  // Check the baselines.
+  Vector<Int> ant1(3), ant2(3);
+  ant1[0] = 0; ant2[0] = 1;
+  ant1[1] = 1; ant2[1] = 3;
+  ant1[2] = 2; ant2[2] = 2;
+  Cube<Double> blUVW;
+  machine.baselineUVW (times, ant1, ant2, blUVW);
+  AlwaysAssertExit (blUVW.shape() == IPosition(3, 3, 3, 40));
+  for (uInt i=0; i<times.size(); ++i) {
+    for (uInt j=0; j<ant1.size(); ++j) {
+      for (uInt k=0; k<3; ++k) {
+        AlwaysAssertExit (nearAbs (blUVW(k,j,i), antUVW(k,ant2[j],i) -
+                                   antUVW(k,ant1[j],i), 1e-9));
+      }
+    }
+  }
+  // An invalid antenna number.
+  ant2[2] = 4;
+  Bool excp = False;
+  try {
+    machine.baselineUVW (times, ant1, ant2, blUVW);
+  } catch (const AipsError&) {
+    excp = True;
+  }
+  AlwaysAssertExit (excp);
+}
+
+int main()
+{
+  try {
+    testUVW (MDirection(Quantity(1.2, "rad"), Quantity(0.8, "rad"),
+                        MDirection::J2000));
+    testUVW (MDirection(Quantity(30, "deg"), Quantity(-20, "deg"),
+                        MDirection::GALACTIC));
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
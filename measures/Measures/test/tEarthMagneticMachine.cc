@@ -34,6 +34,9 @@
 #include <casacore/measures/Measures/MPosition.h>
 #include <casacore/measures/Measures/MEpoch.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/iostream.h>
 
@@ -230,6 +233,31 @@ int main() {
       qhgt = Quantum<Double>(210, "km");
       cout << "LOS 210:       " << fm1(qhgt, "G") << endl;
     }
+    {
+      // The batch version should match a machine per epoch and position.
+      MVDirection mvd(Quantity(20, "deg"), Quantity(50, "deg"));
+      Vector<MEpoch> eps(3);
+      for (uInt i=0; i<eps.size(); ++i) {
+        eps[i] = MEpoch(MVEpoch(dat.day() + 0.1*i));
+      }
+      Vector<MPosition> poss(2, obs);
+      poss[1] = MPosition(MVPosition(Quantity(10, "m"),
+                                     Quantity(-107.6, "deg"),
+                                     Quantity(34.08, "deg")),
+                          MPosition::WGS84);
+      EarthMagneticMachine fm(MDirection::Ref(MDirection::J2000),
+                              Quantity(300, "km"), obs, eps[0]);
+      Matrix<Double> los(fm.getLOSFields(mvd, eps, poss));
+      AlwaysAssertExit (los.shape() == IPosition(2, 2, 3));
+      for (uInt i=0; i<eps.size(); ++i) {
+        for (uInt j=0; j<poss.size(); ++j) {
+          MeasFrame fr(eps[i], poss[j]);
+          EarthMagneticMachine fmp(MDirection::Ref(MDirection::J2000, fr),
+                                   Quantity(300, "km"), fr);
+          AlwaysAssertExit (near(los(j,i), fmp(mvd), 1e-10));
+        }
+      }
+    }
     
   } catch (std::exception& x) {
     cout << x.what() << endl;
@@ -25,7 +25,17 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/measures/Measures/MDirection.h>
+#include <casacore/measures/Measures/MCDirection.h>
+#include <casacore/measures/Measures/MeasConvert.h>
+#include <casacore/measures/Measures/MEpoch.h>
+#include <casacore/measures/Measures/MPosition.h>
+#include <casacore/measures/Measures/MeasFrame.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/namespace.h>
+#include <thread>
+#include <vector>
 
 Bool testShiftAngle() {
 	Double rav = 30;
@@ -96,11 +106,106 @@ Bool testShiftAngle() {
 	return True;
 }
 
+// Convert directions in one go and compare with converting them one by one.
+Bool testBatchConvert(MDirection::Convert& conv) {
+	const uInt n = 25;
+	Vector<Double> in(3*n);
+	for (uInt i=0; i<n; i++) {
+		MVDirection dir(Quantity(i*0.25, "rad"), Quantity(i*0.06 - 0.7, "rad"));
+		for (uInt j=0; j<3; j++) {
+			in[3*i + j] = dir.getValue()[j];
+		}
+	}
+	Vector<Double> out(3*n);
+	conv.convert(in.data(), out.data(), n);
+	for (uInt i=0; i<n; i++) {
+		MVDirection dir(in(Slice(3*i, 3)));
+		Vector<Double> exp = conv(dir).getValue().getValue();
+		AlwaysAssert(allNear(out(Slice(3*i, 3)), exp, 1e-13), AipsError);
+	}
+	// In-place conversion.
+	conv.convert(in.data(), in.data(), n);
+	AlwaysAssert(allEQ(in, out), AipsError);
+	return True;
+}
+
+Bool testBatchConvert() {
+	MeasFrame frame(MEpoch(Quantity(58999.5, "d")),
+			MPosition(MVPosition(Quantity(10, "m"),
+					     Quantity(6.8, "deg"),
+					     Quantity(52.7, "deg")),
+				  MPosition::WGS84));
+	// A linear conversion (rotation).
+	MDirection::Convert gal(MDirection::J2000, MDirection::GALACTIC);
+	testBatchConvert(gal);
+	MDirection::Convert azel(MDirection::Ref(MDirection::HADEC, frame),
+				 MDirection::Ref(MDirection::AZEL, frame));
+	testBatchConvert(azel);
+	// A non-linear conversion (includes aberration).
+	MDirection::Convert app(MDirection::Ref(MDirection::J2000, frame),
+				MDirection::Ref(MDirection::AZEL, frame));
+	testBatchConvert(app);
+	return True;
+}
+
+// Convert directions to AZEL in parallel threads, each using a copy of
+// the frame, and compare with the results of serial conversions.
+Bool testThreads() {
+	const uInt nthr = 4;
+	const uInt n = 50;
+	MeasFrame frame(MEpoch(Quantity(58999.5, "d")),
+			MPosition(MVPosition(Quantity(10, "m"),
+					     Quantity(6.8, "deg"),
+					     Quantity(52.7, "deg")),
+				  MPosition::WGS84));
+	// The copy must be independent of the original.
+	MeasFrame copied(frame.copy());
+	AlwaysAssert(copied != frame, AipsError);
+	copied.resetEpoch(59000.5);
+	Double ut1, ut1c;
+	MDirection::Convert conv(MDirection::J2000,
+				 MDirection::Ref(MDirection::AZEL, frame));
+	Matrix<Double> exp(2*n, nthr);
+	for (uInt t=0; t<nthr; t++) {
+		for (uInt i=0; i<n; i++) {
+			frame.resetEpoch(58999.5 + t + i/86400.);
+			Vector<Double> azel = conv(MVDirection(i*0.1, 0.5)).
+				getValue().get();
+			exp(2*i, t) = azel[0];
+			exp(2*i+1, t) = azel[1];
+		}
+	}
+	AlwaysAssert(frame.getUT1(ut1) && copied.getUT1(ut1c), AipsError);
+	AlwaysAssert(ut1 != ut1c, AipsError);
+	Matrix<Double> res(2*n, nthr);
+	std::vector<std::thread> threads;
+	for (uInt t=0; t<nthr; t++) {
+		threads.push_back(std::thread([&frame, &res, t, n]() {
+			MeasFrame myFrame(frame.copy());
+			MDirection::Convert myConv(MDirection::J2000,
+				MDirection::Ref(MDirection::AZEL, myFrame));
+			for (uInt i=0; i<n; i++) {
+				myFrame.resetEpoch(58999.5 + t + i/86400.);
+				Vector<Double> azel = myConv(MVDirection(i*0.1, 0.5)).
+					getValue().get();
+				res(2*i, t) = azel[0];
+				res(2*i+1, t) = azel[1];
+			}
+		}));
+	}
+	for (uInt t=0; t<nthr; t++) {
+		threads[t].join();
+	}
+	AlwaysAssert(allNear(res, exp, 1e-12), AipsError);
+	return True;
+}
 
 int main() {
 	try {
 		Bool success = True;
 		success = success && testShiftAngle();
+		success = success && testBatchConvert();
+		success = success && testThreads();
 
 		if (success) {
 			cout << "tMDirection succeeded" << endl;
@@ -36,6 +36,13 @@
 #include <casacore/measures/Measures/MDirection.h>
 #include <casacore/measures/Measures/MCDirection.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/casa/OS/Path.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Quanta/MVTime.h>
 #include <casacore/casa/Quanta/MVRadialVelocity.h>
@@ -47,11 +54,118 @@
 
 #include <casacore/casa/namespace.h>
 
+// Analytic position and radial velocity of a fake comet.
+Double cometRA (Double t)
+  { return 10 + 20*sin(0.3*t); }
+Double cometDEC (Double t)
+  { return 5 + 3*cos(0.2*t); }
+Double cometRho (Double t)
+  { return 1 + 0.1*t; }
+Double cometRadVel (Double t)
+  { return cos(0.5*t); }
+
+// Test the spline interpolation using a comet table made from the
+// analytic functions above.
+void testSplines()
+{
+  const Double mjdStart = 50800;
+  const Double dmjd = 0.5;
+  const uInt nrow = 41;
+  {
+    TableDesc td;
+    td.addColumn (ScalarColumnDesc<Double>("MJD"));
+    td.addColumn (ScalarColumnDesc<Double>("RA"));
+    td.addColumn (ScalarColumnDesc<Double>("DEC"));
+    td.addColumn (ScalarColumnDesc<Double>("Rho"));
+    td.addColumn (ScalarColumnDesc<Double>("RadVel"));
+    SetupNewTable newtab("tMeasComet_tmp.tab", td, Table::New);
+    Table tab(newtab, nrow);
+    tab.tableInfo().setType ("IERS");
+    TableRecord& kws = tab.rwKeywordSet();
+    kws.define ("VS_DATE", "2026/10/15/00:00");
+    kws.define ("VS_VERSION", "0001.0001");
+    kws.define ("VS_CREATE", "2026/10/15/00:00");
+    kws.define ("VS_TYPE", "Test comet");
+    kws.define ("MJD0", mjdStart - dmjd);
+    kws.define ("dMJD", dmjd);
+    kws.define ("NAME", "FAKE");
+    kws.define ("GeoDist", 0.);
+    kws.define ("GeoLong", 0.);
+    kws.define ("GeoLat", 0.);
+    ScalarColumn<Double> mjd(tab, "MJD");
+    ScalarColumn<Double> ra(tab, "RA");
+    ScalarColumn<Double> dec(tab, "DEC");
+    ScalarColumn<Double> rho(tab, "Rho");
+    ScalarColumn<Double> radvel(tab, "RadVel");
+    for (uInt i=0; i<nrow; ++i) {
+      Double t = i*dmjd;
+      mjd.put (i, mjdStart + t);
+      ra.put (i, cometRA(t));
+      dec.put (i, cometDEC(t));
+      rho.put (i, cometRho(t));
+      radvel.put (i, cometRadVel(t));
+    }
+  }
+  MeasComet linear(Path("tMeasComet_tmp.tab").absoluteName());
+  MeasComet comet(linear);
+  AlwaysAssertExit (!comet.usesSplines());
+  AlwaysAssertExit (comet.loadSplines());
+  AlwaysAssertExit (comet.usesSplines());
+  // Compare the interpolation errors in the middle part of the table.
+  Double maxLinErr = 0;
+  Double maxSplErr = 0;
+  Vector<Double> dates;
+  for (Double t=2.1; t<17.9; t+=0.1) {
+    MVPosition exact(Quantity(cometRho(t), "AU"),
+                     Quantity(cometRA(t), "deg"),
+                     Quantity(cometDEC(t), "deg"));
+    MVPosition linPos, splPos;
+    AlwaysAssertExit (linear.get (linPos, mjdStart + t));
+    AlwaysAssertExit (comet.get (splPos, mjdStart + t));
+    maxLinErr = max(maxLinErr, (linPos - exact).radius());
+    maxSplErr = max(maxSplErr, (splPos - exact).radius());
+    MVRadialVelocity rv;
+    AlwaysAssertExit (comet.getRadVel (rv, mjdStart + t));
+    AlwaysAssertExit (nearAbs (rv.get("AU/d").getValue(), cometRadVel(t),
+                               1e-3));
+    dates.resize (dates.size() + 1, True);
+    dates[dates.size() - 1] = mjdStart + t;
+  }
+  AlwaysAssertExit (maxSplErr < 0.1*maxLinErr);
+  // The spline goes through the table values.
+  for (uInt i=0; i<nrow-1; ++i) {
+    MVPosition linPos, splPos;
+    AlwaysAssertExit (linear.get (linPos, mjdStart + i*dmjd));
+    AlwaysAssertExit (comet.get (splPos, mjdStart + i*dmjd));
+    AlwaysAssertExit ((splPos - linPos).radius() < 1e-6*linPos.radius());
+  }
+  // Get all dates in one go, also from a clone.
+  MeasComet* clone = comet.clone();
+  AlwaysAssertExit (clone->usesSplines());
+  Vector<MVPosition> positions;
+  AlwaysAssertExit (clone->get (positions, dates));
+  AlwaysAssertExit (positions.size() == dates.size());
+  for (uInt i=0; i<dates.size(); ++i) {
+    MVPosition pos;
+    comet.get (pos, dates[i]);
+    AlwaysAssertExit (allEQ (pos.getValue(), positions[i].getValue()));
+  }
+  delete clone;
+  // Dates outside the table.
+  MVPosition pos;
+  AlwaysAssertExit (!comet.get (pos, mjdStart - 1));
+  AlwaysAssertExit (!comet.get (pos, mjdStart + nrow*dmjd));
+  dates[0] = mjdStart - 1;
+  AlwaysAssertExit (!comet.get (positions, dates));
+  AlwaysAssertExit (positions[0].radius() == 0);
+}
+
 int main()
 {
   try {
     cout << "Test MeasComet..." << endl;
     cout << "--------------------------------------" << endl;
+    testSplines();
     
     {
       MeasComet comet("VGEO");
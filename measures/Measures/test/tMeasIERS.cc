@@ -54,6 +54,13 @@ int main()
     cout << setprecision(9);
     Vector<Double> val(6);
 
+    // The IERS tables are only loaded when needed.
+    AlwaysAssertExit (!MeasIERS::loadTimes().isDefined("IERSpredict"));
+    double dummy;
+    MeasIERS::get(dummy, MeasIERS::PREDICTED, MeasIERS::X, 55000);
+    AlwaysAssertExit (MeasIERS::loadTimes().isDefined("IERSpredict"));
+    AlwaysAssertExit (!MeasIERS::loadTimes().isDefined("IERSeop97"));
+
     double date= 51116;
     for (int i=0; i<3; ++i) {
       getX (date);
@@ -64,6 +71,7 @@ int main()
     getX (55000);
     getX (55809);
     getX (600000);
+    AlwaysAssertExit (MeasIERS::loadTimes().asDouble("IERSeop97") >= 0);
 
 
     // Test for handling of leap seconds (CAS-7984)
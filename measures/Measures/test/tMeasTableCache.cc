@@ -0,0 +1,117 @@
+//# tMeasTableCache.cc: Test program for class MeasTableCache
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/measures/Measures/MeasTableCache.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Create a table with some Double and other columns.
+void createTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Double>("MJD"));
+  td.addColumn (ScalarColumnDesc<Int>("INT"));
+  td.addColumn (ArrayColumnDesc<Double>("x", IPosition(1,5),
+                                        ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Double>("var"));
+  SetupNewTable newtab ("tMeasTableCache_tmp.tab", td, Table::New);
+  Table tab(newtab, nrow);
+  ScalarColumn<Double> mjd(tab, "MJD");
+  ArrayColumn<Double> x(tab, "x");
+  ArrayColumn<Double> var(tab, "var");
+  for (uInt i=0; i<nrow; ++i) {
+    mjd.put (i, 50000 + i);
+    Vector<Double> vec(5);
+    indgen (vec, Double(10*i));
+    x.put (i, vec);
+    var.put (i, Vector<Double>(i+1, 1.));
+  }
+}
+
+void testCache()
+{
+  createTable (10);
+  Table tab("tMeasTableCache_tmp.tab");
+  // No cache yet.
+  AlwaysAssertExit (MeasTableCache(tab).empty());
+  AlwaysAssertExit (MeasTableCache::create (tab));
+  AlwaysAssertExit (File(MeasTableCache::fileName(tab)).exists());
+  MeasTableCache cache(tab);
+  AlwaysAssertExit (!cache.empty());
+  AlwaysAssertExit (cache.nrow() == 10);
+  uInt64 nvalues;
+  const Double* mjd = cache.data ("MJD", nvalues);
+  AlwaysAssertExit (mjd  &&  nvalues == 1);
+  const Double* x = cache.data ("x", nvalues);
+  AlwaysAssertExit (x  &&  nvalues == 5);
+  for (uInt i=0; i<10; ++i) {
+    AlwaysAssertExit (mjd[i] == 50000 + i);
+    for (uInt j=0; j<5; ++j) {
+      AlwaysAssertExit (x[i*5 + j] == 10*i + j);
+    }
+  }
+  // Non-Double and variable shaped columns are not cached.
+  AlwaysAssertExit (cache.data ("INT", nvalues) == 0);
+  AlwaysAssertExit (cache.data ("var", nvalues) == 0);
+  AlwaysAssertExit (cache.data ("NONE", nvalues) == 0);
+}
+
+void testChanged()
+{
+  // A changed table makes the cache invalid.
+  {
+    Table tab("tMeasTableCache_tmp.tab", Table::Update);
+    tab.addRow();
+  }
+  Table tab("tMeasTableCache_tmp.tab");
+  AlwaysAssertExit (MeasTableCache(tab).empty());
+  AlwaysAssertExit (MeasTableCache::create (tab));
+  AlwaysAssertExit (MeasTableCache(tab).nrow() == 11);
+}
+
+int main()
+{
+  try {
+    testCache();
+    testChanged();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -38,6 +38,9 @@
 #include <casacore/casa/Quanta/Quantum.h>
 #include <casacore/casa/Quanta/MVEpoch.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/OS/Timer.h>
 #include <casacore/casa/iostream.h>
@@ -145,6 +148,22 @@ int main() {
     cout << pam(vmedat).get("deg") << endl;
     cout << Quantum<Vector<Double> >(pam(vddat), "rad").get("deg") << endl;
 
+    {
+      // The batch version should give the same results as the scalar one.
+      MPosition pos2(MVPosition(Quantity(2000, "m"), Quantity(-107.6, "deg"),
+                                Quantity(34.08, "deg")), MPosition::WGS84);
+      Vector<MPosition> vpos(2, obs);
+      vpos[1] = pos2;
+      Matrix<Double> pa(pam(vddat, vpos));
+      AlwaysAssertExit (pa.shape() == IPosition(2, 2, 5));
+      ParAngleMachine pam2(dir);
+      pam2.set(MeasFrame(medat, pos2));
+      for (uInt i=0; i<5; ++i) {
+        AlwaysAssertExit (nearAbs(pa(0,i), pam(vddat[i]), 1e-6));
+        AlwaysAssertExit (nearAbs(pa(1,i), pam2(vddat[i]), 1e-6));
+      }
+    }
+
     cout << "--------------- Timing ----------------------" << endl;
     cout << ">>>" << endl;
     const uInt N=1000;
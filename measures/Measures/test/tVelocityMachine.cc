@@ -35,6 +35,8 @@
 #include <casacore/measures/Measures/MFrequency.h>
 #include <casacore/measures/Measures/MDoppler.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/iostream.h>
 
@@ -120,6 +122,23 @@ int main() {
     cout << "List to RADIO: " << vm.makeVelocity(fx) << endl;
     vm.set(frame);
     cout << "List to RADIO: " << vm.makeVelocity(fx) << endl;
+    {
+      // The vector conversions should match the scalar ones.
+      VelocityMachine vmv(MFrequency::Ref(MFrequency::TOPO, frame),
+                          Unit("MHz"), restfrq, MFrequency::LSRK,
+                          MDoppler::Ref(MDoppler::OPTICAL), Unit("km/s"));
+      Vector<Double> freqs(100);
+      indgen (freqs, 1400., 0.2);
+      Vector<Double> vels(vmv.makeVelocity(freqs).getValue().copy());
+      Vector<Double> frqs(vmv.makeFrequency(vels).getValue().copy());
+      for (uInt i=0; i<freqs.size(); ++i) {
+        AlwaysAssertExit (near(vels[i], vmv.makeVelocity(freqs[i]).getValue(),
+                               1e-10));
+        AlwaysAssertExit (near(frqs[i], vmv.makeFrequency(vels[i]).getValue(),
+                               1e-12));
+        AlwaysAssertExit (near(frqs[i], freqs[i], 1e-12));
+      }
+    }
     {
     	// test restfreq <= 0 throws exception
     	MVFrequency restfrq2(0);
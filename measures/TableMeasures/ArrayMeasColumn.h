@@ -31,6 +31,7 @@
 #include <casacore/measures/TableMeasures/TableMeasColumn.h>
 #include <casacore/measures/Measures/MeasRef.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -210,6 +211,18 @@ public:
   Array<M> convert (rownr_t rownr, uInt refCode) const;
   // </group>
 
+  // Get the Measure arrays in all rows and convert them to the given
+  // reference. All rows must have the same shape; the last axis of the
+  // result is the row axis.
+  // The values and reference codes are read in bulk and the values with
+  // the same reference are converted together (see
+  // <linkto class=MeasConvert>MeasConvert</linkto>), which is much faster
+  // than converting row by row.
+  // <group>
+  Array<M> convertColumn (const MeasRef<M>& measRef) const;
+  Array<M> convertColumn (uInt refCode) const;
+  // </group>
+
   // Get the column's reference.
   const MeasRef<M>& getMeasRef() const
     { return itsMeasRef; }
@@ -265,8 +278,17 @@ private:
   // to reallocate data.
   void cleanUp();
 
-  // Get the data and convert using conversion engine.
-  Array<M> doConvert (rownr_t rownr, typename M::Convert& conv) const;
+  // Get the data and convert them to the given reference.
+  Array<M> doConvert (rownr_t rownr, const MeasRef<M>& measRef) const;
+
+  // Get the shape of the Measure array for the given data shape.
+  IPosition measShape (const IPosition& dataShape) const;
+
+  // Get the reference types of the Measures in the given row or, if
+  // <src>allRows=True</src>, in all rows.
+  // The vector is left empty if the reference is fixed.
+  void getRefTypes (std::vector<uInt>& refTypes, rownr_t rownr,
+                    Bool allRows, size_t nperRow) const;
 };
 
 
@@ -42,6 +42,7 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <map>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -203,18 +204,7 @@ void ArrayMeasColumn<M>::get (rownr_t rownr, Array<M>& meas,
   const Double* d_p = d_ptr;
 
   // Determine the dimensionality of the resulting Array<Measure>.
-  IPosition shpt (tmpData.shape());
-  IPosition shp;
-  if (itsNvals > 1  &&  shpt.nelements() > 0) {
-    if (shpt.nelements() == 1) {
-      shp = shpt;
-      shp(0) = 1;
-    } else {
-      shp = shpt.getLast (shpt.nelements() - 1);
-    }
-  } else {
-    shp = shpt;
-  }
+  IPosition shp = measShape (tmpData.shape());
   if (! shp.isEqual (meas.shape())) {
     if (resize  ||  meas.nelements() == 0) {
       meas.resize (shp);
@@ -342,24 +332,46 @@ template<class M>
 Array<M> ArrayMeasColumn<M>::convert (rownr_t rownr,
                                       const MeasRef<M>& measRef) const
 {
-  typename M::Convert conv;
-  conv.setOut (measRef);
-  return doConvert (rownr, conv);
+  return doConvert (rownr, measRef);
 }
 
 
 template<class M>
 Array<M> ArrayMeasColumn<M>::convert (rownr_t rownr, uInt refCode) const
 {
-  typename M::Convert conv;
-  conv.setOut (typename M::Types(refCode));
-  return doConvert (rownr, conv);
+  return doConvert (rownr, MeasRef<M>(typename M::Types(refCode)));
 }
 
 template<class M>
 Array<M> ArrayMeasColumn<M>::doConvert (rownr_t rownr,
-                                        typename M::Convert& conv) const
+                                        const MeasRef<M>& measRef) const
 {
+  // Without offsets per element, the Measures with the same reference
+  // are converted together.
+  if (itsArrOffsetCol == 0) {
+    Array<Double> tmpData((*itsDataCol)(rownr));
+    Array<M> tmp(measShape (tmpData.shape()));
+    std::vector<uInt> refTypes;
+    getRefTypes (refTypes, rownr, False, tmp.nelements());
+    MeasRef<M> fromRef (typename M::Types(itsMeasRef.getType()));
+    if (itsOffsetCol != 0) {
+      fromRef.set ((*itsOffsetCol)(rownr));
+    } else if (itsMeasRef.offset()) {
+      fromRef.set (*itsMeasRef.offset());
+    }
+    Bool deleteData, deleteIt;
+    const Double* d_p = tmpData.getStorage (deleteData);
+    M* data = tmp.getStorage (deleteIt);
+    ScalarMeasColumn<M>::convertValues
+      (data, d_p, itsNvals, measDesc().getUnits(),
+       (refTypes.empty()  ?  0 : refTypes.data()), tmp.nelements(),
+       fromRef, measRef);
+    tmp.putStorage (data, deleteIt);
+    tmpData.freeStorage (d_p, deleteData);
+    return tmp;
+  }
+  typename M::Convert conv;
+  conv.setOut (measRef);
   Array<M> tmp;
   get (rownr, tmp);
   uInt n = tmp.nelements();
@@ -372,6 +384,113 @@ Array<M> ArrayMeasColumn<M>::doConvert (rownr_t rownr,
   return tmp;
 }
 
+template<class M>
+Array<M> ArrayMeasColumn<M>::convertColumn (uInt refCode) const
+{
+  return convertColumn (MeasRef<M>(typename M::Types(refCode)));
+}
+
+template<class M>
+Array<M> ArrayMeasColumn<M>::convertColumn (const MeasRef<M>& measRef) const
+{
+  rownr_t nrow = table().nrow();
+  if (nrow == 0) {
+    return Array<M>();
+  }
+  // Get the data of all rows (which fails if their shapes differ).
+  Array<Double> data (itsDataCol->getColumn());
+  IPosition dataShape (data.shape());
+  IPosition shp = measShape (dataShape.getFirst (dataShape.size() - 1));
+  size_t nperRow = shp.product();
+  shp.append (IPosition(1, nrow));
+  Array<M> result(shp);
+  if (itsOffsetCol != 0  ||  itsArrOffsetCol != 0) {
+    // Variable offsets cannot be grouped, so convert row by row.
+    for (rownr_t i=0; i<nrow; ++i) {
+      result[i] = convert (i, measRef);
+    }
+    return result;
+  }
+  std::vector<uInt> refTypes;
+  getRefTypes (refTypes, 0, True, nperRow);
+  Bool deleteData, deleteRes;
+  const Double* d_p = data.getStorage (deleteData);
+  M* r_p = result.getStorage (deleteRes);
+  ScalarMeasColumn<M>::convertValues
+    (r_p, d_p, itsNvals, measDesc().getUnits(),
+     (refTypes.empty()  ?  0 : refTypes.data()), result.nelements(),
+     itsMeasRef, measRef);
+  result.putStorage (r_p, deleteRes);
+  data.freeStorage (d_p, deleteData);
+  return result;
+}
+
+template<class M>
+IPosition ArrayMeasColumn<M>::measShape (const IPosition& dataShape) const
+{
+  // The first axis contains the values of a Measure (if more than one).
+  if (itsNvals > 1  &&  dataShape.nelements() > 0) {
+    if (dataShape.nelements() == 1) {
+      return IPosition(1, 1);
+    }
+    return dataShape.getLast (dataShape.nelements() - 1);
+  }
+  return dataShape;
+}
+
+template<class M>
+void ArrayMeasColumn<M>::getRefTypes (std::vector<uInt>& refTypes,
+                                      rownr_t rownr, Bool allRows,
+                                      size_t nperRow) const
+{
+  if (itsArrRefStrCol != 0  ||  itsRefStrCol != 0) {
+    Array<String> refs;
+    if (itsArrRefStrCol != 0) {
+      refs.reference (allRows  ?  itsArrRefStrCol->getColumn() :
+                                  (*itsArrRefStrCol)(rownr));
+    } else {
+      refs.reference (allRows  ?  Array<String>(itsRefStrCol->getColumn()) :
+                                  Array<String>(IPosition(1,1),
+                                                (*itsRefStrCol)(rownr)));
+    }
+    // A reference per row applies to all values in the row.
+    size_t nper = (itsArrRefStrCol != 0  ?  1 : nperRow);
+    refTypes.resize (refs.nelements() * nper);
+    std::map<String,uInt> types;
+    size_t inx = 0;
+    for (const String& ref : refs) {
+      auto iter = types.find (ref);
+      if (iter == types.end()) {
+        typename M::Types tp;
+        M::getType (tp, ref);
+        iter = types.insert (std::make_pair (ref, uInt(tp))).first;
+      }
+      for (size_t i=0; i<nper; ++i) {
+        refTypes[inx++] = iter->second;
+      }
+    }
+  } else if (itsArrRefIntCol != 0  ||  itsRefIntCol != 0) {
+    Array<Int> refs;
+    if (itsArrRefIntCol != 0) {
+      refs.reference (allRows  ?  itsArrRefIntCol->getColumn() :
+                                  (*itsArrRefIntCol)(rownr));
+    } else {
+      refs.reference (allRows  ?  Array<Int>(itsRefIntCol->getColumn()) :
+                                  Array<Int>(IPosition(1,1),
+                                             (*itsRefIntCol)(rownr)));
+    }
+    size_t nper = (itsArrRefIntCol != 0  ?  1 : nperRow);
+    refTypes.resize (refs.nelements() * nper);
+    size_t inx = 0;
+    for (Int ref : refs) {
+      uInt tp = measDesc().getRefDesc().tab2cur (ref);
+      for (size_t i=0; i<nper; ++i) {
+        refTypes[inx++] = tp;
+      }
+    }
+  }
+}
+
 
 template<class M>
 void ArrayMeasColumn<M>::setDescRefCode (uInt refCode,
@@ -30,6 +30,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/measures/TableMeasures/TableMeasColumn.h>
 #include <casacore/measures/Measures/MeasRef.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -182,6 +183,29 @@ public:
   M convert (rownr_t rownr, uInt refCode) const;
   // </group>
 
+  // Get the Measures in all rows and convert them to the given reference.
+  // The values and reference codes are read in bulk and the values with
+  // the same reference are converted together (see
+  // <linkto class=MeasConvert>MeasConvert</linkto>), which is much faster
+  // than converting row by row.
+  // <group>
+  Vector<M> convertColumn (const MeasRef<M>& measRef) const;
+  Vector<M> convertColumn (uInt refCode) const;
+  // </group>
+
+  // Convert <src>n</src> Measure values to the given reference.
+  // The values are given as stored in a column, thus as <src>nvals</src>
+  // values per Measure in the given units. The reference type of each
+  // value is given in <src>refTypes</src>; if it is a null pointer, all
+  // values have the type of <src>fromRef</src>. The possible offset of
+  // <src>fromRef</src> is used for all values.
+  // <br>It is used by ScalarMeasColumn and ArrayMeasColumn.
+  static void convertValues (M* result, const Double* data, uInt nvals,
+                             const Vector<Unit>& units,
+                             const uInt* refTypes, size_t n,
+                             const MeasRef<M>& fromRef,
+                             const MeasRef<M>& toRef);
+
   // Returns the column's fixed reference or the reference of the last
   // read Measure if references are variable.
   const MeasRef<M>& getMeasRef() const
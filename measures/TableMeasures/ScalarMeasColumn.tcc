@@ -40,6 +40,8 @@
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <map>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -215,6 +217,144 @@ M ScalarMeasColumn<M>::convert (rownr_t rownr, uInt refCode) const
   return typename M::Convert(tmp, typename M::Types(refCode))();
 }
 
+template<class M>
+Vector<M> ScalarMeasColumn<M>::convertColumn (uInt refCode) const
+{
+  return convertColumn (MeasRef<M>(typename M::Types(refCode)));
+}
+
+template<class M>
+Vector<M> ScalarMeasColumn<M>::convertColumn (const MeasRef<M>& measRef) const
+{
+  rownr_t nrow = table().nrow();
+  Vector<M> result(nrow);
+  // Variable offsets cannot be grouped, so convert row by row.
+  if (itsOffsetCol != 0) {
+    for (rownr_t i=0; i<nrow; ++i) {
+      result[i] = convert (i, measRef);
+    }
+    return result;
+  }
+  if (nrow == 0) {
+    return result;
+  }
+  // Get the data of all rows.
+  Array<Double> data;
+  if (itsScaDataCol != 0) {
+    data.reference (itsScaDataCol->getColumn());
+  } else {
+    data.reference (itsArrDataCol->getColumn());
+  }
+  // Get the reference type of all rows if variable.
+  std::vector<uInt> refTypes;
+  if (itsVarRefFlag) {
+    refTypes.resize (nrow);
+    if (itsRefStrCol != 0) {
+      Vector<String> refs = itsRefStrCol->getColumn();
+      std::map<String,uInt> types;
+      for (rownr_t i=0; i<nrow; ++i) {
+        auto iter = types.find (refs[i]);
+        if (iter == types.end()) {
+          typename M::Types tp;
+          M::getType (tp, refs[i]);
+          iter = types.insert (std::make_pair (refs[i], uInt(tp))).first;
+        }
+        refTypes[i] = iter->second;
+      }
+    } else {
+      Vector<Int> refs = itsRefIntCol->getColumn();
+      for (rownr_t i=0; i<nrow; ++i) {
+        refTypes[i] = measDesc().getRefDesc().tab2cur (refs[i]);
+      }
+    }
+  }
+  Bool deleteData, deleteRes;
+  const Double* d_p = data.getStorage (deleteData);
+  M* r_p = result.getStorage (deleteRes);
+  convertValues (r_p, d_p, itsNvals, measDesc().getUnits(),
+                 (refTypes.empty()  ?  0 : refTypes.data()), nrow,
+                 itsMeasRef, measRef);
+  result.putStorage (r_p, deleteRes);
+  data.freeStorage (d_p, deleteData);
+  return result;
+}
+
+template<class M>
+void ScalarMeasColumn<M>::convertValues (M* result, const Double* data,
+                                         uInt nvals,
+                                         const Vector<Unit>& units,
+                                         const uInt* refTypes, size_t n,
+                                         const MeasRef<M>& fromRef,
+                                         const MeasRef<M>& toRef)
+{
+  if (n == 0) {
+    return;
+  }
+  // Get the internal representation of all values.
+  typename M::MVType measVal;
+  const uInt nv = measVal.getVector().nelements();
+  std::vector<Double> values(n*nv);
+  Vector<Quantum<Double> > qvec(nvals);
+  for (uInt j=0; j<nvals; j++) {
+    qvec(j).setUnit (units(j));
+  }
+  for (size_t i=0; i<n; i++) {
+    for (uInt j=0; j<nvals; j++) {
+      qvec(j).setValue (*data++);
+    }
+    measVal.putValue (qvec);
+    Vector<Double> vec(measVal.getVector());
+    for (uInt j=0; j<nv; j++) {
+      values[i*nv + j] = vec[j];
+    }
+  }
+  // Group the values by reference type.
+  std::map<uInt, std::vector<size_t> > groups;
+  if (refTypes == 0) {
+    groups[fromRef.getType()];
+  } else {
+    for (size_t i=0; i<n; i++) {
+      groups[refTypes[i]].push_back (i);
+    }
+  }
+  // Convert each group in one go.
+  // Note that a MeasRef copy is a reference, so a new one is made.
+  std::vector<Double> buf;
+  for (const auto& group : groups) {
+    MeasRef<M> ref (typename M::Types(group.first));
+    if (fromRef.offset()) {
+      ref.set (*fromRef.offset());
+    }
+    typename M::Convert conv (M(typename M::MVType(), ref), toRef);
+    if (refTypes == 0) {
+      conv.convert (values.data(), values.data(), n);
+    } else {
+      const std::vector<size_t>& rows = group.second;
+      buf.resize (rows.size() * nv);
+      for (size_t i=0; i<rows.size(); i++) {
+        for (uInt j=0; j<nv; j++) {
+          buf[i*nv + j] = values[rows[i]*nv + j];
+        }
+      }
+      conv.convert (buf.data(), buf.data(), rows.size());
+      for (size_t i=0; i<rows.size(); i++) {
+        for (uInt j=0; j<nv; j++) {
+          values[rows[i]*nv + j] = buf[i*nv + j];
+        }
+      }
+    }
+  }
+  // Make the resulting Measures.
+  Vector<Double> vec(nv);
+  for (size_t i=0; i<n; i++) {
+    for (uInt j=0; j<nv; j++) {
+      vec[j] = values[i*nv + j];
+    }
+    measVal.putVector (vec);
+    result[i] = M(measVal, toRef);
+  }
+}
+
 template<class M> 
 M ScalarMeasColumn<M>::operator() (rownr_t rownr) const
 {
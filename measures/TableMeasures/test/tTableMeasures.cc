@@ -1421,6 +1421,83 @@ void testRefCodeChg()
 }
 
 
+// Check that the bulk conversion of a column gives the same results as
+// converting row by row.
+void testConvertColumn()
+{
+  {
+    TableDesc td;
+    td.addColumn (ArrayColumnDesc<Double>("Dir", IPosition(1,2),
+                                          ColumnDesc::Direct));
+    td.addColumn (ScalarColumnDesc<Int>("DirRef"));
+    td.addColumn (ArrayColumnDesc<Double>("SDir", IPosition(1,2),
+                                          ColumnDesc::Direct));
+    td.addColumn (ScalarColumnDesc<String>("SDirRef"));
+    td.addColumn (ArrayColumnDesc<Double>("ADir", IPosition(2,2,3),
+                                          ColumnDesc::Direct));
+    td.addColumn (ArrayColumnDesc<Int>("ADirRef", IPosition(1,3),
+                                       ColumnDesc::Direct));
+    TableMeasDesc<MDirection> tmd1 (TableMeasValueDesc(td, "Dir"),
+                                    TableMeasRefDesc(td, "DirRef"));
+    tmd1.write (td);
+    TableMeasDesc<MDirection> tmd2 (TableMeasValueDesc(td, "SDir"),
+                                    TableMeasRefDesc(td, "SDirRef"));
+    tmd2.write (td);
+    TableMeasDesc<MDirection> tmd3 (TableMeasValueDesc(td, "ADir"),
+                                    TableMeasRefDesc(td, "ADirRef"));
+    tmd3.write (td);
+    SetupNewTable newtab("tTableMeasures_tmp.tab", td, Table::New);
+    Table tab(newtab, 20);
+    MDirection::ScalarColumn dirCol(tab, "Dir");
+    MDirection::ScalarColumn sdirCol(tab, "SDir");
+    MDirection::ArrayColumn adirCol(tab, "ADir");
+    const MDirection::Types types[] = {MDirection::J2000, MDirection::B1950,
+                                       MDirection::GALACTIC,
+                                       MDirection::ECLIPTIC};
+    Vector<MDirection> vec(3);
+    for (uInt i=0; i<tab.nrow(); ++i) {
+      MDirection dir (Quantity(0.1*i, "rad"), Quantity(0.05*i-0.5, "rad"),
+                      types[i%4]);
+      dirCol.put (i, dir);
+      sdirCol.put (i, MDirection (dir.getValue(), types[(i+1)%4]));
+      for (uInt j=0; j<3; ++j) {
+        vec[j] = MDirection (dir.getValue(), types[(i+j)%4]);
+      }
+      adirCol.put (i, vec);
+    }
+  }
+  Table tab("tTableMeasures_tmp.tab");
+  MDirection::ScalarColumn dirCol(tab, "Dir");
+  MDirection::ScalarColumn sdirCol(tab, "SDir");
+  MDirection::ArrayColumn adirCol(tab, "ADir");
+  Vector<MDirection> res1 = dirCol.convertColumn (MDirection::GALACTIC);
+  Vector<MDirection> res2 = sdirCol.convertColumn
+    (MDirection::Ref(MDirection::SUPERGAL));
+  Array<MDirection> res3 = adirCol.convertColumn (MDirection::J2000);
+  AlwaysAssertExit (res1.size() == tab.nrow());
+  AlwaysAssertExit (res3.shape() == IPosition(2, 3, tab.nrow()));
+  for (uInt i=0; i<tab.nrow(); ++i) {
+    MDirection d1 = dirCol.convert (i, MDirection::GALACTIC);
+    AlwaysAssertExit (res1[i].getRef().getType() == MDirection::GALACTIC);
+    AlwaysAssertExit (allNearAbs (res1[i].getValue().getValue(),
+                                  d1.getValue().getValue(), 1e-12));
+    MDirection d2 = sdirCol.convert (i, MDirection::SUPERGAL);
+    AlwaysAssertExit (allNearAbs (res2[i].getValue().getValue(),
+                                  d2.getValue().getValue(), 1e-12));
+    Array<MDirection> a3 = adirCol.convert (i, MDirection::J2000);
+    AlwaysAssertExit (a3.shape() == IPosition(1,3));
+    for (uInt j=0; j<3; ++j) {
+      MDirection d3 = MDirection::Convert
+        (MDirection(adirCol(i)(IPosition(1,j))), MDirection::J2000)();
+      AlwaysAssertExit (allNearAbs (a3(IPosition(1,j)).getValue().getValue(),
+                                    d3.getValue().getValue(), 1e-12));
+      AlwaysAssertExit (allNearAbs
+                        (res3(IPosition(2,j,i)).getValue().getValue(),
+                         d3.getValue().getValue(), 1e-12));
+    }
+  }
+}
+
 int main(int argc, const char*[])
 {
   try {
@@ -1434,6 +1511,8 @@ int main(int argc, const char*[])
     testMain (doExcep);
     // Do tests where a refcode changes.
     testRefCodeChg();
+    // Test the conversion of an entire column.
+    testConvertColumn();
     cout << "Test completed normally...bye.\n";
   } catch (std::exception& x) {
     cout << "An error occurred.  The test ended early with the following";
@@ -25,6 +25,7 @@
 
 
 //# Includes
+#include <casacore/measures/Measures/MeasTableCache.h>
 #include <casacore/tables/Tables/SetupNewTab.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableDesc.h>
@@ -941,7 +942,16 @@ Bool close_table(const String &tnam, Table *&tab,
     put_version(tab, vs);	
   };
   if (timup) put_vsdate(tab);
+  String tabName = tab->tableName();
   delete tab; tab = 0;
+  // Create the data cache of the IERS and JPL tables (if not up-to-date).
+  String baseName = Path(tnam).baseName();
+  if (baseName.startsWith("IERS") || baseName.startsWith("DE")) {
+    Table ctab(tabName);
+    if (MeasTableCache(ctab).empty() && MeasTableCache::create(ctab)) {
+      cout << tnam << " data cache created" << endl;
+    };
+  };
   cout << tnam << " table " << version_string(vs);
   if (timup) cout << " now " << n << " entries"; 
   else cout << " has " << n << " entries"; 
@@ -52,6 +52,8 @@
 #include <casacore/measures/TableMeasures/ScalarQuantColumn.h>
 #include <casacore/tables/Tables/ColumnsIndex.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/TableRow.h>
 #include <casacore/tables/Tables/TableVector.h>
@@ -66,6 +68,63 @@
 
 namespace casacore {
 
+namespace {
+  // The number of main table rows appended in one go.
+  const rownr_t MainChunkSize = 65536;
+  // The maximum number of data values per column copied in one go.
+  const Int64 MainRunElements = 4194304;
+
+  // Test if the cells of the given rows are defined and have the same shape.
+  template<class T>
+  Bool sameShapeRows(const ArrayColumn<T>& col, rownr_t row, rownr_t nrow)
+  {
+    if (!col.isDefined(row)) {
+      return False;
+    }
+    const IPosition shape = col.shape(row);
+    for (rownr_t r = row+1; r < row+nrow; r++) {
+      if (!col.isDefined(r) || !col.shape(r).isEqual(shape)) {
+	return False;
+      }
+    }
+    return True;
+  }
+
+  // Copy the cells of nrow consecutive rows. They are copied in one go
+  // if they have the same shape, otherwise row by row.
+  template<class T>
+  void copyArrayRows(ArrayColumn<T>& to, rownr_t toRow,
+		     const ArrayColumn<T>& from, rownr_t fromRow, rownr_t nrow)
+  {
+    if (sameShapeRows(from, fromRow, nrow)) {
+      to.putColumnRange(Slicer(IPosition(1,toRow), IPosition(1,nrow)),
+			from.getColumnRange(Slicer(IPosition(1,fromRow),
+						   IPosition(1,nrow))));
+    } else {
+      for (rownr_t r = 0; r < nrow; r++) {
+	to.put(toRow+r, from, fromRow+r);
+      }
+    }
+  }
+
+  // Copy the cells of nrow consecutive rows multiplied by a factor.
+  void scaleArrayRows(ArrayColumn<Float>& to, rownr_t toRow,
+		      const ArrayColumn<Float>& from, rownr_t fromRow,
+		      rownr_t nrow, Float factor)
+  {
+    if (sameShapeRows(from, fromRow, nrow)) {
+      Array<Float> values(from.getColumnRange(Slicer(IPosition(1,fromRow),
+						      IPosition(1,nrow))));
+      values *= factor;
+      to.putColumnRange(Slicer(IPosition(1,toRow), IPosition(1,nrow)), values);
+    } else {
+      for (rownr_t r = 0; r < nrow; r++) {
+	to.put(toRow+r, from(fromRow+r) * factor);
+      }
+    }
+  }
+}
+
 MSConcat::MSConcat(MeasurementSet& ms):
   MSColumns(ms),
   itsMS(ms),
@@ -1380,32 +1439,36 @@ IPosition MSConcat::isFixedShape(const TableDesc& td) {
   thisObsId.reference(observationId());
   thisProcId.reference(processorId());
 
-  Vector<Int> obsIds=otherObsId.getColumn();
+  // The columns of the first part are read and written in one go.
+  const Slicer firstRows(IPosition(1,0), IPosition(1,curRow));
+  Vector<Int> firstObsIds;
+  Vector<Int> firstScans;
+  if(curRow > 0){
+    firstObsIds.reference(thisObsId.getColumnRange(firstRows));
+    firstScans.reference(thisScan.getColumnRange(firstRows));
+  }
 
-  if(doObsA_p){ // the obs ids changed for the first table
-    Vector<Int> oldObsIds=thisObsId.getColumn();
+  if(doObsA_p && curRow > 0){ // the obs ids changed for the first table
     for(rownr_t r = 0; r < curRow; r++) {
-      if(newObsIndexA_p.find(oldObsIds[r]) != newObsIndexA_p.end()){ // apply change
-	thisObsId.put(r, getMapValue (newObsIndexA_p, oldObsIds[r]));
+      if(newObsIndexA_p.find(firstObsIds[r]) != newObsIndexA_p.end()){ // apply change
+	firstObsIds[r] = getMapValue (newObsIndexA_p, firstObsIds[r]);
       }
     }
+    thisObsId.putColumnRange(firstRows, firstObsIds);
   }
 
-  Vector<Int> procIds=otherProcId.getColumn();
-
-  if(doProcA_p){ // the proc ids changed for the first table
-    Vector<Int> oldProcIds=thisProcId.getColumn();
-    for(uInt r = 0; r < curRow; r++) {
+  if(doProcA_p && curRow > 0){ // the proc ids changed for the first table
+    Vector<Int> oldProcIds=thisProcId.getColumnRange(firstRows);
+    for(rownr_t r = 0; r < curRow; r++) {
       if(newProcIndexA_p.find(oldProcIds[r]) != newProcIndexA_p.end()){ // apply change
-	thisProcId.put(r, getMapValue (newProcIndexA_p, oldProcIds[r]));
+	oldProcIds[r] = getMapValue (newProcIndexA_p, oldProcIds[r]);
       }
     }
+    thisProcId.putColumnRange(firstRows, oldProcIds);
   }
 
-  if(doState && otherStateNull){ // the state ids for the first table will have to be set to -1
-    for(rownr_t r = 0; r < curRow; r++) {
-      thisStateId.put(r, -1);
-    }
+  if(doState && otherStateNull && curRow > 0){ // the state ids for the first table will have to be set to -1
+    thisStateId.putColumnRange(firstRows, Vector<Int>(curRow, -1));
   }
 
   // SCAN NUMBER
@@ -1418,8 +1481,8 @@ IPosition MSConcat::isFixedShape(const TableDesc& td) {
   vector<Int> maxScan;
   Int maxScanThis=0;
   for(rownr_t r = 0; r < curRow; r++) {
-    Int oid = thisObsId(r);
-    Int scanid = thisScan(r);
+    Int oid = firstObsIds[r];
+    Int scanid = firstScans[r];
     Bool found = False;
     uInt i;
     for(i=0; i<distinctObsIdSet.size(); i++){
@@ -1498,6 +1561,11 @@ IPosition MSConcat::isFixedShape(const TableDesc& td) {
 
   // MAIN
 
+  // The rows are appended in chunks. The scalar columns of a chunk are
+  // remapped in memory and written with a single put. The array columns
+  // of a run of rows with the same data description, which need neither
+  // a channel reversal nor a swap of the antennas, are copied in one go
+  // as well; the other rows are copied row by row.
   Bool notYetFeedWarned = True;
   Bool doWeightScale = (itsWeightScale!=1. && itsWeightScale>0.);
   Float sScale = 1.; // scale for SIGMA
@@ -1510,345 +1578,427 @@ IPosition MSConcat::isFixedShape(const TableDesc& td) {
   Int polId = -1;
   vector<Int> polSwap;
 
-  for (rownr_t r = 0; r < newRows; r++, curRow++) {
-    // Determine whether we need to swap rows in the visibility matrix
-    // if we change the order of the antennas.  This is done by
-    // creating a mapping that makes sure the receptor numbers remain
-    // correct when the antennas are swapped.
-    /////uInt d = otherDDId(r);
-    Int p = otherDDCols.polarizationId()(otherDDId(r));
-    if (p != polId) {
-      const Matrix<Int> &products = otherPolCols.corrProduct()(p);
-      polSwap.resize(products.shape()(1));
-      for (Int i = 0; i < products.shape()(1); i++) {
-        for (Int j = 0; j < products.shape()(1); j++) {
-          if (products(0, i) == products(1, j) &&
-              products(1, i) == products(0, j)) {
-            polSwap[i] = j;
-            break;
-          }
-        }
+  const rownr_t firstNewRow = curRow;
+  for (rownr_t chunkStart = 0; chunkStart < newRows; chunkStart += MainChunkSize) {
+    const rownr_t nChunk = std::min(MainChunkSize, newRows - chunkStart);
+    const Slicer otherRows(IPosition(1,chunkStart), IPosition(1,nChunk));
+    const Slicer thisRows(IPosition(1,firstNewRow + chunkStart), IPosition(1,nChunk));
+
+    // SCALAR COLUMNS
+    const Vector<Int> ant1 = otherAnt1.getColumnRange(otherRows);
+    const Vector<Int> ant2 = otherAnt2.getColumnRange(otherRows);
+    const Vector<Int> ddIds = otherDDId.getColumnRange(otherRows);
+    const Vector<Int> fieldIds = otherFieldId.getColumnRange(otherRows);
+    const Vector<Int> obsIds = otherObsId.getColumnRange(otherRows);
+    const Vector<Int> procIds = otherProcId.getColumnRange(otherRows);
+    const Vector<Int> scans = otherScan.getColumnRange(otherRows);
+    const Vector<Int> stateIds = otherStateId.getColumnRange(otherRows);
+    const Vector<Int> feed1 = otherFeed1.getColumnRange(otherRows);
+    const Vector<Int> feed2 = otherFeed2.getColumnRange(otherRows);
+    Vector<Int> newAnt1(nChunk), newAnt2(nChunk), newDDIds(nChunk), newFieldIds(nChunk);
+    Vector<Int> newObsIds(nChunk), newProcIds(nChunk), newScans(nChunk), newStateIds(nChunk);
+    Vector<Int> newFeed1(nChunk), newFeed2(nChunk);
+    Vector<Bool> conjugate(nChunk, False);
+
+    for (rownr_t i = 0; i < nChunk; i++) {
+      Int newA1 = newAntIndices[ant1[i]];
+      Int newA2 = newAntIndices[ant2[i]];
+      if(newA1>newA2){ // swap indices; the UVW and data are handled below
+	newAnt1[i] = newA2;
+	newAnt2[i] = newA1;
+	newFeed1[i] = feed2[i];
+	newFeed2[i] = feed1[i];
+	conjugate[i] = True;
+      }
+      else{
+	newAnt1[i] = newA1;
+	newAnt2[i] = newA2;
+	newFeed1[i] = feed1[i];
+	newFeed2[i] = feed2[i];
       }
-      polId = p;
-    }
-
-    Int newA1 = newAntIndices[otherAnt1(r)];
-    Int newA2 = newAntIndices[otherAnt2(r)];
-    Bool doConjugateVis = False;
-    if(newA1>newA2){ // swap indices and multiply UVW by -1
-      //cout << "   corrected order r: " << r << " " << newA2 << " " << newA1 << endl;
-      thisAnt1.put(curRow, newA2);
-      thisAnt2.put(curRow, newA1);
-      Array<Double> newUvw;
-      newUvw.assign(otherUvw(r));
-      //cout << "   old UVW " << newUvw;
-      newUvw *= -1.;
-      //cout << ", new UVW " << newUvw << endl;
-      thisUvw.put(curRow, newUvw);
-      doConjugateVis = True;
-    }
-    else{
-      thisAnt1.put(curRow, newA1);
-      thisAnt2.put(curRow, newA2);
-      thisUvw.put(curRow, otherUvw, r);
-    }
-
-    thisDDId.put(curRow, newDDIndices[otherDDId(r)]);
-    thisFieldId.put(curRow, newFldIndices[otherFieldId(r)]);
 
-    Int oid = 0;
-    if(doObsB_p && newObsIndexB_p.find(obsIds[r]) != newObsIndexB_p.end()){
-      // the obs ids have been changed for the table to be appended
-      oid = getMapValue(newObsIndexB_p, obsIds[r]);
-    }
-    else { // this OBS id didn't change
-      oid = obsIds[r];
-    }
-    thisObsId.put(curRow, oid);
+      newDDIds[i] = newDDIndices[ddIds[i]];
+      newFieldIds[i] = newFldIndices[fieldIds[i]];
 
-    if(oid != obsIds[r]){ // obsid actually changed
-      if(scanOffsetForOid.find(oid) == scanOffsetForOid.end()){ // offset not set, use default
-	scanOffsetForOid[oid] = defaultScanOffset;
+      Int oid = 0;
+      if(doObsB_p && newObsIndexB_p.find(obsIds[i]) != newObsIndexB_p.end()){
+	// the obs ids have been changed for the table to be appended
+	oid = getMapValue(newObsIndexB_p, obsIds[i]);
       }
-      if(encountered.find(oid)==encountered.end() && scanOffsetForOid.at(oid)!=0){
-	log << LogIO::NORMAL << "Will offset scan numbers by " <<  scanOffsetForOid.at(oid)
-	    << " for observations with Obs ID " << oid
-	    << " in order to make scan numbers unique." << LogIO::POST;
-	encountered[oid] = 0;
+      else { // this OBS id didn't change
+	oid = obsIds[i];
       }
-      thisScan.put(curRow, otherScan(r) + scanOffsetForOid.at(oid));
-    }
-    else{
-      thisScan.put(curRow, otherScan(r));
-    }
+      newObsIds[i] = oid;
 
-    Int procid = 0;
-    if(doProcB_p && newProcIndexB_p.find(procIds[r]) != newProcIndexB_p.end()){
-      // the proc ids have been changed for the table to be appended
-      procid = getMapValue(newProcIndexB_p, procIds[r]);
-    }
-    else { // this PROC id didn't change
-      procid = procIds[r];
-    }
-    thisProcId.put(curRow, procid);
-
-
-    if(doState){
-      if(itsStateNull || otherStateNull){
-	thisStateId.put(curRow, -1);
+      if(oid != obsIds[i]){ // obsid actually changed
+	if(scanOffsetForOid.find(oid) == scanOffsetForOid.end()){ // offset not set, use default
+	  scanOffsetForOid[oid] = defaultScanOffset;
+	}
+	if(encountered.find(oid)==encountered.end() && scanOffsetForOid.at(oid)!=0){
+	  log << LogIO::NORMAL << "Will offset scan numbers by " <<  scanOffsetForOid.at(oid)
+	      << " for observations with Obs ID " << oid
+	      << " in order to make scan numbers unique." << LogIO::POST;
+	  encountered[oid] = 0;
+	}
+	newScans[i] = scans[i] + scanOffsetForOid.at(oid);
       }
       else{
-	thisStateId.put(curRow, newStateIndices[otherStateId(r)]);
+	newScans[i] = scans[i];
       }
-    }
-    else{
-      thisStateId.put(curRow, otherStateId, r);
-    }
 
-    if(itsChanReversed[otherDDId(r)]){
-
-      Vector<Int> datShape;
-      Matrix<Complex> reversedData;
-      Matrix<Float> reversedFloatData;
-      Matrix<Complex> swappedData;
-      if(doFloatData){
-	datShape=otherFloatData.shape(r).asVector();
-	reversedFloatData.resize(datShape[0], datShape[1]);
+      if(doProcB_p && newProcIndexB_p.find(procIds[i]) != newProcIndexB_p.end()){
+	// the proc ids have been changed for the table to be appended
+	newProcIds[i] = getMapValue(newProcIndexB_p, procIds[i]);
       }
-      else{
-	datShape=otherData.shape(r).asVector();
-	reversedData.resize(datShape[0], datShape[1]);
+      else { // this PROC id didn't change
+	newProcIds[i] = procIds[i];
       }
-      Matrix<Complex> reversedCorrData(datShape[0], datShape[1]);
-      Matrix<Complex> reversedModData(datShape[0], datShape[1]);
-      for (Int k1=0; k1 < datShape[0]; ++k1){
-	for(Int k2=0; k2 < datShape[1]; ++k2){
-	  if(doFloatData){
-	    reversedFloatData(k1,k2)=(Matrix<Float>(otherFloatData(r)))(k1,
-									datShape[1]-1-k2);
-	  }
-	  else{
-	    reversedData(k1,k2)=(Matrix<Complex>(otherData(r)))(k1,
-								datShape[1]-1-k2);
-	  }
-	  if(doModelData){
-	    reversedModData(k1,k2)=(Matrix<Complex>(otherModelData(r)))(k1,
-									datShape[1]-1-k2);
-	  }
-	  if(doCorrectedData){
-	    reversedCorrData(k1,k2)=(Matrix<Complex>(otherCorrectedData(r)))(k1,
-									     datShape[1]-1-k2);
-	  }
+
+      if(doState){
+	if(itsStateNull || otherStateNull){
+	  newStateIds[i] = -1;
+	}
+	else{
+	  newStateIds[i] = newStateIndices[stateIds[i]];
 	}
-      }
-      if(doFloatData){
-	thisFloatData.put(curRow, reversedFloatData);
       }
       else{
-	if(doConjugateVis){
-	  swappedData.resize(datShape[0], datShape[1]);
-	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedData.row(p) = (Matrix<Complex>(reversedData)).row(polSwap[p]);
-	  }
-	  thisData.put(curRow, conj(swappedData));
+	newStateIds[i] = stateIds[i];
+      }
+
+      if(notYetFeedWarned && (feed1[i]>0 || feed2[i]>0)){
+	log << LogIO::WARN << "MS to be appended contains antennas with multiple feeds. Feed ID reindexing is not implemented.\n"
+	    << LogIO::POST;
+	notYetFeedWarned = False;
+      }
+    }
+
+    thisAnt1.putColumnRange(thisRows, newAnt1);
+    thisAnt2.putColumnRange(thisRows, newAnt2);
+    thisDDId.putColumnRange(thisRows, newDDIds);
+    thisFieldId.putColumnRange(thisRows, newFieldIds);
+    thisObsId.putColumnRange(thisRows, newObsIds);
+    thisScan.putColumnRange(thisRows, newScans);
+    thisProcId.putColumnRange(thisRows, newProcIds);
+    thisStateId.putColumnRange(thisRows, newStateIds);
+    thisFeed1.putColumnRange(thisRows, newFeed1);
+    thisFeed2.putColumnRange(thisRows, newFeed2);
+    thisTime.putColumnRange(thisRows, otherTime.getColumnRange(otherRows));
+    thisInterval.putColumnRange(thisRows, otherInterval.getColumnRange(otherRows));
+    thisExposure.putColumnRange(thisRows, otherExposure.getColumnRange(otherRows));
+    thisTimeCen.putColumnRange(thisRows, otherTimeCen.getColumnRange(otherRows));
+    thisArrayId.putColumnRange(thisRows, otherArrayId.getColumnRange(otherRows));
+    thisFlagRow.putColumnRange(thisRows, otherFlagRow.getColumnRange(otherRows));
+
+    // UVW (always 3 values per row); negate it if the antennas are swapped
+    {
+      Matrix<Double> uvws(otherUvw.getColumnRange(otherRows));
+      for (rownr_t i = 0; i < nChunk; i++) {
+	if(conjugate[i]){
+	  Vector<Double> uvw(uvws.column(i));
+	  uvw *= -1.;
+	}
+      }
+      thisUvw.putColumnRange(thisRows, uvws);
+    }
+
+    // ARRAY COLUMNS
+    rownr_t i = 0;
+    while (i < nChunk) {
+      const Int dd = ddIds[i];
+      if(!conjugate[i] && !itsChanReversed[dd]){
+	// find the run of rows which can be copied as is, but limit the
+	// amount of data held in memory
+	const IPosition dataShape = (doFloatData ? otherFloatData.shape(chunkStart+i)
+				     : otherData.shape(chunkStart+i));
+	const rownr_t maxRun = std::max(rownr_t(1),
+					rownr_t(MainRunElements / std::max(dataShape.product(), Int64(1))));
+	rownr_t nRun = 1;
+	while (i+nRun < nChunk && nRun < maxRun && ddIds[i+nRun] == dd
+	       && !conjugate[i+nRun]) {
+	  nRun++;
+	}
+	const rownr_t r = chunkStart + i;
+	curRow = firstNewRow + r;
+	if(doFloatData){
+	  copyArrayRows(thisFloatData, curRow, otherFloatData, r, nRun);
 	}
 	else{
-	  thisData.put(curRow, reversedData);
+	  copyArrayRows(thisData, curRow, otherData, r, nRun);
 	}
-      }
-      if(doCorrectedData){
-	if(doConjugateVis){
-	  swappedData.resize(datShape[0], datShape[1]);
-	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedData.row(p) = (Matrix<Complex>(reversedCorrData)).row(polSwap[p]);
-	  }
-	  thisCorrectedData.put(curRow, conj(swappedData));
+	if(doModelData){
+	  copyArrayRows(thisModelData, curRow, otherModelData, r, nRun);
 	}
-	else{
-	  thisCorrectedData.put(curRow, reversedCorrData);
+	if(doCorrectedData){
+	  copyArrayRows(thisCorrectedData, curRow, otherCorrectedData, r, nRun);
 	}
-      }
-      if(doModelData){
-	if(doConjugateVis){
-	  swappedData.resize(datShape[0], datShape[1]);
-	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedData.row(p) = (Matrix<Complex>(reversedModData)).row(polSwap[p]);
-	  }
-	  thisModelData.put(curRow, conj(swappedData));
+	if(doWeightScale){
+	  scaleArrayRows(thisWeight, curRow, otherWeight, r, nRun, itsWeightScale);
+	  if (copyWtSp) scaleArrayRows(thisWeightSp, curRow, otherWeightSp, r, nRun, itsWeightScale);
+	  scaleArrayRows(thisSigma, curRow, otherSigma, r, nRun, sScale);
+	  if (copySgSp) scaleArrayRows(thisSigmaSp, curRow, otherSigmaSp, r, nRun, sScale);
 	}
 	else{
-	  thisModelData.put(curRow, reversedModData);
+	  copyArrayRows(thisWeight, curRow, otherWeight, r, nRun);
+	  if (copyWtSp) copyArrayRows(thisWeightSp, curRow, otherWeightSp, r, nRun);
+	  copyArrayRows(thisSigma, curRow, otherSigma, r, nRun);
+	  if (copySgSp) copyArrayRows(thisSigmaSp, curRow, otherSigmaSp, r, nRun);
+	}
+	copyArrayRows(thisFlag, curRow, otherFlag, r, nRun);
+	if (copyFlagCat) copyArrayRows(thisFlagCat, curRow, otherFlagCat, r, nRun);
+	i += nRun;
+	continue;
+      }
+
+      // Copy a single row which needs a channel reversal or an antenna swap.
+      const rownr_t r = chunkStart + i;
+      curRow = firstNewRow + r;
+      const Bool doConjugateVis = conjugate[i];
+      i++;
+
+      // Determine whether we need to swap rows in the visibility matrix
+      // if we change the order of the antennas.  This is done by
+      // creating a mapping that makes sure the receptor numbers remain
+      // correct when the antennas are swapped.
+      Int p = otherDDCols.polarizationId()(dd);
+      if (p != polId) {
+	const Matrix<Int> &products = otherPolCols.corrProduct()(p);
+	polSwap.resize(products.shape()(1));
+	for (Int k = 0; k < products.shape()(1); k++) {
+	  for (Int j = 0; j < products.shape()(1); j++) {
+	    if (products(0, k) == products(1, j) &&
+		products(1, k) == products(0, j)) {
+	      polSwap[k] = j;
+	      break;
+	    }
+	  }
 	}
+	polId = p;
       }
-    }
-    else{ // no reversal
-      Vector<Int> datShape;
-      Matrix<Complex> swappedData;
-      if(doFloatData){
-	thisFloatData.put(curRow, otherFloatData, r);
-      }
-      else{
-	if(doConjugateVis){ // conjugate because order of antennas was reversed
+
+      if(itsChanReversed[dd]){
+
+	Vector<Int> datShape;
+	Matrix<Complex> reversedData;
+	Matrix<Float> reversedFloatData;
+	Matrix<Complex> swappedData;
+	if(doFloatData){
+	  datShape=otherFloatData.shape(r).asVector();
+	  reversedFloatData.resize(datShape[0], datShape[1]);
+	}
+	else{
 	  datShape=otherData.shape(r).asVector();
-	  swappedData.resize(datShape[0], datShape[1]);
-	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedData.row(p) = (Matrix<Complex>(otherData(r))).row(polSwap[p]);
+	  reversedData.resize(datShape[0], datShape[1]);
+	}
+	Matrix<Complex> reversedCorrData(datShape[0], datShape[1]);
+	Matrix<Complex> reversedModData(datShape[0], datShape[1]);
+	for (Int k1=0; k1 < datShape[0]; ++k1){
+	  for(Int k2=0; k2 < datShape[1]; ++k2){
+	    if(doFloatData){
+	      reversedFloatData(k1,k2)=(Matrix<Float>(otherFloatData(r)))(k1,
+									  datShape[1]-1-k2);
+	    }
+	    else{
+	      reversedData(k1,k2)=(Matrix<Complex>(otherData(r)))(k1,
+								  datShape[1]-1-k2);
+	    }
+	    if(doModelData){
+	      reversedModData(k1,k2)=(Matrix<Complex>(otherModelData(r)))(k1,
+									  datShape[1]-1-k2);
+	    }
+	    if(doCorrectedData){
+	      reversedCorrData(k1,k2)=(Matrix<Complex>(otherCorrectedData(r)))(k1,
+									       datShape[1]-1-k2);
+	    }
 	  }
-	  thisData.put(curRow, conj(swappedData));
+	}
+	if(doFloatData){
+	  thisFloatData.put(curRow, reversedFloatData);
 	}
 	else{
-	  thisData.put(curRow, otherData, r);
+	  if(doConjugateVis){
+	    swappedData.resize(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedData.row(p) = (Matrix<Complex>(reversedData)).row(polSwap[p]);
+	    }
+	    thisData.put(curRow, conj(swappedData));
+	  }
+	  else{
+	    thisData.put(curRow, reversedData);
+	  }
 	}
-      }
-      if(doModelData){
-	if(doConjugateVis){
-	  datShape=otherModelData.shape(r).asVector();
-	  swappedData.resize(datShape[0], datShape[1]);
-	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedData.row(p) = (Matrix<Complex>(otherModelData(r))).row(polSwap[p]);
+	if(doCorrectedData){
+	  if(doConjugateVis){
+	    swappedData.resize(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedData.row(p) = (Matrix<Complex>(reversedCorrData)).row(polSwap[p]);
+	    }
+	    thisCorrectedData.put(curRow, conj(swappedData));
+	  }
+	  else{
+	    thisCorrectedData.put(curRow, reversedCorrData);
 	  }
-	  thisModelData.put(curRow, conj(swappedData));
 	}
-	else{
-	  thisModelData.put(curRow, otherModelData, r);
+	if(doModelData){
+	  if(doConjugateVis){
+	    swappedData.resize(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedData.row(p) = (Matrix<Complex>(reversedModData)).row(polSwap[p]);
+	    }
+	    thisModelData.put(curRow, conj(swappedData));
+	  }
+	  else{
+	    thisModelData.put(curRow, reversedModData);
+	  }
 	}
       }
-      if(doCorrectedData){
-	if(doConjugateVis){
-	  datShape=otherCorrectedData.shape(r).asVector();
-	  swappedData.resize(datShape[0], datShape[1]);
-	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedData.row(p) = (Matrix<Complex>(otherCorrectedData(r))).row(polSwap[p]);
-	  }
-	  thisCorrectedData.put(curRow, conj(swappedData));
+      else{ // no reversal
+	Vector<Int> datShape;
+	Matrix<Complex> swappedData;
+	if(doFloatData){
+	  thisFloatData.put(curRow, otherFloatData, r);
 	}
 	else{
-	  thisCorrectedData.put(curRow, otherCorrectedData, r);
-	}
-      }
-    } // end if itsChanReversed
-
-    if(doWeightScale){
-      if(doConjugateVis){
-	Vector<Int> datShape=otherWeight.shape(r).asVector();
-	Vector<Float> swappedWeight(datShape[0]);
-	for (Int p = 0; p < datShape[0]; p++) {
-	  swappedWeight(p) = (Vector<Float>(otherWeight(r)))(polSwap[p]);
+	  if(doConjugateVis){ // conjugate because order of antennas was reversed
+	    datShape=otherData.shape(r).asVector();
+	    swappedData.resize(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedData.row(p) = (Matrix<Complex>(otherData(r))).row(polSwap[p]);
+	    }
+	    thisData.put(curRow, conj(swappedData));
+	  }
+	  else{
+	    thisData.put(curRow, otherData, r);
+	  }
 	}
-	thisWeight.put(curRow, swappedWeight*itsWeightScale);
-	if (copyWtSp) {
-	  datShape.assign(otherWeightSp.shape(r).asVector());
-	  Matrix<Float> swappedWeightSp(datShape[0], datShape[1]);
-	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedWeightSp.row(p) = (Matrix<Float>(otherWeightSp(r))).row(polSwap[p]);
+	if(doModelData){
+	  if(doConjugateVis){
+	    datShape=otherModelData.shape(r).asVector();
+	    swappedData.resize(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedData.row(p) = (Matrix<Complex>(otherModelData(r))).row(polSwap[p]);
+	    }
+	    thisModelData.put(curRow, conj(swappedData));
+	  }
+	  else{
+	    thisModelData.put(curRow, otherModelData, r);
 	  }
-	  thisWeightSp.put(curRow, swappedWeightSp*itsWeightScale);
 	}
-	datShape.assign(otherSigma.shape(r).asVector());
-	Vector<Float> swappedSigma(datShape[0]);
-	for (Int p = 0; p < datShape[0]; p++) {
-	  swappedSigma(p) = (Vector<Float>(otherSigma(r)))(polSwap[p]);
+	if(doCorrectedData){
+	  if(doConjugateVis){
+	    datShape=otherCorrectedData.shape(r).asVector();
+	    swappedData.resize(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedData.row(p) = (Matrix<Complex>(otherCorrectedData(r))).row(polSwap[p]);
+	    }
+	    thisCorrectedData.put(curRow, conj(swappedData));
+	  }
+	  else{
+	    thisCorrectedData.put(curRow, otherCorrectedData, r);
+	  }
 	}
-	thisSigma.put(curRow, swappedSigma*sScale);
-	if (copySgSp) {
-	  datShape.assign(otherSigmaSp.shape(r).asVector());
-	  Matrix<Float> swappedSigmaSp(datShape[0], datShape[1]);
+      } // end if itsChanReversed
+
+      if(doWeightScale){
+	if(doConjugateVis){
+	  Vector<Int> datShape=otherWeight.shape(r).asVector();
+	  Vector<Float> swappedWeight(datShape[0]);
 	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedSigmaSp.row(p) = (Matrix<Float>(otherSigmaSp(r))).row(polSwap[p]);
+	    swappedWeight(p) = (Vector<Float>(otherWeight(r)))(polSwap[p]);
+	  }
+	  thisWeight.put(curRow, swappedWeight*itsWeightScale);
+	  if (copyWtSp) {
+	    datShape.assign(otherWeightSp.shape(r).asVector());
+	    Matrix<Float> swappedWeightSp(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedWeightSp.row(p) = (Matrix<Float>(otherWeightSp(r))).row(polSwap[p]);
+	    }
+	    thisWeightSp.put(curRow, swappedWeightSp*itsWeightScale);
+	  }
+	  datShape.assign(otherSigma.shape(r).asVector());
+	  Vector<Float> swappedSigma(datShape[0]);
+	  for (Int p = 0; p < datShape[0]; p++) {
+	    swappedSigma(p) = (Vector<Float>(otherSigma(r)))(polSwap[p]);
+	  }
+	  thisSigma.put(curRow, swappedSigma*sScale);
+	  if (copySgSp) {
+	    datShape.assign(otherSigmaSp.shape(r).asVector());
+	    Matrix<Float> swappedSigmaSp(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedSigmaSp.row(p) = (Matrix<Float>(otherSigmaSp(r))).row(polSwap[p]);
+	    }
+	    thisSigmaSp.put(curRow, swappedSigmaSp*sScale);
 	  }
-	  thisSigmaSp.put(curRow, swappedSigmaSp*sScale);
 	}
-      }
-      else {
-	thisWeight.put(curRow, otherWeight(r)*itsWeightScale);
-	if (copyWtSp)
-	  thisWeightSp.put(curRow, otherWeightSp(r)*itsWeightScale);
-	thisSigma.put(curRow, otherSigma(r)*sScale);
-	if (copySgSp)
-	  thisSigmaSp.put(curRow, otherSigmaSp(r)*sScale);
-      }
-    }
-    else{
-      if (doConjugateVis){
-	Vector<Int> datShape=otherWeight.shape(r).asVector();
-	Vector<Float> swappedWeight(datShape[0]);
-	for (Int p = 0; p < datShape[0]; p++) {
-	  swappedWeight(p) = (Vector<Float>(otherWeight(r)))(polSwap[p]);
+	else {
+	  thisWeight.put(curRow, otherWeight(r)*itsWeightScale);
+	  if (copyWtSp)
+	    thisWeightSp.put(curRow, otherWeightSp(r)*itsWeightScale);
+	  thisSigma.put(curRow, otherSigma(r)*sScale);
+	  if (copySgSp)
+	    thisSigmaSp.put(curRow, otherSigmaSp(r)*sScale);
 	}
-	thisWeight.put(curRow, swappedWeight);
-	if (copyWtSp) {
-	  datShape.assign(otherWeightSp.shape(r).asVector());
-	  Matrix<Float> swappedWeightSp(datShape[0], datShape[1]);
+      }
+      else{
+	if (doConjugateVis){
+	  Vector<Int> datShape=otherWeight.shape(r).asVector();
+	  Vector<Float> swappedWeight(datShape[0]);
 	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedWeightSp.row(p) = (Matrix<Float>(otherWeightSp(r))).row(polSwap[p]);
+	    swappedWeight(p) = (Vector<Float>(otherWeight(r)))(polSwap[p]);
+	  }
+	  thisWeight.put(curRow, swappedWeight);
+	  if (copyWtSp) {
+	    datShape.assign(otherWeightSp.shape(r).asVector());
+	    Matrix<Float> swappedWeightSp(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedWeightSp.row(p) = (Matrix<Float>(otherWeightSp(r))).row(polSwap[p]);
+	    }
+	    thisWeightSp.put(curRow, swappedWeightSp);
+	  }
+	  datShape.assign(otherSigma.shape(r).asVector());
+	  Vector<Float> swappedSigma(datShape[0]);
+	  for (Int p = 0; p < datShape[0]; p++) {
+	    swappedSigma(p) = (Vector<Float>(otherSigma(r)))(polSwap[p]);
+	  }
+	  thisSigma.put(curRow, swappedSigma);
+	  if (copySgSp) {
+	    datShape.assign(otherSigmaSp.shape(r).asVector());
+	    Matrix<Float> swappedSigmaSp(datShape[0], datShape[1]);
+	    for (Int p = 0; p < datShape[0]; p++) {
+	      swappedSigmaSp.row(p) = (Matrix<Float>(otherSigmaSp(r))).row(polSwap[p]);
+	    }
+	    thisSigmaSp.put(curRow, swappedSigmaSp);
 	  }
-	  thisWeightSp.put(curRow, swappedWeightSp);
 	}
-	datShape.assign(otherSigma.shape(r).asVector());
-	Vector<Float> swappedSigma(datShape[0]);
+	else{
+	  thisWeight.put(curRow, otherWeight, r);
+	  if (copyWtSp) thisWeightSp.put(curRow, otherWeightSp, r);
+	  thisSigma.put(curRow, otherSigma, r);
+	  if (copySgSp) thisSigmaSp.put(curRow, otherSigmaSp, r);
+	}
+      }
+
+      if(doConjugateVis){
+	Vector<Int> datShape=otherFlag.shape(r).asVector();
+	Matrix<Bool> swappedFlag(datShape[0], datShape[1]);
 	for (Int p = 0; p < datShape[0]; p++) {
-	  swappedSigma(p) = (Vector<Float>(otherSigma(r)))(polSwap[p]);
+	  swappedFlag.row(p) = (Matrix<Bool>(otherFlag(r))).row(polSwap[p]);
 	}
-	thisSigma.put(curRow, swappedSigma);
-	if (copySgSp) {
-	  datShape.assign(otherSigmaSp.shape(r).asVector());
-	  Matrix<Float> swappedSigmaSp(datShape[0], datShape[1]);
+	thisFlag.put(curRow, swappedFlag);
+	if (copyFlagCat) {
+	  datShape.assign(otherFlagCat.shape(r).asVector());
+	  Cube<Bool> swappedFlagCat(datShape[0], datShape[1], datShape[2]);
 	  for (Int p = 0; p < datShape[0]; p++) {
-	    swappedSigmaSp.row(p) = (Matrix<Float>(otherSigmaSp(r))).row(polSwap[p]);
+	    swappedFlagCat.yzPlane(p) = (Cube<Bool>(otherFlagCat(r))).yzPlane(polSwap[p]);
 	  }
-	  thisSigmaSp.put(curRow, swappedSigmaSp);
+	  thisFlagCat.put(curRow, swappedFlagCat);
 	}
       }
       else{
-	thisWeight.put(curRow, otherWeight, r);
-	if (copyWtSp) thisWeightSp.put(curRow, otherWeightSp, r);
-	thisSigma.put(curRow, otherSigma, r);
-	if (copySgSp) thisSigmaSp.put(curRow, otherSigmaSp, r);
+	thisFlag.put(curRow, otherFlag, r);
+	if (copyFlagCat) thisFlagCat.put(curRow, otherFlagCat, r);
       }
     }
-
-    if(notYetFeedWarned && (otherFeed1(r)>0 || otherFeed2(r)>0)){
-      log << LogIO::WARN << "MS to be appended contains antennas with multiple feeds. Feed ID reindexing is not implemented.\n"
-	  << LogIO::POST;
-      notYetFeedWarned = False;
-    }
-
-    if(doConjugateVis){
-      thisFeed1.put(curRow, otherFeed2, r);
-      thisFeed2.put(curRow, otherFeed1, r);
-    }
-    else{
-      thisFeed1.put(curRow, otherFeed1, r);
-      thisFeed2.put(curRow, otherFeed2, r);
-    }
-
-    thisTime.put(curRow, otherTime, r);
-    thisInterval.put(curRow, otherInterval, r);
-    thisExposure.put(curRow, otherExposure, r);
-    thisTimeCen.put(curRow, otherTimeCen, r);
-    thisArrayId.put(curRow, otherArrayId, r);
-    if(doConjugateVis){
-      Vector<Int> datShape=otherFlag.shape(r).asVector();
-      Matrix<Bool> swappedFlag(datShape[0], datShape[1]);
-      for (Int p = 0; p < datShape[0]; p++) {
-	swappedFlag.row(p) = (Matrix<Bool>(otherFlag(r))).row(polSwap[p]);
-      }
-      thisFlag.put(curRow, swappedFlag);
-      if (copyFlagCat) {
-	datShape.assign(otherFlagCat.shape(r).asVector());
-	Cube<Bool> swappedFlagCat(datShape[0], datShape[1], datShape[2]);
-	for (Int p = 0; p < datShape[0]; p++) {
-	  swappedFlagCat.yzPlane(p) = (Cube<Bool>(otherFlagCat(r))).yzPlane(polSwap[p]);
-	}
-	thisFlagCat.put(curRow, swappedFlagCat);
-      }
-    }
-    else{
-      thisFlag.put(curRow, otherFlag, r);
-      if (copyFlagCat) thisFlagCat.put(curRow, otherFlagCat, r);
-    }
-    thisFlagRow.put(curRow, otherFlagRow, r);
-
   } // end for
 
   if(doModelData){ //update the MODEL_DATA keywords
@@ -446,7 +446,7 @@ void MSFlagger::diffMedian(Array<Float>& out, const Array<Float>& in,
   out.putStorage(pout,deleteOut);
 }
 
-inline String multiple(Int n) { return n!=1 ? "s" : ""; }
+inline String multiple(Int64 n) { return n!=1 ? "s" : ""; }
 
 Bool MSFlagger::clipDataBuffer(Float pixelLevel, Float timeLevel, 
 				Float channelLevel)
@@ -673,6 +673,93 @@ Bool MSFlagger::writeDataBufferFlags()
   return msSel_p->putData(items);
 }
 
+namespace {
+  // Flag the points with a squared amplitude outside [min2,max2] and
+  // return the number of points not flagged before.
+  Int64 clipAmplitudes(Bool* flag, const Complex* data, Int64 n,
+		       Float min2, Float max2)
+  {
+    Int64 count=0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:count) if (n > 65536)
+#endif
+    for (Int64 i=0; i<n; i++) {
+      const Float amp2=norm(data[i]);
+      const Bool clip=(amp2>max2) | (amp2<min2);
+      count+=(clip & !flag[i]);
+      flag[i]=flag[i] | clip;
+    }
+    return count;
+  }
+}
+
+Int64 MSFlagger::clipAmplitude(Float maxLevel, Float minLevel,
+			       const String& column)
+{
+  LogIO os;
+  if (!check()) return -1;
+  MeasurementSet tab=msSel_p->selectedTable();
+  if (!tab.isWritable()) {
+    os << LogIO::SEVERE << "MeasurementSet is not writable"<< LogIO::POST;
+    return -1;
+  }
+  if (!tab.tableDesc().isColumn(column)) {
+    os << LogIO::WARN << "Column "<< column <<" does not exist"<< LogIO::POST;
+    return -1;
+  }
+  ArrayColumn<Complex> dataCol(tab,column);
+  ArrayColumn<Bool> flagCol(tab,MS::columnName(MS::FLAG));
+  ScalarColumn<Bool> flagRowCol(tab,MS::columnName(MS::FLAG_ROW));
+  const Float max2=maxLevel*maxLevel;
+  const Float min2=(minLevel>0 ? minLevel*minLevel : -1);
+  const rownr_t nRow=tab.nrow();
+  Int64 nFlagged=0;
+  rownr_t start=0;
+  while (start<nRow) {
+    if (!dataCol.isDefined(start)) {
+      start++;
+      continue;
+    }
+    // find the rows with the same shape, of order 1 MB flags
+    const IPosition shape=dataCol.shape(start);
+    const rownr_t maxRow=max(rownr_t(1),rownr_t(1000000/shape.product()));
+    rownr_t n=1;
+    while (n<maxRow && start+n<nRow && dataCol.isDefined(start+n) &&
+	   dataCol.shape(start+n).isEqual(shape)) {
+      n++;
+    }
+    Slicer rowSlice(Slice(start,n));
+    Array<Complex> data(dataCol.getColumnRange(rowSlice));
+    Array<Bool> flag(flagCol.getColumnRange(rowSlice));
+    Bool deleteData, deleteFlag;
+    const Complex* pdata=data.getStorage(deleteData);
+    Bool* pflag=flag.getStorage(deleteFlag);
+    Int64 count=clipAmplitudes(pflag,pdata,flag.nelements(),min2,max2);
+    data.freeStorage(pdata,deleteData);
+    flag.putStorage(pflag,deleteFlag);
+    if (count>0) {
+      nFlagged+=count;
+      flagCol.putColumnRange(rowSlice,flag);
+      Vector<Bool> flagRow(flagRowCol.getColumnRange(rowSlice));
+      const Int64 nPerRow=shape.product();
+      Matrix<Bool> rowFlags(flag.reform(IPosition(2,nPerRow,n)));
+      Bool changed=False;
+      for (rownr_t j=0; j<n; j++) {
+	if (!flagRow(j) && allEQ(rowFlags.column(j),True)) {
+	  flagRow(j)=True;
+	  changed=True;
+	}
+      }
+      if (changed) flagRowCol.putColumnRange(rowSlice,flagRow);
+    }
+    start+=n;
+  }
+  os << LogIO::NORMAL << "Flagged "<< nFlagged <<" point"<< multiple(nFlagged)
+     << " with amplitude outside ["<< minLevel <<","<< maxLevel <<"]"
+     << LogIO::POST;
+  return nFlagged;
+}
+
 Bool MSFlagger::createFlagHistory(Int nHis)
 {
   LogIO os;
@@ -800,7 +887,7 @@ void MSFlagger::fillFlagHist(Int nHis, Int numCorr, Int numChan, Table& tab)
 {
   // fill the first two levels of flagging with the flags present 
   // in the MS columns FLAG and FLAG_ROW.
-  const rownr_t maxRow=1000000/(numCorr*numChan); // of order 1 MB chunks
+  const rownr_t maxRow=max(1,1000000/(numCorr*numChan)); // of order 1 MB chunks
   ArrayColumn<Bool> flagCol(tab,MS::columnName(MS::FLAG));
   ArrayColumn<Bool> flagHisCol(tab,MS::columnName(MS::FLAG_CATEGORY));
   Array<Bool> flagHis(IPosition(4,nHis,numCorr,numChan,maxRow));
@@ -817,7 +904,7 @@ void MSFlagger::fillFlagHist(Int nHis, Int numCorr, Int numChan, Table& tab)
   ScalarColumn<Bool> flagRowCol(tab,MS::columnName(MS::FLAG_ROW));
   Array<Bool> flagCube;
   Vector<Bool> flagRowVec;
-  for (rownr_t i=0; i<=(nRow/maxRow); i+=maxRow) {
+  for (rownr_t i=0; i*maxRow<nRow; i++) {
     rownr_t n=min(maxRow,nRow-maxRow*i);
     if (n<maxRow) {
       flagHis.resize(IPosition(4,nHis,numCorr,numChan,n));
@@ -895,14 +982,14 @@ void MSFlagger::saveToFlagHist(Int level, Table& tab)
   ArrayColumn<Bool> flagCol(tab,MS::columnName(MS::FLAG));
   Int numCorr=flagCol.shape(0)(0);
   Int numChan=flagCol.shape(0)(1);
-  const rownr_t maxRow=1000000/(numCorr*numChan); // of order 1 MB chunks
+  const rownr_t maxRow=max(1,1000000/(numCorr*numChan)); // of order 1 MB chunks
   Array<Bool> flagHis(IPosition(4,1,numCorr,numChan,maxRow));
   Cube<Bool> ref(flagHis.reform(IPosition(3,numCorr,numChan,maxRow)));
   rownr_t nRow=tab.nrow();
   Array<Bool> flagCube;
   Vector<Bool> flagRowVec;
   Slicer slicer(Slice(level,1),Slice(0,numCorr),Slice(0,numChan));
-  for (rownr_t i=0; i<=(nRow/maxRow); i+=maxRow) {
+  for (rownr_t i=0; i*maxRow<nRow; i++) {
     rownr_t n=min(maxRow,nRow-maxRow*i);
     if (n<maxRow) {
       flagHis.resize(IPosition(4,1,numCorr,numChan,n));
@@ -969,9 +1056,9 @@ void MSFlagger::applyFlagHist(Int level, Table& tab)
   rownr_t nRow=tab.nrow();
   ArrayColumn<Bool> flagHisCol(tab,MS::columnName(MS::FLAG_CATEGORY));
   IPosition shape=flagHisCol.shape(0); shape(0)=1;
-  const rownr_t maxRow=1000000/(shape(1)*shape(2)); // of order 1 MB chunks
+  const rownr_t maxRow=std::max(ssize_t(1),1000000/(shape(1)*shape(2))); // of order 1 MB chunks
   Slicer slicer(Slice(level,1),Slice(0,shape(1)),Slice(0,shape(2)));
-  for (rownr_t i=0; i<=nRow/maxRow; i++) {
+  for (rownr_t i=0; i*maxRow<nRow; i++) {
     rownr_t n=min(maxRow,nRow-i*maxRow);
     RowNumbers rows(n);
     indgen(rows, i*maxRow);
@@ -144,6 +144,17 @@ public:
   // Write the flags in the buffer back to the table
   Bool writeDataBufferFlags();
 
+  // Flag the points in the selected rows whose amplitude in the given
+  // data column (DATA, CORRECTED_DATA or MODEL_DATA) is above maxLevel or
+  // below minLevel. FLAG_ROW is set for rows getting all points flagged.
+  // Unlike the data buffer functions, the rows are processed directly in
+  // chunks of rows with the same data shape, so it can be used on a large
+  // selection. The comparison is done in parallel if OpenMP is used.
+  // It returns the number of points flagged by this call or -1 if the
+  // MS is not writable or the column does not exist.
+  Int64 clipAmplitude(Float maxLevel, Float minLevel=0,
+		      const String& column="DATA");
+
   // Clear the internal data buffer, reclaiming memory
   Bool clearDataBuffer()
   { buffer_p=Record(); return True;}
@@ -40,8 +40,14 @@
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/TaQL/TableParse.h>
 #include <casacore/casa/Containers/ValueHolder.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/Arrays/Slicer.h>
 
+#include <algorithm>
+#include <cstdio>
 #include <regex>
+#include <unistd.h>
 #include <utility>
 
 #define _ORIGIN "MSMetaData::" + String(__func__) + ": "
@@ -91,6 +97,7 @@ MSMetaData::MSMetaData(const MeasurementSet *const &ms, const Float maxCacheSize
         File(ms->tableName()).exists() ? 0 : 1, ms
       ),
        _spwInfoStored(False), _forceSubScanPropsToCache(False),
+       _columnRunsDone(False), _persistSummary(False),
        _sourceTimes() {}
 
 MSMetaData::~MSMetaData() {}
@@ -2264,13 +2271,291 @@ std::shared_ptr<std::map<ScanKey, std::set<Double> > > MSMetaData::_getScanToTim
 template <class T> std::shared_ptr<Vector<T> > MSMetaData::_getMainScalarColumn(
     MSMainEnums::PredefinedColumns col
 ) const {
-    String name = MeasurementSet::columnName(col);
-    ScalarColumn<T> mycol(*_ms, name);
     std::shared_ptr<Vector<T> > v(new Vector<T>());
-    mycol.getColumn(*v);
+    if (! _getColumnFromRuns(col, *v)) {
+        String name = MeasurementSet::columnName(col);
+        ScalarColumn<T> mycol(*_ms, name);
+        mycol.getColumn(*v);
+    }
     return v;
 }
 
+template <class T> void MSMetaData::_expandRuns(
+    Vector<T>& v, const _ColumnRuns<T>& runs, rownr_t nrow
+) {
+    v.resize(nrow);
+    rownr_t start = 0;
+    for (size_t i=0; i<runs.values.size(); ++i) {
+        std::fill(v.data() + start, v.data() + runs.ends[i], runs.values[i]);
+        start = runs.ends[i];
+    }
+}
+
+Bool MSMetaData::_getColumnFromRuns(
+    MSMainEnums::PredefinedColumns col, Vector<Int>& v
+) const {
+    _buildColumnRuns();
+    std::map<Int, _ColumnRuns<Int> >::const_iterator iter
+        = _intColumnRuns.find(col);
+    if (iter == _intColumnRuns.end()) {
+        return False;
+    }
+    _expandRuns(v, iter->second, nRows());
+    return True;
+}
+
+Bool MSMetaData::_getColumnFromRuns(
+    MSMainEnums::PredefinedColumns col, Vector<Double>& v
+) const {
+    _buildColumnRuns();
+    std::map<Int, _ColumnRuns<Double> >::const_iterator iter
+        = _doubleColumnRuns.find(col);
+    if (iter == _doubleColumnRuns.end()) {
+        return False;
+    }
+    _expandRuns(v, iter->second, nRows());
+    return True;
+}
+
+namespace {
+    // Accumulate the runs of a column. It gives up if there are too many.
+    template <class T> struct RunBuilder {
+        explicit RunBuilder(rownr_t maxRuns)
+            : maxRuns(maxRuns), ok(True) {}
+        void add(const Vector<T>& v, rownr_t startRow) {
+            for (size_t i=0; i<v.size(); ++i) {
+                if (values.empty() || v[i] != values.back()) {
+                    if (values.size() == maxRuns) {
+                        ok = False;
+                        values.clear();
+                        ends.clear();
+                        return;
+                    }
+                    values.push_back(v[i]);
+                    ends.push_back(startRow + i + 1);
+                } else {
+                    ends.back() = startRow + i + 1;
+                }
+            }
+        }
+        rownr_t maxRuns;
+        Bool ok;
+        std::vector<T> values;
+        std::vector<rownr_t> ends;
+    };
+}
+
+void MSMetaData::_buildColumnRuns() const {
+    if (_columnRunsDone) {
+        return;
+    }
+    _columnRunsDone = True;
+    // Without a cache the columns would be read many times.
+    if (_maxCacheMB <= 0) {
+        return;
+    }
+    if (_canPersistSummary() && _readColumnRuns()) {
+        return;
+    }
+    static const MSMainEnums::PredefinedColumns intCols[] = {
+        MSMainEnums::SCAN_NUMBER, MSMainEnums::FIELD_ID,
+        MSMainEnums::DATA_DESC_ID, MSMainEnums::STATE_ID,
+        MSMainEnums::OBSERVATION_ID, MSMainEnums::ARRAY_ID
+    };
+    const uInt nIntCols = sizeof(intCols) / sizeof(intCols[0]);
+    rownr_t nrow = nRows();
+    // A column is only worth keeping if it compresses well.
+    rownr_t maxRuns = std::max(nrow/8, rownr_t(1));
+    std::vector<RunBuilder<Int> > intRuns(nIntCols, RunBuilder<Int>(maxRuns));
+    RunBuilder<Double> timeRuns(maxRuns);
+    std::vector<ScalarColumn<Int> > intColumns;
+    for (uInt i=0; i<nIntCols; ++i) {
+        intColumns.push_back(
+            ScalarColumn<Int>(*_ms, MeasurementSet::columnName(intCols[i]))
+        );
+    }
+    ScalarColumn<Double> timeColumn(
+        *_ms, MeasurementSet::columnName(MSMainEnums::TIME)
+    );
+    // Read the columns in blocks of rows to limit the memory used.
+    const rownr_t blockSize = 1048576;
+    Vector<Int> intValues;
+    Vector<Double> timeValues;
+    for (rownr_t start=0; start<nrow; start+=blockSize) {
+        Slicer rows(
+            IPosition(1, start), IPosition(1, std::min(blockSize, nrow-start))
+        );
+        for (uInt i=0; i<nIntCols; ++i) {
+            if (intRuns[i].ok) {
+                intColumns[i].getColumnRange(rows, intValues, True);
+                intRuns[i].add(intValues, start);
+            }
+        }
+        if (timeRuns.ok) {
+            timeColumn.getColumnRange(rows, timeValues, True);
+            timeRuns.add(timeValues, start);
+        }
+    }
+    std::map<Int, _ColumnRuns<Int> > intColumnRuns;
+    std::map<Int, _ColumnRuns<Double> > doubleColumnRuns;
+    uInt size = 0;
+    for (uInt i=0; i<nIntCols; ++i) {
+        if (intRuns[i].ok) {
+            _ColumnRuns<Int>& runs = intColumnRuns[intCols[i]];
+            runs.values = Vector<Int>(intRuns[i].values);
+            runs.ends = Vector<rownr_t>(intRuns[i].ends);
+            size += runs.values.size() * (sizeof(Int) + sizeof(rownr_t));
+        }
+    }
+    if (timeRuns.ok) {
+        _ColumnRuns<Double>& runs = doubleColumnRuns[MSMainEnums::TIME];
+        runs.values = Vector<Double>(timeRuns.values);
+        runs.ends = Vector<rownr_t>(timeRuns.ends);
+        size += runs.values.size() * (sizeof(Double) + sizeof(rownr_t));
+    }
+    if (_cacheUpdated(size)) {
+        _intColumnRuns = intColumnRuns;
+        _doubleColumnRuns = doubleColumnRuns;
+        if (_canPersistSummary()) {
+            _writeColumnRuns();
+        }
+    }
+}
+
+Bool MSMetaData::hasPersistentSummary(const MeasurementSet& ms) {
+    return ms.isRootTable() && ms.tableType() == Table::Plain
+        && ! ms.isWritable()
+        && File(ms.tableName() + "/table.msmdsummary").isReadable();
+}
+
+Bool MSMetaData::getRunStarts(
+    Vector<rownr_t>& starts,
+    const vector<MSMainEnums::PredefinedColumns>& columns
+) const {
+    _buildColumnRuns();
+    // Collect the ends of the runs of all columns.
+    std::vector<rownr_t> ends;
+    for (MSMainEnums::PredefinedColumns col : columns) {
+        const Vector<rownr_t>* colEnds = 0;
+        std::map<Int, _ColumnRuns<Int> >::const_iterator intIter
+            = _intColumnRuns.find(col);
+        if (intIter != _intColumnRuns.end()) {
+            colEnds = &(intIter->second.ends);
+        } else {
+            std::map<Int, _ColumnRuns<Double> >::const_iterator doubleIter
+                = _doubleColumnRuns.find(col);
+            if (doubleIter == _doubleColumnRuns.end()) {
+                return False;
+            }
+            colEnds = &(doubleIter->second.ends);
+        }
+        ends.insert(ends.end(), colEnds->begin(), colEnds->end());
+    }
+    // A run starts at row 0 and at the end of each run but the last.
+    ends.push_back(0);
+    ends.push_back(nRows());
+    std::sort(ends.begin(), ends.end());
+    ends.erase(std::unique(ends.begin(), ends.end()), ends.end());
+    ends.pop_back();
+    starts.resize(ends.size());
+    std::copy(ends.begin(), ends.end(), starts.data());
+    return True;
+}
+
+Bool MSMetaData::_canPersistSummary() const {
+    // Only an entire readonly MS cannot have unflushed changes.
+    return _persistSummary && _ms->isRootTable()
+        && _ms->tableType() == Table::Plain && ! _ms->isWritable();
+}
+
+Bool MSMetaData::_readColumnRuns() const {
+    String name = _ms->tableName() + "/table.msmdsummary";
+    if (! File(name).isReadable()) {
+        return False;
+    }
+    std::map<Int, _ColumnRuns<Int> > intColumnRuns;
+    std::map<Int, _ColumnRuns<Double> > doubleColumnRuns;
+    uInt size = 0;
+    try {
+        AipsIO ios(name);
+        ios.getstart("MSMetaDataSummary");
+        uInt counter, nInt, nDouble;
+        uInt64 nrow;
+        ios >> counter >> nrow;
+        // The modify counter is up to date because nrow() has locked the MS.
+        if (nrow != _ms->nrow() || counter != _ms->modifyCounter()) {
+            return False;
+        }
+        ios >> nInt;
+        for (uInt i=0; i<nInt; ++i) {
+            String colName;
+            ios >> colName;
+            _ColumnRuns<Int>& runs
+                = intColumnRuns[MeasurementSet::columnType(colName)];
+            ios >> runs.values >> runs.ends;
+            size += runs.values.size() * (sizeof(Int) + sizeof(rownr_t));
+        }
+        ios >> nDouble;
+        for (uInt i=0; i<nDouble; ++i) {
+            String colName;
+            ios >> colName;
+            _ColumnRuns<Double>& runs
+                = doubleColumnRuns[MeasurementSet::columnType(colName)];
+            ios >> runs.values >> runs.ends;
+            size += runs.values.size() * (sizeof(Double) + sizeof(rownr_t));
+        }
+        ios.getend();
+    }
+    catch (const AipsError&) {
+        // A damaged file is ignored; the summary is made again.
+        return False;
+    }
+    if (_cacheUpdated(size)) {
+        _intColumnRuns = intColumnRuns;
+        _doubleColumnRuns = doubleColumnRuns;
+    }
+    return True;
+}
+
+void MSMetaData::_writeColumnRuns() const {
+    if (! File(_ms->tableName()).isWritable()) {
+        return;
+    }
+    // Write into a temporary file and rename it to make the update atomic
+    // for other processes reading it.
+    String name = _ms->tableName() + "/table.msmdsummary";
+    String tmpName = name + "_tmp" + String::toString(getpid());
+    try {
+        {
+            AipsIO ios(tmpName, ByteIO::New);
+            ios.putstart("MSMetaDataSummary", 1);
+            ios << _ms->modifyCounter() << uInt64(_ms->nrow());
+            ios << uInt(_intColumnRuns.size());
+            for (const auto& runs : _intColumnRuns) {
+                ios << MeasurementSet::columnName(
+                    MSMainEnums::PredefinedColumns(runs.first)
+                );
+                ios << runs.second.values << runs.second.ends;
+            }
+            ios << uInt(_doubleColumnRuns.size());
+            for (const auto& runs : _doubleColumnRuns) {
+                ios << MeasurementSet::columnName(
+                    MSMainEnums::PredefinedColumns(runs.first)
+                );
+                ios << runs.second.values << runs.second.ends;
+            }
+            ios.putend();
+        }
+        if (rename(tmpName.chars(), name.chars()) != 0) {
+            unlink(tmpName.chars());
+        }
+    }
+    catch (const AipsError&) {
+        // Not being able to write the summary is not an error.
+        unlink(tmpName.chars());
+    }
+}
+
 std::shared_ptr<Vector<Double> > MSMetaData::_getTimes() const {
     return _getMainScalarColumn<Double>(MSMainEnums::TIME);
 }
@@ -53,6 +53,14 @@ struct SubScanKey;
 // expensive to create, aren't cached. Also, the column data is usually only
 // needed temporarily to compute smaller data structures, and the column data
 // is not particularly expensive to recreate if necessary.
+// The exception are the columns SCAN_NUMBER, FIELD_ID, DATA_DESC_ID,
+// STATE_ID, OBSERVATION_ID, ARRAY_ID and TIME. In the usual MS ordering
+// they contain long runs of equal values, so they are read in a single
+// pass and cached run-length encoded, which is usually orders of magnitude
+// smaller than the columns themselves. A column that does not compress
+// well is not kept and read again when needed. The run-length summary can
+// be stored in the MS directory for use by later MSMetaData objects (see
+// <src>setPersistentSummary</src>).
 // Parallel processing is enabled using openmp.
 // </summary>
 
@@ -660,6 +668,26 @@ public:
 
     void setShowProgress(Bool b) { _showProgress = b; }
 
+    // If True, the run-length summary of the main table columns (see the
+    // class description) is stored in a file in the MS directory, which is
+    // used by later MSMetaData objects if its number of rows and modify
+    // counter match those of the MS. It is only done for an entire MS
+    // opened readonly, because otherwise unflushed changes could make the
+    // summary stale. It has to be set before the first query.
+    void setPersistentSummary(Bool b) { _persistSummary = b; }
+
+    // Tell if a persistent run-length summary has been stored for the MS
+    // and can be used for it.
+    static Bool hasPersistentSummary(const MeasurementSet& ms);
+
+    // Get the first row of each run of rows having equal values in all the
+    // given main table columns using the run-length summary.
+    // It returns False if a column is not in the summary.
+    Bool getRunStarts(
+        Vector<rownr_t>& starts,
+        const vector<MSMainEnums::PredefinedColumns>& columns
+    ) const;
+
     // get statistics related to the values of the INTERVAL column. Returned
     // values are in seconds. All values in this column are used in the computation,
     // including those which associated row flags may be set. 
@@ -752,6 +780,13 @@ private:
         std::shared_ptr<vector<String> > transition;
     };
 
+    // A main table column stored as runs of equal values.
+    template <class T> struct _ColumnRuns {
+        Vector<T> values;
+        // The row number just after the end of each run.
+        Vector<rownr_t> ends;
+    };
+
     // The general pattern is that a mutable gets set only once, on demand, when its
     // setter is called for the first time. If this pattern is broken, defective behavior
     // will occur.
@@ -814,6 +849,13 @@ private:
     const vector<const Table*> _taqlTempTable;
 
     mutable Bool _spwInfoStored, _forceSubScanPropsToCache;
+
+    // The run-length summary of the main table columns. A column not
+    // compressing well is not present.
+    mutable std::map<Int, _ColumnRuns<Int> > _intColumnRuns;
+    mutable std::map<Int, _ColumnRuns<Double> > _doubleColumnRuns;
+    mutable Bool _columnRunsDone;
+    Bool _persistSummary;
     vector<std::map<Int, Quantity> > _firstExposureTimeMap;
     mutable vector<Int> _numCorrs, _source_sourceIDs, _field_sourceIDs;
 
@@ -1181,6 +1223,41 @@ private:
         MSMainEnums::PredefinedColumns col
     ) const;
 
+    // Get the column from the run-length summary, which is built if
+    // not done yet. False is returned if the column is not in the summary.
+    // <group>
+    template <class T> Bool _getColumnFromRuns(
+        MSMainEnums::PredefinedColumns, Vector<T>&
+    ) const { return False; }
+
+    Bool _getColumnFromRuns(
+        MSMainEnums::PredefinedColumns col, Vector<Int>& v
+    ) const;
+
+    Bool _getColumnFromRuns(
+        MSMainEnums::PredefinedColumns col, Vector<Double>& v
+    ) const;
+    // </group>
+
+    // Build the run-length summary of the main table columns in a single
+    // pass, or read it from the persistent file if possible.
+    void _buildColumnRuns() const;
+
+    // Can the persistent summary be used for this MS?
+    Bool _canPersistSummary() const;
+
+    // Read or write the persistent summary file.
+    // <group>
+    Bool _readColumnRuns() const;
+
+    void _writeColumnRuns() const;
+    // </group>
+
+    // Expand the runs to the full column.
+    template <class T> static void _expandRuns(
+        Vector<T>& v, const _ColumnRuns<T>& runs, rownr_t nrow
+    );
+
     std::shared_ptr<vector<int>> _almaReceiverBands(uint nspw) const;
 
 };
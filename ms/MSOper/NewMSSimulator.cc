@@ -1443,12 +1443,6 @@ void NewMSSimulator::observe(const Vector<String>& sourceNames,
     //    os << "Written " << thisChunk/(1024.0*1024.0) << " Mbytes to scratch columns" << LogIO::DEBUG1;
   }
 
-  Matrix<Complex> data(nCorr,nChan); 
-  data.set(Complex(0.0));
-
-  Matrix<Bool> flag(nCorr,nChan); 
-  flag=False;
-
   os << "Calculating a total of " << nIntegrations << " integrations" << endl 
      << LogIO::POST;
 
@@ -1614,36 +1608,23 @@ void NewMSSimulator::observe(const Vector<String>& sourceNames,
       Matrix<Double> antUVW(3,nAnt);	      
       calcAntUVW(ep, feed_phc, antUVW);
 
-   
+
+      // Calculate the baselines of this integration in memory, so they
+      // can be written in bulk below.
+      Vector<Int> ant1s(nBaselines), ant2s(nBaselines);
+      Matrix<Double> uvws(3, nBaselines);
+      Vector<Float> wts(nBaselines), sigmas(nBaselines);
+      Int nbl=0;
       for(Int ant1=0; ant1<nAnt; ant1++) {
-	Double x1=antUVW(0,ant1), y1=antUVW(1,ant1), z1=antUVW(2,ant1);
 	Int startAnt2=ant1+1;
 	if(autoCorrelationWt_p>0.0) startAnt2=ant1;
 	for (Int ant2=startAnt2; ant2<nAnt; ant2++) {
-	  row++; 
-	  
-	  msc.antenna1().put(row,ant1);
-	  msc.antenna2().put(row,ant2);
-	  msc.feed1().put(row,feed);
-	  msc.feed2().put(row,feed);
-	  
-	  Double x2=antUVW(0,ant2), y2=antUVW(1,ant2), z2=antUVW(2,ant2);
-	  Vector<Double> uvwvec(3);
-	  uvwvec(0) = x2-x1;
-	  uvwvec(1) = y2-y1;
-	  uvwvec(2) = z2-z1;
-	  msc.uvw().put(row,uvwvec);
-	  
-	  data.set(Complex(0.,0.));
-	  msc.data().put(row,data);		  
-	  msc.data().put(row,data);		  
-	  msc.flag().put(row,flag);
-	  msc.flagRow().put(row,False);
-	  
-	  msc.correctedData().setShape(row, data.shape());
-	  msc.correctedData().put(row,data);
-	  msc.modelData().setShape(row,data.shape());
-	  msc.modelData().put(row, data);
+	  ant1s(nbl) = ant1;
+	  ant2s(nbl) = ant2;
+	  Vector<Double> uvwvec(uvws.column(nbl));
+	  uvwvec(0) = antUVW(0,ant2) - antUVW(0,ant1);
+	  uvwvec(1) = antUVW(1,ant2) - antUVW(1,ant1);
+	  uvwvec(2) = antUVW(2,ant2) - antUVW(2,ant1);
 	  
 	  if (ant1 != ant2) {
 	    blockage(fractionBlocked1, fractionBlocked2,
@@ -1662,35 +1643,12 @@ void NewMSSimulator::observe(const Vector<String>& sourceNames,
 	  if  (ant1 == ant2 ) {
 	    wt *= autoCorrelationWt_p;
 	  }		  
-	  Vector<Float> tmp(nCorr); tmp=wt;
-	  msc.weight().put(row, tmp);
-	  tmp=sigma1;
-	  msc.sigma().put(row,tmp);
+	  wts(nbl) = wt;
+	  sigmas(nbl) = sigma1;
+	  nbl++;
 	}
       }
     
-    
-    // go back and flag weights based on shadowing
-    // Future option: we could increase sigma based on
-    // fraction shadowed.
-    Matrix<Bool> trueFlag(nCorr,nChan); 
-    trueFlag=True;
-
-    Int64 reRow = startingRow;
-    for (Int ant1=0; ant1<nAnt; ant1++) {
-	Int startAnt2=ant1+1;
-	if(autoCorrelationWt_p>0.0) startAnt2=ant1;
-	for (Int ant2=startAnt2; ant2<nAnt; ant2++) {
-	  reRow++; 
-	  if ( isShadowed(ant1) || isShadowed(ant2) ) {
-	    msc.flag().put(reRow,trueFlag);
-	    msc.flagRow().put(reRow, True);
-	    nShadowed++;
-	  }
-	}
-    }
-    
-    
     // Find antennas pointing below the elevation limit
     Vector<Double> azel(2);
     for (Int ant1=0; ant1<nAnt; ant1++) {
@@ -1714,20 +1672,57 @@ void NewMSSimulator::observe(const Vector<String>& sourceNames,
 	}
     }    
 
-    // Now flag all antennas pointing below the elevation limit
-    reRow = startingRow;    
-    for (Int ant1=0; ant1<nAnt; ant1++) {
-	Int startAnt2=ant1+1;
-	if(autoCorrelationWt_p>0.0) startAnt2=ant1;
-	for (Int ant2=startAnt2; ant2<nAnt; ant2++) {
-	  reRow++; 
-	  if ( isTooLow(ant1) || isTooLow(ant2) ) {
-	    msc.flag().put(reRow,trueFlag);
-	    msc.flagRow().put(reRow, True);
-	    nSubElevation++;
-	  }
-	}
-    }    
+    // Flag the baselines with a shadowed antenna or an antenna pointing
+    // below the elevation limit.
+    // Future option: we could increase sigma based on
+    // fraction shadowed.
+    Vector<Bool> flagRows(nBaselines, False);
+    for (Int i=0; i<nBaselines; i++) {
+      if ( isShadowed(ant1s(i)) || isShadowed(ant2s(i)) ) {
+	flagRows(i) = True;
+	nShadowed++;
+      }
+      if ( isTooLow(ant1s(i)) || isTooLow(ant2s(i)) ) {
+	flagRows(i) = True;
+	nSubElevation++;
+      }
+    }
+
+    // Write the rows in blocks of about a million visibilities, so the
+    // columns are accessed once per block instead of once per row.
+    Int blockSize = max(1, 1048576 / (nCorr*nChan));
+    for (Int first=0; first<nBaselines; first+=blockSize) {
+      Int n = min(blockSize, nBaselines-first);
+      Slicer rowRange(IPosition(1, startingRow+1+first), IPosition(1, n));
+      Slicer blRange(IPosition(1, first), IPosition(1, n));
+      Vector<Int> feeds(n, feed);
+      msc.antenna1().putColumnRange(rowRange, ant1s(blRange));
+      msc.antenna2().putColumnRange(rowRange, ant2s(blRange));
+      msc.feed1().putColumnRange(rowRange, feeds);
+      msc.feed2().putColumnRange(rowRange, feeds);
+      msc.uvw().putColumnRange(rowRange,
+			       uvws(IPosition(2, 0, first),
+				    IPosition(2, 2, first+n-1)));
+      Cube<Complex> data(nCorr, nChan, n, Complex(0.,0.));
+      msc.data().putColumnRange(rowRange, data);
+      msc.correctedData().putColumnRange(rowRange, data);
+      msc.modelData().putColumnRange(rowRange, data);
+      Vector<Bool> flagRow(flagRows(blRange));
+      Cube<Bool> flag(nCorr, nChan, n);
+      for (Int i=0; i<n; i++) {
+	flag.xyPlane(i) = flagRow(i);
+      }
+      msc.flag().putColumnRange(rowRange, flag);
+      msc.flagRow().putColumnRange(rowRange, flagRow);
+      Matrix<Float> wt(nCorr, n), sigma(nCorr, n);
+      for (Int i=0; i<n; i++) {
+	wt.column(i) = wts(first+i);
+	sigma.column(i) = sigmas(first+i);
+      }
+      msc.weight().putColumnRange(rowRange, wt);
+      msc.sigma().putColumnRange(rowRange, sigma);
+    }
+    row += nBaselines;
     
     // this is all still inside the single integration loop
     Int64 numpointrows=nAnt;
@@ -1844,13 +1839,15 @@ String NewMSSimulator::formatTime(const Double time) {
 Bool NewMSSimulator::calcAntUVW(MEpoch& epoch, MDirection& refdir, 
 				      Matrix<Double>& uvwAnt){
 
-  MSColumns msc(*ms_p);
+  // Only the ANTENNA columns are needed; creating an MSColumns object for
+  // every integration is expensive.
+  MSAntennaColumns antc(ms_p->antenna());
  // Lets define a Measframe with the telescope nominal position
   MPosition obsPos;
   if(!MeasTable::Observatory(obsPos, telescope_p)){
     //not a known observatory then lets use antenna(0) position...as ref pos
     //does not matter really as the difference will make the baseline
-    obsPos=msc.antenna().positionMeas()(0);    
+    obsPos=antc.positionMeas()(0);    
   }
 
   MVPosition basePos=obsPos.getValue();
@@ -1866,12 +1863,12 @@ Bool NewMSSimulator::calcAntUVW(MEpoch& epoch, MDirection& refdir,
   if(refdir.getRef().getType() != MDirection::J2000)
     throw(AipsError("Ref direction is not in  J2000 "));
 
-  Int nAnt=msc.antenna().nrow();
+  Int nAnt=antc.nrow();
   uvwAnt.resize(3,nAnt);
   MBaseline::Convert elconv(basMeas, MBaseline::Ref(MBaseline::J2000));
   Muvw::Convert uvwconv(Muvw(), Muvw::Ref(Muvw::J2000, measFrame));
   for(Int k=0; k< nAnt; ++k){
-    MPosition antpos=msc.antenna().positionMeas()(k);
+    MPosition antpos=antc.positionMeas()(k);
  
     MVBaseline mvblA(obsPos.getValue(), antpos.getValue());
     basMeas.set(mvblA, basref);
@@ -62,6 +62,11 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/ms/MeasurementSets/MSColumns.h>
+#include <casacore/ms/MSOper/MSMetaData.h>
+#include <casacore/tables/TaQL/ExprDerNode.h>
+#include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/tables/TaQL/TableExprId.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
   
@@ -891,8 +896,64 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       throw(MSSelectionError("MSSelection::getSelectedMS() called without setting the parent MS.\n"
   			     "Hint: Need to use MSSelection::resetMS() perhaps?"));
     //    return baseGetSelectedMS_p(selectedMS, *ms_p, fullTEN_p, outMSName);
+    Vector<rownr_t> rows;
+    if (selectFromSummary(rows, *ms_p, fullTEN_p))
+      {
+	Table& selectedTab = selectedMS;
+	selectedTab = (*ms_p)(rows);
+	if (selectedTab.nrow() == 0)
+	  throw(MSSelectionNullSelection("MSSelectionNullSelection : The selected table has zero rows."));
+	if (outMSName!="") selectedTab.rename(outMSName,Table::New);
+	selectedTab.flush();
+	return True;
+      }
     return getSelectedTable(selectedMS, *ms_p, fullTEN_p, outMSName);
   }
+
+  //----------------------------------------------------------------------------
+  Bool MSSelection::selectFromSummary(Vector<rownr_t>& rows,
+				      const MeasurementSet& ms,
+				      const TableExprNode& ten)
+  {
+    if (ten.isNull() || !MSMetaData::hasPersistentSummary(ms))
+      return False;
+    // Random numbers and user defined functions can differ per row.
+    TableExprNodeRep* rep = ten.getRep().get();
+    if (!TableExprNodeUtil::isParallelSafe(rep)) return False;
+    // All columns used must be main table columns in the summary.
+    std::vector<TableExprNodeRep*> colNodes =
+      TableExprNodeUtil::getColumnNodes(rep);
+    if (colNodes.empty()) return False;
+    vector<MSMainEnums::PredefinedColumns> columns;
+    for (TableExprNodeRep* node : colNodes)
+      {
+	const TableExprNodeColumn* colNode =
+	  dynamic_cast<const TableExprNodeColumn*>(node);
+	if (colNode == 0 ||
+	    colNode->getTableInfo().table().tableName() != ms.tableName())
+	  return False;
+	columns.push_back(MS::columnType(colNode->getColumn().columnDesc().name()));
+      }
+    MSMetaData md(&ms, 1000);
+    md.setPersistentSummary(True);
+    Vector<rownr_t> starts;
+    if (!md.getRunStarts(starts, columns)) return False;
+    // The TEN has the same value for all rows in a run.
+    std::vector<rownr_t> selected;
+    rownr_t nrow = ms.nrow();
+    Bool value;
+    for (size_t i=0; i<starts.nelements(); i++)
+      {
+	ten.get(TableExprId(starts[i]), value);
+	if (value)
+	  {
+	    rownr_t end = (i+1 < starts.nelements() ? starts[i+1] : nrow);
+	    for (rownr_t row=starts[i]; row<end; row++) selected.push_back(row);
+	  }
+      }
+    rows = Vector<rownr_t>(selected);
+    return True;
+  }
   
   //----------------------------------------------------------------------------
   
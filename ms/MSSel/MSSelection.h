@@ -84,6 +84,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // TENs from sub-expressions are finally ANDed and the resultant TEN
 // is used to select the rows of the MS table.
 //
+// If a persistent run-length summary of the main table exists (see
+// <linkto class=MSMetaData>MSMetaData::setPersistentSummary</linkto>) and
+// the TEN only uses columns kept in it (e.g. for field, spw, scan,
+// observation, array, state and time selections), getSelectedMS evaluates
+// the TEN only for the first row of each run of rows having equal values
+// in those columns. So selecting a scan in a large time-ordered MS does
+// not read the entire SCAN_NUMBER column. Otherwise (e.g. for a uvdist or
+// antenna selection) the TEN is evaluated for every row.
+//
 // </synopsis>
 //
 // <example>
@@ -599,6 +608,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     
     // Check if record field exists and is not unset
     Bool definedAndSet(const Record& inpRec, const String& fieldName);
+
+    // Get the rows selected by the TEN using the persistent run-length
+    // summary of the main table of the MS. It returns False if there is no
+    // summary or if the TEN uses columns not kept in it.
+    static Bool selectFromSummary(Vector<rownr_t>& rows,
+                                  const MeasurementSet& ms,
+                                  const TableExprNode& ten);
     
     // Convert an MS select string to TaQL
     //   const String msToTaQL(const String& msSelect) {};
@@ -37,13 +37,14 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/BasicMath/Math.h>
+#include <algorithm>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 MSTableIndex::MSTableIndex()
     : timeVals_p(0), intervalVals_p(0), key_p(0), time_p(0.0), interval_p(0.0),
       lastTime_p(0.0), lastInterval_p(0.0), lastNearest_p(0), nearestFound_p(False), 
-      nearestReady_p(False), nrows_p(0), hasChanged_p(True), index_p(0), 
+      nearestReady_p(False), nrows_p(0), hasChanged_p(True), index_p(0),
       hasTime_p(False), hasInterval_p(False)
 {;}
 
@@ -52,7 +53,7 @@ MSTableIndex::MSTableIndex(const Table &subTable,
                            ColumnsIndex::Compare* compareFunction)
     : timeVals_p(0), intervalVals_p(0), key_p(0), time_p(0.0), interval_p(0.0),
       lastTime_p(0.0), lastInterval_p(0.0), lastNearest_p(0), nearestFound_p(False), 
-      nearestReady_p(False), nrows_p(0), hasChanged_p(True), index_p(0), 
+      nearestReady_p(False), nrows_p(0), hasChanged_p(True), index_p(0),
       hasTime_p(False), hasInterval_p(False)
 {
     attach(subTable, indexCols, compareFunction);
@@ -61,7 +62,7 @@ MSTableIndex::MSTableIndex(const Table &subTable,
 MSTableIndex::MSTableIndex(const MSTableIndex &other)
     : timeVals_p(0), intervalVals_p(0), key_p(0), time_p(0.0), interval_p(0.0),
       lastTime_p(0.0), lastInterval_p(0.0), lastNearest_p(0), nearestFound_p(False), 
-      nearestReady_p(False), nrows_p(0), hasChanged_p(True), index_p(0), 
+      nearestReady_p(False), nrows_p(0), hasChanged_p(True), index_p(0),
       hasTime_p(False), hasInterval_p(False)
 {
     *this = other;
@@ -105,6 +106,8 @@ MSTableIndex &MSTableIndex::operator=(const MSTableIndex &other)
 	    lastTime_p = other.lastTime_p;
 	    lastInterval_p = other.lastInterval_p;
 	    lastSearch_p = other.lastSearch_p;
+	    lastSorted_p = other.lastSorted_p;
+	    searchCache_p = other.searchCache_p;
 	    lastNearest_p = other.lastNearest_p;
 	    nearestFound_p = other.nearestFound_p;
 	    nearestReady_p = other.nearestReady_p;
@@ -129,17 +132,12 @@ void MSTableIndex::attach(const Table &subTable,
 
     if (hasTime_p) {
 	timeColumn_p.attach(tab_p, "TIME");
-	// fish out the values
-	timeVec_p = timeColumn_p.getColumn();
-	timeVals_p = timeVec_p.getStorage(deleteItTime_p);
-
 	// interval requires a TIME
 	if (hasInterval_p) {
 	    intervalColumn_p.attach(tab_p, "INTERVAL");
-	    // fish out the values
-	    intervalVec_p = intervalColumn_p.getColumn();
-	    intervalVals_p = intervalVec_p.getStorage(deleteItInterval_p);
 	}
+	// fish out the values
+	readTimes();
     }
 
     if (indexCols.nelements() > 0) {    
@@ -167,6 +165,18 @@ void MSTableIndex::setChanged()
     if (index_p) index_p->setChanged();
 }
 
+void MSTableIndex::readTimes()
+{
+    if (hasTime_p) {
+	timeVec_p.reference(timeColumn_p.getColumn());
+	timeVals_p = timeVec_p.getStorage(deleteItTime_p);
+	if (hasInterval_p) {
+	    intervalVec_p.reference(intervalColumn_p.getColumn());
+	    intervalVals_p = intervalVec_p.getStorage(deleteItInterval_p);
+	}
+    }
+}
+
 RowNumbers MSTableIndex::getRowNumbers()
 {
     getInternals();
@@ -211,6 +221,48 @@ Int64 MSTableIndex::getNearestRow(Bool &found)
     return lastNearest_p;
 }
 
+Vector<Int64> MSTableIndex::getNearestRows(const Vector<Double> &times,
+                                           Vector<Bool> &found)
+{
+    Vector<Int64> rows(times.nelements());
+    found.resize(times.nelements());
+    for (uInt i=0; i<times.nelements(); i++) {
+	// only the time changes, so the cached search is used
+	time_p = times(i);
+	Bool thisFound;
+	rows(i) = getNearestRow(thisFound);
+	found(i) = thisFound;
+    }
+    return rows;
+}
+
+Bool MSTableIndex::getBracketingRows(Int64 &row1, Int64 &row2,
+                                     Double &fraction)
+{
+    getInternals();
+    uInt nElem = lastSorted_p.nelements();
+    if (!hasTime_p || nElem == 0) {
+	return False;
+    }
+    const rownr_t *rowPtr = lastSorted_p.data();
+    const Double *times = timeVals_p;
+    // find the first row with a time after the search time
+    uInt elem = std::upper_bound(rowPtr, rowPtr+nElem, time_p,
+				 [times](Double t, rownr_t row)
+				 { return t < times[row]; }) - rowPtr;
+    fraction = 0.0;
+    if (elem == 0) {
+	row1 = row2 = rowPtr[0];
+    } else if (elem == nElem) {
+	row1 = row2 = rowPtr[nElem-1];
+    } else {
+	row1 = rowPtr[elem-1];
+	row2 = rowPtr[elem];
+	fraction = (time_p - times[row1]) / (times[row2] - times[row1]);
+    }
+    return True;
+}
+
 void MSTableIndex::nearestTime()
 {
     // this is only called when we know it is a strict time search and there
@@ -219,11 +271,15 @@ void MSTableIndex::nearestTime()
     Int thisElem = 0;
     Int nElem = lastSearch_p.nelements();
     Bool deleteIt;
-    const rownr_t *rowPtr = lastSearch_p.getStorage(deleteIt);
-    while (!nearestFound_p && thisElem < nElem) {
-	rownr_t thisRow = rowPtr[thisElem];
-	// needs column unit conversion here to seconds
-	nearestFound_p = time_p < timeVals_p[thisRow];
+    // use the rows in time order and do a binary search for the
+    // first row with a time after the search time
+    const rownr_t *rowPtr = lastSorted_p.getStorage(deleteIt);
+    const Double *times = timeVals_p;
+    thisElem = std::upper_bound(rowPtr, rowPtr+nElem, time_p,
+				[times](Double t, rownr_t row)
+				{ return t < times[row]; }) - rowPtr;
+    if (thisElem < nElem) {
+	nearestFound_p = True;
 	thisElem++;
     }
     if (nearestFound_p) {
@@ -302,7 +358,7 @@ void MSTableIndex::nearestTime()
 	}
     }
 	    
-    lastSearch_p.freeStorage(rowPtr, deleteIt);
+    lastSorted_p.freeStorage(rowPtr, deleteIt);
 }
 
 void MSTableIndex::makeKeys()
@@ -336,6 +392,8 @@ void MSTableIndex::clear()
     hasChanged_p = True;
 
     lastSearch_p.resize(0);
+    lastSorted_p.resize(0);
+    searchCache_p.clear();
 
     lastNearest_p = 0;
     lastKeys_p.resize(0);
@@ -350,21 +408,52 @@ void MSTableIndex::getInternals()
     if (!isNull() && (hasChanged_p ||
 	tab_p.nrow() != nrows_p ||
 	keysChanged())) {
+	if (hasChanged_p || tab_p.nrow() != nrows_p) {
+	    // the cached searches are invalid and the times may have changed
+	    searchCache_p.clear();
+	    readTimes();
+	}
 	nrows_p = tab_p.nrow();
-	if (index_p) {
+	if (index_p || hasTime_p) {
 	    uInt nkeys = intKeys_p.nelements();
+	    std::vector<Int> keys(nkeys);
 	    lastKeys_p.resize(nkeys);
 	    for (uInt i=0;i<nkeys;i++) {
-		Int thisKey = *(intKeys_p[i]);
-		*(indexKeys_p[i]) = thisKey;
-		lastKeys_p(i) = thisKey;
+		keys[i] = *(intKeys_p[i]);
+		lastKeys_p(i) = keys[i];
+	    }
+	    // only search if these keys have not been searched before
+	    auto iter = searchCache_p.find(keys);
+	    if (iter == searchCache_p.end()) {
+		CachedSearch search;
+		if (index_p) {
+		    for (uInt i=0;i<nkeys;i++) {
+			*(indexKeys_p[i]) = keys[i];
+		    }
+		    search.rows = index_p->getRowNumbers();
+		} else {
+		    // all rows match at this point
+		    search.rows.resize(nrows_p);
+		    indgen(search.rows);
+		}
+		// keep the rows in time order as well
+		const Double *times = timeVals_p;
+		auto timeLess = [times](rownr_t r1, rownr_t r2)
+		    { return times[r1] < times[r2]; };
+		rownr_t nr = search.rows.nelements();
+		if (!hasTime_p  ||
+		    std::is_sorted(search.rows.data(), search.rows.data() + nr,
+				   timeLess)) {
+		    search.sorted.reference(search.rows);
+		} else {
+		    search.sorted.reference(search.rows.copy());
+		    std::stable_sort(search.sorted.data(),
+				     search.sorted.data() + nr, timeLess);
+		}
+		iter = searchCache_p.insert(std::make_pair(keys, search)).first;
 	    }
-	    lastSearch_p.resize(0);
-	    lastSearch_p = index_p->getRowNumbers();
-	} else if (hasTime_p) {
-	    // all rows match at this point
-	    lastSearch_p.resize(nrows_p);
-	    indgen(lastSearch_p);
+	    lastSearch_p.reference(iter->second.rows);
+	    lastSorted_p.reference(iter->second.sorted);
 	} // nothing can match, lastSearch_p should already have zero elements
 	lastTime_p = time_p;
 	lastInterval_p = interval_p;
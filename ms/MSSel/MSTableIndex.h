@@ -33,6 +33,8 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/Tables/ColumnsIndex.h>
+#include <map>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -58,12 +60,23 @@ class String;
 // </etymology>
 //
 // <synopsis>
+// MSTableIndex finds the rows in a MeasurementSet subtable (e.g. SYSCAL,
+// WEATHER, FEED, POINTING) matching a set of integer keys (like ANTENNA_ID)
+// and a time and interval.
+// <br>The rows matching a set of keys are looked up once and kept (in time
+// order) until the table changes, so a change of the time or of the keys
+// to a combination used before does not require another lookup. The
+// nearest row in time is found using a binary search.
+// Functions <src>getNearestRows</src> and <src>getBracketingRows</src> can
+// be used for batch lookups and for interpolation in time.
 // </synopsis>
 //
 // <example>
 // </example>
 //
 // <motivation>
+// Lookups of, say, the pointing per antenna for each visibility row
+// need to be fast.
 // </motivation>
 //
 // <thrown>
@@ -124,6 +137,21 @@ public:
     // center of the interval (time()).  This also has the same problem as the previous function.
     virtual Int64 getNearestRow(Bool &found);
 
+    // get the nearest row (as getNearestRow) for each of the given times,
+    // using the current integer keys and interval. The time() is left at
+    // the last time given. <src>found</src> tells per time if a row was found.
+    virtual Vector<Int64> getNearestRows(const Vector<Double> &times,
+                                         Vector<Bool> &found);
+
+    // get the rows matching the integer keys with the last time before or
+    // at time() and the first time after time(), which can be used to
+    // interpolate in time. <src>fraction</src> is the fractional distance
+    // of time() between the times of both rows.
+    // If time() is outside the time range, both rows are the first or last
+    // row and fraction is 0.
+    // False is returned if no rows match or if there is no TIME column.
+    virtual Bool getBracketingRows(Int64 &row1, Int64 &row2, Double &fraction);
+
     // is this attached to a null table
     virtual Bool isNull() { return tab_p.isNull();}
 
@@ -150,6 +178,15 @@ private:
 
     // last search result - matching integer keys
     RowNumbers lastSearch_p;
+    // last search result in time order
+    Vector<rownr_t> lastSorted_p;
+
+    // the search results per set of integer keys
+    struct CachedSearch {
+        RowNumbers rows;
+        Vector<rownr_t> sorted;
+    };
+    std::map<std::vector<Int>, CachedSearch> searchCache_p;
 
     // last nearest
     Int64 lastNearest_p;
@@ -165,6 +202,7 @@ private:
     Bool hasTime_p, hasInterval_p;
 
     void clear();
+    void readTimes();
     void makeKeys();
     Bool keysChanged();
     void getInternals();
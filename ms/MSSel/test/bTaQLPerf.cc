@@ -0,0 +1,408 @@
+//# bTaQLPerf.cc: Benchmark the TaQL query engine and MSSelection
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/ms/MeasurementSets/MeasurementSet.h>
+#include <casacore/ms/MeasurementSets/MSColumns.h>
+#include <casacore/ms/MSSel/MSSelection.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableUtil.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/measures/Measures/Stokes.h>
+#include <casacore/casa/Quanta/MVTime.h>
+#include <casacore/casa/OS/Benchmark.h>
+#include <casacore/casa/OS/ProfileRegistry.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace casacore;
+using namespace std;
+
+// This program benchmarks a standard set of TaQL queries (selections,
+// GROUPBY aggregates, joins, array reductions, UDF calls) and MSSelection
+// expressions on a synthetic MeasurementSet of configurable size.
+// Besides the total time, the time spent in each phase of a TaQL command
+// (parse, where, groupby, having, orderby, projection, distinct) is reported
+// as a counter (in microseconds per query), taken from the TaQL profile
+// counters in ProfileRegistry. The remaining time of the command (mainly
+// the analysis of the parse tree and the planning of the query) is
+// reported as counter 'plan_us'.
+// Benchmarks using UDFs (e.g., derivedmscal) are skipped if the UDF library
+// cannot be loaded.
+//
+// It is built by 'make bench'. Run it as:
+//    bTaQLPerf [ntime [nant [nchan]]] [benchmark options]
+// E.g., to compare two releases (using Google Benchmark's compare.py):
+//    bTaQLPerf --benchmark_out=new.json
+//    compare.py benchmarks old.json new.json
+
+const String msName ("bTaQLPerf_tmp.ms");
+const uInt npol   = 4;
+const uInt nspw   = 2;
+const uInt nfield = 2;
+uInt ntime = 100;
+uInt nant  = 16;
+uInt nchan = 32;
+const Double startTime = 4.5e9;
+const Double interval  = 10.;
+
+uInt nbaseline()
+  { return nant*(nant-1)/2; }
+
+uInt64 nrow()
+  { return uInt64(ntime) * nbaseline(); }
+
+// Create the synthetic MS with the subtables needed by the queries
+// and MSSelection.
+void makeMS()
+{
+  TableDesc td (MS::requiredTableDesc());
+  MS::addColumnToDesc (td, MS::DATA, 2);
+  SetupNewTable newtab(msName, td, Table::New);
+  MeasurementSet ms(newtab, nrow());
+  ms.createDefaultSubtables (Table::New);
+  MSColumns mscols(ms);
+  // Fill the main table column-wise.
+  Vector<Double> times(nrow());
+  Vector<Int> ant1(nrow()), ant2(nrow()), field(nrow()), dd(nrow()),
+    scan(nrow());
+  Matrix<Double> uvw(3, nrow());
+  uInt64 row = 0;
+  for (uInt t=0; t<ntime; ++t) {
+    for (uInt a1=0; a1<nant; ++a1) {
+      for (uInt a2=a1+1; a2<nant; ++a2) {
+        times[row] = startTime + interval*(t+0.5);
+        ant1[row]  = a1;
+        ant2[row]  = a2;
+        // Alternate field and spectral window every 10 time slots.
+        field[row] = (t/10) % nfield;
+        dd[row]    = (t/10) % nspw;
+        scan[row]  = t/10 + 1;
+        uvw(0,row) = 10. * (a2 - a1);
+        uvw(1,row) = 5. * (a1 + a2);
+        uvw(2,row) = 0.1 * t;
+        ++row;
+      }
+    }
+  }
+  mscols.time().putColumn (times);
+  mscols.timeCentroid().putColumn (times);
+  mscols.interval().putColumn (Vector<Double>(nrow(), interval));
+  mscols.exposure().putColumn (Vector<Double>(nrow(), interval));
+  mscols.antenna1().putColumn (ant1);
+  mscols.antenna2().putColumn (ant2);
+  mscols.fieldId().putColumn (field);
+  mscols.dataDescId().putColumn (dd);
+  mscols.scanNumber().putColumn (scan);
+  mscols.uvw().putColumn (uvw);
+  // Fill the data and flags in chunks of a time slot.
+  uInt nbl = nbaseline();
+  Cube<Complex> data(npol, nchan, nbl);
+  Cube<Bool> flag(npol, nchan, nbl);
+  for (uInt t=0; t<ntime; ++t) {
+    for (uInt i=0; i<data.size(); ++i) {
+      data.data()[i] = Complex((i+t)%13, Float((i+3*t)%7) - 3);
+      flag.data()[i] = ((i+t) % 17 == 0);
+    }
+    RefRows rows(uInt64(t)*nbl, uInt64(t+1)*nbl - 1);
+    mscols.data().putColumnCells (rows, data);
+    mscols.flag().putColumnCells (rows, flag);
+  }
+  // Fill the subtables.
+  ms.antenna().addRow (nant);
+  MSAntennaColumns antcols(ms.antenna());
+  Vector<Double> pos(3);
+  for (uInt i=0; i<nant; ++i) {
+    antcols.name().put (i, "ANT" + String::toString(100+i).from(1));
+    antcols.station().put (i, "ST" + String::toString(i));
+    antcols.mount().put (i, "alt-az");
+    pos[0] = 3826577. + 100.*i;
+    pos[1] = 461022.  - 50.*i;
+    pos[2] = 5064892. + 20.*i;
+    antcols.position().put (i, pos);
+    antcols.dishDiameter().put (i, 25.);
+  }
+  ms.field().addRow (nfield);
+  MSFieldColumns fieldcols(ms.field());
+  Matrix<Double> dir(2,1);
+  for (uInt i=0; i<nfield; ++i) {
+    dir(0,0) = 1.1 + 0.5*i;
+    dir(1,0) = 0.8 - 0.3*i;
+    fieldcols.name().put (i, "FIELD" + String::toString(i));
+    fieldcols.delayDir().put (i, dir);
+    fieldcols.phaseDir().put (i, dir);
+    fieldcols.referenceDir().put (i, dir);
+    fieldcols.sourceId().put (i, i);
+    fieldcols.time().put (i, startTime);
+  }
+  ms.spectralWindow().addRow (nspw);
+  ms.dataDescription().addRow (nspw);
+  MSSpWindowColumns spwcols(ms.spectralWindow());
+  MSDataDescColumns ddcols(ms.dataDescription());
+  Vector<Double> freqs(nchan);
+  for (uInt i=0; i<nspw; ++i) {
+    indgen (freqs, 1e8 + 1e7*i, 1e5);
+    spwcols.numChan().put (i, nchan);
+    spwcols.chanFreq().put (i, freqs);
+    spwcols.chanWidth().put (i, Vector<Double>(nchan, 1e5));
+    spwcols.effectiveBW().put (i, Vector<Double>(nchan, 1e5));
+    spwcols.resolution().put (i, Vector<Double>(nchan, 1e5));
+    spwcols.refFrequency().put (i, freqs[0]);
+    spwcols.totalBandwidth().put (i, nchan*1e5);
+    spwcols.name().put (i, "SPW" + String::toString(i));
+    ddcols.spectralWindowId().put (i, i);
+    ddcols.polarizationId().put (i, 0);
+  }
+  ms.polarization().addRow (1);
+  MSPolarizationColumns polcols(ms.polarization());
+  Vector<Int> corrTypes(npol);
+  for (uInt i=0; i<npol; ++i) {
+    corrTypes[i] = Stokes::XX + i;
+  }
+  polcols.numCorr().put (0, npol);
+  polcols.corrType().put (0, corrTypes);
+  ms.observation().addRow (1);
+  MSObservationColumns obscols(ms.observation());
+  obscols.telescopeName().put (0, "WSRT");
+  Vector<Double> timeRange(2);
+  timeRange[0] = startTime;
+  timeRange[1] = startTime + ntime*interval;
+  obscols.timeRange().put (0, timeRange);
+}
+
+
+// The TaQL phases having a profile counter.
+const char* phases[] = {"parse", "where", "groupby", "having",
+                        "orderby", "projection", "distinct"};
+const uInt nphase = sizeof(phases) / sizeof(phases[0]);
+
+// Take a snapshot of the TaQL profile counters, so the time spent in
+// each phase of a query can be derived.
+struct PhaseTimes
+{
+  PhaseTimes()
+  {
+    command = ProfileRegistry::counter("TaQL.command").seconds();
+    for (uInt i=0; i<nphase; ++i) {
+      const ProfileCounter& counter =
+        ProfileRegistry::counter (String("TaQL.") + phases[i]);
+      count[i] = counter.count();
+      time[i]  = counter.seconds();
+    }
+  }
+
+  // Add the time spent in each phase since the other snapshot
+  // as counters (in usec).
+  void addCounters (const PhaseTimes& before, BenchmarkState& state) const
+  {
+    Double rest = command - before.command;
+    for (uInt i=0; i<nphase; ++i) {
+      if (count[i] > before.count[i]) {
+        Double t = time[i] - before.time[i];
+        state.addCounter (String(phases[i]) + "_us", 1e6*t);
+        rest -= t;
+      }
+    }
+    state.addCounter ("plan_us", 1e6 * std::max(0., rest));
+  }
+
+  Double command;
+  uInt64 count[nphase];
+  Double time[nphase];
+};
+
+
+// Add a benchmark executing a TaQL command.
+// If a UDF library is needed, the benchmark is skipped if it cannot be used.
+void addQuery (Benchmark& bench, const String& name, const String& command,
+               Bool usesUDF=False)
+{
+  // Let the query use the MS as $1.
+  String cmd(command);
+  cmd.gsub ("$1", msName);
+  bench.add ("taql/" + name, [cmd, usesUDF](BenchmarkState& state) {
+      if (usesUDF  &&  state.iterations() == 0) {
+        state.pauseTiming();
+        try {
+          tableCommand (cmd + " limit 1");
+        } catch (const std::exception& x) {
+          state.skip (x.what());
+          return;
+        }
+        state.resumeTiming();
+      }
+      PhaseTimes before;
+      TaQLResult result = tableCommand (cmd);
+      PhaseTimes after;
+      after.addCounters (before, state);
+      state.pauseTiming();
+      state.setLabel (String::toString(result.table().nrow()) + " rows");
+      state.resumeTiming();
+      state.addItems (nrow());
+    });
+}
+
+// Add a benchmark for an MSSelection expression. The parse of the
+// expression and the evaluation of the resulting selection are timed
+// separately as well.
+void addMSSelection (Benchmark& bench, const String& name,
+                     const std::function<void(MSSelection&)>& setExpr)
+{
+  bench.add ("mssel/" + name, [setExpr](BenchmarkState& state) {
+      state.pauseTiming();
+      MeasurementSet ms(msName);
+      state.resumeTiming();
+      auto start = std::chrono::steady_clock::now();
+      MSSelection select;
+      setExpr (select);
+      TableExprNode node = select.toTableExprNode (&ms);
+      auto parsed = std::chrono::steady_clock::now();
+      Table seltab = ms(node);
+      auto end = std::chrono::steady_clock::now();
+      state.addCounter ("parse_us", std::chrono::duration<Double,std::micro>
+                        (parsed - start).count());
+      state.addCounter ("where_us", std::chrono::duration<Double,std::micro>
+                        (end - parsed).count());
+      state.pauseTiming();
+      state.setLabel (String::toString(seltab.nrow()) + " rows");
+      state.resumeTiming();
+      state.addItems (nrow());
+    });
+}
+
+void addBenchmarks (Benchmark& bench)
+{
+  ostringstream midTime;
+  midTime << std::setprecision(16) << startTime + 0.5*ntime*interval;
+  // Selections on scalars.
+  addQuery (bench, "select/scalar",
+            "select from $1 where ANTENNA1 != ANTENNA2 && TIME < " +
+            midTime.str());
+  addQuery (bench, "select/set",
+            "select from $1 where ANTENNA1 in [0,2,4,6] && FIELD_ID == 1");
+  addQuery (bench, "select/array",
+            "select from $1 where any(abs(DATA) > 14)");
+  addQuery (bench, "select/count",
+            "select gcount() as N from $1 where ANTENNA2 > 3");
+  // Sorting and distinct.
+  addQuery (bench, "orderby",
+            "select from $1 orderby ANTENNA2, ANTENNA1 desc, TIME");
+  addQuery (bench, "distinct",
+            "select distinct ANTENNA1, ANTENNA2 from $1");
+  // Aggregates.
+  addQuery (bench, "groupby/scalar",
+            "select ANTENNA1, gcount() as N, gmean(UVW[1]) as U "
+            "from $1 groupby ANTENNA1");
+  addQuery (bench, "groupby/array",
+            "select ANTENNA1, ANTENNA2, gmean(abs(DATA)) as AMP "
+            "from $1 groupby ANTENNA1, ANTENNA2");
+  addQuery (bench, "groupby/having",
+            "select FIELD_ID, DATA_DESC_ID, gcount() as N from $1 "
+            "groupby FIELD_ID, DATA_DESC_ID having gcount() > 10");
+  // Join with a subtable.
+  addQuery (bench, "join",
+            "select t1.TIME, t2.NAME from $1 t1 join ::ANTENNA t2 "
+            "on t1.ANTENNA1 = t2.rowid() where t2.NAME != 'ANT00'");
+  // Array reductions.
+  addQuery (bench, "array/reduce",
+            "select mean(abs(DATA)) as AMP, ntrue(FLAG) as NFLAG from $1");
+  addQuery (bench, "array/partial",
+            "select means(abs(DATA), 2) as CHANAMP from $1");
+  // UDF calls.
+  addQuery (bench, "udf/mscal.ha1",
+            "select mscal.ha1() as HA1 from $1", True);
+  addQuery (bench, "udf/mscal.uvwwvl",
+            "select mscal.uvwwvl() as UVWL from $1", True);
+  // MSSelection expressions.
+  addMSSelection (bench, "antenna", [](MSSelection& sel) {
+      sel.setAntennaExpr ("0~5&");
+    });
+  addMSSelection (bench, "baseline", [](MSSelection& sel) {
+      sel.setAntennaExpr ("ANT00&ANT01;ANT02&*;!ANT03");
+    });
+  addMSSelection (bench, "time", [](MSSelection& sel) {
+      Double t1 = startTime + 0.25*ntime*interval;
+      Double t2 = startTime + 0.75*ntime*interval;
+      sel.setTimeExpr (MVTime(t1/86400).string(MVTime::YMD, 7) + '~' +
+                       MVTime(t2/86400).string(MVTime::YMD, 7));
+    });
+  addMSSelection (bench, "field", [](MSSelection& sel) {
+      sel.setFieldExpr ("FIELD1");
+    });
+  addMSSelection (bench, "spw", [](MSSelection& sel) {
+      sel.setSpwExpr ("0:0~7");
+    });
+  addMSSelection (bench, "scan", [](MSSelection& sel) {
+      sel.setScanExpr (">2");
+    });
+  addMSSelection (bench, "uvdist", [](MSSelection& sel) {
+      sel.setUvDistExpr ("1~100m");
+    });
+  addMSSelection (bench, "combined", [](MSSelection& sel) {
+      sel.setAntennaExpr ("0~7&");
+      sel.setFieldExpr ("0");
+      sel.setSpwExpr ("0");
+      sel.setScanExpr ("1~5");
+    });
+}
+
+int main (int argc, const char* argv[])
+{
+  try {
+    Benchmark bench(argc, argv);
+    const std::vector<String>& args = bench.arguments();
+    if (args.size() > 0) {
+      ntime = std::max(1, atoi(args[0].chars()));
+    }
+    if (args.size() > 1) {
+      nant = std::max(2, atoi(args[1].chars()));
+    }
+    if (args.size() > 2) {
+      nchan = std::max(1, atoi(args[2].chars()));
+    }
+    cout << "bTaQLPerf: nrow=" << nrow() << " (ntime=" << ntime
+         << " nbaseline=" << nbaseline() << ")  DATA shape=[" << npol << ','
+         << nchan << "] Complex" << endl;
+    // The phase timings need the profile counters.
+    ProfileRegistry::setEnabled (True);
+    makeMS();
+    addBenchmarks (bench);
+    int status = bench.run();
+    TableUtil::deleteTable (msName, True);
+    return status;
+  } catch (const std::exception& x) {
+    cerr << "Exception: " << x.what() << endl;
+    return 1;
+  }
+}
@@ -0,0 +1,160 @@
+//# tMSTableIndex.cc: Test program for class MSTableIndex
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/ms/MSSel/MSTableIndex.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <iostream>
+
+using namespace casacore;
+using namespace std;
+
+// Create a subtable like POINTING with ntime times for 4 antennas.
+// Antennas 0-2 are in time order; antenna 3 has its times in reverse order.
+Table makeTable (uInt ntime)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ANTENNA_ID"));
+  td.addColumn (ScalarColumnDesc<Double>("TIME"));
+  td.addColumn (ScalarColumnDesc<Double>("INTERVAL"));
+  SetupNewTable newtab("tMSTableIndex_tmp.tab", td, Table::New);
+  Table tab(newtab, Table::Memory, 4*ntime);
+  ScalarColumn<Int> ant(tab, "ANTENNA_ID");
+  ScalarColumn<Double> time(tab, "TIME");
+  ScalarColumn<Double> interval(tab, "INTERVAL");
+  rownr_t row = 0;
+  for (uInt t=0; t<ntime; ++t) {
+    for (Int a=0; a<4; ++a) {
+      ant.put (row, a);
+      time.put (row, 100. + 10*(a==3 ? ntime-1-t : t));
+      interval.put (row, 10.);
+      ++row;
+    }
+  }
+  return tab;
+}
+
+// Get the expected row for the given antenna and time step.
+rownr_t expRow (Int antenna, uInt t, uInt ntime)
+{
+  return 4*(antenna==3 ? ntime-1-t : t) + antenna;
+}
+
+void testNearest (MSTableIndex& index, uInt ntime)
+{
+  RecordFieldPtr<Int> antKey(index.accessKey(), "ANTENNA_ID");
+  // Lookups for alternating antennas use the cached searches.
+  for (uInt t=0; t<ntime; ++t) {
+    for (Int a=3; a>=0; --a) {
+      *antKey = a;
+      index.time() = 100. + 10*t + 3;
+      Bool found;
+      Int64 row = index.getNearestRow (found);
+      AlwaysAssertExit (found);
+      AlwaysAssertExit (row == Int64(expRow(a, t, ntime)));
+      AlwaysAssertExit (index.getRowNumbers().nelements() == ntime);
+    }
+  }
+  // Batch lookup.
+  *antKey = 1;
+  Vector<Double> times(ntime);
+  indgen (times, 98., 10.);
+  Vector<Bool> found;
+  Vector<Int64> rows = index.getNearestRows (times, found);
+  AlwaysAssertExit (allTrue (found));
+  for (uInt t=0; t<ntime; ++t) {
+    AlwaysAssertExit (rows[t] == Int64(expRow(1, t, ntime)));
+  }
+}
+
+void testBracketing (MSTableIndex& index, uInt ntime)
+{
+  RecordFieldPtr<Int> antKey(index.accessKey(), "ANTENNA_ID");
+  Int64 row1, row2;
+  Double fraction;
+  for (Int a=0; a<4; ++a) {
+    *antKey = a;
+    index.time() = 123.;
+    AlwaysAssertExit (index.getBracketingRows (row1, row2, fraction));
+    AlwaysAssertExit (row1 == Int64(expRow(a, 2, ntime)));
+    AlwaysAssertExit (row2 == Int64(expRow(a, 3, ntime)));
+    AlwaysAssertExit (near (fraction, 0.3));
+    // Before the first and after the last time.
+    index.time() = 50.;
+    AlwaysAssertExit (index.getBracketingRows (row1, row2, fraction));
+    AlwaysAssertExit (row1 == Int64(expRow(a, 0, ntime))  &&  row2 == row1);
+    AlwaysAssertExit (fraction == 0);
+    index.time() = 1e6;
+    AlwaysAssertExit (index.getBracketingRows (row1, row2, fraction));
+    AlwaysAssertExit (row1 == Int64(expRow(a, ntime-1, ntime))  &&
+                      row2 == row1);
+  }
+  // No matching rows.
+  *antKey = 10;
+  AlwaysAssertExit (! index.getBracketingRows (row1, row2, fraction));
+}
+
+void testAddRows (Table& tab, MSTableIndex& index, uInt ntime)
+{
+  // Add a row for antenna 0; the index must see it.
+  tab.addRow();
+  rownr_t row = tab.nrow() - 1;
+  ScalarColumn<Int>(tab, "ANTENNA_ID").put (row, 0);
+  ScalarColumn<Double>(tab, "TIME").put (row, 100. + 10*ntime);
+  ScalarColumn<Double>(tab, "INTERVAL").put (row, 10.);
+  RecordFieldPtr<Int> antKey(index.accessKey(), "ANTENNA_ID");
+  *antKey = 0;
+  index.time() = 100. + 10*ntime + 1;
+  Bool found;
+  AlwaysAssertExit (index.getNearestRow (found) == Int64(row));
+  AlwaysAssertExit (found);
+  AlwaysAssertExit (index.getRowNumbers().nelements() == ntime+1);
+}
+
+int main()
+{
+  try {
+    const uInt ntime = 10;
+    Table tab = makeTable (ntime);
+    MSTableIndex index(tab, stringToVector("ANTENNA_ID"));
+    testNearest (index, ntime);
+    testBracketing (index, ntime);
+    // A copy has the same cached searches.
+    MSTableIndex index2(index);
+    testNearest (index2, ntime);
+    testAddRows (tab, index, ntime);
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -41,7 +41,12 @@
 #include <casacore/measures/Measures/Stokes.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Logging/LogIO.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/OS/File.h>
 #include <casacore/casa/iostream.h>
+#include <cstdio>
+#include <unistd.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -81,7 +86,7 @@ int MSInterval::comp(const void * obj1, const void * obj2) const
 }
 
 
-  MSIter::MSIter():nMS_p(0),storeSorted_p(False),prevFirstTimeStamp_p(-1.0), allBeamOffsetsZero_p(True)
+  MSIter::MSIter():nMS_p(0),storeSorted_p(False),persistIndex_p(False),prevFirstTimeStamp_p(-1.0), allBeamOffsetsZero_p(True)
 {}
 
 MSIter::MSIter(const MeasurementSet& ms,
@@ -100,6 +105,7 @@ MSIter::MSIter(const MeasurementSet& ms,
   newPolarizationId_p(true),
   newDataDescId_p(true),
   storeSorted_p(false),
+  persistIndex_p(false),
   interval_p(0),
   prevFirstTimeStamp_p(-1.0),
   allBeamOffsetsZero_p(True),
@@ -128,6 +134,7 @@ MSIter::MSIter(const Block<MeasurementSet>& mss,
   newPolarizationId_p(true),
   newDataDescId_p(true),
   storeSorted_p(false),
+  persistIndex_p(false),
   interval_p(0),
   prevFirstTimeStamp_p(-1.0),
   allBeamOffsetsZero_p(True),
@@ -190,7 +197,8 @@ MSIter::MSIter(const MeasurementSet& ms,
 	       const Block<Int>& sortColumns,
 	       Double timeInterval,
 	       Bool addDefaultSortColumns,
-	       Bool storeSorted)
+	       Bool storeSorted,
+	       Bool persistIndex)
 : curMS_p(0),
   lastMS_p(-1),
   more_p(true),
@@ -201,6 +209,7 @@ MSIter::MSIter(const MeasurementSet& ms,
   newPolarizationId_p(true),
   newDataDescId_p(true),
   storeSorted_p(storeSorted),
+  persistIndex_p(persistIndex),
   interval_p(timeInterval), prevFirstTimeStamp_p(-1.0),
   allBeamOffsetsZero_p(True)
 {
@@ -213,7 +222,8 @@ MSIter::MSIter(const Block<MeasurementSet>& mss,
 	       const Block<Int>& sortColumns,
 	       Double timeInterval,
 	       Bool addDefaultSortColumns,
-	       Bool storeSorted)
+	       Bool storeSorted,
+	       Bool persistIndex)
 : bms_p(mss),
   curMS_p(0),
   lastMS_p(-1),
@@ -225,6 +235,7 @@ MSIter::MSIter(const Block<MeasurementSet>& mss,
   newPolarizationId_p(true),
   newDataDescId_p(true),
   storeSorted_p(storeSorted),
+  persistIndex_p(persistIndex),
   interval_p(timeInterval), prevFirstTimeStamp_p(-1.0)
 {
   construct(sortColumns,addDefaultSortColumns);
@@ -248,6 +259,72 @@ Bool MSIter::isSubSet (const Vector<rownr_t>& r1, const Vector<rownr_t>& r2) {
   return ok;
 }
 
+String MSIter::sortIndexName(const Table& ms, const Block<String>& columns)
+{
+  String name = ms.tableName() + "/table.msiterindex";
+  for (size_t i=0; i<columns.nelements(); i++) {
+    name += '_' + columns[i];
+  }
+  return name;
+}
+
+Bool MSIter::readSortIndex(const Table& ms, const Block<String>& columns,
+                           Vector<rownr_t>& rows)
+{
+  String name = sortIndexName(ms, columns);
+  if (! File(name).isReadable()) {
+    return False;
+  }
+  try {
+    AipsIO ios(name);
+    ios.getstart("MSIterIndex");
+    uInt counter;
+    uInt64 nrrow;
+    Vector<String> cols;
+    ios >> counter >> nrrow >> cols;
+    // The modify counter is up to date because nrow() has locked the MS.
+    if (nrrow != ms.nrow()  ||
+        counter != ms.modifyCounter()  ||
+        cols.nelements() != columns.nelements()  ||
+        !allEQ(cols, Vector<String>(columns.begin(), columns.end()))) {
+      return False;
+    }
+    ios >> rows;
+    ios.getend();
+  } catch (const AipsError&) {
+    // A damaged file is ignored; the MS is sorted again.
+    return False;
+  }
+  return rows.nelements() == ms.nrow();
+}
+
+void MSIter::writeSortIndex(const Table& ms, const Block<String>& columns,
+                            const Vector<rownr_t>& rows)
+{
+  if (! File(ms.tableName()).isWritable()) {
+    return;
+  }
+  // Write into a temporary file and rename it to make the update atomic
+  // for other processes reading it.
+  String name = sortIndexName(ms, columns);
+  String tmpName = name + "_tmp" + String::toString(getpid());
+  try {
+    {
+      AipsIO ios(tmpName, ByteIO::New);
+      ios.putstart("MSIterIndex", 1);
+      ios << ms.modifyCounter() << uInt64(ms.nrow())
+          << Vector<String>(columns.begin(), columns.end()) << rows;
+      ios.putend();
+    }
+    if (rename(tmpName.chars(), name.chars()) != 0) {
+      unlink(tmpName.chars());
+    }
+  } catch (const AipsError&) {
+    // Not being able to write the index is not an error.
+    unlink(tmpName.chars());
+  }
+}
+
 void MSIter::construct(const Block<Int>& sortColumns,
 		       Bool addDefaultSortColumns)
 {
@@ -388,8 +465,21 @@ void MSIter::construct(const Block<Int>& sortColumns,
 
     if (!useIn && !useSorted) {
       // we have to resort the input; enclose in >>> <<< to avoid pollution of test .out file
-      if (aips_debug) cout << ">>>"<<endl<<"MSIter::construct - resorting table"<<endl<<"<<<"<<endl;
-      sorted = bms_p[i].sort(columns, Sort::Ascending, Sort::QuickSort);
+      // Use the persistent sort index if possible.
+      // Only an entire readonly MS cannot have unflushed changes.
+      Bool persist = persistIndex_p && bms_p[i].isRootTable() &&
+                     bms_p[i].tableType() == Table::Plain &&
+                     !bms_p[i].isWritable();
+      Vector<rownr_t> rows;
+      if (persist && readSortIndex(bms_p[i], columns, rows)) {
+        sorted = bms_p[i](rows);
+      } else {
+        if (aips_debug) cout << ">>>"<<endl<<"MSIter::construct - resorting table"<<endl<<"<<<"<<endl;
+        sorted = bms_p[i].sort(columns, Sort::Ascending, Sort::DefaultSort);
+        if (persist) {
+          writeSortIndex(bms_p[i], columns, sorted.rowNumbers());
+        }
+      }
     }
 
     // Only store if globally requested _and_ locally decided
@@ -422,7 +512,8 @@ void MSIter::construct(const Block<Int>& sortColumns,
 }
 
 MSIter::MSIter(const MSIter& other)
-	: nMS_p(0), storeSorted_p(False), allBeamOffsetsZero_p(True)
+	: nMS_p(0), storeSorted_p(False), persistIndex_p(False),
+	  allBeamOffsetsZero_p(True)
 {
   operator=(other);
 }
@@ -473,6 +564,7 @@ MSIter::operator=(const MSIter& other)
   spwDepFeed_p = other.spwDepFeed_p;
   checkFeed_p = other.checkFeed_p;
   storeSorted_p = other.storeSorted_p;
+  persistIndex_p = other.persistIndex_p;
   interval_p = other.interval_p;
   colArray_p = other.colArray_p;
   colDataDesc_p = other.colDataDesc_p;
@@ -1029,4 +1121,20 @@ const String& MSIter::keyChange() const
   return tabIter_p[curMS_p]->keyChangeAtLastNext();
 }
 
+void MSIter::setProjection(const Block<String>& columnNames)
+{
+  // Add the columns used by MSIter itself.
+  Block<String> names(columnNames);
+  uInt nr = names.nelements();
+  names.resize (nr+4, False, True);
+  names[nr++] = MS::columnName(MS::ARRAY_ID);
+  names[nr++] = MS::columnName(MS::DATA_DESC_ID);
+  names[nr++] = MS::columnName(MS::FIELD_ID);
+  names[nr++] = MS::columnName(MS::TIME);
+  for (size_t i=0; i<nMS_p; i++) {
+    tabIter_p[i]->setProjection(names);
+    tabIterAtStart_p[i]=True;
+  }
+}
+
 } //# NAMESPACE CASACORE - END
@@ -187,15 +187,26 @@ public:
   // to be a problem when the MS is being read in parallel.  If storeSorted is
   // false then the SORTED_TABLE is constructed and used in memory which keeps
   // concurrent readers from interfering with each other.
+  //
+  // If persistIndex is true, the row order resulting from the sort is
+  // stored in a file in the MS directory, so later iterators using the
+  // same sort columns can skip the sort. The file also holds the number
+  // of rows and the modify counter of the MS (see
+  // <linkto class=TableSyncData>TableSyncData</linkto>); it is only used if
+  // both still match, so any data change written to the MS invalidates it.
+  // Similar to a persistent <linkto class=ColumnsIndex>ColumnsIndex</linkto>,
+  // it is only used for an entire MS opened readonly, because otherwise
+  // unflushed changes could make it stale. Nothing is written if the
+  // MS directory is not writable.
 
   MSIter(const MeasurementSet& ms, const Block<Int>& sortColumns,
          Double timeInterval=0, Bool addDefaultSortColumns=True,
-         Bool storeSorted=True);
+         Bool storeSorted=True, Bool persistIndex=False);
 
   // Same as above with multiple MSs as input.
   MSIter(const Block<MeasurementSet>& mss, const Block<Int>& sortColumns,
          Double timeInterval=0, Bool addDefaultSortColumns=True,
-         Bool storeSorted=True);
+         Bool storeSorted=True, Bool persistIndex=False);
 
   // This constructor is similar to the previous ones but the comparison
   // functions used to group the iterations are given explicitly, making
@@ -248,6 +259,17 @@ public:
   // Report Name of slowest column that changes at end of current iteration
   const String& keyChange() const;
 
+  // Declare the main table columns the caller will use from the iteration
+  // tables. Thereafter the table returned by <src>table()</src> only
+  // contains these columns, the iteration columns and the columns MSIter
+  // needs itself (ARRAY_ID, DATA_DESC_ID, FIELD_ID, and TIME).
+  // It avoids setting up column objects for the other columns in each
+  // iteration, which can be significant for MS main tables with many
+  // columns.
+  // Note that <src>msColumns()</src> still refers to the full MS.
+  // You should call origin() to reset the iteration after calling this.
+  void setProjection(const Block<String>& columnNames);
+
   // Return the current Table iteration
   Table table() const;
 
@@ -425,6 +447,19 @@ protected:
 // Determine if the numbers in r1 are a sorted subset of those in r2
   Bool isSubSet(const Vector<rownr_t>& r1, const Vector<rownr_t>& r2);
 
+  // Get the name of the file holding the persistent row order of the MS
+  // sorted on the given columns.
+  static String sortIndexName(const Table& ms, const Block<String>& columns);
+
+  // Read the persistent row order if its modify counter and number of rows
+  // match those of the MS. It returns False if it cannot be used.
+  static Bool readSortIndex(const Table& ms, const Block<String>& columns,
+                            Vector<rownr_t>& rows);
+
+  // Write the persistent row order. Nothing is done if it cannot be written.
+  static void writeSortIndex(const Table& ms, const Block<String>& columns,
+                             const Vector<rownr_t>& rows);
+
   MSIter* This;
   Block<MeasurementSet> bms_p;
   PtrBlock<TableIterator* > tabIter_p;
@@ -463,6 +498,9 @@ protected:
   // Globally control disk storage of SORTED_TABLE
   Bool storeSorted_p;
 
+  // Use a persistent sort index for readonly MSs
+  Bool persistIndex_p;
+
   // time selection
   Double interval_p;
 
@@ -0,0 +1,183 @@
+//# MSIterPrefetcher.cc: Read the chunks of an MSIter ahead in a background thread
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/ms/MeasurementSets/MSIterPrefetcher.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <algorithm>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+  // Read the column of the chunk into the record.
+  template<typename T>
+  void readColumn(Record& rec, const Table& tab, const String& name,
+                  Bool isScalar)
+  {
+    if (isScalar) {
+      rec.define(name, ScalarColumn<T>(tab, name).getColumn());
+    } else {
+      rec.define(name, ArrayColumn<T>(tab, name).getColumn());
+    }
+  }
+}
+
+MSIterPrefetcher::MSIterPrefetcher(const MSIter& iter,
+                                   const Vector<String>& columns,
+                                   uInt nAhead)
+: itsIter   (iter),
+  itsColumns(columns.copy()),
+  itsNAhead (std::max(nAhead, 1u)),
+  itsEnd    (False),
+  itsStop   (False)
+{
+  itsThread = std::thread(&MSIterPrefetcher::run, this);
+}
+
+MSIterPrefetcher::~MSIterPrefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsStop = True;
+  }
+  itsTakeCond.notify_all();
+  itsThread.join();
+}
+
+std::shared_ptr<const MSIterChunk> MSIterPrefetcher::next()
+{
+  std::unique_lock<std::mutex> lock(itsMutex);
+  while (itsChunks.empty()  &&  !itsEnd) {
+    itsReadCond.wait(lock);
+  }
+  if (itsChunks.empty()) {
+    // All chunks have been taken; an error ends the iteration.
+    if (itsError) {
+      std::rethrow_exception(itsError);
+    }
+    return std::shared_ptr<const MSIterChunk>();
+  }
+  std::shared_ptr<const MSIterChunk> chunk = itsChunks.front();
+  itsChunks.pop_front();
+  lock.unlock();
+  itsTakeCond.notify_one();
+  return chunk;
+}
+
+void MSIterPrefetcher::run()
+{
+  try {
+    // Only set up the columns to read in the iteration tables.
+    Block<String> columns(itsColumns.size());
+    std::copy(itsColumns.begin(), itsColumns.end(), columns.begin());
+    itsIter.setProjection(columns);
+    uInt64 index = 0;
+    for (itsIter.origin(); itsIter.more(); itsIter++) {
+      {
+        // Wait until there is room for another chunk.
+        std::unique_lock<std::mutex> lock(itsMutex);
+        while (itsChunks.size() >= itsNAhead  &&  !itsStop) {
+          itsTakeCond.wait(lock);
+        }
+        if (itsStop) {
+          break;
+        }
+      }
+      // Read without holding the lock, so consumers can take chunks.
+      std::shared_ptr<MSIterChunk> chunk = std::make_shared<MSIterChunk>();
+      readChunk(*chunk, index++);
+      {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        itsChunks.push_back(chunk);
+      }
+      itsReadCond.notify_one();
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsError = std::current_exception();
+  }
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsEnd = True;
+  }
+  itsReadCond.notify_all();
+}
+
+void MSIterPrefetcher::readChunk(MSIterChunk& chunk, uInt64 index)
+{
+  Table tab = itsIter.table();
+  chunk.index = index;
+  chunk.msId  = itsIter.msId();
+  chunk.rows.reference(tab.rowNumbers(itsIter.ms()));
+  const TableDesc& desc = tab.tableDesc();
+  for (const String& name : itsColumns) {
+    const ColumnDesc& cdesc = desc.columnDesc(name);
+    Bool isScalar = cdesc.isScalar();
+    switch (cdesc.dataType()) {
+    case TpBool:
+      readColumn<Bool>(chunk.data, tab, name, isScalar);
+      break;
+    case TpUChar:
+      readColumn<uChar>(chunk.data, tab, name, isScalar);
+      break;
+    case TpShort:
+      readColumn<Short>(chunk.data, tab, name, isScalar);
+      break;
+    case TpInt:
+      readColumn<Int>(chunk.data, tab, name, isScalar);
+      break;
+    case TpUInt:
+      readColumn<uInt>(chunk.data, tab, name, isScalar);
+      break;
+    case TpInt64:
+      readColumn<Int64>(chunk.data, tab, name, isScalar);
+      break;
+    case TpFloat:
+      readColumn<Float>(chunk.data, tab, name, isScalar);
+      break;
+    case TpDouble:
+      readColumn<Double>(chunk.data, tab, name, isScalar);
+      break;
+    case TpComplex:
+      readColumn<Complex>(chunk.data, tab, name, isScalar);
+      break;
+    case TpDComplex:
+      readColumn<DComplex>(chunk.data, tab, name, isScalar);
+      break;
+    case TpString:
+      readColumn<String>(chunk.data, tab, name, isScalar);
+      break;
+    default:
+      throw TableError("MSIterPrefetcher: column " + name +
+                       " has an unsupported data type");
+    }
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,164 @@
+//# MSIterPrefetcher.h: Read the chunks of an MSIter ahead in a background thread
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef MS_MSITERPREFETCHER_H
+#define MS_MSITERPREFETCHER_H
+
+#include <casacore/casa/aips.h>
+#include <casacore/ms/MeasurementSets/MSIter.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// The data of a chunk read by an MSIterPrefetcher
+// </summary>
+// <synopsis>
+// It contains the sequence number of the chunk in the iteration, the MS
+// it belongs to, its row numbers in that MS, and a Record with a field
+// per column read containing the column data of the chunk.
+// </synopsis>
+struct MSIterChunk
+{
+  // Sequence number of the chunk (0 is the first chunk).
+  uInt64 index;
+  // The index of the MS in the MSIter the chunk belongs to.
+  size_t msId;
+  // The row numbers of the chunk in that MS.
+  Vector<rownr_t> rows;
+  // The data of the columns read.
+  Record data;
+};
+
+// <summary>
+// Read the chunks of an MSIter ahead in a background thread
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tMSIter">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=MSIter>MSIter</linkto>
+// </prerequisite>
+
+// <synopsis>
+// An MSIterPrefetcher iterates over a copy of an MSIter in a background
+// thread and reads the data of the given columns for each chunk.
+// At most <src>nAhead</src> chunks are held, so with the default of 2 the
+// next chunk is read while the caller processes the current one (double
+// buffering). Function <src>next</src> returns the chunks in iteration
+// order. It is thread-safe, so several consumer threads can process
+// independent chunks by calling it in parallel.
+// <p>
+// The column data of a chunk are read using <src>getColumn</src>, so an
+// array column must have the same shape in all rows of a chunk, which
+// normally is the case if DATA_DESC_ID is one of the sort columns.
+// An exception thrown while reading is rethrown by <src>next</src>.
+// <p>
+// Tables are not thread-safe. Therefore the MS (and tables derived from it)
+// should not be used by other threads while a prefetcher is active;
+// the chunks returned are independent of the MS.
+// </synopsis>
+
+// <example>
+// <srcblock>
+// MeasurementSet ms("my.ms");
+// Block<Int> sort(2);
+// sort[0] = MS::ANTENNA1;
+// sort[1] = MS::ANTENNA2;
+// MSIter msIter(ms, sort, 60.);
+// MSIterPrefetcher prefetcher(msIter,
+//                             Vector<String>({"DATA", "FLAG", "UVW"}));
+// while (std::shared_ptr<const MSIterChunk> chunk = prefetcher.next()) {
+//   Cube<Complex> data(chunk->data.asArrayComplex("DATA"));
+//   ...
+// }
+// </srcblock>
+// </example>
+
+// <motivation>
+// Calibration and imaging steps iterating through an MS spend much time
+// waiting for the data of a chunk to be read. Reading ahead makes the
+// I/O overlap with the processing.
+// </motivation>
+
+class MSIterPrefetcher
+{
+public:
+  // Start reading the given columns of the chunks of the iterator
+  // (which is copied and set to its origin) in a background thread.
+  // At most nAhead chunks are held.
+  MSIterPrefetcher(const MSIter& iter, const Vector<String>& columns,
+                   uInt nAhead=2);
+
+  // The destructor stops the background thread.
+  ~MSIterPrefetcher();
+
+  // Forbid copy constructor.
+  MSIterPrefetcher(const MSIterPrefetcher&) = delete;
+
+  // Forbid assignment.
+  MSIterPrefetcher& operator=(const MSIterPrefetcher&) = delete;
+
+  // Get the next chunk, waiting until it has been read.
+  // It returns a null pointer if there are no more chunks.
+  std::shared_ptr<const MSIterChunk> next();
+
+private:
+  // The function executed by the background thread.
+  void run();
+
+  // Read the data of the current chunk of the iterator.
+  void readChunk(MSIterChunk& chunk, uInt64 index);
+
+  //# Data members
+  MSIter          itsIter;
+  Vector<String>  itsColumns;
+  uInt            itsNAhead;
+  // The chunks read, but not taken yet.
+  std::deque<std::shared_ptr<const MSIterChunk>> itsChunks;
+  Bool            itsEnd;
+  Bool            itsStop;
+  std::exception_ptr      itsError;
+  std::mutex              itsMutex;
+  std::condition_variable itsReadCond;
+  std::condition_variable itsTakeCond;
+  std::thread             itsThread;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
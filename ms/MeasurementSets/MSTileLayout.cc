@@ -24,9 +24,20 @@
 //#                        Charlottesville, VA 22903-2475 USA
 
 #include <casacore/ms/MeasurementSets/MSTileLayout.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableCopy.h>
+#include <casacore/tables/DataMan/DataManInfo.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/ValType.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -98,5 +109,199 @@ IPosition MSTileLayout::tileShape(const IPosition& dataShape,
   return tileShape(dataShape,observationType,nIfr);
 }
 
+IPosition MSTileLayout::accessTileShape(const IPosition& dataShape,
+					AccessOrder order, Int nIfr,
+					Int nChanAccess)
+{
+  if(nIfr<1) 
+    nIfr=100;
+  const Int ioBlockSize = 131072; // 131072 * sizeOf(Complex) = 1 MB
+  const Int minBlockSize = 4096;  // 4096 * sizeOf(Complex) = 32 kB
+  IPosition tileShape(3,0,0,0);
+  if (dataShape.nelements()==2 && dataShape(0)>0 && dataShape(1)>0) {
+    // Always read all polarizations
+    Int corrSize = dataShape(0);
+    Int nChan = dataShape(1);
+    Int chanSize = nChan;
+    Int rowSize;
+    if (order==BaselineOrder) {
+      // Successive rows of a baseline are nIfr rows apart, so use tiles
+      // with as few rows as possible without making them too small.
+      chanSize=min(nChan, max(1, ioBlockSize/corrSize));
+      rowSize=max(1, minBlockSize/corrSize/chanSize);
+    }
+    else if (order==ChannelOrder) {
+      // Only the channels accessed at a time, but many rows.
+      chanSize=min(nChan, max(1, nChanAccess));
+      rowSize=max(1, ioBlockSize/corrSize/chanSize);
+    }
+    else {
+      // Whole time slots, with all channels if possible.
+      rowSize=ioBlockSize/corrSize/nChan;
+      if (rowSize >= nIfr) {
+	rowSize=(rowSize/nIfr)*nIfr;
+      }
+      else {
+	rowSize=nIfr;
+	chanSize=min(nChan, max(1, ioBlockSize/corrSize/nIfr));
+      }
+    }
+    tileShape(0)=corrSize;
+    tileShape(1)=chanSize;
+    tileShape(2)=rowSize;
+  }
+  return tileShape;
+}
+
+MSTileLayout::AccessOrder MSTileLayout::accessOrder(const Record& columnStats,
+						    const IPosition& dataShape,
+						    uInt elementSize,
+						    Int nIfr,
+						    Int& nChanAccess)
+{
+  nChanAccess = (dataShape.nelements()==2 ? dataShape(1) : 1);
+  if (!columnStats.isDefined("READ")) {
+    return TimeOrder;
+  }
+  const Record& read = columnStats.subRecord("READ");
+  Double nCall = read.asInt64("NCALL");
+  Double nCell = read.asInt64("NCELL");
+  Double nByte = read.asInt64("NBYTE");
+  Double cellSize = Double(dataShape.product()) * elementSize;
+  if (nCall <= 0  ||  nCell <= 0  ||  cellSize <= 0) {
+    return TimeOrder;
+  }
+  // Fraction of the cells read.
+  Double fraction = nByte / (nCell*cellSize);
+  if (fraction < 0.5  &&  dataShape.nelements()==2) {
+    nChanAccess = max(1, Int(fraction*dataShape(1) + 0.5));
+    return ChannelOrder;
+  }
+  if (nCell/nCall >= 0.5*max(1, nIfr)) {
+    return TimeOrder;
+  }
+  return BaselineOrder;
+}
+
+IPosition MSTileLayout::recommendTileShape(const Table& ms,
+					   const String& column,
+					   const Record& ioStatistics)
+{
+  IPosition dataShape;
+  Int nIfr;
+  getDataLayout(ms, column, dataShape, nIfr);
+  Record stats = (ioStatistics.nfields() == 0 ?
+		  ms.ioStatistics() : ioStatistics);
+  Record colStats;
+  if (stats.isDefined("COLUMNS")  &&
+      stats.subRecord("COLUMNS").isDefined(column)) {
+    colStats = stats.subRecord("COLUMNS").subRecord(column);
+  }
+  Int nChanAccess;
+  DataType dtype = TableColumn(ms, column).columnDesc().dataType();
+  AccessOrder order = accessOrder(colStats, dataShape,
+				  ValType::getTypeSize(dtype),
+				  nIfr, nChanAccess);
+  return accessTileShape(dataShape, order, nIfr, nChanAccess);
+}
+
+IPosition MSTileLayout::recommendTileShape(const Table& ms,
+					   const String& column,
+					   AccessOrder order,
+					   Int nChanAccess)
+{
+  IPosition dataShape;
+  Int nIfr;
+  getDataLayout(ms, column, dataShape, nIfr);
+  return accessTileShape(dataShape, order, nIfr, nChanAccess);
+}
+
+void MSTileLayout::getDataLayout(const Table& ms, const String& column,
+				 IPosition& dataShape, Int& nIfr)
+{
+  TableColumn col(ms, column);
+  const ColumnDesc& cdesc = col.columnDesc();
+  // Get the data shape from the description or the first defined cell.
+  dataShape.resize(0);
+  if (cdesc.isFixedShape()) {
+    dataShape = cdesc.shape();
+  }
+  else {
+    for (rownr_t row=0; row<ms.nrow(); ++row) {
+      if (col.isDefined(row)) {
+	dataShape = col.shape(row);
+	break;
+      }
+    }
+  }
+  // Get the number of rows in the first time slot.
+  nIfr = 0;
+  if (ms.nrow() > 0) {
+    rownr_t nrow = min(ms.nrow(), rownr_t(1000000));
+    Vector<Double> times = ScalarColumn<Double>(ms, "TIME").getColumnRange
+      (Slicer(IPosition(1,0), IPosition(1,nrow)));
+    nIfr = 1;
+    while (rownr_t(nIfr) < nrow  &&  times(nIfr) == times(0)) {
+      nIfr++;
+    }
+  }
+}
+
+void MSTileLayout::retile(const Table& ms, const String& newName,
+			  const Vector<String>& columns,
+			  const IPosition& tileShape)
+{
+  TableDesc tabDesc = ms.actualTableDesc();
+  Record dminfo = ms.dataManagerInfo();
+  DataManInfo::removeDminfoColumns(dminfo, columns);
+  for (uInt i=0; i<columns.size(); ++i) {
+    // Find out if all cells have the same shape.
+    TableColumn col(ms, columns(i));
+    IPosition shape;
+    for (rownr_t row=0; row<ms.nrow(); ++row) {
+      if (!col.isDefined(row)) {
+	shape.resize(0);
+	break;
+      }
+      IPosition shp = col.shape(row);
+      if (row == 0) {
+	shape = shp;
+      }
+      else if (!shp.isEqual(shape)) {
+	shape.resize(0);
+	break;
+      }
+    }
+    Record dm;
+    if (shape.empty()) {
+      dm.define("TYPE", "TiledShapeStMan");
+    }
+    else {
+      dm.define("TYPE", "TiledColumnStMan");
+      ColumnDesc& cdesc = tabDesc.rwColumnDesc(columns(i));
+      if (!cdesc.isFixedShape()) {
+	cdesc.setShape(shape);
+      }
+    }
+    dm.define("NAME", "Tiled" + columns(i));
+    dm.define("COLUMNS", Vector<String>(1, columns(i)));
+    Record spec;
+    spec.define("DEFAULTTILESHAPE", tileShape.asVector());
+    dm.defineRecord("SPEC", spec);
+    dminfo.defineRecord(dminfo.nfields(), dm);
+  }
+  DataManInfo::makeUniqueNames(dminfo);
+  // Same adjustments as done by TableCopy::makeEmptyTable.
+  DataManInfo::adjustDesc(tabDesc, dminfo);
+  DataManInfo::adjustTSM(tabDesc, dminfo);
+  dminfo = DataManInfo::adjustStMan(dminfo, "StandardStMan", True);
+  SetupNewTable newtab(newName, tabDesc, Table::New);
+  newtab.bindCreate(dminfo);
+  Table out(newtab, ms.nrow());
+  TableCopy::copyRows(out, ms);
+  TableCopy::copyInfo(out, ms);
+  TableCopy::copySubTables(out, ms);
+}
+
 } //# NAMESPACE CASACORE - END
 
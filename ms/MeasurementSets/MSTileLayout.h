@@ -27,12 +27,15 @@
 #define MS_MSTILELAYOUT_H
 
 #include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <casacore/casa/Containers/Record.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# forward decl
 class IPosition;
 class String;
+class Table;
 
 // <summary> 
 // An helper class for deciding on tile shapes in MeasurementSets
@@ -53,6 +56,12 @@ class String;
 // MSTileLayout is a class to determine an appropriate tile shape choice
 // for the MeasurementSet DATA columns, based on the shape of the DATA,
 // the observing mode and the number of interferometers
+// <p>
+// Alternatively the tile shape can be chosen for the order in which the
+// data will mainly be accessed (see enum AccessOrder). That order can be
+// derived from the IO statistics collected while processing an MS (see
+// <src>Table::ioStatistics</src>). Function <src>retile</src> copies
+// an MS while storing data columns with new tile shapes.
 // </synopsis> 
 //
 // <example>
@@ -67,6 +76,22 @@ class String;
 // // Output is: 
 // tileShape = (4,11,15)
 // </srcblock>
+// The following code retiles an MS for the access pattern recorded while
+// processing it, where the statistics are saved in a file to be used
+// later (e.g. by program msretile).
+// <srcblock>
+// Table::setIOStatistics (True);
+// MeasurementSet ms("my.ms");
+// ... process the MS
+// Record stats = ms.ioStatistics();
+// AipsIO aio("my.iostats", ByteIO::New);
+// aio << stats;
+// ...
+// IPosition tileShape = MSTileLayout::recommendTileShape (ms, "DATA",
+//                                                         stats);
+// MSTileLayout::retile (ms, "my_retiled.ms",
+//                       Vector<String>({"DATA", "FLAG"}), tileShape);
+// </srcblock>
 // </example>
 
 // <motivation>
@@ -89,6 +114,18 @@ public:
     FastMosaic=1
   };
 
+  // The order in which the data in a DATA-like column are mainly accessed.
+  enum AccessOrder {
+    // All baselines of one or a few time slots at a time (e.g. imaging,
+    // calibration solving per time interval).
+    TimeOrder=0,
+    // One baseline for many time slots at a time (e.g. flagging or
+    // averaging per baseline).
+    BaselineOrder=1,
+    // A few channels of many rows at a time (e.g. per channel imaging).
+    ChannelOrder=2
+  };
+
   // Suggest tile shape based on the data shape, the observing mode, 
   // the number of interferometers and the number of integrations per
   // pointing.
@@ -121,6 +158,63 @@ public:
   static IPosition tileShape(const IPosition& dataShape,
 			     Int observationType,
 			     const String& array);
+
+  // Suggest a tile shape for a data column with the given data shape
+  // (correlations, channels) accessed in the given order.
+  // <src>nIfr</src> is the number of rows per time slot.
+  // <src>nChanAccess</src> is the number of channels accessed at a time
+  // in channel order.
+  static IPosition accessTileShape(const IPosition& dataShape,
+				   AccessOrder order, Int nIfr,
+				   Int nChanAccess = 1);
+
+  // Derive the access order from the IO statistics of a data column,
+  // i.e. a subrecord of the COLUMNS subrecord of
+  // <src>Table::ioStatistics</src>. <src>elementSize</src> is the size
+  // of a data element in bytes.
+  // The column is accessed in channel order if on average less than half
+  // of a cell is read; then <src>nChanAccess</src> is set to the average
+  // number of channels read. Otherwise it is accessed in time order if on
+  // average at least half a time slot is read per call, else in baseline
+  // order. Without any reads, time order is returned.
+  static AccessOrder accessOrder(const Record& columnStats,
+				 const IPosition& dataShape,
+				 uInt elementSize, Int nIfr,
+				 Int& nChanAccess);
+
+  // Recommend a tile shape for a data column of an MS.
+  // The data shape and number of rows per time slot are taken from the MS.
+  // The access order is derived from the given IO statistics (as returned
+  // by <src>Table::ioStatistics</src>). If the record is empty, the
+  // statistics collected thus far for the MS in this process are used.
+  static IPosition recommendTileShape(const Table& ms,
+				      const String& column = "DATA",
+				      const Record& ioStatistics = Record());
+
+  // Recommend a tile shape for a data column of an MS accessed in the
+  // given order.
+  static IPosition recommendTileShape(const Table& ms,
+				      const String& column,
+				      AccessOrder order,
+				      Int nChanAccess = 1);
+
+  // Copy an MS to a new MS, where each of the given array columns is
+  // stored in its own tiled storage manager with the given tile shape.
+  // A column having the same shape in all rows is stored with a
+  // TiledColumnStMan (the column gets a fixed shape), otherwise with a
+  // TiledShapeStMan. The subtables are copied as well.
+  // <br>The columns are copied in chunks of rows. As described in
+  // <linkto class=TableCopy>TableCopy</linkto>, the columns are copied
+  // in parallel if aipsrc variable <src>table.copy.nthreads</src> is set.
+  static void retile(const Table& ms, const String& newName,
+		     const Vector<String>& columns,
+		     const IPosition& tileShape);
+
+private:
+  // Get the data shape of a column (from its description or first defined
+  // cell) and the number of rows in the first time slot of an MS.
+  static void getDataLayout(const Table& ms, const String& column,
+			    IPosition& dataShape, Int& nIfr);
 };
 
 
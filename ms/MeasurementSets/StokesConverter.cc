@@ -40,6 +40,54 @@ extern "C" {
     static float floatsqrt(float val) {return sqrt(val);}
 }
 
+namespace {
+  // Convert nSample samples of NIN correlations to nOut correlations using
+  // the conversion matrix conv (column-major, nOut x NIN).
+  // NIN is a compile-time constant, so the inner loops can be unrolled.
+  // The complex products are spelled out, because std::complex products
+  // check for NaN and infinity and do not vectorize.
+  template<Int NIN>
+  void linearConvert(Complex* out, const Complex* in, const Complex* conv,
+                     Int nOut, Int64 nSample)
+  {
+#ifdef _OPENMP
+#pragma omp parallel for if (nSample > 16384)
+#endif
+    for (Int64 j=0; j<nSample; j++) {
+      const Complex* pin=in+j*NIN;
+      Complex* pout=out+j*nOut;
+      for (Int i=0; i<nOut; i++) {
+        Float re=0, im=0;
+        for (Int k=0; k<NIN; k++) {
+          const Complex& c=conv[i+k*nOut];
+          re+=c.real()*pin[k].real()-c.imag()*pin[k].imag();
+          im+=c.real()*pin[k].imag()+c.imag()*pin[k].real();
+        }
+        pout[i]=Complex(re,im);
+      }
+    }
+  }
+
+  // The same for a number of correlations only known at run time.
+  void linearConvert(Complex* out, const Complex* in, const Complex* conv,
+                     Int nIn, Int nOut, Int64 nSample)
+  {
+    for (Int64 j=0; j<nSample; j++) {
+      const Complex* pin=in+j*nIn;
+      Complex* pout=out+j*nOut;
+      for (Int i=0; i<nOut; i++) {
+        Float re=0, im=0;
+        for (Int k=0; k<nIn; k++) {
+          const Complex& c=conv[i+k*nOut];
+          re+=c.real()*pin[k].real()-c.imag()*pin[k].imag();
+          im+=c.real()*pin[k].imag()+c.imag()*pin[k].real();
+        }
+        pout[i]=Complex(re,im);
+      }
+    }
+  }
+}
+
 StokesConverter::StokesConverter() {}
 
 StokesConverter::~StokesConverter() {}
@@ -292,6 +340,36 @@ void StokesConverter::convert(Array<Complex>& out, const Array<Complex>& in) con
 
   Matrix<Complex> outMat=out.reform(IPosition(2,outShape(0),
 					      out.nelements()/outShape(0)));
+  // If all outputs are linear combinations of the inputs, convert all
+  // samples in one pass.
+  Bool allLinear=True;
+  for (uInt i=0; i<out_p.nelements(); i++) {
+    if (out_p(i)>=Stokes::PP) allLinear=False;
+  }
+  if (allLinear) {
+    Bool deleteIn, deleteOut;
+    const Complex* pin=inMat.getStorage(deleteIn);
+    Complex* pout=outMat.getStorage(deleteOut);
+    const Complex* pconv=conv_p.data();
+    const Int nOut=outShape(0);
+    const Int64 nSample=inMat.ncolumn();
+    switch (nCorrIn) {
+    case 1:
+      linearConvert<1>(pout,pin,pconv,nOut,nSample);
+      break;
+    case 2:
+      linearConvert<2>(pout,pin,pconv,nOut,nSample);
+      break;
+    case 4:
+      linearConvert<4>(pout,pin,pconv,nOut,nSample);
+      break;
+    default:
+      linearConvert(pout,pin,pconv,nCorrIn,nOut,nSample);
+    }
+    inMat.freeStorage(pin,deleteIn);
+    outMat.putStorage(pout,deleteOut);
+    return;
+  }
   IPosition iquvShape(outMat.shape()); iquvShape(0)=4;
   Matrix<Complex> iquv;
   if (doIQUV_p) iquv.resize(iquvShape);
@@ -27,6 +27,7 @@
 
 #include <casacore/ms/MeasurementSets/MeasurementSet.h>
 #include <casacore/ms/MeasurementSets/MSIter.h>
+#include <casacore/ms/MeasurementSets/MSIterPrefetcher.h>
 #include <casacore/ms/MeasurementSets/MSColumns.h>
 #include <casacore/ms/MeasurementSets/MSFieldColumns.h>
 #include <casacore/ms/MeasurementSets/MSDataDescColumns.h>
@@ -38,8 +39,11 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 using namespace casacore;
 using namespace std;
@@ -952,6 +956,117 @@ void iterMSCachedFieldInfo ()
   }
 }
 
+// Iterate with a persistent sort index and check that a second iterator
+// gives the same chunks using the stored index.
+// It does not write any output, so it runs the same without the index.
+Vector<rownr_t> iterRows (const MeasurementSet& ms, double binwidth)
+{
+  Block<int> sort(2);
+  sort[0] = MS::ANTENNA2;
+  sort[1] = MS::ANTENNA1;
+  MSIter msIter(ms, sort, binwidth, False, True, True);
+  std::vector<rownr_t> rows;
+  for (msIter.origin(); msIter.more(); msIter++) {
+    Vector<rownr_t> chunk = msIter.table().rowNumbers(ms);
+    rows.insert (rows.end(), chunk.begin(), chunk.end());
+    rows.push_back (ms.nrow());     // mark the end of the chunk
+  }
+  return Vector<rownr_t>(rows);
+}
+
+void iterMSPersistIndex (double binwidth)
+{
+  MeasurementSet ms("tMSIter_tmp.ms", Table::Old);
+  Vector<rownr_t> rows1 = iterRows (ms, binwidth);
+  AlwaysAssertExit (File("tMSIter_tmp.ms/table.msiterindex_"
+                         "ANTENNA2_ANTENNA1_TIME").exists());
+  Vector<rownr_t> rows2 = iterRows (ms, binwidth);
+  AlwaysAssertExit (allEQ (rows1, rows2));
+}
+
+// Check that the prefetched chunks match the chunks of the iterator,
+// also if several threads take the chunks.
+// It does not write any output.
+void iterMSPrefetch (double binwidth)
+{
+  MeasurementSet ms("tMSIter_tmp.ms");
+  Block<int> sort(2);
+  sort[0] = MS::ANTENNA1;
+  sort[1] = MS::ANTENNA2;
+  MSIter msIter(ms, sort, binwidth, False, False);
+  {
+    // Take all chunks before using the MS again, because tables are
+    // not thread-safe.
+    std::vector<std::shared_ptr<const MSIterChunk>> chunks;
+    {
+      MSIterPrefetcher prefetcher(msIter, Vector<String>({"TIME", "UVW"}));
+      while (std::shared_ptr<const MSIterChunk> chunk = prefetcher.next()) {
+        chunks.push_back (chunk);
+      }
+    }
+    uInt64 nchunk = 0;
+    for (msIter.origin(); msIter.more(); msIter++) {
+      AlwaysAssertExit (nchunk < chunks.size());
+      const MSIterChunk& chunk = *chunks[nchunk];
+      AlwaysAssertExit (chunk.index == nchunk++);
+      AlwaysAssertExit (allEQ (chunk.rows, msIter.table().rowNumbers(ms)));
+      AlwaysAssertExit (allEQ (chunk.data.asArrayDouble("TIME"),
+                               ScalarColumn<Double>(msIter.table(),
+                                                    "TIME").getColumn()));
+      AlwaysAssertExit (allEQ (chunk.data.asArrayDouble("UVW"),
+                               ArrayColumn<Double>(msIter.table(),
+                                                   "UVW").getColumn()));
+    }
+    AlwaysAssertExit (nchunk == chunks.size());
+  }
+  {
+    // Let 3 threads take the chunks and count the rows.
+    MSIterPrefetcher prefetcher(msIter, Vector<String>(1, "ANTENNA1"), 4);
+    std::vector<rownr_t> nrow(3, 0);
+    std::vector<std::thread> threads;
+    for (uInt i=0; i<nrow.size(); ++i) {
+      threads.push_back (std::thread([&prefetcher, &nrow, i]() {
+        while (std::shared_ptr<const MSIterChunk> chunk = prefetcher.next()) {
+          nrow[i] += chunk->data.asArrayInt("ANTENNA1").nelements();
+        }
+      }));
+    }
+    for (std::thread& thr : threads) {
+      thr.join();
+    }
+    AlwaysAssertExit (nrow[0] + nrow[1] + nrow[2] == ms.nrow());
+  }
+}
+
+// Check that a projected iterator gives the same chunks, but only
+// contains the requested and the internally used columns.
+// It does not write any output.
+void iterMSProjection (double binwidth)
+{
+  MeasurementSet ms("tMSIter_tmp.ms");
+  Block<int> sort(2);
+  sort[0] = MS::ANTENNA1;
+  sort[1] = MS::ANTENNA2;
+  MSIter msIter(ms, sort, binwidth, False, False);
+  MSIter msIter1(ms, sort, binwidth, False, False);
+  msIter1.setProjection(Block<String>(1, "UVW"));
+  msIter1.origin();
+  for (msIter.origin(); msIter.more(); msIter++, msIter1++) {
+    AlwaysAssertExit (msIter1.more());
+    const TableDesc& td = msIter1.table().tableDesc();
+    AlwaysAssertExit (td.ncolumn() == 7);
+    AlwaysAssertExit (td.isColumn("UVW")  &&  td.isColumn("ANTENNA1")  &&
+                      td.isColumn("TIME")  &&  !td.isColumn("FLAG"));
+    AlwaysAssertExit (allEQ (msIter.table().rowNumbers(ms),
+                             msIter1.table().rowNumbers(ms)));
+    AlwaysAssertExit (msIter.keyChange() == msIter1.keyChange());
+    AlwaysAssertExit (msIter.fieldId() == msIter1.fieldId());
+    AlwaysAssertExit (msIter.dataDescriptionId() ==
+                      msIter1.dataDescriptionId());
+  }
+  AlwaysAssertExit (!msIter1.more());
+}
+
 int main (int argc, char* argv[])
 {
   try {
@@ -991,6 +1106,9 @@ int main (int argc, char* argv[])
     iterMSCachedDDFeedInfo();
     cout << "########" << endl;
     iterMSCachedFieldInfo();
+    iterMSPersistIndex(binwidth);
+    iterMSProjection(binwidth);
+    iterMSPrefetch(binwidth);
   } catch (std::exception& x) {
     cerr << "Unexpected exception: " << x.what() << endl;
     return 1;
@@ -0,0 +1,157 @@
+//# tMSTileLayout.cc: Test program for class MSTileLayout
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/ms/MeasurementSets/MSTileLayout.h>
+#include <casacore/ms/MeasurementSets/MeasurementSet.h>
+#include <casacore/ms/MeasurementSets/MSMainColumns.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Make a record as returned by ColumnIOStats::toRecord.
+Record makeStats (Int64 nCall, Int64 nCell, Int64 nByte)
+{
+  Record read;
+  read.define ("NCALL", nCall);
+  read.define ("NCELL", nCell);
+  read.define ("NBYTE", nByte);
+  Record rec;
+  rec.defineRecord ("READ", read);
+  return rec;
+}
+
+void testShapes()
+{
+  IPosition dataShape(2, 4, 64);
+  AlwaysAssertExit (MSTileLayout::accessTileShape
+                    (dataShape, MSTileLayout::TimeOrder, 351) ==
+                    IPosition(3, 4, 64, 351));
+  AlwaysAssertExit (MSTileLayout::accessTileShape
+                    (dataShape, MSTileLayout::BaselineOrder, 351) ==
+                    IPosition(3, 4, 64, 16));
+  AlwaysAssertExit (MSTileLayout::accessTileShape
+                    (dataShape, MSTileLayout::ChannelOrder, 351, 2) ==
+                    IPosition(3, 4, 2, 16384));
+  // A time slot does not fit in a tile with all channels.
+  AlwaysAssertExit (MSTileLayout::accessTileShape
+                    (IPosition(2, 4, 1024), MSTileLayout::TimeOrder, 351) ==
+                    IPosition(3, 4, 93, 351));
+}
+
+void testOrder()
+{
+  IPosition dataShape(2, 4, 64);
+  uInt cellSize = 4*64*8;
+  Int nChan;
+  // No statistics.
+  AlwaysAssertExit (MSTileLayout::accessOrder (Record(), dataShape, 8, 351,
+                                               nChan) ==
+                    MSTileLayout::TimeOrder);
+  // Entire time slots read.
+  AlwaysAssertExit (MSTileLayout::accessOrder
+                    (makeStats(10, 3510, 3510*cellSize), dataShape, 8, 351,
+                     nChan) == MSTileLayout::TimeOrder);
+  // Single rows read.
+  AlwaysAssertExit (MSTileLayout::accessOrder
+                    (makeStats(3510, 3510, 3510*cellSize), dataShape, 8, 351,
+                     nChan) == MSTileLayout::BaselineOrder);
+  // 4 channels read.
+  AlwaysAssertExit (MSTileLayout::accessOrder
+                    (makeStats(10, 3510, 3510*cellSize/16), dataShape, 8, 351,
+                     nChan) == MSTileLayout::ChannelOrder);
+  AlwaysAssertExit (nChan == 4);
+}
+
+void testRetile()
+{
+  // Create an MS with 5 time slots of 6 baselines.
+  {
+    TableDesc td(MS::requiredTableDesc());
+    MS::addColumnToDesc (td, MS::DATA, 2);
+    SetupNewTable newtab("tMSTileLayout_tmp.ms", td, Table::New);
+    MeasurementSet ms(newtab, 30);
+    ms.createDefaultSubtables (Table::New);
+    MSMainColumns cols(ms);
+    Cube<Complex> data(4, 8, 30);
+    indgen (data);
+    cols.data().putColumn (data);
+    cols.flag().putColumn (Cube<Bool>(4, 8, 30, False));
+    for (uInt i=0; i<30; ++i) {
+      cols.time().put (i, i/6);
+    }
+  }
+  MeasurementSet ms("tMSTileLayout_tmp.ms");
+  // Nothing has been read, so time order is used.
+  IPosition tileShape = MSTileLayout::recommendTileShape (ms, "DATA");
+  AlwaysAssertExit (tileShape == IPosition(3, 4, 8, 4092));
+  tileShape = MSTileLayout::recommendTileShape (ms, "DATA",
+                                                MSTileLayout::ChannelOrder, 2);
+  AlwaysAssertExit (tileShape == IPosition(3, 4, 2, 16384));
+  MSTileLayout::retile (ms, "tMSTileLayout_tmp.ms_retiled",
+                        Vector<String>(1, "DATA"), IPosition(3, 4, 2, 6));
+  MeasurementSet ms2("tMSTileLayout_tmp.ms_retiled");
+  AlwaysAssertExit (ms2.nrow() == 30);
+  Record dminfo = ms2.dataManagerInfo();
+  Bool found = False;
+  for (uInt i=0; i<dminfo.nfields(); ++i) {
+    const Record& dm = dminfo.subRecord(i);
+    if (dm.asArrayString("COLUMNS")(IPosition(1,0)) == "DATA") {
+      found = True;
+      AlwaysAssertExit (dm.asString("TYPE") == "TiledColumnStMan");
+      AlwaysAssertExit (IPosition(dm.subRecord("SPEC").toArrayInt
+                                  ("DEFAULTTILESHAPE")) ==
+                        IPosition(3, 4, 2, 6));
+    }
+  }
+  AlwaysAssertExit (found);
+  AlwaysAssertExit (allEQ (ArrayColumn<Complex>(ms2, "DATA").getColumn(),
+                           ArrayColumn<Complex>(ms, "DATA").getColumn()));
+  AlwaysAssertExit (allEQ (ArrayColumn<Bool>(ms2, "FLAG").getColumn(),
+                           False));
+  AlwaysAssertExit (ms2.antenna().nrow() == 0);
+}
+
+int main()
+{
+  try {
+    testShapes();
+    testOrder();
+    testRetile();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -25,6 +25,8 @@
 
 #include <casacore/casa/Arrays/MaskArrLogi.h>
 #include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/ms/MeasurementSets/StokesConverter.h>
 #include <casacore/casa/iostream.h>
@@ -117,6 +119,63 @@ int main()
 	}
       }
     }
+
+    {
+      // Convert a cube of circular and one of linear correlations.
+      const Int nChan=7, nRow=5;
+      Vector<Int> in(4), out(4);
+      in(0)=Stokes::RR; in(1)=Stokes::RL; in(2)=Stokes::LR; in(3)=Stokes::LL;
+      out(0)=Stokes::I; out(1)=Stokes::Q; out(2)=Stokes::U; out(3)=Stokes::V;
+      sc.setConversion(out,in);
+      Cube<Complex> datain(4,nChan,nRow), dataout;
+      for (Int k=0; k<nRow; k++) {
+	for (Int j=0; j<nChan; j++) {
+	  for (Int i=0; i<4; i++) {
+	    datain(i,j,k)=Complex(i+0.1*j, k-0.2*j*i);
+	  }
+	}
+      }
+      sc.convert(dataout,datain);
+      for (Int k=0; k<nRow; k++) {
+	for (Int j=0; j<nChan; j++) {
+	  Complex rr=datain(0,j,k), rl=datain(1,j,k);
+	  Complex lr=datain(2,j,k), ll=datain(3,j,k);
+	  if (!nearAbs(dataout(0,j,k),rr+ll,1.e-5) ||
+	      !nearAbs(dataout(1,j,k),rl+lr,1.e-5) ||
+	      !nearAbs(dataout(2,j,k),Complex(0,1)*(lr-rl),1.e-5) ||
+	      !nearAbs(dataout(3,j,k),rr-ll,1.e-5)) {
+	    err++;
+	    cerr << "circular cube error at "<<j<<","<<k<<endl;
+	  }
+	}
+      }
+
+      Vector<Int> in2(2), out2(2);
+      in2(0)=Stokes::XX; in2(1)=Stokes::YY;
+      out2(0)=Stokes::I; out2(1)=Stokes::Q;
+      sc.setConversion(out2,in2);
+      Cube<Complex> datain2(datain(IPosition(3,0,0,0),
+				   IPosition(3,1,nChan-1,nRow-1)).copy());
+      sc.convert(dataout,datain2);
+      if (dataout.shape()!=IPosition(3,2,nChan,nRow) ||
+	  !allNearAbs(Cube<Complex>(dataout(IPosition(3,0,0,0),
+					    IPosition(3,0,nChan-1,nRow-1))),
+		      Cube<Complex>(datain2(IPosition(3,0,0,0),
+					    IPosition(3,0,nChan-1,nRow-1)) +
+				    datain2(IPosition(3,1,0,0),
+					    IPosition(3,1,nChan-1,nRow-1))),
+		      1.e-5) ||
+	  !allNearAbs(Cube<Complex>(dataout(IPosition(3,1,0,0),
+					    IPosition(3,1,nChan-1,nRow-1))),
+		      Cube<Complex>(datain2(IPosition(3,0,0,0),
+					    IPosition(3,0,nChan-1,nRow-1)) -
+				    datain2(IPosition(3,1,0,0),
+					    IPosition(3,1,nChan-1,nRow-1))),
+		      1.e-5)) {
+	err++;
+	cerr << "linear cube error: "<<dataout<<endl;
+      }
+    }
   } catch (std::exception& x) {
     cout << "Exception: "<< x.what() <<endl;
   } 
@@ -0,0 +1,122 @@
+//# msretile.cc: Recommend tile shapes and retile data columns of an MS
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/ms/MeasurementSets/MSTileLayout.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayUtil.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/Inputs/Input.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <iostream>
+
+using namespace casacore;
+using namespace std;
+
+// Get the tile shape for the first column to retile.
+IPosition getTileShape (const Table& ms, const String& column,
+                        const String& order, Int nchan,
+                        const String& statsName)
+{
+  if (order == "auto") {
+    Record stats;
+    if (! statsName.empty()) {
+      AipsIO aio(statsName);
+      aio >> stats;
+    }
+    return MSTileLayout::recommendTileShape (ms, column, stats);
+  }
+  MSTileLayout::AccessOrder accOrder = MSTileLayout::TimeOrder;
+  if (order == "baseline") {
+    accOrder = MSTileLayout::BaselineOrder;
+  } else if (order == "channel") {
+    accOrder = MSTileLayout::ChannelOrder;
+  } else if (order != "time") {
+    throw AipsError ("order should be auto, time, baseline or channel");
+  }
+  return MSTileLayout::recommendTileShape (ms, column, accOrder, nchan);
+}
+
+int main (int argc, char* argv[])
+{
+  try {
+    // enable input in no-prompt mode
+    Input inputs(1);
+    // define the input structure
+    inputs.version("20261015");
+    inputs.create ("in", "",
+		   "Name of input MeasurementSet",
+		   "string");
+    inputs.create ("out", "",
+		   "Name of output MeasurementSet; if empty, only the "
+                   "recommended tile shape is shown",
+		   "string");
+    inputs.create ("columns", "DATA,FLAG",
+		   "Names of the data columns to retile",
+		   "string");
+    inputs.create ("order", "auto",
+		   "Main access order (auto, time, baseline, channel); "
+                   "auto derives it from the IO statistics",
+		   "string");
+    inputs.create ("stats", "",
+		   "Name of AipsIO file containing the IO statistics record "
+                   "(as returned by Table::ioStatistics)",
+		   "string");
+    inputs.create ("nchan", "1",
+		   "Number of channels accessed at a time in channel order",
+		   "int");
+    // Fill the input structure from the command line.
+    inputs.readArguments (argc, argv);
+
+    // Get and check the input specification.
+    String msin (inputs.getString("in"));
+    if (msin.empty()) {
+      throw AipsError(" an input MeasurementSet must be given");
+    }
+    String out (inputs.getString("out"));
+    Vector<std::string> colNames = strToVector (inputs.getString("columns"));
+    Vector<String> columns (colNames.begin(), colNames.end());
+    if (columns.empty()) {
+      throw AipsError(" at least one column must be given");
+    }
+    Table ms(msin);
+    IPosition tileShape = getTileShape (ms, columns(0),
+                                        inputs.getString("order"),
+                                        inputs.getInt("nchan"),
+                                        inputs.getString("stats"));
+    cout << "Tile shape for " << columns(0) << ": " << tileShape << endl;
+    if (! out.empty()) {
+      MSTileLayout::retile (ms, out, columns, tileShape);
+      cout << "Created MeasurementSet " << out << " containing "
+           << ms.nrow() << " rows" << endl;
+    }
+  } catch (std::exception& x) {
+    cerr << "Error: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
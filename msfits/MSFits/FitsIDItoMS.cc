@@ -35,6 +35,7 @@
 #include <casacore/casa/Arrays/MatrixMath.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/Slice.h> 
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/fits/FITS/fitsio.h>
@@ -43,6 +44,7 @@
 #include <casacore/casa/BasicMath/Math.h>
 
 #include <casacore/casa/OS/Directory.h>
+#include <casacore/casa/OS/OMP.h>
 
 #include <casacore/ms/MeasurementSets/MeasurementSet.h> 
 #include <casacore/ms/MeasurementSets/MSAntennaColumns.h>
@@ -107,6 +109,8 @@
 
 #include <casacore/scimath/Mathematics/FFTW.h>
 
+#include <vector>
+
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //local debug switch 
@@ -1920,13 +1924,6 @@ void FITSIDItoMS1::fillMSMainTable(const String& MSFileName, Int& nField, Int& n
   //cout << "nCorr=" << nCorr << endl;
   //cout << "nChan=" << nChan << endl;
 
-  Matrix<Complex> vis(nCorr,nChan);
-  Matrix<Float> sigmaSpec(nCorr, nChan);
-  Matrix<Float> weightSpec(nCorr, nChan);
-
-  std::vector<float> fftIn(nChan + 1), fftOut(nChan + 1);
-  FFTW::Plan redftPlan = FFTW::plan_redft00( IPosition(1, nChan+1), fftIn.data(), fftOut.data() );
-
   const Int nCat = 3; // three initial categories
   // define the categories
   Vector<String> cat(nCat);
@@ -1934,8 +1931,6 @@ void FITSIDItoMS1::fillMSMainTable(const String& MSFileName, Int& nField, Int& n
   cat(1)="ORIGINAL"; 
   cat(2)="USER"; 
   msc.flagCategory().rwKeywordSet().define("CATEGORY",cat);
-  Cube<Bool> flagCat(nCorr,nChan,nCat,False);
-  Matrix<Bool> flag = flagCat.xyPlane(0); // references flagCat's storage
 
   // find out the indices for U, V and W, there are several naming schemes
   Int iU,iV,iW;
@@ -1964,18 +1959,6 @@ void FITSIDItoMS1::fillMSMainTable(const String& MSFileName, Int& nField, Int& n
   // get index for weight
   Int iWeight = getIndex(tType, "WEIGHT");
 
-  /*
-  cout << "iU=" << iU << endl;
-  cout << "iV=" << iV << endl;
-  cout << "iW=" << iW << endl;
-  cout << "iBsln=" << iBsln << endl;
-  cout << "iTime0=" << iTime0 << endl;
-  cout << "iTime1=" << iTime1 << endl;
-  cout << "iSource=" << iSource << endl;
-  cout << "iFreq=" << iFreq << endl;
-  cout << "iFlux=" << iFlux << endl;
-  */
-
   receptorAngle_p.resize(1);
   nAnt_p=0;
   *itsLog << LogIO::NORMAL << "Reading and writing visibility data"<< LogIO::POST;
@@ -1988,214 +1971,268 @@ void FITSIDItoMS1::fillMSMainTable(const String& MSFileName, Int& nField, Int& n
   ProgressMeter meter(0.0, nRows*1.0, "FITS-IDI Filler", "Rows copied", "",
  		      "", True,  nRows/100);
 
-  Vector<Double> uvw(3); // Move this temporary out of the loop
-  Vector<Float> _uvw(3); 
-  Int lastSpW;
-  lastSpW=-1;
-  Int putrow = -1;
-  //  Double lastTime=0;
-  //  Bool lastRowFlag=False;
   Int nScan = 0;
+  if (!firstMain) {
+    nScan = scans(MSnRows - 1) + 1;      
+  }
+  //cout << "scanNumber=" << nScan<< endl;
 
-  if (firstMain) {
-    putrow = -1; 
+  Int nIF_p = getIndex(coordType_p,"BAND");
+  if (nIF_p>=0) {
+    nIF_p=nPixel_p(nIF_p);
   } else {
-    putrow = MSnRows - 1; 
-    nScan = scans(putrow) + 1;      
+    nIF_p=1;
+  }
+  const Int nif = max(1,nIF_p);
+  // Number of values per band in the FLUX column.
+  const Int nFluxBand = nChan * nCorr * (uv_data_hasWeights_p ? 3 : 2);
+
+  // The UV_DATA rows are read in blocks of about 32 MB. For each block
+  // the meta data are derived sequentially, thereafter the visibilities and
+  // weights are converted in parallel and the MS rows are written in
+  // one go.
+  const Int nBlock = max(1, min(nRows,
+                                Int(32*1024*1024 / max(1u, rowsize()))));
+  const Int nBlockRow = nBlock * nif;
+  Cube<Complex> visBlk(nCorr, nChan, nBlockRow);
+  Cube<Float> sigmaSpecBlk(nCorr, nChan, nBlockRow);
+  Cube<Float> weightSpecBlk(nCorr, nChan, nBlockRow);
+  Cube<Bool> flagBlk(nCorr, nChan, nBlockRow);
+  Array<Bool> flagCatBlk(IPosition(4, nCorr, nChan, nCat, nBlockRow), False);
+  Matrix<Float> sigmaBlk(nCorr, nBlockRow);
+  Matrix<Float> weightBlk(nCorr, nBlockRow);
+  Matrix<Double> uvwBlk(3, nBlockRow);
+  Vector<Bool> flagRowBlk(nBlockRow);
+  Vector<Int> ant1Blk(nBlockRow), ant2Blk(nBlockRow), arrayBlk(nBlockRow);
+  Vector<Int> spwBlk(nBlockRow), fieldBlk(nBlockRow);
+  Vector<Double> timeBlk(nBlockRow), timeCentroidBlk(nBlockRow);
+  Vector<Double> intervalBlk(nBlockRow);
+  // Per UV_DATA row of a block its conversion parameters.
+  std::vector<const Float*> fluxPtr(nBlock), weightPtr(nBlock);
+  std::vector<Bool> conjugate(nBlock);
+  std::vector<Float> rowInterval(nBlock);
+  std::vector<Int> digiLevel1(nBlock), digiLevel2(nBlock);
+  // The columns with a constant value.
+  Vector<Int> zeroBlk(nBlockRow, 0);
+  Vector<Int> minusOneBlk(nBlockRow, -1);
+  Vector<Int> scanBlk(nBlockRow, nScan);
+
+  // Each thread needs its own FFT buffers (the plans cannot be made in
+  // parallel).
+  const uInt nThreads = OMP::maxThreads();
+  std::vector<std::vector<float>> fftIns(nThreads), fftOuts(nThreads);
+  std::vector<FFTW::Plan> redftPlans;
+  for (uInt i=0; i<nThreads; ++i) {
+    fftIns[i].resize(nChan + 1);
+    fftOuts[i].resize(nChan + 1);
+    redftPlans.push_back (FFTW::plan_redft00( IPosition(1, nChan+1), fftIns[i].data(), fftOuts[i].data() ));
   }
-  //cout << "scanNumber=" << nScan<< endl;
 
-  for (Int trow=0; trow<nRows; trow++) {
-    // Read next row and
-    // get time in MJD seconds
-    const Double JDofMJD0=2400000.5;
-    read(1);
+  for (Int startRow=0; startRow<nRows; startRow+=nBlock) {
+    const Int nBlkRows = min(nBlock, nRows - startRow);
+    const Int nMSRows = nBlkRows * nif;
+    read(nBlkRows);
+    const rownr_t firstRow = ms.nrow();
+    ms.addRow(nMSRows);
+
+    // Derive the meta data of the rows.
+    for (Int brow=0; brow<nBlkRows; brow++) {
+      const Int trow = startRow + brow;
+      (*this)(beg_row + brow);
+      // get time in MJD seconds
+      const Double JDofMJD0=2400000.5;
     
-    //
-    //get actual Time0 data value from field array,
-    //then multiply by scale factor and add offset.
-    //
-    Double time;
-    memcpy(&time, (static_cast<Double *>(data_addr[iTime0])), sizeof(Double));
-    time *= tscal(iTime0);
-    time += tzero(iTime0);  
-    time -= JDofMJD0;
-    //cout << "TIME=" << time << endl; 
-
-    if (iTime1>=0){
-      Double time1;
-      memcpy(&time1, (static_cast<Double *>(data_addr[iTime1])), sizeof(Double));
-      time1 *= tscal(iTime1);
-      time1 += tzero(iTime1); 
-      time += time1;
-    }
-    //cout << "TIME=" << time << endl; 
-
-    Int _baseline;
-    Float baseline;
-    memcpy(&_baseline, (static_cast<Int *>(data_addr[iBsln])), sizeof(Int));
-    baseline=static_cast<Float>(_baseline); 
-    baseline *= tscal(iBsln);
-    baseline += tzero(iBsln); 
-    //cout << "BASELINE=" << baseline << endl; 
-
-    if(field(iU).fieldtype() == FITS::FLOAT) {
-      uvw(0) = *static_cast<Float *>(data_addr[iU]);
-    } else {
-      uvw(0) = *static_cast<Double *>(data_addr[iU]);
-    }    
-    uvw(0) *= tscal(iU);
-    uvw(0) += tzero(iU); 
-    //cout << "uvw(0)=" << uvw(0) << endl; 
-
-    if(field(iV).fieldtype() == FITS::FLOAT) {
-      uvw(1) = *static_cast<Float *>(data_addr[iV]);
-    } else {
-      uvw(1) = *static_cast<Double *>(data_addr[iV]);
-    }
-    uvw(1) *= tscal(iV);
-    uvw(1) += tzero(iV); 
-    //cout << "uvw(1)=" << uvw(1) << endl; 
+      //
+      //get actual Time0 data value from field array,
+      //then multiply by scale factor and add offset.
+      //
+      Double time;
+      memcpy(&time, (static_cast<Double *>(data_addr[iTime0])), sizeof(Double));
+      time *= tscal(iTime0);
+      time += tzero(iTime0);  
+      time -= JDofMJD0;
+
+      if (iTime1>=0){
+        Double time1;
+        memcpy(&time1, (static_cast<Double *>(data_addr[iTime1])), sizeof(Double));
+        time1 *= tscal(iTime1);
+        time1 += tzero(iTime1); 
+        time += time1;
+      }
 
-    if(field(iW).fieldtype() == FITS::FLOAT) {
-      uvw(2) = *static_cast<Float *>(data_addr[iW]);
-    } else {
-      uvw(2) = *static_cast<Double *>(data_addr[iW]);
-    }
-    uvw(2) *= tscal(iW);
-    uvw(2) += tzero(iW); 
-    //cout << "uvw(2)=" << uvw(2) << endl; 
-
-    time  *= C::day; 
-    //    cout << "TIME=" << setprecision(11) << time << endl; 
-
-    if (row<0) {
-      startTime = time;
-      if (firstMain){
-	startTime_p = startTime;
-	//	cout << "startTime is set to " << startTime << endl;
+      Int _baseline;
+      Float baseline;
+      memcpy(&_baseline, (static_cast<Int *>(data_addr[iBsln])), sizeof(Int));
+      baseline=static_cast<Float>(_baseline); 
+      baseline *= tscal(iBsln);
+      baseline += tzero(iBsln); 
+
+      Vector<Double> uvw(3);
+      Int iUVW[3] = {iU, iV, iW};
+      for (Int i=0; i<3; ++i) {
+        if(field(iUVW[i]).fieldtype() == FITS::FLOAT) {
+          uvw(i) = *static_cast<Float *>(data_addr[iUVW[i]]);
+        } else {
+          uvw(i) = *static_cast<Double *>(data_addr[iUVW[i]]);
+        }    
+        uvw(i) *= tscal(iUVW[i]);
+        uvw(i) += tzero(iUVW[i]); 
       }
-    }
 
-    // If integration time is available, use it:
-    if (iInttim > -1) {
-      memcpy(&interval, (static_cast<Float *>(data_addr[iInttim])), sizeof(Float));
-      interval *= tscal(iInttim);
-      // cout << "INTTIM=" << setprecision(11) << interval << endl; 
-    } else {
-      // make a guess at the integration time
+      time  *= C::day; 
+
       if (row<0) {
-	*itsLog << LogIO::WARN << "UV_DATA table contains no integration time information. Will try to derive it from TIME." 
-		<< LogIO::POST;
+        startTime = time;
+        if (firstMain){
+	  startTime_p = startTime;
+        }
       }
-      if (time > startTime) {
-	interval=time-startTime;
-	msc.interval().fillColumn(interval);
-	msc.exposure().fillColumn(interval);
-	startTime = DBL_MAX; // do this only once
+
+      // If integration time is available, use it:
+      if (iInttim > -1) {
+        memcpy(&interval, (static_cast<Float *>(data_addr[iInttim])), sizeof(Float));
+        interval *= tscal(iInttim);
+      } else {
+        // make a guess at the integration time
+        if (row<0) {
+	  *itsLog << LogIO::WARN << "UV_DATA table contains no integration time information. Will try to derive it from TIME." 
+		  << LogIO::POST;
+        }
+        if (time > startTime) {
+	  interval=time-startTime;
+	  // Also set it for the rows filled before (including those of
+	  // this block which are not written yet).
+	  msc.interval().fillColumn(interval);
+	  msc.exposure().fillColumn(interval);
+	  for (Int i=0; i<brow*nif; ++i) {
+	    intervalBlk(i) = interval;
+	  }
+	  startTime = DBL_MAX; // do this only once
+        }
       }
-    }
 
-    if(trow==nRows-1){
-      lastTime_p = time+interval;
-    }
+      if(trow==nRows-1){
+        lastTime_p = time+interval;
+      }
 
-    Int array = Int(100.0*(baseline - Int(baseline)+0.001));
-    Int ant1 = Int(baseline)/256; 
-    Int ant2 = Int(baseline) - ant1*256; 
-    if(antIdFromNo.find(ant1) != antIdFromNo.end()){
+      Int array = Int(100.0*(baseline - Int(baseline)+0.001));
+      Int ant1 = Int(baseline)/256; 
+      Int ant2 = Int(baseline) - ant1*256; 
+      if(antIdFromNo.find(ant1) != antIdFromNo.end()){
     	ant1 = antIdFromNo[ant1];
-    }
-    else{
+      }
+      else{
     	*itsLog << LogIO::SEVERE << "Inconsistent input dataset: unknown ANTENNA_NO "
     			<< ant1 << " in baseline used in UV_DATA table." << LogIO::EXCEPTION;
-    }
-    if(antIdFromNo.find(ant2) != antIdFromNo.end()){
+      }
+      if(antIdFromNo.find(ant2) != antIdFromNo.end()){
     	ant2 = antIdFromNo[ant2];
-    }
-    else{
+      }
+      else{
     	*itsLog << LogIO::SEVERE << "Inconsistent input dataset: unknown ANTENNA_NO "
     			<< ant2 << " in baseline used in UV_DATA table." << LogIO::EXCEPTION;
-    }
-    nAnt_p = max(nAnt_p,ant1+1);
-    nAnt_p = max(nAnt_p,ant2+1);
-
-    Bool doConjugateVis = False;
-
-    if(ant1>ant2){ // swap indices and multiply UVW by -1
-      Int tant = ant1;
-      ant1 = ant2;
-      ant2 = tant;
-      uvw *= -1.;
-      doConjugateVis = True;
-    }
-
-    // Convert U,V,W from units of seconds to meters
-    uvw *= C::c;
+      }
+      nAnt_p = max(nAnt_p,ant1+1);
+      nAnt_p = max(nAnt_p,ant2+1);
 
-    Int count = 0;
+      Bool doConjugateVis = False;
 
-    Float test_baseline;
-    memcpy(&test_baseline,fitsrow,sizeof(Int));
-    //cout << "*****TEST_BASELINE FITS=" << test_baseline << endl;
+      if(ant1>ant2){ // swap indices and multiply UVW by -1
+        Int tant = ant1;
+        ant1 = ant2;
+        ant2 = tant;
+        uvw *= -1.;
+        doConjugateVis = True;
+      }
 
-    memcpy(&test_baseline,table,sizeof(Int));
-    //cout << "*****TEST_BASELINE TABLE=" << test_baseline << endl;
+      // Convert U,V,W from units of seconds to meters
+      uvw *= C::c;
 
-    Int new_baseline;
-    memcpy(&new_baseline,static_cast<Int *>(data_addr[iBsln]),sizeof(Int));
-    //cout << "*****NEW_BASELINE ADDR=" << new_baseline << endl;
-        
+      fluxPtr[brow] = static_cast<Float *>(data_addr[iFlux]);
+      weightPtr[brow] = (iWeight >= 0 ? static_cast<Float *>(data_addr[iWeight]) : 0);
+      conjugate[brow] = doConjugateVis;
+      rowInterval[brow] = interval;
+      digiLevel1[brow] = digiLevels[ant1];
+      digiLevel2[brow] = digiLevels[ant2];
 
-    Float visReal = 0.;
-    Float visImag = 0.;
-    Float visWeight = 1.;
+      // store the sourceId 
+      Int sourceId = 0;
+      if (iSource>=0) {
+        memcpy(&sourceId, (static_cast<Int *>(data_addr[iSource])), sizeof(Int));
+        sourceId *= (Int)tscal(iSource);
+        sourceId += (Int)tzero(iSource); 
+ 	sourceId--; // make 0-based
+      }
+      nField = max(nField, sourceId+1);
 
-    Int nIF_p = 0;
-    nIF_p = getIndex(coordType_p,"BAND");
-    if (nIF_p>=0) {
-      nIF_p=nPixel_p(nIF_p);
-    } else {
-      nIF_p=1;
+      for (Int ifno=0; ifno<nif; ifno++) {
+        // BANDs go to separate rows in the MS
+        row++;
+        const Int mrow = brow * nif + ifno;
+
+        // determine the spectralWindowId
+        Int spW = ifno;
+        if (iFreq>=0) {
+	  memcpy(&spW, (static_cast<Int *>(data_addr[iFreq])), sizeof(Int));
+	  spW *= (Int)tscal(iFreq);
+	  spW += (Int)tzero(iFreq); 
+	  spW--; // make 0-based
+	  if (nIF_p>0) {
+	    spW *=nIF_p; 
+	    spW+=ifno;
+	  }
+        }
+        nSpW = max(nSpW, spW+1);
+
+        spwBlk(mrow) = spW;
+        intervalBlk(mrow) = interval;
+        ant1Blk(mrow) = ant1;
+        ant2Blk(mrow) = ant2;
+        arrayBlk(mrow) = array;
+        timeBlk(mrow) = time;
+        timeCentroidBlk(mrow) = time+interval/2.;
+        uvwBlk.column(mrow) = uvw;
+        fieldBlk(mrow) = sourceId;
+      }
     }
-    
-    Double weightScale = visScl_p;
-    if (itsCorrelat == "VLBA" && itsCorVer >= 4.17)
-      weightScale *= interval;
-
-    //cout <<"ifnomax ="<<max(1,nIF_p)<<endl;
 
-    for (Int ifno=0; ifno<max(1,nIF_p); ifno++) {
-      // BANDs go to separate rows in the MS
-      ms.addRow();
-      row++;
-      putrow++;
- 
+    // Convert the visibilities and weights of the rows.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (nMSRows > 1)
+#endif
+    for (Int mrow=0; mrow<nMSRows; mrow++) {
+      const Int brow = mrow / nif;
+      const Int ifno = mrow % nif;
+      const uInt thread = OMP::threadNum();
+      std::vector<float>& fftIn = fftIns[thread];
+      std::vector<float>& fftOut = fftOuts[thread];
+      FFTW::Plan& redftPlan = redftPlans[thread];
+      const Int ant1 = ant1Blk(mrow);
+      const Int ant2 = ant2Blk(mrow);
+      const Int spW = spwBlk(mrow);
+      const Bool doConjugateVis = conjugate[brow];
+      const Float interval = rowInterval[brow];
+      Matrix<Complex> vis(visBlk.xyPlane(mrow));
+      Matrix<Float> sigmaSpec(sigmaSpecBlk.xyPlane(mrow));
+      Matrix<Float> weightSpec(weightSpecBlk.xyPlane(mrow));
+      Matrix<Bool> flag(flagBlk.xyPlane(mrow));
+
+      Double weightScale = visScl_p;
+      if (itsCorrelat == "VLBA" && itsCorVer >= 4.17)
+        weightScale *= interval;
+
+      const Float* flux = fluxPtr[brow] + ifno * nFluxBand;
+      Float visWeight = 1.;
       for (Int chan=0; chan<nChan; chan++) {
 	for (Int pol=0; pol<nCorr; pol++) {
-           
-          memcpy(&visReal, (static_cast<Float *>(data_addr[iFlux])) + count++, sizeof(Float));
-//          if(count<9){
-//	    cout << "COUNT=" << count <<"ifno="<< ifno <<"chan="<< chan<<"pol="<< pol  << " corrindex " << corrIndex_p[pol] << endl;
-//	  }
-	  //visReal *= tscal(iFlux);
-	  //visReal += tzero(iFlux); 
-
-	  memcpy(&visImag, (static_cast<Float *>(data_addr[iFlux])) + count++, sizeof(Float));     
-	  //visImag *= tscal(iFlux);
-	  //visImag += tzero(iFlux); 
-//	  if(count<10){
-//	    cout<<"    visReal="<< visReal << "visImag="<< visImag<<endl;
-//	  }
-
+	  const Float visReal = *flux++;
+	  const Float visImag = *flux++;
 	  if (uv_data_hasWeights_p) {
-	    memcpy(&visWeight, (static_cast<Float *>(data_addr[iFlux])) + count++, sizeof(Float));
+	    visWeight = *flux++;
 	  } else if (iWeight>=0) {
-	    memcpy(&visWeight, (static_cast<Float *>(data_addr[iWeight])) + ifno * nStokes_p + pol, sizeof(Float));
+	    visWeight = weightPtr[brow][ifno * nStokes_p + pol];
 	  }
 
-	  //const Float wt = priGroup_p(count++); 
-
 	  const Int p = doConjugateVis ? corrSwapIndex_p[pol] : corrIndex_p[pol];
 
  	  if (visWeight <= 0.0) {
@@ -2238,19 +2275,21 @@ void FITSIDItoMS1::fillMSMainTable(const String& MSFileName, Int& nField, Int& n
 	Double bfacta, bfactc;
 	Double Rm, gamma, alfa, sat;
 	Double (*rho)(Double) = NULL;
+	const Int digi1 = digiLevel1[brow];
+	const Int digi2 = digiLevel2[brow];
 
-	if (digiLevels[ant1] == 4 && digiLevels[ant2] == 4) {
+	if (digi1 == 4 && digi2 == 4) {
 	  Rm = 4.3048;
 	  alfa = 0.882518;
 	  gamma = 3.335875 * 64.0 / 63.0;
 	  rho = rho_4;
-	} else if (digiLevels[ant1] == 2 && digiLevels[ant2] == 2) {
+	} else if (digi1 == 2 && digi2 == 2) {
 	  Rm = 1.0;
 	  alfa = 2.0 / C::pi;
 	  gamma = 1.0 * 64.0 / 63.0;
 	  rho = rho_2;
-	} else if ((digiLevels[ant1] == 2 && digiLevels[ant2] == 4) ||
-		   (digiLevels[ant1] == 4 && digiLevels[ant2] == 2)) {
+	} else if ((digi1 == 2 && digi2 == 4) ||
+		   (digi1 == 4 && digi2 == 2)) {
 	  Rm = 5.8784;
 	  alfa = 0.882518;
 	  gamma = 3.335875 * 64.0 / 63.0;
@@ -2321,24 +2360,6 @@ void FITSIDItoMS1::fillMSMainTable(const String& MSFileName, Int& nField, Int& n
       if (weightyp_p == "CORRELAT")
 	vis /= ((Float)weightScale * weightSpec);
 
-      // determine the spectralWindowId
-      Int spW = ifno;
-      if (iFreq>=0) {
-	memcpy(&spW, (static_cast<Int *>(data_addr[iFreq])), sizeof(Int));
-	spW *= (Int)tscal(iFreq);
-	spW += (Int)tzero(iFreq); 
-	spW--; // make 0-based
-	if (nIF_p>0) {
-	  spW *=nIF_p; 
-	  spW+=ifno;
-	}
-      }
-      if (spW!=lastSpW) {
-	msc.dataDescId().put(putrow,spW);
-	nSpW = max(nSpW, spW+1);
-	lastSpW=spW;
-      }
-
       for (Int chan=0; chan<nChan; chan++) {
 	for (Int pol=0; pol<nCorr; pol++) {
 	  const Int p = corrIndex_p[pol];
@@ -2355,63 +2376,48 @@ void FITSIDItoMS1::fillMSMainTable(const String& MSFileName, Int& nField, Int& n
 	}
       }
 
-      // fill in values for all the unused columns
-      msc.feed1().put(putrow,0);
-      msc.feed2().put(putrow,0);
-      msc.flagRow().put(putrow,False);
-      msc.processorId().put(putrow,-1);
-      msc.observationId().put(putrow,0);
-      msc.stateId().put(putrow,-1);
-
-      Vector<Float> tmpValue(nCorr);
-      tmpValue=1.0;
-      msc.sigma().put(putrow,tmpValue);
-      tmpValue=0.0;
-      msc.weight().put(putrow,tmpValue);
-
-      msc.interval().put(putrow,interval);
-      msc.exposure().put(putrow,interval);
-      msc.scanNumber().put(putrow,nScan);
-
-      msc.data().put(putrow,vis);
-
-      const Vector<Float> sigma = partialMedians(sigmaSpec, IPosition(1, 1));
-      const Vector<Float> weight = partialMedians(weightSpec, IPosition(1, 1));
-      msc.sigma().put(putrow,sigma);
-      msc.weight().put(putrow,weight);
-
-      if(uv_data_hasWeights_p){
-	msc.sigmaSpectrum().put(putrow,sigmaSpec);
-	msc.weightSpectrum().put(putrow,weightSpec); 
-      }
-
-      msc.flag().put(putrow,flag);
-      msc.flagCategory().put(putrow,flagCat);
-
-      Bool rowFlag=allEQ(flag,True);
-      msc.flagRow().put(putrow,rowFlag);
+      sigmaBlk.column(mrow) = partialMedians(sigmaSpec, IPosition(1, 1));
+      weightBlk.column(mrow) = partialMedians(weightSpec, IPosition(1, 1));
+      flagRowBlk(mrow) = allEQ(flag, True);
+      // The first flag category is the flag itself.
+      Array<Bool> flagCat(flagCatBlk(IPosition(4, 0, 0, 0, mrow),
+                                     IPosition(4, nCorr-1, nChan-1, 0, mrow)));
+      flagCat = flag.reform(flagCat.shape());
+    }
 
-      msc.antenna1().put(putrow,ant1);
-      msc.antenna2().put(putrow,ant2);
-      msc.arrayId().put(putrow,array);
-      msc.time().put(putrow,time);
-      msc.timeCentroid().put(putrow,time+interval/2.);
-      msc.uvw().put(putrow,uvw);
-      
-      // store the sourceId 
-      Int sourceId = 0;
-      if (iSource>=0) {
- 	// make 0-based
-        memcpy(&sourceId, (static_cast<Int *>(data_addr[iSource])), sizeof(Int));
-        sourceId *= (Int)tscal(iSource);
-        sourceId += (Int)tzero(iSource); 
- 	sourceId--; // make 0-based
-      }
-      msc.fieldId().put(putrow,sourceId);
-      nField = max(nField, sourceId+1);
-    } // end for(ifno=0 ...
-    meter.update((trow+1)*1.0);
-  } // end for(trow=0 ...
+    // Write the rows.
+    const Slicer rowRange(IPosition(1, firstRow), IPosition(1, nMSRows));
+    const Slice blkRange(0, nMSRows);
+    const IPosition end2(2, nCorr-1, nMSRows-1);
+    const IPosition end3(3, nCorr-1, nChan-1, nMSRows-1);
+    msc.feed1().putColumnRange(rowRange, zeroBlk(blkRange));
+    msc.feed2().putColumnRange(rowRange, zeroBlk(blkRange));
+    msc.processorId().putColumnRange(rowRange, minusOneBlk(blkRange));
+    msc.observationId().putColumnRange(rowRange, zeroBlk(blkRange));
+    msc.stateId().putColumnRange(rowRange, minusOneBlk(blkRange));
+    msc.interval().putColumnRange(rowRange, intervalBlk(blkRange));
+    msc.exposure().putColumnRange(rowRange, intervalBlk(blkRange));
+    msc.scanNumber().putColumnRange(rowRange, scanBlk(blkRange));
+    msc.dataDescId().putColumnRange(rowRange, spwBlk(blkRange));
+    msc.data().putColumnRange(rowRange, visBlk(IPosition(3, 0), end3));
+    msc.sigma().putColumnRange(rowRange, sigmaBlk(IPosition(2, 0), end2));
+    msc.weight().putColumnRange(rowRange, weightBlk(IPosition(2, 0), end2));
+    if(uv_data_hasWeights_p){
+      msc.sigmaSpectrum().putColumnRange(rowRange, sigmaSpecBlk(IPosition(3, 0), end3));
+      msc.weightSpectrum().putColumnRange(rowRange, weightSpecBlk(IPosition(3, 0), end3));
+    }
+    msc.flag().putColumnRange(rowRange, flagBlk(IPosition(3, 0), end3));
+    msc.flagCategory().putColumnRange(rowRange, flagCatBlk(IPosition(4, 0), IPosition(4, nCorr-1, nChan-1, nCat-1, nMSRows-1)));
+    msc.flagRow().putColumnRange(rowRange, flagRowBlk(blkRange));
+    msc.antenna1().putColumnRange(rowRange, ant1Blk(blkRange));
+    msc.antenna2().putColumnRange(rowRange, ant2Blk(blkRange));
+    msc.arrayId().putColumnRange(rowRange, arrayBlk(blkRange));
+    msc.time().putColumnRange(rowRange, timeBlk(blkRange));
+    msc.timeCentroid().putColumnRange(rowRange, timeCentroidBlk(blkRange));
+    msc.uvw().putColumnRange(rowRange, uvwBlk(IPosition(2, 0), IPosition(2, 2, nMSRows-1)));
+    msc.fieldId().putColumnRange(rowRange, fieldBlk(blkRange));
+    meter.update((startRow+nBlkRows)*1.0);
+  } // end for(startRow=0 ...
 
   // fill the receptorAngle with defaults, just in case there is no AN table
   receptorAngle_p=0;
@@ -33,6 +33,7 @@
 #include <casacore/casa/Arrays/MatrixMath.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/Slice.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/fits/FITS/fitsio.h>
@@ -96,7 +97,9 @@
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/iomanip.h>
 #include <casacore/casa/OS/Directory.h>
+#include <algorithm>
 #include <map>
+#include <vector>
 
 using std::make_pair;
 
@@ -1427,7 +1430,9 @@ void MSFitsInput::fillMSMainTableColWise(Int& nField, Int& nSpW) {
 
 // Extract the data from the PrimaryGroup object and stick it into
 // the MeasurementSet 
-// Doing it row by row
+// Doing it in blocks of rows. The groups in a block are read sequentially,
+// the visibilities, weights and flags are converted in parallel and the
+// block is written with a single put per column.
 void MSFitsInput::fillMSMainTable(Int& nField, Int& nSpW) {
     _log << LogOrigin("MSFitsInput", "fillMSMainTable");
     // Get access to the MS columns
@@ -1448,11 +1453,6 @@ void MSFitsInput::fillMSMainTable(Int& nField, Int& nSpW) {
     Int nCorr = _nPixel(getIndex(_coordType, "STOKES"));
     Int nChan = _nPixel(getIndex(_coordType, "FREQ"));
 
-
-    Matrix<Complex> vis(nCorr, nChan);
-    Vector<Float> sigma(nCorr);
-    Matrix<Float> weightSpec(nCorr, nChan);
-    Vector<Float> weight(nCorr);
     const Int nCat = 3; // three initial categories
     // define the categories
     Vector<String> cat(nCat);
@@ -1460,8 +1460,6 @@ void MSFitsInput::fillMSMainTable(Int& nField, Int& nSpW) {
     cat(1) = "ORIGINAL";
     cat(2) = "USER";
     msc.flagCategory().rwKeywordSet().define("CATEGORY", cat);
-    Cube<Bool> flagCat(nCorr, nChan, nCat, False);
-    Matrix<Bool> flag = flagCat.xyPlane(0); // references flagCat's storage
 
     // find out the indices for U, V and W, there are several naming schemes
     Int iU, iV, iW;
@@ -1507,7 +1505,6 @@ void MSFitsInput::fillMSMainTable(Int& nField, Int& nSpW) {
     _receptorAngle.resize(1);
     _log << LogIO::NORMAL << "Reading and writing " << nGroups
             << " visibility groups" << LogIO::POST;
-    Int row = -1;
 
     Double interval, exposure;
     interval = 0.0;
@@ -1518,8 +1515,6 @@ void MSFitsInput::fillMSMainTable(Int& nField, Int& nSpW) {
     ProgressMeter meter(0.0, nGroups * 1.0, "UVFITS Filler", "Groups copied",
             "", "", True, nGroups / 100);
 
-    Vector<Double> uvw(3);
-
     // Remember last-filled values for TSM use
     Int lastFillArrayId, lastFillFieldId, lastFillScanNumber;
     lastFillArrayId = -1;
@@ -1539,209 +1534,296 @@ void MSFitsInput::fillMSMainTable(Int& nField, Int& nSpW) {
 
     Bool lastRowFlag = False;
 
-    // Loop over groups
-    for (Int group = 0; group < nGroups; group++) {
+    // Work out which axis increments fastests, pol or channel
+    // The COMPLEX axis is assumed to be first, and the IF axis is assumed
+    // to be after STOKES and FREQ.
+    const Bool polFastest = (getIndex(_coordType, "STOKES") < getIndex(
+            _coordType, "FREQ"));
+    const Int nx = (polFastest ? nChan : nCorr);
+    const Int ny = (polFastest ? nCorr : nChan);
+    const Int nif = max(1, _nIF);
+    const Int64 nElem = _priGroup.nelements();
+    const Int64 nRowElem = Int64(nCorr) * nChan;
+    if (nElem < 3 * nRowElem * nif) {
+        throw(AipsError("MSFitsInput: group data size does not match the "
+                        "STOKES, FREQ and IF axes"));
+    }
+
+    // Read the groups in blocks of about 64 MB of group data.
+    const Int nBlock = max(1, min(nGroups, Int(64 * 1024 * 1024
+            / (sizeof(Float) * (nElem + nParams)))));
+    const Int nBlockRow = nBlock * nif;
+    Matrix<Double> parms(max(1, nParams), nBlock);
+    std::vector<Float> data(nElem * nBlock);
+    Cube<Complex> vis(nCorr, nChan, nBlockRow);
+    Cube<Float> weightSpec(nCorr, nChan, nBlockRow);
+    Cube<Bool> flag(nCorr, nChan, nBlockRow);
+    Matrix<Float> weight(nCorr, nBlockRow);
+    Matrix<Float> sigma(nCorr, nBlockRow);
+    Array<Bool> flagCat(IPosition(4, nCorr, nChan, nCat, nBlockRow), False);
+    Matrix<Double> uvw(3, nBlockRow);
+    Vector<Int> ant1(nBlockRow);
+    Vector<Int> ant2(nBlockRow);
+    Vector<Int> datDescId(nBlockRow);
+    Vector<Bool> rowFlag(nBlockRow);
+    const Int* corrIndex = _corrIndex.storage();
+
+    // Loop over blocks of groups
+    for (Int startGroup = 0; startGroup < nGroups; startGroup += nBlock) {
+        const Int nGroup = min(nBlock, nGroups - startGroup);
+        const Int nRow = nGroup * nif;
+        // Read the groups (sequentially as the FITS file is a stream).
+        for (Int group = 0; group < nGroup; group++) {
+            _priGroup.read();
+            _priGroup.copyparm(parms.data() + group * parms.nrow());
+            _priGroup.copy(data.data() + group * nElem);
+        }
+        const rownr_t firstRow = _ms.nrow();
+        _ms.addRow(nRow);
+
+        // Derive the meta data. This is done serially, because the scan
+        // numbers and the columns only written on changes depend on the
+        // previous rows.
+        for (Int group = 0; group < nGroup; group++) {
+            const Double* parm = parms.data() + group * parms.nrow();
+
+            // Extract time in MJD seconds
+            //  (this has VERY limited precision [~0.01s])
+            const Double JDofMJD0 = 2400000.5;
+            Double time = parm[iTime0];
+            time -= JDofMJD0;
+            if (iTime1 >= 0)
+                time += parm[iTime1];
+            time *= C::day;
 
-        // Read next group and
-        _priGroup.read();
+            // Extract fqid
+            Int freqId = iFreq > 0 ? Int(parm[iFreq]) : 1;
 
-        // Extract time in MJD seconds
-        //  (this has VERY limited precision [~0.01s])
-        const Double JDofMJD0 = 2400000.5;
-        Double time = _priGroup.parm(iTime0);
-        time -= JDofMJD0;
-        if (iTime1 >= 0)
-            time += _priGroup.parm(iTime1);
-        time *= C::day;
+            // Extract field Id
+            Int fieldId = 0;
+            if (iSource >= 0) {
+                // make 0-based
+                fieldId = (Int) parm[iSource] - 1;
+            }
 
-        // Extract fqid
-        Int freqId = iFreq > 0 ? Int(_priGroup.parm(iFreq)) : 1;
+            // Extract array/baseline/antenna info
+            Int arrayId = 0;
+            std::pair<Int, Int> ants;
+            if (iBsln >= 0) {
+                Float baseline = parm[iBsln];
+                ants = _extractAntennas(baseline);
+                arrayId = Int(100.0 * (baseline - Int(baseline) + 0.001));
+            } else {
+                Int antenna1 = parm[iAnt1];
+                Int antenna2 = parm[iAnt2];
+                ants = _extractAntennas(antenna1, antenna2);
+                arrayId = parm[iSubarr];
+            }
+            _nArray = max(_nArray, arrayId + 1);
+            // Ensure arrayId-specific params are of correct length:
+            if (scanNumber.shape() < _nArray) {
+                scanNumber.resize(_nArray, True);
+                lastFieldId.resize(_nArray, True);
+                lastFreqId.resize(_nArray, True);
+                scanNumber(_nArray - 1) = 0;
+                lastFieldId(_nArray - 1) = -1;
+                lastFreqId(_nArray - 1) = -1;
+            }
 
-        // Extract field Id
-        Int fieldId = 0;
-        if (iSource >= 0) {
-            // make 0-based
-            fieldId = (Int) _priGroup.parm(iSource) - 1;
-        }
+            // Detect new scan (field or freqid change) for each arrayId
+            if (fieldId != lastFieldId(arrayId) || freqId != lastFreqId(arrayId)
+                    || time - lastFillTime > 300.0) {
+                scanNumber(arrayId)++;
+                lastFieldId(arrayId) = fieldId;
+                lastFreqId(arrayId) = freqId;
+            }
 
-        // Extract uvw
-        uvw(0) = _priGroup.parm(iU);
-        uvw(1) = _priGroup.parm(iV);
-        uvw(2) = _priGroup.parm(iW);
-        // Convert from units of seconds to meters
-        uvw *= C::c;
+            // If integration time is a RP, use it:
+            if (iInttim > -1) {
+                discernIntExp = False;
+                exposure = parm[iInttim];
+                interval = exposure;
+            } else {
+                // keep track of minimum which is the only one
+                // (if time step is larger than UVFITS precision (and zero))
+                discernIntExp = True;
+                Double tempint;
+                tempint = time - lastFillTime;
+                if (tempint > 0.01) {
+                    discernedInt = min(discernedInt, tempint);
+                }
+            }
 
-        // Extract array/baseline/antenna info
-        Int arrayId = 0;
-        std::pair<Int, Int> ants;
-        if (iBsln >= 0) {
-            Float baseline = _priGroup.parm(iBsln);
-            ants = _extractAntennas(baseline);
-            arrayId = Int(100.0 * (baseline - Int(baseline) + 0.001));
-        } else {
-            Int antenna1 = _priGroup.parm(iAnt1);
-            Int antenna2 = _priGroup.parm(iAnt2);
-            ants = _extractAntennas(antenna1, antenna2);
-            arrayId = _priGroup.parm(iSubarr);
-        }
-        _nArray = max(_nArray, arrayId + 1);
-        Int ant1 = ants.first;
-        Int ant2 = ants.second;
-        // Ensure arrayId-specific params are of correct length:
-        if (scanNumber.shape() < _nArray) {
-            scanNumber.resize(_nArray, True);
-            lastFieldId.resize(_nArray, True);
-            lastFreqId.resize(_nArray, True);
-            scanNumber(_nArray - 1) = 0;
-            lastFieldId(_nArray - 1) = -1;
-            lastFreqId(_nArray - 1) = -1;
-        }
+            for (Int ifno = 0; ifno < nif; ifno++) {
+                // IFs go to separate rows in the MS
+                const Int brow = group * nif + ifno;
+                const rownr_t row = firstRow + brow;
 
-        // Detect new scan (field or freqid change) for each arrayId
-        if (fieldId != lastFieldId(arrayId) || freqId != lastFreqId(arrayId)
-                || time - lastFillTime > 300.0) {
-            scanNumber(arrayId)++;
-            lastFieldId(arrayId) = fieldId;
-            lastFreqId(arrayId) = freqId;
-        }
+                // fill in values for all the unused columns
+                if (row == 0) {
+                    msc.feed1().put(row, 0);
+                    msc.feed2().put(row, 0);
+                    msc.flagRow().put(row, False);
+                    msc.processorId().put(row, -1);
+                    msc.observationId().put(row, 0);
+                    msc.stateId().put(row, -1);
+                }
 
-        // If integration time is a RP, use it:
-        if (iInttim > -1) {
-            discernIntExp = False;
-            exposure = _priGroup.parm(iInttim);
-            interval = exposure;
-        } else {
-            // keep track of minimum which is the only one
-            // (if time step is larger than UVFITS precision (and zero))
-            discernIntExp = True;
-            Double tempint;
-            tempint = time - lastFillTime;
-            if (tempint > 0.01) {
-                discernedInt = min(discernedInt, tempint);
-            }
-        }
+                // Fill scanNumber if changed since last row
+                if (scanNumber(arrayId) != lastFillScanNumber) {
+                    msc.scanNumber().put(row, scanNumber(arrayId));
+                    lastFillScanNumber = scanNumber(arrayId);
+                }
 
-        // Work out which axis increments fastests, pol or channel
-        // The COMPLEX axis is assumed to be first, and the IF axis is assumed
-        // to be after STOKES and FREQ.
-        Bool polFastest = (getIndex(_coordType, "STOKES") < getIndex(
-                _coordType, "FREQ"));
-        const Int nx = (polFastest ? nChan : nCorr);
-        const Int ny = (polFastest ? nCorr : nChan);
+                // If available, store interval/exposure
+                if (!discernIntExp) {
+                    msc.interval().put(row, interval);
+                    msc.exposure().put(row, exposure);
+                }
 
-        Int count = 0;
-        for (Int ifno = 0; ifno < max(1, _nIF); ifno++) {
-            // IFs go to separate rows in the MS
-            _ms.addRow();
-            row++;
+                if (arrayId != lastFillArrayId) {
+                    msc.arrayId().put(row, arrayId);
+                    lastFillArrayId = arrayId;
+                }
+                // Always put antenna1 & antenna2 since it is bound to the
+                // aipsStMan and is assumed to change every row
+                ant1(brow) = ants.first;
+                ant2(brow) = ants.second;
+                if (time != lastFillTime) {
+                    msc.time().put(row, time);
+                    msc.timeCentroid().put(row, time);
+                    lastFillTime = time;
+                }
+                // Extract uvw and convert from units of seconds to meters
+                uvw(0, brow) = parm[iU] * C::c;
+                uvw(1, brow) = parm[iV] * C::c;
+                uvw(2, brow) = parm[iW] * C::c;
 
-            // fill in values for all the unused columns
-            if (row == 0) {
-                msc.feed1().put(row, 0);
-                msc.feed2().put(row, 0);
-                msc.flagRow().put(row, False);
-                lastRowFlag = False;
-                msc.processorId().put(row, -1);
-                msc.observationId().put(row, 0);
-                msc.stateId().put(row, -1);
-            }
+                // determine the spectralWindowId
+                Int spW = ifno;
+                if (iFreq >= 0) {
+                    spW = (Int) parm[iFreq] - 1; // make 0-based
+                    if (_nIF > 0) {
+                        spW *= _nIF;
+                        spW += ifno;
+                    }
+                }
+                nSpW = max(nSpW, spW + 1);
 
-            // Fill scanNumber if changed since last row
-            if (scanNumber(arrayId) != lastFillScanNumber) {
-                msc.scanNumber().put(row, scanNumber(arrayId));
-                lastFillScanNumber = scanNumber(arrayId);
+                // Always put DDI (SSM) since it might change rapidly
+                datDescId(brow) = spW;
+
+                // store the fieldId
+                if (fieldId != lastFillFieldId) {
+                    msc.fieldId().put(row, fieldId);
+                    nField = max(nField, fieldId + 1);
+                    lastFillFieldId = fieldId;
+                }
             }
+        }
 
-            weight = 0.0;
+        // Convert the visibilities, weights and flags of all rows.
+        Complex* visData = vis.data();
+        Float* weightSpecData = weightSpec.data();
+        Bool* flagData = flag.data();
+        Float* weightData = weight.data();
+        Float* sigmaData = sigma.data();
+        Bool* rowFlagData = rowFlag.data();
+#ifdef _OPENMP
+#pragma omp parallel for if (nRow * nRowElem > 65536)
+#endif
+        for (Int brow = 0; brow < nRow; brow++) {
+            const Float* grp = data.data() + (brow / nif) * nElem
+                + (brow % nif) * 3 * nRowElem;
+            Complex* rvis = visData + brow * nRowElem;
+            Float* rweightSpec = weightSpecData + brow * nRowElem;
+            Bool* rflag = flagData + brow * nRowElem;
+            Float* rweight = weightData + brow * nCorr;
+            Float* rsigma = sigmaData + brow * nCorr;
+            for (Int nc = 0; nc < nCorr; nc++) {
+                rweight[nc] = 0.0;
+            }
             // Loop over chans and corrs:
+            Int count = 0;
             for (Int ix = 0; ix < nx; ix++) {
                 for (Int iy = 0; iy < ny; iy++) {
-                    const Float visReal = _priGroup(count++);
-                    const Float visImag = _priGroup(count++);
-                    const Float wt = _priGroup(count++);
-                    const Int pol = (polFastest ? _corrIndex[iy]
-                            : _corrIndex[ix]);
+                    const Float visReal = grp[count++];
+                    const Float visImag = grp[count++];
+                    const Float wt = grp[count++];
+                    const Int pol = (polFastest ? corrIndex[iy]
+                            : corrIndex[ix]);
                     const Int chan = (polFastest ? ix : iy);
+                    const Int64 inx = pol + Int64(chan) * nCorr;
                     if (wt <= 0.0) {
-                        weightSpec(pol, chan) = abs(wt);
-                        flag(pol, chan) = True;
-                        weight(pol) += abs(wt);
+                        rweightSpec[inx] = abs(wt);
+                        rflag[inx] = True;
+                        rweight[pol] += abs(wt);
                     } else {
-                        weightSpec(pol, chan) = wt;
-                        flag(pol, chan) = False;
+                        rweightSpec[inx] = wt;
+                        rflag[inx] = False;
                         // weight column is sum of weight_spectrum (each pol):
-                        weight(pol) += wt;
+                        rweight[pol] += wt;
                     }
-                    vis(pol, chan) = Complex(visReal, visImag);
+                    rvis[inx] = Complex(visReal, visImag);
                 }
             }
-
             // calculate sigma (weight = inverse variance)
             for (Int nc = 0; nc < nCorr; nc++) {
-                if (weight(nc) > 0.0) {
-                    sigma(nc) = sqrt(1.0 / weight(nc));
+                if (rweight[nc] > 0.0) {
+                    rsigma[nc] = sqrt(1.0 / rweight[nc]);
                 } else {
-                    sigma(nc) = 0.0;
-                }
-            }
-
-            // If available, store interval/exposure
-            if (!discernIntExp) {
-                msc.interval().put(row, interval);
-                msc.exposure().put(row, exposure);
-            }
-
-            msc.data().put(row, vis);
-
-            msc.weight().put(row, weight);
-            msc.sigma().put(row, sigma);
-            msc.weightSpectrum().put(row, weightSpec);
-
-            msc.flag().put(row, flag);
-            msc.flagCategory().put(row, flagCat);
-            Bool rowFlag = allEQ(flag, True);
-            if (rowFlag != lastRowFlag) {
-                msc.flagRow().put(row, rowFlag);
-                lastRowFlag = rowFlag;
-            }
-
-            if (arrayId != lastFillArrayId) {
-                msc.arrayId().put(row, arrayId);
-                lastFillArrayId = arrayId;
-            }
-            // Always put antenna1 & antenna2 since it is bound to the
-            // aipsStMan and is assumed to change every row
-            msc.antenna1().put(row, ant1);
-            msc.antenna2().put(row, ant2);
-            if (time != lastFillTime) {
-                msc.time().put(row, time);
-                msc.timeCentroid().put(row, time);
-                lastFillTime = time;
-            }
-            msc.uvw().put(row, uvw);
-
-            // determine the spectralWindowId
-            Int spW = ifno;
-            if (iFreq >= 0) {
-                spW = (Int) _priGroup.parm(iFreq) - 1; // make 0-based
-                if (_nIF > 0) {
-                    spW *= _nIF;
-                    spW += ifno;
+                    rsigma[nc] = 0.0;
                 }
             }
-            nSpW = max(nSpW, spW + 1);
-
-            // Always put DDI (SSM) since it might change rapidly
-            msc.dataDescId().put(row, spW);
+            rowFlagData[brow] = std::all_of(rflag, rflag + nRowElem,
+                                            [](Bool f) { return f; });
+        }
 
-            // store the fieldId
-            if (fieldId != lastFillFieldId) {
-                msc.fieldId().put(row, fieldId);
-                nField = max(nField, fieldId + 1);
-                lastFillFieldId = fieldId;
+        // Write FLAG_ROW if changed since last row.
+        for (Int brow = 0; brow < nRow; brow++) {
+            if (rowFlag(brow) != lastRowFlag) {
+                msc.flagRow().put(firstRow + brow, rowFlag(brow));
+                lastRowFlag = rowFlag(brow);
             }
         }
-        meter.update((group + 1) * 1.0);
+
+        // Write the block of rows. Use the first nRow rows of the buffers
+        // for the last (possibly smaller) block.
+        const Slicer rowRange(IPosition(1, firstRow), IPosition(1, nRow));
+        if (nRow == nBlockRow) {
+            msc.data().putColumnRange(rowRange, vis);
+            msc.weight().putColumnRange(rowRange, weight);
+            msc.sigma().putColumnRange(rowRange, sigma);
+            msc.weightSpectrum().putColumnRange(rowRange, weightSpec);
+            msc.flag().putColumnRange(rowRange, flag);
+            msc.flagCategory().putColumnRange(rowRange, flagCat);
+            msc.uvw().putColumnRange(rowRange, uvw);
+            msc.antenna1().putColumnRange(rowRange, ant1);
+            msc.antenna2().putColumnRange(rowRange, ant2);
+            msc.dataDescId().putColumnRange(rowRange, datDescId);
+        } else {
+            const IPosition end3(3, nCorr - 1, nChan - 1, nRow - 1);
+            const IPosition end2(2, nCorr - 1, nRow - 1);
+            msc.data().putColumnRange(rowRange, vis(IPosition(3, 0), end3));
+            msc.weight().putColumnRange(rowRange,
+                    weight(IPosition(2, 0), end2));
+            msc.sigma().putColumnRange(rowRange,
+                    sigma(IPosition(2, 0), end2));
+            msc.weightSpectrum().putColumnRange(rowRange,
+                    weightSpec(IPosition(3, 0), end3));
+            msc.flag().putColumnRange(rowRange, flag(IPosition(3, 0), end3));
+            msc.flagCategory().putColumnRange(rowRange,
+                    flagCat(IPosition(4, 0),
+                            IPosition(4, nCorr - 1, nChan - 1, nCat - 1,
+                                      nRow - 1)));
+            msc.uvw().putColumnRange(rowRange,
+                    uvw(IPosition(2, 0), IPosition(2, 2, nRow - 1)));
+            msc.antenna1().putColumnRange(rowRange, ant1(Slice(0, nRow)));
+            msc.antenna2().putColumnRange(rowRange, ant2(Slice(0, nRow)));
+            msc.dataDescId().putColumnRange(rowRange,
+                    datDescId(Slice(0, nRow)));
+        }
+        meter.update((startGroup + nGroup) * 1.0);
     }
     // If determining interval on-the-fly, fill interval/exposure columns
     //  now:
@@ -234,6 +234,21 @@ public:
   Double operator () (Int i) const
   { return pf ? (*pf)(i) : ( pl ? (*pl)(i) : (*ps)(i));}
 
+  // Number of data values in a group
+  Int64 nelements()
+  { Int64 n = 1; for (Int i=0; i<dims(); ++i) n *= dim(i); return n; }
+
+  // Copy all parameters of the current group, scaled to Double
+  void copyparm(Double* target) const
+  { if (pf) pf->copyparm(target); else if (pl) pl->copyparm(target);
+    else ps->copyparm(target); }
+
+  // Copy the data of the current group, scaled to Float
+  // (blanked values are set to NaN)
+  void copy(Float* target) const
+  { if (pf) pf->copy(target); else if (pl) pl->copy(target);
+    else ps->copy(target); }
+
 private:
   HeaderDataUnit* hdu_p;
   PrimaryGroup<Short>* ps;
@@ -40,10 +40,13 @@
 #include <casacore/fits/FITS/fitsio.h>
 #include <casacore/fits/FITS/FITSTable.h>
 #include <casacore/fits/FITS/FITSDateUtil.h>
+#include <casacore/casa/Arrays/Cube.h>
 #include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/MatrixMath.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/casa/BasicSL/Constants.h>
 #include <casacore/casa/Quanta/MVAngle.h>
@@ -65,8 +68,13 @@
 
 #include <casacore/casa/Logging/LogIO.h>
 
-#include <set>
+#include <algorithm>
+#include <deque>
+#include <future>
 #include <limits>
+#include <memory>
+#include <set>
+#include <vector>
 
 namespace casacore {
 
@@ -77,7 +85,7 @@ MSFitsOutput::MSFitsOutput(
     _startChan(0), _nchan(1), _stepChan(1), _avgChan(1),
     _writeSysCal(False), _asMultiSource(False), _combineSpw(False),
     _writeStation(False), _padWithFlags(False), _overwrite(False),
-    _sensitivity(1.0), _fieldNumber(0) {}
+    _sensitivity(1.0), _fieldNumber(0), _memoryInMB(256) {}
 
 void MSFitsOutput::setChannelInfo(
     Int startChan, Int nchan, Int stepChan, Int avgChan
@@ -120,6 +128,10 @@ void MSFitsOutput::setOverwrite(Bool overwrite) {
     _overwrite = overwrite;
 }
 
+void MSFitsOutput::setMemory(uInt memoryInMB) {
+    _memoryInMB = std::max(1u, memoryInMB);
+}
+
 static String toFITSDate(const MVTime &time) {
     String date, timesys;
     FITSDateUtil::toFITS(date, timesys, time);
@@ -319,7 +331,7 @@ Bool MSFitsOutput::writeFitsFile(
 	Int nchan, Int stepchan, Bool writeSysCal, Bool asMultiSource,
 	Bool combineSpw, Bool writeStation, Double sensitivity,
 	const Bool padWithFlags, Int avgchan, uInt fieldNumber,
-	Bool overwrite
+	Bool overwrite, uInt memoryInMB
 ) {
     // A FITS table can handle only Int nrows.
     if (ms.nrow() > static_cast<rownr_t>(std::numeric_limits<Int>::max())) {
@@ -335,6 +347,7 @@ Bool MSFitsOutput::writeFitsFile(
     out.setPadWitFlags(padWithFlags);
     out.setFieldNumber(fieldNumber);
     out.setOverwrite(overwrite);
+    out.setMemory(memoryInMB);
     out.write();
     return True;
 }
@@ -381,6 +394,241 @@ static void defineRandomParam(Record& ek, Int n, const String& name,
     ek.setComment(ptype, comment);
 }
 
+namespace {
+
+  // The columns of a range of rows of the sorted MS needed to write the
+  // UVFITS groups.
+  struct MSFitsRowBlock {
+    rownr_t startRow;
+    rownr_t nrow;
+    Cube<Complex> data;
+    Cube<Bool> flag;
+    Cube<Float> weightSpectrum;
+    // Tells per row if WEIGHT_SPECTRUM has the correct shape.
+    Vector<Bool> hasWeightSpectrum;
+    Matrix<Float> weight;
+    Vector<Bool> flagRow;
+    Matrix<Double> uvw;
+    Vector<Double> timeCentroid;
+    Vector<Int> antenna1;
+    Vector<Int> antenna2;
+    Vector<Int> arrayId;
+    Vector<Int> dataDescId;
+    Vector<Int> fieldId;
+    Vector<Double> exposure;
+  };
+
+  // Read the sorted MS in blocks of rows. The next block is read in a
+  // background thread, so the MS must not be accessed otherwise while
+  // this object exists. Rows have to be accessed in about ascending order;
+  // a row can be at most one block before the last row accessed.
+  class MSFitsRowReader {
+  public:
+    MSFitsRowReader (const Table& sortTable, const String& dataColumn,
+                     Bool hasWeightArray, Bool asMultiSource,
+                     Int numcorr, Int numchan, rownr_t blockRows)
+      : itsData        (sortTable, dataColumn),
+        itsFlag        (sortTable, MS::columnName(MS::FLAG)),
+        itsWeight      (sortTable, MS::columnName(MS::WEIGHT)),
+        itsFlagRow     (sortTable, MS::columnName(MS::FLAG_ROW)),
+        itsUvw         (sortTable, MS::columnName(MS::UVW)),
+        itsTimeCentroid(sortTable, MS::columnName(MS::TIME_CENTROID)),
+        itsAntenna1    (sortTable, MS::columnName(MS::ANTENNA1)),
+        itsAntenna2    (sortTable, MS::columnName(MS::ANTENNA2)),
+        itsArrayId     (sortTable, MS::columnName(MS::ARRAY_ID)),
+        itsDataDescId  (sortTable, MS::columnName(MS::DATA_DESC_ID)),
+        itsShape       (2, numcorr, numchan),
+        itsNrow        (sortTable.nrow()),
+        itsBlockRows   (blockRows)
+    {
+      if (hasWeightArray) {
+        itsWeightSpectrum.attach (sortTable,
+                                  MS::columnName(MS::WEIGHT_SPECTRUM));
+      }
+      if (asMultiSource) {
+        itsFieldId.attach (sortTable, MS::columnName(MS::FIELD_ID));
+        itsExposure.attach (sortTable, MS::columnName(MS::EXPOSURE));
+      }
+      itsNext = std::async (std::launch::async, &MSFitsRowReader::read,
+                            this, rownr_t(0));
+    }
+
+    // The destructor waits for a pending read.
+    ~MSFitsRowReader()
+    {
+      if (itsNext.valid()) {
+        itsNext.wait();
+      }
+    }
+
+    // Get the block containing the given row.
+    const MSFitsRowBlock& block (rownr_t row)
+    {
+      const MSFitsRowBlock* blk = find (row);
+      while (!blk) {
+        AlwaysAssert (itsNext.valid(), AipsError);
+        itsBlocks.push_back (itsNext.get());
+        // Keep at most two blocks (the one being used and the next one).
+        if (itsBlocks.size() > 2) {
+          itsBlocks.pop_front();
+        }
+        rownr_t next = itsBlocks.back()->startRow + itsBlocks.back()->nrow;
+        if (next < itsNrow) {
+          itsNext = std::async (std::launch::async, &MSFitsRowReader::read,
+                                this, next);
+        }
+        blk = find (row);
+      }
+      return *blk;
+    }
+
+    // Find the block containing the given row. A null pointer is returned
+    // if the block is not in memory. It can be used by multiple threads.
+    const MSFitsRowBlock* find (rownr_t row) const
+    {
+      for (const std::shared_ptr<MSFitsRowBlock>& blk : itsBlocks) {
+        if (row >= blk->startRow  &&  row < blk->startRow + blk->nrow) {
+          return blk.get();
+        }
+      }
+      return 0;
+    }
+
+  private:
+    // Read the block starting at the given row.
+    std::shared_ptr<MSFitsRowBlock> read (rownr_t startRow) const
+    {
+      std::shared_ptr<MSFitsRowBlock> blk(new MSFitsRowBlock());
+      blk->startRow = startRow;
+      blk->nrow = std::min (itsBlockRows, itsNrow - startRow);
+      Slicer rows(IPosition(1, startRow), IPosition(1, blk->nrow));
+      blk->data.reference (itsData.getColumnRange (rows));
+      blk->flag.reference (itsFlag.getColumnRange (rows));
+      blk->weight.reference (itsWeight.getColumnRange (rows));
+      blk->flagRow.reference (itsFlagRow.getColumnRange (rows));
+      blk->uvw.reference (itsUvw.getColumnRange (rows));
+      blk->timeCentroid.reference (itsTimeCentroid.getColumnRange (rows));
+      blk->antenna1.reference (itsAntenna1.getColumnRange (rows));
+      blk->antenna2.reference (itsAntenna2.getColumnRange (rows));
+      blk->arrayId.reference (itsArrayId.getColumnRange (rows));
+      blk->dataDescId.reference (itsDataDescId.getColumnRange (rows));
+      if (! itsFieldId.isNull()) {
+        blk->fieldId.reference (itsFieldId.getColumnRange (rows));
+        blk->exposure.reference (itsExposure.getColumnRange (rows));
+      }
+      // WEIGHT_SPECTRUM is only used in rows where it has the correct shape.
+      blk->hasWeightSpectrum.resize (blk->nrow);
+      blk->hasWeightSpectrum = False;
+      if (! itsWeightSpectrum.isNull()) {
+        for (rownr_t i=0; i<blk->nrow; ++i) {
+          blk->hasWeightSpectrum[i] =
+            itsWeightSpectrum.shape(startRow+i).isEqual (itsShape);
+        }
+        if (allTrue (blk->hasWeightSpectrum)) {
+          blk->weightSpectrum.reference
+            (itsWeightSpectrum.getColumnRange (rows));
+        } else if (anyTrue (blk->hasWeightSpectrum)) {
+          blk->weightSpectrum.resize (itsShape[0], itsShape[1], blk->nrow);
+          for (rownr_t i=0; i<blk->nrow; ++i) {
+            if (blk->hasWeightSpectrum[i]) {
+              Matrix<Float> wt(blk->weightSpectrum.xyPlane(i));
+              itsWeightSpectrum.get (startRow+i, wt);
+            }
+          }
+        }
+      }
+      return blk;
+    }
+
+    ArrayColumn<Complex> itsData;
+    ArrayColumn<Bool>    itsFlag;
+    ArrayColumn<Float>   itsWeight;
+    ArrayColumn<Float>   itsWeightSpectrum;
+    ScalarColumn<Bool>   itsFlagRow;
+    ArrayColumn<Double>  itsUvw;
+    ScalarColumn<Double> itsTimeCentroid;
+    ScalarColumn<Int>    itsAntenna1;
+    ScalarColumn<Int>    itsAntenna2;
+    ScalarColumn<Int>    itsArrayId;
+    ScalarColumn<Int>    itsDataDescId;
+    ScalarColumn<Int>    itsFieldId;
+    ScalarColumn<Double> itsExposure;
+    IPosition            itsShape;
+    rownr_t              itsNrow;
+    rownr_t              itsBlockRows;
+    std::deque<std::shared_ptr<MSFitsRowBlock>> itsBlocks;
+    std::future<std::shared_ptr<MSFitsRowBlock>> itsNext;
+  };
+
+  // Select and average the channels of an MS row and store them as
+  // UVFITS (real, imag, weight) triplets. A flagged average gets a negative
+  // weight. If wsptr (WEIGHT_SPECTRUM) is null, the channel weights are
+  // WEIGHT divided by the number of channels.
+  // It returns the output pointer incremented by the values stored.
+  Float* convertFitsRow (Float* outptr, const Complex* iptr, const Bool* fptr,
+                       const Float* wsptr, const Float* weight, Bool rowFlag,
+                       const uInt* indptr, Int numcorr0, Int numchan0,
+                       Int chanstart, Int nchan, Int chanstep, Int avgchan)
+  {
+    std::vector<Float> realcorr(numcorr0, 0);
+    std::vector<Float> imagcorr(numcorr0, 0);
+    std::vector<Float> wgtaver(numcorr0, 0);
+    std::vector<Float> realcorrf(numcorr0, 0);
+    std::vector<Float> imagcorrf(numcorr0, 0);
+    std::vector<Float> wgtaverf(numcorr0, 0);
+    std::vector<Int> flagcounter(numcorr0, 0);
+    Int chancounter = 0;
+    for (Int k = chanstart; k < (nchan * chanstep + chanstart); k += chanstep) {
+      if (chancounter != avgchan) {
+        for (Int j = 0; j < numcorr0; j++) {
+          Int offset = indptr[j] + k * numcorr0;
+          Float wt = (wsptr ? wsptr[offset] : weight[indptr[j]] / numchan0);
+          if (!fptr[offset]) {
+            realcorr[j] += iptr[offset].real();
+            imagcorr[j] += iptr[offset].imag();
+            wgtaver[j] += wt;
+            flagcounter[j]++;
+          } else {
+            realcorrf[j] += iptr[offset].real();
+            imagcorrf[j] += iptr[offset].imag();
+            wgtaverf[j] += wt;
+          }
+        }
+        ++chancounter;
+      }
+      if (chancounter == avgchan) {
+        for (Int j = 0; j < numcorr0; j++) {
+          if (flagcounter[j] > 0) {
+            outptr[0] = realcorr[j] / flagcounter[j];
+            outptr[1] = imagcorr[j] / flagcounter[j];
+            outptr[2] = wgtaver[j] / flagcounter[j];
+          } else if (wgtaverf[j] > 0) {
+            outptr[0] = realcorrf[j] / avgchan;
+            outptr[1] = imagcorrf[j] / avgchan;
+            outptr[2] = -wgtaverf[j] / avgchan;
+          } else {
+            outptr[0] = realcorrf[j] / avgchan;
+            outptr[1] = imagcorrf[j] / avgchan;
+            outptr[2] = 0;
+          }
+          if (rowFlag) {
+            //calculate the average even if row flagged, just in case
+            //unflag the row and it has some reasonable data there
+            outptr[2] = -abs(outptr[2]);
+          }
+          outptr += 3;
+          realcorr[j] = imagcorr[j] = wgtaver[j] = 0;
+          realcorrf[j] = imagcorrf[j] = wgtaverf[j] = 0;
+          flagcounter[j] = 0;
+        }
+        chancounter = 0;
+      }
+    }
+    return outptr;
+  }
+
+} // end anonymous namespace
+
 std::shared_ptr<FitsOutput> MSFitsOutput::_writeMain(Int& refPixelFreq, Double& refFreq,
     Double& chanbw, const String &outFITSFile,
     const Block<Int>& spwidMap, Int nrspw,
@@ -852,25 +1100,9 @@ std::shared_ptr<FitsOutput> MSFitsOutput::_writeMain(Int& refPixelFreq, Double&
     // Similarly, record the sort order (the following didn't work....)
     //  ek.define("history aips sort order", "TB");
 
-    Bool deleteIptr;
-    Matrix<Complex> indatatmp(IPosition(2, numcorr0, numchan0));
-    const Complex *iptr = indatatmp.getStorage(deleteIptr);
-
-    Bool deleteWtPtr;
-    Matrix<Float> inwttmp(numcorr0, numchan0);
-    const Float *wptr = inwttmp.getStorage(deleteWtPtr);
-
-    Bool deleteFlagPtr;
-    Matrix<Bool> inflagtmp(IPosition(2, numcorr0, numchan0));
-    const Bool *fptr = inflagtmp.getStorage(deleteFlagPtr);
-
-    Bool deleteIndPtr;
-    const uInt *indptr = stokesIndex.getStorage(deleteIndPtr);
-
     // Do we need to check units? I think the MS rules are that units cannot
     // be changed.
 
-    Vector<Double> uvw(3);
     Int day;
     Double dayFraction;
 
@@ -894,21 +1126,16 @@ std::shared_ptr<FitsOutput> MSFitsOutput::_writeMain(Int& refPixelFreq, Double&
     }
     Table sortTable = _ms.sort(sortNames);
 
-    // Make objects for the various columns.
-    ArrayColumn<Complex> indata(sortTable, columnName);
-    ArrayColumn<Float> inweightscalar(sortTable, MS::columnName(MS::WEIGHT));
+    // Make objects for the columns used to determine the output rows.
+    // The other columns are read by an MSFitsRowReader.
     ArrayColumn<Float> inweightarray;
     if (hasWeightArray) {
         inweightarray.attach(sortTable, MS::columnName(MS::WEIGHT_SPECTRUM));
     }
-    ScalarColumn<Bool> inrowflag(sortTable, MS::columnName(MS::FLAG_ROW));
-    ArrayColumn<Bool> indataflag(sortTable, MS::columnName(MS::FLAG));
-    ArrayColumn<Double> inuvw(sortTable, MS::columnName(MS::UVW));
     ScalarColumn<Double>
             intimec(sortTable, MS::columnName(MS::TIME_CENTROID));
     ScalarColumn<Int> inant1(sortTable, MS::columnName(MS::ANTENNA1));
     ScalarColumn<Int> inant2(sortTable, MS::columnName(MS::ANTENNA2));
-    ScalarColumn<Int> inarray(sortTable, MS::columnName(MS::ARRAY_ID));
     ScalarColumn<Int> inspwinid(sortTable, MS::columnName(MS::DATA_DESC_ID));
 
     ScalarColumn<Double> inexposure;
@@ -1082,13 +1309,42 @@ std::shared_ptr<FitsOutput> MSFitsOutput::_writeMain(Int& refPixelFreq, Double&
     // Check if first cell has a WEIGHT of correct shape.
     if (hasWeightArray) {
         IPosition shp = inweightarray.shape(0);
-        if (shp.nelements() > 0 && !shp.isEqual(inwttmp.shape())) {
+        if (shp.nelements() > 0
+                && !shp.isEqual(IPosition(2, numcorr0, numchan0))) {
             hasWeightArray = False;
             os << LogIO::WARN << "WEIGHT_SPECTRUM is ignored (incorrect shape)"
                     << LogIO::POST;
         }
     }
 
+    // The MS is read in blocks of rows in a background thread, while the
+    // previous block is converted (in parallel) and written. The block size
+    // is such that at most three blocks (two in use and one being read)
+    // and the converted groups fit in the memory given.
+    const Int64 nInData = Int64(numcorr0) * numchan0;
+    const Int64 inRowBytes = nInData * (sizeof(Complex) + sizeof(Bool)
+            + (hasWeightArray ? sizeof(Float) : 0))
+            + numcorr0 * sizeof(Float) + 64;
+    const Int64 outRowSize = dataShape.product();
+    Int64 blockRows = Int64(_memoryInMB) * 1024 * 1024
+        / (3 * inRowBytes + outRowSize * Int64(sizeof(Float)) / nif);
+    blockRows = std::min(std::max(blockRows, Int64(2 * nif)), Int64(nrow));
+    const uInt maxOutRows = std::max(Int64(1), blockRows / nif);
+    os << LogIO::DEBUG1 << "Reading the MS in blocks of " << blockRows
+            << " rows" << LogIO::POST;
+    std::vector<Float> outData(maxOutRows * outRowSize, 0);
+    // Per output row the first input row and per IF the input row used
+    // (-1 means a flagged padding row).
+    std::vector<uInt> planRow(maxOutRows);
+    std::vector<Int64> planIF(Int64(maxOutRows) * nif);
+    // The data of a flagged padding row.
+    Vector<Complex> padData(nInData, Complex(0));
+    Vector<Bool> padFlag(nInData, True);
+    Vector<Float> padWeight(nInData, 0);
+    const uInt* indptr = stokesIndex.data();
+    MSFitsRowReader reader(sortTable, columnName, hasWeightArray,
+            asMultiSource, numcorr0, numchan0, blockRows);
+
     // Loop through all rows.
     ProgressMeter meter(0.0, nOutRow * 1.0, "UVFITS Writer", "Rows copied", "",
             "", True, nOutRow / 100);
@@ -1096,352 +1352,205 @@ std::shared_ptr<FitsOutput> MSFitsOutput::_writeMain(Int& refPixelFreq, Double&
     uInt tbfrownr = 0; // Input row # of (time, baseline, field).
     uInt outrownr = 0; // Output row #.
 
-    //Double lasttime(0.0);
-    Vector<Float> realcorr(numcorr0);
-    Vector<Float> imagcorr(numcorr0);
-    Vector<Float> wgtaver(numcorr0);
-    Vector<Float> realcorrf(numcorr0);
-    Vector<Float> imagcorrf(numcorr0);
-    Vector<Float> wgtaverf(numcorr0);
     Int old_nspws_found = -1; // Just for debugging curiosity.
-    while (tbfrownr < nrow) {
-        if (outrownr >= nOutRow) { // Shouldn't happen, but just in case...
-            os << LogIO::WARN
-                    << "The loop over output rows failed to stop when expected...stopping it now."
-                    << LogIO::POST;
-            break;
-        }
-
-        // Will only write a record if some non-flagged data found
-        //    Bool dowrite(True);   // temporarily disable, because FITSGroupWriter chokes
-
-        Float* outptr = optr; // reset for each spectral-window
-
-        // Loop over the IFs, whether or not the corresponding spws are present for
-        // this (time, baseline, field).
-        // rownr should only be used inside this loop; use tbfrownr outside.
-        uInt rawrownr = tbfrownr; // Essentially tbfrownr + m - # of missing spws
-        // so far.
-        uInt rownr = rawrownr;
-        uInt tbfend = tbfrownr + nif - 1;
-        if (_combineSpw && nif > 1) {
-            tbfend = tbfends[rownr];
-            rownr = sortIndex[rawrownr];
-        }
-
-        for (uInt m = 0; m < nif; ++m) {
-            Bool rowFlag; // FLAG_ROW
-
-            if (_combineSpw && (rownr >= nrow // flag remaining IFs in tbfrownr
-                    || inspwinid(rownr) != expectedDDIDs[m])) {
-                if (padWithFlags) {
-                    // Save this row for the next one, and fill in with flagged junk.
-
-                    indatatmp.set(0.0); // DATA matrix
-                    //indata.get(rownr, indatatmp);   // DATA matrix
-                    rowFlag = true;
-                    inflagtmp.set(true);
-                    inwttmp.set(0.0);
-                    // Don't update lasttime.
-                } else {
-                    os << LogIO::SEVERE
-                            << "A DATA_DESC_ID appeared out of the expected order.\n"
-                            << "MSes with multiple tunings (i.e. spw varies with time) cannot"
-                            << "\nbe exported with combinespw.  Export each tuning separately."
-                            << LogIO::POST;
-                    return 0;
-                }
-            } else { // The spw is present, use it.
-                if (rownr >= nrow) { // Shouldn't happen, but just in case...
-                    os << LogIO::WARN
-                            << "The loop over input rows failed to stop when expected...stopping it now."
-                            << LogIO::POST;
-                    break;
-                }
-
-                indata.get(rownr, indatatmp); // DATA matrix
-                rowFlag = inrowflag(rownr);
-                indataflag.get(rownr, inflagtmp); // FLAG
-
-                // WEIGHT_SPECTRUM (defaults to WEIGHT)
-                Bool getwt = True;
-                if (hasWeightArray) {
-                    IPosition shp = inweightarray.shape(rownr);
-                    if (shp.isEqual(inwttmp.shape())) {
-                        inweightarray.get(rownr, inwttmp);
-                        getwt = False;
-                    }
-                }
-                if (getwt) {
-                    //weight_spectrum may not exist but flag and data always will.
-                    IPosition shp = indatatmp.shape();
-                    Int nchan = shp(1); // either num of channels of num of lags
-                    //cout << "shp1=" << shp << " shp2=" << inflagtmp.shape()
-                    //     << " nchan=" << nchan << endl;
-                    if (nchan < 1) nchan = 1;
-                    const Vector<Float> wght = inweightscalar(rownr);
-                    for (Int p = 0; p < numcorr0; p++) {
-                        inwttmp.row(p) = wght(p) / nchan;
-                    }
-                }
-                /*
-                 Double rtime(86400.0*floor(intimec(0)/86400.0));
-                 cout << "rtime = " << rtime << " " << "nrows = " << intimec.nrow()
-                 << endl;
-                 cout << "time = " << intimec(rownr)-rtime;
-                 if (intimec(rownr)!=lasttime)
-                 cout << " ***NEW*** ";
-                 cout << endl;
-                 */
-                // lasttime = intimec(rownr);
-
-                if (! padWithFlags || rawrownr <= tbfend) {
-                    ++rawrownr; // register that the spw was present.
-                    rownr = _combineSpw && nif > 1
-                        ? sortIndex[rawrownr] : rawrownr;
-                }
+    Bool stop = False;
+    while (tbfrownr < nrow && !stop) {
+        // Determine the input rows of the output rows starting in the
+        // current block. It has to be done sequentially, because the number
+        // of input rows per output row varies.
+        const rownr_t blockEnd = reader.block(tbfrownr).startRow
+            + reader.block(tbfrownr).nrow;
+        uInt nOut = 0;
+        while (tbfrownr < nrow && tbfrownr < blockEnd && nOut < maxOutRows) {
+            if (outrownr + nOut >= nOutRow) { // Shouldn't happen, but just in case...
+                os << LogIO::WARN
+                        << "The loop over output rows failed to stop when expected...stopping it now."
+                        << LogIO::POST;
+                stop = True;
+                break;
+            }
+            Int64* ifRows = &planIF[Int64(nOut) * nif];
+
+            // Loop over the IFs, whether or not the corresponding spws are
+            // present for this (time, baseline, field).
+            // rownr should only be used inside this loop; use tbfrownr outside.
+            uInt rawrownr = tbfrownr; // Essentially tbfrownr + m - # of missing spws
+            // so far.
+            uInt rownr = rawrownr;
+            uInt tbfend = tbfrownr + nif - 1;
+            if (_combineSpw && nif > 1) {
+                tbfend = tbfends[rownr];
+                rownr = sortIndex[rawrownr];
             }
 
-            // We should optimize this loop more, probably do frequency as
-            // the inner loop?
-            realcorr.set(0);
-            imagcorr.set(0);
-            wgtaver.set(0);
-            realcorrf.set(0);
-            imagcorrf.set(0);
-            wgtaverf.set(0);
-            Int chancounter = 0;
-            Vector<Int> flagcounter(numcorr0);
-            flagcounter.set(0);
-            //cout << "chanstart=" << chanstart << " nchan=" << nchan
-            //     << " chanstep=" << chanstep << " avgchan=" << avgchan << endl;
-            for (Int k = chanstart; k < (nchan * chanstep + chanstart); k += chanstep) {
-                //cout << "row = " << tbfrownr << " "
-                //   << outptr << " " << optr << " " << outptr-optr << " ";
-                //   << "ddi = " << m << " (" << inspwinid(i) << ") "
-                //   << "chan = " << k << " / "
-                //   << boolalpha
-                //   << "hasWeightArray = " << hasWeightArray << " "
-                //   << "wt(chan) = " << inwttmp.column(k) << "; "
-                //   << "flag(chan) = " << inflagtmp.column(k) << " "
-                //   << "shapes: "
-                //   << indatatmp.shape() << " "
-                //   << inwttmp.shape()  << " "
-                //   << inflagtmp.shape()  << " "
-                //   << endl;
-                /*
-                if (chancounter != avgchan) {
-                    for (Int j = 0; j < numcorr0; j++) {
-                        Int offset = indptr[j] + k * numcorr0;
-                        //cout << "j=" << j << " real=" << iptr[offset].real()
-                        //     << " imag=" << iptr[offset].imag() << endl;
-                        if (!fptr[offset]) {
-                            realcorr[j] += iptr[offset].real() * wptr[offset];
-                            imagcorr[j] += iptr[offset].imag() * wptr[offset];
-                            wgtaver[j] += wptr[offset];
-                            flagcounter++;
-                        }
-                        else {
-                            realcorrf[j] += iptr[offset].real() * wptr[offset];
-                            imagcorrf[j] += iptr[offset].imag() * wptr[offset];
-                            wgtaverf[j] += wptr[offset];
-                        }
-                        //cout << "j=" << j << " k=" << k
-                        //     << " real=" << realcorr[j] << " image=" << imagcorr[j]
-                        //     << " offset=" << offset << " chancounter=" << chancounter << endl;
+            for (uInt m = 0; m < nif; ++m) {
+                if (_combineSpw && (rownr >= nrow // flag remaining IFs in tbfrownr
+                        || reader.block(rownr).dataDescId
+                               (rownr - reader.block(rownr).startRow)
+                           != expectedDDIDs[m])) {
+                    if (padWithFlags) {
+                        // Save this row for the next one, and fill in with
+                        // flagged junk.
+                        ifRows[m] = -1;
+                    } else {
+                        os << LogIO::SEVERE
+                                << "A DATA_DESC_ID appeared out of the expected order.\n"
+                                << "MSes with multiple tunings (i.e. spw varies with time) cannot"
+                                << "\nbe exported with combinespw.  Export each tuning separately."
+                                << LogIO::POST;
+                        return 0;
                     }
-                    ++chancounter;
-                }
-                if (chancounter == avgchan) {
-                    for (Int j = 0; j < numcorr0; j++) {
-                        if (wgtaver[j] > 0) {
-                            outptr[0] = realcorr[j] / wgtaver[j];
-                            outptr[1] = imagcorr[j] / wgtaver[j];
-                            outptr[2] = wgtaver[j] / flagcounter * numcorr0;
-                        }
-                        else if (wgtaverf[j] > 0) {
-                            outptr[0] = realcorrf[j] / wgtaverf[j];
-                            outptr[1] = imagcorrf[j] / wgtaverf[j];
-                            outptr[2] = -wgtaverf[j] / avgchan;
-                        }
-                        else {
-                            outptr[0] = realcorrf[j] / avgchan;
-                            outptr[1] = imagcorrf[j] / avgchan;
-                            outptr[2] = 0;
+                } else { // The spw is present, use it.
+                    if (rownr >= nrow) { // Shouldn't happen, but just in case...
+                        os << LogIO::WARN
+                                << "The loop over input rows failed to stop when expected...stopping it now."
+                                << LogIO::POST;
+                        for (; m < nif; ++m) {
+                            ifRows[m] = -1;
                         }
-                        if (rowFlag) {
-                            //calculate the average even if row flagged, just in case
-                            //unflag the row and it has some reasonable data there
-                            outptr[2] = -abs(outptr[2]);
-                        }
-                        outptr += 3;
+                        break;
                     }
-                    realcorr.set(0);
-                    imagcorr.set(0);
-                    wgtaver.set(0);
-                    realcorrf.set(0);
-                    imagcorrf.set(0);
-                    wgtaverf.set(0);
-                    chancounter = 0;
-                    flagcounter = 0;
-                }
-                */
-                if (chancounter != avgchan) {
-                    for (Int j = 0; j < numcorr0; j++) {
-                        Int offset = indptr[j] + k * numcorr0;
-                        //cout << "j=" << j << " real=" << iptr[offset].real()
-                        //     << " imag=" << iptr[offset].imag() << endl;
-                        if (!fptr[offset]) {
-                            realcorr[j] += iptr[offset].real();
-                            imagcorr[j] += iptr[offset].imag();
-                            wgtaver[j] += wptr[offset];
-                            flagcounter[j]++;
-                        }
-                        else {
-                            realcorrf[j] += iptr[offset].real();
-                            imagcorrf[j] += iptr[offset].imag();
-                            wgtaverf[j] += wptr[offset];
-                        }
-                        //cout << "j=" << j << " k=" << k
-                        //     << " real=" << realcorr[j] << " image=" << imagcorr[j]
-                        //     << " offset=" << offset << " chancounter=" << chancounter << endl;
+                    // Make sure the block of the row is in memory.
+                    reader.block(rownr);
+                    ifRows[m] = rownr;
+                    if (! padWithFlags || rawrownr <= tbfend) {
+                        ++rawrownr; // register that the spw was present.
+                        rownr = _combineSpw && nif > 1
+                            ? sortIndex[rawrownr] : rawrownr;
                     }
-                    ++chancounter;
                 }
-                if (chancounter == avgchan) {
-                    for (Int j = 0; j < numcorr0; j++) {
-                        if (flagcounter[j] > 0) {
-                            outptr[0] = realcorr[j] / flagcounter[j];
-                            outptr[1] = imagcorr[j] / flagcounter[j];
-                            outptr[2] = wgtaver[j] / flagcounter[j];
-                        }
-                        else if (wgtaverf[j] > 0) {
-                            outptr[0] = realcorrf[j] / avgchan;
-                            outptr[1] = imagcorrf[j] / avgchan;
-                            outptr[2] = -wgtaverf[j] / avgchan;
-                        }
-                        else {
-                            outptr[0] = realcorrf[j] / avgchan;
-                            outptr[1] = imagcorrf[j] / avgchan;
-                            outptr[2] = 0;
-                        }
-                        if (rowFlag) {
-                            //calculate the average even if row flagged, just in case
-                            //unflag the row and it has some reasonable data there
-                            outptr[2] = -abs(outptr[2]);
-                        }
-                        outptr += 3;
-                    }
-                    realcorr.set(0);
-                    imagcorr.set(0);
-                    wgtaver.set(0);
-                    realcorrf.set(0);
-                    imagcorrf.set(0);
-                    wgtaverf.set(0);
-                    chancounter = 0;
-                    flagcounter.set(0);
+            } // Ends loop over IFs.
+            planRow[nOut] = tbfrownr;
+            ++nOut;
+
+            // How many spws showed up for this (time_centroid, ant1, ant2, field)?
+            const MSFitsRowBlock& blk = reader.block(tbfrownr);
+            const rownr_t brow = tbfrownr - blk.startRow;
+            if (rawrownr == tbfrownr) {
+                os << LogIO::WARN << "No spectral windows were present for row # "
+                        << tbfrownr << "\n"
+                        << " input (time_centroid, ant1, ant2, field) =\n" << "  ("
+                        << blk.timeCentroid(brow) << ", " << blk.antenna1(brow)
+                        << ", " << blk.antenna2(brow) << ", "
+                        << (asMultiSource ? blk.fieldId(brow) : 0) << ")"
+                        << LogIO::POST;
+            } else {
+                Int nspws_found = rawrownr - tbfrownr; // Just for debugging curiosity.
+
+                if (nspws_found != old_nspws_found) {
+                    old_nspws_found = nspws_found;
+                    os << LogIO::DEBUG1 << "Beginning with row # " << tbfrownr
+                            << LogIO::POST;
+                    os << LogIO::DEBUG1
+                            << " input (time_centroid, ant1, ant2, field) ="
+                            << LogIO::POST;
+
+                    // intimec is in modified julian day seconds, but Time::Time() takes
+                    // julian days.
+                    Double mjd_in_s = blk.timeCentroid(brow);
+                    Time juldate(2400000.5 + mjd_in_s / 86400.0);
+                    os << LogIO::DEBUG1 << "  (" << juldate.year() << "-";
+                    if (juldate.month() < 10)
+                        os << "0";
+                    os << juldate.month() << "-";
+                    if (juldate.dayOfMonth() < 10)
+                        os << "0";
+                    os << juldate.dayOfMonth() << "-";
+
+                    if (juldate.hours() < 10) // Time stores things internally as days.
+                        os << "0"; // Do we really want to use it for sub-day units
+                    os << juldate.hours() << ":"; // when we start with intimec in s?
+                    if (juldate.minutes() < 10)
+                        os << "0";
+                    os << juldate.minutes() << ":";
+                    mjd_in_s -= 60.0 * static_cast<Int> (mjd_in_s / 60.0);
+                    os << mjd_in_s;
+
+                    os << ", " << blk.antenna1(brow) << ", "
+                            << blk.antenna2(brow) << ", "
+                            << (asMultiSource ? blk.fieldId(brow) : 0) << "):"
+                            << LogIO::POST;
+                    os << LogIO::DEBUG1 << nspws_found << " spws present out of "
+                            << nif << " IFs." << LogIO::POST;
                 }
-            }
 
-            // if(nOutRow - outtbfrownr < 5)
-            //   os << LogIO::DEBUG1 << "(outtbfrownr, m) = (" << outtbfrownr
-            //      << ", " << m << ")" << LogIO::POST;
-
-        } // Ends loop over IFs.
-
-        // If found data at this timestamp, write it out
-        //    if (dowrite) {
-        // Random parameters
-        // UU VV WW
-        inuvw.get(tbfrownr, uvw);
-        *ouu = uvw(0) * oneOverC;
-        *ovv = uvw(1) * oneOverC;
-        *oww = uvw(2) * oneOverC;
-
-        // TIME
-        timeToDay(day, dayFraction, intimec(tbfrownr));
-        *odate1 = day;
-        *odate2 = dayFraction;
-
-        // BASELINE
-        if (maxant < 256) {
-            *obaseline = antnumbers(inant1(tbfrownr)) * 256 +
-                    antnumbers(inant2(tbfrownr)) +
-                    inarray(tbfrownr) * 0.01;
-        } else {
-            *osubarray = inarray(tbfrownr) + 1;
-            *oantenna1 = antnumbers(inant1(tbfrownr));
-            *oantenna2 = antnumbers(inant2(tbfrownr));
+                tbfrownr = rawrownr; // Increment it by the # of spws found.
+            }
         }
 
-        // FREQSEL (in the future it might be FREQ_GRP+1)
-        //    *ofreqsel = inddid(i) + 1;
-        *ofreqsel = _combineSpw ? 1 : 1 + spwidMap[inspwinid(tbfrownr)];
-
-        // SOURCE
-        // INTTIM
-        if (asMultiSource) {
-            *osource = 1 + fieldidMap[infieldid(tbfrownr)];
-            *ointtim = inexposure(tbfrownr);
+        // Convert the data of the output rows in parallel.
+        // All blocks needed are in memory now.
+#ifdef _OPENMP
+#pragma omp parallel for if (Int64(nOut) * outRowSize > 65536)
+#endif
+        for (Int i = 0; i < Int(nOut); ++i) {
+            Float* outptr = outData.data() + i * outRowSize;
+            for (uInt m = 0; m < nif; ++m) {
+                const Int64 row = planIF[Int64(i) * nif + m];
+                if (row < 0) {
+                    outptr = convertFitsRow(outptr, padData.data(),
+                            padFlag.data(), padWeight.data(), 0, True,
+                            indptr, numcorr0, numchan0, chanstart, nchan,
+                            chanstep, avgchan);
+                } else {
+                    const MSFitsRowBlock* blk = reader.find(row);
+                    const rownr_t brow = row - blk->startRow;
+                    const Int64 offset = brow * nInData;
+                    outptr = convertFitsRow(outptr, blk->data.data() + offset,
+                            blk->flag.data() + offset,
+                            blk->hasWeightSpectrum(brow)
+                                ? blk->weightSpectrum.data() + offset : 0,
+                            blk->weight.data() + brow * numcorr0,
+                            blk->flagRow(brow), indptr, numcorr0, numchan0,
+                            chanstart, nchan, chanstep, avgchan);
+                }
+            }
         }
 
-        writer.write();
-        ++outrownr;
-        meter.update(outrownr);
-
-        // How many spws showed up for this (time_centroid, ant1, ant2, field)?
-        if (rawrownr == tbfrownr) {
-            os << LogIO::WARN << "No spectral windows were present for row # "
-                    << tbfrownr << "\n"
-                    << " input (time_centroid, ant1, ant2, field) =\n" << "  ("
-                    << intimec(tbfrownr) << ", " << inant1(tbfrownr) << ", "
-                    << inant2(tbfrownr) << ", " << infieldid(tbfrownr) << ")"
-                    << LogIO::POST;
-        } else {
-            Int nspws_found = rawrownr - tbfrownr; // Just for debugging curiosity.
+        // Write the output rows.
+        for (uInt i = 0; i < nOut; ++i) {
+            std::copy(outData.begin() + i * outRowSize,
+                      outData.begin() + (i + 1) * outRowSize, optr);
+            const uInt row = planRow[i];
+            const MSFitsRowBlock& blk = reader.block(row);
+            const rownr_t brow = row - blk.startRow;
+
+            // Random parameters
+            // UU VV WW
+            *ouu = blk.uvw(0, brow) * oneOverC;
+            *ovv = blk.uvw(1, brow) * oneOverC;
+            *oww = blk.uvw(2, brow) * oneOverC;
+
+            // TIME
+            timeToDay(day, dayFraction, blk.timeCentroid(brow));
+            *odate1 = day;
+            *odate2 = dayFraction;
+
+            // BASELINE
+            if (maxant < 256) {
+                *obaseline = antnumbers(blk.antenna1(brow)) * 256 +
+                        antnumbers(blk.antenna2(brow)) +
+                        blk.arrayId(brow) * 0.01;
+            } else {
+                *osubarray = blk.arrayId(brow) + 1;
+                *oantenna1 = antnumbers(blk.antenna1(brow));
+                *oantenna2 = antnumbers(blk.antenna2(brow));
+            }
 
-            if (nspws_found != old_nspws_found) {
-                old_nspws_found = nspws_found;
-                os << LogIO::DEBUG1 << "Beginning with row # " << tbfrownr
-                        << LogIO::POST;
-                os << LogIO::DEBUG1
-                        << " input (time_centroid, ant1, ant2, field) ="
-                        << LogIO::POST;
+            // FREQSEL (in the future it might be FREQ_GRP+1)
+            *ofreqsel = _combineSpw ? 1 : 1 + spwidMap[blk.dataDescId(brow)];
 
-                // intimec is in modified julian day seconds, but Time::Time() takes
-                // julian days.
-                Double mjd_in_s = intimec(tbfrownr);
-                Time juldate(2400000.5 + mjd_in_s / 86400.0);
-                os << LogIO::DEBUG1 << "  (" << juldate.year() << "-";
-                if (juldate.month() < 10)
-                    os << "0";
-                os << juldate.month() << "-";
-                if (juldate.dayOfMonth() < 10)
-                    os << "0";
-                os << juldate.dayOfMonth() << "-";
-
-                if (juldate.hours() < 10) // Time stores things internally as days.
-                    os << "0"; // Do we really want to use it for sub-day units
-                os << juldate.hours() << ":"; // when we start with intimec in s?
-                if (juldate.minutes() < 10)
-                    os << "0";
-                os << juldate.minutes() << ":";
-                mjd_in_s -= 60.0 * static_cast<Int> (mjd_in_s / 60.0);
-                os << mjd_in_s;
-
-                os << ", " << inant1(tbfrownr) << ", " << inant2(tbfrownr)
-                        << ", "
-                // infieldid is unattached and segfaultable if !asMultiSource.
-                        << (asMultiSource ? infieldid(tbfrownr) : 0) << "):"
-                        << LogIO::POST;
-                os << LogIO::DEBUG1 << nspws_found << " spws present out of "
-                        << nif << " IFs." << LogIO::POST;
+            // SOURCE
+            // INTTIM
+            if (asMultiSource) {
+                *osource = 1 + fieldidMap[blk.fieldId(brow)];
+                *ointtim = blk.exposure(brow);
             }
 
-            tbfrownr = rawrownr; // Increment it by the # of spws found.
+            writer.write();
+            ++outrownr;
+            meter.update(outrownr);
         }
-
-        //    } // dowrite
     }
     os << LogIO::DEBUG1 << "tbfrownr = " << tbfrownr << LogIO::POST;
     os << LogIO::DEBUG1 << "outrownr = " << outrownr << LogIO::POST;
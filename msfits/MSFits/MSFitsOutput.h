@@ -90,6 +90,12 @@ public:
     //  @param overwrite     overwrite existing file?
     void setOverwrite(Bool overwrite);
 
+    //  @param memoryInMB    maximum memory (in MB) used to buffer the data
+    //                       read from the MS (default 256). The data are
+    //                       read in blocks in a background thread while the
+    //                       previous block is converted and written.
+    void setMemory(uInt memoryInMB);
+
     // write the uvfits file.
     void write() const;
 
@@ -114,6 +120,7 @@ public:
     //  @param avgchan       average every N channels
     //  @param fieldNumber   field number
     //  @param overwrite     overwrite existing file?
+    //  @param memoryInMB    maximum memory used to buffer the MS data
     static Bool writeFitsFile(
         const String& fitsfile, const MeasurementSet& ms,
         const String& column, Int startchan=0,
@@ -122,7 +129,8 @@ public:
         Bool asMultiSource = False, Bool combineSpw=False,
         Bool writeStation=False, Double sensitivity=1.0,
         const Bool padWithFlags=false, Int avgchan=1,
-        uInt fieldNumber=0, Bool overwrite=False
+        uInt fieldNumber=0, Bool overwrite=False,
+        uInt memoryInMB=256
     );
 
 private:
@@ -133,6 +141,7 @@ private:
         _writeStation, _padWithFlags, _overwrite;
     Double _sensitivity;
     uInt _fieldNumber;
+    uInt _memoryInMB;
 
 
     // Write the main table.
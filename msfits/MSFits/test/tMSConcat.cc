@@ -29,11 +29,322 @@
 
 #include <casacore/ms/MSOper/MSConcat.h>
 #include <casacore/ms/MeasurementSets/MeasurementSet.h>
+#include <casacore/ms/MeasurementSets/MSColumns.h>
 #include <casacore/msfits/MSFits/MSFitsInput.h>
+#include <casacore/measures/Measures/Stokes.h>
 #include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Inputs.h>
 
 #include <casacore/casa/namespace.h>
+
+// If no MS or FITS file is given, two small MSs are created and
+// concatenated. The MS to be appended has its antennas in reverse order
+// (so baselines get swapped), a spectral window with the channels in
+// reverse order, and rows of data descriptions with different data shapes
+// alternating in short runs. The result is checked against the values
+// expected from appending the rows one by one.
+
+const uInt nant = 4;
+const uInt ntime = 5;
+const Double startFreq[2] = {1.e9, 2.e9};
+const uInt nchanSpw[2] = {4, 8};
+
+// The data values of a row in the MS to be appended.
+Complex dataValue (uInt row, uInt corr, uInt chan)
+{
+  return Complex(100*row + 10*corr + chan, -Float(row + corr) - 0.5*chan);
+}
+Float weightValue (uInt row, uInt corr)
+{
+  return 1 + row + 0.25*corr;
+}
+Bool flagValue (uInt row, uInt corr, uInt chan)
+{
+  return (row + corr + chan) % 3 == 0;
+}
+
+// Add a spectral window whose channels can be in reverse order.
+void addSpw (MSColumns& msc, uInt spw, Bool reversed)
+{
+  MSSpWindowColumns& cols = msc.spectralWindow();
+  uInt row = cols.nrow();
+  cols.numChan().table().addRow();
+  uInt nchan = nchanSpw[spw];
+  Vector<Double> freqs(nchan);
+  for (uInt i=0; i<nchan; ++i) {
+    freqs[i] = startFreq[spw] + 1.e6 * (reversed ? nchan-1-i : i);
+  }
+  Vector<Double> widths(nchan, (reversed ? -1.e6 : 1.e6));
+  cols.numChan().put (row, nchan);
+  cols.name().put (row, "SPW" + String::toString(spw));
+  cols.refFrequency().put (row, startFreq[spw]);
+  cols.chanFreq().put (row, freqs);
+  cols.chanWidth().put (row, widths);
+  cols.effectiveBW().put (row, abs(widths));
+  cols.resolution().put (row, abs(widths));
+  cols.totalBandwidth().put (row, nchan * 1.e6);
+  cols.measFreqRef().put (row, MFrequency::TOPO);
+  cols.netSideband().put (row, 1);
+  cols.ifConvChain().put (row, 0);
+  cols.freqGroup().put (row, 0);
+  cols.freqGroupName().put (row, "");
+  cols.flagRow().put (row, False);
+}
+
+// Add a polarization with 4 (RR,RL,LR,LL) or 2 (RR,LL) correlations.
+void addPol (MSColumns& msc, uInt ncorr)
+{
+  MSPolarizationColumns& cols = msc.polarization();
+  uInt row = cols.nrow();
+  cols.numCorr().table().addRow();
+  Vector<Int> types(ncorr);
+  Matrix<Int> products(2, ncorr);
+  for (uInt i=0; i<ncorr; ++i) {
+    uInt c = (ncorr == 4 ? i : 3*i);
+    types[i] = Stokes::RR + c;
+    products(0,i) = c / 2;
+    products(1,i) = c % 2;
+  }
+  cols.numCorr().put (row, ncorr);
+  cols.corrType().put (row, types);
+  cols.corrProduct().put (row, products);
+  cols.flagRow().put (row, False);
+}
+
+void addDD (MSColumns& msc, Int spw, Int pol)
+{
+  MSDataDescColumns& cols = msc.dataDescription();
+  uInt row = cols.nrow();
+  cols.spectralWindowId().table().addRow();
+  cols.spectralWindowId().put (row, spw);
+  cols.polarizationId().put (row, pol);
+  cols.flagRow().put (row, False);
+}
+
+// Create an MS. The antennas are in reverse order in the MS to be
+// appended, which also uses the reversed spectral window 0 and spectral
+// window 1 with two polarizations.
+void makeMS (const String& name, Bool toAppend)
+{
+  TableDesc td = MeasurementSet::requiredTableDesc();
+  MeasurementSet::addColumnToDesc (td, MeasurementSet::DATA, 2);
+  SetupNewTable newtab(name, td, Table::New);
+  MeasurementSet ms(newtab);
+  ms.createDefaultSubtables (Table::New);
+  MSColumns msc(ms);
+  // ANTENNA
+  ms.antenna().addRow (nant);
+  for (uInt i=0; i<nant; ++i) {
+    uInt ant = (toAppend ? nant-1-i : i);
+    Vector<Double> pos(3);
+    pos[0] = 1000. * ant;
+    pos[1] = -2000. * ant;
+    pos[2] = 500.;
+    msc.antenna().name().put (i, "A" + String::toString(ant));
+    msc.antenna().station().put (i, "S" + String::toString(ant));
+    msc.antenna().position().put (i, pos);
+    msc.antenna().offset().put (i, Vector<Double>(3, 0.));
+    msc.antenna().dishDiameter().put (i, 25.);
+    msc.antenna().mount().put (i, "ALT-AZ");
+    msc.antenna().type().put (i, "GROUND-BASED");
+    msc.antenna().flagRow().put (i, False);
+  }
+  // SPECTRAL_WINDOW, POLARIZATION and DATA_DESCRIPTION
+  addSpw (msc, 0, toAppend);
+  addPol (msc, 4);
+  addDD (msc, 0, 0);
+  if (toAppend) {
+    addSpw (msc, 1, False);
+    addPol (msc, 2);
+    addDD (msc, 1, 0);
+    addDD (msc, 1, 1);
+  }
+  // FIELD
+  ms.field().addRow();
+  Matrix<Double> dir(2, 1);
+  dir(0,0) = 1.;
+  dir(1,0) = 0.5;
+  msc.field().name().put (0, "F0");
+  msc.field().code().put (0, "");
+  msc.field().time().put (0, 0.);
+  msc.field().numPoly().put (0, 0);
+  msc.field().delayDir().put (0, dir);
+  msc.field().phaseDir().put (0, dir);
+  msc.field().referenceDir().put (0, dir);
+  msc.field().sourceId().put (0, -1);
+  msc.field().flagRow().put (0, False);
+  // OBSERVATION and PROCESSOR
+  ms.observation().addRow();
+  Vector<Double> timeRange(2);
+  timeRange[0] = 4.e9;
+  timeRange[1] = 4.e9 + 100;
+  msc.observation().telescopeName().put (0, "TEST");
+  msc.observation().timeRange().put (0, timeRange);
+  msc.observation().observer().put (0, "me");
+  msc.observation().project().put (0, "tMSConcat");
+  msc.observation().releaseDate().put (0, 0.);
+  msc.observation().scheduleType().put (0, "");
+  msc.observation().schedule().put (0, Vector<String>(1, ""));
+  msc.observation().log().put (0, Vector<String>(1, ""));
+  msc.observation().flagRow().put (0, False);
+  ms.processor().addRow();
+  msc.processor().type().put (0, "CORRELATOR");
+  msc.processor().subType().put (0, "");
+  msc.processor().typeId().put (0, -1);
+  msc.processor().modeId().put (0, -1);
+  msc.processor().flagRow().put (0, False);
+  // MAIN; all baselines including the autocorrelations and both antenna
+  // orders, so after reordering the antennas only some rows are swapped.
+  // The data descriptions alternate in runs of different lengths.
+  uInt row = 0;
+  for (uInt t=0; t<ntime; ++t) {
+    for (uInt a1=0; a1<nant; ++a1) {
+      for (uInt a2=0; a2<nant; ++a2) {
+        if (a1 > a2  &&  (a1+a2+t) % 2 == 0) {
+          continue;
+        }
+        uInt dd = 0;
+        if (toAppend) {
+          dd = (a1 + t) % 3;
+        }
+        uInt ncorr = (dd == 2 ? 2 : 4);
+        uInt nchan = nchanSpw[dd == 0 ? 0 : 1];
+        Matrix<Complex> data(ncorr, nchan);
+        Matrix<Bool> flag(ncorr, nchan);
+        Vector<Float> weight(ncorr);
+        for (uInt c=0; c<ncorr; ++c) {
+          weight[c] = weightValue (row, c);
+          for (uInt ch=0; ch<nchan; ++ch) {
+            data(c,ch) = dataValue (row, c, ch);
+            flag(c,ch) = flagValue (row, c, ch);
+          }
+        }
+        Vector<Double> uvw(3);
+        uvw[0] = row + 1.;
+        uvw[1] = -2. * row;
+        uvw[2] = 0.5 * row;
+        ms.addRow();
+        msc.time().put (row, 4.e9 + 10*t);
+        msc.timeCentroid().put (row, 4.e9 + 10*t);
+        msc.interval().put (row, 10.);
+        msc.exposure().put (row, 10.);
+        msc.antenna1().put (row, a1);
+        msc.antenna2().put (row, a2);
+        msc.feed1().put (row, 0);
+        msc.feed2().put (row, 0);
+        msc.dataDescId().put (row, dd);
+        msc.fieldId().put (row, 0);
+        msc.arrayId().put (row, 0);
+        msc.observationId().put (row, 0);
+        msc.processorId().put (row, 0);
+        msc.stateId().put (row, -1);
+        msc.scanNumber().put (row, 1);
+        msc.uvw().put (row, uvw);
+        msc.data().put (row, data);
+        msc.flag().put (row, flag);
+        msc.weight().put (row, weight);
+        msc.sigma().put (row, Float(1) / sqrt(weight));
+        msc.flagRow().put (row, False);
+        row++;
+      }
+    }
+  }
+}
+
+// Check the rows appended to the first MS.
+void checkConcat (const String& msName, const String& appendName)
+{
+  MeasurementSet ms(msName);
+  MeasurementSet other(appendName);
+  MSColumns msc(ms);
+  MSColumns otherc(other);
+  rownr_t firstRow = ms.nrow() - other.nrow();
+  // The spectral windows and polarizations are added in the order of the
+  // data descriptions, so the data description ids do not change.
+  AlwaysAssertExit (ms.dataDescription().nrow() == 3);
+  AlwaysAssertExit (ms.spectralWindow().nrow() == 2);
+  AlwaysAssertExit (ms.polarization().nrow() == 2);
+  AlwaysAssertExit (ms.antenna().nrow() == nant);
+  uInt nswap = 0;
+  uInt nrev  = 0;
+  for (rownr_t r=0; r<other.nrow(); ++r) {
+    rownr_t row = firstRow + r;
+    // The antennas are in reverse order, so antenna i becomes nant-1-i.
+    Int a1 = nant-1 - otherc.antenna1()(r);
+    Int a2 = nant-1 - otherc.antenna2()(r);
+    Bool swap = a1 > a2;
+    Int dd = otherc.dataDescId()(r);
+    Bool reversed = (dd == 0);
+    AlwaysAssertExit (msc.antenna1()(row) == (swap ? a2 : a1));
+    AlwaysAssertExit (msc.antenna2()(row) == (swap ? a1 : a2));
+    AlwaysAssertExit (msc.dataDescId()(row) == dd);
+    AlwaysAssertExit (msc.time()(row) == otherc.time()(r));
+    Vector<Double> uvw = otherc.uvw()(r);
+    if (swap) {
+      uvw *= -1.;
+    }
+    AlwaysAssertExit (allEQ (msc.uvw()(row), uvw));
+    // Swapping the antennas swaps the RL and LR correlations and
+    // conjugates the data. The data (but not the flags) of the reversed
+    // spectral window get their channels reversed.
+    Matrix<Complex> data (msc.data()(row));
+    Matrix<Bool> flag (msc.flag()(row));
+    Vector<Float> weight (msc.weight()(row));
+    uInt ncorr = data.nrow();
+    uInt nchan = data.ncolumn();
+    AlwaysAssertExit (ncorr == (dd == 2 ? 2u : 4u));
+    AlwaysAssertExit (nchan == nchanSpw[dd == 0 ? 0 : 1]);
+    for (uInt c=0; c<ncorr; ++c) {
+      uInt oc = (swap && ncorr == 4 && (c == 1 || c == 2) ? 3-c : c);
+      AlwaysAssertExit (weight[c] == weightValue (r, oc));
+      for (uInt ch=0; ch<nchan; ++ch) {
+        Complex val = dataValue (r, oc, (reversed ? nchan-1-ch : ch));
+        if (swap) {
+          val = conj(val);
+        }
+        AlwaysAssertExit (data(c,ch) == val);
+        AlwaysAssertExit (flag(c,ch) == flagValue (r, oc, ch));
+      }
+    }
+    if (swap) nswap++;
+    if (reversed) nrev++;
+  }
+  // Both special cases have to be tested as well as normal rows.
+  AlwaysAssertExit (nswap > 0  &&  nswap < other.nrow());
+  AlwaysAssertExit (nrev > 0  &&  nrev < other.nrow());
+  // The rows of the first MS are unchanged.
+  for (rownr_t row=0; row<firstRow; ++row) {
+    AlwaysAssertExit (msc.dataDescId()(row) == 0);
+    Matrix<Complex> data (msc.data()(row));
+    for (uInt c=0; c<data.nrow(); ++c) {
+      for (uInt ch=0; ch<data.ncolumn(); ++ch) {
+        AlwaysAssertExit (data(c,ch) == dataValue (row, c, ch));
+      }
+    }
+  }
+  cout << "Checked " << other.nrow() << " appended rows ("
+       << nswap << " swapped, " << nrev << " reversed)" << endl;
+}
+
+void testSynthetic()
+{
+  makeMS ("tMSConcat_tmp.ms", False);
+  makeMS ("tMSConcat_tmp.ms2", True);
+  {
+    MeasurementSet ms("tMSConcat_tmp.ms", Table::Update);
+    MeasurementSet appendedMS("tMSConcat_tmp.ms2");
+    MSConcat mscat(ms);
+    mscat.concatenate (appendedMS);
+  }
+  checkConcat ("tMSConcat_tmp.ms", "tMSConcat_tmp.ms2");
+}
+
 int main(int argc, const char* argv[])
 {
   try {
@@ -48,6 +359,11 @@ int main(int argc, const char* argv[])
     const String fitsAppendName = inputs.getString("fitsappend");
     const String msName = inputs.getString("ms");
     const String appendName = inputs.getString("append");
+    if (msName.empty()  &&  appendName.empty()) {
+      testSynthetic();
+      cout << "OK" << endl;
+      return 0;
+    }
     if (!Table::isReadable(msName)) {
       if (fitsName.length() == 0) {
 	String errorMsg = "Input ms called " + msName + " does not exist\n" +
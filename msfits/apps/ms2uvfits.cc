@@ -33,6 +33,7 @@
 #include <casacore/msfits/MSFits/MSFitsOutput.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 
 #include <casacore/casa/namespace.h>
@@ -66,6 +67,8 @@ int main (int argc, const char* argv[])
 		       "Write station names instead of antenna names", "bool");
 	inputs.create ("sensitivity", "0.1",
 		       "Sensitivity", "double");
+	inputs.create ("memory", "256",
+		       "Memory (in MB) used to buffer the MS data", "int");
 
 	// Fill the input structure from the command line.
 	inputs.readArguments (argc, argv);
@@ -116,11 +119,15 @@ int main (int argc, const char* argv[])
 	// Get the sensitivity.
 	Double sensitivity(inputs.getDouble("sensitivity"));
 
+	// Get the memory to use.
+	Int memory(inputs.getInt("memory"));
+
 	// Now write the fits file.
 	MSFitsOutput::writeFitsFile(fitsfile, MeasurementSet(msin),
 				    column, -1, -1, -1,
 				    writeSyscal, multisource,
-				    combinespw, writestation, sensitivity);
+				    combinespw, writestation, sensitivity,
+				    False, 1, 0, False, std::max(1, memory));
     } catch (std::exception& x) {
 	cout << x.what() << endl;
 	return 1;
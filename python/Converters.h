@@ -31,6 +31,7 @@
 #include <casacore/python/Converters/PycRecord.h>
 #include <casacore/python/Converters/PycValueHolder.h>
 #include <casacore/python/Converters/PycExcp.h>
+#include <casacore/python/Converters/PycGil.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -70,6 +71,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //    <li> N-dim Array of any basic data type. A casacore::Array can be
 //         constructed from Python types like tuple, list, and numpy array
 //         A Py_None object results in an empty array.
+//         Other objects supporting the (PEP 3118) buffer protocol with
+//         a numeric format (e.g. memoryview, array.array) are converted
+//         directly without using numpy.
 //         The conversion back is done to a numpy array.
 //         An empty array is returned as an empty numpy array.
 //         <br>Because Casacore arrays are in Fortran order and numpy arrays
@@ -93,6 +97,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //       exception. Only the <src>casacore::IterError</src> exception is mapped
 //       to a Python <src>StopIteration</src> exception.
 // </ul>
+// The conversions need the Python GIL, but the Casacore work done by a
+// wrapped function does not. Class <linkto class=PycGilRelease>
+// PycGilRelease</linkto> can be used in a wrapped function to release
+// the GIL around that work, so other Python threads can run meanwhile
+// (e.g. when reading many tables concurrently from Python threads).
 // The converts from Python to C++ can handle some special numpy objects.
 // Such objects can also be contained in sequences or dicts.
 // <ul>
@@ -52,6 +52,23 @@ namespace casacore { namespace python {
     return numpy::PycArrayScalarType(obj_ptr);
   }
 
+  Bool PycBufferCheck (PyObject* obj_ptr)
+  {
+    return PyObject_CheckBuffer(obj_ptr)
+      &&  !PyBytes_Check(obj_ptr)  &&  !PyByteArray_Check(obj_ptr)
+      &&  !PyUnicode_Check(obj_ptr)  &&  !numpy::PycArrayCheck(obj_ptr);
+  }
+
+  void setPycArrayShare (Bool share)
+  {
+    numpy::setShareArrays (share);
+  }
+
+  Bool getPycArrayShare()
+  {
+    return numpy::shareArrays();
+  }
+
   ValueHolder casa_array_from_python::makeArray (PyObject* obj_ptr,
 						 Bool copyData)
   {
@@ -84,6 +101,116 @@ namespace casacore { namespace python {
     return ValueHolder(arr.reform (shp));
   }
 
+  // Release a Py_buffer when going out of scope.
+  struct PycBufferHolder
+  {
+    explicit PycBufferHolder (Py_buffer& view) : itsView(view) {}
+    ~PycBufferHolder() { PyBuffer_Release (&itsView); }
+    Py_buffer& itsView;
+  };
+
+  // Copy buffer data of type From into an Array<To>.
+  template <typename From, typename To>
+  ValueHolder copyBuffer (const IPosition& shape, const void* data)
+  {
+    Array<To> arr(shape);
+    const From* src = static_cast<const From*>(data);
+    To* dst = arr.data();
+    for (size_t i=0; i<arr.size(); ++i) {
+      dst[i] = src[i];
+    }
+    return ValueHolder(arr);
+  }
+
+  ValueHolder casa_array_from_python::makeArrayFromBuffer (PyObject* obj_ptr)
+  {
+    Py_buffer view;
+    if (PyObject_GetBuffer (obj_ptr, &view,
+                            PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+      PyErr_Clear();
+      throw AipsError ("PycArray: python object does not give a "
+                       "C-contiguous buffer");
+    }
+    PycBufferHolder holder(view);
+    // Reverse the axes, because Casacore has row minor and Python row major
+    // order. A scalar is treated as a vector with length 1 (as in makeArray).
+    IPosition shp(1, 1);
+    if (view.ndim > 0) {
+      shp.resize (view.ndim);
+      for (int i=0; i<view.ndim; i++) {
+        shp[i] = view.shape[view.ndim-i-1];
+      }
+    }
+    // Interpret the struct module format; only native byte order is
+    // supported.
+    const char* fmt = (view.format ? view.format : "B");
+    if (*fmt == '@'  ||  *fmt == '=') {
+      ++fmt;
+#if defined(AIPS_LITTLE_ENDIAN)
+    } else if (*fmt == '<') {
+#else
+    } else if (*fmt == '>'  ||  *fmt == '!') {
+#endif
+      ++fmt;
+    } else if (*fmt == '<'  ||  *fmt == '>'  ||  *fmt == '!') {
+      throw AipsError ("PycArray: buffer has non-native byte order");
+    }
+    const size_t isz = view.itemsize;
+    const void* data = view.buf;
+    switch (fmt[0] == '\0'  ||  fmt[1] == '\0'  ?  fmt[0] : 0) {
+    case '?':
+      return copyBuffer<bool,Bool> (shp, data);
+    case 'b':
+      return copyBuffer<signed char,Short> (shp, data);
+    case 'B':
+      return copyBuffer<unsigned char,Short> (shp, data);
+    case 'h':
+    case 'i':
+    case 'l':
+    case 'q':
+    case 'n':
+      if (isz == sizeof(Short)) {
+        return copyBuffer<Short,Short> (shp, data);
+      } else if (isz == sizeof(Int)) {
+        return copyBuffer<Int,Int> (shp, data);
+      } else if (isz == sizeof(Int64)) {
+        return copyBuffer<Int64,Int64> (shp, data);
+      }
+      break;
+    case 'H':
+    case 'I':
+    case 'L':
+    case 'Q':
+    case 'N':
+      // As in makeArray, uInt64 is converted to Int64.
+      if (isz == sizeof(uShort)) {
+        return copyBuffer<uShort,uShort> (shp, data);
+      } else if (isz == sizeof(uInt)) {
+        return copyBuffer<uInt,uInt> (shp, data);
+      } else if (isz == sizeof(uInt64)) {
+        return copyBuffer<uInt64,Int64> (shp, data);
+      }
+      break;
+    case 'f':
+      return copyBuffer<Float,Float> (shp, data);
+    case 'd':
+      return copyBuffer<Double,Double> (shp, data);
+    case 0:
+      if (fmt[0] == 'Z'  &&  fmt[2] == '\0') {
+        if (fmt[1] == 'f') {
+          return copyBuffer<Complex,Complex> (shp, data);
+        } else if (fmt[1] == 'd') {
+          return copyBuffer<DComplex,DComplex> (shp, data);
+        }
+      }
+      break;
+    default:
+      break;
+    }
+    throw AipsError ("PycArray: unsupported buffer format " +
+                     String(view.format ? view.format : "B"));
+  }
+
   template <>
   object makePyArrayObject (casacore::Array<String> const& arr)
   {
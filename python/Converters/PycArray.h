@@ -62,6 +62,27 @@ namespace casacore { namespace python {
   // TpOther is returned if unrecognized.
   DataType PycArrayScalarType (PyObject* obj_ptr);
 
+  // Check if the PyObject supports the (PEP 3118) buffer protocol and is
+  // not a numpy array, bytes, bytearray, or string object
+  // (e.g. a memoryview or array.array object).
+  Bool PycBufferCheck (PyObject* obj_ptr);
+
+  // Set or get if Casacore arrays are converted to Python arrays sharing
+  // the data instead of copying it (default False).
+  // If set, a contiguous array is given to Python as a numpy array using
+  // its data. The Casacore data are kept alive while the numpy array exists.
+  // Note that changes in the data are visible in both the Casacore and the
+  // Python array, so it should only be used if the Casacore array is not
+  // changed thereafter (as is usually the case for an array returned by
+  // a function).
+  // <br>Note that Python arrays are already converted to Casacore arrays
+  // without copying if the layout and data type match and if the Array
+  // does not outlive the Python array (see makeArray below).
+  // <group>
+  void setPycArrayShare (Bool share);
+  Bool getPycArrayShare();
+  // </group>
+
   struct casa_array_from_python
   {
     // Constructs an Array from a Python object.
@@ -75,6 +96,13 @@ namespace casacore { namespace python {
     // Construct an Array<String> from a special Python dict object.
     static ValueHolder makeArrayFromDict (PyObject* obj_ptr);
 
+    // Construct an Array from an object supporting the buffer protocol
+    // (see PycBufferCheck), so without using numpy.
+    // The buffer must be C-contiguous in native byte order; its format
+    // must be a basic numeric type (using the same types as makeArray).
+    // The data are copied, so the Array does not reference the buffer.
+    static ValueHolder makeArrayFromBuffer (PyObject* obj_ptr);
+
     // Construct a scalar from an array scalar (i.e. element in array).
     static ValueHolder makeScalar (PyObject* obj_ptr);
   };
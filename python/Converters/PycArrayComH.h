@@ -83,7 +83,16 @@
 					  void* data, size_t slen);
 
   // Convert a Casacore array to a Python array object.
+  // The data are shared instead of copied if sharing is switched on
+  // (see setShareArrays) and if possible.
   template <typename T>
   boost::python::object makePyArrayObject (casacore::Array<T> const& arr);
 
+  // Set or get if Casacore arrays are converted to Python arrays sharing
+  // the data (default False).
+  // <group>
+  void setShareArrays (Bool share);
+  Bool shareArrays();
+  // </group>
+
 
@@ -308,6 +308,28 @@ namespace casacore { namespace python { namespace numpy {
 
 #include <casacore/python/Converters/PycArrayComCC.h>
 
+  // Sharing is off by default, because changes in the data of the
+  // Casacore array are visible in the Python array and vice versa.
+  static Bool theirShareArrays = False;
+
+  void setShareArrays (Bool share)
+  {
+    theirShareArrays = share;
+  }
+
+  Bool shareArrays()
+  {
+    return theirShareArrays;
+  }
+
+  // Delete the Casacore array kept alive by a capsule.
+  template <typename T>
+  void deleteArrayCapsule (PyObject* capsule)
+  {
+    delete static_cast<Array<T>*>(PyCapsule_GetPointer (capsule,
+                                                        "casacore.Array"));
+  }
+
   template <typename T>
   boost::python::object makePyArrayObject (casacore::Array<T> const& arr)
   {
@@ -326,6 +348,32 @@ namespace casacore { namespace python { namespace numpy {
 	newshp[i] = shp[nd-i-1];
       }
     }
+    // Share the data if possible. The data are kept alive by a copy
+    // of the Array object (referencing the data), which is held by a
+    // capsule used as the base object of the numpy array.
+    if (theirShareArrays  &&  arr.size() > 0  &&  arr.contiguousStorage()  &&
+        sizeof(T) == sizeof(typename TypeConvTraits<T>::python_type)) {
+      Array<T>* ref = new Array<T>(arr);
+      PyObject* capsule = PyCapsule_New (ref, "casacore.Array",
+                                         &deleteArrayCapsule<T>);
+      if (capsule == 0) {
+        delete ref;
+        boost::python::throw_error_already_set();
+      }
+      PyObject* po = PyArray_SimpleNewFromData
+        (nd, &(newshp[0]), TypeConvTraits<T>::pyType(),
+         const_cast<T*>(ref->data()));
+      if (po == 0) {
+        Py_DECREF (capsule);
+        boost::python::throw_error_already_set();
+      }
+      // This steals the reference to the capsule.
+      if (PyArray_SetBaseObject ((PyArrayObject*)po, capsule) != 0) {
+        Py_DECREF (po);
+        boost::python::throw_error_already_set();
+      }
+      return boost::python::object(boost::python::handle<>(po));
+    }
     // Create the array from the shape.
     // This gives a warning because a function pointer is converted
     // to a data pointer.
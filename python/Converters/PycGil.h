@@ -0,0 +1,126 @@
+//# PycGil.h: Release or acquire the Python GIL around C++ code
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef PYRAP_PYCGIL_H
+#define PYRAP_PYCGIL_H
+
+// include python first to avoid _POSIX_C_SOURCE redefined warnings
+#include <Python.h>
+#include <casacore/casa/aips.h>
+
+namespace casacore { namespace python {
+
+  // <summary>
+  // Release the Python GIL while executing C++ code.
+  // </summary>
+
+  // <use visibility=export>
+  // <reviewed reviewer="" date="" tests="tConvert">
+  // </reviewed>
+
+  // <synopsis>
+  // The converters in this module use the Python C-API, so they need
+  // the Python Global Interpreter Lock (GIL). Boost.Python holds the GIL
+  // when calling a wrapped C++ function, so by default all Python threads
+  // are serialized while the C++ code is executing (e.g. reading a table).
+  // <br>A PycGilRelease object releases the GIL in its constructor and
+  // reacquires it in its destructor (also if an exception is thrown).
+  // It should be used in a wrapped function around the Casacore work only;
+  // the arguments are converted by Boost.Python before the function is
+  // called, and the result is converted after it returns, so the conversions
+  // are done while holding the GIL. No Python objects (e.g. a
+  // boost::python::object) must be used while the GIL is released.
+  // Note that a converted array argument can reference the data of the
+  // Python array (see <src>casa_array_from_python::makeArray</src>). That
+  // is safe, because the caller keeps the Python array alive and numpy does
+  // not resize an array that is referenced.
+  // <br>A PycGilAcquire object does the opposite; it acquires the GIL for
+  // a thread (e.g. for a callback into Python from C++ code running without
+  // the GIL) and releases it again in its destructor.
+  // </synopsis>
+
+  // <example>
+  // <srcblock>
+  //   ValueHolder MyTableWrapper::getColumn (const String& name)
+  //   {
+  //     ValueHolder result;
+  //     {
+  //       PycGilRelease release;
+  //       result = ... read the column ...;
+  //     }
+  //     return result;      // converted to numpy while holding the GIL
+  //   }
+  // </srcblock>
+  // Function <src>callWithoutGil</src> makes this shorter:
+  // <srcblock>
+  //     return callWithoutGil ([&]() { return ... read the column ...; });
+  // </srcblock>
+  // </example>
+
+  class PycGilRelease
+  {
+  public:
+    PycGilRelease()
+      : itsState (PyEval_SaveThread())
+    {}
+    ~PycGilRelease()
+      { PyEval_RestoreThread (itsState); }
+
+    PycGilRelease (const PycGilRelease&) = delete;
+    PycGilRelease& operator= (const PycGilRelease&) = delete;
+
+  private:
+    PyThreadState* itsState;
+  };
+
+  class PycGilAcquire
+  {
+  public:
+    PycGilAcquire()
+      : itsState (PyGILState_Ensure())
+    {}
+    ~PycGilAcquire()
+      { PyGILState_Release (itsState); }
+
+    PycGilAcquire (const PycGilAcquire&) = delete;
+    PycGilAcquire& operator= (const PycGilAcquire&) = delete;
+
+  private:
+    PyGILState_STATE itsState;
+  };
+
+  // Call the given function (without arguments) with the GIL released.
+  // The function must not use Python objects.
+  template<typename Func>
+  auto callWithoutGil (Func func) -> decltype(func())
+  {
+    PycGilRelease release;
+    return func();
+  }
+
+}}
+
+#endif
@@ -111,7 +111,8 @@ namespace casacore { namespace python {
       || PyRange_Check(obj_ptr)
       || PySequence_Check(obj_ptr)
       || PycArrayCheck(obj_ptr)
-      || PycArrayScalarCheck(obj_ptr)  )) {
+      || PycArrayScalarCheck(obj_ptr)
+      || PycBufferCheck(obj_ptr)  )) {
         // An empty numarray is Py_None, so accept that.
         if (obj_ptr != Py_None) {
           return 0;
@@ -176,6 +177,9 @@ namespace casacore { namespace python {
       return ValueHolder(casa_record_from_python::makeRecord (obj_ptr));
     } else if (PycArrayCheck(obj_ptr)) {
       return casa_array_from_python::makeArray (obj_ptr);
+    } else if (PycBufferCheck(obj_ptr)) {
+      // E.g. a memoryview or array.array; converted without numpy.
+      return casa_array_from_python::makeArrayFromBuffer (obj_ptr);
     } else {
       return toVector (obj_ptr);
     }
@@ -28,6 +28,8 @@
 #include <casacore/python/Converters/PycValueHolder.h>
 #include <casacore/python/Converters/PycRecord.h>
 #include <casacore/python/Converters/PycArray.h>
+#include <casacore/python/Converters/PycGil.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/BasicSL/STLIO.h>
 #include <casacore/casa/Exceptions/Error.h>
@@ -82,6 +84,15 @@ namespace casacore { namespace python {
       {cout << "vecvecuInt " << in << endl; return in;}
     std::vector<ValueHolder> teststdvecvh (const std::vector<ValueHolder>& in)
       {cout << "vecvh " << in.size() << endl; return in;}
+    Double testsumnogil (const ValueHolder& in)
+    {
+      // Do the work without holding the GIL.
+      Double sum = callWithoutGil ([&in]() {
+        return casacore::sum (in.asArrayDouble());
+      });
+      cout << "SumNoGil " << sum << endl;
+      return sum;
+    }
     IPosition testipos (const IPosition& in)
       {cout << "IPos " << in << endl; return in;}
     void testIterError()
@@ -112,6 +123,7 @@ namespace casacore { namespace python {
       .def ("teststdvecuint", &TConvert::teststdvecuint)
       .def ("teststdvecvecuint", &TConvert::teststdvecvecuint)
       .def ("teststdvecvh"  , &TConvert::teststdvecvh)
+      .def ("testsumnogil",   &TConvert::testsumnogil)
       .def ("testipos",       &TConvert::testipos)
       .def ("testitererror",  &TConvert::testIterError)
       ;
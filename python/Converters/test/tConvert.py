@@ -191,6 +191,15 @@ def testexcp():
     if not excp:
         print ("IterError exception in testexcp was not converted");
 
+def testbuffer():
+    # Objects supporting the buffer protocol are converted without numpy.
+    import array
+    print (t.testvh(array.array('i', [1,2,3])));
+    print (t.testvh(memoryview(NUM.float32([[1,2],[3,4]]))));
+    print (t.testvh(memoryview(NUM.complex128([1+2j]))));
+    # The sum is calculated without holding the GIL.
+    print (t.testsumnogil(NUM.arange(10.)));
+
 def testnp():
     # Test byte and sbyte.
     b = NUM.int8([-1,-2]);
@@ -204,6 +213,7 @@ def testnp():
     print (t.testvh(NUM.array([["abcd","c"],["12","x12"]])));
     testnps();
     testexcp();
+    testbuffer();
 
 
 if __name__ == "__main__":
@@ -527,6 +527,27 @@ template<class T> class GenericL2Fit : public LSQaips {
 		   const Vector<typename FunctionTraits<T>::BaseType>
 		   *const sigma,
 		   const Vector<Bool> *const mask=0);
+  // Build the normal matrix for the given number of data points.
+  // The real version evaluates the function (and its derivatives) in
+  // chunks of data points using <src>Function::evalMany</src>, where the
+  // parts of a chunk are evaluated in parallel on a copy of the function
+  // per thread. The condition equations of a chunk are added with
+  // <src>LSQFit::makeNormBlock</src>. The complex version adds the
+  // data points one by one.
+  // <group>
+  void buildMatrixIt(uInt nrows,
+		     const Array<typename FunctionTraits<T>::BaseType> &x, 
+		     const Vector<typename FunctionTraits<T>::BaseType> &y,
+		     const Vector<typename FunctionTraits<T>::BaseType>
+		     *const sigma,
+		     const Vector<Bool> *const mask, LSQReal);
+  void buildMatrixIt(uInt nrows,
+		     const Array<typename FunctionTraits<T>::BaseType> &x, 
+		     const Vector<typename FunctionTraits<T>::BaseType> &y,
+		     const Vector<typename FunctionTraits<T>::BaseType>
+		     *const sigma,
+		     const Vector<Bool> *const mask, LSQComplex);
+  // </group>
   // Build the constraint equations
   void buildConstraint();
   // Get the SVD constraints
@@ -32,6 +32,9 @@
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/VectorSTLIterator.h>
 #include <casacore/scimath/Functionals/HyperPlane.h>
+#include <casacore/casa/OS/OMP.h>
+#include <memory>
+#include <vector>
 
 namespace casacore {  //# Begin namespace casa
 //# Constants
@@ -565,6 +568,99 @@ buildMatrix(const Array<typename FunctionTraits<T>::BaseType> &x,
 	    const Vector<Bool> *const mask) {
   if (!needInit_p) needInit_p = solved_p;
   uInt nrows = testInput_p(x, y, sigma);
+  buildMatrixIt(nrows, x, y, sigma, mask,
+		typename LSQTraits<typename FunctionTraits<T>::BaseType>::
+		num_type());
+}
+
+template<class T>
+void GenericL2Fit<T>::
+buildMatrixIt(uInt nrows,
+	      const Array<typename FunctionTraits<T>::BaseType> &x, 
+	      const Vector<typename FunctionTraits<T>::BaseType> &y,
+	      const Vector<typename FunctionTraits<T>::BaseType> *const sigma,
+	      const Vector<Bool> *const mask, LSQReal) {
+  typedef typename FunctionTraits<T>::BaseType BaseType;
+  typedef typename FunctionTraits<T>::DiffType DiffType;
+  // Number of data points handled at a time.
+  const uInt nChunk = 16384;
+  // The solvable parameters.
+  std::vector<uInt> solvable;
+  for (uInt j=0; j<pCount_p; ++j) {
+    if (ptr_derive_p->mask(j)) solvable.push_back(j);
+  }
+  const uInt nsolv = solvable.size();
+  // Use a copy of the function for the other threads, because functions
+  // keep state while evaluating.
+  uInt nthr = 1;
+  if (nrows >= 4096) nthr = std::min(OMP::maxThreads(), nrows/2048);
+  std::vector<std::unique_ptr<Function<DiffType> > > funcs(nthr);
+  for (uInt t=1; t<nthr; ++t) funcs[t].reset(ptr_derive_p->clone());
+  ptr_derive_p->lockParam(); // Parameters will not change during loop
+  const uInt nbuf = std::min(nChunk, nrows);
+  std::vector<uInt> rows(nbuf);
+  std::vector<BaseType> args(size_t(nbuf)*ndim_p);
+  std::vector<BaseType> wt(nbuf);
+  std::vector<BaseType> obs(nbuf);
+  std::vector<BaseType> ceq(size_t(nbuf)*nsolv);
+  std::vector<DiffType> vals(nbuf);
+  BaseType sig(1.0);
+  uInt i = 0;
+  while (i < nrows) {
+    // Collect the data points to use and their arguments.
+    uInt n = 0;
+    for (; i<nrows && n<nChunk; ++i) {
+      if (mask && !((*mask)[i])) continue;
+      if (sigma) {
+	if ((*sigma)[i] == BaseType(0) || (*sigma)[i] == BaseType(-1)) continue;
+	sig = (*sigma)[i];
+	if (!asweight_p) {
+	  sig = abs(BaseType(1.0)/sig); 
+	  sig *= sig;
+	}
+      }
+      rows[n] = i;
+      wt[n] = abs(sig);
+      if (x.ndim() == 1) {
+	if (ndim_p > 0) {
+	  args[n] = static_cast<const Vector<BaseType> &>(x)[i];
+	}
+      } else {
+	const Matrix<BaseType> &xt = static_cast<const Matrix<BaseType> &>(x);
+	for (uInt k=0; k<ndim_p; ++k) args[size_t(n)*ndim_p + k] = xt(i,k);
+      }
+      ++n;
+    }
+    // Evaluate the function and fill the condition equations.
+    const uInt nt = (n >= 2048 ? nthr : 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(nt)
+#endif
+    for (uInt t=0; t<nt; ++t) {
+      const Function<DiffType> &func = (t==0 ? *ptr_derive_p : *funcs[t]);
+      uInt st = size_t(n)*t/nt;
+      uInt end = size_t(n)*(t+1)/nt;
+      func.evalMany(args.data() + size_t(st)*ndim_p, vals.data() + st,
+		    end-st);
+      for (uInt k=st; k<end; ++k) {
+	obs[k] = y(rows[k]) - vals[k].value();
+	for (uInt j=0; j<nsolv; ++j) {
+	  ceq[size_t(k)*nsolv + j] = vals[k].deriv(solvable[j]);
+	}
+      }
+    }
+    makeNormBlock(n, ceq.data(), wt.data(), obs.data());
+  }
+  ptr_derive_p->unlockParam();
+}
+
+template<class T>
+void GenericL2Fit<T>::
+buildMatrixIt(uInt nrows,
+	      const Array<typename FunctionTraits<T>::BaseType> &x, 
+	      const Vector<typename FunctionTraits<T>::BaseType> &y,
+	      const Vector<typename FunctionTraits<T>::BaseType> *const sigma,
+	      const Vector<Bool> *const mask, LSQComplex) {
   typename FunctionTraits<T>::BaseType b(0.0);
   typename FunctionTraits<T>::BaseType sig(1.0);
   VectorSTLIterator<typename FunctionTraits<T>::BaseType> ceqit(condEq_p);
@@ -634,6 +634,20 @@ class LSQFit {
 		      const U &obs, const U &obs2,
 		      Bool doNorm=True, Bool doKnown=True);
   // </group>
+  // Add a block of <src>nEq</src> real condition equations. The
+  // <src>nUnknowns</src> coefficients of equation <src>k</src> start at
+  // <src>cEq[k*nUnknowns]</src>; <src>weight[k]</src> and <src>obs[k]</src>
+  // give its weight and observed value. The result is the same as calling
+  // the real <src>makeNorm()</src> for each equation (apart from
+  // rounding if done in parallel). The equations are handled in groups, so the update of the
+  // normal equations can be done as a cache friendly rank-k update.
+  // If OpenMP is used and the block is large enough, the groups are
+  // accumulated in parallel into a partial normal matrix per thread,
+  // which are added at the end.
+  template <class U>
+    void makeNormBlock(uInt nEq, const U *cEq, const U *weight,
+		       const U *obs,
+		       Bool doNorm=True, Bool doKnown=True);
   // Get the <src>n-th</src> (from 0 to the rank deficiency, or missing rank,
   // see e.g. <src>getDeficiency()</src>)
   // constraint equation as determined by <src>invert()</src> in SVD-mode in
@@ -966,6 +980,17 @@ class LSQFit {
   Double normInfKnown(const Double *known) const;
   // Merge sparse normal equations
   Bool mergeIt(const LSQFit &other, uInt nIndex, const uInt *nEqIndex);
+  // Add a group of at most <src>nGroup</src> real condition equations to
+  // the given triangular normal matrix, known terms and statistics
+  // (number of equations, sum of weights, sum of squared observations).
+  // <src>work</src> must have room for <src>(2*nUnknowns+1)*nGroup</src>
+  // values.
+  template <class U>
+    void makeNormGroup(uInt nEq, uInt nGroup, const U *cEq,
+		       const U *weight, const U *obs,
+		       Bool doNorm, Bool doKnown,
+		       Double *norm, Double *known, Double *stats,
+		       Double *work) const;
   // Save current status (or part)
   void save(Bool all=True);
   // Restore current status
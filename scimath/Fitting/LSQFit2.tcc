@@ -32,7 +32,9 @@
 //
 //# Includes
 #include <casacore/scimath/Fitting/LSQFit.h>
+#include <casacore/casa/OS/OMP.h>
 #include <algorithm>
+#include <vector>
 
 using namespace std;
 
@@ -1029,6 +1031,122 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
   //
   template <class U>
+  void LSQFit::makeNormBlock(uInt nEq, const U *cEq, const U *weight,
+			     const U *obs,
+			     Bool doNorm, Bool doKnown) {
+    if (nEq == 0 || nun_p == 0 || !(doNorm || doKnown)) return;
+    // Number of equations in a group; the group's transposed coefficients
+    // and weighted coefficients have to fit in the cache.
+    const uInt nGroup = std::max(uInt(8), std::min(uInt(64),
+						     uInt(4096/nun_p)));
+    const uInt nGroups = (nEq + nGroup - 1) / nGroup;
+    const size_t nwork = (2*size_t(nun_p) + 1) * nGroup;
+    Double stats[3] = {error_p[NC], error_p[SUMWEIGHT], error_p[SUMLL]};
+    // Only run in parallel if there is enough work to outweigh the
+    // partial normal matrices.
+    const Bool parallel = (OMP::maxThreads() > 1  &&  nGroups > 1  &&
+			   Double(nEq)*nun_p*nun_p > 4e6);
+    if (!parallel) {
+      std::vector<Double> work(nwork);
+      Double *norm = (doNorm ? norm_p->row(0) : 0);
+      for (uInt k=0; k<nEq; k+=nGroup) {
+	makeNormGroup(std::min(nGroup, nEq-k), nGroup, cEq + size_t(k)*nun_p,
+		      weight+k, obs+k, doNorm, doKnown,
+		      norm, known_p, stats, &work[0]);
+      }
+    } else {
+      const size_t nnorm = (doNorm ? norm_p->nelements() : 0);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+      {
+	// Accumulate in a partial normal matrix per thread.
+	std::vector<Double> work(nwork);
+	std::vector<Double> norm(nnorm, 0.);
+	std::vector<Double> known(nun_p, 0.);
+	Double tstats[3] = {0, 0, 0};
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+	for (Int g=0; g<Int(nGroups); ++g) {
+	  uInt k = g*nGroup;
+	  makeNormGroup(std::min(nGroup, nEq-k), nGroup,
+			cEq + size_t(k)*nun_p, weight+k, obs+k,
+			doNorm, doKnown,
+			(doNorm ? &norm[0] : 0), &known[0], tstats, &work[0]);
+	}
+#ifdef _OPENMP
+#pragma omp critical(LSQFit_makeNormBlock)
+#endif
+	{
+	  if (doNorm) {
+	    Double *i2 = norm_p->row(0);
+	    for (size_t i=0; i<nnorm; ++i) i2[i] += norm[i];
+	  }
+	  if (doKnown) {
+	    for (uInt i=0; i<nun_p; ++i) known_p[i] += known[i];
+	  }
+	  for (uInt i=0; i<3; ++i) stats[i] += tstats[i];
+	}
+      }
+    }
+    if (doNorm) state_p &= ~TRIANGLE;
+    if (doKnown) {
+      error_p[NC] = stats[0];			 // cnt equations
+      error_p[SUMWEIGHT] = stats[1];		 // sum weight
+      error_p[SUMLL] = stats[2];		 // sum rms
+    }
+  }
+  //
+  template <class U>
+  void LSQFit::makeNormGroup(uInt nEq, uInt nGroup, const U *cEq,
+			     const U *weight, const U *obs,
+			     Bool doNorm, Bool doKnown,
+			     Double *norm, Double *known, Double *stats,
+			     Double *work) const {
+    // Transpose the coefficients, so the sums over the equations in the
+    // rank-k update below run over contiguous memory. The terms are added
+    // in the same order as makeNorm does, so the results are the same.
+    Double *ceq = work;				 // [nun_p][nGroup]
+    Double *wceq = work + size_t(nGroup)*nun_p;	 // weighted ceq
+    Double *obswt = wceq + size_t(nGroup)*nun_p;	 // weighted obs
+    for (uInt k=0; k<nEq; ++k) {
+      obswt[k] = obs[k]*weight[k];
+      const U *eq = cEq + size_t(k)*nun_p;
+      const Double wt(weight[k]);
+      for (uInt i=0; i<nun_p; ++i) {
+	ceq[i*nGroup + k] = Double(eq[i]);
+	wceq[i*nGroup + k] = Double(eq[i])*wt;
+      }
+    }
+    if (doNorm) {
+      for (uInt i=0; i<nun_p; ++i) {
+	Double *i2 = norm + ((2*nun_p-1-i)*i)/2; // row pointer
+	const Double *wci = wceq + i*nGroup;
+	for (uInt i1=i; i1<nun_p; ++i1) {
+	  const Double *ci1 = ceq + i1*nGroup;
+	  Double sum = i2[i1];
+	  for (uInt k=0; k<nEq; ++k) sum += wci[k]*ci1[k];
+	  i2[i1] = sum;
+	}
+      }
+    }
+    if (doKnown) {
+      for (uInt i=0; i<nun_p; ++i) {
+	const Double *ci = ceq + i*nGroup;
+	Double sum = known[i];
+	for (uInt k=0; k<nEq; ++k) sum += ci[k]*obswt[k];
+	known[i] = sum;				 // data vector
+      }
+      for (uInt k=0; k<nEq; ++k) {
+	stats[0] += 1;				 // cnt equations
+	stats[1] += weight[k];			 // sum weight
+	stats[2] += obs[k]*obswt[k];		 // sum rms
+      }
+    }
+  }
+  //
+  template <class U>
   Bool LSQFit::getConstraint(uInt n, U *cEq) const {
     n += r_p;
     if (n<nun_p) {
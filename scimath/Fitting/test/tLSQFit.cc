@@ -148,6 +148,35 @@ void showdt(const LSQFit &lsq) {
   cout << "---------------------------------------------------" << endl;
 }
 
+// Compare the normal equations made per equation and per block.
+Bool checkBlock(uInt nEq, uInt nun) {
+  std::vector<Double> cEq(nEq*nun), wt(nEq), obs(nEq);
+  MLCG genit;
+  Normal noise(&genit, 0.0, 1.0);
+  for (uInt k=0; k<nEq; ++k) {
+    for (uInt i=0; i<nun; ++i) cEq[k*nun+i] = noise();
+    wt[k] = 1 + 0.5*(k%3);
+    obs[k] = noise();
+  }
+  LSQFit lsq1(nun);
+  LSQFit lsq2(nun);
+  for (uInt k=0; k<nEq; ++k) lsq1.makeNorm(&cEq[k*nun], wt[k], obs[k]);
+  lsq2.makeNormBlock(nEq, &cEq[0], &wt[0], &obs[0]);
+  uInt rank1, rank2;
+  if (!lsq1.invert(rank1) || !lsq2.invert(rank2) || rank1 != rank2) {
+    return False;
+  }
+  std::vector<Double> sol1(nun), sol2(nun);
+  lsq1.solve(&sol1[0]);
+  lsq2.solve(&sol2[0]);
+  Double mu1 = lsq1.getSD();
+  Double mu2 = lsq2.getSD();
+  for (uInt i=0; i<nun; ++i) {
+    if (abs(sol1[i] - sol2[i]) > 1e-10) return False;
+  }
+  return abs(mu1 - mu2) < 1e-10;
+}
+
 int main() {
 
   const uInt N=3;		// # unknowns
@@ -1480,6 +1509,10 @@ int main() {
     }
 
     cout << "---------------------------------------------------" << endl;
+    // Block of equations; the large one is done in parallel if possible.
+    cout << "Block normal equations: " <<
+      (checkBlock(100, 5) && checkBlock(40000, 12) ? "ok" : "failed") << endl;
+    cout << "---------------------------------------------------" << endl;
   } catch (std::exception& x) {
     cout << x.what() << endl;
   }
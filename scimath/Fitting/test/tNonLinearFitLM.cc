@@ -929,6 +929,34 @@ int main() {
     }
   }
   cout << endl;
+
+  // Fit a 2-D Gaussian to an image large enough to be done in chunks
+  // (and in parallel if possible).
+  {
+    const uInt nx = 150;
+    const uInt ny = 120;
+    Gaussian2D<Double> gauss(10, 70, 62, 20, 0.6, 0.4);
+    Matrix<Double> x(nx*ny, 2);
+    Vector<Double> y(nx*ny);
+    MLCG generator;
+    Normal noise(&generator, 0.0, 0.01);
+    for (uInt i=0; i<nx*ny; ++i) {
+      x(i,0) = i%nx;
+      x(i,1) = i/nx;
+      y[i] = gauss(x(i,0), x(i,1)) + noise();
+    }
+    NonLinearFitLM<Double> fitterg;
+    fitterg.setMaxIter(100);
+    fitterg.setCriteria(0.0001);
+    Gaussian2D<AutoDiff<Double> > gaussg(9.5, 69, 61, 19, 0.62, 0.38);
+    fitterg.setFunction(gaussg);
+    Vector<Double> solution = fitterg.fit(x, y);
+    AlwaysAssertExit(fitterg.converged());
+    AlwaysAssertExit(allNearAbs(solution, gauss.parameters().getParameters(),
+				0.05));
+    cout << "Test for large 2-D Gaussian succeeded" << endl;
+  }
+  cout << endl;
   
   cout << "OK" << endl;
   return 0;
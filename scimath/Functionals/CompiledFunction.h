@@ -149,6 +149,15 @@ template <class T> class CompiledFunction : public CompiledParam<T> {
   //# Operators
   // Evaluate the function at <src>x</src>.
   virtual T eval(typename Function<T>::FunctionArg x) const;
+
+  // Evaluate the function at the <src>n</src> points in <src>x</src>.
+  // The compiled code is executed one operation at a time for a block of
+  // points, so the interpretation overhead is paid once per block and the
+  // inner loops can be vectorized. Derivatives are obtained in the same way
+  // if <src>T</src> is an AutoDiff. Code containing jumps (i.e. the
+  // <src>?:</src> operator) is evaluated point by point.
+  virtual void evalMany(typename Function<T>::FunctionArg x, T *result,
+			size_t n) const;
   
   //# Member functions
   // Return a copy of this object from the heap. The caller is responsible for
@@ -161,6 +170,11 @@ template <class T> class CompiledFunction : public CompiledParam<T> {
   virtual Function<typename FunctionTraits<T>::BaseType> *cloneNonAD() const {
     return new CompiledFunction<typename FunctionTraits<T>::BaseType>(*this); }
   // </group>
+
+ private:
+  // Check if the compiled code can be executed block-wise. If so, the
+  // maximum depth of the execution stack is returned in <src>depth</src>.
+  Bool blockable(uInt &depth) const;
   
 };
 
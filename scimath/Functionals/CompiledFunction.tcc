@@ -34,6 +34,7 @@
 #include <casacore/scimath/Mathematics/NumericTraits.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/stdvector.h>
+#include <algorithm>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -254,6 +255,268 @@ T CompiledFunction<T>::eval(typename Function<T>::FunctionArg x) const {
   return res;
 }
 
+template<class T>
+Bool CompiledFunction<T>::blockable(uInt &depth) const {
+  depth = 0;
+  if (!this->functionPtr_p) return False;
+  Int level = 0;
+  for (vector<FuncExprData::ExprOperator>::const_iterator
+	 pos = this->functionPtr_p->getCode().begin();
+       pos != this->functionPtr_p->getCode().end(); pos++) {
+    switch (pos->code) {
+    case FuncExprData::CONST:
+    case FuncExprData::PARAM:
+    case FuncExprData::ARG:
+      ++level;
+      break;
+    case FuncExprData::PI:
+    case FuncExprData::EE:
+      if (pos->state.argcnt == 0) ++level;
+      break;
+    case FuncExprData::GOTO:
+    case FuncExprData::GOTOF:
+    case FuncExprData::GOTOT:
+      return False;
+    case FuncExprData::UNAMIN: case FuncExprData::UNAPLUS:
+    case FuncExprData::POW: case FuncExprData::GTE:
+    case FuncExprData::LTE: case FuncExprData::EQ:
+    case FuncExprData::NEQ: case FuncExprData::OR:
+    case FuncExprData::AND: case FuncExprData::ADD:
+    case FuncExprData::SUB: case FuncExprData::MUL:
+    case FuncExprData::DIV: case FuncExprData::CONDEX3:
+    case FuncExprData::TOIMAG: case FuncExprData::NOP:
+    case FuncExprData::SIN: case FuncExprData::COS:
+    case FuncExprData::ATAN: case FuncExprData::ATAN2:
+    case FuncExprData::ASIN: case FuncExprData::ACOS:
+    case FuncExprData::EXP: case FuncExprData::EXP2:
+    case FuncExprData::EXP10: case FuncExprData::LOG:
+    case FuncExprData::LOG2: case FuncExprData::LOG10:
+    case FuncExprData::ERF: case FuncExprData::ERFC:
+    case FuncExprData::ABS: case FuncExprData::FLOOR:
+    case FuncExprData::CEIL: case FuncExprData::ROUND:
+    case FuncExprData::INT: case FuncExprData::FRACT:
+    case FuncExprData::SQRT: case FuncExprData::REAL:
+    case FuncExprData::IMAG: case FuncExprData::AMPL:
+    case FuncExprData::PHASE:
+      break;
+    default:
+      return False;
+    }
+    if (pos->narg == 2 ||
+	(pos->code == FuncExprData::ATAN && pos->state.argcnt == 2)) {
+      --level;
+    }
+    if (level < 1) return False;
+    if (static_cast<uInt>(level) > depth) depth = level;
+  }
+  return level == 1;
+}
+
+template<class T>
+void CompiledFunction<T>::evalMany(typename Function<T>::FunctionArg x,
+				   T *result, size_t n) const {
+  uInt depth;
+  if (n < 2 || !blockable(depth)) {
+    Function<T>::evalMany(x, result, n);
+    return;
+  }
+  typedef typename FunctionTraits<T>::BaseType BaseType;
+  const uInt nd = this->ndim();
+  const vector<FuncExprData::ExprOperator> &code =
+    this->functionPtr_p->getCode();
+  const vector<Double> &constv = this->functionPtr_p->getConst();
+  // The execution stack contains a block of values per level.
+  const size_t blk = 64;
+  vector<T> exec(depth*blk);
+  for (size_t start=0; start<n; start+=blk) {
+    const size_t nb = std::min(blk, n-start);
+    typename Function<T>::FunctionArg xb = x + start*nd;
+    T *top = 0;
+    for (vector<FuncExprData::ExprOperator>::const_iterator
+	   pos = code.begin(); pos != code.end(); pos++) {
+      const T *t = 0;
+      if (pos->narg == 2 ||
+	  (pos->code == FuncExprData::ATAN && pos->state.argcnt == 2)) {
+	t = top;
+	top -= blk;
+      }
+      switch (pos->code) {
+      case FuncExprData::UNAMIN:
+	for (size_t i=0; i<nb; ++i) top[i] = -top[i];
+	break;
+      case FuncExprData::UNAPLUS:
+      case FuncExprData::NOP:
+      case FuncExprData::REAL:
+      case FuncExprData::AMPL:
+	break;
+
+      case FuncExprData::POW:
+	for (size_t i=0; i<nb; ++i) top[i] = pow(top[i], t[i]);
+	break;
+      case FuncExprData::GTE:
+	for (size_t i=0; i<nb; ++i) top[i] = top[i] >= t[i] ? T(1) : T(0);
+	break;
+      case FuncExprData::LTE:
+	for (size_t i=0; i<nb; ++i) top[i] = top[i] <= t[i] ? T(1) : T(0);
+	break;
+      case FuncExprData::EQ:
+	for (size_t i=0; i<nb; ++i) top[i] = top[i] == t[i] ? T(1) : T(0);
+	break;
+      case FuncExprData::NEQ:
+	for (size_t i=0; i<nb; ++i) top[i] = top[i] != t[i] ? T(1) : T(0);
+	break;
+      case FuncExprData::OR:
+	for (size_t i=0; i<nb; ++i) {
+	  top[i] = (top[i] != T(0) || t[i] != T(0)) ? T(1) : T(0);
+	}
+	break;
+      case FuncExprData::AND:
+	for (size_t i=0; i<nb; ++i) {
+	  top[i] = (t[i]*top[i] != T(0)) ? T(1) : T(0);
+	}
+	break;
+      case FuncExprData::ADD:
+	for (size_t i=0; i<nb; ++i) top[i] += t[i];
+	break;
+      case FuncExprData::SUB:
+	for (size_t i=0; i<nb; ++i) top[i] -= t[i];
+	break;
+      case FuncExprData::MUL:
+	for (size_t i=0; i<nb; ++i) top[i] *= t[i];
+	break;
+      case FuncExprData::DIV:
+	for (size_t i=0; i<nb; ++i) top[i] /= t[i];
+	break;
+      case FuncExprData::CONDEX3:
+	for (size_t i=0; i<nb; ++i) top[i] = t[i];
+	break;
+
+      case FuncExprData::CONST: {
+	top = (top ? top+blk : &exec[0]);
+	const T c(constv[pos->info]);
+	for (size_t i=0; i<nb; ++i) top[i] = c;
+	break; }
+      case FuncExprData::PARAM: {
+	top = (top ? top+blk : &exec[0]);
+	const T &p = this->param_p[pos->info];
+	for (size_t i=0; i<nb; ++i) top[i] = p;
+	break; }
+      case FuncExprData::ARG:
+	top = (top ? top+blk : &exec[0]);
+	for (size_t i=0; i<nb; ++i) top[i] = T(xb[i*nd + pos->info]);
+	break;
+      case FuncExprData::TOIMAG:
+	for (size_t i=0; i<nb; ++i) {
+	  NumericTraits<T>::setValue(top[i],
+				     NumericTraits<T>::getValue(top[i], 0),
+				     1);
+	  NumericTraits<T>::setValue(top[i],
+				     typename NumericTraits<T>::BaseType(0.0),
+				     0);
+	}
+	break;
+
+      case FuncExprData::SIN:
+	for (size_t i=0; i<nb; ++i) top[i] = sin(top[i]);
+	break;
+      case FuncExprData::COS:
+	for (size_t i=0; i<nb; ++i) top[i] = cos(top[i]);
+	break;
+      case FuncExprData::ATAN:
+	if (pos->state.argcnt == 1) {
+	  for (size_t i=0; i<nb; ++i) top[i] = atan(top[i]);
+	  break;
+	}
+	CASACORE_FALLTHROUGH;
+      case FuncExprData::ATAN2:
+	for (size_t i=0; i<nb; ++i) top[i] = atan2(top[i], t[i]);
+	break;
+      case FuncExprData::ASIN:
+	for (size_t i=0; i<nb; ++i) top[i] = asin(top[i]);
+	break;
+      case FuncExprData::ACOS:
+	for (size_t i=0; i<nb; ++i) top[i] = acos(top[i]);
+	break;
+      case FuncExprData::EXP:
+	for (size_t i=0; i<nb; ++i) top[i] = exp(top[i]);
+	break;
+      case FuncExprData::EXP2:
+	for (size_t i=0; i<nb; ++i) {
+	  top[i] = exp(top[i]*static_cast<BaseType>(C::ln2));
+	}
+	break;
+      case FuncExprData::EXP10:
+	for (size_t i=0; i<nb; ++i) {
+	  top[i] = exp(top[i]*static_cast<BaseType>(C::ln10));
+	}
+	break;
+      case FuncExprData::LOG:
+	for (size_t i=0; i<nb; ++i) top[i] = log(top[i]);
+	break;
+      case FuncExprData::LOG2:
+	for (size_t i=0; i<nb; ++i) {
+	  top[i] = log(top[i])/static_cast<BaseType>(C::ln2);
+	}
+	break;
+      case FuncExprData::LOG10:
+	for (size_t i=0; i<nb; ++i) top[i] = log10(top[i]);
+	break;
+      case FuncExprData::ERF:
+	for (size_t i=0; i<nb; ++i) top[i] = erf(top[i]);
+	break;
+      case FuncExprData::ERFC:
+	for (size_t i=0; i<nb; ++i) top[i] = erfc(top[i]);
+	break;
+      case FuncExprData::PI:
+      case FuncExprData::EE: {
+	const BaseType c = static_cast<BaseType>
+	  (pos->code == FuncExprData::PI ? C::pi : C::e);
+	if (pos->state.argcnt == 0) {
+	  top = (top ? top+blk : &exec[0]);
+	  for (size_t i=0; i<nb; ++i) top[i] = T(c);
+	} else {
+	  for (size_t i=0; i<nb; ++i) top[i] *= c;
+	}
+	break; }
+      case FuncExprData::ABS:
+	for (size_t i=0; i<nb; ++i) top[i] = abs(top[i]);
+	break;
+      case FuncExprData::FLOOR:
+	for (size_t i=0; i<nb; ++i) top[i] = floor(top[i]);
+	break;
+      case FuncExprData::CEIL:
+	for (size_t i=0; i<nb; ++i) top[i] = ceil(top[i]);
+	break;
+      case FuncExprData::ROUND:
+	for (size_t i=0; i<nb; ++i) top[i] = floor(top[i]+T(0.5));
+	break;
+      case FuncExprData::INT:
+	for (size_t i=0; i<nb; ++i) {
+	  if (top[i] < T(0)) top[i] = floor(top[i]);
+	  else top[i] = ceil(top[i]);
+	}
+	break;
+      case FuncExprData::FRACT:
+	for (size_t i=0; i<nb; ++i) {
+	  if (top[i] < T(0)) top[i] -= ceil(top[i]);
+	  else top[i] -= floor(top[i]);
+	}
+	break;
+      case FuncExprData::SQRT:
+	for (size_t i=0; i<nb; ++i) top[i] = sqrt(top[i]);
+	break;
+      case FuncExprData::IMAG:
+      case FuncExprData::PHASE:
+	for (size_t i=0; i<nb; ++i) top[i] = T(0);
+	break;
+      default:
+	break;
+      }
+    }
+    for (size_t i=0; i<nb; ++i) result[start+i] = top[i];
+  }
+}
+
 } //# NAMESPACE CASACORE - END
 
 
@@ -28,6 +28,7 @@
 
 //# Includes
 #include <casacore/scimath/Functionals/CompoundFunction.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -52,6 +53,30 @@ eval(typename Function<AutoDiff<T> >::FunctionArg x) const {
   return tmp;
 }
 
+template <class T>
+void CompoundFunction<AutoDiff<T> >::
+evalMany(typename Function<AutoDiff<T> >::FunctionArg x,
+	 AutoDiff<T> *result, size_t n) const {
+  if (this->parset_p) fromParam_p();
+  for (size_t k=0; k<n; ++k) {
+    result[k] = AutoDiff<T>(T(0), this->nparameters());
+    result[k].value() = 0;
+    for (uInt j=0; j<result[k].nDerivatives(); j++) result[k].deriv(j) = 0.0;
+  }
+  // Evaluate the points per function and add the results.
+  std::vector<AutoDiff<T> > tmp(n);
+  for (uInt i = 0; i< this->nFunctions(); ++i) {
+    this->function(i).evalMany(x, tmp.data(), n);
+    const uInt off = this->paroff_p[i];
+    for (size_t k=0; k<n; ++k) {
+      result[k].value() += tmp[k].value();
+      for (uInt j=0; j<tmp[k].nDerivatives(); ++j) {
+	result[k].deriv(off+j) += tmp[k].deriv(j);
+      }
+    }
+  }
+}
+
 //# Member functions
 template <class T>
 uInt CompoundFunction<AutoDiff<T> >::
@@ -140,7 +140,11 @@ public:
   
   //# Operators
   // Evaluate the function at <src>x</src>.
+  // <group>
   virtual T eval(typename Function<T>::FunctionArg x) const;
+  virtual void evalMany(typename Function<T>::FunctionArg x, T *result,
+			size_t n) const;
+  // </group>
   
   //# Member functions
   // Consolidate the parameter settings. This could be necessary if
@@ -223,8 +227,12 @@ public CompoundParam<AutoDiff<T> >
   //# Operators
   // Evaluate the function and its derivatives at <src>x</src> <em>wrt</em>
   // to the coefficients.
+  // <group>
   virtual AutoDiff<T>
     eval(typename Function<AutoDiff<T> >::FunctionArg x) const;
+  virtual void evalMany(typename Function<AutoDiff<T> >::FunctionArg x,
+			AutoDiff<T> *result, size_t n) const;
+  // </group>
   
   //# Member functions
 // Add a function to the sum. All functions must have the same 
@@ -28,6 +28,7 @@
 
 //# Includes
 #include <casacore/scimath/Functionals/CompoundFunction.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -42,6 +43,19 @@ T CompoundFunction<T>::eval(typename Function<T>::FunctionArg x) const {
   return tmp;
 }
 
+template<class T>
+void CompoundFunction<T>::evalMany(typename Function<T>::FunctionArg x,
+				   T *result, size_t n) const {
+  if (parset_p) fromParam_p();
+  for (size_t k=0; k<n; ++k) result[k] = T(0);
+  // Evaluate the points per function and add the results.
+  std::vector<T> tmp(n);
+  for (uInt i = 0; i<nFunctions(); ++i) {
+    function(i).evalMany(x, tmp.data(), n);
+    for (size_t k=0; k<n; ++k) result[k] += tmp[k];
+  }
+}
+
 //# Member functions
 template <class T>
 void CompoundFunction<T>::fromParam_p() const {
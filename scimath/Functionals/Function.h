@@ -230,6 +230,16 @@ class RecordInterface;
      // Evaluate the function object
      virtual U eval(FunctionArg x) const = 0;
 
+     // Evaluate the function object at <src>n</src> points. The arguments
+     // of the points are stored one after another in <src>x</src>, thus
+     // <src>x</src> must contain <src>n*ndim()</src> values.
+     // The default implementation calls <src>eval</src> for each point.
+     // Functions used to evaluate large amounts of points (e.g. for
+     // component models) override it to take the parameter handling out of
+     // the loop over the points, which makes it possible for the compiler
+     // to vectorize the loop.
+     virtual void evalMany(FunctionArg x, U *result, size_t n) const;
+
      //# Operators
      // Manipulate the nth parameter (0-based) with no index check
      // <group>
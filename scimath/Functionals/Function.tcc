@@ -61,6 +61,12 @@ U Function<T,U>::operator()(const ArgType &x, const ArgType &y,
   return this->eval(&(arg_p[0]));
 } 
 
+template<class T, class U>
+void Function<T,U>::evalMany(FunctionArg x, U *result, size_t n) const {
+  const uInt nd = ndim();
+  for (size_t i=0; i<n; ++i) result[i] = this->eval(x + i*nd);
+}
+
 template<class T, class U>
 const String &Function<T,U>::name() const {
   static String x("unknown");
@@ -73,7 +73,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 template<class T, class U=T> class Function1D : public Function<T,U> {
   public:
   //# Typedefs
-  typedef const T* FunctionArg;
+  typedef typename Function<T,U>::FunctionArg FunctionArg;
   
   //# Constructors
   // Constructors
@@ -31,6 +31,7 @@
 #include <casacore/scimath/Mathematics/AutoDiff.h>
 #include <casacore/scimath/Mathematics/AutoDiffA.h>
 #include <casacore/scimath/Mathematics/AutoDiffX.h>
+#include <casacore/scimath/Mathematics/AutoDiffN.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -118,6 +119,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // <li> <src>AutoDiff<T></src>
 // <li> <src>AutoDiffA<T></src>
 // <li> <src>AutoDiffX<T></src>
+// <li> <src>AutoDiffN<T,N></src>
 // </ul>
 // </synopsis>
 //
@@ -245,6 +247,35 @@ public:
 
 #undef FunctionTraits_PX
 
+#define FunctionTraits_PN FunctionTraits
+
+// <summary> FunctionTraits specialization for AutoDiffN
+// </summary>
+
+template <class T, uInt N> class FunctionTraits_PN<AutoDiffN<T,N> > {
+public:
+  // Actual template type
+  typedef AutoDiffN<T,N> Type; 
+  // Template base type
+  typedef T BaseType;
+  // Template numeric type
+  typedef typename FunctionTraits_PN<T>::NumericType NumericType;
+  // Type for parameters
+  typedef AutoDiffN<T,N> ParamType;
+  // Type for arguments
+  typedef T ArgType;
+  // Default type for differentiation
+  typedef AutoDiffN<T,N> DiffType;
+  // Get the value
+  static const T &getValue(const Type &in) {
+    return FunctionTraits<T>::getValue(in.value()); }
+  // Set a value (and possible derivative)
+  static void setValue(Type &out, const T &val, const uInt nder,
+		       const uInt i) { out = Type(val, nder, i); }
+};
+
+#undef FunctionTraits_PN
+
 
 } //# NAMESPACE CASACORE - END
 
@@ -41,6 +41,19 @@ T Gaussian1D<T>::eval(typename Function1D<T>::FunctionArg x) const {
   return param_p[HEIGHT] * exp(-(value*value));
 }
 
+template<class T>
+void Gaussian1D<T>::evalMany(typename Function1D<T>::FunctionArg x,
+			     T *result, size_t n) const {
+  const T height = param_p[HEIGHT];
+  const T center = param_p[CENTER];
+  const T width  = param_p[WIDTH];
+  const T f2i    = fwhm2int;
+  for (size_t i=0; i<n; ++i) {
+    T value = (x[i] - center)/width/f2i;
+    result[i] = height * exp(-(value*value));
+  }
+}
+
 //# Member functions
 
 } //# NAMESPACE CASACORE - END
@@ -64,6 +64,39 @@ eval(typename Function<AutoDiff<T> >::FunctionArg x) const {
   return tmp;
 }
 
+template<class T>
+void Gaussian1D<AutoDiff<T> >::
+evalMany(typename Function<AutoDiff<T> >::FunctionArg x,
+	 AutoDiff<T> *result, size_t n) const {
+  AutoDiff<T> tmp;
+  if (this->param_p[this->HEIGHT].nDerivatives() > 0) tmp = this->param_p[this->HEIGHT];
+  else if (this->param_p[this->CENTER].nDerivatives() > 0) tmp = this->param_p[this->CENTER];
+  else if (this->param_p[this->WIDTH].nDerivatives() > 0) tmp = this->param_p[this->WIDTH];
+  const uInt nder = tmp.nDerivatives();
+  for (uInt j=0; j<nder; j++) tmp.deriv(j) = 0.0;
+  const T height = this->param_p[this->HEIGHT].value();
+  const T center = this->param_p[this->CENTER].value();
+  const T width  = this->param_p[this->WIDTH].value();
+  const T f2i    = this->fwhm2int.value();
+  const Bool mHeight = this->param_p.mask(this->HEIGHT);
+  const Bool mCenter = this->param_p.mask(this->CENTER);
+  const Bool mWidth  = this->param_p.mask(this->WIDTH);
+  for (size_t i=0; i<n; ++i) {
+    T x_norm = (x[i] - center)/width/f2i;
+    T exponential = exp(-(x_norm*x_norm));
+    // Copy the zeroed template to get the correct number of derivatives.
+    result[i] = tmp;
+    result[i].value() = height * exponential;
+    if (nder > 0) {
+      T dev = exponential;
+      if (mHeight) result[i].deriv(this->HEIGHT) = dev;
+      dev *= height*x_norm*T(2.0)/width/f2i;
+      if (mCenter) result[i].deriv(this->CENTER) = dev;
+      if (mWidth)  result[i].deriv(this->WIDTH) = dev*x_norm*f2i;
+    }
+  }
+}
+
 //# Member functions
 
 } //# NAMESPACE CASACORE - END
@@ -212,6 +212,8 @@ public:
   // Evaluate the Gaussian at <src>x</src>.
   // <group>
   virtual T eval(typename Function<T>::FunctionArg x) const;
+  virtual void evalMany(typename Function<T>::FunctionArg x, T *result,
+			size_t n) const;
   // </group>
 
   //# Member functions
@@ -293,6 +295,8 @@ public:
   // Evaluate the Gaussian and its derivatives at <src>x</src>.
   // <group>
   virtual AutoDiff<T> eval(typename Function<AutoDiff<T> >::FunctionArg x) const;
+  virtual void evalMany(typename Function<AutoDiff<T> >::FunctionArg x,
+			AutoDiff<T> *result, size_t n) const;
   // </group>
 
   //# Member functions
@@ -52,6 +52,30 @@ T Gaussian2D<T>::eval(typename Function<T>::FunctionArg x) const {
   return param_p[HEIGHT]*exp(-(xnorm*xnorm + ynorm*ynorm));
 }
 
+template<class T>
+void Gaussian2D<T>::evalMany(typename Function<T>::FunctionArg x,
+			     T *result, size_t n) const {
+  if (param_p[PANGLE] != thePA) {
+    thePA = param_p[PANGLE];
+    theCpa = cos(thePA);
+    theSpa = sin(thePA);
+  }
+  const T height = param_p[HEIGHT];
+  const T xcen = param_p[XCENTER];
+  const T ycen = param_p[YCENTER];
+  const T cpa = theCpa;
+  const T spa = theSpa;
+  const T xwidth = param_p[YWIDTH]*param_p[RATIO]*fwhm2int;
+  const T ywidth = param_p[YWIDTH]*fwhm2int;
+  for (size_t i=0; i<n; ++i) {
+    const T xn = x[2*i]   - xcen;
+    const T yn = x[2*i+1] - ycen;
+    T xnorm = (  cpa*xn + spa*yn) / xwidth;
+    T ynorm = (- spa*xn + cpa*yn) / ywidth;
+    result[i] = height*exp(-(xnorm*xnorm + ynorm*ynorm));
+  }
+}
+
 //# Member functions
 
 //# Member functions
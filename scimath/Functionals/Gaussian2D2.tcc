@@ -99,6 +99,68 @@ eval(typename Function<AutoDiff<T> >::FunctionArg x) const {
   return tmp;
 }
 
+template<class T>
+void Gaussian2D<AutoDiff<T> >::
+evalMany(typename Function<AutoDiff<T> >::FunctionArg x,
+	 AutoDiff<T> *result, size_t n) const {
+  AutoDiff<T> tmp;
+  if (this->param_p[this->HEIGHT].nDerivatives() > 0) tmp = this->param_p[this->HEIGHT];
+  else if (this->param_p[this->XCENTER].nDerivatives() > 0) tmp = this->param_p[this->XCENTER];
+  else if (this->param_p[this->YCENTER].nDerivatives() > 0) tmp = this->param_p[this->YCENTER];
+  else if (this->param_p[this->YWIDTH].nDerivatives() > 0) tmp = this->param_p[this->YWIDTH];
+  else if (this->param_p[this->RATIO].nDerivatives() > 0) tmp = this->param_p[this->RATIO];
+  else if (this->param_p[this->PANGLE].nDerivatives() > 0) tmp = this->param_p[this->PANGLE];
+  const uInt nder = tmp.nDerivatives();
+  for (uInt k=0; k<nder; k++) tmp.deriv(k) = 0.0;
+  if (this->param_p[this->PANGLE] != this->thePA) {
+    this->thePA = this->param_p[this->PANGLE];
+    this->theCpa = cos(this->thePA);
+    this->theSpa = sin(this->thePA);
+  }
+  this->theXwidth.value() = this->param_p[this->YWIDTH].value() * this->param_p[this->RATIO].value();
+  const T height = this->param_p[this->HEIGHT].value();
+  const T xcen = this->param_p[this->XCENTER].value();
+  const T ycen = this->param_p[this->YCENTER].value();
+  const T ywidth = this->param_p[this->YWIDTH].value();
+  const T xwidth = this->theXwidth.value();
+  const T cpa = this->theCpa.value();
+  const T spa = this->theSpa.value();
+  const T f2i = this->fwhm2int.value();
+  const T xwidth2 = xwidth*xwidth*f2i*f2i;
+  const T ywidth2 = ywidth*ywidth*f2i*f2i;
+  const Bool mHeight = this->param_p.mask(this->HEIGHT);
+  const Bool mXcen   = this->param_p.mask(this->XCENTER);
+  const Bool mYcen   = this->param_p.mask(this->YCENTER);
+  const Bool mYwidth = this->param_p.mask(this->YWIDTH);
+  const Bool mRatio  = this->param_p.mask(this->RATIO);
+  const Bool mPangle = this->param_p.mask(this->PANGLE);
+  for (size_t i=0; i<n; ++i) {
+    T x2mean = x[2*i]   - xcen;
+    T y2mean = x[2*i+1] - ycen;
+    T xnorm = x2mean*cpa + y2mean*spa;
+    T ynorm = -x2mean*spa + y2mean*cpa;
+    T x2w = T(2.0)*xnorm/xwidth2;
+    T y2w = T(2.0)*ynorm/ywidth2;
+    T exponential = exp(-(xnorm*xnorm/xwidth2 + ynorm*ynorm/ywidth2));
+    result[i] = tmp;
+    result[i].value() = height*exponential;
+    if (nder > 0) {
+      T dev = exponential;
+      if (mHeight) result[i].deriv(this->HEIGHT) = dev;
+      dev *= height;
+      if (mXcen) result[i].deriv(this->XCENTER) = dev*(x2w*cpa - y2w*spa);
+      if (mYcen) result[i].deriv(this->YCENTER) = dev*(spa*x2w + cpa*y2w);
+      if (mYwidth) result[i].deriv(this->YWIDTH) = dev*
+		     ((x2w*xnorm + y2w*ynorm)/ywidth);
+      if (mRatio) result[i].deriv(this->RATIO) = dev*
+		    x2w*xnorm*ywidth/xwidth;
+      if (mPangle) result[i].deriv(this->PANGLE) = -dev*
+		     (x2w*(-x2mean*spa + y2mean*cpa) +
+		      y2w*(-x2mean*cpa - y2mean*spa));
+    }
+  }
+}
+
 //# Member functions
 
 } //# NAMESPACE CASACORE - END
@@ -109,7 +109,11 @@ public:
   
   //# Operators    
   // Evaluate the polynomial at <src>x</src>.
+  // <group>
   virtual T eval(typename Function1D<T>::FunctionArg x) const;
+  virtual void evalMany(typename Function1D<T>::FunctionArg x, T *result,
+			size_t n) const;
+  // </group>
   
   //# Member functions
   // Return the polynomial which is the derivative of this one. <em>e.g.,</em>
@@ -178,6 +182,8 @@ public:
   // to the coefficients.
   // <group>
   virtual AutoDiff<T> eval(typename Function<AutoDiff<T> >::FunctionArg x) const;
+  virtual void evalMany(typename Function<AutoDiff<T> >::FunctionArg x,
+			AutoDiff<T> *result, size_t n) const;
   // </group>
 
   //# Member functions
@@ -45,6 +45,20 @@ T Polynomial<T>::eval(typename Function1D<T>::FunctionArg x) const {
   return accum;
 }
 
+template<class T>
+void Polynomial<T>::evalMany(typename Function1D<T>::FunctionArg x,
+			     T *result, size_t n) const {
+  // Apply Horner's rule to all points at once, so the inner loop can be
+  // vectorized.
+  Int j = nparameters();
+  const T last = param_p[--j];
+  for (size_t i=0; i<n; ++i) result[i] = last;
+  while (--j >= 0) {
+    const T coeff = param_p[j];
+    for (size_t i=0; i<n; ++i) result[i] = result[i]*x[i] + coeff;
+  }
+}
+
 template<class T>
 Polynomial<T> Polynomial<T>::derivative() const {
   Int ord = order() - 1;
@@ -28,6 +28,7 @@
 
 //# Includes
 #include <casacore/scimath/Functionals/Polynomial.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -63,6 +64,45 @@ eval(typename Function<AutoDiff<T> >::FunctionArg x) const {
   return tmp;
 }
 
+template<class T>
+void Polynomial<AutoDiff<T> >::
+evalMany(typename Function<AutoDiff<T> >::FunctionArg x,
+	 AutoDiff<T> *result, size_t n) const {
+  AutoDiff<T> tmp;
+  const uInt npar = this->nparameters();
+  for (uInt i=0; i<npar; ++i) {
+    if (this->param_p[i].nDerivatives() > 0) {
+      tmp = this->param_p[i];
+      break;
+    }
+  }
+  const uInt nder = tmp.nDerivatives();
+  for (uInt j=0; j<nder; j++) tmp.deriv(j) = 0.0;
+  std::vector<T> coeff(npar);
+  std::vector<Bool> masks(npar);
+  for (uInt i=0; i<npar; ++i) {
+    coeff[i] = this->param_p[i].value();
+    masks[i] = this->param_p.mask(i);
+  }
+  for (size_t k=0; k<n; ++k) {
+    result[k] = tmp;
+    Int j = npar;
+    T value = coeff[--j];
+    while (--j >= 0) {
+      value *= x[k];
+      value += coeff[j];
+    }
+    result[k].value() = value;
+    if (nder > 0) {
+      T dev(1);
+      for (uInt i=0; i<npar; ++i) {
+	if (masks[i]) result[k].deriv(i) = dev;
+	dev *= x[k];
+      }
+    }
+  }
+}
+
 //# Member functions
 
 } //# NAMESPACE CASACORE - END
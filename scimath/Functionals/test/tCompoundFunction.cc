@@ -28,6 +28,8 @@
 
 #include <casacore/scimath/Functionals/Polynomial.h>
 #include <casacore/scimath/Functionals/Gaussian1D.h>
+#include <casacore/scimath/Mathematics/AutoDiff.h>
+#include <casacore/scimath/Mathematics/AutoDiffMath.h>
 
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/BasicSL/Constants.h>
@@ -98,6 +100,22 @@ int main() {
   AlwaysAssertExit(allEQ(sumfunc.parameters().getParameters(), 
 			  fptr->parameters().getParameters()));
   delete fptr;
+
+  // Batched evaluation, also with derivatives.
+  {
+    Double args[4] = {-1.0, 0.0, 2.5, 3.0};
+    Double res[4];
+    sumfunc.evalMany(args, res, 4);
+    CompoundFunction<AutoDiff<Double> > adfunc(sumfunc);
+    AutoDiff<Double> adres[4];
+    adfunc.evalMany(args, adres, 4);
+    for (uInt i=0; i<4; ++i) {
+      AlwaysAssertExit(near(res[i], sumfunc(args[i])));
+      AlwaysAssertExit(near(adres[i].value(), adfunc(args[i]).value()) &&
+		       allNear(adres[i].derivatives(),
+			       adfunc(args[i]).derivatives(), 1e-13));
+    }
+  }
   
   cout << "OK" << endl;
   return 0;
@@ -32,10 +32,20 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/scimath/Mathematics/AutoDiffIO.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <vector>
 
 #include <casacore/casa/iostream.h>
 
 #include <casacore/casa/namespace.h>
+
+// Compare values which can be infinite or NaN.
+Bool sameValue(Double v1, Double v2) {
+  if (isNaN(v1) || isNaN(v2)) return isNaN(v1) && isNaN(v2);
+  return v1 == v2 || nearAbs(v1, v2, 1e-13);
+}
+
 int main() {
 
   try {
@@ -122,6 +132,37 @@ int main() {
       cout << expr(3.5) << ", " << expr(0.0) << endl;
       cout << "----------------------------------------------------" << endl;
     }
+    // The block-wise evalMany must give the same values and derivatives
+    // as the point by point evaluation.
+    for (uInt i=0; i<n; ++i) {
+      CompiledFunction<Double> expr;
+      CompiledFunction<AutoDiff<Double> > exprd;
+      if (!expr.setFunction(exprlist[i]) ||
+	  !exprd.setFunction(exprlist[i])) continue;
+      for (uInt j=0; j<expr.nparameters(); ++j) {
+	expr[j] = 1.5 + j;
+	exprd[j] = AutoDiff<Double>(1.5 + j, expr.nparameters(), j);
+      }
+      const uInt nd = std::max(expr.ndim(), 1u);
+      const size_t np = 150;
+      std::vector<Double> x(np*nd);
+      for (size_t k=0; k<x.size(); ++k) {
+	x[k] = (k%7 == 0 ? 0.0 : 0.1*k - 3.0);
+      }
+      std::vector<Double> res(np);
+      std::vector<AutoDiff<Double> > resd(np);
+      expr.evalMany(&x[0], &res[0], np);
+      exprd.evalMany(&x[0], &resd[0], np);
+      for (size_t k=0; k<np; ++k) {
+	const Double v = expr.eval(&x[nd*k]);
+	AlwaysAssertExit(sameValue(v, res[k]));
+	const AutoDiff<Double> vd = exprd.eval(&x[nd*k]);
+	AlwaysAssertExit(sameValue(vd.value(), resd[k].value()));
+	for (uInt j=0; j<vd.nDerivatives(); ++j) {
+	  AlwaysAssertExit(sameValue(vd.deriv(j), resd[k].deriv(j)));
+	}
+      }
+    }
   }  catch (std::exception& x) {
     cerr << x.what() << endl;
     cout << "FAIL" << endl;
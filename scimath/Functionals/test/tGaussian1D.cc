@@ -207,6 +207,25 @@ int main() {
   delete gauss4da;
   delete gauss4d;
 
+  // Batched evaluation
+  {
+    Double args[5] = {-3.0, 1.0, 6.0, 6.5, 20.0};
+    Double res[5];
+    gauss1.evalMany(args, res, 5);
+    Gaussian1D<AutoDiff<Double> > adgauss(AutoDiff<Double>(gauss1[0], 3, 0),
+                                          AutoDiff<Double>(gauss1[1], 3, 1),
+                                          AutoDiff<Double>(gauss1[2], 3, 2));
+    adgauss.mask(1) = False;
+    AutoDiff<Double> adres[5];
+    adgauss.evalMany(args, adres, 5);
+    for (uInt i=0; i<5; ++i) {
+      AlwaysAssertExit(near(res[i], gauss1(args[i])));
+      AlwaysAssertExit(near(adres[i].value(), adgauss(args[i]).value()) &&
+                       allNear(adres[i].derivatives(),
+                               adgauss(args[i]).derivatives(), 1e-13));
+    }
+  }
+
   cout << "OK" << endl;
   return 0;
 }
@@ -279,6 +279,21 @@ int main() {
       AlwaysAssertExit(near(g4(adx, ady).value(), g5(adax, aday).value()) &&
 		       allNearAbs(g4(adx, ady).derivatives(),
 				  g5(adax, aday).derivatives(), 1e-13));
+      // Batched evaluation
+      {
+        Double args[8] = {x, y, x+0.5, y-1.5, mean[0], mean[1], -3.0, 7.25};
+        Double res[4];
+        AutoDiff<Double> adres[4];
+        g2.evalMany(args, res, 4);
+        g4.evalMany(args, adres, 4);
+        for (uInt i=0; i<4; ++i) {
+          AlwaysAssertExit(near(res[i], g2(args[2*i], args[2*i+1])));
+          AutoDiff<Double> exp = g4(args[2*i], args[2*i+1]);
+          AlwaysAssertExit(near(adres[i].value(), exp.value()) &&
+                           allNearAbs(adres[i].derivatives(),
+                                      exp.derivatives(), 1e-13));
+        }
+      }
    }
     if (anyFailures) {
       cout << "FAIL" << endl;
@@ -135,6 +135,23 @@ int main() {
 		     allNear(sq2(AutoDiffA<Double>(3.0)).derivatives(),
 			     sq3(3.0).derivatives(),
 			     1e-13));
+
+  // Batched evaluation
+    {
+      Double args[4] = {-2.0, 0.0, 0.5, 3.0};
+      Double res[4];
+      AutoDiff<Double> adres[4];
+      Polynomial<Double> sq4(3);
+      sq4[0] = 1.0; sq4[1] = -2.0; sq4[2] = 0.25; sq4[3] = 3.0;
+      sq4.evalMany(args, res, 4);
+      sq3.evalMany(args, adres, 4);
+      for (uInt i=0; i<4; ++i) {
+	AlwaysAssertExit(near(res[i], sq4(args[i])));
+	AlwaysAssertExit(near(adres[i].value(), sq3(args[i]).value()) &&
+			 allNear(adres[i].derivatives(),
+				 sq3(args[i]).derivatives(), 1e-13));
+      }
+    }
     cout << "OK" << endl;
     return 0;
 }
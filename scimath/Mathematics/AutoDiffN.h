@@ -0,0 +1,226 @@
+//# AutoDiffN.h: Automatic differentiation with a fixed number of derivatives
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef SCIMATH_AUTODIFFN_H
+#define SCIMATH_AUTODIFFN_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/scimath/Mathematics/AutoDiff.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Automatic differentiation with a fixed number of derivatives.
+// </summary>
+//
+// <use visibility=export>
+//
+// <reviewed reviewer="" date="" tests="tAutoDiffN.cc">
+// </reviewed>
+//
+// <prerequisite>
+// <li> <linkto class=AutoDiff>AutoDiff</linkto>
+// </prerequisite>
+//
+// <synopsis>
+// AutoDiffN does the same as <linkto class=AutoDiff>AutoDiff</linkto>,
+// but the number of derivatives is a template parameter. The derivatives
+// are kept in the object itself, so creating, copying and combining
+// AutoDiffN objects does not allocate memory. Because the loops over the
+// derivatives have a fixed length, the compiler can unroll them and
+// keep the (typically few) derivatives in registers.
+// It makes AutoDiffN a lot faster than AutoDiff in inner loops such as
+// the calculation of a function and its derivatives for every data point
+// of a fit.
+//
+// AutoDiffN can be used as the template type of a
+// <linkto class=Function>Function</linkto> if the number of parameters of
+// the function equals <src>N</src> (e.g. 3 for a
+// <src>Gaussian1D<AutoDiffN<Double,3> ></src>). Hence the
+// <linkto class=FunctionTraits>FunctionTraits</linkto> are defined for it.
+// Conversion from and to an AutoDiff is possible to interface with code
+// using AutoDiff.
+//
+// All operators and functions are declared in
+// <linkto file=AutoDiffNMath.h>AutoDiffNMath</linkto>.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   AutoDiffN<Double,3> x(10.0, 3, 0);
+//   AutoDiffN<Double,3> y(20.0, 3, 1);
+//   AutoDiffN<Double,3> z(30.0, 3, 2);
+//   AutoDiffN<Double,3> result = x*y + sin(z);
+//   cout << result.value() << endl;         // 199.012
+//   cout << result.derivatives() << endl;   // [20, 10, 0.154251]
+// </srcblock>
+// </example>
+//
+// <templating arg=T>
+//  <li> any class that has the standard mathematical and comparisons
+//	defined
+// </templating>
+
+template <class T, uInt N> class AutoDiffN {
+ public:
+  //# Typedefs
+  typedef T 			value_type;
+  typedef value_type&		reference;
+  typedef const value_type&	const_reference;
+  typedef value_type*		iterator;
+  typedef const value_type*	const_iterator;
+
+  // Construct a constant with a value of zero.  Zero derivatives.
+  AutoDiffN()
+    : val_p(T(0)) { setDerivatives (T(0)); }
+
+  // Construct a constant with a value of v.  Zero derivatives.
+  AutoDiffN(const T &v)
+    : val_p(v) { setDerivatives (T(0)); }
+
+  // A function f(x0,x1,...,xn,...) with a value of v.  The
+  // nth derivative is one, and all others are zero. An exception is
+  // thrown if ndiffs differs from N.
+  AutoDiffN(const T &v, const uInt ndiffs, const uInt n)
+    : val_p(v)
+    { checkSize (ndiffs); setDerivatives (T(0)); grad_p[n] = T(1); }
+
+  // A function f(x0,x1,...,xn,...) with a value of v.  All derivatives
+  // are zero. An exception is thrown if ndiffs differs from N.
+  AutoDiffN(const T &v, const uInt ndiffs)
+    : val_p(v) { checkSize (ndiffs); setDerivatives (T(0)); }
+
+  // Construct from a value and a vector of N derivatives.
+  AutoDiffN(const T &v, const Vector<T> &derivs)
+    : val_p(v)
+    { checkSize (derivs.nelements());
+      for (uInt i=0; i<N; ++i) grad_p[i] = derivs[i]; }
+
+  // Construct from an AutoDiff with N (or no) derivatives.
+  explicit AutoDiffN(const AutoDiff<T> &other)
+    : val_p(other.value())
+    { if (other.nDerivatives() == 0) {
+        setDerivatives (T(0));
+      } else {
+        checkSize (other.nDerivatives());
+        for (uInt i=0; i<N; ++i) grad_p[i] = other.deriv(i);
+      }
+    }
+
+  // Assign a constant. All derivatives are zero.
+  AutoDiffN<T,N> &operator=(const T &v)
+    { val_p = v; setDerivatives (T(0)); return *this; }
+
+  // In-place mathematical operators
+  // <group>
+  void operator*=(const AutoDiffN<T,N> &other) {
+    for (uInt i=0; i<N; ++i) {
+      grad_p[i] = val_p*other.grad_p[i] + other.val_p*grad_p[i];
+    }
+    val_p *= other.val_p;
+  }
+  void operator/=(const AutoDiffN<T,N> &other) {
+    T temp = other.val_p * other.val_p;
+    for (uInt i=0; i<N; ++i) {
+      grad_p[i] = grad_p[i]/other.val_p - val_p*other.grad_p[i]/temp;
+    }
+    val_p /= other.val_p;
+  }
+  void operator+=(const AutoDiffN<T,N> &other) {
+    for (uInt i=0; i<N; ++i) grad_p[i] += other.grad_p[i];
+    val_p += other.val_p;
+  }
+  void operator-=(const AutoDiffN<T,N> &other) {
+    for (uInt i=0; i<N; ++i) grad_p[i] -= other.grad_p[i];
+    val_p -= other.val_p;
+  }
+  void operator*=(const T other)
+    { val_p *= other; scaleDerivatives (other); }
+  void operator/=(const T other)
+    { val_p /= other; for (uInt i=0; i<N; ++i) grad_p[i] /= other; }
+  void operator+=(const T other)
+    { val_p += other; }
+  void operator-=(const T other)
+    { val_p -= other; }
+  // </group>
+
+  // Returns the value of the function
+  // <group>
+  T &value() { return val_p; }
+  const T &value() const { return val_p; }
+  // </group>
+
+  // Returns a copy of the derivatives.
+  Vector<T> derivatives() const
+    { Vector<T> res(N); derivatives (res); return res; }
+
+  // Copy the derivatives into res, which is resized if needed.
+  void derivatives(Vector<T> &res) const
+    { res.resize (N); for (uInt i=0; i<N; ++i) res[i] = grad_p[i]; }
+
+  // Returns a specific derivative. No check on a valid which is done.
+  // <group>
+  T &derivative(uInt which) { return grad_p[which]; }
+  const T &derivative(uInt which) const { return grad_p[which]; }
+  T &deriv(uInt which) { return grad_p[which]; }
+  const T &deriv(uInt which) const { return grad_p[which]; }
+  // </group>
+
+  // Set all derivatives to the given value.
+  void setDerivatives(const T &v)
+    { for (uInt i=0; i<N; ++i) grad_p[i] = v; }
+
+  // Multiply all derivatives by the given factor.
+  void scaleDerivatives(const T &factor)
+    { for (uInt i=0; i<N; ++i) grad_p[i] *= factor; }
+
+  // Convert to an AutoDiff.
+  AutoDiff<T> autoDiff() const
+    { return AutoDiff<T>(val_p, derivatives()); }
+
+  // Return total number of derivatives
+  uInt nDerivatives() const { return N; }
+
+ private:
+  // Check if the number of derivatives matches N.
+  static void checkSize(uInt ndiffs)
+    { ThrowIf (ndiffs != N, "AutoDiffN: number of derivatives " +
+               String::toString(ndiffs) + " mismatches template size " +
+               String::toString(N)); }
+
+  //# Data
+  // The function value
+  T val_p;
+  // The derivatives
+  T grad_p[N];
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,219 @@
+//# AutoDiffNMath.h: Implements all mathematical functions for AutoDiffN
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef SCIMATH_AUTODIFFNMATH_H
+#define SCIMATH_AUTODIFFNMATH_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/iosfwd.h>
+#include <casacore/scimath/Mathematics/AutoDiffN.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Implements all mathematical operators and functions for AutoDiffN.
+// </summary>
+//
+// <reviewed reviewer="" date="" tests="tAutoDiffN" demos="">
+// </reviewed>
+//
+// <prerequisite>
+// <li> <linkto class=AutoDiffN>AutoDiffN</linkto> class
+// </prerequisite>
+//
+// <synopsis>
+// The functions are the same as the ones in
+// <linkto file=AutoDiffMath.h>AutoDiffMath</linkto> for AutoDiff.
+// Comparisons only use the values.
+// </synopsis>
+
+// <group name="AutoDiffN mathematical operations">
+
+// Unary arithmetic operators.
+// <group>
+template<class T, uInt N>
+AutoDiffN<T,N> operator+(const AutoDiffN<T,N> &other);
+template<class T, uInt N>
+AutoDiffN<T,N> operator-(const AutoDiffN<T,N> &other);
+// </group>
+
+// Arithmetic on two AutoDiffN objects, returning an AutoDiffN object
+// <group>
+template<class T, uInt N>
+AutoDiffN<T,N> operator+(const AutoDiffN<T,N> &left,
+                         const AutoDiffN<T,N> &right);
+template<class T, uInt N>
+AutoDiffN<T,N> operator-(const AutoDiffN<T,N> &left,
+                         const AutoDiffN<T,N> &right);
+template<class T, uInt N>
+AutoDiffN<T,N> operator*(const AutoDiffN<T,N> &left,
+                         const AutoDiffN<T,N> &right);
+template<class T, uInt N>
+AutoDiffN<T,N> operator/(const AutoDiffN<T,N> &left,
+                         const AutoDiffN<T,N> &right);
+// </group>
+
+// Arithmetic on an AutoDiffN and a scalar, returning an AutoDiffN
+// <group>
+template<class T, uInt N>
+AutoDiffN<T,N> operator+(const AutoDiffN<T,N> &left, const T &right);
+template<class T, uInt N>
+AutoDiffN<T,N> operator-(const AutoDiffN<T,N> &left, const T &right);
+template<class T, uInt N>
+AutoDiffN<T,N> operator*(const AutoDiffN<T,N> &left, const T &right);
+template<class T, uInt N>
+AutoDiffN<T,N> operator/(const AutoDiffN<T,N> &left, const T &right);
+// </group>
+
+// Arithmetic between a scalar and an AutoDiffN returning an AutoDiffN
+// <group>
+template<class T, uInt N>
+AutoDiffN<T,N> operator+(const T &left, const AutoDiffN<T,N> &right);
+template<class T, uInt N>
+AutoDiffN<T,N> operator-(const T &left, const AutoDiffN<T,N> &right);
+template<class T, uInt N>
+AutoDiffN<T,N> operator*(const T &left, const AutoDiffN<T,N> &right);
+template<class T, uInt N>
+AutoDiffN<T,N> operator/(const T &left, const AutoDiffN<T,N> &right);
+// </group>
+
+// Transcendental functions
+// <group>
+template<class T, uInt N> AutoDiffN<T,N> acos(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> asin(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> atan(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> atan2(const AutoDiffN<T,N> &y,
+                                               const AutoDiffN<T,N> &x);
+template<class T, uInt N> AutoDiffN<T,N> cos(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> cosh(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> exp(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> log(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> log10(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> erf(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> erfc(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> pow(const AutoDiffN<T,N> &a,
+                                             const AutoDiffN<T,N> &b);
+template<class T, uInt N> AutoDiffN<T,N> pow(const AutoDiffN<T,N> &a,
+                                             const T &b);
+template<class T, uInt N> AutoDiffN<T,N> square(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> cube(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> sin(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> sinh(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> sqrt(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> tan(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> tanh(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> abs(const AutoDiffN<T,N> &ad);
+// </group>
+// Floating-point remainder of x/c, with the same sign as x, where c is
+// a constant.
+// <group>
+template<class T, uInt N> AutoDiffN<T,N> fmod(const AutoDiffN<T,N> &x,
+                                              const T &c);
+template<class T, uInt N> AutoDiffN<T,N> fmod(const AutoDiffN<T,N> &x,
+                                              const AutoDiffN<T,N> &c);
+// </group>
+// Floor and ceil of values
+// <group>
+template<class T, uInt N> AutoDiffN<T,N> floor(const AutoDiffN<T,N> &ad);
+template<class T, uInt N> AutoDiffN<T,N> ceil(const AutoDiffN<T,N> &ad);
+// </group>
+
+// Comparison operators.  Only the values are compared.
+// <group>
+template<class T, uInt N> Bool operator>(const AutoDiffN<T,N> &left,
+                                         const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator<(const AutoDiffN<T,N> &left,
+                                         const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator>=(const AutoDiffN<T,N> &left,
+                                          const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator<=(const AutoDiffN<T,N> &left,
+                                          const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator==(const AutoDiffN<T,N> &left,
+                                          const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator!=(const AutoDiffN<T,N> &left,
+                                          const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator>(const AutoDiffN<T,N> &left,
+                                         const T &right);
+template<class T, uInt N> Bool operator<(const AutoDiffN<T,N> &left,
+                                         const T &right);
+template<class T, uInt N> Bool operator>=(const AutoDiffN<T,N> &left,
+                                          const T &right);
+template<class T, uInt N> Bool operator<=(const AutoDiffN<T,N> &left,
+                                          const T &right);
+template<class T, uInt N> Bool operator==(const AutoDiffN<T,N> &left,
+                                          const T &right);
+template<class T, uInt N> Bool operator!=(const AutoDiffN<T,N> &left,
+                                          const T &right);
+template<class T, uInt N> Bool operator>(const T &left,
+                                         const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator<(const T &left,
+                                         const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator>=(const T &left,
+                                          const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator<=(const T &left,
+                                          const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator==(const T &left,
+                                          const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool operator!=(const T &left,
+                                          const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool near(const AutoDiffN<T,N> &left,
+                                    const AutoDiffN<T,N> &right);
+template<class T, uInt N> Bool near(const AutoDiffN<T,N> &left,
+                                    const AutoDiffN<T,N> &right,
+                                    const Double tol);
+template<class T, uInt N> Bool nearAbs(const AutoDiffN<T,N> &left,
+                                       const AutoDiffN<T,N> &right,
+                                       const Double tol);
+// </group>
+
+// Test special values
+// <group>
+template<class T, uInt N> Bool isNaN(const AutoDiffN<T,N> &val);
+template<class T, uInt N> Bool isInf(const AutoDiffN<T,N> &val);
+// </group>
+
+// Minimum/maximum
+// <group>
+template<class T, uInt N> AutoDiffN<T,N> min(const AutoDiffN<T,N> &left,
+                                             const AutoDiffN<T,N> &right);
+template<class T, uInt N> AutoDiffN<T,N> max(const AutoDiffN<T,N> &left,
+                                             const AutoDiffN<T,N> &right);
+// </group>
+
+// Write as (value, [derivatives]) like an AutoDiff.
+template<class T, uInt N>
+ostream &operator<<(ostream &os, const AutoDiffN<T,N> &ad);
+
+// </group>
+
+
+} //# NAMESPACE CASACORE - END
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/scimath/Mathematics/AutoDiffNMath.tcc>
+#endif //# CASACORE_NO_AUTO_TEMPLATES
+#endif
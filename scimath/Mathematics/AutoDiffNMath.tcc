@@ -0,0 +1,446 @@
+//# AutoDiffNMath.tcc: Implements all mathematical functions for AutoDiffN
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef SCIMATH_AUTODIFFNMATH_TCC
+#define SCIMATH_AUTODIFFNMATH_TCC
+
+//# Includes
+#include <casacore/scimath/Mathematics/AutoDiffNMath.h>
+#include <casacore/casa/BasicSL/Constants.h>
+#include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/iostream.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// Unary arithmetic operators.
+template<class T, uInt N>
+AutoDiffN<T,N> operator+(const AutoDiffN<T,N> &other) {
+  return other;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator-(const AutoDiffN<T,N> &other) {
+  AutoDiffN<T,N> tmp(other);
+  tmp *= T(-1);
+  return tmp;
+}
+
+// Binary arithmetic operators
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator+(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  AutoDiffN<T,N> tmp(left);
+  tmp += right;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator-(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  AutoDiffN<T,N> tmp(left);
+  tmp -= right;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator*(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  AutoDiffN<T,N> tmp(left);
+  tmp *= right;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator/(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  AutoDiffN<T,N> tmp(left);
+  tmp /= right;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator+(const AutoDiffN<T,N> &left, const T &right) {
+  AutoDiffN<T,N> tmp(left);
+  tmp += right;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator-(const AutoDiffN<T,N> &left, const T &right) {
+  AutoDiffN<T,N> tmp(left);
+  tmp -= right;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator*(const AutoDiffN<T,N> &left, const T &right) {
+  AutoDiffN<T,N> tmp(left);
+  tmp *= right;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator/(const AutoDiffN<T,N> &left, const T &right) {
+  AutoDiffN<T,N> tmp(left);
+  tmp /= right;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator+(const T &left, const AutoDiffN<T,N> &right) {
+  AutoDiffN<T,N> tmp(right);
+  tmp += left;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator*(const T &left, const AutoDiffN<T,N> &right) {
+  AutoDiffN<T,N> tmp(right);
+  tmp *= left;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator-(const T &left, const AutoDiffN<T,N> &right) {
+  AutoDiffN<T,N> tmp(right);
+  tmp *= T(-1);
+  tmp += left;
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> operator/(const T &left, const AutoDiffN<T,N> &right) {
+  AutoDiffN<T,N> tmp(right);
+  T tv = right.value();
+  tmp.value() = left/tv;
+  tmp.scaleDerivatives (-tmp.value()/tv);
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> acos(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = acos(tv);
+  tmp.scaleDerivatives (T(-1)/T(sqrt(T(1) - tv*tv)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> asin(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = asin(tv);
+  tmp.scaleDerivatives (T(1)/T(sqrt(T(1) - tv*tv)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> atan(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = atan(tv);
+  tmp.scaleDerivatives (T(1)/(T(1) + tv*tv));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> cos(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = cos(tv);
+  tmp.scaleDerivatives (T(-sin(tv)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> cosh(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = cosh(tv);
+  tmp.scaleDerivatives (T(sinh(tv)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> exp(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = exp(tv);
+  tmp.scaleDerivatives (tmp.value());
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> log(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = log(tv);
+  tmp.scaleDerivatives (T(1)/tv);
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> log10(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = log10(tv);
+  tmp.scaleDerivatives (T(1)/(tv*T(C::ln10)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> erf(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = erf(tv);
+  tmp.scaleDerivatives (T(T(C::_2_sqrtpi)*exp(-tv*tv)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> erfc(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = erfc(tv);
+  tmp.scaleDerivatives (T(T(-C::_2_sqrtpi)*exp(-tv*tv)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> square(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = tv*tv;
+  tmp.scaleDerivatives (T(2)*tv);
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> cube(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = tv*tv*tv;
+  tmp.scaleDerivatives (T(3)*tv*tv);
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> sin(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = sin(tv);
+  tmp.scaleDerivatives (T(cos(tv)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> sinh(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = sinh(tv);
+  tmp.scaleDerivatives (T(cosh(tv)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> sqrt(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = sqrt(tv);
+  tmp.scaleDerivatives (T(1)/(T(2)*tmp.value()));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> tan(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = tan(tv);
+  tmp.scaleDerivatives (T(1)/T(cos(tv)*cos(tv)));
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> tanh(const AutoDiffN<T,N> &ad) {
+  AutoDiffN<T,N> tmp(ad);
+  T tv = ad.value();
+  tmp.value() = tanh(tv);
+  tmp.scaleDerivatives (T(1)/T(cosh(tv)*cosh(tv)));
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> atan2(const AutoDiffN<T,N> &y, const AutoDiffN<T,N> &x) {
+  // Get the derivatives via atan, but the value from atan2 to get the
+  // right quadrant.
+  AutoDiffN<T,N> tmp = atan(y/x);
+  tmp.value() = atan2(y.value(), x.value());
+  return tmp;
+}
+
+template<class T, uInt N>
+AutoDiffN<T,N> pow(const AutoDiffN<T,N> &a, const AutoDiffN<T,N> &b) {
+  T ta = a.value();
+  T tb = b.value();
+  T value = pow(ta, tb);
+  T temp1 = value * T(log(ta));
+  T temp2 = tb * pow(ta, tb - T(1));
+  AutoDiffN<T,N> tmp(value);
+  for (uInt i=0; i<N; ++i) {
+    tmp.deriv(i) = b.deriv(i)*temp1 + a.deriv(i)*temp2;
+  }
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> pow(const AutoDiffN<T,N> &a, const T &b) {
+  AutoDiffN<T,N> tmp(a);
+  T ta = a.value();
+  tmp.scaleDerivatives (b*pow(ta, b-T(1)));
+  tmp.value() = pow(ta, b);
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> abs(const AutoDiffN<T,N> &ad) {
+  // As for AutoDiff the function is assumed to be differentiable
+  // in the neighbourhood of the value.
+  AutoDiffN<T,N> tmp(ad);
+  if (ad.value() < T(0)) tmp *= T(-1);
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> fmod(const AutoDiffN<T,N> &x, const T &c) {
+  // The derivative of fmod(x,c) wrt x is 1 (see AutoDiffMath).
+  AutoDiffN<T,N> tmp(x);
+  tmp.value() = fmod(x.value(), c);
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> fmod(const AutoDiffN<T,N> &x, const AutoDiffN<T,N> &c) {
+  AutoDiffN<T,N> tmp(x);
+  tmp.value() = fmod(x.value(), c.value());
+  return tmp;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> floor(const AutoDiffN<T,N> &ad) {
+  return AutoDiffN<T,N>(floor(ad.value()));
+}
+
+template<class T, uInt N> AutoDiffN<T,N> ceil(const AutoDiffN<T,N> &ad) {
+  return AutoDiffN<T,N>(ceil(ad.value()));
+}
+
+// Comparisons use the values only
+
+template<class T, uInt N> Bool operator>(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  return left.value() > right.value();
+}
+
+template<class T, uInt N> Bool operator<(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  return left.value() < right.value();
+}
+
+template<class T, uInt N> Bool operator>=(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  return left.value() >= right.value();
+}
+
+template<class T, uInt N> Bool operator<=(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  return left.value() <= right.value();
+}
+
+template<class T, uInt N> Bool operator==(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  return left.value() == right.value();
+}
+
+template<class T, uInt N> Bool operator!=(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  return left.value() != right.value();
+}
+
+template<class T, uInt N> Bool operator>(const AutoDiffN<T,N> &left, const T &right) {
+  return left.value() > right;
+}
+
+template<class T, uInt N> Bool operator<(const AutoDiffN<T,N> &left, const T &right) {
+  return left.value() < right;
+}
+
+template<class T, uInt N> Bool operator>=(const AutoDiffN<T,N> &left, const T &right) {
+  return left.value() >= right;
+}
+
+template<class T, uInt N> Bool operator<=(const AutoDiffN<T,N> &left, const T &right) {
+  return left.value() <= right;
+}
+
+template<class T, uInt N> Bool operator==(const AutoDiffN<T,N> &left, const T &right) {
+  return left.value() == right;
+}
+
+template<class T, uInt N> Bool operator!=(const AutoDiffN<T,N> &left, const T &right) {
+  return left.value() != right;
+}
+
+template<class T, uInt N> Bool operator>(const T &left, const AutoDiffN<T,N> &right) {
+  return left > right.value();
+}
+
+template<class T, uInt N> Bool operator<(const T &left, const AutoDiffN<T,N> &right) {
+  return left < right.value();
+}
+
+template<class T, uInt N> Bool operator>=(const T &left, const AutoDiffN<T,N> &right) {
+  return left >= right.value();
+}
+
+template<class T, uInt N> Bool operator<=(const T &left, const AutoDiffN<T,N> &right) {
+  return left <= right.value();
+}
+
+template<class T, uInt N> Bool operator==(const T &left, const AutoDiffN<T,N> &right) {
+  return left == right.value();
+}
+
+template<class T, uInt N> Bool operator!=(const T &left, const AutoDiffN<T,N> &right) {
+  return left != right.value();
+}
+
+template<class T, uInt N> Bool near(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  return near(left.value(), right.value());
+}
+
+template<class T, uInt N> Bool near(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right, const Double tol) {
+  return near(left.value(), right.value(), tol);
+}
+
+template<class T, uInt N> Bool nearAbs(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right, const Double tol) {
+  return nearAbs(left.value(), right.value(), tol);
+}
+
+template<class T, uInt N> Bool isNaN(const AutoDiffN<T,N> &val) {
+  return isNaN(val.value());
+}
+
+template<class T, uInt N> Bool isInf(const AutoDiffN<T,N> &val) {
+  return isInf(val.value());
+}
+
+template<class T, uInt N> AutoDiffN<T,N> min(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  return (left.value() <= right.value()) ? left : right;
+}
+
+template<class T, uInt N> AutoDiffN<T,N> max(const AutoDiffN<T,N> &left, const AutoDiffN<T,N> &right) {
+  return (left.value() <= right.value()) ? right : left;
+}
+
+template<class T, uInt N>
+ostream &operator<<(ostream &os, const AutoDiffN<T,N> &ad) {
+  os << "(" << ad.value() << ", " << ad.derivatives() << ")";
+  return os;
+}
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -28,6 +28,7 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/scimath/Mathematics/Gridder.h>
+#include <casacore/scimath/Mathematics/NumericTraits.h>
 #include <casacore/casa/BasicSL/String.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -56,6 +57,29 @@ public:
 		      const Vector<Domain>& position,
 		      Range& value);
 
+  // Grid or degrid many values at once, where column <src>i</src> of
+  // <src>positions</src> is the position of value <src>i</src>.
+  // Values whose convolution support is not on the grid are ignored
+  // (degridded values are then left unchanged).
+  // The number of values on the grid is returned.
+  // <br>For a 2-dim grid the values are sorted into tiles of the grid.
+  // The tiles are gridded in parallel in four passes, where a pass handles
+  // every other tile in both axes, so threads never write the same grid
+  // points. The convolution is applied per grid row in a loop that the
+  // compiler can vectorize. Degridding is done in parallel per value.
+  // The results are the same as those of calling grid or degrid per value,
+  // apart from rounding differences.
+  // <br>Other dimensionalities are handled by calling grid or degrid
+  // per value.
+  // <group>
+  uInt gridMany(Array<Range>& gridded,
+		const Matrix<Domain>& positions,
+		const Vector<Range>& values);
+  uInt degridMany(const Array<Range>& gridded,
+		  const Matrix<Domain>& positions,
+		  Vector<Range>& values);
+  // </group>
+
   Vector<Double>& cFunction();
 
   Vector<Int>& cSupport();
@@ -66,6 +90,17 @@ protected:
   virtual Range correctionFactor1D(Int loc, Int len);
 
 private:
+  typedef typename NumericTraits<Range>::BaseType BaseType;
+
+  // Get the grid location of a 2-dim position and the offsets in the
+  // convolution function. False is returned if not on the grid.
+  Bool locate2D(Int& li, Int& lj, Int& offi, Int& offj,
+		Domain posi, Domain posj, Bool useOffset) const;
+
+  // Fill the 1-dim convolution weights for the given offset.
+  // It returns their sum.
+  Double fillWeights(BaseType* weights, Int off) const;
+
   Vector<Double> convFunc;
   Vector<Int> supportVec;
   Vector<Int> loc;
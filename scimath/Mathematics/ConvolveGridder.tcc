@@ -30,7 +30,13 @@
 #include <casacore/casa/BasicSL/Constants.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -378,6 +384,210 @@ Bool ConvolveGridder<Domain, Range>::degrid(const Array<Range> &gridded,
   }
 }
 
+template <class Domain, class Range>
+Bool ConvolveGridder<Domain, Range>::locate2D(Int& li, Int& lj,
+					      Int& offi, Int& offj,
+					      Domain posi, Domain posj,
+					      Bool useOffset) const
+{
+  // Do the same as location() and the Fortran gridding routines.
+  Double gi = scale(0)*posi + offset(0);
+  Double gj = scale(1)*posj + offset(1);
+  li = Int(std::floor(gi+0.5));
+  lj = Int(std::floor(gj+0.5));
+  if (useOffset) {
+    li -= offsetVec(0);
+    lj -= offsetVec(1);
+  }
+  if (li-support < 0  ||  li+support >= shapeVec(0)  ||
+      lj-support < 0  ||  lj+support >= shapeVec(1)) {
+    return False;
+  }
+  offi = Int(std::lround((std::round(gi) - gi) * sampling));
+  offj = Int(std::lround((std::round(gj) - gj) * sampling));
+  return True;
+}
+
+template <class Domain, class Range>
+Double ConvolveGridder<Domain, Range>::fillWeights(BaseType* weights,
+						   Int off) const
+{
+  const Double* cf = convFunc.data();
+  Double sum = 0;
+  for (Int i=-support; i<=support; i++) {
+    Double w = cf[std::abs(sampling*i + off)];
+    weights[i+support] = w;
+    sum += w;
+  }
+  return sum;
+}
+
+template <class Domain, class Range>
+uInt ConvolveGridder<Domain, Range>::gridMany(Array<Range>& gridded,
+					      const Matrix<Domain>& positions,
+					      const Vector<Range>& values)
+{
+  AlwaysAssert (positions.nrow() == uInt(ndim)  &&
+		positions.ncolumn() == values.nelements(), AipsError);
+  const Int nval = values.nelements();
+  if (ndim != 2) {
+    uInt nr = 0;
+    Vector<Domain> pos(ndim);
+    for (Int i=0; i<nval; i++) {
+      pos = positions.column(i);
+      if (grid(gridded, pos, values(i))) {
+	nr++;
+      }
+    }
+    return nr;
+  }
+  const Int nx = gridded.shape()(0);
+  // Locate the values and sort them into tiles. A tile must not be
+  // smaller than the convolution support to make the passes independent.
+  const Int tileSize = std::max(64, 2*support+1);
+  const Int ntx = (shapeVec(0) + tileSize - 1) / tileSize;
+  const Int nty = (shapeVec(1) + tileSize - 1) / tileSize;
+  std::vector<Int> li(nval), lj(nval), offi(nval), offj(nval), tile(nval);
+  Bool deletePos;
+  const Domain* pos = positions.getStorage(deletePos);
+#ifdef _OPENMP
+#pragma omp parallel for if (nval > 1000)
+#endif
+  for (Int i=0; i<nval; i++) {
+    tile[i] = -1;
+    if (locate2D(li[i], lj[i], offi[i], offj[i], pos[2*i], pos[2*i+1],
+		 True)) {
+      tile[i] = li[i]/tileSize + ntx*(lj[i]/tileSize);
+    }
+  }
+  positions.freeStorage(pos, deletePos);
+  std::vector<Int> tileStart(ntx*nty + 1, 0);
+  uInt nrOnGrid = 0;
+  for (Int i=0; i<nval; i++) {
+    if (tile[i] >= 0) {
+      tileStart[tile[i]+1]++;
+      nrOnGrid++;
+    }
+  }
+  for (Int t=0; t<ntx*nty; t++) {
+    tileStart[t+1] += tileStart[t];
+  }
+  std::vector<Int> order(nrOnGrid);
+  {
+    std::vector<Int> next(tileStart.begin(), tileStart.end()-1);
+    for (Int i=0; i<nval; i++) {
+      if (tile[i] >= 0) {
+	order[next[tile[i]]++] = i;
+      }
+    }
+  }
+  Bool deleteGrid, deleteVal;
+  Range* gridPtr = gridded.getStorage(deleteGrid);
+  const Range* valPtr = values.getStorage(deleteVal);
+  const Int nsupp = 2*support + 1;
+  for (Int pass=0; pass<4; pass++) {
+    std::vector<Int> tiles;
+    for (Int ty=pass/2; ty<nty; ty+=2) {
+      for (Int tx=pass%2; tx<ntx; tx+=2) {
+	Int t = tx + ntx*ty;
+	if (tileStart[t+1] > tileStart[t]) {
+	  tiles.push_back(t);
+	}
+      }
+    }
+    const Int ntiles = tiles.size();
+#ifdef _OPENMP
+#pragma omp parallel if (ntiles > 1)
+#endif
+    {
+      std::vector<BaseType> wi(nsupp), wj(nsupp);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (Int it=0; it<ntiles; it++) {
+	Int t = tiles[it];
+	for (Int k=tileStart[t]; k<tileStart[t+1]; k++) {
+	  Int i = order[k];
+	  Double norm = fillWeights(wi.data(), offi[i]) *
+	                fillWeights(wj.data(), offj[i]);
+	  const BaseType* wip = wi.data();
+	  for (Int j=0; j<nsupp; j++) {
+	    Range nvalue = valPtr[i] * BaseType(wj[j]/norm);
+	    Range* row = gridPtr + (lj[i]+j-support)*nx + li[i] - support;
+	    for (Int m=0; m<nsupp; m++) {
+	      row[m] += nvalue * wip[m];
+	    }
+	  }
+	}
+      }
+    }
+  }
+  values.freeStorage(valPtr, deleteVal);
+  gridded.putStorage(gridPtr, deleteGrid);
+  return nrOnGrid;
+}
+
+template <class Domain, class Range>
+uInt ConvolveGridder<Domain, Range>::degridMany(const Array<Range>& gridded,
+						const Matrix<Domain>& positions,
+						Vector<Range>& values)
+{
+  AlwaysAssert (positions.nrow() == uInt(ndim)  &&
+		positions.ncolumn() == values.nelements(), AipsError);
+  const Int nval = values.nelements();
+  if (ndim != 2) {
+    uInt nr = 0;
+    Vector<Domain> pos(ndim);
+    for (Int i=0; i<nval; i++) {
+      pos = positions.column(i);
+      if (degrid(gridded, pos, values(i))) {
+	nr++;
+      }
+    }
+    return nr;
+  }
+  const Int nx = gridded.shape()(0);
+  const Int nsupp = 2*support + 1;
+  Bool deletePos, deleteGrid, deleteVal;
+  const Domain* pos = positions.getStorage(deletePos);
+  const Range* gridPtr = gridded.getStorage(deleteGrid);
+  Range* valPtr = values.getStorage(deleteVal);
+  uInt nrOnGrid = 0;
+#ifdef _OPENMP
+#pragma omp parallel if (nval > 1000) reduction(+:nrOnGrid)
+#endif
+  {
+    std::vector<BaseType> wi(nsupp), wj(nsupp);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+    for (Int i=0; i<nval; i++) {
+      // Note that degrid does not apply the offset.
+      Int li, lj, offi, offj;
+      if (locate2D(li, lj, offi, offj, pos[2*i], pos[2*i+1], False)) {
+	Double norm = fillWeights(wi.data(), offi) *
+	              fillWeights(wj.data(), offj);
+	const BaseType* wip = wi.data();
+	Range sum = 0;
+	for (Int j=0; j<nsupp; j++) {
+	  const Range* row = gridPtr + (lj+j-support)*nx + li - support;
+	  Range rowSum = 0;
+	  for (Int m=0; m<nsupp; m++) {
+	    rowSum += row[m] * wip[m];
+	  }
+	  sum += rowSum * wj[j];
+	}
+	valPtr[i] = sum * BaseType(1./norm);
+	nrOnGrid++;
+      }
+    }
+  }
+  positions.freeStorage(pos, deletePos);
+  gridded.freeStorage(gridPtr, deleteGrid);
+  values.putStorage(valPtr, deleteVal);
+  return nrOnGrid;
+}
+
 template <class Domain, class Range>
 Range ConvolveGridder<Domain, Range>::correctionFactor1D(Int loc, Int len)
 {
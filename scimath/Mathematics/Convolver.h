@@ -313,6 +313,18 @@ private:
   void doConvolution(Array<FType>& result, 
 		     const Array<FType>& model, 
 		     Bool fullSize);
+  // Do the convolution of a single plane using the given FFTServer
+  // objects, so multiple planes can be convolved in parallel.
+  void doConvolution(Array<FType>& result, 
+		     const Array<FType>& model, 
+		     Bool fullSize,
+		     FFTServer<FType, typename NumericTraits<FType>::ConjugateType>& fft,
+		     FFTServer<FType, typename NumericTraits<FType>::ConjugateType>& ifft) const;
+  // Convolve all planes (with the dimensionality of the psf) of the model.
+  // They are done in parallel if OpenMP is used.
+  void convolvePlanes(Array<FType>& result, 
+		      const Array<FType>& model, 
+		      Bool fullSize);
   void resizeXfr(const IPosition& imageShape, Bool linear, Bool fullSize);
 //#   void padArray(Array<FType>& paddedArr, const Array<FType>& origArr, 
 //# 		const IPosition & blc);
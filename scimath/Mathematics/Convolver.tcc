@@ -30,6 +30,10 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/ArrayIter.h>
+#include <casacore/casa/OS/OMP.h>
+#include <exception>
+#include <memory>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -214,13 +218,58 @@ linearConv(Array<FType>& result,
   // create space in the output array to hold the data
   result.resize(resultSize);
 
+  convolvePlanes(result, model, fullSize);
+}
+
+template<class FType> void Convolver<FType>::
+convolvePlanes(Array<FType>& result,
+	       const Array<FType>& model,
+	       Bool fullSize) {
+  // Collect the planes to convolve; they reference the arrays.
+  std::vector<Array<FType> > fromPlanes, toPlanes;
   ReadOnlyArrayIterator<FType> from(model, thePsfSize.nelements());
   ArrayIterator<FType> to(result, thePsfSize.nelements());
-
   for (from.origin(), to.origin();
        (from.pastEnd() || to.pastEnd()) == False;
        from.next(), to.next()) {
-    doConvolution(to.array(), from.array(), fullSize);
+    fromPlanes.push_back(from.array());
+    toPlanes.push_back(to.array());
+  }
+  // The planes are convolved in parallel using the same transfer function.
+  // Each thread needs its own FFTServer objects.
+  typedef FFTServer<FType, typename NumericTraits<FType>::ConjugateType> Server;
+  const Int nplanes = fromPlanes.size();
+  uInt nthreads = 1;
+#ifdef _OPENMP
+  nthreads = std::max(1, std::min(Int(OMP::nMaxThreads()), nplanes));
+#endif
+  std::vector<std::unique_ptr<Server> > servers;
+  for (uInt i = 2; i < 2*nthreads; i++) {
+    servers.push_back(std::unique_ptr<Server>(new Server()));
+  }
+  std::vector<std::exception_ptr> errors(nthreads);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+#endif
+  for (Int i = 0; i < nplanes; i++) {
+    uInt thr = 0;
+#ifdef _OPENMP
+    thr = omp_get_thread_num();
+#endif
+    if (!errors[thr]) {
+      try {
+	Server& fft = thr == 0 ? theFFT : *servers[2*thr-2];
+	Server& ifft = thr == 0 ? theIFFT : *servers[2*thr-1];
+	doConvolution(toPlanes[i], fromPlanes[i], fullSize, fft, ifft);
+      } catch (...) {
+	errors[thr] = std::current_exception();
+      }
+    }
+  }
+  for (const std::exception_ptr& err : errors) {
+    if (err) {
+      std::rethrow_exception(err);
+    }
   }
 }
 
@@ -229,6 +278,16 @@ doConvolution(Array<FType>& result,
 	      const Array<FType>& model,
 	      Bool fullSize) {
   validate();
+  doConvolution(result, model, fullSize, theFFT, theIFFT);
+}
+
+template<class FType> void Convolver<FType>::
+doConvolution(Array<FType>& result,
+	      const Array<FType>& model,
+	      Bool fullSize,
+	      FFTServer<FType, typename NumericTraits<FType>::ConjugateType>& fft,
+	      FFTServer<FType, typename NumericTraits<FType>::ConjugateType>& ifft)
+  const {
   IPosition modelSize = model.shape();
   Array<typename NumericTraits<FType>::ConjugateType> fftModel;
   if (theFFTSize != modelSize){
@@ -239,23 +298,23 @@ doConvolution(Array<FType>& result,
     paddedModel = 0.;
     paddedModel(blc, trc) = model;
     // And calculate its transform
-    //    theFFT.flip(paddedModel, True, False);
+    //    fft.flip(paddedModel, True, False);
     if(doFast_p){
-      theFFT.fft0(fftModel, paddedModel);
+      fft.fft0(fftModel, paddedModel);
     }
     else{
-      theFFT.fft(fftModel, paddedModel);
+      fft.fft(fftModel, paddedModel);
     }
   }
   else{
     Array<FType> paddedModel=model;
     if(doFast_p){
       Array<FType> paddedModel=model;
-      //    theFFT.flip(paddedModel, True, False);
-      theFFT.fft0(fftModel, paddedModel);
+      //    fft.flip(paddedModel, True, False);
+      fft.fft0(fftModel, paddedModel);
     }
     else{
-      theFFT.fft(fftModel, model);
+      fft.fft(fftModel, model);
     } 
   }
   // Multiply by the transfer function
@@ -264,11 +323,11 @@ doConvolution(Array<FType>& result,
   // Do the inverse transform
   Array<FType> convolvedData(theFFTSize);
   if(doFast_p){
-    theIFFT.fft0(convolvedData, fftModel);
-    theIFFT.flip(convolvedData, False, False);
+    ifft.fft0(convolvedData, fftModel);
+    ifft.flip(convolvedData, False, False);
   }
   else{
-    theIFFT.fft(convolvedData, fftModel);
+    ifft.fft(convolvedData, fftModel);
   }
   // Extract the required part of the convolved data
   IPosition trc, blc; 
@@ -325,14 +384,7 @@ circularConv(Array<FType>& result,
   // create space in the output array to hold the data
   result.resize(model.shape());
 
-  ReadOnlyArrayIterator<FType> from(model, thePsfSize.nelements());
-  ArrayIterator<FType> to(result, thePsfSize.nelements());
-
-  for (from.origin(), to.origin();
-       (from.pastEnd() || to.pastEnd()) == False;
-       from.next(), to.next()) {
-    doConvolution(to.array(), from.array(), False);
-  }
+  convolvePlanes(result, model, False);
 }
 
 template<class FType> const Array<FType> Convolver<FType>::
@@ -325,6 +325,21 @@ public:
   //# void fft0(Array<T> & rValues, const Bool toFrequency=True);
 
   // </group>
+
+  // Complex to complex in-place fft of all lines along the given axis.
+  // It is the same as doing a 1-dimensional <src>fft</src> (or
+  // <src>fft0</src>) on each vector along the axis, but all lines are
+  // transformed with a single (possibly multi-threaded) FFTW plan without
+  // copying them. The origin of the transform is the centre of each line
+  // for <src>fftAxis</src> and the first element for <src>fft0Axis</src>.
+  // Scaling is always done on the backward transform.
+  // <group>
+  void fftAxis(Array<S> & cValues, uInt whichAxis,
+               const Bool toFrequency=True);
+  void fft0Axis(Array<S> & cValues, uInt whichAxis,
+                const Bool toFrequency=True);
+  // </group>
+
   //# Flips the quadrants in a complex Array so that the point at
   //# cData.shape()/2 moves to the origin. This moves, for example, the point
   //# at [8,3] to the origin ([0,0]) in an array of shape [16,7]. Usually two
@@ -374,10 +389,15 @@ public:
 private:
   //# finds the shape of the output array when doing complex->real transforms
   IPosition determineShape(const IPosition & rShape, const Array<S> & cData);
+  //# flips the lines along the given axis in contiguous data
+  void flipAxis(S * data, const IPosition & shape, uInt axis,
+                const Bool toZero);
 
   //# Data members.
   // The size of the last FFT done by this object
   IPosition itsSize;
+  // The size in FFTW (i.e. C) order used to plan and execute the FFT.
+  IPosition itsFFTWSize;
   // Whether the last FFT was complex<->complex or not
   FFTEnums::TransformType itsTransformType;
   // buffer for copying non-contigious arrays to contigious ones. This is done
@@ -25,6 +25,8 @@
 
 #include <casacore/scimath/Mathematics/FFTW.h>
 #include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
 
 #ifdef HAVE_FFTW3
 # include <fftw3.h>
@@ -33,12 +35,18 @@
 # include <omp.h>
 #endif
 
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
 
 
 namespace casacore {
 
 bool FFTW::is_initialized_fftw = false;
+int FFTW::theirNThreads = 0;
 std::mutex FFTW::theirMutex;
 
 
@@ -76,28 +84,311 @@ std::mutex FFTW::theirMutex;
     fftwf_plan itsPlan;
   };
 
-    
+
+  // Key of a plan in the cache.
+  // A plan can only be executed on data with the same alignment as the
+  // data it was made for, so the alignment is part of the key.
+  struct FFTWPlanKey
+  {
+    enum Kind {R2C, C2R, C2CForward, C2CBackward,
+               C2CAxisForward, C2CAxisBackward};
+
+    FFTWPlanKey (Kind kind, const IPosition& size, int axis,
+                 int alignIn, int alignOut, int nthreads)
+      : kind(kind), axis(axis), alignIn(alignIn), alignOut(alignOut),
+        nthreads(nthreads), shape(size.asStdVector64())
+    {}
+
+    bool operator< (const FFTWPlanKey& that) const
+    {
+      return std::tie (kind, axis, alignIn, alignOut, nthreads, shape) <
+        std::tie (that.kind, that.axis, that.alignIn, that.alignOut,
+                  that.nthreads, that.shape);
+    }
+
+    int kind;
+    int axis;
+    int alignIn;
+    int alignOut;
+    int nthreads;
+    std::vector<long long> shape;
+  };
+
+
+  // The cache of plans of an FFTW object.
+  class FFTWPlanCache
+  {
+  public:
+    explicit FFTWPlanCache (unsigned flags)
+      : itsFlags (flags)
+    {}
+
+    // Get the plan for a transform, which is made if not in the cache yet.
+    // <group>
+    FFTWPlanf* r2c (const IPosition& size, float* in,
+                    std::complex<float>* out);
+    FFTWPlan*  r2c (const IPosition& size, double* in,
+                    std::complex<double>* out);
+    FFTWPlanf* c2r (const IPosition& size, std::complex<float>* in,
+                    float* out);
+    FFTWPlan*  c2r (const IPosition& size, std::complex<double>* in,
+                    double* out);
+    FFTWPlanf* c2c (const IPosition& size, std::complex<float>* in,
+                    bool forward);
+    FFTWPlan*  c2c (const IPosition& size, std::complex<double>* in,
+                    bool forward);
+    FFTWPlanf* c2cAxis (const IPosition& shape, uInt axis,
+                        std::complex<float>* data, bool forward);
+    FFTWPlan*  c2cAxis (const IPosition& shape, uInt axis,
+                        std::complex<double>* data, bool forward);
+    // </group>
+
+    uInt size() const
+      { return itsPlans.size() + itsPlansf.size(); }
+
+  private:
+    // Get the plan for the key from the cache. If not found, it is made
+    // by calling the make function while holding the planner mutex.
+    template<typename PlanType, typename MakeFunc>
+    PlanType* get (std::map<FFTWPlanKey, std::unique_ptr<PlanType>>& cache,
+                   const FFTWPlanKey& key, MakeFunc make);
+
+    // Set the number of threads to use by the FFTW planner.
+    // <group>
+    static void planWithNThreads (int nthreads, const FFTWPlan*);
+    static void planWithNThreads (int nthreads, const FFTWPlanf*);
+    // </group>
+
+    // Get the number of threads to use for a transform of nelem elements.
+    static int nthreadsFor (size_t nelem);
+
+    // Fill the guru dimensions for the lines along an axis.
+    static void axisDims (const IPosition& shape, uInt axis,
+                          fftw_iodim64& dim,
+                          std::vector<fftw_iodim64>& howmany);
+
+    unsigned itsFlags;
+    std::map<FFTWPlanKey, std::unique_ptr<FFTWPlan>>  itsPlans;
+    std::map<FFTWPlanKey, std::unique_ptr<FFTWPlanf>> itsPlansf;
+  };
+
+  // Clear the cache if it gets this large, to avoid unbounded growth
+  // when transforming many different shapes.
+  const size_t theMaxCachedPlans = 64;
+
+  // Transforms with fewer elements are always done in a single thread.
+  const size_t theMinElemPerThread = 32768;
+
+  template<typename PlanType, typename MakeFunc>
+  PlanType* FFTWPlanCache::get
+  (std::map<FFTWPlanKey, std::unique_ptr<PlanType>>& cache,
+   const FFTWPlanKey& key, MakeFunc make)
+  {
+    auto iter = cache.find (key);
+    if (iter != cache.end()) {
+      return iter->second.get();
+    }
+    if (cache.size() >= theMaxCachedPlans) {
+      cache.clear();
+    }
+    std::unique_ptr<PlanType> plan;
+    {
+      std::lock_guard<std::mutex> lock(FFTW::theirMutex);
+      planWithNThreads (key.nthreads, plan.get());
+      plan.reset (make());
+    }
+    if (! plan->getPlan()) {
+      throw std::runtime_error("FFTW could not make a plan");
+    }
+    PlanType* ptr = plan.get();
+    cache[key] = std::move(plan);
+    return ptr;
+  }
+
+  void FFTWPlanCache::planWithNThreads (int nthreads, const FFTWPlan*)
+  {
+#ifdef HAVE_FFTW3_THREADS
+    fftw_plan_with_nthreads(nthreads);
+#else
+    (void)nthreads;
+#endif
+  }
+
+  void FFTWPlanCache::planWithNThreads (int nthreads, const FFTWPlanf*)
+  {
+#ifdef HAVE_FFTW3_THREADS
+    fftwf_plan_with_nthreads(nthreads);
+#else
+    (void)nthreads;
+#endif
+  }
+
+  int FFTWPlanCache::nthreadsFor (size_t nelem)
+  {
+    size_t nthr = FFTW::getNThreads();
+    return std::max (size_t(1), std::min (nthr, nelem / theMinElemPerThread));
+  }
+
+  void FFTWPlanCache::axisDims (const IPosition& shape, uInt axis,
+                                fftw_iodim64& dim,
+                                std::vector<fftw_iodim64>& howmany)
+  {
+    AlwaysAssert (axis < shape.size(), AipsError);
+    ptrdiff_t stride = 1;
+    for (uInt i=0; i<axis; ++i) {
+      stride *= shape[i];
+    }
+    ptrdiff_t n = shape[axis];
+    ptrdiff_t nouter = shape.product() / (stride * n);
+    dim.n  = n;
+    dim.is = dim.os = stride;
+    howmany.clear();
+    if (stride > 1) {
+      fftw_iodim64 inner;
+      inner.n  = stride;
+      inner.is = inner.os = 1;
+      howmany.push_back (inner);
+    }
+    if (nouter > 1) {
+      fftw_iodim64 outer;
+      outer.n  = nouter;
+      outer.is = outer.os = stride * n;
+      howmany.push_back (outer);
+    }
+  }
+
+  FFTWPlanf* FFTWPlanCache::r2c (const IPosition& size, float* in,
+                                 std::complex<float>* out)
+  {
+    float* fout = reinterpret_cast<float*>(out);
+    FFTWPlanKey key(FFTWPlanKey::R2C, size, 0, fftwf_alignment_of(in),
+                    fftwf_alignment_of(fout), nthreadsFor(size.product()));
+    return get (itsPlansf, key, [&]() {
+        return new FFTWPlanf
+          (fftwf_plan_dft_r2c(size.nelements(), size.asStdVector().data(),
+                              in, reinterpret_cast<fftwf_complex*>(out),
+                              itsFlags)); });
+  }
+
+  FFTWPlan* FFTWPlanCache::r2c (const IPosition& size, double* in,
+                                std::complex<double>* out)
+  {
+    double* dout = reinterpret_cast<double*>(out);
+    FFTWPlanKey key(FFTWPlanKey::R2C, size, 0, fftw_alignment_of(in),
+                    fftw_alignment_of(dout), nthreadsFor(size.product()));
+    return get (itsPlans, key, [&]() {
+        return new FFTWPlan
+          (fftw_plan_dft_r2c(size.nelements(), size.asStdVector().data(),
+                             in, reinterpret_cast<fftw_complex*>(out),
+                             itsFlags)); });
+  }
+
+  FFTWPlanf* FFTWPlanCache::c2r (const IPosition& size,
+                                 std::complex<float>* in, float* out)
+  {
+    float* fin = reinterpret_cast<float*>(in);
+    FFTWPlanKey key(FFTWPlanKey::C2R, size, 0, fftwf_alignment_of(fin),
+                    fftwf_alignment_of(out), nthreadsFor(size.product()));
+    return get (itsPlansf, key, [&]() {
+        return new FFTWPlanf
+          (fftwf_plan_dft_c2r(size.nelements(), size.asStdVector().data(),
+                              reinterpret_cast<fftwf_complex*>(in), out,
+                              itsFlags)); });
+  }
+
+  FFTWPlan* FFTWPlanCache::c2r (const IPosition& size,
+                                std::complex<double>* in, double* out)
+  {
+    double* din = reinterpret_cast<double*>(in);
+    FFTWPlanKey key(FFTWPlanKey::C2R, size, 0, fftw_alignment_of(din),
+                    fftw_alignment_of(out), nthreadsFor(size.product()));
+    return get (itsPlans, key, [&]() {
+        return new FFTWPlan
+          (fftw_plan_dft_c2r(size.nelements(), size.asStdVector().data(),
+                             reinterpret_cast<fftw_complex*>(in), out,
+                             itsFlags)); });
+  }
+
+  FFTWPlanf* FFTWPlanCache::c2c (const IPosition& size,
+                                 std::complex<float>* in, bool forward)
+  {
+    fftwf_complex* cin = reinterpret_cast<fftwf_complex*>(in);
+    int align = fftwf_alignment_of(reinterpret_cast<float*>(in));
+    FFTWPlanKey key(forward ? FFTWPlanKey::C2CForward : FFTWPlanKey::C2CBackward,
+                    size, 0, align, align, nthreadsFor(size.product()));
+    return get (itsPlansf, key, [&]() {
+        return new FFTWPlanf
+          (fftwf_plan_dft(size.nelements(), size.asStdVector().data(),
+                          cin, cin, forward ? FFTW_FORWARD : FFTW_BACKWARD,
+                          itsFlags)); });
+  }
+
+  FFTWPlan* FFTWPlanCache::c2c (const IPosition& size,
+                                std::complex<double>* in, bool forward)
+  {
+    fftw_complex* cin = reinterpret_cast<fftw_complex*>(in);
+    int align = fftw_alignment_of(reinterpret_cast<double*>(in));
+    FFTWPlanKey key(forward ? FFTWPlanKey::C2CForward : FFTWPlanKey::C2CBackward,
+                    size, 0, align, align, nthreadsFor(size.product()));
+    return get (itsPlans, key, [&]() {
+        return new FFTWPlan
+          (fftw_plan_dft(size.nelements(), size.asStdVector().data(),
+                         cin, cin, forward ? FFTW_FORWARD : FFTW_BACKWARD,
+                         itsFlags)); });
+  }
+
+  FFTWPlanf* FFTWPlanCache::c2cAxis (const IPosition& shape, uInt axis,
+                                     std::complex<float>* data, bool forward)
+  {
+    fftwf_complex* cdata = reinterpret_cast<fftwf_complex*>(data);
+    int align = fftwf_alignment_of(reinterpret_cast<float*>(data));
+    FFTWPlanKey key(forward ? FFTWPlanKey::C2CAxisForward :
+                              FFTWPlanKey::C2CAxisBackward,
+                    shape, axis, align, align, nthreadsFor(shape.product()));
+    return get (itsPlansf, key, [&]() {
+        fftw_iodim64 dim;
+        std::vector<fftw_iodim64> howmany;
+        axisDims (shape, axis, dim, howmany);
+        return new FFTWPlanf
+          (fftwf_plan_guru64_dft(1, &dim, howmany.size(), howmany.data(),
+                                 cdata, cdata,
+                                 forward ? FFTW_FORWARD : FFTW_BACKWARD,
+                                 itsFlags)); });
+  }
+
+  FFTWPlan* FFTWPlanCache::c2cAxis (const IPosition& shape, uInt axis,
+                                    std::complex<double>* data, bool forward)
+  {
+    fftw_complex* cdata = reinterpret_cast<fftw_complex*>(data);
+    int align = fftw_alignment_of(reinterpret_cast<double*>(data));
+    FFTWPlanKey key(forward ? FFTWPlanKey::C2CAxisForward :
+                              FFTWPlanKey::C2CAxisBackward,
+                    shape, axis, align, align, nthreadsFor(shape.product()));
+    return get (itsPlans, key, [&]() {
+        fftw_iodim64 dim;
+        std::vector<fftw_iodim64> howmany;
+        axisDims (shape, axis, dim, howmany);
+        return new FFTWPlan
+          (fftw_plan_guru64_dft(1, &dim, howmany.size(), howmany.data(),
+                                cdata, cdata,
+                                forward ? FFTW_FORWARD : FFTW_BACKWARD,
+                                itsFlags)); });
+  }
+
 
   FFTW::FFTW() : flags(FFTW_ESTIMATE)
   { 
     initialize_fftw();
+    itsCache.reset (new FFTWPlanCache(flags));
   }
   
   void FFTW::initialize_fftw()
   {
     std::lock_guard<std::mutex> lock(theirMutex);
     if (!is_initialized_fftw) {
-      int numCPUs = HostInfo::numCPUs();
-      int nthreads = 1;
-      if (numCPUs > 1) {
-        nthreads = numCPUs;
-      }
-      
 #ifdef HAVE_FFTW3_THREADS
       fftwf_init_threads();
       fftw_init_threads();
-      fftwf_plan_with_nthreads(nthreads);
-      fftw_plan_with_nthreads(nthreads);
 #endif
       is_initialized_fftw = true;
     }
@@ -116,126 +407,101 @@ std::mutex FFTW::theirMutex;
 #endif
   }
   
+  uInt FFTW::nplans() const
+  {
+    return itsCache->size();
+  }
 
   void FFTW::plan_r2c(const IPosition &size, float *in, std::complex<float> *out) 
   {
-    itsPlanR2Cf.reset( new FFTWPlanf
-      (fftwf_plan_dft_r2c(size.nelements(),
-                          size.asStdVector().data(),
-                          in,
-                          reinterpret_cast<fftwf_complex *>(out), 
-                          flags)) );
+    itsCache->r2c (size, in, out);
   }
 
   void FFTW::plan_r2c(const IPosition &size, double *in, std::complex<double> *out) 
   {
-    itsPlanR2C.reset( new FFTWPlan
-      (fftw_plan_dft_r2c(size.nelements(),
-                         size.asStdVector().data(),
-                         in,
-                         reinterpret_cast<fftw_complex *>(out), 
-                         flags)) );
+    itsCache->r2c (size, in, out);
   }
 
   void FFTW::plan_c2r(const IPosition &size, std::complex<float> *in, float *out) {
-    itsPlanC2Rf.reset( new FFTWPlanf
-      (fftwf_plan_dft_c2r(size.nelements(),
-                          size.asStdVector().data(),
-                          reinterpret_cast<fftwf_complex *>(in),
-                          out, 
-                          flags)) );
-
+    itsCache->c2r (size, in, out);
   }
 
   void FFTW::plan_c2r(const IPosition &size, std::complex<double> *in, double *out) {
-    itsPlanC2R.reset( new FFTWPlan
-      (fftw_plan_dft_c2r(size.nelements(),
-                         size.asStdVector().data(),
-                         reinterpret_cast<fftw_complex *>(in), 
-                         out,
-                         flags)) );
+    itsCache->c2r (size, in, out);
   }
 
   void FFTW::plan_c2c_forward(const IPosition &size, std::complex<double> *in) {
-    itsPlanC2CF.reset( new FFTWPlan
-      (fftw_plan_dft(size.nelements(),
-                     size.asStdVector().data(),
-                     reinterpret_cast<fftw_complex *>(in), 
-                     reinterpret_cast<fftw_complex *>(in), 
-                     FFTW_FORWARD, flags)) );
-
+    itsCache->c2c (size, in, true);
   }
     
   void FFTW::plan_c2c_forward(const IPosition &size, std::complex<float> *in) {
-    itsPlanC2CFf.reset( new FFTWPlanf
-      (fftwf_plan_dft(size.nelements(),
-                      size.asStdVector().data(),
-                      reinterpret_cast<fftwf_complex *>(in), 
-                      reinterpret_cast<fftwf_complex *>(in), 
-                      FFTW_FORWARD, flags)) );
+    itsCache->c2c (size, in, true);
   }
 
   void FFTW::plan_c2c_backward(const IPosition &size, std::complex<double> *in) {
-    itsPlanC2CB.reset( new FFTWPlan
-      (fftw_plan_dft(size.nelements(),
-                     size.asStdVector().data(),
-                     reinterpret_cast<fftw_complex *>(in), 
-                     reinterpret_cast<fftw_complex *>(in), 
-                     FFTW_BACKWARD, flags)) );
-      
+    itsCache->c2c (size, in, false);
   }
     
   void FFTW::plan_c2c_backward(const IPosition &size, std::complex<float> *in) {
-    itsPlanC2CBf.reset( new FFTWPlanf
-      (fftwf_plan_dft(size.nelements(),
-                      size.asStdVector().data(),
-                      reinterpret_cast<fftwf_complex *>(in), 
-                      reinterpret_cast<fftwf_complex *>(in), 
-                      FFTW_BACKWARD, flags)) );
+    itsCache->c2c (size, in, false);
   }
 
-  // the parameters are used only in order to overload this function
-  void FFTW::r2c(const IPosition&, float*, std::complex<float>*) 
+  void FFTW::r2c(const IPosition &size, float *in, std::complex<float> *out) 
   {
-    fftwf_execute(itsPlanR2Cf->getPlan());
+    fftwf_execute_dft_r2c(itsCache->r2c(size, in, out)->getPlan(),
+                          in, reinterpret_cast<fftwf_complex*>(out));
   }
     
-  void FFTW::r2c(const IPosition&, double*, std::complex<double>*) 
+  void FFTW::r2c(const IPosition &size, double *in, std::complex<double> *out) 
   {
-    fftw_execute(itsPlanR2C->getPlan());
+    fftw_execute_dft_r2c(itsCache->r2c(size, in, out)->getPlan(),
+                         in, reinterpret_cast<fftw_complex*>(out));
   }
 
-  void FFTW::c2r(const IPosition&, std::complex<float>*, float*)
+  void FFTW::c2r(const IPosition &size, std::complex<float> *in, float *out)
   {
-    fftwf_execute(itsPlanC2Rf->getPlan());
+    fftwf_execute_dft_c2r(itsCache->c2r(size, in, out)->getPlan(),
+                          reinterpret_cast<fftwf_complex*>(in), out);
   }
     
-  void FFTW::c2r(const IPosition&, std::complex<double>*, double*)
+  void FFTW::c2r(const IPosition &size, std::complex<double> *in, double *out)
   {
-    fftw_execute(itsPlanC2R->getPlan());
+    fftw_execute_dft_c2r(itsCache->c2r(size, in, out)->getPlan(),
+                         reinterpret_cast<fftw_complex*>(in), out);
   }
     
-  void FFTW::c2c(const IPosition&, std::complex<float>*, bool forward)
+  void FFTW::c2c(const IPosition &size, std::complex<float> *in, bool forward)
   {
-    if (forward) {
-      fftwf_execute(itsPlanC2CFf->getPlan());
-    } else {
-      fftwf_execute(itsPlanC2CBf->getPlan());
-    }
+    fftwf_complex* cin = reinterpret_cast<fftwf_complex*>(in);
+    fftwf_execute_dft(itsCache->c2c(size, in, forward)->getPlan(), cin, cin);
   }
     
-  void FFTW::c2c(const IPosition&, std::complex<double>*, bool forward)
+  void FFTW::c2c(const IPosition &size, std::complex<double> *in, bool forward)
   {
-    if (forward) {
-      fftw_execute(itsPlanC2CF->getPlan());
-    } else {
-      fftw_execute(itsPlanC2CB->getPlan());
-    }
+    fftw_complex* cin = reinterpret_cast<fftw_complex*>(in);
+    fftw_execute_dft(itsCache->c2c(size, in, forward)->getPlan(), cin, cin);
+  }
+
+  void FFTW::c2c_axis(const IPosition &shape, uInt axis,
+                      std::complex<float> *data, bool forward)
+  {
+    fftwf_complex* cdata = reinterpret_cast<fftwf_complex*>(data);
+    fftwf_execute_dft(itsCache->c2cAxis(shape, axis, data, forward)->getPlan(),
+                      cdata, cdata);
+  }
+
+  void FFTW::c2c_axis(const IPosition &shape, uInt axis,
+                      std::complex<double> *data, bool forward)
+  {
+    fftw_complex* cdata = reinterpret_cast<fftw_complex*>(data);
+    fftw_execute_dft(itsCache->c2cAxis(shape, axis, data, forward)->getPlan(),
+                     cdata, cdata);
   }
 
   FFTW::Plan FFTW::plan_redft00(const IPosition &size, float *in, float *out)
   {
     initialize_fftw();
+    std::lock_guard<std::mutex> lock(theirMutex);
     
     std::vector<fftwf_r2r_kind> kinds(size.nelements(), FFTW_REDFT00);
     
@@ -247,6 +513,7 @@ std::mutex FFTW::theirMutex;
   FFTW::Plan FFTW::plan_redft00(const IPosition &size, double *in, double *out)
   {
     initialize_fftw();
+    std::lock_guard<std::mutex> lock(theirMutex);
     
     std::vector<fftw_r2r_kind> kinds(size.nelements(), FFTW_REDFT00);
     
@@ -269,11 +536,14 @@ std::mutex FFTW::theirMutex;
 
   class FFTWPlan { };
   class FFTWPlanf { };
+  class FFTWPlanCache { };
   
   FFTW::FFTW()
   {}
   FFTW::~FFTW()
   {}
+  uInt FFTW::nplans() const
+  { return 0; }
   void FFTW::plan_r2c(const IPosition&, float*, std::complex<float>*) 
   {}
   void FFTW::plan_r2c(const IPosition&, double*, std::complex<double>*) 
@@ -302,6 +572,10 @@ std::mutex FFTW::theirMutex;
   {}
   void FFTW::c2c(const IPosition&, std::complex<double>*, Bool)
   {}
+  void FFTW::c2c_axis(const IPosition&, uInt, std::complex<float>*, bool)
+  {}
+  void FFTW::c2c_axis(const IPosition&, uInt, std::complex<double>*, bool)
+  {}
 
   FFTW::Plan FFTW::plan_redft00(const IPosition &, float *, float *)
   { throw std::runtime_error("FFTW not available"); }
@@ -317,6 +591,21 @@ std::mutex FFTW::theirMutex;
   
 #endif
 
+void FFTW::setNThreads(int nthreads)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  theirNThreads = nthreads;
+}
+
+int FFTW::getNThreads()
+{
+  int nthreads = theirNThreads;
+  if (nthreads < 1) {
+    nthreads = std::max (1, HostInfo::numCPUs());
+  }
+  return nthreads;
+}
+
 FFTW::Plan::Plan(Plan&&) = default;
 
 FFTW::Plan::Plan(FFTWPlan* plan)
@@ -37,6 +37,7 @@ namespace casacore {
 //# Forward Declarations.
 class FFTWPlan;
 class FFTWPlanf;
+class FFTWPlanCache;
 
 // <summary> C++ interface to the FFTWw library </summary>
 // <reviewed reviewer="NONE" date="" tests="" demos="">
@@ -49,6 +50,20 @@ class FFTWPlanf;
 // The interface is such that the presence of FFTW3 is only visible
 // in the implementation. The header file does not need to know.
 // In this way external code using this class does not need to set HAVE_FFTW.
+// <p>
+// The plans made are kept in a cache (per FFTW object) keyed on the transform
+// type, shape, number of threads and data alignment. An execute function
+// looks up (or makes) the plan for the given shape and applies it to the
+// given data using the FFTW new-array execute functions. So a plan is made
+// only once for each shape, also if FFTs of various shapes are interleaved.
+// <br>If FFTW was built with threads, large transforms are planned with
+// multiple threads (by default the number of CPUs; see
+// <src>setNThreads</src>). Small transforms always use a single thread,
+// because the thread overhead would dominate.
+// <br>Function <src>c2c_axis</src> does in-place transforms of all lines
+// along one axis of an N-dim array in a single (batched) FFTW plan.
+// <br>Note that FFTW's planner is not thread-safe, so making a plan is
+// guarded by a mutex; executing a plan can be done in parallel.
 // </synopsis>
 
 class FFTW
@@ -68,9 +83,10 @@ public:
   void plan_c2c_backward(const IPosition &size, std::complex<double> *in) ;
   void plan_c2c_backward(const IPosition &size, std::complex<float> *in) ;
   
-  // TODO These overloads do not use their parameters at all. This should
-  // be written to use an interface like plan_redft00().
   // overloaded interface to fftw[f]_execute...
+  // The plan for the given size (as used in the plan functions above) is
+  // taken from the cache (or made if not planned yet) and executed on the
+  // given data.
   void r2c(const IPosition &size, float *in, std::complex<float> *out) ;
   void r2c(const IPosition &size, double *in, std::complex<double> *out) ;
   void c2r(const IPosition &size, std::complex<float> *in, float *out);
@@ -78,6 +94,29 @@ public:
   void c2c(const IPosition &size, std::complex<float> *in, bool forward);
   void c2c(const IPosition &size, std::complex<double> *in, bool forward);
 
+  // Do in-place complex-to-complex FFTs along the given axis of the
+  // contiguous array with the given shape (in casacore order, thus axis 0
+  // varies fastest). All lines along the axis are transformed in a single
+  // batched FFTW plan, which is cached as well.
+  // Like FFTW, the result is not normalized.
+  // <group>
+  void c2c_axis(const IPosition &shape, uInt axis,
+                std::complex<float> *data, bool forward);
+  void c2c_axis(const IPosition &shape, uInt axis,
+                std::complex<double> *data, bool forward);
+  // </group>
+
+  // Set or get the (maximum) number of threads used for new plans.
+  // A value < 1 means the number of CPUs (which is the default).
+  // It only has effect if FFTW was built with threads.
+  // <group>
+  static void setNThreads(int nthreads);
+  static int getNThreads();
+  // </group>
+
+  // Get the number of plans in the cache of this object.
+  uInt nplans() const;
+
   class Plan
   {
     public:
@@ -105,35 +144,24 @@ public:
   static Plan plan_redft00(const IPosition &size, double *in, double *out);
   
 private:
+  friend class FFTWPlanCache;
+
   static void initialize_fftw();
   
-  std::unique_ptr<FFTWPlanf> itsPlanR2Cf;
-  std::unique_ptr<FFTWPlan>  itsPlanR2C;
-  
-  std::unique_ptr<FFTWPlanf> itsPlanC2Rf;
-  std::unique_ptr<FFTWPlan>  itsPlanC2R;
-  
-  std::unique_ptr<FFTWPlanf> itsPlanC2CFf;   // forward
-  std::unique_ptr<FFTWPlan>  itsPlanC2CF;
-  
-  std::unique_ptr<FFTWPlanf> itsPlanC2CBf;   // backward
-  std::unique_ptr<FFTWPlan>  itsPlanC2CB;
-  
-  std::unique_ptr<FFTWPlanf> itsPlanR2Rf;
-  std::unique_ptr<FFTWPlan>  itsPlanR2R;
+  // The cache of plans made by this object.
+  std::unique_ptr<FFTWPlanCache> itsCache;
   
   unsigned flags;
 
+  static int theirNThreads;         // max nr of threads for new plans
+
   static bool is_initialized_fftw;  // FFTW needs initialization
                                              // only once per process,
                                              // not once per object
                                              
-  // TODO this mutex does not make FFTW thread safe, because
-  // planning an FFT with FFTW is not thread safe either.
-  // So either the plan..() methods should take the mutex, or
-  // FFTW should leave synchronization fully to the user of
-  // this class: currently it's halfway in between.
-  static std::mutex theirMutex;          // Initialization mutex
+  // Mutex for initialization and planning, because FFTW's planner
+  // is not thread-safe.
+  static std::mutex theirMutex;
 };    
     
 } //# NAMESPACE CASACORE - END
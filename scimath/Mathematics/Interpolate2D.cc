@@ -31,10 +31,14 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Containers/Block.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
-Interpolate2D::Interpolate2D(Interpolate2D::Method method) {
+Interpolate2D::Interpolate2D(Interpolate2D::Method method)
+: itsMethod (method)
+{
 
 // Set up function pointers to correct method
 
@@ -60,7 +64,8 @@ Interpolate2D::Interpolate2D(Interpolate2D::Method method) {
 Interpolate2D::Interpolate2D(const Interpolate2D &other)
 : itsFuncPtrFloat (other.itsFuncPtrFloat),
   itsFuncPtrDouble(other.itsFuncPtrDouble),
-  itsFuncPtrBool  (other.itsFuncPtrBool)
+  itsFuncPtrBool  (other.itsFuncPtrBool),
+  itsMethod       (other.itsMethod)
 {}
 
 Interpolate2D::~Interpolate2D()
@@ -71,6 +76,7 @@ Interpolate2D &Interpolate2D::operator=(const Interpolate2D &other)
    itsFuncPtrFloat  = other.itsFuncPtrFloat;
    itsFuncPtrDouble = other.itsFuncPtrDouble;
    itsFuncPtrBool   = other.itsFuncPtrBool;
+   itsMethod        = other.itsMethod;
    return *this;
 }
 
@@ -197,6 +203,78 @@ Bool Interpolate2D::interp(
     return True;
 }
 
+// Versions interpolating many coordinates
+
+void Interpolate2D::interp(Float* result, Bool* valid,
+                           const Double* x, const Double* y, size_t n,
+                           const Matrix<Float>& data,
+                           const Matrix<Bool>* mask) const
+{
+  if (itsMethod == LINEAR) {
+    interpLinearMany (result, valid, x, y, n, data, mask);
+  } else if (itsMethod == CUBIC) {
+    interpCubicMany (result, valid, x, y, n, data, mask);
+  } else if (itsMethod == LANCZOS) {
+    interpLanczosMany (result, valid, x, y, n, data, mask);
+  } else {
+    interpMany (result, valid, x, y, n, data, mask, itsFuncPtrFloat);
+  }
+}
+
+void Interpolate2D::interp(Double* result, Bool* valid,
+                           const Double* x, const Double* y, size_t n,
+                           const Matrix<Double>& data,
+                           const Matrix<Bool>* mask) const
+{
+  if (itsMethod == LINEAR) {
+    interpLinearMany (result, valid, x, y, n, data, mask);
+  } else if (itsMethod == CUBIC) {
+    interpCubicMany (result, valid, x, y, n, data, mask);
+  } else if (itsMethod == LANCZOS) {
+    interpLanczosMany (result, valid, x, y, n, data, mask);
+  } else {
+    interpMany (result, valid, x, y, n, data, mask, itsFuncPtrDouble);
+  }
+}
+
+void Interpolate2D::interp(Complex* result, Bool* valid,
+                           const Double* x, const Double* y, size_t n,
+                           const Matrix<Complex>& data,
+                           const Matrix<Bool>* mask) const
+{
+  Matrix<Float> realData = (Matrix<Float>)real(data);
+  Matrix<Float> imagData = (Matrix<Float>)imag(data);
+  std::vector<Float> realRes(n), imagRes(n);
+  Block<Bool> imagValid(n);
+  interp (realRes.data(), valid, x, y, n, realData, mask);
+  interp (imagRes.data(), imagValid.storage(), x, y, n, imagData, mask);
+  for (size_t k=0; k<n; ++k) {
+    valid[k] = valid[k] && imagValid[k];
+    if (valid[k]) {
+      result[k] = Complex(realRes[k], imagRes[k]);
+    }
+  }
+}
+
+void Interpolate2D::interp(DComplex* result, Bool* valid,
+                           const Double* x, const Double* y, size_t n,
+                           const Matrix<DComplex>& data,
+                           const Matrix<Bool>* mask) const
+{
+  Matrix<Double> realData = (Matrix<Double>)real(data);
+  Matrix<Double> imagData = (Matrix<Double>)imag(data);
+  std::vector<Double> realRes(n), imagRes(n);
+  Block<Bool> imagValid(n);
+  interp (realRes.data(), valid, x, y, n, realData, mask);
+  interp (imagRes.data(), imagValid.storage(), x, y, n, imagData, mask);
+  for (size_t k=0; k<n; ++k) {
+    valid[k] = valid[k] && imagValid[k];
+    if (valid[k]) {
+      result[k] = DComplex(realRes[k], imagRes[k]);
+    }
+  }
+}
+
 // Double version with two identicals and mask
 
 Bool Interpolate2D::interp(Double &resultI, Double &resultJ, 
@@ -325,7 +403,7 @@ void Interpolate2D::bcucof (Double c[4][4], const Double y[4],
     {0,0,0,0,0,0,0,0,2,-2,0,0,1,1,0,0},
     {-6,6,-6,6,-3,-3,3,3,-4,4,2,-2,-2,-2,-1,-1},
     {4,-4,4,-4,2,2,-2,-2,2,-2,-2,2,1,1,1,1} };
-  static Double X[16], CL[16];
+  Double X[16], CL[16];
   
   // Pack temporary
   for (uInt i=0; i<4; ++i) {
@@ -85,10 +85,6 @@ class String;
 // </motivation>
 //
 //
-// <todo asof="1998/08/02">
-//   <li> Alternative approach: instantiate with an Array, take a block of
-//        vector locations, return a block of interpolation results
-// </todo>
 
 
 class Interpolate2D {
@@ -174,6 +170,31 @@ class Interpolate2D {
                const Matrix<Bool> &mask) const;
   // </group>
 
+  // Do many interpolations at once for the pixel coordinates
+  // <src>(x[k],y[k])</src> with k=0..n-1. The mask pointer can be null.
+  // <src>valid[k]</src> tells if <src>result[k]</src> could be
+  // interpolated (as returned by <src>interp</src> for a single
+  // coordinate); otherwise <src>result[k]</src> is undefined.
+  // <br>The results are the same as for interpolating the coordinates one
+  // by one, but bilinear, bicubic and Lanczos interpolation are done by
+  // tight loops on the data (in parallel for many coordinates) and complex
+  // data are split in real and imaginary parts only once. For Lanczos the
+  // separable kernel is evaluated once per axis.
+  // <group>
+  void interp (Float* result, Bool* valid,
+               const Double* x, const Double* y, size_t n,
+               const Matrix<Float>& data, const Matrix<Bool>* mask) const;
+  void interp (Double* result, Bool* valid,
+               const Double* x, const Double* y, size_t n,
+               const Matrix<Double>& data, const Matrix<Bool>* mask) const;
+  void interp (Complex* result, Bool* valid,
+               const Double* x, const Double* y, size_t n,
+               const Matrix<Complex>& data, const Matrix<Bool>* mask) const;
+  void interp (DComplex* result, Bool* valid,
+               const Double* x, const Double* y, size_t n,
+               const Matrix<DComplex>& data, const Matrix<Bool>* mask) const;
+  // </group>
+
   // Do two linear interpolations simultaneously. The second call is direct.
   // The first call transfers to the second call. It is assumed that the
   // structure (shape, steps) of the mask and data files are the same.
@@ -235,6 +256,41 @@ class Interpolate2D {
   Bool interpCubicBool(Bool &result, const Vector<Double> &where,
 		       const Matrix<Bool> &data) const;
 
+  // Interpolate many coordinates using the given single point function.
+  template <typename T>
+  void interpMany(T* result, Bool* valid,
+                  const Double* x, const Double* y, size_t n,
+                  const Matrix<T>& data, const Matrix<Bool>* mask,
+                  Bool (Interpolate2D::*func)(T&, const Vector<Double>&,
+                                              const Matrix<T>&,
+                                              const Matrix<Bool>*&) const)
+    const;
+
+  // Bi-linear interpolation of one coordinate using pointers into the
+  // data and mask (null if no mask) with the given steps.
+  template <typename T>
+  static Bool interpLinearAt(T& result, Double x, Double y,
+                             const T* dataPtr, size_t k0, size_t k1,
+                             uInt si, uInt sj, const Bool* maskPtr,
+                             size_t m0, size_t m1);
+
+  // Bi-linear, bi-cubic and Lanczos interpolation of many coordinates.
+  // Large numbers of coordinates are interpolated in parallel.
+  // <group>
+  template <typename T>
+  void interpLinearMany(T* result, Bool* valid,
+                        const Double* x, const Double* y, size_t n,
+                        const Matrix<T>& data, const Matrix<Bool>* mask) const;
+  template <typename T>
+  void interpCubicMany(T* result, Bool* valid,
+                       const Double* x, const Double* y, size_t n,
+                       const Matrix<T>& data, const Matrix<Bool>* mask) const;
+  template <typename T>
+  void interpLanczosMany(T* result, Bool* valid,
+                         const Double* x, const Double* y, size_t n,
+                         const Matrix<T>& data, const Matrix<Bool>* mask) const;
+  // </group>
+
   // Lanczos interpolation
   template <typename T>
   Bool interpLanczos(T &result, const Vector<Double> &where,
@@ -272,6 +328,7 @@ class Interpolate2D {
   FuncPtrFloat itsFuncPtrFloat;
   FuncPtrDouble itsFuncPtrDouble;
   FuncPtrBool itsFuncPtrBool;
+  Method itsMethod;
 
 };
 
@@ -103,6 +103,226 @@ Bool Interpolate2D::interpLinear(T &result,
   } else return False;
 }
 
+template <typename T>
+inline Bool Interpolate2D::interpLinearAt(T& result, Double x, Double y,
+                                          const T* dataPtr, size_t k0,
+                                          size_t k1, uInt si, uInt sj,
+                                          const Bool* maskPtr, size_t m0,
+                                          size_t m1) {
+  // This is the same as interpLinear, but uses pointers into the data
+  // instead of indexing the matrix.
+  uInt i = Int(x);
+  uInt j = Int(y);
+  if (i==si) --i;
+  if (j==sj) --j;
+  if (i < si && j < sj) {
+    if (maskPtr) {
+      const Bool* m = maskPtr + i*m0 + j*m1;
+      if (!m[0] || !m[m0] || !m[m1] || !m[m0+m1]) return False;
+    }
+    const T* d = dataPtr + i*k0 + j*k1;
+    Double TT = x - i;
+    Double UU = y - j;
+    result = (1.0-TT)*(1.0-UU)*d[0] +
+      TT*(1.0-UU)*d[k0] +
+      TT*UU*d[k0+k1] +
+      (1.0-TT)*UU*d[k1];
+    return True;
+  }
+  return False;
+}
+
+template <typename T>
+void Interpolate2D::interpLinearMany(T* result, Bool* valid,
+                                     const Double* x, const Double* y,
+                                     size_t n, const Matrix<T>& data,
+                                     const Matrix<Bool>* mask) const {
+  const IPosition &shape = data.shape();
+  uInt si = uInt(shape(0)-1);
+  uInt sj = uInt(shape(1)-1);
+  const T* dataPtr = data.data();
+  const size_t k0 = data.steps()[0];
+  const size_t k1 = data.steps()[1];
+  const Bool* maskPtr = (mask ? mask->data() : 0);
+  const size_t m0 = (mask ? mask->steps()[0] : 0);
+  const size_t m1 = (mask ? mask->steps()[1] : 0);
+  Int64 nr = n;
+#ifdef _OPENMP
+#pragma omp parallel for if (nr > 65536)
+#endif
+  for (Int64 k=0; k<nr; ++k) {
+    valid[k] = interpLinearAt (result[k], x[k], y[k], dataPtr, k0, k1,
+                               si, sj, maskPtr, m0, m1);
+  }
+}
+
+template <typename T>
+void Interpolate2D::interpCubicMany(T* result, Bool* valid,
+                                    const Double* x, const Double* y,
+                                    size_t n, const Matrix<T>& data,
+                                    const Matrix<Bool>* mask) const {
+  // This is the same as interpCubic, but uses pointers into the data.
+  const IPosition &shape = data.shape();
+  uInt si = uInt(shape(0)-1);
+  uInt sj = uInt(shape(1)-1);
+  const T* dataPtr = data.data();
+  const size_t k0 = data.steps()[0];
+  const size_t k1 = data.steps()[1];
+  const Bool* maskPtr = (mask ? mask->data() : 0);
+  const size_t m0 = (mask ? mask->steps()[0] : 0);
+  const size_t m1 = (mask ? mask->steps()[1] : 0);
+  Int64 nr = n;
+#ifdef _OPENMP
+#pragma omp parallel for if (nr > 4096)
+#endif
+  for (Int64 k=0; k<nr; ++k) {
+    Int i = Int(x[k]);
+    Int j = Int(y[k]);
+    // Handle edge (and beyond) by using linear.
+    if (i<=0 || i>=shape[0]-2 || j<=0 || j>=shape[1]-2) {
+      valid[k] = interpLinearAt (result[k], x[k], y[k], dataPtr, k0, k1,
+                                 si, sj, maskPtr, m0, m1);
+      continue;
+    }
+    valid[k] = False;
+    if (maskPtr) {
+      Bool bad = False;
+      const Bool* mj = maskPtr + (i-1)*m0 + (j-1)*m1;
+      for (Int jj=0; jj<4 && !bad; ++jj, mj+=m1) {
+        for (Int ii=0; ii<4; ++ii) {
+          if (!mj[ii*m0]) {
+            bad = True;
+            break;
+          }
+        }
+      }
+      if (bad) continue;
+    }
+    // d(a,b) is data(i+a,j+b).
+    const T* dij = dataPtr + i*k0 + j*k1;
+    auto d = [dij,k0,k1] (Int a, Int b) -> T
+      { return dij[Int64(a)*Int64(k0) + Int64(b)*Int64(k1)]; };
+    Double TT = x[k] - i;
+    Double UU = y[k] - j;
+    Double itsY[4];
+    Double itsY1[4];
+    Double itsY2[4];
+    Double itsY12[4];
+    Double itsC[4][4];
+    itsY[0] = d(0,0);
+    itsY[1] = d(1,0);
+    itsY[2] = d(1,1);
+    itsY[3] = d(0,1);
+    itsY1[0] = d(1,0) - d(-1,0);
+    itsY1[1] = d(2,0) - d(0,0);
+    itsY1[2] = d(2,1) - d(0,1);
+    itsY1[3] = d(1,1) - d(-1,1);
+    itsY2[0] = d(0,1) - d(0,-1);
+    itsY2[1] = d(1,1) - d(1,-1);
+    itsY2[2] = d(1,2) - d(1,0);
+    itsY2[3] = d(0,2) - d(0,0);
+    itsY12[0] = d(1,1) + d(-1,-1) - d(-1,1) - d(1,-1);
+    itsY12[1] = d(2,1) + d(0,-1) - d(0,1) - d(2,-1);
+    itsY12[2] = d(2,2) + d(0,0) - d(0,2) - d(2,0);
+    itsY12[3] = d(1,2) + d(-1,0) - d(-1,2) - d(1,0);
+    for (uInt l=0; l<4; ++l) {
+      itsY1[l]  /= 2.0;
+      itsY2[l]  /= 2.0;
+      itsY12[l] /= 4.0;
+    }
+    bcucof(itsC, itsY, itsY1, itsY2, itsY12);
+    T res = 0.0;
+    for (Int l=3; l>=0; --l) {
+      res = TT*res + ((itsC[l][3]*UU + itsC[l][2])*UU +
+                      itsC[l][1])*UU + itsC[l][0];
+    }
+    result[k] = res;
+    valid[k] = True;
+  }
+}
+
+template <typename T>
+void Interpolate2D::interpLanczosMany(T* result, Bool* valid,
+                                      const Double* x, const Double* y,
+                                      size_t n, const Matrix<T>& data,
+                                      const Matrix<Bool>* mask) const {
+  // This is the same as interpLanczos, but the kernel is separable, so
+  // only 2*2a instead of (2a)^2 kernel values are calculated per point.
+  const Int a = 3;
+  const IPosition &shape = data.shape();
+  const Int nx = shape[0];
+  const Int ny = shape[1];
+  const T* dataPtr = data.data();
+  const size_t k0 = data.steps()[0];
+  const size_t k1 = data.steps()[1];
+  const Bool* maskPtr = (mask ? mask->data() : 0);
+  const size_t m0 = (mask ? mask->steps()[0] : 0);
+  const size_t m1 = (mask ? mask->steps()[1] : 0);
+  Int64 nr = n;
+#ifdef _OPENMP
+#pragma omp parallel for if (nr > 4096)
+#endif
+  for (Int64 k=0; k<nr; ++k) {
+    const T floorx = std::floor(x[k]);
+    const T floory = std::floor(y[k]);
+    // Handle mask for the kernel support within the data.
+    valid[k] = False;
+    if (maskPtr) {
+      Int i1 = std::max(Int(x[k]-a+1), 0);
+      Int i2 = std::min(Int(x[k]+a), nx-1);
+      Int j1 = std::max(Int(y[k]-a+1), 0);
+      Int j2 = std::min(Int(y[k]+a), ny-1);
+      Bool bad = False;
+      for (Int j=j1; j<=j2 && !bad; ++j) {
+        for (Int i=i1; i<=i2; ++i) {
+          if (!maskPtr[i*m0 + j*m1]) {
+            bad = True;
+            break;
+          }
+        }
+      }
+      if (bad) continue;
+    }
+    valid[k] = True;
+    // Set the pixel to zero near the edge (as in interpLanczos).
+    if (floorx < a || floorx >= nx - a || floory < a || floory >= ny - a) {
+      result[k] = 0;
+      continue;
+    }
+    Double wx[2*a];
+    Double wy[2*a];
+    for (Int l=0; l<2*a; ++l) {
+      wx[l] = L(x[k] - (floorx - a + 1 + l), a);
+      wy[l] = L(y[k] - (floory - a + 1 + l), a);
+    }
+    const T* d = dataPtr + (Int64(floorx) - a + 1)*k0 +
+                           (Int64(floory) - a + 1)*k1;
+    T res = 0;
+    for (Int ii=0; ii<2*a; ++ii) {
+      for (Int jj=0; jj<2*a; ++jj) {
+        res += d[ii*k0 + jj*k1] * wx[ii] * wy[jj];
+      }
+    }
+    result[k] = res;
+  }
+}
+
+template <typename T>
+void Interpolate2D::interpMany(T* result, Bool* valid,
+                               const Double* x, const Double* y, size_t n,
+                               const Matrix<T>& data, const Matrix<Bool>* mask,
+                               Bool (Interpolate2D::*func)
+                                 (T&, const Vector<Double>&,
+                                  const Matrix<T>&,
+                                  const Matrix<Bool>*&) const) const {
+  Vector<Double> where(2);
+  for (size_t k=0; k<n; ++k) {
+    where[0] = x[k];
+    where[1] = y[k];
+    valid[k] = ((*this).*func)(result[k], where, data, mask);
+  }
+}
+
 template <typename T>
 Bool Interpolate2D::interpLinear2(T &resultI, T &resultJ, 
 				  const Vector<Double> &where, 
@@ -267,8 +487,11 @@ Bool Interpolate2D::interpLanczos(T &result,
     const T floorx = std::floor(x);
     const T floory = std::floor(y);
 
-    // Handle mask
-    if (anyBadMaskPixels(maskPtr, x-a+1, x+a, y-a+1, y+a)) return False;
+    // Handle mask for the kernel support within the data.
+    if (anyBadMaskPixels(maskPtr, std::max(Int(x-a+1), 0),
+                         std::min(Int(x+a), Int(shape[0]-1)),
+                         std::max(Int(y-a+1), 0),
+                         std::min(Int(y+a), Int(shape[1]-1)))) return False;
 
     // Where we can't sum over the full support of the kernel due to proximity
     // to the edge, set the pixel value to zero. This is just one way of
@@ -249,41 +249,55 @@ void InterpolateArray1D<Domain,Range>::interpolatePtr(PtrBlock<Range*>& yout,
 						      const PtrBlock<const Range*>& yin, 
                                                       Int method)
 {
+  // The positions and weights are determined once per output x value
+  // (which also checks for repeated x values, because an exception cannot
+  // be thrown in a parallel loop). Thereafter they are applied to the
+  // y-vectors in a loop that can be vectorized; large arrays are done
+  // in parallel.
   uInt nElements=xin.nelements();
   AlwaysAssert (nElements>0, AipsError);
+  Int nout = xout.nelements();
+#ifdef _OPENMP
+  size_t nval = size_t(nout) * ny;
+#endif
   Domain x_req;
   switch (method) {
   case nearestNeighbour: // This does nearest neighbour interpolation
     {
-      for (uInt i=0; i<xout.nelements(); i++) {
+      Block<uInt> index(nout);
+      for (Int i=0; i<nout; i++) {
 	x_req=xout[i];
 	Bool found;
 	uInt where = binarySearchBrackets(found, xin, x_req, nElements);
 	if (where == nElements) {
-	  for (Int j=0; j<ny; j++) yout[i][j]=yin[nElements-1][j];
+	  index[i] = nElements-1;
 	}
 	else if (where == 0) {
-	  for (Int j=0; j<ny; j++) yout[i][j]=yin[0][j];
+	  index[i] = 0;
 	}
 	else {
  	  // The following works for both ascending/descending xin 
 	  Domain nextdiff=abs(xin[where]-x_req);    // forward diff
 	  Domain prevdiff=abs(xin[where-1]-x_req);  // backward diff
-	  if (nextdiff < prevdiff) { 
-            // closer to next
-	    for (Int j=0; j<ny; j++) yout[i][j]=yin[where][j];
-	  }
-	  else {
-            // closer to previous
-	    for (Int j=0; j<ny; j++) yout[i][j]=yin[where-1][j];
-	  }
+	  // closer to next or previous
+	  index[i] = (nextdiff < prevdiff  ?  where : where-1);
 	}
       }
+#ifdef _OPENMP
+#pragma omp parallel for if (nval > 65536)
+#endif
+      for (Int i=0; i<nout; i++) {
+	const Range* yi = yin[index[i]];
+	Range* yo = yout[i];
+	for (Int j=0; j<ny; j++) yo[j]=yi[j];
+      }
       return;
     }
   case linear: // Linear interpolation is the default
     {
-      for (uInt i=0; i<xout.nelements(); i++) {
+      Block<uInt> index(nout);
+      Block<Domain> fracs(nout);
+      for (Int i=0; i<nout; i++) {
 	x_req=xout[i];
 	Bool found;
 	uInt where = binarySearchBrackets(found, xin, x_req, nElements);
@@ -291,15 +305,25 @@ void InterpolateArray1D<Domain,Range>::interpolatePtr(PtrBlock<Range*>& yout,
 	  where--;
 	else if (where == 0)
 	  where++;
-	Domain x2 = xin[where]; Int ind2 = where;
+	Domain x2 = xin[where];
 	where--;
-	Domain x1 = xin[where]; Int ind1 = where; 
+	Domain x1 = xin[where];
 	if (nearAbs(x1, x2)) 
 	  throw(AipsError("Interpolate1D::operator()"
 			  " data has repeated x values"));
-	Domain frac=(x_req-x1)/(x2-x1);
+	index[i] = where;
+	fracs[i] = (x_req-x1)/(x2-x1);
+      }
+#ifdef _OPENMP
+#pragma omp parallel for if (nval > 65536)
+#endif
+      for (Int i=0; i<nout; i++) {
+	const Range* y1 = yin[index[i]];
+	const Range* y2 = yin[index[i]+1];
+	Range* yo = yout[i];
+	Domain frac = fracs[i];
 	for (Int j=0; j<ny; j++) 
-	  yout[i][j] = yin[ind1][j] + frac * (yin[ind2][j] - yin[ind1][j]);
+	  yo[j] = y1[j] + frac * (y2[j] - y1[j]);
 	//    return y1 + ((x_req-x1)/(x2-x1)) * (y2-y1);
       }
       return ;
@@ -311,7 +335,6 @@ void InterpolateArray1D<Domain,Range>::interpolatePtr(PtrBlock<Range*>& yout,
     }
   case spline: // natural cubic splines
     {
-      Block<Range> y2(nElements);
       // The y2 values are initialised here.  I need to calculate the second
       // derivates of the interpolating curve at each x_value.  As described
       // in Numerical Recipies 2nd Ed. Sec. 3.3, this is done by requiring
@@ -325,70 +348,95 @@ void InterpolateArray1D<Domain,Range>::interpolatePtr(PtrBlock<Range*>& yout,
       // coefficients are in the diagonal immediately above the main
       // one. These values are stored in y2Values temporarily. The temporary
       // storage t, is used to hold the right hand side.
+      // The coefficients only depend on x, so they are the same for all
+      // y-vectors, which are solved simultaneously. y2 holds the second
+      // derivatives of all y-vectors for an x value contiguously.
+      Block<Range> y2(size_t(nElements)*ny);
       Block<Domain> t(nElements);
       t[0] = 0; 
+      Domain c = xin[1] - xin[0];
+      if (nearAbs(xin[1],  xin[0])) 
+	throw(AipsError("Interpolate1D::setMethod"
+			" data has repeated x values"));
+      Domain a, b, delta;
+      const Domain six = 6;
+      const Float one = 1;
+      Range* y2p = y2.storage();
       for (Int j=0; j<ny; j++) {
-	y2[0] = Range(0);
-	y2[nElements-1] = y2[0];
-	Domain c = xin[1] - xin[0];
-	if (nearAbs(xin[1],  xin[0])) 
+	y2p[j] = Range(0);
+	y2p[size_t(nElements-1)*ny + j] = Range(0);
+      }
+      Int i;
+      for (i = 1; i < Int(nElements)-1; i++){
+	a = c;
+	b = Domain(2)*(xin[i+1] - xin[i-1]);
+	if (nearAbs(xin[i+1],  xin[i])) 
 	  throw(AipsError("Interpolate1D::setMethod"
 			  " data has repeated x values"));
-	Domain a, b, delta;
-	const Domain six = 6;
-	const Float one = 1;
-	Range r;
-	Int i;
-	for (i = 1; i < Int(nElements)-1; i++){
-	  a = c;
-	  b = Domain(2)*(xin[i+1] - xin[i-1]);
-	  if (nearAbs(xin[i+1],  xin[i])) 
-	    throw(AipsError("Interpolate1D::setMethod"
-			    " data has repeated x values"));
-	  c = (xin[i+1] - xin[i]);
-	  r = (one/c) * (yin[i+1][j] - yin[i][j]) - 
-	    (one/a) * (yin[i][j] - yin[i-1][j]);
-	  delta = a * t[i-1];
-	  if (nearAbs(b, delta)) 
-	    throw(AipsError("Interpolate1D::setMethod"
-			    " trouble constructing second derivatives"));
-	  delta = b - delta;
-	  t[i] = c/delta;
-	  y2[i] = (one/delta)*(six*r - a*y2[i-1]);
+	c = (xin[i+1] - xin[i]);
+	delta = a * t[i-1];
+	if (nearAbs(b, delta)) 
+	  throw(AipsError("Interpolate1D::setMethod"
+			  " trouble constructing second derivatives"));
+	delta = b - delta;
+	t[i] = c/delta;
+	const Range* yp = yin[i-1];
+	const Range* yc = yin[i];
+	const Range* yn = yin[i+1];
+	const Range* y2prev = y2p + size_t(i-1)*ny;
+	Range* y2cur = y2p + size_t(i)*ny;
+	for (Int j=0; j<ny; j++) {
+	  Range r = (one/c) * (yn[j] - yc[j]) - (one/a) * (yc[j] - yp[j]);
+	  y2cur[j] = (one/delta)*(six*r - a*y2prev[j]);
 	}
-	// The second part of the solution is to do the back-substitution to
-	// iteratively obtain the second derivatives.
-	for (i = Int(nElements)-2; i > 1; i--){
-	  y2[i] -= t[i]*y2[i+1];
+      }
+      // The second part of the solution is to do the back-substitution to
+      // iteratively obtain the second derivatives.
+      for (i = Int(nElements)-2; i > 1; i--){
+	Range* y2cur = y2p + size_t(i)*ny;
+	const Range* y2next = y2cur + ny;
+	for (Int j=0; j<ny; j++) {
+	  y2cur[j] -= t[i]*y2next[j];
 	}
+      }
 
-	for (i=0; i<Int(xout.nelements()); i++) {
-	  x_req=xout[i];
-	  Bool found;
-	  uInt where = binarySearchBrackets(found, xin, x_req, nElements);
-	  if (where == nElements)
-	    where--;
-	  else if (where == 0)
-	    where++;
-	  
-	  Domain dx, h, a, b, x1, x2;
-	  Range y1v, y2v, y1d, y2d;
-	  
-	  x2 = xin[where]; 
-	  y2v = yin[where][j];
-	  y2d = y2[where];
+      // Determine the position and weights of each output x value.
+      Block<uInt> index(nout);
+      Block<Domain> wa(nout), wb(nout), wh(nout);
+      for (i=0; i<nout; i++) {
+	x_req=xout[i];
+	Bool found;
+	uInt where = binarySearchBrackets(found, xin, x_req, nElements);
+	if (where == nElements)
 	  where--;
-	  x1 = xin[where]; 
-	  y1v = yin[where][j];
-	  y1d = y2[where];
-	  if (nearAbs(x1, x2)) 
-	    throw(AipsError("Interpolate1D::operator()"
-			    " data has repeated x values"));
-	  dx = x2-x1;
-	  a = (x2-x_req)/dx; 
-	  b = Domain(1)-a;
-	  h = dx*dx/6.;
-	  yout[i][j] = a*y1v + b*y2v + h*(a*a*a-a)*y1d + h*(b*b*b-b)*y2d;
+	else if (where == 0)
+	  where++;
+	Domain x1 = xin[where-1];
+	Domain x2 = xin[where];
+	if (nearAbs(x1, x2)) 
+	  throw(AipsError("Interpolate1D::operator()"
+			  " data has repeated x values"));
+	Domain dx = x2-x1;
+	index[i] = where-1;
+	wa[i] = (x2-x_req)/dx; 
+	wb[i] = Domain(1)-wa[i];
+	wh[i] = dx*dx/6.;
+      }
+#ifdef _OPENMP
+#pragma omp parallel for if (nval > 65536)
+#endif
+      for (i=0; i<nout; i++) {
+	const Range* y1v = yin[index[i]];
+	const Range* y2v = yin[index[i]+1];
+	const Range* y1d = y2p + size_t(index[i])*ny;
+	const Range* y2d = y1d + ny;
+	Range* yo = yout[i];
+	Domain a = wa[i];
+	Domain b = wb[i];
+	Domain h = wh[i];
+	for (Int j=0; j<ny; j++) {
+	  yo[j] = a*y1v[j] + b*y2v[j] + h*(a*a*a-a)*y1d[j] +
+	    h*(b*b*b-b)*y2d[j];
 	}
       }
       return;
@@ -809,18 +857,20 @@ void InterpolateArray1D<Domain,Range>::polynomialInterpolation
  const PtrBlock<const Range*>& yin, 
  Int order)
 {
-  // Based on Nevilles Algorithm (Numerical Recipies 2nd ed., Section 3.1)
-  // x is the point we want to estimate, n is the number of points to use
-  // in the interpolation, and offset controls which n points are used
-  // (normally the nearest points)
+  // The interpolating polynomial through n points is the sum of the
+  // y values times the Lagrange basis polynomials at x (Numerical Recipies
+  // 2nd ed., Section 3.1). The latter only depend on x, so they are
+  // calculated once per output x value and applied to all y-vectors.
+  // Normally the nearest points are used.
   
   // n = #points used in interpolation
   Int n = order+1;
-  Block<Range> c(n), d(n);
-  Block<Domain> x(n);
   Int nElements = xin.nelements();
   DebugAssert((n<=nElements),AipsError);
-  for (Int i=0; i<Int(xout.nelements()); i++) {
+  Int nout = xout.nelements();
+  Block<Int> index(nout);
+  Block<Domain> weights(size_t(nout)*n);
+  for (Int i=0; i<nout; i++) {
     Domain x_req=xout[i];
     Bool found;
     Int where = binarySearchBrackets(found, xin, x_req, nElements);
@@ -830,32 +880,37 @@ void InterpolateArray1D<Domain,Range>::polynomialInterpolation
       where = 0;
     else
       where = nElements - n;
-    
-    for (Int j=0; j<ny; j++) {
-      Int offset=where;
-      // copy the x, y data into the working arrays
-      for (Int i2 = 0; i2 < n; i2++){
-	d[i2] = c[i2] = yin[offset][j]; 
-	x[i2] = xin[offset];
-	offset++;
-      }
-      // Now do the interpolation using the rather opaque algorithm
-      Range w, y;
-      y = c[0];
-      const Float one = 1;
-      for (Int k = 1; k < n; k++){
-	// Calculate new C's and D's for each iteration 
-	for (Int l = 0; l < n-k; l++){
-	  if (nearAbs(x[l+k], x[l])) 
+    index[i] = where;
+    const Domain* x = xin.data() + where*xin.steps()[0];
+    Int step = xin.steps()[0];
+    Domain* w = weights.storage() + size_t(i)*n;
+    for (Int k=0; k<n; k++) {
+      w[k] = 1;
+      for (Int l=0; l<n; l++) {
+	if (l != k) {
+	  if (nearAbs(x[l*step], x[k*step])) 
 	    throw(AipsError("Interpolate1D::polynomialInterpolation"
 			    " data has repeated x values"));
-	  w = (c[l+1] - d[l]) * (one / (x[l] - x[l+k]));
-	  c[l] = (x[l] - x_req) * w;
-	  d[l] = (x[l+k] - x_req) * w;
+	  w[k] *= (x_req - x[l*step]) / (x[k*step] - x[l*step]);
 	}
-	y += c[0];
       }
-      yout[i][j]=y;
+    }
+  }
+#ifdef _OPENMP
+#pragma omp parallel for if (size_t(nout)*ny > 65536)
+#endif
+  for (Int i=0; i<nout; i++) {
+    const Domain* w = weights.storage() + size_t(i)*n;
+    Range* yo = yout[i];
+    const Range* y0 = yin[index[i]];
+    for (Int j=0; j<ny; j++) {
+      yo[j] = w[0] * y0[j];
+    }
+    for (Int k=1; k<n; k++) {
+      const Range* yk = yin[index[i]+k];
+      for (Int j=0; j<ny; j++) {
+	yo[j] += w[k] * yk[j];
+      }
     }
   }
 }
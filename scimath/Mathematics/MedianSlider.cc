@@ -24,6 +24,7 @@
 //#                        Charlottesville, VA 22903-2475 USA
 
 #include <casacore/scimath/Mathematics/MedianSlider.h>
+#include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <stdlib.h>    
 #include <cstring>                  //# for memcpy with gcc-4.3
@@ -31,7 +32,7 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 MedianSlider::MedianSlider () 
-  : buf(0),index(0),valid(0)
+  : buf(0),low(0),high(0),hpos(0),valid(0)
 {
 }
 
@@ -39,8 +40,10 @@ MedianSlider::MedianSlider ( int hw )
 {
   halfwin = hw;
   fullwin = hw*2+1;
-  index = new uInt[fullwin];
   buf   = new Float[fullwin];
+  low   = new uInt[fullwin];
+  high  = new uInt[fullwin];
+  hpos  = new uInt[fullwin];
   valid = new Bool[fullwin];
 // buffer initially all-null and totally invalid
   for( uInt i=0; i<fullwin; i++ ) 
@@ -48,27 +51,35 @@ MedianSlider::MedianSlider ( int hw )
     buf[i] = 0;
     valid[i] = False;
   }
-  ibuf=nind=0;
+  ibuf=nlow=nhigh=nind=0;
 }
 
 MedianSlider::MedianSlider( const MedianSlider &other ) 
-  : buf(0),index(0),valid(0)
+  : buf(0),low(0),high(0),hpos(0),valid(0)
 {
   *this = other;
 }
 
 MedianSlider & MedianSlider::operator = ( const MedianSlider &other )
 {
+  if( this == &other )
+    return *this;
   cleanup();
   halfwin = other.halfwin;
   fullwin = other.fullwin;
-  index = new uInt[fullwin];
   buf   = new Float[fullwin];
+  low   = new uInt[fullwin];
+  high  = new uInt[fullwin];
+  hpos  = new uInt[fullwin];
   valid = new Bool[fullwin];
-  memcpy(index,other.index,fullwin*sizeof(uInt));
   memcpy(buf,other.buf,fullwin*sizeof(Float));
+  memcpy(low,other.low,fullwin*sizeof(uInt));
+  memcpy(high,other.high,fullwin*sizeof(uInt));
+  memcpy(hpos,other.hpos,fullwin*sizeof(uInt));
   memcpy(valid,other.valid,fullwin*sizeof(Bool));
   ibuf=other.ibuf;
+  nlow=other.nlow;
+  nhigh=other.nhigh;
   nind=other.nind;
   return *this;
 }
@@ -76,9 +87,11 @@ MedianSlider & MedianSlider::operator = ( const MedianSlider &other )
 void MedianSlider::cleanup ()
 {
   if( buf ) delete [] buf;
-  if( index ) delete [] index;
+  if( low ) delete [] low;
+  if( high ) delete [] high;
+  if( hpos ) delete [] hpos;
   if( valid ) delete [] valid;
-  buf=0; index=0; valid=0;
+  buf=0; low=0; high=0; hpos=0; valid=0;
 }
 
 MedianSlider::~MedianSlider ()
@@ -122,80 +135,179 @@ Float MedianSlider::add ( const Vector<Float> &d )
 Float MedianSlider::add ( Float din,Bool flag )
 {
   uInt ibuf0 = ibuf;
-  Float dout = buf[ibuf0];   // outgoing datum
-  Bool  val_in=!flag,
-       val_out = valid[ibuf0]; // outgoing flag
-  
-// insert new value into buffer
-  buf[ibuf] = din;
-  valid[ibuf] = val_in;
+// remove a valid outgoing datum from the heaps
+  if( valid[ibuf0] )
+    remove(ibuf0);
+// insert new value into buffer (and heaps if valid)
+  buf[ibuf0] = din;
+  valid[ibuf0] = !flag;
+  if( !flag )
+    insert(ibuf0);
   if( ++ibuf >= fullwin )
     ibuf = 0;
-  
-  if( val_out ) // A) valid outgoing datum...
+  return median();
+}
+
+void MedianSlider::insert ( uInt ib )
+{
+  if( !nlow || !(buf[low[0]] < buf[ib]) )
+  {
+    low[nlow++] = ib;
+    siftLow(nlow-1);
+  }
+  else
+  {
+    high[nhigh++] = ib;
+    siftHigh(nhigh-1);
+  }
+  nind++;
+  rebalance();
+}
+
+void MedianSlider::remove ( uInt ib )
+{
+  uInt i = hpos[ib];
+  if( i < fullwin )
+  {
+    // replace by the last element of the low heap
+    if( i < --nlow )
+    {
+      low[i] = low[nlow];
+      siftLow(i);
+    }
+  }
+  else
+  {
+    i -= fullwin;
+    if( i < --nhigh )
+    {
+      high[i] = high[nhigh];
+      siftHigh(i);
+    }
+  }
+  nind--;
+  rebalance();
+}
+
+void MedianSlider::siftLow ( uInt i )
+{
+  uInt ib = low[i];
+  Float v = buf[ib];
+  // move up while larger than the parent
+  while( i > 0 )
+  {
+    uInt parent = (i-1)/2;
+    if( !(buf[low[parent]] < v) )
+      break;
+    low[i] = low[parent];
+    hpos[low[i]] = i;
+    i = parent;
+  }
+  // move down while smaller than the largest child
+  for( uInt child=2*i+1; child<nlow; child=2*i+1 )
   {
-    if( val_in ) // A.1) ..replaced by a valid datum
+    if( child+1 < nlow && buf[low[child]] < buf[low[child+1]] )
+      child++;
+    if( !(v < buf[low[child]]) )
+      break;
+    low[i] = low[child];
+    hpos[low[i]] = i;
+    i = child;
+  }
+  low[i] = ib;
+  hpos[ib] = i;
+}
+
+void MedianSlider::siftHigh ( uInt i )
+{
+  uInt ib = high[i];
+  Float v = buf[ib];
+  // move up while smaller than the parent
+  while( i > 0 )
+  {
+    uInt parent = (i-1)/2;
+    if( !(v < buf[high[parent]]) )
+      break;
+    high[i] = high[parent];
+    hpos[high[i]] = fullwin+i;
+    i = parent;
+  }
+  // move down while larger than the smallest child
+  for( uInt child=2*i+1; child<nhigh; child=2*i+1 )
+  {
+    if( child+1 < nhigh && buf[high[child+1]] < buf[high[child]] )
+      child++;
+    if( !(buf[high[child]] < v) )
+      break;
+    high[i] = high[child];
+    hpos[high[i]] = fullwin+i;
+    i = child;
+  }
+  high[i] = ib;
+  hpos[ib] = fullwin+i;
+}
+
+void MedianSlider::rebalance ()
+{
+  if( nlow > nhigh+1 )
+  {
+    // move the largest low value to the high heap
+    uInt ib = low[0];
+    if( --nlow )
     {
-      if( dout<din )  // inserting larger value
-      {
-        uInt j=0;
-        // skip indices up to outgoing value
-        for( ; j<nind && index[j]!=ibuf0; j++ ) {}
-//        Assure(j<nind);
-        // move up indexes (up to incoming value)
-        for( j++; j<nind; j++ )
-          if( buf[ index[j] ] < din ) 
-            index[j-1] = index[j];
-          else
-            break;
-        // insert new index
-        index[j-1] = ibuf0;
-      } 
-      else if( dout>din )  // inserting smaller value
-      {   
-        uInt j=0;
-        // skip indices up to incoming value
-        for( ; j<nind && buf[index[j]]<din; j++ ) {}
-        int j0 = j;
-        // go forward to locate the outgoing value
-        for( ; j<nind && index[j]!=ibuf0; j++ ) {}
-//        Assure(j<nind);
-        // move down indices up to the outgoing value
-        if( j-j0 ) 
-          memmove(index+j0+1,index+j0,(j-j0)*sizeof(index[0]));
-        // insert new index
-        index[j0] = ibuf0;
-      }
-      // else if datums are equal, then no change -- fall thorugh
+      low[0] = low[nlow];
+      siftLow(0);
     }
-    else // A.2) replaced by an invalid datum
+    high[nhigh++] = ib;
+    siftHigh(nhigh-1);
+  }
+  else if( nhigh > nlow )
+  {
+    // move the smallest high value to the low heap
+    uInt ib = high[0];
+    if( --nhigh )
     {
-      uInt j=0;
-      // skip indices up to outgoing datum
-      for( ; j<nind && index[j]!=ibuf0; j++ ) {}
-//      Assure(j<nind);
-      // shift up remaining indices
-      if( nind-j-1 )
-        memmove(index+j,index+j+1,(nind-j-1)*sizeof(index[0]));
-      nind--;
+      high[0] = high[nhigh];
+      siftHigh(0);
     }
+    low[nlow++] = ib;
+    siftLow(nlow-1);
   }
-  else // B) invalid outgoing datum...
+}
+
+void MedianSlider::medianFilter ( Matrix<Float> &result,
+                                  const Matrix<Float> &data,
+                                  const Matrix<Bool> &flags, int halfwin )
+{
+  if( !flags.shape().isEqual(data.shape()) )
+    throw(AipsError("MedianSlider::medianFilter: data and flags have "
+                    "different shapes"));
+  result.resize(data.shape());
+  Int64 ntime = data.nrow();
+  Int64 nseries = data.ncolumn();
+  const Float *dataPtr = data.data();
+  const Bool *flagPtr = flags.data();
+  Float *resPtr = result.data();
+  size_t d0 = data.steps()[0], d1 = data.steps()[1];
+  size_t f0 = flags.steps()[0], f1 = flags.steps()[1];
+  size_t r0 = result.steps()[0], r1 = result.steps()[1];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (nseries > 1 && ntime*nseries > 16384)
+#endif
+  for( Int64 i=0; i<nseries; i++ )
   {
-    if( val_in ) // B.1) ...replaced by valid datum
+    MedianSlider slider(halfwin);
+    const Float *d = dataPtr + i*d1;
+    const Bool *f = flagPtr + i*f1;
+    Float *r = resPtr + i*r1;
+    // the median for time t is known when t+halfwin has been added
+    for( Int64 t=0; t<ntime+halfwin; t++ )
     {
-      uInt j=0;
-      // skip indices up to incoming value
-      for( ; j<nind && buf[index[j]]<din; j++ ) {}
-      // move down the remaining indices to make space
-      if( nind-j ) 
-        memmove(index+j+1,index+j,(nind-j)*sizeof(index[0]));
-      index[j] = ibuf0;
-      nind++;
+      Float med = ( t<ntime ? slider.add(d[t*d0],f[t*f0]) : slider.add() );
+      if( t >= halfwin )
+        r[(t-halfwin)*r0] = med;
     }
-    // else B.2) ...replaced by another invalid datum - so no change
   }
-  return median();
 }
 
 
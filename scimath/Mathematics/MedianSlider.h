@@ -30,6 +30,7 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -46,9 +47,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 // <synopsis>
 // MedianSlider is a class for efficient computing of sliding medians.
+//
+// The unflagged values in the window are kept in two binary heaps: a
+// max-heap holding the lower half of the values and a min-heap holding
+// the upper half. The tops of the heaps give the median. Adding a value
+// (which pushes out the oldest one) takes O(log(window size)) time.
+//
+// The static function <src>medianFilter</src> applies a sliding median
+// to many independent series (e.g. the time series of each channel and
+// baseline) in parallel.
 // </synopsis>
 //
 // <example>
+// <srcblock>
+//   // Sliding median over 21 time slots of each channel, where the data
+//   // are shaped [ntime,nchan].
+//   Matrix<Float> medians;
+//   MedianSlider::medianFilter (medians, data, flags, 10);
+// </srcblock>
 // </example>
 //
 // <motivation>
@@ -111,19 +127,40 @@ public:
 
 // returns total memory usage (in bytes) for a given halfwin size 
   static size_t objsize ( int halfwin )
-  { return sizeof(MedianSlider)+(sizeof(Float)+sizeof(uInt)+sizeof(Bool))*(halfwin*2+1); }
+  { return sizeof(MedianSlider)+(sizeof(Float)+3*sizeof(uInt)+sizeof(Bool))*(halfwin*2+1); }
+
+// Computes the sliding median of each column of data, thus the first
+// axis is the time axis. The median at each time is taken over the
+// unflagged values (flag False) within halfwin time slots; values
+// beyond the ends of a series are skipped. The median is 0 if the window
+// has no unflagged values. The result gets the shape of data.
+// The columns are processed in parallel.
+  static void medianFilter ( Matrix<Float> &result,
+                             const Matrix<Float> &data,
+                             const Matrix<Bool> &flags, int halfwin );
   
 // For testing purposes only: verifies current value of median.
 // Throws an exception if it fails.
   Bool  assure ();
 
 private:
+// Inserts or removes the value at the given buffer index in the heaps.
+  void insert    ( uInt ib );
+  void remove    ( uInt ib );
+// Restores the heap order after the element at heap position i changed.
+  void siftLow   ( uInt i );
+  void siftHigh  ( uInt i );
+// Moves the top element of one heap to the other if needed, so the low
+// heap has the same number or one more element than the high heap.
+  void rebalance ();
 
   uInt   halfwin,fullwin;
   Float *buf;
-  uInt  *index;
+  uInt  *low;     // max-heap of buffer indices of the lower values
+  uInt  *high;    // min-heap of buffer indices of the upper values
+  uInt  *hpos;    // heap position of a buffer index (+fullwin for high)
   Bool  *valid;
-  uInt   ibuf,nind;
+  uInt   ibuf,nlow,nhigh,nind;
   
 };
 
@@ -137,10 +174,8 @@ inline Float MedianSlider::median ()
 {
   if( !nind )
     return 0;
-  return nind%2 ? buf[ index[nind/2] ] 
-      : ( buf[ index[nind/2-1] ] + buf[ index[nind/2] ] )/2;
-//  return nind%2 ? buf[ index[nind/2] ] 
-//      : buf[ index[nind/2-1] ];
+  return nind%2 ? buf[ low[0] ] 
+      : ( buf[ low[0] ] + buf[ high[0] ] )/2;
 }
 
 inline Float MedianSlider::midpoint ( Bool &flag ) 
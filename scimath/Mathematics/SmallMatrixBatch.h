@@ -0,0 +1,150 @@
+//# SmallMatrixBatch.h: Linear algebra on batches of small fixed-size matrices
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef SCIMATH_SMALLMATRIXBATCH_H
+#define SCIMATH_SMALLMATRIXBATCH_H
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <cstddef>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+//    Linear algebra functions on batches of small fixed-size matrices.
+// </summary>
+//
+// <reviewed reviewer="" date="" tests="tSmallMatrixBatch">
+//
+// <prerequisite>
+//   <li> <linkto group="MatrixMathLA.h#Linear Algebra">Linear Algebra</linkto>
+// </prerequisite>
+//
+// <synopsis>
+// The functions in this group operate on a batch of <src>nmat</src> square
+// matrices of size <src>n x n</src>, where <src>n</src> is a template
+// parameter. The matrices are stored contiguously, each of them in
+// column-major (Fortran) order, so the storage of a
+// <src>Cube<T>(n,n,nmat)</src> can be passed directly. Vectors are stored
+// contiguously in the same way.
+//
+// Unlike <src>invert</src> and <src>determinate</src> in MatrixMathLA.h
+// and the <linkto class=SquareMatrix>SquareMatrix</linkto> class, these
+// functions do not allocate memory and do not call LAPACK; the size of the
+// matrices is known at compile time, so the loop over the batch contains
+// fully unrolled matrix operations which the compiler can vectorize. It
+// makes them suited to apply millions of 2x2 or 4x4 Jones or Mueller
+// matrices as needed in calibration.
+//
+// The output can be the same as an input (i.e., in-place operation is
+// possible), but the arrays should not partially overlap.
+//
+// Singular matrices (i.e., with a zero determinant or pivot) are not
+// considered to be an error. The functions inverting or solving return the
+// number of singular matrices in the batch and set the corresponding
+// output to zero.
+// </synopsis>
+//
+// <example>
+// Correct visibilities of baselines using per-antenna gains.
+// <srcblock>
+//   Cube<Complex> gains(2,2,nant);      // gain Jones matrix per antenna
+//   Cube<Complex> vis(2,2,nbl);         // visibility per baseline
+//   Vector<uInt> ant1(nbl), ant2(nbl);  // antennae of each baseline
+//   Cube<Complex> invGains(2,2,nant);
+//   batchInvert<Complex,2> (invGains.data(), gains.data(), nant);
+//   batchApplyJones<Complex,2> (vis.data(), invGains.data(),
+//                               ant1.data(), ant2.data(), vis.data(), nbl);
+// </srcblock>
+// </example>
+//
+// <motivation>
+// The Matrix based functions are far too slow when applied to many small
+// matrices, because of the heap allocations and the per-call overhead.
+// </motivation>
+//
+// <templating arg=T>
+//  <li> Float, Double, Complex or DComplex
+// </templating>
+//
+// <group name="Small Matrix Batch">
+
+// Matrix product <src>out[k] = a[k] * b[k]</src>.
+template<class T, Int n>
+void batchMultiply (T* out, const T* a, const T* b, size_t nmat);
+
+// Matrix product with the adjoint (conjugate transpose) of the second
+// matrix: <src>out[k] = a[k] * adjoint(b[k])</src>.
+template<class T, Int n>
+void batchMultiplyAdjoint (T* out, const T* a, const T* b, size_t nmat);
+
+// Apply Jones matrices to both sides of a matrix:
+// <src>out[k] = left[k] * in[k] * adjoint(right[k])</src>.
+// <br>The second version takes the Jones matrices from a table using
+// index arrays, e.g., a gain table per antenna indexed by the antennae of
+// the baselines: <src>out[k] = jones[ind1[k]] * in[k] *
+// adjoint(jones[ind2[k]])</src>.
+// <group>
+template<class T, Int n>
+void batchApplyJones (T* out, const T* left, const T* in, const T* right,
+		      size_t nmat);
+template<class T, Int n>
+void batchApplyJones (T* out, const T* jones,
+		      const uInt* ind1, const uInt* ind2,
+		      const T* in, size_t nmat);
+// </group>
+
+// Matrix-vector product <src>out[k] = a[k] * v[k]</src>.
+template<class T, Int n>
+void batchMultiplyVector (T* out, const T* a, const T* v, size_t nmat);
+
+// Determinant of each matrix.
+template<class T, Int n>
+void batchDeterminant (T* out, const T* a, size_t nmat);
+
+// Inverse of each matrix. 2x2 matrices are inverted directly, larger ones
+// using Gauss-Jordan elimination with partial pivoting.
+// It returns the number of singular matrices (which are set to zero).
+template<class T, Int n>
+size_t batchInvert (T* out, const T* a, size_t nmat);
+
+// Solve <src>a[k] * x[k] = b[k]</src> for the vectors <src>x[k]</src>
+// using Gaussian elimination with partial pivoting.
+// It returns the number of singular matrices (whose solutions are set to
+// zero).
+template<class T, Int n>
+size_t batchSolve (T* x, const T* a, const T* b, size_t nmat);
+
+// </group>
+
+
+} //# NAMESPACE CASACORE - END
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/scimath/Mathematics/SmallMatrixBatch.tcc>
+#endif //# CASACORE_NO_AUTO_TEMPLATES
+#endif
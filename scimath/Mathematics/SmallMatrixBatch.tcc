@@ -0,0 +1,302 @@
+//# SmallMatrixBatch.tcc: Linear algebra on batches of small fixed-size matrices
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef SCIMATH_SMALLMATRIXBATCH_TCC
+#define SCIMATH_SMALLMATRIXBATCH_TCC
+
+#include <casacore/scimath/Mathematics/SmallMatrixBatch.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <utility>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Kernels for a single matrix; the element (i,j) is at index i+j*n.
+//# The output must not be an input. The general versions use Gaussian
+//# elimination with partial pivoting on a local copy; they are specialized
+//# for 2x2 matrices using the explicit formulae.
+template<class T, Int n> struct SmallMatrixKernel
+{
+  static void mul (T* c, const T* a, const T* b)
+  {
+    for (Int j=0; j<n; ++j) {
+      for (Int i=0; i<n; ++i) {
+	T s = a[i] * b[j*n];
+	for (Int l=1; l<n; ++l) s += a[i+l*n] * b[l+j*n];
+	c[i+j*n] = s;
+      }
+    }
+  }
+  static void mulAdjoint (T* c, const T* a, const T* b)
+  {
+    for (Int j=0; j<n; ++j) {
+      for (Int i=0; i<n; ++i) {
+	T s = a[i] * std::conj(b[j]);
+	for (Int l=1; l<n; ++l) s += a[i+l*n] * std::conj(b[j+l*n]);
+	c[i+j*n] = s;
+      }
+    }
+  }
+  static void mulVector (T* c, const T* a, const T* v)
+  {
+    for (Int i=0; i<n; ++i) {
+      T s = a[i] * v[0];
+      for (Int l=1; l<n; ++l) s += a[i+l*n] * v[l];
+      c[i] = s;
+    }
+  }
+  // Reduce the matrix to upper triangular form (row operations are also
+  // applied to the nrhs right hand side columns in b).
+  // It returns False if the matrix is singular.
+  static Bool eliminate (T* m, T* b, Int nrhs, T& det)
+  {
+    det = T(1);
+    for (Int c=0; c<n; ++c) {
+      Int piv = c;
+      for (Int r=c+1; r<n; ++r) {
+	if (abs(m[r+c*n]) > abs(m[piv+c*n])) piv = r;
+      }
+      if (m[piv+c*n] == T(0)) {
+	det = T(0);
+	return False;
+      }
+      if (piv != c) {
+	det = -det;
+	for (Int l=c; l<n; ++l) std::swap (m[c+l*n], m[piv+l*n]);
+	for (Int l=0; l<nrhs; ++l) std::swap (b[c+l*n], b[piv+l*n]);
+      }
+      det *= m[c+c*n];
+      for (Int r=c+1; r<n; ++r) {
+	const T f = m[r+c*n] / m[c+c*n];
+	for (Int l=c+1; l<n; ++l) m[r+l*n] -= f * m[c+l*n];
+	for (Int l=0; l<nrhs; ++l) b[r+l*n] -= f * b[c+l*n];
+      }
+    }
+    return True;
+  }
+  // Back substitution of the nrhs columns in b (result in b).
+  static void backSubstitute (const T* m, T* b, Int nrhs)
+  {
+    for (Int l=0; l<nrhs; ++l) {
+      for (Int r=n-1; r>=0; --r) {
+	T s = b[r+l*n];
+	for (Int c=r+1; c<n; ++c) s -= m[r+c*n] * b[c+l*n];
+	b[r+l*n] = s / m[r+r*n];
+      }
+    }
+  }
+  static T determinant (const T* a)
+  {
+    T m[n*n];
+    for (Int i=0; i<n*n; ++i) m[i] = a[i];
+    T det;
+    eliminate (m, 0, 0, det);
+    return det;
+  }
+  static Bool invert (T* out, const T* a)
+  {
+    T m[n*n];
+    for (Int i=0; i<n*n; ++i) {
+      m[i] = a[i];
+      out[i] = T(0);
+    }
+    for (Int i=0; i<n; ++i) out[i+i*n] = T(1);
+    T det;
+    if (! eliminate (m, out, n, det)) {
+      for (Int i=0; i<n*n; ++i) out[i] = T(0);
+      return False;
+    }
+    backSubstitute (m, out, n);
+    return True;
+  }
+  static Bool solve (T* x, const T* a, const T* b)
+  {
+    T m[n*n];
+    for (Int i=0; i<n*n; ++i) m[i] = a[i];
+    for (Int i=0; i<n; ++i) x[i] = b[i];
+    T det;
+    if (! eliminate (m, x, 1, det)) {
+      for (Int i=0; i<n; ++i) x[i] = T(0);
+      return False;
+    }
+    backSubstitute (m, x, 1);
+    return True;
+  }
+};
+
+template<class T> struct SmallMatrixKernel<T,2>
+{
+  static void mul (T* c, const T* a, const T* b)
+  {
+    c[0] = a[0]*b[0] + a[2]*b[1];
+    c[1] = a[1]*b[0] + a[3]*b[1];
+    c[2] = a[0]*b[2] + a[2]*b[3];
+    c[3] = a[1]*b[2] + a[3]*b[3];
+  }
+  static void mulAdjoint (T* c, const T* a, const T* b)
+  {
+    const T b0 = std::conj(b[0]);
+    const T b1 = std::conj(b[1]);
+    const T b2 = std::conj(b[2]);
+    const T b3 = std::conj(b[3]);
+    c[0] = a[0]*b0 + a[2]*b2;
+    c[1] = a[1]*b0 + a[3]*b2;
+    c[2] = a[0]*b1 + a[2]*b3;
+    c[3] = a[1]*b1 + a[3]*b3;
+  }
+  static void mulVector (T* c, const T* a, const T* v)
+  {
+    c[0] = a[0]*v[0] + a[2]*v[1];
+    c[1] = a[1]*v[0] + a[3]*v[1];
+  }
+  static T determinant (const T* a)
+    { return a[0]*a[3] - a[2]*a[1]; }
+  static Bool invert (T* out, const T* a)
+  {
+    const T det = determinant (a);
+    if (det == T(0)) {
+      out[0] = out[1] = out[2] = out[3] = T(0);
+      return False;
+    }
+    const T a0 = a[0];
+    out[0] = a[3] / det;
+    out[1] = -a[1] / det;
+    out[2] = -a[2] / det;
+    out[3] = a0 / det;
+    return True;
+  }
+  static Bool solve (T* x, const T* a, const T* b)
+  {
+    const T det = determinant (a);
+    if (det == T(0)) {
+      x[0] = x[1] = T(0);
+      return False;
+    }
+    const T x0 = (a[3]*b[0] - a[2]*b[1]) / det;
+    x[1] = (a[0]*b[1] - a[1]*b[0]) / det;
+    x[0] = x0;
+    return True;
+  }
+};
+
+
+template<class T, Int n>
+void batchMultiply (T* out, const T* a, const T* b, size_t nmat)
+{
+  const Int nn = n*n;
+  T tmp[nn];
+  for (size_t k=0; k<nmat; ++k) {
+    SmallMatrixKernel<T,n>::mul (tmp, a+k*nn, b+k*nn);
+    for (Int i=0; i<nn; ++i) out[k*nn+i] = tmp[i];
+  }
+}
+
+template<class T, Int n>
+void batchMultiplyAdjoint (T* out, const T* a, const T* b, size_t nmat)
+{
+  const Int nn = n*n;
+  T tmp[nn];
+  for (size_t k=0; k<nmat; ++k) {
+    SmallMatrixKernel<T,n>::mulAdjoint (tmp, a+k*nn, b+k*nn);
+    for (Int i=0; i<nn; ++i) out[k*nn+i] = tmp[i];
+  }
+}
+
+template<class T, Int n>
+void batchApplyJones (T* out, const T* left, const T* in, const T* right,
+		      size_t nmat)
+{
+  const Int nn = n*n;
+  T tmp[nn];
+  T res[nn];
+  for (size_t k=0; k<nmat; ++k) {
+    SmallMatrixKernel<T,n>::mul (tmp, left+k*nn, in+k*nn);
+    SmallMatrixKernel<T,n>::mulAdjoint (res, tmp, right+k*nn);
+    for (Int i=0; i<nn; ++i) out[k*nn+i] = res[i];
+  }
+}
+
+template<class T, Int n>
+void batchApplyJones (T* out, const T* jones,
+		      const uInt* ind1, const uInt* ind2,
+		      const T* in, size_t nmat)
+{
+  const Int nn = n*n;
+  T tmp[nn];
+  T res[nn];
+  for (size_t k=0; k<nmat; ++k) {
+    SmallMatrixKernel<T,n>::mul (tmp, jones+size_t(ind1[k])*nn, in+k*nn);
+    SmallMatrixKernel<T,n>::mulAdjoint (res, tmp, jones+size_t(ind2[k])*nn);
+    for (Int i=0; i<nn; ++i) out[k*nn+i] = res[i];
+  }
+}
+
+template<class T, Int n>
+void batchMultiplyVector (T* out, const T* a, const T* v, size_t nmat)
+{
+  T tmp[n];
+  for (size_t k=0; k<nmat; ++k) {
+    SmallMatrixKernel<T,n>::mulVector (tmp, a+k*n*n, v+k*n);
+    for (Int i=0; i<n; ++i) out[k*n+i] = tmp[i];
+  }
+}
+
+template<class T, Int n>
+void batchDeterminant (T* out, const T* a, size_t nmat)
+{
+  for (size_t k=0; k<nmat; ++k) {
+    out[k] = SmallMatrixKernel<T,n>::determinant (a+k*n*n);
+  }
+}
+
+template<class T, Int n>
+size_t batchInvert (T* out, const T* a, size_t nmat)
+{
+  const Int nn = n*n;
+  T tmp[nn];
+  size_t nsing = 0;
+  for (size_t k=0; k<nmat; ++k) {
+    if (! SmallMatrixKernel<T,n>::invert (tmp, a+k*nn)) ++nsing;
+    for (Int i=0; i<nn; ++i) out[k*nn+i] = tmp[i];
+  }
+  return nsing;
+}
+
+template<class T, Int n>
+size_t batchSolve (T* x, const T* a, const T* b, size_t nmat)
+{
+  T tmp[n];
+  size_t nsing = 0;
+  for (size_t k=0; k<nmat; ++k) {
+    if (! SmallMatrixKernel<T,n>::solve (tmp, a+k*n*n, b+k*n)) ++nsing;
+    for (Int i=0; i<n; ++i) x[k*n+i] = tmp[i];
+  }
+  return nsing;
+}
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
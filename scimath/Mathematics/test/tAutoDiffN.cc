@@ -0,0 +1,141 @@
+//# tAutoDiffN.cc: Test program for class AutoDiffN
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/scimath/Mathematics/AutoDiffN.h>
+#include <casacore/scimath/Mathematics/AutoDiffNMath.h>
+#include <casacore/scimath/Mathematics/AutoDiff.h>
+#include <casacore/scimath/Mathematics/AutoDiffMath.h>
+#include <casacore/scimath/Functionals/Gaussian1D.h>
+#include <casacore/scimath/Functionals/Polynomial.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+typedef AutoDiffN<Double,3> ADN;
+
+// Check value and derivatives against an AutoDiff.
+void check (const ADN& res, const AutoDiff<Double>& exp)
+{
+  AlwaysAssertExit (nearAbs (res.value(), exp.value(), 1e-12));
+  AlwaysAssertExit (exp.nDerivatives() == 3);
+  AlwaysAssertExit (allNearAbs (res.derivatives(), exp.derivatives(), 1e-12));
+}
+
+void testMath()
+{
+  ADN x(0.3, 3, 0), y(0.7, 3, 1), z(1.9, 3, 2);
+  AutoDiff<Double> xa(0.3, 3, 0), ya(0.7, 3, 1), za(1.9, 3, 2);
+  AlwaysAssertExit (x.nDerivatives() == 3);
+  check (x, xa);
+  check (ADN(xa), xa);
+  check (ADN(0.3, xa.derivatives()), xa);
+  check (ADN(xa), x.autoDiff());
+  check (x*y + z, xa*ya + za);
+  check (x/y - z, xa/ya - za);
+  check (-x + 2.0*y - z/3.0, -xa + 2.0*ya - za/3.0);
+  check (1.0/x - 2.0 + y*4.0 + (1.0 - z), 1.0/xa - 2.0 + ya*4.0 + (1.0 - za));
+  check (sin(x*y) + cos(z) + tan(x), sin(xa*ya) + cos(za) + tan(xa));
+  check (asin(x) + acos(y) + atan(z), asin(xa) + acos(ya) + atan(za));
+  check (atan2(x, -z), atan2(xa, -za));
+  check (sinh(x) + cosh(y) + tanh(z), sinh(xa) + cosh(ya) + tanh(za));
+  check (exp(x*y) + log(z) + log10(y), exp(xa*ya) + log(za) + log10(ya));
+  check (erf(x) + erfc(z), erf(xa) + erfc(za));
+  check (sqrt(x*z) + pow(y, 2.5) + pow(z, x), sqrt(xa*za) + pow(ya, 2.5)
+         + pow(za, xa));
+  check (abs(x - z) + fmod(z, 0.5) + floor(z) + ceil(x), abs(xa - za)
+         + fmod(za, 0.5) + floor(za) + ceil(xa));
+  check (min(x, y) * max(y, z), min(xa, ya) * max(ya, za));
+  // Square and cube against the explicit products.
+  check (square(y) + cube(z), ya*ya + za*za*za);
+  // In-place operators.
+  ADN r(x);
+  AutoDiff<Double> ra(xa);
+  r += y; r -= z; r *= x; r /= y; r += 1.5; r -= 0.5; r *= 3.0; r /= 4.0;
+  ra += ya; ra -= za; ra *= xa; ra /= ya; ra += 1.5; ra -= 0.5; ra *= 3.0;
+  ra /= 4.0;
+  check (r, ra);
+  // Comparisons only use the value.
+  AlwaysAssertExit (x < y  &&  y <= z  &&  z > 1.0  &&  0.3 == x
+                    &&  x != y  &&  ADN(0.3) == x);
+  AlwaysAssertExit (near (x, ADN(0.3))  &&  !isNaN(x)  &&  !isInf(x));
+  // The number of derivatives has to match.
+  Bool failed = False;
+  try {
+    ADN w(1.0, 2, 0);
+  } catch (const AipsError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+void testFunctions()
+{
+  // A Gaussian with AutoDiffN parameters gives the same derivatives as the
+  // specialized AutoDiff implementation.
+  Gaussian1D<AutoDiff<Double> > gauss(AutoDiff<Double>(5, 3, 0),
+                                      AutoDiff<Double>(2, 3, 1),
+                                      AutoDiff<Double>(3, 3, 2));
+  Gaussian1D<ADN> gaussN(ADN(5, 3, 0), ADN(2, 3, 1), ADN(3, 3, 2));
+  AlwaysAssertExit (gaussN.nparameters() == 3);
+  for (Double x=-3; x<8; x+=0.7) {
+    check (gaussN(x), gauss(x));
+  }
+  // Conversion from and to a plain Function.
+  Gaussian1D<Double> gaussD(gaussN);
+  AlwaysAssertExit (near (gaussD(2.5), gaussN(2.5).value()));
+  Gaussian1D<ADN> gaussN2(gaussD);
+  for (uInt i=0; i<3; ++i) {
+    AlwaysAssertExit (gaussN2[i].deriv(i) == 1);
+  }
+  check (gaussN2(1.5), gauss(1.5));
+  // A polynomial of order 2.
+  Polynomial<AutoDiff<Double> > poly(2);
+  Polynomial<ADN> polyN(2);
+  for (uInt i=0; i<3; ++i) {
+    poly[i] = AutoDiff<Double>(i+1., 3, i);
+    polyN[i] = ADN(i+1., 3, i);
+  }
+  for (Double x=-3; x<8; x+=0.7) {
+    check (polyN(x), poly(x));
+  }
+}
+
+int main()
+{
+  try {
+    testMath();
+    testFunctions();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
@@ -0,0 +1,113 @@
+//# tConvolveGridder.cc: Test program for ConvolveGridder
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/scimath/Mathematics/ConvolveGridder.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Make pseudo-random positions, some of them off the grid.
+Matrix<Double> makePositions (uInt nval, Double size)
+{
+  Matrix<Double> pos(2, nval);
+  uInt val = 17;
+  for (uInt i=0; i<nval; i++) {
+    for (uInt j=0; j<2; j++) {
+      val = val*1103515245 + 12345;
+      pos(j,i) = ((val>>8) % 100000) / 100000. * size - size/2;
+    }
+  }
+  return pos;
+}
+
+template<typename T>
+void testGrid (const String& convType, const Vector<T>& values)
+{
+  IPosition shape(2, 300, 200);
+  Vector<Double> scale(2), offset(2);
+  scale(0) = 2.;
+  scale(1) = -1.5;
+  offset(0) = 150.;
+  offset(1) = 100.;
+  uInt nval = values.nelements();
+  Matrix<Double> positions = makePositions (nval, 160.);
+  // Grid one by one and all at once.
+  ConvolveGridder<Double,T> gridder1(shape, scale, offset, convType);
+  ConvolveGridder<Double,T> gridder2(shape, scale, offset, convType);
+  Array<T> grid1(shape, T(0));
+  Array<T> grid2(shape, T(0));
+  uInt nr1 = 0;
+  Vector<Int> loc(2);
+  for (uInt i=0; i<nval; i++) {
+    // Only grid if on the grid to avoid messages.
+    Vector<Double> pos(positions.column(i));
+    gridder1.location (loc, pos);
+    if (gridder1.onGrid (loc, gridder1.cSupport())) {
+      AlwaysAssertExit (gridder1.grid (grid1, pos, values(i)));
+      nr1++;
+    }
+  }
+  uInt nr2 = gridder2.gridMany (grid2, positions, values);
+  AlwaysAssertExit (nr1 == nr2);
+  AlwaysAssertExit (nr2 > nval/2  &&  nr2 < nval);
+  AlwaysAssertExit (allNearAbs (grid1, grid2, 1e-3));
+  // Degrid the grid again.
+  Vector<T> res1(nval, T(-1));
+  Vector<T> res2(nval, T(-1));
+  for (uInt i=0; i<nval; i++) {
+    Vector<Double> pos(positions.column(i));
+    gridder1.degrid (grid1, pos, res1(i));
+  }
+  AlwaysAssertExit (gridder2.degridMany (grid1, positions, res2) == nr1);
+  AlwaysAssertExit (allNearAbs (res1, res2, 1e-3));
+}
+
+int main()
+{
+  try {
+    uInt nval = 20000;
+    Vector<Float> fvalues(nval);
+    Vector<Complex> cvalues(nval);
+    for (uInt i=0; i<nval; i++) {
+      fvalues(i) = 1 + i%7;
+      cvalues(i) = Complex(1 + i%7, Float(i%5) - 2);
+    }
+    testGrid ("SF", fvalues);
+    testGrid ("SF", cvalues);
+    testGrid ("BOX", cvalues);
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "ok" << endl;
+  return 0;
+}
@@ -424,6 +424,37 @@ int main() {
 	 << endl;
     if (failed) anyFailures = True;
   }
+  {
+    Bool failed = False;
+    //    Test that the (parallel) convolution of many planes gives the
+    //    same result as convolving each plane separately
+    Matrix<Double> psf(6,5);
+    indgen(psf);
+    psf = sin(psf);
+    Cube<Double> mod(6,5,7);
+    indgen(mod);
+    mod = cos(mod);
+    Convolver<Double> conv(psf, mod.shape().getFirst(2));
+    Cube<Double> linResult, circResult;
+    conv.linearConv(linResult, mod);
+    conv.circularConv(circResult, mod);
+    for (uInt k = 0; k < mod.nplane(); k++) {
+      Matrix<Double> plane(mod.xyPlane(k));
+      Matrix<Double> linPlane, circPlane;
+      conv.linearConv(linPlane, plane);
+      conv.circularConv(circPlane, plane);
+      if (!allNearAbs(linPlane, linResult.xyPlane(k), 1.E-10) ||
+	  !allNearAbs(circPlane, circResult.xyPlane(k), 1.E-10)) {
+	failed = True;
+      }
+    }
+    if (failed)
+      cout << "Failed";
+    else
+      cout << "Passed";
+    cout << " the Multiple Plane Convolution Test" << endl;
+    if (failed) anyFailures = True;
+  }
   {
 	  Bool failed = False;
 	 if (! doLinearConv()) {
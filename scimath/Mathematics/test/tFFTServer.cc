@@ -34,6 +34,7 @@
 #include <casacore/casa/Arrays/Cube.h>
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/VectorIter.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Arrays/IPosition.h>
@@ -1374,6 +1375,54 @@ public:
   }
 };
 
+template <class T, class S>
+class TestFFTAxis
+{
+public:
+  TestFFTAxis()  // test the complex->complex fft of all lines along an axis
+  {
+    FFTServer<T, S> server;
+    FFTServer<T, S> lineServer;
+    const T epsilon = 1000 * FLT_EPSILON;
+    Cube<S> data(5, 6, 4);
+    for (size_t i = 0; i < data.nelements(); ++i) {
+      data.data()[i] = S(T(i%7), T(i%3) - T(1));
+    }
+    for (uInt axis = 0; axis < 3; ++axis) {
+      for (int toFreq = 0; toFreq < 2; ++toFreq) {
+        // Compare with the 1-dim transform of each line.
+        Array<S> expected = data.copy();
+        Array<S> expected0 = data.copy();
+        VectorIterator<S> iter(expected, axis);
+        VectorIterator<S> iter0(expected0, axis);
+        while (!iter.pastEnd()) {
+          lineServer.fft(iter.vector(), toFreq);
+          lineServer.fft0(iter0.vector(), toFreq);
+          iter.next();
+          iter0.next();
+        }
+        Array<S> result = data.copy();
+        server.fftAxis(result, axis, toFreq);
+        AlwaysTrue(allNearAbs(result, expected, epsilon), AipsError);
+        result = data;
+        server.fft0Axis(result, axis, toFreq);
+        AlwaysTrue(allNearAbs(result, expected0, epsilon), AipsError);
+      }
+    }
+    // A forward and backward transform gives the original data.
+    Array<S> result = data.copy();
+    server.fftAxis(result, 1, True);
+    server.fftAxis(result, 1, False);
+    AlwaysTrue(allNearAbs(result, data, epsilon), AipsError);
+    // A non-contiguous array.
+    Array<S> sub = result(IPosition(3,1,0,0), IPosition(3,3,5,3));
+    Array<S> expected = sub.copy();
+    server.fft0Axis(expected, 2, True);
+    server.fft0Axis(sub, 2, True);
+    AlwaysTrue(allNearAbs(sub, expected, epsilon), AipsError);
+  }
+};
+
 template <class T, class S>
 class TestFFTShift
 {
@@ -2278,6 +2327,7 @@ void run_tests()
     TestC2C<S, C2C4Doddoddoddeven2, T, S> c2c21(server, 500*FLT_EPSILON, 2*FLT_EPSILON);
 
     TestFFTShift<T, S> ();
+    TestFFTAxis<T, S> ();
 
     return;
 }
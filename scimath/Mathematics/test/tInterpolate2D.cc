@@ -27,6 +27,7 @@
 #include <casacore/scimath/Mathematics/Interpolate2D.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <vector>
 #include <string>
@@ -114,6 +115,96 @@ int main() {
             AlwaysAssert(ok, AipsError);
             AlwaysAssert(near(result_dc, cresults[method]), AipsError);
         }
+
+        // Interpolate many coordinates at once (including ones outside
+        // the data and masked ones) and compare with single interpolations.
+        Matrix<Bool> mask(10,10, True);
+        mask(5,5) = False;
+        std::vector<Double> xs, ys;
+        for (Double x=-1.2; x<10.5; x+=0.37) {
+          for (Double y=-0.8; y<10.5; y+=0.91) {
+            xs.push_back(x);
+            ys.push_back(y);
+          }
+        }
+        uInt n = xs.size();
+        for (uInt method=0; method<methods.size(); ++method) {
+          Interpolate2D myInterp(Interpolate2D::stringToMethod(methods[method]));
+          for (uInt useMask=0; useMask<2; ++useMask) {
+            const Matrix<Bool>* maskPtr = (useMask ? &mask : 0);
+            std::vector<Float> res_f(n);
+            std::vector<Complex> res_c(n);
+            Block<Bool> valid_f(n), valid_c(n);
+            myInterp.interp (res_f.data(), valid_f.storage(), xs.data(),
+                             ys.data(), n, matt_f, maskPtr);
+            myInterp.interp (res_c.data(), valid_c.storage(), xs.data(),
+                             ys.data(), n, matt_c, maskPtr);
+            for (uInt k=0; k<n; ++k) {
+              where(0) = xs[k];
+              where(1) = ys[k];
+              Float result_f;
+              Complex result_c;
+              if (useMask) {
+                ok = myInterp.interp(result_f, where, matt_f, mask);
+              } else {
+                ok = myInterp.interp(result_f, where, matt_f);
+              }
+              AlwaysAssert(ok == valid_f[k], AipsError);
+              AlwaysAssert(!ok  ||  result_f == res_f[k], AipsError);
+              if (useMask) {
+                ok = myInterp.interp(result_c, where, matt_c, mask);
+              } else {
+                ok = myInterp.interp(result_c, where, matt_c);
+              }
+              AlwaysAssert(ok == valid_c[k], AipsError);
+              AlwaysAssert(!ok  ||  result_c == res_c[k], AipsError);
+            }
+          }
+        }
+
+        // Many coordinates on a larger matrix, so they are interpolated
+        // in parallel if OpenMP is used.
+        Matrix<Float> big(40,30);
+        Matrix<Bool> bigMask(40,30, True);
+        for (uInt i=0; i<40; ++i) {
+          for (uInt j=0; j<30; ++j) {
+            big(i,j) = sin(0.3*i) * cos(0.2*j) + 0.01*i*j;
+          }
+        }
+        bigMask(20,12) = False;
+        bigMask(3,27) = False;
+        xs.clear();
+        ys.clear();
+        for (Double x=-0.9; x<40.5; x+=0.31) {
+          for (Double y=-0.7; y<30.5; y+=0.43) {
+            xs.push_back(x);
+            ys.push_back(y);
+          }
+        }
+        n = xs.size();
+        AlwaysAssert(n > 4096, AipsError);
+        for (uInt method=0; method<methods.size(); ++method) {
+          Interpolate2D myInterp(Interpolate2D::stringToMethod(methods[method]));
+          for (uInt useMask=0; useMask<2; ++useMask) {
+            const Matrix<Bool>* maskPtr = (useMask ? &bigMask : 0);
+            std::vector<Float> res_f(n);
+            Block<Bool> valid_f(n);
+            myInterp.interp (res_f.data(), valid_f.storage(), xs.data(),
+                             ys.data(), n, big, maskPtr);
+            for (uInt k=0; k<n; ++k) {
+              where(0) = xs[k];
+              where(1) = ys[k];
+              Float result_f;
+              if (useMask) {
+                ok = myInterp.interp(result_f, where, big, bigMask);
+              } else {
+                ok = myInterp.interp(result_f, where, big);
+              }
+              AlwaysAssert(ok == valid_f[k], AipsError);
+              AlwaysAssert(!ok  ||  result_f == res_f[k], AipsError);
+            }
+          }
+        }
     }
     catch (const std::exception& x) {
         cout << x.what() << endl;
@@ -34,6 +34,7 @@
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Arrays/IPosition.h>
@@ -274,6 +275,62 @@ public:
 };
 
 
+template <class T, class S>
+class TestCubicSplineInterpolation
+{
+public:
+  // Interpolate the rows of a matrix. The matrix is large enough to
+  // make the interpolation run in parallel if OpenMP is used.
+  TestCubicSplineInterpolation(Double tol)
+  {
+    Int nx(12), ny(300), n(240);
+    Vector<T> xin(nx), xout(n);
+    for (Int i=0; i<nx; ++i) {
+      xin[i] = 1.5*i + 0.1*i*i;
+    }
+    for (Int i=0; i<n; ++i) {
+      xout[i] = -1 + i*(xin[nx-1] + 2)/n;
+    }
+    // Cubic polynomials are reproduced by cubic interpolation and
+    // straight lines by spline interpolation.
+    Matrix<S> ycub(ny, nx), ylin(ny, nx);
+    for (Int i=0; i<nx; ++i) {
+      for (Int j=0; j<ny; ++j) {
+        ycub(j,i) = cubic(j, xin[i]);
+        ylin(j,i) = S(j + 0.5*xin[i]);
+      }
+    }
+    Matrix<S> rcub, rlin;
+    InterpolateArray1D<T,S>::interpolate(rcub, xout, xin, ycub,
+                                         InterpolateArray1D<T,S>::cubic);
+    InterpolateArray1D<T,S>::interpolate(rlin, xout, xin, ylin,
+                                         InterpolateArray1D<T,S>::spline);
+    AlwaysTrue(rcub.shape() == IPosition(2, ny, n), AipsError);
+    AlwaysTrue(rlin.shape() == IPosition(2, ny, n), AipsError);
+    for (Int i=0; i<n; ++i) {
+      for (Int j=0; j<ny; ++j) {
+        AlwaysAssert(nearAbs(rcub(j,i), cubic(j, xout[i]), tol), AipsError);
+        AlwaysAssert(nearAbs(rlin(j,i), S(j + 0.5*xout[i]), tol), AipsError);
+      }
+    }
+    // Interpolating a single row gives the same result.
+    Vector<S> row;
+    InterpolateArray1D<T,S>::interpolate(row, xout, xin,
+                                         Vector<S>(ycub.row(7)),
+                                         InterpolateArray1D<T,S>::cubic);
+    AlwaysTrue(allEQ(row, Vector<S>(rcub.row(7))), AipsError);
+    InterpolateArray1D<T,S>::interpolate(row, xout, xin,
+                                         Vector<S>(ylin.row(7)),
+                                         InterpolateArray1D<T,S>::spline);
+    AlwaysTrue(allEQ(row, Vector<S>(rlin.row(7))), AipsError);
+  }
+
+  static S cubic(Int j, Double x)
+  {
+    return S(0.01*j + 0.5*x - 0.02*x*x + 0.001*(j%10)*x*x*x);
+  }
+};
+
 
 
 
@@ -311,6 +368,11 @@ int main()
       cout << "Testing 'nearestNeighbour' Double/Float, ascending/descending" << endl;
       run_nearest_tests<Double,Float>();
 
+      cout << "Testing 'cubic' and 'spline' Double/Double" << endl;
+      TestCubicSplineInterpolation<Double,Double> (1e-8);
+      cout << "Testing 'cubic' and 'spline' Float/Complex" << endl;
+      TestCubicSplineInterpolation<Float,Complex> (1e-3);
+
   }
   catch (std::exception& x) {
     cerr << x.what() << endl;
@@ -27,11 +27,69 @@
 
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/scimath/Mathematics/MedianSlider.h>
 
 #include <casacore/casa/namespace.h>
+
+// Brute-force median of the unflagged values in [t-halfwin,t+halfwin].
+Float bruteMedian (const Float* data, const Bool* flags, Int ntime,
+                   Int t, Int halfwin)
+{
+  Vector<Float> vals(2*halfwin+1);
+  uInt n = 0;
+  for (Int i=t-halfwin; i<=t+halfwin; i++) {
+    if (i >= 0  &&  i < ntime  &&  !flags[i]) {
+      vals[n++] = data[i];
+    }
+  }
+  if (n == 0) {
+    return 0;
+  }
+  GenSort<Float>::sort (vals.data(), n);
+  return n%2 ? vals[n/2] : (vals[n/2-1] + vals[n/2]) / 2;
+}
+
+// Compare the batched median filter with a brute-force median.
+void testMedianFilter()
+{
+  const Int ntime = 300;
+  const Int nseries = 80;
+  const Int halfwin = 25;
+  Matrix<Float> data(ntime, nseries);
+  Matrix<Bool> flags(ntime, nseries);
+  uInt val = 1;
+  for (Int j=0; j<nseries; j++) {
+    for (Int i=0; i<ntime; i++) {
+      val = val*1103515245 + 12345;
+      // use a coarse grid of values to get many duplicates
+      data(i,j) = Float((val>>16) % 97);
+      val = val*1103515245 + 12345;
+      flags(i,j) = (val>>16) % 4 == 0;
+    }
+  }
+  // flag an entire window of the first series
+  for (Int i=100; i<200; i++) {
+    flags(i,0) = True;
+  }
+  Matrix<Float> result;
+  MedianSlider::medianFilter (result, data, flags, halfwin);
+  AlwaysAssertExit (result.shape().isEqual (data.shape()));
+  for (Int j=0; j<nseries; j++) {
+    Vector<Float> dcol(data.column(j));
+    Vector<Bool> fcol(flags.column(j));
+    for (Int i=0; i<ntime; i++) {
+      AlwaysAssertExit (result(i,j) == bruteMedian (dcol.data(), fcol.data(),
+                                                    ntime, i, halfwin));
+    }
+  }
+  cout << "\nmedianFilter agrees with the brute-force median" << endl;
+}
+
 int main(){
   MedianSlider me;
   cout << "Create a MedianSlider me by means of call to MedianSlider () with default arguments" << endl;
@@ -132,5 +190,7 @@ int main(){
   cout << "Add vl2 to m1, old values are pushed out" << endl;
   cout << "The number of non-flagged values in m1 window is " << m1.nval() << endl;
   cout << "Current median value in m1 window is " << m1.median() << endl;
+
+  testMedianFilter();
   return 0;
 }
@@ -0,0 +1,162 @@
+//# tSmallMatrixBatch.cc: Test the batched small matrix functions
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/scimath/Mathematics/SmallMatrixBatch.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/MatrixMath.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Fill a cube with deterministic pseudo-random values.
+template<class T> void fill (Cube<T>& cube, Int seed)
+{
+  T* p = cube.data();
+  for (size_t i=0; i<cube.nelements(); ++i) {
+    p[i] = T((i*7 + seed) % 13) - T(6) + T(0.25) * T(i%3);
+  }
+}
+void fill (Cube<Complex>& cube, Int seed)
+{
+  Complex* p = cube.data();
+  for (size_t i=0; i<cube.nelements(); ++i) {
+    p[i] = Complex(Float((i*7 + seed) % 13) - 6, Float((i*5 + seed) % 11) - 5);
+  }
+}
+void fill (Cube<DComplex>& cube, Int seed)
+{
+  DComplex* p = cube.data();
+  for (size_t i=0; i<cube.nelements(); ++i) {
+    p[i] = DComplex(Double((i*7 + seed) % 13) - 6,
+		    Double((i*5 + seed) % 11) - 5);
+  }
+}
+
+template<class T, Int n> void doTest (Double tol)
+{
+  const size_t nmat = 37;
+  Cube<T> a(n,n,nmat), b(n,n,nmat), c(n,n,nmat), out(n,n,nmat);
+  fill (a, 1);
+  fill (b, 2);
+  fill (c, 3);
+  // Make the matrices well-conditioned.
+  for (size_t k=0; k<nmat; ++k) {
+    for (Int i=0; i<n; ++i) a(i,i,k) += T(20);
+  }
+  Matrix<T> v(n,nmat), vout(n,nmat);
+  T* vp = v.data();
+  for (size_t i=0; i<v.nelements(); ++i) vp[i] = T(i%5) - T(2);
+  Vector<T> det(nmat);
+  Vector<uInt> ind1(nmat), ind2(nmat);
+  for (size_t k=0; k<nmat; ++k) {
+    ind1[k] = (k*3) % nmat;
+    ind2[k] = (k*5 + 1) % nmat;
+  }
+  // Products.
+  batchMultiply<T,n> (out.data(), a.data(), b.data(), nmat);
+  for (size_t k=0; k<nmat; ++k) {
+    AlwaysAssertExit (allNearAbs (Matrix<T>(out.xyPlane(k)),
+				  product (a.xyPlane(k), b.xyPlane(k)), tol));
+  }
+  batchMultiplyAdjoint<T,n> (out.data(), a.data(), b.data(), nmat);
+  for (size_t k=0; k<nmat; ++k) {
+    AlwaysAssertExit (allNearAbs (Matrix<T>(out.xyPlane(k)),
+				  product (a.xyPlane(k),
+					   adjoint(Matrix<T>(b.xyPlane(k)))),
+				  tol));
+  }
+  batchApplyJones<T,n> (out.data(), a.data(), b.data(), c.data(), nmat);
+  for (size_t k=0; k<nmat; ++k) {
+    Matrix<T> exp = product (product (a.xyPlane(k), b.xyPlane(k)),
+			     adjoint(Matrix<T>(c.xyPlane(k))));
+    AlwaysAssertExit (allNearAbs (Matrix<T>(out.xyPlane(k)), exp, tol));
+  }
+  // In-place using a Jones table and index arrays.
+  out = b;
+  batchApplyJones<T,n> (out.data(), a.data(), ind1.data(), ind2.data(),
+			out.data(), nmat);
+  for (size_t k=0; k<nmat; ++k) {
+    Matrix<T> exp = product (product (a.xyPlane(ind1[k]), b.xyPlane(k)),
+			     adjoint(Matrix<T>(a.xyPlane(ind2[k]))));
+    AlwaysAssertExit (allNearAbs (Matrix<T>(out.xyPlane(k)), exp, tol));
+  }
+  batchMultiplyVector<T,n> (vout.data(), a.data(), v.data(), nmat);
+  for (size_t k=0; k<nmat; ++k) {
+    AlwaysAssertExit (allNearAbs (vout.column(k),
+				  product (a.xyPlane(k), v.column(k)), tol));
+  }
+  // Inverse and determinant; make one matrix singular.
+  a.xyPlane(5) = T(1);
+  batchDeterminant<T,n> (det.data(), a.data(), nmat);
+  AlwaysAssertExit (near (det[5], T(0)));
+  size_t nsing = batchInvert<T,n> (out.data(), a.data(), nmat);
+  AlwaysAssertExit (nsing == 1);
+  AlwaysAssertExit (allEQ (out.xyPlane(5), T(0)));
+  Matrix<T> ident(n,n, T(0));
+  ident.diagonal() = T(1);
+  for (size_t k=0; k<nmat; ++k) {
+    if (k != 5) {
+      AlwaysAssertExit (allNearAbs (product (a.xyPlane(k), out.xyPlane(k)),
+				    ident, tol));
+      // det(A) * det(inv(A)) = 1
+      T dinv;
+      batchDeterminant<T,n> (&dinv, out.xyPlane(k).data(), 1);
+      AlwaysAssertExit (nearAbs (det[k] * dinv, T(1), tol));
+    }
+  }
+  // Solve in place.
+  vout = v;
+  nsing = batchSolve<T,n> (vout.data(), a.data(), vout.data(), nmat);
+  AlwaysAssertExit (nsing == 1);
+  AlwaysAssertExit (allEQ (vout.column(5), T(0)));
+  for (size_t k=0; k<nmat; ++k) {
+    if (k != 5) {
+      AlwaysAssertExit (allNearAbs (product (a.xyPlane(k), vout.column(k)),
+				    v.column(k), tol));
+    }
+  }
+}
+
+int main()
+{
+  try {
+    doTest<Float,2> (1e-4);
+    doTest<Double,3> (1e-10);
+    doTest<Complex,2> (1e-3);
+    doTest<DComplex,2> (1e-10);
+    doTest<DComplex,4> (1e-10);
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
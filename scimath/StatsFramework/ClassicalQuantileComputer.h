@@ -28,6 +28,7 @@
 
 #include <casacore/scimath/StatsFramework/StatisticsAlgorithmQuantileComputer.h>
 
+#include <casacore/scimath/StatsFramework/QuantileSketch.h>
 #include <casacore/scimath/StatsFramework/StatisticsUtilities.h>
 
 #include <casacore/casa/aips.h>
@@ -436,6 +437,10 @@ private:
         const typename StatisticsDataset<CASA_STATP>::ChunkData& chunk
     );
 
+    // Create a QuantileSketch of the complete data set with the error given
+    // by getQuantileError(). The data set is scanned once (in parallel).
+    QuantileSketch<AccumType> _createSketch();
+
     // Create an unsorted array of the complete data set. If
     // <src>includeLimits</src> is specified, only points within those limits
     // (including min but excluding max, as per definition of bins), are
@@ -467,6 +467,69 @@ void ClassicalQuantileComputer<CASA_STATP>::_createDataArray(DataArray& ary) {
     }
 }
 
+CASA_STATD QuantileSketch<AccumType>
+ClassicalQuantileComputer<CASA_STATP>::_createSketch() {
+    auto* ds = this->_getDataset();
+    ds->initIterators();
+    const auto nThreadsMax = StatisticsUtilities<AccumType>::nThreadsMax(
+        ds->getDataProvider()
+    );
+    // Each thread collects the good data of a block in an array, which is
+    // added to the thread's sketch. Thus the memory used is bounded.
+    std::unique_ptr<DataArray[]> tAry(
+        new DataArray[ClassicalStatisticsData::CACHE_PADDING*nThreadsMax]
+    );
+    std::vector<QuantileSketch<AccumType>> tSketch(
+        ClassicalStatisticsData::CACHE_PADDING*nThreadsMax,
+        QuantileSketch<AccumType>(this->getQuantileError())
+    );
+    while (True) {
+        const auto& chunk = ds->initLoopVars();
+        uInt nBlocks, nthreads;
+        uInt64 extra;
+        std::unique_ptr<DataIterator[]> dataIter;
+        std::unique_ptr<MaskIterator[]> maskIter;
+        std::unique_ptr<WeightsIterator[]> weightsIter;
+        std::unique_ptr<uInt64[]> offset;
+        ds->initThreadVars(
+            nBlocks, extra, nthreads, dataIter,
+            maskIter, weightsIter, offset, nThreadsMax
+        );
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads)
+#endif
+        for (uInt i=0; i<nBlocks; ++i) {
+            uInt idx8 = StatisticsUtilities<AccumType>::threadIdx();
+            uInt64 dataCount = (chunk.count - offset[idx8])
+                < ClassicalStatisticsData::BLOCK_SIZE
+                ? extra : ClassicalStatisticsData::BLOCK_SIZE;
+            auto& ary = tAry[idx8];
+            ary.clear();
+            _computeDataArray(
+                ary, dataIter[idx8], maskIter[idx8],
+                weightsIter[idx8], dataCount, chunk
+            );
+            auto& sketch = tSketch[idx8];
+            for (const auto& v : ary) {
+                sketch.add(v);
+            }
+            ds->incrementThreadIters(
+                dataIter[idx8], maskIter[idx8], weightsIter[idx8],
+                offset[idx8], nthreads
+            );
+        }
+        if (ds->increment(False)) {
+            break;
+        }
+    }
+    // merge the per-thread sketches
+    auto& sketch = tSketch[0];
+    for (uInt tid=1; tid<nThreadsMax; ++tid) {
+        sketch.merge(tSketch[ClassicalStatisticsData::CACHE_PADDING*tid]);
+    }
+    return sketch;
+}
+
 CASA_STATD
 void ClassicalQuantileComputer<CASA_STATP>::_computeDataArray(
     DataArray& ary, DataIterator dataIter, MaskIterator maskIter,
@@ -876,30 +939,18 @@ ClassicalQuantileComputer<CASA_STATP>::_dataFromSingleBins(
             );
             ++iNpts;
         });
-        iNpts = binNpts.begin();
+        // select the values in each array; large arrays are done in parallel
         std::vector<IndexValueMap> ivMaps(binLimits.size());
-        typename std::vector<IndexValueMap>::iterator iIVMaps = ivMaps.begin();
+        auto iIVMaps = ivMaps.begin();
         auto iArrays = dataArrays.begin();
         for_each (
             dataIndices.cbegin(), dataIndices.cend(),
-            [&iIVMaps, &iNpts, &iArrays](const IndexSet& idxSet) {
-            uInt64 prevIdx = 0;
-            for_each(
-                idxSet.cbegin(), idxSet.cend(),
-                [&iNpts, &iIVMaps, &iArrays, &prevIdx](uInt64 idx) {
-                ThrowIf(
-                    idx >= *iNpts,
-                    "Logic Error: aryIdx " + String::toString(idx) + " is too "
-                    "large. It should be no larger than "
-                    + String::toString(*iNpts-1) + ". Please file a defect "
-                    + "report and include your dataset and your inputs"
-                );
-                (*iIVMaps)[idx] = GenSort<AccumType>::kthLargest(
-                    &((*iArrays)[prevIdx]), *iNpts - prevIdx, idx - prevIdx
+            [&iIVMaps, &iArrays](const IndexSet& idxSet) {
+            if (! idxSet.empty()) {
+                *iIVMaps = StatisticsUtilities<AccumType>::indicesToValues(
+                    *iArrays, idxSet
                 );
-                prevIdx = idx;
-            });
-            ++iNpts;
+            }
             ++iArrays;
             ++iIVMaps;
         });
@@ -908,8 +959,14 @@ ClassicalQuantileComputer<CASA_STATP>::_dataFromSingleBins(
     else {
         // number of points is too large to fit in an array to be sorted, so
         // rebin those points into smaller bins
-        // we want at least 1000 bins
-        nBins = max(nBins, (uInt)1000);
+        // we want at least 1000 bins. Use more bins if needed to make it
+        // likely that the bins containing the indices are small enough to be
+        // sorted after this pass, which saves passes through the data. The
+        // factor 10 allows for the data being concentrated around the
+        // quantiles; the number of bins is limited to bound the memory used
+        // for the bin counts of all threads.
+        uInt64 wanted = std::min(10*(totalPts/maxArraySize + 1), uInt64(100000));
+        nBins = max(nBins, max((uInt)wanted, (uInt)1000));
         std::vector<StatsHistogram<AccumType>> hist;
         for_each(
             binLimits.cbegin(), binLimits.cend(),
@@ -936,6 +993,26 @@ ClassicalQuantileComputer<CASA_STATP>::_indicesToValues(
     uInt64 mynpts, AccumType mymin, AccumType mymax, uInt64 maxArraySize,
     const IndexSet& indices, Bool persistSortedArray, uInt nBins
 ) {
+    if (this->getQuantileError() > 0) {
+        // Approximate the values using a sketch. The indices are scaled in
+        // case the sketch counted another number of points than given.
+        auto sketch = _createSketch();
+        ThrowIf(sketch.count() == 0, "No valid data found");
+        std::map<uInt64, uInt64> sketchIndex;
+        IndexSet sketchIndices;
+        for (auto idx : indices) {
+            auto sidx = sketch.count() == mynpts
+                ? idx : uInt64(Double(idx) * sketch.count() / mynpts);
+            sketchIndex[idx] = std::min(sidx, sketch.count() - 1);
+            sketchIndices.insert(sketchIndex[idx]);
+        }
+        auto values = sketch.valuesAtIndices(sketchIndices);
+        IndexValueMap indexToValue;
+        for (auto idx : indices) {
+            indexToValue[idx] = values[sketchIndex[idx]];
+        }
+        return indexToValue;
+    }
     IndexValueMap indexToValue;
     if (
         _valuesFromSortedArray(
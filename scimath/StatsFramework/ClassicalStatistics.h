@@ -222,6 +222,24 @@ public:
         _qComputer = qc;
     }
 
+    // Compute quantile-like statistics (median, quantiles, medabsdevmed)
+    // approximately with the given maximum error in the rank of the values,
+    // given as a fraction of the number of points (eg 0.001). The data set is
+    // scanned once per quantile-like statistic using memory independent of its
+    // size, where the scan is done in parallel. The default 0 means that they
+    // are computed exactly. It should be called before any statistics are
+    // computed. Purposefully non-virtual. Derived classes should not
+    // implement.
+    // <group>
+    void setQuantileError(Double error) {
+        _qComputer->setQuantileError(error);
+    }
+
+    Double getQuantileError() const {
+        return _qComputer->getQuantileError();
+    }
+    // </group>
+
     virtual void setStatsToCalculate(std::set<StatisticsData::STATS>& stats);
 
 protected:
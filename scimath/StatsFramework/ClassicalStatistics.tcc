@@ -1649,6 +1649,16 @@ void ClassicalStatistics<CASA_STATP>::_unweightedStats(
     StatsData<AccumType>& stats, uInt64& ngood, LocationType& location,
     const DataIterator& dataBegin, uInt64 nr, uInt dataStride
 ) {
+    if (
+        dataStride == 1
+        && StatisticsUtilities<AccumType>::accumulateContiguous(
+            stats, ngood, dataBegin, (const Bool*)nullptr,
+            (const AccumType*)nullptr, nr, location, _doMaxMin
+        )
+    ) {
+        location.second += nr;
+        return;
+    }
     auto datum = dataBegin;
     uInt64 count = 0;
     while (count < nr) {
@@ -1689,6 +1699,16 @@ void ClassicalStatistics<CASA_STATP>::_unweightedStats(
     const DataIterator& dataBegin, uInt64 nr, uInt dataStride,
     const MaskIterator& maskBegin, uInt maskStride
 ) {
+    if (
+        dataStride == 1 && maskStride == 1
+        && StatisticsUtilities<AccumType>::accumulateContiguous(
+            stats, ngood, dataBegin, maskBegin, (const AccumType*)nullptr,
+            nr, location, _doMaxMin
+        )
+    ) {
+        location.second += nr;
+        return;
+    }
     auto datum = dataBegin;
     auto mask = maskBegin;
     uInt64 count = 0;
@@ -1738,6 +1758,17 @@ void ClassicalStatistics<CASA_STATP>::_weightedStats(
     const DataIterator& dataBegin, const WeightsIterator& weightsBegin,
     uInt64 nr, uInt dataStride
 ) {
+    uInt64 ngood = 0;
+    if (
+        dataStride == 1
+        && StatisticsUtilities<AccumType>::accumulateContiguous(
+            stats, ngood, dataBegin, (const Bool*)nullptr, weightsBegin, nr,
+            location, _doMaxMin
+        )
+    ) {
+        location.second += nr;
+        return;
+    }
     auto datum = dataBegin;
     auto weight = weightsBegin;
     uInt64 count = 0;
@@ -1814,6 +1845,17 @@ void ClassicalStatistics<CASA_STATP>::_weightedStats(
     const DataIterator& dataBegin, const WeightsIterator& weightBegin,
     uInt64 nr, uInt dataStride, const MaskIterator& maskBegin, uInt maskStride
 ) {
+    uInt64 ngood = 0;
+    if (
+        dataStride == 1 && maskStride == 1
+        && StatisticsUtilities<AccumType>::accumulateContiguous(
+            stats, ngood, dataBegin, maskBegin, weightBegin, nr, location,
+            _doMaxMin
+        )
+    ) {
+        location.second += nr;
+        return;
+    }
     auto datum = dataBegin;
     auto weight = weightBegin;
     auto mask = maskBegin;
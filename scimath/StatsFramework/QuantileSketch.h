@@ -0,0 +1,129 @@
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+
+#ifndef SCIMATH_QUANTILESKETCH_H
+#define SCIMATH_QUANTILESKETCH_H
+
+#include <casacore/casa/aips.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace casacore {
+
+// Streaming sketch to compute approximate quantiles of a data set in a single
+// pass using bounded memory. It is a KLL sketch (Karnin, Lang and Liberty,
+// 2016), which keeps a hierarchy of compactors. Level h holds values each
+// representing 2^h values of the data set. When a level is full, it is sorted
+// and every other value is promoted to the next level. The capacity of a level
+// decreases by a factor 2/3 for each lower level, so the number of values
+// kept is about three times the capacity of the top level.
+//
+// The sketch is constructed with the maximum error in the rank of a value,
+// given as a fraction of the number of values in the data set. For example,
+// an error of 0.001 means that the value returned for the median has a rank
+// between 0.499*N and 0.501*N. The error is an upper bound achieved with
+// very high probability; in practice the error is usually much smaller. The
+// memory used is inversely proportional to the error, but independent of the
+// size of the data set. Data sets smaller than the capacity of the lowest
+// level are kept completely, so their quantiles are exact.
+//
+// Sketches of subsets of the data can be merged, so the subsets can be
+// processed in parallel. The promotion is done in a deterministic way, so the
+// results are reproducible for a given order of adding and merging.
+
+template <class AccumType> class QuantileSketch {
+public:
+
+    // Construct an empty sketch with the given maximum relative rank error,
+    // which must be between 0 and 1 (exclusive).
+    explicit QuantileSketch(Double error=0.001);
+
+    ~QuantileSketch();
+
+    // add a value to the data set
+    void add(const AccumType& value) {
+        _levels[0].push_back(value);
+        ++_count;
+        if (++_size >= _maxSize) {
+            _compress();
+        }
+    }
+
+    // merge another sketch into this one. The sketches should have the same
+    // error, otherwise the error of this sketch is used.
+    void merge(const QuantileSketch<AccumType>& other);
+
+    // the number of values added to the data set
+    uInt64 count() const { return _count; }
+
+    // the maximum relative rank error given at construction
+    Double error() const { return _error; }
+
+    // the number of values kept in the sketch
+    uInt64 size() const { return _size; }
+
+    // get the (approximate) values at the specified indices of the sorted
+    // data set. An exception is thrown if the data set is empty.
+    std::map<uInt64, AccumType> valuesAtIndices(
+        const std::set<uInt64>& indices
+    ) const;
+
+    // get the (approximate) value at the specified fraction of the sorted
+    // data set, eg 0.5 for the median.
+    AccumType quantile(Double fraction) const;
+
+    // clear the data set
+    void reset();
+
+private:
+    Double _error;
+    // capacity of the top level
+    uInt _k;
+    uInt64 _count{0}, _size{0}, _maxSize{0};
+    std::vector<std::vector<AccumType>> _levels{};
+    // start of the values to promote per level; it alternates between
+    // 0 and 1 to avoid a bias
+    std::vector<Bool> _offset{};
+
+    // the capacity of the given level
+    uInt _capacity(uInt level) const;
+
+    // add a level and update the maximum size
+    void _addLevel();
+
+    // compact the lowest full levels until the size is below the maximum
+    void _compress();
+
+};
+
+}
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/scimath/StatsFramework/QuantileSketch.tcc>
+#endif
+
+#endif
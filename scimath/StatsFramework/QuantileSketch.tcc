@@ -0,0 +1,188 @@
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+
+#ifndef SCIMATH_QUANTILESKETCH_TCC
+#define SCIMATH_QUANTILESKETCH_TCC
+
+#include <casacore/scimath/StatsFramework/QuantileSketch.h>
+
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Exceptions/Error.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace casacore {
+
+// The rank error of a KLL sketch is about this factor divided by the capacity
+// of the top level. It was determined empirically with a safety margin.
+const Double QuantileSketchErrorFactor = 2.0;
+
+template <class AccumType>
+QuantileSketch<AccumType>::QuantileSketch(Double error)
+  : _error(error) {
+    ThrowIf(
+        error <= 0 || error >= 1,
+        "QuantileSketch error " + String::toString(error)
+        + " must be between 0 and 1"
+    );
+    _k = std::max(uInt(8), uInt(std::ceil(QuantileSketchErrorFactor/error)));
+    _addLevel();
+}
+
+template <class AccumType>
+QuantileSketch<AccumType>::~QuantileSketch() {}
+
+template <class AccumType>
+uInt QuantileSketch<AccumType>::_capacity(uInt level) const {
+    uInt depth = _levels.size() - 1 - level;
+    return std::max(uInt(2), uInt(std::ceil(_k * std::pow(2./3., depth))));
+}
+
+template <class AccumType>
+void QuantileSketch<AccumType>::_addLevel() {
+    _levels.push_back(std::vector<AccumType>());
+    _offset.push_back(False);
+    _maxSize = 0;
+    for (uInt i=0; i<_levels.size(); ++i) {
+        _maxSize += _capacity(i);
+    }
+}
+
+template <class AccumType>
+void QuantileSketch<AccumType>::_compress() {
+    while (_size >= _maxSize) {
+        // If the total size exceeds the total capacity, at least one level
+        // must be full. Compact the lowest one.
+        for (uInt h=0; h<_levels.size(); ++h) {
+            if (_levels[h].size() >= _capacity(h)) {
+                if (h+1 == _levels.size()) {
+                    _addLevel();
+                }
+                auto& level = _levels[h];
+                auto& next = _levels[h+1];
+                std::sort(level.begin(), level.end());
+                auto n = level.size();
+                auto npair = n/2*2;
+                for (size_t i=_offset[h] ? 1 : 0; i<npair; i+=2) {
+                    next.push_back(level[i]);
+                }
+                _offset[h] = ! _offset[h];
+                // an odd value (the largest) stays in this level
+                if (n > npair) {
+                    level[0] = level[n-1];
+                    level.resize(1);
+                }
+                else {
+                    level.clear();
+                }
+                _size -= npair/2;
+                break;
+            }
+        }
+    }
+}
+
+template <class AccumType>
+void QuantileSketch<AccumType>::merge(const QuantileSketch<AccumType>& other) {
+    if (other._count == 0) {
+        return;
+    }
+    while (_levels.size() < other._levels.size()) {
+        _addLevel();
+    }
+    for (uInt h=0; h<other._levels.size(); ++h) {
+        const auto& from = other._levels[h];
+        _levels[h].insert(_levels[h].end(), from.begin(), from.end());
+    }
+    _count += other._count;
+    _size += other._size;
+    _compress();
+}
+
+template <class AccumType>
+std::map<uInt64, AccumType> QuantileSketch<AccumType>::valuesAtIndices(
+    const std::set<uInt64>& indices
+) const {
+    ThrowIf(_count == 0, "No valid data found");
+    // sort all values kept, where a value in level h has weight 2^h
+    std::vector<std::pair<AccumType, uInt64>> weighted;
+    weighted.reserve(_size);
+    for (uInt h=0; h<_levels.size(); ++h) {
+        uInt64 weight = uInt64(1) << h;
+        for (const auto& v : _levels[h]) {
+            weighted.push_back(std::make_pair(v, weight));
+        }
+    }
+    std::sort(
+        weighted.begin(), weighted.end(),
+        [](const std::pair<AccumType, uInt64>& a,
+           const std::pair<AccumType, uInt64>& b) {
+            return a.first < b.first;
+        }
+    );
+    // The value at an index is the first one whose cumulative weight
+    // exceeds the index. The indices are in ascending order.
+    std::map<uInt64, AccumType> values;
+    auto iter = weighted.cbegin();
+    auto last = weighted.cend() - 1;
+    uInt64 cumWeight = iter->second;
+    for (auto idx : indices) {
+        while (cumWeight <= idx && iter != last) {
+            ++iter;
+            cumWeight += iter->second;
+        }
+        values[idx] = iter->first;
+    }
+    return values;
+}
+
+template <class AccumType>
+AccumType QuantileSketch<AccumType>::quantile(Double fraction) const {
+    ThrowIf(
+        fraction < 0 || fraction > 1,
+        "Quantile fraction must be between 0 and 1"
+    );
+    ThrowIf(_count == 0, "No valid data found");
+    uInt64 idx = std::min(_count - 1, uInt64(fraction*_count));
+    std::set<uInt64> indices;
+    indices.insert(idx);
+    return valuesAtIndices(indices)[idx];
+}
+
+template <class AccumType>
+void QuantileSketch<AccumType>::reset() {
+    _count = 0;
+    _size = 0;
+    _levels.clear();
+    _offset.clear();
+    _addLevel();
+}
+
+}
+
+#endif
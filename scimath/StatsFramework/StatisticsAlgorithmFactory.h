@@ -74,6 +74,13 @@ public:
     // configure to use Chauvenet's criterion
     void configureChauvenet(Double zscore=-1, Int maxIterations=-1);
 
+    // Set the maximum relative rank error of quantile-like statistics computed
+    // by the created algorithm objects. The default 0 means that they are
+    // computed exactly. See ClassicalStatistics::setQuantileError().
+    void setQuantileError(Double error);
+
+    Double quantileError() const { return _quantileError; }
+
     // copy the data from this object to an object with different template
     // types. Note that the AccumType of <src>other</src> must be the same as
     // the AccumType of this object.
@@ -122,6 +129,7 @@ private:
     StatisticsAlgorithmFactoryData::BiweightData _biweightData;
     StatisticsAlgorithmFactoryData::FitToHalfData<AccumType> _fitToHalfData;
     StatisticsAlgorithmFactoryData::ChauvenetData _chauvData;
+    Double _quantileError{0};
 
 };
 
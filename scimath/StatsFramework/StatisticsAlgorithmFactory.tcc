@@ -83,6 +83,16 @@ CASA_STATD void StatisticsAlgorithmFactory<CASA_STATP>::configureChauvenet(
     _chauvData.maxIter= maxIterations;
 }
 
+CASA_STATD
+void StatisticsAlgorithmFactory<CASA_STATP>::setQuantileError(Double error) {
+    ThrowIf(
+        error < 0 || error >= 1,
+        "Quantile error " + String::toString(error)
+        + " must be between 0 (exact) and 1"
+    );
+    _quantileError = error;
+}
+
 CASA_STATD
 template <class DataIterator2, class MaskIterator2, class WeightsIterator2>
 void StatisticsAlgorithmFactory<CASA_STATP>::copy(
@@ -95,36 +105,47 @@ void StatisticsAlgorithmFactory<CASA_STATP>::copy(
     other._chauvData = _chauvData;
     other._fitToHalfData = _fitToHalfData;
     other._biweightData = _biweightData;
+    other._quantileError = _quantileError;
 }
 
 CASA_STATD std::shared_ptr<StatisticsAlgorithm<CASA_STATP>>
 StatisticsAlgorithmFactory<CASA_STATP>::createStatsAlgorithm() const {
+    std::shared_ptr<ClassicalStatistics<CASA_STATP>> sa;
     switch (_algorithm) {
     case StatisticsData::BIWEIGHT:
-        return std::make_shared<BiweightStatistics<CASA_STATP>>(
+        sa = std::make_shared<BiweightStatistics<CASA_STATP>>(
             _biweightData.maxIter, _biweightData.c
         );
+        break;
     case StatisticsData::CLASSICAL:
-        return std::make_shared<ClassicalStatistics<CASA_STATP>>();
+        sa = std::make_shared<ClassicalStatistics<CASA_STATP>>();
+        break;
     case StatisticsData::HINGESFENCES: {
-        return std::make_shared<HingesFencesStatistics<CASA_STATP>>(_hf);
+        sa = std::make_shared<HingesFencesStatistics<CASA_STATP>>(_hf);
+        break;
     }
     case StatisticsData::FITTOHALF: {
-        return std::make_shared<FitToHalfStatistics<CASA_STATP>>(
+        sa = std::make_shared<FitToHalfStatistics<CASA_STATP>>(
             _fitToHalfData.center, _fitToHalfData.side,
             _fitToHalfData.centerValue
         );
+        break;
     }
     case StatisticsData::CHAUVENETCRITERION: {
-        return std::make_shared<ChauvenetCriterionStatistics<CASA_STATP>>(
+        sa = std::make_shared<ChauvenetCriterionStatistics<CASA_STATP>>(
             _chauvData.zScore, _chauvData.maxIter
         );
+        break;
     }
     default:
         ThrowCc(
             "Logic Error: Unhandled algorithm " + String::toString(_algorithm)
         );
     }
+    if (_quantileError > 0) {
+        sa->setQuantileError(_quantileError);
+    }
+    return sa;
 }
 
 CASA_STATD StatisticsAlgorithmFactoryData::BiweightData
@@ -167,6 +188,9 @@ StatisticsAlgorithmFactory<CASA_STATP>::chauvenetData() const {
 CASA_STATD Record StatisticsAlgorithmFactory<CASA_STATP>::toRecord() const {
     Record r;
     r.define("algorithm", _algorithm);
+    if (_quantileError > 0) {
+        r.define("quantile_error", _quantileError);
+    }
     switch (_algorithm) {
     case StatisticsData::BIWEIGHT:
         r.define("max_iter", _biweightData.maxIter);
@@ -235,6 +259,9 @@ StatisticsAlgorithmFactory<CASA_STATP>::fromRecord(const Record& r) {
         ThrowCc("Unsupported type for field 'algorithm'");
     }
     StatisticsAlgorithmFactory<CASA_STATP> saf;
+    if (r.isDefined("quantile_error")) {
+        saf.setQuantileError(r.asDouble("quantile_error"));
+    }
     switch (algorithm) {
     case StatisticsData::BIWEIGHT: {
         ThrowIf(! r.isDefined("c"), "field 'c' is not defined");
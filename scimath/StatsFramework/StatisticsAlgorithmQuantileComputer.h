@@ -71,6 +71,14 @@ public:
 
     void setMedian(std::shared_ptr<AccumType> median) { _median = std::move(median); }
 
+    // Set the maximum relative rank error of quantile-like statistics. The
+    // default 0 means that they are computed exactly. Otherwise they are
+    // computed approximately in a single pass using bounded memory (see
+    // QuantileSketch). Derived classes not supporting it ignore the error.
+    void setQuantileError(Double error);
+
+    Double getQuantileError() const { return _quantileError; }
+
 protected:
 
     // ds should be the dataset object held in the StatisticsAlgorithm object.
@@ -118,6 +126,7 @@ private:
     // so this should not be wrapped in a smart pointer.
     StatisticsDataset<CASA_STATP>* _dataset{nullptr};
     std::shared_ptr<AccumType> _median{}, _medAbsDevMed{};
+    Double _quantileError{0};
 
 };
 
@@ -28,6 +28,9 @@
 
 #include <casacore/scimath/StatsFramework/StatisticsAlgorithmQuantileComputer.h>
 
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Exceptions/Error.h>
+
 namespace casacore {
 
 CASA_STATD StatisticsAlgorithmQuantileComputer<CASA_STATP>
@@ -46,7 +49,7 @@ CASA_STATD StatisticsAlgorithmQuantileComputer<CASA_STATP>
     _median(other._median ? new AccumType(*other._median) : nullptr),
     _medAbsDevMed(
         other._medAbsDevMed ? new AccumType(*other._medAbsDevMed) : nullptr
-    ) {}
+    ), _quantileError(other._quantileError) {}
 
 CASA_STATD StatisticsAlgorithmQuantileComputer<CASA_STATP>&
 StatisticsAlgorithmQuantileComputer<CASA_STATP>::operator=(
@@ -63,6 +66,7 @@ StatisticsAlgorithmQuantileComputer<CASA_STATP>::operator=(
      _medAbsDevMed.reset(
          other._medAbsDevMed ? new AccumType(*other._medAbsDevMed) : nullptr
      );
+     _quantileError = other._quantileError;
      return *this;
 }
 
@@ -71,6 +75,24 @@ void StatisticsAlgorithmQuantileComputer<CASA_STATP>::deleteSortedArray() {
     _sortedArray.clear();
 }
 
+CASA_STATD
+void StatisticsAlgorithmQuantileComputer<CASA_STATP>::setQuantileError(
+    Double error
+) {
+    ThrowIf(
+        error < 0 || error >= 1,
+        "Quantile error " + String::toString(error)
+        + " must be between 0 (exact) and 1"
+    );
+    if (error != _quantileError) {
+        _quantileError = error;
+        // quantiles computed before are not valid anymore
+        _sortedArray.clear();
+        _median.reset();
+        _medAbsDevMed.reset();
+    }
+}
+
 CASA_STATD void StatisticsAlgorithmQuantileComputer<CASA_STATP>::reset() {
     _sortedArray.clear();
     _median.reset();
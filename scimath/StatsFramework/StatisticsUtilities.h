@@ -118,6 +118,38 @@ public:
 	);
 	// </group>
 
+	// <group>
+	// Accumulate the statistics of <src>n</src> contiguous data values in
+	// <src>stats</src>, skipping values having a False mask or a weight that
+	// is not positive. A null mask or weights pointer means that all values
+	// are used; if the weights pointer is null, the unweighted statistics are
+	// accumulated and <src>stats.sumweights</src> is not updated. The
+	// number of values accumulated is added to <src>ngood</src>. Max and min
+	// (and their positions) are only accumulated if <src>doMaxMin</src> is
+	// True, where <src>location</src> is the location of the first value.
+	// <br>The values are handled in blocks. The sums of a block are computed
+	// using several independent partial sums, so the compiler can use SIMD
+	// instructions, and are merged into the running statistics using the
+	// pairwise update formulae of Chan et al. This is faster than
+	// accumulating the values one by one and has smaller rounding errors.
+	// <br>The generic iterator version does nothing and returns False,
+	// meaning that the caller has to accumulate the values one by one. The
+	// version for pointers returns True.
+	template <class DataIterator, class MaskIterator, class WeightsIterator>
+	static Bool accumulateContiguous(
+	    StatsData<AccumType>& stats, uInt64& ngood, DataIterator data,
+	    MaskIterator mask, WeightsIterator weights, uInt64 n,
+	    const LocationType& location, Bool doMaxMin
+	);
+
+	template <class DataType, class MaskType, class WeightsType>
+	static Bool accumulateContiguous(
+	    StatsData<AccumType>& stats, uInt64& ngood, DataType* data,
+	    MaskType* mask, WeightsType* weights, uInt64 n,
+	    const LocationType& location, Bool doMaxMin
+	);
+	// </group>
+
 	// <group>
 	// return True if the max or min was updated, False otherwise.
 	template <class LocationType>
@@ -182,6 +214,8 @@ public:
 
     // The array can be changed by partially sorting it up to the largest index.
 	// Return a map of index to value in the sorted array.
+	// The values are found by selection (std::nth_element), where a large
+	// array is scanned in parallel.
     static std::map<uInt64, AccumType> indicesToValues(
         std::vector<AccumType>& myArray, const std::set<uInt64>& indices
     );
@@ -216,6 +250,35 @@ private:
 
 	const static AccumType TWO;
 
+    // Arrays having at least this number of elements are selected in
+    // parallel if multiple threads can be used.
+    static const uInt64 _PARALLEL_SELECT_SIZE = 1000000;
+
+    // Comparison used for selection; it makes the casacore comparison
+    // operators of complex values visible to the std algorithms.
+    static Bool _less(const AccumType& a, const AccumType& b)
+        { return a < b; }
+
+    // Find the values at the (sorted) indices <src>[iIdx,eIdx)</src> of the
+    // sorted array by recursively selecting the middle index and
+    // partitioning the array around it. Both parts are handled as
+    // separate OpenMP tasks if large enough.
+    static void _multiSelect(
+        AccumType* first, AccumType* last, uInt64 offset,
+        const uInt64* iIdx, const uInt64* eIdx, AccumType* values
+    );
+
+    // Find the value at index <src>k</src> of the sorted array without
+    // changing it. A sample of the array gives a narrow value range that
+    // should contain the value; a parallel scan counts the values below
+    // that range and collects the values in it, after which only the
+    // collected values need to be selected. False is returned if the range
+    // turns out not to contain the value.
+    static Bool _parallelSelect(
+        AccumType& value, const std::vector<AccumType>& myArray, uInt64 k,
+        uInt nthreads
+    );
+
 };
 
 }
@@ -32,6 +32,7 @@
 #include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/scimath/StatsFramework/ClassicalStatisticsData.h>
 
+#include <algorithm>
 #include <iostream>
 
 namespace casacore {
@@ -144,6 +145,178 @@ void StatisticsUtilities<AccumType>::waccumulate (
 	_MAXMIN
 }
 
+template <class AccumType>
+template <class DataIterator, class MaskIterator, class WeightsIterator>
+Bool StatisticsUtilities<AccumType>::accumulateContiguous(
+    StatsData<AccumType>&, uInt64&, DataIterator, MaskIterator,
+    WeightsIterator, uInt64, const LocationType&, Bool
+) {
+    return False;
+}
+
+template <class AccumType>
+template <class DataType, class MaskType, class WeightsType>
+Bool StatisticsUtilities<AccumType>::accumulateContiguous(
+    StatsData<AccumType>& stats, uInt64& ngood, DataType* data,
+    MaskType* mask, WeightsType* weights, uInt64 n,
+    const LocationType& location, Bool doMaxMin
+) {
+    // the block size is small enough to keep the block in the L1 cache
+    static const uInt64 blockSize = 1024;
+    static const uInt nLanes = 4;
+    static const AccumType zero = 0;
+    AccumType vals[blockSize];
+    AccumType wts[blockSize];
+    uInt64 index[blockSize];
+    for (uInt64 start=0; start<n; start+=blockSize) {
+        const uInt64 end = std::min(n, start + blockSize);
+        // gather the values to be used (and their weights)
+        uInt64 nb = 0;
+        if (mask || weights) {
+            for (uInt64 i=start; i<end; ++i) {
+                if ((! mask || mask[i]) && (! weights || weights[i] > 0)) {
+                    vals[nb] = data[i];
+                    if (weights) {
+                        wts[nb] = weights[i];
+                    }
+                    index[nb] = i;
+                    ++nb;
+                }
+            }
+            if (nb == 0) {
+                continue;
+            }
+        }
+        else {
+            nb = end - start;
+            for (uInt64 k=0; k<nb; ++k) {
+                vals[k] = data[start + k];
+                index[k] = start + k;
+            }
+        }
+        // sums of the block using independent partial sums
+        AccumType lsumw[nLanes], lsum[nLanes], lsumsq[nLanes];
+        for (uInt j=0; j<nLanes; ++j) {
+            lsumw[j] = lsum[j] = lsumsq[j] = zero;
+        }
+        const uInt64 nbl = nb - nb%nLanes;
+        if (weights) {
+            for (uInt64 k=0; k<nbl; k+=nLanes) {
+                for (uInt j=0; j<nLanes; ++j) {
+                    AccumType wx = wts[k+j]*vals[k+j];
+                    lsumw[j] += wts[k+j];
+                    lsum[j] += wx;
+                    lsumsq[j] += wx*vals[k+j];
+                }
+            }
+            for (uInt64 k=nbl; k<nb; ++k) {
+                AccumType wx = wts[k]*vals[k];
+                lsumw[0] += wts[k];
+                lsum[0] += wx;
+                lsumsq[0] += wx*vals[k];
+            }
+        }
+        else {
+            for (uInt64 k=0; k<nbl; k+=nLanes) {
+                for (uInt j=0; j<nLanes; ++j) {
+                    lsum[j] += vals[k+j];
+                    lsumsq[j] += vals[k+j]*vals[k+j];
+                }
+            }
+            for (uInt64 k=nbl; k<nb; ++k) {
+                lsum[0] += vals[k];
+                lsumsq[0] += vals[k]*vals[k];
+            }
+            lsumw[0] = AccumType(Double(nb));
+        }
+        AccumType bsumw = (lsumw[0] + lsumw[1]) + (lsumw[2] + lsumw[3]);
+        AccumType bsum = (lsum[0] + lsum[1]) + (lsum[2] + lsum[3]);
+        AccumType bsumsq = (lsumsq[0] + lsumsq[1]) + (lsumsq[2] + lsumsq[3]);
+        // the sum of squared deviations from the block mean
+        AccumType bmean = bsum/bsumw;
+        AccumType lnvar[nLanes];
+        for (uInt j=0; j<nLanes; ++j) {
+            lnvar[j] = zero;
+        }
+        if (weights) {
+            for (uInt64 k=0; k<nbl; k+=nLanes) {
+                for (uInt j=0; j<nLanes; ++j) {
+                    AccumType diff = vals[k+j] - bmean;
+                    lnvar[j] += wts[k+j]*diff*diff;
+                }
+            }
+            for (uInt64 k=nbl; k<nb; ++k) {
+                AccumType diff = vals[k] - bmean;
+                lnvar[0] += wts[k]*diff*diff;
+            }
+        }
+        else {
+            for (uInt64 k=0; k<nbl; k+=nLanes) {
+                for (uInt j=0; j<nLanes; ++j) {
+                    AccumType diff = vals[k+j] - bmean;
+                    lnvar[j] += diff*diff;
+                }
+            }
+            for (uInt64 k=nbl; k<nb; ++k) {
+                AccumType diff = vals[k] - bmean;
+                lnvar[0] += diff*diff;
+            }
+        }
+        AccumType bnvar = (lnvar[0] + lnvar[1]) + (lnvar[2] + lnvar[3]);
+        // merge the block with the running statistics
+        const Bool isFirst = stats.npts == 0;
+        AccumType prevw = weights ? stats.sumweights : AccumType(stats.npts);
+        AccumType totw = prevw + bsumw;
+        AccumType delta = bmean - stats.mean;
+        stats.mean += delta*(bsumw/totw);
+        stats.nvariance += bnvar + delta*delta*(prevw*bsumw/totw);
+        stats.sum += bsum;
+        stats.sumsq += bsumsq;
+        if (weights) {
+            stats.sumweights = totw;
+        }
+        stats.npts += nb;
+        ngood += nb;
+        if (doMaxMin) {
+            uInt64 k0 = 0;
+            if (isFirst) {
+                *stats.max = vals[0];
+                *stats.min = vals[0];
+                stats.maxpos = location;
+                stats.maxpos.second += index[0];
+                stats.minpos = stats.maxpos;
+                k0 = 1;
+            }
+            AccumType bmax = *stats.max;
+            AccumType bmin = *stats.min;
+            for (uInt64 k=k0; k<nb; ++k) {
+                bmax = vals[k] > bmax ? vals[k] : bmax;
+                bmin = vals[k] < bmin ? vals[k] : bmin;
+            }
+            // the position is the first occurrence of a new max or min
+            if (bmax > *stats.max) {
+                uInt64 k = k0;
+                while (! (vals[k] == bmax)) {
+                    ++k;
+                }
+                *stats.max = bmax;
+                stats.maxpos = location;
+                stats.maxpos.second += index[k];
+            }
+            if (bmin < *stats.min) {
+                uInt64 k = k0;
+                while (! (vals[k] == bmin)) {
+                    ++k;
+                }
+                *stats.min = bmin;
+                stats.minpos = location;
+                stats.minpos.second += index[k];
+            }
+        }
+    }
+    return True;
+}
+
 template <class AccumType> template <class LocationType>
 Bool StatisticsUtilities<AccumType>::doMax(
 	AccumType& datamax, LocationType& maxpos, Bool isFirst,
@@ -273,23 +446,125 @@ std::map<uInt64, AccumType> StatisticsUtilities<AccumType>::indicesToValues(
         "large. The sorted array has size " + String::toString(arySize)
     );
     std::map<uInt64, AccumType> indexToValuesMap;
-    uInt64 lastIndex = 0;
-    for_each(
-        indices.cbegin(), indices.cend(),
-        [&myArray, &lastIndex, &arySize](uInt64 index) {
-        GenSort<AccumType>::kthLargest(
-            &myArray[lastIndex], arySize - lastIndex, index - lastIndex
+    std::vector<uInt64> idx(indices.cbegin(), indices.cend());
+    std::vector<AccumType> values(idx.size());
+    const uInt nthreads = OMP::nMaxThreads();
+    std::vector<Bool> found(idx.size(), False);
+    if (nthreads > 1 && arySize >= _PARALLEL_SELECT_SIZE) {
+        // each index is found by a parallel scan of the array
+        for (uInt i=0; i<idx.size(); ++i) {
+            found[i] = _parallelSelect(values[i], myArray, idx[i], nthreads);
+        }
+    }
+    if (std::find(found.begin(), found.end(), False) != found.end()) {
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) if (nthreads > 1 && idx.size() > 1)
+#pragma omp single
+#endif
+        _multiSelect(
+            myArray.data(), myArray.data() + arySize, 0,
+            idx.data(), idx.data() + idx.size(), values.data()
         );
-        lastIndex = index;
-    });
-    for_each(
-        indices.cbegin(), indices.cend(),
-        [&myArray, &indexToValuesMap](uInt64 index) {
-        indexToValuesMap[index] = myArray[index];
-    });
+    }
+    for (uInt i=0; i<idx.size(); ++i) {
+        indexToValuesMap[idx[i]] = values[i];
+    }
     return indexToValuesMap;
 }
 
+template <class AccumType>
+void StatisticsUtilities<AccumType>::_multiSelect(
+    AccumType* first, AccumType* last, uInt64 offset,
+    const uInt64* iIdx, const uInt64* eIdx, AccumType* values
+) {
+    if (iIdx == eIdx) {
+        return;
+    }
+    // select the middle index; the elements before it are not larger, the
+    // ones after it not smaller, so the other indices are found in either part
+    auto mid = iIdx + (eIdx - iIdx)/2;
+    auto kth = first + (*mid - offset);
+    std::nth_element(first, kth, last, _less);
+    values[mid - iIdx] = *kth;
+    auto nextOffset = *mid + 1;
+#ifdef _OPENMP
+#pragma omp task if (last - first > 65536)
+#endif
+    _multiSelect(first, kth, offset, iIdx, mid, values);
+    _multiSelect(
+        kth + 1, last, nextOffset, mid + 1, eIdx, values + (mid + 1 - iIdx)
+    );
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+}
+
+template <class AccumType>
+Bool StatisticsUtilities<AccumType>::_parallelSelect(
+    AccumType& value, const std::vector<AccumType>& myArray, uInt64 k,
+    uInt nthreads
+) {
+    const Int64 n = myArray.size();
+    // take an evenly spaced sample and sort it
+    const Int64 nsamp = 16384;
+    std::vector<AccumType> sample(nsamp);
+    for (Int64 i=0; i<nsamp; ++i) {
+        sample[i] = myArray[(i*n)/nsamp];
+    }
+    std::sort(sample.begin(), sample.end(), _less);
+    // the range around the expected position in the sample; for an
+    // unbiased sample the chance the value is outside it is negligible
+    const Int64 pos = Int64((Double(k) * nsamp) / n);
+    const Int64 delta = 512;
+    const Bool hasLow = pos - delta >= 0;
+    const Bool hasHigh = pos + delta < nsamp;
+    const AccumType low = sample[hasLow ? pos - delta : 0];
+    const AccumType high = sample[hasHigh ? pos + delta : nsamp - 1];
+    // count the values below the range and collect the ones inside it
+    std::vector<std::vector<AccumType>> tInRange(nthreads);
+    uInt64 nBelow = 0;
+    const AccumType* data = myArray.data();
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) reduction(+:nBelow)
+#endif
+    {
+#ifdef _OPENMP
+        auto& inRange = tInRange[omp_get_thread_num()];
+#else
+        auto& inRange = tInRange[0];
+#endif
+        inRange.reserve(4*delta*n/nsamp/nthreads);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for (Int64 i=0; i<n; ++i) {
+            const AccumType& v = data[i];
+            if (hasLow && v < low) {
+                ++nBelow;
+            }
+            else if (! hasHigh || ! (high < v)) {
+                inRange.push_back(v);
+            }
+        }
+    }
+    uInt64 nInRange = 0;
+    for (const auto& inRange : tInRange) {
+        nInRange += inRange.size();
+    }
+    if (k < nBelow || k >= nBelow + nInRange) {
+        return False;
+    }
+    std::vector<AccumType> candidates;
+    candidates.reserve(nInRange);
+    for (const auto& inRange : tInRange) {
+        candidates.insert(candidates.end(), inRange.begin(), inRange.end());
+    }
+    auto kth = candidates.begin() + (k - nBelow);
+    std::nth_element(candidates.begin(), kth, candidates.end(), _less);
+    value = *kth;
+    return True;
+}
+
 template <class AccumType>
 void StatisticsUtilities<AccumType>::mergeResults(
     std::vector<BinCountArray>& bins,
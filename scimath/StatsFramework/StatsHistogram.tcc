@@ -68,6 +68,10 @@ uInt StatsHistogram<AccumType>::getIndex(AccumType value) const {
     // because the caller has already done that
     // estimate the index
     auto idx = _getUInt((value - _minHistLimit)/_binWidth);
+    // rounding can give nBins for a value near the upper limit
+    if (idx >= _nBins) {
+        idx = _nBins - 1;
+    }
     auto mymin = idx == 0 ? _minHistLimit : _maxBinLimits[idx - 1];
     if (value >= mymin && value < _maxBinLimits[idx]) {
         return idx;
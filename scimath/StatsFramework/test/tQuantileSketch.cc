@@ -0,0 +1,164 @@
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+
+#include <casacore/scimath/StatsFramework/QuantileSketch.h>
+#include <casacore/scimath/StatsFramework/ClassicalStatistics.h>
+#include <casacore/scimath/StatsFramework/StatisticsAlgorithmFactory.h>
+
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// pseudo random values, the same on all platforms
+std::vector<Double> makeData(uInt n) {
+    std::vector<Double> v(n);
+    uInt64 seed = 12345;
+    for (auto& x : v) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        x = Double(seed >> 11) / Double(uInt64(1) << 53);
+        x = x * x * 100;
+    }
+    return v;
+}
+
+// the rank error of value q (as a fraction of the data set size)
+Double rankError(const std::vector<Double>& sorted, Double q, Double fraction) {
+    auto r = std::lower_bound(sorted.begin(), sorted.end(), q) - sorted.begin();
+    return std::abs(Double(r)/sorted.size() - fraction);
+}
+
+int main() {
+    try {
+        {
+            // a small data set is kept completely, so its quantiles are exact
+            QuantileSketch<Double> sketch(0.01);
+            for (uInt i=0; i<101; ++i) {
+                sketch.add(100 - i);
+            }
+            AlwaysAssert(sketch.count() == 101, AipsError);
+            AlwaysAssert(sketch.size() == 101, AipsError);
+            AlwaysAssert(sketch.quantile(0.5) == 50, AipsError);
+            AlwaysAssert(sketch.quantile(0) == 0, AipsError);
+            AlwaysAssert(sketch.quantile(1) == 100, AipsError);
+        }
+        {
+            // a large data set in parallel parts, which are merged
+            const Double error = 0.001;
+            auto data = makeData(1000000);
+            std::vector<QuantileSketch<Double>> parts(
+                4, QuantileSketch<Double>(error)
+            );
+            for (uInt i=0; i<data.size(); ++i) {
+                parts[i%4].add(data[i]);
+            }
+            for (uInt i=1; i<4; ++i) {
+                parts[0].merge(parts[i]);
+            }
+            const auto& sketch = parts[0];
+            AlwaysAssert(sketch.count() == data.size(), AipsError);
+            AlwaysAssert(sketch.size() < 20/error, AipsError);
+            std::sort(data.begin(), data.end());
+            for (Double f : {0.01, 0.25, 0.5, 0.75, 0.99}) {
+                AlwaysAssert(
+                    rankError(data, sketch.quantile(f), f) <= error, AipsError
+                );
+            }
+        }
+        {
+            // approximate quantiles using ClassicalStatistics
+            const Double error = 0.001;
+            auto data = makeData(300000);
+            ClassicalStatistics<Double, std::vector<Double>::const_iterator> cs;
+            cs.setQuantileError(error);
+            AlwaysAssert(cs.getQuantileError() == error, AipsError);
+            cs.setData(data.begin(), data.size());
+            std::set<Double> fractions {0.25, 0.75};
+            std::map<Double, Double> quantiles;
+            auto median = cs.getMedianAndQuantiles(quantiles, fractions);
+            auto medAbsDevMed = cs.getMedianAbsDevMed();
+            auto sorted = data;
+            std::sort(sorted.begin(), sorted.end());
+            AlwaysAssert(rankError(sorted, median, 0.5) <= error, AipsError);
+            AlwaysAssert(
+                rankError(sorted, quantiles[0.25], 0.25) <= error, AipsError
+            );
+            AlwaysAssert(
+                rankError(sorted, quantiles[0.75], 0.75) <= error, AipsError
+            );
+            std::vector<Double> absdev(data.size());
+            for (uInt i=0; i<data.size(); ++i) {
+                absdev[i] = std::abs(data[i] - median);
+            }
+            std::sort(absdev.begin(), absdev.end());
+            AlwaysAssert(
+                rankError(absdev, medAbsDevMed, 0.5) <= 2*error, AipsError
+            );
+            // compare with the exact values
+            ClassicalStatistics<Double, std::vector<Double>::const_iterator> ex;
+            ex.setData(data.begin(), data.size());
+            AlwaysAssert(
+                std::abs(ex.getMedian() - median) < 0.2, AipsError
+            );
+        }
+        {
+            // the error is passed by the factory and persisted in a record
+            StatisticsAlgorithmFactory<
+                Double, std::vector<Double>::const_iterator
+            > saf;
+            saf.configureHingesFences(1.5);
+            saf.setQuantileError(0.01);
+            auto saf2 = StatisticsAlgorithmFactory<
+                Double, std::vector<Double>::const_iterator
+            >::fromRecord(saf.toRecord());
+            AlwaysAssert(saf2.quantileError() == 0.01, AipsError);
+            auto sa = saf2.createStatsAlgorithm();
+            auto cs = std::dynamic_pointer_cast<
+                ClassicalStatistics<Double, std::vector<Double>::const_iterator>
+            >(sa);
+            AlwaysAssert(cs && cs->getQuantileError() == 0.01, AipsError);
+        }
+        {
+            Bool thrown = False;
+            try {
+                QuantileSketch<Double> sketch(0);
+            }
+            catch (const AipsError&) {
+                thrown = True;
+            }
+            AlwaysAssert(thrown, AipsError);
+        }
+    }
+    catch (const std::exception& x) {
+        cout << x.what() << endl;
+        return 1;
+    }
+    cout << "OK" << endl;
+    return 0;
+}
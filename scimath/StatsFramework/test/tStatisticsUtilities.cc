@@ -30,6 +30,7 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/scimath/StatsFramework/ClassicalStatistics.h>
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -293,13 +294,122 @@ int main() {
             AlwaysAssert(got.rms == expec.rms, AipsError);
             AlwaysAssert(near(got.stddev, expec.stddev), AipsError);
             AlwaysAssert(near(got.sum, expec.sum), AipsError);
-            AlwaysAssert(got.sumsq == expec.sumsq, AipsError);
+            AlwaysAssert(near(got.sumsq, expec.sumsq), AipsError);
             AlwaysAssert(near(got.variance, expec.variance), AipsError);
             AlwaysAssert(*got.max == *expec.max, AipsError);
             AlwaysAssert(*got.min == *expec.min, AipsError);
             AlwaysAssert(got.maxpos == std::pair<Int64 COMMA Int64>(0, 2), AipsError);
             AlwaysAssert(got.minpos == std::pair<Int64 COMMA Int64>(2, 0), AipsError);
         }
+        {
+            // accumulateContiguous must give the same results as accumulating
+            // the values one by one
+            const uInt64 n = 5000;
+            vector<Float> data(n);
+            Bool mask[n];
+            vector<Double> weights(n);
+            uInt val = 3;
+            for (uInt64 i=0; i<n; ++i) {
+                val = val*1103515245 + 12345;
+                data[i] = Float((val >> 8) % 10000) / 7 - 500;
+                mask[i] = (val >> 4) % 5 != 0;
+                weights[i] = (val >> 12) % 7;
+            }
+            data[2345] = 2000;
+            data[3456] = -2000;
+            for (uInt type=0; type<4; ++type) {
+                const Bool* m = (type & 1) ? mask : nullptr;
+                const Double* w = (type & 2) ? weights.data() : nullptr;
+                StatsData<Double> expec = initializeStatsData<Double>();
+                expec.max.reset(new Double(0));
+                expec.min.reset(new Double(0));
+                uInt64 nexpec = 0;
+                for (uInt64 i=0; i<n; ++i) {
+                    LocationType loc(1, 10 + i);
+                    if (m && ! m[i]) {
+                        continue;
+                    }
+                    if (w) {
+                        if (w[i] > 0) {
+                            StatisticsUtilities<Double>::waccumulate(
+                                expec.npts, expec.sumweights, expec.sum,
+                                expec.mean, expec.nvariance, expec.sumsq,
+                                *expec.min, *expec.max, expec.minpos,
+                                expec.maxpos, data[i], w[i], loc
+                            );
+                        }
+                    }
+                    else {
+                        StatisticsUtilities<Double>::accumulate(
+                            expec.npts, expec.sum, expec.mean,
+                            expec.nvariance, expec.sumsq, *expec.min,
+                            *expec.max, expec.minpos, expec.maxpos,
+                            Double(data[i]), loc
+                        );
+                        ++nexpec;
+                    }
+                }
+                StatsData<Double> got = initializeStatsData<Double>();
+                got.max.reset(new Double(0));
+                got.min.reset(new Double(0));
+                uInt64 ngood = 0;
+                AlwaysAssert(
+                    StatisticsUtilities<Double>::accumulateContiguous(
+                        got, ngood, data.data(), m, w, n, LocationType(1, 10),
+                        True
+                    ), AipsError
+                );
+                AlwaysAssert(got.npts == expec.npts, AipsError);
+                AlwaysAssert(w || ngood == nexpec, AipsError);
+                AlwaysAssert(near(got.sumweights, expec.sumweights), AipsError);
+                AlwaysAssert(near(got.sum, expec.sum, 1e-12), AipsError);
+                AlwaysAssert(near(got.sumsq, expec.sumsq, 1e-12), AipsError);
+                AlwaysAssert(near(got.mean, expec.mean, 1e-10), AipsError);
+                AlwaysAssert(
+                    near(got.nvariance, expec.nvariance, 1e-12), AipsError
+                );
+                AlwaysAssert(*got.max == *expec.max, AipsError);
+                AlwaysAssert(*got.min == *expec.min, AipsError);
+                AlwaysAssert(got.maxpos == expec.maxpos, AipsError);
+                AlwaysAssert(got.minpos == expec.minpos, AipsError);
+            }
+            // a generic iterator is not handled
+            StatsData<Double> got = initializeStatsData<Double>();
+            uInt64 ngood = 0;
+            AlwaysAssert(
+                ! StatisticsUtilities<Double>::accumulateContiguous(
+                    got, ngood, data.cbegin(), mask,
+                    weights.cbegin(), n, LocationType(0, 0), False
+                ), AipsError
+            );
+        }
+        {
+            // indicesToValues, for a small array and for an array large
+            // enough to be selected in parallel
+            for (uInt64 n : {uInt64(1001), uInt64(1500000)}) {
+                vector<Double> data(n);
+                uInt val = 1;
+                for (auto& d : data) {
+                    val = val*1103515245 + 12345;
+                    d = (val >> 8) % 100000;
+                }
+                vector<Double> sorted(data);
+                std::sort(sorted.begin(), sorted.end());
+                std::set<uInt64> indices;
+                indices.insert(0);
+                indices.insert(n/4);
+                indices.insert(n/2);
+                indices.insert(n/2 + 1);
+                indices.insert(n - 1);
+                auto values = StatisticsUtilities<Double>::indicesToValues(
+                    data, indices
+                );
+                AlwaysAssert(values.size() == indices.size(), AipsError);
+                for (auto idx : indices) {
+                    AlwaysAssert(values[idx] == sorted[idx], AipsError);
+                }
+            }
+        }
     }
     catch (const std::exception& x) {
         cout << x.what() << endl;
@@ -42,6 +42,7 @@ constexpr const char *Adios2StMan::impl::SPEC_FIELD_ENGINE_TYPE;
 constexpr const char *Adios2StMan::impl::SPEC_FIELD_ENGINE_PARAMS;
 constexpr const char *Adios2StMan::impl::SPEC_FIELD_TRANSPORT_PARAMS;
 constexpr const char *Adios2StMan::impl::SPEC_FIELD_OPERATOR_PARAMS;
+constexpr const char *Adios2StMan::impl::SPEC_FIELD_BUFFER_SIZE;
 
 //
 // Adios2StMan implementation in terms of the impl class
@@ -181,6 +182,16 @@ rownr_t Adios2StMan::getNrRows()
     return pimpl->getNrRows();
 }
 
+void Adios2StMan::setBufferedWrites(uInt64 maxBufferSize, uInt nAggregators)
+{
+    pimpl->setBufferedWrites(maxBufferSize, nAggregators);
+}
+
+uInt64 Adios2StMan::bufferedWrites() const
+{
+    return pimpl->bufferedWrites();
+}
+
 
 
 //
@@ -312,6 +323,11 @@ Adios2StMan::impl::~impl()
 {
     if (itsAdiosEngine)
     {
+        // Every rank performs its own outstanding puts before the step ends.
+        if (itsWriting)
+        {
+            performPuts();
+        }
         itsAdiosEngine->EndStep();
         itsAdiosEngine->Close();
     }
@@ -376,12 +392,17 @@ DataManager *Adios2StMan::impl::makeObject(const String &/*aDataManType*/,
             operator_params.emplace_back(std::move(params));
         }
     }
-    return new Adios2StMan(
+    Adios2StMan *stman = new Adios2StMan(
 #ifdef HAVE_MPI
             itsMpiComm,
 #endif
             engine, engine_params,
             transport_params, operator_params, configFile);
+    if (spec.isDefined(SPEC_FIELD_BUFFER_SIZE)) {
+        Int64 bufferSize = spec.asInt64(SPEC_FIELD_BUFFER_SIZE);
+        stman->setBufferedWrites(bufferSize > 0 ? bufferSize : 0);
+    }
+    return stman;
 }
 
 Record Adios2StMan::impl::dataManagerSpec() const
@@ -422,12 +443,16 @@ Record Adios2StMan::impl::dataManagerSpec() const
         }
         record.defineRecord(SPEC_FIELD_OPERATOR_PARAMS, operator_params_record);
     }
+    if (itsMaxBufferSize > 0) {
+        record.define(SPEC_FIELD_BUFFER_SIZE, Int64(itsMaxBufferSize));
+    }
     return record;
 }
 
 DataManager *Adios2StMan::impl::clone() const
 {
-    return new Adios2StMan(
+    // The number of aggregators is part of the engine parameters.
+    Adios2StMan *stman = new Adios2StMan(
 #ifdef HAVE_MPI
         itsMpiComm,
 #endif
@@ -437,6 +462,53 @@ DataManager *Adios2StMan::impl::clone() const
         itsAdiosOperatorParamsVec,
         itsAdiosConfigFile
     );
+    stman->setBufferedWrites(itsMaxBufferSize);
+    return stman;
+}
+
+void Adios2StMan::impl::setBufferedWrites(uInt64 maxBufferSize,
+                                          uInt nAggregators)
+{
+    if (itsAdiosEngine)
+    {
+        throw DataManError("Adios2StMan::setBufferedWrites cannot be used "
+                           "after the table has been created");
+    }
+    itsMaxBufferSize = maxBufferSize;
+    if (nAggregators > 0)
+    {
+        std::string value = std::to_string(nAggregators);
+        itsAdiosEngineParams["NumAggregators"] = value;
+        itsAdiosIO->SetParameter("NumAggregators", value);
+    }
+}
+
+void Adios2StMan::impl::addBufferedBytes(uInt64 nbytes)
+{
+    itsBufferedBytes += nbytes;
+    if (itsBufferedBytes >= itsMaxBufferSize)
+    {
+        performPuts();
+    }
+}
+
+void Adios2StMan::impl::performPuts()
+{
+    if (itsMaxBufferSize == 0 || !itsAdiosEngine)
+    {
+        return;
+    }
+    for (uInt i = 0; i < ncolumn(); ++i)
+    {
+        itsColumnPtrBlk[i]->putPending();
+    }
+    // The buffers must be kept until the deferred puts are done.
+    itsAdiosEngine->PerformPuts();
+    for (uInt i = 0; i < ncolumn(); ++i)
+    {
+        itsColumnPtrBlk[i]->clearPutBuffers();
+    }
+    itsBufferedBytes = 0;
 }
 
 String Adios2StMan::impl::dataManagerType() const
@@ -458,6 +530,7 @@ void Adios2StMan::impl::create64(rownr_t  aNrRows)
     {
         itsColumnPtrBlk[i]->create(itsAdiosEngine, 'w');
     }
+    itsWriting = True;
     itsAdiosEngine->BeginStep();
 }
 
@@ -583,6 +656,10 @@ rownr_t Adios2StMan::impl::resync64(rownr_t /*aNrRows*/) { return itsRows; }
 
 Bool Adios2StMan::impl::flush(AipsIO &ios, Bool /*doFsync*/)
 {
+    if (itsWriting)
+    {
+        performPuts();
+    }
     ios.putstart(DATA_MANAGER_TYPE, 2);
     ios << itsDataManName;
     // Here we used to write itsStManColumnType (int), but that was an otherwise
@@ -96,6 +96,22 @@ public:
     Record dataManagerSpec() const;
     rownr_t getNrRows();
 
+    // Use buffered writes. The data put into the columns are gathered and
+    // handed to ADIOS2 as deferred puts, which are performed in batches
+    // when more than maxBufferSize bytes are buffered, when the table is
+    // flushed, and when the table is closed. Puts of consecutive rows of a
+    // column are combined into a single ADIOS2 block.
+    // In an MPI-parallel run each rank can fill its own rows without any
+    // coordination; ADIOS2 aggregates the data of the ranks into the files.
+    // If nAggregators > 0, it sets the number of aggregators (engine
+    // parameter NumAggregators), otherwise the ADIOS2 default is used.
+    // It has to be called before the table is created.
+    // A maxBufferSize of 0 means synchronous puts (the default).
+    void setBufferedWrites(uInt64 maxBufferSize, uInt nAggregators = 0);
+
+    // Get the maximum size of buffered writes (0 means not buffered).
+    uInt64 bufferedWrites() const;
+
 private:
     class impl;
     std::unique_ptr<impl> pimpl;
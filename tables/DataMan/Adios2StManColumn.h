@@ -26,7 +26,9 @@
 #ifndef ADIOS2STMANCOLUMN_H
 #define ADIOS2STMANCOLUMN_H
 
+#include <deque>
 #include <unordered_map>
+#include <vector>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/tables/DataMan/StManColumnBase.h>
 #include <casacore/tables/Tables/RefRows.h>
@@ -53,6 +55,12 @@ public:
     int getDataType();
     String getColumnName();
 
+    // In buffered write mode, hand the pending run of rows to ADIOS2
+    // as a deferred put.
+    virtual void putPending() {}
+    // Release the buffers of the deferred puts (after they are performed).
+    virtual void clearPutBuffers() {}
+
 protected:
 
     // scalar get/put
@@ -166,12 +174,75 @@ public:
         }
     }
 
+    void putPending()
+    {
+        if (itsPending.empty())
+            return;
+        if(!isShapeFixed)
+            itsAdiosVariable.SetShape(itsPendingShape);
+        itsAdiosVariable.SetSelection({itsPendingStart, itsPendingCount});
+        itsPutBuffers.push_back(std::move(itsPending));
+        itsPending = std::vector<T>();
+        itsAdiosEngine->Put<T>(itsAdiosVariable, itsPutBuffers.back().data(),
+                               adios2::Mode::Deferred);
+    }
+
+    void clearPutBuffers()
+    {
+        itsPutBuffers.clear();
+    }
+
 private:
     adios2::Variable<T> itsAdiosVariable;
+    // Data of the rows not handed to ADIOS2 yet and their selection.
+    std::vector<T> itsPending;
+    adios2::Dims itsPendingShape;
+    adios2::Dims itsPendingStart;
+    adios2::Dims itsPendingCount;
+    // Data of the deferred puts not performed yet.
+    std::deque<std::vector<T>> itsPutBuffers;
+
+    // Can the current selection be appended to the pending run?
+    // That is the case if it starts at the row after the run and has
+    // the same shape in the other dimensions.
+    bool canAppend() const
+    {
+        if (itsPending.empty() || itsAdiosShape != itsPendingShape ||
+            itsAdiosStart[0] != itsPendingStart[0] + itsPendingCount[0])
+            return false;
+        for (size_t i = 1; i < itsAdiosStart.size(); ++i)
+        {
+            if (itsAdiosStart[i] != itsPendingStart[i] ||
+                itsAdiosCount[i] != itsPendingCount[i])
+                return false;
+        }
+        return true;
+    }
 
     void toAdios(const void *data, std::size_t offset)
     {
         const T *tData = static_cast<const T *>(data);
+        if (itsStManPtr->bufferedWrites() > 0)
+        {
+            // Copy the data, so the put can be deferred.
+            std::size_t n = 1;
+            for (auto count : itsAdiosCount)
+                n *= count;
+            if (canAppend())
+            {
+                itsPendingCount[0] += itsAdiosCount[0];
+            }
+            else
+            {
+                putPending();
+                itsPendingShape = itsAdiosShape;
+                itsPendingStart = itsAdiosStart;
+                itsPendingCount = itsAdiosCount;
+            }
+            itsPending.insert(itsPending.end(), tData + offset, tData + offset + n);
+            itsStManPtr->addBufferedBytes(n * sizeof(T));
+            return;
+        }
         if(!isShapeFixed)
             itsAdiosVariable.SetShape(itsAdiosShape);
         itsAdiosVariable.SetSelection({itsAdiosStart, itsAdiosCount});
@@ -80,6 +80,13 @@ public:
                                    const Record &spec);
     Record dataManagerSpec() const;
     rownr_t getNrRows();
+    void setBufferedWrites(uInt64 maxBufferSize, uInt nAggregators);
+    uInt64 bufferedWrites() const { return itsMaxBufferSize; }
+    // Register that a column buffered the given number of bytes.
+    // The puts are performed if the buffer size exceeds the maximum.
+    void addBufferedBytes(uInt64 nbytes);
+    // Perform all deferred puts and release the column buffers.
+    void performPuts();
 
 private:
     Adios2StMan &parent;
@@ -106,6 +113,12 @@ private:
     std::vector<adios2::Params> itsAdiosOperatorParamsVec;
     // The ADIOS2 XML configuration file
     std::string itsAdiosConfigFile;
+    // Maximum nr of bytes of buffered (deferred) puts (0 = synchronous puts)
+    uInt64 itsMaxBufferSize {0};
+    // Current nr of bytes in buffered puts
+    uInt64 itsBufferedBytes {0};
+    // Is the engine opened for writing?
+    Bool itsWriting {False};
 
     // The type of this storage manager
     static constexpr const char *DATA_MANAGER_TYPE = "Adios2StMan";
@@ -119,6 +132,8 @@ private:
     static constexpr const char *SPEC_FIELD_TRANSPORT_PARAMS = "TRANSPORTPARAMS";
     // The name of the specification field for the ADIOS2 operator parameters
     static constexpr const char *SPEC_FIELD_OPERATOR_PARAMS = "OPERATORPARAMS";
+    // The name of the specification field for the maximum buffer size
+    static constexpr const char *SPEC_FIELD_BUFFER_SIZE = "MAXBUFFERSIZE";
 
     void configureAdios();
     uInt ncolumn() const { return parent.ncolumn(); }
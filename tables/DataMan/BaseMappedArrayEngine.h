@@ -461,8 +461,55 @@ protected:
     virtual void mapOnPut (const Array<VirtualType>& array,
                            Array<StoredType>& stored);
 
+    // Tell if the stored data can be read directly into the storage of
+    // the virtual array, thus without a temporary stored array.
+    // If so, <src>stored</src> is set to an array with the given stored
+    // shape sharing that storage (see <src>shareStorage</src>) and
+    // <src>mapInPlaceOnGet</src> is called after reading the data.
+    // The default implementation returns False, so mapOnGet is used.
+    virtual Bool shareOnGet (Array<VirtualType>& array,
+                             const IPosition& storedShape,
+                             Array<StoredType>& stored);
+
+    // Map the stored data read into the storage of the virtual array
+    // (by a get using shareOnGet) to the virtual data.
+    // The default implementation does nothing, which is correct if the
+    // stored and virtual data have the same memory layout.
+    virtual void mapInPlaceOnGet (Array<VirtualType>& array,
+                                  Array<StoredType>& stored);
+
+    // Tell if the virtual array can be written directly, because its
+    // storage has the layout of the stored data. If so, <src>stored</src>
+    // is set to an array with the given stored shape sharing that storage.
+    // The default implementation returns False, so mapOnPut is used.
+    virtual Bool shareOnPut (const Array<VirtualType>& array,
+                             const IPosition& storedShape,
+                             Array<StoredType>& stored);
+
+    // Set <src>stored</src> to an array with the given shape sharing the
+    // storage of the virtual array. False is returned if not possible,
+    // because the virtual array is not contiguous or its storage is too
+    // small or not aligned for StoredType.
+    static Bool shareStorage (const Array<VirtualType>& array,
+                              const IPosition& storedShape,
+                              Array<StoredType>& stored);
+
 
 private:
+    // Get the stored data using <src>getFunc(storedArray)</src> and map it
+    // to the virtual array. The data are read directly into the virtual
+    // array if shareOnGet allows it.
+    template<typename Func>
+    void getMapped (Array<VirtualType>& array, const IPosition& storedShape,
+                    Func getFunc);
+
+    // Map the virtual array to the stored data and put it using
+    // <src>putFunc(storedArray)</src>. The virtual array is put directly
+    // if shareOnPut allows it.
+    template<typename Func>
+    void putMapped (const Array<VirtualType>& array,
+                    const IPosition& storedShape, Func putFunc);
+
     //# Now define the data members.
     String         virtualName_p;        //# virtual column name
     String         storedName_p;         //# stored column name
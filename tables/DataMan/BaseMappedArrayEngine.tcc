@@ -34,6 +34,7 @@
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <cstdint>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -249,106 +250,139 @@ Bool BaseMappedArrayEngine<VirtualType, StoredType>::canChangeShape() const
 }
 
 
+template<class VirtualType, class StoredType>
+template<typename Func>
+void BaseMappedArrayEngine<VirtualType, StoredType>::getMapped
+(Array<VirtualType>& array, const IPosition& storedShape, Func getFunc)
+  {
+    Array<StoredType> target;
+    if (shareOnGet (array, storedShape, target)) {
+      const StoredType* shared = target.data();
+      getFunc (target);
+      //# Map in place unless the get made target refer to other data.
+      if (target.data() == shared) {
+        mapInPlaceOnGet (array, target);
+        return;
+      }
+    } else {
+      target.resize (storedShape);
+      getFunc (target);
+    }
+    mapOnGet (array, target);
+  }
+template<class VirtualType, class StoredType>
+template<typename Func>
+void BaseMappedArrayEngine<VirtualType, StoredType>::putMapped
+(const Array<VirtualType>& array, const IPosition& storedShape, Func putFunc)
+  {
+    Array<StoredType> target;
+    if (! shareOnPut (array, storedShape, target)) {
+      target.resize (storedShape);
+      mapOnPut (array, target);
+    }
+    putFunc (target);
+  }
+
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::getArray
 (rownr_t rownr, Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    column().baseGet (rownr, target);
-    mapOnGet (array, target);
+    getMapped (array, getStoredShape(0, array.shape()),
+               [&] (Array<StoredType>& target)
+                 { column().baseGet (rownr, target); });
   }
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::putArray
 (rownr_t rownr, const Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    mapOnPut (array, target);
-    column().basePut (rownr, target);
+    putMapped (array, getStoredShape(0, array.shape()),
+               [&] (const Array<StoredType>& target)
+                 { column().basePut (rownr, target); });
   }
 
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::getSlice
 (rownr_t rownr, const Slicer& slicer, Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(rownr, array.shape()));
-    column().getSlice (rownr, getStoredSlicer(slicer), target);
-    mapOnGet (array, target);
+    getMapped (array, getStoredShape(rownr, array.shape()),
+               [&] (Array<StoredType>& target)
+                 { column().getSlice (rownr, getStoredSlicer(slicer), target); });
   }
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::putSlice
 (rownr_t rownr, const Slicer& slicer, const Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(rownr, array.shape()));
-    mapOnPut (array, target);
-    column().putSlice (rownr, getStoredSlicer(slicer), target);
+    putMapped (array, getStoredShape(rownr, array.shape()),
+               [&] (const Array<StoredType>& target)
+                 { column().putSlice (rownr, getStoredSlicer(slicer), target); });
   }
 
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::getArrayColumn
 (Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    column().getColumn (target);
-    mapOnGet (array, target);
+    getMapped (array, getStoredShape(0, array.shape()),
+               [&] (Array<StoredType>& target)
+                 { column().getColumn (target); });
   }
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::putArrayColumn
 (const Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    mapOnPut (array, target);
-    column().putColumn (target);
+    putMapped (array, getStoredShape(0, array.shape()),
+               [&] (const Array<StoredType>& target)
+                 { column().putColumn (target); });
   }
 
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::getArrayColumnCells
 (const RefRows& rownrs, Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    column().getColumnCells (rownrs, target);
-    mapOnGet (array, target);
+    getMapped (array, getStoredShape(0, array.shape()),
+               [&] (Array<StoredType>& target)
+                 { column().getColumnCells (rownrs, target); });
   }
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::putArrayColumnCells
 (const RefRows& rownrs, const Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    mapOnPut (array, target);
-    column().putColumnCells (rownrs, target);
+    putMapped (array, getStoredShape(0, array.shape()),
+               [&] (const Array<StoredType>& target)
+                 { column().putColumnCells (rownrs, target); });
   }
 
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::getColumnSlice
 (const Slicer& slicer, Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    column().getColumn (getStoredSlicer(slicer), target);
-    mapOnGet (array, target);
+    getMapped (array, getStoredShape(0, array.shape()),
+               [&] (Array<StoredType>& target)
+                 { column().getColumn (getStoredSlicer(slicer), target); });
   }
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::putColumnSlice
 (const Slicer& slicer, const Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    mapOnPut (array, target);
-    column().putColumn (getStoredSlicer(slicer), target);
+    putMapped (array, getStoredShape(0, array.shape()),
+               [&] (const Array<StoredType>& target)
+                 { column().putColumn (getStoredSlicer(slicer), target); });
   }
 
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::getColumnSliceCells
 (const RefRows& rownrs, const Slicer& slicer, Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    column().getColumnCells (rownrs, getStoredSlicer(slicer), target);
-    mapOnGet (array, target);
+    getMapped (array, getStoredShape(0, array.shape()),
+               [&] (Array<StoredType>& target)
+                 { column().getColumnCells (rownrs, getStoredSlicer(slicer), target); });
   }
 template<class VirtualType, class StoredType>
 void BaseMappedArrayEngine<VirtualType, StoredType>::putColumnSliceCells
 (const RefRows& rownrs, const Slicer& slicer, const Array<VirtualType>& array)
   {
-    Array<StoredType> target(getStoredShape(0, array.shape()));
-    mapOnPut (array, target);
-    column().putColumnCells (rownrs, getStoredSlicer(slicer), target);
+    putMapped (array, getStoredShape(0, array.shape()),
+               [&] (const Array<StoredType>& target)
+                 { column().putColumnCells (rownrs, getStoredSlicer(slicer), target); });
   }
 
 template<class VirtualType, class StoredType>
@@ -381,6 +415,46 @@ void BaseMappedArrayEngine<VirtualType, StoredType>::mapOnPut
                        "for column " + virtualName());
 }
 
+template<class VirtualType, class StoredType>
+Bool BaseMappedArrayEngine<VirtualType, StoredType>::shareOnGet
+(Array<VirtualType>&, const IPosition&, Array<StoredType>&)
+{
+  return False;
+}
+
+template<class VirtualType, class StoredType>
+void BaseMappedArrayEngine<VirtualType, StoredType>::mapInPlaceOnGet
+(Array<VirtualType>&, Array<StoredType>&)
+{}
+
+template<class VirtualType, class StoredType>
+Bool BaseMappedArrayEngine<VirtualType, StoredType>::shareOnPut
+(const Array<VirtualType>&, const IPosition&, Array<StoredType>&)
+{
+  return False;
+}
+
+template<class VirtualType, class StoredType>
+Bool BaseMappedArrayEngine<VirtualType, StoredType>::shareStorage
+(const Array<VirtualType>& array, const IPosition& storedShape,
+ Array<StoredType>& stored)
+{
+  const VirtualType* data = array.data();
+  if (array.nelements() == 0  ||  !array.contiguousStorage()  ||
+      size_t(storedShape.product()) * sizeof(StoredType) >
+        array.nelements() * sizeof(VirtualType)  ||
+      reinterpret_cast<std::uintptr_t>(data) % alignof(StoredType) != 0) {
+    return False;
+  }
+  //# The stored array only refers to the storage, so it cannot outlive
+  //# the virtual array. A put does not change the (const) data.
+  stored.takeStorage (storedShape,
+                      reinterpret_cast<StoredType*>
+                        (const_cast<VirtualType*>(data)),
+                      SHARE);
+  return True;
+}
+
 
 } //# NAMESPACE CASACORE - END
 
@@ -29,6 +29,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/BaseMappedArrayEngine.h>
+#include <casacore/casa/Arrays/Array.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -324,6 +325,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     void mapOnGet (Array<Bool>& array,
                    const Array<StoredType>& stored);
 
+    // Map n contiguous bit flags to Bools using the read mask.
+    // It is a plain loop, so the compiler can vectorize it.
+    static void flagsToBool (const StoredType* flags, Bool* out, size_t n,
+                             StoredType readMask);
+
+    // Get the stored data of the rows in chunks and map them to the
+    // virtual array, whose last axis is the row axis.
+    // <src>getFunc(startRow, nrow, target)</src> gets the stored data of
+    // a chunk of rows. The chunks are small enough to keep the stored data
+    // in the cache, which also limits the memory needed for a large column.
+    template<typename Func>
+    void getChunked (Array<Bool>& array, rownr_t nrow, Func getFunc);
+
     // Map Bool array to bit flags array.
     // This is meant when writing an array into the stored column.
     void mapOnPut (const Array<Bool>& array,
@@ -366,6 +380,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     StoredType   itsReadMask;
     StoredType   itsWriteMask;
     Bool         itsIsNew;         //# True = new table
+    Array<StoredType> itsBuffer;   //# buffer for a get of a single cell
   };
 
 
@@ -33,11 +33,13 @@
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <algorithm>
 #include <casacore/casa/Utilities/ValTypeId.h>
 
 
@@ -200,9 +202,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   template<typename T>
   void BitFlagsEngine<T>::getArray (rownr_t rownr, Array<Bool>& array)
   {
-    Array<T> target(array.shape());
-    column().get (rownr, target);
-    mapOnGet (array, target);
+    if (! itsBuffer.shape().isEqual (array.shape())) {
+      itsBuffer.resize (array.shape());
+    }
+    column().get (rownr, itsBuffer);
+    mapOnGet (array, itsBuffer);
   }
   template<typename T>
   void BitFlagsEngine<T>::putArray (rownr_t rownr, const Array<Bool>& array)
@@ -216,9 +220,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void BitFlagsEngine<T>::getSlice (rownr_t rownr, const Slicer& slicer,
                                     Array<Bool>& array)
   {
-    Array<T> target(array.shape());
-    column().getSlice (rownr, slicer, target);
-    mapOnGet (array, target);
+    if (! itsBuffer.shape().isEqual (array.shape())) {
+      itsBuffer.resize (array.shape());
+    }
+    column().getSlice (rownr, slicer, itsBuffer);
+    mapOnGet (array, itsBuffer);
   }
   template<typename T>
   void BitFlagsEngine<T>::putSlice (rownr_t rownr, const Slicer& slicer,
@@ -232,9 +238,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   template<typename T>
   void BitFlagsEngine<T>::getArrayColumn (Array<Bool>& array)
   {
-    Array<T> target(array.shape());
-    column().getColumn (target);
-    mapOnGet (array, target);
+    getChunked (array, table().nrow(),
+                [this] (rownr_t st, rownr_t n, Array<T>& target)
+                { column().getColumnRange (Slicer(IPosition(1,st),
+                                                  IPosition(1,n)),
+                                           target); });
   }
   template<typename T>
   void BitFlagsEngine<T>::putArrayColumn (const Array<Bool>& array)
@@ -248,9 +256,21 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void BitFlagsEngine<T>::getArrayColumnCells (const RefRows& rownrs,
                                                Array<Bool>& array)
   {
-    Array<T> target(array.shape());
-    column().getColumnCells (rownrs, target);
-    mapOnGet (array, target);
+    //# Only convert to row numbers if multiple chunks are needed.
+    RowNumbers rows;
+    getChunked (array, rownrs.nrow(),
+                [&] (rownr_t st, rownr_t n, Array<T>& target)
+                {
+                  if (n == rownrs.nrow()) {
+                    column().getColumnCells (rownrs, target);
+                  } else {
+                    if (rows.empty()) {
+                      rows = rownrs.convert();
+                    }
+                    column().getColumnCells
+                      (RefRows(rows(Slice(st,n))), target);
+                  }
+                });
   }
   template<typename T>
   void BitFlagsEngine<T>::putArrayColumnCells (const RefRows& rownrs,
@@ -265,9 +285,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void BitFlagsEngine<T>::getColumnSlice (const Slicer& slicer,
                                           Array<Bool>& array)
   {
-    Array<T> target(array.shape());
-    column().getColumn (slicer, target);
-    mapOnGet (array, target);
+    getChunked (array, table().nrow(),
+                [&] (rownr_t st, rownr_t n, Array<T>& target)
+                { column().getColumnRange (Slicer(IPosition(1,st),
+                                                  IPosition(1,n)),
+                                           slicer, target); });
   }
   template<typename T>
   void BitFlagsEngine<T>::putColumnSlice (const Slicer& slicer,
@@ -283,9 +305,20 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                                                const Slicer& slicer,
                                                Array<Bool>& array)
   {
-    Array<T> target(array.shape());
-    column().getColumnCells (rownrs, slicer, target);
-    mapOnGet (array, target);
+    RowNumbers rows;
+    getChunked (array, rownrs.nrow(),
+                [&] (rownr_t st, rownr_t n, Array<T>& target)
+                {
+                  if (n == rownrs.nrow()) {
+                    column().getColumnCells (rownrs, slicer, target);
+                  } else {
+                    if (rows.empty()) {
+                      rows = rownrs.convert();
+                    }
+                    column().getColumnCells
+                      (RefRows(rows(Slice(st,n))), slicer, target);
+                  }
+                });
   }
   template<typename T>
   void BitFlagsEngine<T>::putColumnSliceCells (const RefRows& rownrs,
@@ -297,11 +330,63 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     column().putColumnCells (rownrs, slicer, target);
   }
 
+  template<typename T>
+  template<typename Func>
+  void BitFlagsEngine<T>::getChunked (Array<Bool>& array, rownr_t nrow,
+                                      Func getFunc)
+  {
+    //# The nr of stored values in a chunk (256 KB for Int).
+    const size_t chunkSize = 65536;
+    const size_t cellSize = (nrow == 0  ?  0 : array.nelements() / nrow);
+    if (cellSize == 0  ||  array.nelements() <= chunkSize  ||
+        !array.contiguousStorage()) {
+      Array<T> target(array.shape());
+      getFunc (0, nrow, target);
+      mapOnGet (array, target);
+      return;
+    }
+    //# The last axis is the row axis, so a chunk of rows is contiguous.
+    IPosition shape = array.shape();
+    const rownr_t chunkRows = std::max (size_t(1), chunkSize / cellSize);
+    Bool* out = array.data();
+    Array<T> target;
+    for (rownr_t st=0; st<nrow; st+=chunkRows) {
+      const rownr_t n = std::min (chunkRows, nrow-st);
+      shape[shape.size() - 1] = n;
+      if (! target.shape().isEqual (shape)) {
+        target.resize (shape);
+      }
+      getFunc (st, n, target);
+      Array<Bool> part(shape, out + st*cellSize, SHARE);
+      mapOnGet (part, target);
+    }
+  }
+
+  template<typename T>
+  void BitFlagsEngine<T>::flagsToBool (const T* flags, Bool* out, size_t n,
+                                       T readMask)
+  {
+    for (size_t i=0; i<n; ++i) {
+      out[i] = (flags[i] & readMask) != 0;
+    }
+  }
+
   template<typename T>
   void BitFlagsEngine<T>::mapOnGet (Array<Bool>& array,
                                     const Array<T>& stored)
   {
-    arrayTransform (stored, array, FlagsToBool(itsReadMask));
+    if (array.contiguousStorage()  &&  stored.contiguousStorage()) {
+      const T* flags = stored.data();
+      Bool* out = array.data();
+      const T mask = itsReadMask;
+      size_t n = array.nelements();
+      arrays_internal::parallelChunks
+        (n, arrays_internal::parallelNChunk(n),
+         [=] (size_t, size_t st, size_t len)
+         { flagsToBool (flags+st, out+st, len, mask); });
+    } else {
+      arrayTransform (stored, array, FlagsToBool(itsReadMask));
+    }
   }
 
   template<typename T>
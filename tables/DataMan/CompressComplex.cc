@@ -25,6 +25,7 @@
 
 //# Includes
 #include <casacore/tables/DataMan/CompressComplex.h>
+#include <casacore/tables/DataMan/CompressKernels.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
@@ -35,6 +36,8 @@
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <algorithm>
+#include <limits>
 
 
 
@@ -212,33 +215,20 @@ void CompressComplex::addRowInit (rownr_t startRow, rownr_t nrrow)
 void CompressComplex::findMinMax (Float& minVal, Float& maxVal,
 				  const Array<Complex>& array) const
 {
-  setNaN (minVal);
-  setNaN (maxVal);
+  const Float inf = std::numeric_limits<Float>::infinity();
   Bool deleteIt;
   const Complex* data = array.getStorage (deleteIt);
-  const Int64 nr = array.nelements();
-  Bool firstTime = True;
-  for (Int64 i=0; i<nr; i++) {
-    if (isFinite(data[i].real())  &&  isFinite(data[i].imag())) {
-      Float tmp = data[i].real();
-      if (firstTime) {
-	minVal = tmp;
-	maxVal = tmp;
-	firstTime = False;
-      }
-      if (tmp < minVal) {
-	minVal = tmp;
-      } else if (tmp > maxVal) {
-	maxVal = tmp;
-      }
-      tmp = data[i].imag();
-      if (tmp < minVal) {
-	minVal = tmp;
-      } else if (tmp > maxVal) {
-	maxVal = tmp;
-      }
-    }
-  }
+  compress_internal::finiteMinMax
+    (minVal, maxVal, array.nelements(),
+     [data, inf] (size_t i, Float& lo, Float& hi)
+     {
+       Float re = data[i].real();
+       Float im = data[i].imag();
+       Bool ok = (compress_internal::finiteValue (re)  &&
+                  compress_internal::finiteValue (im));
+       lo = ok  ?  std::min (re, im) : inf;
+       hi = ok  ?  std::max (re, im) : -inf;
+     });
   array.freeStorage (data, deleteIt);
 }
 
@@ -264,26 +254,29 @@ void CompressComplex::scaleOnGet (Float scale, Float offset,
 				  Array<Complex>& array,
 				  const Array<Int>& target)
 {
+  const Float nan = floatNaN();
   Bool deleteIn, deleteOut;
   Complex* out = array.getStorage (deleteOut);
   const Int* in = target.getStorage (deleteIn);
-  const Int64 nr = array.nelements();
-  for (Int64 i=0; i<nr; i++) {
-    Int r = in[i] / 65536;
-    if (r == -32768) {
-      setNaN (out[i]);
-    } else {
-      Int im = in[i] - r*65536;
-      if (im < -32768) {
-	r  -= 1;
-	im += 65536;
-      } else if (im >= 32768) {
-	r  += 1;
-	im -= 65536;
-      }
-      out[i] = Complex (r * scale + offset, im * scale + offset);
-    }
-  }
+  // Write the real and imaginary parts as floats, which is allowed
+  // for std::complex and makes vectorization easier.
+  Float* outf = reinterpret_cast<Float*>(out);
+  compress_internal::parallelLoop
+    (array.nelements(),
+     [=] (size_t i)
+     {
+       // The real part is in the upper 16 bits, the imaginary part in the
+       // lower 16 bits (as a signed value, so it can borrow from the upper).
+       Int r  = in[i] / 65536;
+       Bool ok = (r != -32768);
+       Int im = in[i] - r*65536;
+       Int lo = (im < -32768);
+       Int hi = (im >= 32768);
+       r  += hi - lo;
+       im += (lo - hi) * 65536;
+       outf[2*i]   = ok  ?  r * scale + offset : nan;
+       outf[2*i+1] = ok  ?  im * scale + offset : nan;
+     });
   target.freeStorage (in, deleteIn);
   array.putStorage (out, deleteOut);
 }
@@ -296,48 +289,24 @@ void CompressComplex::scaleOnPut (Float scale, Float offset,
   Bool deleteIn, deleteOut;
   const Complex* in = array.getStorage (deleteIn);
   Int* out = target.getStorage (deleteOut);
-  const Int64 nr = array.nelements();
-  for (Int64 i=0; i<nr; i++) {
-    if (!isFinite(in[i].real())  ||  !isFinite(in[i].imag())) {
-      out[i] = -32768 * 65536;
-    } else {
-      Short s;
-      Float tmp = (in[i].real() - offset) / scale;
-      if (tmp < 0) {
-	float f = ceil(tmp - 0.5);
-	if (f < -32767) {
-	  s = -32767;
-	} else {
-	  s = short(f);
-	}
-      } else {
-	float f = floor(tmp + 0.5);
-	if (f > 32767) {
-	  s = 32767;
-	} else {
-	  s = short(f);
-	}
-      }
-      Int r = int(s) * 65536;
-      tmp = (in[i].imag() - offset) / scale;
-      if (tmp < 0) {
-	float f = ceil(tmp - 0.5);
-	if (f < -32767) {
-	  s = -32767;
-	} else {
-	  s = short(f);
-	}
-      } else {
-	float f = floor(tmp + 0.5);
-	if (f > 32767) {
-	  s = 32767;
-	} else {
-	  s = short(f);
-	}
-      }
-      out[i] = r + s;
-    }
-  }
+  compress_internal::parallelLoop
+    (array.nelements(),
+     [=] (size_t i)
+     {
+       // Use 0 for a non-finite value, so it can always be converted.
+       Float re = in[i].real();
+       Float im = in[i].imag();
+       Bool ok = (compress_internal::finiteValue (re)  &&
+                  compress_internal::finiteValue (im));
+       Float tr = ok  ?  (re - offset) / scale : 0;
+       Float ti = ok  ?  (im - offset) / scale : 0;
+       // Limit to [-32767,32767], because -32768 marks a non-finite value.
+       tr = std::min (std::max (tr, Float(-32767)), Float(32767));
+       ti = std::min (std::max (ti, Float(-32767)), Float(32767));
+       Int v = (compress_internal::roundAway (tr) * 65536 +
+                compress_internal::roundAway (ti));
+       out[i] = ok  ?  v : -32768 * 65536;
+     });
   array.freeStorage (in, deleteIn);
   target.putStorage (out, deleteOut);
 }
@@ -702,35 +671,22 @@ void CompressComplexSD::create64 (rownr_t initialNrrow)
 void CompressComplexSD::findMinMax (Float& minVal, Float& maxVal,
 				    const Array<Complex>& array) const
 {
-  setNaN (minVal);
-  setNaN (maxVal);
+  const Float inf = std::numeric_limits<Float>::infinity();
   Bool deleteIt;
   const Complex* data = array.getStorage (deleteIt);
-  const Int64 nr = array.nelements();
-  Bool firstTime = True;
-  for (Int64 i=0; i<nr; i++) {
-    if (isFinite(data[i].real())  &&  isFinite(data[i].imag())) {
-      Float tmp = data[i].real();
-      if (firstTime) {
-	minVal = tmp;
-	maxVal = tmp;
-	firstTime = False;
-      }
-      if (tmp < minVal) {
-	minVal = tmp;
-      } else if (tmp > maxVal) {
-	maxVal = tmp;
-      }
-      tmp = data[i].imag();
-      if (tmp != 0) {
-	if (tmp < minVal) {
-	  minVal = tmp;
-	} else if (tmp > maxVal) {
-	  maxVal = tmp;
-	}
-      }
-    }
-  }
+  compress_internal::finiteMinMax
+    (minVal, maxVal, array.nelements(),
+     [data, inf] (size_t i, Float& lo, Float& hi)
+     {
+       // A zero imaginary part is not stored, so it is not taken into account.
+       Float re = data[i].real();
+       Float im = data[i].imag();
+       Bool ok = (compress_internal::finiteValue (re)  &&
+                  compress_internal::finiteValue (im));
+       Bool useIm = (im != 0);
+       lo = ok  ?  std::min (re, useIm ? im : re) : inf;
+       hi = ok  ?  std::max (re, useIm ? im : re) : -inf;
+     });
   array.freeStorage (data, deleteIt);
 }
 
@@ -744,8 +700,7 @@ void CompressComplexSD::scaleOnGet (Float scale, Float offset,
   Bool deleteIn, deleteOut;
   Complex* out = array.getStorage (deleteOut);
   const Int* in = target.getStorage (deleteIn);
-  const Int64 nr = array.nelements();
-  for (Int64 i=0; i<nr; i++) {
+  compress_internal::parallelLoop (array.nelements(), [=] (size_t i) {
     Int inval = in[i];
     if (inval%2 == 0) {
       inval >>= 1;
@@ -767,7 +722,7 @@ void CompressComplexSD::scaleOnGet (Float scale, Float offset,
 	out[i] = Complex (r * scale + offset, im * imagScale + offset);
       }
     }
-  }
+  });
   target.freeStorage (in, deleteIn);
   array.putStorage (out, deleteOut);
 }
@@ -782,8 +737,7 @@ void CompressComplexSD::scaleOnPut (Float scale, Float offset,
   Bool deleteIn, deleteOut;
   const Complex* in = array.getStorage (deleteIn);
   Int* out = target.getStorage (deleteOut);
-  const Int64 nr = array.nelements();
-  for (Int64 i=0; i<nr; i++) {
+  compress_internal::parallelLoop (array.nelements(), [=] (size_t i) {
     if (!isFinite(in[i].real())  ||  !isFinite(in[i].imag())) {
       out[i] = -32768 * 65536;
     } else if (in[i].imag() == 0) {
@@ -840,7 +794,7 @@ void CompressComplexSD::scaleOnPut (Float scale, Float offset,
       s <<= 1;
       out[i] = r + s + 1;
     }
-  }
+  });
   array.freeStorage (in, deleteIn);
   target.putStorage (out, deleteOut);
 }
@@ -25,6 +25,7 @@
 
 //# Includes
 #include <casacore/tables/DataMan/CompressFloat.h>
+#include <casacore/tables/DataMan/CompressKernels.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
@@ -35,6 +36,7 @@
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -209,27 +211,17 @@ void CompressFloat::addRowInit (rownr_t startRow, rownr_t nrrow)
 void CompressFloat::findMinMax (Float& minVal, Float& maxVal,
 				const Array<Float>& array) const
 {
-  setNaN (minVal);
-  setNaN (maxVal);
+  const Float inf = std::numeric_limits<Float>::infinity();
   Bool deleteIt;
   const Float* data = array.getStorage (deleteIt);
-  const Int64 nr = array.nelements();
-  Bool firstTime = True;
-  for (Int64 i=0; i<nr; i++) {
-    if (isFinite (data[i])) {
-      if (firstTime) {
-	minVal = data[i];
-	maxVal = data[i];
-	firstTime = False;
-      } else {
-	if (data[i] < minVal) {
-	  minVal = data[i];
-	} else if (data[i] > maxVal) {
-	  maxVal = data[i];
-	}
-      }
-    }
-  }
+  compress_internal::finiteMinMax
+    (minVal, maxVal, array.nelements(),
+     [data, inf] (size_t i, Float& lo, Float& hi)
+     {
+       Bool ok = compress_internal::finiteValue (data[i]);
+       lo = ok  ?  data[i] : inf;
+       hi = ok  ?  data[i] : -inf;
+     });
   array.freeStorage (data, deleteIt);
 }
 
@@ -255,17 +247,16 @@ void CompressFloat::scaleOnGet (Float scale, Float offset,
 				Array<Float>& array,
 				const Array<Short>& target)
 {
+  const Float nan = floatNaN();
   Bool deleteIn, deleteOut;
   Float* out = array.getStorage (deleteOut);
   const Short* in = target.getStorage (deleteIn);
-  const Int64 nr = array.nelements();
-  for (Int64 i=0; i<nr; i++) {
-    if (in[i] == -32768) {
-      setNaN (out[i]);
-    } else {
-      out[i] = in[i] * scale + offset;
-    }
-  }
+  compress_internal::parallelLoop
+    (array.nelements(),
+     [=] (size_t i)
+     {
+       out[i] = in[i] == -32768  ?  nan : in[i] * scale + offset;
+     });
   target.freeStorage (in, deleteIn);
   array.putStorage (out, deleteOut);
 }
@@ -278,24 +269,20 @@ void CompressFloat::scaleOnPut (Float scale, Float offset,
   Bool deleteIn, deleteOut;
   const Float* in = array.getStorage (deleteIn);
   Short* out = target.getStorage (deleteOut);
-  const Int64 nr = array.nelements();
-  for (Int64 i=0; i<nr; i++) {
-    if (isFinite (in[i])) {
-      Float tmp = (in[i] - offset) / scale;
-      if (tmp < 0) {
-	out[i] = short (ceil(tmp - 0.5));
-      } else {
-	out[i] = short (floor(tmp + 0.5));
-      }
-    } else {
-      out[i] = -32768;
-    }
-  }
+  compress_internal::parallelLoop
+    (array.nelements(),
+     [=] (size_t i)
+     {
+       // Use 0 for a non-finite value, so it can always be converted.
+       Bool ok = compress_internal::finiteValue (in[i]);
+       Float tmp = ok  ?  (in[i] - offset) / scale : 0;
+       Short s = Short(compress_internal::roundAway (tmp));
+       out[i] = ok  ?  s : Short(-32768);
+     });
   array.freeStorage (in, deleteIn);
   target.putStorage (out, deleteOut);
 }
 
-
 void CompressFloat::scaleColumnOnGet (Array<Float>& array,
 				      const Array<Short>& target)
 {
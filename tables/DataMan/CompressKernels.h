@@ -0,0 +1,135 @@
+//# CompressKernels.h: Kernels for scaling arrays in the compression engines
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_COMPRESSKERNELS_H
+#define TABLES_COMPRESSKERNELS_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArrayMathKernels.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// The functions in this namespace are used by CompressFloat and
+// CompressComplex to find the min/max and to scale the data.
+// Their loops do not branch on the data values, but select the result
+// of a comparison, so the compiler can vectorize them. Large arrays
+// are processed in parallel chunks (see ArrayMathKernels.h).
+namespace compress_internal {
+
+// Test if a value is finite. Unlike isFinite, it is a single comparison
+// (false for NaN), which can be vectorized.
+inline Bool finiteValue (Float v)
+  { return std::abs(v) <= std::numeric_limits<Float>::max(); }
+
+// Round to the nearest integer, where halfway values are rounded away
+// from zero. It is done in double precision, so no rounding error is
+// made in adding 0.5. The value must fit in an Int.
+inline Int roundAway (Float v)
+  { return Int(Double(v) + (v < 0  ?  -0.5 : 0.5)); }
+
+// Execute func(i) for each i in [0,n). Large arrays are processed in
+// parallel chunks, so func must only write element i.
+template<typename Func>
+inline void parallelLoop (size_t n, Func func)
+{
+  arrays_internal::parallelChunks
+    (n, arrays_internal::parallelNChunk(n),
+     [&func] (size_t, size_t st, size_t len)
+     {
+       const size_t end = st + len;
+       for (size_t i=st; i<end; ++i) {
+         func (i);
+       }
+     });
+}
+
+// Find the minimum and maximum of the finite values of n elements.
+// func(i, lo, hi) gives the lowest and highest finite value of element i
+// (an element can have multiple values, e.g. a complex number). For an
+// element without finite values, lo must be +inf and hi -inf.
+// The min/max are set to NaN if no finite values are found.
+// <br>Independent lanes are used, so the loop can be vectorized.
+template<typename Func>
+inline void finiteMinMax (Float& minVal, Float& maxVal, size_t n, Func func)
+{
+  using arrays_internal::laneKernelWidth;
+  const Float inf = std::numeric_limits<Float>::infinity();
+  const size_t nchunk = arrays_internal::parallelNChunk (n);
+  std::vector<Float> pmin(nchunk, inf);
+  std::vector<Float> pmax(nchunk, -inf);
+  arrays_internal::parallelChunks
+    (n, nchunk,
+     [&] (size_t c, size_t st, size_t len)
+     {
+       Float lmin[laneKernelWidth];
+       Float lmax[laneKernelWidth];
+       for (size_t j=0; j<laneKernelWidth; ++j) {
+         lmin[j] = inf;
+         lmax[j] = -inf;
+       }
+       const size_t end = st + len;
+       size_t i = st;
+       for (; i+laneKernelWidth <= end; i+=laneKernelWidth) {
+         for (size_t j=0; j<laneKernelWidth; ++j) {
+           Float lo, hi;
+           func (i+j, lo, hi);
+           lmin[j] = lo < lmin[j]  ?  lo : lmin[j];
+           lmax[j] = hi > lmax[j]  ?  hi : lmax[j];
+         }
+       }
+       for (; i<end; ++i) {
+         Float lo, hi;
+         func (i, lo, hi);
+         lmin[0] = lo < lmin[0]  ?  lo : lmin[0];
+         lmax[0] = hi > lmax[0]  ?  hi : lmax[0];
+       }
+       for (size_t j=0; j<laneKernelWidth; ++j) {
+         pmin[c] = lmin[j] < pmin[c]  ?  lmin[j] : pmin[c];
+         pmax[c] = lmax[j] > pmax[c]  ?  lmax[j] : pmax[c];
+       }
+     });
+  minVal = inf;
+  maxVal = -inf;
+  for (size_t c=0; c<nchunk; ++c) {
+    minVal = pmin[c] < minVal  ?  pmin[c] : minVal;
+    maxVal = pmax[c] > maxVal  ?  pmax[c] : maxVal;
+  }
+  if (minVal > maxVal) {
+    setNaN (minVal);
+    setNaN (maxVal);
+  }
+}
+
+} //# NAMESPACE compress_internal
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -480,7 +480,7 @@ Vector<String> DataManInfo::removeDminfoColumns (Record& dminfo,
         dmcols.resize (ndmcol, True);
         rec.define ("COLUMNS", dmcols);
       }
-      newdm.defineRecord (j, rec);
+      newdm.defineRecord (newdm.nfields(), rec);
     }
   }
   dminfo = newdm;
@@ -41,14 +41,18 @@
 #include <casacore/tables/DataMan/ForwardCol.h>
 #include <casacore/tables/DataMan/VirtualTaQLColumn.h>
 #include <casacore/tables/DataMan/BitFlagsEngine.h>
+#include <casacore/tables/DataMan/LosslessCompressEngine.h>
 #include <casacore/tables/Tables/SetupNewTab.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/PlainTable.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/OS/DynLib.h>
+#include <casacore/casa/System/AipsrcValue.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/stdio.h>                     // for sprintf
+#include <atomic>
+#include <mutex>
 
 #ifdef HAVE_ADIOS2
 #include <casacore/tables/DataMan/Adios2StMan.h>
@@ -155,6 +159,9 @@ void DataManager::setMaximumCacheSize (uInt)
 void DataManager::showCacheStatistics (ostream&) const
 {}
 
+Record DataManager::cacheStatistics() const
+    { return Record(); }
+
 void DataManager::setTsmOption (const TSMOption& tsmOption)
 {
   AlwaysAssert (!multiFile_p, AipsError);
@@ -246,6 +253,31 @@ Bool DataManager::hasMultiFileSupport() const
 
 Bool DataManager::canReallocateColumns() const
     { return False; }
+Bool DataManager::canDeferOpen() const
+    { return False; }
+
+static std::atomic<Bool> theirConcurrentRead (False);
+static std::once_flag theirConcurrentReadInitFlag;
+
+static void initConcurrentRead()
+{
+    Bool concurrentRead;
+    AipsrcValue<Bool>::find (concurrentRead, "table.concurrentread", False);
+    theirConcurrentRead = concurrentRead;
+}
+
+void DataManager::setConcurrentRead (Bool concurrentRead)
+{
+    std::call_once (theirConcurrentReadInitFlag, initConcurrentRead);
+    theirConcurrentRead = concurrentRead;
+}
+
+Bool DataManager::concurrentRead()
+{
+    std::call_once (theirConcurrentReadInitFlag, initConcurrentRead);
+    return theirConcurrentRead;
+}
+
 DataManagerColumn* DataManager::reallocateColumn (DataManagerColumn* column)
     { return column; }
 
@@ -330,12 +362,20 @@ void DataManager::removeColumn (DataManagerColumn*)
 
 
 
-//# Initialize the static map of "constructors".
+//# Get the static map of "constructors".
+//# It is created (and filled with the main data managers) at first use.
+std::map<String,DataManagerCtor>& DataManager::registerMap()
+{
+    static std::map<String,DataManagerCtor> theirRegisterMap(initRegisterMap());
+    return theirRegisterMap;
+}
 // Use a recursive mutex, because loading from a shared library can cause
 // a nested lock.
-std::map<String,DataManagerCtor>
-        DataManager::theirRegisterMap(initRegisterMap());
-std::recursive_mutex DataManager::theirMutex;
+std::recursive_mutex& DataManager::registerMutex()
+{
+    static std::recursive_mutex theirMutex;
+    return theirMutex;
+}
 // Define the nr of rows fitting in an Int which is used by the data
 // managers. Test programs can set it to a lower value to test storing
 // 64-bit rownrs without the need of having very large tables.
@@ -345,15 +385,16 @@ rownr_t DataManager::MAXROWNR32 (2147483647);
 //# Register a mapping.
 void DataManager::registerCtor (const String& type, DataManagerCtor func)
 {
-    std::lock_guard<std::recursive_mutex> lock(theirMutex);
-    theirRegisterMap.insert (std::make_pair(type, func));
+    std::lock_guard<std::recursive_mutex> lock(registerMutex());
+    registerMap().insert (std::make_pair(type, func));
 }
 
 //# Test if the data manager is registered.
 Bool DataManager::isRegistered (const String& type)
 {
-    std::lock_guard<std::recursive_mutex> lock(theirMutex);
-    return theirRegisterMap.find(type) != theirRegisterMap.end();
+    std::lock_guard<std::recursive_mutex> lock(registerMutex());
+    const std::map<String,DataManagerCtor>& regMap = registerMap();
+    return regMap.find(type) != regMap.end();
 }
 
 //# Get a data manager constructor.
@@ -361,9 +402,10 @@ Bool DataManager::isRegistered (const String& type)
 //# after having tried to load it from a shared library.
 DataManagerCtor DataManager::getCtor (const String& type)
 {
-    std::lock_guard<std::recursive_mutex> lock(theirMutex);
-    std::map<String,DataManagerCtor>::const_iterator iter = theirRegisterMap.find (type);
-    if (iter != theirRegisterMap.end()) {
+    std::lock_guard<std::recursive_mutex> lock(registerMutex());
+    const std::map<String,DataManagerCtor>& regMap = registerMap();
+    std::map<String,DataManagerCtor>::const_iterator iter = regMap.find (type);
+    if (iter != regMap.end()) {
         return iter->second;
     }
     // Try to load the data manager from a dynamic library with that name
@@ -382,8 +424,8 @@ DataManagerCtor DataManager::getCtor (const String& type)
               "register_"+libname, False);
     if (dl.getHandle()) {
         // See if registered now.
-        iter = theirRegisterMap.find (type);
-        if (iter != theirRegisterMap.end()) {
+        iter = regMap.find (type);
+        if (iter != regMap.end()) {
             return iter->second;
         }
     }
@@ -407,45 +449,68 @@ DataManager* DataManager::unknownDataManager (const String& type,
 //# Register all mappings of the names of classes derived from
 //# DataManager to a static function calling the default constructor.
 //# The class name is the name as returned by the function dataManagerType.
-// No locking since private and only called by ctor of static member init.
+// No locking since private and only called by the initialization of the
+// static map in registerMap.
 std::map<String,DataManagerCtor> DataManager::initRegisterMap()
 {
   std::map<String,DataManagerCtor> regMap;
 
-  theirRegisterMap.insert (std::make_pair("StManAipsIO",      StManAipsIO::makeObject));
-  theirRegisterMap.insert (std::make_pair("StandardStMan",    StandardStMan::makeObject));
-  theirRegisterMap.insert (std::make_pair("IncrementalStMan", IncrementalStMan::makeObject));
-  theirRegisterMap.insert (std::make_pair("TiledDataStMan",   TiledDataStMan::makeObject));
-  theirRegisterMap.insert (std::make_pair("TiledCellStMan",   TiledCellStMan::makeObject));
-  theirRegisterMap.insert (std::make_pair("TiledColumnStMan", TiledColumnStMan::makeObject));
-  theirRegisterMap.insert (std::make_pair("TiledShapeStMan",  TiledShapeStMan::makeObject));
-  theirRegisterMap.insert (std::make_pair("MemoryStMan",      MemoryStMan::makeObject));
+  regMap.insert (std::make_pair("StManAipsIO",      StManAipsIO::makeObject));
+  regMap.insert (std::make_pair("StandardStMan",    StandardStMan::makeObject));
+  regMap.insert (std::make_pair("IncrementalStMan", IncrementalStMan::makeObject));
+  regMap.insert (std::make_pair("TiledDataStMan",   TiledDataStMan::makeObject));
+  regMap.insert (std::make_pair("TiledCellStMan",   TiledCellStMan::makeObject));
+  regMap.insert (std::make_pair("TiledColumnStMan", TiledColumnStMan::makeObject));
+  regMap.insert (std::make_pair("TiledShapeStMan",  TiledShapeStMan::makeObject));
+  regMap.insert (std::make_pair("MemoryStMan",      MemoryStMan::makeObject));
 #ifdef HAVE_ADIOS2
-  theirRegisterMap.insert (std::make_pair("Adios2StMan",      Adios2StMan::makeObject));
+  regMap.insert (std::make_pair("Adios2StMan",      Adios2StMan::makeObject));
 #endif
 
 #ifdef HAVE_DYSCO
-  theirRegisterMap.insert (std::make_pair("DyscoStMan", dyscostman::DyscoStMan::makeObject));
+  regMap.insert (std::make_pair("DyscoStMan", dyscostman::DyscoStMan::makeObject));
 #endif
   
-  theirRegisterMap.insert (std::make_pair(CompressFloat::className(),
+  regMap.insert (std::make_pair(CompressFloat::className(),
                                           CompressFloat::makeObject));
-  theirRegisterMap.insert (std::make_pair(CompressComplex::className(),
+  regMap.insert (std::make_pair(CompressComplex::className(),
                                           CompressComplex::makeObject));
-  theirRegisterMap.insert (std::make_pair(CompressComplexSD::className(),
+  regMap.insert (std::make_pair(CompressComplexSD::className(),
                                           CompressComplexSD::makeObject));
-  theirRegisterMap.insert (std::make_pair(MappedArrayEngine<Complex,DComplex>::className(),
+  regMap.insert (std::make_pair(MappedArrayEngine<Complex,DComplex>::className(),
                                           MappedArrayEngine<Complex,DComplex>::makeObject));
-  theirRegisterMap.insert (std::make_pair(ForwardColumnEngine::className(),
+  regMap.insert (std::make_pair(ForwardColumnEngine::className(),
                                           ForwardColumnEngine::makeObject));
-  theirRegisterMap.insert (std::make_pair(VirtualTaQLColumn::className(),
+  regMap.insert (std::make_pair(VirtualTaQLColumn::className(),
                                           VirtualTaQLColumn::makeObject));
-  theirRegisterMap.insert (std::make_pair(BitFlagsEngine<uChar>::className(),
+  regMap.insert (std::make_pair(BitFlagsEngine<uChar>::className(),
                                           BitFlagsEngine<uChar>::makeObject));
-  theirRegisterMap.insert (std::make_pair(BitFlagsEngine<Short>::className(),
+  regMap.insert (std::make_pair(BitFlagsEngine<Short>::className(),
                                           BitFlagsEngine<Short>::makeObject));
-  theirRegisterMap.insert (std::make_pair(BitFlagsEngine<Int>::className(),
+  regMap.insert (std::make_pair(BitFlagsEngine<Int>::className(),
                                           BitFlagsEngine<Int>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<Bool>::className(),
+                                          LosslessCompressEngine<Bool>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<uChar>::className(),
+                                          LosslessCompressEngine<uChar>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<Short>::className(),
+                                          LosslessCompressEngine<Short>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<uShort>::className(),
+                                          LosslessCompressEngine<uShort>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<Int>::className(),
+                                          LosslessCompressEngine<Int>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<uInt>::className(),
+                                          LosslessCompressEngine<uInt>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<Int64>::className(),
+                                          LosslessCompressEngine<Int64>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<Float>::className(),
+                                          LosslessCompressEngine<Float>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<Double>::className(),
+                                          LosslessCompressEngine<Double>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<Complex>::className(),
+                                          LosslessCompressEngine<Complex>::makeObject));
+  regMap.insert (std::make_pair(LosslessCompressEngine<DComplex>::className(),
+                                          LosslessCompressEngine<DComplex>::makeObject));
 
   return regMap;
 }
@@ -276,6 +276,28 @@ public:
     // By default it returns False.
     virtual Bool canReallocateColumns() const;
 
+    // Can opening the data manager be deferred until one of its columns
+    // is accessed? That is only possible if opening it does not change
+    // the number of rows in the table (see ColumnSet::getFile).
+    // By default it returns False.
+    virtual Bool canDeferOpen() const;
+
+    // Set or get if the storage managers of read-only tables can be read by
+    // multiple threads simultaneously. It is checked when a storage manager
+    // is opened. The standard storage managers (StandardStMan,
+    // IncrementalStMan and the TiledStMan's) then read their buckets
+    // through a thread-safe ShardedBucketCache and do not keep the
+    // state of the last access in their column objects.
+    // It requires that the table is opened without (auto)locking
+    // (e.g., TableLock::NoLocking) and that the column objects are created
+    // before the threads start reading.
+    // <br>Initially it is set from the aipsrc variable
+    // <src>table.concurrentread</src> (default False).
+    // <group>
+    static void setConcurrentRead (Bool concurrentRead);
+    static Bool concurrentRead();
+    // </group>
+
     // Reallocate the column object if it is part of this data manager.
     // It returns a pointer to the new column object.
     // This function is used by the tiling storage manager.
@@ -350,6 +372,10 @@ public:
     // Show the data manager's IO statistics. By default it does nothing.
     virtual void showCacheStatistics (std::ostream&) const;
 
+    // Get the data manager's cache and IO statistics as a record.
+    // The contents depend on the data manager; by default it is empty.
+    virtual Record cacheStatistics() const;
+
     // Create a column in the data manager on behalf of a table column.
     // It calls makeXColumn and checks the data type.
     // <group>
@@ -514,10 +540,14 @@ private:
     virtual uInt resync1 (uInt nrrow);
     // </group>
 
-    // Declare the mapping of the data manager type name to a static
-    // "makeObject" function.
-    static std::map<String,DataManagerCtor> theirRegisterMap;
-    static std::recursive_mutex theirMutex;
+    // Get the mapping of the data manager type name to a static
+    // "makeObject" function and the mutex protecting it.
+    // They are created at first use, so data managers can be registered
+    // during static initialization (see class DataManagerRegistrar).
+    // <group>
+    static std::map<String,DataManagerCtor>& registerMap();
+    static std::recursive_mutex& registerMutex();
+    // </group>
 
 public:
     // Has the object already been cloned?
@@ -538,7 +568,7 @@ public:
     // Test if a data manager is registered (thread-safe).
     static Bool isRegistered (const String& dataManagerType);
 
-    // Serve as default function for theirRegisterMap, which catches all
+    // Serve as default function for the register map, which catches all
     // unknown data manager types.
     // <thrown>
     //   <li> TableUnknownDataManager
@@ -557,6 +587,44 @@ private:
 };
 
 
+// <summary>
+// Register a data manager during static initialization
+// </summary>
+
+// <use visibility=export>
+
+// <synopsis>
+// Defining a static DataManagerRegistrar object registers the construction
+// function of a data manager when the library containing it is loaded.
+// If an application is linked with that library, the data manager can be
+// used without finding and loading the library at run time using DynLib,
+// which involves searching the file system.
+// <br>Note that when linking statically, the object file containing the
+// registrar has to be referenced to be linked in.
+// </synopsis>
+
+// <example>
+// <srcblock>
+// // In MyStMan.cc
+// static DataManagerRegistrar theirMyStManRegistrar ("MyStMan",
+//                                                    MyStMan::makeObject);
+// </srcblock>
+// </example>
+
+class DataManagerRegistrar
+{
+public:
+    // Register the data manager type with its "constructor".
+    DataManagerRegistrar (const String& type, DataManagerCtor func)
+      { DataManager::registerCtor (type, func); }
+
+    // Call a function registering one or more data managers
+    // (such as <src>register_dyscostman</src>).
+    explicit DataManagerRegistrar (void (*registerFunc)())
+      { registerFunc(); }
+};
+
+
 } //# NAMESPACE CASACORE - END
 
 #endif
@@ -27,10 +27,13 @@
 //# Includes
 #include <casacore/tables/DataMan/DataManagerColumn.h>
 #include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/DataMan/StringDictionary.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/OS/Conversion.h>
 #include <casacore/tables/DataMan/DataManError.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -291,6 +294,41 @@ void DataManagerColumn::putArrayV (rownr_t, const ArrayBase&)
   throw DataManError("putArrayV not implemented"
                      " for column " + columnName());
 }
+void DataManagerColumn::getPackedBoolV (rownr_t rownr, const IPosition& shape,
+                                        uChar* bits)
+{
+  Array<Bool> arr(shape);
+  getArrayV (rownr, arr);
+  Conversion::boolToBit (bits, arr.data(), arr.size());
+}
+void DataManagerColumn::putPackedBoolV (rownr_t rownr, const IPosition& shape,
+                                        const uChar* bits)
+{
+  Array<Bool> arr(shape);
+  Conversion::bitToBool (arr.data(), bits, arr.size());
+  putArrayV (rownr, arr);
+}
+void DataManagerColumn::getStringCodesV (const RefRows& rownrs, uInt* codes,
+                                         StringDictionary& dictionary)
+{
+  if (dataType() != TpString) {
+    throw DataManInvOper ("DataManagerColumn::getStringCodesV: column " +
+                          columnName() + " does not contain Strings");
+  }
+  String value;
+  RefRowsSliceIter iter(rownrs);
+  while (! iter.pastEnd()) {
+    rownr_t rownr = iter.sliceStart();
+    rownr_t end   = iter.sliceEnd();
+    rownr_t incr  = iter.sliceIncr();
+    while (rownr <= end) {
+      getString (rownr, &value);
+      *codes++ = dictionary.code (value);
+      rownr += incr;
+    }
+    iter++;
+  }
+}
 void DataManagerColumn::getArrayColumnV (ArrayBase& arr)
 {
   getArrayColumnBase (arr);
@@ -41,6 +41,7 @@ class IPosition;
 class Slicer;
 class RefRows;
 class ArrayBase;
+class StringDictionary;
 
 
 // <summary>
@@ -347,6 +348,31 @@ public:
     // The default implementation throws an "invalid operation" exception.
     virtual void putArrayV (rownr_t rownr, const ArrayBase& data);
 
+    // Get the Bool array in the given row as packed bits (in the order
+    // used by <linkto class=Conversion>Conversion::boolToBit</linkto>).
+    // The buffer <src>bits</src> must hold <src>(shape.product()+7)/8</src>
+    // bytes, where <src>shape</src> is the shape of the array in the row.
+    // The default implementation does getArrayV and packs the result.
+    // Storage managers keeping Bools as bits can copy them directly.
+    virtual void getPackedBoolV (rownr_t rownr, const IPosition& shape,
+                                 uChar* bits);
+
+    // Put packed bits into the Bool array in the given row.
+    // The default implementation unpacks them and does putArrayV.
+    virtual void putPackedBoolV (rownr_t rownr, const IPosition& shape,
+                                 const uChar* bits);
+
+    // Get the values of a String column in the given rows as codes in
+    // a dictionary of the distinct values (see
+    // <linkto class=StringDictionary>StringDictionary</linkto>).
+    // The buffer <src>codes</src> must hold <src>rownrs.nrow()</src>
+    // values. The dictionary can already contain values (e.g. when
+    // called for multiple tables).
+    // The default implementation gets the strings one by one into the
+    // same buffer, so only a String per distinct value is made.
+    virtual void getStringCodesV (const RefRows& rownrs, uInt* codes,
+                                  StringDictionary& dictionary);
+
     // Get all array values in the column.
     // The array given in <src>data</src> has to have the correct shape
     // (which is guaranteed by the ArrayColumn getColumn function).
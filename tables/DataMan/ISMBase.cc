@@ -35,11 +35,13 @@
 #include <casacore/casa/Utilities/ValType.h>
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/ShardedBucketCache.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/IO/CanonicalIO.h>
 #include <casacore/casa/IO/LECanonicalIO.h>
 #include <casacore/casa/IO/FiledesIO.h>
 #include <casacore/casa/OS/DOos.h>
+#include <algorithm>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/ostream.h>
 
@@ -53,6 +55,7 @@ ISMBase::ISMBase (uInt bucketSize, Bool checkBucketSize, uInt cacheSize)
   iosfile_p         (0),
   uniqnr_p          (0),
   cache_p           (0),
+  sharedCache_p     (0),
   file_p            (0),
   index_p           (0),
   persCacheSize_p   (cacheSize),
@@ -74,6 +77,7 @@ ISMBase::ISMBase (const String& dataManagerName,
   iosfile_p         (0),
   uniqnr_p          (0),
   cache_p           (0),
+  sharedCache_p     (0),
   file_p            (0),
   index_p           (0),
   persCacheSize_p   (cacheSize),
@@ -94,6 +98,7 @@ ISMBase::ISMBase (const String& dataManagerName, const Record& spec)
   iosfile_p         (0),
   uniqnr_p          (0),
   cache_p           (0),
+  sharedCache_p     (0),
   file_p            (0),
   index_p           (0),
   persCacheSize_p   (1),
@@ -124,6 +129,7 @@ ISMBase::ISMBase (const ISMBase& that)
   iosfile_p         (0),
   uniqnr_p          (0),
   cache_p           (0),
+  sharedCache_p     (0),
   file_p            (0),
   index_p           (0),
   persCacheSize_p   (that.persCacheSize_p),
@@ -143,6 +149,7 @@ ISMBase::~ISMBase()
 	delete colSet_p[i];
     }
     delete index_p;
+    delete sharedCache_p;
     delete cache_p;
     delete file_p;
     delete [] tempBuffer_p;
@@ -192,6 +199,9 @@ void ISMBase::clearCache()
     if (cache_p != 0) {
 	cache_p->clear();
     }
+    if (sharedCache_p != 0) {
+	sharedCache_p->clear();
+    }
 }
 
 void ISMBase::showCacheStatistics (ostream& os) const
@@ -201,6 +211,19 @@ void ISMBase::showCacheStatistics (ostream& os) const
 	cache_p->showStatistics (os);
 	os << "<<<" << endl;
     }
+    if (sharedCache_p != 0) {
+	os << ">>> IncrementalStMan shared cache statistics:" << endl;
+	sharedCache_p->showStatistics (os);
+	os << "<<<" << endl;
+    }
+}
+
+Record ISMBase::cacheStatistics() const
+{
+    if (cache_p != 0) {
+	return cache_p->statistics();
+    }
+    return Record();
 }
 
 void ISMBase::showIndexStatistics (ostream& os)
@@ -270,6 +293,9 @@ void ISMBase::setCacheSize (uInt cacheSize, Bool canExceedNrBuckets)
     if (cache_p != 0) {
 	cache_p->resize (cacheSize_p);
     }
+    if (sharedCache_p != 0) {
+	makeSharedCache();
+    }
 }
 
 void ISMBase::makeCache()
@@ -295,6 +321,20 @@ void ISMBase::makeCache()
     }
 }
 
+void ISMBase::makeSharedCache()
+{
+    // The index and bucket cache are also needed.
+    getCache();
+    delete sharedCache_p;
+    sharedCache_p = 0;
+    sharedCache_p = new ShardedBucketCache (file_p, 512, bucketSize_p,
+                                            nbucketInit_p,
+                                            std::max(cacheSize_p, 1u), 0,
+                                            this,
+                                            ISMBucket::readCallBack,
+                                            ISMBucket::deleteCallBack);
+}
+
 void ISMBase::makeIndex()
 {
     if (index_p != 0) {
@@ -404,6 +444,20 @@ ISMBucket* ISMBase::getBucket (rownr_t rownr, rownr_t& bucketStartRow,
     return (ISMBucket*) (getCache().getBucket (bucketNr));
 }
 
+const ISMBucket* ISMBase::getBucket (rownr_t rownr, rownr_t& bucketStartRow,
+                                     rownr_t& bucketNrrow,
+                                     std::shared_ptr<const char>& holder)
+{
+    if (sharedCache_p == 0) {
+        return getBucket (rownr, bucketStartRow, bucketNrrow);
+    }
+    // The index does not change while read by multiple threads.
+    uInt bucketNr = index_p->getBucketNr (rownr, bucketStartRow,
+                                          bucketNrrow);
+    holder = sharedCache_p->getBucket (bucketNr);
+    return reinterpret_cast<const ISMBucket*> (holder.get());
+}
+
 ISMBucket* ISMBase::nextBucket (uInt& cursor, rownr_t& bucketStartRow,
 				rownr_t& bucketNrrow)
 {
@@ -434,6 +488,11 @@ Bool ISMBase::canAddRow() const
 {
     return True;
 }
+
+Bool ISMBase::canDeferOpen() const
+{
+    return True;
+}
 //# The storage manager can delete rows.
 Bool ISMBase::canRemoveRow() const
 {
@@ -529,6 +588,8 @@ void ISMBase::removeColumn (DataManagerColumn* colp)
 
 void ISMBase::recreate()
 {
+    delete sharedCache_p;
+    sharedCache_p = 0;
     delete index_p;
     index_p = 0;
     delete cache_p;
@@ -590,6 +651,9 @@ rownr_t ISMBase::resync64 (rownr_t nrrow)
     if (cache_p != 0) {
 	cache_p->resync (nbucketInit_p, nFreeBucket_p, firstFree_p);
     }
+    if (sharedCache_p != 0) {
+	makeSharedCache();
+    }
     uInt nrcol = ncolumn();
     for (uInt i=0; i<nrcol; i++) {
 	colSet_p[i]->resync (nrrow_p);
@@ -631,6 +695,12 @@ rownr_t ISMBase::open64 (rownr_t tabNrrow, AipsIO& ios)
     for (uInt i=0; i<nrcol; i++) {
 	colSet_p[i]->getFile (nrrow_p);
     }
+    //# If read by multiple threads, the index and caches are created
+    //# now instead of on first access.
+    if (DataManager::concurrentRead()  &&  !table().isWritable()  &&
+        !file_p->isMultiFile()) {
+        makeSharedCache();
+    }
     return nrrow_p;
 }
 
@@ -645,6 +715,9 @@ StManArrayFile* ISMBase::openArrayFile (ByteIO::OpenOption opt)
 
 void ISMBase::reopenRW()
 {
+    //# The shared cache can only be used for a read-only file.
+    delete sharedCache_p;
+    sharedCache_p = 0;
     file_p->setRW();
     uInt nrcol = ncolumn();
     for (uInt i=0; i<nrcol; i++) {
@@ -656,6 +729,8 @@ void ISMBase::deleteManager()
 {
     delete iosfile_p;
     iosfile_p = 0;
+    delete sharedCache_p;
+    sharedCache_p = 0;
     // Clear cache without flushing.
     if (cache_p != 0) {
       cache_p->clear (0, False);
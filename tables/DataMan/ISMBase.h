@@ -32,12 +32,15 @@
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/iosfwd.h>
+#include <memory>
+#include <mutex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward declarations
 class BucketCache;
 class BucketFile;
+class ShardedBucketCache;
 class ISMBucket;
 class ISMIndex;
 class ISMColumn;
@@ -154,6 +157,9 @@ public:
     // Show the statistics of all caches used.
     virtual void showCacheStatistics (ostream& os) const;
 
+    // Get the statistics of the cache and bucket file as a record.
+    virtual Record cacheStatistics() const;
+
     // Show the index statistics.
     void showIndexStatistics (ostream& os);
 
@@ -175,6 +181,23 @@ public:
     ISMBucket* getBucket (rownr_t rownr, rownr_t& bucketStartRow,
 			  rownr_t& bucketNrrow);
 
+    // Get the bucket containing the given row for a read.
+    // If the storage manager is read by multiple threads, the bucket is
+    // taken from the thread-safe cache and <src>holder</src> keeps it
+    // alive while being used.
+    const ISMBucket* getBucket (rownr_t rownr, rownr_t& bucketStartRow,
+                                rownr_t& bucketNrrow,
+                                std::shared_ptr<const char>& holder);
+
+    // Is the storage manager read by multiple threads
+    // (see <src>DataManager::setConcurrentRead</src>)?
+    Bool isConcurrent() const;
+
+    // Get a lock serializing the access to the indirect arrays if the
+    // storage manager is read by multiple threads; otherwise the lock
+    // returned does not own the mutex.
+    std::unique_lock<std::mutex> lockConcurrent();
+
     // Get the next bucket.
     // cursor=0 indicates the start of the iteration.
     // The first bucket returned is the bucket containing the rownr
@@ -199,6 +222,9 @@ public:
     // Can the storage manager add rows? (yes)
     virtual Bool canAddRow() const;
 
+    // Can opening the storage manager be deferred? (yes)
+    virtual Bool canDeferOpen() const;
+
     // Can the storage manager delete rows? (yes)
     virtual Bool canRemoveRow() const;
 
@@ -328,6 +354,9 @@ private:
     // Construct the cache object (if not constructed yet).
     void makeCache();
 
+    // (Re)construct the thread-safe cache used if read by multiple threads.
+    void makeSharedCache();
+
     // Construct the index object (if not constructed yet) and read it.
     void makeIndex();
 
@@ -353,6 +382,10 @@ private:
     PtrBlock<ISMColumn*>  colSet_p;
     // The cache with the ISM buckets.
     BucketCache* cache_p;
+    // The thread-safe cache used if read by multiple threads.
+    ShardedBucketCache* sharedCache_p;
+    // The mutex used by lockConcurrent.
+    std::mutex mutex_p;
     // The file containing all data.
     BucketFile*  file_p;
     // The ISM bucket index.
@@ -422,6 +455,19 @@ inline char* ISMBase::tempBuffer() const
     return tempBuffer_p;
 }
 
+inline Bool ISMBase::isConcurrent() const
+{
+    return sharedCache_p != 0;
+}
+
+inline std::unique_lock<std::mutex> ISMBase::lockConcurrent()
+{
+    if (sharedCache_p != 0) {
+        return std::unique_lock<std::mutex> (mutex_p);
+    }
+    return std::unique_lock<std::mutex> (mutex_p, std::defer_lock);
+}
+
 inline BucketCache& ISMBase::getCache()
 {
     if (cache_p == 0) {
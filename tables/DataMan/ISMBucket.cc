@@ -36,6 +36,7 @@
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -186,10 +187,12 @@ void ISMBucket::addData (uInt colnr, rownr_t rownr, uInt index,
     DebugAssert ((index == 0  ||  rowIndex[index-1] < rownr)  &&
 		 (index <= nrused)  &&
 		 (index == nrused  ||  rowIndex[index] >= rownr), AipsError);
-    // Extend blocks if needed.
+    // Extend blocks if needed. Grow them geometrically, because appending
+    // rows one by one adds an entry per put.
     if (offIndex.nelements() <= nrused) {
-	rowIndex.resize (nrused + 32);
-	offIndex.resize (nrused + 32);
+	uInt newSize = std::max (nrused + 32, 2*nrused);
+	rowIndex.resize (newSize);
+	offIndex.resize (newSize);
     }
     // Increment row if the same row is being added.
     if (index < nrused  &&  rownr == rowIndex[index]) {
@@ -176,65 +176,89 @@ void ISMColumn::remove (rownr_t bucketRownr, ISMBucket* bucket, rownr_t bucketNr
 }
 
 
+template<typename T>
+void ISMColumn::getCell (rownr_t rownr, T* value)
+{
+    if (stmanPtr_p->isConcurrent()) {
+        rownr_t startRow, endRow;
+        readValue (rownr, value, startRow, endRow);
+    } else {
+        getValue (rownr, lastValue_p, True);
+        *value = *(T*)lastValue_p;
+    }
+}
+
+template<typename T>
+void ISMColumn::getCellsConcurrent (const RefRows& rownrs, T* value)
+{
+    // Keep the row interval of the last value read locally.
+    rownr_t startRow = 1;
+    rownr_t endRow   = 0;
+    const T* lastValue = 0;
+    RefRowsSliceIter iter(rownrs);
+    while (! iter.pastEnd()) {
+        rownr_t end  = iter.sliceEnd();
+        rownr_t incr = iter.sliceIncr();
+        for (rownr_t rownr=iter.sliceStart(); rownr<=end; rownr+=incr) {
+            if (rownr < startRow  ||  rownr > endRow) {
+                readValue (rownr, value, startRow, endRow);
+                lastValue = value;
+            } else {
+                *value = *lastValue;
+            }
+            value++;
+        }
+        iter++;
+    }
+}
+
 void ISMColumn::getBool (rownr_t rownr, Bool* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Bool*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getuChar (rownr_t rownr, uChar* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(uChar*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getShort (rownr_t rownr, Short* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Short*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getuShort (rownr_t rownr, uShort* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(uShort*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getInt (rownr_t rownr, Int* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Int*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getuInt (rownr_t rownr, uInt* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(uInt*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getInt64 (rownr_t rownr, Int64* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Int64*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getfloat (rownr_t rownr, float* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(float*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getdouble (rownr_t rownr, double* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(double*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getComplex (rownr_t rownr, Complex* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Complex*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getDComplex (rownr_t rownr, DComplex* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(DComplex*)lastValue_p;
+    getCell (rownr, value);
 }
 void ISMColumn::getString (rownr_t rownr, String* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(String*)lastValue_p;
+    getCell (rownr, value);
 }
 
 void ISMColumn::getScalarColumnV (ArrayBase& dataPtr)
@@ -329,6 +353,15 @@ void ISMColumn::getScalarColumnCellsV (const RefRows& rows, ArrayBase& dataPtr)
 void ISMColumn::getScaCol (Vector<T>& dataPtr) \
 { \
     rownr_t nrrow = dataPtr.nelements(); \
+    if (stmanPtr_p->isConcurrent()) { \
+        if (nrrow > 0) { \
+            Bool delV; \
+            T* value = dataPtr.getStorage (delV); \
+            getCellsConcurrent (RefRows(0, nrrow-1), value); \
+            dataPtr.putStorage (value, delV); \
+        } \
+        return; \
+    } \
     rownr_t rownr = 0; \
     while (rownr < nrrow) { \
         aips_name2(get,T) (rownr, &(dataPtr(rownr))); \
@@ -343,7 +376,9 @@ void ISMColumn::getScaColCells (const RefRows& rownrs, \
     Bool delV; \
     T* value = values.getStorage (delV); \
     T* valptr = value; \
-    if (rownrs.isSliced()) { \
+    if (stmanPtr_p->isConcurrent()) { \
+        getCellsConcurrent (rownrs, value); \
+    } else if (rownrs.isSliced()) { \
         RefRowsSliceIter iter(rownrs); \
         while (! iter.pastEnd()) { \
             rownr_t rownr = iter.sliceStart(); \
@@ -429,6 +464,26 @@ void ISMColumn::getValue (rownr_t rownr, void* value, Bool setCache)
   }
 }
 
+void ISMColumn::readValue (rownr_t rownr, void* value,
+                           rownr_t& startRow, rownr_t& endRow)
+{
+    // Get the bucket with its row number boundaries.
+    // The holder keeps the bucket alive while it is used.
+    rownr_t bucketStartRow;
+    rownr_t bucketNrrow;
+    std::shared_ptr<const char> holder;
+    const ISMBucket* bucket = stmanPtr_p->getBucket (rownr, bucketStartRow,
+                                                     bucketNrrow, holder);
+    // Get the interval in the bucket with its rownr boundaries.
+    rownr -= bucketStartRow;
+    uInt offset;
+    rownr_t stint, endint;
+    bucket->getInterval (colnr_p, rownr, bucketNrrow, stint, endint, offset);
+    readFunc_p (value, bucket->get (offset), nrcopy_p);
+    startRow = bucketStartRow + stint;
+    endRow   = bucketStartRow + endint;
+}
+
 void ISMColumn::putBool (rownr_t rownr, const Bool* value)
 {
     putValue (rownr, value);
@@ -610,6 +665,15 @@ void ISMColumn::putScaCol (const Vector<String>& dataPtr)
 
 void ISMColumn::getArrayV (rownr_t rownr, ArrayBase& value)
 {
+    if (stmanPtr_p->isConcurrent()) {
+        // Read directly into the array (also for strings).
+        rownr_t startRow, endRow;
+        Bool deleteIt;
+        void* vptr = value.getVStorage(deleteIt);
+        readValue (rownr, vptr, startRow, endRow);
+        value.putVStorage (vptr, deleteIt);
+        return;
+    }
     getValue (rownr, lastValue_p, False);
     if (dtype() == TpString) {
       value.assignBase (Array<String> (shape_p, (String*)lastValue_p, SHARE));
@@ -251,6 +251,12 @@ protected:
     // Set the cache if the flag is set.
     void getValue (rownr_t rownr, void* value, Bool setCache);
 
+    // Read the value for this row without using or changing the last
+    // value, so it can be used if the storage manager is read by multiple
+    // threads. It also returns the rows for which the value is valid.
+    void readValue (rownr_t rownr, void* value,
+                    rownr_t& startRow, rownr_t& endRow);
+
     // Put the value for this row.
     void putValue (rownr_t rownr, const void* value);
 
@@ -363,6 +369,16 @@ private:
     void getScaColCells (const RefRows&, Vector<DComplex>&);
     void getScaColCells (const RefRows&, Vector<String>&);
 
+    // Get the value of a row or the values of the given rows.
+    // If the storage manager is read by multiple threads, the value is
+    // read using <src>readValue</src>.
+    // <group>
+    template<typename T>
+    void getCell (rownr_t rownr, T* value);
+    template<typename T>
+    void getCellsConcurrent (const RefRows& rownrs, T* value);
+    // </group>
+
     void putScaCol (const Vector<Bool>&);
     void putScaCol (const Vector<uChar>&);
     void putScaCol (const Vector<Short>&);
@@ -186,14 +186,25 @@ StIndArray* ISMIndColumn::putShapeSliced (rownr_t rownr)
     return putArrayPtr (rownr, ptr->shape(), True);
 }
 
+//# The indirect array file and the last value are not thread-safe, so
+//# access is serialized if read by multiple threads.
 Bool ISMIndColumn::isShapeDefined (rownr_t rownr)
-    { return (getArrayPtr(rownr) == 0  ?  False : True); }
+{
+    std::unique_lock<std::mutex> lock (stmanPtr_p->lockConcurrent());
+    return (getArrayPtr(rownr) == 0  ?  False : True);
+}
 
 uInt ISMIndColumn::ndim (rownr_t rownr)
-    { return getShape(rownr)->shape().nelements(); }
+{
+    std::unique_lock<std::mutex> lock (stmanPtr_p->lockConcurrent());
+    return getShape(rownr)->shape().nelements();
+}
 
 IPosition ISMIndColumn::shape (rownr_t rownr)
-    { return getShape(rownr)->shape(); }
+{
+    std::unique_lock<std::mutex> lock (stmanPtr_p->lockConcurrent());
+    return getShape(rownr)->shape();
+}
 
 Bool ISMIndColumn::canChangeShape() const
     { return (shapeIsFixed_p  ?  False : True); }
@@ -240,14 +251,20 @@ StIndArray* ISMIndColumn::putArrayPtr (rownr_t rownr, const IPosition& shape,
 
 
 void ISMIndColumn::getArrayV (rownr_t rownr, ArrayBase& arr)
-    { getShape(rownr)->getArrayV (*iosfile_p, arr, dtype()); }
+{
+    std::unique_lock<std::mutex> lock (stmanPtr_p->lockConcurrent());
+    getShape(rownr)->getArrayV (*iosfile_p, arr, dtype());
+}
 
 void ISMIndColumn::putArrayV (rownr_t rownr, const ArrayBase& arr)
     { putShape(rownr, arr.shape())->putArrayV (*iosfile_p, arr, dtype()); }
 
 void ISMIndColumn::getSliceV (rownr_t rownr, const Slicer& ns,
                               ArrayBase& arr)
-    { getShape(rownr)->getSliceV (*iosfile_p, ns, arr, dtype()); }
+{
+    std::unique_lock<std::mutex> lock (stmanPtr_p->lockConcurrent());
+    getShape(rownr)->getSliceV (*iosfile_p, ns, arr, dtype());
+}
 
 void ISMIndColumn::putSliceV (rownr_t rownr, const Slicer& ns,
                               const ArrayBase& arr)
@@ -39,7 +39,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 ISMIndex::ISMIndex()
 : nused_p    (1),
   rows_p     (2, 0),
-  bucketNr_p (1, 0)
+  bucketNr_p (1, 0),
+  lastIndex_p(0)
 {}
 
 ISMIndex::~ISMIndex()
@@ -131,6 +132,18 @@ Int ISMIndex::removeRow (rownr_t rownr)
 
 uInt ISMIndex::getIndex (rownr_t rownr) const
 {
+    // Rows are usually accessed sequentially, so first try the bucket
+    // found last and the one thereafter.
+    // The index can be used by multiple threads, so the last index is
+    // atomic and copied (its exact value does not matter).
+    uInt lastIndex = lastIndex_p.load (std::memory_order_relaxed);
+    for (uInt index=lastIndex; index<nused_p && index<=lastIndex+1;
+         index++) {
+	if (rownr >= rows_p[index]  &&  rownr < rows_p[index+1]) {
+	    lastIndex_p.store (index, std::memory_order_relaxed);
+	    return index;
+	}
+    }
     // If no exact match, the interval starts at the previous index.
     Bool found;
     uInt index = binarySearchBrackets (found, rows_p, rownr, (uInt)nused_p+1);
@@ -138,6 +151,7 @@ uInt ISMIndex::getIndex (rownr_t rownr) const
 	index--;
     }
     AlwaysAssert (index <= nused_p, AipsError);
+    lastIndex_p.store (index, std::memory_order_relaxed);
     return index;
 }
 
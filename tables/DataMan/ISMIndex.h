@@ -29,6 +29,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Containers/Block.h>
+#include <atomic>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -131,6 +132,8 @@ public:
 
 private:
     // Get the index of the bucket containing the given row.
+    // The bucket found last and its successor are tried first, so
+    // sequential access does not need a binary search.
     uInt getIndex (rownr_t rownr) const;
 
 
@@ -141,6 +144,8 @@ private:
     Block<rownr_t>    rows_p;
     // Corresponding bucket number.
     Block<uInt>       bucketNr_p;
+    // Index found by the last getIndex call.
+    mutable std::atomic<uInt> lastIndex_p;
 };
 
 
@@ -0,0 +1,210 @@
+//# LosslessCompressEngine.cc: Virtual column engine to compress arrays losslessly
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/DataMan/LosslessCompressEngine.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/IO/LZ4Codec.h>
+#include <casacore/casa/OS/LECanonicalConversion.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <cstring>
+#include <sstream>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  // Size of the fixed part of the cell header.
+  static const size_t lceHeaderSize = 4;
+  static const uChar  lceVersion    = 1;
+  static const uChar  lceCompressed = 1;
+  static const uChar  lceShuffled   = 2;
+
+  void LCECellCodec::encode (std::vector<uChar>& cell, const IPosition& shape,
+                             const uChar* data, uInt elemSize, Bool shuffle)
+  {
+    size_t nbytes = shape.product() * elemSize;
+    size_t hdrSize = lceHeaderSize + shape.size() * 8;
+    cell.resize (hdrSize + LZ4Codec::maxCompressedSize (nbytes));
+    uChar* hdr = cell.data();
+    hdr[0] = lceVersion;
+    hdr[2] = uChar(elemSize);
+    hdr[3] = uChar(shape.size());
+    for (uInt i=0; i<shape.size(); ++i) {
+      LECanonicalConversion::fromLocal (hdr + lceHeaderSize + 8*i,
+                                        Int64(shape[i]));
+    }
+    std::vector<uChar> shuffled;
+    const uChar* src = data;
+    uChar flags = lceCompressed;
+    if (shuffle  &&  elemSize > 1) {
+      shuffled.resize (nbytes);
+      LZ4Codec::shuffle (shuffled.data(), data, nbytes/elemSize, elemSize);
+      src = shuffled.data();
+      flags |= lceShuffled;
+    }
+    size_t n = LZ4Codec::compress (cell.data() + hdrSize, src, nbytes);
+    if (n >= nbytes) {
+      // Store uncompressed if it does not get smaller.
+      memcpy (cell.data() + hdrSize, data, nbytes);
+      n = nbytes;
+      flags = 0;
+    }
+    cell[1] = flags;
+    cell.resize (hdrSize + n);
+  }
+
+  IPosition LCECellCodec::shape (const uChar* cell, size_t cellSize)
+  {
+    if (cellSize < lceHeaderSize  ||  cell[0] != lceVersion  ||
+        cellSize < lceHeaderSize + 8*size_t(cell[3])) {
+      throw DataManError ("LosslessCompressEngine: invalid cell header");
+    }
+    IPosition shp(cell[3]);
+    for (uInt i=0; i<shp.size(); ++i) {
+      Int64 v;
+      LECanonicalConversion::toLocal (v, cell + lceHeaderSize + 8*i);
+      shp[i] = v;
+    }
+    return shp;
+  }
+
+  void LCECellCodec::decode (uChar* data, size_t nbytes, uInt elemSize,
+                             const uChar* cell, size_t cellSize)
+  {
+    IPosition shp = shape (cell, cellSize);
+    if (cell[2] != elemSize  ||  size_t(shp.product()) * elemSize != nbytes) {
+      std::ostringstream msg;
+      msg << "LosslessCompressEngine: cell has shape " << shp
+          << " and element size " << Int(cell[2])
+          << "; mismatches the expected size";
+      throw DataManError (msg.str());
+    }
+    size_t hdrSize = lceHeaderSize + 8*shp.size();
+    const uChar* src = cell + hdrSize;
+    size_t srcSize = cellSize - hdrSize;
+    uChar flags = cell[1];
+    if ((flags & lceCompressed) == 0) {
+      if (srcSize != nbytes) {
+        throw DataManError ("LosslessCompressEngine: invalid cell size");
+      }
+      memcpy (data, src, nbytes);
+    } else if ((flags & lceShuffled) == 0) {
+      LZ4Codec::decompress (data, nbytes, src, srcSize);
+    } else {
+      std::vector<uChar> shuffled(nbytes);
+      LZ4Codec::decompress (shuffled.data(), nbytes, src, srcSize);
+      LZ4Codec::unshuffle (data, shuffled.data(), nbytes/elemSize, elemSize);
+    }
+  }
+
+  uInt LCECellCodec::nThreads (size_t nbytes)
+  {
+    const size_t minBytesPerThread = 1024*1024;
+    if (nbytes < 2*minBytesPerThread) {
+      return 1;
+    }
+    Int nthread;
+    AipsrcValue<Int>::find (nthread, "table.compress.nthreads", 0);
+    if (nthread <= 0) {
+      nthread = ThreadPool::concurrency();
+    }
+    return std::max (1, std::min (nthread, Int(nbytes / minBytesPerThread)));
+  }
+
+  void LCECellCodec::parallelFor (size_t n, uInt nthread,
+                                  const std::function<void(size_t)>& func)
+  {
+    if (nthread <= 1  ||  n <= 1) {
+      for (size_t i=0; i<n; ++i) {
+        func (i);
+      }
+      return;
+    }
+    // Each thread of the global pool handles a contiguous chunk.
+    nthread = std::min (size_t(nthread), n);
+    size_t chunkSize = (n + nthread - 1) / nthread;
+    ThreadPool::global().parallelFor (nthread, [&] (size_t chunk)
+      {
+        size_t end = std::min (n, (chunk+1) * chunkSize);
+        for (size_t i=chunk*chunkSize; i<end; ++i) {
+          func (i);
+        }
+      }, nthread);
+  }
+
+  void LCECellCodec::toCanonical (uChar* to, const Bool* from, size_t n)
+    { memcpy (to, from, n); }
+  void LCECellCodec::toCanonical (uChar* to, const uChar* from, size_t n)
+    { memcpy (to, from, n); }
+  void LCECellCodec::toCanonical (uChar* to, const Short* from, size_t n)
+    { LECanonicalConversion::fromLocal (to, from, n); }
+  void LCECellCodec::toCanonical (uChar* to, const uShort* from, size_t n)
+    { LECanonicalConversion::fromLocal (to, from, n); }
+  void LCECellCodec::toCanonical (uChar* to, const Int* from, size_t n)
+    { LECanonicalConversion::fromLocal (to, from, n); }
+  void LCECellCodec::toCanonical (uChar* to, const uInt* from, size_t n)
+    { LECanonicalConversion::fromLocal (to, from, n); }
+  void LCECellCodec::toCanonical (uChar* to, const Int64* from, size_t n)
+    { LECanonicalConversion::fromLocal (to, from, n); }
+  void LCECellCodec::toCanonical (uChar* to, const Float* from, size_t n)
+    { LECanonicalConversion::fromLocal (to, from, n); }
+  void LCECellCodec::toCanonical (uChar* to, const Double* from, size_t n)
+    { LECanonicalConversion::fromLocal (to, from, n); }
+  void LCECellCodec::toCanonical (uChar* to, const Complex* from, size_t n)
+    { LECanonicalConversion::fromLocal (to, reinterpret_cast<const Float*>(from), 2*n); }
+  void LCECellCodec::toCanonical (uChar* to, const DComplex* from, size_t n)
+    { LECanonicalConversion::fromLocal (to, reinterpret_cast<const Double*>(from), 2*n); }
+
+  void LCECellCodec::fromCanonical (Bool* to, const uChar* from, size_t n)
+  {
+    // Make sure that any non-zero byte is a valid Bool.
+    for (size_t i=0; i<n; ++i) {
+      to[i] = from[i] != 0;
+    }
+  }
+  void LCECellCodec::fromCanonical (uChar* to, const uChar* from, size_t n)
+    { memcpy (to, from, n); }
+  void LCECellCodec::fromCanonical (Short* to, const uChar* from, size_t n)
+    { LECanonicalConversion::toLocal (to, from, n); }
+  void LCECellCodec::fromCanonical (uShort* to, const uChar* from, size_t n)
+    { LECanonicalConversion::toLocal (to, from, n); }
+  void LCECellCodec::fromCanonical (Int* to, const uChar* from, size_t n)
+    { LECanonicalConversion::toLocal (to, from, n); }
+  void LCECellCodec::fromCanonical (uInt* to, const uChar* from, size_t n)
+    { LECanonicalConversion::toLocal (to, from, n); }
+  void LCECellCodec::fromCanonical (Int64* to, const uChar* from, size_t n)
+    { LECanonicalConversion::toLocal (to, from, n); }
+  void LCECellCodec::fromCanonical (Float* to, const uChar* from, size_t n)
+    { LECanonicalConversion::toLocal (to, from, n); }
+  void LCECellCodec::fromCanonical (Double* to, const uChar* from, size_t n)
+    { LECanonicalConversion::toLocal (to, from, n); }
+  void LCECellCodec::fromCanonical (Complex* to, const uChar* from, size_t n)
+    { LECanonicalConversion::toLocal (reinterpret_cast<Float*>(to), from, 2*n); }
+  void LCECellCodec::fromCanonical (DComplex* to, const uChar* from, size_t n)
+    { LECanonicalConversion::toLocal (reinterpret_cast<Double*>(to), from, 2*n); }
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,349 @@
+//# LosslessCompressEngine.h: Virtual column engine to compress arrays losslessly
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_LOSSLESSCOMPRESSENGINE_H
+#define TABLES_LOSSLESSCOMPRESSENGINE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/DataMan/BaseMappedArrayEngine.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <functional>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+  // <summary> Non-templated helper class to encode and decode a cell. </summary>
+  // <use visibility=local>
+  // <synopsis>
+  // A cell is stored as a vector of bytes with the following layout:
+  // <ul>
+  //  <li> 1 byte format version (currently 1).
+  //  <li> 1 byte flags: bit 0 set means LZ4 compressed, bit 1 set means
+  //       byte-shuffled.
+  //  <li> 1 byte element size.
+  //  <li> 1 byte dimensionality <src>n</src>.
+  //  <li> <src>n</src> 64-bit little-endian values giving the array shape.
+  //  <li> The (compressed) data in little-endian canonical format.
+  // </ul>
+  // Data that do not get smaller are stored uncompressed.
+  // </synopsis>
+  class LCECellCodec
+  {
+  public:
+    // Encode the canonical data of an array with the given shape.
+    static void encode (std::vector<uChar>& cell, const IPosition& shape,
+                        const uChar* data, uInt elemSize, Bool shuffle);
+
+    // Get the array shape from an encoded cell.
+    static IPosition shape (const uChar* cell, size_t cellSize);
+
+    // Decode the cell into canonical data of <src>nbytes</src> bytes.
+    static void decode (uChar* data, size_t nbytes, uInt elemSize,
+                        const uChar* cell, size_t cellSize);
+
+    // Get the nr of threads to use to encode or decode the given nr of
+    // bytes. It is given by aipsrc variable
+    // <src>table.compress.nthreads</src> (default 0 meaning the ThreadPool
+    // concurrency), but each thread has to handle at least 1 MByte.
+    static uInt nThreads (size_t nbytes);
+
+    // Execute <src>func(i)</src> for <src>i</src> in <src>[0,n)</src>
+    // using the given number of threads, each doing a contiguous range.
+    // An exception thrown by a thread is rethrown.
+    static void parallelFor (size_t n, uInt nthread,
+                             const std::function<void(size_t)>& func);
+
+    // Convert data from local to little-endian canonical format.
+    // <group>
+    static void toCanonical (uChar* to, const Bool* from, size_t n);
+    static void toCanonical (uChar* to, const uChar* from, size_t n);
+    static void toCanonical (uChar* to, const Short* from, size_t n);
+    static void toCanonical (uChar* to, const uShort* from, size_t n);
+    static void toCanonical (uChar* to, const Int* from, size_t n);
+    static void toCanonical (uChar* to, const uInt* from, size_t n);
+    static void toCanonical (uChar* to, const Int64* from, size_t n);
+    static void toCanonical (uChar* to, const Float* from, size_t n);
+    static void toCanonical (uChar* to, const Double* from, size_t n);
+    static void toCanonical (uChar* to, const Complex* from, size_t n);
+    static void toCanonical (uChar* to, const DComplex* from, size_t n);
+    // </group>
+
+    // Convert data from little-endian canonical to local format.
+    // <group>
+    static void fromCanonical (Bool* to, const uChar* from, size_t n);
+    static void fromCanonical (uChar* to, const uChar* from, size_t n);
+    static void fromCanonical (Short* to, const uChar* from, size_t n);
+    static void fromCanonical (uShort* to, const uChar* from, size_t n);
+    static void fromCanonical (Int* to, const uChar* from, size_t n);
+    static void fromCanonical (uInt* to, const uChar* from, size_t n);
+    static void fromCanonical (Int64* to, const uChar* from, size_t n);
+    static void fromCanonical (Float* to, const uChar* from, size_t n);
+    static void fromCanonical (Double* to, const uChar* from, size_t n);
+    static void fromCanonical (Complex* to, const uChar* from, size_t n);
+    static void fromCanonical (DComplex* to, const uChar* from, size_t n);
+    // </group>
+  };
+
+
+  // <summary>
+  // Virtual column engine to compress arrays without loss of information
+  // </summary>
+
+  // <use visibility=export>
+
+  // <reviewed reviewer="" date="" tests="tLosslessCompressEngine">
+  // </reviewed>
+
+  // <prerequisite>
+  //# Classes you should understand before using this one.
+  //   <li> VirtualColumnEngine
+  //   <li> VirtualArrayColumn
+  //   <li> <linkto class=LZ4Codec>LZ4Codec</linkto>
+  // </prerequisite>
+
+  // <synopsis>
+  // LosslessCompressEngine is a virtual column engine that compresses each
+  // array in a column without loss of information. It is meant for columns
+  // such as FLAG, UVW, WEIGHT_SPECTRUM or integer columns, for which the
+  // lossy <linkto class=CompressFloat>CompressFloat</linkto> or Dysco
+  // compression cannot be used.
+  // <p>
+  // The data of an array are converted to little-endian canonical format,
+  // optionally byte-shuffled (putting byte <src>k</src> of all elements
+  // together) and compressed using <linkto class=LZ4Codec>LZ4Codec</linkto>.
+  // The result, preceded by the array shape, is stored as a vector of bytes
+  // in the stored column, which must be a variable shaped uChar column of
+  // a storage manager that can change the shape of an array (for instance
+  // StandardStMan). Flags compress extremely well; in a typical
+  // MeasurementSet a factor 20-50 is obtained.
+  // <p>
+  // Because each array is compressed independently, the entire array has to
+  // be decompressed when a slice is accessed. When getting or putting
+  // an entire column or multiple cells, the arrays are decompressed or
+  // compressed by multiple threads (see <src>LCECellCodec::nThreads</src>),
+  // while the stored column is read or written by the calling thread.
+  // <p>
+  // The engine can be used for a column containing any kind of array
+  // (fixed or variable shaped) of type Bool, uChar, Short, uShort, Int,
+  // uInt, Int64, Float, Double, Complex, or DComplex.
+  // A fixed shaped array that has not been written yet is returned as
+  // zeroes.
+  // <br>An engine object should be used for one column only, because the
+  // stored column name is part of the engine.
+  // </synopsis>
+
+  // <motivation>
+  // Lossless compression reduces both the disk footprint and the read time
+  // of I/O-bound applications.
+  // </motivation>
+
+  // <example>
+  // <srcblock>
+  // // Create the table description and 2 columns with indirect arrays in it.
+  // // The Bool column will be virtual using the uChar column to store the
+  // // compressed data.
+  // TableDesc tableDesc ("", TableDesc::Scratch);
+  // tableDesc.addColumn (ArrayColumnDesc<Bool> ("FLAG", IPosition(2,4,64),
+  //                                             ColumnDesc::FixedShape));
+  // tableDesc.addColumn (ArrayColumnDesc<uChar> ("FLAG_COMPRESSED"));
+  //
+  // // Create a new table using the table description.
+  // SetupNewTable newtab (tableDesc, "tab.data", Table::New);
+  //
+  // // Create the engine and bind the FLAG column to it.
+  // LosslessCompressEngine<Bool> engine("FLAG", "FLAG_COMPRESSED");
+  // newtab.bindColumn ("FLAG", engine);
+  // // Create the table.
+  // Table table (newtab);
+  // </srcblock>
+  // </example>
+
+  // <templating arg=T>
+  //  <li> only the data types listed above
+  // </templating>
+
+  template<typename T> class LosslessCompressEngine : public BaseMappedArrayEngine<T, uChar>
+  {
+  public:
+    using BaseMappedArrayEngine<T,uChar>::virtualName;
+  protected:
+    using BaseMappedArrayEngine<T,uChar>::storedName;
+    using BaseMappedArrayEngine<T,uChar>::table;
+    using BaseMappedArrayEngine<T,uChar>::column;
+    using BaseMappedArrayEngine<T,uChar>::setNames;
+
+  public:
+    // Construct an engine to compress the arrays in the virtual column
+    // into the stored uChar column. By default the bytes of the data
+    // are shuffled before compressing them.
+    LosslessCompressEngine (const String& virtualColumnName,
+                            const String& storedColumnName,
+                            Bool shuffle = True);
+
+    // Construct from a record specification as created by dataManagerSpec().
+    LosslessCompressEngine (const Record& spec);
+
+    // Destructor is mandatory.
+    ~LosslessCompressEngine();
+
+    // Assignment is not needed and therefore forbidden.
+    LosslessCompressEngine<T>& operator= (const LosslessCompressEngine<T>&) = delete;
+
+    // Return the type name of the engine (i.e. its class name).
+    virtual String dataManagerType() const;
+
+    // Get the name given to the engine (is the virtual column name).
+    virtual String dataManagerName() const;
+
+    // Get a record containing data manager specifications.
+    virtual Record dataManagerSpec() const;
+
+    // Return the name of the class.
+    // This includes the names of the template arguments.
+    static String className();
+
+    // Register the class name and the static makeObject "constructor".
+    // This will make the engine known to the table system.
+    static void registerClass();
+
+  private:
+    // Copy constructor is only used by clone().
+    // (so it is made private).
+    LosslessCompressEngine (const LosslessCompressEngine<T>&);
+
+    // Clone the engine object.
+    DataManager* clone() const;
+
+    // Initialize the object for a new table.
+    // It defines the keywords containing the engine parameters.
+    void create64 (rownr_t initialNrrow);
+
+    // Preparing consists of setting the writable switch and
+    // reading the keywords containing the engine parameters.
+    // It checks if the stored column can hold arrays of different shapes.
+    void prepare();
+
+    // Resync and removing a row invalidate the cached cell.
+    // <group>
+    rownr_t resync64 (rownr_t nrrow);
+    void removeRow64 (rownr_t rownr);
+    // </group>
+
+    // The stored shape is not set when rows are added, because it depends
+    // on the compressed size.
+    void addRowInit (rownr_t startRow, rownr_t nrrow);
+
+    // The shape of the virtual arrays is kept in the stored cells and
+    // in the engine for a FixedShape column.
+    // <group>
+    void setShapeColumn (const IPosition& shape);
+    void setShape (rownr_t rownr, const IPosition& shape);
+    Bool isShapeDefined (rownr_t rownr);
+    uInt ndim (rownr_t rownr);
+    IPosition shape (rownr_t rownr);
+    Bool canChangeShape() const;
+    // </group>
+
+    // Get or put an array in the given row.
+    // <group>
+    void getArray (rownr_t rownr, Array<T>& array);
+    void putArray (rownr_t rownr, const Array<T>& array);
+    // </group>
+
+    // Get or put a section of an array. The entire array is decompressed.
+    // <group>
+    void getSlice (rownr_t rownr, const Slicer& slicer, Array<T>& array);
+    void putSlice (rownr_t rownr, const Slicer& slicer,
+                   const Array<T>& array);
+    // </group>
+
+    // Get or put an entire column or some cells, decompressing or
+    // compressing with multiple threads.
+    // <group>
+    void getArrayColumn (Array<T>& array);
+    void putArrayColumn (const Array<T>& array);
+    void getArrayColumnCells (const RefRows& rownrs, Array<T>& data);
+    void putArrayColumnCells (const RefRows& rownrs, const Array<T>& data);
+    // </group>
+
+    // Get or put a section of the arrays in the column, row by row.
+    // <group>
+    void getColumnSlice (const Slicer& slicer, Array<T>& array);
+    void putColumnSlice (const Slicer& slicer, const Array<T>& array);
+    void getColumnSliceCells (const RefRows& rownrs, const Slicer& slicer,
+                              Array<T>& data);
+    void putColumnSliceCells (const RefRows& rownrs, const Slicer& slicer,
+                              const Array<T>& data);
+    // </group>
+
+    // Read the stored cell. The last cell read is cached, because the
+    // shape and data are usually asked one after the other.
+    const Vector<uChar>& readCell (rownr_t rownr);
+
+    // Decode a cell into <src>n</src> values.
+    // An empty cell is decoded as zeroes.
+    void decodeCell (const Vector<uChar>& cell, T* data, size_t n,
+                     const IPosition& shape) const;
+
+    // Encode <src>n</src> values with the given shape.
+    void encodeCell (std::vector<uChar>& cell, const T* data, size_t n,
+                     const IPosition& shape) const;
+
+    // Get the cells in the given rows using multiple threads.
+    void getCells (const Vector<rownr_t>& rows, Array<T>& array);
+
+    // Put the cells in the given rows using multiple threads.
+    void putCells (const Vector<rownr_t>& rows, const Array<T>& array);
+
+  public:
+    // Define the "constructor" to construct this engine when a
+    // table is read back.
+    // This "constructor" has to be registered by the user of the engine.
+    // If the engine is commonly used, its registration can be added
+    // to the registerAllCtor function in DataManager.cc.
+    // That function gets automatically invoked by the table system.
+    static DataManager* makeObject (const String& dataManagerType,
+                                    const Record& spec);
+
+  private:
+    Bool               itsShuffle;
+    Bool               itsIsNew;         //# True = new table
+    Bool               itsIsFixed;       //# True = FixedShape virtual column
+    IPosition          itsFixedShape;
+    rownr_t            itsCacheRow;      //# row of the cached cell
+    Vector<uChar>      itsCacheCell;
+  };
+
+
+} //# NAMESPACE CASACORE - END
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/tables/DataMan/LosslessCompressEngine.tcc>
+#endif //# CASACORE_NO_AUTO_TEMPLATES
+#endif
@@ -0,0 +1,434 @@
+//# LosslessCompressEngine.tcc: Virtual column engine to compress arrays losslessly
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_LOSSLESSCOMPRESSENGINE_TCC
+#define TABLES_LOSSLESSCOMPRESSENGINE_TCC
+
+//# Includes
+#include <casacore/tables/DataMan/LosslessCompressEngine.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/ValTypeId.h>
+#include <limits>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  template<typename T>
+  LosslessCompressEngine<T>::LosslessCompressEngine
+                                        (const String& virtualColumnName,
+                                         const String& storedColumnName,
+                                         Bool shuffle)
+  : BaseMappedArrayEngine<T,uChar> (virtualColumnName, storedColumnName),
+    itsShuffle  (shuffle),
+    itsIsNew    (False),
+    itsIsFixed  (False),
+    itsCacheRow (std::numeric_limits<rownr_t>::max())
+  {}
+
+  template<typename T>
+  LosslessCompressEngine<T>::LosslessCompressEngine (const Record& spec)
+  : BaseMappedArrayEngine<T,uChar>(),
+    itsShuffle  (True),
+    itsIsNew    (False),
+    itsIsFixed  (False),
+    itsCacheRow (std::numeric_limits<rownr_t>::max())
+  {
+    if (spec.isDefined("SOURCENAME")  &&  spec.isDefined("TARGETNAME")) {
+      setNames (spec.asString("SOURCENAME"), spec.asString("TARGETNAME"));
+      if (spec.isDefined("SHUFFLE")) {
+        itsShuffle = spec.asBool ("SHUFFLE");
+      }
+    }
+  }
+
+  template<typename T>
+  LosslessCompressEngine<T>::LosslessCompressEngine
+                                   (const LosslessCompressEngine<T>& that)
+  : BaseMappedArrayEngine<T,uChar> (that),
+    itsShuffle  (that.itsShuffle),
+    itsIsNew    (that.itsIsNew),
+    itsIsFixed  (False),
+    itsCacheRow (std::numeric_limits<rownr_t>::max())
+  {}
+
+  template<typename T>
+  LosslessCompressEngine<T>::~LosslessCompressEngine()
+  {}
+
+  //# Clone the engine object.
+  template<typename T>
+  DataManager* LosslessCompressEngine<T>::clone() const
+  {
+    return new LosslessCompressEngine<T> (*this);
+  }
+
+
+  //# Return the type name of the engine (i.e. its class name).
+  template<typename T>
+  String LosslessCompressEngine<T>::dataManagerType() const
+  {
+    return className();
+  }
+  //# Return the class name.
+  //# Get the data type names using class ValType.
+  template<typename T>
+  String LosslessCompressEngine<T>::className()
+  {
+    return "LosslessCompressEngine<" + valDataTypeId (static_cast<T*>(0))
+      + ">";
+  }
+
+  template<typename T>
+  String LosslessCompressEngine<T>::dataManagerName() const
+  {
+    return virtualName();
+  }
+
+  template<typename T>
+  Record LosslessCompressEngine<T>::dataManagerSpec() const
+  {
+    Record spec;
+    spec.define ("SOURCENAME", virtualName());
+    spec.define ("TARGETNAME", storedName());
+    spec.define ("SHUFFLE", itsShuffle);
+    return spec;
+  }
+
+  template<typename T>
+  DataManager* LosslessCompressEngine<T>::makeObject (const String&,
+                                                      const Record& spec)
+  {
+    return new LosslessCompressEngine<T>(spec);
+  }
+  template<typename T>
+  void LosslessCompressEngine<T>::registerClass()
+  {
+    DataManager::registerCtor (className(), makeObject);
+  }
+
+
+  template<typename T>
+  void LosslessCompressEngine<T>::create64 (rownr_t initialNrrow)
+  {
+    BaseMappedArrayEngine<T,uChar>::create64 (initialNrrow);
+    itsIsNew = True;
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::prepare()
+  {
+    BaseMappedArrayEngine<T,uChar>::prepare();
+    TableColumn thisCol (table(), virtualName());
+    if (itsIsNew) {
+      thisCol.rwKeywordSet().define ("_LosslessCompressEngine_Shuffle",
+                                     itsShuffle);
+    } else {
+      itsShuffle = thisCol.keywordSet().asBool
+                                      ("_LosslessCompressEngine_Shuffle");
+    }
+    // The size of the stored arrays depends on the compression.
+    if ((column().columnDesc().options() & ColumnDesc::FixedShape)
+                                                  == ColumnDesc::FixedShape
+        ||  !column().canChangeShape()) {
+      throw DataManInvOper ("LosslessCompressEngine: stored column " +
+                            storedName() + " must be variable shaped and "
+                            "its storage manager must be able to change "
+                            "the shape of an array");
+    }
+  }
+
+  template<typename T>
+  rownr_t LosslessCompressEngine<T>::resync64 (rownr_t nrrow)
+  {
+    itsCacheRow = std::numeric_limits<rownr_t>::max();
+    return nrrow;
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::removeRow64 (rownr_t)
+  {
+    itsCacheRow = std::numeric_limits<rownr_t>::max();
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::addRowInit (rownr_t, rownr_t)
+  {}
+
+  template<typename T>
+  void LosslessCompressEngine<T>::setShapeColumn (const IPosition& shape)
+  {
+    BaseMappedArrayEngine<T,uChar>::setShapeColumn (shape);
+    itsIsFixed    = True;
+    itsFixedShape = shape;
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::setShape (rownr_t rownr,
+                                            const IPosition& shape)
+  {
+    // Store an array of zeroes, so the shape is known.
+    if (!column().isDefined(rownr)  ||  !this->shape(rownr).isEqual(shape)) {
+      Array<T> arr(shape, T());
+      putArray (rownr, arr);
+    }
+  }
+
+  template<typename T>
+  Bool LosslessCompressEngine<T>::isShapeDefined (rownr_t rownr)
+  {
+    return itsIsFixed  ||  column().isDefined (rownr);
+  }
+
+  template<typename T>
+  uInt LosslessCompressEngine<T>::ndim (rownr_t rownr)
+  {
+    return shape(rownr).size();
+  }
+
+  template<typename T>
+  IPosition LosslessCompressEngine<T>::shape (rownr_t rownr)
+  {
+    if (itsIsFixed) {
+      return itsFixedShape;
+    }
+    const Vector<uChar>& cell = readCell (rownr);
+    if (cell.empty()) {
+      return IPosition();
+    }
+    return LCECellCodec::shape (cell.data(), cell.size());
+  }
+
+  template<typename T>
+  Bool LosslessCompressEngine<T>::canChangeShape() const
+  {
+    return True;
+  }
+
+  template<typename T>
+  const Vector<uChar>& LosslessCompressEngine<T>::readCell (rownr_t rownr)
+  {
+    if (rownr != itsCacheRow) {
+      if (column().isDefined (rownr)) {
+        column().get (rownr, itsCacheCell, True);
+      } else {
+        itsCacheCell.resize (0);
+      }
+      itsCacheRow = rownr;
+    }
+    return itsCacheCell;
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::decodeCell (const Vector<uChar>& cell,
+                                              T* data, size_t n,
+                                              const IPosition& shape) const
+  {
+    if (cell.empty()) {
+      std::fill (data, data+n, T());
+      return;
+    }
+    if (! LCECellCodec::shape(cell.data(), cell.size()).isEqual (shape)) {
+      throw DataManError ("LosslessCompressEngine: shape of array in column "
+                          + virtualName() + " mismatches "
+                          + String(shape.toString()));
+    }
+    std::vector<uChar> buf (n * sizeof(T));
+    LCECellCodec::decode (buf.data(), buf.size(), sizeof(T),
+                          cell.data(), cell.size());
+    LCECellCodec::fromCanonical (data, buf.data(), n);
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::encodeCell (std::vector<uChar>& cell,
+                                              const T* data, size_t n,
+                                              const IPosition& shape) const
+  {
+    std::vector<uChar> buf (n * sizeof(T));
+    LCECellCodec::toCanonical (buf.data(), data, n);
+    LCECellCodec::encode (cell, shape, buf.data(), sizeof(T), itsShuffle);
+  }
+
+
+  template<typename T>
+  void LosslessCompressEngine<T>::getArray (rownr_t rownr, Array<T>& array)
+  {
+    const Vector<uChar>& cell = readCell (rownr);
+    Bool deleteIt;
+    T* data = array.getStorage (deleteIt);
+    decodeCell (cell, data, array.size(), array.shape());
+    array.putStorage (data, deleteIt);
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::putArray (rownr_t rownr,
+                                            const Array<T>& array)
+  {
+    std::vector<uChar> cell;
+    Bool deleteIt;
+    const T* data = array.getStorage (deleteIt);
+    encodeCell (cell, data, array.size(), array.shape());
+    array.freeStorage (data, deleteIt);
+    itsCacheRow = std::numeric_limits<rownr_t>::max();
+    Vector<uChar> vec (IPosition(1, cell.size()), cell.data(), SHARE);
+    column().put (rownr, vec);
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::getSlice (rownr_t rownr,
+                                            const Slicer& slicer,
+                                            Array<T>& array)
+  {
+    this->getSliceBase (rownr, slicer, array);
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::putSlice (rownr_t rownr,
+                                            const Slicer& slicer,
+                                            const Array<T>& array)
+  {
+    this->putSliceBase (rownr, slicer, array);
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::getCells (const Vector<rownr_t>& rows,
+                                            Array<T>& array)
+  {
+    size_t nr = rows.size();
+    if (nr == 0) {
+      return;
+    }
+    // Read the stored cells first, because the table cannot be accessed
+    // by multiple threads.
+    std::vector<Vector<uChar>> cells(nr);
+    for (size_t i=0; i<nr; ++i) {
+      if (column().isDefined (rows[i])) {
+        column().get (rows[i], cells[i], True);
+      }
+    }
+    IPosition cellShape = array.shape().getFirst (array.ndim() - 1);
+    size_t cellSize = array.size() / nr;
+    Bool deleteIt;
+    T* data = array.getStorage (deleteIt);
+    LCECellCodec::parallelFor
+      (nr, LCECellCodec::nThreads (array.size() * sizeof(T)),
+       [&] (size_t i)
+       { decodeCell (cells[i], data + i*cellSize, cellSize, cellShape); });
+    array.putStorage (data, deleteIt);
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::putCells (const Vector<rownr_t>& rows,
+                                            const Array<T>& array)
+  {
+    size_t nr = rows.size();
+    if (nr == 0) {
+      return;
+    }
+    IPosition cellShape = array.shape().getFirst (array.ndim() - 1);
+    size_t cellSize = array.size() / nr;
+    std::vector<std::vector<uChar>> cells(nr);
+    Bool deleteIt;
+    const T* data = array.getStorage (deleteIt);
+    LCECellCodec::parallelFor
+      (nr, LCECellCodec::nThreads (array.size() * sizeof(T)),
+       [&] (size_t i)
+       { encodeCell (cells[i], data + i*cellSize, cellSize, cellShape); });
+    array.freeStorage (data, deleteIt);
+    itsCacheRow = std::numeric_limits<rownr_t>::max();
+    for (size_t i=0; i<nr; ++i) {
+      Vector<uChar> vec (IPosition(1, cells[i].size()), cells[i].data(),
+                         SHARE);
+      column().put (rows[i], vec);
+    }
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::getArrayColumn (Array<T>& array)
+  {
+    Vector<rownr_t> rows(array.shape()[array.ndim() - 1]);
+    indgen (rows);
+    getCells (rows, array);
+  }
+  template<typename T>
+  void LosslessCompressEngine<T>::putArrayColumn (const Array<T>& array)
+  {
+    Vector<rownr_t> rows(array.shape()[array.ndim() - 1]);
+    indgen (rows);
+    putCells (rows, array);
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::getArrayColumnCells (const RefRows& rownrs,
+                                                       Array<T>& array)
+  {
+    getCells (rownrs.convert(), array);
+  }
+  template<typename T>
+  void LosslessCompressEngine<T>::putArrayColumnCells (const RefRows& rownrs,
+                                                       const Array<T>& array)
+  {
+    putCells (rownrs.convert(), array);
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::getColumnSlice (const Slicer& slicer,
+                                                  Array<T>& array)
+  {
+    this->getColumnSliceBase (slicer, array);
+  }
+  template<typename T>
+  void LosslessCompressEngine<T>::putColumnSlice (const Slicer& slicer,
+                                                  const Array<T>& array)
+  {
+    this->putColumnSliceBase (slicer, array);
+  }
+
+  template<typename T>
+  void LosslessCompressEngine<T>::getColumnSliceCells (const RefRows& rownrs,
+                                                       const Slicer& slicer,
+                                                       Array<T>& array)
+  {
+    this->getColumnSliceCellsBase (rownrs, slicer, array);
+  }
+  template<typename T>
+  void LosslessCompressEngine<T>::putColumnSliceCells (const RefRows& rownrs,
+                                                       const Slicer& slicer,
+                                                       const Array<T>& array)
+  {
+    this->putColumnSliceCellsBase (rownrs, slicer, array);
+  }
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -34,20 +34,22 @@
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/string.h>                           // for memcpy
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 MSMDirColumn::MSMDirColumn (MSMBase* smptr, int dataType)
 : MSMColumn (smptr, dataType, True),
-  nrelem_p  (0)
+  nrelem_p    (0),
+  arenaUsed_p (0),
+  arenaSize_p (0)
 {}
 
 MSMDirColumn::~MSMDirColumn()
 {
-  rownr_t nr = stmanPtr_p->nrow();
-  for (rownr_t i=0; i<nr; i++) {
-    deleteArray (i);
+  for (void* arena : arena_p) {
+    deleteData (arena, False);
   }
 }
 
@@ -63,11 +65,18 @@ void MSMDirColumn::addRow (rownr_t nrnew, rownr_t nrold)
 {
   //# Extend data blocks if needed.
   MSMColumn::addRow (nrnew, nrold);
-  //# Allocate the fixed shape data arrays.
-  void* ptr;
+  //# Take the fixed shape data arrays from the arena.
+  //# Allocate a new arena if the current one is too small.
+  rownr_t nradd = nrnew - nrold;
+  if (arenaUsed_p + nradd > arenaSize_p) {
+    rownr_t cellSize = std::max (rownr_t(1), nrelem_p * elemSize());
+    rownr_t maxCells = std::max (rownr_t(1), rownr_t(64*1024*1024) / cellSize);
+    arenaSize_p = std::max (nradd, std::min (nrold, maxCells));
+    arenaUsed_p = 0;
+    arena_p.push_back (allocData (arenaSize_p * nrelem_p, False));
+  }
   for (; nrold<nrnew; nrold++) {
-    ptr = allocData (nrelem_p, False);
-    putArrayPtr (nrold, ptr);
+    putArrayPtr (nrold, arenaCell (arena_p.back(), arenaUsed_p++));
   }
 }
 
@@ -210,17 +219,65 @@ void MSMDirColumn::putSliceV (rownr_t rownr, const Slicer& slicer, const ArrayBa
 }
 
 
-void MSMDirColumn::remove (rownr_t rownr)
+void MSMDirColumn::getArrayColumnV (ArrayBase& arr)
 {
-  deleteArray (rownr);
-  MSMColumn::remove (rownr);
+  DebugAssert (arr.ndim() > 0  &&
+               arr.shape()[arr.ndim()-1] == Int64(stmanPtr_p->nrow()),
+               AipsError);
+  Bool deleteIt;
+  void* data = arr.getVStorage (deleteIt);
+  copyColumn (data, True);
+  arr.putVStorage (data, deleteIt);
 }
 
+void MSMDirColumn::putArrayColumnV (const ArrayBase& arr)
+{
+  DebugAssert (arr.ndim() > 0  &&
+               arr.shape()[arr.ndim()-1] == Int64(stmanPtr_p->nrow()),
+               AipsError);
+  Bool deleteIt;
+  const void* data = arr.getVStorage (deleteIt);
+  copyColumn (const_cast<void*>(data), False);
+  arr.freeVStorage (data, deleteIt);
+  stmanPtr_p->setHasPut();
+}
 
-void MSMDirColumn::deleteArray (rownr_t rownr)
+void MSMDirColumn::copyColumn (void* data, Bool get)
 {
-  void* datap = getArrayPtr (rownr);
-  deleteData (datap, False);
+  rownr_t nrow = stmanPtr_p->nrow();
+  rownr_t st = 0;
+  while (st < nrow) {
+    // Find the nr of rows adjacent in the arena.
+    void* cell = getArrayPtr (st);
+    rownr_t nr = 1;
+    while (st+nr < nrow  &&  getArrayPtr(st+nr) == arenaCell (cell, nr)) {
+      nr++;
+    }
+    void* buf = arenaCell (data, st);
+    if (dtype() == TpString) {
+      if (get) {
+        objcopy (static_cast<String*>(buf), static_cast<const String*>(cell),
+                 nr*nrelem_p);
+      } else {
+        objcopy (static_cast<String*>(cell), static_cast<const String*>(buf),
+                 nr*nrelem_p);
+      }
+    } else {
+      if (get) {
+        memcpy (buf, cell, nr*nrelem_p*elemSize());
+      } else {
+        memcpy (cell, buf, nr*nrelem_p*elemSize());
+      }
+    }
+    st += nr;
+  }
+}
+
+
+void MSMDirColumn::remove (rownr_t rownr)
+{
+  // The array stays in the arena until the column is deleted.
+  MSMColumn::remove (rownr);
 }
 
 } //# NAMESPACE CASACORE - END
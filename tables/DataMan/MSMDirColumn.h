@@ -31,6 +31,8 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/MSMColumn.h>
 #include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -53,6 +55,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // <synopsis> 
 // MSMDirColumn handles arrays in a table column.
 // It only keeps them in memory, so they are not persistent.
+// <br>The arrays are stored in arenas, i.e. large contiguous buffers each
+// holding the arrays of many rows. An arena grows in chunks (doubling the
+// number of rows up to a maximum of about 64 MB), which avoids a heap
+// allocation per row. Because consecutive rows are usually adjacent in
+// memory, an entire column is read or written with a few memcpy calls.
+// Note that the memory of a removed row is only released when the column
+// is deleted.
 // </synopsis> 
 
 //# <todo asof="$DATE:$">
@@ -110,6 +119,14 @@ public:
   // (which is guaranteed by the ArrayColumn putSlice function).
   virtual void putSliceV (rownr_t rownr, const Slicer&, const ArrayBase& arr);
 
+  // Get all array values in the column.
+  // Rows that are adjacent in the arena are copied in a single step.
+  virtual void getArrayColumnV (ArrayBase& arr);
+
+  // Put all array values in the column.
+  // Rows that are adjacent in the arena are copied in a single step.
+  virtual void putArrayColumnV (const ArrayBase& arr);
+
   // Remove the value in the given row.
   void remove (rownr_t rownr);
 
@@ -131,13 +148,26 @@ private:
     arr(slicer) = data;
   }
 
-  // Delete the array in the given row.
-  void deleteArray (rownr_t rownr);
+  // Get the pointer to the i-th array in an arena.
+  void* arenaCell (void* arena, rownr_t i) const
+  {
+    return (dtype() == TpString  ?
+            static_cast<void*>(static_cast<String*>(arena) + i*nrelem_p) :
+            static_cast<void*>(static_cast<char*>(arena) + i*nrelem_p*elemSize()));
+  }
+
+  // Copy the arrays of all rows from or to the given buffer.
+  void copyColumn (void* data, Bool get);
 
   // The shape of the array.
   IPosition shape_p;
   // The nr of elements in the array.
   rownr_t nrelem_p;
+  // The arenas holding the arrays.
+  std::vector<void*> arena_p;
+  // The nr of arrays used and available in the last arena.
+  rownr_t arenaUsed_p;
+  rownr_t arenaSize_p;
 
 };
 
@@ -183,6 +183,22 @@ private:
   virtual void mapOnPut (const Array<VirtualType>& array,
                          Array<StoredType>& stored);
 
+  // Read the stored data directly into the virtual array if a virtual
+  // value is at least as large as a stored value. The conversion is then
+  // done in place by mapInPlaceOnGet.
+  virtual Bool shareOnGet (Array<VirtualType>& array,
+                           const IPosition& storedShape,
+                           Array<StoredType>& stored);
+
+  // Convert the stored data in the storage of the virtual array.
+  virtual void mapInPlaceOnGet (Array<VirtualType>& array,
+                                Array<StoredType>& stored);
+
+  // Write the virtual array directly if the types are the same.
+  virtual Bool shareOnPut (const Array<VirtualType>& array,
+                           const IPosition& storedShape,
+                           Array<StoredType>& stored);
+
 
 public:
   // Define the "constructor" to construct this engine when a
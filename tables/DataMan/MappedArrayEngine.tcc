@@ -35,6 +35,8 @@
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/ValTypeId.h>
+#include <cstring>
+#include <type_traits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -127,6 +129,49 @@ void MappedArrayEngine<S,T>::mapOnPut (const Array<S>& array, Array<T>& target)
   convertArray (target, array);
 }
 
+template<class S, class T>
+Bool MappedArrayEngine<S,T>::shareOnGet (Array<S>& array,
+                                         const IPosition& storedShape,
+                                         Array<T>& target)
+{
+  // Other types can only be converted in place if their values can be
+  // moved bytewise.
+  return ((std::is_same<S,T>::value  ||
+           (sizeof(S) >= sizeof(T)  &&  std::is_trivially_copyable<S>::value
+            &&  std::is_trivially_copyable<T>::value))  &&
+          this->shareStorage (array, storedShape, target));
+}
+
+template<class S, class T>
+void MappedArrayEngine<S,T>::mapInPlaceOnGet (Array<S>& array, Array<T>&)
+{
+  if (std::is_same<S,T>::value) {
+    return;
+  }
+  // The stored values are in the first part of the storage.
+  // Convert from back to front, so a stored value is used before being
+  // overwritten by a (larger) virtual value. Because the storage contains
+  // values of both types, they are accessed using memcpy.
+  char* buf = reinterpret_cast<char*>(array.data());
+  for (size_t i=array.nelements(); i>0;) {
+    --i;
+    T in;
+    S out;
+    memcpy (&in, buf + i*sizeof(T), sizeof(T));
+    arrays_internal::convertScalar (out, in);
+    memcpy (buf + i*sizeof(S), &out, sizeof(S));
+  }
+}
+
+template<class S, class T>
+Bool MappedArrayEngine<S,T>::shareOnPut (const Array<S>& array,
+                                         const IPosition& storedShape,
+                                         Array<T>& target)
+{
+  return (std::is_same<S,T>::value  &&
+          this->shareStorage (array, storedShape, target));
+}
+
 } //# NAMESPACE CASACORE - END
 
 
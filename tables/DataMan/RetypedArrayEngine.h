@@ -29,6 +29,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/BaseMappedArrayEngine.h>
+#include <casacore/tables/DataMan/RetypedArraySetGet.h>
 #include <casacore/tables/Tables/TableRecord.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -568,6 +569,22 @@ private:
     virtual void mapOnPut (const Array<VirtualType>& array,
                            Array<StoredType>& stored);
 
+    // Read or write the stored data directly in the virtual array if
+    // the virtual type has the memory layout of the stored element
+    // (see <linkto class=RetypedArraySameLayout>RetypedArraySameLayout
+    // </linkto>) and full elements are stored.
+    // <group>
+    virtual Bool shareOnGet (Array<VirtualType>& array,
+                             const IPosition& storedShape,
+                             Array<StoredType>& stored);
+    virtual Bool shareOnPut (const Array<VirtualType>& array,
+                             const IPosition& storedShape,
+                             Array<StoredType>& stored);
+    // </group>
+
+    // Can the data with the given stored shape be shared?
+    Bool canShare (const IPosition& storedShape) const;
+
     //# Now define the data members.
     IPosition shape_p;             //# shape of a virtual element in the stored
     IPosition virtualFixedShape_p; //# The shape in case virtual has FixedShape
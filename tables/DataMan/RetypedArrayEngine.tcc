@@ -315,6 +315,32 @@ void RetypedArrayEngine<S,T>::mapOnPut (const Array<S>& array,
     S::get (copyInfo_p, target, &array, elemShape);
 }
 
+template<class S, class T>
+Bool RetypedArrayEngine<S,T>::canShare (const IPosition& storedShape) const
+{
+    return (RetypedArraySameLayout<S,T>::value  &&
+	    sizeof(S) == shape_p.product() * sizeof(T)  &&
+	    storedShape.getFirst(shape_p.nelements()).isEqual (shape_p));
+}
+
+template<class S, class T>
+Bool RetypedArrayEngine<S,T>::shareOnGet (Array<S>& array,
+                                          const IPosition& storedShape,
+                                          Array<T>& target)
+{
+    return (canShare (storedShape)  &&
+	    this->shareStorage (array, storedShape, target));
+}
+
+template<class S, class T>
+Bool RetypedArrayEngine<S,T>::shareOnPut (const Array<S>& array,
+                                          const IPosition& storedShape,
+                                          Array<T>& target)
+{
+    return (canShare (storedShape)  &&
+	    this->shareStorage (array, storedShape, target));
+}
+
 
 } //# NAMESPACE CASACORE - END
 
@@ -29,6 +29,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
+#include <type_traits>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -151,6 +152,30 @@ void retypedArrayEngineGet (Array<TargetType>& out,
 // </group>
 
 
+// <summary>
+// Tell if a RetypedArrayEngine can map without copying
+// </summary>
+// <synopsis>
+// If the memory layout of a SourceType object is the array of TargetType
+// values it is stored as (i.e., the SourceType data can be copied as done
+// by retypedArrayEngineSet/Get without shape), a RetypedArrayEngine can
+// read and write the stored data directly in the storage of the virtual
+// array, thus without a temporary array and copy.
+// It is only done for full elements (i.e., if the element shape in the
+// stored column is the SourceType shape).
+// <br>A SourceType class has to declare this by specializing this struct.
+// </synopsis>
+// <example>
+// <srcblock>
+// // StokesVector contains 4 doubles and nothing else.
+// template<> struct RetypedArraySameLayout<StokesVector,double>
+//   : public std::true_type {};
+// </srcblock>
+// </example>
+template<class SourceType, class TargetType>
+struct RetypedArraySameLayout : public std::false_type {};
+
+
 
 } //# NAMESPACE CASACORE - END
 
@@ -36,8 +36,11 @@
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Utilities/ValType.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/System/AipsrcValue.h>
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/ShardedBucketCache.h>
+#include <casacore/casa/IO/MMapfdIO.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/IO/MemoryIO.h>
 #include <casacore/casa/IO/CanonicalIO.h>
@@ -58,6 +61,7 @@ SSMBase::SSMBase (Int aBucketSize, uInt aCacheSize)
   itsIosFile           (0),
   itsNrRows            (0),
   itsCache             (0),
+  itsSharedCache       (0),
   itsFile              (0),
   itsStringHandler     (0),
   itsPersCacheSize     (std::max(aCacheSize,uInt(2))),
@@ -90,6 +94,7 @@ SSMBase::SSMBase (const String& aDataManName,
   itsIosFile           (0),
   itsNrRows            (0),
   itsCache             (0),
+  itsSharedCache       (0),
   itsFile              (0),
   itsStringHandler     (0),
   itsPersCacheSize     (std::max(aCacheSize,uInt(2))),
@@ -122,6 +127,7 @@ SSMBase::SSMBase (const String& aDataManName,
   itsIosFile           (0),
   itsNrRows            (0),
   itsCache             (0),
+  itsSharedCache       (0),
   itsFile              (0),
   itsStringHandler     (0),
   itsPersCacheSize     (2),
@@ -163,6 +169,7 @@ SSMBase::SSMBase (const SSMBase& that)
   itsIosFile           (0),
   itsNrRows            (0),
   itsCache             (0),
+  itsSharedCache       (0),
   itsFile              (0),
   itsStringHandler     (0),
   itsPersCacheSize     (that.itsPersCacheSize),
@@ -188,6 +195,7 @@ SSMBase::~SSMBase()
   for (uInt i=0; i<itsPtrIndex.nelements(); i++) {
     delete itsPtrIndex[i];
   }
+  delete itsSharedCache;
   delete itsCache;
   delete itsFile;
   delete itsIosFile;
@@ -234,12 +242,20 @@ void SSMBase::setProperties (const Record& rec)
   }
 }
 
+Bool SSMBase::isMapped() const
+{
+  return itsFile != 0  &&  itsFile->isMapped();
+}
+
 void SSMBase::clearCache()
 {
   if (itsCache != 0) {
     itsStringHandler->flush();
     itsCache->clear();
   }
+  if (itsSharedCache != 0) {
+    itsSharedCache->clear();
+  }
 }
 
 void SSMBase::showBaseStatistics (ostream& anOs) const
@@ -271,6 +287,19 @@ void SSMBase::showCacheStatistics (ostream& anOs) const
     itsCache->showStatistics (anOs);
     anOs << endl;
   }
+  if (itsSharedCache != 0) {
+    anOs << "StandardStMan shared cache statistics:" << endl;
+    itsSharedCache->showStatistics (anOs);
+    anOs << endl;
+  }
+}
+
+Record SSMBase::cacheStatistics() const
+{
+  if (itsCache != 0) {
+    return itsCache->statistics();
+  }
+  return Record();
 }
 
 void SSMBase::showIndexStatistics (ostream & anOs) const
@@ -345,6 +374,9 @@ void SSMBase::setCacheSize (uInt aCacheSize, Bool canExceedNrBuckets)
   if (itsCache != 0) {
     itsCache->resize (itsCacheSize);
   }
+  if (itsSharedCache != 0) {
+    makeSharedCache();
+  }
 }
 
 void SSMBase::makeCache()
@@ -378,6 +410,21 @@ void SSMBase::makeCache()
   }
 }
 
+void SSMBase::makeSharedCache()
+{
+  // Use the bucket cache for the file header and indices.
+  // It also opens the file and maps it, so findMapped does not change
+  // any state when used by multiple threads.
+  getCache();
+  delete itsSharedCache;
+  itsSharedCache = 0;
+  itsSharedCache = new ShardedBucketCache (itsFile, 512, itsBucketSize,
+                                           itsNrBuckets, itsCacheSize, 0,
+                                           this,
+                                           SSMBase::readCallBack,
+                                           SSMBase::deleteCallBack);
+}
+
 uInt SSMBase::getRowsPerBucket(uInt aColumn) const
 {
   return itsPtrIndex[itsColIndexMap[aColumn]]->getRowsPerBucket();
@@ -649,6 +696,11 @@ Bool SSMBase::canAddRow() const
 {
   return True;
 }
+
+Bool SSMBase::canDeferOpen() const
+{
+  return True;
+}
 //# The storage manager can delete rows.
 Bool SSMBase::canRemoveRow() const
 {
@@ -910,10 +962,50 @@ char* SSMBase::find(rownr_t aRowNr,     uInt aColNr,
   return aPtr + itsColumnOffset[aColNr];
 }
 
+const char* SSMBase::find (rownr_t aRowNr,     uInt aColNr,
+                           rownr_t& aStartRow, rownr_t& anEndRow,
+                           const String& colName,
+                           std::shared_ptr<const char>& aBucket)
+{
+  if (itsSharedCache == 0) {
+    return find (aRowNr, aColNr, aStartRow, anEndRow, colName);
+  }
+  // The index does not change while read by multiple threads.
+  SSMIndex* anIndexPtr = itsPtrIndex[itsColIndexMap[aColNr]];
+  uInt aBucketNr;
+  anIndexPtr->find(aRowNr,aBucketNr,aStartRow,anEndRow, colName);
+  aBucket = itsSharedCache->getBucket (aBucketNr);
+  return aBucket.get() + itsColumnOffset[aColNr];
+}
+
+
+const char* SSMBase::findMapped (rownr_t aRowNr,     uInt aColNr,
+                                 rownr_t& aStartRow, rownr_t& anEndRow,
+                                 const String& colName)
+{
+  getCache();
+  MMapfdIO* aMapped = itsFile->mappedFile();
+  if (aMapped == 0  ||  itsFile->isWritable()) {
+    return 0;
+  }
+  SSMIndex* anIndexPtr = itsPtrIndex[itsColIndexMap[aColNr]];
+  uInt aBucketNr;
+  anIndexPtr->find(aRowNr,aBucketNr,aStartRow,anEndRow, colName);
+  // The buckets start at offset 512 in the file.
+  // The file might have been extended after it was mapped.
+  Int64 anOffset = 512 + Int64(aBucketNr) * itsBucketSize;
+  if (anOffset + itsBucketSize > aMapped->getFileSize()) {
+    return 0;
+  }
+  return static_cast<const char*>(aMapped->getReadPointer(anOffset))
+         + itsColumnOffset[aColNr];
+}
 
 
 void SSMBase::recreate()
 {
+  delete itsSharedCache;
+  itsSharedCache = 0;
   delete itsCache;
   itsCache = 0;
   delete itsFile;
@@ -991,6 +1083,9 @@ rownr_t SSMBase::resync64 (rownr_t aNrRows)
   if (itsPtrIndex.nelements() != 0) {
     readIndexBuckets();
   }  
+  if (itsSharedCache != 0) {
+    makeSharedCache();
+  }
   if (itsStringHandler != 0) {
     itsStringHandler->resync();
   }
@@ -1022,8 +1117,13 @@ rownr_t SSMBase::open64 (rownr_t aRowNr, AipsIO& ios)
   getBlock (ios,itsColIndexMap);
   ios.getend();
   
+  // Memory-map a read-only file, so data can be read directly from it.
+  Bool mapFile = False;
+  if (!table().isWritable()) {
+    AipsrcValue<Bool>::find (mapFile, "table.ssm.mmap", True);
+  }
   itsFile = new BucketFile (fileName(), table().isWritable(),
-                            0, False, multiFile());
+                            0, mapFile, multiFile());
   AlwaysAssert (itsFile != 0, AipsError);
 
   // Let the column object initialize themselves (if needed)
@@ -1031,6 +1131,12 @@ rownr_t SSMBase::open64 (rownr_t aRowNr, AipsIO& ios)
   for (uInt i=0; i<aNrCol; i++) {
     itsPtrColumn[i]->getFile(itsNrRows);
   }
+  // If read by multiple threads, the caches and indices are created
+  // now instead of on first access.
+  if (DataManager::concurrentRead()  &&  !table().isWritable()  &&
+      !itsFile->isMultiFile()) {
+    makeSharedCache();
+  }
   return itsNrRows;
 }
 
@@ -1045,6 +1151,14 @@ StManArrayFile* SSMBase::openArrayFile (ByteIO::OpenOption anOpt)
 
 void SSMBase::reopenRW()
 {
+  // The column caches can point into the memory-mapped file, which
+  // might be unmapped when reopening the file.
+  for (uInt i=0; i<ncolumn(); i++) {
+    itsPtrColumn[i]->columnCache().invalidate();
+  }
+  // The shared cache can only be used for a read-only file.
+  delete itsSharedCache;
+  itsSharedCache = 0;
   if (itsFile != 0) {
     itsFile->setRW();
   }
@@ -1057,6 +1171,8 @@ void SSMBase::deleteManager()
 {
   delete itsIosFile;
   itsIosFile = 0;
+  delete itsSharedCache;
+  itsSharedCache = 0;
   // Clear cache without flushing.
   if (itsCache != 0) {
     itsCache->clear (0, False);
@@ -31,12 +31,15 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/casa/Containers/Block.h>
+#include <memory>
+#include <mutex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward declarations
 class BucketCache;
 class BucketFile;
+class ShardedBucketCache;
 class StManArrayFile;
 class SSMIndex;
 class SSMColumn;
@@ -78,7 +81,11 @@ class SSMStringHandler;
 // </ul>
 // Bucket access is handled by class
 // <linkto class=BucketCache>BucketCache</linkto>.
-// It also keeps a list of free buckets. A bucket is freed when it is
+// If the table is opened read-only, the file is also memory-mapped
+// (unless aipsrc variable <src>table.ssm.mmap</src> is False), so
+// the column data that need no conversion can be copied straight from
+// the mapping without going through the cache.
+// BucketCache also keeps a list of free buckets. A bucket is freed when it is
 // not needed anymore (e.g. all data from it are deleted).
 // <p>
 // Data buckets form the main part of the SSM. The data can be viewed as
@@ -214,9 +221,16 @@ public:
   // It will flush the cache as needed and remove all buckets from it.
   void clearCache();
 
+  // Is the file memory-mapped, thus are data read directly from the file
+  // where possible?
+  Bool isMapped() const;
+
   // Show the statistics of all caches used.
   virtual void showCacheStatistics (ostream& anOs) const;
 
+  // Get the statistics of the cache and bucket file as a record.
+  virtual Record cacheStatistics() const;
+
   // Show statistics of all indices used.
   void showIndexStatistics (ostream & anOs) const;
 
@@ -231,6 +245,9 @@ public:
   
   // The storage manager can add rows.
   virtual Bool canAddRow() const;
+
+  // Opening the storage manager can be deferred.
+  virtual Bool canDeferOpen() const;
   
   // The storage manager can delete rows.
   virtual Bool canRemoveRow() const;
@@ -269,6 +286,21 @@ public:
 	      rownr_t& aStartRow, rownr_t& anEndRow,
               const String& colName);
 
+  // Similar to <src>find</src> above, but if the storage manager is read
+  // by multiple threads, the bucket is taken from the thread-safe cache.
+  // <src>aBucket</src> keeps the bucket alive while it is being used.
+  const char* find (rownr_t aRowNr,     uInt aColNr,
+                    rownr_t& aStartRow, rownr_t& anEndRow,
+                    const String& colName,
+                    std::shared_ptr<const char>& aBucket);
+
+  // Similar to <src>find</src>, but return a pointer into the memory-mapped
+  // file. It returns a null pointer if the file is not mapped or writable,
+  // or if the bucket is beyond the mapped part.
+  const char* findMapped (rownr_t aRowNr,     uInt aColNr,
+                          rownr_t& aStartRow, rownr_t& anEndRow,
+                          const String& colName);
+
   // Add a new bucket and get its bucket number.
   uInt getNewBucket();
 
@@ -284,6 +316,15 @@ public:
   // Return a pointer to the (one and only) StringHandler object.
   SSMStringHandler* getStringHandler();
 
+  // Is the storage manager read by multiple threads
+  // (see <src>DataManager::setConcurrentRead</src>)?
+  Bool isConcurrent() const;
+
+  // Get a lock serializing the access to the strings and indirect arrays
+  // if the storage manager is read by multiple threads; otherwise the
+  // lock returned does not own the mutex.
+  std::unique_lock<std::mutex> lockConcurrent();
+
   // <group>
   // Callbacks for BucketCache access.
   static char* readCallBack (void* anOwner, const char* aBucketStorage);
@@ -379,6 +420,9 @@ private:
   
   // Construct the cache object (if not constructed yet).
   void makeCache();
+
+  // (Re)construct the thread-safe cache used if read by multiple threads.
+  void makeSharedCache();
   
   // Read the header.
   void readHeader();
@@ -411,6 +455,12 @@ private:
   
   // The cache with the SSM buckets.
   BucketCache* itsCache;
+
+  // The thread-safe cache used if read by multiple threads.
+  ShardedBucketCache* itsSharedCache;
+
+  // The mutex used by lockConcurrent.
+  std::mutex itsMutex;
   
   // The file containing all data.
   BucketFile*  itsFile;
@@ -504,6 +554,19 @@ inline SSMStringHandler* SSMBase::getStringHandler()
   return itsStringHandler;
 }
 
+inline Bool SSMBase::isConcurrent() const
+{
+  return itsSharedCache != 0;
+}
+
+inline std::unique_lock<std::mutex> SSMBase::lockConcurrent()
+{
+  if (itsSharedCache != 0) {
+    return std::unique_lock<std::mutex> (itsMutex);
+  }
+  return std::unique_lock<std::mutex> (itsMutex, std::defer_lock);
+}
+
 
 
 } //# NAMESPACE CASACORE - END
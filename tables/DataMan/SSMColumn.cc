@@ -26,6 +26,7 @@
 #include <casacore/tables/DataMan/SSMColumn.h>
 #include <casacore/tables/DataMan/SSMBase.h>
 #include <casacore/tables/DataMan/SSMStringHandler.h>
+#include <casacore/tables/DataMan/StringDictionary.h>
 #include <casacore/tables/Tables/RefRows.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Vector.h>
@@ -33,8 +34,10 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/OS/HostInfo.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/LECanonicalConversion.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -48,7 +51,8 @@ SSMColumn::SSMColumn (SSMBase* aParent, int aDataType, uInt aColNr)
   itsMaxLen      (0),
   itsNrElem      (1),
   itsNrCopy      (0),
-  itsData        (0)
+  itsData        (0),
+  itsNoConversion(False)
 {
   init();
 }
@@ -190,61 +194,78 @@ void SSMColumn::shiftRows(char* aValue, rownr_t aRowNr,
 }
 
 
+template<typename T>
+void SSMColumn::getCell (rownr_t aRowNr, T* aValue)
+{
+  if (itsSSMPtr->isConcurrent()) {
+    // The column cache cannot be shared by threads, so read the value
+    // from the bucket (which is kept alive by the shared pointer).
+    rownr_t aStartRow;
+    rownr_t anEndRow;
+    Bool    isMapped;
+    std::shared_ptr<const char> aBucket;
+    const char* aValPtr = findData (aRowNr, aStartRow, anEndRow, isMapped,
+                                    aBucket);
+    uInt64 anOff = aRowNr - aStartRow;
+    if (dtype() == TpBool) {
+      Conversion::bitToBool (reinterpret_cast<Bool*>(aValue),
+                             aValPtr + anOff*itsNrCopy/8,
+                             anOff*itsNrCopy%8, itsNrCopy);
+    } else {
+      readData (reinterpret_cast<char*>(aValue),
+                aValPtr + anOff*itsExternalSizeBytes, 1, isMapped);
+    }
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const T*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
+  }
+}
+
 void SSMColumn::getBool (rownr_t aRowNr, Bool* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Bool*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 void SSMColumn::getuChar (rownr_t aRowNr, uChar* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<uChar*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 void SSMColumn::getShort (rownr_t aRowNr, Short* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Short*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 void SSMColumn::getuShort (rownr_t aRowNr, uShort* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<uShort*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 void SSMColumn::getInt (rownr_t aRowNr, Int* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Int*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 void SSMColumn::getuInt (rownr_t aRowNr, uInt* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<uInt*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 void SSMColumn::getInt64 (rownr_t aRowNr, Int64* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Int64*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 void SSMColumn::getfloat (rownr_t aRowNr, float* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<float*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 void SSMColumn::getdouble (rownr_t aRowNr, double* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<double*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 void SSMColumn::getComplex (rownr_t aRowNr, Complex* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Complex*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 
 void SSMColumn::getDComplex (rownr_t aRowNr,DComplex* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<DComplex*>(itsData)[aRowNr-columnCache().start()];
+  getCell (aRowNr, aValue);
 }
 
 void SSMColumn::getString (rownr_t aRowNr, String* aValue)
@@ -257,8 +278,9 @@ void SSMColumn::getString (rownr_t aRowNr, String* aValue)
     char* sp = const_cast<char*>(aValue->chars());
     rownr_t aStartRow;
     rownr_t anEndRow;
-    char* buf = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
-                                 columnName());
+    std::shared_ptr<const char> aBucket;
+    const char* buf = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                                       columnName(), aBucket);
     itsReadFunc (sp, buf+(aRowNr-aStartRow)*itsExternalSizeBytes,
 		 itsNrCopy);
     // Append a trailing zero (in case needed).
@@ -271,6 +293,8 @@ void SSMColumn::getString (rownr_t aRowNr, String* aValue)
     }
     aValue->alloc(len);
   } else {
+    // The string handler and the bucket cache it uses are not thread-safe.
+    std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
 
     // The string is probably stored indirectly in a string bucket.
     // Get bucketnr, offset, and length.
@@ -310,11 +334,20 @@ void SSMColumn::getValue(rownr_t aRowNr)
   if (aRowNr < columnCache().start()  ||  aRowNr > columnCache().end()) {
     rownr_t aStartRow;
     rownr_t anEndRow;
-    char*   aValue;
-    aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
-                              columnName());
-    itsReadFunc (getDataPtr(), aValue, (anEndRow-aStartRow+1) * itsNrCopy);
-    columnCache().set (aStartRow, anEndRow, getDataPtr());
+    Bool    isMapped;
+    std::shared_ptr<const char> aBucket;
+    const char* aValue = findData (aRowNr, aStartRow, anEndRow, isMapped,
+                                   aBucket);
+    // Aligned data in the memory-mapped file can be used directly, which
+    // avoids copying the bucket data for each bucket being accessed.
+    // The mapping stays valid while the table is not writable.
+    if (isMapped  &&
+        size_t(aValue) % std::min (itsLocalSize, uInt(sizeof(double))) == 0) {
+      columnCache().set (aStartRow, anEndRow, aValue);
+    } else {
+      readData (getDataPtr(), aValue, anEndRow-aStartRow+1, isMapped);
+      columnCache().set (aStartRow, anEndRow, getDataPtr());
+    }
   }
 }
 
@@ -509,21 +542,211 @@ void SSMColumn::getColumnValue(void* anArray,rownr_t aNrRows)
   char*   aDataPtr = static_cast<char*>(anArray);
   rownr_t aRowNr=0;
   rownr_t rowsToDo = aNrRows;
+  std::shared_ptr<const char> aBucket;
   
   while (rowsToDo > 0) {
     rownr_t aStartRow;
     rownr_t anEndRow;
-    char*   aValue;
-    aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
-                              columnName());
+    Bool    isMapped;
+    const char* aValue = findData (aRowNr, aStartRow, anEndRow, isMapped,
+                                   aBucket);
     aRowNr = anEndRow+1;
     rownr_t aNr = anEndRow-aStartRow+1;
     rowsToDo -= aNr;
-    itsReadFunc (aDataPtr, aValue, aNr * itsNrCopy);
+    readData (aDataPtr, aValue, aNr, isMapped);
     aDataPtr += aNr * itsLocalSize;
   }
 }
 
+const char* SSMColumn::findData (rownr_t aRowNr, rownr_t& aStartRow,
+                                 rownr_t& anEndRow, Bool& isMapped,
+                                 std::shared_ptr<const char>& aBucket)
+{
+  isMapped = False;
+  if (itsNoConversion) {
+    const char* aValue = itsSSMPtr->findMapped (aRowNr, itsColNr, aStartRow,
+                                                anEndRow, columnName());
+    if (aValue != 0) {
+      isMapped = True;
+      return aValue;
+    }
+  }
+  return itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                          columnName(), aBucket);
+}
+
+void SSMColumn::readData (char* aBuffer, const char* aValue, rownr_t aNrRows,
+                          Bool isMapped)
+{
+  if (isMapped) {
+    memcpy (aBuffer, aValue, aNrRows * itsLocalSize);
+  } else {
+    itsReadFunc (aBuffer, aValue, aNrRows * itsNrCopy);
+  }
+}
+
+void SSMColumn::getScalarColumnCellsV (const RefRows& rownrs,
+                                       ArrayBase& aDataPtr)
+{
+  if (dtype() == TpString) {
+    StManColumnBase::getScalarColumnCellsV (rownrs, aDataPtr);
+  } else {
+    Bool deleteIt;
+    void* anArray = aDataPtr.getVStorage(deleteIt);
+    accessColumnCells (rownrs, static_cast<char*>(anArray), False);
+    aDataPtr.putVStorage(anArray, deleteIt);
+  }
+}
+
+void SSMColumn::getStringCodesV (const RefRows& rownrs, uInt* codes,
+                                 StringDictionary& dictionary)
+{
+  if (dtype() != TpString  ||  itsNrElem != 1) {
+    StManColumnBase::getStringCodesV (rownrs, codes, dictionary);
+    return;
+  }
+  // Indirect strings are read by the string handler, which is not
+  // thread-safe.
+  std::unique_lock<std::mutex> lock;
+  if (itsMaxLen == 0) {
+    lock = itsSSMPtr->lockConcurrent();
+  }
+  String value;
+  std::shared_ptr<const char> aBucket;
+  RefRowsSliceIter iter(rownrs);
+  while (! iter.pastEnd()) {
+    rownr_t rownr = iter.sliceStart();
+    rownr_t end   = iter.sliceEnd();
+    rownr_t incr  = iter.sliceIncr();
+    while (rownr <= end) {
+      // Handle the rows in the bucket containing this row.
+      rownr_t aStartRow;
+      rownr_t anEndRow;
+      const char* buf = itsSSMPtr->find (rownr, itsColNr, aStartRow,
+                                         anEndRow, columnName(), aBucket);
+      rownr_t lastRow = std::min (end, anEndRow);
+      while (rownr <= lastRow) {
+        const char* ptr = buf + (rownr-aStartRow)*itsExternalSizeBytes;
+        rownr += incr;
+        if (itsMaxLen > 0) {
+          // Fixed length string; it ends at the first zero byte (if any).
+          const char* zero = static_cast<const char*>
+            (memchr (ptr, 0, itsMaxLen));
+          *codes++ = dictionary.code (ptr, zero ? zero-ptr : itsMaxLen);
+        } else {
+          // Bucketnr, offset, and length of an indirect string.
+          Int data[3];
+          itsReadFunc (data, ptr, itsNrCopy);
+          if (data[2] <= 8) {
+            *codes++ = dictionary.code (ptr, data[2]);
+          } else {
+            itsSSMPtr->getStringHandler()->get (value, data[0], data[1],
+                                                data[2]);
+            *codes++ = dictionary.code (value);
+            // Reading the string bucket can remove the data bucket
+            // from the cache, so find it again.
+            break;
+          }
+        }
+      }
+    }
+    iter++;
+  }
+}
+
+void SSMColumn::putScalarColumnCellsV (const RefRows& rownrs,
+                                       const ArrayBase& aDataPtr)
+{
+  if (dtype() == TpString) {
+    StManColumnBase::putScalarColumnCellsV (rownrs, aDataPtr);
+  } else {
+    // The cache might get outdated.
+    columnCache().invalidate();
+    Bool deleteIt;
+    const void* anArray = aDataPtr.getVStorage(deleteIt);
+    accessColumnCells (rownrs,
+                       static_cast<char*>(const_cast<void*>(anArray)), True);
+    aDataPtr.freeVStorage(anArray, deleteIt);
+  }
+}
+
+void SSMColumn::accessColumnCells (const RefRows& rownrs, char* aBuffer,
+                                   Bool writeFlag)
+{
+  // Bools are stored as bits; the bit offset of a row uses itsNrCopy.
+  Bool isBool = (dtype() == TpBool);
+  uInt cellSize = (isBool ? itsNrCopy : itsLocalSize);
+  // Start with an empty bucket row range.
+  rownr_t aStartRow = 1;
+  rownr_t anEndRow  = 0;
+  char*   aValue    = 0;
+  Bool    isMapped  = False;
+  std::shared_ptr<const char> aBucket;
+  auto accessSlice = [&] (rownr_t rownr, rownr_t end, rownr_t incr)
+  {
+    while (rownr <= end) {
+      if (rownr < aStartRow  ||  rownr > anEndRow) {
+        if (writeFlag) {
+          aValue = itsSSMPtr->find (rownr, itsColNr, aStartRow, anEndRow,
+                                    columnName());
+        } else {
+          aValue = const_cast<char*>(findData (rownr, aStartRow, anEndRow,
+                                               isMapped, aBucket));
+        }
+      }
+      // Consecutive rows in this bucket are done at once.
+      rownr_t nr = 1;
+      if (incr == 1) {
+        nr = std::min (end, anEndRow) - rownr + 1;
+      }
+      uInt64 anOff = rownr - aStartRow;
+      if (isBool) {
+        if (writeFlag) {
+          Conversion::boolToBit (aValue + anOff*itsNrCopy/8, aBuffer,
+                                 anOff*itsNrCopy%8, nr*itsNrCopy);
+        } else {
+          Conversion::bitToBool (aBuffer, aValue + anOff*itsNrCopy/8,
+                                 anOff*itsNrCopy%8, nr*itsNrCopy);
+        }
+      } else if (writeFlag) {
+        itsWriteFunc (aValue + anOff*itsExternalSizeBytes, aBuffer,
+                      nr*itsNrCopy);
+      } else {
+        readData (aBuffer, aValue + anOff*itsExternalSizeBytes, nr, isMapped);
+      }
+      if (writeFlag) {
+        itsSSMPtr->setBucketDirty();
+      }
+      aBuffer += nr * cellSize;
+      rownr   += nr * incr;
+    }
+  };
+  if (rownrs.isSliced()) {
+    RefRowsSliceIter iter(rownrs);
+    while (! iter.pastEnd()) {
+      accessSlice (iter.sliceStart(), iter.sliceEnd(), iter.sliceIncr());
+      iter++;
+    }
+  } else {
+    // Individual row numbers (e.g. of a RefTable); these are mostly
+    // ascending, so combine consecutive row numbers into a single slice.
+    const Vector<rownr_t>& rowvec = rownrs.rowVector();
+    Bool delR;
+    const rownr_t* rows = rowvec.getStorage (delR);
+    rownr_t nrow = rowvec.size();
+    rownr_t i = 0;
+    while (i < nrow) {
+      rownr_t j = i+1;
+      while (j < nrow  &&  rows[j] == rows[j-1] + 1) {
+        ++j;
+      }
+      accessSlice (rows[i], rows[j-1], 1);
+      i = j;
+    }
+    rowvec.freeStorage (rows, delR);
+  }
+}
+
 void SSMColumn::putScalarColumnV (const ArrayBase& aDataPtr)
 {
   if (dtype() == TpString) {
@@ -620,6 +843,11 @@ void SSMColumn::init()
     itsLocalSize         *= itsNrElem;
     itsExternalSizeBits   = 8*itsExternalSizeBytes;
   }
+  // Data in local format can be copied directly (not for bits and
+  // indirect strings).
+  itsNoConversion = (aDT != TpBool  &&  (aDT != TpString  ||  itsMaxLen > 0)
+                     &&  asBigEndian == HostInfo::bigEndian()
+                     &&  itsExternalSizeBytes == itsLocalSize);
 }
 
 void SSMColumn::resync (rownr_t)
@@ -176,6 +176,24 @@ public:
   // Put the scalar values of the entire column.
   // It invalidates the cache.
   virtual void putScalarColumnV (const ArrayBase& aDataPtr);
+
+  // Get or put the scalar values of some rows.
+  // The values are accessed directly in the data buckets, where all
+  // consecutive rows in a bucket are converted at once.
+  // Putting values invalidates the cache.
+  // <group>
+  virtual void getScalarColumnCellsV (const RefRows& rownrs,
+                                      ArrayBase& aDataPtr);
+  virtual void putScalarColumnCellsV (const RefRows& rownrs,
+                                      const ArrayBase& aDataPtr);
+  // </group>
+
+  // Get the values of a scalar String column in the given rows as
+  // dictionary codes.
+  // Strings stored in the data bucket (fixed length strings and short
+  // variable length strings) are looked up without making a String.
+  virtual void getStringCodesV (const RefRows& rownrs, uInt* codes,
+                                StringDictionary& dictionary);
   
   // Add (NewNrRows-OldNrRows) rows to the Column and initialize
   // the new rows when needed.
@@ -206,7 +224,15 @@ protected:
   void shiftRows (char* aValue, rownr_t rowNr, rownr_t startRow, rownr_t endRow);
 
   // Fill the cache with data of the bucket containing the given row.
+  // If possible, the cache points directly to the data in the
+  // memory-mapped file (see <src>findData</src>).
   void getValue (rownr_t aRowNr);
+
+  // Get the scalar value of the given row. If the storage manager is read
+  // by multiple threads, the value is read directly from the bucket
+  // instead of using the column cache.
+  template<typename T>
+  void getCell (rownr_t aRowNr, T* aValue);
   
   // Get the bucketnr, offset, and length of a variable length string.
   // <src>data</src> must have 3 Ints to hold the values.
@@ -226,11 +252,35 @@ protected:
   // Get the values for the entire column.
   // The data from all buckets is copied to the array.
   void getColumnValue (void* anArray, rownr_t aNrRows);
+
+  // Find the bucket containing the column and row and return the pointer
+  // to the beginning of the column data in that bucket (see SSMBase::find).
+  // The pointer points into the memory-mapped file if possible, which is
+  // the case if the table is read-only and no conversion is needed.
+  // <src>isMapped</src> tells if that is the case.
+  // <src>aBucket</src> keeps the bucket alive if the storage manager is
+  // read by multiple threads.
+  const char* findData (rownr_t aRowNr, rownr_t& aStartRow,
+                        rownr_t& anEndRow, Bool& isMapped,
+                        std::shared_ptr<const char>& aBucket);
+
+  // Copy the data of the given nr of rows found by <src>findData</src>
+  // to the buffer in local format.
+  void readData (char* aBuffer, const char* aValue, rownr_t aNrRows,
+                 Bool isMapped);
   
   // Put the values from the array in the entire column.
   // Each data bucket is filled with the the appropriate part of the array.
   void putColumnValue (const void* anArray, rownr_t aNrRows);
 
+  // Get or put the values of the given rows from or into the buffer
+  // (which must have the size of all cells together).
+  // A data bucket is looked up once for all its rows in a row range
+  // and consecutive rows are converted in a single call.
+  // It can be used for scalars and direct arrays, but not for strings.
+  void accessColumnCells (const RefRows& rownrs, char* aBuffer,
+                          Bool writeFlag);
+
 
   // Pointer to the parent storage manager.
   SSMBase*          itsSSMPtr;
@@ -257,6 +307,8 @@ protected:
   Conversion::ValueFunction* itsWriteFunc;
   // Pointer to a convert function for reading.
   Conversion::ValueFunction* itsReadFunc;
+  // Are the data stored in local format, thus need no conversion?
+  Bool              itsNoConversion;
   
 private:
   // Initialize part of the object.
@@ -25,6 +25,7 @@
 
 #include <casacore/tables/DataMan/SSMDirColumn.h>
 #include <casacore/tables/DataMan/SSMStringHandler.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Utilities/ValType.h>
 
@@ -58,11 +59,7 @@ void SSMDirColumn::deleteRow(rownr_t aRowNr)
       uInt64 anOffr = (aRowNr-aSRow+1) * itsNrCopy;
       uInt64 anOfto = (aRowNr-aSRow) * itsNrCopy;
       uInt64 nr = (anERow-aRowNr) * itsNrCopy;
-      Block<Bool> tmp(nr);
-      Conversion::bitToBool (tmp.storage(), aValue + anOffr/8,
-			     anOffr%8, nr);
-      Conversion::boolToBit (aValue + anOfto/8, tmp.storage(),
-			     anOfto%8, nr);
+      Conversion::copyBits (aValue, anOfto, aValue, anOffr, nr);
     } else {
       // remove from bucket
       shiftRows(aValue,aRowNr,aSRow,anERow);
@@ -78,16 +75,17 @@ void SSMDirColumn::getArrayV (rownr_t aRowNr, ArrayBase& aDataPtr)
     // Bools need to be converted from bits.
     rownr_t aStartRow;
     rownr_t anEndRow;
-    char*   aValue;
+    std::shared_ptr<const char> aBucket;
     Array<Bool>& arr = static_cast<Array<Bool>&>(aDataPtr);
     Bool* data = arr.getStorage (deleteIt);
-    aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
-                              columnName());
+    const char* aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow,
+                                          anEndRow, columnName(), aBucket);
     uInt64 anOff = (aRowNr-aStartRow) * itsNrCopy;
     Conversion::bitToBool(data, aValue+ anOff/8, anOff%8, itsNrCopy);
     arr.putStorage (data, deleteIt);
   } else if (dtype() == TpString) {
-    // Strings are stored indirectly.
+    // Strings are stored indirectly (by the not thread-safe string handler).
+    std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
     Int buf[3];
     getRowValue(buf, aRowNr);
     Array<String>& arr = static_cast<Array<String>&>(aDataPtr);
@@ -100,13 +98,89 @@ void SSMDirColumn::getArrayV (rownr_t aRowNr, ArrayBase& aDataPtr)
   }
 }
 
-void SSMDirColumn::getValue(rownr_t aRowNr, void* data)
+void SSMDirColumn::getArrayColumnV (ArrayBase& aDataPtr)
 {
+  rownr_t nrow = aDataPtr.shape().last();
+  if (nrow > 0) {
+    getArrayColumnCellsV (RefRows(0, nrow-1), aDataPtr);
+  }
+}
+
+void SSMDirColumn::putArrayColumnV (const ArrayBase& aDataPtr)
+{
+  rownr_t nrow = aDataPtr.shape().last();
+  if (nrow > 0) {
+    putArrayColumnCellsV (RefRows(0, nrow-1), aDataPtr);
+  }
+}
+
+void SSMDirColumn::getArrayColumnCellsV (const RefRows& rownrs,
+                                         ArrayBase& aDataPtr)
+{
+  if (dtype() == TpString) {
+    SSMColumn::getArrayColumnCellsV (rownrs, aDataPtr);
+  } else {
+    Bool deleteIt;
+    void* data = aDataPtr.getVStorage (deleteIt);
+    accessColumnCells (rownrs, static_cast<char*>(data), False);
+    aDataPtr.putVStorage (data, deleteIt);
+  }
+}
+
+void SSMDirColumn::putArrayColumnCellsV (const RefRows& rownrs,
+                                         const ArrayBase& aDataPtr)
+{
+  if (dtype() == TpString) {
+    SSMColumn::putArrayColumnCellsV (rownrs, aDataPtr);
+  } else {
+    Bool deleteIt;
+    const void* data = aDataPtr.getVStorage (deleteIt);
+    accessColumnCells (rownrs, static_cast<char*>(const_cast<void*>(data)),
+                       True);
+    aDataPtr.freeVStorage (data, deleteIt);
+  }
+}
+
+void SSMDirColumn::getPackedBoolV (rownr_t aRowNr, const IPosition& shape,
+                                   uChar* bits)
+{
+  if (dtype() != TpBool  ||  uInt64(shape.product()) != itsNrCopy) {
+    SSMColumn::getPackedBoolV (aRowNr, shape, bits);
+    return;
+  }
+  rownr_t aStartRow;
+  rownr_t anEndRow;
+  std::shared_ptr<const char> aBucket;
+  const char* aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow,
+                                        anEndRow, columnName(), aBucket);
+  uInt64 anOff = (aRowNr-aStartRow) * itsNrCopy;
+  Conversion::copyBits (bits, 0, aValue, anOff, itsNrCopy);
+}
+
+void SSMDirColumn::putPackedBoolV (rownr_t aRowNr, const IPosition& shape,
+                                   const uChar* bits)
+{
+  if (dtype() != TpBool  ||  uInt64(shape.product()) != itsNrCopy) {
+    SSMColumn::putPackedBoolV (aRowNr, shape, bits);
+    return;
+  }
   rownr_t aStartRow;
   rownr_t anEndRow;
   char*   aValue;
   aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                             columnName());
+  uInt64 anOff = (aRowNr-aStartRow) * itsNrCopy;
+  Conversion::copyBits (aValue, anOff, bits, 0, itsNrCopy);
+  itsSSMPtr->setBucketDirty();
+}
+
+void SSMDirColumn::getValue(rownr_t aRowNr, void* data)
+{
+  rownr_t aStartRow;
+  rownr_t anEndRow;
+  std::shared_ptr<const char> aBucket;
+  const char* aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow,
+                                        anEndRow, columnName(), aBucket);
   itsReadFunc (data, aValue+(aRowNr-aStartRow)*itsExternalSizeBytes,
 	       itsNrCopy);
 }
@@ -100,6 +100,27 @@ public:
   // Put an array value in the given row.
   virtual void putArrayV (rownr_t rownr, const ArrayBase& dataPtr);
 
+  // Get or put the arrays in all or some rows.
+  // A data bucket is looked up once for all its rows and consecutive
+  // rows are converted in a single call.
+  // <group>
+  virtual void getArrayColumnV (ArrayBase& dataPtr);
+  virtual void putArrayColumnV (const ArrayBase& dataPtr);
+  virtual void getArrayColumnCellsV (const RefRows& rownrs,
+                                     ArrayBase& dataPtr);
+  virtual void putArrayColumnCellsV (const RefRows& rownrs,
+                                     const ArrayBase& dataPtr);
+  // </group>
+
+  // Get or put a Bool array in the given row as packed bits.
+  // The bits are copied directly from or to the bucket.
+  // <group>
+  virtual void getPackedBoolV (rownr_t rownr, const IPosition& shape,
+                               uChar* bits);
+  virtual void putPackedBoolV (rownr_t rownr, const IPosition& shape,
+                               const uChar* bits);
+  // </group>
+
   // Remove the given row from the data bucket and possibly string bucket.
   virtual void deleteRow (rownr_t aRowNr);
 
@@ -158,14 +158,25 @@ StIndArray* SSMIndColumn::getShape (rownr_t aRowNr)
     return aPtr;
 }
 
+//# The indirect array file and the current array object are not
+//# thread-safe, so access is serialized if read by multiple threads.
 Bool SSMIndColumn::isShapeDefined (rownr_t aRowNr)
-    { return (getArrayPtr(aRowNr) == 0  ?  False : True); }
+{
+  std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
+  return (getArrayPtr(aRowNr) == 0  ?  False : True);
+}
 
 uInt SSMIndColumn::ndim (rownr_t aRowNr)
-    { return getShape(aRowNr)->shape().nelements(); }
+{
+  std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
+  return getShape(aRowNr)->shape().nelements();
+}
 
 IPosition SSMIndColumn::shape (rownr_t aRowNr)
-    { return getShape(aRowNr)->shape(); }
+{
+  std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
+  return getShape(aRowNr)->shape();
+}
 
 Bool SSMIndColumn::canChangeShape() const
     { return (isShapeFixed  ?  False : True); }
@@ -187,6 +198,7 @@ void SSMIndColumn::deleteRow(rownr_t aRowNr)
 
 void SSMIndColumn::getArrayV (rownr_t aRowNr, ArrayBase& arr)
 {
+  std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
   getShape(aRowNr)->getArrayV (*itsIosFile, arr, dtype());
 }
 
@@ -198,6 +210,7 @@ void SSMIndColumn::putArrayV (rownr_t aRowNr, const ArrayBase& arr)
 void SSMIndColumn::getSliceV (rownr_t aRowNr, const Slicer& ns,
                               ArrayBase& arr)
 {
+  std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
   getShape(aRowNr)->getSliceV (*itsIosFile, ns, arr, dtype());
 }
 
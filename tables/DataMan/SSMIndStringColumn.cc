@@ -62,6 +62,8 @@ IPosition SSMIndStringColumn::shape (rownr_t aRowNr)
     return itsShape;
   }
 
+  // The string handler is not thread-safe.
+  std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
   IPosition aShape;
   Int buf[3];
 
@@ -88,6 +90,7 @@ Bool SSMIndStringColumn::isShapeDefined (rownr_t aRowNr)
   if (itsShape.nelements() != 0) {
     return True;
   } else {
+    std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
     Int buf[3];
     getRowValue(buf, aRowNr);
     return buf[2] != 0;
@@ -106,6 +109,7 @@ void SSMIndStringColumn::getArrayV (rownr_t aRowNr,
   if (itsShape.nelements() != 0) {
     SSMDirColumn::getArrayV (aRowNr,aDataPtr);
   } else {
+    std::unique_lock<std::mutex> lock (itsSSMPtr->lockConcurrent());
     Int buf[3];
     getRowValue(buf, aRowNr);
     if ( buf[2] == 0 ) {
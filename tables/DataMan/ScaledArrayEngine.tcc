@@ -36,6 +36,7 @@
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/ArrayIter.h>
+#include <casacore/casa/Arrays/ArrayMathKernels.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/ValTypeId.h>
@@ -256,6 +257,7 @@ S ScaledArrayEngine<S,T>::getOffset (rownr_t rownr)
 }
 
 // Scale/offset an array for get.
+// Large arrays are done in parallel chunks (see ArrayMathKernels.h).
 template<class S, class T>
 void ScaledArrayEngine<S,T>::scaleOnGet (S scale, S offset,
 					 Array<S>& array,
@@ -263,31 +265,36 @@ void ScaledArrayEngine<S,T>::scaleOnGet (S scale, S offset,
 {
     Bool deleteIn, deleteOut;
     S* out = array.getStorage (deleteOut);
-    S* op  = out;
     const T* in = target.getStorage (deleteIn);
-    const T* ip = in;
-    const T* last = ip + array.nelements();
-    if (offset == 0) {
-	if (scale == 1) {
-	    while (ip < last) {
-		*op++ = *ip++;
-	    }
-	}else{
-	    while (ip < last) {
-		*op++ = *ip++ * scale;
-	    }
-	}
-    }else{
-	if (scale == 1) {
-	    while (ip < last) {
-		*op++ = *ip++ + offset;
-	    }
-	}else{
-	    while (ip < last) {
-		*op++ = *ip++ * scale + offset;
-	    }
-	}
-    }
+    const size_t n = array.nelements();
+    arrays_internal::parallelChunks
+      (n, arrays_internal::parallelNChunk(n),
+       [=] (size_t, size_t st, size_t len)
+       {
+	   const T* ip = in + st;
+	   S* op = out + st;
+	   if (offset == 0) {
+	       if (scale == 1) {
+		   for (size_t i=0; i<len; ++i) {
+		       op[i] = ip[i];
+		   }
+	       }else{
+		   for (size_t i=0; i<len; ++i) {
+		       op[i] = ip[i] * scale;
+		   }
+	       }
+	   }else{
+	       if (scale == 1) {
+		   for (size_t i=0; i<len; ++i) {
+		       op[i] = ip[i] + offset;
+		   }
+	       }else{
+		   for (size_t i=0; i<len; ++i) {
+		       op[i] = ip[i] * scale + offset;
+		   }
+	       }
+	   }
+       });
     target.freeStorage (in, deleteIn);
     array.putStorage (out, deleteOut);
 }
@@ -300,31 +307,36 @@ void ScaledArrayEngine<S,T>::scaleOnPut (S scale, S offset,
 {
     Bool deleteIn, deleteOut;
     const S* in = array.getStorage (deleteIn);
-    const S* ip = in;
     T* out = target.getStorage (deleteOut);
-    T* op  = out;
-    const T* last = op + array.nelements();
-    if (offset == 0) {
-	if (scale == 1) {
-	    while (op < last) {
-		*op++ = T(*ip++);
-	    }
-	}else{
-	    while (op < last) {
-		*op++ = T(*ip++ / scale);
-	    }
-	}
-    }else{
-	if (scale == 1) {
-	    while (op < last) {
-		*op++ = T(*ip++ - offset);
-	    }
-	}else{
-	    while (op < last) {
-		*op++ = T((*ip++ - offset) / scale);
-	    }
-	}
-    }
+    const size_t n = array.nelements();
+    arrays_internal::parallelChunks
+      (n, arrays_internal::parallelNChunk(n),
+       [=] (size_t, size_t st, size_t len)
+       {
+	   const S* ip = in + st;
+	   T* op = out + st;
+	   if (offset == 0) {
+	       if (scale == 1) {
+		   for (size_t i=0; i<len; ++i) {
+		       op[i] = T(ip[i]);
+		   }
+	       }else{
+		   for (size_t i=0; i<len; ++i) {
+		       op[i] = T(ip[i] / scale);
+		   }
+	       }
+	   }else{
+	       if (scale == 1) {
+		   for (size_t i=0; i<len; ++i) {
+		       op[i] = T(ip[i] - offset);
+		   }
+	       }else{
+		   for (size_t i=0; i<len; ++i) {
+		       op[i] = T((ip[i] - offset) / scale);
+		   }
+	       }
+	   }
+       });
     array.freeStorage (in, deleteIn);
     target.putStorage (out, deleteOut);
 }
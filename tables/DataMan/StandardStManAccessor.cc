@@ -81,6 +81,11 @@ void ROStandardStManAccessor::clearCache()
     itsSSMPtr->clearCache();
 }
 
+Bool ROStandardStManAccessor::isMapped() const
+{
+    return itsSSMPtr->isMapped();
+}
+
 void ROStandardStManAccessor::showBaseStatistics (ostream& anOs) const
 {
     itsSSMPtr->showBaseStatistics (anOs);
@@ -138,6 +138,9 @@ public:
     // resulting in a drop in memory used.
     void clearCache();
 
+    // Is the file memory-mapped (see class SSMBase)?
+    Bool isMapped() const;
+
     // Show the statistics for the base class.
     void showBaseStatistics (ostream& anOs) const;
 
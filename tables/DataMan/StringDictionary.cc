@@ -0,0 +1,53 @@
+//# StringDictionary.cc: Dictionary encoding of string values
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/DataMan/StringDictionary.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <algorithm>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+uInt StringDictionary::code (const Char* value, size_t length)
+{
+  // Reuse the key buffer to avoid an allocation per lookup.
+  itsKey.assign (value, length);
+  auto iter = itsCodes.find (itsKey);
+  if (iter != itsCodes.end()) {
+    return iter->second;
+  }
+  uInt newCode = itsValues.size();
+  itsCodes.emplace (itsKey, newCode);
+  itsValues.push_back (String(value, length));
+  return newCode;
+}
+
+void StringDictionary::getValues (Vector<String>& values) const
+{
+  values.resize (itsValues.size());
+  std::copy (itsValues.begin(), itsValues.end(), values.begin());
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,107 @@
+//# StringDictionary.h: Dictionary encoding of string values
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_STRINGDICTIONARY_H
+#define TABLES_STRINGDICTIONARY_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Dictionary encoding of string values.
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tStringColumnCodes" demos="">
+// </reviewed>
+
+// <synopsis>
+// StringDictionary assigns a code to each distinct string it is given.
+// The codes are consecutive, starting at 0, in order of first appearance,
+// so the code is the index of the string in the dictionary.
+// <p>
+// It is used by the <src>getStringCodes</src> functions of the column
+// classes to read a String column as integer codes plus a dictionary.
+// That is much cheaper for columns with few distinct values (e.g. the
+// NAME column in an MS FIELD table), because a String object is only
+// made for each distinct value instead of for each row. Comparing or
+// grouping the values can then be done on the codes.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   StringDictionary dict;
+//   uInt c0 = dict.code ("abc");    // 0
+//   uInt c1 = dict.code ("de");     // 1
+//   uInt c2 = dict.code ("abc");    // 0
+//   Vector<String> values;
+//   dict.getValues (values);        // ["abc", "de"]
+// </srcblock>
+// </example>
+
+class StringDictionary
+{
+public:
+  // Create an empty dictionary.
+  StringDictionary()
+    {}
+
+  // Get the code of a string. It is added to the dictionary if new.
+  // <group>
+  uInt code (const String& value)
+    { return code (value.data(), value.size()); }
+  uInt code (const Char* value, size_t length);
+  // </group>
+
+  // Get the number of distinct strings.
+  uInt size() const
+    { return itsValues.size(); }
+
+  // Get the string with the given code.
+  const String& value (uInt code) const
+    { return itsValues[code]; }
+
+  // Get all distinct strings in order of their code.
+  // The vector is resized as needed.
+  void getValues (Vector<String>& values) const;
+
+private:
+  std::unordered_map<std::string, uInt> itsCodes;
+  std::vector<String>                   itsValues;
+  std::string                           itsKey;      // reused lookup key
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
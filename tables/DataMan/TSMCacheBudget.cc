@@ -0,0 +1,204 @@
+//# TSMCacheBudget.cc: Process-wide memory budget for the tile caches
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/DataMan/TSMCacheBudget.h>
+#include <casacore/tables/DataMan/TSMCube.h>
+#include <casacore/tables/DataMan/TSMFile.h>
+#include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// The budget is initialized from aipsrc at first use.
+static std::atomic<uInt> theirBudget (0);
+static std::once_flag theirInitFlag;
+// The clock used to order the accesses of the hypercubes.
+static std::atomic<uInt64> theirClock (0);
+// The mutex guards the set of cubes, the used size and the sizes
+// accounted for the cubes.
+static std::mutex theirMutex;
+static std::set<TSMCube*> theirCubes;
+static uInt64 theirUsed = 0;
+
+static void initBudget()
+{
+    Int nMiB;
+    AipsrcValue<Int>::find (nMiB, "table.tsm.cachebudget", 0);
+    theirBudget = std::max (nMiB, 0);
+}
+
+void TSMCacheBudget::account (TSMCube* cube, uInt nbuckets)
+{
+    theirUsed -= cube->budgetBytes_p;
+    cube->budgetBuckets_p = nbuckets;
+    cube->budgetBytes_p   = nbuckets * cube->bytesPerBucket();
+    theirUsed += cube->budgetBytes_p;
+}
+
+void TSMCacheBudget::reclaim (uInt64 needed, TSMCube* requester,
+                              Bool colderOnly)
+{
+    uInt64 key = std::numeric_limits<uInt64>::max();
+    if (requester  &&  colderOnly) {
+        key = requester->accessTime_p[1];
+    }
+    std::vector<TSMCube*> victims;
+    for (TSMCube* cube : theirCubes) {
+        if (cube != requester  &&  cube->budgetBuckets_p > 1  &&
+            cube->accessTime_p[1] < key) {
+            victims.push_back (cube);
+        }
+    }
+    // Coldest first; the most recent access decides for equal cubes.
+    std::sort (victims.begin(), victims.end(),
+               [] (const TSMCube* a, const TSMCube* b)
+               { return a->accessTime_p[1] < b->accessTime_p[1]  ||
+                   (a->accessTime_p[1] == b->accessTime_p[1]  &&
+                    a->accessTime_p[0] < b->accessTime_p[0]); });
+    for (TSMCube* cube : victims) {
+        uInt64 bpb = cube->bytesPerBucket();
+        uInt64 nfree = std::min (uInt64(cube->budgetBuckets_p - 1),
+                                 (needed + bpb - 1) / bpb);
+        uInt keep = cube->budgetBuckets_p - nfree;
+        // A readonly cache not in use can be shrunk immediately.
+        // Otherwise the new limit is applied at the next access.
+        if (!cube->filePtr_p->bucketFile()->isWritable()  &&
+            cube->cacheMutex_p.try_lock()) {
+            cube->cache_p->resize (keep);
+            cube->cacheMutex_p.unlock();
+            account (cube, keep);
+            needed -= std::min (needed, nfree * bpb);
+            if (needed == 0) {
+                break;
+            }
+        } else {
+            cube->budgetLimit_p = keep;
+        }
+    }
+}
+
+void TSMCacheBudget::setBudget (uInt nMiB)
+{
+    std::call_once (theirInitFlag, initBudget);
+    theirBudget = nMiB;
+    if (nMiB > 0) {
+        std::lock_guard<std::mutex> lock(theirMutex);
+        uInt64 budgetBytes = uInt64(nMiB) * 1024 * 1024;
+        if (theirUsed > budgetBytes) {
+            reclaim (theirUsed - budgetBytes, 0, False);
+        }
+    }
+}
+
+uInt TSMCacheBudget::budget()
+{
+    std::call_once (theirInitFlag, initBudget);
+    return theirBudget;
+}
+
+uInt64 TSMCacheBudget::usedBytes()
+{
+    std::lock_guard<std::mutex> lock(theirMutex);
+    return theirUsed;
+}
+
+void TSMCacheBudget::add (TSMCube* cube)
+{
+    uInt64 budgetBytes = uInt64(budget()) * 1024 * 1024;
+    std::lock_guard<std::mutex> lock(theirMutex);
+    if (theirCubes.insert(cube).second) {
+        cube->budgetBuckets_p = 0;
+        cube->budgetBytes_p   = 0;
+        cube->budgetLimit_p   = 0;
+        account (cube, cube->cache_p->cacheSize());
+        // Make room for the (small) initial cache.
+        if (budgetBytes > 0  &&  theirUsed > budgetBytes) {
+            reclaim (theirUsed - budgetBytes, cube, False);
+        }
+    }
+}
+
+void TSMCacheBudget::remove (TSMCube* cube)
+{
+    std::lock_guard<std::mutex> lock(theirMutex);
+    if (theirCubes.erase (cube) > 0) {
+        account (cube, 0);
+    }
+}
+
+void TSMCacheBudget::touch (TSMCube& cube)
+{
+    cube.accessTime_p[1] = cube.accessTime_p[0].load();
+    cube.accessTime_p[0] = ++theirClock;
+}
+
+uInt TSMCacheBudget::acquire (TSMCube* cube, uInt nbuckets)
+{
+    uInt64 budgetBytes = uInt64(budget()) * 1024 * 1024;
+    std::lock_guard<std::mutex> lock(theirMutex);
+    nbuckets = std::max (nbuckets, 1u);
+    if (budgetBytes > 0) {
+        uInt64 bpb = cube->bytesPerBucket();
+        uInt64 others = theirUsed - cube->budgetBytes_p;
+        if (others + nbuckets * bpb > budgetBytes) {
+            reclaim (others + nbuckets * bpb - budgetBytes, cube, True);
+            others = theirUsed - cube->budgetBytes_p;
+        }
+        uInt64 avail = (budgetBytes > others  ?  budgetBytes - others : 0);
+        nbuckets = std::max (std::min (uInt64(nbuckets), avail / bpb),
+                             uInt64(1));
+        // A cache has at least one bucket, for which room has to be made
+        // regardless of the hotness of the other cubes.
+        if (others + nbuckets * bpb > budgetBytes) {
+            reclaim (others + nbuckets * bpb - budgetBytes, cube, False);
+        }
+    }
+    account (cube, nbuckets);
+    cube->budgetLimit_p = 0;
+    return nbuckets;
+}
+
+void TSMCacheBudget::update (TSMCube* cube)
+{
+    std::lock_guard<std::mutex> lock(theirMutex);
+    if (theirCubes.find (cube) != theirCubes.end()) {
+        uInt nbuckets = cube->cache_p->cacheSize();
+        account (cube, nbuckets);
+        if (nbuckets <= cube->budgetLimit_p) {
+            cube->budgetLimit_p = 0;
+        }
+    }
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,130 @@
+//# TSMCacheBudget.h: Process-wide memory budget for the tile caches
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef TABLES_TSMCACHEBUDGET_H
+#define TABLES_TSMCACHEBUDGET_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class TSMCube;
+
+
+// <summary>
+// Process-wide memory budget for the tile caches of tiled storage managers
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tTSMCacheBudget">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> TSMCube
+//   <li> BucketCache
+// </prerequisite>
+
+// <synopsis>
+// The cache size of a hypercube in a tiled storage manager is determined
+// from the access pattern and limited by the maximum cache size of its
+// storage manager. With many hypercubes (e.g. TiledShapeStMan) or many
+// open tables the total memory used by the tile caches can grow without
+// bound. TSMCacheBudget limits the total size of all tile caches in the
+// process. A hypercube asking for a larger cache gets memory that is free
+// within the budget. If not enough is free, memory is taken from the caches
+// of hypercubes that have been used less recently, using an LRU-2 policy:
+// a hypercube is as hot as its second most recent access, so a single
+// pass over a hypercube does not push out the caches of the hypercubes
+// accessed repeatedly.
+// <br>The cache of a hypercube in a readonly file is shrunk immediately
+// (if it is not in use by another thread). The cache of a writable
+// hypercube gets a lower limit that is applied at its next access, because
+// its changed tiles have to be written by the thread using it.
+// <p>
+// The budget (in MiB) can be set using <src>setBudget</src> or the aipsrc
+// variable <src>table.tsm.cachebudget</src>. The default 0 means that no
+// budget is used. The sizes of the tile caches are tracked in any case.
+// </synopsis>
+
+// <motivation>
+// Jobs having to run within a given amount of memory need to be able to
+// cap the memory used by the tile caches, while still getting good hit
+// rates for the hypercubes in use.
+// </motivation>
+
+class TSMCacheBudget
+{
+public:
+    // Set the budget in MiB. 0 means no budget.
+    // If lowered, colder caches are shrunk as needed.
+    static void setBudget (uInt nMiB);
+
+    // Get the budget in MiB. The initial value is given by the aipsrc
+    // variable <src>table.tsm.cachebudget</src> (default 0).
+    static uInt budget();
+
+    // Get the total size (in bytes) of the tile caches in the process.
+    static uInt64 usedBytes();
+
+    // Add a hypercube with a cache to the set of managed caches.
+    static void add (TSMCube* cube);
+
+    // Remove a hypercube (before its cache is deleted).
+    static void remove (TSMCube* cube);
+
+    // Register an access to the hypercube for the LRU-2 policy.
+    static void touch (TSMCube& cube);
+
+    // Get the number of buckets the cache of the hypercube can have if it
+    // wants to have <src>nbuckets</src> buckets. If needed, memory is
+    // taken from colder caches. The result is at least 1.
+    // The caller must resize the cache to the returned size.
+    static uInt acquire (TSMCube* cube, uInt nbuckets);
+
+    // Tell the budget that the cache size of the hypercube has changed.
+    static void update (TSMCube* cube);
+
+private:
+    // Set the number of buckets accounted for a cube.
+    // The mutex must be locked by the caller.
+    static void account (TSMCube* cube, uInt nbuckets);
+
+    // Free at least the given number of bytes by shrinking the caches of
+    // other cubes than the requesting one (which can be null). If
+    // <src>colderOnly</src> is set, only caches of cubes colder than the
+    // requesting one are shrunk.
+    // The mutex must be locked by the caller.
+    static void reclaim (uInt64 needed, TSMCube* requester, Bool colderOnly);
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
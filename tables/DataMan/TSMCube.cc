@@ -29,6 +29,7 @@
 #include <casacore/tables/DataMan/TSMCube.h>
 #include <casacore/tables/DataMan/TiledStMan.h>
 #include <casacore/tables/DataMan/TSMFile.h>
+#include <casacore/tables/DataMan/TSMCacheBudget.h>
 #include <casacore/tables/DataMan/TSMColumn.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/Arrays/ArrayUtil.h>
@@ -37,10 +38,14 @@
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/IO/ShardedBucketCache.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/OS/Conversion.h>
 #include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/NumaMemory.h>
+#include <casacore/casa/OS/SlabAllocator.h>
+#include <casacore/casa/OS/ProfileRegistry.h>
 #include <casacore/casa/string.h>                           // for memcpy
 #include <casacore/casa/iostream.h>
 
@@ -81,6 +86,7 @@ TSMCube::TSMCube (TiledStMan* stman, TSMFile* file,
                   Int64 fileOffset,
                   Bool useDerived)
 : cachedTile_p (0),
+  slab_p       (0),
   stmanPtr_p     (stman),
   useDerived_p   (useDerived),
   values_p       (values),
@@ -91,9 +97,15 @@ TSMCube::TSMCube (TiledStMan* stman, TSMFile* file,
   filePtr_p      (file),
   fileOffset_p   (0),
   cache_p        (0),
+  sharedCache_p  (0),
   userSetCache_p (False),
-  lastColAccess_p(NoAccess)
+  lastColAccess_p(NoAccess),
+  prefetchFrom_p (-1),
+  budgetLimit_p  (0),
+  budgetBuckets_p(0),
+  budgetBytes_p  (0)
 {
+    accessTime_p[0] = accessTime_p[1] = 0;
     if (fileOffset < 0) {
         // TiledCellStMan uses an empty shape; setShape is called later. 
         if (! cubeShape.empty()) {
@@ -114,13 +126,20 @@ TSMCube::TSMCube (TiledStMan* stman, TSMFile* file,
 TSMCube::TSMCube (TiledStMan* stman, AipsIO& ios,
                   Bool useDerived)
 : cachedTile_p (0),
+  slab_p       (0),
   stmanPtr_p     (stman),
   useDerived_p   (useDerived),
   filePtr_p      (0),
   cache_p        (0),
+  sharedCache_p  (0),
   userSetCache_p (False),
-  lastColAccess_p(NoAccess)
+  lastColAccess_p(NoAccess),
+  prefetchFrom_p (-1),
+  budgetLimit_p  (0),
+  budgetBuckets_p(0),
+  budgetBytes_p  (0)
 {
+    accessTime_p[0] = accessTime_p[1] = 0;
     Int fileSeqnr = getObject (ios);
     if (fileSeqnr >= 0) {
 	filePtr_p = stmanPtr_p->getFile (fileSeqnr);
@@ -131,24 +150,41 @@ TSMCube::TSMCube (TiledStMan* stman, AipsIO& ios,
 
 TSMCube::~TSMCube()
 {
+    if (cache_p != 0) {
+        TSMCacheBudget::remove (this);
+    }
+    clearWriteBehind();
     delete cache_p;
-    delete [] cachedTile_p;
+    delete sharedCache_p.load();
+    freeTile (cachedTile_p);
+    delete slab_p;
 }
 
 
 void TSMCube::clearCache (Bool doFlush)
 {
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
     if (doFlush) {
         flushCache();
     }
+    clearWriteBehind();
     if (cache_p != 0) {
         cache_p->clear (0, False);
     }
+    if (sharedCache_p != 0) {
+        sharedCache_p.load()->clear();
+    }
 }
 void TSMCube::emptyCache()
 {
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
+    flushWriteBehind();
     if (cache_p != 0) {
         cache_p->resize (0);
+        TSMCacheBudget::update (this);
+    }
+    if (sharedCache_p != 0) {
+        sharedCache_p.load()->clear();
     }
     userSetCache_p = False;
     lastColAccess_p = NoAccess;
@@ -164,6 +200,25 @@ void TSMCube::showCacheStatistics (ostream& os) const
         cache_p->showStatistics (os);
         os << "<<<" << endl;
     }
+    const ShardedBucketCache* sharedCache = sharedCache_p;
+    if (sharedCache != 0) {
+        os << ">>> TSMCube sharded cache statistics:" << endl;
+        os << "cubeShape: " << cubeShape_p << endl;
+        os << "tileShape: " << tileShape_p << endl;
+        sharedCache->showStatistics (os);
+        os << "<<<" << endl;
+    }
+}
+
+Record TSMCube::cacheStatistics() const
+{
+    Record rec;
+    if (cache_p != 0) {
+        rec = cache_p->statistics();
+    }
+    rec.define ("CUBESHAPE", cubeShape_p.asVector());
+    rec.define ("TILESHAPE", tileShape_p.asVector());
+    return rec;
 }
 
 uInt TSMCube::coordinateSize (const String& coordinateName) const
@@ -373,15 +428,28 @@ void TSMCube::makeCache()
 {
     // If there is no cache, make one with initially 1 slot.
     if (cache_p == 0) {
+        // Take the tiles from huge page slabs if wanted.
+        if (stmanPtr_p->tsmOption().useHugePages()  &&  slab_p == 0) {
+            slab_p = new SlabAllocator (localTileLength_p, True);
+        }
         cache_p = new BucketCache (filePtr_p->bucketFile(), fileOffset_p,
                                    bucketSize_p, nrTiles_p, 1, this,
                                    readCallBack, writeCallBack,
                                    initCallBack, deleteCallBack);
+        // Read tiles ahead if wanted (only done for read-only files).
+        Int nprefetch = stmanPtr_p->tsmOption().prefetchTiles();
+        if (nprefetch > 0) {
+            cache_p->setPrefetch (nprefetch);
+        }
+        prefetchFrom_p = -1;
+        TSMCacheBudget::add (this);
     }
 }
 
 void TSMCube::flushCache()
 {
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
+    flushWriteBehind();
     if (cache_p != 0) {
 	cache_p->flush();
     }
@@ -389,15 +457,84 @@ void TSMCube::flushCache()
 
 void TSMCube::resyncCache()
 {
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
+    clearWriteBehind();
     if (cache_p != 0) {
       cache_p->resync (nrTiles_p, 0, -1);
     }
+    // The number of tiles can have changed.
+    delete sharedCache_p.exchange (0);
+    prefetchFrom_p = -1;
 }
 
 void TSMCube::deleteCache()
 {
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
+    clearWriteBehind();
+    if (cache_p != 0) {
+        TSMCacheBudget::remove (this);
+    }
     delete cache_p;
     cache_p = 0;
+    delete sharedCache_p.exchange (0);
+    // All tiles are freed now, so the slabs can be released.
+    if (slab_p != 0) {
+        freeTile (cachedTile_p);
+        cachedTile_p = 0;
+        delete slab_p;
+        slab_p = 0;
+    }
+}
+
+void TSMCube::deleteSharedCache()
+{
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
+    delete sharedCache_p.exchange (0);
+}
+
+Bool TSMCube::useSharedCache() const
+{
+    return stmanPtr_p->isConcurrent()  &&  !useDerived_p  &&  filePtr_p != 0
+      &&  !filePtr_p->bucketFile()->isWritable()
+      &&  !filePtr_p->bucketFile()->isMultiFile();
+}
+
+ShardedBucketCache* TSMCube::getSharedCache()
+{
+    ShardedBucketCache* sharedCache = sharedCache_p;
+    if (sharedCache == 0) {
+        std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
+        sharedCache = sharedCache_p;
+        if (sharedCache == 0) {
+            // Each thread can need all tiles of a subcube at the same time.
+            // Use at most 25% of the memory like setCacheSize.
+            uInt cacheSize = std::max (this->cacheSize(),
+                                       nrTilesSubCube_p *
+                                       uInt(HostInfo::numCPUs(True)));
+            cacheSize = validateCacheSize (cacheSize);
+            uInt maxSize = uInt(HostInfo::memoryTotal(True) * 1024.*0.25 /
+                                bucketSize_p);
+            cacheSize = std::max (1u, std::min (std::min (cacheSize, maxSize),
+                                                nrTiles_p));
+            sharedCache = new ShardedBucketCache (filePtr_p->bucketFile(),
+                                                  fileOffset_p, bucketSize_p,
+                                                  nrTiles_p, cacheSize, 0,
+                                                  this, readSharedCallBack,
+                                                  deleteSharedCallBack);
+            sharedCache_p = sharedCache;
+        }
+    }
+    return sharedCache;
+}
+
+std::unique_lock<std::recursive_mutex> TSMCube::lockConcurrent()
+{
+    std::unique_lock<std::recursive_mutex> lock(cacheMutex_p,
+                                                std::defer_lock);
+    if (stmanPtr_p->isConcurrent()) {
+        lock.lock();
+    }
+    return lock;
 }
 
 
@@ -415,6 +552,7 @@ void TSMCube::extend (uInt64 nr, const Record& coordValues,
                       " is not extensible");
     }
     // Make the cache here, otherwise nrTiles_p is too high.
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
     makeCache();
     uInt lastDim = nrdim_p - 1;
     uInt nrold = nrTiles_p;
@@ -664,15 +802,30 @@ char* TSMCube::readCallBack (void* owner, const char* external)
 {
     return ((TSMCube*)owner)->readTile (external);
 }
+char* TSMCube::readSharedCallBack (void* owner, const char* external)
+{
+    TSMCube* cube = static_cast<TSMCube*>(owner);
+    char* local = new char[cube->localTileLength_p];
+    cube->stmanPtr_p->readTile (local, cube->localOffset_p, external,
+                                cube->externalOffset_p, cube->tileSize_p);
+    return local;
+}
+void TSMCube::deleteSharedCallBack (void*, char* buffer)
+{
+    delete [] buffer;
+}
 char* TSMCube::readTile (const char* external)
 {
+    static ProfileCounter& readCounter =
+      ProfileRegistry::counter ("TSM.tileRead");
+    ProfileTimer timer(readCounter);
     char* local = 0;
 
     if (cachedTile_p != 0){
         local = cachedTile_p;
         cachedTile_p = 0;
     } else {
-        local = new char[localTileLength_p];
+        local = allocTile();
     }
 
     stmanPtr_p->readTile (local, localOffset_p, external, externalOffset_p,
@@ -694,16 +847,42 @@ void TSMCube::deleteCallBack (void* owner, char* buffer)
     if (tsmCube->cachedTile_p == 0){
         tsmCube->cachedTile_p = buffer;
     } else {
-        delete [] buffer;
+        tsmCube->freeTile (buffer);
     }
 }
 char* TSMCube::initCallBack (void* owner)
 {
-    uInt64 size = ((TSMCube*)owner)->localTileLength();
-    char* buffer = new char[size];
-    memset(buffer, 0, size);
+    TSMCube* tsmCube = ((TSMCube*)owner);
+    char* buffer = tsmCube->allocTile();
+    memset(buffer, 0, tsmCube->localTileLength());
     return buffer;
 }
+char* TSMCube::allocTile()
+{
+    if (slab_p != 0) {
+        return slab_p->allocate();
+    }
+    char* buffer = new char[localTileLength_p];
+    NumaMemory::place (buffer, localTileLength_p);
+    return buffer;
+}
+void TSMCube::freeTile (char* buffer)
+{
+    if (slab_p != 0) {
+        slab_p->deallocate (buffer);
+    } else {
+        delete [] buffer;
+    }
+}
+
+void TSMCube::applyBudgetLimit()
+{
+    uInt limit = budgetLimit_p;
+    if (limit > 0  &&  cache_p->cacheSize() > limit) {
+        cache_p->resize (limit);
+        TSMCacheBudget::update (this);
+    }
+}
 
 uInt TSMCube::cacheSize() const
 {
@@ -738,10 +917,13 @@ void TSMCube::setCacheSize (uInt cacheSize, Bool forceSmaller, Bool userSet)
     // the first of a bunch of accesses at the same tiles.
     // However, don't let the cache exceed the maximum,
     // unless it is only 10% more.
+    // The process-wide budget can make the cache smaller.
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
     BucketCache* cachePtr = getCache();
     cacheSize = validateCacheSize (cacheSize);
     if (forceSmaller  ||  cacheSize > cachePtr->cacheSize()) {
-        cachePtr->resize (cacheSize);
+        cachePtr->resize (TSMCacheBudget::acquire (this, cacheSize));
+        TSMCacheBudget::update (this);
     }
 ////    cout << "cachesize=" << cacheSize << endl;
     userSetCache_p = userSet;
@@ -767,6 +949,15 @@ void TSMCube::setCacheSize (const IPosition& sliceShape,
     setCacheSize (cacheSize, forceSmaller, userSet);
 }
 
+const char* TSMCube::mappedTile (const IPosition&, const IPosition&, uInt)
+{
+    return 0;
+}
+
+void TSMCube::adviseAccess (const IPosition&, const IPosition&,
+                            const IPosition&, const IPosition&)
+{}
+
 // Calculate the cache size for the given slice and access path.
 uInt TSMCube::calcCacheSize (const IPosition& sliceShape,
                              const IPosition& windowStart,
@@ -902,10 +1093,191 @@ void TSMCube::resizeTileSections()
   return;
 }
 
+void TSMCube::prefetchTiles()
+{
+    // Assume the access continues along the last axis, thus the tiles
+    // needed next are the ones following the current section.
+    // Nothing needs to be done if still in the same row of tiles.
+    uInt lastAxis = nrdim_p - 1;
+    Int64 nextTile = endTile_p(lastAxis) + 1;
+    if (nextTile == prefetchFrom_p) {
+        return;
+    }
+    prefetchFrom_p = nextTile;
+    uInt maxTiles = stmanPtr_p->tsmOption().prefetchTiles();
+    std::vector<uInt> tiles;
+    tiles.reserve (maxTiles);
+    IPosition tilePos (startTile_p);
+    tilePos(lastAxis) = nextTile;
+    while (tilePos(lastAxis) < tilesPerDim_p(lastAxis)  &&
+           tiles.size() < maxTiles) {
+        tiles.push_back (expandedTilesPerDim_p.offset (tilePos));
+        // Step to the next tile in the section (last axis unlimited).
+        uInt i;
+        for (i=0; i<lastAxis; i++) {
+            if (++tilePos(i) <= endTile_p(i)) {
+                break;
+            }
+            tilePos(i) = startTile_p(i);
+        }
+        if (i == lastAxis) {
+            tilePos(lastAxis)++;
+        }
+    }
+    cache_p->prefetch (tiles);
+}
+
+void TSMCube::loadTiles (BucketCache* cachePtr, Bool writeFlag)
+{
+    // Only worthwhile if multiple tiles are needed.
+    size_t ntiles = nrTileSection_p.product();
+    if (ntiles < 2) {
+        return;
+    }
+    std::vector<uInt> tiles;
+    tiles.reserve (std::min (ntiles, size_t(cachePtr->cacheSize())));
+    IPosition tilePos (startTile_p);
+    while (tiles.size() < cachePtr->cacheSize()) {
+        if (!(writeFlag  &&  isTileCovered (tilePos))) {
+            tiles.push_back (expandedTilesPerDim_p.offset (tilePos));
+        }
+        uInt i;
+        for (i=0; i<nrdim_p; i++) {
+            if (++tilePos(i) <= endTile_p(i)) {
+                break;
+            }
+            tilePos(i) = startTile_p(i);
+        }
+        if (i == nrdim_p) {
+            break;
+        }
+    }
+    cachePtr->loadBuckets (tiles);
+}
+
+Bool TSMCube::isTileCovered (const IPosition& tilePos) const
+{
+    if (localOffset_p.nelements() != 1) {
+        return False;
+    }
+    for (uInt i=0; i<nrdim_p; i++) {
+        if (tilePos(i) == startTile_p(i)  &&
+            startPixelInFirstTile_p(i) != 0) {
+            return False;
+        }
+        if (tilePos(i) == endTile_p(i)  &&
+            endPixelInLastTile_p(i) != tileShape_p(i) - 1  &&
+            tilePos(i) * tileShape_p(i) + endPixelInLastTile_p(i)
+              != cubeShape_p(i) - 1) {
+            return False;
+        }
+    }
+    return True;
+}
+
+uInt TSMCube::localTileLengthInCube (const IPosition& tilePos) const
+{
+    uInt nrPixels = 1;
+    for (uInt i=0; i<nrdim_p; i++) {
+        nrPixels *= std::min (tileShape_p(i),
+                              cubeShape_p(i) - tilePos(i) * tileShape_p(i));
+    }
+    return nrPixels * (localTileLength_p / tileSize_p);
+}
+
+TSMCube::WriteBehindTile& TSMCube::writeBehindTile (BucketCache* cachePtr,
+                                                    uInt tileNr)
+{
+    std::map<uInt,WriteBehindTile>::iterator iter = writeBehind_p.find (tileNr);
+    if (iter != writeBehind_p.end()) {
+        return iter->second;
+    }
+    // Keep at most the tiles of a row of tiles (needed when writing row
+    // by row) or as many as the cache size. For sequential writes the
+    // first tile is the oldest one.
+    size_t maxTiles = std::max (nrTilesSubCube_p, cachePtr->cacheSize());
+    if (writeBehind_p.size() >= maxTiles) {
+        flushWriteBehindTile (cachePtr, writeBehind_p.begin());
+    }
+    WriteBehindTile& tile = writeBehind_p[tileNr];
+    tile.data = new char[localTileLength_p];
+    tile.written.assign (localTileLength_p, 0);
+    tile.nwritten = 0;
+    return tile;
+}
+
+void TSMCube::markWritten (WriteBehindTile& tile, uInt offset, uInt length)
+{
+    uChar* flags = tile.written.data() + offset;
+    tile.nwritten += length - std::count (flags, flags + length, uChar(1));
+    memset (flags, 1, length);
+}
+
+void TSMCube::flushWriteBehindTile
+                       (BucketCache* cachePtr,
+                        std::map<uInt,WriteBehindTile>::iterator iter)
+{
+    uInt tileNr = iter->first;
+    WriteBehindTile& tile = iter->second;
+    // A complete tile replaces the one in the file, so it is not read.
+    Bool complete = (tile.nwritten == localTileLengthInCube
+                          (expandedTilesPerDim_p.position (tileNr)));
+    char* dataArray = cachePtr->getBucket (tileNr, !complete);
+    cachePtr->setDirty();
+    // Copy the runs of bytes written.
+    const uChar* flags = tile.written.data();
+    const uChar* flagsEnd = flags + tile.written.size();
+    const uChar* st = std::find (flags, flagsEnd, uChar(1));
+    while (st != flagsEnd) {
+        const uChar* end = std::find (st, flagsEnd, uChar(0));
+        memcpy (dataArray + (st - flags), tile.data + (st - flags), end - st);
+        st = std::find (end, flagsEnd, uChar(1));
+    }
+    delete [] tile.data;
+    writeBehind_p.erase (iter);
+}
+
+void TSMCube::dropWriteBehindTile (uInt tileNr)
+{
+    std::map<uInt,WriteBehindTile>::iterator iter = writeBehind_p.find (tileNr);
+    if (iter != writeBehind_p.end()) {
+        delete [] iter->second.data;
+        writeBehind_p.erase (iter);
+    }
+}
+
+void TSMCube::flushWriteBehind()
+{
+    if (!writeBehind_p.empty()) {
+        BucketCache* cachePtr = getCache();
+        while (!writeBehind_p.empty()) {
+            flushWriteBehindTile (cachePtr, writeBehind_p.begin());
+        }
+    }
+}
+
+void TSMCube::clearWriteBehind()
+{
+    for (auto& tile : writeBehind_p) {
+        delete [] tile.second.data;
+    }
+    writeBehind_p.clear();
+}
+
 void TSMCube::accessSection (const IPosition& start, const IPosition& end,
                              char* section, uInt colnr,
-                             uInt localPixelSize, uInt, Bool writeFlag)
+                             uInt localPixelSize, uInt externalPixelSize,
+                             Bool writeFlag)
 {
+    // Reading concurrently is done by accessStrided, because it does not
+    // use the section variables in this object.
+    if (!writeFlag  &&  useSharedCache()) {
+        TSMCube::accessStrided (start, end, IPosition(start.nelements(), 1),
+                                section, colnr, localPixelSize,
+                                externalPixelSize, writeFlag);
+        return;
+    }
+    std::unique_lock<std::recursive_mutex> concurrentLock(lockConcurrent());
     // Set flag if writing.
     if (writeFlag) {
 	stmanPtr_p->setDataChanged();
@@ -944,7 +1316,21 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
         }
     }
     // Get the cache.
+    std::lock_guard<std::recursive_mutex> lock(cacheMutex_p);
     BucketCache* cachePtr = getCache();
+    TSMCacheBudget::touch (*this);
+    applyBudgetLimit();
+    // Partial tile updates are gathered in the write-behind buffer if the
+    // data are written sequentially. Otherwise the tiles in that buffer are
+    // written into the cache first, so the cache contains all data.
+    Bool writeBehind = writeFlag  &&  stmanPtr_p->sequentialWrite();
+    if (!writeBehind) {
+        flushWriteBehind();
+    }
+    // Start reading the next tiles if read-ahead is enabled.
+    if (!writeFlag  &&  cachePtr->hasPrefetch()) {
+        prefetchTiles();
+    }
     
 //    cout << "nrTileSection_p=" << nrTileSection_p << endl;
 //    cout << "startTile_p=" << startTile_p << endl;
@@ -960,10 +1346,17 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
 
     // If the section matches the tile shape, we can simply
     // copy all values and do not have to do difficult iterations.
-    if (oneEntireTile) {
+    // If the tile only contains this column, a put overwrites it entirely,
+    // so it does not need to be read.
+    Bool singleColumn = (localOffset_p.nelements() == 1);
+    if (oneEntireTile  &&  (singleColumn || !writeBehind)) {
         // Get the tile from the cache.
         uInt tileNr = expandedTilesPerDim_p.offset (startTile_p);
-        char* dataArray = cachePtr->getBucket (tileNr);
+        Bool overwrite = writeFlag && singleColumn;
+        if (overwrite) {
+            dropWriteBehindTile (tileNr);
+        }
+        char* dataArray = cachePtr->getBucket (tileNr, !overwrite);
         // If writing, set cache slot to dirty.
         if (writeFlag) {
             memcpy (dataArray+pixelOffset, section,
@@ -976,9 +1369,15 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
         return;
     }
 
+    // Read the tiles needed for the section in a single batch.
+    // When using write-behind, the tiles not in the cache are not needed.
+    if (!writeBehind) {
+        loadTiles (cachePtr, writeFlag);
+    }
+
     // If the section is a line, call a specialized function.
     // Note that a single pixel is also handled as a line.
-    if (nOneLong >= nrdim_p - 1) {
+    if (nOneLong >= nrdim_p - 1  &&  !writeBehind) {
         accessLine (section, pixelOffset, localPixelSize,
                     writeFlag, cachePtr,
                     startTile_p, endTile_p(lineIndex),
@@ -1013,9 +1412,23 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
 //      cout << "end=" << endPixel << endl;
         // Get the tile from the cache.
         // Set it to dirty if we are writing.
-        char* dataArray = cachePtr->getBucket (tileNr);
-        if (writeFlag) {
+        // A tile that is overwritten entirely does not need to be read.
+        // When using write-behind, a tile not in the cache is written into
+        // the write-behind buffer.
+        char* dataArray;
+        WriteBehindTile* pendingTile = 0;
+        if (writeFlag  &&  isTileCovered (tilePos)) {
+            dropWriteBehindTile (tileNr);
+            dataArray = cachePtr->getBucket (tileNr, False);
             cachePtr->setDirty();
+        } else if (writeBehind  &&  !cachePtr->isCached (tileNr)) {
+            pendingTile = &(writeBehindTile (cachePtr, tileNr));
+            dataArray = pendingTile->data;
+        } else {
+            dataArray = cachePtr->getBucket (tileNr);
+            if (writeFlag) {
+                cachePtr->setDirty();
+            }
         }
 
         // At this point we start looping through all pixels in the tile.
@@ -1053,6 +1466,9 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
             if (writeFlag) {
                 TSMCube_MoveData(dataArray + dataOffset,
                                  section + sectionOffset, localSize);
+                if (pendingTile != 0) {
+                    markWritten (*pendingTile, dataOffset, localSize);
+                }
             } else {
                 TSMCube_MoveData(section + sectionOffset,
                                  dataArray + dataOffset, localSize);
@@ -1071,6 +1487,12 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
                 break;
             }
         }
+        // A tile in the write-behind buffer is moved into the cache when
+        // it is complete.
+        if (pendingTile != 0  &&
+            pendingTile->nwritten == localTileLengthInCube (tilePos)) {
+            flushWriteBehindTile (cachePtr, writeBehind_p.find (tileNr));
+        }
 
         // Determine the next tile to access and the starting and
         // ending pixels in it.
@@ -1301,8 +1723,11 @@ void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
                              uInt localPixelSize, uInt externalPixelSize,
                              Bool writeFlag)
 {
+    // When reading concurrently, the tiles are taken from the sharded cache
+    // without locking the cube.
+    Bool concurrent = !writeFlag  &&  useSharedCache();
     // If all strides are 1, use accessSection.
-    if (stride.allOne()) {
+    if (stride.allOne()  &&  !concurrent) {
         accessSection (start, end, section, colnr,
                        localPixelSize, externalPixelSize, writeFlag);
         return;
@@ -1313,7 +1738,20 @@ void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
     }
     uInt i, j;
     // Get the cache (if needed).
-    BucketCache* cachePtr = getCache();
+    std::unique_lock<std::recursive_mutex> lock(cacheMutex_p,
+                                                std::defer_lock);
+    BucketCache* cachePtr = 0;
+    ShardedBucketCache* sharedCache = 0;
+    std::shared_ptr<const char> sharedTile;
+    if (concurrent) {
+        sharedCache = getSharedCache();
+    } else {
+        lock.lock();
+        cachePtr = getCache();
+        TSMCacheBudget::touch (*this);
+        applyBudgetLimit();
+        flushWriteBehind();
+    }
 
     // A tile can contain more than one data array.
     // Each array is contiguous, so the first pixel of an array
@@ -1380,9 +1818,15 @@ void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
 //      cout << "start=" << startPixel << endl;
         // Get the tile from the cache.
         // Set it to dirty if we are writing.
-        char* dataArray = cachePtr->getBucket (tileNr);
-        if (writeFlag) {
-            cachePtr->setDirty();
+        char* dataArray;
+        if (concurrent) {
+            sharedTile = sharedCache->getBucket (tileNr);
+            dataArray  = const_cast<char*>(sharedTile.get());
+        } else {
+            dataArray = cachePtr->getBucket (tileNr);
+            if (writeFlag) {
+                cachePtr->setDirty();
+            }
         }
 
         // At this point we start looping through all pixels in the tile.
@@ -34,6 +34,10 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/OS/Conversion.h>
 #include <casacore/casa/iosfwd.h>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -42,6 +46,8 @@ class TiledStMan;
 class TSMFile;
 class TSMColumn;
 class BucketCache;
+class ShardedBucketCache;
+class SlabAllocator;
 template<class T> class Block;
 
 // <summary>
@@ -89,6 +95,16 @@ template<class T> class Block;
 // The description of class
 // <linkto class=ROTiledStManAccessor>ROTiledStManAccessor</linkto>
 // contains a discussion about the effect of setting the maximum cache size.
+// <p>
+// A tile that is entirely overwritten by a put is not read from the file.
+// If the data are written sequentially (see
+// <src>TiledStMan::setSequentialWrite</src>), partial updates of tiles
+// not in the cache are gathered in a write-behind buffer. A tile is moved
+// into the cache (without reading it) when all its pixels are written.
+// Otherwise it is merged with the tile in the file when the buffer is
+// full, when the cube is read, or when the cache is flushed. In this way
+// a writer putting row by row does not need to read back the tiles it
+// wrote, even if the cache is small.
 // </synopsis> 
 
 // <motivation>
@@ -102,6 +118,7 @@ template<class T> class Block;
 
 class TSMCube
 {
+friend class TSMCacheBudget;
 public:
     // Define the possible access types for TSMDataColumn.
     enum AccessType {
@@ -151,9 +168,17 @@ public:
     // It'll also clear the <src>userSetCache_p</src> flag.
     void emptyCache();
 
+    // Delete the cache used when reading concurrently.
+    // It is done when the table gets writable.
+    void deleteSharedCache();
+
     // Show the cache statistics.
     virtual void showCacheStatistics (ostream& os) const;
 
+    // Get the cube and tile shape and the cache statistics (if a cache
+    // is used) as a record.
+    Record cacheStatistics() const;
+
     // Put the data of the object into the AipsIO stream.
     void putObject (AipsIO& ios);
 
@@ -232,6 +257,22 @@ public:
                                 uInt localPixelSize, uInt externalPixelSize,
                                 Bool writeFlag);
 
+    // Get a pointer to the data of a column in a tile if the section is
+    // exactly one tile and its data can be used directly (without a copy
+    // and conversion). By default 0 is returned, because it is only possible
+    // for hypercubes using memory-mapped IO.
+    virtual const char* mappedTile (const IPosition& start,
+                                    const IPosition& end, uInt colnr);
+
+    // Tell how the hypercube will be accessed for the given slice and
+    // access path. It is used to give hints for read-ahead.
+    // By default nothing is done, because the cache does its own
+    // prefetching.
+    virtual void adviseAccess (const IPosition& sliceShape,
+                               const IPosition& windowStart,
+                               const IPosition& windowLength,
+                               const IPosition& axisPath);
+
     // Get the current cache size (in buckets).
     uInt cacheSize() const;
 
@@ -308,7 +349,19 @@ protected:
     // if nrdim_p changes value.
     void resizeTileSections();
 
+    // Get the memory used by a bucket in the cache (in bytes).
+    uInt64 bytesPerBucket() const
+      { return (localTileLength_p > 0  ?  localTileLength_p : 1); }
+
+    // Get a lock on the cache mutex if the storage manager is read
+    // concurrently, otherwise an unlocked lock. It is used by the derived
+    // classes to serialize the access to the section variables.
+    std::unique_lock<std::recursive_mutex> lockConcurrent();
+
 private:
+    // Shrink the cache if the limit set by TSMCacheBudget requires so.
+    void applyBudgetLimit();
+
     // Get the cache object.
     // This will construct the cache object if not present yet.
     BucketCache* getCache();
@@ -322,6 +375,66 @@ private:
     // Delete the cache object.
     virtual void deleteCache();
 
+    // Can the sharded cache be used to read the hypercube concurrently?
+    // It requires a read-only bucket file that is not part of a MultiFile.
+    Bool useSharedCache() const;
+
+    // Get the sharded cache used when reading concurrently.
+    // It is constructed if not present yet.
+    ShardedBucketCache* getSharedCache();
+
+    // Read the tiles ahead that are expected to be needed after the
+    // tiles of the current section (as set in startTile_p and endTile_p).
+    // It assumes sequential access along the last axis.
+    void prefetchTiles();
+
+    // Read the tiles of the current section (as set in startTile_p and
+    // endTile_p) that are not in the cache yet in a single batch.
+    // When writing, tiles covered entirely by the section are not read.
+    void loadTiles (BucketCache* cachePtr, Bool writeFlag);
+
+    // Is the tile at the given position covered entirely by the current
+    // section (as set in startTile_p, endTile_p and the pixel variables)?
+    // Pixels outside the cube (in tiles at its edges) do not need to be
+    // covered. It can only be the case if the cube has one data column.
+    Bool isTileCovered (const IPosition& tilePos) const;
+
+    // Get the length (in bytes in local format) of the part of the tile at
+    // the given position that is inside the cube.
+    uInt localTileLengthInCube (const IPosition& tilePos) const;
+
+    // A partially written tile in the write-behind buffer. It holds the
+    // data written so far (in local format) and a flag per byte telling
+    // if it is written.
+    struct WriteBehindTile
+    {
+        char*              data;
+        std::vector<uChar> written;
+        uInt               nwritten;
+    };
+
+    // Get the tile from the write-behind buffer, adding it if needed.
+    // If the buffer is full, its first tile is written into the cache.
+    WriteBehindTile& writeBehindTile (BucketCache* cachePtr, uInt tileNr);
+
+    // Mark the given part of a tile in the write-behind buffer as written.
+    static void markWritten (WriteBehindTile& tile, uInt offset,
+                             uInt length);
+
+    // Write a tile of the write-behind buffer into the cache and remove it
+    // from the buffer. The tile is only read if not written entirely.
+    void flushWriteBehindTile (BucketCache* cachePtr,
+                               std::map<uInt,WriteBehindTile>::iterator iter);
+
+    // Remove a tile from the write-behind buffer without writing it.
+    void dropWriteBehindTile (uInt tileNr);
+
+    // Write all tiles of the write-behind buffer into the cache.
+    void flushWriteBehind();
+
+    // Remove all tiles from the write-behind buffer without writing them.
+    void clearWriteBehind();
+
     // Access a line in a more optimized way.
     void accessLine (char* section, uInt pixelOffset,
 		     uInt localPixelSize,
@@ -340,6 +453,14 @@ private:
     static void deleteCallBack (void* owner, char* buffer);
     // </group>
 
+    // Define the callback functions for the ShardedBucketCache.
+    // They do not use the slabs or cachedTile_p, because they are called
+    // by multiple threads.
+    // <group>
+    static char* readSharedCallBack (void* owner, const char* external);
+    static void deleteSharedCallBack (void* owner, char* buffer);
+    // </group>
+
     // Define the functions doing the actual read and write of the 
     // data in the tile and converting it to/from local format.
     // <group>
@@ -347,10 +468,19 @@ private:
     void writeTile (char* external, const char* local);
     // </group>
 
+    // Allocate or free a tile buffer in local format.
+    // It uses the slabs if huge pages are used for the cache.
+    // <group>
+    char* allocTile();
+    void freeTile (char* buffer);
+    // </group>
+
 protected:
     //# Declare member variables.
 
     char * cachedTile_p; // optimization to hold one tile chunk
+    // The huge page slabs the tiles are taken from (if used).
+    SlabAllocator*  slab_p;
 
     // Pointer to the parent storage manager.
     TiledStMan*     stmanPtr_p;
@@ -392,12 +522,28 @@ protected:
     uInt            localTileLength_p;
     // The bucket cache.
     BucketCache*    cache_p;
+    // The sharded bucket cache used when reading concurrently.
+    std::atomic<ShardedBucketCache*> sharedCache_p;
     // Did the user set the cache size?
     Bool            userSetCache_p;
     // Was the last column access to a cell, slice, or column?
     AccessType      lastColAccess_p;
     // The slice shape of the last column access to a slice.
     IPosition       lastColSlice_p;
+    // The first tile (in last axis) read ahead (-1 = none).
+    Int64           prefetchFrom_p;
+    // The write-behind buffer of partially written tiles (by tile number).
+    std::map<uInt,WriteBehindTile> writeBehind_p;
+    // The mutex serializing the use of the cache. It makes it possible for
+    // TSMCacheBudget to shrink the cache of an unused hypercube.
+    std::recursive_mutex cacheMutex_p;
+    // The clock values of the last two accesses (for TSMCacheBudget).
+    std::atomic<uInt64> accessTime_p[2];
+    // The cache size limit set by TSMCacheBudget (0 = no limit).
+    std::atomic<uInt>   budgetLimit_p;
+    // The cache size (in buckets and bytes) accounted by TSMCacheBudget.
+    uInt            budgetBuckets_p;
+    uInt64          budgetBytes_p;
 
     // IPosition variables used in accessSection(); declared here
     // as member variables to avoid significant construction and
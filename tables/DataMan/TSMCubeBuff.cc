@@ -149,6 +149,8 @@ void TSMCubeBuff::accessSection (const IPosition& start, const IPosition& end,
                                  uInt localPixelSize, uInt externalPixelSize,
                                  Bool writeFlag)
 {
+  // The section variables are shared, so serialize concurrent reads.
+  std::unique_lock<std::recursive_mutex> lock(lockConcurrent());
   // A tile can contain more than one data column.
   // Get the offset of the column's data array in the tile.
   uInt tileOffset = externalOffset_p[colnr];
@@ -42,6 +42,8 @@
 #include <casacore/casa/OS/HostInfo.h>
 #include <casacore/casa/string.h>                           // for memcpy
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -88,6 +90,14 @@ void TSMCubeMMap::makeCache()
     if (cache_p == 0) {
         cache_p = new BucketMapped (filePtr_p->bucketFile(), fileOffset_p,
                                     bucketSize_p, nrTiles_p);
+        adviseHugePages();
+    }
+}
+
+void TSMCubeMMap::adviseHugePages()
+{
+    if (stmanPtr_p->tsmOption().useHugePages()) {
+        cache_p->advise (0, nrTiles_p, MMapfdIO::HugePage);
     }
 }
 
@@ -136,6 +146,8 @@ void TSMCubeMMap::extend (uInt64 nr, const Record& coordValues,
     // Extend the cache which extends the file and remaps.
     // Note that extending TSMFile only means updating its length.
     getCache()->extend (nrTiles_p - nrold);
+    // The file is remapped, so the advice has to be given again.
+    adviseHugePages();
     filePtr_p->extend ((nrTiles_p - nrold) * bucketSize_p);
     // Update the last coordinate (if there).
     if (lastCoordColumn != 0) {
@@ -147,18 +159,124 @@ void TSMCubeMMap::extend (uInt64 nr, const Record& coordValues,
 void TSMCubeMMap::setCacheSize (uInt, Bool, Bool)
 {}
 
-void TSMCubeMMap::setCacheSize (const IPosition&,
-                                const IPosition&,
-                                const IPosition&,
-                                const IPosition&,
+void TSMCubeMMap::setCacheSize (const IPosition& sliceShape,
+                                const IPosition& windowStart,
+                                const IPosition& windowLength,
+                                const IPosition& axisPath,
                                 Bool, Bool)
-{}
+{
+  adviseAccess (sliceShape, windowStart, windowLength, axisPath);
+}
+
+const char* TSMCubeMMap::mappedTile (const IPosition& start,
+                                     const IPosition& end, uInt colnr)
+{
+  const TSMDataColumn* dataColumn = stmanPtr_p->getDataColumn(colnr);
+  if (dataColumn->isConversionNeeded()  ||  dataColumn->dataType() == TpBool
+  ||  start.nelements() != nrdim_p  ||  end.nelements() != nrdim_p) {
+    return 0;
+  }
+  IPosition tilePos(nrdim_p);
+  for (uInt i=0; i<nrdim_p; i++) {
+    if (start(i) % tileShape_p(i) != 0
+    ||  end(i) - start(i) + 1 != tileShape_p(i)) {
+      return 0;
+    }
+    tilePos(i) = start(i) / tileShape_p(i);
+  }
+  // A tile not written yet is not mapped.
+  BucketMapped* cachePtr = getCache();
+  uInt tileNr = expandedTilesPerDim_p.offset (tilePos);
+  if (tileNr >= cachePtr->nBucket()) {
+    return 0;
+  }
+  const char* data = cachePtr->getBucket(tileNr) + externalOffset_p[colnr];
+  // The data must be aligned properly for the data type.
+  uInt align = std::min (dataColumn->localPixelSize(), uInt(8));
+  if (reinterpret_cast<size_t>(data) % align != 0) {
+    return 0;
+  }
+  return data;
+}
+
+void TSMCubeMMap::adviseAccess (const IPosition& sliceShape,
+                                const IPosition& windowStart,
+                                const IPosition& windowLength,
+                                const IPosition& axisPath)
+{
+  if (nrdim_p == 0  ||  sliceShape.nelements() > nrdim_p
+  ||  windowStart.nelements() > nrdim_p
+  ||  windowLength.nelements() > nrdim_p
+  ||  axisPath.nelements() > nrdim_p) {
+    return;
+  }
+  // Determine the tiles in the window (defaults to the entire cube) and
+  // the number of tiles spanned by a slice (its unspecified parts are 1).
+  IPosition startTile(nrdim_p, 0);
+  IPosition endTile(tilesPerDim_p - 1);
+  IPosition sliceTiles(nrdim_p, 1);
+  for (uInt i=0; i<nrdim_p; i++) {
+    ssize_t st = i < windowStart.nelements() ? windowStart(i) : 0;
+    st = std::max (ssize_t(0), std::min (st, cubeShape_p(i) - 1));
+    ssize_t end = cubeShape_p(i) - 1;
+    if (i < windowLength.nelements()  &&  windowLength(i) > 0) {
+      end = std::min (end, st + windowLength(i) - 1);
+    }
+    startTile(i) = st / tileShape_p(i);
+    endTile(i)   = end / tileShape_p(i);
+    if (i < sliceShape.nelements()  &&  sliceShape(i) > 0) {
+      sliceTiles(i) = (sliceShape(i) + tileShape_p(i) - 1) / tileShape_p(i);
+    }
+  }
+  // Determine the order in which the axes having multiple tiles change.
+  // A slice gets its tiles in natural order, thereafter the cursor moves
+  // along the axis path (unspecified axes follow in natural order).
+  Block<Bool> used(nrdim_p, False);
+  std::vector<uInt> order;
+  for (uInt i=0; i<nrdim_p; i++) {
+    if (sliceTiles(i) > 1) {
+      order.push_back (i);
+      used[i] = True;
+    }
+  }
+  for (uInt i=0; i<nrdim_p; i++) {
+    uInt axis = i < axisPath.nelements() ? axisPath(i) : 0;
+    if (i >= axisPath.nelements()) {
+      while (axis < nrdim_p  &&  used[axis]) {
+        axis++;
+      }
+    }
+    if (axis < nrdim_p  &&  !used[axis]) {
+      order.push_back (axis);
+      used[axis] = True;
+    }
+  }
+  // The tiles are stored with the first axis varying fastest, so
+  // the access is sequential if those axes are in increasing order.
+  Bool sequential = True;
+  Int lastAxis = -1;
+  for (uInt axis : order) {
+    if (endTile(axis) > startTile(axis)) {
+      if (Int(axis) < lastAxis) {
+        sequential = False;
+        break;
+      }
+      lastAxis = axis;
+    }
+  }
+  uInt firstTile = expandedTilesPerDim_p.offset (startTile);
+  uInt lastTile  = expandedTilesPerDim_p.offset (endTile);
+  getCache()->advise (firstTile, lastTile - firstTile + 1,
+                      sequential ? MMapfdIO::Sequential : MMapfdIO::Random);
+}
 
 void TSMCubeMMap::accessSection (const IPosition& start, const IPosition& end,
                                  char* section, uInt colnr,
                                  uInt localPixelSize, uInt externalPixelSize,
                                  Bool writeFlag)
 {
+  // The section variables are shared, so serialize concurrent reads.
+  std::unique_lock<std::recursive_mutex> lock(lockConcurrent());
   // A tile can contain more than one data column.
   // Get the offset of the column's data array in the tile.
   uInt tileOffset = externalOffset_p[colnr];
@@ -150,7 +150,25 @@ public:
                                 uInt localPixelSize, uInt externalPixelSize,
                                 Bool writeFlag);
 
+    // Get a pointer to the data of a column in the mapped tile if the
+    // section is exactly one tile, the tile exists in the file and the data
+    // are stored in local format (thus are not Bool and need no byte swap).
+    // Otherwise 0 is returned.
+    // <br>The pointer is only valid until the file is extended or closed.
+    // The data must not be changed using it.
+    virtual const char* mappedTile (const IPosition& start,
+                                    const IPosition& end, uInt colnr);
+
+    // Advise the OS about the access pattern using <src>madvise</src>.
+    // If the tiles of the window are accessed in their order in the file,
+    // sequential access is advised, otherwise random access.
+    virtual void adviseAccess (const IPosition& sliceShape,
+                               const IPosition& windowStart,
+                               const IPosition& windowLength,
+                               const IPosition& axisPath);
+
     // Set the cache size for the given slice and access path.
+    // No cache is used, but the access pattern is advised.
     virtual void setCacheSize (const IPosition& sliceShape,
                                const IPosition& windowStart,
                                const IPosition& windowLength,
@@ -180,6 +198,10 @@ private:
     // Delete the cache object.
     virtual void deleteCache();
 
+    // Advise the kernel to use huge pages for the mapped file if the
+    // TSMOption tells so.
+    void adviseHugePages();
+
     //# Declare member variables.
     // The bucket cache.
     BucketMapped* cache_p;
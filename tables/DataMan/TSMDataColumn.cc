@@ -157,6 +157,11 @@ IPosition TSMDataColumn::tileShape (rownr_t rownr)
 }
 
 
+Bool TSMDataColumn::canSizeCache (rownr_t rownr) const
+{
+    return !stmanPtr_p->isConcurrent()  &&  !stmanPtr_p->userSetCache (rownr);
+}
+
 void TSMDataColumn::accessCell (rownr_t rownr, const void* dataPtr, 
 				Bool writeFlag)
 {
@@ -172,7 +177,7 @@ void TSMDataColumn::accessCell (rownr_t rownr, const void* dataPtr,
     // Size the cache if the user has not done it and if the
     // last access was not to a cell.
     if (hypercube->getLastColAccess() != TSMCube::CellAccess) {
-	if (! stmanPtr_p->userSetCache (rownr)) {
+	if (canSizeCache (rownr)) {
 	    hypercube->setCacheSize (1 + end - start, IPosition(),
 				     IPosition(), IPosition(), True, False);
 	    hypercube->setLastColAccess (TSMCube::CellAccess);
@@ -204,7 +209,7 @@ void TSMDataColumn::accessCellSlice (rownr_t rownr, const Slicer& ns,
     // and if the access type or slice shape differs.
     if (hypercube->getLastColAccess() != TSMCube::SliceAccess
     ||  ! slice.isEqual (hypercube->getLastColSlice())) {
-	if (! stmanPtr_p->userSetCache (rownr)) {
+	if (canSizeCache (rownr)) {
 	    // The main access path is assumed to be along the full slice
 	    // dimensions.
 	    uInt naxis = 0;
@@ -234,7 +239,7 @@ void TSMDataColumn::accessColumn (const void* dataPtr, Bool writeFlag)
     end -= 1;
     IPosition start (end.nelements(), 0);
     // Size the cache if the user has not done it.
-    if (! stmanPtr_p->userSetCache (0)) {
+    if (canSizeCache (0)) {
 	hypercube->setCacheSize (end + 1, IPosition(),
 				 IPosition(), IPosition(), True, False);
 	hypercube->setLastColAccess (TSMCube::ColumnAccess);
@@ -268,7 +273,7 @@ void TSMDataColumn::accessColumnSlice (const Slicer& ns,
     // and if the access type or slice shape differs.
     if (hypercube->getLastColAccess() != TSMCube::ColumnSliceAccess
     ||  ! slice.isEqual (hypercube->getLastColSlice())) {
-	if (! stmanPtr_p->userSetCache (0)) {
+	if (canSizeCache (0)) {
 	    // The main access path is assumed to be along the full slice
 	    // dimensions.
 	    uInt naxis = 0;
@@ -460,7 +465,7 @@ void TSMDataColumn::accessFullCells (TSMCube* hypercube,
 {
   //  cout << "accessFullCells " << start << end << incr << endl;
   // Size the cache if the user has not done it.
-  if (! stmanPtr_p->userSetCache (0)) {
+  if (canSizeCache (0)) {
     if (hypercube->getLastColAccess() != TSMCube::ColumnAccess) {
       hypercube->setCacheSize (hypercube->cubeShape(), IPosition(),
 			       IPosition(), IPosition(), True, False);
@@ -479,7 +484,7 @@ void TSMDataColumn::accessSlicedCells (TSMCube* hypercube,
 {
   //  cout << "accessSlicedCells " << start << end << incr << endl;
   // Size the cache if the user has not done it.
-  if (! stmanPtr_p->userSetCache (0)) {
+  if (canSizeCache (0)) {
     // The main access path is assumed to be along the full slice
     // dimensions.
     uInt naxis = 0;
@@ -536,6 +541,24 @@ void TSMDataColumn::putArrayV (rownr_t rownr, const ArrayBase& dataPtr)
     dataPtr.freeVStorage (data, deleteIt);
 }
 
+const char* TSMDataColumn::mappedCellSlice (rownr_t rownr,
+                                            const IPosition& blc,
+                                            const IPosition& trc)
+{
+    IPosition end;
+    TSMCube* hypercube = stmanPtr_p->getHypercube (rownr, end);
+    IPosition start (end);
+    if (blc.nelements() != stmanPtr_p->nrCoordVector()
+    ||  trc.nelements() != blc.nelements()) {
+	return 0;
+    }
+    for (uInt i=0; i<blc.nelements(); i++) {
+	start(i) = blc(i);
+	end(i)   = trc(i);
+    }
+    return hypercube->mappedTile (start, end, colnr_p);
+}
+
 void TSMDataColumn::getSliceV (rownr_t rownr, const Slicer& ns,
                                ArrayBase& dataPtr)
 {
@@ -607,7 +630,8 @@ void TSMDataColumn::getArrayColumnCellsV (const RefRows& rownrs,
 {
     // Only use optimized accessColumnCells for hypercubes where the rows
     // are mapped to a single axis.
-    if (dataPtr.ndim() == stmanPtr_p->nrCoordVector() + 1) {
+    if (dataPtr.ndim() == stmanPtr_p->nrCoordVector() + 1
+    &&  dataPtr.ndim() == stmanPtr_p->nrdim()) {
         Bool deleteIt;
 	void* data = dataPtr.getVStorage (deleteIt);
 	accessColumnCells (rownrs, dataPtr.shape(), data, False);
@@ -622,7 +646,8 @@ void TSMDataColumn::putArrayColumnCellsV (const RefRows& rownrs,
 {
     // Only use optimized accessColumnCells for hypercubes where the rows
     // are mapped to a single axis.
-    if (dataPtr.ndim() == stmanPtr_p->nrCoordVector() + 1) {
+    if (dataPtr.ndim() == stmanPtr_p->nrCoordVector() + 1
+    &&  dataPtr.ndim() == stmanPtr_p->nrdim()) {
         Bool deleteIt;
 	const void* data = dataPtr.getVStorage (deleteIt);
 	accessColumnCells (rownrs, dataPtr.shape(), data, True);
@@ -638,7 +663,8 @@ void TSMDataColumn::getColumnSliceCellsV (const RefRows& rownrs,
 {
     // Only use optimized accessColumnSliceCells for hypercubes where the rows
     // are mapped to a single axis.
-    if (dataPtr.ndim() == stmanPtr_p->nrCoordVector() + 1) {
+    if (dataPtr.ndim() == stmanPtr_p->nrCoordVector() + 1
+    &&  dataPtr.ndim() == stmanPtr_p->nrdim()) {
         Bool deleteIt;
 	void* data = dataPtr.getVStorage (deleteIt);
 	accessColumnSliceCells (rownrs, ns, dataPtr.shape(), data, False);
@@ -654,7 +680,8 @@ void TSMDataColumn::putColumnSliceCellsV (const RefRows& rownrs,
 {
     // Only use optimized accessColumnSliceCells for hypercubes where the rows
     // are mapped to a single axis.
-    if (dataPtr.ndim() == stmanPtr_p->nrCoordVector() + 1) {
+    if (dataPtr.ndim() == stmanPtr_p->nrCoordVector() + 1
+    &&  dataPtr.ndim() == stmanPtr_p->nrdim()) {
         Bool deleteIt;
 	const void* data = dataPtr.getVStorage (deleteIt);
 	accessColumnSliceCells (rownrs, ns, dataPtr.shape(), data, True);
@@ -269,6 +269,12 @@ public:
     Bool isConversionNeeded() const
       { return mustConvert_p; }
 
+    // Get a pointer to the data of the given part of a cell if it can be
+    // used directly in the memory-mapped file (see TSMCube::mappedTile).
+    // Otherwise 0 is returned.
+    const char* mappedCellSlice (rownr_t rownr, const IPosition& blc,
+                                 const IPosition& trc);
+
 private:
     // The (canonical) size of a pixel in a tile.
     uInt tilePixelSize_p;
@@ -287,6 +293,11 @@ private:
     Conversion::ValueFunction* writeFunc_p;
 
 
+    // Can the cache size of the hypercube containing the row be set
+    // automatically? It is not done if the user has set it or if the
+    // storage manager is read concurrently.
+    Bool canSizeCache (rownr_t rownr) const;
+
     // Read or write a data cell in the cube.
     // A cell can contain a scalar or an array (depending on the
     // column definition).
@@ -68,6 +68,9 @@ TSMFile::TSMFile (const String& fileName, Bool writable,
       bufSize = tsmOpt.bufferSize();
     }
     file_p = new BucketFile (fileName, writable, bufSize, mapOpt, mfile);
+    if (tsmOpt.option() == TSMOption::Cache  &&  tsmOpt.useODirect()) {
+      file_p->setODirect (True);
+    }
 }
 
 TSMFile::TSMFile (const TiledStMan* stman, AipsIO& ios, uInt seqnr,
@@ -90,6 +93,9 @@ TSMFile::TSMFile (const TiledStMan* stman, AipsIO& ios, uInt seqnr,
     }
     file_p = new BucketFile (fileName, stman->table().isWritable(),
                              bufSize, mapOpt, mfile);
+    if (tsmOpt.option() == TSMOption::Cache  &&  tsmOpt.useODirect()) {
+      file_p->setODirect (True);
+    }
 }
 
 TSMFile::~TSMFile()
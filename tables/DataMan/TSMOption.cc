@@ -29,10 +29,14 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   TSMOption::TSMOption (TSMOption::Option option, Int bufferSize,
-                        Int maxCacheSizeMB)
-    : itsOption       (option),
-      itsBufferSize   (bufferSize),
-      itsMaxCacheSize (maxCacheSizeMB)
+                        Int maxCacheSizeMB, Int prefetchTiles,
+                        Int useODirect, Int useHugePages)
+    : itsOption        (option),
+      itsBufferSize    (bufferSize),
+      itsMaxCacheSize  (maxCacheSizeMB),
+      itsPrefetchTiles (prefetchTiles),
+      itsUseODirect    (useODirect),
+      itsUseHugePages  (useHugePages)
   {}
 
   void TSMOption::fillOption (Bool newTable)
@@ -65,6 +69,25 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (itsMaxCacheSize <= -2) {
       AipsrcValue<Int>::find (itsMaxCacheSize, "table.tsm.maxcachesizemb", -1);
     }
+    // Default is no read-ahead.
+    if (itsPrefetchTiles <= -2) {
+      AipsrcValue<Int>::find (itsPrefetchTiles, "table.tsm.prefetchtiles", 0);
+    }
+    if (itsPrefetchTiles < 0) {
+      itsPrefetchTiles = 0;
+    }
+    // Default is not to use O_DIRECT.
+    if (itsUseODirect < 0) {
+      Bool useODirect;
+      AipsrcValue<Bool>::find (useODirect, "table.tsm.odirect", False);
+      itsUseODirect = useODirect;
+    }
+    // Default is not to use huge pages.
+    if (itsUseHugePages < 0) {
+      Bool useHugePages;
+      AipsrcValue<Bool>::find (useHugePages, "table.tsm.hugepages", False);
+      itsUseHugePages = useHugePages;
+    }
     // Default is to use the old caching behaviour
     // Abandoned default to use mmap for existing files on 64 bit systems.
     if (itsOption == TSMOption::Default) {
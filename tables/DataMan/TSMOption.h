@@ -107,6 +107,28 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> <src>table.tsm.buffersize</src> gives the buffer size for option
 //       <src>TSMOption::Buffer</src>. A value <=0 means use the default 4096.
 //       It defaults to 0.
+//  <li> <src>table.tsm.prefetchtiles</src> gives the maximum number of tiles
+//       read ahead by a background thread for option
+//       <src>TSMOption::Cache</src>. When a hypercube is accessed sequentially
+//       along its last axis (e.g. iterating through the rows of a column),
+//       the tiles following the ones accessed are read ahead, so I/O overlaps
+//       with computation. It is only done for tables opened read-only.
+//       A value 0 means no read-ahead. It defaults to 0.
+//  <li> <src>table.tsm.odirect</src> can be true or false. It tells if
+//       the tiles have to be read with O_DIRECT for option
+//       <src>TSMOption::Cache</src>, thus bypassing the kernel's file cache.
+//       It is meant for one-pass processing of large tables, which would
+//       otherwise evict more useful data from the file cache (and keep the
+//       data twice in memory). It is only done for tables opened read-only
+//       and if the OS supports O_DIRECT. It defaults to false.
+//  <li> <src>table.tsm.hugepages</src> can be true or false. It tells if
+//       the tiles in the cache of option <src>TSMOption::Cache</src> are
+//       allocated in slabs backed by transparent huge pages (see class
+//       <linkto class=SlabAllocator>SlabAllocator</linkto>). For option
+//       <src>TSMOption::MMap</src> it advises the kernel to use huge pages
+//       for the mapped file (which only has effect for file systems
+//       supporting it). Huge pages reduce the TLB misses and page faults
+//       for large caches. It defaults to false.
 // </ul>
 // </synopsis>
 
@@ -133,8 +155,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // A size value -2 means reading that size from the aipsrc file.
     // The buffer size has to be given in bytes.
     // The maximum cache size has to be given in MibiBytes (1024*1024 bytes).
+    // The number of prefetch tiles and O_DIRECT are only used for option
+    // Cache. A negative useODirect or useHugePages means reading it from
+    // the aipsrc file.
     TSMOption (Option option=Aipsrc, Int bufferSize=-2,
-               Int maxCacheSizeMB=-2);
+               Int maxCacheSizeMB=-2, Int prefetchTiles=-2,
+               Int useODirect=-2, Int useHugePages=-2);
 
     // Fill the option in case Aipsrc or Default was given.
     // It is done as explained in the synopsis.
@@ -152,10 +178,25 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int maxCacheSizeMB() const
       { return itsMaxCacheSize; }
 
+    // Get the maximum number of tiles to read ahead. 0 means no read-ahead.
+    Int prefetchTiles() const
+      { return itsPrefetchTiles; }
+
+    // Tell if O_DIRECT has to be used for reading tiles.
+    Bool useODirect() const
+      { return itsUseODirect > 0; }
+
+    // Tell if huge pages have to be used for the tile cache or mapped file.
+    Bool useHugePages() const
+      { return itsUseHugePages > 0; }
+
   private:
     Option itsOption;
     Int    itsBufferSize;
     Int    itsMaxCacheSize;
+    Int    itsPrefetchTiles;
+    Int    itsUseODirect;
+    Int    itsUseHugePages;
   };
 
 } //# NAMESPACE CASACORE - END
@@ -49,7 +49,10 @@ static Record emptyRecord;
 TiledShapeStMan::TiledShapeStMan()
 : TiledStMan     (),
   nrUsedRowMap_p (0),
-  lastHC_p       (-1)
+  lastHC_p       (-1),
+  lastFoundCube_p(0),
+  rowIndexShift_p(0),
+  rowIndexEnd_p  (0)
 {}
 
 TiledShapeStMan::TiledShapeStMan (const String& hypercolumnName,
@@ -58,14 +61,20 @@ TiledShapeStMan::TiledShapeStMan (const String& hypercolumnName,
 : TiledStMan         (hypercolumnName, maximumCacheSize),
   defaultTileShape_p (defaultTileShape),
   nrUsedRowMap_p     (0),
-  lastHC_p           (-1)
+  lastHC_p           (-1),
+  lastFoundCube_p    (0),
+  rowIndexShift_p    (0),
+  rowIndexEnd_p      (0)
 {}
 
 TiledShapeStMan::TiledShapeStMan (const String& hypercolumnName,
 				  const Record& spec)
 : TiledStMan     (hypercolumnName, 0),
   nrUsedRowMap_p (0),
-  lastHC_p       (-1)
+  lastHC_p       (-1),
+  lastFoundCube_p(0),
+  rowIndexShift_p(0),
+  rowIndexEnd_p  (0)
 {
     if (spec.isDefined ("DEFAULTTILESHAPE")) {
         defaultTileShape_p = IPosition (spec.toArrayInt ("DEFAULTTILESHAPE"));
@@ -153,9 +162,17 @@ Int TiledShapeStMan::findHypercube (const IPosition& shape)
 {
     // A hypercube matches when its shape matches.
     // Its last axis is excluded, because it represents the rows.
+    // Usually consecutive rows have the same shape, so first test the
+    // hypercube found last.
     uInt64 n = cubeSet_p.nelements();
+    if (lastFoundCube_p > 0  &&  lastFoundCube_p < n  &&
+        shape.isEqual (cubeSet_p[lastFoundCube_p]->cubeShape(),
+                       size_t(nrdim_p-1))) {
+        return lastFoundCube_p;
+    }
     for (uInt64 i=1; i<n; i++) {
 	if (shape.isEqual (cubeSet_p[i]->cubeShape(), size_t(nrdim_p-1))) {
+	    lastFoundCube_p = i;
 	    return i;
 	}
     }
@@ -238,6 +255,9 @@ void TiledShapeStMan::readHeader (rownr_t tabNrrow, Bool firstTime)
     getBlock (*headerFile, cubeMap_p);
     getBlock (*headerFile, posMap_p);
     headerFile->getend();
+    lastHC_p = -1;
+    rowIndex_p.clear();
+    rowIndexEnd_p = 0;
     headerFileClose (headerFile);
 }
 
@@ -353,7 +373,10 @@ void TiledShapeStMan::updateRowMap (uInt cubeNr, uInt pos, rownr_t rownr)
     //        row  6-10 are in pos 0-4  of cube 2
     //        row 11-15 are in pos 6-10 of cube 1
 
-    // The row is not past the end.
+    // The row is not past the end, so existing intervals might change.
+    lastHC_p = -1;
+    rowIndex_p.clear();
+    rowIndexEnd_p = 0;
     // Find the closest row number in the map
     // (returns index of entry equal or less to given one).
     Bool found;
@@ -447,6 +470,73 @@ void TiledShapeStMan::updateRowMap (uInt cubeNr, uInt pos, rownr_t rownr)
     posMap_p[index]  = pos;
 }
 
+uInt TiledShapeStMan::findRowMapIndex (rownr_t rownr)
+{
+    // Test if the row number is in the most recently used interval.
+    // See description in function updateRowMap (about line 340)
+    // how intervals are defined.
+    if (lastHC_p >= 0  &&  rownr <= rowMap_p[lastHC_p]
+    &&  (lastHC_p == 0  ||  rownr > rowMap_p[lastHC_p-1])) {
+        return lastHC_p;
+    }
+    // Use a binary search if there are only a few intervals.
+    if (nrUsedRowMap_p < 64) {
+        Bool found;
+        return binarySearchBrackets (found, rowMap_p, rownr, nrUsedRowMap_p);
+    }
+    // Otherwise use the row index. It is remade if it covers less than
+    // half of the rows (rows can have been added since it was made).
+    rownr_t nrow = rownr_t(rowMap_p[nrUsedRowMap_p-1]) + 1;
+    if (rowIndexEnd_p <= nrow/2) {
+        makeRowIndex();
+    }
+    if (rownr >= rowIndexEnd_p) {
+        Bool found;
+        return binarySearchBrackets (found, rowMap_p, rownr, nrUsedRowMap_p);
+    }
+    // The index gives the interval of the first row in a step. On average
+    // a step contains about one interval.
+    uInt index = rowIndex_p[rownr >> rowIndexShift_p];
+    while (rowMap_p[index] < rownr) {
+        index++;
+    }
+    return index;
+}
+
+uInt TiledShapeStMan::lockedFindRowMapIndex (rownr_t rownr)
+{
+    // The search updates lastHC_p and possibly the row index, so it has
+    // to be serialized if rows are read by multiple threads.
+    std::unique_lock<std::mutex> lock(mutex_p, std::defer_lock);
+    if (isConcurrent()) {
+        lock.lock();
+    }
+    lastHC_p = findRowMapIndex (rownr);
+    return lastHC_p;
+}
+
+void TiledShapeStMan::makeRowIndex()
+{
+    rownr_t nrow = rownr_t(rowMap_p[nrUsedRowMap_p-1]) + 1;
+    // Use the largest power of 2 as step giving at least as many steps
+    // as there are intervals.
+    rowIndexShift_p = 0;
+    while ((nrow >> (rowIndexShift_p+1)) >= nrUsedRowMap_p) {
+        rowIndexShift_p++;
+    }
+    size_t nstep = ((nrow-1) >> rowIndexShift_p) + 1;
+    rowIndex_p.resize (nstep);
+    uInt index = 0;
+    for (size_t i=0; i<nstep; ++i) {
+        rownr_t rownr = rownr_t(i) << rowIndexShift_p;
+        while (rowMap_p[index] < rownr) {
+            index++;
+        }
+        rowIndex_p[i] = index;
+    }
+    rowIndexEnd_p = nrow;
+}
+
 TSMCube* TiledShapeStMan::getHypercube (rownr_t rownr)
 {
     if (rownr >= nrrow_p) {
@@ -456,16 +546,8 @@ TSMCube* TiledShapeStMan::getHypercube (rownr_t rownr)
     if (nrUsedRowMap_p == 0  ||  rownr > rowMap_p[nrUsedRowMap_p-1]) {
         return cubeSet_p[0];
     }
-    // Test if the row number is in the most recently used interval.
-    // See description in function updateRowMap (about line 340)
-    // how intervals are defined.
-    if (lastHC_p < 0  ||  rownr > rowMap_p[lastHC_p]
-    ||  (lastHC_p > 0  &&  rownr <= rowMap_p[lastHC_p-1])) {
-        Bool found;
-	lastHC_p = binarySearchBrackets (found, rowMap_p, rownr,
-					 nrUsedRowMap_p);
-    }
-    return cubeSet_p[cubeMap_p[lastHC_p]];
+    uInt index = lockedFindRowMapIndex (rownr);
+    return cubeSet_p[cubeMap_p[index]];
 }
 
 TSMCube* TiledShapeStMan::getHypercube (rownr_t rownr, IPosition& position)
@@ -483,16 +565,8 @@ TSMCube* TiledShapeStMan::getHypercube (rownr_t rownr, IPosition& position)
 	position = shp;
         return hypercube;
     }
-    // Test if the row number is in the most recently used interval.
-    // See description in function updateRowMap (about line 340)
-    // how intervals are defined.
-    if (lastHC_p < 0  ||  rownr > rowMap_p[lastHC_p]
-    ||  (lastHC_p > 0  &&  rownr <= rowMap_p[lastHC_p-1])) {
-        Bool found;
-	lastHC_p = binarySearchBrackets (found, rowMap_p, rownr,
-					 nrUsedRowMap_p);
-    }
-    TSMCube* hypercube = cubeSet_p[cubeMap_p[lastHC_p]];
+    uInt index = lockedFindRowMapIndex (rownr);
+    TSMCube* hypercube = cubeSet_p[cubeMap_p[index]];
     const IPosition& shp = hypercube->cubeShape();
     if (position.nelements() != shp.nelements()) {
         position.resize (shp.nelements());
@@ -500,8 +574,8 @@ TSMCube* TiledShapeStMan::getHypercube (rownr_t rownr, IPosition& position)
     position = shp;
     // Add the starting position of the hypercube chunk the row is in.
     if (position.nelements() > 0) {
-        position(nrdim_p - 1) = posMap_p[lastHC_p] -
-	                        (rowMap_p[lastHC_p] - rownr);
+        position(nrdim_p - 1) = posMap_p[index] -
+	                        (rowMap_p[index] - rownr);
     }
     return hypercube;
 }
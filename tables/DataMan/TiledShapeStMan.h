@@ -32,6 +32,8 @@
 #include <casacore/tables/DataMan/TiledStMan.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <mutex>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -301,6 +303,17 @@ private:
     // will new empty entries.
     void extendRowMap (rownr_t nrow);
 
+    // Find the index of the row interval in the maps containing the row.
+    // The row must be contained in the maps.
+    uInt findRowMapIndex (rownr_t rownr);
+
+    // Find the index like findRowMapIndex and set lastHC_p to it.
+    // It takes the mutex if the storage manager is read concurrently.
+    uInt lockedFindRowMapIndex (rownr_t rownr);
+
+    // Make the index giving the row interval for rows at regular steps.
+    void makeRowIndex();
+
 
     //# Declare the data members.
     // The default tile shape.
@@ -313,6 +326,17 @@ private:
     uInt nrUsedRowMap_p;
     // The last hypercube found.
     Int lastHC_p;
+    // The cube index last found by findHypercube.
+    uInt lastFoundCube_p;
+    // The index to find the row interval in constant time if there are
+    // many intervals (e.g. a variable shaped column with many shapes).
+    // Entry i gives the interval containing row i * 2**rowIndexShift_p.
+    // The index is valid for rows < rowIndexEnd_p.
+    std::vector<uInt> rowIndex_p;
+    uInt    rowIndexShift_p;
+    rownr_t rowIndexEnd_p;
+    // The mutex serializing the row map search in concurrent reading.
+    std::mutex mutex_p;
 };
 
 
@@ -35,6 +35,7 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Utilities/DataType.h>
@@ -58,7 +59,9 @@ TiledStMan::TiledStMan ()
   maxCacheSize_p    (0),
   nrdim_p           (0),
   nrCoordVector_p   (0),
-  dataChanged_p     (False)
+  dataChanged_p     (False),
+  sequentialWrite_p (False),
+  concurrent_p      (False)
 {}
 
 TiledStMan::TiledStMan (const String& hypercolumnName, uInt maximumCacheSize)
@@ -70,7 +73,9 @@ TiledStMan::TiledStMan (const String& hypercolumnName, uInt maximumCacheSize)
   maxCacheSize_p    (maximumCacheSize),
   nrdim_p           (0),
   nrCoordVector_p   (0),
-  dataChanged_p     (False)
+  dataChanged_p     (False),
+  sequentialWrite_p (False),
+  concurrent_p      (False)
 {}
 
 TiledStMan::~TiledStMan()
@@ -327,6 +332,13 @@ void TiledStMan::setShape (rownr_t, TSMCube*, const IPosition&, const IPosition&
 
 void TiledStMan::reopenRW()
 {
+    // Concurrent reading is not possible anymore.
+    concurrent_p = False;
+    for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+	if (cubeSet_p[i] != 0) {
+	    cubeSet_p[i]->deleteSharedCache();
+	}
+    }
     for (uInt i=0; i<fileSet_p.nelements(); i++) {
 	if (fileSet_p[i] != 0) {
 	    fileSet_p[i]->bucketFile()->setRW();
@@ -376,6 +388,11 @@ Bool TiledStMan::canAddRow() const
     return True;
 }
 
+Bool TiledStMan::canDeferOpen() const
+{
+    return True;
+}
+
 TSMCube* TiledStMan::makeTSMCube (TSMFile* file, const IPosition& cubeShape,
                                   const IPosition& tileShape,
                                   const Record& values,
@@ -471,6 +488,34 @@ void TiledStMan::setHypercubeCacheSize (uInt hypercube, uInt nbuckets, Bool forc
 }
 
 
+void TiledStMan::adviseAccess (rownr_t rownr,
+			       const IPosition& sliceShape,
+			       const IPosition& windowStart,
+			       const IPosition& windowLength,
+			       const IPosition& axisPath)
+{
+    getHypercube(rownr)->adviseAccess (sliceShape, windowStart,
+				       windowLength, axisPath);
+}
+
+void TiledStMan::setSequentialWrite (Bool sequential)
+{
+    sequentialWrite_p = sequential;
+}
+
+const char* TiledStMan::mappedCellSlice (const String& columnName,
+					 rownr_t rownr,
+					 const IPosition& blc,
+					 const IPosition& trc)
+{
+    for (uInt i=0; i<dataCols_p.nelements(); i++) {
+	if (dataCols_p[i]->columnName() == columnName) {
+	    return dataCols_p[i]->mappedCellSlice (rownr, blc, trc);
+	}
+    }
+    return 0;
+}
+
 Bool TiledStMan::userSetCache (rownr_t rownr) const
 {
     return getHypercube(rownr)->userSetCache();
@@ -494,6 +539,18 @@ void TiledStMan::showCacheStatistics (ostream& os) const
     }
 }
 
+Record TiledStMan::cacheStatistics() const
+{
+    Record rec;
+    for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+	if (cubeSet_p[i] != 0) {
+	    rec.defineRecord ('*' + String::toString(i),
+                              cubeSet_p[i]->cacheStatistics());
+	}
+    }
+    return rec;
+}
+
 TSMCube* TiledStMan::singleHypercube()
 {
     if (cubeSet_p.nelements() != 1  ||  cubeSet_p[0] == 0) {
@@ -997,6 +1054,7 @@ rownr_t TiledStMan::addedNrrow (const IPosition& shape, uInt incrInLastDim) cons
 
 rownr_t TiledStMan::open64 (rownr_t nrrow, AipsIO&)
 {
+    concurrent_p = DataManager::concurrentRead()  &&  !table().isWritable();
     // Read the header info (for the first time).
     readHeader (nrrow, True);
     return nrrow;
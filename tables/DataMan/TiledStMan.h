@@ -250,6 +250,38 @@ public:
     // Useful for iterating over all hypercubes.
     void setHypercubeCacheSize (uInt hypercube, uInt nbuckets, Bool forceSmaller);
 
+    // Tell how the hypercube containing the given row will be accessed,
+    // so hints for read-ahead can be given (see TSMCube::adviseAccess).
+    // The arguments are the same as for <src>setCacheSize</src>.
+    void adviseAccess (rownr_t rownr, const IPosition& sliceShape,
+                       const IPosition& windowStart,
+                       const IPosition& windowLength,
+                       const IPosition& axisPath);
+
+    // Tell if the data will be written sequentially (e.g. when appending
+    // rows). If so, partial tile updates are gathered in a write-behind
+    // buffer, so a tile is written once when complete and not read back
+    // (see TSMCube::accessSection). It is only used for hypercubes using
+    // <src>TSMOption::Cache</src>. The setting is not persistent.
+    // <group>
+    void setSequentialWrite (Bool sequential);
+    Bool sequentialWrite() const;
+    // </group>
+
+    // Are the hypercubes read concurrently by multiple threads?
+    // It is the case if the table is opened read-only while
+    // <src>DataManager::concurrentRead()</src> is set. The cache sizes
+    // are not changed automatically then.
+    Bool isConcurrent() const;
+
+    // Get a pointer to the data of the part blc-trc of a cell in the given
+    // column if it is exactly one tile in a memory-mapped hypercube and
+    // if the data do not need to be converted. Otherwise 0 is returned.
+    // <br>The pointer is only valid until the hypercube is extended or the
+    // table is closed. The data must not be changed using the pointer.
+    const char* mappedCellSlice (const String& columnName, rownr_t rownr,
+                                 const IPosition& blc, const IPosition& trc);
+
     // Determine if the user set the cache size (using setCacheSize).
     Bool userSetCache (rownr_t rownr) const;
 
@@ -262,6 +294,11 @@ public:
     // Show the statistics of all caches used.
     void showCacheStatistics (ostream& os) const;
 
+    // Get the statistics of the caches of all hypercubes as a record.
+    // It contains a subrecord per hypercube (named *i) holding the
+    // cache statistics and the cube and tile shape.
+    virtual Record cacheStatistics() const;
+
     // Get the length of the data for the given number of pixels.
     // This can be used to calculate the length of a tile.
     uInt64 getLengthOffset (uInt64 nrPixels, Block<uInt>& dataOffset,
@@ -271,12 +308,20 @@ public:
     // Get the number of coordinate vectors.
     uInt nrCoordVector() const;
 
+    // Get the dimensionality of the hypercubes.
+    // It is equal to nrCoordVector() in the TiledCellStMan, because
+    // it has a hypercube per row.
+    uInt nrdim() const;
+
     // Get the nr of rows in this storage manager.
     rownr_t nrow() const;
 
     // Does the storage manager allow to add rows? (yes)
     Bool canAddRow() const;
 
+    // Can opening the storage manager be deferred? (yes)
+    Bool canDeferOpen() const;
+
     // Get the default tile shape.
     // By default it returns a zero-length IPosition.
     virtual IPosition defaultTileShape() const;
@@ -523,6 +568,10 @@ protected:
     IPosition fixedCellShape_p;
     // Has any data changed since the last flush?
     Bool      dataChanged_p;
+    // Is the data written sequentially (use write-behind)?
+    Bool      sequentialWrite_p;
+    // Are the hypercubes read concurrently?
+    Bool      concurrent_p;
 };
 
 
@@ -532,6 +581,9 @@ inline uInt TiledStMan::maximumCacheSize() const
 inline uInt TiledStMan::nrCoordVector() const
     { return nrCoordVector_p; }
 
+inline uInt TiledStMan::nrdim() const
+    { return nrdim_p; }
+
 inline rownr_t TiledStMan::nrow() const
     { return nrrow_p; }
 
@@ -541,6 +593,12 @@ inline uInt TiledStMan::nhypercubes() const
 inline void TiledStMan::setDataChanged()
     { dataChanged_p = True; }
 
+inline Bool TiledStMan::sequentialWrite() const
+    { return sequentialWrite_p; }
+
+inline Bool TiledStMan::isConcurrent() const
+    { return concurrent_p; }
+
 inline const TSMCube* TiledStMan::getTSMCube (uInt hypercube) const
     { return const_cast<TiledStMan*>(this)->getTSMCube (hypercube); }
 
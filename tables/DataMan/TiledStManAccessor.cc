@@ -185,6 +185,29 @@ void ROTiledStManAccessor::setCacheSize (rownr_t rownr, uInt nbuckets,
     dataManPtr_p->setCacheSize (rownr, nbuckets, forceSmaller);
 }
 
+void ROTiledStManAccessor::adviseAccess (rownr_t rownr,
+					 const IPosition& sliceShape,
+					 const IPosition& windowStart,
+					 const IPosition& windowLength,
+					 const IPosition& axisPath)
+{
+    dataManPtr_p->adviseAccess (rownr, sliceShape, windowStart,
+				windowLength, axisPath);
+}
+
+void ROTiledStManAccessor::setSequentialWrite (Bool sequential)
+{
+    dataManPtr_p->setSequentialWrite (sequential);
+}
+
+const void* ROTiledStManAccessor::mappedCellSlice (const String& columnName,
+						   rownr_t rownr,
+						   const IPosition& blc,
+						   const IPosition& trc) const
+{
+    return dataManPtr_p->mappedCellSlice (columnName, rownr, blc, trc);
+}
+
 void ROTiledStManAccessor::setHypercubeCacheSize (uInt hypercube, uInt nbuckets,
                                                   Bool forceSmaller)
 {
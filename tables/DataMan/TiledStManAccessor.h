@@ -274,6 +274,35 @@ public:
     // is useful when iterating over the hypercubes in an StMan.
     void setHypercubeCacheSize (uInt hypercube, uInt nbuckets, Bool forceSmaller = True);
 
+    // Tell how the hypercube containing the given row will be accessed.
+    // The arguments are the same as for <src>setCacheSize</src>.
+    // It is used for memory-mapped hypercubes to advise the OS about
+    // read-ahead; for other hypercubes nothing is done.
+    void adviseAccess (rownr_t rownr, const IPosition& sliceShape,
+                       const IPosition& windowStart,
+                       const IPosition& windowLength,
+                       const IPosition& axisPath);
+
+    // Tell if the data will be written sequentially, for example by a
+    // writer appending rows one by one. In that case partial tile updates
+    // are gathered in memory and a tile is written only once when it is
+    // complete, instead of being written and read back when the cache is
+    // too small. Note that a tile completely overwritten by a put is never
+    // read, also without this hint.
+    // The hint is not persistent and is only used by hypercubes using
+    // <src>TSMOption::Cache</src>.
+    void setSequentialWrite (Bool sequential);
+
+    // Get a pointer to the data of the part blc-trc of a cell in the given
+    // column if the part is exactly one tile of a memory-mapped hypercube
+    // (see <linkto class=TSMOption>TSMOption</linkto>) and the data are
+    // stored in local format. Otherwise a null pointer is returned.
+    // <br>The pointer is only valid until the hypercube is extended or the
+    // table is closed. The data must not be changed using the pointer.
+    const void* mappedCellSlice (const String& columnName, rownr_t rownr,
+                                 const IPosition& blc,
+                                 const IPosition& trc) const;
+
     // Clear the caches used by the hypercubes in this storage manager.
     // It will flush the caches as needed and remove all buckets from them
     // resulting in a possibly large drop in memory used.
@@ -38,6 +38,8 @@ Bool VirtualColumnEngine::isStorageManager() const
 
 Bool VirtualColumnEngine::canAddRow() const
     { return True; }
+Bool VirtualColumnEngine::canDeferOpen() const
+    { return True; }
 void VirtualColumnEngine::addRow64 (rownr_t)
     {}
 Bool VirtualColumnEngine::canRemoveRow() const
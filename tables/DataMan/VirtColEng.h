@@ -130,6 +130,9 @@ private:
     // Does the data manager allow to add rows? (default no)
     virtual Bool canAddRow() const;
 
+    // Can opening the engine be deferred? (default yes)
+    virtual Bool canDeferOpen() const;
+
     // Does the data manager allow to delete rows? (default no)
     virtual Bool canRemoveRow() const;
 
@@ -27,6 +27,7 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/TaQL/TableParse.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/DataMan/DataManError.h>
@@ -34,11 +35,14 @@
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <algorithm>
+#include <memory>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
-  VirtualTaQLColumn::VirtualTaQLColumn (const String& expr, const String& style)
+VirtualTaQLColumn::VirtualTaQLColumn (const String& expr, const String& style,
+                                      Bool cacheResult)
 : itsDataType     (TpOther),
   itsIsArray      (False),
   itsIsConst      (False),
@@ -47,7 +51,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   itsStyle        (style),
   itsNode         (0),
   itsCurArray     (0),
-  itsCurRow       (-1)
+  itsCurRow       (-1),
+  itsCacheResult  (cacheResult),
+  itsFillingCache (False),
+  itsResultCache  (0),
+  itsCacheCounter (0)
 {}
 
 VirtualTaQLColumn::VirtualTaQLColumn (const Record& spec)
@@ -57,7 +65,11 @@ VirtualTaQLColumn::VirtualTaQLColumn (const Record& spec)
   itsTempWritable (False),
   itsNode         (0),
   itsCurArray     (0),
-  itsCurRow       (-1)
+  itsCurRow       (-1),
+  itsCacheResult  (False),
+  itsFillingCache (False),
+  itsResultCache  (0),
+  itsCacheCounter (0)
 {
   if (spec.isDefined ("TAQLCALCEXPR")) {
     itsExpr = spec.asString ("TAQLCALCEXPR");
@@ -65,10 +77,14 @@ VirtualTaQLColumn::VirtualTaQLColumn (const Record& spec)
   if (spec.isDefined ("TAQLSTYLE")) {
     itsStyle = spec.asString ("TAQLSTYLE");
   }
+  if (spec.isDefined ("TAQLCACHE")) {
+    itsCacheResult = spec.asBool ("TAQLCACHE");
+  }
 }
 
 VirtualTaQLColumn::~VirtualTaQLColumn()
 {
+  delete itsResultCache;
   delete itsCurArray;
   delete itsNode;
 }
@@ -121,7 +137,7 @@ void VirtualTaQLColumn::makeCurArray()
 
 DataManager* VirtualTaQLColumn::clone() const
 {
-  DataManager* dmPtr = new VirtualTaQLColumn (itsExpr, itsStyle);
+  DataManager* dmPtr = new VirtualTaQLColumn (itsExpr, itsStyle, itsCacheResult);
   return dmPtr;
 }
 
@@ -157,6 +173,9 @@ void VirtualTaQLColumn::create64 (rownr_t)
   itsTempWritable = False;
   tabcol.rwKeywordSet().define ("_VirtualTaQLEngine_CalcExpr", itsExpr);
   tabcol.rwKeywordSet().define ("_VirtualTaQLEngine_Style", itsStyle);
+  if (itsCacheResult) {
+    tabcol.rwKeywordSet().define ("_VirtualTaQLEngine_Cache", itsCacheResult);
+  }
 }
 
 void VirtualTaQLColumn::prepare()
@@ -167,6 +186,9 @@ void VirtualTaQLColumn::prepare()
   if (tabcol.keywordSet().isDefined ("_VirtualTaQLEngine_Style")) {
     itsStyle = tabcol.keywordSet().asString ("_VirtualTaQLEngine_Style");
   }
+  if (tabcol.keywordSet().isDefined ("_VirtualTaQLEngine_Cache")) {
+    itsCacheResult = tabcol.keywordSet().asBool ("_VirtualTaQLEngine_Cache");
+  }
   // Compile the expression.
   String cmd;
   if (! itsStyle.empty()) {
@@ -242,9 +264,41 @@ Record VirtualTaQLColumn::dataManagerSpec() const
 {
   Record spec;
   spec.define ("TAQLCALCEXPR", itsExpr);
+  spec.define ("TAQLCACHE", itsCacheResult);
   return spec;
 }
 
+Record VirtualTaQLColumn::getProperties() const
+{
+  Record rec;
+  rec.define ("CACHE", itsCacheResult);
+  return rec;
+}
+
+void VirtualTaQLColumn::setProperties (const Record& rec)
+{
+  if (rec.isDefined ("CACHE")) {
+    clearResultCache();
+    itsCacheResult = rec.asBool ("CACHE");
+  }
+}
+
+void VirtualTaQLColumn::addRow64 (rownr_t)
+{
+  clearResultCache();
+}
+
+void VirtualTaQLColumn::removeRow64 (rownr_t)
+{
+  clearResultCache();
+}
+
+rownr_t VirtualTaQLColumn::resync64 (rownr_t nrrow)
+{
+  clearResultCache();
+  return nrrow;
+}
+
 void VirtualTaQLColumn::setShapeColumn (const IPosition& aShape)
 {
   itsShape = aShape;
@@ -298,54 +352,124 @@ Bool VirtualTaQLColumn::isShapeDefined (rownr_t)
 
 void VirtualTaQLColumn::getBool (rownr_t rownr, Bool* dataPtr)
 {
-  *dataPtr = itsNode->getBool (rownr);
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = itsNode->getBool (rownr);
+  }
 }
 void VirtualTaQLColumn::getuChar (rownr_t rownr, uChar* dataPtr)
 {
-  *dataPtr = uChar(itsNode->getInt (rownr));
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = uChar(itsNode->getInt (rownr));
+  }
 }
 void VirtualTaQLColumn::getShort (rownr_t rownr, Short* dataPtr)
 {
-  *dataPtr = Short(itsNode->getInt (rownr));
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = Short(itsNode->getInt (rownr));
+  }
 }
 void VirtualTaQLColumn::getuShort (rownr_t rownr, uShort* dataPtr)
 {
-  *dataPtr = uShort(itsNode->getInt (rownr));
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = uShort(itsNode->getInt (rownr));
+  }
 }
 void VirtualTaQLColumn::getInt (rownr_t rownr, Int* dataPtr)
 {
-  *dataPtr = Int(itsNode->getInt (rownr));
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = Int(itsNode->getInt (rownr));
+  }
 }
 void VirtualTaQLColumn::getuInt (rownr_t rownr, uInt* dataPtr)
 {
-  *dataPtr = uInt(itsNode->getInt (rownr));
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = uInt(itsNode->getInt (rownr));
+  }
 }
 void VirtualTaQLColumn::getInt64 (rownr_t rownr, Int64* dataPtr)
 {
-  *dataPtr = itsNode->getInt (rownr);
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = itsNode->getInt (rownr);
+  }
 }
 void VirtualTaQLColumn::getfloat (rownr_t rownr, float* dataPtr)
 {
-  *dataPtr = Float(itsNode->getDouble (rownr));
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = Float(itsNode->getDouble (rownr));
+  }
 }
 void VirtualTaQLColumn::getdouble (rownr_t rownr, double* dataPtr)
 {
-  *dataPtr = itsNode->getDouble (rownr);
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = itsNode->getDouble (rownr);
+  }
 }
 void VirtualTaQLColumn::getComplex (rownr_t rownr, Complex* dataPtr)
 {
-  *dataPtr = Complex(itsNode->getDComplex (rownr));
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = Complex(itsNode->getDComplex (rownr));
+  }
 }
 void VirtualTaQLColumn::getDComplex (rownr_t rownr, DComplex* dataPtr)
 {
-  *dataPtr = itsNode->getDComplex (rownr);
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = itsNode->getDComplex (rownr);
+  }
 }
 void VirtualTaQLColumn::getString (rownr_t rownr, String* dataPtr)
 {
-  *dataPtr = itsNode->getString (rownr);
-  if (itsMaxLen > 0  &&  dataPtr->size() > itsMaxLen) {
-    *dataPtr = dataPtr->substr (0, itsMaxLen);
+  if (! getCached (rownr, dataPtr)) {
+    *dataPtr = itsNode->getString (rownr);
+    if (itsMaxLen > 0  &&  dataPtr->size() > itsMaxLen) {
+      *dataPtr = dataPtr->substr (0, itsMaxLen);
+    }
+  }
+}
+
+template<typename T>
+Bool VirtualTaQLColumn::getCached (rownr_t rownr, T* dataPtr)
+{
+  // Constant expressions are handled by the ColumnCache.
+  if (!itsCacheResult  ||  itsFillingCache  ||  itsIsConst) {
+    return False;
   }
+  checkResultCache();
+  *dataPtr = static_cast<Array<T>*>(itsResultCache)->data()[rownr];
+  return True;
+}
+
+void VirtualTaQLColumn::checkResultCache()
+{
+  if (itsResultCache  &&
+      itsCacheCounter != table().changeCounter()) {
+    clearResultCache();
+  }
+  if (! itsResultCache) {
+    fillResultCache();
+  }
+}
+
+void VirtualTaQLColumn::fillResultCache()
+{
+  // Create a vector of the correct type and fill it (in batch if possible).
+  std::unique_ptr<ArrayBase> arr (itsCurArray->makeArray());
+  arr->resize (IPosition(1, table().nrow()));
+  itsFillingCache = True;
+  try {
+    getScalarColumnV (*arr);
+  } catch (...) {
+    itsFillingCache = False;
+    throw;
+  }
+  itsFillingCache = False;
+  itsResultCache  = arr.release();
+  itsCacheCounter = table().changeCounter();
+}
+
+void VirtualTaQLColumn::clearResultCache()
+{
+  delete itsResultCache;
+  itsResultCache = 0;
 }
 
 void VirtualTaQLColumn::getArrayV (rownr_t rownr, ArrayBase& arr)
@@ -469,7 +593,11 @@ void VirtualTaQLColumn::getScalarColumnV (ArrayBase& arr)
   if (itsIsConst) {
     // Constant value, so fill the array with the same value.
     fillArray (arr);
-  } else {
+  } else if (itsCacheResult  &&  !itsFillingCache) {
+    checkResultCache();
+    arr.assignBase (*itsResultCache);
+  } else if (arr.size() == 0  ||
+             ! getBatch (RefRows(0, arr.size()-1), arr)) {
     getScalarColumnBase (arr);
   }
 }
@@ -479,8 +607,80 @@ void VirtualTaQLColumn::getScalarColumnCellsV (const RefRows& rownrs,
   if (itsIsConst) {
     // Constant value, so fill the array with the same value.
     fillArray (arr);
-  } else {
+  } else if (itsCacheResult  &&  !itsFillingCache) {
     getScalarColumnCellsBase (rownrs, arr);
+  } else if (! getBatch (rownrs, arr)) {
+    getScalarColumnCellsBase (rownrs, arr);
+  }
+}
+
+Bool VirtualTaQLColumn::getBatch (const RefRows& rownrs, ArrayBase& arr)
+{
+  Bool deleteIt;
+  void* ptr = arr.getVStorage (deleteIt);
+  Bool done = True;
+  switch (itsDataType) {
+  case TpBool:
+    getBatchT<Bool,Bool> (rownrs, static_cast<Bool*>(ptr));
+    break;
+  case TpUChar:
+    getBatchT<uChar,Int64> (rownrs, static_cast<uChar*>(ptr));
+    break;
+  case TpShort:
+    getBatchT<Short,Int64> (rownrs, static_cast<Short*>(ptr));
+    break;
+  case TpUShort:
+    getBatchT<uShort,Int64> (rownrs, static_cast<uShort*>(ptr));
+    break;
+  case TpInt:
+    getBatchT<Int,Int64> (rownrs, static_cast<Int*>(ptr));
+    break;
+  case TpUInt:
+    getBatchT<uInt,Int64> (rownrs, static_cast<uInt*>(ptr));
+    break;
+  case TpInt64:
+    getBatchT<Int64,Int64> (rownrs, static_cast<Int64*>(ptr));
+    break;
+  case TpFloat:
+    getBatchT<Float,Double> (rownrs, static_cast<Float*>(ptr));
+    break;
+  case TpDouble:
+    getBatchT<Double,Double> (rownrs, static_cast<Double*>(ptr));
+    break;
+  default:
+    done = False;
+  }
+  arr.putVStorage (ptr, deleteIt);
+  return done;
+}
+
+template<typename T, typename U>
+void VirtualTaQLColumn::getBatchT (const RefRows& rownrs, T* data)
+{
+  const rownr_t batchSize = 4096;
+  Block<U> values(batchSize);
+  TableExprId id;
+  for (RefRowsSliceIter iter(rownrs); !iter.pastEnd(); iter++) {
+    rownr_t row  = iter.sliceStart();
+    rownr_t end  = iter.sliceEnd();
+    rownr_t incr = iter.sliceIncr();
+    if (incr == 1) {
+      while (row <= end) {
+        rownr_t nr = std::min (batchSize, end-row+1);
+        id.setRownr (row);
+        itsNode->getBatch (id, nr, values.storage());
+        for (rownr_t i=0; i<nr; ++i) {
+          *data++ = T(values[i]);
+        }
+        row += nr;
+      }
+    } else {
+      for (; row<=end; row+=incr) {
+        id.setRownr (row);
+        itsNode->get (id, values[0]);
+        *data++ = T(values[0]);
+      }
+    }
   }
 }
 void VirtualTaQLColumn::fillColumnCache()
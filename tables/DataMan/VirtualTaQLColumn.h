@@ -60,6 +60,16 @@ class TableExprNode;
 // Constant expressions are precalculated and cached making the retrieval of
 // e.g. the full column much faster (factor 4).
 // <br>
+// Optionally the results of a scalar expression can be cached. The first get
+// evaluates the expression for all rows; thereafter values are taken from
+// the cache until the table is changed by another process (i.e., the table's
+// modify counter changed), rows are added or removed, or data in the table
+// are written by this process (i.e., the table's change counter changed).
+// Setting property CACHE (also to True) clears the cache. The option can be given in the constructor, in the
+// specification record (field TAQLCACHE), or as property CACHE; it is
+// stored in the column keywords, so it is used when the table is reopened.
+// Caching should not be used for expressions with random results.
+// <br>
 // A possible use for a virtual TaQL column is a column in a MeasurementSet
 // containing a constant value. It could also be used for on-the-fly calculation
 // of J2000 UVW-values or HADEC using an expression such as "derivedmscal.newuvw()"
@@ -97,7 +107,9 @@ class VirtualTaQLColumn : public VirtualColumnEngine, public DataManagerColumn
 public:
 
   // Construct it with the given TaQL expression.
-  VirtualTaQLColumn (const String& expr, const String& style=String());
+  // Optionally the results of a scalar expression are cached.
+  VirtualTaQLColumn (const String& expr, const String& style=String(),
+                     Bool cacheResult=False);
 
   // Construct it with the given specification.
   VirtualTaQLColumn (const Record& spec);
@@ -121,6 +133,13 @@ public:
   // (i.e. its class name VirtualTaQLColumn).
   virtual String dataManagerType() const;
 
+  // Get or set the properties. The only property is CACHE, telling if the
+  // expression results are cached. Setting it clears the cache.
+  // <group>
+  virtual Record getProperties() const;
+  virtual void setProperties (const Record& spec);
+  // </group>
+
   // Return the name of the class.
   static String className();
 
@@ -177,6 +196,14 @@ private:
   // Prepare compiles the expression.
   virtual void prepare();
 
+  // Clear the result cache if rows are added or removed, or if another
+  // process changed the table.
+  // <group>
+  virtual void addRow64 (rownr_t nrrow);
+  virtual void removeRow64 (rownr_t rownr);
+  virtual rownr_t resync64 (rownr_t nrrow);
+  // </group>
+
   // Get the scalar value in the given row.
   // <group>
   virtual void getBool     (rownr_t rownr, Bool* dataPtr);
@@ -205,13 +232,40 @@ private:
   void makeCurArray();
 
   // Get functions implemented by means of their DataManagerColumn::getXXBase
-  // counterparts, but optimized for constant expressions.
+  // counterparts, but optimized for constant expressions and using
+  // batch evaluation for numeric and Bool expressions.
   // <group>
   virtual void getScalarColumnV (ArrayBase& arr);
   virtual void getScalarColumnCellsV (const RefRows& rownrs,
                                       ArrayBase& arr);
   // </group>
 
+  // Get the scalar values of the given rows using batch evaluation of
+  // the expression, which avoids most of the per-row interpretation overhead.
+  // Ranges of consecutive rows are evaluated in blocks, other rows one by one.
+  // It returns False if the data type cannot be evaluated in batch
+  // (complex and string).
+  Bool getBatch (const RefRows& rownrs, ArrayBase& arr);
+
+  // Evaluate as type U and store as the column type T.
+  template<typename T, typename U>
+  void getBatchT (const RefRows& rownrs, T* data);
+
+  // Get a value from the result cache (which is filled if needed).
+  // It returns False if the results are not cached.
+  template<typename T>
+  Bool getCached (rownr_t rownr, T* dataPtr);
+
+  // Make sure the result cache is valid. It is cleared if data in the table
+  // have been changed since it was filled, and (re)filled if needed.
+  void checkResultCache();
+
+  // Evaluate the expression for all rows and store the results in the cache.
+  void fillResultCache();
+
+  // Clear the result cache.
+  void clearResultCache();
+
   // Fill the ColumnCache object with a constant scalar value.
   void fillColumnCache();
 
@@ -245,6 +299,10 @@ private:
   String     itsString;
   ArrayBase* itsCurArray;             //# array value (constant or in itsCurRow)
   rownr_t    itsCurRow;               //# row of current array value
+  Bool       itsCacheResult;          //# cache the scalar results?
+  Bool       itsFillingCache;         //# cache is being filled
+  ArrayBase* itsResultCache;          //# cached results of all rows (or 0)
+  uInt64     itsCacheCounter;         //# table change counter at cache fill
 };
 
 
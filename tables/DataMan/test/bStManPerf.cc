@@ -0,0 +1,394 @@
+//# bStManPerf.cc: Benchmark the throughput of the storage managers
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/TiledCellStMan.h>
+#include <casacore/tables/DataMan/MemoryStMan.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/OS/Benchmark.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+
+using namespace casacore;
+using namespace std;
+
+// This program benchmarks writing and reading a visibility-like DATA
+// column (complex, fixed shape [npol,nchan]) in several storage managers
+// using various access patterns (row-wise, column-wise, slices, random).
+// The table layout resembles a MeasurementSet, so Dysco can be used as well.
+// Storage managers not available in this build (Dysco, Adios2) are skipped.
+//
+// It is built by 'make bench'. Run it as:
+//    bStManPerf [ntime [nchan]] [benchmark options]
+// E.g., to compare two releases (using Google Benchmark's compare.py):
+//    bStManPerf --benchmark_out=new.json
+//    compare.py benchmarks old.json new.json
+
+const uInt nant  = 10;
+const uInt nbl   = nant*(nant-1)/2;
+const uInt npol  = 4;
+const uInt chunk = 1000;             // nr of rows per column-wise access
+uInt ntime = 200;
+uInt nchan = 64;
+
+class StManCase
+{
+public:
+  StManCase (const String& type, std::function<DataManager*()> make,
+             Bool persistent=True)
+    : itsType       (type),
+      itsMake       (make),
+      itsPersistent (persistent),
+      itsFilled     (False)
+  {}
+
+  const String& type() const
+    { return itsType; }
+
+  String tableName() const
+    { return "bStManPerf_tmp." + itsType; }
+
+  // Test if the storage manager can be made. If not, the reason is set.
+  Bool available (String& reason) const
+  {
+    try {
+      std::unique_ptr<DataManager> dm (itsMake());
+    } catch (const std::exception& x) {
+      reason = x.what();
+      return False;
+    }
+    return True;
+  }
+
+  // Create the table and fill it row-wise or column-wise.
+  void create (Bool rowWise)
+  {
+    // Close a table kept from a previous run.
+    itsKept = Table();
+    TableDesc td;
+    td.addColumn (ScalarColumnDesc<Double>("TIME"));
+    td.addColumn (ScalarColumnDesc<Int>("ANTENNA1"));
+    td.addColumn (ScalarColumnDesc<Int>("ANTENNA2"));
+    td.addColumn (ScalarColumnDesc<Int>("FIELD_ID"));
+    td.addColumn (ScalarColumnDesc<Int>("DATA_DESC_ID"));
+    td.addColumn (ArrayColumnDesc<Complex>("DATA", IPosition(2,npol,nchan),
+                                           ColumnDesc::FixedShape));
+    SetupNewTable newtab(tableName(), td, Table::New);
+    std::unique_ptr<DataManager> dm (itsMake());
+    newtab.bindColumn ("DATA", *dm);
+    Table tab(newtab, nrow());
+    ScalarColumn<Double> timeCol(tab, "TIME");
+    ScalarColumn<Int> ant1Col(tab, "ANTENNA1");
+    ScalarColumn<Int> ant2Col(tab, "ANTENNA2");
+    ScalarColumn<Int> fieldCol(tab, "FIELD_ID");
+    ScalarColumn<Int> ddCol(tab, "DATA_DESC_ID");
+    ArrayColumn<Complex> dataCol(tab, "DATA");
+    Array<Complex> arr(IPosition(2,npol,nchan));
+    for (uInt i=0; i<arr.size(); ++i) {
+      arr.data()[i] = Complex(i%7, Float(i%5) - 2);
+    }
+    if (rowWise) {
+      uInt row = 0;
+      for (uInt t=0; t<ntime; ++t) {
+        for (uInt a1=0; a1<nant; ++a1) {
+          for (uInt a2=a1+1; a2<nant; ++a2) {
+            timeCol.put (row, 4.5e9 + t);
+            ant1Col.put (row, a1);
+            ant2Col.put (row, a2);
+            fieldCol.put (row, 0);
+            ddCol.put (row, 0);
+            dataCol.put (row, arr);
+            ++row;
+          }
+        }
+      }
+    } else {
+      Vector<Double> times(nrow());
+      Vector<Int> ant1(nrow()), ant2(nrow());
+      uInt row = 0;
+      for (uInt t=0; t<ntime; ++t) {
+        for (uInt a1=0; a1<nant; ++a1) {
+          for (uInt a2=a1+1; a2<nant; ++a2) {
+            times[row] = 4.5e9 + t;
+            ant1[row]  = a1;
+            ant2[row]  = a2;
+            ++row;
+          }
+        }
+      }
+      timeCol.putColumn (times);
+      ant1Col.putColumn (ant1);
+      ant2Col.putColumn (ant2);
+      fieldCol.fillColumn (0);
+      ddCol.fillColumn (0);
+      Array<Complex> chunkArr(IPosition(3,npol,nchan,chunk));
+      for (uInt i=0; i<chunk; ++i) {
+        chunkArr[i] = arr;
+      }
+      for (uInt st=0; st<nrow(); st+=chunk) {
+        uInt n = std::min(chunk, nrow()-st);
+        Slicer rowRange(IPosition(1,st), IPosition(1,n));
+        if (n == chunk) {
+          dataCol.putColumnRange (rowRange, chunkArr);
+        } else {
+          dataCol.putColumnRange
+            (rowRange, chunkArr(IPosition(3,0), IPosition(3,npol-1,nchan-1,n-1)));
+        }
+      }
+    }
+    itsFilled = True;
+    // A non-persistent table has to be kept to be able to read it.
+    if (! itsPersistent) {
+      itsKept = tab;
+    }
+  }
+
+  // Get the table for reading; it is created first if needed.
+  Table openRead (BenchmarkState& state)
+  {
+    if (! itsFilled) {
+      state.pauseTiming();
+      create (True);
+      state.resumeTiming();
+    }
+    if (itsPersistent) {
+      return Table(tableName());
+    }
+    return itsKept;
+  }
+
+  static uInt nrow()
+    { return ntime*nbl; }
+
+  static uInt64 cellBytes()
+    { return sizeof(Complex) * npol * nchan; }
+
+  void remove()
+  {
+    itsKept = Table();
+    if (Table::isReadable (tableName())) {
+      Table tab(tableName(), Table::Delete);
+    }
+  }
+
+private:
+  String itsType;
+  std::function<DataManager*()> itsMake;
+  Bool   itsPersistent;
+  Bool   itsFilled;
+  Table  itsKept;
+};
+
+// Create a data manager registered under the given type name.
+// It throws an exception if not available.
+DataManager* makeRegistered (const String& type, const Record& spec)
+{
+  if (! DataManager::isRegistered (type)) {
+    // getCtor tries to load the data manager from a shared library.
+    try {
+      DataManager::getCtor (type);
+    } catch (const std::exception&) {
+    }
+    if (! DataManager::isRegistered (type)) {
+      throw AipsError (type + " is not available in this build");
+    }
+  }
+  return DataManager::getCtor(type) (type + "Data", spec);
+}
+
+std::vector<std::shared_ptr<StManCase>> makeCases()
+{
+  std::vector<std::shared_ptr<StManCase>> cases;
+  cases.push_back (std::make_shared<StManCase>
+    ("SSM", [](){ return new StandardStMan("SSMData"); }));
+  cases.push_back (std::make_shared<StManCase>
+    ("ISM", [](){ return new IncrementalStMan("ISMData"); }));
+  cases.push_back (std::make_shared<StManCase>
+    ("TiledColumnStMan", [](){ return new TiledColumnStMan
+        ("TSMData", IPosition(3,npol,nchan,64)); }));
+  cases.push_back (std::make_shared<StManCase>
+    ("TiledShapeStMan", [](){ return new TiledShapeStMan
+        ("TSMData", IPosition(3,npol,nchan,64)); }));
+  cases.push_back (std::make_shared<StManCase>
+    ("TiledCellStMan", [](){ return new TiledCellStMan
+        ("TSMData", IPosition(2,npol,nchan)); }));
+  cases.push_back (std::make_shared<StManCase>
+    ("MemoryStMan", [](){ return new MemoryStMan("MSMData"); }, False));
+  cases.push_back (std::make_shared<StManCase>
+    ("DyscoStMan", [](){
+        Record spec;
+        spec.define ("dataBitCount", 8);
+        spec.define ("weightBitCount", 12);
+        spec.define ("distribution", "TruncatedGaussian");
+        spec.define ("normalization", "AF");
+        spec.define ("studentTNu", 0.);
+        spec.define ("distributionTruncation", 2.5);
+        return makeRegistered ("DyscoStMan", spec); }));
+  cases.push_back (std::make_shared<StManCase>
+    ("Adios2StMan", [](){
+        return makeRegistered ("Adios2StMan", Record()); }));
+  return cases;
+}
+
+// Define the benchmarks for a storage manager.
+void addBenchmarks (Benchmark& bench, std::shared_ptr<StManCase> smc)
+{
+  const String& type = smc->type();
+  // Check availability once, so skipping is cheap.
+  String reason;
+  Bool avail = smc->available (reason);
+  auto check = [avail, reason](BenchmarkState& state) {
+    if (! avail) {
+      state.skip (reason);
+    }
+    return avail;
+  };
+  bench.add ("write_row/" + type, [smc, check](BenchmarkState& state) {
+      if (check(state)) {
+        smc->create (True);
+        state.addBytes (smc->nrow() * smc->cellBytes());
+        state.addItems (smc->nrow());
+      }
+    });
+  bench.add ("write_column/" + type, [smc, check](BenchmarkState& state) {
+      if (check(state)) {
+        smc->create (False);
+        state.addBytes (smc->nrow() * smc->cellBytes());
+        state.addItems (smc->nrow());
+      }
+    });
+  bench.add ("read_row/" + type, [smc, check](BenchmarkState& state) {
+      if (check(state)) {
+        Table tab = smc->openRead (state);
+        ArrayColumn<Complex> col(tab, "DATA");
+        Array<Complex> arr;
+        for (rownr_t row=0; row<tab.nrow(); ++row) {
+          col.get (row, arr, True);
+        }
+        state.addBytes (tab.nrow() * smc->cellBytes());
+        state.addItems (tab.nrow());
+      }
+    });
+  bench.add ("read_column/" + type, [smc, check](BenchmarkState& state) {
+      if (check(state)) {
+        Table tab = smc->openRead (state);
+        ArrayColumn<Complex> col(tab, "DATA");
+        Array<Complex> arr;
+        for (rownr_t st=0; st<tab.nrow(); st+=chunk) {
+          rownr_t n = std::min(rownr_t(chunk), tab.nrow()-st);
+          col.getColumnRange (Slicer(IPosition(1,st), IPosition(1,n)),
+                              arr, True);
+        }
+        state.addBytes (tab.nrow() * smc->cellBytes());
+        state.addItems (tab.nrow());
+      }
+    });
+  bench.add ("read_slice/" + type, [smc, check](BenchmarkState& state) {
+      if (check(state)) {
+        // Read the first polarization of the first quarter of the channels.
+        Table tab = smc->openRead (state);
+        ArrayColumn<Complex> col(tab, "DATA");
+        Slicer section(IPosition(2,0,0), IPosition(2,1,std::max(1u,nchan/4)));
+        Array<Complex> arr;
+        for (rownr_t st=0; st<tab.nrow(); st+=chunk) {
+          rownr_t n = std::min(rownr_t(chunk), tab.nrow()-st);
+          col.getColumnRange (Slicer(IPosition(1,st), IPosition(1,n)),
+                              section, arr, True);
+        }
+        state.addBytes (tab.nrow() * section.length().product() *
+                        sizeof(Complex));
+        state.addItems (tab.nrow());
+      }
+    });
+  bench.add ("read_random/" + type, [smc, check](BenchmarkState& state) {
+      if (check(state)) {
+        // Read a quarter of the rows in random order.
+        state.pauseTiming();
+        std::vector<rownr_t> rows(smc->nrow());
+        for (rownr_t i=0; i<rows.size(); ++i) {
+          rows[i] = i;
+        }
+        std::mt19937 gen(state.iterations());
+        std::shuffle (rows.begin(), rows.end(), gen);
+        rows.resize (std::max(size_t(1), rows.size()/4));
+        state.resumeTiming();
+        Table tab = smc->openRead (state);
+        ArrayColumn<Complex> col(tab, "DATA");
+        Array<Complex> arr;
+        for (rownr_t row : rows) {
+          col.get (row, arr, True);
+        }
+        state.addBytes (rows.size() * smc->cellBytes());
+        state.addItems (rows.size());
+      }
+    });
+}
+
+int main (int argc, const char* argv[])
+{
+  std::vector<std::shared_ptr<StManCase>> cases;
+  try {
+    Benchmark bench(argc, argv);
+    const std::vector<String>& args = bench.arguments();
+    if (args.size() > 0) {
+      ntime = std::max(1, atoi(args[0].chars()));
+    }
+    if (args.size() > 1) {
+      nchan = std::max(1, atoi(args[1].chars()));
+    }
+    cout << "bStManPerf: nrow=" << StManCase::nrow() << " (ntime=" << ntime
+         << " nbaseline=" << nbl << ")  cell shape=[" << npol << ','
+         << nchan << "] Complex" << endl;
+    cases = makeCases();
+    for (auto& smc : cases) {
+      addBenchmarks (bench, smc);
+    }
+    int status = bench.run();
+    for (auto& smc : cases) {
+      smc->remove();
+    }
+    return status;
+  } catch (const std::exception& x) {
+    cerr << "Exception: " << x.what() << endl;
+    return 1;
+  }
+}
@@ -99,6 +99,13 @@ private:
     float y_p;
 };
 
+// RetypedArrayEx1 only contains its 2 floats, so the engine can map it
+// without copying.
+namespace casacore {
+template<> struct RetypedArraySameLayout<RetypedArrayEx1,float>
+  : public std::true_type {};
+}
+
 
 class RetypedArrayEx2
 {
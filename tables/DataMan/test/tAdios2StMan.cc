@@ -92,7 +92,8 @@ void VerifyScalarColumn(Table &table, std::string column, uInt rows)
     }
 }
 
-void doWriteDefault(std::string filename, uInt rows, IPosition array_pos)
+void doWriteDefault(std::string filename, uInt rows, IPosition array_pos,
+                    uInt64 bufferSize=0)
 {
     TableDesc td("", "1", TableDesc::Scratch);
     td.addColumn (ScalarColumnDesc<Bool>("scalar_Bool"));
@@ -122,10 +123,12 @@ void doWriteDefault(std::string filename, uInt rows, IPosition array_pos)
     SetupNewTable newtab(filename, td, Table::New);
 #ifdef HAVE_MPI
     Adios2StMan stman(MPI_COMM_WORLD);
+    stman.setBufferedWrites(bufferSize);
     newtab.bindAll(stman);
     Table tab(MPI_COMM_WORLD, newtab, rows);
 #else
     Adios2StMan stman;
+    stman.setBufferedWrites(bufferSize);
     newtab.bindAll(stman);
     Table tab(newtab, rows);
 #endif // HAVE_MPI
@@ -295,6 +298,11 @@ int main(int argc, char **argv){
     doCopyTable("default.table", "duplicated.table", "array_Complex");
     doReadCopiedTable("duplicated.table", "array_Complex", rows, array_pos);
 
+    // Buffered writes; the small buffer makes the puts being done in batches.
+    doWriteDefault("buffered.table", rows, array_pos, 4096);
+    doReadScalar("buffered.table", rows);
+    doReadArray("buffered.table", rows, array_pos);
+
 #ifdef HAVE_MPI
     MPI_Finalize();
 #endif
@@ -263,6 +263,51 @@ void readTable()
   }
 }
 
+// Test getting columns in multiple chunks of rows.
+void testLarge()
+{
+  TableDesc td("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Bool> ("virtual", "", IPosition(2,64,32),
+                                       ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Int> ("stored", "", IPosition(2,64,32),
+                                      ColumnDesc::FixedShape));
+  SetupNewTable newtab("tBitFlagsEngine_tmp.large", td, Table::Scratch);
+  BitFlagsEngine<Int> engine("virtual", "stored", 6, 1);
+  newtab.bindColumn ("virtual", engine);
+  const uInt nrow = 200;
+  Table tab(newtab, nrow);
+  ArrayColumn<Int> storedcol (tab, "stored");
+  ArrayColumn<Bool> virtualcol (tab, "virtual");
+  Cube<Int> flags(64, 32, nrow);
+  indgen (flags);
+  storedcol.putColumn (flags);
+  Cube<Bool> expect(64, 32, nrow);
+  for (size_t i=0; i<flags.nelements(); ++i) {
+    expect.data()[i] = (flags.data()[i] & 6) != 0;
+  }
+  AlwaysAssertExit (allEQ (virtualcol.getColumn(), expect));
+  Slicer rows(IPosition(1,3), IPosition(1,150));
+  AlwaysAssertExit (allEQ (virtualcol.getColumnRange(rows),
+                           expect(IPosition(3,0,0,3),
+                                  IPosition(3,63,31,152))));
+  Vector<rownr_t> rownrs(100);
+  for (uInt i=0; i<rownrs.size(); ++i) {
+    rownrs[i] = (i*7) % nrow;
+  }
+  Cube<Bool> cells = virtualcol.getColumnCells (RefRows(rownrs));
+  Slicer section(IPosition(2,1,2), IPosition(2,60,20), Slicer::endIsLength);
+  Cube<Bool> cellsSect = virtualcol.getColumnCells (RefRows(rownrs), section);
+  for (uInt i=0; i<rownrs.size(); ++i) {
+    AlwaysAssertExit (allEQ (cells.xyPlane(i), expect.xyPlane(rownrs[i])));
+    AlwaysAssertExit (allEQ (cellsSect.xyPlane(i),
+                             expect.xyPlane(rownrs[i])(IPosition(2,1,2),
+                                                       IPosition(2,60,21))));
+  }
+  Cube<Bool> sect = virtualcol.getColumn (section);
+  AlwaysAssertExit (allEQ (sect, expect(IPosition(3,1,2,0),
+                                        IPosition(3,60,21,nrow-1))));
+}
+
 
 int main ()
 {
@@ -270,6 +315,7 @@ int main ()
   try {
     createTable();
     readTable();
+    testLarge();
   } catch (std::exception& x) {
     cout << "Caught an exception: " << x.what() << endl;
     return 1;
@@ -0,0 +1,249 @@
+//# tConcurrentRead.cc: Test program for reading a table from multiple threads
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/DataManager.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for reading a read-only table from multiple threads
+// when DataManager::concurrentRead is set. It reads columns stored with
+// the StandardStMan, IncrementalStMan and TiledStMan.
+// </summary>
+
+const uInt nrow = 1000;
+const uInt nthread = 4;
+
+// The expected values of a row.
+Int    ssmInt (uInt i)       { return 3*i + 1; }
+Double ssmDouble (uInt i)    { return i / 3.; }
+Bool   ssmBool (uInt i)      { return i%3 == 0; }
+String ssmString (uInt i)    { return "str" + String::toString(i); }
+String ssmFixString (uInt i) { return String::toString(i%100); }
+Int    ismInt (uInt i)       { return i/7; }
+String ismString (uInt i)    { return "ism" + String::toString(i/11); }
+
+Array<Float> ssmArray (uInt i)
+{
+  Array<Float> arr(IPosition(1,4));
+  indgen (arr, Float(i));
+  return arr;
+}
+
+Array<Int> ssmVarArray (uInt i)
+{
+  Array<Int> arr(IPosition(1, 1 + i%5));
+  indgen (arr, Int(i));
+  return arr;
+}
+
+// Alternate the shape, so the TiledShapeStMan has many row intervals.
+Array<Float> tsmArray (uInt i)
+{
+  Array<Float> arr(IPosition(2, 4, (i%2 == 0 ? 6 : 5)));
+  indgen (arr, Float(10*i));
+  return arr;
+}
+
+Array<Complex> tcolArray (uInt i)
+{
+  Array<Complex> arr(IPosition(2,3,8));
+  indgen (arr, Complex(i, -Float(i)));
+  return arr;
+}
+
+void makeTable (const String& name)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>    ("ssmint"));
+  td.addColumn (ScalarColumnDesc<Double> ("ssmdbl"));
+  td.addColumn (ScalarColumnDesc<Bool>   ("ssmbool"));
+  td.addColumn (ScalarColumnDesc<String> ("ssmstr"));
+  ScalarColumnDesc<String> fixStr ("ssmfstr");
+  fixStr.setMaxLength (4);
+  td.addColumn (fixStr);
+  td.addColumn (ArrayColumnDesc<Float>   ("ssmarr", IPosition(1,4),
+                                          ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Int>     ("ssmvarr"));
+  td.addColumn (ScalarColumnDesc<Int>    ("ismint"));
+  td.addColumn (ScalarColumnDesc<String> ("ismstr"));
+  td.addColumn (ArrayColumnDesc<Float>   ("tsm", 2));
+  td.addColumn (ArrayColumnDesc<Complex> ("tcol", IPosition(2,3,8),
+                                          ColumnDesc::FixedShape));
+  td.defineHypercolumn ("TSMShape", 3, Vector<String>(1, "tsm"));
+  td.defineHypercolumn ("TSMColumn", 3, Vector<String>(1, "tcol"));
+  SetupNewTable newtab(name, td, Table::New);
+  StandardStMan ssm("SSM", 1024);
+  IncrementalStMan ism("ISM", 1024);
+  TiledShapeStMan tsm("TSMShape", IPosition(3,4,6,16));
+  TiledColumnStMan tcol("TSMColumn", IPosition(3,3,8,32));
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("ismint", ism);
+  newtab.bindColumn ("ismstr", ism);
+  newtab.bindColumn ("tsm", tsm);
+  newtab.bindColumn ("tcol", tcol);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int>    c1(tab, "ssmint");
+  ScalarColumn<Double> c2(tab, "ssmdbl");
+  ScalarColumn<Bool>   c3(tab, "ssmbool");
+  ScalarColumn<String> c4(tab, "ssmstr");
+  ScalarColumn<String> c5(tab, "ssmfstr");
+  ArrayColumn<Float>   c6(tab, "ssmarr");
+  ArrayColumn<Int>     c7(tab, "ssmvarr");
+  ScalarColumn<Int>    c8(tab, "ismint");
+  ScalarColumn<String> c9(tab, "ismstr");
+  ArrayColumn<Float>   c10(tab, "tsm");
+  ArrayColumn<Complex> c11(tab, "tcol");
+  for (uInt i=0; i<nrow; ++i) {
+    c1.put (i, ssmInt(i));
+    c2.put (i, ssmDouble(i));
+    c3.put (i, ssmBool(i));
+    c4.put (i, ssmString(i));
+    c5.put (i, ssmFixString(i));
+    c6.put (i, ssmArray(i));
+    c7.put (i, ssmVarArray(i));
+    c8.put (i, ismInt(i));
+    c9.put (i, ismString(i));
+    c10.put (i, tsmArray(i));
+    c11.put (i, tcolArray(i));
+  }
+}
+
+// The column objects are created before the threads start.
+struct Columns
+{
+  explicit Columns (const Table& tab)
+    : c1(tab, "ssmint"), c2(tab, "ssmdbl"), c3(tab, "ssmbool"),
+      c4(tab, "ssmstr"), c5(tab, "ssmfstr"), c6(tab, "ssmarr"),
+      c7(tab, "ssmvarr"), c8(tab, "ismint"), c9(tab, "ismstr"),
+      c10(tab, "tsm"), c11(tab, "tcol")
+  {}
+  ScalarColumn<Int>    c1;
+  ScalarColumn<Double> c2;
+  ScalarColumn<Bool>   c3;
+  ScalarColumn<String> c4;
+  ScalarColumn<String> c5;
+  ArrayColumn<Float>   c6;
+  ArrayColumn<Int>     c7;
+  ScalarColumn<Int>    c8;
+  ScalarColumn<String> c9;
+  ArrayColumn<Float>   c10;
+  ArrayColumn<Complex> c11;
+};
+
+// Read all rows, starting at a different row in each thread.
+// The number of wrong values is added to nerr.
+void readRows (Columns& cols, uInt thread, std::atomic<uInt>& nerr)
+{
+  uInt n = 0;
+  for (uInt j=0; j<nrow; ++j) {
+    uInt i = (j + thread*nrow/nthread) % nrow;
+    if (cols.c1(i) != ssmInt(i))        n++;
+    if (cols.c2(i) != ssmDouble(i))     n++;
+    if (cols.c3(i) != ssmBool(i))       n++;
+    if (cols.c4(i) != ssmString(i))     n++;
+    if (cols.c5(i) != ssmFixString(i))  n++;
+    if (! allEQ (cols.c6(i), ssmArray(i)))     n++;
+    if (! allEQ (cols.c7(i), ssmVarArray(i)))  n++;
+    if (cols.c8(i) != ismInt(i))        n++;
+    if (cols.c9(i) != ismString(i))     n++;
+    if (! allEQ (cols.c10(i), tsmArray(i)))    n++;
+    if (! allEQ (cols.c11(i), tcolArray(i)))   n++;
+  }
+  // Also read the scalar columns as a whole.
+  Vector<Int> ints = cols.c8.getColumn();
+  Vector<Double> dbls = cols.c2.getColumn();
+  for (uInt i=0; i<nrow; ++i) {
+    if (ints(i) != ismInt(i))     n++;
+    if (dbls(i) != ssmDouble(i))  n++;
+  }
+  nerr += n;
+}
+
+void testConcurrent (const String& name)
+{
+  Table tab(name, TableLock(TableLock::NoLocking));
+  Columns cols(tab);
+  std::atomic<uInt> nerr(0);
+  std::vector<std::thread> threads;
+  for (uInt i=0; i<nthread; ++i) {
+    threads.push_back (std::thread(readRows, std::ref(cols), i,
+                                   std::ref(nerr)));
+  }
+  for (std::thread& thr : threads) {
+    thr.join();
+  }
+  cout << "Read " << nrow << " rows in " << nthread << " threads: "
+       << nerr << " errors" << endl;
+  AlwaysAssertExit (nerr == 0);
+}
+
+int main()
+{
+  try {
+    makeTable ("tConcurrentRead_tmp.tab");
+    DataManager::setConcurrentRead (True);
+    testConcurrent ("tConcurrentRead_tmp.tab");
+    // Reading serially gives the same result.
+    DataManager::setConcurrentRead (False);
+    {
+      Table tab("tConcurrentRead_tmp.tab");
+      Columns cols(tab);
+      std::atomic<uInt> nerr(0);
+      readRows (cols, 0, nerr);
+      AlwaysAssertExit (nerr == 0);
+    }
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  } catch (...) {
+    cout << "Unexpected unknown exception" << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,211 @@
+//# tLosslessCompressEngine.cc: Test program for class LosslessCompressEngine
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/DataMan/LosslessCompressEngine.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <fstream>
+#include <stdlib.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary> Test program for class LosslessCompressEngine </summary>
+
+const uInt nrow = 400;
+const IPosition flagShape(2, 4, 256);
+
+Bool makeFlag (uInt row, uInt pol, uInt chan)
+{
+  return (chan+row) % 97 == 0  ||  (pol == 3  &&  row % 10 == 1);
+}
+
+Double makeWeight (uInt row, uInt chan)
+{
+  return 1. + (row%7) * 0.25 + chan*1e-3;
+}
+
+void createTable()
+{
+  TableDesc td("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Bool> ("FLAG", flagShape,
+                                       ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<uChar> ("FLAG_LC"));
+  td.addColumn (ArrayColumnDesc<Double> ("WEIGHT"));
+  td.addColumn (ArrayColumnDesc<uChar> ("WEIGHT_LC"));
+  td.addColumn (ArrayColumnDesc<Complex> ("DATA"));
+  td.addColumn (ArrayColumnDesc<uChar> ("DATA_LC"));
+  SetupNewTable newtab("tLosslessCompressEngine_tmp.data", td, Table::New);
+  StandardStMan ssm;
+  newtab.bindAll (ssm);
+  LosslessCompressEngine<Bool> engine1("FLAG", "FLAG_LC");
+  LosslessCompressEngine<Double> engine2("WEIGHT", "WEIGHT_LC");
+  LosslessCompressEngine<Complex> engine3("DATA", "DATA_LC", False);
+  newtab.bindColumn ("FLAG", engine1);
+  newtab.bindColumn ("WEIGHT", engine2);
+  newtab.bindColumn ("DATA", engine3);
+  Table tab(newtab, nrow);
+  ArrayColumn<Bool> flagCol(tab, "FLAG");
+  ArrayColumn<Double> weightCol(tab, "WEIGHT");
+  ArrayColumn<Complex> dataCol(tab, "DATA");
+  // Put the flags as an entire column.
+  Cube<Bool> flags(flagShape[0], flagShape[1], nrow);
+  for (uInt r=0; r<nrow; ++r) {
+    for (uInt c=0; c<flagShape[1]; ++c) {
+      for (uInt p=0; p<flagShape[0]; ++p) {
+        flags(p,c,r) = makeFlag(r,p,c);
+      }
+    }
+  }
+  flagCol.putColumn (flags);
+  // Put the variable shaped weights row by row.
+  for (uInt r=0; r<nrow; ++r) {
+    Vector<Double> weight(10 + r%5);
+    for (uInt c=0; c<weight.size(); ++c) {
+      weight[c] = makeWeight (r, c);
+    }
+    weightCol.put (r, weight);
+  }
+  // Put data in some rows only.
+  for (uInt r=0; r<nrow; r+=2) {
+    Matrix<Complex> data(2, 3);
+    indgen (data, Complex(r, -Float(r)));
+    dataCol.put (r, data);
+  }
+}
+
+void checkTable()
+{
+  Table tab("tLosslessCompressEngine_tmp.data");
+  ArrayColumn<Bool> flagCol(tab, "FLAG");
+  ArrayColumn<Double> weightCol(tab, "WEIGHT");
+  ArrayColumn<Complex> dataCol(tab, "DATA");
+  ArrayColumn<uChar> storedFlag(tab, "FLAG_LC");
+  // Get the flags as a column and per row.
+  Cube<Bool> flags = flagCol.getColumn();
+  AlwaysAssertExit (flags.shape() == IPosition(3, 4, 256, nrow));
+  uInt nstored = 0;
+  for (uInt r=0; r<nrow; ++r) {
+    Matrix<Bool> rowFlags = flagCol(r);
+    for (uInt c=0; c<flagShape[1]; ++c) {
+      for (uInt p=0; p<flagShape[0]; ++p) {
+        AlwaysAssertExit (flags(p,c,r) == makeFlag(r,p,c));
+        AlwaysAssertExit (rowFlags(p,c) == makeFlag(r,p,c));
+      }
+    }
+    nstored += storedFlag.shape(r).product();
+  }
+  // The flags must compress well.
+  cout << "flag compression factor > 20: "
+       << (nrow * flagShape.product() > 20 * nstored) << endl;
+  // Get some cells and a slice.
+  Vector<rownr_t> rows(3);
+  rows[0] = 5; rows[1] = 17; rows[2] = 300;
+  Cube<Bool> cells = flagCol.getColumnCells (RefRows(rows));
+  for (uInt i=0; i<rows.size(); ++i) {
+    AlwaysAssertExit (allEQ (cells.xyPlane(i), flagCol(rows[i])));
+  }
+  Slicer slicer(IPosition(2,3,10), IPosition(2,1,20));
+  Cube<Bool> slices = flagCol.getColumn (slicer);
+  for (uInt r=0; r<nrow; ++r) {
+    for (uInt c=0; c<20; ++c) {
+      AlwaysAssertExit (slices(0,c,r) == makeFlag(r,3,c+10));
+    }
+  }
+  // Check the variable shaped weights.
+  for (uInt r=0; r<nrow; ++r) {
+    AlwaysAssertExit (weightCol.shape(r) == IPosition(1, 10 + r%5));
+    Vector<Double> weight = weightCol(r);
+    for (uInt c=0; c<weight.size(); ++c) {
+      AlwaysAssertExit (weight[c] == makeWeight (r, c));
+    }
+  }
+  // Rows without data are undefined.
+  for (uInt r=0; r<nrow; ++r) {
+    AlwaysAssertExit (dataCol.isDefined(r) == (r%2 == 0));
+    if (r%2 == 0) {
+      Matrix<Complex> exp(2, 3);
+      indgen (exp, Complex(r, -Float(r)));
+      AlwaysAssertExit (allEQ (dataCol(r), exp));
+    }
+  }
+}
+
+void updateTable()
+{
+  Table tab("tLosslessCompressEngine_tmp.data", Table::Update);
+  ArrayColumn<Bool> flagCol(tab, "FLAG");
+  ArrayColumn<Double> weightCol(tab, "WEIGHT");
+  // Put a slice, which rewrites the entire cell.
+  Matrix<Bool> slice(1, 5, True);
+  flagCol.putSlice (7, Slicer(IPosition(2,0,100), IPosition(2,1,5)), slice);
+  Matrix<Bool> flags = flagCol(7);
+  for (uInt c=0; c<flagShape[1]; ++c) {
+    for (uInt p=0; p<flagShape[0]; ++p) {
+      Bool exp = makeFlag(7,p,c)  ||  (p == 0  &&  c >= 100  &&  c < 105);
+      AlwaysAssertExit (flags(p,c) == exp);
+    }
+  }
+  // Change the shape of a weight array.
+  Vector<Double> weight(3, 2.5);
+  weightCol.put (1, weight);
+  AlwaysAssertExit (weightCol.shape(1) == IPosition(1,3));
+  AlwaysAssertExit (allEQ (weightCol(1), 2.5));
+  // Add a row; the fixed shape flags are zero.
+  tab.addRow();
+  AlwaysAssertExit (flagCol.shape(nrow) == flagShape);
+  AlwaysAssertExit (allEQ (flagCol(nrow), False));
+}
+
+int main()
+{
+  try {
+    // Force multi-threaded decoding where possible.
+    {
+      std::ofstream rc("tLosslessCompressEngine_tmp.rc");
+      rc << "table.compress.nthreads: 4" << endl;
+    }
+    setenv ("CASARCFILES", "tLosslessCompressEngine_tmp.rc", 1);
+    createTable();
+    checkTable();
+    updateTable();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -98,6 +98,9 @@ void restoreData(const Table aTable);
 // put/putColumn cache test
 void putColumnTest();
 
+// Test fixed shape arrays stored in the arena.
+void arenaTest();
+
 
 int main ()
 {
@@ -136,7 +139,7 @@ int main ()
 	  aNewNrRows(i) = i;
 	}
 	deleteRows      (aNewNrRows);
-
+	arenaTest();
 
     } catch (std::exception& x) {
 	cout << "Caught an exception: " << x.what() << endl;
@@ -718,3 +721,52 @@ void putColumnTest()
 
 
 
+
+void arenaTest()
+{
+  TableDesc td("", "1", TableDesc::Scratch);
+  td.addColumn(ArrayColumnDesc<Float>("arrf", IPosition(2,3,2),
+                                      ColumnDesc::Direct));
+  td.addColumn(ArrayColumnDesc<String>("arrs", IPosition(1,2),
+                                       ColumnDesc::Direct));
+  SetupNewTable aNewTab("tMemoryStMan_tmp.arena", td, Table::Scratch);
+  MemoryStMan aSm1 ("MSM");
+  aNewTab.bindAll (aSm1);
+  Table aTable (aNewTab, 3);
+  ArrayColumn<Float> af(aTable, "arrf");
+  ArrayColumn<String> as(aTable, "arrs");
+  // Add rows one by one, so several arenas are used.
+  for (uInt i=0; i<50; ++i) {
+    aTable.addRow();
+  }
+  uInt nrow = aTable.nrow();
+  Cube<Float> cf(3,2,nrow);
+  indgen (cf);
+  Matrix<String> ms(2,nrow);
+  for (uInt i=0; i<nrow; ++i) {
+    ms(0,i) = String::toString(i);
+    ms(1,i) = "s" + String::toString(i);
+  }
+  af.putColumn (cf);
+  as.putColumn (ms);
+  AlwaysAssertExit (allEQ (af.getColumn(), cf));
+  AlwaysAssertExit (allEQ (as.getColumn(), ms));
+  for (uInt i=0; i<nrow; ++i) {
+    AlwaysAssertExit (allEQ (af(i), cf.xyPlane(i)));
+    AlwaysAssertExit (as(i)(IPosition(1,1)) == ms(1,i));
+  }
+  // Remove some rows, so the arrays are not adjacent anymore.
+  aTable.removeRow (40);
+  aTable.removeRow (2);
+  Cube<Float> cf2 = af.getColumn();
+  Matrix<String> ms2 = as.getColumn();
+  AlwaysAssertExit (cf2.shape()[2] == Int(nrow-2));
+  for (uInt i=0; i<nrow-2; ++i) {
+    uInt j = (i<2 ? i : (i<39 ? i+1 : i+2));
+    AlwaysAssertExit (allEQ (cf2.xyPlane(i), cf.xyPlane(j)));
+    AlwaysAssertExit (ms2(1,i) == ms(1,j));
+  }
+  cf2 += Float(1);
+  af.putColumn (cf2);
+  AlwaysAssertExit (allEQ (af.getColumn(), cf2));
+}
@@ -0,0 +1,229 @@
+//# tSSMColumnCells.cc: Test program for accessing StandardStMan column cells
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for getting and putting the cells of some rows in
+// StandardStMan columns.
+// </summary>
+
+// The values of some rows are accessed directly in the buckets (combining
+// consecutive rows). They must be the same as those accessed per row.
+
+const rownr_t nrrow = 1000;
+const IPosition cellShape(2,3,5);
+
+Matrix<Float> makeArr (rownr_t row)
+{
+  Matrix<Float> arr(cellShape);
+  indgen (arr, Float(row));
+  return arr;
+}
+
+Matrix<Bool> makeFlags (rownr_t row)
+{
+  Matrix<Bool> arr(cellShape);
+  for (uInt i=0; i<arr.size(); ++i) {
+    arr.data()[i] = (row + i) % 3 == 0;
+  }
+  return arr;
+}
+
+void createTable (const String& name, Bool bigEndian)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ScalarColumnDesc<Double>("cd"));
+  td.addColumn (ScalarColumnDesc<Bool>("cb"));
+  td.addColumn (ScalarColumnDesc<String>("cstr"));
+  td.addColumn (ArrayColumnDesc<Float>("af", cellShape, ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Bool>("ab", cellShape, ColumnDesc::FixedShape));
+  SetupNewTable newtab(name, td, Table::New);
+  // Use small buckets to have many of them.
+  StandardStMan ssm (512);
+  newtab.bindAll (ssm);
+  Table tab(newtab, nrrow, False,
+            bigEndian ? Table::BigEndian : Table::LittleEndian);
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<Double> cd(tab, "cd");
+  ScalarColumn<Bool> cb(tab, "cb");
+  ScalarColumn<String> cstr(tab, "cstr");
+  ArrayColumn<Float> af(tab, "af");
+  ArrayColumn<Bool> ab(tab, "ab");
+  for (rownr_t i=0; i<nrrow; ++i) {
+    ci.put (i, i);
+    cd.put (i, i*0.5);
+    cb.put (i, i%3 == 1);
+    cstr.put (i, String::toString(i));
+    af.put (i, makeArr(i));
+    ab.put (i, makeFlags(i));
+  }
+}
+
+// Check the values of the given rows (in order) against the expected values.
+void checkRows (const Table& tab, const RefRows& rows,
+                const Vector<rownr_t>& exp)
+{
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<Double> cd(tab, "cd");
+  ScalarColumn<Bool> cb(tab, "cb");
+  ScalarColumn<String> cstr(tab, "cstr");
+  ArrayColumn<Float> af(tab, "af");
+  ArrayColumn<Bool> ab(tab, "ab");
+  Vector<Int> vi = ci.getColumnCells (rows);
+  Vector<Double> vd = cd.getColumnCells (rows);
+  Vector<Bool> vb = cb.getColumnCells (rows);
+  Vector<String> vs = cstr.getColumnCells (rows);
+  Cube<Float> cf = af.getColumnCells (rows);
+  Cube<Bool> cbo = ab.getColumnCells (rows);
+  AlwaysAssertExit (vi.size() == exp.size());
+  AlwaysAssertExit (cf.shape() == IPosition(3,3,5,exp.size()));
+  for (uInt i=0; i<exp.size(); ++i) {
+    rownr_t row = exp[i];
+    AlwaysAssertExit (vi[i] == Int(ci(row)));
+    AlwaysAssertExit (vd[i] == cd(row));
+    AlwaysAssertExit (vb[i] == cb(row));
+    AlwaysAssertExit (vs[i] == cstr(row));
+    AlwaysAssertExit (allEQ (cf.xyPlane(i), af(row)));
+    AlwaysAssertExit (allEQ (cbo.xyPlane(i), ab(row)));
+  }
+}
+
+void checkTable (const String& name, Bool update)
+{
+  Table tab(name, update ? Table::Update : Table::Old);
+  // All rows as a slice.
+  Vector<rownr_t> all(nrrow);
+  indgen (all);
+  checkRows (tab, RefRows(0, nrrow-1), all);
+  // Strided slices.
+  Vector<rownr_t> strided(nrrow/7 + 1);
+  indgen (strided, rownr_t(0), rownr_t(7));
+  checkRows (tab, RefRows(0, nrrow-1, 7), strided);
+  // Unsorted individual rows with runs across buckets.
+  Vector<rownr_t> rows(300);
+  for (uInt i=0; i<rows.size(); ++i) {
+    rows[i] = (i < 200 ? 100+i : 999-i);
+  }
+  rows[50] = 3;
+  checkRows (tab, RefRows(rows), rows);
+  // Full columns via a selection.
+  Table sel = tab(tab.col("ci") % 4 != 0);
+  ScalarColumn<Int> selci(sel, "ci");
+  ArrayColumn<Bool> selab(sel, "ab");
+  Vector<Int> vi = selci.getColumn();
+  Cube<Bool> cb = selab.getColumn();
+  for (uInt i=0; i<sel.nrow(); ++i) {
+    rownr_t row = i + i/3 + 1;
+    AlwaysAssertExit (vi[i] == Int(row));
+    AlwaysAssertExit (allEQ (cb.xyPlane(i), makeFlags(row)));
+  }
+}
+
+void putCells (const String& name)
+{
+  Table tab(name, Table::Update);
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<Bool> cb(tab, "cb");
+  ArrayColumn<Float> af(tab, "af");
+  ArrayColumn<Bool> ab(tab, "ab");
+  // Read first to fill the column cache, which must be kept up to date.
+  AlwaysAssertExit (ci(10) == 10);
+  RefRows rows(5, 605, 3);
+  Vector<Int> vi(rows.nrow());
+  Vector<Bool> vb(rows.nrow());
+  Cube<Float> cf(3, 5, rows.nrow());
+  Cube<Bool> cbo(3, 5, rows.nrow());
+  for (uInt i=0; i<rows.nrow(); ++i) {
+    vi[i] = -Int(i);
+    vb[i] = i%2 == 0;
+    cf.xyPlane(i) = Float(i);
+    cbo.xyPlane(i) = (i%2 == 1);
+  }
+  ci.putColumnCells (rows, vi);
+  cb.putColumnCells (rows, vb);
+  af.putColumnCells (rows, cf);
+  ab.putColumnCells (rows, cbo);
+  for (rownr_t row=0; row<nrrow; ++row) {
+    if (row >= 5  &&  row <= 605  &&  (row-5) % 3 == 0) {
+      uInt i = (row - 5) / 3;
+      AlwaysAssertExit (ci(row) == -Int(i));
+      AlwaysAssertExit (cb(row) == (i%2 == 0));
+      AlwaysAssertExit (allEQ (af(row), Float(i)));
+      AlwaysAssertExit (allEQ (ab(row), (i%2 == 1)));
+    } else {
+      AlwaysAssertExit (ci(row) == Int(row));
+      AlwaysAssertExit (cb(row) == (row%3 == 1));
+      AlwaysAssertExit (allEQ (af(row), makeArr(row)));
+      AlwaysAssertExit (allEQ (ab(row), makeFlags(row)));
+    }
+  }
+  // Put an entire array column.
+  Cube<Float> all(3, 5, nrrow);
+  for (rownr_t row=0; row<nrrow; ++row) {
+    all.xyPlane(row) = makeArr(row);
+  }
+  af.putColumn (all);
+  AlwaysAssertExit (allEQ (af.getColumn(), all));
+}
+
+int main()
+{
+  try {
+    for (int i=0; i<2; ++i) {
+      Bool bigEndian = (i == 0);
+      String name = "tSSMColumnCells_tmp.data";
+      createTable (name, bigEndian);
+      // Read-only tables might be read from the memory-mapped file.
+      checkTable (name, False);
+      checkTable (name, True);
+      putCells (name);
+    }
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,159 @@
+//# tSSMMapped.cc: Test program for reading memory-mapped StandardStMan data
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/StandardStManAccessor.h>
+#include <casacore/casa/System/Aipsrc.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <fstream>
+#include <stdlib.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for reading StandardStMan data from the memory-mapped file.
+// </summary>
+
+// A read-only table is memory-mapped and the data that need no conversion
+// are read straight from the mapping. The data read must be the same as
+// those read via the bucket cache, for little and big endian tables.
+
+const rownr_t nrrow = 1000;
+
+void createTable (const String& name, Bool bigEndian)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ScalarColumnDesc<Short>("cs"));
+  td.addColumn (ScalarColumnDesc<Double>("cd"));
+  td.addColumn (ScalarColumnDesc<Complex>("cx"));
+  td.addColumn (ScalarColumnDesc<Bool>("cb"));
+  ScalarColumnDesc<String> fixstr("cfs");
+  fixstr.setMaxLength (8);
+  td.addColumn (fixstr);
+  td.addColumn (ScalarColumnDesc<String>("cstr"));
+  SetupNewTable newtab(name, td, Table::New);
+  // Use small buckets to have many of them.
+  StandardStMan ssm (512);
+  newtab.bindAll (ssm);
+  Table tab(newtab, nrrow, False,
+            bigEndian ? Table::BigEndian : Table::LittleEndian);
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<Short> cs(tab, "cs");
+  ScalarColumn<Double> cd(tab, "cd");
+  ScalarColumn<Complex> cx(tab, "cx");
+  ScalarColumn<Bool> cb(tab, "cb");
+  ScalarColumn<String> cfs(tab, "cfs");
+  ScalarColumn<String> cstr(tab, "cstr");
+  for (rownr_t i=0; i<nrrow; ++i) {
+    ci.put (i, i);
+    cs.put (i, i%100 - 50);
+    cd.put (i, i*0.5);
+    cx.put (i, Complex(i, -Float(i)));
+    cb.put (i, i%3==0);
+    cfs.put (i, String::toString(i%10000));
+    cstr.put (i, "str" + String::toString(i));
+  }
+}
+
+void checkTable (const String& name, Bool mapped)
+{
+  Table tab(name);
+  ROStandardStManAccessor acc(tab, "ci", True);
+  AlwaysAssertExit (acc.isMapped() == mapped);
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<Short> cs(tab, "cs");
+  ScalarColumn<Double> cd(tab, "cd");
+  ScalarColumn<Complex> cx(tab, "cx");
+  ScalarColumn<Bool> cb(tab, "cb");
+  ScalarColumn<String> cfs(tab, "cfs");
+  ScalarColumn<String> cstr(tab, "cstr");
+  // Read the entire columns.
+  Vector<Int> vi = ci.getColumn();
+  Vector<Short> vs = cs.getColumn();
+  Vector<Double> vd = cd.getColumn();
+  Vector<Complex> vx = cx.getColumn();
+  Vector<Bool> vb = cb.getColumn();
+  Vector<String> vfs = cfs.getColumn();
+  Vector<String> vstr = cstr.getColumn();
+  for (rownr_t i=0; i<nrrow; ++i) {
+    AlwaysAssertExit (vi[i] == Int(i));
+    AlwaysAssertExit (vs[i] == Short(i%100 - 50));
+    AlwaysAssertExit (vd[i] == i*0.5);
+    AlwaysAssertExit (vx[i] == Complex(i, -Float(i)));
+    AlwaysAssertExit (vb[i] == (i%3==0));
+    AlwaysAssertExit (vfs[i] == String::toString(i%10000));
+    AlwaysAssertExit (vstr[i] == "str" + String::toString(i));
+  }
+  // Read the values per row in reversed order.
+  for (Int64 i=nrrow-1; i>=0; --i) {
+    AlwaysAssertExit (ci(i) == Int(i));
+    AlwaysAssertExit (cs(i) == Short(i%100 - 50));
+    AlwaysAssertExit (cd(i) == i*0.5);
+    AlwaysAssertExit (cx(i) == Complex(i, -Float(i)));
+    AlwaysAssertExit (cb(i) == (i%3==0));
+  }
+}
+
+int main()
+{
+  try {
+    createTable ("tSSMMapped_tmp.le", False);
+    createTable ("tSSMMapped_tmp.be", True);
+    // Read using the memory-mapped file (the default).
+    checkTable ("tSSMMapped_tmp.le", True);
+    checkTable ("tSSMMapped_tmp.be", True);
+    // Read without memory-mapping.
+    {
+      std::ofstream rc("tSSMMapped_tmp.rc");
+      rc << "table.ssm.mmap: false" << endl;
+    }
+    setenv ("CASARCFILES", "tSSMMapped_tmp.rc", 1);
+    // The aipsrc files have been read already, so read them again.
+    Aipsrc::reRead();
+    checkTable ("tSSMMapped_tmp.le", False);
+    checkTable ("tSSMMapped_tmp.be", False);
+    // Reading an updatable table uses the cache.
+    Table tab("tSSMMapped_tmp.le", Table::Update);
+    AlwaysAssertExit (! ROStandardStManAccessor(tab, "ci", True).isMapped());
+    ScalarColumn<Int> ci(tab, "ci");
+    ci.put (10, -10);
+    AlwaysAssertExit (ci(10) == -10);
+    AlwaysAssertExit (ci.getColumn()[10] == -10);
+  } catch (std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  } 
+  cout << "OK" << endl;
+  return 0;                           // exit with success status
+}
@@ -0,0 +1,138 @@
+//# tTSMCacheBudget.cc: Test program for the process-wide tile cache budget
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/TiledStManAccessor.h>
+#include <casacore/tables/DataMan/TSMCacheBudget.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for class TSMCacheBudget.
+// </summary>
+
+// Each hypercube has 100 or 200 tiles of 16*16*4 floats (4 KiB).
+const uInt nrcube = 4;
+const uInt nrow = 400;
+const uInt tileBytes = 16*16*4*sizeof(Float);
+
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Float>("arr", 2));
+  SetupNewTable newtab("tTSMCacheBudget_tmp.tab", td, Table::New);
+  TiledShapeStMan tsm("TSM", IPosition(3,16,16,4));
+  newtab.bindAll (tsm);
+  Table tab(newtab, nrcube*nrow);
+  ArrayColumn<Float> arr(tab, "arr");
+  // Use a different shape for each hypercube.
+  for (uInt i=0; i<nrcube*nrow; ++i) {
+    Array<Float> val(IPosition(2, 16, 16+i/nrow));
+    indgen (val, Float(i));
+    arr.put (i, val);
+  }
+}
+
+// Read a few cells of the hypercube holding the given row.
+void readCube (ArrayColumn<Float>& arr, uInt cube)
+{
+  for (uInt i=0; i<3; ++i) {
+    uInt rownr = cube*nrow + 4*i;
+    Array<Float> val = arr.get (rownr);
+    AlwaysAssertExit (val.data()[0] == Float(rownr));
+  }
+}
+
+void doTest()
+{
+  Table tab("tTSMCacheBudget_tmp.tab");
+  ArrayColumn<Float> arr(tab, "arr");
+  ROTiledStManAccessor acc(tab, "TSM");
+  // 256 tiles fit in the budget.
+  TSMCacheBudget::setBudget (1);
+  AlwaysAssertExit (TSMCacheBudget::budget() == 1);
+  uInt64 budget = 1024*1024;
+  // The first hypercube can use most of the budget.
+  acc.setCacheSize (0, 200);
+  readCube (arr, 0);
+  readCube (arr, 0);
+  uInt nr0 = acc.cacheSize(0);
+  AlwaysAssertExit (nr0 == 200);
+  AlwaysAssertExit (TSMCacheBudget::usedBytes() <= budget);
+  // The second hypercube has not been used yet, so it is colder
+  // and only gets the remaining memory.
+  acc.setCacheSize (nrow, 200);
+  AlwaysAssertExit (acc.cacheSize(0) == nr0);
+  AlwaysAssertExit (acc.cacheSize(nrow) < 200);
+  AlwaysAssertExit (TSMCacheBudget::usedBytes() <= budget);
+  // After using it twice it is hotter, so it takes memory from the first.
+  readCube (arr, 1);
+  readCube (arr, 1);
+  acc.setCacheSize (nrow, 200);
+  AlwaysAssertExit (acc.cacheSize(nrow) == 200);
+  AlwaysAssertExit (acc.cacheSize(0) < nr0);
+  AlwaysAssertExit (TSMCacheBudget::usedBytes() <= budget);
+  AlwaysAssertExit (TSMCacheBudget::usedBytes() + tileBytes > budget);
+  // Lowering the budget shrinks the caches.
+  TSMCacheBudget::setBudget (0);
+  acc.setCacheSize (2*nrow, 100);
+  AlwaysAssertExit (acc.cacheSize(2*nrow) == 100);
+  AlwaysAssertExit (TSMCacheBudget::usedBytes() > budget);
+  TSMCacheBudget::setBudget (1);
+  AlwaysAssertExit (TSMCacheBudget::usedBytes() <= budget);
+  // The data can still be read.
+  for (uInt i=0; i<nrcube; ++i) {
+    readCube (arr, i);
+  }
+  AlwaysAssertExit (TSMCacheBudget::usedBytes() <= budget);
+  TSMCacheBudget::setBudget (0);
+}
+
+int main()
+{
+  try {
+    makeTable();
+    doTest();
+    // All caches are removed when the table is closed.
+    AlwaysAssertExit (TSMCacheBudget::usedBytes() == 0);
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  } catch (...) {
+    cout << "Unexpected unknown exception" << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
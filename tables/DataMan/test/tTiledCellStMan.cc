@@ -177,6 +177,21 @@ void readTable(const TSMOption& tsmOpt)
 	freqValues += float(200);
 	polValues += float(200);
     }
+    // Get a slice from multiple cells (each cell is a separate hypercube).
+    if (table.nrow() > 2) {
+        Array<float> slices = data.getColumnRange
+	  (Slicer(IPosition(1,1), IPosition(1,2)),
+	   Slicer(IPosition(2,2,3), IPosition(2,3,2)));
+	AlwaysAssertExit (slices.shape() == IPosition(3,3,2,2));
+	for (i=0; i<2; i++) {
+	    for (uInt y=0; y<2; y++) {
+	        for (uInt x=0; x<3; x++) {
+		    AlwaysAssertExit (slices(IPosition(3,x,y,i)) ==
+				      float(2+x + 16*(3+y) + 200*(i+1)));
+		}
+	    }
+	}
+    }
 }
 
 void writeVar(const TSMOption& tsmOpt)
@@ -39,6 +39,7 @@
 #include <casacore/casa/Arrays/ArrayUtil.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/iostream.h>
 
 #include <casacore/casa/namespace.h>
@@ -599,6 +600,40 @@ void writeFlags()
 }
 
 
+void writeManyShapes()
+{
+    // Write rows with many different shapes in a non-sequential order,
+    // so many row intervals are used (which are found using an index).
+    TableDesc td ("", "1", TableDesc::Scratch);
+    td.addColumn (ArrayColumnDesc<float> ("Data", 2));
+    td.defineHypercolumn ("TSMExample", 3, stringToVector ("Data"));
+    SetupNewTable newtab("tTiledShapeStMan_tmp.data", td, Table::New);
+    TiledShapeStMan sm1 ("TSMExample", IPosition(3,2,4,16));
+    newtab.bindAll (sm1);
+    const uInt nrow = 3000;
+    Table table(newtab, nrow);
+    ArrayColumn<float> data (table, "Data");
+    // Put the odd rows in reverse order after the even rows.
+    for (Int step=0; step<2; ++step) {
+        for (uInt j=0; j<nrow/2; ++j) {
+            uInt i = (step == 0  ?  2*j : nrow-1-2*j);
+            Matrix<float> arr(2, 1 + (i/3)%7);
+            arr = float(i);
+            data.put (i, arr);
+            // Check a row written before.
+            uInt r = (step == 0  ?  j/2*2 : i+2);
+            if (r < nrow) {
+                AlwaysAssertExit (data.shape(r)(1) == Int(1 + (r/3)%7));
+                AlwaysAssertExit (allEQ (data(r), float(r)));
+            }
+        }
+    }
+    for (uInt i=0; i<nrow; i+=(i%5==0 ? 7 : 3)) {
+        AlwaysAssertExit (data.shape(i)(1) == Int(1 + (i/3)%7));
+        AlwaysAssertExit (allEQ (data(i), float(i)));
+    }
+}
+
 int main () {
     try {
         writeFixed (TSMOption::MMap);
@@ -614,6 +649,7 @@ int main () {
 	readTable (IPosition(2,16,25), TSMOption::Default);
 
         writeFlags();
+        writeManyShapes();
 
     } catch (std::exception& x) {
 	cout << "Caught an exception: " << x.what() << endl;
@@ -0,0 +1,244 @@
+//# tTiledWriteBehind.cc: Test program for the write-behind buffer of the TiledStMan
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/tables/DataMan/TiledStManAccessor.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for the write-behind buffer used by the TiledStMan when
+// writing sequentially, and for not reading tiles being overwritten.
+// </summary>
+
+// A row has 2 tiles of 4*8*16 floats.
+const uInt nrow = 100;
+const IPosition cellShape(2,8,8);
+const IPosition tileShape(3,4,8,16);
+
+// Get the number of tiles read and written.
+void ioCounts (const Table& tab, Int64& nread, Int64& nwrite)
+{
+  nread = nwrite = 0;
+  Record dms = tab.ioStatistics().subRecord ("DATAMANAGERS");
+  for (uInt i=0; i<dms.nfields(); ++i) {
+    const Record& caches = dms.subRecord(i).subRecord ("CACHE");
+    for (uInt j=0; j<caches.nfields(); ++j) {
+      if (caches.dataType(j) == TpRecord) {
+        const Record& cache = caches.subRecord(j);
+        if (cache.isDefined ("NREAD")) {
+          nread  += cache.asInt64 ("NREAD");
+          nwrite += cache.asInt64 ("NWRITE");
+        }
+      }
+    }
+  }
+}
+
+Array<Float> cellValue (uInt rownr, Float offset)
+{
+  Array<Float> val(cellShape);
+  indgen (val, Float(rownr) + offset);
+  return val;
+}
+
+void checkValues (const Table& tab, const String& colName, Float offset)
+{
+  ArrayColumn<Float> arr(tab, colName);
+  for (uInt i=0; i<nrow; ++i) {
+    AlwaysAssertExit (allEQ (arr.get(i), cellValue(i, offset)));
+  }
+}
+
+// Create a table with two columns in the same hypercolumn, so a tile
+// contains the data of both columns.
+void makeTable (const String& name, uInt ncol)
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Float>("data", cellShape,
+                                       ColumnDesc::FixedShape));
+  Vector<String> dataNames(1, "data");
+  if (ncol > 1) {
+    td.addColumn (ArrayColumnDesc<Float>("model", cellShape,
+                                         ColumnDesc::FixedShape));
+    dataNames.resize (2, True);
+    dataNames(1) = "model";
+  }
+  td.defineHypercolumn ("TSM", 3, dataNames);
+  SetupNewTable newtab(name, td, Table::New);
+  TiledColumnStMan tsm("TSM", tileShape);
+  newtab.bindAll (tsm);
+  Table tab(newtab, nrow);
+}
+
+// Write the rows one by one with a cache of a single tile.
+void writeRows (Table& tab, const String& colName, Float offset,
+                Bool sequential)
+{
+  ROTiledStManAccessor acc(tab, "TSM");
+  acc.setSequentialWrite (sequential);
+  acc.setCacheSize (0, 1);
+  ArrayColumn<Float> arr(tab, colName);
+  for (uInt i=0; i<nrow; ++i) {
+    arr.put (i, cellValue(i, offset));
+  }
+  tab.flush();
+}
+
+void testNew (Bool sequential)
+{
+  makeTable ("tTiledWriteBehind_tmp.tab", 1);
+  Int64 nread, nwrite;
+  {
+    Table tab("tTiledWriteBehind_tmp.tab", Table::Update);
+    writeRows (tab, "data", 0, sequential);
+    ioCounts (tab, nread, nwrite);
+    if (sequential) {
+      // Each tile is written once and never read back.
+      AlwaysAssertExit (nread == 0);
+      AlwaysAssertExit (nwrite == 2*((nrow+15)/16));
+    }
+    checkValues (tab, "data", 0);
+  }
+  Table tab("tTiledWriteBehind_tmp.tab");
+  checkValues (tab, "data", 0);
+}
+
+void testUpdate()
+{
+  // Overwriting all rows of an existing table does not read the tiles.
+  Int64 nread, nwrite;
+  {
+    Table tab("tTiledWriteBehind_tmp.tab", Table::Update);
+    writeRows (tab, "data", 1000, True);
+    ioCounts (tab, nread, nwrite);
+    AlwaysAssertExit (nread == 0);
+    checkValues (tab, "data", 1000);
+  }
+  // Overwriting part of the rows keeps the other values.
+  {
+    Table tab("tTiledWriteBehind_tmp.tab", Table::Update);
+    ROTiledStManAccessor acc(tab, "TSM");
+    acc.setSequentialWrite (True);
+    acc.setCacheSize (0, 1);
+    ArrayColumn<Float> arr(tab, "data");
+    for (uInt i=10; i<20; ++i) {
+      arr.put (i, cellValue(i, 2000));
+    }
+    // Reading a row in a partially written tile gives the new values.
+    AlwaysAssertExit (allEQ (arr.get(12), cellValue(12, 2000)));
+    AlwaysAssertExit (allEQ (arr.get(5), cellValue(5, 1000)));
+    for (uInt i=30; i<35; ++i) {
+      arr.put (i, cellValue(i, 2000));
+    }
+    // Also a slice of a cell can be written.
+    Array<Float> part(IPosition(2,3,2), -1.f);
+    arr.putSlice (40, Slicer(IPosition(2,2,3), part.shape()), part);
+  }
+  Table tab("tTiledWriteBehind_tmp.tab");
+  ArrayColumn<Float> arr(tab, "data");
+  for (uInt i=0; i<nrow; ++i) {
+    Array<Float> expected = cellValue (i, ((i>=10 && i<20) || (i>=30 && i<35)
+                                           ?  2000 : 1000));
+    if (i == 40) {
+      expected(Slicer(IPosition(2,2,3), IPosition(2,3,2))) = -1.f;
+    }
+    AlwaysAssertExit (allEQ (arr.get(i), expected));
+  }
+}
+
+void testEntireTiles()
+{
+  // Without the hint, a put of entire tiles does not read them.
+  Table tab("tTiledWriteBehind_tmp.tab", Table::Update);
+  ArrayColumn<Float> arr(tab, "data");
+  Array<Float> val(IPosition(3,8,8,32));
+  indgen (val);
+  arr.putColumnRange (Slicer(IPosition(1,16), IPosition(1,32)), val);
+  tab.flush();
+  Int64 nread, nwrite;
+  ioCounts (tab, nread, nwrite);
+  AlwaysAssertExit (nread == 0);
+  AlwaysAssertExit (allEQ (arr.getColumnRange (Slicer(IPosition(1,16),
+                                                      IPosition(1,32))),
+                           val));
+}
+
+void testTwoColumns()
+{
+  // Tiles are complete when both columns are written.
+  makeTable ("tTiledWriteBehind_tmp.tab", 2);
+  {
+    Table tab("tTiledWriteBehind_tmp.tab", Table::Update);
+    ROTiledStManAccessor acc(tab, "TSM");
+    acc.setSequentialWrite (True);
+    acc.setCacheSize (0, 1);
+    ArrayColumn<Float> data(tab, "data");
+    ArrayColumn<Float> model(tab, "model");
+    for (uInt i=0; i<nrow; ++i) {
+      data.put (i, cellValue(i, 0));
+      model.put (i, cellValue(i, 500));
+    }
+    tab.flush();
+    Int64 nread, nwrite;
+    ioCounts (tab, nread, nwrite);
+    AlwaysAssertExit (nread == 0);
+    AlwaysAssertExit (nwrite == 2*((nrow+15)/16));
+  }
+  Table tab("tTiledWriteBehind_tmp.tab");
+  checkValues (tab, "data", 0);
+  checkValues (tab, "model", 500);
+}
+
+int main()
+{
+  try {
+    testNew (False);
+    testNew (True);
+    testUpdate();
+    testEntireTiles();
+    testTwoColumns();
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  } catch (...) {
+    cout << "Unexpected unknown exception" << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
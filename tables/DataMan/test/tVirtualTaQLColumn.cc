@@ -34,7 +34,9 @@
 #include <casacore/tables/DataMan/VirtualTaQLColumn.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/DataMan/StManAipsIO.h>
+#include <casacore/tables/DataMan/DataManAccessor.h>
 #include <casacore/tables/TaQL/TableParse.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/Cube.h>
@@ -59,6 +61,7 @@ TableDesc makeDesc();
 void a (const TableDesc&);
 void check(const Table& table, Bool showname);
 void testSelect();
+void testCache();
 void testPerf();
 
 int main ()
@@ -75,6 +78,7 @@ int main ()
 	check (tab2, True);
       }
       testSelect();
+      testCache();
       testPerf();
     } catch (std::exception& x) {
 	cout << "Caught an exception: " << x.what() << endl;
@@ -284,6 +288,23 @@ void check(const Table& tab, Bool showname)
 		 << acalc3vec(i) << endl;
 	}
     }
+    // Rows with a stride are evaluated one by one, others in batch.
+    Vector<Short> acalc3cells = acalc3.getColumnCells (RefRows(1, 9, 2));
+    for (i=0; i<5; i++) {
+	Int row = 2*i+1;
+	if (acalc3cells(i) != row*(row+1)) {
+	    cout << "error in acalc3 getColumnCells " << row << ": "
+		 << acalc3cells(i) << endl;
+	}
+    }
+    acalc3cells = acalc3.getColumnRange (Slicer(IPosition(1,2), IPosition(1,5)));
+    for (i=0; i<5; i++) {
+	Int row = i+2;
+	if (acalc3cells(i) != row*(row+1)) {
+	    cout << "error in acalc3 getColumnRange " << row << ": "
+		 << acalc3cells(i) << endl;
+	}
+    }
     Array<float> arr1a = arr1.getColumn();
     if (arr1a.ndim() != 4) {
 	cout << "arr1a not 4-dim" << endl;
@@ -358,6 +379,57 @@ void testSelect()
   check (subset, False);
 }
 
+// Test caching of the expression results.
+void testCache()
+{
+  {
+    TableDesc td;
+    td.addColumn (ScalarColumnDesc<Int>("a"));
+    td.addColumn (ScalarColumnDesc<Double>("vc"));
+    SetupNewTable newtab("tVirtualTaQLColumn_tmp.datacache", td, Table::New);
+    VirtualTaQLColumn vc("2.*a", "", True);
+    newtab.bindColumn ("vc", vc);
+    Table tab(newtab, 10);
+    ScalarColumn<Int> acol(tab, "a");
+    acol.putColumn (Vector<Int>({0,1,2,3,4,5,6,7,8,9}));
+  }
+  Table tab("tVirtualTaQLColumn_tmp.datacache", Table::Update);
+  ScalarColumn<Int> acol(tab, "a");
+  ScalarColumn<Double> vccol(tab, "vc");
+  RODataManAccessor acc(tab, "vc", True);
+  // The option is kept in the column keywords.
+  AlwaysAssertExit (acc.getProperties().asBool("CACHE"));
+  AlwaysAssertExit (vccol(3) == 6.);
+  // A put in this process invalidates the cache.
+  acol.put (3, 10);
+  AlwaysAssertExit (vccol(3) == 20.);
+  AlwaysAssertExit (vccol.getColumn()(3) == 20.);
+  acol.putColumn (Vector<Int>({9,8,7,6,5,4,3,2,1,0}));
+  AlwaysAssertExit (vccol.getColumn()(3) == 12.);
+  AlwaysAssertExit (vccol(0) == 18.);
+  acol.put (3, 10);
+  AlwaysAssertExit (vccol.getColumnCells(RefRows(2,3))(1) == 20.);
+  // Setting the property also clears the cache.
+  Record rec;
+  rec.define ("CACHE", True);
+  acc.setProperties (rec);
+  AlwaysAssertExit (vccol(3) == 20.);
+  // Adding a row clears the cache.
+  tab.addRow();
+  acol.put (10, 11);
+  AlwaysAssertExit (vccol(10) == 22.);
+  Vector<Double> vcvec = vccol.getColumn();
+  for (rownr_t i=0; i<tab.nrow(); ++i) {
+    AlwaysAssertExit (vcvec[i] == 2. * acol(i));
+  }
+  AlwaysAssertExit (vccol.getColumnRange(Slicer(IPosition(1,9), IPosition(1,2)))(1) == 22.);
+  // Without cache the values are evaluated every time.
+  rec.define ("CACHE", False);
+  acc.setProperties (rec);
+  acol.put (3, 4);
+  AlwaysAssertExit (vccol(3) == 8.);
+}
+
 // Test how getting a column performs.
 void testPerf()
 {
@@ -413,10 +413,10 @@ void AFTimeBlockEncoder::Decode(
     const dyscostman::StochasticEncoder<float> &gausEncoder, FBuffer &buffer,
     const AFTimeBlockEncoder::symbol_t *symbolBuffer, size_t blockRow,
     size_t antenna1, size_t antenna2) {
-  ao::uvector<double> antFactors(_nPol);
-  for (size_t p = 0; p != _nPol; ++p)
-    antFactors[p] = _rmsPerAntenna[antenna1 * _nPol + p] *
-                    _rmsPerAntenna[antenna2 * _nPol + p];
+  // No temporary buffer is allocated here, because rows are decoded
+  // concurrently by ThreadedDyscoColumn.
+  const double *rmsA1 = &_rmsPerAntenna[antenna1 * _nPol];
+  const double *rmsA2 = &_rmsPerAntenna[antenna2 * _nPol];
 
   FBufferRow &row = buffer[blockRow];
   row.antenna1 = antenna1;
@@ -427,7 +427,7 @@ void AFTimeBlockEncoder::Decode(
   for (size_t ch = 0; ch != _nChannels; ++ch) {
     for (size_t p = 0; p != _nPol; ++p) {
       double chRMS = _rmsPerChannel[ch * _nPol + p];
-      double factor = chRMS * antFactors[p];
+      double factor = chRMS * (rmsA1[p] * rmsA2[p]);
       destination->real(double(gausEncoder.Decode(*srcRowPtr)) * factor);
       ++srcRowPtr;
       destination->imag(double(gausEncoder.Decode(*srcRowPtr)) * factor);
@@ -10,6 +10,7 @@
 #include <casacore/tables/Tables/ScalarColumn.h>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 
 namespace dyscostman {
@@ -29,13 +30,19 @@ ThreadedDyscoColumn<DataType>::ThreadedDyscoColumn(DyscoStMan *parent,
       _isCurrentBlockChanged(false),
       _blockSize(0),
       _antennaCount(0),
-      _timeBlockBuffer() {}
+      _timeBlockBuffer(),
+      _isRowDecoded(),
+      _nRowsReadInBlock(0),
+      _readAheadBlock(std::numeric_limits<size_t>::max()),
+      _readAheadSucceeded(false),
+      _readAheadBuffer() {}
 
 // prepare the class for destruction when the derived class is destructed.
 // this is necessary because the virtual function of the derived class might get
 // called to empty the cache.
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::shutdown() {
+  waitForReadAhead();
   if (_isCurrentBlockChanged) storeBlock();
 
   stopThreads();
@@ -77,30 +84,174 @@ void ThreadedDyscoColumn<DataType>::setShapeColumn(
 
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::loadBlock(size_t blockIndex) {
+  waitForReadAhead();
+  _isRowDecoded.clear();
   if (blockIndex < nBlocksInFile()) {
-    readCompressedData(blockIndex, _packedBlockReadBuffer.data(), _blockSize);
-    const size_t nPolarizations = _shape[0], nChannels = _shape[1],
-                 nRows = nRowsInBlock(),
-                 nMetaFloats = metaDataFloatCount(nRows, nPolarizations,
-                                                  nChannels, _antennaCount);
-    unsigned char *symbolStart =
-        _packedBlockReadBuffer.data() + nMetaFloats * sizeof(float);
-    BytePacker::unpack(_bitsPerSymbol, _unpackedSymbolReadBuffer.data(),
-                       symbolStart,
-                       symbolCount(nRows, nPolarizations, nChannels));
-    float *metaData = reinterpret_cast<float *>(_packedBlockReadBuffer.data());
-    initializeDecode(_timeBlockBuffer.get(), metaData, nRows, _antennaCount);
-    uint64_t startRow = getRowIndex(blockIndex);
-    _timeBlockBuffer->resize(nRows);
-    for (size_t blockRow = 0; blockRow != nRows; ++blockRow) {
-      int a1 = (*_ant1Col)(startRow + blockRow),
-          a2 = (*_ant2Col)(startRow + blockRow);
-      decode(_timeBlockBuffer.get(), _unpackedSymbolReadBuffer.data(), blockRow,
-             a1, a2);
+    // The full block is only decoded if most rows of the previous block were
+    // read. Otherwise (e.g. when reading a few baselines or when jumping to
+    // another block) only the rows that are read get decoded.
+    const bool isFullDecode =
+        _currentBlock != std::numeric_limits<size_t>::max() &&
+        _nRowsReadInBlock * 2 >= nRowsInBlock();
+    if (blockIndex == _readAheadBlock && _readAheadSucceeded) {
+      std::swap(_timeBlockBuffer, _readAheadBuffer);
+    } else if (isFullDecode) {
+      readAntennas(blockIndex, _ant1Buffer, _ant2Buffer);
+      readAndDecodeBlock(blockIndex, *_timeBlockBuffer,
+                         _packedBlockReadBuffer.data(),
+                         _unpackedSymbolReadBuffer.data(), _ant1Buffer,
+                         _ant2Buffer);
+    } else {
+      readBlockForRowAccess(blockIndex);
+    }
+    _readAheadBlock = std::numeric_limits<size_t>::max();
+    // Only read ahead when the blocks are accessed sequentially and when
+    // the blocks cannot change anymore.
+    const bool isSequential = blockIndex == _currentBlock + 1;
+    if (isFullDecode && isSequential &&
+        !storageManager().table().isWritable()) {
+      startReadAhead(blockIndex + 1);
     }
   }
   _currentBlock = blockIndex;
   _isCurrentBlockChanged = false;
+  _nRowsReadInBlock = 0;
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::readAntennas(size_t blockIndex,
+                                                 std::vector<int> &ant1,
+                                                 std::vector<int> &ant2) const {
+  const size_t nRows = nRowsInBlock();
+  const uint64_t startRow = getRowIndex(blockIndex);
+  ant1.resize(nRows);
+  ant2.resize(nRows);
+  for (size_t blockRow = 0; blockRow != nRows; ++blockRow) {
+    ant1[blockRow] = (*_ant1Col)(startRow + blockRow);
+    ant2[blockRow] = (*_ant2Col)(startRow + blockRow);
+  }
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::readAndDecodeBlock(
+    size_t blockIndex, TimeBlockBuffer<data_t> &buffer,
+    unsigned char *packedSymbolBuffer, unsigned int *unpackedSymbolBuffer,
+    const std::vector<int> &ant1, const std::vector<int> &ant2) {
+  readCompressedData(blockIndex, packedSymbolBuffer, _blockSize);
+  const size_t nPolarizations = _shape[0], nChannels = _shape[1],
+               nRows = nRowsInBlock(),
+               nMetaFloats = metaDataFloatCount(nRows, nPolarizations,
+                                                nChannels, _antennaCount),
+               nSymbols = symbolCount(nRows, nPolarizations, nChannels);
+  unsigned char *symbolStart =
+      packedSymbolBuffer + nMetaFloats * sizeof(float);
+  BytePacker::unpack(_bitsPerSymbol, unpackedSymbolBuffer, symbolStart,
+                     nSymbols);
+  float *metaData = reinterpret_cast<float *>(packedSymbolBuffer);
+  initializeDecode(&buffer, metaData, nRows, _antennaCount);
+  buffer.resize(nRows);
+
+  // Decoding a row only reads the decoder state, hence a large block is
+  // split in ranges of rows that are decoded in parallel.
+  const size_t minSymbolsPerThread = 1 << 16;
+  size_t nThreads = std::min<size_t>(
+      ThreadedDyscoColumn::defaultThreadCount(),
+      std::max<size_t>(1, nSymbols / minSymbolsPerThread));
+  nThreads = std::max<size_t>(1, std::min(nThreads, nRows));
+  std::function<void(size_t, size_t)> decodeRows = [&](size_t first,
+                                                       size_t last) {
+    for (size_t blockRow = first; blockRow != last; ++blockRow) {
+      decode(&buffer, unpackedSymbolBuffer, blockRow, ant1[blockRow],
+             ant2[blockRow]);
+    }
+  };
+  if (nThreads == 1) {
+    decodeRows(0, nRows);
+  } else {
+    threadgroup group;
+    for (size_t t = 1; t != nThreads; ++t) {
+      group.create_thread(std::bind(decodeRows, t * nRows / nThreads,
+                                    (t + 1) * nRows / nThreads));
+    }
+    decodeRows(0, nRows / nThreads);
+    group.join_all();
+  }
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::readBlockForRowAccess(size_t blockIndex) {
+  readAntennas(blockIndex, _ant1Buffer, _ant2Buffer);
+  readCompressedData(blockIndex, _packedBlockReadBuffer.data(), _blockSize);
+  const size_t nRows = nRowsInBlock();
+  float *metaData = reinterpret_cast<float *>(_packedBlockReadBuffer.data());
+  initializeDecode(_timeBlockBuffer.get(), metaData, nRows, _antennaCount);
+  _timeBlockBuffer->resize(nRows);
+  _isRowDecoded.assign(nRows, false);
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::decodeRow(size_t blockRow) {
+  const size_t nPolarizations = _shape[0], nChannels = _shape[1],
+               nMetaFloats = metaDataFloatCount(nRowsInBlock(), nPolarizations,
+                                                nChannels, _antennaCount),
+               symbolsPerRow = symbolCount(1, nPolarizations, nChannels);
+  // Every 8th symbol starts at a byte boundary for all bit counts, so
+  // unpacking starts at the last such symbol before the row.
+  const size_t firstSymbol = blockRow * symbolsPerRow / 8 * 8,
+               endSymbol = (blockRow + 1) * symbolsPerRow;
+  unsigned char *symbolStart = _packedBlockReadBuffer.data() +
+                               nMetaFloats * sizeof(float) +
+                               firstSymbol / 8 * _bitsPerSymbol;
+  BytePacker::unpack(_bitsPerSymbol,
+                     _unpackedSymbolReadBuffer.data() + firstSymbol,
+                     symbolStart, endSymbol - firstSymbol);
+  decode(_timeBlockBuffer.get(), _unpackedSymbolReadBuffer.data(), blockRow,
+         _ant1Buffer[blockRow], _ant2Buffer[blockRow]);
+  _isRowDecoded[blockRow] = true;
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::decodeRemainingRows() {
+  for (size_t blockRow = 0; blockRow != _isRowDecoded.size(); ++blockRow) {
+    if (!_isRowDecoded[blockRow]) decodeRow(blockRow);
+  }
+  _isRowDecoded.clear();
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::startReadAhead(size_t blockIndex) {
+  if (blockIndex >= nBlocksInFile() ||
+      getRowIndex(blockIndex) + nRowsInBlock() >
+          storageManager().table().nrow()) {
+    return;
+  }
+  if (!_readAheadBuffer) {
+    _readAheadBuffer.reset(
+        new TimeBlockBuffer<data_t>(_shape[0], _shape[1]));
+  }
+  _packedReadAheadBuffer.resize(_packedBlockReadBuffer.size());
+  _unpackedSymbolReadAheadBuffer.resize(_unpackedSymbolReadBuffer.size());
+  // The antenna columns are read here, because Table objects cannot
+  // be used by multiple threads.
+  readAntennas(blockIndex, _readAheadAnt1, _readAheadAnt2);
+  _readAheadBlock = blockIndex;
+  _readAheadSucceeded = false;
+  _readAheadThread = std::thread([this]() {
+    try {
+      readAndDecodeBlock(_readAheadBlock, *_readAheadBuffer,
+                         _packedReadAheadBuffer.data(),
+                         _unpackedSymbolReadAheadBuffer.data(),
+                         _readAheadAnt1, _readAheadAnt2);
+      _readAheadSucceeded = true;
+    } catch (std::exception &) {
+      // The block will be read again by loadBlock, which reports the error.
+    }
+  });
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::waitForReadAhead() {
+  if (_readAheadThread.joinable()) _readAheadThread.join();
 }
 
 template <typename DataType>
@@ -135,8 +286,14 @@ void ThreadedDyscoColumn<DataType>::getValues(
       }
 
       // The time block encoder is now initialized and contains the unpacked
-      // block.
-      _timeBlockBuffer->GetData(getRowWithinBlock(rowNr), dataPtr);
+      // block, or the row has to be decoded if the block is decoded row by
+      // row.
+      const size_t blockRow = getRowWithinBlock(rowNr);
+      if (!_isRowDecoded.empty() && !_isRowDecoded[blockRow]) {
+        decodeRow(blockRow);
+      }
+      ++_nRowsReadInBlock;
+      _timeBlockBuffer->GetData(blockRow, dataPtr);
     }
   }
   dataArr->putStorage (dataPtr, deleteIt);
@@ -210,6 +367,8 @@ void ThreadedDyscoColumn<DataType>::putValues(
       // Load new block
       loadBlock(blockIndex);
     }
+    // All rows are needed to encode the block again.
+    if (!_isRowDecoded.empty()) decodeRemainingRows();
     _timeBlockBuffer->SetData(blockRow, ant1, ant2, dataPtr);
   } else {
     _timeBlockBuffer->SetData(rowNr, ant1, ant2, dataPtr);
@@ -222,6 +381,7 @@ template <typename DataType>
 void ThreadedDyscoColumn<DataType>::Prepare(DyscoDistribution, Normalization,
                                             double /*studentsTNu*/,
                                             double /*distributionTruncation*/) {
+  waitForReadAhead();
   stopThreads();
   casacore::Table &table = storageManager().table();
   _ant1Col.reset(new casacore::ScalarColumn<int>(table, "ANTENNA1"));
@@ -237,6 +397,9 @@ void ThreadedDyscoColumn<DataType>::Prepare(DyscoDistribution, Normalization,
     // TODO _timeBlockEncoder->SetNAntennae(_antennaCount);
   }
   _currentBlock = std::numeric_limits<size_t>::max();
+  _readAheadBlock = std::numeric_limits<size_t>::max();
+  _isRowDecoded.clear();
+  _nRowsReadInBlock = 0;
 }
 
 template <typename DataType>
@@ -247,6 +410,7 @@ size_t ThreadedDyscoColumn<DataType>::defaultThreadCount() const {
 
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::InitializeAfterNRowsPerBlockIsKnown() {
+  waitForReadAhead();
   stopThreads();
   if (_bitsPerSymbol == 0)
     throw DyscoStManError(
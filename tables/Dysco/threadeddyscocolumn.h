@@ -12,6 +12,8 @@
 #include <memory>
 #include <mutex>
 #include <random>
+#include <thread>
+#include <vector>
 
 #include "dyscostmancol.h"
 #include "serializable.h"
@@ -183,6 +185,46 @@ class ThreadedDyscoColumn : public DyscoStManColumn {
                       ThreadDataBase *threadUserData);
   bool isWriteItemAvailable(typename cache_t::iterator &i);
   void loadBlock(size_t blockIndex);
+  /**
+   * Read the compressed block and decode it into the given buffer. The
+   * antenna numbers of the rows in the block must have been read already,
+   * because the table columns can only be accessed from the main thread.
+   * Large blocks are decoded by multiple threads, each doing a range of rows.
+   */
+  void readAndDecodeBlock(size_t blockIndex, TimeBlockBuffer<data_t> &buffer,
+                          unsigned char *packedSymbolBuffer,
+                          unsigned int *unpackedSymbolBuffer,
+                          const std::vector<int> &ant1,
+                          const std::vector<int> &ant2);
+  void readAntennas(size_t blockIndex, std::vector<int> &ant1,
+                    std::vector<int> &ant2) const;
+
+  /**
+   * Read the compressed block into the current buffer and initialize the
+   * decoder, but do not decode the rows yet. Because the symbols of a row
+   * are stored at a fixed offset, each row (baseline) can be unpacked and
+   * decoded on its own when it is requested (see decodeRow()). This avoids
+   * decoding full time blocks when only a few baselines are read.
+   */
+  void readBlockForRowAccess(size_t blockIndex);
+
+  /**
+   * Unpack and decode a single row of a block read by
+   * readBlockForRowAccess().
+   */
+  void decodeRow(size_t blockRow);
+
+  /**
+   * Decode the rows of the current block that were not decoded yet, so
+   * the block can be changed and stored again.
+   */
+  void decodeRemainingRows();
+  /**
+   * When the table is opened read-only, the next block is read and decoded
+   * in the background while the current block is being used.
+   */
+  void startReadAhead(size_t blockIndex);
+  void waitForReadAhead();
   void storeBlock();
   size_t maxCacheSize() const {
     return ThreadedDyscoColumn::defaultThreadCount() * 12 / 10 + 1;
@@ -208,6 +250,22 @@ class ThreadedDyscoColumn : public DyscoStManColumn {
   size_t _antennaCount;
 
   std::unique_ptr<TimeBlockBuffer<data_t>> _timeBlockBuffer;
+
+  // The rows of the current block that are decoded if the block is decoded
+  // row by row; it is empty if the full block is decoded.
+  std::vector<bool> _isRowDecoded;
+  // The number of reads in the current block. It determines if the next
+  // block is decoded fully or row by row.
+  size_t _nRowsReadInBlock;
+
+  // Buffers and state for reading ahead the next block.
+  std::thread _readAheadThread;
+  size_t _readAheadBlock;
+  bool _readAheadSucceeded;
+  std::unique_ptr<TimeBlockBuffer<data_t>> _readAheadBuffer;
+  ao::uvector<unsigned char> _packedReadAheadBuffer;
+  ao::uvector<unsigned int> _unpackedSymbolReadAheadBuffer;
+  std::vector<int> _ant1Buffer, _ant2Buffer, _readAheadAnt1, _readAheadAnt2;
 };
 
 template <>
@@ -28,9 +28,9 @@ class WeightBlockEncoder {
     double scaleValue = _decodeMaxValue / (double(_quantCount - 1));
     TimeBlockBuffer<float>::DataRow &row = buffer[blockRow];
     const unsigned int *rowBuffer = &symbolBuffer[blockRow * _nChannels];
+    row.visibilities.resize(_nChannels * _nPolarizations);
     for (size_t ch = 0; ch != _nChannels; ++ch) {
       float value = *rowBuffer * scaleValue;
-      row.visibilities.resize(_nChannels * _nPolarizations);
       float *chPtr = &row.visibilities[ch * _nPolarizations];
       for (size_t p = 0; p != _nPolarizations; ++p) chPtr[p] = value;
       ++rowBuffer;
@@ -34,6 +34,10 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/Constants.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Slicer.h>
+
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -48,14 +52,18 @@ String TableLogSink::id( ) const {
 
 TableLogSink::TableLogSink (LogMessage::Priority filter,
 			    const String& fileName)
-: LogSinkInterface(LogFilter(filter))
+: LogSinkInterface(LogFilter(filter)),
+  maxPending_p (256),
+  maxDelay_p   (1)
 {
     init (fileName);
 }
 
 TableLogSink::TableLogSink (const LogFilterInterface& filter,
 			    const String& fileName)
-: LogSinkInterface(filter)
+: LogSinkInterface(filter),
+  maxPending_p (256),
+  maxDelay_p   (1)
 {
     init (fileName);
 }
@@ -92,7 +100,9 @@ void TableLogSink::init (const String& fileName)
 }
 
 TableLogSink::TableLogSink (const String& fileName)
-: LogSinkInterface()
+: LogSinkInterface(),
+  maxPending_p (256),
+  maxDelay_p   (1)
 {
     LogMessage logMessage(LogOrigin("TableLogSink", "TableLogSink", WHERE));
     if (! Table::isReadable (fileName)) {
@@ -110,7 +120,9 @@ TableLogSink::TableLogSink (const String& fileName)
 }
 
 TableLogSink::TableLogSink (const TableLogSink& other)
-: LogSinkInterface()
+: LogSinkInterface(),
+  maxPending_p (256),
+  maxDelay_p   (1)
 {
     copy_other (other);
 }
@@ -125,7 +137,12 @@ TableLogSink& TableLogSink::operator= (const TableLogSink& other)
 
 void TableLogSink::copy_other (const TableLogSink& other)
 {
+    // Both sinks share the table, so first write all buffered messages.
+    writePending();
+    other.writePending();
     LogSinkInterface::operator= (other);
+    maxPending_p = other.maxPending_p;
+    maxDelay_p   = other.maxDelay_p;
     log_table_p = other.log_table_p;
     time_p.reference     (other.time_p);
     priority_p.reference (other.priority_p);
@@ -178,10 +195,6 @@ void TableLogSink::reopenRW (const LogFilterInterface& aFilter)
 
 Bool TableLogSink::postLocally (const LogMessage& message)
 {
-    if (log_table_p.isWritable()) {
-        log_table_p.reopenRW();
-        attachCols();
-    }
     Bool posted = False;
     if (filter().pass(message)) {
 	String tmp;
@@ -191,11 +204,78 @@ Bool TableLogSink::postLocally (const LogMessage& message)
                       LogMessage::toString(message.priority()),
                       message.origin().location(),
                       tmp);
+        // Do not keep a severe message in the buffer; the program
+        // might end without a proper flush.
+        if (message.priority() >= LogMessage::SEVERE) {
+            writePending();
+        }
         posted = True;
     }
     return posted;
 }
 
+const Table& TableLogSink::table() const
+{
+  writePending();
+  return log_table_p;
+}
+Table& TableLogSink::table()
+{
+  writePending();
+  return log_table_p;
+}
+
+const ScalarColumn<Double>& TableLogSink::roTime() const
+{
+  writePending();
+  return time_p;
+}
+ScalarColumn<Double>& TableLogSink::time()
+{
+  writePending();
+  return time_p;
+}
+const ScalarColumn<String>& TableLogSink::roPriority() const
+{
+  writePending();
+  return priority_p;
+}
+ScalarColumn<String>& TableLogSink::priority()
+{
+  writePending();
+  return priority_p;
+}
+const ScalarColumn<String>& TableLogSink::roMessage() const
+{
+  writePending();
+  return message_p;
+}
+ScalarColumn<String>& TableLogSink::message()
+{
+  writePending();
+  return message_p;
+}
+const ScalarColumn<String>& TableLogSink::roLocation() const
+{
+  writePending();
+  return location_p;
+}
+ScalarColumn<String>& TableLogSink::location()
+{
+  writePending();
+  return location_p;
+}
+const ScalarColumn<String>& TableLogSink::roObjectID() const
+{
+  writePending();
+  return id_p;
+}
+ScalarColumn<String>& TableLogSink::objectID()
+{
+  writePending();
+  return id_p;
+}
+
 uInt TableLogSink::nelements() const
 {
   return table().nrow();
@@ -264,27 +344,85 @@ TableDesc TableLogSink::logTableDescription()
 
 void TableLogSink::flush(Bool)
 {
+  writePending();
   log_table_p.flush();
 }
 
+void TableLogSink::setBuffering (uInt maxMessages, Double maxDelay)
+{
+  maxPending_p = std::max (maxMessages, 1u);
+  maxDelay_p   = maxDelay;
+  if (pendTime_p.size() >= maxPending_p) {
+    writePending();
+  }
+}
+
 void TableLogSink::writeLocally (Double mtime,
 				 const String& mmessage,
 				 const String& mpriority,
 				 const String& mlocation,
 				 const String& mobjectID)
 {
-  uInt offset = table().nrow();
-  // cout << "writing " << mmessage << " at row " << offset << endl;
-  table().addRow(1);
-  time().put     (offset, mtime);
-  message().put  (offset, mmessage);
-  priority().put (offset, mpriority);
-  location().put (offset, mlocation);
-  objectID().put (offset, mobjectID);
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  if (pendTime_p.empty()) {
+    pendStart_p = now;
+  }
+  pendTime_p.push_back     (mtime);
+  pendMessage_p.push_back  (mmessage);
+  pendPriority_p.push_back (mpriority);
+  pendLocation_p.push_back (mlocation);
+  pendId_p.push_back       (mobjectID);
+  // A non-writable table gives an exception right away.
+  if (pendTime_p.size() >= maxPending_p  ||  !log_table_p.isWritable()  ||
+      std::chrono::duration<Double>(now - pendStart_p).count() >= maxDelay_p) {
+    writePending();
+  }
+}
+
+void TableLogSink::writePending() const
+{
+  if (! pendTime_p.empty()) {
+    const_cast<TableLogSink*>(this)->doWritePending();
+  }
+}
+
+void TableLogSink::doWritePending()
+{
+  // Take the messages out of the buffer first, so they are not written
+  // twice if an exception occurs.
+  Vector<Double> times     (pendTime_p);
+  Vector<String> messages  (pendMessage_p);
+  Vector<String> priorities(pendPriority_p);
+  Vector<String> locations (pendLocation_p);
+  Vector<String> ids       (pendId_p);
+  pendTime_p.clear();
+  pendMessage_p.clear();
+  pendPriority_p.clear();
+  pendLocation_p.clear();
+  pendId_p.clear();
+  if (log_table_p.isWritable()) {
+    log_table_p.reopenRW();
+    attachCols();
+  }
+  // Append all messages at once.
+  rownr_t offset = log_table_p.nrow();
+  log_table_p.addRow (times.size());
+  Slicer rows (IPosition(1, offset), IPosition(1, times.size()));
+  time_p.putColumnRange     (rows, times);
+  message_p.putColumnRange  (rows, messages);
+  priority_p.putColumnRange (rows, priorities);
+  location_p.putColumnRange (rows, locations);
+  id_p.putColumnRange       (rows, ids);
 }
 
 void TableLogSink::clearLocally()
 {
+  // The buffered messages are cleared as well.
+  pendTime_p.clear();
+  pendMessage_p.clear();
+  pendPriority_p.clear();
+  pendLocation_p.clear();
+  pendId_p.clear();
   String fileName = log_table_p.tableName();
   // Delete current log table.
   log_table_p.markForDelete();
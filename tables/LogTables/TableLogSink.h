@@ -36,6 +36,9 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 
+#include <chrono>
+#include <vector>
+
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
@@ -70,6 +73,16 @@ class SetupNewTable;
 // This class posts messages which pass the filter to a Casacore
 // <linkto class=Table>Table</linkto>. It puts every field of the
 // <linkto class=LogMessage>LogMessage</linkto> into its own column.
+//
+// Messages are not written one by one, but collected in a buffer which is
+// appended to the table in a single batch (one row addition and one column
+// put per field). The buffer is written when it holds the maximum number
+// of messages, when its oldest message exceeds the maximum delay (checked
+// when a new message arrives), when a SEVERE message is posted, and when
+// the sink is flushed or destructed. Accessing the table or its messages
+// via this class writes the buffer first, so the buffering is transparent.
+// Function <src>setBuffering</src> can be used to change the limits;
+// a maximum of 1 message writes each message immediately.
 // </synopsis>
 //
 // <example>
@@ -182,6 +195,11 @@ public:
   // Write out any pending output to the table.
   virtual void flush (Bool global=True);
 
+  // Set the maximum number of messages and the maximum time (in seconds)
+  // messages are buffered before being appended to the table.
+  // The default is 256 messages and 1 second.
+  void setBuffering (uInt maxMessages, Double maxDelay);
+
   // Write a message (usually from another logsink) into the local one.
   virtual void writeLocally (Double time, const String& message,
 			     const String& priority, const String& location,
@@ -214,6 +232,12 @@ private:
   void attachCols();
   // Initialize the object.
   void init (const String& fileName);
+  // Append the buffered messages to the table.
+  // It is const, because also the const accessors need the table
+  // to be up to date.
+  void writePending() const;
+  // Do the actual appending of the buffered messages.
+  void doWritePending();
 
 
   Table log_table_p;
@@ -224,33 +248,20 @@ private:
   ScalarColumn<String>  location_p;
   // ObjectID
   ScalarColumn<String>  id_p;
+  // The buffered messages.
+  std::vector<Double> pendTime_p;
+  std::vector<String> pendPriority_p;
+  std::vector<String> pendMessage_p;
+  std::vector<String> pendLocation_p;
+  std::vector<String> pendId_p;
+  // The time the oldest buffered message was added.
+  std::chrono::steady_clock::time_point pendStart_p;
+  // The buffering limits.
+  uInt maxPending_p;
+  Double maxDelay_p;
 };
 
 //# Inlines
-inline const Table& TableLogSink::table() const {return log_table_p;}
-inline Table& TableLogSink::table() {return log_table_p;}
-
-inline const ScalarColumn<Double>& TableLogSink::roTime() const
-  {return time_p;}
-inline ScalarColumn<Double>& TableLogSink::time()
-  {return time_p;}
-inline const ScalarColumn<String>& TableLogSink::roPriority() const 
-  {return priority_p;}
-inline ScalarColumn<String>& TableLogSink::priority()
-  {return priority_p;}
-inline const ScalarColumn<String>& TableLogSink::roLocation() const 
-  {return location_p;}
-inline ScalarColumn<String>& TableLogSink::location()
-  {return location_p;}
-inline const ScalarColumn<String>& TableLogSink::roObjectID() const 
-  {return id_p;}
-inline ScalarColumn<String>& TableLogSink::objectID()
-  {return id_p;}
-inline const ScalarColumn<String>& TableLogSink::roMessage() const
-  {return message_p;}
-inline ScalarColumn<String>& TableLogSink::message()
-  {return message_p;}
-
 inline LogSink TableLogSink::makeSink (const String& fileName)
   { return makeSink (LogFilter(), fileName); }
 inline LogSink TableLogSink::makeSink (LogMessage::Priority filter,
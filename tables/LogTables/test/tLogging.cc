@@ -527,6 +527,63 @@ void testLogTable()
   testLogAny (sink);
 }
 
+void testLogTableBuffer()
+{
+  cleanup();
+  {
+    TableLogSink sink (LogMessage::NORMAL, tableNames[0]);
+    sink.setBuffering (4, 1000);
+    Table logTable(tableNames[0]);
+    ScalarColumn<String> messageColumn(logTable,
+                         TableLogSink::columnName(TableLogSink::MESSAGE));
+    LogMessage message;
+    for (uInt i=0; i<3; ++i) {
+      message.message (String::toString(i));
+      AlwaysAssertExit (sink.postLocally(message));
+    }
+    // Still buffered.
+    AlwaysAssertExit (logTable.nrow() == 0);
+    message.message ("3");
+    AlwaysAssertExit (sink.postLocally(message));
+    AlwaysAssertExit (logTable.nrow() == 4);
+    for (uInt i=0; i<4; ++i) {
+      AlwaysAssertExit (messageColumn(i) == String::toString(i));
+    }
+    message.message ("4");
+    sink.postLocally (message);
+    AlwaysAssertExit (logTable.nrow() == 4);
+    // Accessing the messages writes the buffer.
+    AlwaysAssertExit (sink.nelements() == 5);
+    AlwaysAssertExit (logTable.nrow() == 5  &&  messageColumn(4) == "4");
+    message.message ("5");
+    sink.postLocally (message);
+    AlwaysAssertExit (sink.getMessage(5) == "5");
+    // A severe message is written immediately.
+    message.message ("6");
+    sink.postLocally (message);
+    message.message ("7");
+    message.priority (LogMessage::SEVERE);
+    sink.postLocally (message);
+    AlwaysAssertExit (logTable.nrow() == 8  &&  messageColumn(7) == "7");
+    message.priority (LogMessage::NORMAL);
+    // Unbuffered.
+    sink.setBuffering (1, 0);
+    message.message ("8");
+    sink.postLocally (message);
+    AlwaysAssertExit (logTable.nrow() == 9);
+    sink.setBuffering (100, 1000);
+    message.message ("9");
+    sink.postLocally (message);
+    AlwaysAssertExit (logTable.nrow() == 9);
+  }
+  // The destructor writes the buffer.
+  Table logTable(tableNames[0]);
+  AlwaysAssertExit (logTable.nrow() == 10);
+  ScalarColumn<String> messageColumn(logTable,
+                       TableLogSink::columnName(TableLogSink::MESSAGE));
+  AlwaysAssertExit (messageColumn(9) == "9");
+}
+
 int main()
 {
     try {
@@ -538,6 +595,7 @@ int main()
 	testLogIO();
 	testLogMemory();
 	testLogTable();
+	testLogTableBuffer();
     } catch (std::exception& x) {
         cout << "Caught an exception : " << x.what() << endl;
 	exit(1);
@@ -31,12 +31,14 @@
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Quanta/MVTime.h>
 #include <casacore/casa/OS/Time.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
 
 
 
@@ -186,37 +188,115 @@ void TableExprNodeColumn::applySelection (const Vector<rownr_t>& rownrs)
 const TableColumn& TableExprNodeColumn::getColumn() const
     { return tabCol_p; }
 
+template<typename T>
+void TableExprNodeColumn::getValue (const TableExprId& id, T& value)
+{
+    if (id.mutex()) {
+        std::lock_guard<std::mutex> lock(*id.mutex());
+        tabCol_p.getScalar (id.rownr(), value);
+    } else {
+        tabCol_p.getScalar (id.rownr(), value);
+    }
+}
+
 Bool TableExprNodeColumn::getBool (const TableExprId& id)
 {
     Bool val;
-    tabCol_p.getScalar (id.rownr(), val);
+    getValue (id, val);
     return val;
 }
 Int64 TableExprNodeColumn::getInt (const TableExprId& id)
 {
     Int64 val;
-    tabCol_p.getScalar (id.rownr(), val);
+    getValue (id, val);
     return val;
 }
 Double TableExprNodeColumn::getDouble (const TableExprId& id)
 {
     Double val;
-    tabCol_p.getScalar (id.rownr(), val);
+    getValue (id, val);
     return val;
 }
 DComplex TableExprNodeColumn::getDComplex (const TableExprId& id)
 {
     DComplex val;
-    tabCol_p.getScalar (id.rownr(), val);
+    getValue (id, val);
     return val;
 }
 String TableExprNodeColumn::getString (const TableExprId& id)
 {
     String val;
-    tabCol_p.getScalar (id.rownr(), val);
+    getValue (id, val);
     return val;
 }
 
+template<typename T, typename U>
+void TableExprNodeColumn::getRange (const TableExprId& id, rownr_t nrow,
+                                    U* values)
+{
+    Vector<T> vec(nrow);
+    Slicer slicer (IPosition(1, id.rownr()), IPosition(1, nrow));
+    if (id.mutex()) {
+        std::lock_guard<std::mutex> lock(*id.mutex());
+        ScalarColumn<T>(tabCol_p).getColumnRange (slicer, vec);
+    } else {
+        ScalarColumn<T>(tabCol_p).getColumnRange (slicer, vec);
+    }
+    std::copy (vec.begin(), vec.end(), values);
+}
+
+void TableExprNodeColumn::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                        Bool* values)
+{
+    if (tabCol_p.columnDesc().dataType() == TpBool) {
+        getRange<Bool> (id, nrow, values);
+    } else {
+        TableExprNodeBinary::getBoolBatch (id, nrow, values);
+    }
+}
+
+void TableExprNodeColumn::getIntBatch (const TableExprId& id, rownr_t nrow,
+                                       Int64* values)
+{
+    switch (tabCol_p.columnDesc().dataType()) {
+    case TpUChar:
+        getRange<uChar> (id, nrow, values);
+        break;
+    case TpShort:
+        getRange<Short> (id, nrow, values);
+        break;
+    case TpUShort:
+        getRange<uShort> (id, nrow, values);
+        break;
+    case TpInt:
+        getRange<Int> (id, nrow, values);
+        break;
+    case TpUInt:
+        getRange<uInt> (id, nrow, values);
+        break;
+    case TpInt64:
+        getRange<Int64> (id, nrow, values);
+        break;
+    default:
+        TableExprNodeBinary::getIntBatch (id, nrow, values);
+    }
+}
+
+void TableExprNodeColumn::getDoubleBatch (const TableExprId& id, rownr_t nrow,
+                                          Double* values)
+{
+    switch (tabCol_p.columnDesc().dataType()) {
+    case TpFloat:
+        getRange<Float> (id, nrow, values);
+        break;
+    case TpDouble:
+        getRange<Double> (id, nrow, values);
+        break;
+    default:
+        TableExprNodeBinary::getDoubleBatch (id, nrow, values);
+    }
+}
+
 Bool TableExprNodeColumn::getColumnDataType (DataType& dt) const
 {
     dt = tabCol_p.columnDesc().dataType();
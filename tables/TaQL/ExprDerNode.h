@@ -320,6 +320,16 @@ public:
     String   getString   (const TableExprId& id) override;
     const TableColumn& getColumn() const;
 
+    // Get the data for a batch of rows in a single read.
+    // <group>
+    void getBoolBatch   (const TableExprId& id, rownr_t nrow,
+                         Bool* values) override;
+    void getIntBatch    (const TableExprId& id, rownr_t nrow,
+                         Int64* values) override;
+    void getDoubleBatch (const TableExprId& id, rownr_t nrow,
+                         Double* values) override;
+    // </group>
+
     // Get the data for the given rows.
     Array<Bool>     getColumnBool (const Vector<rownr_t>& rownrs) override;
     Array<uChar>    getColumnuChar (const Vector<rownr_t>& rownrs) override;
@@ -337,6 +347,15 @@ public:
     // Get the column unit (can be empty).
     static Unit getColumnUnit (const TableColumn&);
 
+private:
+    // Get a scalar value, while locking the mutex of the id (if any).
+    template<typename T> void getValue (const TableExprId& id, T& value);
+
+    // Read the values of a range of rows (as column type T) and convert
+    // them to type U, while locking the mutex of the id (if any).
+    template<typename T, typename U>
+    void getRange (const TableExprId& id, rownr_t nrow, U* values);
+
 protected:
     TableExprInfo tableInfo_p;
     TableColumn   tabCol_p;
@@ -43,6 +43,7 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <iomanip>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -862,6 +863,131 @@ Double TableExprFuncNode::getDouble (const TableExprId& id)
     return 0;
 }
 
+void TableExprFuncNode::getDoubleBatch (const TableExprId& id, rownr_t nrow,
+                                        Double* values)
+{
+    // Only handle real scalar functions with real arguments.
+    Bool canDo = (dataType() == NTDouble  &&  valueType() == VTScalar);
+    for (size_t i=0; canDo && i<operands_p.size(); ++i) {
+        canDo = (operands_p[i]->valueType() == VTScalar  &&
+                 (operands_p[i]->dataType() == NTDouble  ||
+                  operands_p[i]->dataType() == NTInt));
+    }
+    if (canDo) {
+        switch (funcType_p) {
+        case sinFUNC:
+        case sinhFUNC:
+        case cosFUNC:
+        case coshFUNC:
+        case expFUNC:
+        case logFUNC:
+        case log10FUNC:
+        case squareFUNC:
+        case cubeFUNC:
+        case sqrtFUNC:
+        case absFUNC:
+        case asinFUNC:
+        case acosFUNC:
+        case atanFUNC:
+        case tanFUNC:
+        case tanhFUNC:
+        case floorFUNC:
+        case ceilFUNC:
+        case powFUNC:
+        case atan2FUNC:
+        case fmodFUNC:
+        case minFUNC:
+        case maxFUNC:
+          break;
+        default:
+          canDo = False;
+        }
+    }
+    if (! canDo) {
+        TableExprNodeMulti::getDoubleBatch (id, nrow, values);
+        return;
+    }
+    operands_p[0]->getDoubleBatch (id, nrow, values);
+    std::vector<Double> right;
+    if (operands_p.size() > 1) {
+        right.resize (nrow);
+        operands_p[1]->getDoubleBatch (id, nrow, right.data());
+    }
+    switch (funcType_p) {
+    case sinFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = sin (values[i]);
+        break;
+    case sinhFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = sinh (values[i]);
+        break;
+    case cosFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = cos (values[i]);
+        break;
+    case coshFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = cosh (values[i]);
+        break;
+    case expFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = exp (values[i]);
+        break;
+    case logFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = log (values[i]);
+        break;
+    case log10FUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = log10 (values[i]);
+        break;
+    case squareFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] *= values[i];
+        break;
+    case cubeFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] *= values[i] * values[i];
+        break;
+    case sqrtFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = sqrt (values[i]) * scale_p;
+        break;
+    case absFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = abs (values[i]);
+        break;
+    case asinFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = asin (values[i]);
+        break;
+    case acosFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = acos (values[i]);
+        break;
+    case atanFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = atan (values[i]);
+        break;
+    case tanFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = tan (values[i]);
+        break;
+    case tanhFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = tanh (values[i]);
+        break;
+    case floorFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = floor (values[i]);
+        break;
+    case ceilFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = ceil (values[i]);
+        break;
+    case powFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = pow (values[i], right[i]);
+        break;
+    case atan2FUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = atan2 (values[i], right[i]);
+        break;
+    case fmodFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = fmod (values[i], right[i]);
+        break;
+    case minFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = min (values[i], right[i]);
+        break;
+    case maxFUNC:
+        for (rownr_t i=0; i<nrow; ++i) values[i] = max (values[i], right[i]);
+        break;
+    default:
+        break;
+    }
+}
+
 DComplex TableExprFuncNode::getDComplex (const TableExprId& id)
 {
     if (dataType() == NTDouble) {
@@ -1089,14 +1215,16 @@ String TableExprFuncNode::getString (const TableExprId& id)
 TaqlRegex TableExprFuncNode::getRegex (const TableExprId& id)
 {
     switch (funcType_p) {
+    // The expression can differ per row, so use the cache of compiled
+    // expressions to avoid compiling the same one over and over again.
     case regexFUNC:
-      return TaqlRegex(Regex(operands_p[0]->getString (id), True));
+      return TaqlRegex(Regex::cached(operands_p[0]->getString (id)));
     case patternFUNC:
-      return TaqlRegex(Regex(Regex::fromPattern(operands_p[0]->getString (id)),
-                             True));
+      return TaqlRegex(Regex::cached
+                       (Regex::fromPattern(operands_p[0]->getString (id))));
     case sqlpatternFUNC:
-      return TaqlRegex(Regex(Regex::fromSQLPattern(operands_p[0]->getString (id)),
-                             True));
+      return TaqlRegex(Regex::cached
+                       (Regex::fromSQLPattern(operands_p[0]->getString (id))));
     case iifFUNC:
       return operands_p[0]->getBool(id)  ?
         operands_p[1]->getRegex(id) : operands_p[2]->getRegex(id);
@@ -1341,6 +1469,32 @@ String TableExprFuncNode::stringDMS (double val, Int prec)
 }
 
 
+Bool TableExprFuncNode::isDeterministic (FunctionType ftype, uInt nargs)
+{
+  switch (ftype) {
+  case randFUNC:
+    return False;
+  // These functions use the current date/time if no argument is given.
+  case datetimeFUNC:
+  case dateFUNC:
+  case yearFUNC:
+  case monthFUNC:
+  case dayFUNC:
+  case weekdayFUNC:
+  case weekFUNC:
+  case mjdFUNC:
+  case timeFUNC:
+  case cmonthFUNC:
+  case cdowFUNC:
+  case ctodFUNC:
+  case cdateFUNC:
+  case ctimeFUNC:
+    return nargs > 0;
+  default:
+    return True;
+  }
+}
+
 TableExprNodeRep::NodeDataType TableExprFuncNode::checkOperands
                                  (Block<Int>& dtypeOper,
                                   ValueType& resVT, Block<Int>&,
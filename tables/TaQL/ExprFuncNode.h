@@ -365,6 +365,11 @@ public:
     MVTime    getDate     (const TableExprId& id);
     // </group>
 
+    // Get the values for a batch of rows. It is done in a tight loop for
+    // the common mathematical functions with real arguments; other
+    // functions are evaluated row by row.
+    void getDoubleBatch (const TableExprId& id, rownr_t nrow, Double* values);
+
     // Check the data and value types of the operands.
     // It sets the exptected data and value types of the operands.
     // Set the value type of the function result and returns
@@ -375,6 +380,13 @@ public:
                                        FunctionType,
                                        std::vector<TENShPtr>&);
 
+    // Does the function give the same result each time it is evaluated
+    // with the same arguments? It is not the case for rand and for the
+    // date/time functions without an argument, which use the current time.
+    // Note that such a function results in a constant node if it has no
+    // arguments, so it cannot be recognized in the expression tree.
+    static Bool isDeterministic (FunctionType, uInt nargs);
+
     // Fill the result unit in the node.
     // Adapt the children nodes if their units need to be converted.
     // It returns a possible scale factor in case result unit is SI (for sqrt).
@@ -1163,7 +1163,7 @@ MArray<Int64> TableExprFuncNodeArray::getArrayInt (const TableExprId& id)
     case TableExprFuncNode::arrsumsqrsFUNC:
       {
         MArray<Int64> arr (operands()[0]->getArrayInt(id));
-        return partialSums (arr*arr, getAxes(id, arr.ndim()));
+        return partialSumSqrs (arr, getAxes(id, arr.ndim()));
       }
     case TableExprFuncNode::arrminsFUNC:
       {
@@ -1566,7 +1566,7 @@ MArray<Double> TableExprFuncNodeArray::getArrayDouble (const TableExprId& id)
     case TableExprFuncNode::arrsumsqrsFUNC:
       {
         MArray<Double> arr (operands()[0]->getArrayDouble(id));
-        return partialSums (arr*arr, getAxes(id, arr.ndim()));
+        return partialSumSqrs (arr, getAxes(id, arr.ndim()));
       }
     case TableExprFuncNode::arrminsFUNC:
       {
@@ -2070,7 +2070,7 @@ MArray<DComplex> TableExprFuncNodeArray::getArrayDComplex
     case TableExprFuncNode::arrsumsqrsFUNC:
       {
         MArray<DComplex> arr (operands()[0]->getArrayDComplex(id));
-        return partialSums (arr*arr, getAxes(id, arr.ndim()));
+        return partialSumSqrs (arr, getAxes(id, arr.ndim()));
       }
     case TableExprFuncNode::runsumsqrFUNC:
       {
@@ -32,6 +32,8 @@
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <functional>
 #include <limits>
 
 
@@ -45,7 +47,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     case TableExprNodeRep::NTInt:
       return itsInt64 == that.itsInt64;
     case TableExprNodeRep::NTDouble:
-      return itsDouble == that.itsDouble;
+      return itsDouble == that.itsDouble  ||
+        (isNaN(itsDouble)  &&  isNaN(that.itsDouble));
     default:
       return itsString == that.itsString;
     }
@@ -66,6 +69,22 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
 
+  size_t TableExprGroupKey::hash() const
+  {
+    switch (itsDT) {
+    case TableExprNodeRep::NTBool:
+      return itsBool;
+    case TableExprNodeRep::NTInt:
+      return std::hash<Int64>() (itsInt64);
+    case TableExprNodeRep::NTDouble:
+      // All NaNs are equal, so give them the same hash value.
+      return isNaN(itsDouble)  ?  0 : std::hash<Double>() (itsDouble);
+    default:
+      return std::hash<std::string>() (itsString);
+    }
+  }
+
+
   TableExprGroupKeySet::TableExprGroupKeySet (const vector<TableExprNode>& nodes)
   {
     itsKeys.reserve (nodes.size());
@@ -121,6 +140,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return false;
   }
 
+  size_t TableExprGroupKeySet::hash() const
+  {
+    // Combine the hash values in the same way as boost::hash_combine.
+    size_t h = 0;
+    for (const TableExprGroupKey& key : itsKeys) {
+      h ^= key.hash() + 0x9e3779b9 + (h << 6) + (h >> 2);
+    }
+    return h;
+  }
+
 
   TableExprGroupResult::TableExprGroupResult
   (const vector<std::shared_ptr<TableExprGroupFuncSet>>& funcSets)
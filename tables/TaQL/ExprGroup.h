@@ -72,11 +72,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // </group>
 
     // Compare this and that key.
+    // For operator== all NaN values are equal, so they form a single group.
     // <group>
     bool operator== (const TableExprGroupKey&) const;
     bool operator<  (const TableExprGroupKey&) const;
     // </group>
 
+    // Get the hash value of the key (consistent with operator==).
+    size_t hash() const;
+
   private:
     TableExprNodeRep::NodeDataType itsDT;
     Bool   itsBool = false;
@@ -98,7 +102,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // This class contains a set of TableExprGroupKey objects, each containing
   // the value of a key for a particular table row.
   // <br>It contains comparison functions to make it possible to use them
-  // in a std::map object to map the groupby keyset to a group.
+  // in a std::map or std::unordered_map object to map the groupby keyset
+  // to a group.
   // </synopsis> 
   class TableExprGroupKeySet
   {
@@ -119,6 +124,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     bool operator== (const TableExprGroupKeySet&) const;
     bool operator<  (const TableExprGroupKeySet&) const;
 
+    // Get the hash value of the keyset, so it can also be used in a
+    // std::unordered_map object.
+    size_t hash() const;
+
+    // Functor to be used as the hash function of a std::unordered_map.
+    struct Hash {
+      size_t operator() (const TableExprGroupKeySet& keySet) const
+        { return keySet.hash(); }
+    };
+
   private:
     vector<TableExprGroupKey> itsKeys;
   };
@@ -30,6 +30,7 @@
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/casa/Quanta/MVTime.h>
+#include <casacore/casa/Containers/Block.h>
 #include <float.h>                     // for DBL_MAX
 #include <limits.h>                     // for DBL_MAX
 
@@ -45,6 +46,12 @@ Bool TableExprNodeEQBool::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) == rnode_p->getBool(id);
 }
+void TableExprNodeEQBool::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                        Bool* values)
+{
+    applyBatch<Bool> (id, nrow, values,
+                      [] (Bool l, Bool r) -> Bool { return l == r; });
+}
 
 TableExprNodeEQInt::TableExprNodeEQInt (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -53,6 +60,12 @@ Bool TableExprNodeEQInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) == rnode_p->getInt(id);
 }
+void TableExprNodeEQInt::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                       Bool* values)
+{
+    applyBatch<Int64> (id, nrow, values,
+                       [] (Int64 l, Int64 r) -> Bool { return l == r; });
+}
 
 TableExprNodeEQDouble::TableExprNodeEQDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -61,6 +74,12 @@ Bool TableExprNodeEQDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) == rnode_p->getDouble(id);
 }
+void TableExprNodeEQDouble::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                          Bool* values)
+{
+    applyBatch<Double> (id, nrow, values,
+                        [] (Double l, Double r) -> Bool { return l == r; });
+}
 
 TableExprNodeEQDComplex::TableExprNodeEQDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -102,6 +121,12 @@ Bool TableExprNodeNEBool::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) != rnode_p->getBool(id);
 }
+void TableExprNodeNEBool::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                        Bool* values)
+{
+    applyBatch<Bool> (id, nrow, values,
+                      [] (Bool l, Bool r) -> Bool { return l != r; });
+}
 
 TableExprNodeNEInt::TableExprNodeNEInt (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -110,6 +135,12 @@ Bool TableExprNodeNEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) != rnode_p->getInt(id);
 }
+void TableExprNodeNEInt::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                       Bool* values)
+{
+    applyBatch<Int64> (id, nrow, values,
+                       [] (Int64 l, Int64 r) -> Bool { return l != r; });
+}
 
 TableExprNodeNEDouble::TableExprNodeNEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -118,6 +149,12 @@ Bool TableExprNodeNEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) != rnode_p->getDouble(id);
 }
+void TableExprNodeNEDouble::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                          Bool* values)
+{
+    applyBatch<Double> (id, nrow, values,
+                        [] (Double l, Double r) -> Bool { return l != r; });
+}
 
 TableExprNodeNEDComplex::TableExprNodeNEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -159,6 +196,12 @@ Bool TableExprNodeGTInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) > rnode_p->getInt(id);
 }
+void TableExprNodeGTInt::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                       Bool* values)
+{
+    applyBatch<Int64> (id, nrow, values,
+                       [] (Int64 l, Int64 r) -> Bool { return l > r; });
+}
 
 TableExprNodeGTDouble::TableExprNodeGTDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -167,6 +210,12 @@ Bool TableExprNodeGTDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) > rnode_p->getDouble(id);
 }
+void TableExprNodeGTDouble::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                          Bool* values)
+{
+    applyBatch<Double> (id, nrow, values,
+                        [] (Double l, Double r) -> Bool { return l > r; });
+}
 
 TableExprNodeGTDComplex::TableExprNodeGTDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -200,6 +249,12 @@ Bool TableExprNodeGEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) >= rnode_p->getInt(id);
 }
+void TableExprNodeGEInt::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                       Bool* values)
+{
+    applyBatch<Int64> (id, nrow, values,
+                       [] (Int64 l, Int64 r) -> Bool { return l >= r; });
+}
 
 TableExprNodeGEDouble::TableExprNodeGEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -208,6 +263,12 @@ Bool TableExprNodeGEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) >= rnode_p->getDouble(id);
 }
+void TableExprNodeGEDouble::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                          Bool* values)
+{
+    applyBatch<Double> (id, nrow, values,
+                        [] (Double l, Double r) -> Bool { return l >= r; });
+}
 
 TableExprNodeGEDComplex::TableExprNodeGEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -346,6 +407,41 @@ Bool TableExprNodeINDate::getBool (const TableExprId& id)
 }
 
 
+//# Evaluate the second operand of a logical AND (ref=True) or OR (ref=False)
+//# for the rows where the first operand gave ref. Other rows keep their value.
+//# The second operand is never evaluated for the other rows, because the
+//# first operand might be a guard (as in nelements(A)>1 && A[2]>0).
+//# Each run of consecutive rows to evaluate is done as a batch if long
+//# enough; otherwise its rows are evaluated one by one.
+static void evalSecondBatch (TableExprNodeRep* node, const TableExprId& id,
+                             rownr_t nrow, Bool* values, Bool ref)
+{
+    const rownr_t minBatch = 16;
+    TableExprId rowid(id);
+    rownr_t st = 0;
+    while (st < nrow) {
+        if (values[st] != ref) {
+            st++;
+            continue;
+        }
+        rownr_t end = st+1;
+        while (end < nrow  &&  values[end] == ref) {
+            end++;
+        }
+        if (end - st >= minBatch) {
+            rowid.setRownr (id.rownr() + st);
+            node->getBoolBatch (rowid, end-st, values+st);
+        } else {
+            for (rownr_t i=st; i<end; ++i) {
+                rowid.setRownr (id.rownr() + i);
+                values[i] = node->getBool (rowid);
+            }
+        }
+        st = end;
+    }
+}
+
+
 TableExprNodeOR::TableExprNodeOR (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtOR)
 {}
@@ -353,6 +449,13 @@ Bool TableExprNodeOR::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) || rnode_p->getBool(id);
 }
+void TableExprNodeOR::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                    Bool* values)
+{
+    //# Only evaluate the right operand for rows where the left one is False.
+    lnode_p->getBoolBatch (id, nrow, values);
+    evalSecondBatch (rnode_p.get(), id, nrow, values, False);
+}
 
 
 TableExprNodeAND::TableExprNodeAND (const TableExprNodeRep& node)
@@ -362,6 +465,13 @@ Bool TableExprNodeAND::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) && rnode_p->getBool(id);
 }
+void TableExprNodeAND::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                     Bool* values)
+{
+    //# Only evaluate the right operand for rows where the left one is True.
+    lnode_p->getBoolBatch (id, nrow, values);
+    evalSecondBatch (rnode_p.get(), id, nrow, values, True);
+}
 
 
 TableExprNodeNOT::TableExprNodeNOT (const TableExprNodeRep& node)
@@ -371,6 +481,14 @@ Bool TableExprNodeNOT::getBool (const TableExprId& id)
 {
   return ! lnode_p->getBool(id);
 }
+void TableExprNodeNOT::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                     Bool* values)
+{
+    lnode_p->getBoolBatch (id, nrow, values);
+    for (rownr_t i=0; i<nrow; ++i) {
+        values[i] = !values[i];
+    }
+}
 
 
 
@@ -72,6 +72,8 @@ public:
     TableExprNodeEQBool (const TableExprNodeRep&);
     ~TableExprNodeEQBool() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
 };
 
 
@@ -102,6 +104,8 @@ public:
     TableExprNodeEQInt (const TableExprNodeRep&);
     ~TableExprNodeEQInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
 };
 
 
@@ -132,6 +136,8 @@ public:
     TableExprNodeEQDouble (const TableExprNodeRep&);
     ~TableExprNodeEQDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -284,6 +290,8 @@ public:
     TableExprNodeNEBool (const TableExprNodeRep&);
     ~TableExprNodeNEBool() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
 };
 
 
@@ -314,6 +322,8 @@ public:
     TableExprNodeNEInt (const TableExprNodeRep&);
     ~TableExprNodeNEInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
 };
 
 
@@ -344,6 +354,8 @@ public:
     TableExprNodeNEDouble (const TableExprNodeRep&);
     ~TableExprNodeNEDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
 };
 
 
@@ -495,6 +507,8 @@ public:
     TableExprNodeGTInt (const TableExprNodeRep&);
     ~TableExprNodeGTInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
 };
 
 
@@ -525,6 +539,8 @@ public:
     TableExprNodeGTDouble (const TableExprNodeRep&);
     ~TableExprNodeGTDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -647,6 +663,8 @@ public:
     TableExprNodeGEInt (const TableExprNodeRep&);
     ~TableExprNodeGEInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
 };
 
 
@@ -677,6 +695,8 @@ public:
     TableExprNodeGEDouble (const TableExprNodeRep&);
     ~TableExprNodeGEDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -964,6 +984,8 @@ public:
     TableExprNodeOR (const TableExprNodeRep&);
     ~TableExprNodeOR() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -993,6 +1015,8 @@ public:
     TableExprNodeAND (const TableExprNodeRep&);
     ~TableExprNodeAND() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
     void ranges (Block<TableExprRange>&) override;
 };
 
@@ -1022,6 +1046,8 @@ public:
     TableExprNodeNOT (const TableExprNodeRep&);
     ~TableExprNodeNOT() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolBatch (const TableExprId& id, rownr_t nrow,
+                       Bool* values) override;
 };
 
 
@@ -51,6 +51,12 @@ Double TableExprNodePlusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) + rnode_p->getInt(id); }
 DComplex TableExprNodePlusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) + rnode_p->getInt(id)); }
+void TableExprNodePlusInt::getIntBatch (const TableExprId& id, rownr_t nrow,
+                                        Int64* values)
+{
+    applyBatch<Int64> (id, nrow, values,
+                       [] (Int64 l, Int64 r) { return l + r; });
+}
 
 TableExprNodePlusDouble::TableExprNodePlusDouble (const TableExprNodeRep& node)
 : TableExprNodePlus (NTDouble, node)
@@ -61,6 +67,12 @@ Double TableExprNodePlusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
 DComplex TableExprNodePlusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
+void TableExprNodePlusDouble::getDoubleBatch (const TableExprId& id, rownr_t nrow,
+                                              Double* values)
+{
+    applyBatch<Double> (id, nrow, values,
+                        [] (Double l, Double r) { return l + r; });
+}
 
 TableExprNodePlusDComplex::TableExprNodePlusDComplex (const TableExprNodeRep& node)
 : TableExprNodePlus (NTComplex, node)
@@ -123,6 +135,12 @@ Double TableExprNodeMinusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) - rnode_p->getInt(id); }
 DComplex TableExprNodeMinusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) - rnode_p->getInt(id)); }
+void TableExprNodeMinusInt::getIntBatch (const TableExprId& id, rownr_t nrow,
+                                         Int64* values)
+{
+    applyBatch<Int64> (id, nrow, values,
+                       [] (Int64 l, Int64 r) { return l - r; });
+}
 
 TableExprNodeMinusDouble::TableExprNodeMinusDouble (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTDouble, node)
@@ -141,6 +159,12 @@ Double TableExprNodeMinusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
 DComplex TableExprNodeMinusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
+void TableExprNodeMinusDouble::getDoubleBatch (const TableExprId& id, rownr_t nrow,
+                                               Double* values)
+{
+    applyBatch<Double> (id, nrow, values,
+                        [] (Double l, Double r) { return l - r; });
+}
 
 TableExprNodeMinusDComplex::TableExprNodeMinusDComplex (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTComplex, node)
@@ -196,6 +220,12 @@ Double TableExprNodeTimesInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) * rnode_p->getInt(id); }
 DComplex TableExprNodeTimesInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) * rnode_p->getInt(id)); }
+void TableExprNodeTimesInt::getIntBatch (const TableExprId& id, rownr_t nrow,
+                                         Int64* values)
+{
+    applyBatch<Int64> (id, nrow, values,
+                       [] (Int64 l, Int64 r) { return l * r; });
+}
 
 TableExprNodeTimesDouble::TableExprNodeTimesDouble (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTDouble, node)
@@ -206,6 +236,12 @@ Double TableExprNodeTimesDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
 DComplex TableExprNodeTimesDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
+void TableExprNodeTimesDouble::getDoubleBatch (const TableExprId& id, rownr_t nrow,
+                                               Double* values)
+{
+    applyBatch<Double> (id, nrow, values,
+                        [] (Double l, Double r) { return l * r; });
+}
 
 TableExprNodeTimesDComplex::TableExprNodeTimesDComplex (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTComplex, node)
@@ -262,6 +298,12 @@ Double TableExprNodeDivideDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
 DComplex TableExprNodeDivideDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
+void TableExprNodeDivideDouble::getDoubleBatch (const TableExprId& id, rownr_t nrow,
+                                                Double* values)
+{
+    applyBatch<Double> (id, nrow, values,
+                        [] (Double l, Double r) { return l / r; });
+}
 
 TableExprNodeDivideDComplex::TableExprNodeDivideDComplex (const TableExprNodeRep& node)
 : TableExprNodeDivide (NTComplex, node)
@@ -101,6 +101,7 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBatch (const TableExprId& id, rownr_t nrow, Int64* values);
 };
 
 
@@ -133,6 +134,7 @@ public:
     ~TableExprNodePlusDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBatch (const TableExprId& id, rownr_t nrow, Double* values);
 };
 
 
@@ -289,6 +291,7 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBatch (const TableExprId& id, rownr_t nrow, Int64* values);
 };
 
 
@@ -321,6 +324,7 @@ public:
     virtual void handleUnits();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBatch (const TableExprId& id, rownr_t nrow, Double* values);
 };
 
 
@@ -444,6 +448,7 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntBatch (const TableExprId& id, rownr_t nrow, Int64* values);
 };
 
 
@@ -475,6 +480,7 @@ public:
     ~TableExprNodeTimesDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBatch (const TableExprId& id, rownr_t nrow, Double* values);
 };
 
 
@@ -565,6 +571,7 @@ public:
     ~TableExprNodeDivideDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleBatch (const TableExprId& id, rownr_t nrow, Double* values);
 };
 
 
@@ -329,6 +329,23 @@ TENShPtr TableExprNode::setBinaryNodeInfo (TableExprNodeBinary* tsnptr,
   return TableExprNodeRep::replaceConstNode (shPtr);
 }
 
+TENShPtr TableExprNode::setLogicNodeInfo (TableExprNodeBinary* tsnptr,
+                                          const TENShPtr& right) const
+{
+  //# The left operand might be used as a guard for the right one (as in
+  //# isdefined(X) && X>0), so only swap if neither operand can throw.
+  //# Furthermore, only swap if clearly cheaper.
+  if (TableExprNodeUtil::isExceptionFree (node_p.get())  &&
+      TableExprNodeUtil::isExceptionFree (right.get())  &&
+      2 * TableExprNodeUtil::evaluationCost (right.get()) <
+      TableExprNodeUtil::evaluationCost (node_p.get())) {
+    TENShPtr shPtr(tsnptr);
+    tsnptr->setChildren (right, node_p);
+    return TableExprNodeRep::replaceConstNode (shPtr);
+  }
+  return setBinaryNodeInfo (tsnptr, right);
+}
+
 TENShPtr TableExprNode::newPlus (const TENShPtr& right) const
 {
     TableExprNodeRep node = TableExprNodeBinary::getCommonTypes
@@ -932,6 +949,7 @@ TENShPtr TableExprNode::newOR (const TENShPtr& right) const
         default:
             throwInvDT("no Bool operands in logical OR (||)");
         }
+        return setLogicNodeInfo (tsnptr, right);
     }else{
         switch (node.dataType()) {
         case TableExprNodeRep::NTBool:
@@ -957,6 +975,7 @@ TENShPtr TableExprNode::newAND (const TENShPtr& right) const
         default:
             throwInvDT("no Bool operators in logical AND (&&)");
         }
+        return setLogicNodeInfo (tsnptr, right);
     }else{
         switch (node.dataType()) {
         case TableExprNodeRep::NTBool:
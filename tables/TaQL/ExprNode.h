@@ -348,6 +348,14 @@ public:
     Array<DComplex> getArrayDComplex (const TableExprId& id) const;
     Array<String>   getArrayString   (const TableExprId& id) const;
     Array<MVTime>   getArrayDate     (const TableExprId& id) const;
+    // Get the scalar values for <src>nrow</src> consecutive rows starting
+    // at the row given by the id. The values array must have room for
+    // nrow values. It is much faster than getting the values row by row.
+    // <group>
+    void getBatch (const TableExprId& id, rownr_t nrow, Bool* values) const;
+    void getBatch (const TableExprId& id, rownr_t nrow, Int64* values) const;
+    void getBatch (const TableExprId& id, rownr_t nrow, Double* values) const;
+    // </group>
     // Get a value as an array, even it it is a scalar.
     // This is useful in case one can give an argument as scalar or array.
     // <group>
@@ -563,6 +571,15 @@ private:
     TENShPtr setBinaryNodeInfo (TableExprNodeBinary* tsnptr,
                                 const TENShPtr& right=TENShPtr()) const;
 
+    // Same as setBinaryNodeInfo for a scalar logical AND or OR.
+    // If both operands cannot throw an exception and the right operand is
+    // much cheaper to evaluate, the operands are swapped, so the cheap one
+    // is evaluated first and the other one can be skipped if possible.
+    // Otherwise the order given by the user is kept, because the left
+    // operand might guard the right one.
+    TENShPtr setLogicNodeInfo (TableExprNodeBinary* tsnptr,
+                               const TENShPtr& right) const;
+
     // convert Block of TableExprNode to vector of TENShPtr.
     static std::vector<TENShPtr> convertBlockTEN (Block<TableExprNode>& nodes);
 
@@ -590,6 +607,15 @@ inline void TableExprNode::get (const TableExprId& id, TaqlRegex& value) const
     { value = node_p->getRegex (id); }
 inline void TableExprNode::get (const TableExprId& id, MVTime& value) const
     { value = node_p->getDate (id); }
+inline void TableExprNode::getBatch (const TableExprId& id, rownr_t nrow,
+                                     Bool* values) const
+    { node_p->getBoolBatch (id, nrow, values); }
+inline void TableExprNode::getBatch (const TableExprId& id, rownr_t nrow,
+                                     Int64* values) const
+    { node_p->getIntBatch (id, nrow, values); }
+inline void TableExprNode::getBatch (const TableExprId& id, rownr_t nrow,
+                                     Double* values) const
+    { node_p->getDoubleBatch (id, nrow, values); }
 inline void TableExprNode::get (const TableExprId& id,
                                 MArray<Bool>& value) const
     { value = node_p->getArrayBool (id); }
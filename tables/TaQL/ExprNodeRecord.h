@@ -87,6 +87,10 @@ public:
     virtual DComplex getDComplex (const TableExprId& id);
     virtual String   getString   (const TableExprId& id);
 
+    // Get the field numbers defining the field in the (sub)records.
+    const Block<Int>& fieldNumbers() const
+      { return fieldNrs_p; }
+
 protected:
     Block<Int> fieldNrs_p;
     uInt       lastEntry_p;
@@ -135,6 +139,10 @@ public:
     virtual MArray<DComplex> getArrayDComplex (const TableExprId& id);
     virtual MArray<String>   getArrayString   (const TableExprId& id);
 
+    // Get the field numbers defining the field in the (sub)records.
+    const Block<Int>& fieldNumbers() const
+      { return fieldNrs_p; }
+
 protected:
     Block<Int> fieldNrs_p;
     uInt       lastEntry_p;
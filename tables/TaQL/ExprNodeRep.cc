@@ -35,6 +35,8 @@
 #include <casacore/tables/TaQL/MArray.h>
 #include <casacore/tables/TaQL/MArrayLogical.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <vector>
 
 
 
@@ -230,6 +232,53 @@ MVTime TableExprNodeRep::getDate (const TableExprId&)
     TableExprNode::throwInvDT ("(getDate not implemented)");
     return MVTime(0.);
 }
+void TableExprNodeRep::getBoolBatch (const TableExprId& id, rownr_t nrow,
+                                     Bool* values)
+{
+    if (isConstant()) {
+        std::fill (values, values+nrow, getBool(id));
+    } else {
+        TableExprId rowid(id);
+        for (rownr_t i=0; i<nrow; ++i) {
+            rowid.setRownr (id.rownr() + i);
+            values[i] = getBool (rowid);
+        }
+    }
+}
+void TableExprNodeRep::getIntBatch (const TableExprId& id, rownr_t nrow,
+                                    Int64* values)
+{
+    if (isConstant()) {
+        std::fill (values, values+nrow, getInt(id));
+    } else {
+        TableExprId rowid(id);
+        for (rownr_t i=0; i<nrow; ++i) {
+            rowid.setRownr (id.rownr() + i);
+            values[i] = getInt (rowid);
+        }
+    }
+}
+void TableExprNodeRep::getDoubleBatch (const TableExprId& id, rownr_t nrow,
+                                       Double* values)
+{
+    if (isConstant()) {
+        std::fill (values, values+nrow, getDouble(id));
+    } else if (dataType() == NTInt) {
+        // Integer nodes only need to implement getIntBatch.
+        std::vector<Int64> intValues(nrow);
+        getIntBatch (id, nrow, intValues.data());
+        for (rownr_t i=0; i<nrow; ++i) {
+            values[i] = intValues[i];
+        }
+    } else {
+        TableExprId rowid(id);
+        for (rownr_t i=0; i<nrow; ++i) {
+            rowid.setRownr (id.rownr() + i);
+            values[i] = getDouble (rowid);
+        }
+    }
+}
+
 MArray<Bool> TableExprNodeRep::getArrayBool (const TableExprId&)
 {
     TableExprNode::throwInvDT ("(getArrayBool not implemented)");
@@ -32,6 +32,7 @@
 #include <casacore/tables/TaQL/TableExprId.h>
 #include <casacore/tables/TaQL/ExprRange.h>
 #include <casacore/tables/TaQL/MArray.h>
+#include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/Quanta/MVTime.h>
@@ -319,6 +320,28 @@ public:
     virtual MVTime getDate       (const TableExprId& id);
     // </group>
 
+    // Get the scalar values for <src>nrow</src> consecutive rows starting
+    // at the row given by the id (which must be a row number). The values
+    // array must have room for nrow values.
+    // The default implementations evaluate the node once if it is constant,
+    // otherwise row by row using the get functions above. Derived classes
+    // implement them by getting the values of their children in batch
+    // and applying the operator in a tight loop, which the compiler can
+    // vectorize. A column node reads all values in a single call.
+    // A node must not evaluate a child for rows where the row by row
+    // evaluation would not do so, because the child might throw an
+    // exception for such rows. E.g., the right operand of AND and OR is only
+    // evaluated for the rows not decided by the left operand, which can be
+    // a guard as in <src>nelements(A)>1 && A[2]>0</src>.
+    // <group>
+    virtual void getBoolBatch   (const TableExprId& id, rownr_t nrow,
+                                 Bool* values);
+    virtual void getIntBatch    (const TableExprId& id, rownr_t nrow,
+                                 Int64* values);
+    virtual void getDoubleBatch (const TableExprId& id, rownr_t nrow,
+                                 Double* values);
+    // </group>
+
     // Get an array value for this node in the given row.
     // The appropriate functions are implemented in the derived classes and
     // will usually invoke the get in their children and apply the
@@ -633,6 +656,38 @@ protected:
     static const Unit& makeEqualUnits (const TENShPtr& left,
                                        TENShPtr& right);
 
+    // Evaluate both operands for a batch of rows and apply the operator
+    // <src>op</src> in a tight loop (T is the operand type, R the result type).
+    // A constant operand is evaluated once and used as a scalar in the loop.
+    // Because each node class instantiates this function with its own
+    // (inlined) operator, a specialized kernel is generated for the
+    // shapes column-column, column-constant and constant-column.
+    template<typename T, typename R, typename Op>
+    void applyBatch (const TableExprId& id, rownr_t nrow, R* values, Op op);
+
+    // Get the value(s) of a node for the given type.
+    // They are used by applyBatch.
+    // <group>
+    static void getNodeValue (TableExprNodeRep& node, const TableExprId& id,
+                              Bool& value)
+        { value = node.getBool (id); }
+    static void getNodeValue (TableExprNodeRep& node, const TableExprId& id,
+                              Int64& value)
+        { value = node.getInt (id); }
+    static void getNodeValue (TableExprNodeRep& node, const TableExprId& id,
+                              Double& value)
+        { value = node.getDouble (id); }
+    static void getNodeBatch (TableExprNodeRep& node, const TableExprId& id,
+                              rownr_t nrow, Bool* values)
+        { node.getBoolBatch (id, nrow, values); }
+    static void getNodeBatch (TableExprNodeRep& node, const TableExprId& id,
+                              rownr_t nrow, Int64* values)
+        { node.getIntBatch (id, nrow, values); }
+    static void getNodeBatch (TableExprNodeRep& node, const TableExprId& id,
+                              rownr_t nrow, Double* values)
+        { node.getDoubleBatch (id, nrow, values); }
+    // </group>
+
     TENShPtr lnode_p;     //# left operand
     TENShPtr rnode_p;     //# right operand
 };
@@ -762,6 +817,35 @@ inline Int TableExprNodeRep::ndim() const
 inline const IPosition& TableExprNodeRep::shape() const
     { return shape_p; }
 
+template<typename T, typename R, typename Op>
+inline void TableExprNodeBinary::applyBatch (const TableExprId& id,
+                                             rownr_t nrow, R* values, Op op)
+{
+    Block<T> buf(nrow);
+    if (rnode_p->isConstant()) {
+        T right;
+        getNodeValue (*rnode_p, id, right);
+        getNodeBatch (*lnode_p, id, nrow, buf.storage());
+        for (rownr_t i=0; i<nrow; ++i) {
+            values[i] = op (buf[i], right);
+        }
+    } else if (lnode_p->isConstant()) {
+        T left;
+        getNodeValue (*lnode_p, id, left);
+        getNodeBatch (*rnode_p, id, nrow, buf.storage());
+        for (rownr_t i=0; i<nrow; ++i) {
+            values[i] = op (left, buf[i]);
+        }
+    } else {
+        Block<T> right(nrow);
+        getNodeBatch (*lnode_p, id, nrow, buf.storage());
+        getNodeBatch (*rnode_p, id, nrow, right.storage());
+        for (rownr_t i=0; i<nrow; ++i) {
+            values[i] = op (buf[i], right[i]);
+        }
+    }
+}
+
 
 } //# NAMESPACE CASACORE - END
 
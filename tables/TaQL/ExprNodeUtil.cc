@@ -25,6 +25,8 @@
 
 //# Includes
 #include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/tables/TaQL/ExprUDFNode.h>
+#include <casacore/tables/TaQL/ExprUDFNodeArray.h>
 #include <casacore/tables/Tables/TableError.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -114,6 +116,88 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       return nrow;
     }
 
+    Bool isParallelSafe (TableExprNodeRep* node)
+    {
+      std::vector<TableExprNodeRep*> allNodes;
+      node->flattenTree (allNodes);
+      for (auto nodeP : allNodes) {
+        if (nodeP->isConstant()) {
+          continue;
+        }
+        if (nodeP->valueType() != TableExprNodeRep::VTScalar  ||
+            nodeP->isAggregate()  ||
+            nodeP->operType() == TableExprNodeRep::OtRandom  ||
+            nodeP->operType() == TableExprNodeRep::OtField  ||
+            nodeP->getTableInfo().isJoinTable()  ||
+            dynamic_cast<TableExprUDFNode*>(nodeP) != 0) {
+          return False;
+        }
+      }
+      return True;
+    }
+
+    Bool isExceptionFree (TableExprNodeRep* node)
+    {
+      std::vector<TableExprNodeRep*> allNodes;
+      node->flattenTree (allNodes);
+      for (auto nodeP : allNodes) {
+        if (nodeP->isConstant()) {
+          continue;
+        }
+        if (nodeP->valueType() != TableExprNodeRep::VTScalar) {
+          return False;
+        }
+        switch (nodeP->operType()) {
+        case TableExprNodeRep::OtPlus:
+        case TableExprNodeRep::OtMinus:
+        case TableExprNodeRep::OtTimes:
+        case TableExprNodeRep::OtDivide:
+        case TableExprNodeRep::OtBitAnd:
+        case TableExprNodeRep::OtBitOr:
+        case TableExprNodeRep::OtBitXor:
+        case TableExprNodeRep::OtBitNegate:
+        case TableExprNodeRep::OtEQ:
+        case TableExprNodeRep::OtGE:
+        case TableExprNodeRep::OtGT:
+        case TableExprNodeRep::OtNE:
+        case TableExprNodeRep::OtAND:
+        case TableExprNodeRep::OtOR:
+        case TableExprNodeRep::OtNOT:
+        case TableExprNodeRep::OtMIN:
+        case TableExprNodeRep::OtColumn:
+        case TableExprNodeRep::OtRownr:
+          break;
+        default:
+          // E.g., integer modulo by zero, indexing or a function.
+          return False;
+        }
+      }
+      return True;
+    }
+
+    Double evaluationCost (TableExprNodeRep* node)
+    {
+      std::vector<TableExprNodeRep*> allNodes;
+      node->flattenTree (allNodes);
+      Double cost = 0;
+      for (auto nodeP : allNodes) {
+        if (nodeP->isConstant()) {
+          continue;
+        }
+        Double nodeCost = 1;
+        if (dynamic_cast<TableExprUDFNode*>(nodeP) != 0  ||
+            dynamic_cast<TableExprUDFNodeArray*>(nodeP) != 0) {
+          nodeCost = 1000;
+        } else if (nodeP->operType() == TableExprNodeRep::OtFunc) {
+          nodeCost = 5;
+        }
+        if (nodeP->valueType() == TableExprNodeRep::VTArray) {
+          nodeCost *= 10;
+        }
+        cost += nodeCost;
+      }
+      return cost;
+    }
     
   }
 
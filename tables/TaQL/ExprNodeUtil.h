@@ -75,6 +75,31 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the nr of rows in the tables used.
     // An exception is thrown if the tables differ in the nr of rows.
     rownr_t getCheckNRow (const std::vector<Table>&);
+
+    // Can the expression be evaluated by multiple threads simultaneously,
+    // each using its own TableExprId?
+    // That is the case if all nodes are scalar (or constant) and if no
+    // random numbers, user defined functions, aggregates or join tables are
+    // used. Note that column values must still be read by one thread at a
+    // time (see TableExprId::setMutex).
+    Bool isParallelSafe (TableExprNodeRep* node);
+
+    // Can the expression be evaluated for any row without the risk of an
+    // exception (or a crash)? That is the case if all nodes are constants,
+    // scalar columns or scalar operators other than modulo and IN.
+    // Such an expression never needs another operand of a logical AND or OR
+    // to act as a guard (as in <src>nelements(A)>1 && A[2]>0</src>).
+    Bool isExceptionFree (TableExprNodeRep* node);
+
+    // Estimate the relative cost of evaluating the expression for a row.
+    // Constant nodes are free; user defined functions are very expensive,
+    // other functions are more expensive than operators, and array values
+    // cost more than scalars. It is a static estimate; the selectivity of
+    // an expression and indices on columns (such as a persistent
+    // ColumnsIndex) are not taken into account.
+    // It is used to evaluate the cheapest operand of a logical AND or OR
+    // first if both operands are exception free.
+    Double evaluationCost (TableExprNodeRep* node);
 }
   
 
@@ -404,6 +404,35 @@ namespace casacore {
   }
 
 
+  // Define the operations for partialMaskedReduce of the partial ntrues,
+  // etc.
+  // <group>
+  class MPartialNTrueOp : public MPartialOpBase<MPartialNTrueOp> {
+  public:
+    template<typename T>
+    void operator() (size_t& accum, const T& value, Bool valid, size_t) const
+      { accum += (valid  &&  value != T()); }
+  };
+  class MPartialNFalseOp : public MPartialOpBase<MPartialNFalseOp> {
+  public:
+    template<typename T>
+    void operator() (size_t& accum, const T& value, Bool valid, size_t) const
+      { accum += (valid  &&  value == T()); }
+  };
+  class MPartialAllOp : public MPartialOpBase<MPartialAllOp> {
+  public:
+    template<typename T>
+    void operator() (Bool& accum, const T& value, Bool valid, size_t) const
+      { accum = accum  &&  (!valid  ||  value != T()); }
+  };
+  class MPartialAnyOp : public MPartialOpBase<MPartialAnyOp> {
+  public:
+    template<typename T>
+    void operator() (Bool& accum, const T& value, Bool valid, size_t) const
+      { accum = accum  ||  (valid  &&  value != T()); }
+  };
+  // </group>
+
   // Get partial ntrues.
   template<typename T>
   MArray<size_t> partialNTrue (const MArray<T>& a,
@@ -414,9 +443,8 @@ namespace casacore {
     } else if (! a.hasMask()) {
       return MArray<size_t>(partialNTrue (a.array(), collapseAxes));
     }
-    MArray<size_t> res;
-    partialArrayMath (res, a, collapseAxes, MNTrueFunc<T,size_t>());
-    return res;
+    return partialMaskedReduce (a, collapseAxes, size_t(0),
+                                MPartialNTrueOp());
   }
   // Get partial nfalses.
   template<typename T>
@@ -428,9 +456,8 @@ namespace casacore {
     } else if (! a.hasMask()) {
       return MArray<size_t>(partialNFalse (a.array(), collapseAxes));
     }
-    MArray<size_t> res;
-    partialArrayMath (res, a, collapseAxes, MNFalseFunc<T,size_t>());
-    return res;
+    return partialMaskedReduce (a, collapseAxes, size_t(0),
+                                MPartialNFalseOp());
   }
   // Get partial all.
   template<typename T>
@@ -439,14 +466,8 @@ namespace casacore {
   {
     if (a.isNull()) {
       return MArray<Bool>();
-    } else if (! a.hasMask()) {
-      Array<Bool> res;
-      partialArrayMath (res, a.array(), collapseAxes, AllFunc<T>());
-      return MArray<Bool>(res);
     }
-    MArray<Bool> res;
-    partialArrayMath (res, a, collapseAxes, MAllFunc<T>());
-    return res;
+    return partialMaskedReduce (a, collapseAxes, True, MPartialAllOp());
   }
   // Get partial any.
   template<typename T>
@@ -455,14 +476,8 @@ namespace casacore {
   {
     if (a.isNull()) {
       return MArray<Bool>();
-    } else if (! a.hasMask()) {
-      Array<Bool> res;
-      partialArrayMath (res, a.array(), collapseAxes, AnyFunc<T>());
-      return MArray<Bool>(res);
     }
-    MArray<Bool> res;
-    partialArrayMath (res, a, collapseAxes, MAnyFunc<T>());
-    return res;
+    return partialMaskedReduce (a, collapseAxes, False, MPartialAnyOp());
   }
 
   // Get sliding ntrues.
@@ -891,7 +891,75 @@ namespace casacore {
   }
   // </group>
 
+  // Define the operations for partialMaskedReduce of the partial sums, etc.
+  // Sums use the lane kernels for arithmetic types.
+  // <group>
+  template<Bool SQR> class MPartialSumOp
+    : public MPartialOpBase<MPartialSumOp<SQR>> {
+  public:
+    template<typename T>
+    void operator() (T& accum, const T& value, Bool valid, size_t) const
+    {
+      const T v = valid  ?  value : T();
+      accum += SQR  ?  v*v : v;
+    }
+    template<typename T>
+    void cont (T& accum, size_t& nvalid, const T* data, const Bool* mask,
+               size_t n) const
+      { doCont (accum, nvalid, data, mask, n,
+                arrays_internal::UseLaneKernel<T>()); }
+  private:
+    template<typename T>
+    void doCont (T& accum, size_t& nvalid, const T* data, const Bool* mask,
+                 size_t n, std::true_type) const
+    {
+      if (mask) {
+        accum += arrays_internal::laneMaskedSum<SQR> (data, mask, n, nvalid);
+      } else {
+        MPartialOpBase<MPartialSumOp<SQR>>::cont (accum, nvalid, data,
+                                                  mask, n);
+      }
+    }
+    template<typename T>
+    void doCont (T& accum, size_t& nvalid, const T* data, const Bool* mask,
+                 size_t n, std::false_type) const
+      { MPartialOpBase<MPartialSumOp<SQR>>::cont (accum, nvalid, data,
+                                                  mask, n); }
+  };
+  class MPartialProductOp : public MPartialOpBase<MPartialProductOp> {
+  public:
+    template<typename T>
+    void operator() (T& accum, const T& value, Bool valid, size_t) const
+      { accum *= (valid  ?  value : T(1)); }
+  };
+  // Minimum and maximum start with the first unmasked value like
+  // accumulateMasked does.
+  class MPartialMinOp : public MPartialOpBase<MPartialMinOp> {
+  public:
+    template<typename T>
+    void operator() (T& accum, const T& value, Bool valid,
+                     size_t nvalid) const
+    {
+      if (valid) {
+        accum = (nvalid == 0  ?  value : Min<T>()(accum, value));
+      }
+    }
+  };
+  class MPartialMaxOp : public MPartialOpBase<MPartialMaxOp> {
+  public:
+    template<typename T>
+    void operator() (T& accum, const T& value, Bool valid,
+                     size_t nvalid) const
+    {
+      if (valid) {
+        accum = (nvalid == 0  ?  value : Max<T>()(accum, value));
+      }
+    }
+  };
+  // </group>
+
   // Get partial sums, etc.
+  // The functions for an MArray with a mask use partialMaskedReduce.
   // <group>
   template<typename T>
   MArray<T> partialSums (const MArray<T>& a,
@@ -902,7 +970,7 @@ namespace casacore {
     } else if (! a.hasMask()) {
       return MArray<T>(partialSums (a.array(), collapseAxes));
     }
-    return partialArrayMath (a, collapseAxes, MSumFunc<T>());
+    return partialMaskedReduce (a, collapseAxes, T(), MPartialSumOp<False>());
   }
   template<typename T>
   MArray<T> partialSumSqrs (const MArray<T>& a,
@@ -911,10 +979,9 @@ namespace casacore {
     if (a.isNull()) {
       return MArray<T>();
     } else if (! a.hasMask()) {
-      return MArray<T>(partialArrayMath (a.array(), collapseAxes,
-                                         SumSqrFunc<T>()));
+      return MArray<T>(partialSumSqrs (a.array(), collapseAxes));
     }
-    return partialArrayMath (a, collapseAxes, MSumSqrFunc<T>());
+    return partialMaskedReduce (a, collapseAxes, T(), MPartialSumOp<True>());
   }
   template<typename T>
   MArray<T> partialProducts (const MArray<T>& a,
@@ -925,7 +992,7 @@ namespace casacore {
     } else if (! a.hasMask()) {
       return MArray<T>(partialProducts (a.array(), collapseAxes));
     }
-    return partialArrayMath (a, collapseAxes, MProductFunc<T>());
+    return partialMaskedReduce (a, collapseAxes, T(1), MPartialProductOp());
   }
   template<typename T>
   MArray<T> partialMins (const MArray<T>& a,
@@ -936,7 +1003,7 @@ namespace casacore {
     } else if (! a.hasMask()) {
       return MArray<T>(partialMins (a.array(), collapseAxes));
     }
-    return partialArrayMath (a, collapseAxes, MMinFunc<T>());
+    return partialMaskedReduce (a, collapseAxes, T(), MPartialMinOp());
   }
   template<typename T>
   MArray<T> partialMaxs (const MArray<T>& a,
@@ -947,7 +1014,7 @@ namespace casacore {
     } else if (! a.hasMask()) {
       return MArray<T>(partialMaxs (a.array(), collapseAxes));
     }
-    return partialArrayMath (a, collapseAxes, MMaxFunc<T>());
+    return partialMaskedReduce (a, collapseAxes, T(), MPartialMaxOp());
   }
   template<typename T>
   MArray<T> partialMeans (const MArray<T>& a,
@@ -958,7 +1025,18 @@ namespace casacore {
     } else if (! a.hasMask()) {
       return MArray<T>(partialMeans (a.array(), collapseAxes));
     }
-    return partialArrayMath (a, collapseAxes, MMeanFunc<T>());
+    Array<T> result;
+    Array<size_t> nvalid;
+    partialMaskedReduce (result, nvalid, a, collapseAxes, T(),
+                         MPartialSumOp<False>());
+    T* res = result.data();
+    const size_t* nv = nvalid.data();
+    for (size_t i=0; i<result.size(); ++i) {
+      if (nv[i] > 0) {
+        res[i] = T(res[i] / (1.0*nv[i]));
+      }
+    }
+    return makePartialMArray (result, nvalid, True);
   }
   template<typename T>
   MArray<T> partialVariances (const MArray<T>& a,
@@ -28,6 +28,9 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/ArrayMathBase.h>
+#include <casacore/casa/Arrays/ArrayMathKernels.h>
+#include <casacore/casa/Arrays/ArrayUtil.h>
+#include <casacore/casa/Arrays/Array.h>
 
 namespace casacore {
 
@@ -55,6 +58,9 @@ namespace casacore {
   // code bloat when used in functions like partialArrayMath. Because a
   // reduction operation usually takes much more time than the call, using
   // virtual functions hardly imposes a performance penalty.
+  // <br>The simple partial reductions (like partialSums) do not use those
+  // functors, but the templated function partialMaskedReduce which applies
+  // the mask while traversing the data linearly.
   // </synopsis>
 
 
@@ -264,6 +270,167 @@ namespace casacore {
     virtual RES operator() (const MArray<T>&) const = 0;
   };
 
+
+  // Define the base class for the operations used by partialMaskedReduce.
+  // A derived class OP must define the function
+  // <src>void operator() (RES& accum, const T& value, Bool valid,
+  // size_t nvalid) const</src>, which adds the value to the accumulator
+  // if valid (i.e., not masked off). <src>nvalid</src> is the number of
+  // valid values already added. The function should select instead of
+  // branch as much as possible, so the compiler can vectorize the loops.
+  // <br>The function <src>cont</src> reduces a contiguous run of values
+  // into a single accumulator. A null mask pointer means that all values
+  // are valid. A derived class can define its own version (e.g., using
+  // lane kernels).
+  template<typename OP> class MPartialOpBase {
+  public:
+    template<typename T, typename RES>
+    void cont (RES& accum, size_t& nvalid, const T* data, const Bool* mask,
+               size_t n) const
+    {
+      const OP& op = static_cast<const OP&>(*this);
+      RES acc = accum;
+      size_t nv = nvalid;
+      if (mask) {
+        for (size_t i=0; i<n; ++i) {
+          Bool valid = !mask[i];
+          op (acc, data[i], valid, nv);
+          nv += valid;
+        }
+      } else {
+        for (size_t i=0; i<n; ++i) {
+          op (acc, data[i], True, nv);
+          ++nv;
+        }
+      }
+      accum  = acc;
+      nvalid = nv;
+    }
+  };
+
+  // Reduce the unmasked values of an MArray over the collapse axes using
+  // the given operation (derived from MPartialOpBase). The accumulators
+  // are initialized with <src>init</src>. For each result element,
+  // <src>nvalid</src> gets the number of unmasked values reduced.
+  // <br>Like <src>partialSums</src> for an Array, it traverses the data
+  // linearly, thus without creating an MArray object per result element
+  // as <src>partialArrayMath</src> does. It also means that the operation
+  // is fused with the masking.
+  template<typename T, typename RES, typename OP>
+  void partialMaskedReduce (Array<RES>& result, Array<size_t>& nvalid,
+                            const MArray<T>& a,
+                            const IPosition& collapseAxes,
+                            const RES& init, const OP& op)
+  {
+    const IPosition& shape = a.shape();
+    size_t ndim = shape.size();
+    if (ndim == 0) {
+      result.resize();
+      nvalid.resize();
+      return;
+    }
+    IPosition resShape, incr;
+    int nelemCont = 0;
+    size_t stax = partialFuncHelper (nelemCont, resShape, incr, shape,
+                                     collapseAxes);
+    result.resize (resShape, False);
+    result = init;
+    nvalid.resize (resShape, False);
+    nvalid = size_t(0);
+    Array<T> arr (a.array().contiguousStorage() ?
+                  a.array() : a.array().copy());
+    Array<Bool> marr;
+    if (a.hasMask()) {
+      marr.reference (a.mask().contiguousStorage() ?
+                      a.mask() : a.mask().copy());
+    }
+    const T* data = arr.data();
+    const Bool* mask = (a.hasMask()  ?  marr.data() : 0);
+    RES* res = result.data();
+    size_t* nv = nvalid.data();
+    // See partialSums in ArrayPartMath.tcc for the traversal.
+    bool cont = true;
+    size_t n0 = nelemCont;
+    ssize_t incr0 = incr[0];
+    if (nelemCont <= 1) {
+      cont = false;
+      n0 = shape[0];
+      stax = 1;
+    }
+    ssize_t r = 0;
+    IPosition pos(ndim, 0);
+    while (true) {
+      if (cont) {
+        op.cont (res[r], nv[r], data, mask, n0);
+      } else if (mask) {
+        for (size_t i=0; i<n0; ++i) {
+          Bool valid = !mask[i];
+          op (res[r], data[i], valid, nv[r]);
+          nv[r] += valid;
+          r += incr0;
+        }
+      } else {
+        for (size_t i=0; i<n0; ++i) {
+          op (res[r], data[i], True, nv[r]);
+          ++nv[r];
+          r += incr0;
+        }
+      }
+      data += n0;
+      if (mask) {
+        mask += n0;
+      }
+      size_t ax;
+      for (ax=stax; ax<ndim; ++ax) {
+        r += incr[ax];
+        if (++pos[ax] < shape[ax]) {
+          break;
+        }
+        pos[ax] = 0;
+      }
+      if (ax == ndim) {
+        break;
+      }
+    }
+  }
+
+  // Make an MArray from the result of partialMaskedReduce. If the input
+  // array has a mask, a result element is masked off if it has no
+  // unmasked values; its value is then set to <src>RES()</src>.
+  template<typename RES>
+  MArray<RES> makePartialMArray (Array<RES>& result,
+                                 const Array<size_t>& nvalid,
+                                 Bool hasMask)
+  {
+    if (! hasMask) {
+      return MArray<RES>(result);
+    }
+    Array<Bool> resMask(result.shape());
+    RES* res = result.data();
+    Bool* mask = resMask.data();
+    const size_t* nv = nvalid.data();
+    size_t n = result.size();
+    for (size_t i=0; i<n; ++i) {
+      mask[i] = (nv[i] == 0);
+      if (mask[i]) {
+        res[i] = RES();
+      }
+    }
+    return MArray<RES>(result, resMask);
+  }
+
+  // Do partialMaskedReduce and make the resulting MArray.
+  template<typename T, typename RES, typename OP>
+  MArray<RES> partialMaskedReduce (const MArray<T>& a,
+                                   const IPosition& collapseAxes,
+                                   const RES& init, const OP& op)
+  {
+    Array<RES> result;
+    Array<size_t> nvalid;
+    partialMaskedReduce (result, nvalid, a, collapseAxes, init, op);
+    return makePartialMArray (result, nvalid, a.hasMask());
+  }
+
   // </group>
 
 } //# end namespace
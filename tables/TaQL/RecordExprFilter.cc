@@ -0,0 +1,489 @@
+//# RecordExprFilter.cc: Record selection expression compiled for a fixed description
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/tables/TaQL/RecordExprFilter.h>
+#include <casacore/tables/TaQL/ExprNodeRecord.h>
+#include <casacore/tables/TaQL/RecordGram.h>
+#include <casacore/tables/TaQL/TableExprData.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Containers/RecordField.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Vector.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+
+  // Get a pointer to the value of a field.
+  template<typename T>
+  inline const void* fieldPtr (const RecordInterface& record, Int fieldNr)
+  {
+    return &(RORecordFieldPtr<T>(record, fieldNr).get());
+  }
+
+  // Get the array a field pointer points to.
+  template<typename T>
+  inline const Array<T>& arrayField (const void* data)
+  {
+    return *static_cast<const Array<T>*>(data);
+  }
+
+  // Convert an array to another type.
+  template<typename T, typename U>
+  inline Array<T> convertField (const Array<U>& in)
+  {
+    Array<T> out(in.shape());
+    convertArray (out, in);
+    return out;
+  }
+
+} //# end anonymous namespace
+
+
+// The fields used in the expression with a pointer to their value in the
+// record being evaluated.
+class RecordExprFilter::FieldData : public TableExprData
+{
+public:
+  struct Field
+  {
+    Block<Int>  fieldNrs;
+    DataType    dtype;
+    Bool        variable;     //# type taken from each record?
+    const void* data;
+  };
+
+  explicit FieldData (uInt nfields)
+    : itsNFields (nfields)
+  {}
+
+  ~FieldData() override
+  {}
+
+  uInt nfields() const
+    { return itsFields.size(); }
+
+  // Add a field if not used yet. Its type is taken from the description.
+  // A subrecord with a variable structure has an empty description, so
+  // then the type is taken from each record.
+  void addField (const Block<Int>& fieldNrs, const RecordDesc& desc)
+  {
+    if (find (fieldNrs)) {
+      return;
+    }
+    const RecordDesc* descPtr = &desc;
+    uInt last = fieldNrs.nelements() - 1;
+    for (uInt i=0; i<=last; ++i) {
+      if (fieldNrs[i] < 0  ||  fieldNrs[i] >= Int(descPtr->nfields())  ||
+          (i < last  &&  !descPtr->isSubRecord (fieldNrs[i]))) {
+        throw TableInvExpr ("RecordExprFilter: a field in the expression "
+                            "is not part of the record description");
+      }
+      if (i < last) {
+        descPtr = &(descPtr->subRecord (fieldNrs[i]));
+        if (descPtr->nfields() == 0) {
+          itsFields.push_back (Field{fieldNrs, TpOther, True, nullptr});
+          return;
+        }
+      }
+    }
+    itsFields.push_back (Field{fieldNrs, descPtr->type(fieldNrs[last]),
+                               False, nullptr});
+  }
+
+  // Get the pointers to the field values in the record.
+  void attach (const RecordInterface& record)
+  {
+    if (record.nfields() != itsNFields) {
+      throw TableInvExpr ("RecordExprFilter: the record does not have the "
+                          "description of the filter");
+    }
+    for (Field& fld : itsFields) {
+      const RecordInterface* recPtr = &record;
+      uInt last = fld.fieldNrs.nelements() - 1;
+      for (uInt i=0; i<last; ++i) {
+        recPtr = &(recPtr->asRecord (fld.fieldNrs[i]));
+      }
+      if (fld.variable) {
+        fld.dtype = recPtr->type (fld.fieldNrs[last]);
+      }
+      fld.data = pointer (*recPtr, fld.fieldNrs[last], fld.dtype);
+    }
+  }
+
+  IPosition shape (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    switch (fld.dtype) {
+    case TpArrayBool:
+      return arrayField<Bool>(fld.data).shape();
+    case TpArrayUChar:
+      return arrayField<uChar>(fld.data).shape();
+    case TpArrayShort:
+      return arrayField<Short>(fld.data).shape();
+    case TpArrayInt:
+      return arrayField<Int>(fld.data).shape();
+    case TpArrayUInt:
+      return arrayField<uInt>(fld.data).shape();
+    case TpArrayInt64:
+      return arrayField<Int64>(fld.data).shape();
+    case TpArrayFloat:
+      return arrayField<Float>(fld.data).shape();
+    case TpArrayDouble:
+      return arrayField<Double>(fld.data).shape();
+    case TpArrayComplex:
+      return arrayField<Complex>(fld.data).shape();
+    case TpArrayDComplex:
+      return arrayField<DComplex>(fld.data).shape();
+    case TpArrayString:
+      return arrayField<String>(fld.data).shape();
+    default:
+      return IPosition();
+    }
+  }
+
+  DataType dataType (const Block<Int>& fieldNrs) const override
+  {
+    const Field* fld = find (fieldNrs);
+    return fld  ?  fld->dtype : TpOther;
+  }
+
+  Bool getBool (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    if (fld.dtype == TpBool) {
+      return *static_cast<const Bool*>(fld.data);
+    }
+    return TableExprData::getBool (fieldNrs);
+  }
+
+  Int64 getInt (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    switch (fld.dtype) {
+    case TpUChar:
+      return *static_cast<const uChar*>(fld.data);
+    case TpShort:
+      return *static_cast<const Short*>(fld.data);
+    case TpInt:
+      return *static_cast<const Int*>(fld.data);
+    case TpUInt:
+      return *static_cast<const uInt*>(fld.data);
+    case TpInt64:
+      return *static_cast<const Int64*>(fld.data);
+    default:
+      return TableExprData::getInt (fieldNrs);
+    }
+  }
+
+  Double getDouble (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    switch (fld.dtype) {
+    case TpFloat:
+      return *static_cast<const Float*>(fld.data);
+    case TpDouble:
+      return *static_cast<const Double*>(fld.data);
+    default:
+      return getInt (fieldNrs);
+    }
+  }
+
+  DComplex getDComplex (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    switch (fld.dtype) {
+    case TpComplex:
+      return *static_cast<const Complex*>(fld.data);
+    case TpDComplex:
+      return *static_cast<const DComplex*>(fld.data);
+    default:
+      return getDouble (fieldNrs);
+    }
+  }
+
+  String getString (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    if (fld.dtype == TpString) {
+      return *static_cast<const String*>(fld.data);
+    }
+    return TableExprData::getString (fieldNrs);
+  }
+
+  Array<Bool> getArrayBool (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    if (fld.dtype == TpArrayBool) {
+      return arrayField<Bool>(fld.data);
+    }
+    return TableExprData::getArrayBool (fieldNrs);
+  }
+
+  Array<Int64> getArrayInt (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    switch (fld.dtype) {
+    case TpArrayUChar:
+      return convertField<Int64> (arrayField<uChar>(fld.data));
+    case TpArrayShort:
+      return convertField<Int64> (arrayField<Short>(fld.data));
+    case TpArrayInt:
+      return convertField<Int64> (arrayField<Int>(fld.data));
+    case TpArrayUInt:
+      return convertField<Int64> (arrayField<uInt>(fld.data));
+    case TpArrayInt64:
+      return arrayField<Int64>(fld.data);
+    default:
+      return TableExprData::getArrayInt (fieldNrs);
+    }
+  }
+
+  Array<Double> getArrayDouble (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    switch (fld.dtype) {
+    case TpArrayFloat:
+      return convertField<Double> (arrayField<Float>(fld.data));
+    case TpArrayDouble:
+      return arrayField<Double>(fld.data);
+    default:
+      return convertField<Double> (getArrayInt (fieldNrs));
+    }
+  }
+
+  Array<DComplex> getArrayDComplex (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    switch (fld.dtype) {
+    case TpArrayComplex:
+      return convertField<DComplex> (arrayField<Complex>(fld.data));
+    case TpArrayDComplex:
+      return arrayField<DComplex>(fld.data);
+    default:
+      return convertField<DComplex> (getArrayDouble (fieldNrs));
+    }
+  }
+
+  Array<String> getArrayString (const Block<Int>& fieldNrs) const override
+  {
+    const Field& fld = get (fieldNrs);
+    if (fld.dtype == TpArrayString) {
+      return arrayField<String>(fld.data);
+    }
+    return TableExprData::getArrayString (fieldNrs);
+  }
+
+private:
+  // Find a field; a null pointer is returned if not found.
+  // Usually the expression uses only a few fields, so a linear search
+  // is fast enough.
+  const Field* find (const Block<Int>& fieldNrs) const
+  {
+    for (const Field& fld : itsFields) {
+      if (fld.fieldNrs.nelements() == fieldNrs.nelements()) {
+        Bool equal = True;
+        for (uInt i=0; i<fieldNrs.nelements(); ++i) {
+          if (fld.fieldNrs[i] != fieldNrs[i]) {
+            equal = False;
+            break;
+          }
+        }
+        if (equal) {
+          return &fld;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  const Field& get (const Block<Int>& fieldNrs) const
+  {
+    const Field* fld = find (fieldNrs);
+    if (! fld) {
+      throw TableInvExpr ("RecordExprFilter: unknown field used");
+    }
+    return *fld;
+  }
+
+  // Get the pointer to the value of a field with the given type.
+  static const void* pointer (const RecordInterface& record, Int fieldNr,
+                              DataType dtype)
+  {
+    switch (dtype) {
+    case TpBool:
+      return fieldPtr<Bool> (record, fieldNr);
+    case TpUChar:
+      return fieldPtr<uChar> (record, fieldNr);
+    case TpShort:
+      return fieldPtr<Short> (record, fieldNr);
+    case TpInt:
+      return fieldPtr<Int> (record, fieldNr);
+    case TpUInt:
+      return fieldPtr<uInt> (record, fieldNr);
+    case TpInt64:
+      return fieldPtr<Int64> (record, fieldNr);
+    case TpFloat:
+      return fieldPtr<Float> (record, fieldNr);
+    case TpDouble:
+      return fieldPtr<Double> (record, fieldNr);
+    case TpComplex:
+      return fieldPtr<Complex> (record, fieldNr);
+    case TpDComplex:
+      return fieldPtr<DComplex> (record, fieldNr);
+    case TpString:
+      return fieldPtr<String> (record, fieldNr);
+    case TpArrayBool:
+      return fieldPtr<Array<Bool>> (record, fieldNr);
+    case TpArrayUChar:
+      return fieldPtr<Array<uChar>> (record, fieldNr);
+    case TpArrayShort:
+      return fieldPtr<Array<Short>> (record, fieldNr);
+    case TpArrayInt:
+      return fieldPtr<Array<Int>> (record, fieldNr);
+    case TpArrayUInt:
+      return fieldPtr<Array<uInt>> (record, fieldNr);
+    case TpArrayInt64:
+      return fieldPtr<Array<Int64>> (record, fieldNr);
+    case TpArrayFloat:
+      return fieldPtr<Array<Float>> (record, fieldNr);
+    case TpArrayDouble:
+      return fieldPtr<Array<Double>> (record, fieldNr);
+    case TpArrayComplex:
+      return fieldPtr<Array<Complex>> (record, fieldNr);
+    case TpArrayDComplex:
+      return fieldPtr<Array<DComplex>> (record, fieldNr);
+    case TpArrayString:
+      return fieldPtr<Array<String>> (record, fieldNr);
+    default:
+      throw TableInvExpr ("RecordExprFilter: field has an invalid data type");
+    }
+  }
+
+  std::vector<Field> itsFields;
+  uInt               itsNFields;
+};
+
+
+RecordExprFilter::RecordExprFilter (const RecordDesc& desc,
+                                    const String& expression)
+  : itsExpr (RecordGram::parse (Record(desc), expression))
+{
+  init (desc);
+}
+
+RecordExprFilter::RecordExprFilter (const RecordDesc& desc,
+                                    const TableExprNode& expression)
+  : itsExpr (expression)
+{
+  init (desc);
+}
+
+RecordExprFilter::~RecordExprFilter()
+{}
+
+void RecordExprFilter::init (const RecordDesc& desc)
+{
+  if (itsExpr.isNull()  ||  itsExpr.dataType() != TpBool  ||
+      !itsExpr.isScalar()) {
+    throw TableInvExpr ("RecordExprFilter: the expression must result in "
+                        "a scalar bool value");
+  }
+  itsData.reset (new FieldData (desc.nfields()));
+  std::vector<TableExprNodeRep*> nodes;
+  itsExpr.getRep()->flattenTree (nodes);
+  for (TableExprNodeRep* node : nodes) {
+    TableExprNodeRecordField* fld =
+      dynamic_cast<TableExprNodeRecordField*>(node);
+    if (fld) {
+      itsData->addField (fld->fieldNumbers(), desc);
+    } else {
+      TableExprNodeRecordFieldArray* arr =
+        dynamic_cast<TableExprNodeRecordFieldArray*>(node);
+      if (arr) {
+        itsData->addField (arr->fieldNumbers(), desc);
+      }
+    }
+  }
+}
+
+uInt RecordExprFilter::nfields() const
+{
+  return itsData->nfields();
+}
+
+Bool RecordExprFilter::matches (const RecordInterface& record)
+{
+  itsData->attach (record);
+  Bool result;
+  itsExpr.get (TableExprId(*itsData), result);
+  return result;
+}
+
+Vector<Bool> RecordExprFilter::matches
+(const std::vector<const RecordInterface*>& records)
+{
+  Vector<Bool> result(records.size());
+  TableExprId id(*itsData);
+  for (size_t i=0; i<records.size(); ++i) {
+    itsData->attach (*records[i]);
+    itsExpr.get (id, result[i]);
+  }
+  return result;
+}
+
+Vector<Bool> RecordExprFilter::matches (const std::vector<Record>& records)
+{
+  Vector<Bool> result(records.size());
+  TableExprId id(*itsData);
+  for (size_t i=0; i<records.size(); ++i) {
+    itsData->attach (records[i]);
+    itsExpr.get (id, result[i]);
+  }
+  return result;
+}
+
+std::vector<size_t> RecordExprFilter::select
+(const std::vector<const RecordInterface*>& records)
+{
+  std::vector<size_t> rows;
+  TableExprId id(*itsData);
+  Bool match;
+  for (size_t i=0; i<records.size(); ++i) {
+    itsData->attach (*records[i]);
+    itsExpr.get (id, match);
+    if (match) {
+      rows.push_back (i);
+    }
+  }
+  return rows;
+}
+
+
+} //# NAMESPACE CASACORE - END
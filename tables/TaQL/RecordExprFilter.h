@@ -0,0 +1,156 @@
+//# RecordExprFilter.h: Record selection expression compiled for a fixed description
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef TABLES_RECORDEXPRFILTER_H
+#define TABLES_RECORDEXPRFILTER_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/casa/Containers/RecordDesc.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <memory>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Record;
+class RecordInterface;
+
+
+// <summary>
+// Record selection expression compiled for a fixed description
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tRecordExprFilter">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto group=RecordExpr.h#RecordExpr>makeRecordExpr</linkto>
+//   <li> <linkto class=TableExprData>TableExprData</linkto>
+// </prerequisite>
+
+// <synopsis>
+// A selection expression on records (made by
+// <linkto class=RecordGram>RecordGram</linkto> or
+// <linkto group=RecordExpr.h#RecordExpr>makeRecordExpr</linkto>) is
+// evaluated directly on a record by getting the value of a field each
+// time the field is used in the expression. Each get goes through the
+// virtual functions of <linkto class=RecordInterface>RecordInterface</linkto>
+// to check the field number and type and to convert the value.
+// <br>RecordExprFilter compiles such an expression for records with a
+// fixed description. The data types of the fields used in the expression
+// are determined once. When evaluating a record, a pointer to the value of
+// each used field is obtained once, after which the expression reads
+// the values directly through the pointers (using a
+// <linkto class=TableExprData>TableExprData</linkto> object).
+// <br>A record to be filtered must have the description given to the
+// constructor. Only the number of fields and the types of the fields
+// used in the expression are checked.
+// <br>The functions taking a vector of records evaluate the filter for
+// many records in a single call.
+// <br>A RecordExprFilter object is not thread-safe; use a separate
+// object per thread.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   // Select the messages of antennas 3 and 5 with a large amplitude.
+//   RecordExprFilter filter (msg.description(),
+//                            "ANTENNA in [3,5] && AMP > 10");
+//   while (bus.receive (msg)) {
+//     if (filter.matches (msg)) {
+//       ...
+//     }
+//   }
+// </srcblock>
+// </example>
+
+// <motivation>
+// Message buses filtering a high rate of records spend most time in the
+// field access of the expression evaluation.
+// </motivation>
+
+class RecordExprFilter
+{
+public:
+  // Make the filter from an expression string (see
+  // <linkto class=RecordGram>RecordGram</linkto>) for records with the given
+  // description.
+  RecordExprFilter (const RecordDesc& desc, const String& expression);
+
+  // Make the filter from an expression made for records with the given
+  // description (using <src>makeRecordExpr</src>).
+  RecordExprFilter (const RecordDesc& desc, const TableExprNode& expression);
+
+  ~RecordExprFilter();
+
+  // Copying is not possible.
+  // <group>
+  RecordExprFilter (const RecordExprFilter&) = delete;
+  RecordExprFilter& operator= (const RecordExprFilter&) = delete;
+  // </group>
+
+  // Get the expression.
+  const TableExprNode& node() const
+    { return itsExpr; }
+
+  // Get the number of (sub)record fields used in the expression.
+  uInt nfields() const;
+
+  // Does the record match the filter?
+  // An exception is thrown if the record does not have the description.
+  Bool matches (const RecordInterface& record);
+
+  // Evaluate the filter for each record.
+  // <group>
+  Vector<Bool> matches (const std::vector<const RecordInterface*>& records);
+  Vector<Bool> matches (const std::vector<Record>& records);
+  // </group>
+
+  // Get the indices of the records matching the filter.
+  std::vector<size_t> select
+    (const std::vector<const RecordInterface*>& records);
+
+private:
+  // The TableExprData object giving the field values of a record.
+  class FieldData;
+
+  // Find the fields used in the expression and check the expression.
+  void init (const RecordDesc& desc);
+
+  TableExprNode              itsExpr;
+  std::unique_ptr<FieldData> itsData;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,155 @@
+//# TaQLCursor.cc: Deliver the result of a TaQL selection in batches of rows
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/TaQL/TaQLCursor.h>
+#include <casacore/tables/TaQL/ExprNodeRep.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <vector>
+#include <algorithm>
+
+namespace casacore {
+
+TaQLCursor::TaQLCursor (const Table& table, const TableExprNode& where,
+                        const Block<String>& oldNames,
+                        const Block<String>& newNames,
+                        rownr_t offset, rownr_t endrow, rownr_t stride,
+                        rownr_t batchSize)
+  : itsTable     (table),
+    itsWhere     (where),
+    itsOldNames  (oldNames),
+    itsNewNames  (newNames),
+    itsStreaming (True),
+    itsOffset    (offset),
+    itsEndRow    (endrow),
+    itsStride    (std::max (stride, rownr_t(1))),
+    itsBatchSize (std::max (batchSize, rownr_t(1)))
+{
+  AlwaysAssert (itsOldNames.size() == itsNewNames.size(), AipsError);
+  if (! itsWhere.isNull()) {
+    if (itsWhere.dataType() != TpBool  ||  !itsWhere.isScalar()) {
+      throw TableInvExpr ("WHERE expression of a TaQL cursor "
+                          "is not a Bool scalar");
+    }
+  }
+  reset();
+}
+
+TaQLCursor::TaQLCursor (const Table& result, rownr_t batchSize)
+  : itsTable     (result),
+    itsStreaming (False),
+    itsOffset    (0),
+    itsEndRow    (0),
+    itsStride    (1),
+    itsBatchSize (std::max (batchSize, rownr_t(1)))
+{
+  reset();
+}
+
+void TaQLCursor::reset()
+{
+  itsSrcRow  = 0;
+  itsNrMatch = 0;
+  itsNrDone  = 0;
+  itsAtEnd   = False;
+  itsRownrs.resize (0);
+  itsBatch   = Table();
+}
+
+Bool TaQLCursor::next()
+{
+  if (itsAtEnd) {
+    return False;
+  }
+  if (itsStreaming) {
+    fillStreaming();
+  } else {
+    rownr_t nrow = itsTable.nrow();
+    rownr_t nr = std::min (itsBatchSize, nrow - itsSrcRow);
+    itsRownrs.resize (nr);
+    indgen (itsRownrs, itsSrcRow);
+    itsSrcRow += nr;
+  }
+  if (itsRownrs.empty()) {
+    itsAtEnd = True;
+    itsBatch = Table();
+    return False;
+  }
+  itsNrDone += itsRownrs.size();
+  itsBatch = itsTable(itsRownrs);
+  if (itsStreaming  &&  itsOldNames.size() > 0) {
+    itsBatch = itsBatch.project (itsOldNames);
+    for (uInt i=0; i<itsNewNames.size(); ++i) {
+      if (itsNewNames[i] != itsOldNames[i]) {
+        itsBatch.renameColumn (itsNewNames[i], itsOldNames[i]);
+      }
+    }
+  }
+  return True;
+}
+
+void TaQLCursor::fillStreaming()
+{
+  std::vector<rownr_t> rows;
+  rows.reserve (itsBatchSize);
+  rownr_t nrow = itsTable.nrow();
+  TableExprId id;
+  // Evaluate the expression in chunks of at most the batch size.
+  while (rows.size() < itsBatchSize  &&  itsSrcRow < nrow) {
+    if (itsEndRow > 0  &&  itsNrMatch >= itsEndRow) {
+      break;
+    }
+    rownr_t nr = std::min (itsBatchSize - rownr_t(rows.size()), nrow - itsSrcRow);
+    if (! itsWhere.isNull()) {
+      if (itsValues.size() < nr) {
+        itsValues.resize (itsBatchSize);
+      }
+      id.setRownr (itsSrcRow);
+      itsWhere.getBatch (id, nr, itsValues.storage());
+    }
+    rownr_t j = 0;
+    for (; j<nr; ++j) {
+      if (itsWhere.isNull()  ||  itsValues[j]) {
+        // Apply offset, stride and limit on the matching rows.
+        if (itsNrMatch >= itsOffset  &&
+            (itsNrMatch - itsOffset) % itsStride == 0) {
+          rows.push_back (itsSrcRow + j);
+        }
+        itsNrMatch++;
+        if (itsEndRow > 0  &&  itsNrMatch >= itsEndRow) {
+          ++j;
+          break;
+        }
+      }
+    }
+    itsSrcRow += j;
+  }
+  itsRownrs.resize (rows.size());
+  std::copy (rows.begin(), rows.end(), itsRownrs.begin());
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,158 @@
+//# TaQLCursor.h: Deliver the result of a TaQL selection in batches of rows
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TAQLCURSOR_H
+#define TABLES_TAQLCURSOR_H
+
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Arrays/Vector.h>
+
+namespace casacore {
+
+// <summary>
+// Deliver the result of a TaQL selection in batches of rows.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTaQLCursor">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TaQLResult>TaQLResult</linkto>
+//   <li> <linkto class=TableExprNode>TableExprNode</linkto>
+// </prerequisite>
+
+// <synopsis>
+// A TaQLCursor iterates over the result of a TaQL SELECT command in batches
+// of rows. Each call of <src>next</src> makes the next batch available as a
+// reference table containing at most <src>batchSize</src> rows.
+// <br>If the query has no ORDERBY, GROUPBY, aggregation, DISTINCT, GIVING, or
+// projection expressions, the WHERE expression is evaluated incrementally
+// on the next part of the source table, so the full selection never has to
+// be materialized. A LIMIT/OFFSET/stride (if given) is applied on the fly
+// and evaluation stops as soon as the limit is reached.
+// <br>Other queries are fully executed beforehand; in that case the cursor
+// merely returns the rows of the resulting table in batches, so the
+// consumer can use the same interface for every SELECT command.
+// <br>A cursor is usually obtained using the global function
+// <src>tableCursor</src>, which returns it in a
+// <linkto class=TaQLResult>TaQLResult</linkto> object.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   TaQLResult res = tableCursor ("select col1 from my.ms where col2 > 3");
+//   TaQLCursor& cursor = res.cursor();
+//   while (cursor.next()) {
+//     ScalarColumn<Int> col(cursor.batch(), "col1");
+//     Vector<Int> vals = col.getColumn();
+//   }
+// </srcblock>
+// </example>
+
+// <motivation>
+// Selecting from a large table can result in a large row number vector,
+// while the consumer often processes the rows sequentially or only needs
+// the first few of them.
+// </motivation>
+
+class TaQLCursor
+{
+public:
+  // Create a cursor evaluating the WHERE expression incrementally on the
+  // source table. The projection is done with the old column names, which
+  // are renamed to the new ones (both can be empty meaning no projection).
+  // An endrow of 0 means no limit.
+  TaQLCursor (const Table& table, const TableExprNode& where,
+              const Block<String>& oldNames, const Block<String>& newNames,
+              rownr_t offset, rownr_t endrow, rownr_t stride,
+              rownr_t batchSize);
+
+  // Create a cursor returning the rows of an already evaluated table.
+  TaQLCursor (const Table& result, rownr_t batchSize);
+
+  // Is the selection evaluated incrementally?
+  Bool isStreaming() const
+    { return itsStreaming; }
+
+  // Get the batch size.
+  rownr_t batchSize() const
+    { return itsBatchSize; }
+
+  // Make the next batch of rows available.
+  // It returns False if no more rows are available.
+  Bool next();
+
+  // Get the current batch of rows as a reference table.
+  const Table& batch() const
+    { return itsBatch; }
+
+  // Get the row numbers of the current batch in the source table.
+  const Vector<rownr_t>& rowNumbers() const
+    { return itsRownrs; }
+
+  // Get the number of result rows delivered so far (including current batch).
+  rownr_t nrowDone() const
+    { return itsNrDone; }
+
+  // Has the end of the result been reached?
+  Bool atEnd() const
+    { return itsAtEnd; }
+
+  // Restart the iteration from the beginning.
+  void reset();
+
+private:
+  // Evaluate the WHERE expression on the next part of the source table
+  // until a full batch of rows is found or the end is reached.
+  void fillStreaming();
+
+  Table           itsTable;       //# source table (or result if not streaming)
+  TableExprNode   itsWhere;
+  Block<String>   itsOldNames;
+  Block<String>   itsNewNames;
+  Bool            itsStreaming;
+  rownr_t         itsOffset;
+  rownr_t         itsEndRow;
+  rownr_t         itsStride;
+  rownr_t         itsBatchSize;
+  rownr_t         itsSrcRow;      //# next source row to evaluate
+  rownr_t         itsNrMatch;     //# nr of rows matching WHERE so far
+  rownr_t         itsNrDone;      //# nr of rows delivered so far
+  Bool            itsAtEnd;
+  Block<Bool>     itsValues;
+  Vector<rownr_t> itsRownrs;
+  Table           itsBatch;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -40,6 +40,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     return itsRow;
   }
+
+  std::shared_ptr<TaQLJoinBase> TaQLJoinRow::rebind
+  (const std::vector<TableExprNode>&, size_t)
+  {
+    return shared_from_this();
+  }
   
 
 
@@ -55,24 +61,61 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     
   Int64 TaQLJoin::findRow (const TableExprId& id)
   {
-    Int64 index;
+    // Consecutive main rows often have the same value (e.g., the TIME of
+    // all baselines in a MeasurementSet), so only look up a new value.
     switch (itsMainNode->dataType()) {
     case TableExprNodeRep::NTInt:
-      index = itsOptSet->find (itsMainNode->getInt(id));
+      {
+        Int64 value = itsMainNode->getInt(id);
+        if (itsLastIndex == -2  ||  value != itsLastInt) {
+          itsLastIndex = itsOptSet->find (value);
+          itsLastInt   = value;
+        }
+      }
       break;
     case TableExprNodeRep::NTDouble:
-      index = itsOptSet->find (itsMainNode->getDouble(id));
+      {
+        Double value = itsMainNode->getDouble(id);
+        if (itsLastIndex == -2  ||  value != itsLastDouble) {
+          itsLastIndex  = itsOptSet->find (value);
+          itsLastDouble = value;
+        }
+      }
       break;
     case TableExprNodeRep::NTString:
-      index = itsOptSet->find (itsMainNode->getString(id));
+      {
+        String value = itsMainNode->getString(id);
+        if (itsLastIndex == -2  ||  value != itsLastString) {
+          itsLastIndex  = itsOptSet->find (value);
+          itsLastString = value;
+        }
+      }
       break;
     default:
-      index = -1;
+      return -1;
     }
-    if (index < 0) {
+    if (itsLastIndex < 0) {
       return -1;
     }
-    return itsChildren[index]->findRow (id);
+    return itsChildren[itsLastIndex]->findRow (id);
+  }
+
+  std::shared_ptr<TaQLJoinBase> TaQLJoin::rebind
+  (const std::vector<TableExprNode>& mainNodes, size_t level)
+  {
+    // No main expressions results in a tree only to be used for rebind.
+    TENShPtr mainNode;
+    if (! mainNodes.empty()) {
+      AlwaysAssert (level < mainNodes.size(), AipsError);
+      mainNode = mainNodes[level].getRep();
+    }
+    std::vector<std::shared_ptr<TaQLJoinBase>> children;
+    children.reserve (itsChildren.size());
+    for (const auto& child : itsChildren) {
+      children.push_back (child->rebind (mainNodes, level+1));
+    }
+    return std::shared_ptr<TaQLJoinBase>
+      (new TaQLJoin (mainNode, itsJoinNode, children));
   }
 
   template<typename T>
@@ -104,19 +147,18 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       std::vector<T> vals;
       T val = vec[index[0]];
       std::vector<rownr_t> srows;
-      srows.push_back (index[0]);
+      srows.push_back (rows[index[0]]);
       for (size_t j=1; j<rows.size(); ++j) {
-        Int64 row = index[j];
-        T val2 = vec[row];
+        T val2 = vec[index[j]];
         if (val2 == val) {
-          srows.push_back (row);
+          srows.push_back (rows[index[j]]);
         } else {
           vals.push_back (val);
           children.push_back (TaQLJoin::createRecursive
                               (mainNodes, joinNodes, srows, level+1));
           val = val2;
           srows.resize(0);
-          srows.push_back (index[j]);
+          srows.push_back (rows[index[j]]);
         }
       }
       vals.push_back (val);
@@ -169,11 +211,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       T st = stvals[index[0]];
       T end = endvals[index[0]];
       std::vector<rownr_t> srows;
-      srows.push_back (index[0]);
+      srows.push_back (rows[index[0]]);
       for (size_t j=1; j<rows.size(); ++j) {
         Int64 row = rows[index[j]];
-        T st2 = stvals[row];
-        T end2 = endvals[row];
+        T st2 = stvals[index[j]];
+        T end2 = endvals[index[j]];
         if (st2 == st  &&  end2 == end) {
           srows.push_back (row);
         } else {
@@ -184,7 +226,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
           st = st2;
           end = end2;
           srows.resize(0);
-          srows.push_back (index[j]);
+          srows.push_back (row);
         }
       }
       starts.push_back (st);
@@ -259,6 +301,63 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
 
+
+  std::list<std::pair<String,std::shared_ptr<TaQLJoinBase>>> TaQLJoinCache::theirTrees;
+  size_t     TaQLJoinCache::theirMaxSize = 8;
+  std::mutex TaQLJoinCache::theirMutex;
+
+  std::shared_ptr<TaQLJoinBase> TaQLJoinCache::get (const String& key)
+  {
+    std::lock_guard<std::mutex> lock(theirMutex);
+    for (auto iter=theirTrees.begin(); iter!=theirTrees.end(); ++iter) {
+      if (iter->first == key) {
+        // Move it to the front to make it the most recently used.
+        theirTrees.splice (theirTrees.begin(), theirTrees, iter);
+        return theirTrees.front().second;
+      }
+    }
+    return std::shared_ptr<TaQLJoinBase>();
+  }
+
+  void TaQLJoinCache::put (const String& key,
+                           const std::shared_ptr<TaQLJoinBase>& tree)
+  {
+    std::lock_guard<std::mutex> lock(theirMutex);
+    if (theirMaxSize > 0) {
+      theirTrees.remove_if ([&key] (const std::pair<String,std::shared_ptr<TaQLJoinBase>>& p)
+                            { return p.first == key; });
+      theirTrees.emplace_front (key, tree);
+      shrink();
+    }
+  }
+
+  void TaQLJoinCache::clear()
+  {
+    std::lock_guard<std::mutex> lock(theirMutex);
+    theirTrees.clear();
+  }
+
+  size_t TaQLJoinCache::maxSize()
+  {
+    std::lock_guard<std::mutex> lock(theirMutex);
+    return theirMaxSize;
+  }
+
+  void TaQLJoinCache::setMaxSize (size_t maxSize)
+  {
+    std::lock_guard<std::mutex> lock(theirMutex);
+    theirMaxSize = maxSize;
+    shrink();
+  }
+
+  void TaQLJoinCache::shrink()
+  {
+    while (theirTrees.size() > theirMaxSize) {
+      theirTrees.pop_back();
+    }
+  }
+
+
   
   TaQLJoinColumn::TaQLJoinColumn (const TENShPtr& columnNode,
                                   const TableParseJoin& join)
@@ -361,6 +460,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   TaQLJoinColumnBool::TaQLJoinColumnBool (const TENShPtr& columnNode,
                                           const TableParseJoin& join)
     : TaQLJoinColumn (columnNode, join)
+  {}
+  void TaQLJoinColumnBool::fill()
   {
     rownr_t nrow = itsColumn->getTableInfo().table().nrow();
     itsData.resize (nrow);
@@ -374,6 +475,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (rownr < 0) {
       return False;
     }
+    if (itsData.empty()) {
+      fill();
+    }
     DebugAssert (rownr < static_cast<Int64>(itsData.size()), AipsError);
     return itsData[rownr];
   }
@@ -383,6 +487,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   TaQLJoinColumnInt::TaQLJoinColumnInt (const TENShPtr& columnNode,
                                         const TableParseJoin& join)
     : TaQLJoinColumn (columnNode, join)
+  {}
+  void TaQLJoinColumnInt::fill()
   {
     rownr_t nrow = itsColumn->getTableInfo().table().nrow();
     itsData.resize (nrow);
@@ -396,6 +502,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (rownr < 0) {
       return std::numeric_limits<Int64>::max();
     }
+    if (itsData.empty()) {
+      fill();
+    }
     DebugAssert (rownr < static_cast<Int64>(itsData.size()), AipsError);
     return itsData[rownr];
   }
@@ -406,6 +515,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   TaQLJoinColumnDouble::TaQLJoinColumnDouble (const TENShPtr& columnNode,
                                               const TableParseJoin& join)
     : TaQLJoinColumn (columnNode, join)
+  {}
+  void TaQLJoinColumnDouble::fill()
   {
     rownr_t nrow = itsColumn->getTableInfo().table().nrow();
     itsData.resize (nrow);
@@ -419,6 +530,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (rownr < 0) {
       return std::numeric_limits<Double>::quiet_NaN();
     }
+    if (itsData.empty()) {
+      fill();
+    }
     DebugAssert (rownr < static_cast<Int64>(itsData.size()), AipsError);
     return itsData[rownr];
   }
@@ -429,6 +543,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   TaQLJoinColumnDComplex::TaQLJoinColumnDComplex (const TENShPtr& columnNode,
                                                   const TableParseJoin& join)
     : TaQLJoinColumn (columnNode, join)
+  {}
+  void TaQLJoinColumnDComplex::fill()
   {
     rownr_t nrow = itsColumn->getTableInfo().table().nrow();
     itsData.resize (nrow);
@@ -443,6 +559,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       return DComplex(std::numeric_limits<Double>::quiet_NaN(),
                       std::numeric_limits<Double>::quiet_NaN());
     }
+    if (itsData.empty()) {
+      fill();
+    }
     DebugAssert (rownr < static_cast<Int64>(itsData.size()), AipsError);
     return itsData[rownr];
   }
@@ -453,6 +572,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   TaQLJoinColumnString::TaQLJoinColumnString (const TENShPtr& columnNode,
                                               const TableParseJoin& join)
     : TaQLJoinColumn (columnNode, join)
+  {}
+  void TaQLJoinColumnString::fill()
   {
     rownr_t nrow = itsColumn->getTableInfo().table().nrow();
     itsData.resize (nrow);
@@ -466,6 +587,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (rownr < 0) {
       return "none";
     }
+    if (itsData.empty()) {
+      fill();
+    }
     DebugAssert (rownr < static_cast<Int64>(itsData.size()), AipsError);
     return itsData[rownr];
   }
@@ -475,6 +599,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   TaQLJoinColumnDate::TaQLJoinColumnDate (const TENShPtr& columnNode,
                                           const TableParseJoin& join)
     : TaQLJoinColumn (columnNode, join)
+  {}
+  void TaQLJoinColumnDate::fill()
   {
     rownr_t nrow = itsColumn->getTableInfo().table().nrow();
     itsData.resize (nrow);
@@ -488,6 +614,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (rownr < 0) {
       return MVTime();
     }
+    if (itsData.empty()) {
+      fill();
+    }
     DebugAssert (rownr < static_cast<Int64>(itsData.size()), AipsError);
     return itsData[rownr];
   }
@@ -29,6 +29,9 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/TaQL/ExprDerNode.h>
 #include <casacore/tables/TaQL/ExprNodeSetOpt.h>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -47,13 +50,21 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // <synopsis>
   // </synopsis> 
 
-  class TaQLJoinBase
+  class TaQLJoinBase : public std::enable_shared_from_this<TaQLJoinBase>
   {
   public:
     virtual ~TaQLJoinBase() = default;
 
     // Find the row number. <0 means not found.
     virtual Int64 findRow (const TableExprId&) = 0;
+
+    // Make a tree using the given main table expressions from the given
+    // level on, but sharing the join table values with this tree.
+    // It is used to reuse a cached tree in another query.
+    // If no main expressions are given, the tree can only be used for rebind.
+    // It is used to keep a tree in the cache without the main table.
+    virtual std::shared_ptr<TaQLJoinBase> rebind
+    (const std::vector<TableExprNode>& mainNodes, size_t level) = 0;
   };
 
 
@@ -79,7 +90,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
     // Return the row number.
     Int64 findRow (const TableExprId&) override;
-    
+
+    // The object does not depend on the main table, so return itself.
+    std::shared_ptr<TaQLJoinBase> rebind
+    (const std::vector<TableExprNode>& mainNodes, size_t level) override;
+
   private:
     Int64 itsRow;
   };
@@ -157,8 +172,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     ~TaQLJoin() override = default;
 
     // Find the row number in the join table for the given row in the main table.
+    // The lookup is only done if the main value differs from the previous one.
     Int64 findRow (const TableExprId&) override;
 
+    // Make a new TaQLJoin tree for the given main table expressions.
+    // The values of the join table are shared.
+    std::shared_ptr<TaQLJoinBase> rebind
+    (const std::vector<TableExprNode>& mainNodes, size_t level) override;
+
     // From the given level on create nested TaQLJoin nodes.
     // It use makeOptDiscrete or makeOptInterval to create the appropriate
     // TableExprNodeSetOptBase object.
@@ -195,6 +216,65 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     TENShPtr itsJoinNode;                  // only used for automatic deletion
     TableExprNodeSetOptBase* itsOptSet;    // same ptr as itsJoinNode
     std::vector<std::shared_ptr<TaQLJoinBase>> itsChildren;
+    // The last main value looked up and its index (-2 is none yet).
+    Int64  itsLastIndex  = -2;
+    Int64  itsLastInt    = 0;
+    Double itsLastDouble = 0;
+    String itsLastString;
+  };
+
+
+  // <summary>
+  // Cache of TaQLJoin trees to be reused by later queries
+  // </summary>
+  // <use visibility=local>
+  // <reviewed reviewer="" date="" tests="tTableGramJoin">
+  // </reviewed>
+  // <synopsis>
+  // Building a TaQLJoin tree requires reading and sorting the join values
+  // of all rows in the join table. Usually the same join (e.g., a
+  // MeasurementSet joined with its POINTING or SYSCAL subtable on TIME)
+  // is done by several queries in a session. Therefore the built trees are
+  // kept in a process-wide cache, so a later query only needs to bind
+  // its main table expressions to the tree (see TaQLJoinBase::rebind).
+  // <br>The key of a tree is made by TableParseJoin from the text of the
+  // join condition, the TaQL style, and the name, nr of rows and modify
+  // counter of the join tables. Only joins on persistent tables that are
+  // not writable in this process are cached, because only for those the
+  // modify counter tells reliably if the table has been changed.
+  // <br>The cache holds at most <src>maxSize()</src> trees; the least
+  // recently used one is removed if the cache gets too large.
+  // A maximum size of 0 disables the cache.
+  // </synopsis>
+
+  class TaQLJoinCache
+  {
+  public:
+    // Get the tree for the given key. An empty pointer is returned if
+    // the key is not in the cache.
+    static std::shared_ptr<TaQLJoinBase> get (const String& key);
+
+    // Add a tree to the cache.
+    static void put (const String& key,
+                     const std::shared_ptr<TaQLJoinBase>& tree);
+
+    // Remove all trees from the cache.
+    static void clear();
+
+    // Get or set the maximum nr of trees in the cache (default 8).
+    // <group>
+    static size_t maxSize();
+    static void setMaxSize (size_t maxSize);
+    // </group>
+
+  private:
+    // Remove the least recently used trees until the size fits.
+    // The mutex must have been locked.
+    static void shrink();
+
+    static std::list<std::pair<String,std::shared_ptr<TaQLJoinBase>>> theirTrees;
+    static size_t     theirMaxSize;
+    static std::mutex theirMutex;
   };
 
 
@@ -257,6 +337,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // column in a join table. It is used to find a value in the join column
   // for a row in the main table. It uses the TableParseJoin object to find
   // the row in the join table given the row in the main table.
+  // <br>The column data are read (by the private function fill) when the
+  // column is used for the first time. In this way a column only used in
+  // the join condition is not read if the join tree is taken from the
+  // TaQLJoinCache.
   // </synopsis> 
 
   class TaQLJoinColumnBool : public TaQLJoinColumn
@@ -267,6 +351,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool getBool (const TableExprId& id) override;
     void clear() override;
   private:
+    void fill();
     Vector<Bool> itsData;
   };
 
@@ -278,6 +363,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 getInt (const TableExprId& id) override;
     void clear() override;
   private:
+    void fill();
     Vector<Int64> itsData;
   };
 
@@ -289,6 +375,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double getDouble (const TableExprId& id) override;
     void clear() override;
   private:
+    void fill();
     Vector<Double> itsData;
   };
 
@@ -300,6 +387,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     DComplex getDComplex (const TableExprId& id) override;
     void clear() override;
   private:
+    void fill();
     Vector<DComplex> itsData;
   };
 
@@ -311,6 +399,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     String getString (const TableExprId& id) override;
     void clear() override;
   private:
+    void fill();
     Vector<String> itsData;
   };
 
@@ -322,6 +411,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     MVTime getDate (const TableExprId& id) override;
     void clear() override;
   private:
+    void fill();
     Vector<MVTime> itsData;
   };
 
@@ -184,6 +184,8 @@ TaQLNode TaQLNode::restoreNode (AipsIO& aio)
     return TaQLCopyColNodeRep::restore (aio);
   case TaQLNode_DropTab:
     return TaQLDropTabNodeRep::restore (aio);
+  case TaQLNode_Param:
+    return TaQLParamNodeRep::restore (aio);
   default:
     throw AipsError ("TaQLNode::restoreNode - unknown node type");
   }
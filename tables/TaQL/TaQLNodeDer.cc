@@ -769,6 +769,41 @@ TaQLNode TaQLKeyColNodeRep::restore (AipsIO& aio)
   return new TaQLKeyColNodeRep (name, nameMask);
 }
 
+TaQLParamNodeRep::TaQLParamNodeRep (Int paramNr)
+  : TaQLNodeRep (TaQLNode_Param),
+    itsParamNr  (paramNr)
+{}
+TaQLParamNodeRep::TaQLParamNodeRep (const TaQLNode& tempTable)
+  : TaQLNodeRep (TaQLNode_Param),
+    itsParamNr  (0)
+{
+  const TaQLConstNodeRep* rep =
+    dynamic_cast<const TaQLConstNodeRep*>(tempTable.getRep());
+  AlwaysAssert (rep  &&  rep->itsType == TaQLConstNodeRep::CTInt, AipsError);
+  if (rep->itsSValue != '$' + String::toString(rep->itsIValue)) {
+    throw TableInvExpr ("Invalid bind parameter " + rep->itsSValue);
+  }
+  itsParamNr = rep->itsIValue;
+}
+TaQLNodeResult TaQLParamNodeRep::visit (TaQLNodeVisitor& visitor) const
+{
+  return visitor.visitParamNode (*this);
+}
+void TaQLParamNodeRep::show (std::ostream& os) const
+{
+  os << '$' << itsParamNr;
+}
+void TaQLParamNodeRep::save (AipsIO& aio) const
+{
+  aio << itsParamNr;
+}
+TaQLNode TaQLParamNodeRep::restore (AipsIO& aio)
+{
+  Int paramNr;
+  aio >> paramNr;
+  return new TaQLParamNodeRep (paramNr);
+}
+
 TaQLTableNodeRep::TaQLTableNodeRep (const TaQLNode& table,
                                     const String& alias)
   : TaQLNodeRep (TaQLNode_Table),
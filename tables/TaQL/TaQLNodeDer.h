@@ -430,6 +430,38 @@ public:
 };
 
 
+// <summary>
+// Raw TaQL parse tree node defining a bind parameter.
+// </summary>
+// <use visibility=local>
+// <reviewed reviewer="" date="" tests="tTaQLNode">
+// </reviewed>
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TaQLNodeRep>TaQLNodeRep</linkto>
+// </prerequisite>
+// <synopsis> 
+// This class is a TaQLNodeRep holding the number of a bind parameter
+// given as $n in an expression. Its value is given when executing the
+// command using <linkto class=TaQLPrepared>TaQLPrepared</linkto>.
+// </synopsis> 
+
+class TaQLParamNodeRep: public TaQLNodeRep
+{
+public:
+  explicit TaQLParamNodeRep (Int paramNr);
+  // Construct from the temporary table node made by the scanner for $n.
+  // An exception is thrown if it contains a subtable name.
+  explicit TaQLParamNodeRep (const TaQLNode& tempTable);
+  virtual TaQLNodeResult visit (TaQLNodeVisitor&) const override;
+  virtual void show (std::ostream& os) const override;
+  virtual void save (AipsIO& aio) const override;
+  static TaQLNode restore (AipsIO& aio);
+
+  Int itsParamNr;
+};
+
+
 // <summary>
 // Raw TaQL parse tree node defining a table.
 // </summary>
@@ -28,6 +28,7 @@
 #include <casacore/tables/TaQL/TableParseSortKey.h>
 #include <casacore/tables/TaQL/TableParseUpdate.h>
 #include <casacore/tables/TaQL/TableParseUtil.h>
+#include <casacore/tables/TaQL/TableParseFunc.h>
 #include <casacore/tables/TaQL/TaQLShow.h>
 #include <casacore/tables/DataMan/DataManInfo.h>
 #include <casacore/tables/Tables/TableError.h>
@@ -39,6 +40,11 @@
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+  TaQLNodeHandler::TaQLNodeHandler (rownr_t cursorBatch)
+    : itsCursorBatch (cursorBatch),
+      itsRepeatable  (True)
+  {}
+
   TaQLNodeHandler::~TaQLNodeHandler()
   {
     clearStack();
@@ -49,8 +55,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     clearStack();
     itsTempTables = tempTables;
+    itsUsedTables.clear();
+    itsUsedNames.clear();
+    itsRepeatable = True;
     return node.visit (*this);
   }
+
+  TaQLNodeResult TaQLNodeHandler::handleTree (const TaQLNode& node,
+                                  const std::vector<const Table*>& tempTables,
+                                  const std::vector<TableExprNode>& params)
+  {
+    itsParams = params;
+    return handleTree (node, tempTables);
+  }
     
 
   TableParseQuery* TaQLNodeHandler::pushStack
@@ -253,9 +270,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       funcRes = handleIdFunc(node);
     } else {
       TaQLNodeResult result = visitNode (node.itsArgs);
-      funcRes = topStack()->handleFunc (node.itsName,
-                                        getHR(result).getExprSet(),
-                                        node.style());
+      const TableExprNodeSet& args = getHR(result).getExprSet();
+      funcRes = topStack()->handleFunc (node.itsName, args, node.style());
+      // A function without arguments using the current time results in a
+      // constant node, so it has to be recognized here.
+      TableExprFuncNode::FunctionType ftype =
+        TableParseFunc::findFunc (fncParts[fncParts.size()-1], args.size(),
+                                  Vector<Int>());
+      if (! TableExprFuncNode::isDeterministic (ftype, args.size())) {
+        itsRepeatable = False;
+      }
     }
     TaQLNodeHRValue* hrval = new TaQLNodeHRValue();
     TaQLNodeResult res(hrval);
@@ -366,6 +390,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return res;
   }
 
+  TaQLNodeResult TaQLNodeHandler::visitParamNode (const TaQLParamNodeRep& node)
+  {
+    Int nr = node.itsParamNr;
+    if (nr < 1  ||  nr > Int(itsParams.size())  ||  itsParams[nr-1].isNull()) {
+      throw TableInvExpr ("No value given for bind parameter $" +
+                          String::toString(nr));
+    }
+    TaQLNodeHRValue* hrval = new TaQLNodeHRValue();
+    TaQLNodeResult res(hrval);
+    hrval->setExpr (itsParams[nr-1]);
+    return res;
+  }
+
   TaQLNodeResult TaQLNodeHandler::visitTableNode (const TaQLTableNodeRep& node)
   {
     TaQLNodeHRValue* hrval = new TaQLNodeHRValue;
@@ -442,8 +479,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                         res.getAlias(), itsTempTables, itsStack);
     }
     // Handle the join expression.
+    // Its text and the style are used as the key in the join cache.
     TaQLNodeResult result = visitNode(node.itsCondition);
-    joinObj.handleCondition (getHR(result).getExpr());
+    std::ostringstream condText;
+    node.itsCondition.show (condText);
+    const TaQLStyle& style = node.itsCondition.style();
+    condText << " style=" << style.origin() << style.isEndExcl()
+             << style.isCOrder();
+    joinObj.handleCondition (getHR(result).getExpr(), condText.str());
     return TaQLNodeResult();
   }
 
@@ -519,6 +562,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   TaQLNodeResult TaQLNodeHandler::visitGivingNode (const TaQLGivingNodeRep& node)
   {
+    itsRepeatable = False;
     if (node.itsExprList.isValid()) {
       // Expressions in Giving clause.
       TaQLNodeResult result = visitNode (node.itsExprList);
@@ -597,9 +641,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     TaQLNodeResult res(hrval);
     if (! node.getNoExecute()) {
       if (outer) {
+        curSel->setCursor (itsCursorBatch);
         curSel->execute (node.style().doTiming(), False, False, 0,
                          node.style().doTracing(), itsTempTables, itsStack);
         hrval->setTable (curSel->getTable());
+        hrval->setCursor (curSel->getCursor());
         Block<String> block = curSel->getColumnNames();
         hrval->setNames (Vector<String>(block.begin(), block.end()));
         hrval->setString ("select");
@@ -995,9 +1041,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     for (uInt i=0; i<nodes.size(); ++i) {
       TaQLNodeResult result = visitNode (nodes[i]);
       const TaQLNodeHRValue& res = getHR(result);
-      topStack()->tableList().addTable (res.getInt(), res.getString(),
-                                        res.getTable(), res.getAlias(),
-                                        addToFromList, itsTempTables, itsStack);
+      itsUsedTables.push_back
+        (topStack()->tableList().addTable (res.getInt(), res.getString(),
+                                           res.getTable(), res.getAlias(),
+                                           addToFromList, itsTempTables,
+                                           itsStack));
+      itsUsedNames.push_back (res.getString());
     }
   }
 
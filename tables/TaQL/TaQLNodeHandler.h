@@ -93,13 +93,39 @@ class TaQLNodeHRValue;
 class TaQLNodeHandler : public TaQLNodeVisitor
 {
 public:
+  // Construct the handler. If a nonzero cursor batch size is given,
+  // the outer SELECT command results in a TaQLCursor.
+  explicit TaQLNodeHandler (rownr_t cursorBatch=0);
+
   virtual ~TaQLNodeHandler();
 
   // Handle and process the raw parse tree.
-  // The result contains a Table or TableExprNode object.
+  // The result contains a Table, TableExprNode, or TaQLCursor object.
   TaQLNodeResult handleTree (const TaQLNode& tree,
                              const std::vector<const Table*>&);
 
+  // Handle and process the raw parse tree using the given values for the
+  // bind parameters $n in the expressions (<src>params[n-1]</src>).
+  TaQLNodeResult handleTree (const TaQLNode& tree,
+                             const std::vector<const Table*>&,
+                             const std::vector<TableExprNode>& params);
+
+  // Get the tables used in the FROM and WITH clauses of the last
+  // processed tree.
+  const std::vector<Table>& usedTables() const
+    { return itsUsedTables; }
+
+  // Get the names of the tables in <src>usedTables()</src> as given in the
+  // command. The name is empty for a table resulting from a subquery.
+  const std::vector<String>& usedNames() const
+    { return itsUsedNames; }
+
+  // Does the last processed tree give the same result when executed again
+  // on unchanged tables? It is not the case if it uses a function like
+  // <src>rand</src> or <src>datetime()</src>, or has a GIVING clause.
+  Bool isRepeatable() const
+    { return itsRepeatable; }
+
   // Define the functions to visit each node type.
   // <group>
   virtual TaQLNodeResult visitConstNode    (const TaQLConstNodeRep& node);
@@ -111,6 +137,7 @@ public:
   virtual TaQLNodeResult visitRangeNode    (const TaQLRangeNodeRep& node);
   virtual TaQLNodeResult visitIndexNode    (const TaQLIndexNodeRep& node);
   virtual TaQLNodeResult visitKeyColNode   (const TaQLKeyColNodeRep& node);
+  virtual TaQLNodeResult visitParamNode    (const TaQLParamNodeRep& node);
   virtual TaQLNodeResult visitTableNode    (const TaQLTableNodeRep& node);
   virtual TaQLNodeResult visitColNode      (const TaQLColNodeRep& node);
   virtual TaQLNodeResult visitColumnsNode  (const TaQLColumnsNodeRep& node);
@@ -207,6 +234,16 @@ private:
   std::vector<TableParseQuery*> itsStack;
   //# The temporary tables referred to by $i in the TaQL string.
   std::vector<const Table*> itsTempTables;
+  //# The batch size of a cursor to create (0 = no cursor).
+  rownr_t itsCursorBatch;
+  //# The values of the bind parameters $n.
+  std::vector<TableExprNode> itsParams;
+  //# The tables used in the tree.
+  std::vector<Table> itsUsedTables;
+  //# The names of the tables used as given in the tree.
+  std::vector<String> itsUsedNames;
+  //# Does the tree give the same result each time?
+  Bool itsRepeatable;
 };
 
 
@@ -276,6 +313,8 @@ public:
     { return *itsSet; }
   const Vector<String>& getNames() const
     { return itsNames; }
+  const std::shared_ptr<TaQLCursor>& getCursor() const
+    { return itsCursor; }
   // </group>
 
   // Set the values.
@@ -305,6 +344,8 @@ public:
     { itsSet = set; }
   void setNames (const Vector<String>& names)
     { itsNames = names; }
+  void setCursor (const std::shared_ptr<TaQLCursor>& cursor)
+    { itsCursor = cursor; }
   // </group>
 
 private:
@@ -320,6 +361,7 @@ private:
   TableExprNodeSetElem* itsElem;      //# is counted in itsExpr
   TableExprNodeSet*     itsSet;       //# is counted in itsExpr
   Vector<String>        itsNames;
+  std::shared_ptr<TaQLCursor> itsCursor;
 };
 
 
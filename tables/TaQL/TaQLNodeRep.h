@@ -117,6 +117,7 @@ public:
   #define TaQLNode_Show     char(36)
   #define TaQLNode_CopyCol  char(37)
   #define TaQLNode_DropTab  char(38)
+  #define TaQLNode_Param    char(39)
   // </group>
 
   // Constructor for derived classes specifying the type.
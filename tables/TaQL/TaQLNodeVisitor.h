@@ -84,6 +84,7 @@ public:
   virtual TaQLNodeResult visitRangeNode    (const TaQLRangeNodeRep& node) = 0;
   virtual TaQLNodeResult visitIndexNode    (const TaQLIndexNodeRep& node) = 0;
   virtual TaQLNodeResult visitKeyColNode   (const TaQLKeyColNodeRep& node) = 0;
+  virtual TaQLNodeResult visitParamNode    (const TaQLParamNodeRep& node) = 0;
   virtual TaQLNodeResult visitTableNode    (const TaQLTableNodeRep& node) = 0;
   virtual TaQLNodeResult visitColNode      (const TaQLColNodeRep& node) = 0;
   virtual TaQLNodeResult visitColumnsNode  (const TaQLColumnsNodeRep& node) = 0;
@@ -0,0 +1,274 @@
+//# TaQLPrepared.cc: A TaQL command parsed once to be executed many times
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/tables/TaQL/TaQLPrepared.h>
+#include <casacore/tables/TaQL/TaQLNodeHandler.h>
+#include <casacore/tables/TaQL/TaQLResultCache.h>
+#include <casacore/tables/TaQL/ExprNodeRep.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/OS/ProfileRegistry.h>
+#include <casacore/casa/Quanta/MVTime.h>
+#include <iomanip>
+#include <sstream>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+
+  // Add the type, value and unit of a bind parameter to the cache key.
+  // False is returned if the value is not a constant scalar.
+  Bool addParamToKey (std::ostream& os, const TableExprNode& node)
+  {
+    if (node.isNull()  ||  !node.isScalar()  ||
+        !node.getRep()->isConstant()) {
+      return False;
+    }
+    TableExprId id(0);
+    os << Int(node.getRep()->dataType()) << ':';
+    switch (node.getRep()->dataType()) {
+    case TableExprNodeRep::NTBool:
+      {
+        Bool value;
+        node.get (id, value);
+        os << value;
+        break;
+      }
+    case TableExprNodeRep::NTInt:
+      {
+        Int64 value;
+        node.get (id, value);
+        os << value;
+        break;
+      }
+    case TableExprNodeRep::NTDouble:
+      {
+        Double value;
+        node.get (id, value);
+        os << value;
+        break;
+      }
+    case TableExprNodeRep::NTComplex:
+      {
+        DComplex value;
+        node.get (id, value);
+        os << value;
+        break;
+      }
+    case TableExprNodeRep::NTString:
+      {
+        // Add the length to make the key unambiguous.
+        String value;
+        node.get (id, value);
+        os << value.size() << ':' << value;
+        break;
+      }
+    case TableExprNodeRep::NTDate:
+      {
+        MVTime value;
+        node.get (id, value);
+        os << value.day();
+        break;
+      }
+    default:
+      return False;
+    }
+    os << ':' << node.unit().getName();
+    return True;
+  }
+
+} //# end anonymous namespace
+
+
+TaQLPrepared::TaQLPrepared (const String& command)
+  : TaQLPrepared (command, std::vector<const Table*>())
+{}
+
+TaQLPrepared::TaQLPrepared (const String& command,
+                            const std::vector<const Table*>& tempTables)
+  : itsCommand    (command),
+    itsTempTables (tempTables),
+    itsNExec      (0)
+{
+  static ProfileCounter& parseCounter =
+    ProfileRegistry::counter ("TaQL.parse");
+  // Do the first parse step. It returns a raw parse tree
+  // (or throws an exception).
+  ProfileTimer parseTimer(parseCounter);
+  itsTree = TaQLNode::parse (command);
+}
+
+void TaQLPrepared::setParam (uInt paramNr, const TableExprNode& value)
+{
+  if (paramNr == 0) {
+    throw TableInvExpr ("Bind parameter number must be > 0");
+  }
+  if (paramNr > itsParams.size()) {
+    itsParams.resize (paramNr);
+  }
+  itsParams[paramNr-1] = value;
+}
+
+void TaQLPrepared::setParams (const std::vector<TableExprNode>& values)
+{
+  itsParams = values;
+}
+
+void TaQLPrepared::clearParams()
+{
+  itsParams.clear();
+}
+
+TaQLResult TaQLPrepared::execute()
+{
+  Vector<String> cols;
+  String commandType;
+  return doExecute (0, cols, commandType);
+}
+
+TaQLResult TaQLPrepared::execute (Vector<String>& columnNames,
+                                  String& commandType)
+{
+  return doExecute (0, columnNames, commandType);
+}
+
+TaQLResult TaQLPrepared::execute (const std::vector<TableExprNode>& values)
+{
+  setParams (values);
+  return execute();
+}
+
+TaQLResult TaQLPrepared::cursor (rownr_t batchSize)
+{
+  if (batchSize == 0) {
+    throw TableParseError ("'" + itsCommand + "'\n  batch size of a cursor "
+                           "must be positive");
+  }
+  Vector<String> cols;
+  String commandType;
+  return doExecute (batchSize, cols, commandType);
+}
+
+TaQLResult TaQLPrepared::doExecute (rownr_t batchSize,
+                                    Vector<String>& cols,
+                                    String& commandType)
+{
+  static ProfileCounter& taqlCounter =
+    ProfileRegistry::counter ("TaQL.command");
+  ProfileTimer ptimer(taqlCounter);
+  commandType = "error";
+  itsNExec++;
+  // A cursor is never taken from the result cache.
+  String cacheKey;
+  if (batchSize == 0) {
+    cacheKey = makeCacheKey();
+  }
+  if (! cacheKey.empty()) {
+    TaQLResult result;
+    if (TaQLResultCache::get (cacheKey, result, cols, commandType,
+                              itsTables)) {
+      return result;
+    }
+  }
+  // Now process the raw tree and get the final ParseSelect object.
+  Timer timer;
+  try {
+    TaQLNodeHandler treeHandler(batchSize);
+    TaQLNodeResult res = treeHandler.handleTree (itsTree, itsTempTables,
+                                                 itsParams);
+    const TaQLNodeHRValue& hrval = TaQLNodeHandler::getHR(res);
+    commandType = hrval.getString();
+    // Keep the tables open for a next execution, unless the command
+    // changed or removed tables. Cached results using those tables are
+    // outdated.
+    Bool readOnly = (commandType == "select"  ||  commandType == "count"  ||
+                     commandType == "calc");
+    if (readOnly) {
+      itsTables = treeHandler.usedTables();
+    } else {
+      itsTables.clear();
+      for (const Table& tab : treeHandler.usedTables()) {
+        TaQLResultCache::invalidate (tab.tableName());
+      }
+    }
+    if (itsTree.style().doTiming()) {
+      timer.show (" Total time   ");
+    }
+    if (batchSize > 0) {
+      if (! hrval.getCursor()) {
+        throw TableInvExpr ("a TaQL cursor can only be made for a "
+                            "SELECT command");
+      }
+      return TaQLResult(hrval.getCursor());
+    }
+    TaQLResult result;
+    TableExprNode expr = hrval.getExpr();
+    if (! expr.isNull()) {
+      result = TaQLResult(expr);               // result of CALC command
+    } else {
+      //# Copy the possibly selected column names.
+      cols.reference (hrval.getNames());
+      result = TaQLResult(hrval.getTable());
+    }
+    // A command using GIVING or a function like rand is not cached.
+    if (readOnly  &&  !cacheKey.empty()  &&  treeHandler.isRepeatable()) {
+      TaQLResultCache::put (cacheKey, result, cols, commandType, itsTables,
+                            treeHandler.usedNames());
+    }
+    return result;
+  } catch (std::exception& x) {
+    itsTables.clear();
+    throw TableParseError ("'" + itsCommand + "'\n  " + x.what());
+  }
+}
+
+String TaQLPrepared::makeCacheKey() const
+{
+  // Temporary tables have no name to check, and timings are not shown
+  // for a cached result.
+  if (!itsTempTables.empty()  ||  itsTree.style().doTiming()  ||
+      TaQLResultCache::maxSize() == 0) {
+    return String();
+  }
+  std::ostringstream key;
+  key << std::setprecision(17);
+  itsTree.show (key);
+  const TaQLStyle& style = itsTree.style();
+  key << " style=" << style.origin() << style.isEndExcl()
+      << style.isCOrder();
+  for (size_t i=0; i<itsParams.size(); ++i) {
+    key << " $" << i+1 << '=';
+    if (! addParamToKey (key, itsParams[i])) {
+      return String();
+    }
+  }
+  return key.str();
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,164 @@
+//# TaQLPrepared.h: A TaQL command parsed once to be executed many times
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef TABLES_TAQLPREPARED_H
+#define TABLES_TAQLPREPARED_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/TaQLNode.h>
+#include <casacore/tables/TaQL/TaQLResult.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// A TaQL command parsed once to be executed many times
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTaQLPrepared">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto group=TableParse.h#tableCommand>tableCommand</linkto>
+// </prerequisite>
+
+// <synopsis>
+// A TaQLPrepared object holds the parse tree of a TaQL command, so the
+// command can be executed multiple times without scanning and parsing
+// it again.
+// <br>The command can contain bind parameters $1, $2, etc. in its
+// expressions. Their values are given before or when executing the command
+// and are used as constants in the expressions. The value of a parameter
+// can be any constant that can be converted to a TableExprNode (e.g.,
+// an integer, double, string, MVTime, or array).
+// Note that $n used as a table name (e.g., <src>FROM $1</src>) still
+// refers to a temporary table given in the constructor.
+// <br>The tables used by the last execution are kept open, so the next
+// execution finds them in the table cache instead of opening them again.
+// They are released when the command is executed again or the object
+// is destructed.
+// <br>The results of SELECT, COUNT and CALC commands can be kept in the
+// <linkto class=TaQLResultCache>TaQLResultCache</linkto>, so executing
+// a command again on unchanged tables returns the cached result.
+// <br>A TaQLPrepared object is not thread-safe; use a separate object per
+// thread.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   TaQLPrepared query ("select from my.ms where ANTENNA1=$1 and "
+//                       "TIME between $2 and $3");
+//   for (Int ant=0; ant<10; ++ant) {
+//     Table result = query.execute ({ant, startTime, endTime}).table();
+//     ...
+//   }
+// </srcblock>
+// </example>
+
+// <motivation>
+// Services executing the same query shapes many times with different
+// values spend a lot of time in scanning and parsing the commands.
+// </motivation>
+
+class TaQLPrepared
+{
+public:
+  // Parse the command. It can use temporary tables given as $n in table
+  // names. An exception is thrown if the command is invalid.
+  // <group>
+  explicit TaQLPrepared (const String& command);
+  TaQLPrepared (const String& command,
+                const std::vector<const Table*>& tempTables);
+  // </group>
+
+  // Get the command.
+  const String& command() const
+    { return itsCommand; }
+
+  // Get the parse tree.
+  const TaQLNode& tree() const
+    { return itsTree; }
+
+  // Set the value of bind parameter $n (n>0).
+  void setParam (uInt paramNr, const TableExprNode& value);
+
+  // Set the values of the bind parameters $1, $2, etc. in order.
+  void setParams (const std::vector<TableExprNode>& values);
+
+  // Clear the values of all bind parameters.
+  void clearParams();
+
+  // Execute the command using the current values of the bind parameters.
+  // The command type and the selected or updated column names can be
+  // returned (as in tableCommand).
+  // An exception is thrown if a value is missing for a bind parameter
+  // used in the command.
+  // <group>
+  TaQLResult execute();
+  TaQLResult execute (Vector<String>& columnNames, String& commandType);
+  // </group>
+
+  // Set the values of the bind parameters and execute the command.
+  TaQLResult execute (const std::vector<TableExprNode>& values);
+
+  // Execute the command, which must be a SELECT command, as a
+  // <linkto class=TaQLCursor>TaQLCursor</linkto> (as in tableCursor).
+  TaQLResult cursor (rownr_t batchSize=4096);
+
+  // Get the number of times the command has been executed.
+  uInt64 nexecuted() const
+    { return itsNExec; }
+
+private:
+  // Execute the command using a handler making a cursor if batchSize>0.
+  TaQLResult doExecute (rownr_t batchSize, Vector<String>& columnNames,
+                        String& commandType);
+
+  // Make the key of the command in the TaQLResultCache.
+  // An empty string is returned if the command cannot be cached.
+  String makeCacheKey() const;
+
+  String                     itsCommand;
+  TaQLNode                   itsTree;
+  std::vector<const Table*>  itsTempTables;
+  std::vector<TableExprNode> itsParams;
+  std::vector<Table>         itsTables;   //# tables kept open
+  uInt64                     itsNExec;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
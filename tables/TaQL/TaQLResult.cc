@@ -38,6 +38,10 @@ TaQLResult::TaQLResult (const TableExprNode& node)
   : itsNode  (node)
 {}
 
+TaQLResult::TaQLResult (const std::shared_ptr<TaQLCursor>& cursor)
+  : itsCursor (cursor)
+{}
+
 const Table& TaQLResult::table() const
 {
   AlwaysAssert (isTable(), AipsError);
@@ -46,8 +50,14 @@ const Table& TaQLResult::table() const
 
 TableExprNode TaQLResult::node() const
 {
-  AlwaysAssert (!isTable(), AipsError);
+  AlwaysAssert (!itsNode.isNull(), AipsError);
   return itsNode;
 }
+
+TaQLCursor& TaQLResult::cursor() const
+{
+  AlwaysAssert (isCursor(), AipsError);
+  return *itsCursor;
+}
  
 } //#NAMESPACE CASACORE - END
@@ -30,6 +30,8 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/TaQLCursor.h>
+#include <memory>
 
 namespace casacore {
 
@@ -49,6 +51,9 @@ namespace casacore {
 // <synopsis> 
 // The result of a TaQL command can be a Table or a TableExprNode.
 // This class holds the actual result.
+// <br>The result of <src>tableCursor</src> is a
+// <linkto class=TaQLCursor>TaQLCursor</linkto> delivering the rows of
+// a SELECT command in batches.
 // </synopsis> 
 
 // <motivation>
@@ -70,9 +75,16 @@ public:
   // Construct from a TableExprNode.
   explicit TaQLResult (const TableExprNode&);
 
+  // Construct from a TaQLCursor.
+  explicit TaQLResult (const std::shared_ptr<TaQLCursor>&);
+
   // Is the result a Table?
   Bool isTable() const
-    { return itsNode.isNull(); }
+    { return itsNode.isNull()  &&  !itsCursor; }
+
+  // Is the result a TaQLCursor?
+  Bool isCursor() const
+    { return static_cast<bool>(itsCursor); }
 
   // Return the result as a TableExprInfo.
   // It throws an exception if it is not a table.
@@ -82,9 +94,14 @@ public:
   // It throws an exception if it is not a TableExprNode.
   TableExprNode node() const;
 
+  // Return the result as a TaQLCursor.
+  // It throws an exception if it is not a TaQLCursor.
+  TaQLCursor& cursor() const;
+
 private:
   Table         itsTable;
   TableExprNode itsNode;
+  std::shared_ptr<TaQLCursor> itsCursor;
 };
 
 }
@@ -0,0 +1,233 @@
+//# TaQLResultCache.cc: Cache of the results of read-only TaQL commands
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/tables/TaQL/TaQLResultCache.h>
+#include <casacore/tables/Tables/TableLock.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/OS/Path.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+std::list<std::pair<String,std::shared_ptr<TaQLResultCache::Entry>>>
+                  TaQLResultCache::theirEntries;
+size_t            TaQLResultCache::theirMaxSize = 0;
+Bool              TaQLResultCache::theirInit = False;
+uInt64            TaQLResultCache::theirNHits = 0;
+uInt64            TaQLResultCache::theirNMisses = 0;
+std::mutex        TaQLResultCache::theirMutex;
+
+Bool TaQLResultCache::canCache (const Table& table)
+{
+  return (table.isRootTable()  &&  table.tableType() == Table::Plain  &&
+          !table.isWritable()  &&  !table.isMarkedForDelete()  &&
+          table.lockOptions().option() != TableLock::NoLocking  &&
+          table.lockOptions().readLocking());
+}
+
+Bool TaQLResultCache::get (const String& key, TaQLResult& result,
+                           Vector<String>& columnNames, String& commandType,
+                           std::vector<Table>& tables)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  for (auto iter=theirEntries.begin(); iter!=theirEntries.end(); ++iter) {
+    if (iter->first == key) {
+      if (! isValid (*iter->second)) {
+        theirEntries.erase (iter);
+        break;
+      }
+      // Move it to the front to make it the most recently used.
+      theirEntries.splice (theirEntries.begin(), theirEntries, iter);
+      const Entry& entry = *theirEntries.front().second;
+      result = copyResult (entry.result);
+      columnNames.reference (entry.columnNames.copy());
+      commandType = entry.commandType;
+      tables = entry.tables;
+      theirNHits++;
+      return True;
+    }
+  }
+  theirNMisses++;
+  return False;
+}
+
+void TaQLResultCache::put (const String& key, const TaQLResult& result,
+                           const Vector<String>& columnNames,
+                           const String& commandType,
+                           const std::vector<Table>& tables,
+                           const std::vector<String>& tableNames)
+{
+  // A cursor cannot be reused and a persistent table (of GIVING) can be
+  // changed or deleted by the user.
+  if (result.isCursor()) {
+    return;
+  }
+  if (result.isTable()) {
+    const Table& tab = result.table();
+    if (tab.isNull()  ||  (tab.tableType() == Table::Plain  &&
+                           (tab.isRootTable()  ||  tab.isWritable()))) {
+      return;
+    }
+  }
+  auto entry = std::make_shared<Entry>();
+  for (const String& name : tableNames) {
+    if (! name.empty()) {
+      entry->names.push_back (name);
+      entry->absNames.push_back (Path(name).absoluteName());
+    }
+  }
+  for (const Table& tab : tables) {
+    if (! canCache (tab)) {
+      return;
+    }
+    entry->tables.push_back (tab);
+    // The counter is the one read when the table was last locked, thus
+    // the one belonging to the data read by the command.
+    entry->counters.push_back (tab.modifyCounter());
+    entry->nrows.push_back (tab.nrow());
+  }
+  entry->result      = copyResult (result);
+  entry->columnNames = columnNames.copy();
+  entry->commandType = commandType;
+  std::lock_guard<std::mutex> lock(theirMutex);
+  init();
+  if (theirMaxSize > 0) {
+    theirEntries.remove_if ([&key] (const std::pair<String,std::shared_ptr<Entry>>& p)
+                            { return p.first == key; });
+    theirEntries.emplace_front (key, entry);
+    shrink();
+  }
+}
+
+void TaQLResultCache::invalidate (const String& tableName)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  theirEntries.remove_if ([&tableName] (const std::pair<String,std::shared_ptr<Entry>>& p)
+                          { for (const Table& tab : p.second->tables) {
+                              if (tab.tableName() == tableName) {
+                                return true;
+                              }
+                            }
+                            return false; });
+}
+
+void TaQLResultCache::clear()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  theirEntries.clear();
+}
+
+size_t TaQLResultCache::maxSize()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  init();
+  return theirMaxSize;
+}
+
+void TaQLResultCache::setMaxSize (size_t maxSize)
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  theirInit    = True;
+  theirMaxSize = maxSize;
+  shrink();
+}
+
+size_t TaQLResultCache::size()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  return theirEntries.size();
+}
+
+uInt64 TaQLResultCache::nhits()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  return theirNHits;
+}
+
+uInt64 TaQLResultCache::nmisses()
+{
+  std::lock_guard<std::mutex> lock(theirMutex);
+  return theirNMisses;
+}
+
+void TaQLResultCache::init()
+{
+  if (! theirInit) {
+    uInt nres;
+    AipsrcValue<uInt>::find (nres, "table.taql.resultcache.size", 0);
+    theirMaxSize = nres;
+    theirInit    = True;
+  }
+}
+
+Bool TaQLResultCache::isValid (Entry& entry)
+{
+  // A relative name might refer to another table now.
+  for (size_t i=0; i<entry.names.size(); ++i) {
+    if (Path(entry.names[i]).absoluteName() != entry.absNames[i]) {
+      return False;
+    }
+  }
+  for (size_t i=0; i<entry.tables.size(); ++i) {
+    Table& tab = entry.tables[i];
+    // The table might have been reopened for write in this process.
+    if (! canCache (tab)) {
+      return False;
+    }
+    // Get a read lock (without waiting) to update the modify counter
+    // from the lock file. If not succeeding, another process is writing.
+    if (! tab.hasLock (FileLocker::Read)) {
+      if (! tab.lock (FileLocker::Read, 1)) {
+        return False;
+      }
+      tab.unlock();
+    }
+    if (tab.modifyCounter() != entry.counters[i]  ||
+        tab.nrow() != entry.nrows[i]) {
+      return False;
+    }
+  }
+  return True;
+}
+
+TaQLResult TaQLResultCache::copyResult (const TaQLResult& result)
+{
+  if (result.isTable()  &&  result.table().tableType() == Table::Memory) {
+    const Table& tab = result.table();
+    return TaQLResult (tab.copyToMemoryTable (tab.tableName()));
+  }
+  return result;
+}
+
+void TaQLResultCache::shrink()
+{
+  while (theirEntries.size() > theirMaxSize) {
+    theirEntries.pop_back();
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,196 @@
+//# TaQLResultCache.h: Cache of the results of read-only TaQL commands
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef TABLES_TAQLRESULTCACHE_H
+#define TABLES_TAQLRESULTCACHE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/TaQLResult.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// Cache of the results of read-only TaQL commands
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTaQLResultCache">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TaQLPrepared>TaQLPrepared</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Monitoring tools often execute the same TaQL query many times on tables
+// that hardly change. TaQLResultCache keeps the results of SELECT, COUNT
+// and CALC commands in a process-wide cache, so such a query is only
+// evaluated again if one of its tables has been changed.
+// <br>The cache is used by <linkto class=TaQLPrepared>TaQLPrepared</linkto>
+// (thus also by <src>tableCommand</src>). The key of a result is the
+// normalized text of the parse tree, the TaQL style, and the values of
+// the bind parameters. Because a table name in the command can be
+// relative to the working directory, the cache also keeps the absolute
+// names of the tables as resolved when the result was made. A result is
+// only reused if the names in the command still resolve to the same tables.
+// A command is not cached if it uses temporary tables, a GIVING clause,
+// a nondeterministic function (such as <src>rand</src> or
+// <src>datetime()</src> giving the current time), or bind parameters that
+// are not constant scalars.
+// <br>For each table used by the command, the cache keeps its modify
+// counter and nr of rows. A result is only reused if all tables still
+// have the same counter and nr of rows. The modify counter is kept in the
+// lock file and changes each time another process writes the table,
+// so only persistent tables opened readonly in this process and using read
+// locking are cached. A result is discarded as soon as one of its tables
+// is opened for write in this process (e.g., by a TaQL UPDATE command).
+// TaQLPrepared also discards the results using the tables changed by a
+// TaQL command.
+// <br>A resulting row set (a reference table) is shared by all users of
+// the result, so it should not be changed. A result in a memory table
+// (e.g., of an aggregate) is copied to and from the cache.
+// <br>The cache holds at most <src>maxSize()</src> results; the least
+// recently used one is removed if the cache gets too large. Note that a
+// cached result keeps its tables open.
+// The default maximum size is given by the aipsrc variable
+// <src>table.taql.resultcache.size</src>; it defaults to 0, thus the cache
+// is disabled by default.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   TaQLResultCache::setMaxSize (32);
+//   // The second execution takes the result from the cache if the table
+//   // has not changed in the mean time.
+//   Table t1 = tableCommand ("select from my.ms where ANTENNA1=0").table();
+//   Table t2 = tableCommand ("select from my.ms where ANTENNA1=0").table();
+// </srcblock>
+// </example>
+
+// <motivation>
+// Dashboards and notebooks run the same selections over and over again
+// on tables that did not change.
+// </motivation>
+
+class TaQLResultCache
+{
+public:
+  // Can the results of commands using the table be cached?
+  // It is the case for a persistent root table that is not writable
+  // in this process and using read locking.
+  static Bool canCache (const Table& table);
+
+  // Get the result for the given key. False is returned if the key is not
+  // in the cache or if one of the tables of the result has changed.
+  static Bool get (const String& key, TaQLResult& result,
+                   Vector<String>& columnNames, String& commandType,
+                   std::vector<Table>& tables);
+
+  // Add the result of a command using the given tables to the cache.
+  // The names of the tables as given in the command must be given as well
+  // (empty for a table resulting from a subquery).
+  // Nothing is done if a table cannot be cached or if the result is
+  // a cursor or a persistent table.
+  static void put (const String& key, const TaQLResult& result,
+                   const Vector<String>& columnNames,
+                   const String& commandType,
+                   const std::vector<Table>& tables,
+                   const std::vector<String>& tableNames);
+
+  // Remove the results using the given table from the cache.
+  static void invalidate (const String& tableName);
+
+  // Remove all results from the cache.
+  static void clear();
+
+  // Get or set the maximum nr of results in the cache.
+  // <group>
+  static size_t maxSize();
+  static void setMaxSize (size_t maxSize);
+  // </group>
+
+  // Get the nr of results in the cache.
+  static size_t size();
+
+  // Get the nr of cache hits and misses (for statistics and tests).
+  // <group>
+  static uInt64 nhits();
+  static uInt64 nmisses();
+  // </group>
+
+private:
+  // A cached result with the state of its tables.
+  struct Entry
+  {
+    TaQLResult           result;
+    Vector<String>       columnNames;
+    String               commandType;
+    std::vector<Table>   tables;
+    std::vector<String>  names;
+    std::vector<String>  absNames;
+    std::vector<uInt>    counters;
+    std::vector<rownr_t> nrows;
+  };
+
+  // Read the maximum size from the aipsrc variable.
+  // The mutex must have been locked.
+  static void init();
+
+  // Do the table names still resolve to the same tables and
+  // have the tables of the entry not been changed?
+  static Bool isValid (Entry& entry);
+
+  // Copy a result in a memory table.
+  static TaQLResult copyResult (const TaQLResult& result);
+
+  // Remove the least recently used results until the size fits.
+  // The mutex must have been locked.
+  static void shrink();
+
+  static std::list<std::pair<String,std::shared_ptr<Entry>>> theirEntries;
+  static size_t     theirMaxSize;
+  static Bool       theirInit;
+  static uInt64     theirNHits;
+  static uInt64     theirNMisses;
+  static std::mutex theirMutex;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -29,6 +29,7 @@
 
 //# Includes
 #include <casacore/casa/aips.h>
+#include <mutex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -76,6 +77,11 @@ class TableExprData;
 // <linkto class=TableExprNodeRecordField>TableExprNodeRecordField</linkto>
 // has to be used to know the index of the fields in the expression.
 // It uses a record (description) for this purpose.
+// <p>
+// If an expression is evaluated by multiple threads, each thread has to use
+// its own TableExprId object. All of them must be given the same mutex
+// (using function <src>setMutex</src>), which is used by the column nodes
+// to serialize reading the column values.
 // </synopsis>
 
 // <example>
@@ -133,7 +139,15 @@ public:
     // Set the record.
     void setRecord (const RecordInterface&);
 
+    // Set the mutex to be locked when reading table columns.
+    // A null pointer (the default) means no locking is done.
+    void setMutex (std::mutex* mutex);
+
+    // Get the mutex (null pointer if no locking has to be done).
+    std::mutex* mutex() const;
+
 private:
+    std::mutex*                  mutex_p;
     Int                          type_p;
     union {
       Int64                      row_p;
@@ -145,22 +159,26 @@ private:
 
 
 inline TableExprId::TableExprId()
-  : type_p (0),
+  : mutex_p (0),
+    type_p  (0),
     row_p  (-1)
 {}
 
 inline TableExprId::TableExprId (rownr_t rowNumber)
-  : type_p (0),
+  : mutex_p (0),
+    type_p  (0),
     row_p  (rowNumber)
 {}
 
 inline TableExprId::TableExprId (const RecordInterface& record)
-  : type_p   (-1),
+  : mutex_p  (0),
+    type_p   (-1),
     record_p (&record)
 {}
 
 inline TableExprId::TableExprId (const TableExprData& data)
-  : type_p (-2),
+  : mutex_p (0),
+    type_p  (-2),
     data_p (&data)
 {}
 
@@ -189,6 +207,16 @@ inline void TableExprId::setRecord (const RecordInterface& record)
     record_p = &record;
 }
 
+inline void TableExprId::setMutex (std::mutex* mutex)
+{
+    mutex_p = mutex;
+}
+
+inline std::mutex* TableExprId::mutex() const
+{
+    return mutex_p;
+}
+
 inline Bool TableExprId::byRow() const
 {
     return type_p >= 0;
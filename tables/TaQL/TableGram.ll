@@ -246,6 +246,7 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
     between TABLENAMEstate and EXPRstate.
     A table name can be $nnn indicating a temporary table. It can optionally
     be followed by :: and the name of a subtable of that temporary table.
+    In an expression $nnn is a bind parameter (see TaQLPrepared.h).
 
     The order in the following list is important, since, for example,
     the word "giving" must be recognized as GIVING and not as NAME.
@@ -1846,6 +1846,11 @@ simbexpr:  LPAREN orexpr RPAREN     /* subexpression in parentheses */
          | set {
 	       $$ = $1;
 	   }
+         | TABNAME {               /* bind parameter $n */
+	       $$ = new TaQLNode(
+                    new TaQLParamNodeRep (*$1));
+	       TaQLNode::theirNodesCreated.push_back ($$);
+	   }
          ;
 
 /* Column name or keyword name (possibly with alias) */
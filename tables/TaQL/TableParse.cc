@@ -24,12 +24,9 @@
 //#                        Charlottesville, VA 22903-2475 USA
 
 #include <casacore/tables/TaQL/TableParse.h>
-#include <casacore/tables/TaQL/TaQLNode.h>
-#include <casacore/tables/TaQL/TaQLNodeHandler.h>
-#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/TaQLPrepared.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/Vector.h>
-#include <casacore/casa/OS/Timer.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -82,29 +79,26 @@ TaQLResult tableCommand (const String& str,
                          String& commandType)
 {
   commandType = "error";
-  // Do the first parse step. It returns a raw parse tree
-  // (or throws an exception).
-  Timer timer;
-  TaQLNode tree = TaQLNode::parse(str);
-  // Now process the raw tree and get the final ParseSelect object.
-  try {
-    TaQLNodeHandler treeHandler;
-    TaQLNodeResult res = treeHandler.handleTree (tree, tempTables);
-    const TaQLNodeHRValue& hrval = TaQLNodeHandler::getHR(res);
-    commandType = hrval.getString();
-    TableExprNode expr = hrval.getExpr();
-    if (tree.style().doTiming()) {
-      timer.show (" Total time   ");
-    }
-    if (! expr.isNull()) {
-      return TaQLResult(expr);                 // result of CALC command
-    }
-    //# Copy the possibly selected column names.
-    cols.reference (hrval.getNames());
-    return TaQLResult(hrval.getTable());
-  } catch (std::exception& x) {
-    throw TableParseError ("'" + str + "'\n  " + x.what());
+  TaQLPrepared command(str, tempTables);
+  return command.execute (cols, commandType);
+}
+
+TaQLResult tableCursor (const String& str, rownr_t batchSize)
+{
+  std::vector<const Table*> tmp;
+  return tableCursor (str, tmp, batchSize);
+}
+
+TaQLResult tableCursor (const String& str,
+                        const std::vector<const Table*>& tempTables,
+                        rownr_t batchSize)
+{
+  if (batchSize == 0) {
+    throw TableParseError ("'" + str + "'\n  batch size of a cursor "
+                           "must be positive");
   }
+  TaQLPrepared command(str, tempTables);
+  return command.cursor (batchSize);
 }
 
 } //# NAMESPACE CASACORE - END
@@ -47,6 +47,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // column names can be returned.
   // Zero or more temporary tables can be used in the command
   // using the $nnn syntax.
+  // <br>Use <linkto class=TaQLPrepared>TaQLPrepared</linkto> to execute
+  // a command multiple times, possibly with bind parameters.
   // </synopsis>
   // <group name=tableCommand>
   TaQLResult tableCommand (const String& command);
@@ -69,6 +71,22 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                            String& commandType);
   // </group>
 
+  // <synopsis>
+  // Parse and execute the given TaQL SELECT command and return a
+  // TaQLResult holding a <linkto class=TaQLCursor>TaQLCursor</linkto>
+  // delivering the resulting rows in batches of the given size.
+  // If the command only uses WHERE, LIMIT/OFFSET and a projection of
+  // columns, the selection is evaluated incrementally while iterating.
+  // Otherwise the query is fully executed first.
+  // An exception is thrown if the command is not a SELECT command.
+  // </synopsis>
+  // <group name=tableCursor>
+  TaQLResult tableCursor (const String& command, rownr_t batchSize=4096);
+  TaQLResult tableCursor (const String& command,
+                          const std::vector<const Table*>& tempTables,
+                          rownr_t batchSize=4096);
+  // </group>
+
 
 } //# NAMESPACE CASACORE - END
 
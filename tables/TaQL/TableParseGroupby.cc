@@ -257,25 +257,33 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Group the data according to the (maybe empty) groupby.
     // Step through the table in the normal order which may not be the
     // groupby order.
-    // A map<key,int> is used to keep track of the results where the int
-    // is the index in a vector of a set of aggregate function objects.
+    // A hash map<key,int> is used to keep track of the results where the
+    // int is the index in a vector of a set of aggregate function objects.
     std::vector<std::shared_ptr<TableExprGroupFuncSet>> funcSets;
-    std::map<TableExprGroupKeySet, Int> keyFuncMap;
+    std::unordered_map<TableExprGroupKeySet, Int,
+                       TableExprGroupKeySet::Hash> keyFuncMap;
     // Create the set of groupby key objects.
+    // The key of the previous row is kept, because consecutive rows
+    // often belong to the same group.
     TableExprGroupKeySet keySet(itsGroupbyNodes);
+    TableExprGroupKeySet lastKeySet(itsGroupbyNodes);
+    Int groupnr = -1;
     // Loop through all rows.
     // For each row generate the key to get the right entry.
     TableExprId rowid(0);
     for (rownr_t i=0; i<rownrs.size(); ++i) {
       rowid.setRownr (rownrs[i]);
       keySet.fill (itsGroupbyNodes, rowid);
-      Int groupnr = funcSets.size();
-      std::map<TableExprGroupKeySet, Int>::iterator iter=keyFuncMap.find (keySet);
-      if (iter == keyFuncMap.end()) {
-        keyFuncMap[keySet] = groupnr;
-        funcSets.push_back (std::make_shared<TableExprGroupFuncSet>(nodes));
-      } else {
-        groupnr = iter->second;
+      if (groupnr < 0  ||  !(keySet == lastKeySet)) {
+        auto iter = keyFuncMap.find (keySet);
+        if (iter == keyFuncMap.end()) {
+          groupnr = funcSets.size();
+          keyFuncMap[keySet] = groupnr;
+          funcSets.push_back (std::make_shared<TableExprGroupFuncSet>(nodes));
+        } else {
+          groupnr = iter->second;
+        }
+        lastKeySet = keySet;
       }
       funcSets[groupnr]->apply (rowid);
     }
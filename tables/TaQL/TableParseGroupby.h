@@ -30,6 +30,9 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprGroup.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <functional>
+#include <unordered_map>
 #include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -125,6 +128,23 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     std::vector<std::shared_ptr<TableExprGroupFuncSet>> multiKey
     (const std::vector<TableExprNodeRep*>&, const Vector<rownr_t>& rownrs) const;
 
+    // Hash and equality functors for a single groupby key.
+    // All NaN values are treated as equal, thus form a single group.
+    // <group>
+    struct SingleKeyHash {
+      size_t operator() (Int64 v) const
+        { return std::hash<Int64>() (v); }
+      size_t operator() (Double v) const
+        { return isNaN(v)  ?  0 : std::hash<Double>() (v); }
+    };
+    struct SingleKeyEqual {
+      bool operator() (Int64 v1, Int64 v2) const
+        { return v1 == v2; }
+      bool operator() (Double v1, Double v2) const
+        { return v1 == v2  ||  (isNaN(v1)  &&  isNaN(v2)); }
+    };
+    // </group>
+
     // Create the set of aggregate functions and groupby keys in case
     // a single groupby key is given.
     // This offers much faster map access then the general multipleKeys.
@@ -136,11 +156,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       // We have to group the data according to the (possibly empty) groupby.
       // We step through the table in the normal order which may not be the
       // groupby order.
-      // A map<key,int> is used to keep track of the results where the int
-      // is the index in a vector of a set of aggregate function objects.
+      // A hash map<key,int> is used to keep track of the results where the
+      // int is the index in a vector of a set of aggregate function objects.
       std::vector<std::shared_ptr<TableExprGroupFuncSet>> funcSets;
-      std::map<T, int> keyFuncMap;
-      T lastKey = std::numeric_limits<T>::max();
+      std::unordered_map<T, int, SingleKeyHash, SingleKeyEqual> keyFuncMap;
+      T lastKey = 0;
       int groupnr = -1;
       // Loop through all rows.
       // For each row generate the key to get the right entry.
@@ -149,8 +169,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       for (rownr_t i=0; i<rownrs.size(); ++i) {
         rowid.setRownr (rownrs[i]);
         itsGroupbyNodes[0].get (rowid, key);
-        if (key != lastKey) {
-          typename std::map<T, int>::iterator iter = keyFuncMap.find (key);
+        if (groupnr < 0  ||  key != lastKey) {
+          auto iter = keyFuncMap.find (key);
           if (iter == keyFuncMap.end()) {
             groupnr = funcSets.size();
             keyFuncMap[key] = groupnr;
@@ -159,6 +179,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
           } else {
             groupnr = iter->second;
           }
+          lastKey = key;
         }
         rowid.setRownr (rownrs[i]);
         funcSets[groupnr]->apply (rowid);
@@ -29,6 +29,7 @@
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprNodeUtil.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <sstream>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -72,9 +73,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                                                  True, tempTables, stack,
                                                  itsParent->joins().size() - 1);
     itsJoinTables.push_back (tab);
+    itsJoinShorthands.push_back (shorthand);
   }
 
-  void TableParseJoin::handleCondition (const TableExprNode& expr)
+  void TableParseJoin::handleCondition (const TableExprNode& expr,
+                                        const String& condText)
   {
     // Check that no aggregate functions are used.
     if (! TableExprNodeUtil::getAggrNodes(expr.getRep().get()).empty()) {
@@ -84,7 +87,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Split the condition recursively into its AND parts and handle them.
     std::vector<TENShPtr> parts;
     splitAnd (expr.getRep(), parts);
-    handleConditionParts (parts);
+    handleConditionParts (parts, condText);
   }
 
   void TableParseJoin::splitAnd (const TENShPtr& node, std::vector<TENShPtr>& parts)
@@ -100,7 +103,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
   }
 
-  void TableParseJoin::handleConditionParts (std::vector<TENShPtr>& parts)
+  void TableParseJoin::handleConditionParts (std::vector<TENShPtr>& parts,
+                                             const String& condText)
   {
     std::vector<Table> mainTables;
     std::vector<Table> joinTables;
@@ -190,11 +194,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Everything seems to be fine.
     // Now read the join data for each part.
     // Joins can only be done on Int, Double, String and DateTime (handled as Double).
-    std::vector<rownr_t> rows(nrow);
-    for (size_t i=0; i<nrow; ++i) {
-      rows[i] = i;
+    // A tree made by a previous query can be used if the join is the same.
+    String key = makeCacheKey (condText, eqMainParts);
+    std::shared_ptr<TaQLJoinBase> cached;
+    if (! key.empty()) {
+      cached = TaQLJoinCache::get (key);
+    }
+    if (cached) {
+      itsJoin = cached->rebind (eqMainParts, 0);
+    } else {
+      std::vector<rownr_t> rows(nrow);
+      for (size_t i=0; i<nrow; ++i) {
+        rows[i] = i;
+      }
+      itsJoin = TaQLJoin::createRecursive(eqMainParts, eqParts, rows, 0);
+      if (! key.empty()) {
+        TaQLJoinCache::put (key, itsJoin->rebind (std::vector<TableExprNode>(), 0));
+      }
     }
-    itsJoin = TaQLJoin::createRecursive(eqMainParts, eqParts, rows, 0);
     // Clear the cache in the TaQLJoinColumn nodes of the join conditions.
     for (const auto& tnode : eqParts) {
       std::vector<TableExprNodeRep*> nodes;
@@ -208,6 +225,33 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
   }
 
+  String TableParseJoin::makeCacheKey
+  (const String& condText, const std::vector<TableExprNode>& mainParts) const
+  {
+    if (condText.empty()) {
+      return String();
+    }
+    std::ostringstream key;
+    key << condText;
+    // The join tables must be persistent and cannot change in this process.
+    for (size_t i=0; i<itsJoinTables.size(); ++i) {
+      const Table& tab = itsJoinTables[i];
+      if (!tab.isRootTable()  ||  tab.tableType() != Table::Plain  ||
+          tab.isWritable()  ||  tab.isMarkedForDelete()) {
+        return String();
+      }
+      key << '|' << itsJoinShorthands[i] << '=' << tab.tableName()
+          << ':' << tab.nrow()
+          << ':' << tab.baseTablePtr()->getModifyCounter();
+    }
+    // The data types of the main expressions determine the type of lookup.
+    key << '|';
+    for (const TableExprNode& node : mainParts) {
+      key << Int(node.getRep()->dataType()) << ',';
+    }
+    return key.str();
+  }
+
   void TableParseJoin::addUniqueTables (std::vector<Table>& tables,
                                         const std::vector<Table>& other)
   {
@@ -80,7 +80,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                    const std::vector<TableParseQuery*>& stack);
 
     // Handle the ON condition of a join.
-    void handleCondition (const TableExprNode& expr);
+    // The condition text (including the TaQL style) is used in the key of
+    // the TaQLJoinCache. If empty, the cache is not used.
+    void handleCondition (const TableExprNode& expr,
+                          const String& condText = String());
 
     // Find the row in the join table for the given main table row.
     //# In the initialization phase of TaQLJoin, the itsJoin pointer
@@ -93,7 +96,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     void splitAnd (const TENShPtr& node, std::vector<TENShPtr>& parts);
 
     // Handle all AND parts of the join condition.
-    void handleConditionParts (std::vector<TENShPtr>& parts);
+    void handleConditionParts (std::vector<TENShPtr>& parts,
+                               const String& condText);
+
+    // Make the key of the join tree in the TaQLJoinCache.
+    // An empty string is returned if the join tables cannot be cached.
+    String makeCacheKey (const String& condText,
+                         const std::vector<TableExprNode>& mainParts) const;
 
     // Tell how many tables in the exprTables vector are the same as those
     // in the tables vector.
@@ -112,6 +121,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     TableParseQuery*   itsParent;
     std::vector<Table> itsFromTables;
     std::vector<Table> itsJoinTables;
+    std::vector<String> itsJoinShorthands;
     //# Index in TableParseQuery's vector of joins; <0 is no parent join.
     Int                itsParentJoinIndex;
     std::shared_ptr<TaQLJoinBase> itsJoin;
@@ -83,6 +83,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     const Block<String>& getColumnNames() const
       { return columnNames_p; }
 
+    // Get the original names of the projected columns.
+    const Block<String>& getColumnOldNames() const
+      { return columnOldNames_p; }
+
     // Get the projected column expressions.
     const Block<TableExprNode>& getColumnExpr() const
       { return columnExpr_p; }
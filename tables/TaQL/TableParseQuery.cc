@@ -57,6 +57,7 @@
 #include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/OS/ProfileRegistry.h>
 #include <casacore/casa/ostream.h>
 #include <algorithm>
 
@@ -80,7 +81,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       stride_p        (1),
       insSel_p        (0),
       noDupl_p        (False),
-      order_p         (Sort::Ascending)
+      order_p         (Sort::Ascending),
+      cursorBatch_p   (0)
   {}
 
   TableParseQuery::~TableParseQuery()
@@ -781,6 +783,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   std::shared_ptr<TableExprGroupResult> TableParseQuery::doGroupby
   (Bool showTimings)
   {
+    static ProfileCounter& pcounter = ProfileRegistry::counter ("TaQL.groupby");
+    ProfileTimer ptimer(pcounter);
     Timer timer;
     std::shared_ptr<TableExprGroupResult> result = groupby_p.execGroupAggr(rownrs_p);
     if (showTimings) {
@@ -805,6 +809,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   Bool TableParseQuery::doHaving (Bool showTimings,
                                   const std::shared_ptr<TableExprGroupResult>& groups)
   {
+    static ProfileCounter& pcounter = ProfileRegistry::counter ("TaQL.having");
+    ProfileTimer ptimer(pcounter);
     Timer timer;
     // Find the rows matching the HAVING expression.
     Bool done = groupby_p.execHaving (rownrs_p, groups);
@@ -815,13 +821,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
   //# Execute the sort.
-  void TableParseQuery::doSort (Bool showTimings)
+  void TableParseQuery::doSort (Bool showTimings, rownr_t nrfirst)
   {
     //# If no rows, return immediately.
     //# (the code below will fail if empty)
     if (rownrs_p.empty()) {
       return;
     }
+    static ProfileCounter& pcounter = ProfileRegistry::counter ("TaQL.orderby");
+    ProfileTimer ptimer(pcounter);
     Timer timer;
     // Create and fill a Sort object for all keys.
     // The data are kept in vector Arrays and are automatically deleted at the end.
@@ -832,11 +840,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
     rownr_t nrrow = rownrs_p.size();
     Vector<rownr_t> newRownrs (nrrow);
-    int sortOpt = Sort::HeapSort;
-    if (noDupl_p) {
-      sortOpt += Sort::NoDuplicates;
+    if (nrfirst > 0  &&  nrfirst < nrrow  &&  !noDupl_p) {
+      // Only the first rows are needed, so a top-k sort suffices.
+      sort.partialSort (newRownrs, nrrow, nrfirst);
+    } else {
+      int sortOpt = Sort::DefaultSort;
+      if (noDupl_p) {
+        sortOpt += Sort::NoDuplicates;
+      }
+      sort.sort (newRownrs, nrrow, sortOpt);
     }
-    sort.sort (newRownrs, nrrow, sortOpt);
     if (showTimings) {
       timer.show ("  Orderby     ");
     }
@@ -896,21 +909,26 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   (Bool showTimings, const Table& table,
    const std::shared_ptr<TableExprGroupResult>& groups)
   {
-    Timer timer;
     Table tabp;
-    // doProjectExpr might have been done for some columns, so clear first to avoid
-    // they are calculated twice.
-    update_p.clear();
-    if (tableProject_p.hasExpressions()) {
-      // Expressions used, so make a real table.
-      tabp = doProjectExpr (False, groups);
-    } else {
-      // Only column names used, so make a reference table.
-      tabp = table(rownrs_p);
-      tabp = tableProject_p.project (tabp);
-    }
-    if (showTimings) {
-      timer.show ("  Projection  ");
+    {
+      static ProfileCounter& pcounter =
+        ProfileRegistry::counter ("TaQL.projection");
+      ProfileTimer ptimer(pcounter);
+      Timer timer;
+      // doProjectExpr might have been done for some columns, so clear first
+      // to avoid they are calculated twice.
+      update_p.clear();
+      if (tableProject_p.hasExpressions()) {
+        // Expressions used, so make a real table.
+        tabp = doProjectExpr (False, groups);
+      } else {
+        // Only column names used, so make a reference table.
+        tabp = table(rownrs_p);
+        tabp = tableProject_p.project (tabp);
+      }
+      if (showTimings) {
+        timer.show ("  Projection  ");
+      }
     }
     if (distinct_p) {
       tabp = doDistinct (showTimings, tabp);
@@ -982,6 +1000,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   Table TableParseQuery::doDistinct (Bool showTimings, const Table& table)
   {
+    static ProfileCounter& pcounter = ProfileRegistry::counter ("TaQL.distinct");
+    ProfileTimer ptimer(pcounter);
     Timer timer;
     Table result;
     // Sort the table uniquely on all columns.
@@ -1237,6 +1257,20 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         cerr << "pre-empt WHERE at " << nrmax << " rows" << endl;
       }
     }
+    //# A streaming cursor evaluates WHERE and LIMIT/OFFSET on the fly,
+    //# so the selection is not done here (endrow_p has been set above).
+    if (cursorBatch_p > 0  &&  canStream()) {
+      cursor_p = std::make_shared<TaQLCursor>
+        (table, node_p, tableProject_p.getColumnOldNames(),
+         tableProject_p.getColumnNames(), offset_p, endrow_p, stride_p,
+         cursorBatch_p);
+      if (doTracing) {
+        cerr << "Streaming cursor created with batch size "
+             << cursorBatch_p << endl;
+      }
+      table_p = table;
+      return;
+    }
     //# First do the where selection.
     Table resultTable(table);
     if (! node_p.isNull()) {
@@ -1247,6 +1281,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       //#//            cout << rang[i].getColumn().columnDesc().name() << rang[i].start()
       //#//                 << rang[i].end() << endl;
       //#//        }
+      static ProfileCounter& pcounter = ProfileRegistry::counter ("TaQL.where");
+      ProfileTimer ptimer(pcounter);
       Timer timer;
       resultTable = table(node_p, nrmax);
       if (showTimings) {
@@ -1292,8 +1328,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       }
     }
     //# Then do the sort.
+    //# If a positive limit or endrow is given (without select distinct),
+    //# only the first endrow rows of the sorted result are needed.
     if (sort_p.size() > 0) {
-      doSort (showTimings);
+      rownr_t nrfirst = 0;
+      if (!distinct_p  &&  offset_p >= 0  &&  limit_p >= 0  &&  endrow_p > 0) {
+        nrfirst = endrow_p;
+        if (doTracing) {
+          cerr << "ORDERBY needs only first " << nrfirst << " rows" << endl;
+        }
+      }
+      doSort (showTimings, nrfirst);
       if (doTracing) {
         cerr << "ORDERBY resulted in " << rownrs_p.size() << " rows" << endl;
       }
@@ -1372,6 +1417,18 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
     //# Keep the table for later.
     table_p = resultTable;
+    if (cursorBatch_p > 0) {
+      cursor_p = std::make_shared<TaQLCursor> (table_p, cursorBatch_p);
+    }
+  }
+
+  Bool TableParseQuery::canStream() const
+  {
+    return commandType_p == PSELECT  &&  sort_p.empty()  &&  !distinct_p  &&
+      !groupby_p.isUsed()  &&  !tableProject_p.hasExpressions()  &&
+      tableProject_p.nColumnsPreCalc() == 0  &&
+      resultSet_p == 0  &&  resultType_p == 0  &&  resultName_p.empty()  &&
+      offset_p >= 0  &&  limit_p >= 0  &&  endrow_p >= 0  &&  stride_p >= 1;
   }
 
   String TableParseQuery::getTableStructure (const Vector<String>& parts,
@@ -37,6 +37,7 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprGroup.h>
+#include <casacore/tables/TaQL/TaQLCursor.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/Sort.h>
@@ -310,6 +311,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     const Table& getTable() const
       { return table_p; }
 
+    // Tell that execute has to create a TaQLCursor delivering the result
+    // in batches of the given size (0 means no cursor).
+    void setCursor (rownr_t batchSize)
+      { cursorBatch_p = batchSize; }
+
+    // Get the cursor created by execute (null if no cursor requested).
+    const std::shared_ptr<TaQLCursor>& getCursor() const
+      { return cursor_p; }
+
     // Show the structure of fromTables_p[0] using the options given in parts[2:].
     String getTableStructure (const Vector<String>& parts, const TaQLStyle& style);
 
@@ -375,7 +385,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                    const std::shared_ptr<TableExprGroupResult>& groups);
 
     // Do the sort step.
-    void doSort (Bool showTimings);
+    // If nrfirst > 0, only the first nrfirst rows of the sorted result are
+    // needed (because of a LIMIT), so a partial (top-k) sort is done.
+    void doSort (Bool showTimings, rownr_t nrfirst=0);
 
     // Do the limit/offset step.
     void  doLimOff (Bool showTimings);
@@ -398,6 +410,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Evaluate an int scalar expression.
     Int64 evalIntScaExpr (const TableExprNode& expr) const;
 
+    // Can the result of a SELECT be delivered by a streaming TaQLCursor?
+    // That is possible if only WHERE, LIMIT/OFFSET and a projection of
+    // column names are used.
+    Bool canStream() const;
+
     //# Data mambers.
     //# Command type.
     CommandType commandType_p;
@@ -453,6 +470,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Table projectExprTable_p;
     //# The resulting row numbers.
     Vector<rownr_t> rownrs_p;
+    //# The batch size of the cursor to create (0 = no cursor).
+    rownr_t cursorBatch_p;
+    //# The cursor created by execute.
+    std::shared_ptr<TaQLCursor> cursor_p;
   };
 
 
@@ -30,11 +30,19 @@
 
 namespace casacore {
 
-  // Define the static objects.
+  // Define the static objects at first use.
+  map<String,UDFBase::MakeUDFObject*>& UDFBase::registry()
+  {
+    static map<String,MakeUDFObject*> theirRegistry;
+    return theirRegistry;
+  }
   // Use a recursive mutex, because loading from a shared library can cause
   // a nested lock.
-  map<String,UDFBase::MakeUDFObject*> UDFBase::theirRegistry;
-  std::recursive_mutex UDFBase::theirMutex;
+  std::recursive_mutex& UDFBase::registryMutex()
+  {
+    static std::recursive_mutex theirMutex;
+    return theirMutex;
+  }
 
 
   UDFBase::UDFBase()
@@ -166,7 +174,8 @@ namespace casacore {
     } else {
       throw TableInvExpr("UDF " + name + " has an invalid name (no dot)");
     }
-    std::lock_guard<std::recursive_mutex> lock(theirMutex);
+    std::lock_guard<std::recursive_mutex> lock(registryMutex());
+    map<String,MakeUDFObject*>& theirRegistry = registry();
     map<String,MakeUDFObject*>::iterator iter = theirRegistry.find (fname);
     if (iter == theirRegistry.end()) {
       theirRegistry[fname] = func;
@@ -190,9 +199,10 @@ namespace casacore {
   {
     String fname(name);
     fname.downcase();
+    map<String,MakeUDFObject*>& theirRegistry = registry();
     map<String,MakeUDFObject*>::iterator iter;
     {
-      std::lock_guard<std::recursive_mutex> lock(theirMutex);
+      std::lock_guard<std::recursive_mutex> lock(registryMutex());
       // Try to find the function.
       iter = theirRegistry.find (fname);
       if (iter != theirRegistry.end()) {
@@ -209,13 +219,12 @@ namespace casacore {
       libname = fname.substr(0,j);
       libname = style.findSynonym (libname);
       fname   = libname + fname.substr(j);
+      std::lock_guard<std::recursive_mutex> lock(registryMutex());
       // Try to find the function with the synonym.
       iter = theirRegistry.find (fname);
       if (iter != theirRegistry.end()) {
         return iter->second (fname);
       }
-
-      std::lock_guard<std::recursive_mutex> lock(theirMutex);
       // See if the library is already loaded.
       iter = theirRegistry.find (libname);
       if (iter == theirRegistry.end()) {
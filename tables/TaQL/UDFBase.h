@@ -379,8 +379,43 @@ namespace casacore {
     //#    Function name * means that the library can contain any function,
     //#    which is intended for python functions (through PyTaQL).
     //# 2. The loaded libraries are kept in the map (with 0 funcptr).
-    static map<String, MakeUDFObject*> theirRegistry;
-    static std::recursive_mutex theirMutex;
+    //# The registry and its mutex are created at first use, so UDFs can
+    //# be registered during static initialization (see class UDFRegistrar).
+    static map<String, MakeUDFObject*>& registry();
+    static std::recursive_mutex& registryMutex();
+  };
+
+
+  // <summary>
+  // Register TaQL user defined functions during static initialization
+  // </summary>
+  // <use visibility=export>
+  // <synopsis>
+  // Defining a static UDFRegistrar object registers one or more UDFs
+  // when the library containing it is loaded. If an application is linked
+  // with that library, the functions are known without TaQL having to find
+  // and load the library at run time using DynLib, which involves
+  // searching the file system when the first query uses the library.
+  // <br>The constructor taking a function is meant to call the
+  // <src>register_libname</src> function of a UDF library.
+  // <br>Note that when linking statically, the object file containing the
+  // registrar has to be referenced to be linked in.
+  // </synopsis>
+  // <example>
+  // <srcblock>
+  //   static UDFRegistrar theirMyLibRegistrar (register_mylib);
+  // </srcblock>
+  // </example>
+  class UDFRegistrar
+  {
+  public:
+    // Register a single UDF.
+    UDFRegistrar (const String& name, UDFBase::MakeUDFObject* func)
+      { UDFBase::registerUDF (name, func); }
+
+    // Call the function registering the UDFs of a library.
+    explicit UDFRegistrar (void (*registerFunc)())
+      { registerFunc(); }
   };
 
 } // end namespace
@@ -0,0 +1,305 @@
+//# tExprNodeBatch.cc: Test program for batch evaluation of expressions
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprNodeSet.h>
+#include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for the batch evaluation of TableExprNode objects.
+// </summary>
+
+const rownr_t nrrow = 1000;
+
+Table makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Bool>("cb"));
+  td.addColumn (ScalarColumnDesc<Short>("cs"));
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ScalarColumnDesc<Float>("cf"));
+  td.addColumn (ScalarColumnDesc<Double>("cd"));
+  td.addColumn (ScalarColumnDesc<String>("cstr"));
+  td.addColumn (ArrayColumnDesc<Int>("arr"));
+  SetupNewTable newtab("tExprNodeBatch_tmp.tab", td, Table::New);
+  Table tab(newtab, Table::Memory, nrrow);
+  ScalarColumn<Bool> cb(tab, "cb");
+  ScalarColumn<Short> cs(tab, "cs");
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<Float> cf(tab, "cf");
+  ScalarColumn<Double> cd(tab, "cd");
+  ScalarColumn<String> cstr(tab, "cstr");
+  ArrayColumn<Int> arr(tab, "arr");
+  for (rownr_t i=0; i<nrrow; ++i) {
+    cb.put (i, i%3 == 0);
+    cs.put (i, Int(i%100) - 50);
+    ci.put (i, i%17);
+    cf.put (i, i*0.25);
+    cd.put (i, i*0.1 - 20);
+    cstr.put (i, String::toString(i%10));
+    // Every 7th row has an empty array.
+    Vector<Int> vec(i%7 == 0 ? 0 : 3, Int(i%5) - 2);
+    arr.put (i, vec);
+  }
+  return tab;
+}
+
+// Compare the batch result with the row by row result.
+// Do it starting at row 0 and at an arbitrary row.
+void checkBool (const TableExprNode& expr)
+{
+  for (rownr_t st : {rownr_t(0), rownr_t(123)}) {
+    rownr_t nr = nrrow - st;
+    Block<Bool> vals(nr);
+    expr.getBatch (TableExprId(st), nr, vals.storage());
+    for (rownr_t i=0; i<nr; ++i) {
+      AlwaysAssertExit (vals[i] == expr.getBool (TableExprId(st+i)));
+    }
+  }
+}
+
+void checkInt (const TableExprNode& expr)
+{
+  for (rownr_t st : {rownr_t(0), rownr_t(123)}) {
+    rownr_t nr = nrrow - st;
+    std::vector<Int64> vals(nr);
+    expr.getBatch (TableExprId(st), nr, vals.data());
+    for (rownr_t i=0; i<nr; ++i) {
+      AlwaysAssertExit (vals[i] == expr.getInt (TableExprId(st+i)));
+    }
+  }
+}
+
+void checkDouble (const TableExprNode& expr)
+{
+  for (rownr_t st : {rownr_t(0), rownr_t(123)}) {
+    rownr_t nr = nrrow - st;
+    std::vector<Double> vals(nr);
+    expr.getBatch (TableExprId(st), nr, vals.data());
+    for (rownr_t i=0; i<nr; ++i) {
+      Double v = expr.getDouble (TableExprId(st+i));
+      AlwaysAssertExit (vals[i] == v  ||  (isNaN(vals[i]) && isNaN(v)));
+    }
+  }
+}
+
+void doColumns (const Table& tab)
+{
+  checkBool (tab.col("cb"));
+  checkInt (tab.col("cs"));
+  checkInt (tab.col("ci"));
+  checkDouble (tab.col("ci"));
+  checkDouble (tab.col("cf"));
+  checkDouble (tab.col("cd"));
+  // A constant.
+  checkDouble (TableExprNode(3.5));
+}
+
+void doMath (const Table& tab)
+{
+  checkInt (tab.col("ci") + tab.col("cs"));
+  checkInt (tab.col("ci") - 3);
+  checkInt (tab.col("ci") * tab.col("cs"));
+  checkDouble (tab.col("ci") * tab.col("cs"));
+  checkDouble (tab.col("cd") + tab.col("ci"));
+  checkDouble (tab.col("cd") - tab.col("cf"));
+  checkDouble (2. * tab.col("cd"));
+  checkDouble (tab.col("cd") / tab.col("ci"));
+  // A constant left operand of a non-commutative operator.
+  checkInt (3 - tab.col("ci"));
+  checkDouble (100. / tab.col("cf"));
+  // Modulo is evaluated row by row.
+  checkInt (tab.col("ci") % 5);
+}
+
+void doFunc (const Table& tab)
+{
+  checkDouble (sin(tab.col("cd")));
+  checkDouble (cos(tab.col("cf")));
+  checkDouble (sqrt(tab.col("cf")));
+  checkDouble (log(tab.col("cd")));
+  checkDouble (exp(tab.col("cd") / 100.));
+  checkDouble (square(tab.col("cd")));
+  checkDouble (cube(tab.col("cd")));
+  checkDouble (abs(tab.col("cd")));
+  checkDouble (floor(tab.col("cd")));
+  checkDouble (ceil(tab.col("cf")));
+  checkDouble (pow(tab.col("cf"), 2.));
+  checkDouble (atan2(tab.col("cd"), tab.col("cf")));
+  checkDouble (fmod(tab.col("cd"), 3.));
+  checkDouble (min(tab.col("cd"), tab.col("cf")));
+  checkDouble (max(tab.col("cd"), 1.));
+  // Integer functions are evaluated row by row.
+  checkInt (abs(tab.col("cs")));
+  checkDouble (abs(tab.col("cs")));
+}
+
+void doLogic (const Table& tab)
+{
+  checkBool (tab.col("cb") == (tab.col("ci") > 8));
+  checkBool (tab.col("cb") != True);
+  checkBool (tab.col("ci") == 3);
+  checkBool (tab.col("ci") != tab.col("cs"));
+  checkBool (tab.col("ci") < tab.col("cs"));
+  checkBool (tab.col("ci") >= 10);
+  checkBool (tab.col("cd") == 0.);
+  checkBool (tab.col("cd") != tab.col("cf"));
+  checkBool (tab.col("cd") > tab.col("cf"));
+  checkBool (tab.col("cd") <= 5.);
+  checkBool (5. > tab.col("cd"));
+  checkBool (10 >= tab.col("ci"));
+  checkBool (tab.col("cb")  &&  tab.col("ci") > 5);
+  checkBool (tab.col("cb")  ||  sin(tab.col("cd")) > 0.5);
+  checkBool (! tab.col("cb"));
+  // Strings are evaluated row by row.
+  checkBool (tab.col("cstr") == "3"  ||  tab.col("ci") == 2);
+  // The right operand is evaluated for all, few or no rows.
+  checkBool (tab.col("cb")  &&  tab.col("cstr") == "3");
+  checkBool (tab.col("ci") == 3  &&  tab.col("cstr") == "3");
+  checkBool (tab.col("ci") > 99  &&  tab.col("cstr") == "3");
+  checkBool (tab.col("ci") < 99  ||  tab.col("cstr") == "3");
+  checkBool (tab.col("ci") != 3  ||  tab.col("cstr") == "3");
+}
+
+void doGuard (const Table& tab)
+{
+  // The right operand of AND and OR is only evaluated for the rows not
+  // decided by the left one, so the left one can guard it. Indexing an
+  // empty array throws an exception. Use long and short runs of rows.
+  TableExprNode elem (tab.col("arr")(TableExprNodeSet(IPosition(1,2))));
+  checkBool (nelements(tab.col("arr")) > 0  &&  elem > 0);
+  checkBool (nelements(tab.col("arr")) == 0  ||  elem > 0);
+  checkBool (tab.col("ci") != 0  &&  nelements(tab.col("arr")) > 0  &&
+             elem > 0);
+  checkBool (tab.col("ci") > 2  &&  nelements(tab.col("arr")) > 0  &&
+             elem > 0);
+}
+
+void doReorder (const Table& tab)
+{
+  // A much cheaper right operand of AND and OR is evaluated first if
+  // neither operand can throw an exception.
+  TableExprNode cheap (tab.col("ci") == 3);
+  TableExprNode costly (tab.col("cd") * tab.col("cf") +
+                        tab.col("cd") * tab.col("cd") - tab.col("cf") > 0.5);
+  AlwaysAssertExit (TableExprNodeUtil::isExceptionFree(cheap.getRep().get()));
+  AlwaysAssertExit (TableExprNodeUtil::isExceptionFree(costly.getRep().get()));
+  AlwaysAssertExit (2*TableExprNodeUtil::evaluationCost(cheap.getRep().get()) <
+                    TableExprNodeUtil::evaluationCost(costly.getRep().get()));
+  for (const TableExprNode& expr : {costly && cheap, costly || cheap}) {
+    const TableExprNodeBinary* node =
+      dynamic_cast<const TableExprNodeBinary*>(expr.getRep().get());
+    AlwaysAssertExit (node->getLeftChild() == cheap.getRep());
+    checkBool (expr);
+  }
+  // A costly operand using a function or indexing is not reordered,
+  // because it might be guarded by the left operand.
+  TableExprNode guard (nelements(tab.col("arr")) > 0);
+  TableExprNode func (sin(tab.col("cd")) + cos(tab.col("cf")) +
+                      sqrt(tab.col("cf")) > 0.5);
+  AlwaysAssertExit (! TableExprNodeUtil::isExceptionFree(func.getRep().get()));
+  for (const TableExprNode& expr : {func && cheap, func || cheap,
+                                    guard && cheap}) {
+    const TableExprNodeBinary* node =
+      dynamic_cast<const TableExprNodeBinary*>(expr.getRep().get());
+    AlwaysAssertExit (node->getLeftChild() != cheap.getRep());
+    checkBool (expr);
+  }
+  // Operands of similar cost keep their order.
+  TableExprNode expr (tab.col("cb")  &&  tab.col("ci") == 3);
+  const TableExprNodeBinary* node =
+    dynamic_cast<const TableExprNodeBinary*>(expr.getRep().get());
+  AlwaysAssertExit (node->getLeftChild()->operType() ==
+                    TableExprNodeRep::OtColumn);
+}
+
+void doSelect (const Table& tab)
+{
+  // The selection evaluates the expression in batches.
+  TableExprNode expr (tab.col("cd") > 0.  &&  tab.col("ci") % 4 == 1);
+  Table sel = tab(expr);
+  Vector<rownr_t> rows = sel.rowNumbers();
+  rownr_t n = 0;
+  for (rownr_t i=0; i<nrrow; ++i) {
+    if (i*0.1 - 20 > 0  &&  (i%17)%4 == 1) {
+      AlwaysAssertExit (rows[n] == i);
+      n++;
+    }
+  }
+  AlwaysAssertExit (n == rows.size());
+  // Using a limit and offset.
+  Table sel2 = tab(expr, 10, 5);
+  AlwaysAssertExit (sel2.nrow() == 10);
+  AlwaysAssertExit (allEQ (sel2.rowNumbers(), rows(Slice(5,10))));
+  // A selection guarding an array index must not fail on the empty
+  // arrays (in every 7th row).
+  TableExprNode elem (tab.col("arr")(TableExprNodeSet(IPosition(1,1))));
+  Table sel3 = tab(nelements(tab.col("arr")) > 0  &&  elem >= 0);
+  n = 0;
+  for (rownr_t i=0; i<nrrow; ++i) {
+    if (i%7 != 0  &&  i%5 >= 2) {
+      AlwaysAssertExit (sel3.rowNumbers()[n] == i);
+      n++;
+    }
+  }
+  AlwaysAssertExit (n == sel3.nrow());
+}
+
+int main()
+{
+  try {
+    Table tab = makeTable();
+    doColumns (tab);
+    doMath (tab);
+    doFunc (tab);
+    doLogic (tab);
+    doGuard (tab);
+    doReorder (tab);
+    doSelect (tab);
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  } catch (...) {
+    cout << "Unexpected unknown exception" << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,132 @@
+//# tExprNodeParallel.cc: Test program for parallel evaluation of selections
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <fstream>
+#include <stdlib.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for the multi-threaded evaluation of a selection expression.
+// </summary>
+
+const rownr_t nrrow = 250000;
+
+Table makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ScalarColumnDesc<Double>("cd"));
+  SetupNewTable newtab("tExprNodeParallel_tmp.tab", td, Table::New);
+  Table tab(newtab, Table::Memory, nrrow);
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<Double> cd(tab, "cd");
+  for (rownr_t i=0; i<nrrow; ++i) {
+    ci.put (i, i%1000);
+    cd.put (i, i*0.5);
+  }
+  return tab;
+}
+
+// Check the selection against the expected row numbers.
+void check (const Table& sel, const Vector<rownr_t>& expRows)
+{
+  Vector<rownr_t> rows = sel.rowNumbers();
+  AlwaysAssertExit (rows.size() == expRows.size());
+  for (size_t i=0; i<rows.size(); ++i) {
+    AlwaysAssertExit (rows[i] == expRows[i]);
+  }
+}
+
+void doSelect (const Table& tab)
+{
+  // Select rows using a pure scalar expression.
+  TableExprNode expr = (tab.col("ci") % 7 == 3  &&
+                        sin(tab.col("cd")) > 0.)  ||  tab.col("ci") == 999;
+  AlwaysAssertExit (TableExprNodeUtil::isParallelSafe (expr.getRep().get()));
+  std::vector<rownr_t> exp;
+  for (rownr_t i=0; i<nrrow; ++i) {
+    Int vi = i%1000;
+    if ((vi%7 == 3  &&  sin(i*0.5) > 0)  ||  vi == 999) {
+      exp.push_back (i);
+    }
+  }
+  check (tab(expr), Vector<rownr_t>(exp));
+  // Skipping the first matching rows.
+  check (tab(expr, 0, 10),
+         Vector<rownr_t>(std::vector<rownr_t>(exp.begin()+10, exp.end())));
+  // A limit is evaluated sequentially.
+  check (tab(expr, 5),
+         Vector<rownr_t>(std::vector<rownr_t>(exp.begin(), exp.begin()+5)));
+  // Also select on a reference table.
+  Table sub = tab(tab.col("ci") < 900);
+  TableExprNode subexpr = sub.col("ci") == 100;
+  std::vector<rownr_t> subexp;
+  for (rownr_t i=100; i<nrrow; i+=1000) {
+    subexp.push_back (i);
+  }
+  check (sub(subexpr), Vector<rownr_t>(subexp));
+}
+
+void doNotSafe (const Table& tab)
+{
+  // Random numbers cannot be generated in parallel.
+  TableExprNode expr = tab.nodeRandom() < 2.  &&  tab.col("ci") == 1;
+  AlwaysAssertExit (! TableExprNodeUtil::isParallelSafe (expr.getRep().get()));
+  AlwaysAssertExit (tab(expr).nrow() == nrrow/1000);
+}
+
+int main()
+{
+  try {
+    // Use 4 threads for the selection.
+    {
+      std::ofstream rc("tExprNodeParallel_tmp.rc");
+      rc << "table.select.nthreads: 4" << endl;
+    }
+    setenv ("CASARCFILES", "tExprNodeParallel_tmp.rc", 1);
+    Table tab = makeTable();
+    doSelect (tab);
+    doNotSafe (tab);
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  } catch (...) {
+    cout << "Unexpected unknown exception" << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
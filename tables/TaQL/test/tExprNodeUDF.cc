@@ -82,6 +82,9 @@ public:
   }
 };
 
+// Register a UDF during static initialization.
+static UDFRegistrar theirRegistrar ("Test.UDF", TestUDF::makeObject);
+
 void makeTable()
 {
   TableDesc td;
@@ -98,7 +101,6 @@ void makeTable()
 int main()
 {
   try {
-    UDFBase::registerUDF ("Test.UDF", TestUDF::makeObject);
     UDFBase::registerUDF ("Test.UDFAggr", TestUDFAggr::makeObject);
     makeTable();
     Table tab("tExprNodeUDF_tmp.tab");
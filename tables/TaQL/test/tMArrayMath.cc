@@ -386,6 +386,90 @@ void doTestPartial()
   AlwaysAssertExit (allNear(mad.array(), aresd, 1e-5) && allEQ(mad.mask(), mres));
 }
 
+template<typename T>
+void checkPartial (const MArray<T>& ma, const MArray<T>& exp)
+{
+  AlwaysAssertExit (ma.shape().isEqual (exp.shape()));
+  AlwaysAssertExit (allNear(ma.array(), exp.array(), 1e-10));
+  AlwaysAssertExit (ma.hasMask() == exp.hasMask());
+  if (ma.hasMask()) {
+    AlwaysAssertExit (allEQ(ma.mask(), exp.mask()));
+  }
+}
+template<typename T>
+void checkPartialEQ (const MArray<T>& ma, const MArray<T>& exp)
+{
+  AlwaysAssertExit (ma.shape().isEqual (exp.shape()));
+  AlwaysAssertExit (allEQ(ma.array(), exp.array()));
+  AlwaysAssertExit (allEQ(ma.mask(), exp.mask()));
+}
+
+void doTestPartialMasked()
+{
+  // Compare the masked partial reductions with the functor based
+  // partialArrayMath for all combinations of collapse axes.
+  // Use an array slice to test non-contiguous data.
+  Cube<Double> full(15,6,7);
+  Cube<Bool> fullMask(15,6,7);
+  indgen (full, -20.);
+  for (size_t i=0; i<full.size(); ++i) {
+    full.data()[i] = sin(full.data()[i]) * 10;
+    fullMask.data()[i] = (i%3 == 0  ||  i%7 == 0);
+  }
+  // Mask a line entirely.
+  fullMask(Slice(), Slice(2), Slice(3)) = True;
+  Array<Double> arrs[2] = {full, full(Slice(1,13), Slice(0,6), Slice(0,7))};
+  Array<Bool> masks[2] = {fullMask,
+                          fullMask(Slice(1,13), Slice(0,6), Slice(0,7))};
+  for (int c=0; c<2; ++c) {
+    MArray<Double> ma(arrs[c], masks[c]);
+    MArray<Bool> mb(arrs[c] > 0., masks[c]);
+    for (int m=1; m<8; ++m) {
+      IPosition axes;
+      for (int ax=0; ax<3; ++ax) {
+        if ((m & (1<<ax)) != 0) {
+          axes.append (IPosition(1,ax));
+        }
+      }
+      if (axes.size() == 3) {
+        // The old code does not handle reduction of all axes.
+        continue;
+      }
+      checkPartial (partialSums(ma, axes),
+                    partialArrayMath(ma, axes, MSumFunc<Double>()));
+      checkPartial (partialSumSqrs(ma, axes),
+                    partialArrayMath(ma, axes, MSumSqrFunc<Double>()));
+      checkPartial (partialProducts(ma, axes),
+                    partialArrayMath(ma, axes, MProductFunc<Double>()));
+      checkPartial (partialMins(ma, axes),
+                    partialArrayMath(ma, axes, MMinFunc<Double>()));
+      checkPartial (partialMaxs(ma, axes),
+                    partialArrayMath(ma, axes, MMaxFunc<Double>()));
+      checkPartial (partialMeans(ma, axes),
+                    partialArrayMath(ma, axes, MMeanFunc<Double>()));
+      MArray<size_t> ntrue;
+      partialArrayMath (ntrue, mb, axes, MNTrueFunc<Bool,size_t>());
+      checkPartialEQ (partialNTrue(mb, axes), ntrue);
+      partialArrayMath (ntrue, mb, axes, MNFalseFunc<Bool,size_t>());
+      checkPartialEQ (partialNFalse(mb, axes), ntrue);
+      MArray<Bool> res;
+      partialArrayMath (res, mb, axes, MAllFunc<Bool>());
+      checkPartialEQ (partialAlls(mb, axes), res);
+      partialArrayMath (res, mb, axes, MAnyFunc<Bool>());
+      checkPartialEQ (partialAnys(mb, axes), res);
+      // Without a mask the result must match the Array functions.
+      MArray<Bool> mbu(mb.array());
+      AlwaysAssertExit (!partialAlls(mbu, axes).hasMask());
+      AlwaysAssertExit (allEQ(partialAlls(mbu, axes).array(),
+                              partialArrayMath(mb.array(), axes,
+                                               AllFunc<Bool>())));
+      AlwaysAssertExit (allEQ(partialAnys(mbu, axes).array(),
+                              partialArrayMath(mb.array(), axes,
+                                               AnyFunc<Bool>())));
+    }
+  }
+}
+
 void doTestBoxed()
 {
   // Test the boxed reduction functions.
@@ -738,6 +822,8 @@ int main()
     doTestReduce();
     cout << "doTestPartial" << endl;
     doTestPartial();
+    cout << "doTestPartialMasked" << endl;
+    doTestPartialMasked();
     cout << "doTestBoxed" << endl;
     doTestBoxed();
     cout << "doTestSliding" << endl;
@@ -0,0 +1,161 @@
+//# tRecordExprFilter.cc: Test program for class RecordExprFilter
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/tables/TaQL/RecordExprFilter.h>
+#include <casacore/tables/TaQL/RecordExpr.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for class RecordExprFilter.
+// </summary>
+
+Record makeRecord (Int i)
+{
+  Record sub;
+  sub.define ("x", Double(i%5));
+  Record rec;
+  rec.define ("ant", Int(i%7));
+  rec.define ("amp", Float(i*0.5));
+  rec.define ("name", String::toString(i%3));
+  rec.define ("flags", Vector<Bool>(3, i%4 == 0));
+  rec.define ("chan", Vector<uInt>(2, i));
+  rec.defineRecord ("sub", sub);
+  return rec;
+}
+
+// Check if the filter gives the same result as evaluating the expression
+// on the record itself.
+void check (const TableExprNode& expr)
+{
+  Record rec = makeRecord(0);
+  RecordExprFilter filter (rec.description(), expr);
+  std::vector<Record> recs;
+  std::vector<const RecordInterface*> ptrs;
+  for (Int i=0; i<100; ++i) {
+    recs.push_back (makeRecord(i));
+  }
+  uInt nmatch = 0;
+  for (const Record& r : recs) {
+    ptrs.push_back (&r);
+    Bool res;
+    expr.get (r, res);
+    AlwaysAssertExit (filter.matches(r) == res);
+    if (res) nmatch++;
+  }
+  // The same record object filled with other values.
+  for (Int i=0; i<100; ++i) {
+    rec = makeRecord(i);
+    Bool res;
+    expr.get (rec, res);
+    AlwaysAssertExit (filter.matches(rec) == res);
+  }
+  // Batch evaluation.
+  Vector<Bool> res1 = filter.matches (recs);
+  Vector<Bool> res2 = filter.matches (ptrs);
+  AlwaysAssertExit (allEQ (res1, res2));
+  AlwaysAssertExit (ntrue(res1) == nmatch);
+  std::vector<size_t> rows = filter.select (ptrs);
+  AlwaysAssertExit (rows.size() == nmatch);
+  for (size_t row : rows) {
+    AlwaysAssertExit (res1[row]);
+  }
+}
+
+void testExpr()
+{
+  Record rec = makeRecord(0);
+  TableExprNode ant  = makeRecordExpr (rec, "ant");
+  TableExprNode amp  = makeRecordExpr (rec, "amp");
+  TableExprNode name = makeRecordExpr (rec, "name");
+  TableExprNode flags = makeRecordExpr (rec, "flags");
+  TableExprNode chan = makeRecordExpr (rec, "chan");
+  TableExprNode x    = makeRecordExpr (rec, "sub.x");
+  check (ant == 3);
+  check (ant == 3  &&  amp > 10);
+  check (ant > 2  ||  name == "1");
+  check (any(flags)  &&  amp < 30);
+  check (sum(chan) > 50  &&  x != 2.);
+  check (isdefined(ant)  &&  amp+x > ant);
+  RecordExprFilter filter (rec.description(), ant > 2  &&  amp > ant);
+  AlwaysAssertExit (filter.nfields() == 2);
+}
+
+void testErrors()
+{
+  Record rec = makeRecord(0);
+  // The expression must be a bool scalar.
+  Bool failed = False;
+  try {
+    RecordExprFilter (rec.description(), makeRecordExpr(rec, "ant") + 1);
+  } catch (const TableInvExpr&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  // A record with another description.
+  RecordExprFilter filter (rec.description(), makeRecordExpr(rec, "ant") == 1);
+  Record other;
+  other.define ("ant", 1);
+  failed = False;
+  try {
+    filter.matches (other);
+  } catch (const TableInvExpr&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  // The field has another type.
+  Record rec2 = makeRecord(0);
+  rec2.removeField ("ant");
+  rec2.define ("ant", String("1"));
+  failed = False;
+  try {
+    filter.matches (rec2);
+  } catch (const std::exception&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+int main()
+{
+  try {
+    testExpr();
+    testErrors();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
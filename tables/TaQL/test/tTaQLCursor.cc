@@ -0,0 +1,148 @@
+//# tTaQLCursor.cc: Test program for class TaQLCursor
+//# Copyright (C) 2024
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/TaQL/TaQLCursor.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for class TaQLCursor.
+// </summary>
+
+const rownr_t nrrow = 1000;
+
+Table makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Bool>("cb"));
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ScalarColumnDesc<Double>("cd"));
+  SetupNewTable newtab("tTaQLCursor_tmp.tab", td, Table::New);
+  Table tab(newtab, Table::Memory, nrrow);
+  ScalarColumn<Bool> cb(tab, "cb");
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<Double> cd(tab, "cd");
+  for (rownr_t i=0; i<nrrow; ++i) {
+    cb.put (i, i%3 == 0);
+    ci.put (i, i%17);
+    cd.put (i, i*0.1 - 20);
+  }
+  return tab;
+}
+
+// Iterate through the cursor and compare the row numbers with the
+// result of the normal execution of the command.
+void check (const Table& tab, const String& command, rownr_t batchSize,
+            Bool mustStream, uInt ncol)
+{
+  std::vector<const Table*> tmp(1, &tab);
+  TaQLResult expRes = tableCommand (command, tmp);
+  Vector<rownr_t> expRows = expRes.table().rowNumbers (tab);
+  TaQLResult res = tableCursor (command, tmp, batchSize);
+  AlwaysAssertExit (res.isCursor()  &&  !res.isTable());
+  TaQLCursor& cursor = res.cursor();
+  AlwaysAssertExit (cursor.isStreaming() == mustStream);
+  // Do it twice to test reset.
+  for (uInt iter=0; iter<2; ++iter) {
+    std::vector<rownr_t> rows;
+    while (cursor.next()) {
+      AlwaysAssertExit (cursor.batch().nrow() > 0);
+      AlwaysAssertExit (cursor.batch().nrow() <= batchSize);
+      AlwaysAssertExit (cursor.batch().tableDesc().ncolumn() == ncol);
+      Vector<rownr_t> batchRows = cursor.batch().rowNumbers (tab);
+      rows.insert (rows.end(), batchRows.begin(), batchRows.end());
+    }
+    AlwaysAssertExit (cursor.atEnd());
+    AlwaysAssertExit (! cursor.next());
+    AlwaysAssertExit (cursor.nrowDone() == rows.size());
+    AlwaysAssertExit (rows.size() == expRows.size());
+    for (size_t i=0; i<rows.size(); ++i) {
+      AlwaysAssertExit (rows[i] == expRows[i]);
+    }
+    cursor.reset();
+  }
+}
+
+void testRename (const Table& tab)
+{
+  std::vector<const Table*> tmp(1, &tab);
+  TaQLResult res = tableCursor ("select ci as cx from $1 where cb", tmp, 64);
+  TaQLCursor& cursor = res.cursor();
+  AlwaysAssertExit (cursor.isStreaming());
+  AlwaysAssertExit (cursor.next());
+  ScalarColumn<Int> cx(cursor.batch(), "cx");
+  AlwaysAssertExit (cursor.batch().nrow() == 64);
+  for (rownr_t i=0; i<cursor.batch().nrow(); ++i) {
+    AlwaysAssertExit (cx(i) == Int((i*3) % 17));
+  }
+}
+
+void testNoSelect (const Table& tab)
+{
+  std::vector<const Table*> tmp(1, &tab);
+  Bool failed = False;
+  try {
+    tableCursor ("calc 1+2", tmp);
+  } catch (const TableParseError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+int main()
+{
+  try {
+    Table tab = makeTable();
+    // Streaming queries.
+    check (tab, "select from $1 where ci < 5", 100, True, 3);
+    check (tab, "select ci,cd from $1 where ci < 5", 7, True, 2);
+    check (tab, "select from $1 where cb && cd > 0", 4096, True, 3);
+    check (tab, "select ci from $1", 333, True, 1);
+    check (tab, "select from $1 where ci < 5 limit 20 offset 10", 6, True, 3);
+    check (tab, "select from $1 where ci < 5 limit 3:80:4", 5, True, 3);
+    check (tab, "select from $1 where ci > 100", 10, True, 3);
+    // Queries needing full execution.
+    check (tab, "select from $1 where ci < 5 orderby cd desc", 100, False, 3);
+    check (tab, "select distinct ci from $1 where cd > 10", 5, False, 1);
+    testRename (tab);
+    testNoSelect (tab);
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,156 @@
+//# tTaQLPrepared.cc: Test program for class TaQLPrepared
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/TaQL/TaQLPrepared.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <sstream>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for class TaQLPrepared.
+// </summary>
+
+const rownr_t nrrow = 100;
+
+Table makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ScalarColumnDesc<Double>("cd"));
+  td.addColumn (ScalarColumnDesc<String>("cs"));
+  SetupNewTable newtab("tTaQLPrepared_tmp.tab", td, Table::New);
+  Table tab(newtab, Table::Memory, nrrow);
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<Double> cd(tab, "cd");
+  ScalarColumn<String> cs(tab, "cs");
+  for (rownr_t i=0; i<nrrow; ++i) {
+    ci.put (i, i%7);
+    cd.put (i, i*0.5);
+    cs.put (i, String::toString(i%3));
+  }
+  return tab;
+}
+
+// Check if the prepared command gives the same rows as the command
+// with the values filled in.
+void check (TaQLPrepared& query, const std::vector<TableExprNode>& values,
+            const Table& tab, const String& command)
+{
+  std::vector<const Table*> tmp(1, &tab);
+  Vector<rownr_t> expRows = tableCommand(command, tmp).table().rowNumbers(tab);
+  Vector<rownr_t> rows = query.execute(values).table().rowNumbers(tab);
+  AlwaysAssertExit (rows.size() > 0);
+  AlwaysAssertExit (allEQ (rows, expRows));
+}
+
+void testSelect (const Table& tab)
+{
+  // $1 in the FROM clause is the temporary table; in expressions it is
+  // a bind parameter.
+  std::vector<const Table*> tmp(1, &tab);
+  TaQLPrepared query ("select from $1 where ci==$1 and cd between $2 and $3"
+                      " and cs!=$4", tmp);
+  for (Int i=0; i<7; ++i) {
+    check (query, {i, 2.*i, 40.+i, String("1")}, tab,
+           "select from $1 where ci==" + String::toString(i) +
+           " and cd between " + String::toString(2.*i) + " and " +
+           String::toString(40.+i) + " and cs!='1'");
+  }
+  AlwaysAssertExit (query.nexecuted() == 7);
+  // The parse tree shows the parameters.
+  ostringstream os;
+  query.tree().show (os);
+  AlwaysAssertExit (os.str().find("$2") != String::npos);
+  // Use setParam.
+  query.clearParams();
+  query.setParam (4, String("1"));
+  query.setParam (3, 40.);
+  query.setParam (2, 0.);
+  query.setParam (1, 3);
+  AlwaysAssertExit (query.execute().table().nrow() == 8);
+}
+
+void testCalc()
+{
+  TaQLPrepared query ("calc $1 + $2*2");
+  AlwaysAssertExit (query.execute({1, 2}).node().getInt(0) == 5);
+  AlwaysAssertExit (query.execute({1.5, 2}).node().getDouble(0) == 5.5);
+  // An array value.
+  Vector<Int> vec(3);
+  indgen (vec);
+  TaQLResult res = query.execute ({TableExprNode(vec), 1});
+  Array<Int64> arr = res.node().getArrayInt(0);
+  AlwaysAssertExit (arr.size() == 3  &&  arr.data()[2] == 4);
+}
+
+void testErrors (const Table& tab)
+{
+  std::vector<const Table*> tmp(1, &tab);
+  // A missing parameter value.
+  TaQLPrepared query ("select from $1 where ci==$2", tmp);
+  Bool failed = False;
+  try {
+    query.execute ({1});
+  } catch (const TableParseError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  AlwaysAssertExit (query.execute({1, 3}).table().nrow() == 14);
+  // A subtable name cannot be used for a parameter.
+  failed = False;
+  try {
+    TaQLPrepared ("calc $1::SUB + 1");
+  } catch (const std::exception&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+int main()
+{
+  try {
+    Table tab = makeTable();
+    testSelect (tab);
+    testCalc();
+    testErrors (tab);
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
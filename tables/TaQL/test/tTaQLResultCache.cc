@@ -0,0 +1,210 @@
+//# tTaQLResultCache.cc: Test program for class TaQLResultCache
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/tables/TaQL/TaQLResultCache.h>
+#include <casacore/tables/TaQL/TaQLPrepared.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/OS/Directory.h>
+#include <casacore/casa/iostream.h>
+#include <unistd.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for class TaQLResultCache.
+// </summary>
+
+const String tabName = "tTaQLResultCache_tmp.tab";
+
+void makeTable (const String& name=tabName, Int step=1)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  SetupNewTable newtab(name, td, Table::New);
+  Table tab(newtab, 100);
+  ScalarColumn<Int> ci(tab, "ci");
+  for (rownr_t i=0; i<tab.nrow(); ++i) {
+    ci.put (i, i*step);
+  }
+}
+
+// Execute the command and check if it is taken from the cache as expected.
+TaQLResult check (TaQLPrepared& query, Bool hit)
+{
+  uInt64 nhits = TaQLResultCache::nhits();
+  TaQLResult result = query.execute();
+  AlwaysAssertExit (TaQLResultCache::nhits() == nhits + (hit ? 1 : 0));
+  return result;
+}
+
+void testSelect()
+{
+  Table tab(tabName);
+  TaQLPrepared query ("select from " + tabName + " where ci < 10");
+  Table t1 = check(query, False).table();
+  AlwaysAssertExit (TaQLResultCache::size() == 1);
+  Table t2 = check(query, True).table();
+  AlwaysAssertExit (t1.nrow() == 10  &&  t2.nrow() == 10);
+  AlwaysAssertExit (allEQ (t1.rowNumbers(tab), t2.rowNumbers(tab)));
+  // The same command given by tableCommand uses the same cache entry.
+  uInt64 nhits = TaQLResultCache::nhits();
+  AlwaysAssertExit (tableCommand("select from " + tabName +
+                                 " where ci < 10").table().nrow() == 10);
+  AlwaysAssertExit (TaQLResultCache::nhits() == nhits + 1);
+}
+
+void testParams()
+{
+  TaQLPrepared query ("select from " + tabName + " where ci < $1");
+  query.setParams ({5});
+  AlwaysAssertExit (check(query, False).table().nrow() == 5);
+  AlwaysAssertExit (check(query, True).table().nrow() == 5);
+  query.setParams ({6});
+  AlwaysAssertExit (check(query, False).table().nrow() == 6);
+  query.setParams ({5});
+  AlwaysAssertExit (check(query, True).table().nrow() == 5);
+  // A double differs from an integer value.
+  query.setParams ({5.5});
+  AlwaysAssertExit (check(query, False).table().nrow() == 6);
+}
+
+void testAggregate()
+{
+  TaQLPrepared query ("select gsum(ci) as S from " + tabName);
+  Table t1 = check(query, False).table();
+  AlwaysAssertExit (ScalarColumn<Int64>(t1, "S")(0) == 4950);
+  // The result in a memory table is a copy, so changing it does not
+  // change the cached result.
+  ScalarColumn<Int64>(t1, "S").put (0, 0);
+  Table t2 = check(query, True).table();
+  AlwaysAssertExit (ScalarColumn<Int64>(t2, "S")(0) == 4950);
+}
+
+void testWrite()
+{
+  {
+    TaQLPrepared query ("select from " + tabName + " where ci < 10");
+    check (query, True);
+    // Opening the table for write invalidates the result.
+    Table tab(tabName, Table::Update);
+    ScalarColumn<Int>(tab, "ci").put (50, 0);
+    AlwaysAssertExit (check(query, False).table().nrow() == 11);
+    // A writable table is not cached.
+    AlwaysAssertExit (check(query, False).table().nrow() == 11);
+  }
+  // The table is closed now, so it can be opened readonly again.
+  TaQLResultCache::clear();
+  AlwaysAssertExit (TaQLResultCache::size() == 0);
+  Table tab(tabName);
+  TaQLPrepared query ("select from " + tabName + " where ci < 10");
+  AlwaysAssertExit (check(query, False).table().nrow() == 11);
+  AlwaysAssertExit (check(query, True).table().nrow() == 11);
+}
+
+void testNotCached()
+{
+  // Commands giving a different result each time are not cached.
+  TaQLPrepared q1 ("select from " + tabName + " where rand() < 0.5");
+  check (q1, False);
+  check (q1, False);
+  TaQLPrepared q2 ("calc datetime()");
+  check (q2, False);
+  check (q2, False);
+  TaQLPrepared q3 ("select from " + tabName + " where year() > 2000");
+  check (q3, False);
+  check (q3, False);
+  TaQLPrepared q4 ("select from " + tabName + " where ci < 10 giving "
+                   "tTaQLResultCache_tmp.giv");
+  check (q4, False);
+  check (q4, False);
+  // A date/time function with an argument is deterministic, as are
+  // string constants looking like a GIVING clause or a rand call.
+  TaQLPrepared q5 ("select from " + tabName + " where year(ci) > 1850 "
+                   "and 'giving' != 'rand()'");
+  check (q5, False);
+  AlwaysAssertExit (check(q5, True).table().nrow() == 100);
+}
+
+void testRelativeName()
+{
+  // A table with the same relative name in another directory.
+  Directory dir("tTaQLResultCache_tmp.dir");
+  dir.create();
+  makeTable ("tTaQLResultCache_tmp.dir/" + tabName, 2);
+  TaQLPrepared query ("select from " + tabName + " where ci < 4");
+  AlwaysAssertExit (check(query, False).table().nrow() == 5);
+  AlwaysAssertExit (check(query, True).table().nrow() == 5);
+  // In the other directory the name refers to the other table.
+  AlwaysAssertExit (chdir ("tTaQLResultCache_tmp.dir") == 0);
+  AlwaysAssertExit (check(query, False).table().nrow() == 2);
+  AlwaysAssertExit (check(query, True).table().nrow() == 2);
+  AlwaysAssertExit (chdir ("..") == 0);
+  AlwaysAssertExit (check(query, False).table().nrow() == 5);
+}
+
+void testSize()
+{
+  TaQLResultCache::setMaxSize (1);
+  AlwaysAssertExit (TaQLResultCache::size() == 1);
+  TaQLPrepared query ("select from " + tabName + " where ci < 3");
+  check (query, False);
+  check (query, True);
+  AlwaysAssertExit (TaQLResultCache::size() == 1);
+  // A maximum size of 0 disables the cache.
+  TaQLResultCache::setMaxSize (0);
+  AlwaysAssertExit (TaQLResultCache::size() == 0);
+  check (query, False);
+  check (query, False);
+  AlwaysAssertExit (TaQLResultCache::size() == 0);
+}
+
+int main()
+{
+  try {
+    makeTable();
+    TaQLResultCache::setMaxSize (8);
+    testSelect();
+    testParams();
+    testAggregate();
+    testWrite();
+    testNotCached();
+    testRelativeName();
+    testSize();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
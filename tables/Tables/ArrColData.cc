@@ -28,6 +28,7 @@
 #include <casacore/tables/Tables/ColumnSet.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/tables/Tables/TableTrace.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayIter.h>
@@ -167,6 +168,8 @@ void ArrayColumnData::getArray (rownr_t rownr, ArrayBase& array) const
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr,
                          array.shape());
     }
+    ColumnIOStats::Timer timer (iostats_p, False, 1,
+                                array.nelements() * elemSize_p);
     checkReadLock (True);
     dataColPtr_p->getArrayV (rownr, array);
     autoReleaseLock();
@@ -180,11 +183,26 @@ void ArrayColumnData::getSlice (rownr_t rownr, const Slicer& ns,
                          array.shape(),
                          ns.start(), ns.end(), ns.stride());
     }
+    ColumnIOStats::Timer timer (iostats_p, False, 1,
+                                array.nelements() * elemSize_p);
     checkReadLock (True);
     dataColPtr_p->getSliceV (rownr, ns, array);
     autoReleaseLock();
 }
 
+void ArrayColumnData::getPackedBool (rownr_t rownr, const IPosition& shape,
+                                     uChar* bits) const
+{
+    if (rtraceColumn_p) {
+      TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr, shape);
+    }
+    ColumnIOStats::Timer timer (iostats_p, False, 1,
+                                (shape.product() + 7) / 8);
+    checkReadLock (True);
+    dataColPtr_p->getPackedBoolV (rownr, shape, bits);
+    autoReleaseLock();
+}
+
 
 void ArrayColumnData::putArray (rownr_t rownr, const ArrayBase& array)
 {
@@ -195,6 +213,8 @@ void ArrayColumnData::putArray (rownr_t rownr, const ArrayBase& array)
     if (checkValueLength_p) {
       checkValueLength (static_cast<const Array<String>*>(&array));
     }
+    ColumnIOStats::Timer timer (iostats_p, True, 1,
+                                array.nelements() * elemSize_p);
     checkWriteLock (True);
     dataColPtr_p->putArrayV (rownr, array);
     autoReleaseLock();
@@ -211,12 +231,27 @@ void ArrayColumnData::putSlice (rownr_t rownr, const Slicer& ns,
     if (checkValueLength_p) {
       checkValueLength (static_cast<const Array<String>*>(&array));
     }
+    ColumnIOStats::Timer timer (iostats_p, True, 1,
+                                array.nelements() * elemSize_p);
     checkWriteLock (True);
     dataColPtr_p->putSliceV (rownr, ns, array);
     autoReleaseLock();
 }
 
 
+void ArrayColumnData::putPackedBool (rownr_t rownr, const IPosition& shape,
+                                     const uChar* bits)
+{
+    if (wtraceColumn_p) {
+      TableTrace::trace (traceId(), columnDesc().name(), 'w', rownr, shape);
+    }
+    ColumnIOStats::Timer timer (iostats_p, True, 1,
+                                (shape.product() + 7) / 8);
+    checkWriteLock (True);
+    dataColPtr_p->putPackedBoolV (rownr, shape, bits);
+    autoReleaseLock();
+}
+
 
 //# Get or put the column by iterating through the array and getting the
 //# column array for each row.
@@ -227,6 +262,8 @@ void ArrayColumnData::getArrayColumn (ArrayBase& array) const
       TableTrace::trace (traceId(), columnDesc().name(), 'r',
                          array.shape());
     }
+    ColumnIOStats::Timer timer (iostats_p, False, nrow(),
+                                array.nelements() * elemSize_p);
     checkReadLock (True);
     dataColPtr_p->getArrayColumnV (array);
     autoReleaseLock();
@@ -240,6 +277,8 @@ void ArrayColumnData::getArrayColumnCells (const RefRows& rownrs,
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownrs,
                          array.shape());
     }
+    ColumnIOStats::Timer timer (iostats_p, False, rownrs.nrow(),
+                                array.nelements() * elemSize_p);
     checkReadLock (True);
     dataColPtr_p->getArrayColumnCellsV (rownrs, array);
     autoReleaseLock();
@@ -253,6 +292,8 @@ void ArrayColumnData::getColumnSlice (const Slicer& ns,
                          array.shape(),
                          ns.start(), ns.end(), ns.stride());
     }
+    ColumnIOStats::Timer timer (iostats_p, False, nrow(),
+                                array.nelements() * elemSize_p);
     checkReadLock (True);
     dataColPtr_p->getColumnSliceV (ns, array);
     autoReleaseLock();
@@ -267,6 +308,8 @@ void ArrayColumnData::getColumnSliceCells (const RefRows& rownrs,
                          array.shape(),
                          ns.start(), ns.end(), ns.stride());
     }
+    ColumnIOStats::Timer timer (iostats_p, False, rownrs.nrow(),
+                                array.nelements() * elemSize_p);
     checkReadLock (True);
     dataColPtr_p->getColumnSliceCellsV (rownrs, ns, array);
     autoReleaseLock();
@@ -281,6 +324,8 @@ void ArrayColumnData::putArrayColumn (const ArrayBase& array)
     if (checkValueLength_p) {
       checkValueLength (static_cast<const Array<String>*>(&array));
     }
+    ColumnIOStats::Timer timer (iostats_p, True, nrow(),
+                                array.nelements() * elemSize_p);
     checkWriteLock (True);
     dataColPtr_p->putArrayColumnV (array);
     autoReleaseLock();
@@ -296,6 +341,8 @@ void ArrayColumnData::putArrayColumnCells (const RefRows& rownrs,
     if (checkValueLength_p) {
       checkValueLength (static_cast<const Array<String>*>(&array));
     }
+    ColumnIOStats::Timer timer (iostats_p, True, rownrs.nrow(),
+                                array.nelements() * elemSize_p);
     checkWriteLock (True);
     dataColPtr_p->putArrayColumnCellsV (rownrs, array);
     autoReleaseLock();
@@ -312,6 +359,8 @@ void ArrayColumnData::putColumnSlice (const Slicer& ns,
     if (checkValueLength_p) {
       checkValueLength (static_cast<const Array<String>*>(&array));
     }
+    ColumnIOStats::Timer timer (iostats_p, True, nrow(),
+                                array.nelements() * elemSize_p);
     checkWriteLock (True);
     dataColPtr_p->putColumnSliceV (ns, array);
     autoReleaseLock();
@@ -329,6 +378,8 @@ void ArrayColumnData::putColumnSliceCells (const RefRows& rownrs,
     if (checkValueLength_p) {
       checkValueLength (static_cast<const Array<String>*>(&array));
     }
+    ColumnIOStats::Timer timer (iostats_p, True, rownrs.nrow(),
+                                array.nelements() * elemSize_p);
     checkWriteLock (True);
     dataColPtr_p->putColumnSliceCellsV (rownrs, ns, array);
     autoReleaseLock();
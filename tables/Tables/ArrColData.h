@@ -161,6 +161,11 @@ public:
     // the actual length. This is checked by ArrayColumn.
     void getSlice (rownr_t rownr, const Slicer&, ArrayBase& arrayPtr) const;
 
+    // Get a Bool array in a particular cell as packed bits.
+    // The storage manager can copy them without expanding to Bools.
+    void getPackedBool (rownr_t rownr, const IPosition& shape,
+                        uChar* bits) const;
+
     // Get the array of all values in a column.
     // If the column contains n-dim arrays, the resulting array is (n+1)-dim.
     // The arrays in the column have to have the same shape in all cells.
@@ -200,6 +205,10 @@ public:
     // the actual length. This is checked by ArrayColumn.
     void putSlice (rownr_t rownr, const Slicer&, const ArrayBase& arrayPtr);
 
+    // Put packed bits into the Bool array in a particular cell.
+    void putPackedBool (rownr_t rownr, const IPosition& shape,
+                        const uChar* bits);
+
     // Put the array of all values in the column.
     // If the column contains n-dim arrays, the source array is (n+1)-dim.
     // The arrays in the column have to have the same shape in all cells.
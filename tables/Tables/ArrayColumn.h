@@ -30,8 +30,10 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayView.h>
 #include <casacore/tables/Tables/ArrayColumnBase.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <future>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -185,6 +187,20 @@ public:
     Array<T> getSlice (rownr_t rownr, const Slicer& arraySection) const;
     // </group>
 
+    // Get the array (or a slice of it) in a particular cell into the data
+    // referred to by an <linkto class=ArrayView>ArrayView</linkto>,
+    // which can refer to memory not owned by an Array.
+    // The shape of the view must match the shape of the cell (slice).
+    // The data are read directly into the view if it is contiguous,
+    // otherwise via a temporary array.
+    // <group>
+    template<size_t N>
+    void get (rownr_t rownr, const ArrayView<T,N>& view) const;
+    template<size_t N>
+    void getSlice (rownr_t rownr, const Slicer& arraySection,
+                   const ArrayView<T,N>& view) const;
+    // </group>
+
     // Get an irregular slice of an N-dimensional array in a particular cell
     // (i.e. table row)  as given by the vectors of Slice objects.
     // The outer vector represents the array axes.
@@ -328,6 +344,28 @@ public:
                          Array<T>& destination,
                          Bool resize = False) const;
 
+    // Get data asynchronously. The functions are the same as their
+    // synchronous counterparts, but return at once with a future
+    // that gives the data (or the exception) when the read is done.
+    // The reads are executed in order by the global
+    // <linkto class="TableIOQueue">TableIOQueue</linkto>, so the data are
+    // read with the same (batched) storage manager accesses as the
+    // synchronous functions. The table is kept alive until the read is
+    // done. While reads are outstanding, the table must not be accessed
+    // otherwise (see TableIOQueue).
+    // <group>
+    std::future<Array<T>> getAsync (rownr_t rownr) const;
+    std::future<Array<T>> getSliceAsync (rownr_t rownr,
+                                         const Slicer& arraySection) const;
+    std::future<Array<T>> getColumnAsync() const;
+    std::future<Array<T>> getColumnRangeAsync (const Slicer& rowRange) const;
+    std::future<Array<T>> getColumnRangeAsync (const Slicer& rowRange,
+                                               const Slicer& arraySection) const;
+    std::future<Array<T>> getColumnCellsAsync (const RefRows& rownrs) const;
+    std::future<Array<T>> getColumnCellsAsync (const RefRows& rownrs,
+                                               const Slicer& arraySection) const;
+    // </group>
+
     // Set the shape of the array in the given row.
     // Setting the shape is needed if the array is put in slices,
     // otherwise the table system would not know the shape.
@@ -30,6 +30,7 @@
 #include <casacore/tables/Tables/ArrayColumnFunc.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/Tables/TableIOQueue.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/ArrayIter.h>
 #include <casacore/casa/Arrays/IPosition.h>
@@ -149,6 +150,31 @@ void ArrayColumn<T>::getSlice (rownr_t rownr, const Slicer& arraySection,
     acbGetSlice (rownr, arraySection, arr, resize);
 }
 
+template<class T>
+template<size_t N>
+void ArrayColumn<T>::get (rownr_t rownr, const ArrayView<T,N>& view) const
+{
+    if (view.contiguous()) {
+        Array<T> arr(view.shapeIP(), view.data(), SHARE);
+        get (rownr, arr);
+    } else {
+        view.assign (get (rownr));
+    }
+}
+
+template<class T>
+template<size_t N>
+void ArrayColumn<T>::getSlice (rownr_t rownr, const Slicer& arraySection,
+                               const ArrayView<T,N>& view) const
+{
+    if (view.contiguous()) {
+        Array<T> arr(view.shapeIP(), view.data(), SHARE);
+        getSlice (rownr, arraySection, arr);
+    } else {
+        view.assign (getSlice (rownr, arraySection));
+    }
+}
+
 
 template<class T>
 Array<T> ArrayColumn<T>::getSlice
@@ -320,6 +346,82 @@ Array<T> ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
     return arr;
 }
 
+// The requests hold a copy of the column and the Table object, so the
+// table stays alive until the request is done.
+template<class T>
+std::future<Array<T>> ArrayColumn<T>::getAsync (rownr_t rownr) const
+{
+    ArrayColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab, rownr]() { return col.get (rownr); });
+}
+
+template<class T>
+std::future<Array<T>> ArrayColumn<T>::getSliceAsync
+                                  (rownr_t rownr,
+                                   const Slicer& arraySection) const
+{
+    ArrayColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab, rownr, arraySection]()
+       { return col.getSlice (rownr, arraySection); });
+}
+
+template<class T>
+std::future<Array<T>> ArrayColumn<T>::getColumnAsync() const
+{
+    ArrayColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab]() { return col.getColumn(); });
+}
+
+template<class T>
+std::future<Array<T>> ArrayColumn<T>::getColumnRangeAsync
+                                  (const Slicer& rowRange) const
+{
+    ArrayColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab, rowRange]() { return col.getColumnRange (rowRange); });
+}
+
+template<class T>
+std::future<Array<T>> ArrayColumn<T>::getColumnRangeAsync
+                                  (const Slicer& rowRange,
+                                   const Slicer& arraySection) const
+{
+    ArrayColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab, rowRange, arraySection]()
+       { return col.getColumnRange (rowRange, arraySection); });
+}
+
+template<class T>
+std::future<Array<T>> ArrayColumn<T>::getColumnCellsAsync
+                                  (const RefRows& rownrs) const
+{
+    ArrayColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab, rownrs]() { return col.getColumnCells (rownrs); });
+}
+
+template<class T>
+std::future<Array<T>> ArrayColumn<T>::getColumnCellsAsync
+                                  (const RefRows& rownrs,
+                                   const Slicer& arraySection) const
+{
+    ArrayColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab, rownrs, arraySection]()
+       { return col.getColumnCells (rownrs, arraySection); });
+}
+
 template<class T>
 void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
                                      const Slicer& arraySection,
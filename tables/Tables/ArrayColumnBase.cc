@@ -106,6 +106,33 @@ void ArrayColumnBase::acbGet (rownr_t rownr, ArrayBase& arr, Bool resize) const
   baseColPtr_p->getArray (rownr, arr);
 }
 
+void ArrayColumnBase::getPackedBool (rownr_t rownr, Vector<uChar>& bits) const
+{
+  TABLECOLUMNCHECKROW(rownr);
+  if (columnDesc().dataType() != TpBool) {
+    throw TableInvDT ("ArrayColumn::getPackedBool: column " +
+                      columnDesc().name() + " does not contain Bools");
+  }
+  IPosition shp = shape(rownr);
+  size_t nbytes = (shp.product() + 7) / 8;
+  if (bits.size() != nbytes  ||  !bits.contiguousStorage()) {
+    Vector<uChar> tmp(nbytes);
+    bits.reference (tmp);
+  }
+  if (nbytes > 0) {
+    // Clear the unused bits in the last byte.
+    bits[bits.size() - 1] = 0;
+    baseColPtr_p->getPackedBool (rownr, shp, bits.data());
+  }
+}
+
+Vector<uChar> ArrayColumnBase::getPackedBool (rownr_t rownr) const
+{
+  Vector<uChar> bits;
+  getPackedBool (rownr, bits);
+  return bits;
+}
+
 void ArrayColumnBase::acbGetSlice (rownr_t rownr, const Slicer& arraySection,
                                    ArrayBase& arr, Bool resize) const
 {
@@ -330,6 +357,35 @@ void ArrayColumnBase::acbPut (rownr_t rownr, const ArrayBase& arr)
   baseColPtr_p->putArray (rownr, arr);
 }
 
+void ArrayColumnBase::putPackedBool (rownr_t rownr, const IPosition& shp,
+                                     const Vector<uChar>& bits)
+{
+  checkWritable();
+  TABLECOLUMNCHECKROW(rownr);
+  if (columnDesc().dataType() != TpBool) {
+    throw TableInvDT ("ArrayColumn::putPackedBool: column " +
+                      columnDesc().name() + " does not contain Bools");
+  }
+  if (bits.size() < size_t((shp.product() + 7) / 8)) {
+    throw TableArrayConformanceError ("ArrayColumn::putPackedBool: "
+                                      "too few bits for shape " +
+                                      shp.toString());
+  }
+  if (!isDefined(rownr)) {
+    baseColPtr_p->setShape (rownr, shp);
+  }else{
+    if (! checkShape (baseColPtr_p->shape(rownr), shp, True, rownr,
+                      "ArrayColumn::putPackedBool")) {
+      baseColPtr_p->setShape (rownr, shp);
+    }
+  }
+  // Use a contiguous copy if needed.
+  Bool deleteIt;
+  const uChar* data = bits.getStorage (deleteIt);
+  baseColPtr_p->putPackedBool (rownr, shp, data);
+  bits.freeStorage (data, deleteIt);
+}
+
 void ArrayColumnBase::acbPutSlice (rownr_t rownr, const Slicer& arraySection,
                                    const ArrayBase& arr)
 {
@@ -138,6 +138,20 @@ class String;
     // The row numbers count from 0 until #rows-1.
     void acbGet (rownr_t rownr, ArrayBase& array, Bool resize) const;
 
+    // Get the Bool array in a particular cell as packed bits.
+    // The vector is resized to <src>(shape(rownr).product()+7)/8</src>
+    // bytes, where bit <src>i</src> of byte <src>j</src> holds array
+    // element <src>8*j+i</src> (as in Conversion::boolToBit).
+    // Unused bits in the last byte are zero. On little-endian hosts
+    // the bytes can be processed as 64-bit words of 64 flags each.
+    // <br>Storage managers storing Bools as bits (e.g. fixed shaped
+    // arrays in StandardStMan) copy the bits without expanding them.
+    // An exception is thrown if the column does not contain Bools.
+    // <group>
+    void getPackedBool (rownr_t rownr, Vector<uChar>& bits) const;
+    Vector<uChar> getPackedBool (rownr_t rownr) const;
+    // </group>
+
     // Get a slice of an N-dimensional array in a particular cell
     // (i.e. table row).
     // The row numbers count from 0 until #rows-1.
@@ -268,6 +282,13 @@ class String;
     // defined, it will be defined implicitly.
     void acbPut (rownr_t rownr, const ArrayBase& array);
 
+    // Put packed bits (as returned by getPackedBool) into the Bool array
+    // with the given shape in a particular cell.
+    // The vector must contain at least <src>(shape.product()+7)/8</src>
+    // bytes. If not defined yet, the shape of the cell is set.
+    void putPackedBool (rownr_t rownr, const IPosition& shape,
+                        const Vector<uChar>& bits);
+
     // Put into a slice of an N-dimensional array in a particular cell.
     // The row numbers count from 0 until #rows-1.
     // The shape of the table array must have been defined.
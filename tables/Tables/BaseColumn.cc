@@ -25,8 +25,12 @@
 
 #include <casacore/tables/Tables/BaseColumn.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/OS/Conversion.h>
 #include <casacore/casa/Utilities/ValType.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/DataMan/StringDictionary.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -105,6 +109,40 @@ void BaseColumn::getArray (rownr_t, ArrayBase&) const
                        colDesc_p.name() + "; only valid for an array"));
 }
 
+void BaseColumn::getPackedBool (rownr_t rownr, const IPosition& shape,
+                                uChar* bits) const
+{
+  Array<Bool> arr(shape);
+  getArray (rownr, arr);
+  Conversion::boolToBit (bits, arr.data(), arr.size());
+}
+
+void BaseColumn::putPackedBool (rownr_t rownr, const IPosition& shape,
+                                const uChar* bits)
+{
+  Array<Bool> arr(shape);
+  Conversion::bitToBool (arr.data(), bits, arr.size());
+  putArray (rownr, arr);
+}
+
+void BaseColumn::getStringCodes (const RefRows& rownrs, uInt* codes,
+                                 StringDictionary& dictionary) const
+{
+  String value;
+  RefRowsSliceIter iter(rownrs);
+  while (! iter.pastEnd()) {
+    rownr_t rownr = iter.sliceStart();
+    rownr_t end   = iter.sliceEnd();
+    rownr_t incr  = iter.sliceIncr();
+    while (rownr <= end) {
+      get (rownr, &value);
+      *codes++ = dictionary.code (value);
+      rownr += incr;
+    }
+    iter++;
+  }
+}
+
 void BaseColumn::getSlice (rownr_t, const Slicer&, ArrayBase&) const
 {
   throw (TableInvOper ("getSlice() not implemented for column " +
@@ -46,6 +46,7 @@ class RefRows;
 class IPosition;
 class Slicer;
 class Sort;
+class StringDictionary;
 
 // <summary>
 // Abstract base class for a table column
@@ -162,6 +163,12 @@ public:
     // Get a slice of an N-dimensional array in a particular cell.
     virtual void getSlice (rownr_t rownr, const Slicer&, ArrayBase& dataPtr) const;
 
+    // Get the Bool array with the given shape in a particular cell
+    // as packed bits. The default implementation gets the array and
+    // packs it.
+    virtual void getPackedBool (rownr_t rownr, const IPosition& shape,
+                                uChar* bits) const;
+
     // Get the vector of all scalar values in a column.
     virtual void getScalarColumn (ArrayBase& dataPtr) const;
 
@@ -179,6 +186,13 @@ public:
     virtual void getScalarColumnCells (const RefRows& rownrs,
 				       ArrayBase& dataPtr) const;
 
+    // Get the values of a scalar String column in the given rows as codes
+    // in a dictionary of distinct values. <src>codes</src> must hold
+    // <src>rownrs.nrow()</src> values. The default implementation gets
+    // the values one by one.
+    virtual void getStringCodes (const RefRows& rownrs, uInt* codes,
+                                 StringDictionary& dictionary) const;
+
     // Get the array of some array values in a column.
     // If the column contains n-dim arrays, the resulting array is (n+1)-dim.
     // The arrays in the column have to have the same shape in all cells.
@@ -200,6 +214,12 @@ public:
     // Put a slice of an N-dimensional array in a particular cell.
     virtual void putSlice (rownr_t rownr, const Slicer&, const ArrayBase& dataPtr);
 
+    // Put packed bits into the Bool array with the given shape in a
+    // particular cell. The default implementation unpacks them and puts
+    // the array.
+    virtual void putPackedBool (rownr_t rownr, const IPosition& shape,
+                                const uChar* bits);
+
     // Put the vector of all scalar values in the column.
     virtual void putScalarColumn (const ArrayBase& dataPtr);
 
@@ -30,6 +30,7 @@
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <algorithm>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -248,6 +249,34 @@ std::shared_ptr<BaseTable> BaseTableIterator::noCachedIterBoundariesNext()
     return baseTabPtr;
 }
 
+void BaseTableIterator::setProjection (const Block<String>& columnNames)
+{
+    // The iteration columns are always needed.
+    Block<String> names(nrkeys_p);
+    for (uInt i=0; i<nrkeys_p; i++) {
+        names[i] = colPtr_p[i]->columnDesc().name();
+    }
+    uInt nr = nrkeys_p;
+    for (const String& name : columnNames) {
+        if (std::find (names.begin(), names.begin() + nr, name) ==
+            names.begin() + nr) {
+            names.resize (nr+1, False, True);
+            names[nr++] = name;
+        }
+    }
+    // Project the sorted table; the iteration subtables are made from it.
+    sortTab_p = sortTab_p->project (names);
+    for (uInt i=0; i<nrkeys_p; i++) {
+        colPtr_p[i] = sortTab_p->getColumn (names[i]);
+    }
+    if (aRefTable_p) {
+        aBaseTable_p = sortTab_p->makeRefTable (False, 0);
+        aRefTable_p = dynamic_cast<RefTable*>(aBaseTable_p.get());
+        DebugAssert (aRefTable_p, AipsError);
+    }
+    reset();
+}
+
 void
 BaseTableIterator::copyState(const BaseTableIterator &other)
 {
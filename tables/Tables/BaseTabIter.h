@@ -118,6 +118,12 @@ public:
 
     virtual void copyState(const BaseTableIterator &);
 
+    // Project the iteration subtables on the given columns, so they only
+    // contain those columns and the iteration columns. It avoids creating
+    // column objects for columns that are not used, which can be expensive
+    // for tables with many columns. It also resets the iterator.
+    void setProjection (const Block<String>& columnNames);
+
     // Report Name of slowest sort column that changed (according to the
     // comparison function) to terminate the most recent call to next()
     // Enables clients to sense iteration boundary properties
@@ -23,7 +23,7 @@
 //#                        520 Edgemont Road
 //#                        Charlottesville, VA 22903-2475 USA
 
-#include <thread>
+#include <mutex>
 #include <utility>
 
 #include <casacore/casa/aips.h>
@@ -52,6 +52,8 @@
 #include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/System/AipsrcValue.h>
 #include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/OS/Directory.h>
 #include <casacore/casa/Utilities/Assert.h>
@@ -360,6 +362,11 @@ void BaseTable::writeEnd (AipsIO& ios)
 void BaseTable::setTableChanged()
 {}
 
+uInt64 BaseTable::getChangeCounter() const
+{
+    return getModifyCounter();
+}
+
 
 void BaseTable::markForDelete (Bool callback, const String& oldName)
 {
@@ -804,29 +811,104 @@ std::shared_ptr<BaseTable> BaseTable::select (const TableExprNode& node,
     //# Adjust the row numbers to reflect row numbers in the root table.
     std::shared_ptr<RefTable> resultTable = makeRefTable (True, 0);
     DebugAssert (static_cast<bool>(resultTable), AipsError);
-    Bool val;
     rownr_t nrrow = nrow();
+    //# Evaluate the expression in parallel if possible and worthwhile.
+    //# It cannot be done if the loop can be pre-empted by maxRow.
+    uInt nthread = selectNThreads (nrrow);
+    if (nthread > 1  &&  maxRow == 0  &&
+        TableExprNodeUtil::isParallelSafe (node.getRep().get())) {
+      std::vector<rownr_t> rows (selectParallel (node, nrrow, nthread));
+      for (size_t i=offset; i<rows.size(); ++i) {
+        resultTable->addRownr (rows[i]);
+      }
+      adjustRownrs (resultTable->nrow(), resultTable->rowStorage(), False);
+      resultTable->compactRows();
+      return resultTable;
+    }
+    //# Evaluate the expression in batches of rows.
+    //# Use smaller batches if only a few rows are needed.
+    rownr_t batchSize = 4096;
+    if (maxRow > 0) {
+      batchSize = std::min (batchSize, std::max (maxRow + offset, rownr_t(64)));
+    }
+    Block<Bool> vals(batchSize);
     TableExprId id;
-    for (rownr_t i=0; i<nrrow; i++) {
-      id.setRownr (i);
-      node.get (id, val);
-      if (val) {
-        if (offset == 0) {
-          resultTable->addRownr (i);                  // add row
-          // Stop if max #rows reached (note that maxRow==0 means no limit).
-          if (resultTable->nrow() == maxRow) {
-            break;
+    Bool done = False;
+    for (rownr_t st=0; st<nrrow && !done; st+=batchSize) {
+      rownr_t nr = std::min (batchSize, nrrow - st);
+      id.setRownr (st);
+      node.getBatch (id, nr, vals.storage());
+      for (rownr_t j=0; j<nr; ++j) {
+        if (vals[j]) {
+          if (offset == 0) {
+            resultTable->addRownr (st+j);             // add row
+            // Stop if max #rows reached (note that maxRow==0 means no limit).
+            if (resultTable->nrow() == maxRow) {
+              done = True;
+              break;
+            }
+          } else {
+            // Skip first offset matching rows.
+            offset--;
           }
-        } else {
-          // Skip first offset matching rows.
-          offset--;
         }
       }
     }
     adjustRownrs (resultTable->nrow(), resultTable->rowStorage(), False);
+    resultTable->compactRows();
     return resultTable;
 }
 
+uInt BaseTable::selectNThreads (rownr_t nrrow)
+{
+    // Each thread should evaluate a reasonable number of rows.
+    const rownr_t minRowsPerThread = 100000;
+    if (nrrow < 2*minRowsPerThread) {
+      return 1;
+    }
+    Int nthread;
+    AipsrcValue<Int>::find (nthread, "table.select.nthreads", 1);
+    if (nthread <= 0) {
+      nthread = ThreadPool::concurrency();
+    }
+    return std::max (1, std::min (nthread, Int(nrrow / minRowsPerThread)));
+}
+
+std::vector<rownr_t> BaseTable::selectParallel (const TableExprNode& node,
+                                                rownr_t nrrow, uInt nthread)
+{
+    // Each thread evaluates a contiguous chunk of rows using its own id.
+    // Column values are read one thread at a time using a shared mutex.
+    std::mutex mutex;
+    std::vector<std::vector<rownr_t>> chunkRows (nthread);
+    rownr_t chunkSize = (nrrow + nthread - 1) / nthread;
+    auto evaluate = [&] (size_t chunk)
+    {
+      const rownr_t batchSize = 4096;
+      Block<Bool> vals(batchSize);
+      TableExprId id;
+      id.setMutex (&mutex);
+      rownr_t end = std::min (nrrow, (chunk+1) * chunkSize);
+      for (rownr_t st=chunk*chunkSize; st<end; st+=batchSize) {
+        rownr_t nr = std::min (batchSize, end - st);
+        id.setRownr (st);
+        node.getBatch (id, nr, vals.storage());
+        for (rownr_t j=0; j<nr; ++j) {
+          if (vals[j]) {
+            chunkRows[chunk].push_back (st+j);
+          }
+        }
+      }
+    };
+    ThreadPool::global().parallelFor (nthread, evaluate, nthread);
+    // Merge the results in row order.
+    std::vector<rownr_t> rows (std::move (chunkRows[0]));
+    for (uInt i=1; i<nthread; ++i) {
+      rows.insert (rows.end(), chunkRows[i].begin(), chunkRows[i].end());
+    }
+    return rows;
+}
+
 std::shared_ptr<BaseTable> BaseTable::select (const Vector<rownr_t>& rownrs)
 {
     AlwaysAssert (!isNull(), AipsError);
@@ -860,12 +942,16 @@ std::shared_ptr<BaseTable> BaseTable::tabAnd (BaseTable* that)
       return this->shared_from_this();                    // that is root
     }
     //# There is no root table involved, so we have to deal with RefTables.
-    //# Get both rownr arrays which are sorted if not in row order.
-    Vector<rownr_t> r1 = this->logicRows();
-    Vector<rownr_t> r2 = that->logicRows();
     // Create RefTable which will be in row order.
     std::shared_ptr<RefTable> rtp = makeRefTable (True, 0);
     DebugAssert (static_cast<bool>(rtp), AipsError);
+    //# Use the runs if both tables have them.
+    if (rtp->refRuns (RefTable::RunsAnd, this, that)) {
+        return rtp;
+    }
+    //# Get both rownr arrays which are sorted if not in row order.
+    Vector<rownr_t> r1 = this->logicRows();
+    Vector<rownr_t> r2 = that->logicRows();
     // Store rownrs in new RefTable.
     rtp->refAnd (r1.size(), r1.data(), r2.size(), r2.data());
     return rtp;
@@ -883,12 +969,16 @@ std::shared_ptr<BaseTable> BaseTable::tabOr (BaseTable* that)
         return root()->shared_from_this();
     }
     //# There is no root table involved, so we have to deal with RefTables.
-    //# Get both rownr arrays which are sorted if not in row order.
-    Vector<rownr_t> r1 = this->logicRows();
-    Vector<rownr_t> r2 = that->logicRows();
     // Create RefTable which will be in row order.
     std::shared_ptr<RefTable> rtp = makeRefTable (True, 0);
     DebugAssert (static_cast<bool>(rtp), AipsError);
+    //# Use the runs if both tables have them.
+    if (rtp->refRuns (RefTable::RunsOr, this, that)) {
+        return rtp;
+    }
+    //# Get both rownr arrays which are sorted if not in row order.
+    Vector<rownr_t> r1 = this->logicRows();
+    Vector<rownr_t> r2 = that->logicRows();
     // Store rownrs in new RefTable.
     rtp->refOr (r1.size(), r1.data(), r2.size(), r2.data());
     return rtp;
@@ -909,12 +999,16 @@ std::shared_ptr<BaseTable> BaseTable::tabSub (BaseTable* that)
 	return that->tabNot();
     }
     //# There is no root table involved, so we have to deal with RefTables.
-    //# Get both rownr arrays which are sorted if not in row order.
-    Vector<rownr_t> r1 = this->logicRows();
-    Vector<rownr_t> r2 = that->logicRows();
     // Create RefTable which will be in row order.
     std::shared_ptr<RefTable> rtp = makeRefTable (True, 0);
     DebugAssert (static_cast<bool>(rtp), AipsError);
+    //# Use the runs if both tables have them.
+    if (rtp->refRuns (RefTable::RunsSub, this, that)) {
+        return rtp;
+    }
+    //# Get both rownr arrays which are sorted if not in row order.
+    Vector<rownr_t> r1 = this->logicRows();
+    Vector<rownr_t> r2 = that->logicRows();
     // Store rownrs in new RefTable.
     rtp->refSub (r1.size(), r1.data(), r2.size(), r2.data());
     return rtp;
@@ -934,12 +1028,16 @@ std::shared_ptr<BaseTable> BaseTable::tabXor (BaseTable* that)
 	return tabNot();
     }
     //# There is no root table involved, so we have to deal with RefTables.
-    //# Get both rownr arrays which are sorted if not in row order.
-    Vector<rownr_t> r1 = this->logicRows();
-    Vector<rownr_t> r2 = that->logicRows();
     // Create RefTable which will be in row order.
     std::shared_ptr<RefTable> rtp = makeRefTable (True, 0);
     DebugAssert (static_cast<bool>(rtp), AipsError);
+    //# Use the runs if both tables have them.
+    if (rtp->refRuns (RefTable::RunsXor, this, that)) {
+        return rtp;
+    }
+    //# Get both rownr arrays which are sorted if not in row order.
+    Vector<rownr_t> r1 = this->logicRows();
+    Vector<rownr_t> r2 = that->logicRows();
     // Store rownrs in new RefTable.
     rtp->refXor (r1.size(), r1.data(), r2.size(), r2.data());
     return rtp;
@@ -954,11 +1052,15 @@ std::shared_ptr<BaseTable> BaseTable::tabNot()
 	return makeRefTable (True, 0);
     }
     //# There is no root table involved, so we have to deal with RefTables.
-    //# Get rownr array which is sorted if not in row order.
-    Vector<rownr_t> r1 = this->logicRows();
     // Create RefTable which will be in row order.
     std::shared_ptr<RefTable> rtp = makeRefTable (True, 0);
     DebugAssert (static_cast<bool>(rtp), AipsError);
+    //# Use the runs if the table has them (by subtracting it from the root).
+    if (rtp->refRuns (RefTable::RunsSub, root(), this)) {
+        return rtp;
+    }
+    //# Get rownr array which is sorted if not in row order.
+    Vector<rownr_t> r1 = this->logicRows();
     // Store rownrs in new RefTable.
     rtp->refNot (r1.size(), r1.data(), root()->nrow());
     return rtp;
@@ -1171,6 +1273,11 @@ void BaseTable::showStructure (ostream& os, Bool showDataMans, Bool showColumns,
 void BaseTable::showStructureExtra (ostream&) const
 {}
 
+Record BaseTable::ioStatistics() const
+{
+  return Record();
+}
+
 void BaseTable::showColumnInfo (ostream& os, const TableDesc& tdesc,
                                 uInt maxl, const Array<String>& columnNames,
                                 Bool sort, Bool cOrder) const
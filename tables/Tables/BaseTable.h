@@ -37,6 +37,7 @@
 #include <casacore/casa/IO/FileLocker.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
 #include <memory>
+#include <vector>
 
 #ifdef HAVE_MPI
 #include <mpi.h>
@@ -168,6 +169,12 @@ public:
     // Get the modify counter.
     virtual uInt getModifyCounter() const = 0;
 
+    // Get the change counter, which is incremented for each write access
+    // done by this process. It can be used to check if cached data derived
+    // from the table is still valid.
+    // By default it returns the modify counter.
+    virtual uInt64 getChangeCounter() const;
+
     // Set the table to being changed. By default it does nothing.
     virtual void setTableChanged();
 
@@ -278,6 +285,10 @@ public:
     // Get the data manager info.
     virtual Record dataManagerInfo() const = 0;
 
+    // Get the IO statistics (implementation of Table::ioStatistics).
+    // By default an empty record is returned.
+    virtual Record ioStatistics() const;
+
     // Show the table structure (implementation of Table::showStructure).
     void showStructure (std::ostream&,
                         Bool showDataMan,
@@ -576,6 +587,19 @@ private:
     // used in the logical operation on the table.
     Vector<rownr_t> logicRows();
 
+    // Get the nr of threads to use to evaluate a selection expression
+    // on the given nr of rows. It is given by aipsrc variable
+    // <src>table.select.nthreads</src> (default 1; 0 means the ThreadPool
+    // concurrency), but each thread has to evaluate at least 100000 rows.
+    static uInt selectNThreads (rownr_t nrrow);
+
+    // Evaluate the selection expression using multiple threads, each
+    // handling a contiguous chunk of rows. The matching row numbers are
+    // returned in ascending order.
+    // The expression must be parallel safe (see TableExprNodeUtil).
+    std::vector<rownr_t> selectParallel (const TableExprNode& node,
+                                         rownr_t nrrow, uInt nthread);
+
     // Make an empty table description.
     // This is used if one asks for the description of a NullTable.
     // Creating an empty TableDesc in the NullTable takes too much time.
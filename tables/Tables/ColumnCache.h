@@ -58,7 +58,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // valid for multiple rows (as used in
 // <linkto class=IncrementalStMan>IncrementalStMan</linkto>).
 // The value 1 is used for data stored consecutevily in a buffer for
-// each row (as used in <linkto class=StManAipsIO>StManAipsIO</linkto>).
+// each row (as used in <linkto class=StManAipsIO>StManAipsIO</linkto>
+// and <linkto class=StandardStMan>StandardStMan</linkto>).
+// StandardStMan lets the data pointer point directly into the
+// memory-mapped file if the table is read-only and the data are stored
+// in local format; otherwise it points to a copy of the data of a bucket.
 // <p>
 // The ColumnCache object is created and updated by the data manager.
 // The top level <linkto class=ScalarColumn>ScalarColumn</linkto> object
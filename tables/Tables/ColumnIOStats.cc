@@ -0,0 +1,120 @@
+//# ColumnIOStats.cc: IO statistics of a table column
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/tables/Tables/ColumnIOStats.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <atomic>
+#include <mutex>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// The switch is initialized from aipsrc at first use.
+static std::atomic<Bool> theirEnabled (False);
+static std::once_flag theirInitFlag;
+
+static void initEnabled()
+{
+    Bool enable;
+    AipsrcValue<Bool>::find (enable, "table.iostats", False);
+    theirEnabled = enable;
+}
+
+ColumnIOStats::ColumnIOStats()
+{
+    clear (read_p);
+    clear (write_p);
+}
+
+void ColumnIOStats::setEnabled (Bool enable)
+{
+    std::call_once (theirInitFlag, initEnabled);
+    theirEnabled = enable;
+}
+
+Bool ColumnIOStats::enabled()
+{
+    std::call_once (theirInitFlag, initEnabled);
+    return theirEnabled.load (std::memory_order_relaxed);
+}
+
+void ColumnIOStats::add (Bool isWrite, uInt64 nrCells, uInt64 nrBytes,
+                         Double seconds)
+{
+    // Determine the latency bin (powers of 2 in microseconds).
+    Double usec = seconds * 1e6;
+    uInt bin = 0;
+    for (Double limit=1; bin < NrHistBins-1  &&  usec >= limit; limit*=2) {
+        bin++;
+    }
+    std::lock_guard<std::mutex> lock(mutex_p);
+    Counts& counts = (isWrite  ?  write_p : read_p);
+    counts.nrCalls++;
+    counts.nrCells += nrCells;
+    counts.nrBytes += nrBytes;
+    counts.time    += seconds;
+    counts.hist[bin]++;
+}
+
+void ColumnIOStats::clear (Counts& counts)
+{
+    counts.nrCalls = 0;
+    counts.nrCells = 0;
+    counts.nrBytes = 0;
+    counts.time    = 0;
+    for (uInt i=0; i<NrHistBins; ++i) {
+        counts.hist[i] = 0;
+    }
+}
+
+Record ColumnIOStats::toRecord (const Counts& counts)
+{
+    Record rec;
+    rec.define ("NCALL", Int64(counts.nrCalls));
+    rec.define ("NCELL", Int64(counts.nrCells));
+    rec.define ("NBYTE", Int64(counts.nrBytes));
+    rec.define ("TIME", counts.time);
+    Vector<Int64> hist(NrHistBins);
+    for (uInt i=0; i<NrHistBins; ++i) {
+        hist[i] = counts.hist[i];
+    }
+    rec.define ("HISTOGRAM", hist);
+    return rec;
+}
+
+Record ColumnIOStats::toRecord() const
+{
+    std::lock_guard<std::mutex> lock(mutex_p);
+    Record rec;
+    rec.defineRecord ("READ", toRecord (read_p));
+    rec.defineRecord ("WRITE", toRecord (write_p));
+    return rec;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,164 @@
+//# ColumnIOStats.h: IO statistics of a table column
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#ifndef TABLES_COLUMNIOSTATS_H
+#define TABLES_COLUMNIOSTATS_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <chrono>
+#include <mutex>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Record;
+
+
+// <summary>
+// IO statistics of a table column
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tColumnIOStats">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> PlainColumn
+// </prerequisite>
+
+// <synopsis>
+// ColumnIOStats keeps statistics of the get and put operations done on
+// a column in a plain table. For reads and writes separately it counts
+// the number of calls, the number of cells, the number of bytes (in local
+// format; a String counts as <src>sizeof(String)</src>), and the total time
+// spent. Furthermore it keeps a latency histogram of the calls, where
+// bin <src>i</src> counts the calls taking less than <src>2**i</src>
+// microseconds (bin 0 less than 1 microsecond). The last bin counts all
+// longer calls.
+// <br>Note that scalar values obtained by <src>ScalarColumn::get</src>
+// directly from the column cache (see class ColumnCache) bypass the column
+// object, so they are not counted.
+// <p>
+// Collecting the statistics has to be enabled explicitly using
+// <src>ColumnIOStats::setEnabled</src> or by setting the aipsrc variable
+// <src>table.iostats</src> to true. It is a process-wide switch, so it also
+// applies to tables that are already open.
+// The statistics of all columns and data managers of a table can be
+// obtained as a Record using <src>Table::ioStatistics</src>.
+// </synopsis>
+
+// <motivation>
+// Finding out which columns and access patterns make a job slow should
+// not require parsing the output of table tracing.
+// </motivation>
+
+class ColumnIOStats
+{
+public:
+    // The number of bins in the latency histogram.
+    enum {NrHistBins = 24};
+
+    // Helper class timing an IO operation. At destruction it adds the
+    // operation to the statistics if they are enabled.
+    class Timer
+    {
+    public:
+        Timer (ColumnIOStats& stats, Bool isWrite,
+               uInt64 nrCells, uInt64 nrBytes)
+          : stats_p   (enabled() ? &stats : 0),
+            isWrite_p (isWrite),
+            nrCells_p (nrCells),
+            nrBytes_p (nrBytes)
+        {
+            if (stats_p) {
+                start_p = std::chrono::steady_clock::now();
+            }
+        }
+        ~Timer()
+        {
+            if (stats_p) {
+                std::chrono::duration<double> dur =
+                  std::chrono::steady_clock::now() - start_p;
+                stats_p->add (isWrite_p, nrCells_p, nrBytes_p, dur.count());
+            }
+        }
+        Timer (const Timer&) = delete;
+        Timer& operator= (const Timer&) = delete;
+    private:
+        ColumnIOStats* stats_p;
+        Bool   isWrite_p;
+        uInt64 nrCells_p;
+        uInt64 nrBytes_p;
+        std::chrono::steady_clock::time_point start_p;
+    };
+
+    ColumnIOStats();
+
+    // Enable or disable collecting the statistics for all columns.
+    static void setEnabled (Bool enable);
+
+    // Is collecting the statistics enabled?
+    // The initial value is given by the aipsrc variable
+    // <src>table.iostats</src> (default False).
+    static Bool enabled();
+
+    // Add a read or write operation taking the given time (in seconds).
+    // It is thread-safe, because a column can be read by multiple threads.
+    void add (Bool isWrite, uInt64 nrCells, uInt64 nrBytes, Double seconds);
+
+    // Get the statistics as a record with subrecords READ and WRITE.
+    // Each subrecord has fields NCALL, NCELL, NBYTE, TIME (in seconds) and
+    // HISTOGRAM (a vector with the number of calls per latency bin).
+    Record toRecord() const;
+
+private:
+    struct Counts {
+        uInt64 nrCalls;
+        uInt64 nrCells;
+        uInt64 nrBytes;
+        Double time;
+        uInt64 hist[NrHistBins];
+    };
+
+    // Clear the counts.
+    static void clear (Counts&);
+
+    // Convert the counts to a record.
+    static Record toRecord (const Counts&);
+
+    //# Data members
+    Counts read_p;
+    Counts write_p;
+    mutable std::mutex mutex_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -37,7 +37,10 @@
 #include <casacore/casa/IO/MultiHDF5.h>
 #include <casacore/casa/IO/MemoryIO.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <atomic>
 #include <limits>
+#include <mutex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -45,14 +48,27 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 #define COLMAPNAME(NAME)   (static_cast<PlainColumn*>(colMap_p.at(NAME)))
 #define COLMAPCAST(PTR)    (static_cast<PlainColumn*>(PTR))
 
+// The lazy open switch is initialized from aipsrc at first use.
+static std::atomic<Bool> theirLazyOpen (True);
+static std::once_flag theirLazyOpenInitFlag;
+
+static void initLazyOpen()
+{
+    Bool lazyOpen;
+    AipsrcValue<Bool>::find (lazyOpen, "table.lazyopen", True);
+    theirLazyOpen = lazyOpen;
+}
+
 
 ColumnSet::ColumnSet (TableDesc* tdesc, const StorageOption& opt)
 : tdescPtr_p      (tdesc),
   storageOpt_p    (opt),
   baseTablePtr_p  (0),
   lockPtr_p       (0),
+  changeCount_p   (0),
   seqCount_p      (0),
-  blockDataMan_p  (0)
+  blockDataMan_p  (0),
+  nrPending_p     (0)
 {
     //# Loop through all columns in the description and create
     //# a column out of them.
@@ -87,6 +103,60 @@ PlainColumn* ColumnSet::getColumn (uInt columnIndex) const
     return COLMAPNAME(name);
 }
 
+void ColumnSet::setLazyOpen (Bool lazyOpen)
+{
+    std::call_once (theirLazyOpenInitFlag, initLazyOpen);
+    theirLazyOpen = lazyOpen;
+}
+
+Bool ColumnSet::lazyOpen()
+{
+    std::call_once (theirLazyOpenInitFlag, initLazyOpen);
+    return theirLazyOpen;
+}
+
+void ColumnSet::openDataManager (const PlainColumn* column)
+{
+    if (nrPending_p > 0) {
+	for (uInt i=0; i<pendingOpen_p.nelements(); i++) {
+	    if (blockDataMan_p[i] == column->dataManager()) {
+		openPendingDataManager (i);
+		break;
+	    }
+	}
+    }
+}
+
+void ColumnSet::openAllDataManagers()
+{
+    for (uInt i=0; nrPending_p > 0  &&  i<pendingOpen_p.nelements(); i++) {
+	openPendingDataManager (i);
+    }
+}
+
+void ColumnSet::openPendingDataManager (uInt index)
+{
+    if (index >= pendingOpen_p.nelements()  ||  !pendingOpen_p[index]) {
+	return;
+    }
+    //# The data manager reads its files, so the table has to be locked.
+    //# Acquiring the lock can resync the table, which opens all pending
+    //# data managers. So test again if still pending.
+    Bool hasLocked = userLock (FileLocker::Read, True);
+    checkReadLock (True);
+    if (pendingOpen_p[index]) {
+	pendingOpen_p[index] = False;
+	nrPending_p--;
+	std::vector<uChar> data;
+	data.swap (pendingData_p[index]);
+	auto memio = std::make_shared<MemoryIO>(data.data(), data.size());
+	AipsIO aio(memio);
+	BLOCKDATAMANVAL(index)->open64 (nrrow_p, aio);
+	prepareDataManager (index);
+    }
+    userUnlock (hasLocked);
+}
+
 void ColumnSet::addDataManager (DataManager* dmPtr)
 {
     uInt nr = blockDataMan_p.nelements();
@@ -161,6 +231,18 @@ void ColumnSet::prepareSomeDataManagers (uInt from)
     }
 }
 
+void ColumnSet::prepareDataManager (uInt index)
+{
+    DataManager* dmPtr = BLOCKDATAMANVAL(index);
+    if (dmPtr->canReallocateColumns()) {
+	for (uInt j=0; j<colMap_p.size(); j++) {
+	    DataManagerColumn*& column = getColumn(j)->dataManagerColumn();
+	    column = dmPtr->reallocateColumn (column);
+	}
+    }
+    dmPtr->prepare();
+}
+
 void ColumnSet::openMultiFile (uInt from, const Table& tab,
                                ByteIO::OpenOption opt)
 {
@@ -181,7 +263,10 @@ void ColumnSet::openMultiFile (uInt from, const Table& tab,
       if (storageOpt_p.option() == StorageOption::MultiFile) {
         multiFile_p = std::make_shared<MultiFile>(tab.tableName() + "/table.mf",
                                                   opt, storageOpt_p.blockSize(),
-                                                  storageOpt_p.useODirect());
+                                                  storageOpt_p.useODirect(),
+                                                  False,
+                                                  storageOpt_p.nStripe(),
+                                                  storageOpt_p.asyncIO());
       } else {
         multiFile_p = std::make_shared<MultiHDF5>(tab.tableName() + "/table.mfh5",
                                                   opt, storageOpt_p.blockSize());
@@ -200,6 +285,7 @@ rownr_t ColumnSet::resync (rownr_t nrrow, Bool forceSync)
     if (dataManChanged_p.nelements() > 0) {
 	AlwaysAssert (dataManChanged_p.nelements() ==
 		                   blockDataMan_p.nelements(), AipsError);
+	openAllDataManagers();
 	for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
 	    if (dataManChanged_p[i]  ||  nrrow != nrrow_p  ||  forceSync) {
                 rownr_t nrr = BLOCKDATAMANVAL(i)->resync64 (nrrow);
@@ -602,6 +688,9 @@ void ColumnSet::renameColumn (const String& newName, const String& oldName)
 DataManager* ColumnSet::findDataManager (const String& name,
                                          Bool byColumn) const
 {
+    // The data managers have to be opened, because their names are
+    // known after opening and because the caller can access them directly.
+    const_cast<ColumnSet*>(this)->openAllDataManagers();
     if (byColumn) {
         return COLMAPNAME(name)->dataManager();
     }
@@ -661,6 +750,8 @@ String ColumnSet::uniqueDataManagerName (const String& name) const
 
 TableDesc ColumnSet::actualTableDesc() const
 {
+    // The data managers have to be opened to get their names.
+    const_cast<ColumnSet*>(this)->openAllDataManagers();
     TableDesc td = *tdescPtr_p;
     for (uInt i=0; i<td.ncolumn(); i++) {
         ColumnDesc& cd = td.rwColumnDesc(i);
@@ -680,6 +771,8 @@ Record ColumnSet::dataManagerInfo (Bool virtualOnly) const
 {
     Record rec;
     uInt nrec=0;
+    // The data managers have to be opened to get their info.
+    const_cast<ColumnSet*>(this)->openAllDataManagers();
     // Loop through all data managers.
     for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
         DataManager* dmPtr = BLOCKDATAMANVAL(i);
@@ -710,6 +803,45 @@ Record ColumnSet::dataManagerInfo (Bool virtualOnly) const
     return rec;
 }
 
+Record ColumnSet::ioStatistics() const
+{
+    Record colrec;
+    for (auto& x : colMap_p) {
+        colrec.defineRecord (x.first,
+                             COLMAPCAST(x.second)->ioStatistics().toRecord());
+    }
+    Record dmrec;
+    uInt nrec=0;
+    for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
+        // Skip data managers not opened yet; they did not do any IO.
+        if (i < pendingOpen_p.nelements()  &&  pendingOpen_p[i]) {
+            continue;
+        }
+        DataManager* dmPtr = BLOCKDATAMANVAL(i);
+        Vector<String> columns(colMap_p.size());
+        uInt nc=0;
+        for (auto& x : colMap_p) {
+            if (COLMAPCAST(x.second)->dataManager() == dmPtr) {
+                columns(nc++) = x.first;
+            }
+        }
+        if (nc > 0) {
+            columns.resize (nc, True);
+            Record subrec;
+            subrec.define ("TYPE", dmPtr->dataManagerType());
+            subrec.define ("NAME", dmPtr->dataManagerName());
+            subrec.define ("COLUMNS", columns);
+            subrec.defineRecord ("CACHE", dmPtr->cacheStatistics());
+            dmrec.defineRecord (nrec, subrec);
+            nrec++;
+        }
+    }
+    Record rec;
+    rec.defineRecord ("COLUMNS", colrec);
+    rec.defineRecord ("DATAMANAGERS", dmrec);
+    return rec;
+}
+
 
 //# Initialize rows.
 void ColumnSet::initialize (rownr_t startRow, rownr_t endRow)
@@ -722,6 +854,8 @@ void ColumnSet::initialize (rownr_t startRow, rownr_t endRow)
 
 void ColumnSet::reopenRW()
 {
+    // Data managers not opened yet have to be opened first.
+    openAllDataManagers();
     if (multiFile_p) {
         multiFile_p->reopenRW();
     }
@@ -757,6 +891,7 @@ Bool ColumnSet::putFile (Bool writeTable, AipsIO& ios,
 			 const TableAttr& attr, Bool fsync)
 {
     Bool written = False;
+    openAllDataManagers();
     //# Only write the table data when the flag is set.
     uInt nrold = dataManChanged_p.nelements();
     dataManChanged_p.resize (blockDataMan_p.nelements(), True);
@@ -889,19 +1024,39 @@ rownr_t ColumnSet::getFile (AipsIO& ios, Table& tab, rownr_t nrrow, Bool bigEndi
 	BLOCKDATAMANVAL(i)->linkToTable (tab);
     }
     //# Finally open the data managers and let them prepare themselves.
+    //# For a readonly table the data of data managers that can be opened
+    //# later are kept; they are opened when one of their columns is accessed.
+    Bool lazy = !tab.isWritable()  &&  lazyOpen();
+    pendingData_p.resize (nr);
+    pendingOpen_p.resize (nr);
+    nrPending_p = 0;
     for (i=0; i<nr; i++) {
 	uChar* data;
 	uInt leng;
 	ios.getnew (leng, data);
-        auto memio = std::make_shared<MemoryIO>(data, leng);
-	AipsIO aio(memio);
-	rownr_t nrrow = BLOCKDATAMANVAL(i)->open64 (nrrow_p, aio);
-        if (nrrow > nrrow_p) {
-          nrrow_p = nrrow;
+        pendingOpen_p[i] = lazy  &&  BLOCKDATAMANVAL(i)->canDeferOpen();
+        if (pendingOpen_p[i]) {
+            pendingData_p[i].assign (data, data+leng);
+            nrPending_p++;
+        } else {
+            auto memio = std::make_shared<MemoryIO>(data, leng);
+            AipsIO aio(memio);
+            rownr_t nrrow = BLOCKDATAMANVAL(i)->open64 (nrrow_p, aio);
+            if (nrrow > nrrow_p) {
+              nrrow_p = nrrow;
+            }
         }
 	delete [] data;
     }
-    prepareSomeDataManagers (0);
+    if (nrPending_p == 0) {
+        prepareSomeDataManagers (0);
+    } else {
+        for (i=0; i<nr; i++) {
+            if (! pendingOpen_p[i]) {
+                prepareDataManager (i);
+            }
+        }
+    }
     return nrrow_p;
 }
 
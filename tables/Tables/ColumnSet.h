@@ -36,6 +36,7 @@
 #include <casacore/casa/Arrays/ArrayFwd.h>
 
 #include <map>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -121,6 +122,21 @@ public:
     // Get a column by index.
     PlainColumn* getColumn (uInt columnIndex) const;
 
+    // Open the data manager of the given column if its opening was
+    // deferred (see getFile).
+    void openDataManager (const PlainColumn* column);
+
+    // Open all data managers whose opening was deferred.
+    void openAllDataManagers();
+
+    // Enable or disable deferred opening of data managers.
+    // Initially it is set from aipsrc variable <src>table.lazyopen</src>
+    // which defaults to True.
+    // <group>
+    static void setLazyOpen (Bool lazyOpen);
+    static Bool lazyOpen();
+    // </group>
+
     // Add a data manager.
     // It increments seqCount_p and returns that as a unique sequence number.
     // This can, for instance, be used to create a unique file name.
@@ -149,6 +165,12 @@ public:
     void checkWriteLock (Bool wait);
     // </group>
 
+    // Get the change counter. It is incremented for each write access
+    // (i.e., each call of <src>checkWriteLock</src>), so it tells if data
+    // in the table might have been changed by this process.
+    uInt64 changeCounter() const
+        { return changeCount_p; }
+
     // Inspect the auto lock when the inspection interval has expired and
     // release it when another process needs the lock.
     void autoReleaseLock();
@@ -211,6 +233,14 @@ public:
     // Optionally only the virtual engines are retrieved.
     Record dataManagerInfo (Bool virtualOnly=False) const;
 
+    // Get the IO statistics of the columns and data managers.
+    // Subrecord COLUMNS contains the statistics of each column
+    // (see <linkto class=ColumnIOStats>ColumnIOStats</linkto>).
+    // Subrecord DATAMANAGERS contains a subrecord per data manager with
+    // the fields TYPE, NAME, COLUMNS, and CACHE holding the statistics
+    // given by <src>DataManager::cacheStatistics</src>.
+    Record ioStatistics() const;
+
     // Get the trace-id of the table.
     int traceId() const
       { return baseTablePtr_p->traceId(); }
@@ -226,6 +256,11 @@ public:
     // Read the data, reconstruct the data managers, and link those to
     // the table object.
     // This function gets called when an existing table is read back.
+    // If the table is opened readonly and lazy opening is enabled, the
+    // data managers that can defer their opening are not opened yet.
+    // Instead their data are kept and a data manager is opened when one
+    // of its columns is accessed or when needed for other operations
+    // (e.g. resync or reopenRW).
     // It returns the number of rows in case a data manager thinks there are
     // more. That is in particular used by LofarStMan.
     rownr_t getFile (AipsIO&, Table& tab, rownr_t nrrow, Bool bigEndian,
@@ -285,6 +320,12 @@ private:
     // Let the data managers (from the given index on) prepare themselves.
     void prepareSomeDataManagers (uInt from);
 
+    // Let the given data manager prepare itself.
+    void prepareDataManager (uInt index);
+
+    // Open the data manager with the given index if it is still pending.
+    void openPendingDataManager (uInt index);
+
     // Open or create the MultiFile if needed.
     void openMultiFile (uInt from, const Table& tab,
                         ByteIO::OpenOption);
@@ -321,11 +362,16 @@ private:
     rownr_t                 nrrow_p;          //# #rows
     BaseTable*              baseTablePtr_p;
     TableLockData*          lockPtr_p;        //# lock object
+    uInt64                  changeCount_p;    //# #write accesses
     std::map<String,void*>  colMap_p;         //# list of PlainColumns
     uInt                    seqCount_p;       //# sequence number count
     //#                                           (used for unique seqnr)
     Block<void*>            blockDataMan_p;   //# list of data managers
     Block<Bool>             dataManChanged_p; //# data has changed
+    //# Data of the data managers whose opening is deferred.
+    std::vector<std::vector<uChar>> pendingData_p;
+    Block<Bool>             pendingOpen_p;    //# data manager not opened yet
+    uInt                    nrPending_p;      //# #data managers not opened
 };
 
 
@@ -355,6 +401,7 @@ inline void ColumnSet::checkReadLock (Bool wait)
 }
 inline void ColumnSet::checkWriteLock (Bool wait)
 {
+    ++changeCount_p;
     if (! lockPtr_p->hasLock (FileLocker::Write)) {
 	doLock (FileLocker::Write, wait);
     }
@@ -35,25 +35,35 @@
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/OS/File.h>
+#include <cstdio>
+#include <limits>
+#include <unistd.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 ColumnsIndex::ColumnsIndex (const Table& table, const String& columnName,
-			    Compare* compareFunction, Bool noSort)
+			    Compare* compareFunction, Bool noSort,
+                            Bool persistent)
 : itsLowerKeyPtr (0),
   itsUpperKeyPtr (0)
 {
   Vector<String> columnNames(1);
   columnNames(0) = columnName;
-  create (table, columnNames, compareFunction, noSort);
+  create (table, columnNames, compareFunction, noSort, persistent);
 }
 
 ColumnsIndex::ColumnsIndex (const Table& table,
 			    const Vector<String>& columnNames,
-			    Compare* compareFunction, Bool noSort)
+			    Compare* compareFunction, Bool noSort,
+                            Bool persistent)
+: itsLowerKeyPtr (0),
+  itsUpperKeyPtr (0)
 {
-  create (table, columnNames, compareFunction, noSort);
+  create (table, columnNames, compareFunction, noSort, persistent);
 }
 
 ColumnsIndex::ColumnsIndex (const ColumnsIndex& that)
@@ -81,6 +91,7 @@ void ColumnsIndex::copy (const ColumnsIndex& that)
     itsTable = that.itsTable;
     itsNrrow   = itsTable.nrow();
     itsNoSort  = that.itsNoSort;
+    itsPersistent = that.itsPersistent;
     itsCompare = that.itsCompare;
     makeObjects (that.itsLowerKeyPtr->description());
   }
@@ -186,12 +197,13 @@ void ColumnsIndex::addColumnToDesc (RecordDesc& description,
 void ColumnsIndex::create (const Table& table,
 			   const Vector<String>& columnNames,
 			   Compare* compareFunction,
-			   Bool noSort)
+			   Bool noSort, Bool persistent)
 {
   itsTable = table;
   itsNrrow = itsTable.nrow();
   itsCompare = (compareFunction == 0  ?  compare : compareFunction);
   itsNoSort = noSort;
+  itsPersistent = persistent;
   // Loop through all column names.
   // Always add it to the RecordDesc.
   RecordDesc description;
@@ -325,6 +337,20 @@ void ColumnsIndex::readData()
   if (!itsChanged) {
     return;
   }
+  // Try to use the persistent index if the entire index has to be made.
+  // The modify counter is up to date because the table is locked.
+  Bool persist = canPersist();
+  uInt modifyCounter = 0;
+  if (persist) {
+    modifyCounter = itsTable.baseTablePtr()->getModifyCounter();
+    Bool allChanged = True;
+    for (uInt i=0; i<itsColumnChanged.nelements(); i++) {
+      allChanged = allChanged && itsColumnChanged[i];
+    }
+    if (allChanged  &&  readPersistent (modifyCounter)) {
+      return;
+    }
+  }
   Sort sort;
   Bool deleteIt;
   const RecordDesc& desc = itsLowerKeyPtr->description();
@@ -461,6 +487,173 @@ void ColumnsIndex::readData()
   itsDataInx = itsDataIndex.getStorage (deleteIt);
   itsUniqueInx = itsUniqueIndex.getStorage (deleteIt);
   itsChanged = False;
+  if (persist) {
+    writePersistent (modifyCounter);
+  }
+}
+
+String ColumnsIndex::persistentName() const
+{
+  String name = itsTable.tableName() + "/table.colsindex";
+  const RecordDesc& desc = itsLowerKeyPtr->description();
+  for (uInt i=0; i<desc.nfields(); i++) {
+    name += '_' + desc.name(i);
+  }
+  return name;
+}
+
+Bool ColumnsIndex::canPersist() const
+{
+  // Only a readonly plain table cannot have unflushed changes.
+  // The modify counter is only up to date if read locks are acquired.
+  // The index cannot tell which compare function was used by a user.
+  // AipsIO can store at most 2**32 values in an array.
+  const TableLock& lockOpt = itsTable.lockOptions();
+  return itsPersistent  &&  itsTable.tableType() == Table::Plain  &&
+         !itsTable.isWritable()  &&
+         lockOpt.option() != TableLock::NoLocking  &&
+         lockOpt.readLocking()  &&
+         itsCompare == compare  &&
+         itsNrrow <= std::numeric_limits<uInt>::max();
+}
+
+namespace {
+  // Read or write the key data vector of the given type.
+  template<typename T>
+  void persistKeyData (AipsIO& ios, Bool write, void* vecPtr, void*& data)
+  {
+    Vector<T>& vec = *static_cast<Vector<T>*>(vecPtr);
+    if (write) {
+      ios << vec;
+    } else {
+      ios >> vec;
+      Bool deleteIt;
+      data = vec.getStorage (deleteIt);
+    }
+  }
+
+  void persistKeyData (AipsIO& ios, Bool write, Int dtype,
+                       void* vecPtr, void*& data)
+  {
+    switch (dtype) {
+    case TpBool:
+      persistKeyData<Bool> (ios, write, vecPtr, data);
+      break;
+    case TpUChar:
+      persistKeyData<uChar> (ios, write, vecPtr, data);
+      break;
+    case TpShort:
+      persistKeyData<Short> (ios, write, vecPtr, data);
+      break;
+    case TpInt:
+      persistKeyData<Int> (ios, write, vecPtr, data);
+      break;
+    case TpUInt:
+      persistKeyData<uInt> (ios, write, vecPtr, data);
+      break;
+    case TpInt64:
+      persistKeyData<Int64> (ios, write, vecPtr, data);
+      break;
+    case TpFloat:
+      persistKeyData<Float> (ios, write, vecPtr, data);
+      break;
+    case TpDouble:
+      persistKeyData<Double> (ios, write, vecPtr, data);
+      break;
+    case TpComplex:
+      persistKeyData<Complex> (ios, write, vecPtr, data);
+      break;
+    case TpDComplex:
+      persistKeyData<DComplex> (ios, write, vecPtr, data);
+      break;
+    case TpString:
+      persistKeyData<String> (ios, write, vecPtr, data);
+      break;
+    default:
+      throw (TableError ("ColumnsIndex: unknown data type"));
+    }
+  }
+}
+
+Bool ColumnsIndex::readPersistent (uInt modifyCounter)
+{
+  String name = persistentName();
+  if (! File(name).isReadable()) {
+    return False;
+  }
+  const RecordDesc& desc = itsLowerKeyPtr->description();
+  uInt nrfield = itsDataTypes.nelements();
+  try {
+    AipsIO ios (name);
+    ios.getstart ("ColumnsIndex");
+    uInt counter, nfield;
+    uInt64 nrrow;
+    Bool noSort;
+    ios >> counter >> nrrow >> noSort >> nfield;
+    if (counter != modifyCounter  ||  nrrow != itsNrrow  ||
+        noSort != itsNoSort  ||  nfield != nrfield) {
+      return False;
+    }
+    for (uInt i=0; i<nrfield; i++) {
+      String fieldName;
+      Int dtype;
+      ios >> fieldName >> dtype;
+      if (fieldName != desc.name(i)  ||  dtype != itsDataTypes[i]) {
+        return False;
+      }
+    }
+    for (uInt i=0; i<nrfield; i++) {
+      persistKeyData (ios, False, itsDataTypes[i], itsDataVectors[i],
+                      itsData[i]);
+    }
+    ios >> itsDataIndex >> itsUniqueIndex;
+    ios.getend();
+  } catch (const AipsError&) {
+    // A damaged file is ignored; the index is made again.
+    itsColumnChanged.set (True);
+    return False;
+  }
+  Bool deleteIt;
+  itsDataInx = itsDataIndex.getStorage (deleteIt);
+  itsUniqueInx = itsUniqueIndex.getStorage (deleteIt);
+  itsColumnChanged.set (False);
+  itsChanged = False;
+  return True;
+}
+
+void ColumnsIndex::writePersistent (uInt modifyCounter) const
+{
+  if (! File(itsTable.tableName()).isWritable()) {
+    return;
+  }
+  // Write into a temporary file and rename it to make the update atomic
+  // for other processes reading it.
+  String name = persistentName();
+  String tmpName = name + "_tmp" + String::toString(getpid());
+  const RecordDesc& desc = itsLowerKeyPtr->description();
+  uInt nrfield = itsDataTypes.nelements();
+  try {
+    {
+      AipsIO ios (tmpName, ByteIO::New);
+      ios.putstart ("ColumnsIndex", 1);
+      ios << modifyCounter << uInt64(itsNrrow) << itsNoSort << nrfield;
+      for (uInt i=0; i<nrfield; i++) {
+        ios << desc.name(i) << itsDataTypes[i];
+      }
+      for (uInt i=0; i<nrfield; i++) {
+        void* data;
+        persistKeyData (ios, True, itsDataTypes[i], itsDataVectors[i], data);
+      }
+      ios << itsDataIndex << itsUniqueIndex;
+      ios.putend();
+    }
+    if (rename (tmpName.chars(), name.chars()) != 0) {
+      unlink (tmpName.chars());
+    }
+  } catch (const AipsError&) {
+    // Not being able to write the index is not an error.
+    unlink (tmpName.chars());
+  }
 }
 
 rownr_t ColumnsIndex::bsearch (Bool& found, const Block<void*>& fieldPtrs) const
@@ -108,6 +108,23 @@ template<typename T> class RecordFieldPtr;
 // <br>If data have changed, the entire index will be recreated by
 // rereading and optionally resorting the data. This will be deferred
 // until the next key lookup.
+// <p>
+// An index can be made persistent by setting <src>persistent=True</src>
+// in the constructor. The index (i.e., the key data and the sorted row
+// numbers) is then stored in a file in the table directory, so another
+// process opening the table can use it without reading and sorting the
+// key columns again. The file holds the number of rows and the modify
+// counter kept in the table's lock file (see
+// <linkto class=TableSyncData>TableSyncData</linkto>); the file is only
+// used if both still match, so any data change written to the table
+// invalidates it.
+// <br>A persistent index is only used for a plain table opened readonly,
+// because otherwise unflushed changes could make it stale. Furthermore,
+// the table must be opened with a locking option acquiring read locks,
+// because otherwise the modify counter might not be up to date. It is
+// also not used if a compare function is given, because the index file
+// cannot tell which compare function was used.
+// The index file is not written if the table directory is not writable.
 // </synopsis>
 
 // <example>
@@ -245,8 +262,11 @@ public:
     // column and the sort step will not be done.
     // The default compare function is provided by this class. It simply
     // compares each field in the key.
+    // If <src>persistent==True</src>, the index is stored in the table
+    // directory for reuse by later processes (as explained above).
     ColumnsIndex (const Table&, const String& columnName,
-		  Compare* compareFunction = 0, Bool noSort = False);
+		  Compare* compareFunction = 0, Bool noSort = False,
+                  Bool persistent = False);
 
     // Create an index on the given table for the given columns, thus
     // the key is formed by multiple columns.
@@ -256,7 +276,8 @@ public:
     // The default compare function is provided by this class. It simply
     // compares each field in the key.
     ColumnsIndex (const Table&, const Vector<String>& columnNames,
-		  Compare* compareFunction = 0, Bool noSort = False);
+		  Compare* compareFunction = 0, Bool noSort = False,
+                  Bool persistent = False);
 
     // Copy constructor (copy semantics).
     ColumnsIndex (const ColumnsIndex& that);
@@ -275,6 +296,9 @@ public:
     // Get the table for which this index is created.
     const Table& table() const;
 
+    // Get the name of the file holding the persistent index.
+    String persistentName() const;
+
     // Something has changed in the table, so the index has to be recreated.
     // The 2nd version indicates that a specific column has changed,
     // so only that column is reread. If that column is not part of the
@@ -350,7 +374,7 @@ protected:
 
     // Create the various members in the object.
     void create (const Table& table, const Vector<String>& columnNames,
-		 Compare* compareFunction, Bool noSort);
+		 Compare* compareFunction, Bool noSort, Bool persistent);
 
     // Make the various internal <src>RecordFieldPtr</src> objects.
     void makeObjects (const RecordDesc& description);
@@ -359,6 +383,16 @@ protected:
     // form the index.
     void readData();
 
+    // Can the persistent index be used?
+    Bool canPersist() const;
+
+    // Read the persistent index if its modify counter and number of rows
+    // match. It returns False if it could not be read.
+    Bool readPersistent (uInt modifyCounter);
+
+    // Write the persistent index. Nothing is done if it cannot be written.
+    void writePersistent (uInt modifyCounter) const;
+
     // Do a binary search on <src>itsUniqueIndex</src> for the key in
     // <src>fieldPtrs</src>.
     // If the key is found, <src>found</src> is set to True and the index
@@ -404,6 +438,7 @@ private:
     Block<Bool>     itsColumnChanged;
     Bool            itsChanged;
     Bool            itsNoSort;            //# True = sort is not needed
+    Bool            itsPersistent;        //# True = store index in table
     Compare*        itsCompare;           //# Compare function
     Vector<rownr_t> itsDataIndex;         //# Row numbers of all keys
     //# Indices in itsDataIndex for each unique key
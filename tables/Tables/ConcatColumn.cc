@@ -28,6 +28,8 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Utilities/GenSort.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -172,6 +174,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     refColPtr_p[tableNr]->getSlice (tabRownr, ns, arr);
   }
 
+  void ConcatColumn::getPackedBool (rownr_t rownr, const IPosition& shape,
+                                    uChar* bits) const
+  {
+    uInt tableNr;
+    rownr_t tabRownr;
+    refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
+    refColPtr_p[tableNr]->getPackedBool (tabRownr, shape, bits);
+  }
+
   void ConcatColumn::put (rownr_t rownr, const void* dataPtr)
   {
     uInt tableNr;
@@ -190,6 +201,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     refColPtr_p[tableNr]->putArray (tabRownr, arr);
   }
 
+  void ConcatColumn::putPackedBool (rownr_t rownr, const IPosition& shape,
+                                    const uChar* bits)
+  {
+    uInt tableNr;
+    rownr_t tabRownr;
+    refTabPtr_p->rows().mapRownr (tableNr, tabRownr, rownr);
+    refColPtr_p[tableNr]->putPackedBool (tabRownr, shape, bits);
+  }
+
   void ConcatColumn::putSlice (rownr_t rownr, const Slicer& ns,
 			       const ArrayBase& arr)
   {
@@ -216,13 +236,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void ConcatColumn::getArrayColumn (ArrayBase& arr) const
   {
-    accessColumn (0, arr, &getColumnPart);
+    accessColumn (0, arr, &getColumnPart, True);
   }
 
   void ConcatColumn::getColumnSlice (const Slicer& ns,
 				     ArrayBase& arr) const
   {
-    accessColumn (&ns, arr, &getColumnSlicePart);
+    accessColumn (&ns, arr, &getColumnSlicePart, True);
   }
 
   void ConcatColumn::getArrayColumnCells (const RefRows& rownrs,
@@ -264,18 +284,40 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void ConcatColumn::accessColumn (const Slicer* ns,
 				   ArrayBase& arr,
-				   AccessColumnFunc* accessFunc) const
+				   AccessColumnFunc* accessFunc,
+				   Bool canParallel) const
   {
     IPosition st(arr.ndim(), 0);
     IPosition sz(arr.shape());
     uInt nlast = arr.ndim() - 1;
-    for (uInt i=0; i<refColPtr_p.nelements(); ++i) {
+    uInt ntab = refColPtr_p.nelements();
+    uInt nthread = 1;
+    if (canParallel  &&  ntab > 1) {
+      nthread = refTabPtr_p->readNThreads();
+    }
+    if (nthread <= 1) {
+      for (uInt i=0; i<ntab; ++i) {
+        rownr_t nr = refColPtr_p[i]->nrow();
+        sz[nlast] = nr;
+        std::unique_ptr<ArrayBase> part (arr.getSection (Slicer(st, sz)));
+        accessFunc (refColPtr_p[i], ns, *part);
+        st[nlast] += nr;
+      }
+      return;
+    }
+    // Make the array sections beforehand, so each thread only accesses
+    // its own part of the array and its own table.
+    std::vector<std::unique_ptr<ArrayBase>> parts(ntab);
+    for (uInt i=0; i<ntab; ++i) {
       rownr_t nr = refColPtr_p[i]->nrow();
       sz[nlast] = nr;
-      std::unique_ptr<ArrayBase> part (arr.getSection (Slicer(st, sz)));
-      accessFunc (refColPtr_p[i], ns, *part);
+      parts[i] = arr.getSection (Slicer(st, sz));
       st[nlast] += nr;
     }
+    ThreadPool::global().parallelFor (ntab, [&] (size_t i)
+      {
+        accessFunc (refColPtr_p[i], ns, *parts[i]);
+      }, nthread);
   }
 
   void ConcatColumn::accessRows (const RefRows& rownrs,
@@ -302,10 +344,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     IPosition sz(arr.shape());       // size of array part
     Int lastTabNr = -1;
     uInt tableNr;
+    // Map all concat rownrs at once.
+    Vector<uInt> tableNrs;
+    ccRows.mapRownrs (tableNrs, tabRowNrs, rows);
     // Step through all concat rownrs.
     for (rownr_t i=0; i<rows.nelements(); ++i) {
-      // Map to the table and rownr in it.
-      ccRows.mapRownr (tableNr, tabRowNrs[i], rows[i]);
+      tableNr = tableNrs[i];
       // An access has to be done if we have another table.
       if (Int(tableNr) != lastTabNr) {
 	// Access the cells if not the first time.
@@ -150,6 +150,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get a slice of an N-dimensional array in a particular cell.
     virtual void getSlice (rownr_t rownr, const Slicer&, ArrayBase& dataPtr) const;
 
+    // Get a Bool array in a particular cell as packed bits.
+    virtual void getPackedBool (rownr_t rownr, const IPosition& shape,
+                                uChar* bits) const;
+
     // Get the array of all array values in a column.
     // If the column contains n-dim arrays, the resulting array is (n+1)-dim.
     // The arrays in the column have to have the same shape in all cells.
@@ -184,6 +188,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Put a slice of an N-dimensional array in a particular cell.
     virtual void putSlice (rownr_t rownr, const Slicer&, const ArrayBase& dataPtr);
 
+    // Put packed bits into the Bool array in a particular cell.
+    virtual void putPackedBool (rownr_t rownr, const IPosition& shape,
+                                const uChar* bits);
+
     // Put the array of all array values in the column.
     // If the column contains n-dim arrays, the source array is (n+1)-dim.
     // The arrays in the column have to have the same shape in all cells.
@@ -231,9 +239,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                                  const Slicer*, ArrayBase& array);
 
     // Access the data for an entire column.
+    // If <src>canParallel</src> is True, the parts can be accessed
+    // concurrently (one thread per table) if so defined for the ConcatTable.
     void accessColumn (const Slicer* ns,
 		       ArrayBase& dataPtr,
-		       AccessColumnFunc*) const;
+		       AccessColumnFunc*,
+		       Bool canParallel=False) const;
 
     // Access the data with multiple rows combined.
     void accessRows (const RefRows& rownrs,
@@ -58,6 +58,40 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsLastTableNr = inx;
   }
 
+  void ConcatRows::mapRownrs (Vector<uInt>& tableNrs,
+                              Vector<rownr_t>& tabRownrs,
+                              const Vector<rownr_t>& rownrs) const
+  {
+    rownr_t nr = rownrs.size();
+    tableNrs.resize (nr);
+    tabRownrs.resize (nr);
+    rownr_t stRow  = itsLastStRow;
+    rownr_t endRow = itsLastEndRow;
+    uInt    tabNr  = itsLastTableNr;
+    for (rownr_t i=0; i<nr; ++i) {
+      rownr_t rownr = rownrs[i];
+      if (rownr < stRow  ||  rownr >= endRow) {
+        // Step to the next table if possible, otherwise search.
+        if (rownr >= endRow  &&  endRow > stRow  &&
+            tabNr+2 <= itsNTable  &&  rownr < itsRows[tabNr+2]) {
+          ++tabNr;
+          stRow  = itsRows[tabNr];
+          endRow = itsRows[tabNr+1];
+        } else {
+          findRownr (rownr);
+          stRow  = itsLastStRow;
+          endRow = itsLastEndRow;
+          tabNr  = itsLastTableNr;
+        }
+      }
+      tableNrs[i]  = tabNr;
+      tabRownrs[i] = rownr - stRow;
+    }
+    itsLastStRow   = stRow;
+    itsLastEndRow  = endRow;
+    itsLastTableNr = tabNr;
+  }
+
 
 
   ConcatRowsIter::ConcatRowsIter (const ConcatRows& rows)
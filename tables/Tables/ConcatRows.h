@@ -30,6 +30,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/Tables/RefRows.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Arrays/Vector.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -122,6 +123,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       tabRownr = rownr - itsLastStRow;
     }
 
+    // Map a vector of overall row numbers to table and row numbers.
+    // Successive row numbers in the same or the next table are found
+    // without a search, so mapping an ascending vector is linear.
+    // The output vectors are resized as needed.
+    void mapRownrs (Vector<uInt>& tableNrs, Vector<rownr_t>& tabRownrs,
+                    const Vector<rownr_t>& rownrs) const;
+
   private:
     // Find the row number and fill in the lastXX_p values.
     void findRownr (rownr_t rownr) const;
@@ -34,6 +34,8 @@
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/OS/Path.h>
 #include <casacore/casa/OS/Directory.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/System/AipsrcValue.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Utilities/Assert.h>
@@ -231,6 +233,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return tables_p[0].baseTablePtr()->getModifyCounter();
   }
 
+  uInt64 ConcatTable::getChangeCounter() const
+  {
+    uInt64 counter = 0;
+    for (uInt i=0; i<tables_p.nelements(); ++i) {
+      counter += tables_p[i].baseTablePtr()->getChangeCounter();
+    }
+    return counter;
+  }
+
 
   //# Write a concatenate table into a file.
   void ConcatTable::writeConcatTable (Bool)
@@ -414,6 +425,26 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return cols;
   }
 
+  uInt ConcatTable::readNThreads() const
+  {
+    Int nthread;
+    AipsrcValue<Int>::find (nthread, "table.concat.nthreads", 1);
+    if (nthread <= 0) {
+      nthread = ThreadPool::concurrency();
+    }
+    nthread = std::min (nthread, Int(tables_p.nelements()));
+    if (nthread > 1) {
+      for (uInt i=1; i<tables_p.nelements(); ++i) {
+        for (uInt j=0; j<i; ++j) {
+          if (tables_p[i].isSameRoot (tables_p[j])) {
+            return 1;
+          }
+        }
+      }
+    }
+    return std::max (1, nthread);
+  }
+
   //# Test if the table is writable.
   Bool ConcatTable::isWritable() const
   {
@@ -460,6 +491,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return tables_p[0].dataManagerInfo();
   }
 
+  Record ConcatTable::ioStatistics() const
+  {
+    return tables_p[0].ioStatistics();
+  }
+
   //# Get the keyword set.
   TableRecord& ConcatTable::keywordSet()
   {
@@ -216,6 +216,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the modify counter.
     virtual uInt getModifyCounter() const;
 
+    // Get the sum of the change counters of the underlying tables.
+    virtual uInt64 getChangeCounter() const;
+
     // Test if all underlying tables are opened as writable.
     virtual Bool isWritable() const;
 
@@ -245,6 +248,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the data manager info (of the first underlying table).
     virtual Record dataManagerInfo() const;
 
+    // Get the IO statistics (of the first underlying table).
+    virtual Record ioStatistics() const;
+
     // Get readonly access to the table keyword set.
     virtual TableRecord& keywordSet();
 
@@ -308,6 +314,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the column objects in the referenced tables.
     Block<BaseColumn*> getRefColumns (const String& columnName);
 
+    // Get the number of threads to use to read the parts of a column
+    // concurrently. It is defined by the aipsrc variable
+    // <src>table.concat.nthreads</src> (default 1; 0 means the ThreadPool
+    // concurrency), but is limited to the number of tables. It is 1 if some
+    // tables share the same root table, because they cannot be read in
+    // parallel.
+    uInt readNThreads() const;
+
   private:
     // Show the extra table structure info (names of used tables).
     void showStructureExtra (std::ostream&) const;
@@ -144,6 +144,11 @@ void MemoryTable::resync()
   return 0;
 }
 
+uInt64 MemoryTable::getChangeCounter() const
+{
+  return colSetPtr_p->changeCounter();
+}
+
 Bool MemoryTable::isWritable() const
 {
   return True;
@@ -190,6 +195,11 @@ Record MemoryTable::dataManagerInfo() const
   return colSetPtr_p->dataManagerInfo();
 }
 
+Record MemoryTable::ioStatistics() const
+{
+  return colSetPtr_p->ioStatistics();
+}
+
 TableRecord& MemoryTable::keywordSet()
 {
   return tdescPtr_p->rwKeywordSet();
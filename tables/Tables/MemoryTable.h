@@ -139,6 +139,9 @@ public:
   // Get the modify counter. It always returns 0.
   virtual uInt getModifyCounter() const;
 
+  // Get the change counter of the columns.
+  virtual uInt64 getChangeCounter() const;
+
   // Test if the table is opened as writable. It always returns True.
   virtual Bool isWritable() const;
 
@@ -165,6 +168,9 @@ public:
   // Get the data manager info.
   virtual Record dataManagerInfo() const;
 
+  // Get the IO statistics of the columns and data managers.
+  virtual Record ioStatistics() const;
+
   // Get readonly access to the table keyword set.
   virtual TableRecord& keywordSet();
 
@@ -32,6 +32,7 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayIter.h>
 #include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/Utilities/ValType.h>
 #include <casacore/tables/Tables/TableError.h>
 
 
@@ -42,7 +43,8 @@ PlainColumn::PlainColumn (const BaseColumnDesc* cdp, ColumnSet* csp)
   dataManPtr_p  (0),
   dataColPtr_p  (0),
   colSetPtr_p   (csp),
-  originalName_p(cdp->name())
+  originalName_p(cdp->name()),
+  elemSize_p    (ValType::getTypeSize (cdp->dataType()))
 {
   int trace = TableTrace::traceColumn (columnDesc());
   rtraceColumn_p = (trace&TableTrace::READ)  != 0;
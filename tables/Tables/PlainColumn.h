@@ -32,6 +32,7 @@
 #include <casacore/casa/Arrays/ArrayFwd.h>
 #include <casacore/tables/Tables/BaseColumn.h>
 #include <casacore/tables/Tables/ColumnSet.h>
+#include <casacore/tables/Tables/ColumnIOStats.h>
 #include <casacore/tables/Tables/TableRecord.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -135,6 +136,10 @@ public:
     // Read the column.
     void getFile (AipsIO&, const ColumnSet&, const TableAttr&);
 
+    // Get the IO statistics of the column.
+    const ColumnIOStats& ioStatistics() const
+      { return iostats_p; }
+
 protected:
     DataManager*        dataManPtr_p;    //# Pointer to data manager.
     DataManagerColumn*  dataColPtr_p;    //# Pointer to column in data manager.
@@ -142,6 +147,8 @@ protected:
     String              originalName_p;  //# Column name before any rename
     Bool                rtraceColumn_p;  //# trace reads of the column?
     Bool                wtraceColumn_p;  //# trace writes of the column?
+    mutable ColumnIOStats iostats_p;     //# IO statistics of the column
+    uInt                elemSize_p;      //# size of a value in local format
 
     // Get the trace-id of the table.
     int traceId() const
@@ -39,7 +39,10 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/OS/HostInfo.h>
 #include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/FileSync.h>
+#include <casacore/casa/OS/ThreadPool.h>
 #include <casacore/casa/System/AipsrcValue.h>
+#include <algorithm>
 #include <time.h>    //# for nanosleep
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -434,7 +437,9 @@ Bool PlainTable::lock (FileLocker::LockType type, uInt nattempts)
 	if (! lockPtr_p->acquire (&(lockSync_p.memoryIO()), type, nattempts)) {
 	    return False;
 	}
-	if (!noSync) {
+	//# No sync is needed either if the shared change counter tells
+	//# that no other process has changed the table.
+	if (!noSync  &&  !lockPtr_p->infoUnchanged()) {
 	    // Older readonly table files may have empty locksync data.
 	    // Skip the sync-ing in that case.
 	    uInt ncolumn;
@@ -502,15 +507,60 @@ uInt PlainTable::getModifyCounter() const
     return lockSync_p.getModifyCounter();
 }
 
+uInt64 PlainTable::getChangeCounter() const
+{
+    return colSetPtr_p->changeCounter();
+}
+
 
 void PlainTable::flush (Bool fsync, Bool recursive)
 {
-    if (openedForWrite()) {
+    if (! openedForWrite()) {
+        return;
+    }
+    if (! recursive) {
         putFile (False);
-        // Flush subtables if wanted.
-        if (recursive) {
-            keywordSet().flushTables (fsync);
+        if (fsync) {
+            FileSync::syncDirectories (std::vector<String>(1, tableName()));
+        }
+        return;
+    }
+    // Collect this table and its open subtables (recursively), so they
+    // can be flushed and synced as a group.
+    std::vector<PlainTable*> group(1, this);
+    std::vector<BaseTable*> others;
+    for (size_t i=0; i<group.size(); ++i) {
+        std::vector<BaseTable*> subTables;
+        group[i]->keywordSet().getFlushTables (subTables);
+        for (BaseTable* tab : subTables) {
+            PlainTable* ptab = dynamic_cast<PlainTable*>(tab);
+            if (ptab) {
+                if (ptab->openedForWrite()  &&
+                    std::find (group.begin(), group.end(), ptab) ==
+                    group.end()) {
+                    group.push_back (ptab);
+                }
+            } else if (std::find (others.begin(), others.end(), tab) ==
+                       others.end()) {
+                others.push_back (tab);
+            }
+        }
+    }
+    // The tables are independent, so they can be written in parallel.
+    ThreadPool::global().parallelFor (group.size(), [&] (size_t i) {
+        group[i]->putFile (False);
+      });
+    // Other table types (e.g. a RefTable subtable) flush themselves.
+    for (BaseTable* tab : others) {
+        tab->flush (fsync, True);
+    }
+    if (fsync) {
+        std::vector<String> dirNames;
+        dirNames.reserve (group.size());
+        for (const PlainTable* tab : group) {
+            dirNames.push_back (tab->tableName());
         }
+        FileSync::syncDirectories (dirNames);
     }
 }
 
@@ -619,6 +669,11 @@ Record PlainTable::dataManagerInfo() const
   return colSetPtr_p->dataManagerInfo();
 }
 
+Record PlainTable::ioStatistics() const
+{
+  return colSetPtr_p->ioStatistics();
+}
+
 
 //# Get access to the keyword set.
 TableRecord& PlainTable::keywordSet()
@@ -640,10 +695,19 @@ TableRecord& PlainTable::rwKeywordSet()
 
 
 //# Get a column object.
+//# Its data manager is opened if that was deferred.
 BaseColumn* PlainTable::getColumn (uInt columnIndex) const
-    { return colSetPtr_p->getColumn (columnIndex); }
+{
+    PlainColumn* col = colSetPtr_p->getColumn (columnIndex);
+    colSetPtr_p->openDataManager (col);
+    return col;
+}
 BaseColumn* PlainTable::getColumn (const String& columnName) const
-    { return colSetPtr_p->getColumn (columnName); }
+{
+    PlainColumn* col = colSetPtr_p->getColumn (columnName);
+    colSetPtr_p->openDataManager (col);
+    return col;
+}
 
 
 //# The data managers have to be inspected to tell if adding and removing
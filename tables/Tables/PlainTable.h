@@ -178,6 +178,9 @@ public:
     // files written by intermediate flushes.
     // Note that if necessary the destructor will do an implicit flush,
     // unless it is executed due to an exception.
+    // <br>A recursive flush writes the table and its open subtables in
+    // parallel and syncs their files together (see
+    // <linkto class=FileSync>FileSync</linkto>).
     virtual void flush (Bool fsync, Bool recursive);
 
     // Resync the Table object with the table file.
@@ -186,6 +189,9 @@ public:
     // Get the modify counter.
     virtual uInt getModifyCounter() const;
 
+    // Get the change counter of the columns.
+    virtual uInt64 getChangeCounter() const;
+
     // Set the table to being changed.
     virtual void setTableChanged();
 
@@ -202,6 +208,9 @@ public:
     // Get the data manager info.
     virtual Record dataManagerInfo() const;
 
+    // Get the IO statistics of the columns and data managers.
+    virtual Record ioStatistics() const;
+
     // Get readonly access to the table keyword set.
     virtual TableRecord& keywordSet();
 
@@ -31,11 +31,17 @@
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/Tables/SetupNewTab.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayUtil.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/OS/Path.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/IO/MMapIO.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Arrays/Slice.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Quanta/MVAngle.h>
 #include <casacore/casa/Utilities/Regex.h>
@@ -49,12 +55,73 @@
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/fstream.h>             // needed for file IO
 #include <casacore/casa/sstream.h>           // needed for internal IO
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 const Int lineSize = 32768;
 
+//# Convert a string to an integer type like operator>> does, but faster.
+//# Leading digits are used; out-of-range values are clamped.
+template<typename T> inline T toInteger (const char* str)
+{
+  long long value = strtoll (str, 0, 10);
+  if (value < std::numeric_limits<T>::min()) {
+    return std::numeric_limits<T>::min();
+  }
+  if (value > std::numeric_limits<T>::max()) {
+    return std::numeric_limits<T>::max();
+  }
+  return T(value);
+}
+
+//# Buffer holding the values of a scalar column for a chunk of lines.
+class RATBuffer
+{
+public:
+  virtual ~RATBuffer()
+    {}
+  virtual void resize (size_t n) = 0;
+  virtual void* at (size_t i) = 0;
+  // Put the first n values into the column starting at the given row.
+  virtual void put (TableColumn& col, rownr_t row, size_t n) = 0;
+};
+
+template<typename T> class RATBufferT: public RATBuffer
+{
+public:
+  virtual void resize (size_t n)
+    { itsData.resize (n); itsData = T(); }
+  virtual void* at (size_t i)
+    { return &(itsData[i]); }
+  virtual void put (TableColumn& col, rownr_t row, size_t n)
+  {
+    if (n > 0) {
+      ScalarColumn<T>(col).putColumnRange
+        (Slicer(IPosition(1,row), IPosition(1,n)), itsData(Slice(0,n)));
+    }
+  }
+private:
+  Vector<T> itsData;
+};
+
+//# The values parsed from a chunk of lines.
+struct RATChunk
+{
+  Int64  start;          //# offset of first line in the mapped data
+  Int64  end;            //# offset after the last line
+  Int    firstLine;      //# line number of the first line
+  Int    nlines;
+  size_t nrow;           //# number of rows found
+  Bool   stop;           //# stop reading after this chunk?
+  std::vector<std::unique_ptr<RATBuffer>> columns;
+};
+
 
 
 //# Helper function.
@@ -562,38 +629,21 @@ Bool ReadAsciiTable::getValue (char* string1, Int lineSize, char* first,
     first[0] = '\0';
   }
   if(more){
-  String dum(first, done1);
   switch (type) {
   case RATBool:
     *(Bool*)value = makeBool(String(first, done1));
     break;
   case RATShort:
-    if (done1 > 0) {
-      istringstream(dum) >> *(Short*)value;
-    } else {
-      *(Short*)value = 0;
-    }
+    *(Short*)value = toInteger<Short> (first);
     break;
   case RATInt:
-    if (done1 > 0) {
-      istringstream(dum) >> *(Int*)value;
-    } else {
-      *(Int*)value = 0;
-    }
+    *(Int*)value = toInteger<Int> (first);
     break;
   case RATFloat:
-    if (done1 > 0) {
-      istringstream(dum) >> *(Float*)value;
-    } else {
-      *(Float*)value = 0;
-    }
+    *(Float*)value = strtof (first, 0);
     break;
   case RATDouble:
-    if (done1 > 0) {
-      istringstream(dum) >> *(Double*)value;
-    } else {
-      *(Double*)value = 0;
-    }
+    *(Double*)value = strtod (first, 0);
     break;
   case RATString:
     *(String*)value = String(first, done1);
@@ -605,47 +655,35 @@ Bool ReadAsciiTable::getValue (char* string1, Int lineSize, char* first,
     *(Double*)value = stringToPos (String(first, done1), False);
     break;
   case RATComX:
-    if (done1 > 0) {
-      istringstream(dum) >> f1;
-    }
+    f1 = strtof (first, 0);
     done1 = getNext (string1, lineSize, first, at1, separator);
     if (done1 > 0) {
-      String dum2(first, done1);
-      istringstream(dum2) >> f2;
+      f2 = strtof (first, 0);
     }
     *(Complex*)value = Complex(f1, f2);
     break;
   case RATDComX:
-    if (done1 > 0) {
-      istringstream(dum) >> d1;
-    }
+    d1 = strtod (first, 0);
     done1 = getNext (string1, lineSize, first, at1, separator);
     if (done1 > 0) {
-      String dum2(first, done1);
-      istringstream(dum2) >> d2;
+      d2 = strtod (first, 0);
     }
     *(DComplex*)value = DComplex(d1, d2);
     break;
   case RATComZ:
-    if (done1 > 0) {
-      istringstream(dum) >> f1;
-    }
+    f1 = strtof (first, 0);
     done1 = getNext (string1, lineSize, first, at1, separator);
     if (done1 > 0) {
-      String dum2(first, done1);
-      istringstream(dum2) >> f2;
+      f2 = strtof (first, 0);
     }
     f2 *= 3.14159265/180.0; 
     *(Complex*)value = Complex(f1*cos(f2), f1*sin(f2));
     break;
   case RATDComZ:
-    if (done1 > 0) {
-      istringstream(dum) >> d1;
-    }
+    d1 = strtod (first, 0);
     done1 = getNext (string1, lineSize, first, at1, separator);
     if (done1 > 0) {
-      String dum2(first, done1);
-      istringstream(dum2) >> d2;
+      d2 = strtod (first, 0);
     }
     d2 *= 3.14159265/180.0; 
     *(DComplex*)value = DComplex(d1*cos(d2), d1*sin(d2));
@@ -1104,6 +1142,7 @@ Table ReadAsciiTable::makeTab (String& formatString,
     ifstream jFile;
     Path headerPath(headerfile);
     String hdrName = headerPath.expandedName();
+    String dataName = hdrName;
     jFile.open(hdrName.chars(), ios::in);
     if (! jFile) {
         throw AipsError ("ReadAsciiTable: file " + hdrName +
@@ -1158,6 +1197,7 @@ Table ReadAsciiTable::makeTab (String& formatString,
         jFile.close();
 	Path filePath(filein);
 	String fileName = filePath.expandedName();
+	dataName = fileName;
 	jFile.open(fileName.chars(), ios::in);
 	if (! jFile) {
 	    throw AipsError ("ReadAsciiTable: input file " + fileName +
@@ -1367,13 +1407,22 @@ Table ReadAsciiTable::makeTab (String& formatString,
 
 // OK, Now we have real data
 // stringsav may contain the first data line.
+// If all columns are scalars (not given as positions), the other lines
+// of a regular file are read in parallel by readParallel.
 
+    Bool parallel = File(dataName).isRegular();
+    for (Int i=0; i<nrcol; i++) {
+        if (shapeOfColumn[i].nelements() > 0  ||
+	    typeOfColumn[i] == RATDMS  ||  typeOfColumn[i] == RATHMS) {
+	    parallel = False;
+	}
+    }
     int at1=0;
     Bool cont = True;
     if (stringsav[0] == '\0') {
-        cont = getLine (jFile, lineNumber, string1, lineSize,
-			testComment, commentMarker,
-			firstLine, lastLine);
+        cont = !parallel  &&  getLine (jFile, lineNumber, string1, lineSize,
+				       testComment, commentMarker,
+				       firstLine, lastLine);
     } else {
         strcpy (string1, stringsav);
     }
@@ -1396,9 +1445,19 @@ Table ReadAsciiTable::makeTab (String& formatString,
 	    }
 	}
 	rownr++;
-        cont = getLine (jFile, lineNumber, string1, lineSize,
-			testComment, commentMarker,
-			firstLine, lastLine);
+        cont = !parallel  &&  getLine (jFile, lineNumber, string1, lineSize,
+				       testComment, commentMarker,
+				       firstLine, lastLine);
+    }
+    if (parallel) {
+        // tellg gives -1 if the end of the file has been reached.
+        Int64 offset = jFile.tellg();
+	jFile.close();
+	if (offset >= 0) {
+	    readParallel (dataName, offset, lineNumber, tab, tabcol,
+			  typeOfColumn, separator,
+			  testComment, commentMarker, firstLine, lastLine);
+	}
     }
 
     delete [] tabcol;
@@ -1408,6 +1467,164 @@ Table ReadAsciiTable::makeTab (String& formatString,
 }
 
 
+void ReadAsciiTable::readParallel (const String& fileName, Int64 offset,
+				   Int lineNumber, Table& tab,
+				   TableColumn* tabcol,
+				   const Block<Int>& typeOfColumn,
+				   Char separator,
+				   Bool testComment, const Regex& commentMarker,
+				   Int firstLine, Int lastLine)
+{
+  RegularFile file(fileName);
+  Int64 size = file.size();
+  if (offset >= size) {
+    return;
+  }
+  MMapIO mfile(file);
+  const char* data = static_cast<const char*>(mfile.getReadPointer(0));
+  mfile.advise (offset, size-offset, MMapfdIO::Sequential);
+  // Split the data into chunks of about 1 MB ending at a line end.
+  const Int64 chunkSize = 1048576;
+  std::vector<RATChunk> chunks;
+  Int64 start = offset;
+  while (start < size) {
+    Int64 end = std::min (start + chunkSize, size);
+    const void* nl = memchr (data + end - 1, '\n', size - end + 1);
+    end = (nl == 0  ?  size : static_cast<const char*>(nl) - data + 1);
+    chunks.push_back (RATChunk());
+    chunks.back().start = start;
+    chunks.back().end   = end;
+    start = end;
+  }
+  // Count the lines in each chunk to know their line numbers.
+  ThreadPool::global().parallelFor
+    (chunks.size(),
+     [&chunks, data, size](size_t i)
+     {
+       RATChunk& chunk = chunks[i];
+       chunk.nlines = std::count (data + chunk.start, data + chunk.end, '\n');
+       if (chunk.end == size  &&  data[size-1] != '\n') {
+         chunk.nlines++;
+       }
+     });
+  for (RATChunk& chunk : chunks) {
+    chunk.firstLine = lineNumber + 1;
+    lineNumber += chunk.nlines;
+  }
+  uInt nrcol = typeOfColumn.nelements();
+  // Parse a chunk the same way as getLine and handleScalar do.
+  auto parseChunk = [&](size_t i)
+  {
+    RATChunk& chunk = chunks[i];
+    chunk.nrow = 0;
+    chunk.stop = False;
+    if (lastLine > 0  &&  chunk.firstLine > lastLine) {
+      chunk.stop = True;
+      return;
+    }
+    chunk.columns.resize (nrcol);
+    for (uInt col=0; col<nrcol; col++) {
+      RATBuffer* buf = 0;
+      switch (typeOfColumn[col]) {
+      case RATBool:
+	buf = new RATBufferT<Bool>();
+	break;
+      case RATShort:
+	buf = new RATBufferT<Short>();
+	break;
+      case RATInt:
+	buf = new RATBufferT<Int>();
+	break;
+      case RATFloat:
+	buf = new RATBufferT<Float>();
+	break;
+      case RATString:
+	buf = new RATBufferT<String>();
+	break;
+      case RATComX:
+      case RATComZ:
+	buf = new RATBufferT<Complex>();
+	break;
+      case RATDComX:
+      case RATDComZ:
+	buf = new RATBufferT<DComplex>();
+	break;
+      default:
+	buf = new RATBufferT<Double>();
+	break;
+      }
+      chunk.columns[col].reset (buf);
+      buf->resize (chunk.nlines);
+    }
+    std::vector<char> line(lineSize);
+    std::vector<char> first(lineSize);
+    Int lineNr = chunk.firstLine - 1;
+    Int dummy;
+    Int64 pos = chunk.start;
+    while (pos < chunk.end) {
+      const char* beg = data + pos;
+      const char* nl = static_cast<const char*>
+	(memchr (beg, '\n', chunk.end - pos));
+      Int64 len = (nl == 0  ?  data + chunk.end : nl) - beg;
+      pos += len + 1;
+      // ifstream::getline fails for a too long line.
+      if (len >= lineSize) {
+	chunk.stop = True;
+	break;
+      }
+      // Like getLine remove the last character (newline) and
+      // a possible carriage return.
+      Int nch = len + (nl == 0  ?  0 : 1);
+      if (nch > 0) nch--;
+      if (nch > 1  &&  beg[nch-1] == '\r') {
+	nch--;
+      }
+      memcpy (line.data(), beg, nch);
+      line[nch] = '\0';
+      lineNr++;
+      if (lineNr < firstLine) {
+	continue;
+      }
+      if (lastLine > 0  &&  lineNr > lastLine) {
+	chunk.stop = True;
+	break;
+      }
+      if (testComment  &&  commentMarker.find (line.data(), nch, dummy) == 0) {
+	continue;
+      }
+      Int at1 = 0;
+      for (uInt col=0; col<nrcol; col++) {
+	getValue (line.data(), lineSize, first.data(), at1, separator,
+		  typeOfColumn[col], chunk.columns[col]->at(chunk.nrow));
+      }
+      chunk.nrow++;
+    }
+  };
+  // Parse a number of chunks in parallel and add their rows to the table.
+  // Doing it in rounds limits the memory needed for the parsed values.
+  size_t nper = 4 * std::max (ThreadPool::concurrency(), 1u);
+  for (size_t first=0; first<chunks.size(); first+=nper) {
+    size_t nchunk = std::min (nper, chunks.size() - first);
+    ThreadPool::global().parallelFor
+      (nchunk, [&parseChunk, first](size_t i) { parseChunk (first + i); });
+    for (size_t i=first; i<first+nchunk; i++) {
+      RATChunk& chunk = chunks[i];
+      if (chunk.nrow > 0) {
+	rownr_t rownr = tab.nrow();
+	tab.addRow (chunk.nrow);
+	for (uInt col=0; col<nrcol; col++) {
+	  chunk.columns[col]->put (tabcol[col], rownr, chunk.nrow);
+	}
+      }
+      chunk.columns.clear();
+      if (chunk.stop) {
+	return;
+      }
+    }
+  }
+}
+
+
 String ReadAsciiTable::doRun (const String& headerfile, const String& filein, 
 			      const String& tableproto,
 			      const String& tablename,
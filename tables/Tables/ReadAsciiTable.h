@@ -42,6 +42,7 @@ class IPosition;
 class LogIO;
 class TableRecord;
 class TableColumn;
+template<class T> class Block;
 
 
 // <summary>
@@ -434,6 +435,19 @@ private:
 			   const IPosition& shape, Int varAxis,
 			   Int type,
 			   TableColumn& tabcol, rownr_t rownr);
+
+  // Read the data lines of a regular file from the given offset on and
+  // add them to the table. It is used if all columns are scalars.
+  // The file is memory-mapped and split into chunks of lines, which are
+  // parsed in parallel using the global ThreadPool. The lines are handled
+  // in the same way as getLine and handleScalar do.
+  static void readParallel (const String& fileName, Int64 offset,
+			    Int lineNumber, Table& tab,
+			    TableColumn* tabcol,
+			    const Block<Int>& typeOfColumn,
+			    Char separator,
+			    Bool testComment, const Regex& commentMarker,
+			    Int firstLine, Int lastLine);
 };
 
 
@@ -103,6 +103,10 @@ void RefColumn::getArray (rownr_t rownr, ArrayBase& data) const
 void RefColumn::getSlice (rownr_t rownr, const Slicer& ns, ArrayBase& data) const
     { colPtr_p->getSlice (refTabPtr_p->rootRownr(rownr), ns, data); }
 
+void RefColumn::getPackedBool (rownr_t rownr, const IPosition& shape,
+                               uChar* bits) const
+    { colPtr_p->getPackedBool (refTabPtr_p->rootRownr(rownr), shape, bits); }
+
 void RefColumn::put (rownr_t rownr, const void* dataPtr)
     { colPtr_p->put (refTabPtr_p->rootRownr(rownr), dataPtr); }
 
@@ -112,68 +116,78 @@ void RefColumn::putArray (rownr_t rownr, const ArrayBase& data)
 void RefColumn::putSlice (rownr_t rownr, const Slicer& ns, const ArrayBase& data)
     { colPtr_p->putSlice (refTabPtr_p->rootRownr(rownr), ns, data); }
 
+void RefColumn::putPackedBool (rownr_t rownr, const IPosition& shape,
+                               const uChar* bits)
+    { colPtr_p->putPackedBool (refTabPtr_p->rootRownr(rownr), shape, bits); }
+
 void RefColumn::getScalarColumn (ArrayBase& data) const
 {
-    colPtr_p->getScalarColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->getScalarColumnCells (refTabPtr_p->refRows(), data);
 }
 void RefColumn::getArrayColumn (ArrayBase& data) const
 {
-    colPtr_p->getArrayColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->getArrayColumnCells (refTabPtr_p->refRows(), data);
 }
 void RefColumn::getColumnSlice (const Slicer& ns,
 				ArrayBase& data) const
 {
-    colPtr_p->getColumnSliceCells (refTabPtr_p->rowNumbers(), ns, data); 
+    colPtr_p->getColumnSliceCells (refTabPtr_p->refRows(), ns, data); 
 }
 void RefColumn::getScalarColumnCells (const RefRows& rownrs,
 				      ArrayBase& data) const
 {
-    colPtr_p->getScalarColumnCells (rownrs.convert(refTabPtr_p->rowNumbers()),
+    colPtr_p->getScalarColumnCells (refTabPtr_p->convertRefRows(rownrs),
 				    data);
 }
+void RefColumn::getStringCodes (const RefRows& rownrs, uInt* codes,
+                                StringDictionary& dictionary) const
+{
+    colPtr_p->getStringCodes (refTabPtr_p->convertRefRows(rownrs),
+                              codes, dictionary);
+}
 void RefColumn::getArrayColumnCells (const RefRows& rownrs,
 				     ArrayBase& data) const
 {
-    colPtr_p->getArrayColumnCells (rownrs.convert(refTabPtr_p->rowNumbers()),
+    colPtr_p->getArrayColumnCells (refTabPtr_p->convertRefRows(rownrs),
 				   data);
 }
 void RefColumn::getColumnSliceCells (const RefRows& rownrs,
 				     const Slicer& ns,
 				     ArrayBase& data) const
 {
-    colPtr_p->getColumnSliceCells (rownrs.convert(refTabPtr_p->rowNumbers()),
+    colPtr_p->getColumnSliceCells (refTabPtr_p->convertRefRows(rownrs),
 				   ns, data);
 }
 void RefColumn::putScalarColumn (const ArrayBase& data)
 {
-    colPtr_p->putScalarColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->putScalarColumnCells (refTabPtr_p->refRows(), data);
 }
 void RefColumn::putArrayColumn (const ArrayBase& data)
 {
-    colPtr_p->putArrayColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->putArrayColumnCells (refTabPtr_p->refRows(), data);
 }
 void RefColumn::putColumnSlice (const Slicer& ns,
 				const ArrayBase& data)
 {
-    colPtr_p->putColumnSliceCells (refTabPtr_p->rowNumbers(), ns, data); 
+    colPtr_p->putColumnSliceCells (refTabPtr_p->refRows(), ns, data); 
 }
 void RefColumn::putScalarColumnCells (const RefRows& rownrs,
 				      const ArrayBase& data)
 {
-    colPtr_p->putScalarColumnCells (rownrs.convert(refTabPtr_p->rowNumbers()),
+    colPtr_p->putScalarColumnCells (refTabPtr_p->convertRefRows(rownrs),
 				    data);
 }
 void RefColumn::putArrayColumnCells (const RefRows& rownrs,
 				     const ArrayBase& data)
 {
-    colPtr_p->putArrayColumnCells (rownrs.convert(refTabPtr_p->rowNumbers()),
+    colPtr_p->putArrayColumnCells (refTabPtr_p->convertRefRows(rownrs),
 				   data);
 }
 void RefColumn::putColumnSliceCells (const RefRows& rownrs,
 				     const Slicer& ns,
 				     const ArrayBase& data)
 {
-    colPtr_p->putColumnSliceCells (rownrs.convert(refTabPtr_p->rowNumbers()),
+    colPtr_p->putColumnSliceCells (refTabPtr_p->convertRefRows(rownrs),
 				   ns, data);
 }
 
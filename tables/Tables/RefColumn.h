@@ -152,6 +152,10 @@ public:
     // Get a slice of an N-dimensional array in a particular cell.
     virtual void getSlice (rownr_t rownr, const Slicer&, ArrayBase& dataPtr) const;
 
+    // Get a Bool array in a particular cell as packed bits.
+    virtual void getPackedBool (rownr_t rownr, const IPosition& shape,
+                                uChar* bits) const;
+
     // Get the vector of all scalar values in a column.
     virtual void getScalarColumn (ArrayBase& dataPtr) const;
 
@@ -169,6 +173,10 @@ public:
     virtual void getScalarColumnCells (const RefRows& rownrs,
 				       ArrayBase& dataPtr) const;
 
+    // Get some values of a String column as dictionary codes.
+    virtual void getStringCodes (const RefRows& rownrs, uInt* codes,
+                                 StringDictionary& dictionary) const;
+
     // Get the array of some array values in a column.
     // If the column contains n-dim arrays, the resulting array is (n+1)-dim.
     // The arrays in the column have to have the same shape in all cells.
@@ -191,6 +199,10 @@ public:
     // Put a slice of an N-dimensional array in a particular cell.
     virtual void putSlice (rownr_t rownr, const Slicer&, const ArrayBase& dataPtr);
 
+    // Put packed bits into the Bool array in a particular cell.
+    virtual void putPackedBool (rownr_t rownr, const IPosition& shape,
+                                const uChar* bits);
+
     // Put the vector of all scalar values in the column.
     virtual void putScalarColumn (const ArrayBase& dataPtr);
 
@@ -38,6 +38,8 @@
 #include <casacore/casa/OS/Path.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <algorithm>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/BasicSL/STLIO.h>
 
@@ -47,6 +49,7 @@ RefTable::RefTable (AipsIO& ios, const String& name, rownr_t nrrow, int opt,
 		    const TableLock& lockOptions, const TSMOption& tsmOption)
 : BaseTable    (name, opt, nrrow),
   rowStorage_p (0),              // initially empty vector of rownrs
+  compact_p    (False),
   changed_p    (False)
 {
     //# Read the file in.
@@ -65,6 +68,7 @@ RefTable::RefTable (BaseTable* btp, Bool order, rownr_t nrall)
   baseTabPtr_p (btp->root()->shared_from_this()),
   rowOrd_p     (order),
   rowStorage_p (nrall),       // allocate vector of rownrs
+  compact_p    (False),
   changed_p    (True)
 {
     AlwaysAssert (rowStorage_p.contiguousStorage(), AipsError);
@@ -80,6 +84,7 @@ RefTable::RefTable (BaseTable* btp, const Vector<rownr_t>& rownrs)
   baseTabPtr_p (btp->root()->shared_from_this()),
   rowOrd_p     (True),
   rowStorage_p (0),
+  compact_p    (False),
   changed_p    (True)
 {
     //# Copy the table description and create the columns.
@@ -97,6 +102,7 @@ RefTable::RefTable (BaseTable* btp, const Vector<rownr_t>& rownrs)
     }
     //# Adjust rownrs in case input table is a reference table.
     rowOrd_p = btp->adjustRownrs (nrrow_p, rowStorage_p, True);
+    compactRows();
     TableTrace::traceRefTable (baseTabPtr_p->tableName(), 's');
 }
 
@@ -105,6 +111,7 @@ RefTable::RefTable (BaseTable* btp, const Vector<Bool>& mask)
   baseTabPtr_p (btp->root()->shared_from_this()),
   rowOrd_p     (btp->rowOrder()),
   rowStorage_p (0),              // initially empty vector of rownrs
+  compact_p    (False),
   changed_p    (True)
 {
     //# Copy the table description and create the columns.
@@ -119,6 +126,7 @@ RefTable::RefTable (BaseTable* btp, const Vector<Bool>& mask)
     }
     //# Adjust rownrs in case input table is a reference table.
     rowOrd_p = btp->adjustRownrs (nrrow_p, rowStorage_p, True);
+    compactRows();
     TableTrace::traceRefTable (baseTabPtr_p->tableName(), 's');
 }
 
@@ -127,6 +135,7 @@ RefTable::RefTable (BaseTable* btp, const Vector<String>& columnNames)
   baseTabPtr_p (btp->root()->shared_from_this()),
   rowOrd_p     (btp->rowOrder()),
   rowStorage_p (0),
+  compact_p    (False),
   changed_p    (True)
 {
     //# Create table description by copying the selected columns.
@@ -139,9 +148,16 @@ RefTable::RefTable (BaseTable* btp, const Vector<String>& columnNames)
     }
     setup (btp, columnNames);
     //# Get the row numbers from the input table.
-    //# Copy them to this table.
-    rowStorage_p = btp->rowNumbers();
-    AlwaysAssert (rowStorage_p.contiguousStorage(), AipsError);
+    //# Copy them to this table (as runs if the input has runs).
+    const RefTable* rtp = dynamic_cast<const RefTable*>(btp);
+    if (rtp  &&  rtp->compact_p) {
+        compact_p  = True;
+        runRows_p  = rtp->runRows_p;
+        runIndex_p = rtp->runIndex_p;
+    } else {
+        rowStorage_p = btp->rowNumbers();
+        AlwaysAssert (rowStorage_p.contiguousStorage(), AipsError);
+    }
     TableTrace::traceRefTable (baseTabPtr_p->tableName(), 'p');
 }
 
@@ -236,6 +252,11 @@ uInt RefTable::getModifyCounter() const
     return baseTabPtr_p->getModifyCounter();
 }
 
+uInt64 RefTable::getChangeCounter() const
+{
+    return baseTabPtr_p->getChangeCounter();
+}
+
 
 //# Adjust the input rownrs to the actual rownrs in the root table.
 Bool RefTable::adjustRownrs (rownr_t nr, Vector<rownr_t>& rowStorage,
@@ -248,8 +269,14 @@ Bool RefTable::adjustRownrs (rownr_t nr, Vector<rownr_t>& rowStorage,
     const rownr_t* rows = rowStorage_p.data();
     rownr_t* rownrs = rowStorage.data();
     Bool rowOrder = True;
-    for (rownr_t i=0; i<nr; i++) {
-	rownrs[i] = rows[rownrs[i]];
+    if (compact_p) {
+        for (rownr_t i=0; i<nr; i++) {
+            rownrs[i] = compactRownr (rownrs[i]);
+        }
+    } else {
+        for (rownr_t i=0; i<nr; i++) {
+            rownrs[i] = rows[rownrs[i]];
+        }
     }
     if (determineOrder) {
 	for (rownr_t i=1; i<nr; i++) {
@@ -270,11 +297,13 @@ void RefTable::writeRefTable (Bool)
     //# Do this only when something has changed.
     if (changed_p) {
         TableTrace::traceRefTable (baseTabPtr_p->tableName(), 'w');
+        // The file contains all row numbers, also if kept as runs.
+        Vector<rownr_t> rowNrs (rowNumbers());
         // Write old version if all row numbers fit in 32 bits.
         Int version = 3;
         if (nrrow_p < std::numeric_limits<uInt>::max()  &&
             baseTabPtr_p->nrow() < std::numeric_limits<uInt>::max()  &&
-            allLT (rowStorage_p, rownr_t(std::numeric_limits<uInt>::max()))) {
+            allLT (rowNrs, rownr_t(std::numeric_limits<uInt>::max()))) {
           version = 2;
         }
 	AipsIO ios;
@@ -304,7 +333,7 @@ void RefTable::writeRefTable (Bool)
         Vector<uInt> rows32;
         if (version == 2) {
           rows32.resize (nrrow_p);
-          convertArray (rows32, rowStorage_p(Slice(0, nrrow_p)));
+          convertArray (rows32, rowNrs);
         }
         const uInt* rows32p = rows32.data();
         rownr_t done = 0;
@@ -313,7 +342,7 @@ void RefTable::writeRefTable (Bool)
           if (version == 2) {
             ios.put (todo, rows32p+done, False);
           } else {
-            ios.put (todo, rowStorage_p.data()+done, False);
+            ios.put (todo, rowNrs.data()+done, False);
           }
           done += todo;
         }
@@ -376,6 +405,7 @@ void RefTable::getRef (AipsIO& ios, int opt, const TableLock& lockOptions,
       convertArray (rowStorage_p, rows);
     }
     ios.getend();
+    compactRows();
     //# Now read in the root table referenced to.
     //# Check if #rows has not decreased, which is about the only thing
     //# we can do to make sure the referenced rows are still the same.
@@ -396,8 +426,6 @@ void RefTable::getRef (AipsIO& ios, int opt, const TableLock& lockOptions,
     //# Copy the keywords from the root tabledesc.
     tdescPtr_p = std::make_shared<TableDesc>(rootDesc, "", "", TableDesc::Scratch, False);
     makeDesc (*tdescPtr_p, rootDesc, nameMap_p, names);
-    //# Create the refColumns.
-    makeRefCol();
     //# Read the TableInfo object.
     getTableInfo();
     //# Great, everything is done.
@@ -486,20 +514,20 @@ void RefTable::setup (BaseTable* btp, const Vector<String>& columnNames)
                                            tdescPtr_p->columnDesc(i).name()));
 	}
     }
-    makeRefCol();
     //# The initial table info is a copy of the original.
     tableInfo() = btp->tableInfo();
 }
 
-//# Create a RefColumn object for all columns in the description.
+//# Create a RefColumn object for a column in the description.
 //# Insert it with the name in the column map.
-void RefTable::makeRefCol()
+RefColumn* RefTable::makeRefCol (const String& columnName) const
 {
-    for (uInt i=0; i<tdescPtr_p->ncolumn(); i++) {
-	const ColumnDesc& cd = tdescPtr_p->columnDesc(i);
-	colMap_p.insert (std::make_pair(cd.name(), cd.makeRefColumn
-                           (this, baseTabPtr_p->getColumn(nameMap_p.at(cd.name())))));
-    }
+    const ColumnDesc& cd = tdescPtr_p->columnDesc(columnName);
+    RefColumn* col = cd.makeRefColumn
+      (const_cast<RefTable*>(this),
+       baseTabPtr_p->getColumn(nameMap_p.at(columnName)));
+    colMap_p.insert (std::make_pair(columnName, col));
+    return col;
 }
 
 //# Add column to this object for an addColumn.
@@ -524,6 +552,7 @@ void RefTable::addRefCol (const TableDesc& tdesc)
 //# Add a row number of the root table.
 void RefTable::addRownr (rownr_t rnr)
 {
+    expandRows();
     rownr_t nrow = rowStorage_p.nelements();
     if (nrrow_p >= nrow) {
         nrow = max ( nrow + 1024, rownr_t(1.2f * nrow));
@@ -537,6 +566,7 @@ void RefTable::addRownr (rownr_t rnr)
 //# Add a row number range of the root table.
 void RefTable::addRownrRange (rownr_t startRownr, rownr_t endRownr)
 {
+    expandRows();
     rownr_t nrow = rowStorage_p.nelements();
     rownr_t new_nrrow_p = nrrow_p + endRownr - startRownr + 1;
     if (new_nrrow_p > nrow) {
@@ -556,6 +586,7 @@ void RefTable::setNrrow (rownr_t nrrow)
     if (nrrow > nrrow_p) {
 	throw (TableError ("RefTable::setNrrow: exceeds current nrrow"));
     }
+    expandRows();
     AlwaysAssert (rowStorage_p.contiguousStorage(), AipsError);
     nrrow_p = nrrow;
     changed_p = True;
@@ -678,6 +709,12 @@ Record RefTable::dataManagerInfo() const
     return dmi;
 }
 
+Record RefTable::ioStatistics() const
+{
+    // The IO is done on the parent table.
+    return baseTabPtr_p->ioStatistics();
+}
+
 void RefTable::showStructureExtra (ostream& os) const
 {
   os << "out of " << baseTabPtr_p->tableName() << " (" 
@@ -696,7 +733,11 @@ TableRecord& RefTable::rwKeywordSet()
 BaseColumn* RefTable::getColumn (const String& columnName) const
 {
     tdescPtr_p->columnDesc(columnName);             // check if column exists
-    return colMap_p.at(columnName);
+    auto iter = colMap_p.find (columnName);
+    if (iter == colMap_p.end()) {
+        return makeRefCol (columnName);
+    }
+    return iter->second;
 }
 //# We cannot simply return colMap_p.getVal(columnIndex), because the order of
 //# the columns in the description is important. So first get the column
@@ -704,12 +745,15 @@ BaseColumn* RefTable::getColumn (const String& columnName) const
 BaseColumn* RefTable::getColumn (uInt columnIndex) const
 { 
     const String& name = tdescPtr_p->columnDesc(columnIndex).name();
-    return colMap_p.at(name);
+    return getColumn (name);
 }
     
 
 Vector<rownr_t>& RefTable::rowStorage()
-    { return rowStorage_p; }
+{
+    expandRows();
+    return rowStorage_p;
+}
 
 //# Convert a vector of row numbers to row numbers in this table.
 Vector<rownr_t> RefTable::rootRownr (const Vector<rownr_t>& rownrs) const
@@ -717,8 +761,14 @@ Vector<rownr_t> RefTable::rootRownr (const Vector<rownr_t>& rownrs) const
     const rownr_t* rows = rowStorage_p.data();
     rownr_t nrow = rownrs.nelements();
     Vector<rownr_t> rnr(nrow);
-    for (rownr_t i=0; i<nrow; i++) {
-	rnr(i) = rows[rownrs(i)];
+    if (compact_p) {
+        for (rownr_t i=0; i<nrow; i++) {
+            rnr(i) = compactRownr (rownrs(i));
+        }
+    } else {
+        for (rownr_t i=0; i<nrow; i++) {
+            rnr(i) = rows[rownrs(i)];
+        }
     }
     return rnr;
 }
@@ -731,6 +781,15 @@ Bool RefTable::rowOrder() const
 
 Vector<rownr_t> RefTable::rowNumbers() const
 {
+    if (compact_p) {
+        Vector<rownr_t> vec(nrrow_p);
+        rownr_t* rows = vec.data();
+        for (uInt64 i=0; i<runRows_p.size(); ++i) {
+            std::iota (rows + runIndex_p[i], rows + runIndex_p[i+1],
+                       runRows_p[i]);
+        }
+        return vec;
+    }
     if (nrrow_p == rowStorage_p.nelements()) {
 	return rowStorage_p;
     }
@@ -817,6 +876,7 @@ void RefTable::removeRow (rownr_t rownr)
     if (rownr >= nrrow_p) {
 	throw (TableInvOper ("removeRow: rownr out of bounds"));
     }
+    expandRows();
     rownr_t* rows = rowStorage_p.data();
     if (rownr < nrrow_p - 1) {
 	objmove (rows+rownr, rows+rownr+1, nrrow_p-rownr-1);
@@ -827,6 +887,9 @@ void RefTable::removeRow (rownr_t rownr)
 
 void RefTable::removeAllRow ()
 {
+    compact_p = False;
+    runRows_p.resize (0);
+    runIndex_p.resize (0);
     nrrow_p=0;
     changed_p = True;
 }
@@ -838,8 +901,11 @@ void RefTable::removeColumn (const Vector<String>& columnNames)
         const String& name = columnNames(i);
         tdescPtr_p->removeColumn (name);
 	nameMap_p.erase (name);
-	delete colMap_p.at(name);
-	colMap_p.erase (name);
+        auto iter = colMap_p.find (name);
+        if (iter != colMap_p.end()) {
+            delete iter->second;
+            colMap_p.erase (iter);
+        }
     }
     changed_p = True;
 }
@@ -847,9 +913,12 @@ void RefTable::removeColumn (const Vector<String>& columnNames)
 void RefTable::renameColumn (const String& newName, const String& oldName)
 {
     tdescPtr_p->renameColumn (newName, oldName);
-    RefColumn* colval = colMap_p.at(oldName);
-    colMap_p.erase (oldName);
-    colMap_p.insert (std::make_pair(newName, colval));
+    auto iter = colMap_p.find (oldName);
+    if (iter != colMap_p.end()) {
+        RefColumn* colval = iter->second;
+        colMap_p.erase (iter);
+        colMap_p.insert (std::make_pair(newName, colval));
+    }
     const String nmval = nameMap_p.at(oldName);
     nameMap_p.erase (oldName);
     nameMap_p.insert (std::make_pair(newName, nmval));
@@ -909,6 +978,7 @@ void RefTable::refAnd (rownr_t nr1, const rownr_t* inx1,
 	}
     }
     changed_p = True;
+    compactRows();
 }
 
 // Or 2 index arrays, which are both in ascending order.
@@ -948,6 +1018,7 @@ void RefTable::refOr (rownr_t nr1, const rownr_t* inx1,
 	}
     }
     changed_p = True;
+    compactRows();
 }
 
 // Subtract 2 index arrays, which are both in ascending order.
@@ -985,6 +1056,7 @@ void RefTable::refSub (rownr_t nr1, const rownr_t* inx1,
 	}
     }
     changed_p = True;
+    compactRows();
 }
 
 // Xor 2 index arrays, which are both in ascending order.
@@ -1023,6 +1095,7 @@ void RefTable::refXor (rownr_t nr1, const rownr_t* inx1,
 	}
     }
     changed_p = True;
+    compactRows();
 }
 
 // Negate a table.
@@ -1047,6 +1120,204 @@ void RefTable::refNot (rownr_t nr, const rownr_t* inx, rownr_t nrtot)
 	rows[nrrow_p++] = j;
     }
     changed_p = True;
+    compactRows();
+}
+
+
+void RefTable::compactRows()
+{
+    if (compact_p  ||  nrrow_p == 0) {
+        return;
+    }
+    const rownr_t* rows = rowStorage_p.data();
+    // Count the runs; stop if too many.
+    rownr_t maxRuns = nrrow_p / 8;
+    rownr_t nruns = 1;
+    for (rownr_t i=1; i<nrrow_p; ++i) {
+        if (rows[i] != rows[i-1] + 1) {
+            if (++nruns > maxRuns) {
+                return;
+            }
+        }
+    }
+    runRows_p.resize (nruns);
+    runIndex_p.resize (nruns+1);
+    runRows_p[0]  = rows[0];
+    runIndex_p[0] = 0;
+    rownr_t k = 1;
+    for (rownr_t i=1; i<nrrow_p; ++i) {
+        if (rows[i] != rows[i-1] + 1) {
+            runRows_p[k]  = rows[i];
+            runIndex_p[k] = i;
+            ++k;
+        }
+    }
+    runIndex_p[nruns] = nrrow_p;
+    rowStorage_p.resize (0);
+    compact_p = True;
+}
+
+void RefTable::expandRows()
+{
+    if (compact_p) {
+        Vector<rownr_t> rows (rowNumbers());
+        rowStorage_p.reference (rows);
+        runRows_p.resize (0);
+        runIndex_p.resize (0);
+        compact_p = False;
+    }
+}
+
+rownr_t RefTable::compactRownr (rownr_t rownr) const
+{
+    // Find the run containing the row.
+    const rownr_t* end = runIndex_p.data() + runRows_p.size();
+    const rownr_t* inx = std::upper_bound (runIndex_p.data(), end, rownr) - 1;
+    rownr_t run = inx - runIndex_p.data();
+    return runRows_p[run] + (rownr - *inx);
+}
+
+RefRows RefTable::refRows() const
+{
+    if (compact_p) {
+        rownr_t nruns = runRows_p.size();
+        Vector<rownr_t> slices(3*nruns);
+        for (rownr_t i=0; i<nruns; ++i) {
+            slices[3*i]   = runRows_p[i];
+            slices[3*i+1] = runRows_p[i] + runIndex_p[i+1] - runIndex_p[i] - 1;
+            slices[3*i+2] = 1;
+        }
+        return RefRows (slices, True);
+    }
+    return RefRows (rowNumbers());
+}
+
+RefRows RefTable::convertRefRows (const RefRows& rownrs) const
+{
+    if (! compact_p) {
+        return rownrs.convert (rowStorage_p);
+    }
+    // Convert the rows and collapse them to slices again.
+    Vector<rownr_t> rows(rownrs.nrow());
+    rownr_t* rowp = rows.data();
+    RefRowsSliceIter iter(rownrs);
+    while (! iter.pastEnd()) {
+        rownr_t rownr = iter.sliceStart();
+        rownr_t end   = iter.sliceEnd();
+        rownr_t incr  = iter.sliceIncr();
+        while (rownr <= end) {
+            *rowp++ = compactRownr (rownr);
+            rownr += incr;
+        }
+        iter++;
+    }
+    return RefRows (rows, False, True);
+}
+
+void RefTable::getIntervals (Vector<rownr_t>& starts,
+                             Vector<rownr_t>& ends) const
+{
+    rownr_t nruns = runRows_p.size();
+    starts.resize (nruns);
+    ends.resize (nruns);
+    for (rownr_t i=0; i<nruns; ++i) {
+        starts[i] = runRows_p[i];
+        ends[i]   = runRows_p[i] + runIndex_p[i+1] - runIndex_p[i];
+    }
+}
+
+void RefTable::setIntervals (const std::vector<rownr_t>& starts,
+                             const std::vector<rownr_t>& ends)
+{
+    rownr_t nruns = starts.size();
+    runRows_p.resize (nruns);
+    runIndex_p.resize (nruns+1);
+    rownr_t nrow = 0;
+    for (rownr_t i=0; i<nruns; ++i) {
+        runRows_p[i]  = starts[i];
+        runIndex_p[i] = nrow;
+        nrow += ends[i] - starts[i];
+    }
+    runIndex_p[nruns] = nrow;
+    rowStorage_p.resize (0);
+    nrrow_p   = nrow;
+    compact_p = True;
+    changed_p = True;
+    // Use the row number vector if there are too many runs.
+    if (nruns > nrow / 8) {
+        expandRows();
+    }
+}
+
+Bool RefTable::getRunIntervals (const BaseTable* tab, Vector<rownr_t>& starts,
+                                Vector<rownr_t>& ends)
+{
+    const RefTable* rtp = dynamic_cast<const RefTable*>(tab);
+    if (rtp) {
+        if (!rtp->compact_p  ||  !rtp->rowOrd_p) {
+            return False;
+        }
+        rtp->getIntervals (starts, ends);
+    } else {
+        // A root table is a single interval.
+        if (tab != const_cast<BaseTable*>(tab)->root()) {
+            return False;
+        }
+        rownr_t nr = tab->nrow();
+        starts.resize (nr > 0 ? 1 : 0);
+        ends.resize (nr > 0 ? 1 : 0);
+        if (nr > 0) {
+            starts[0] = 0;
+            ends[0]   = nr;
+        }
+    }
+    return True;
+}
+
+Bool RefTable::refRuns (RunsOp op, const BaseTable* t1, const BaseTable* t2)
+{
+    Vector<rownr_t> st1, end1, st2, end2;
+    if (!getRunIntervals (t1, st1, end1)  ||
+        !getRunIntervals (t2, st2, end2)) {
+        return False;
+    }
+    // Sweep through the interval boundaries of both tables.
+    std::vector<rownr_t> starts, ends;
+    rownr_t n1 = st1.size();
+    rownr_t n2 = st2.size();
+    rownr_t i1 = 0;
+    rownr_t i2 = 0;
+    rownr_t pos = 0;
+    const rownr_t last = std::numeric_limits<rownr_t>::max();
+    while (i1 < n1  ||  i2 < n2) {
+        // Determine if pos is in the current interval of each table and
+        // where that state changes.
+        Bool in1 = (i1 < n1  &&  pos >= st1[i1]);
+        Bool in2 = (i2 < n2  &&  pos >= st2[i2]);
+        rownr_t next1 = (i1 < n1  ?  (in1 ? end1[i1] : st1[i1]) : last);
+        rownr_t next2 = (i2 < n2  ?  (in2 ? end2[i2] : st2[i2]) : last);
+        rownr_t next = std::min (next1, next2);
+        Bool sel = False;
+        switch (op) {
+        case RunsAnd: sel = in1 && in2;  break;
+        case RunsOr:  sel = in1 || in2;  break;
+        case RunsSub: sel = in1 && !in2; break;
+        case RunsXor: sel = in1 != in2;  break;
+        }
+        if (sel  &&  next > pos) {
+            if (!ends.empty()  &&  ends.back() == pos) {
+                ends.back() = next;
+            } else {
+                starts.push_back (pos);
+                ends.push_back (next);
+            }
+        }
+        pos = next;
+        if (i1 < n1  &&  pos == end1[i1]) ++i1;
+        if (i2 < n2  &&  pos == end2[i2]) ++i2;
+    }
+    setIntervals (starts, ends);
+    return True;
 }
 
 } //# NAMESPACE CASACORE - END
@@ -39,6 +39,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Forward Declarations
 class TSMOption;
 class RefColumn;
+class RefRows;
 class AipsIO;
 
 
@@ -82,6 +83,16 @@ class AipsIO;
 // (like a join or a concatenation of similar tables), this cannot be
 // used anymore. Most software already anticipates on that. The only
 // exception is the code anding, oring tables (refAnd, etc.).
+// <p>
+// Selections often consist of long runs of consecutive rows. In that case
+// the row numbers are kept compactly as runs (the first row and the
+// index of each run) instead of a row number per row. It is done after a
+// selection or logical operation if the runs take at most a quarter of
+// the memory of the row number vector. Logical operations on tables in
+// row order kept as runs are done on the runs. Whole-column access through
+// RefColumn passes the runs as slices to the data managers, which can
+// access them as ranges. The row number vector is only made again when
+// asked for it (e.g. by a sort or iteration) or when rows are removed.
 // </synopsis> 
 
 // <todo asof="$DATE:$">
@@ -204,6 +215,9 @@ public:
     // Get the modify counter.
     virtual uInt getModifyCounter() const;
 
+    // Get the change counter of the parent table.
+    virtual uInt64 getChangeCounter() const;
+
     // Test if the parent table is opened as writable.
     virtual Bool isWritable() const;
 
@@ -233,6 +247,9 @@ public:
     // Get the data manager info.
     virtual Record dataManagerInfo() const;
 
+    // Get the IO statistics of the columns and data managers.
+    virtual Record ioStatistics() const;
+
     // Get readonly access to the table keyword set.
     virtual TableRecord& keywordSet();
 
@@ -295,6 +312,23 @@ public:
     // Get a vector of row numbers.
     virtual Vector<rownr_t> rowNumbers() const;
 
+    // Get the row numbers in the root table as a RefRows object.
+    // It contains slices if the row numbers are kept as runs.
+    RefRows refRows() const;
+
+    // Convert the given row numbers in this table to row numbers in the
+    // root table. The result contains slices if the row numbers are kept
+    // as runs.
+    RefRows convertRefRows (const RefRows& rownrs) const;
+
+    // Are the row numbers kept as runs of consecutive rows?
+    Bool isCompact() const
+        { return compact_p; }
+
+    // Keep the row numbers as runs if that takes at most a quarter
+    // of the memory of the row number vector.
+    void compactRows();
+
     // Get parent of this table.
     virtual BaseTable* root();
 
@@ -335,12 +369,26 @@ void addRownrRange (rownr_t startRownr, rownr_t endRownr);
     void refXor (rownr_t nr1, const rownr_t* rows1, rownr_t nr2, const rownr_t* rows2);
     void refNot (rownr_t nr1, const rownr_t* rows1, rownr_t nrmain);
 
+    // Logical operations on the runs of tables kept as runs.
+    enum RunsOp {RunsAnd, RunsOr, RunsSub, RunsXor};
+
+    // Do the logical operation on the runs of the given tables and store
+    // the result in this table. It is only done if each table is a root
+    // table or a RefTable in row order kept as runs.
+    // It returns False if not done.
+    Bool refRuns (RunsOp op, const BaseTable* t1, const BaseTable* t2);
+
 private:
     std::shared_ptr<BaseTable> baseTabPtr_p;//# pointer to parent table
     Bool            rowOrd_p;               //# True = table is in row order
     Vector<rownr_t> rowStorage_p;           //# row numbers in parent table
+    Bool            compact_p;              //# True = row numbers in runs
+    Vector<rownr_t> runRows_p;              //# first root row of each run
+    Vector<rownr_t> runIndex_p;             //# first index of each run
+                                            //# (last element is nrrow)
     std::map<String,String> nameMap_p;      //# map to column name in parent
-    std::map<String,RefColumn*> colMap_p;   //# map name to column
+    //# The RefColumn objects are created when first needed.
+    mutable std::map<String,RefColumn*> colMap_p;   //# map name to column
     Bool            changed_p;              //# True = changed since last write
 
     // Get the names of the tables this table consists of.
@@ -360,12 +408,15 @@ private:
     // If the BaseTable is a RefTable, use its name map.
     // Otherwise create the initial name map from the table description.
     // A rename might change the map.
-    // <br>Create the RefColumn objects.
     // <br>Create the initial TableInfo as a copy of the original BaseTable.
     void setup (BaseTable* btp, const Vector<String>& columnNames);
 
-    // Create the RefColumn objects for all columns in the description.
-    void makeRefCol();
+    // Create the RefColumn object for the given column in the description
+    // and insert it into the column map.
+    // It is done when the column is accessed for the first time, so
+    // the underlying columns (and their data managers) are only accessed
+    // when needed.
+    RefColumn* makeRefCol (const String& columnName) const;
 
     // Write a reference table.
     void writeRefTable (Bool fsync);
@@ -381,12 +432,32 @@ private:
     void addRefCol (const ColumnDesc& cd);
     // Add multiple columns.
     void addRefCol (const TableDesc& tdesc);
+
+    // Make the row number vector again if kept as runs.
+    void expandRows();
+
+    // Get the root row number for the given row if kept as runs.
+    rownr_t compactRownr (rownr_t rownr) const;
+
+    // Get the runs as half-open intervals [start,end) of root rows.
+    void getIntervals (Vector<rownr_t>& starts, Vector<rownr_t>& ends) const;
+
+    // Get the runs of a root table or a RefTable as intervals.
+    // It returns False if the table is not a root table, or not in
+    // row order, or not kept as runs.
+    static Bool getRunIntervals (const BaseTable* tab,
+                                 Vector<rownr_t>& starts,
+                                 Vector<rownr_t>& ends);
+
+    // Set the row numbers from half-open intervals of root rows.
+    void setIntervals (const std::vector<rownr_t>& starts,
+                       const std::vector<rownr_t>& ends);
 };
 
 
 
 inline rownr_t RefTable::rootRownr (rownr_t rnr) const
-    { return rowStorage_p[rnr]; }
+    { return compact_p ? compactRownr(rnr) : rowStorage_p[rnr]; }
 
 
 
@@ -121,6 +121,11 @@ public:
     virtual void getScalarColumnCells (const RefRows& rownrs,
                                        ArrayBase& dataPtr) const;
 
+    // Get some values of a String column as dictionary codes.
+    // It is passed to the data manager column.
+    virtual void getStringCodes (const RefRows& rownrs, uInt* codes,
+                                 StringDictionary& dictionary) const;
+
     // Put the value in a particular cell.
     // The length of the buffer pointed to by dataPtr must match
     // the actual length. This is checked by ScalarColumn.
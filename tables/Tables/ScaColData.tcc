@@ -100,6 +100,8 @@ void ScalarColumnData<T>::get (rownr_t rownr, void* val) const
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr);
     }
+    ColumnIOStats::Timer timer (iostats_p, False, 1,
+                                sizeof(T));
     checkReadLock (True);
     dataColPtr_p->get (rownr, static_cast<T*>(val));
     autoReleaseLock();
@@ -115,6 +117,8 @@ void ScalarColumnData<T>::getScalarColumn (ArrayBase& val) const
     if (val.ndim() != 1  ||  val.nelements() != nrow()) {
 	throw (TableArrayConformanceError("ScalarColumnData::getScalarColumn"));
     }
+    ColumnIOStats::Timer timer (iostats_p, False, val.nelements(),
+                                val.nelements() * sizeof(T));
     checkReadLock (True);
     dataColPtr_p->getScalarColumnV (val);
     autoReleaseLock();
@@ -130,11 +134,27 @@ void ScalarColumnData<T>::getScalarColumnCells (const RefRows& rownrs,
     if (val.ndim() != 1  ||  val.nelements() != rownrs.nrow()) {
 	throw (TableArrayConformanceError("ScalarColumnData::getScalarColumnCells"));
     }
+    ColumnIOStats::Timer timer (iostats_p, False, val.nelements(),
+                                val.nelements() * sizeof(T));
     checkReadLock (True);
     dataColPtr_p->getScalarColumnCellsV (rownrs, val);
     autoReleaseLock();
 }
 
+template<class T>
+void ScalarColumnData<T>::getStringCodes (const RefRows& rownrs, uInt* codes,
+                                          StringDictionary& dictionary) const
+{
+    if (rtraceColumn_p) {
+      TableTrace::trace (traceId(), columnDesc().name(), 'r', rownrs);
+    }
+    ColumnIOStats::Timer timer (iostats_p, False, rownrs.nrow(),
+                                rownrs.nrow() * sizeof(uInt));
+    checkReadLock (True);
+    dataColPtr_p->getStringCodesV (rownrs, codes, dictionary);
+    autoReleaseLock();
+}
+
 
 template<class T>
 void ScalarColumnData<T>::put (rownr_t rownr, const void* val)
@@ -143,6 +163,8 @@ void ScalarColumnData<T>::put (rownr_t rownr, const void* val)
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownr);
     }
     checkValueLength (static_cast<const T*>(val));
+    ColumnIOStats::Timer timer (iostats_p, True, 1,
+                                sizeof(T));
     checkWriteLock (True);
     dataColPtr_p->put (rownr, static_cast<const T*>(val));
     autoReleaseLock();
@@ -158,6 +180,8 @@ void ScalarColumnData<T>::putScalarColumn (const ArrayBase& val)
 	throw (TableArrayConformanceError("ScalarColumnData::putColumn"));
     }
     checkValueLength (static_cast<const Array<T>*>(&val));
+    ColumnIOStats::Timer timer (iostats_p, True, val.nelements(),
+                                val.nelements() * sizeof(T));
     checkWriteLock (True);
     dataColPtr_p->putScalarColumnV (val);
     autoReleaseLock();
@@ -174,6 +198,8 @@ void ScalarColumnData<T>::putScalarColumnCells (const RefRows& rownrs,
 	throw (TableArrayConformanceError("ScalarColumnData::putColumn"));
     }
     checkValueLength (static_cast<const Array<T>*>(&val));
+    ColumnIOStats::Timer timer (iostats_p, True, val.nelements(),
+                                val.nelements() * sizeof(T));
     checkWriteLock (True);
     dataColPtr_p->putScalarColumnCellsV (rownrs, val);
     autoReleaseLock();
@@ -32,6 +32,7 @@
 #include <casacore/casa/Arrays/ArrayFwd.h>
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/tables/Tables/ColumnCache.h>
+#include <future>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -135,7 +136,7 @@ public:
     void get (rownr_t rownr, T& value) const
     {
 	TABLECOLUMNCHECKROW(rownr);
-	Int off = colCachePtr_p->offset(rownr);
+	Int64 off = colCachePtr_p->offset(rownr);
 	if (off >= 0) {
 	    value = ((T*)(colCachePtr_p->dataPtr()))[off];
 	}else{
@@ -191,6 +192,21 @@ public:
     // Get the vector of some values in the column.
     Vector<T> getColumnCells (const RefRows& rownrs) const;
 
+    // Get data asynchronously. The functions are the same as their
+    // synchronous counterparts, but return at once with a future
+    // that gives the data (or the exception) when the read is done.
+    // The reads are executed in order by the global
+    // <linkto class="TableIOQueue">TableIOQueue</linkto>.
+    // The table is kept alive until the read is done. While reads are
+    // outstanding, the table must not be accessed otherwise
+    // (see TableIOQueue).
+    // <group>
+    std::future<T> getAsync (rownr_t rownr) const;
+    std::future<Vector<T>> getColumnAsync() const;
+    std::future<Vector<T>> getColumnRangeAsync (const Slicer& rowRange) const;
+    std::future<Vector<T>> getColumnCellsAsync (const RefRows& rownrs) const;
+    // </group>
+
     // Put the value in a particular cell (i.e. table row).
     // The row numbers count from 0 until #rows-1.
     void put (rownr_t rownr, const T& value)
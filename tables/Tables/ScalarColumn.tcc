@@ -30,6 +30,7 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/BaseColumn.h>
 #include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/Tables/TableIOQueue.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Utilities/ValTypeId.h>
@@ -165,6 +166,46 @@ Vector<T> ScalarColumn<T>::getColumnCells (const RefRows& rownrs) const
     return vec;
 }
 
+// The requests hold a copy of the column and the Table object, so the
+// table stays alive until the request is done.
+template<class T>
+std::future<T> ScalarColumn<T>::getAsync (rownr_t rownr) const
+{
+    ScalarColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab, rownr]() { return col.get (rownr); });
+}
+
+template<class T>
+std::future<Vector<T>> ScalarColumn<T>::getColumnAsync() const
+{
+    ScalarColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab]() { return col.getColumn(); });
+}
+
+template<class T>
+std::future<Vector<T>> ScalarColumn<T>::getColumnRangeAsync
+                                  (const Slicer& rowRange) const
+{
+    ScalarColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab, rowRange]() { return col.getColumnRange (rowRange); });
+}
+
+template<class T>
+std::future<Vector<T>> ScalarColumn<T>::getColumnCellsAsync
+                                  (const RefRows& rownrs) const
+{
+    ScalarColumn<T> col(*this);
+    Table tab(countedTable());
+    return TableIOQueue::global().submit
+      ([col, tab, rownrs]() { return col.getColumnCells (rownrs); });
+}
+
 template<class T>
 void ScalarColumn<T>::getColumnCells (const RefRows& rownrs,
                                       Vector<T>& vec, Bool resize) const
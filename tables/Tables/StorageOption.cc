@@ -33,7 +33,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     : itsOption     (option),
       itsBlockSize  (blockSize),
       itsUseODirect (useODirect>0),
-      itsUseAipsrcODirect (useODirect<0)
+      itsUseAipsrcODirect (useODirect<0),
+      itsNrStripe   (-2),
+      itsAsyncIO    (False),
+      itsUseAipsrcAsyncIO (True)
   {}
 
   void StorageOption::fillOption()
@@ -64,6 +67,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (itsUseAipsrcODirect) {
       AipsrcValue<Bool>::find (itsUseODirect, "table.storage.odirect", False);
     }
+    // Default is no striping and synchronous I/O.
+    if (itsNrStripe < 0) {
+      AipsrcValue<Int>::find (itsNrStripe, "table.storage.nstripe", 1);
+    }
+    if (itsNrStripe <= 0) {
+      itsNrStripe = 1;
+    }
+    if (itsUseAipsrcAsyncIO) {
+      AipsrcValue<Bool>::find (itsAsyncIO, "table.storage.asyncio", False);
+    }
     // Default is to use separate files.
     if (itsOption == StorageOption::Default) {
       itsOption = StorageOption::SepFile;
@@ -76,4 +89,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsUseAipsrcODirect = False;
   }
 
+  void StorageOption::setAsyncIO (Bool asyncIO)
+  {
+    itsAsyncIO = asyncIO;
+    itsUseAipsrcAsyncIO = False;
+  }
+
 } //# NAMESPACE CASACORE - END
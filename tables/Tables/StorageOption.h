@@ -67,7 +67,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //       O_DIRECT option has to be used to let the kernel bypass its filecache
 //       for more predictable I/O behaviour. It's only used for MultiFile and
 //       only if the OS supports O_DIRECT.
+// <li> <src>table.storage.nstripe</src> gives the number of files the
+//       blocks of a MultiFile are striped over (default 1).
+// <li> <src>table.storage.asyncio</src> can be true or false. It tells if
+//       MultiFile should write and read ahead data blocks asynchronously.
 // </ul>
+// See class MultiFile for more information on striping and asynchronous I/O.
 // </synopsis>
 
 
@@ -125,11 +130,30 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // It is only set if the OS supports O_DIRECT.
     void setUseODirect (Bool useODirect);
 
+    // Get the number of files a MultiFile is striped over.
+    // It is only used when creating a MultiFile.
+    uInt nStripe() const
+      { return itsNrStripe > 0 ? itsNrStripe : 1; }
+
+    // Set the number of files a MultiFile is striped over.
+    void setNStripe (uInt nstripe)
+      { itsNrStripe = nstripe; }
+
+    // Get the asynchronous I/O option.
+    Bool asyncIO() const
+      { return itsAsyncIO; }
+
+    // Set the asynchronous I/O option.
+    void setAsyncIO (Bool asyncIO);
+
   private:
     Option itsOption;
     Int    itsBlockSize;
     Bool   itsUseODirect;
     Bool   itsUseAipsrcODirect;
+    Int    itsNrStripe;
+    Bool   itsAsyncIO;
+    Bool   itsUseAipsrcAsyncIO;
   };
 
 } //# NAMESPACE CASACORE - END
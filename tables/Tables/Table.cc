@@ -36,6 +36,10 @@
 #include <casacore/tables/Tables/TableLock.h>
 #include <casacore/tables/Tables/TableUtil.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/Tables/ArrayColumnBase.h>
+#include <casacore/tables/Tables/BaseColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/Tables/ColumnIOStats.h>
 #include <casacore/tables/DataMan/StManColumnBase.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/casa/Arrays/Vector.h>
@@ -596,6 +600,94 @@ void Table::removeColumn (const String& columnName)
     baseTabPtr_p->removeColumn (Vector<String>(1, columnName));
 }
 
+rownr_t Table::appendRows (rownr_t nrrow, const RecordInterface& values,
+                           Bool initialize)
+{
+    const TableDesc& tdesc = tableDesc();
+    // Check all fields before adding any row.
+    for (uInt i=0; i<values.nfields(); ++i) {
+        const String& name = values.name(i);
+        if (! tdesc.isColumn (name)) {
+            throw TableError ("Table::appendRows: field " + name +
+                              " is not a column in table " + tableName());
+        }
+        const ColumnDesc& cdesc = tdesc.columnDesc (name);
+        if (values.dataType(i) != asArray (cdesc.dataType())) {
+            throw TableError ("Table::appendRows: field " + name +
+                              " has a data type mismatching the column");
+        }
+        IPosition shp = values.shape(i);
+        if (shp.empty()  ||  rownr_t(shp.last()) != nrrow  ||
+            (cdesc.isScalar()  &&  shp.size() != 1)) {
+            throw TableError ("Table::appendRows: field " + name +
+                              " has shape " + String(shp.toString()) +
+                              "; its last axis should have length " +
+                              String(String::toString(nrrow)));
+        }
+        if ((cdesc.options() & ColumnDesc::FixedShape) != 0  &&
+            ! shp.getFirst(shp.size() - 1).isEqual (cdesc.shape())) {
+            throw TableError ("Table::appendRows: field " + name +
+                              " has shape " + String(shp.toString()) +
+                              "; mismatches the fixed column shape");
+        }
+    }
+    rownr_t firstRow = nrow();
+    if (nrrow == 0) {
+        return firstRow;
+    }
+    addRow (nrrow, initialize);
+    RefRows rows (firstRow, firstRow + nrrow - 1);
+    for (uInt i=0; i<values.nfields(); ++i) {
+        const String& name = values.name(i);
+        const ArrayBase& arr = appendRowsArray (values, i,
+                                   tdesc.columnDesc(name).dataType());
+        if (tdesc.columnDesc(name).isScalar()) {
+            TableColumn col(*this, name);
+            col.checkWritable();
+            baseTabPtr_p->getColumn(name)->putScalarColumnCells (rows, arr);
+        } else {
+            ArrayColumnBase col(*this, name);
+            col.acbPutColumnCells (rows, arr);
+        }
+    }
+    return firstRow;
+}
+
+const ArrayBase& Table::appendRowsArray (const RecordInterface& values,
+                                         Int field, DataType dtype)
+{
+    void* ptr = values.get_pointer (field, asArray(dtype));
+    switch (dtype) {
+    case TpBool:
+        return *static_cast<const Array<Bool>*>(ptr);
+    case TpUChar:
+        return *static_cast<const Array<uChar>*>(ptr);
+    case TpShort:
+        return *static_cast<const Array<Short>*>(ptr);
+    case TpUShort:
+        return *static_cast<const Array<uShort>*>(ptr);
+    case TpInt:
+        return *static_cast<const Array<Int>*>(ptr);
+    case TpUInt:
+        return *static_cast<const Array<uInt>*>(ptr);
+    case TpInt64:
+        return *static_cast<const Array<Int64>*>(ptr);
+    case TpFloat:
+        return *static_cast<const Array<Float>*>(ptr);
+    case TpDouble:
+        return *static_cast<const Array<Double>*>(ptr);
+    case TpComplex:
+        return *static_cast<const Array<Complex>*>(ptr);
+    case TpDComplex:
+        return *static_cast<const Array<DComplex>*>(ptr);
+    case TpString:
+        return *static_cast<const Array<String>*>(ptr);
+    default:
+        throw TableError ("Table::appendRows: unsupported data type for "
+                          "field " + values.name(field));
+    }
+}
+
 RowNumbers Table::rowNumbers () const
     { return baseTabPtr_p->rowNumbers(); }
 
@@ -878,6 +970,16 @@ Record Table::dataManagerInfo() const
     return baseTabPtr_p->dataManagerInfo();
 }
 
+Record Table::ioStatistics() const
+{
+    return baseTabPtr_p->ioStatistics();
+}
+
+void Table::setIOStatistics (Bool enable)
+{
+    ColumnIOStats::setEnabled (enable);
+}
+
 //# Make the table file name.
 String Table::fileName (const String& tableName)
 {
@@ -51,6 +51,8 @@ class TableDesc;
 class ColumnDesc;
 class TableRecord;
 class Record;
+class RecordInterface;
+class ArrayBase;
 class TableExprNode;
 class DataManager;
 class IPosition;
@@ -162,9 +164,12 @@ friend class MemoryTable;
 friend class RefTable;
 friend class ConcatTable;
 friend class TableIterator;
+friend class TableKeyword;
 friend class RODataManAccessor;
 friend class TableExprNode;
 friend class TableExprNodeRep;
+friend class ColumnsIndex;
+friend class TableParseJoin;
 
 public:
     // Define the possible options how a table can be opened.
@@ -454,6 +459,15 @@ public:
     // (or is being changed) since the last time this function was called.
     Bool hasDataChanged();
 
+    // Get the modify counter kept in the lock file of the table, which
+    // changes each time data are written to the table by any process.
+    // It is only up to date while the table is locked.
+    uInt modifyCounter() const;
+
+    // Get the change counter of the table, which changes each time data
+    // are written to the table by this process (even if not locked).
+    uInt64 changeCounter() const;
+
     // Flush the table, i.e. write out the buffers. If <src>sync=True</src>,
     // it is ensured that all data are physically written to disk.
     // Nothing will be done if the table is not writable.
@@ -466,6 +480,12 @@ public:
     // <br>If <src>fsync=True</src> the file contents are fsync-ed to disk,
     // thus ensured that the system buffers are actually written to disk.
     // <br>If <src>recursive=True</src> all subtables are flushed too.
+    // The tables are then written in parallel and all their files are
+    // synced in one batch (a group commit), which is much faster than
+    // flushing a table with many subtables (like a MeasurementSet) one
+    // by one. The aipsrc variable <src>system.fsync.syncfs</src> can be
+    // set to sync the entire file system at once using syncfs (see
+    // <linkto class=FileSync>FileSync</linkto>).
     void flush (Bool fsync=False, Bool recursive=False);
 
     // Resynchronize the Table object with the table file.
@@ -597,6 +617,19 @@ public:
     // Data managers may return some additional fields (e.g. BUCKETSIZE).
     Record dataManagerInfo() const;
 
+    // Get the IO statistics of the columns and data managers.
+    // The record contains subrecord COLUMNS with the statistics per column
+    // and subrecord DATAMANAGERS with the cache statistics per data manager.
+    // For a reference table they are the statistics of its parent table.
+    // Collecting column statistics has to be enabled using
+    // <src>setIOStatistics</src>; see class
+    // <linkto class=ColumnIOStats>ColumnIOStats</linkto> for more details.
+    Record ioStatistics() const;
+
+    // Enable or disable collecting the IO statistics of all columns
+    // of all tables in this process.
+    static void setIOStatistics (Bool enable);
+
     // Get the table name.
     const String& tableName() const;
 
@@ -709,6 +742,22 @@ public:
     // values as defined in the column descriptions.
     void addRow (rownr_t nrrow = 1, Bool initialize = False);
 
+    // Add <src>nrrow</src> rows at the end of the table and fill them with
+    // the values in the record. It returns the number of the first new row.
+    // <br>Each field in the record must have the name of a column and
+    // contain an array with the data type of the column. For a scalar
+    // column it is a vector with one value per new row. For an array column
+    // the last axis gives the row, so for a fixed shape column the array
+    // has the cell shape with <src>nrrow</src> appended.
+    // Columns not in the record are initialized as done by addRow.
+    // <br>All fields are checked before the rows are added. The rows are
+    // added in a single step, so each data manager has to extend its
+    // storage only once, and each column is written with a single put.
+    // This is much faster than adding and filling rows one by one.
+    // <br>An exception is thrown if a field does not match its column.
+    rownr_t appendRows (rownr_t nrrow, const RecordInterface& values,
+                        Bool initialize = False);
+
     // Test if it is possible to remove a row from this table.
     // It is possible if all storage managers used for the table
     // support it.
@@ -1094,6 +1143,10 @@ private:
     // Sort the columns if needed.
     void showColumnInfo (ostream& os, const TableDesc&, uInt maxNameLength,
                          const Array<String>& columnNames, Bool sort) const;
+
+    // Get the array in a record field used by appendRows.
+    static const ArrayBase& appendRowsArray (const RecordInterface& values,
+                                             Int field, DataType dtype);
 };
 
 
@@ -1175,6 +1228,10 @@ inline Bool Table::isMarkedForDelete() const
 
 inline rownr_t Table::nrow() const
     { return baseTabPtr_p->nrow(); }
+inline uInt Table::modifyCounter() const
+    { return baseTabPtr_p->getModifyCounter(); }
+inline uInt64 Table::changeCounter() const
+    { return baseTabPtr_p->getChangeCounter(); }
 inline BaseTable* Table::baseTablePtr() const
     { return baseTabPtr_p; }
 inline const TableDesc& Table::tableDesc() const
@@ -0,0 +1,712 @@
+//# TableArrow.cc: Exchange table columns via the Arrow C data interface
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/Tables/TableArrow.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/OS/Conversion.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+
+  // Data owned by an exported schema.
+  struct SchemaData
+  {
+    std::string format;
+    std::string name;
+    std::string metadata;
+    std::vector<ArrowSchema*> children;
+  };
+
+  // Data owned by an exported array.
+  // The owners keep the casacore data alive the buffers point to.
+  struct ArrayData
+  {
+    std::vector<std::shared_ptr<void>> owners;
+    std::vector<const void*> buffers;
+    std::vector<ArrowArray*> children;
+  };
+
+  // Used as data buffer of empty arrays (buffers cannot be null).
+  const Int64 emptyBuffer = 0;
+
+  void releaseSchema (ArrowSchema* schema)
+  {
+    if (schema->release) {
+      SchemaData* data = static_cast<SchemaData*>(schema->private_data);
+      // A child may have been moved by the consumer, thus released already.
+      for (ArrowSchema* child : data->children) {
+        if (child->release) {
+          child->release (child);
+        }
+        delete child;
+      }
+      delete data;
+      schema->release = nullptr;
+    }
+  }
+
+  void releaseArray (ArrowArray* array)
+  {
+    if (array->release) {
+      ArrayData* data = static_cast<ArrayData*>(array->private_data);
+      for (ArrowArray* child : data->children) {
+        if (child->release) {
+          child->release (child);
+        }
+        delete child;
+      }
+      delete data;
+      array->release = nullptr;
+    }
+  }
+
+  void makeSchema (ArrowSchema* schema, const std::string& format,
+                   const std::string& name,
+                   const std::vector<ArrowSchema*>& children
+                     = std::vector<ArrowSchema*>(),
+                   const std::string& metadata = std::string())
+  {
+    SchemaData* data = new SchemaData;
+    data->format   = format;
+    data->name     = name;
+    data->metadata = metadata;
+    data->children = children;
+    schema->format       = data->format.c_str();
+    schema->name         = data->name.c_str();
+    schema->metadata     = (metadata.empty() ? nullptr :
+                            data->metadata.data());
+    schema->flags        = 0;
+    schema->n_children   = children.size();
+    schema->children     = data->children.data();
+    schema->dictionary   = nullptr;
+    schema->release      = &releaseSchema;
+    schema->private_data = data;
+  }
+
+  void makeArray (ArrowArray* array, size_t length,
+                  const std::vector<const void*>& buffers,
+                  const std::vector<ArrowArray*>& children
+                    = std::vector<ArrowArray*>(),
+                  const std::shared_ptr<void>& owner = std::shared_ptr<void>())
+  {
+    ArrayData* data = new ArrayData;
+    if (owner) {
+      data->owners.push_back (owner);
+    }
+    data->buffers  = buffers;
+    data->children = children;
+    for (const void*& buf : data->buffers) {
+      // Only the validity bitmap can be null.
+      if (!buf  &&  &buf != &data->buffers[0]) {
+        buf = &emptyBuffer;
+      }
+    }
+    array->length       = length;
+    array->null_count   = 0;
+    array->offset       = 0;
+    array->n_buffers    = data->buffers.size();
+    array->n_children   = children.size();
+    array->buffers      = data->buffers.data();
+    array->children     = data->children.data();
+    array->dictionary   = nullptr;
+    array->release      = &releaseArray;
+    array->private_data = data;
+  }
+
+  // Get the Arrow format of a primitive data type.
+  const char* arrowFormat (const uChar*)  { return "C"; }
+  const char* arrowFormat (const Short*)  { return "s"; }
+  const char* arrowFormat (const uShort*) { return "S"; }
+  const char* arrowFormat (const Int*)    { return "i"; }
+  const char* arrowFormat (const uInt*)   { return "I"; }
+  const char* arrowFormat (const Int64*)  { return "l"; }
+  const char* arrowFormat (const Float*)  { return "f"; }
+  const char* arrowFormat (const Double*) { return "g"; }
+
+  // Export the values of a contiguous array as a flat Arrow array.
+  // <group>
+  template<typename T>
+  void exportValues (const Array<T>& values, const std::string& name,
+                     ArrowSchema* schema, ArrowArray* array)
+  {
+    std::shared_ptr<Array<T>> owner (new Array<T>(values));
+    if (! owner->contiguousStorage()) {
+      *owner = values.copy();
+    }
+    makeSchema (schema, arrowFormat(owner->data()), name);
+    makeArray (array, owner->nelements(), {nullptr, owner->data()},
+               std::vector<ArrowArray*>(), owner);
+  }
+
+  void exportValues (const Array<Bool>& values, const std::string& name,
+                     ArrowSchema* schema, ArrowArray* array)
+  {
+    // Arrow uses packed bits in the same order as casacore.
+    std::shared_ptr<std::vector<uChar>> bits
+      (new std::vector<uChar>((values.nelements() + 7) / 8));
+    Bool deleteIt;
+    const Bool* ptr = values.getStorage (deleteIt);
+    Conversion::boolToBit (bits->data(), ptr, values.nelements());
+    values.freeStorage (ptr, deleteIt);
+    makeSchema (schema, "b", name);
+    makeArray (array, values.nelements(), {nullptr, bits->data()},
+               std::vector<ArrowArray*>(), bits);
+  }
+
+  void exportValues (const Array<String>& values, const std::string& name,
+                     ArrowSchema* schema, ArrowArray* array)
+  {
+    // Use large_utf8 (64-bit offsets) to be able to export any size.
+    std::shared_ptr<std::vector<Int64>> offsets
+      (new std::vector<Int64>(values.nelements() + 1));
+    std::shared_ptr<std::string> chars (new std::string);
+    size_t i = 0;
+    (*offsets)[0] = 0;
+    for (const String& str : values) {
+      chars->append (str);
+      (*offsets)[++i] = chars->size();
+    }
+    std::shared_ptr<std::pair<std::shared_ptr<std::vector<Int64>>,
+                              std::shared_ptr<std::string>>> owner
+      (new std::pair<std::shared_ptr<std::vector<Int64>>,
+                     std::shared_ptr<std::string>>(offsets, chars));
+    makeSchema (schema, "U", name);
+    makeArray (array, values.nelements(),
+               {nullptr, offsets->data(), chars->data()},
+               std::vector<ArrowArray*>(), owner);
+  }
+
+  template<typename T, typename R>
+  void exportComplex (const Array<T>& values, const std::string& name,
+                      ArrowSchema* schema, ArrowArray* array)
+  {
+    // A complex value is a fixed size list of its real and imaginary part.
+    std::shared_ptr<Array<T>> owner (new Array<T>(values));
+    if (! owner->contiguousStorage()) {
+      *owner = values.copy();
+    }
+    ArrowSchema* childSchema = new ArrowSchema;
+    makeSchema (childSchema, arrowFormat(static_cast<const R*>(0)), "item");
+    ArrowArray* childArray = new ArrowArray;
+    makeArray (childArray, 2*owner->nelements(), {nullptr, owner->data()},
+               std::vector<ArrowArray*>(), owner);
+    makeSchema (schema, "+w:2", name, {childSchema});
+    makeArray (array, owner->nelements(), {nullptr}, {childArray});
+  }
+
+  void exportValues (const Array<Complex>& values, const std::string& name,
+                     ArrowSchema* schema, ArrowArray* array)
+    { exportComplex<Complex,Float> (values, name, schema, array); }
+
+  void exportValues (const Array<DComplex>& values, const std::string& name,
+                     ArrowSchema* schema, ArrowArray* array)
+    { exportComplex<DComplex,Double> (values, name, schema, array); }
+  // </group>
+
+  // Append an int32 in native byte order to the metadata.
+  void appendInt (std::string& str, Int value)
+  {
+    str.append (reinterpret_cast<const char*>(&value), sizeof(Int));
+  }
+
+  void appendKeyValue (std::string& str, const std::string& key,
+                       const std::string& value)
+  {
+    appendInt (str, key.size());
+    str.append (key);
+    appendInt (str, value.size());
+    str.append (value);
+  }
+
+  // Make the metadata of a fixed_shape_tensor extension type.
+  // Arrow tensors are in C order, so the casacore shape is reversed.
+  std::string tensorMetadata (const IPosition& cellShape)
+  {
+    std::string shape = "{\"shape\":[";
+    for (Int i=cellShape.size()-1; i>=0; --i) {
+      shape += std::to_string (cellShape[i]);
+      if (i > 0) shape += ',';
+    }
+    shape += "]}";
+    std::string metadata;
+    appendInt (metadata, 2);
+    appendKeyValue (metadata, "ARROW:extension:name",
+                    "arrow.fixed_shape_tensor");
+    appendKeyValue (metadata, "ARROW:extension:metadata", shape);
+    return metadata;
+  }
+
+  // Get the cell shape from the metadata of a fixed_shape_tensor.
+  // An empty IPosition is returned if not found.
+  IPosition tensorShape (const char* metadata)
+  {
+    if (!metadata) {
+      return IPosition();
+    }
+    Int nkeys;
+    memcpy (&nkeys, metadata, sizeof(Int));
+    const char* ptr = metadata + sizeof(Int);
+    for (Int i=0; i<nkeys; ++i) {
+      Int len;
+      memcpy (&len, ptr, sizeof(Int));
+      std::string key (ptr + sizeof(Int), len);
+      ptr += sizeof(Int) + len;
+      memcpy (&len, ptr, sizeof(Int));
+      std::string value (ptr + sizeof(Int), len);
+      ptr += sizeof(Int) + len;
+      if (key == "ARROW:extension:metadata") {
+        size_t pos = value.find ("\"shape\"");
+        if (pos != std::string::npos) {
+          size_t st  = value.find ('[', pos);
+          size_t end = value.find (']', pos);
+          if (st == std::string::npos  ||  end == std::string::npos) {
+            break;
+          }
+          std::vector<Int64> shp;
+          const char* s = value.c_str() + st + 1;
+          while (s < value.c_str() + end) {
+            char* next;
+            shp.push_back (strtoll (s, &next, 10));
+            s = next;
+            while (*s == ','  ||  *s == ' ') ++s;
+          }
+          // Reverse to get the casacore order.
+          IPosition cellShape(shp.size());
+          for (size_t j=0; j<shp.size(); ++j) {
+            cellShape[j] = shp[shp.size() - 1 - j];
+          }
+          return cellShape;
+        }
+      }
+    }
+    return IPosition();
+  }
+
+  template<typename T>
+  void exportTyped (const Table& table, const String& columnName,
+                    rownr_t startRow, rownr_t nrow,
+                    ArrowSchema* schema, ArrowArray* array)
+  {
+    const ColumnDesc& cdesc = table.tableDesc().columnDesc (columnName);
+    Slicer rowRange (IPosition(1, startRow), IPosition(1, nrow));
+    if (cdesc.isScalar()) {
+      ScalarColumn<T> col(table, columnName);
+      Vector<T> values;
+      if (nrow > 0) {
+        values.reference (col.getColumnRange (rowRange));
+      }
+      exportValues (values, columnName, schema, array);
+      return;
+    }
+    ArrayColumn<T> col(table, columnName);
+    Array<T> values;
+    IPosition cellShape;
+    if (nrow > 0) {
+      values.reference (col.getColumnRange (rowRange));
+      cellShape = values.shape().getFirst (values.ndim() - 1);
+    } else {
+      cellShape = col.shapeColumn();
+      if (cellShape.empty()) {
+        cellShape = IPosition(1, 0);
+      }
+    }
+    ArrowSchema* childSchema = new ArrowSchema;
+    ArrowArray* childArray = new ArrowArray;
+    exportValues (values, "item", childSchema, childArray);
+    makeSchema (schema, "+w:" + std::to_string(cellShape.product()),
+                columnName, {childSchema}, tensorMetadata(cellShape));
+    makeArray (array, nrow, {nullptr}, {childArray});
+  }
+
+  // Check that an imported array has no nulls and has enough values.
+  void checkImport (const ArrowSchema* schema, const ArrowArray* array,
+                    size_t n, size_t extraOffset)
+  {
+    if (array->release == nullptr) {
+      throw TableError ("TableArrow: imported Arrow array is released");
+    }
+    if (array->null_count != 0  &&  array->n_buffers > 0  &&
+        array->buffers[0] != nullptr) {
+      throw TableError ("TableArrow: imported Arrow array " +
+                        String(schema->name ? schema->name : "") +
+                        " contains null values");
+    }
+    if (size_t(array->length) < extraOffset + n) {
+      throw TableError ("TableArrow: imported Arrow array " +
+                        String(schema->name ? schema->name : "") +
+                        " has too few values");
+    }
+  }
+
+  void throwFormat (const ArrowSchema* schema, DataType dtype)
+  {
+    throw TableError ("TableArrow: Arrow format " + String(schema->format) +
+                      " cannot be imported into a column of type " +
+                      String::toString(dtype));
+  }
+
+  // Get the list size of a fixed size list format (-1 if not a list).
+  Int64 listSize (const char* format)
+  {
+    if (strncmp (format, "+w:", 3) != 0) {
+      return -1;
+    }
+    return strtoll (format+3, 0, 10);
+  }
+
+  // Import the values of a flat Arrow array.
+  // <src>extraOffset</src> is the offset of the parent array.
+  // <group>
+  template<typename T>
+  void importValues (T* to, size_t n, size_t extraOffset,
+                     const ArrowSchema* schema, const ArrowArray* array)
+  {
+    if (strcmp (schema->format, arrowFormat(to)) != 0) {
+      throwFormat (schema, whatType<T>());
+    }
+    checkImport (schema, array, n, extraOffset);
+    const T* from = static_cast<const T*>(array->buffers[1]);
+    memcpy (to, from + array->offset + extraOffset, n * sizeof(T));
+  }
+
+  void importValues (Bool* to, size_t n, size_t extraOffset,
+                     const ArrowSchema* schema, const ArrowArray* array)
+  {
+    if (strcmp (schema->format, "b") != 0) {
+      throwFormat (schema, TpBool);
+    }
+    checkImport (schema, array, n, extraOffset);
+    Conversion::bitToBool (to, array->buffers[1],
+                           array->offset + extraOffset, n);
+  }
+
+  template<typename OFF>
+  void importStrings (String* to, size_t n, size_t start,
+                      const ArrowArray* array)
+  {
+    const OFF* offsets = static_cast<const OFF*>(array->buffers[1]);
+    const char* chars  = static_cast<const char*>(array->buffers[2]);
+    for (size_t i=0; i<n; ++i) {
+      to[i] = String (chars + offsets[start+i],
+                      offsets[start+i+1] - offsets[start+i]);
+    }
+  }
+
+  void importValues (String* to, size_t n, size_t extraOffset,
+                     const ArrowSchema* schema, const ArrowArray* array)
+  {
+    Bool large = strcmp (schema->format, "U") == 0;
+    if (!large  &&  strcmp (schema->format, "u") != 0) {
+      throwFormat (schema, TpString);
+    }
+    checkImport (schema, array, n, extraOffset);
+    size_t start = array->offset + extraOffset;
+    if (large) {
+      importStrings<Int64> (to, n, start, array);
+    } else {
+      importStrings<Int> (to, n, start, array);
+    }
+  }
+
+  template<typename T, typename R>
+  void importComplex (T* to, size_t n, size_t extraOffset,
+                      const ArrowSchema* schema, const ArrowArray* array)
+  {
+    if (listSize(schema->format) != 2  ||  schema->n_children != 1) {
+      throwFormat (schema, whatType<T>());
+    }
+    checkImport (schema, array, n, extraOffset);
+    importValues (reinterpret_cast<R*>(to), 2*n,
+                  2*(array->offset + extraOffset),
+                  schema->children[0], array->children[0]);
+  }
+
+  void importValues (Complex* to, size_t n, size_t extraOffset,
+                     const ArrowSchema* schema, const ArrowArray* array)
+    { importComplex<Complex,Float> (to, n, extraOffset, schema, array); }
+
+  void importValues (DComplex* to, size_t n, size_t extraOffset,
+                     const ArrowSchema* schema, const ArrowArray* array)
+    { importComplex<DComplex,Double> (to, n, extraOffset, schema, array); }
+  // </group>
+
+  // Add rows to the table if needed.
+  void ensureRows (Table& table, rownr_t nrow)
+  {
+    if (nrow > table.nrow()) {
+      table.addRow (nrow - table.nrow());
+    }
+  }
+
+  template<typename T>
+  void importTyped (Table& table, const String& columnName,
+                    rownr_t startRow, size_t nrow, size_t extraOffset,
+                    const ArrowSchema* schema, const ArrowArray* array)
+  {
+    const ColumnDesc& cdesc = table.tableDesc().columnDesc (columnName);
+    if (cdesc.isScalar()) {
+      Vector<T> values(nrow);
+      importValues (values.data(), nrow, extraOffset, schema, array);
+      ensureRows (table, startRow + nrow);
+      if (nrow > 0) {
+        ScalarColumn<T> col(table, columnName);
+        col.putColumnRange (Slicer(IPosition(1, startRow),
+                                   IPosition(1, nrow)), values);
+      }
+      return;
+    }
+    // An array column needs a fixed size list.
+    Int64 cellSize = listSize (schema->format);
+    if (cellSize < 0  ||  schema->n_children != 1) {
+      throwFormat (schema, asArray(whatType<T>()));
+    }
+    checkImport (schema, array, nrow, extraOffset);
+    // Use the column shape if fixed; otherwise the tensor shape if given.
+    IPosition cellShape;
+    if ((cdesc.options() & ColumnDesc::FixedShape) != 0) {
+      cellShape = cdesc.shape();
+    } else {
+      cellShape = tensorShape (schema->metadata);
+      if (cellShape.empty()) {
+        cellShape = IPosition(1, cellSize);
+      }
+    }
+    if (cellShape.product() != cellSize) {
+      throw TableError ("TableArrow: Arrow list size " +
+                        String::toString(cellSize) +
+                        " mismatches the cell shape " +
+                        String(cellShape.toString()) +
+                        " of column " + columnName);
+    }
+    Array<T> values(cellShape.concatenate (IPosition(1, nrow)));
+    importValues (values.data(), nrow*cellSize,
+                  cellSize*(array->offset + extraOffset),
+                  schema->children[0], array->children[0]);
+    ensureRows (table, startRow + nrow);
+    if (nrow > 0) {
+      ArrayColumn<T> col(table, columnName);
+      col.putColumnRange (Slicer(IPosition(1, startRow),
+                                 IPosition(1, nrow)), values);
+    }
+  }
+
+  void doImport (Table& table, const String& columnName,
+                 rownr_t startRow, size_t nrow, size_t extraOffset,
+                 const ArrowSchema* schema, const ArrowArray* array)
+  {
+    if (! table.tableDesc().isColumn (columnName)) {
+      throw TableError ("TableArrow: column " + columnName +
+                        " does not exist");
+    }
+    switch (table.tableDesc().columnDesc(columnName).dataType()) {
+    case TpBool:
+      importTyped<Bool> (table, columnName, startRow, nrow, extraOffset,
+                         schema, array);
+      break;
+    case TpUChar:
+      importTyped<uChar> (table, columnName, startRow, nrow, extraOffset,
+                          schema, array);
+      break;
+    case TpShort:
+      importTyped<Short> (table, columnName, startRow, nrow, extraOffset,
+                          schema, array);
+      break;
+    case TpUShort:
+      importTyped<uShort> (table, columnName, startRow, nrow, extraOffset,
+                           schema, array);
+      break;
+    case TpInt:
+      importTyped<Int> (table, columnName, startRow, nrow, extraOffset,
+                        schema, array);
+      break;
+    case TpUInt:
+      importTyped<uInt> (table, columnName, startRow, nrow, extraOffset,
+                         schema, array);
+      break;
+    case TpInt64:
+      importTyped<Int64> (table, columnName, startRow, nrow, extraOffset,
+                          schema, array);
+      break;
+    case TpFloat:
+      importTyped<Float> (table, columnName, startRow, nrow, extraOffset,
+                          schema, array);
+      break;
+    case TpDouble:
+      importTyped<Double> (table, columnName, startRow, nrow, extraOffset,
+                           schema, array);
+      break;
+    case TpComplex:
+      importTyped<Complex> (table, columnName, startRow, nrow, extraOffset,
+                            schema, array);
+      break;
+    case TpDComplex:
+      importTyped<DComplex> (table, columnName, startRow, nrow, extraOffset,
+                             schema, array);
+      break;
+    case TpString:
+      importTyped<String> (table, columnName, startRow, nrow, extraOffset,
+                           schema, array);
+      break;
+    default:
+      throw TableError ("TableArrow: data type of column " + columnName +
+                        " cannot be imported");
+    }
+  }
+
+} // end anonymous namespace
+
+
+void TableArrow::exportColumn (const Table& table, const String& columnName,
+                               rownr_t startRow, rownr_t nrow,
+                               ArrowSchema* schema, ArrowArray* array)
+{
+  if (! table.tableDesc().isColumn (columnName)) {
+    throw TableError ("TableArrow: column " + columnName +
+                      " does not exist");
+  }
+  if (startRow + nrow > table.nrow()) {
+    throw TableError ("TableArrow: rows to export exceed the table size");
+  }
+  switch (table.tableDesc().columnDesc(columnName).dataType()) {
+  case TpBool:
+    exportTyped<Bool> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpUChar:
+    exportTyped<uChar> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpShort:
+    exportTyped<Short> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpUShort:
+    exportTyped<uShort> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpInt:
+    exportTyped<Int> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpUInt:
+    exportTyped<uInt> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpInt64:
+    exportTyped<Int64> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpFloat:
+    exportTyped<Float> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpDouble:
+    exportTyped<Double> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpComplex:
+    exportTyped<Complex> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpDComplex:
+    exportTyped<DComplex> (table, columnName, startRow, nrow, schema, array);
+    break;
+  case TpString:
+    exportTyped<String> (table, columnName, startRow, nrow, schema, array);
+    break;
+  default:
+    throw TableError ("TableArrow: data type of column " + columnName +
+                      " cannot be exported");
+  }
+}
+
+void TableArrow::exportColumns (const Table& table,
+                                const Vector<String>& columnNames,
+                                rownr_t startRow, rownr_t nrow,
+                                ArrowSchema* schema, ArrowArray* array)
+{
+  std::vector<ArrowSchema*> childSchemas;
+  std::vector<ArrowArray*> childArrays;
+  try {
+    for (const String& name : columnNames) {
+      std::unique_ptr<ArrowSchema> childSchema (new ArrowSchema);
+      std::unique_ptr<ArrowArray> childArray (new ArrowArray);
+      exportColumn (table, name, startRow, nrow,
+                    childSchema.get(), childArray.get());
+      childSchemas.push_back (childSchema.release());
+      childArrays.push_back (childArray.release());
+    }
+  } catch (...) {
+    for (size_t i=0; i<childSchemas.size(); ++i) {
+      childSchemas[i]->release (childSchemas[i]);
+      childArrays[i]->release (childArrays[i]);
+      delete childSchemas[i];
+      delete childArrays[i];
+    }
+    throw;
+  }
+  makeSchema (schema, "+s", "", childSchemas);
+  makeArray (array, nrow, {nullptr}, childArrays);
+}
+
+void TableArrow::importColumn (Table& table, const String& columnName,
+                               rownr_t startRow,
+                               const ArrowSchema* schema,
+                               const ArrowArray* array)
+{
+  doImport (table, columnName, startRow, array->length, 0, schema, array);
+}
+
+void TableArrow::importColumns (Table& table, rownr_t startRow,
+                                const ArrowSchema* schema,
+                                const ArrowArray* array)
+{
+  if (strcmp (schema->format, "+s") != 0  ||
+      schema->n_children != array->n_children) {
+    throw TableError ("TableArrow: imported Arrow array is no struct array");
+  }
+  checkImport (schema, array, array->length, 0);
+  // Check all columns before writing.
+  for (Int64 i=0; i<schema->n_children; ++i) {
+    const char* name = schema->children[i]->name;
+    if (!name  ||  ! table.tableDesc().isColumn (name)) {
+      throw TableError ("TableArrow: struct child " +
+                        String(name ? name : "") + " is not a column");
+    }
+  }
+  for (Int64 i=0; i<schema->n_children; ++i) {
+    doImport (table, schema->children[i]->name, startRow, array->length,
+              array->offset, schema->children[i], array->children[i]);
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
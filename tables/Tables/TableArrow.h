@@ -0,0 +1,187 @@
+//# TableArrow.h: Exchange table columns via the Arrow C data interface
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TABLEARROW_H
+#define TABLES_TABLEARROW_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <cstdint>
+
+//# The structs of the Arrow C data interface. They are defined by the
+//# Arrow ABI; the include guard is the one prescribed by the Arrow
+//# specification, so they can coexist with the Arrow headers.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema {
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray {
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+}  // extern "C"
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Table;
+
+
+// <summary>
+// Class with static functions to exchange columns via Arrow structs.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="UNKNOWN" date="" tests="tTableArrow">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> Table
+//   <li> The <a href="https://arrow.apache.org/docs/format/CDataInterface.html">
+//        Arrow C data interface</a>
+// </prerequisite>
+
+// <synopsis>
+// TableArrow exports table columns as Arrow arrays and imports Arrow
+// arrays into table columns using the Arrow C data interface. Because that
+// interface consists of two plain C structs, no Arrow library is needed.
+// The structs can be passed to any Arrow implementation (e.g., pyarrow,
+// polars or DuckDB) to read the data as columnar batches without
+// converting each value into a Record or ValueHolder.
+// <br>The column data are read with a single getColumnRange call.
+// The Arrow buffers point directly into the resulting casacore arrays, so
+// numeric data are not copied again. Bool and String values have to be
+// converted to the Arrow layout. The exported arrays keep the casacore
+// data alive until the consumer calls the release callback.
+// <br>The data types are mapped as follows:
+// <ul>
+//  <li> Bool, uChar, Short, uShort, Int, uInt, Int64, Float and Double
+//       map to the corresponding Arrow primitive type.
+//  <li> Complex and DComplex map to a fixed size list of 2 floats or doubles.
+//  <li> String maps to large_utf8.
+//  <li> An array column maps to a fixed size list of all values in a cell.
+//       It gets the <src>arrow.fixed_shape_tensor</src> extension type, whose
+//       metadata hold the cell shape in C order (thus reversed).
+//       All exported cells must have the same shape.
+// </ul>
+// Several columns are exported as a struct array, which is the Arrow
+// representation of a record batch.
+// <br>Null values are not supported on import, because table cells
+// always have a value.
+// </synopsis>
+
+// <example>
+// <srcblock>
+// Table tab("my.ms");
+// ArrowSchema schema;
+// ArrowArray array;
+// TableArrow::exportColumns (tab, Vector<String>{"TIME", "ANTENNA1"},
+//                            0, tab.nrow(), &schema, &array);
+// // Pass schema and array to the Arrow consumer that will release them.
+// </srcblock>
+// </example>
+
+// <motivation>
+// Getting columns via Records costs a lot per value, which makes it slow
+// to use table data in analytics packages.
+// </motivation>
+
+class TableArrow
+{
+public:
+  // Export <src>nrow</src> rows starting at <src>startRow</src> of the
+  // given column as an Arrow array.
+  // The structs must not be in use; the caller has to release them.
+  static void exportColumn (const Table& table, const String& columnName,
+                            rownr_t startRow, rownr_t nrow,
+                            ArrowSchema* schema, ArrowArray* array);
+
+  // Export <src>nrow</src> rows starting at <src>startRow</src> of the
+  // given columns as an Arrow struct array with a child per column.
+  static void exportColumns (const Table& table,
+                             const Vector<String>& columnNames,
+                             rownr_t startRow, rownr_t nrow,
+                             ArrowSchema* schema, ArrowArray* array);
+
+  // Import an Arrow array into the given column starting at
+  // <src>startRow</src>. Rows are added to the table if needed.
+  // The structs are not released; that has to be done by the caller.
+  static void importColumn (Table& table, const String& columnName,
+                            rownr_t startRow,
+                            const ArrowSchema* schema, const ArrowArray* array);
+
+  // Import an Arrow struct array into the columns named after its
+  // children. Rows are added to the table if needed.
+  // <br>The columns are written one by one, so if a child does not match
+  // its column, the previous columns have already been written.
+  static void importColumns (Table& table, rownr_t startRow,
+                             const ArrowSchema* schema,
+                             const ArrowArray* array);
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -27,6 +27,8 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/Array.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/DataMan/StringDictionary.h>
 #include <casacore/casa/Containers/ValueHolder.h>
 
 
@@ -124,6 +126,9 @@ const ColumnDesc& TableColumn::columnDesc() const
 Table TableColumn::table() const
     { return Table (baseTabPtr_p); }
 
+Table TableColumn::countedTable() const
+    { return Table (baseTabPtr_p->shared_from_this()); }
+
 
 Bool TableColumn::asBool (rownr_t rownr) const
 {
@@ -210,6 +215,37 @@ String TableColumn::asString (rownr_t rownr) const
     return value;
 }
 
+void TableColumn::getStringCodes (Vector<uInt>& codes,
+                                  Vector<String>& dictionary) const
+{
+    rownr_t nr = nrow();
+    if (nr == 0) {
+        // Check the data type and clear the result.
+        getStringCodes (RefRows(Vector<rownr_t>()), codes, dictionary);
+    } else {
+        getStringCodes (RefRows(0, nr-1), codes, dictionary);
+    }
+}
+
+void TableColumn::getStringCodes (const RefRows& rownrs, Vector<uInt>& codes,
+                                  Vector<String>& dictionary) const
+{
+    if (columnDesc().dataType() != TpString  ||  !columnDesc().isScalar()) {
+        throw TableInvDT ("TableColumn::getStringCodes: column " +
+                          columnDesc().name() +
+                          " does not contain scalar Strings");
+    }
+    if (codes.size() != rownrs.nrow()  ||  !codes.contiguousStorage()) {
+        Vector<uInt> tmp(rownrs.nrow());
+        codes.reference (tmp);
+    }
+    StringDictionary dict;
+    if (codes.size() > 0) {
+        baseColPtr_p->getStringCodes (rownrs, codes.data(), dict);
+    }
+    dict.getValues (dictionary);
+}
+
 
 void TableColumn::put (rownr_t thisRownr, const TableColumn& that,
 		       rownr_t thatRownr, Bool preserveTileShape)
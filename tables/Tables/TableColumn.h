@@ -39,6 +39,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Forward Declarations
 class Table;
 class BaseTable;
+class RefRows;
 
 
 //# Check the number of rows in debug mode.
@@ -280,6 +281,23 @@ public:
     String   asString   (rownr_t rownr) const;
     // </group>
 
+    // Get the values of a scalar String column dictionary encoded.
+    // <src>dictionary</src> is resized to the distinct values (in order
+    // of first appearance) and <src>codes</src> to the number of rows.
+    // Each code is the index of the row's value in the dictionary.
+    // <br>For columns with few distinct values (like the NAME column of
+    // an MS FIELD table) this is much cheaper than getting a String per
+    // row, and comparing or grouping the values can be done on the codes.
+    // StandardStMan looks up strings stored in its data buckets without
+    // making a String.
+    // An exception is thrown if the column does not contain scalar Strings.
+    // <group>
+    void getStringCodes (Vector<uInt>& codes,
+                         Vector<String>& dictionary) const;
+    void getStringCodes (const RefRows& rownrs, Vector<uInt>& codes,
+                         Vector<String>& dictionary) const;
+    // </group>
+
     // Get the value of a scalar in the given row.
     // These functions work for all data types.
     // Data type promotion is possible for the standard data types.
@@ -389,6 +407,11 @@ protected:
     Bool isColWritable_p;                    //# is the column writable at all?
 
 
+    // Get a Table object that counts as a reference to the table, so the
+    // table stays alive as long as the object exists (unlike the object
+    // returned by <src>table()</src>). It is used by the async functions.
+    Table countedTable() const;
+
     // Get the baseColPtr_p of this TableColumn object.
     BaseColumn* baseColPtr () const
 	{ return baseColPtr_p; }
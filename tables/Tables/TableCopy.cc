@@ -30,6 +30,8 @@
 #include <casacore/tables/Tables/TableRow.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/Tables/TableLocker.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/tables/DataMan/DataManager.h>
@@ -38,6 +40,15 @@
 #include <casacore/casa/Utilities/LinearSearch.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/OS/Path.h>
+#include <casacore/casa/OS/ThreadPool.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/MemoryIO.h>
+#include <casacore/casa/Utilities/ValType.h>
+#include <mutex>
 #include <casacore/casa/BasicSL/String.h>
 
 
@@ -85,6 +96,172 @@ Table TableCopy::makeEmptyMemoryTable (const String& newName,
   return Table(newtab, Table::Memory, (noRows ? 0 : tab.nrow()));
 }
 
+// Copy a row range of a column using bulk get/put of column ranges
+// in chunks of about 4 MB. The optional mutexes serialize the access to
+// the input and output table when columns are copied in parallel.
+template<typename T>
+static void copyColumnRange (const TableColumn& incol, TableColumn& outcol,
+                             rownr_t startout, rownr_t startin, rownr_t nrrow,
+                             std::mutex* inMutex, std::mutex* outMutex)
+{
+  const size_t chunkBytes = 4*1024*1024;
+  std::unique_lock<std::mutex> inLock;
+  std::unique_lock<std::mutex> outLock;
+  if (incol.columnDesc().isScalar()) {
+    if (inMutex) inLock = std::unique_lock<std::mutex>(*inMutex);
+    if (outMutex) outLock = std::unique_lock<std::mutex>(*outMutex);
+    ScalarColumn<T> in(incol);
+    ScalarColumn<T> out(outcol);
+    if (inLock.owns_lock()) inLock.unlock();
+    if (outLock.owns_lock()) outLock.unlock();
+    rownr_t chunk = std::max (rownr_t(1), rownr_t(chunkBytes / sizeof(T)));
+    Vector<T> buf;
+    for (rownr_t st=0; st<nrrow; st+=chunk) {
+      rownr_t nr = std::min (chunk, nrrow-st);
+      if (inMutex) inLock = std::unique_lock<std::mutex>(*inMutex);
+      in.getColumnRange (Slicer(IPosition(1,startin+st), IPosition(1,nr)),
+                         buf, True);
+      if (inLock.owns_lock()) inLock.unlock();
+      if (outMutex) outLock = std::unique_lock<std::mutex>(*outMutex);
+      out.putColumnRange (Slicer(IPosition(1,startout+st), IPosition(1,nr)),
+                          buf);
+      if (outLock.owns_lock()) outLock.unlock();
+    }
+  } else {
+    if (inMutex) inLock = std::unique_lock<std::mutex>(*inMutex);
+    if (outMutex) outLock = std::unique_lock<std::mutex>(*outMutex);
+    ArrayColumn<T> in(incol);
+    ArrayColumn<T> out(outcol);
+    size_t cellSize = out.shapeColumn().product() * sizeof(T);
+    if (inLock.owns_lock()) inLock.unlock();
+    if (outLock.owns_lock()) outLock.unlock();
+    rownr_t chunk = std::max (rownr_t(1), rownr_t(chunkBytes / cellSize));
+    Array<T> buf;
+    for (rownr_t st=0; st<nrrow; st+=chunk) {
+      rownr_t nr = std::min (chunk, nrrow-st);
+      if (inMutex) inLock = std::unique_lock<std::mutex>(*inMutex);
+      in.getColumnRange (Slicer(IPosition(1,startin+st), IPosition(1,nr)),
+                         buf, True);
+      if (inLock.owns_lock()) inLock.unlock();
+      if (outMutex) outLock = std::unique_lock<std::mutex>(*outMutex);
+      out.putColumnRange (Slicer(IPosition(1,startout+st), IPosition(1,nr)),
+                          buf);
+      if (outLock.owns_lock()) outLock.unlock();
+    }
+  }
+}
+
+// Test if a column can be copied using bulk column range access.
+// That is possible for scalars and fixed shape arrays of a standard type
+// having the same data type and shape in input and output.
+// A variable shaped input column can also be copied that way to a fixed
+// shape output column if all input cells to copy have that shape.
+static Bool canCopyColumnRange (const TableColumn& incol,
+                                const TableColumn& outcol,
+                                rownr_t startin, rownr_t nrrow)
+{
+  const ColumnDesc& incd  = incol.columnDesc();
+  const ColumnDesc& outcd = outcol.columnDesc();
+  if (incd.dataType() != outcd.dataType()) {
+    return False;
+  }
+  switch (incd.dataType()) {
+  case TpBool: case TpUChar: case TpShort: case TpUShort:
+  case TpInt: case TpUInt: case TpInt64: case TpFloat: case TpDouble:
+  case TpComplex: case TpDComplex: case TpString:
+    break;
+  default:
+    return False;
+  }
+  if (incd.isScalar()  &&  outcd.isScalar()) {
+    return True;
+  }
+  if (! (incd.isArray()  &&  outcd.isArray()  &&  outcd.isFixedShape()  &&
+         outcol.shapeColumn().size() > 0)) {
+    return False;
+  }
+  const IPosition& shape = outcol.shapeColumn();
+  if (incd.isFixedShape()) {
+    return incol.shapeColumn().isEqual (shape);
+  }
+  for (rownr_t i=startin; i<startin+nrrow; ++i) {
+    if (! (incol.isDefined(i)  &&  incol.shape(i).isEqual (shape))) {
+      return False;
+    }
+  }
+  return True;
+}
+
+static void copyColumnRangeTyped (const TableColumn& incol,
+                                  TableColumn& outcol,
+                                  rownr_t startout, rownr_t startin,
+                                  rownr_t nrrow,
+                                  std::mutex* inMutex, std::mutex* outMutex)
+{
+  switch (incol.columnDesc().dataType()) {
+  case TpBool:
+    copyColumnRange<Bool> (incol, outcol, startout, startin, nrrow,
+                           inMutex, outMutex);
+    break;
+  case TpUChar:
+    copyColumnRange<uChar> (incol, outcol, startout, startin, nrrow,
+                            inMutex, outMutex);
+    break;
+  case TpShort:
+    copyColumnRange<Short> (incol, outcol, startout, startin, nrrow,
+                            inMutex, outMutex);
+    break;
+  case TpUShort:
+    copyColumnRange<uShort> (incol, outcol, startout, startin, nrrow,
+                             inMutex, outMutex);
+    break;
+  case TpInt:
+    copyColumnRange<Int> (incol, outcol, startout, startin, nrrow,
+                          inMutex, outMutex);
+    break;
+  case TpUInt:
+    copyColumnRange<uInt> (incol, outcol, startout, startin, nrrow,
+                           inMutex, outMutex);
+    break;
+  case TpInt64:
+    copyColumnRange<Int64> (incol, outcol, startout, startin, nrrow,
+                            inMutex, outMutex);
+    break;
+  case TpFloat:
+    copyColumnRange<Float> (incol, outcol, startout, startin, nrrow,
+                            inMutex, outMutex);
+    break;
+  case TpDouble:
+    copyColumnRange<Double> (incol, outcol, startout, startin, nrrow,
+                             inMutex, outMutex);
+    break;
+  case TpComplex:
+    copyColumnRange<Complex> (incol, outcol, startout, startin, nrrow,
+                              inMutex, outMutex);
+    break;
+  case TpDComplex:
+    copyColumnRange<DComplex> (incol, outcol, startout, startin, nrrow,
+                               inMutex, outMutex);
+    break;
+  case TpString:
+    copyColumnRange<String> (incol, outcol, startout, startin, nrrow,
+                             inMutex, outMutex);
+    break;
+  default:
+    throw TableError ("TableCopy: invalid data type for bulk column copy");
+  }
+}
+
+uInt TableCopy::copyNThreads (uInt ncolumn)
+{
+  Int nthread;
+  AipsrcValue<Int>::find (nthread, "table.copy.nthreads", 1);
+  if (nthread <= 0) {
+    nthread = ThreadPool::concurrency();
+  }
+  return std::max (1, std::min (nthread, Int(ncolumn)));
+}
+
 void TableCopy::copyRows (Table& out, const Table& in, rownr_t startout,
 			  rownr_t startin, rownr_t nrrow, Bool flush)
 {
@@ -98,29 +275,403 @@ void TableCopy::copyRows (Table& out, const Table& in, rownr_t startout,
   Vector<String> columns = outrow.columnNames();
   const TableDesc& tdesc = in.tableDesc();
   // Only copy the columns that exist in the input table.
+  // Columns that can be copied in bulk are handled separately.
   Vector<String> cols(columns.nelements());
+  std::vector<TableColumn> bulkIn, bulkOut;
   uInt nrcol = 0;
   for (uInt i=0; i<columns.nelements(); i++) {
     if (tdesc.isColumn (columns(i))) {
-      cols(nrcol++) = columns(i);
+      TableColumn incol(in, columns(i));
+      TableColumn outcol(out, columns(i));
+      if (canCopyColumnRange (incol, outcol, startin, nrrow)) {
+        bulkIn.push_back (incol);
+        bulkOut.push_back (outcol);
+      } else {
+        cols(nrcol++) = columns(i);
+      }
     }
   }
-  if (nrcol > 0) {
-    cols.resize (nrcol, True);
+  if (nrcol > 0  ||  !bulkIn.empty()) {
     // Add rows as needed.
     if (startout + nrrow > out.nrow()) {
       out.addRow (startout + nrrow - out.nrow());
     }
+  }
+  if (!bulkIn.empty()  &&  nrrow > 0) {
+    // Copy the columns in parallel if possible and wanted.
+    // Reads and writes are serialized per table, so reading one column
+    // overlaps with writing another one.
+    // It cannot be done if input and output share the same root table.
+    uInt nthread = 1;
+    if (! in.isSameRoot (out)) {
+      nthread = copyNThreads (bulkIn.size());
+    }
+    if (nthread <= 1) {
+      for (size_t i=0; i<bulkIn.size(); ++i) {
+        copyColumnRangeTyped (bulkIn[i], bulkOut[i], startout, startin, nrrow,
+                              0, 0);
+      }
+    } else {
+      std::mutex inMutex, outMutex;
+      ThreadPool::global().parallelFor (bulkIn.size(), [&] (size_t i)
+        {
+          copyColumnRangeTyped (bulkIn[i], bulkOut[i], startout, startin,
+                                nrrow, &inMutex, &outMutex);
+        }, nthread);
+    }
+  }
+  if (nrcol > 0) {
+    cols.resize (nrcol, True);
     ROTableRow inrow(in, cols);
     outrow = TableRow(out, cols);
     for (rownr_t i=0; i<nrrow; i++) {
       inrow.get (startin + i);
       outrow.put (startout + i, inrow.record(), inrow.getDefined(), False);
     }
-    if (flush) {
-      out.flush();
+  }
+  if ((nrcol > 0  ||  !bulkIn.empty())  &&  flush) {
+    out.flush();
+  }
+}
+
+// The keyword in an incrementally copied table holding the progress.
+static const String copyProgressKey ("_COPY_PROGRESS");
+// The default amount of data of a column block in an incremental copy.
+static const size_t copyBlockBytes = 64*1024*1024;
+
+// Update a hash value with the given bytes (using 64 bits FNV-1a).
+// It is used to detect changed blocks in an incremental copy.
+static void hashBytes (uInt64& hash, const void* data, size_t nbytes)
+{
+  const uChar* ptr = static_cast<const uChar*>(data);
+  for (size_t i=0; i<nbytes; ++i) {
+    hash = (hash ^ ptr[i]) * 1099511628211ULL;
+  }
+}
+
+template<typename T>
+static void hashArray (uInt64& hash, const Array<T>& arr)
+{
+  Bool deleteIt;
+  const T* data = arr.getStorage (deleteIt);
+  hashBytes (hash, data, arr.size() * sizeof(T));
+  arr.freeStorage (data, deleteIt);
+}
+
+static void hashArray (uInt64& hash, const Array<String>& arr)
+{
+  for (const String& str : arr) {
+    hashBytes (hash, str.chars(), str.size() + 1);
+  }
+}
+
+// Read a block of a column in bulk and write it to the output if its
+// hash differs from the given hash (or if the block was not copied yet).
+// The hash is set to the hash of the input block.
+template<typename T>
+static Bool copyBlockIfChanged (const TableColumn& incol, TableColumn& outcol,
+                                rownr_t start, rownr_t nrrow,
+                                Bool done, uInt64& hash)
+{
+  Slicer rows (IPosition(1,start), IPosition(1,nrrow));
+  uInt64 newHash = 14695981039346656037ULL;
+  if (incol.columnDesc().isScalar()) {
+    Vector<T> buf = ScalarColumn<T>(incol).getColumnRange (rows);
+    hashArray (newHash, buf);
+    if (done  &&  newHash == hash) {
+      return False;
+    }
+    ScalarColumn<T>(outcol).putColumnRange (rows, buf);
+  } else {
+    Array<T> buf = ArrayColumn<T>(incol).getColumnRange (rows);
+    hashArray (newHash, buf);
+    if (done  &&  newHash == hash) {
+      return False;
+    }
+    ArrayColumn<T>(outcol).putColumnRange (rows, buf);
+  }
+  hash = newHash;
+  return True;
+}
+
+static Bool copyBlockIfChangedTyped (const TableColumn& incol,
+                                     TableColumn& outcol,
+                                     rownr_t start, rownr_t nrrow,
+                                     Bool done, uInt64& hash)
+{
+  switch (incol.columnDesc().dataType()) {
+  case TpBool:
+    return copyBlockIfChanged<Bool> (incol, outcol, start, nrrow, done, hash);
+  case TpUChar:
+    return copyBlockIfChanged<uChar> (incol, outcol, start, nrrow, done, hash);
+  case TpShort:
+    return copyBlockIfChanged<Short> (incol, outcol, start, nrrow, done, hash);
+  case TpUShort:
+    return copyBlockIfChanged<uShort> (incol, outcol, start, nrrow, done, hash);
+  case TpInt:
+    return copyBlockIfChanged<Int> (incol, outcol, start, nrrow, done, hash);
+  case TpUInt:
+    return copyBlockIfChanged<uInt> (incol, outcol, start, nrrow, done, hash);
+  case TpInt64:
+    return copyBlockIfChanged<Int64> (incol, outcol, start, nrrow, done, hash);
+  case TpFloat:
+    return copyBlockIfChanged<Float> (incol, outcol, start, nrrow, done, hash);
+  case TpDouble:
+    return copyBlockIfChanged<Double> (incol, outcol, start, nrrow, done, hash);
+  case TpComplex:
+    return copyBlockIfChanged<Complex> (incol, outcol, start, nrrow,
+                                        done, hash);
+  case TpDComplex:
+    return copyBlockIfChanged<DComplex> (incol, outcol, start, nrrow,
+                                         done, hash);
+  case TpString:
+    return copyBlockIfChanged<String> (incol, outcol, start, nrrow,
+                                       done, hash);
+  default:
+    throw TableError ("TableCopy: invalid data type for bulk column copy");
+  }
+}
+
+// Copy a block of a column row by row if its hash differs from the given
+// hash (or if the block was not copied yet). The hash is calculated from
+// the serialized cells, so it has to read the input block twice if changed.
+static Bool copyRowBlockIfChanged (Table& out, const Table& in,
+                                   const String& column,
+                                   rownr_t start, rownr_t nrrow,
+                                   Bool done, uInt64& hash)
+{
+  Vector<String> cols(1, column);
+  ROTableRow inrow(in, cols);
+  uInt64 newHash = 14695981039346656037ULL;
+  for (rownr_t i=start; i<start+nrrow; ++i) {
+    inrow.get (i);
+    std::shared_ptr<MemoryIO> membuf (new MemoryIO());
+    AipsIO aio(membuf);
+    aio << inrow.record();
+    aio.close();
+    hashBytes (newHash, membuf->getBuffer(), membuf->length());
+    Bool defined = inrow.getDefined()[0];
+    hashBytes (newHash, &defined, sizeof(defined));
+  }
+  if (done  &&  newHash == hash) {
+    return False;
+  }
+  TableRow outrow(out, cols);
+  for (rownr_t i=start; i<start+nrrow; ++i) {
+    inrow.get (i);
+    outrow.put (i, inrow.record(), inrow.getDefined(), False);
+  }
+  hash = newHash;
+  return True;
+}
+
+// Get the number of rows in a block of a column in an incremental copy.
+// Columns that can be copied in bulk use blocks of about copyBlockBytes,
+// other columns blocks of 10000 rows.
+static rownr_t copyBlockRows (const TableColumn& outcol, rownr_t blockRows)
+{
+  if (blockRows > 0) {
+    return blockRows;
+  }
+  const ColumnDesc& cd = outcol.columnDesc();
+  size_t cellBytes = ValType::getTypeSize (cd.dataType());
+  if (cd.isArray()) {
+    if (! (cd.isFixedShape()  &&  outcol.shapeColumn().size() > 0)) {
+      return 10000;
+    }
+    cellBytes *= outcol.shapeColumn().product();
+  }
+  return std::max (rownr_t(1), rownr_t(copyBlockBytes / cellBytes));
+}
+
+// Store the progress of a column in the progress keyword of the output
+// table and flush it, so an interrupted copy can be resumed.
+static void saveCopyProgress (Table& out, Record& progress,
+                              Record& colProgress, const String& column,
+                              rownr_t blockRows, const Vector<Bool>& done,
+                              const Vector<Int64>& hashes)
+{
+  Record rec;
+  rec.define ("BLOCKROWS", Int64(blockRows));
+  rec.define ("DONE", done);
+  rec.define ("HASH", hashes);
+  colProgress.defineRecord (column, rec);
+  progress.defineRecord ("COLUMNS", colProgress);
+  out.rwKeywordSet().defineRecord (copyProgressKey, progress);
+  out.flush();
+}
+
+// Get the nr of blocks that can still be copied (0 is unlimited).
+static uInt64 remainingBlocks (uInt64 maxBlocks, uInt64 ncopied)
+{
+  return (maxBlocks == 0  ?  0 : maxBlocks - std::min(maxBlocks, ncopied));
+}
+
+uInt64 TableCopy::copyRowsIncremental (Table& out, const Table& in,
+                                       rownr_t blockRows, uInt64 maxBlocks)
+{
+  const rownr_t nrow = in.nrow();
+  // Make the output table as large as the input one.
+  if (out.nrow() < nrow) {
+    out.addRow (nrow - out.nrow());
+  } else if (out.nrow() > nrow) {
+    Vector<rownr_t> rows(out.nrow() - nrow);
+    indgen (rows, nrow);
+    out.removeRow (RowNumbers(rows));
+  }
+  Record progress;
+  if (out.keywordSet().isDefined (copyProgressKey)) {
+    progress = out.keywordSet().asRecord (copyProgressKey);
+  }
+  Record colProgress;
+  if (progress.isDefined ("COLUMNS")) {
+    colProgress = progress.subRecord ("COLUMNS");
+  }
+  progress.define ("NROW", Int64(nrow));
+  // Copy the stored output columns that exist in the input.
+  TableRow outrow(out, out.tableDesc().ncolumn() > 1);
+  Vector<String> columns = outrow.columnNames();
+  const TableDesc& tdesc = in.tableDesc();
+  uInt64 ncopied = 0;
+  for (const String& column : columns) {
+    if (! tdesc.isColumn (column)) {
+      continue;
+    }
+    TableColumn incol(in, column);
+    TableColumn outcol(out, column);
+    rownr_t colBlockRows = copyBlockRows (outcol, blockRows);
+    rownr_t nblock = (nrow + colBlockRows - 1) / colBlockRows;
+    // Get the progress of the column. Start anew if the block size changed.
+    Vector<Bool> done(nblock, False);
+    Vector<Int64> hashes(nblock, 0);
+    if (colProgress.isDefined (column)) {
+      const Record& rec = colProgress.subRecord (column);
+      if (rec.asInt64 ("BLOCKROWS") == Int64(colBlockRows)) {
+        Vector<Bool> oldDone (rec.asArrayBool ("DONE"));
+        Vector<Int64> oldHashes (rec.asArrayInt64 ("HASH"));
+        for (rownr_t i=0; i<std::min(nblock, rownr_t(oldDone.size())); ++i) {
+          done[i]   = oldDone[i];
+          hashes[i] = oldHashes[i];
+        }
+      }
+    }
+    // A partial last block that got more rows gets another hash, so it
+    // is copied again.
+    for (rownr_t b=0; b<nblock; ++b) {
+      if (maxBlocks > 0  &&  ncopied >= maxBlocks) {
+        break;
+      }
+      rownr_t start = b * colBlockRows;
+      rownr_t nr = std::min (colBlockRows, nrow - start);
+      uInt64 hash = hashes[b];
+      Bool copied;
+      if (canCopyColumnRange (incol, outcol, start, nr)) {
+        copied = copyBlockIfChangedTyped (incol, outcol, start, nr,
+                                          done[b], hash);
+      } else {
+        copied = copyRowBlockIfChanged (out, in, column, start, nr,
+                                        done[b], hash);
+      }
+      if (copied) {
+        done[b]   = True;
+        hashes[b] = hash;
+        ncopied++;
+        // Record the progress, so the copy can be resumed from here.
+        saveCopyProgress (out, progress, colProgress, column,
+                          colBlockRows, done, hashes);
+      }
+    }
+    // Also record the progress if nothing was copied (e.g., rows removed).
+    saveCopyProgress (out, progress, colProgress, column,
+                      colBlockRows, done, hashes);
+  }
+  return ncopied;
+}
+
+Bool TableCopy::isCopyComplete (const Table& out)
+{
+  if (! out.keywordSet().isDefined (copyProgressKey)) {
+    return False;
+  }
+  const Record& progress = out.keywordSet().asRecord (copyProgressKey);
+  if (progress.asInt64("NROW") != Int64(out.nrow())) {
+    return False;
+  }
+  const Record& colProgress = progress.subRecord ("COLUMNS");
+  for (uInt i=0; i<colProgress.nfields(); ++i) {
+    if (! allTrue (colProgress.subRecord(i).asArrayBool ("DONE"))) {
+      return False;
+    }
+  }
+  return True;
+}
+
+uInt64 TableCopy::copyIncremental (const String& newName, const Table& in,
+                                   rownr_t blockRows, uInt64 maxBlocks)
+{
+  Table out;
+  if (Table::isReadable (newName)) {
+    out = Table (newName, Table::Update);
+  } else {
+    out = makeEmptyTable (newName, Record(), in, Table::New,
+                          Table::AipsrcEndian, True, True);
+    copyInfo (out, in);
+  }
+  // Copy the subtables first (recursively); they are usually small.
+  uInt64 ncopied = copySubTablesIncremental (out.rwKeywordSet(),
+                                             in.keywordSet(), out, in,
+                                             blockRows, maxBlocks);
+  const TableDesc& outDesc = out.tableDesc();
+  const TableDesc& inDesc = in.tableDesc();
+  for (uInt i=0; i<outDesc.ncolumn(); i++) {
+    const String& name = outDesc[i].name();
+    if (out.isColumnWritable(i)  &&  inDesc.isColumn(name)) {
+      TableColumn outCol(out, name);
+      TableColumn inCol(in, name);
+      ncopied += copySubTablesIncremental (outCol.rwKeywordSet(),
+                                           inCol.keywordSet(), out, in,
+                                           blockRows,
+                                           remainingBlocks (maxBlocks,
+                                                            ncopied));
+    }
+  }
+  if (maxBlocks == 0  ||  ncopied < maxBlocks) {
+    ncopied += copyRowsIncremental (out, in, blockRows,
+                                    remainingBlocks (maxBlocks, ncopied));
+  }
+  return ncopied;
+}
+
+uInt64 TableCopy::copySubTablesIncremental (TableRecord& outKeys,
+                                            const TableRecord& inKeys,
+                                            const Table& out, const Table& in,
+                                            rownr_t blockRows,
+                                            uInt64 maxBlocks)
+{
+  uInt64 ncopied = 0;
+  for (uInt i=0; i<inKeys.nfields(); i++) {
+    if (inKeys.type(i) == TpTable) {
+      if (maxBlocks > 0  &&  ncopied >= maxBlocks) {
+        break;
+      }
+      Table inTab = inKeys.asTable(i);
+      TableLocker locker(inTab, FileLocker::Read);
+      // A subtable with the same root as the input (e.g. SORTED_TABLE in
+      // a MeasurementSet) is not copied.
+      if (inTab.isSameRoot (in)) {
+        if (outKeys.isDefined (inKeys.name(i))) {
+          outKeys.removeField (inKeys.name(i));
+        }
+      } else {
+        String newName = out.tableName() + '/' +
+                         Path(inTab.tableName()).baseName();
+        ncopied += copyIncremental (newName, inTab, blockRows,
+                                    remainingBlocks (maxBlocks, ncopied));
+        outKeys.defineTable (inKeys.name(i), Table(newName));
+      }
     }
   }
+  return ncopied;
 }
 
 void TableCopy::copyInfo (Table& out, const Table& in)
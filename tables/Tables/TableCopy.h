@@ -66,6 +66,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> <src>CopyInfo</src> copies the table info data.
 //  <li> <src>copySubTables</src> copies all the subtables in table and
 //       column keywords. It is done recursively.
+//  <li> <src>copyIncremental</src> and <src>copyRowsIncremental</src>
+//       copy a table in blocks while recording the progress in the output
+//       table, so the copy can be resumed and later synchronized with the
+//       input table by copying changed blocks only.
 // </ol>
 // </synopsis> 
 
@@ -112,6 +116,15 @@ public:
   // column with the same name in table <src>in</src>. In principle only
   // stored columns will be filled; however if the output table has only
   // one column, it can also be a virtual one.
+  // <br>Scalar columns and fixed shape array columns with the same data type
+  // and shape in input and output are copied in bulk using chunks of rows.
+  // That is also done for a variable shaped input column if the output
+  // column has a fixed shape and all input cells to copy have that shape.
+  // If the aipsrc variable <src>table.copy.nthreads</src> is set to a value
+  // other than 1 (&lt;=0 means the ThreadPool concurrency), such columns are
+  // copied in parallel, where reading a column overlaps with writing another
+  // one.
+  // Other columns are copied row by row.
   // <group>
   static void copyRows (Table& out, const Table& in, Bool flush=True)
     { copyRows (out, in, 0, 0, in.nrow(), flush); }
@@ -142,6 +155,40 @@ public:
 			     Bool noRows=False,
 			     const Block<String>& omit=Block<String>());
 
+  // Make a deep copy of a table incrementally, which can be resumed if
+  // interrupted. If the output table does not exist yet, it is created like
+  // <src>makeEmptyTable</src> (without rows) and the table info is copied.
+  // Thereafter the subtables are copied incrementally (recursively) and the
+  // rows are copied using <src>copyRowsIncremental</src>.
+  // <br>At most <src>maxBlocks</src> column blocks are copied (0 is all),
+  // so a large copy can be spread over multiple calls.
+  // It returns the number of column blocks copied.
+  static uInt64 copyIncremental (const String& newName, const Table& in,
+                                 rownr_t blockRows = 0, uInt64 maxBlocks = 0);
+
+  // Copy the rows of the input to the output table column by column in
+  // blocks of rows. The output table is resized to the size of the input.
+  // The progress is recorded per column and block in the keyword
+  // <src>_COPY_PROGRESS</src> of the output table, which is flushed after
+  // each block, so a copy that was interrupted (e.g., by a crash) can be
+  // resumed by calling the function again.
+  // <br>A checksum of each block is recorded as well, so a subsequent call
+  // only copies the blocks that have changed since, which can be used to
+  // synchronize a copy with its source.
+  // <br>By default the block size is about 64 MB for columns that can be
+  // copied in bulk and 10000 rows otherwise; it can be set explicitly
+  // using <src>blockRows</src>. A column is copied anew if its block size
+  // differs from the recorded one.
+  // <br>At most <src>maxBlocks</src> blocks are copied (0 is all).
+  // It returns the number of blocks copied.
+  static uInt64 copyRowsIncremental (Table& out, const Table& in,
+                                     rownr_t blockRows = 0,
+                                     uInt64 maxBlocks = 0);
+
+  // Tell if an incremental copy of the output table is complete, thus
+  // all blocks of all columns have been copied.
+  static Bool isCopyComplete (const Table& out);
+
   // Clone a column in the from table to a new column in the to table.
   // The new column gets the same table description as the source column.
   // If newdmInfo is empty, the same data manager type as the source column is used.
@@ -224,6 +271,16 @@ public:
                       preserveTileShape); }
 
 private:
+  // Get the number of threads to use for copying the given nr of columns.
+  static uInt copyNThreads (uInt ncolumn);
+
+  // Copy the subtables in the given keywordset incrementally.
+  static uInt64 copySubTablesIncremental (TableRecord& outKeys,
+                                          const TableRecord& inKeys,
+                                          const Table& out, const Table& in,
+                                          rownr_t blockRows,
+                                          uInt64 maxBlocks);
+
   static void doCloneColumn (const Table& fromTable, const String& fromColumn,
                              Table& toTable, const ColumnDesc& newColumn,
                              const String& dataManagerName,
@@ -0,0 +1,102 @@
+//# TableIOQueue.cc: Ordered asynchronous execution of table I/O
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/Tables/TableIOQueue.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TableIOQueue::TableIOQueue()
+: itsNPending (0),
+  itsStop     (False)
+{}
+
+TableIOQueue::~TableIOQueue()
+{
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsStop = True;
+  }
+  itsCond.notify_all();
+  if (itsThread.joinable()) {
+    itsThread.join();
+  }
+}
+
+TableIOQueue& TableIOQueue::global()
+{
+  static TableIOQueue queue;
+  return queue;
+}
+
+void TableIOQueue::push (Task task)
+{
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    itsTasks.push_back (std::move(task));
+    itsNPending++;
+    if (! itsThread.joinable()) {
+      itsThread = std::thread (&TableIOQueue::run, this);
+    }
+  }
+  itsCond.notify_one();
+}
+
+void TableIOQueue::wait()
+{
+  std::unique_lock<std::mutex> lock(itsMutex);
+  itsDoneCond.wait (lock, [this]() { return itsNPending == 0; });
+}
+
+size_t TableIOQueue::nrPending() const
+{
+  std::lock_guard<std::mutex> lock(itsMutex);
+  return itsNPending;
+}
+
+void TableIOQueue::run()
+{
+  std::unique_lock<std::mutex> lock(itsMutex);
+  while (True) {
+    // Finish the outstanding requests before stopping.
+    itsCond.wait (lock, [this]() { return itsStop || !itsTasks.empty(); });
+    if (itsTasks.empty()) {
+      break;
+    }
+    Task task = std::move (itsTasks.front());
+    itsTasks.pop_front();
+    lock.unlock();
+    // A request stores an exception in its future.
+    task();
+    task = Task();
+    lock.lock();
+    itsNPending--;
+    if (itsNPending == 0) {
+      itsDoneCond.notify_all();
+    }
+  }
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,199 @@
+//# TableIOQueue.h: Ordered asynchronous execution of table I/O
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TABLEIOQUEUE_H
+#define TABLES_TABLEIOQUEUE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// Ordered asynchronous execution of table I/O
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTableIOQueue" demos="">
+// </reviewed>
+
+// <synopsis>
+// TableIOQueue executes table I/O requests in a single background thread
+// in the order in which they were submitted. It is used by the
+// <src>getXXXAsync</src> functions of
+// <linkto class="ScalarColumn">ScalarColumn</linkto> and
+// <linkto class="ArrayColumn">ArrayColumn</linkto>, which return a
+// std::future for the data. Because all requests go through one queue,
+// requests on the same column (and on the same table) are done one at a
+// time and complete in submission order.
+//
+// The table system is not thread-safe. While requests are outstanding,
+// the tables involved must not be accessed directly (from any thread);
+// get the futures or call <src>wait</src> first. Requests on different
+// tables are serialized as well, so they can share storage managers
+// (e.g. a reference table and its parent).
+//
+// Other table operations (e.g. reading several columns at once, or a
+// put) can be submitted with <src>submit</src>.
+// </synopsis>
+
+// <example>
+// Process the DATA column of an MS in chunks of 1000 rows, where the
+// next chunk is read while the current one is processed.
+// <srcblock>
+//   ArrayColumn<Complex> dataCol(ms, "DATA");
+//   rownr_t nrow = ms.nrow();
+//   std::future<Array<Complex>> next =
+//       dataCol.getColumnRangeAsync (Slicer(IPosition(1,0),
+//                                           IPosition(1,std::min(nrow,rownr_t(1000)))));
+//   for (rownr_t st=0; st<nrow; st+=1000) {
+//     Array<Complex> data = next.get();
+//     rownr_t nst = st + 1000;
+//     if (nst < nrow) {
+//       next = dataCol.getColumnRangeAsync
+//         (Slicer(IPosition(1,nst), IPosition(1,std::min(nrow-nst,rownr_t(1000)))));
+//     }
+//     process (data);
+//   }
+// </srcblock>
+// </example>
+
+// <motivation>
+// The column get functions are blocking. Overlapping I/O and computation
+// required every application to write its own thread handling.
+// </motivation>
+
+class TableIOQueue
+{
+public:
+  // Create the queue. Its thread is started at the first request.
+  TableIOQueue();
+
+  // Wait for all requests to finish and stop the thread.
+  ~TableIOQueue();
+
+  // Copying is not possible.
+  // <group>
+  TableIOQueue (const TableIOQueue&) = delete;
+  TableIOQueue& operator= (const TableIOQueue&) = delete;
+  // </group>
+
+  // Get the queue used by the column get functions.
+  static TableIOQueue& global();
+
+  // Submit a request. The returned future gives its result (or exception).
+  // The function object (and the objects it holds, such as a Table) is
+  // destroyed before the result is made available.
+  template<typename Func>
+  auto submit (Func func) -> std::future<decltype(func())>
+  {
+    typedef decltype(func()) Result;
+    auto request = std::make_shared<Request<Func,Result>> (std::move(func));
+    std::future<Result> result = request->promise.get_future();
+    push ([request]() { request->run(); });
+    return result;
+  }
+
+  // Wait until all submitted requests are done.
+  void wait();
+
+  // Get the number of requests submitted but not done yet.
+  size_t nrPending() const;
+
+private:
+  typedef std::function<void()> Task;
+
+  // A request holding the function and the promise for its result.
+  // <group>
+  template<typename Func, typename Result>
+  struct Request
+  {
+    explicit Request (Func&& f)
+      : func (new Func(std::move(f)))
+    {}
+    void run()
+    {
+      try {
+        Result res = (*func)();
+        func.reset();
+        promise.set_value (std::move(res));
+      } catch (...) {
+        func.reset();
+        promise.set_exception (std::current_exception());
+      }
+    }
+    std::unique_ptr<Func> func;
+    std::promise<Result>  promise;
+  };
+  template<typename Func>
+  struct Request<Func,void>
+  {
+    explicit Request (Func&& f)
+      : func (new Func(std::move(f)))
+    {}
+    void run()
+    {
+      try {
+        (*func)();
+        func.reset();
+        promise.set_value();
+      } catch (...) {
+        func.reset();
+        promise.set_exception (std::current_exception());
+      }
+    }
+    std::unique_ptr<Func> func;
+    std::promise<void>    promise;
+  };
+  // </group>
+
+  // Add a task to the queue and start the thread if needed.
+  void push (Task task);
+
+  // The loop executed by the thread.
+  void run();
+
+  std::deque<Task>        itsTasks;
+  std::thread             itsThread;
+  mutable std::mutex      itsMutex;
+  std::condition_variable itsCond;      //# signals a new task or stop
+  std::condition_variable itsDoneCond;  //# signals that a task is done
+  size_t                  itsNPending;  //# queued plus executing tasks
+  Bool                    itsStop;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -135,6 +135,12 @@ TableIterator::copyState(const TableIterator &other)
     tabIterPtr_p->copyState(*other.tabIterPtr_p);
 }
 
+void TableIterator::setProjection (const Block<String>& columnNames)
+{
+    tabIterPtr_p->setProjection (columnNames);
+    next();
+}
+
 // Report Name of slowest column that changes at end of current iteration
 const String& TableIterator::keyChangeAtLastNext() const
 { 
@@ -74,6 +74,9 @@ template<class T> class Block;
 //
 // The table is sorted before doing the iteration unless TableIterator::NoSort
 // is given.
+// <br>By default the subtables contain all columns of the table. If only
+// a few columns are used, function <src>setProjection</src> can be used
+// to limit the subtables to those columns.
 // </synopsis> 
 
 // <example>
@@ -213,6 +216,15 @@ public:
 
     void copyState(const TableIterator &);
 
+    // Declare the columns the caller will use from the iteration subtables.
+    // Thereafter each subtable only contains these columns and the iteration
+    // columns, so no column objects are created for the other columns,
+    // which lowers the per-iteration overhead for tables with many columns.
+    // Note that a subtable still references the original table, so its
+    // columns can be read efficiently using <src>getColumn</src>.
+    // The iteration is restarted.
+    void setProjection (const Block<String>& columnNames);
+
     // Report Name of slowest column that changes at end of current iteration
     const String& keyChangeAtLastNext() const;
 
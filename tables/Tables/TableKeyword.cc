@@ -176,6 +176,17 @@ void TableKeyword::flush (Bool fsync) const
     }
 }
 
+BaseTable* TableKeyword::openWritableTable() const
+{
+    if (attr_p.openWritable()) {
+        if (!table_p->isNull()) {
+	    return table_p->baseTablePtr();
+	}
+        return PlainTable::tableCache()(attr_p.name());
+    }
+    return 0;
+}
+
 Bool TableKeyword::conform (const TableKeyword& that) const
 {
     // Only check for conformance if a description is fixed.
@@ -35,6 +35,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
 class Table;
+class BaseTable;
 
 
 // <summary>
@@ -188,6 +189,10 @@ public:
     // Flush and optionally fsync the table.
     void flush (Bool fsync) const;
 
+    // Get the table if it is opened for write, here or elsewhere (thus in
+    // the TableCache). A null pointer is returned otherwise.
+    BaseTable* openWritableTable() const;
+
     // Rename the table if its path contains the old parent table name.
     void renameTable (const String& newParentName,
 		      const String& oldParentName);
@@ -137,5 +137,12 @@ Bool TableLock::lockingDisabled()
 #endif
 }
 
+Bool TableLock::hostSyncEnabled()
+{
+  Bool opt;
+  AipsrcValue<Bool>::find (opt, "table.lock.hostsync", False);
+  return opt;
+}
+
 } //# NAMESPACE CASACORE - END
 
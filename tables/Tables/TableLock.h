@@ -57,6 +57,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //
 // It is possible to disable locking by building casacore with -DAIPS_TABLE_NOLOCKING
 // or by setting the aipsrc variable table.nolocking=true.
+// <p>
+// If all processes accessing a table run on the same host, the aipsrc
+// variable table.lock.hostsync=true can be set. In that case a change
+// counter in shared memory tells if another process has changed the table,
+// so the synchronization info in the lock file is only read if needed.
+// This makes acquiring a lock considerably cheaper, in particular on
+// network file systems. It must not be used if the table is written by
+// processes on other hosts.
 
 // <motivation> 
 // Encapsulate Table locking info.
@@ -163,6 +171,10 @@ public:
     // Is table locking disabled (because AIPS_TABLE_NOLOCKING or table.nolocking is set)?
     static Bool lockingDisabled();
 
+    // Is the shared memory change counter used (because table.lock.hostsync
+    // is set)?
+    static Bool hostSyncEnabled();
+
 
 private:
     LockOption  itsOption;
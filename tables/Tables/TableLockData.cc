@@ -57,6 +57,10 @@ void TableLockData::makeLock (const String& name, Bool create,
 	itsLock = new LockFile (name + "/table.lock", interval(), create,
 				True, False, locknr, isPermanent(),
                                 option() == NoLocking);
+        //# Use the shared change counter if all processes are on this host.
+        if (option() != NoLocking  &&  TableLock::hostSyncEnabled()) {
+            itsLock->enableSharedCounter();
+        }
     }
     //# Acquire a lock when permanent locking is in use.
     if (isPermanent()) {
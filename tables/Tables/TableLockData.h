@@ -119,6 +119,10 @@ public:
     void putInfo (const MemoryIO& info);
     // </group>
 
+    // Did the last acquire skip reading the info, because the shared change
+    // counter tells nothing has changed?
+    Bool infoUnchanged() const;
+
 private:
     //# Define the lock file.
     LockFile*        itsLock;
@@ -152,6 +156,10 @@ inline void TableLockData::putInfo (const MemoryIO& info)
 {
     itsLock->putInfo (info);
 }
+inline Bool TableLockData::infoUnchanged() const
+{
+    return (itsLock == 0  ?  False : itsLock->infoUnchanged());
+}
 
 
 
@@ -0,0 +1,190 @@
+//# TablePool.cc: Pool of recently used open tables
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TablePool.h>
+#include <casacore/tables/Tables/TableUtil.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/OS/Path.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <iterator>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TablePool::TablePool (uInt maxSize)
+: itsMaxSize  (maxSize),
+  itsNHits    (0),
+  itsNMisses  (0)
+{}
+
+TablePool::~TablePool()
+{}
+
+TablePool& TablePool::pool()
+{
+    static TablePool thePool ([]() {
+        uInt maxSize;
+        AipsrcValue<uInt>::find (maxSize, "table.poolsize", 32);
+        return maxSize;
+      }());
+    return thePool;
+}
+
+String TablePool::makeKey (const String& tableName)
+{
+    return Path(tableName).absoluteName();
+}
+
+Table TablePool::open (const String& tableName,
+                       const TableLock& lockOptions,
+                       Table::TableOption option)
+{
+    if (option != Table::Old  &&  option != Table::Update) {
+        throw TableError ("TablePool::open: only options Old and Update "
+                          "can be used for table " + tableName);
+    }
+    String key = makeKey (tableName);
+    Table tab;
+    String name;
+    {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        auto iter = itsMap.find (key);
+        if (iter != itsMap.end()) {
+            // Move the table to the front of the list.
+            itsTables.splice (itsTables.begin(), itsTables, iter->second);
+            tab  = iter->second->table;
+            name = iter->second->name;
+            itsNHits++;
+        } else {
+            itsNMisses++;
+        }
+    }
+    // A table deleted or renamed elsewhere is not valid anymore.
+    if (!tab.isNull()  &&
+        (tab.isMarkedForDelete()  ||  tab.tableName() != name)) {
+        release (key);
+        tab = Table();
+    }
+    if (!tab.isNull()) {
+        if (option == Table::Update  &&  !tab.isWritable()) {
+            tab.reopenRW();
+        }
+        return tab;
+    }
+    // Open the table without holding the mutex.
+    tab = TableUtil::openTable (key, lockOptions, option);
+    TableList removed;
+    {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        // Another thread might have added the table in the meantime.
+        if (itsMap.find (key) == itsMap.end()) {
+            itsTables.push_front (Entry{key, tab.tableName(), tab});
+            itsMap[key] = itsTables.begin();
+            evict (removed);
+        }
+    }
+    // The removed tables are closed (if not used elsewhere) when going
+    // out of scope, thus after the mutex has been released.
+    return tab;
+}
+
+void TablePool::evict (TableList& removed)
+{
+    while (itsTables.size() > itsMaxSize) {
+        itsMap.erase (itsTables.back().key);
+        removed.splice (removed.begin(), itsTables, std::prev(itsTables.end()));
+    }
+}
+
+void TablePool::release (const String& tableName)
+{
+    TableList removed;
+    {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        auto iter = itsMap.find (makeKey(tableName));
+        if (iter != itsMap.end()) {
+            removed.splice (removed.begin(), itsTables, iter->second);
+            itsMap.erase (iter);
+        }
+    }
+}
+
+void TablePool::clear()
+{
+    TableList removed;
+    {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        removed.swap (itsTables);
+        itsMap.clear();
+    }
+}
+
+uInt TablePool::maxSize() const
+{
+    std::lock_guard<std::mutex> lock(itsMutex);
+    return itsMaxSize;
+}
+
+void TablePool::setMaxSize (uInt maxSize)
+{
+    TableList removed;
+    {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        itsMaxSize = maxSize;
+        evict (removed);
+    }
+}
+
+uInt TablePool::size() const
+{
+    std::lock_guard<std::mutex> lock(itsMutex);
+    return itsTables.size();
+}
+
+Vector<String> TablePool::tableNames() const
+{
+    std::lock_guard<std::mutex> lock(itsMutex);
+    Vector<String> names(itsTables.size());
+    uInt i = 0;
+    for (const auto& x : itsTables) {
+        names[i++] = x.key;
+    }
+    return names;
+}
+
+uInt64 TablePool::nHits() const
+{
+    std::lock_guard<std::mutex> lock(itsMutex);
+    return itsNHits;
+}
+
+uInt64 TablePool::nMisses() const
+{
+    std::lock_guard<std::mutex> lock(itsMutex);
+    return itsNMisses;
+}
+
+} //# NAMESPACE CASACORE - END
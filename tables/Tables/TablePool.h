@@ -0,0 +1,179 @@
+//# TablePool.h: Pool of recently used open tables
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TABLEPOOL_H
+#define TABLES_TABLEPOOL_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableLock.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <casacore/casa/BasicSL/String.h>
+
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Pool of recently used open tables
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTablePool">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> Table
+//   <li> TableCache
+// </prerequisite>
+
+// <synopsis>
+// TablePool keeps tables open after their last user has released them,
+// so reopening such a table is cheap. A table is kept open with its data
+// managers and bucket caches, so data read before can be read again
+// without IO.
+// <br>The pool holds at most <src>maxSize</src> tables. When it gets full,
+// the least recently opened table is removed from the pool. That table
+// is only closed if it is not used elsewhere in the process.
+//
+// A process-wide pool can be obtained with the static function
+// <src>TablePool::pool()</src>. Its size is initially set from aipsrc
+// variable <src>table.poolsize</src> (default 32).
+// Other pools can be constructed as needed.
+//
+// All functions are thread-safe. The Table objects handed out by the pool
+// can be used in multiple threads, but as usual concurrent access to the
+// same table has to be synchronized by the caller.
+// Opening a table is done without holding the pool's mutex, so opening
+// different tables can be done in parallel.
+//
+// Note that a table in the pool keeps its locks according to its lock
+// options. Usually tables should be opened with AutoLocking or
+// AutoNoReadLocking, so other processes can still update the tables.
+// A table opened for update is kept writable; if a table is requested
+// for update while it is readonly in the pool, it is reopened read/write.
+// </synopsis>
+
+// <example>
+// <srcblock>
+// // Each request opens the table through the pool, so only the first
+// // request actually opens it.
+// Table tab = TablePool::pool().open ("my.ms",
+//                                     TableLock(TableLock::AutoNoReadLocking));
+// </srcblock>
+// </example>
+
+// <motivation>
+// Services handling many short requests on the same tables spend most
+// of their time in opening and closing the tables.
+// </motivation>
+
+class TablePool
+{
+public:
+    // Create a pool holding at most the given number of tables.
+    explicit TablePool (uInt maxSize);
+
+    // Closes the tables in the pool (if not used elsewhere).
+    ~TablePool();
+
+    // The copy constructor and assignment are forbidden.
+    TablePool (const TablePool&) = delete;
+    TablePool& operator= (const TablePool&) = delete;
+
+    // Get the process-wide pool.
+    static TablePool& pool();
+
+    // Open a table through the pool. If already in the pool, that table
+    // is returned and moved to the front of the LRU list. Otherwise the
+    // table is opened using <src>TableUtil::openTable</src> (thus the name
+    // can contain subtable names using ::) and added to the pool.
+    // Only Table::Old and Table::Update are valid options.
+    Table open (const String& tableName,
+                const TableLock& lockOptions = TableLock(),
+                Table::TableOption = Table::Old);
+
+    // Remove a table from the pool. Nothing is done if not in the pool.
+    // The table is closed if not used elsewhere.
+    void release (const String& tableName);
+
+    // Remove all tables from the pool.
+    void clear();
+
+    // Get or set the maximum number of tables in the pool.
+    // Reducing the size removes the least recently opened tables.
+    // A size of 0 means that no tables are kept.
+    // <group>
+    uInt maxSize() const;
+    void setMaxSize (uInt maxSize);
+    // </group>
+
+    // Get the number of tables in the pool.
+    uInt size() const;
+
+    // Get the names of the tables in the pool, most recently opened first.
+    Vector<String> tableNames() const;
+
+    // Get the number of opens that found the table in the pool or not.
+    // <group>
+    uInt64 nHits() const;
+    uInt64 nMisses() const;
+    // </group>
+
+private:
+    // A table in the pool with its key and the name it had when opened.
+    struct Entry {
+        String key;
+        String name;
+        Table  table;
+    };
+    typedef std::list<Entry> TableList;
+
+    // Make the key of a table name.
+    static String makeKey (const String& tableName);
+
+    // Remove the least recently used tables exceeding the maximum size.
+    // They are moved to the given list, so they can be closed after
+    // the mutex has been released.
+    void evict (TableList& removed);
+
+    //# The tables with the most recently used first.
+    TableList                                  itsTables;
+    std::map<String, TableList::iterator>      itsMap;
+    uInt                                       itsMaxSize;
+    uInt64                                     itsNHits;
+    uInt64                                     itsNMisses;
+    mutable std::mutex                         itsMutex;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
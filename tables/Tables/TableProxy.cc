@@ -894,6 +894,16 @@ Record TableProxy::getDataManagerInfo()
   return table_p.dataManagerInfo();
 }
 
+Record TableProxy::getIOStatistics()
+{
+  return table_p.ioStatistics();
+}
+
+void TableProxy::setIOStatistics (Bool enable)
+{
+  Table::setIOStatistics (enable);
+}
+
 Record TableProxy::getProperties (const String& name, Bool byColumn)
 {
   RODataManAccessor acc (table_p, name, byColumn);
@@ -554,6 +554,12 @@ public:
   // Get the data manager info of the table.
   Record getDataManagerInfo();
 
+  // Get the IO statistics of the columns and data managers of the table.
+  Record getIOStatistics();
+
+  // Enable or disable collecting IO statistics for all tables.
+  static void setIOStatistics (Bool enable);
+
   // Get the properties of a data manager given by column or data manager name.
   Record getProperties (const String& name, Bool byColumn);
 
@@ -32,6 +32,7 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <utility>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -108,6 +109,36 @@ TableRecord::TableRecord (const RecordInterface& other)
   }
 }
 
+// The representation given to a moved-from record. It is shared, so
+// moving a record does not need to allocate a new representation.
+static const COWPtr<TableRecordRep>& emptyRepForMove()
+{
+    static COWPtr<TableRecordRep> rep(new TableRecordRep);
+    return rep;
+}
+
+TableRecord::TableRecord (TableRecord&& other)
+: RecordInterface (other),
+  rep_p    (emptyRepForMove()),
+  parent_p (other.parent_p)
+{
+    std::swap (rep_p, other.rep_p);
+}
+
+TableRecord& TableRecord::operator= (TableRecord&& other)
+{
+    if (this != &other) {
+	if (! isFixed()  ||  nfields() == 0) {
+	    // Give the other record an empty representation.
+	    rep_p = other.rep_p;
+	    other.rep_p = emptyRepForMove();
+	}else{
+	    *this = static_cast<const TableRecord&>(other);
+	}
+    }
+    return *this;
+}
+
 TableRecord& TableRecord::operator= (const TableRecord& other)
 {
     // Assignment is only possible when the Record is empty or
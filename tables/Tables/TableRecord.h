@@ -213,6 +213,9 @@ public:
     // Create a copy of other using copy semantics.
     TableRecord (const TableRecord& other);
 
+    // Move constructor. The other record is left empty.
+    TableRecord (TableRecord&& other);
+
     // Create a TableRecord from another type of record.
     // It uses copy-on-write semantics if possible (i.e. if
     // <src>other</src> is a TableRecord), otherwise each field is copied.
@@ -240,6 +243,12 @@ public:
     // be copied.
     // </note>
     TableRecord& operator= (const TableRecord& other);
+
+    // Move assignment. For a variable structured (or empty) record it takes
+    // over the representation of the other record, thus avoids that the
+    // data have to be copied when either record is changed thereafter.
+    // For a fixed structured record it is the same as copy assignment.
+    TableRecord& operator= (TableRecord&& other);
     
     // Release resources associated with this object.
     ~TableRecord();
@@ -397,6 +406,9 @@ public:
     // Flush all open subtables.
     void flushTables (Bool fsync=False) const;
 
+    // Add the open subtables to be flushed to the vector.
+    void getFlushTables (std::vector<BaseTable*>& tables) const;
+
     // Rename the subtables with a path containing the old parent table name.
     void renameTables (const String& newParentName,
 		       const String& oldParentName);
@@ -549,6 +561,11 @@ inline void TableRecord::flushTables (Bool fsync) const
     ref().flushTables (fsync);
 }
 
+inline void TableRecord::getFlushTables (std::vector<BaseTable*>& tables) const
+{
+    ref().getFlushTables (tables);
+}
+
 inline void TableRecord::renameTables (const String& newParentName,
 				       const String& oldParentName)
 {
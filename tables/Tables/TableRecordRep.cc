@@ -55,7 +55,7 @@ TableRecordRep::TableRecordRep (const TableRecordRep& other)
   desc_p   (other.desc_p)
 {
     restructure (desc_p, False);
-    copy_other (other);
+    copy_other (other, True);
 }
 
 TableRecordRep& TableRecordRep::operator= (const TableRecordRep& other)
@@ -235,7 +235,8 @@ void TableRecordRep::copyData (const TableRecordRep& other)
     copy_other (other);
 }
 
-void TableRecordRep::copy_other (const TableRecordRep& other)
+void TableRecordRep::copy_other (const TableRecordRep& other,
+                                 Bool shareArrays)
 {
     for (uInt i=0; i<nused_p; i++) {
 	if (desc_p.type(i) == TpRecord) {
@@ -244,6 +245,8 @@ void TableRecordRep::copy_other (const TableRecordRep& other)
 	} else if (desc_p.type(i) == TpTable) {
 	    *static_cast<TableKeyword*>(data_p[i]) =
 	      *static_cast<TableKeyword*>(const_cast<void*>(other.data_p[i]));
+	} else if (shareArrays) {
+	    shareDataField (desc_p.type(i), data_p[i], other.data_p[i]);
 	}else{
 	    copyDataField (desc_p.type(i), data_p[i], other.data_p[i]);
 	}
@@ -363,6 +366,20 @@ void TableRecordRep::flushTables (Bool fsync) const
 }
 
 
+void TableRecordRep::getFlushTables (std::vector<BaseTable*>& tables) const
+{
+    for (uInt i=0; i<nused_p; i++) {
+	if (desc_p.type(i) == TpTable) {
+	    BaseTable* tab = static_cast<TableKeyword*>
+                               (const_cast<void*>(data_p[i]))->openWritableTable();
+	    if (tab) {
+	        tables.push_back (tab);
+	    }
+	}
+    }
+}
+
+
 Bool TableRecordRep::areTablesMultiUsed() const
 {
     for (uInt i=0; i<nused_p; i++) {
@@ -475,6 +492,7 @@ void TableRecordRep::getData (AipsIO& os, uInt version,
 	    os >> name;
 	    static_cast<TableKeyword*>(data_p[i])->set (name, parentAttr);
 	}else{
+	    detachDataField (desc_p.type(i), data_p[i]);
 	    getDataField (os, desc_p.type(i), data_p[i]);
 	}
     }
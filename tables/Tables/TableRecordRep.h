@@ -29,12 +29,14 @@
 
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Containers/RecordRep.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
 class TableRecord;
 class TableAttr;
+class BaseTable;
 
 
 // <summary>
@@ -174,6 +176,9 @@ public:
     // Flush all open subtables.
     void flushTables (Bool fsync) const;
 
+    // Add the open subtables to be flushed to the vector.
+    void getFlushTables (std::vector<BaseTable*>& tables) const;
+
     // Rename the subtables with a path containing the old parent table name.
     void renameTables (const String& newParentName,
 		       const String& oldParentName);
@@ -231,7 +236,9 @@ public:
 protected:
     // Utility function to avoid code duplication in the public member 
     // functions.
-    void copy_other (const TableRecordRep& other);
+    // Array fields share their storage if <src>shareArrays=True</src>
+    // (see RecordRep::copy_other).
+    void copy_other (const TableRecordRep& other, Bool shareArrays = False);
 
     // Get the field number for a given name.
     virtual Int fieldNumber (const String& name) const;
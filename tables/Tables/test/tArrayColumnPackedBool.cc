@@ -0,0 +1,191 @@
+//# tArrayColumnPackedBool.cc: Test program for packed Bool access in ArrayColumn
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/OS/Conversion.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+using namespace casacore;
+
+// This program tests getting and putting Bool arrays as packed bits.
+
+const IPosition fixedShape(2,3,7);
+
+Array<Bool> makeFlags (const IPosition& shape, uInt row)
+{
+  Array<Bool> arr(shape);
+  Bool* data = arr.data();
+  for (size_t i=0; i<arr.size(); ++i) {
+    data[i] = (i*7 + row) % 5 < 2;
+  }
+  return arr;
+}
+
+IPosition varShape (uInt row)
+{
+  return IPosition(1, 5 + row%13);
+}
+
+// Check the packed bits against the expected array.
+void checkBits (const Vector<uChar>& bits, const Array<Bool>& exp)
+{
+  AlwaysAssertExit (bits.size() == (exp.size() + 7) / 8);
+  Vector<Bool> flags(exp.size());
+  Conversion::bitToBool (flags.data(), bits.data(), flags.size());
+  AlwaysAssertExit (allEQ (flags, exp.reform(IPosition(1,exp.size()))));
+  // Unused bits must be zero.
+  if (exp.size() % 8 != 0) {
+    AlwaysAssertExit ((bits[bits.size()-1] >> (exp.size() % 8)) == 0);
+  }
+}
+
+void createTab (uInt nrow)
+{
+  TableDesc td("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Bool>("FLAG", fixedShape,
+                                      ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Bool>("VFLAG"));
+  td.addColumn (ScalarColumnDesc<Int>("ID"));
+  td.addColumn (ArrayColumnDesc<Int>("IARR", fixedShape,
+                                     ColumnDesc::FixedShape));
+  SetupNewTable newtab("tArrayColumnPackedBool_tmp.data", td, Table::New);
+  // Use a small bucket to have multiple buckets.
+  StandardStMan ssm(256);
+  newtab.bindAll (ssm);
+  Table tab(newtab, nrow);
+  ArrayColumn<Bool> flag(tab, "FLAG");
+  ArrayColumn<Bool> vflag(tab, "VFLAG");
+  ScalarColumn<Int> id(tab, "ID");
+  for (uInt i=0; i<nrow; ++i) {
+    // Put the fixed shaped flags alternately packed and unpacked.
+    if (i%2 == 0) {
+      flag.put (i, makeFlags(fixedShape, i));
+    } else {
+      Vector<uChar> bits((fixedShape.product() + 7) / 8);
+      Array<Bool> arr = makeFlags(fixedShape, i);
+      Conversion::boolToBit (bits.data(), arr.data(), arr.size());
+      flag.putPackedBool (i, fixedShape, bits);
+    }
+    Vector<uChar> vbits((varShape(i).product() + 7) / 8);
+    Array<Bool> varr = makeFlags(varShape(i), i);
+    Conversion::boolToBit (vbits.data(), varr.data(), varr.size());
+    vflag.putPackedBool (i, varShape(i), vbits);
+    id.put (i, i);
+  }
+}
+
+void checkTab (uInt nrow)
+{
+  Table tab("tArrayColumnPackedBool_tmp.data");
+  ArrayColumn<Bool> flag(tab, "FLAG");
+  ArrayColumn<Bool> vflag(tab, "VFLAG");
+  ScalarColumn<Int> id(tab, "ID");
+  AlwaysAssertExit (tab.nrow() == nrow);
+  Vector<uChar> bits;
+  for (uInt i=0; i<nrow; ++i) {
+    uInt row = id(i);
+    AlwaysAssertExit (allEQ (flag(i), makeFlags(fixedShape, row)));
+    flag.getPackedBool (i, bits);
+    checkBits (bits, makeFlags(fixedShape, row));
+    AlwaysAssertExit (allEQ (vflag(i), makeFlags(varShape(row), row)));
+    checkBits (vflag.getPackedBool(i), makeFlags(varShape(row), row));
+  }
+  // Packed access through a reference table.
+  Table sel = tab(tab.col("ID") % 3 == 0);
+  ArrayColumn<Bool> selFlag(sel, "FLAG");
+  ScalarColumn<Int> selId(sel, "ID");
+  for (uInt i=0; i<sel.nrow(); ++i) {
+    checkBits (selFlag.getPackedBool(i), makeFlags(fixedShape, selId(i)));
+  }
+  // A non-Bool column cannot be accessed packed.
+  Bool ok = False;
+  try {
+    ArrayColumn<Int>(tab, "IARR").getPackedBool (0);
+  } catch (const TableInvDT&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+}
+
+void removeRows()
+{
+  // Removing rows shifts the packed bits in the buckets.
+  Table tab("tArrayColumnPackedBool_tmp.data", Table::Update);
+  tab.removeRow (5);
+  tab.removeRow (0);
+  tab.removeRow (tab.nrow() - 1);
+}
+
+void testTiled (uInt nrow)
+{
+  // A tiled storage manager uses the default (unpacking) implementation.
+  TableDesc td("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Bool>("FLAG", fixedShape,
+                                      ColumnDesc::FixedShape));
+  SetupNewTable newtab("tArrayColumnPackedBool_tmp.tiled", td, Table::New);
+  TiledColumnStMan tsm("TSM", IPosition(3,3,7,4));
+  newtab.bindAll (tsm);
+  Table tab(newtab, nrow);
+  ArrayColumn<Bool> flag(tab, "FLAG");
+  for (uInt i=0; i<nrow; ++i) {
+    Vector<uChar> bits((fixedShape.product() + 7) / 8);
+    Array<Bool> arr = makeFlags(fixedShape, i);
+    Conversion::boolToBit (bits.data(), arr.data(), arr.size());
+    flag.putPackedBool (i, fixedShape, bits);
+  }
+  for (uInt i=0; i<nrow; ++i) {
+    AlwaysAssertExit (allEQ (flag(i), makeFlags(fixedShape, i)));
+    checkBits (flag.getPackedBool(i), makeFlags(fixedShape, i));
+  }
+}
+
+int main()
+{
+  try {
+    createTab (50);
+    checkTab (50);
+    removeRows();
+    checkTab (47);
+    testTiled (10);
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
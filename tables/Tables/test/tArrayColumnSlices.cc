@@ -29,11 +29,14 @@
 #include <casacore/tables/Tables/ArrColDesc.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayView.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Arrays/Slice.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <vector>
 
 using namespace casacore;
 
@@ -109,6 +112,31 @@ void readCellSlices()
   }
 }
 
+void readIntoView()
+{
+  Table tab("tArrayColumnSlices_tmp.data");
+  ArrayColumn<float> arr1(tab, "arr1");
+  Slicer slicer(IPosition(2,2,1), IPosition(2,8,6), IPosition(2,2,3));
+  // A contiguous view on foreign memory.
+  std::vector<float> buf(4*2);
+  ArrayView<float,2> view(buf.data(), {{4,2}});
+  // A strided view on the even rows of a matrix.
+  Matrix<float> mat(8,2, -1.f);
+  ArrayView<float,2> sview = ArrayView<float,2>(mat).section({{0,0}}, {{6,1}},
+                                                              {{2,1}});
+  for (uInt i=0; i<tab.nrow(); ++i) {
+    Array<float> exp = arr1.getSlice(i, slicer);
+    arr1.getSlice (i, slicer, view);
+    arr1.getSlice (i, slicer, sview);
+    AlwaysAssertExit (allEQ (view.copy(), exp));
+    AlwaysAssertExit (allEQ (sview.copy(), exp));
+    AlwaysAssertExit (mat(1,0) == -1.f);
+    Matrix<float> full(20,30);
+    arr1.get (i, ArrayView<float,2>(full));
+    AlwaysAssertExit (allEQ (full, arr1(i)));
+  }
+}
+
 void readColumnSlices()
 {
   Table tab("tArrayColumnSlices_tmp.data");
@@ -189,6 +217,7 @@ int main()
   try {
     createTab();
     readCellSlices();
+    readIntoView();
     readColumnSlices();
     writeCellSlices();
     writeColumnSlices();
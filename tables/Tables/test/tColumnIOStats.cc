@@ -0,0 +1,151 @@
+//# tColumnIOStats.cc: Test program for the column IO statistics
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/Tables/ColumnIOStats.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for the IO statistics of columns and data managers.
+// </summary>
+
+void makeTable (rownr_t nrrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ArrayColumnDesc<Float>("arr", IPosition(2,4,8),
+                                       ColumnDesc::FixedShape));
+  SetupNewTable newtab("tColumnIOStats_tmp.tab", td, Table::New);
+  StandardStMan ssm("SSM", 512);
+  newtab.bindColumn ("ci", ssm);
+  TiledShapeStMan tsm("TSM", IPosition(3,4,8,16));
+  newtab.bindColumn ("arr", tsm);
+  Table tab(newtab, nrrow);
+  ScalarColumn<Int> ci(tab, "ci");
+  ArrayColumn<Float> arr(tab, "arr");
+  Array<Float> arrval(IPosition(2,4,8));
+  for (rownr_t i=0; i<nrrow; ++i) {
+    ci.put (i, i);
+    indgen (arrval, Float(i));
+    arr.put (i, arrval);
+  }
+}
+
+const Record& colStats (const Record& stats, const String& colName,
+                        const String& type)
+{
+  return stats.subRecord("COLUMNS").subRecord(colName).subRecord(type);
+}
+
+void checkCounts (const Record& rec, Int64 ncall, Int64 ncell, Int64 nbyte)
+{
+  AlwaysAssertExit (rec.asInt64("NCALL") == ncall);
+  AlwaysAssertExit (rec.asInt64("NCELL") == ncell);
+  AlwaysAssertExit (rec.asInt64("NBYTE") == nbyte);
+  Vector<Int64> hist = rec.asArrayInt64("HISTOGRAM");
+  AlwaysAssertExit (hist.size() == ColumnIOStats::NrHistBins);
+  AlwaysAssertExit (sum(hist) == ncall);
+}
+
+void doRead (rownr_t nrrow)
+{
+  Table tab("tColumnIOStats_tmp.tab");
+  ScalarColumn<Int> ci(tab, "ci");
+  ArrayColumn<Float> arr(tab, "arr");
+  // Nothing is collected if not enabled.
+  Table::setIOStatistics (False);
+  ci.get (0);
+  checkCounts (colStats (tab.ioStatistics(), "ci", "READ"), 0, 0, 0);
+  Table::setIOStatistics (True);
+  Vector<Int> vec = ci.getColumn();
+  AlwaysAssertExit (vec.size() == nrrow);
+  Vector<Int> cells = ci.getColumnCells (RefRows(10, 19));
+  AlwaysAssertExit (cells.size() == 10  &&  cells[0] == 10);
+  Array<Float> arrval = arr.get (1);
+  AlwaysAssertExit (arrval.data()[0] == 1);
+  Array<Float> allval = arr.getColumn();
+  Record stats = tab.ioStatistics();
+  checkCounts (colStats (stats, "ci", "READ"),
+               2, nrrow+10, (nrrow+10)*sizeof(Int));
+  checkCounts (colStats (stats, "ci", "WRITE"), 0, 0, 0);
+  checkCounts (colStats (stats, "arr", "READ"),
+               2, nrrow+1, (nrrow+1)*32*sizeof(Float));
+  // Check the data manager statistics.
+  const Record& dms = stats.subRecord("DATAMANAGERS");
+  AlwaysAssertExit (dms.nfields() == 2);
+  for (uInt i=0; i<dms.nfields(); ++i) {
+    const Record& dm = dms.subRecord(i);
+    const Record& cache = dm.subRecord("CACHE");
+    if (dm.asString("TYPE") == "StandardStMan") {
+      AlwaysAssertExit (dm.asArrayString("COLUMNS").data()[0] == "ci");
+      AlwaysAssertExit (cache.asInt64("BUCKETSIZE") == 512);
+    } else {
+      AlwaysAssertExit (dm.asString("NAME") == "TSM");
+      // The first hypercube of TiledShapeStMan can be an empty dummy.
+      const Record& cube = cache.subRecord(cache.nfields() - 1);
+      AlwaysAssertExit (cube.asArrayInt("TILESHAPE").data()[2] == 16);
+      AlwaysAssertExit (cube.asInt64("NACCESS") > 0);
+      AlwaysAssertExit (cube.asInt64("NBYTEREAD") > 0);
+    }
+  }
+  // A reference table gives the statistics of its parent.
+  Table sel = tab(tab.col("ci") < 10);
+  AlwaysAssertExit (colStats(sel.ioStatistics(), "ci", "READ")
+                    .asInt64("NCALL") >= 2);
+  Table::setIOStatistics (False);
+}
+
+int main()
+{
+  try {
+    const rownr_t nrrow = 100;
+    makeTable (nrrow);
+    doRead (nrrow);
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  } catch (...) {
+    cout << "Unexpected unknown exception" << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
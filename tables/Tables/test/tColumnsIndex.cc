@@ -34,10 +34,12 @@
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Containers/RecordField.h>
 #include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/OS/File.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/stdio.h>
+#include <sys/stat.h>
 
 
 #include <casacore/casa/namespace.h>
@@ -323,6 +325,87 @@ void d()
     cout << "<<<" << endl;
 }
 
+// Get the inode of a file to test if it is rewritten.
+ino_t inode (const String& name)
+{
+    struct stat sb;
+    AlwaysAssertExit (stat (name.chars(), &sb) == 0);
+    return sb.st_ino;
+}
+
+// Test a persistent index.
+void e()
+{
+    String name;
+    ino_t ino;
+    {
+        Table tab("tColumnsIndex_tmp.data");
+	ColumnsIndex colInx (tab, "adouble", 0, False, True);
+	name = colInx.persistentName();
+	AlwaysAssertExit (File(name).exists());
+	ino = inode(name);
+	// A second index uses the persistent one, so does not rewrite it.
+	ColumnsIndex colInx2 (tab, "adouble", 0, False, True);
+	AlwaysAssertExit (inode(name) == ino);
+	RecordFieldPtr<Double> adouble (colInx2.accessKey(), "adouble");
+	Bool found;
+	for (Int i=0; i<1000; i++) {
+	    *adouble = i;
+	    AlwaysAssertExit (Int(colInx2.getRowNumber(found)) == i  &&  found);
+	}
+	*adouble = 1000;
+	colInx2.getRowNumber (found);
+	AlwaysAssertExit (!found);
+    }
+    {
+        // Change the data, which invalidates the persistent index.
+        Table tab("tColumnsIndex_tmp.data", Table::Update);
+	ScalarColumn<Double> cdouble(tab, "adouble");
+	cdouble.put (3, 3333);
+	// A writable table does not use the persistent index.
+	ColumnsIndex colInx (tab, "adouble", 0, False, True);
+	AlwaysAssertExit (inode(name) == ino);
+    }
+    {
+        Table tab("tColumnsIndex_tmp.data");
+	ColumnsIndex colInx (tab, "adouble", 0, False, True);
+	AlwaysAssertExit (inode(name) != ino);
+	RecordFieldPtr<Double> adouble (colInx.accessKey(), "adouble");
+	Bool found;
+	*adouble = 3333;
+	AlwaysAssertExit (colInx.getRowNumber(found) == 3  &&  found);
+	*adouble = 3;
+	colInx.getRowNumber (found);
+	AlwaysAssertExit (!found);
+    }
+    // An index with a compare function or without read locking
+    // is not persistent.
+    {
+        Table tab("tColumnsIndex_tmp.data");
+        ColumnsIndex colInx (tab, stringToVector("adouble,afloat"),
+                             tcompare, False, True);
+        name = colInx.persistentName();
+        AlwaysAssertExit (! File(name).exists());
+    }
+    {
+        Table tab("tColumnsIndex_tmp.data", TableLock::NoLocking);
+        ColumnsIndex colInx (tab, "aint", 0, False, True);
+        name = colInx.persistentName();
+        AlwaysAssertExit (! File(name).exists());
+    }
+    {
+        Table tab("tColumnsIndex_tmp.data", TableLock::AutoNoReadLocking);
+        ColumnsIndex colInx (tab, "aint", 0, False, True);
+        AlwaysAssertExit (! File(name).exists());
+    }
+    {
+        // With read locking it is persistent.
+        Table tab("tColumnsIndex_tmp.data", TableLock::UserLocking);
+        ColumnsIndex colInx (tab, "aint", 0, False, True);
+        AlwaysAssertExit (File(name).exists());
+    }
+}
+
 int main()
 {
     try {
@@ -330,6 +413,7 @@ int main()
 	b();
 	c();
 	d();
+	e();
     } catch (std::exception& x) {
         cout << "Exception caught: " << x.what() << endl;
 	return 1;
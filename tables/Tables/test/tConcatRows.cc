@@ -71,6 +71,43 @@ void doIt()
   }
   AlwaysAssertExit (!ok);
 
+  // Check the vectorized mapping for ascending and random row numbers.
+  {
+    Vector<rownr_t> rownrs(25);
+    indgen (rownrs);
+    Vector<uInt> tabnrs;
+    Vector<rownr_t> tabrows;
+    rows.mapRownrs (tabnrs, tabrows, rownrs);
+    for (uInt i=0; i<25; ++i) {
+      AlwaysAssertExit (tabnrs[i] == (i<10 ? 0 : 1));
+      AlwaysAssertExit (tabrows[i] == (i<10 ? i : i-10));
+    }
+    rownrs.resize (5);
+    rownrs[0] = 24; rownrs[1] = 3; rownrs[2] = 12; rownrs[3] = 9;
+    rownrs[4] = 10;
+    rows.mapRownrs (tabnrs, tabrows, rownrs);
+    AlwaysAssertExit (tabnrs.size() == 5  &&  tabrows.size() == 5);
+    for (uInt i=0; i<5; ++i) {
+      rows.mapRownr (tabnr, rownr, rownrs[i]);
+      AlwaysAssertExit (tabnrs[i] == tabnr  &&  tabrows[i] == rownr);
+    }
+  }
+  {
+    // Empty tables in between must be skipped.
+    ConcatRows rows2;
+    rows2.add (3);
+    rows2.add (0);
+    rows2.add (2);
+    Vector<rownr_t> rownrs(5);
+    indgen (rownrs);
+    Vector<uInt> tabnrs;
+    Vector<rownr_t> tabrows;
+    rows2.mapRownrs (tabnrs, tabrows, rownrs);
+    AlwaysAssertExit (tabnrs[2] == 0  &&  tabrows[2] == 2);
+    AlwaysAssertExit (tabnrs[3] == 2  &&  tabrows[3] == 0);
+    AlwaysAssertExit (tabnrs[4] == 2  &&  tabrows[4] == 1);
+  }
+
   // Check if iteration is fine.
   {
     // Check for an empty object.
@@ -0,0 +1,152 @@
+//# tRefTableRuns.cc: Test program for RefTables keeping their rows as runs
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+using namespace casacore;
+
+// This program tests RefTables keeping their row numbers as runs
+// of consecutive rows and the set operations done on those runs.
+
+const rownr_t nrow = 10000;
+
+// Make the expected row numbers for rows in [st1,end1) and [st2,end2).
+Vector<rownr_t> makeRows (rownr_t st1, rownr_t end1,
+                          rownr_t st2=0, rownr_t end2=0)
+{
+  std::vector<rownr_t> rows;
+  for (rownr_t i=st1; i<end1; ++i) rows.push_back (i);
+  for (rownr_t i=st2; i<end2; ++i) rows.push_back (i);
+  return Vector<rownr_t>(rows);
+}
+
+// Check the row numbers and the ID values of a table.
+void checkRows (const Table& tab, const Vector<rownr_t>& exp)
+{
+  AlwaysAssertExit (tab.nrow() == exp.size());
+  AlwaysAssertExit (allEQ (tab.rowNumbers(), exp));
+  ScalarColumn<Int64> idCol(tab, "ID");
+  Vector<Int64> ids = idCol.getColumn();
+  for (rownr_t i=0; i<exp.size(); ++i) {
+    AlwaysAssertExit (ids[i] == Int64(exp[i]));
+    if (i % 97 == 0) {
+      AlwaysAssertExit (idCol(i) == Int64(exp[i]));
+    }
+  }
+  // Get a few cells using a sliced RefRows.
+  if (exp.size() > 10) {
+    Vector<Int64> cells = idCol.getColumnCells (RefRows(2, 10, 4));
+    AlwaysAssertExit (cells.size() == 3);
+    for (uInt i=0; i<3; ++i) {
+      AlwaysAssertExit (cells[i] == Int64(exp[2+4*i]));
+    }
+  }
+}
+
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int64>("ID"));
+  SetupNewTable newtab("tRefTableRuns_tmp.data", td, Table::New);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int64> idCol(tab, "ID");
+  for (rownr_t i=0; i<nrow; ++i) {
+    idCol.put (i, i);
+  }
+}
+
+void testSelect()
+{
+  Table tab("tRefTableRuns_tmp.data");
+  // Selections of a few runs.
+  Table sel1 = tab(tab.col("ID") >= 1000  &&  tab.col("ID") < 4000);
+  checkRows (sel1, makeRows(1000, 4000));
+  Table sel2 = tab(tab.col("ID") >= 3000  &&  tab.col("ID") < 6000);
+  // A scattered selection.
+  Table sel3 = tab(tab.col("ID") % 2 == 0);
+  AlwaysAssertExit (sel3.nrow() == nrow/2);
+  // Set operations on the runs.
+  Table tand = sel1 & sel2;
+  checkRows (tand, makeRows(3000, 4000));
+  Table tor = sel1 | sel2;
+  checkRows (tor, makeRows(1000, 6000));
+  Table tsub = sel1 - sel2;
+  checkRows (tsub, makeRows(1000, 3000));
+  Table txor = sel1 ^ sel2;
+  checkRows (txor, makeRows(1000, 3000, 4000, 6000));
+  Table tnot = !sel1;
+  checkRows (tnot, makeRows(0, 1000, 4000, nrow));
+  // Mixing runs and a scattered selection.
+  Table tmix = sel1 & sel3;
+  AlwaysAssertExit (tmix.nrow() == 1500);
+  AlwaysAssertExit (allEQ (tmix.rowNumbers(), (sel3 & sel1).rowNumbers()));
+  // A selection of a selection refers to the root table.
+  Table sel4 = tor(tor.col("ID") < 2000  ||  tor.col("ID") >= 5000);
+  checkRows (sel4, makeRows(1000, 2000, 5000, 6000));
+  // A projection of runs.
+  Table proj = tor.project (Block<String>(1, "ID"));
+  checkRows (proj, makeRows(1000, 6000));
+  // Removing a row from a selection of runs.
+  Table sel5 = tab(tab.col("ID") < 100);
+  sel5.removeRow (10);
+  checkRows (sel5, makeRows(0, 10, 11, 100));
+  // Writing and reading back a RefTable of runs.
+  txor.rename ("tRefTableRuns_tmp.ref", Table::New);
+}
+
+void testRead()
+{
+  Table tab("tRefTableRuns_tmp.ref");
+  checkRows (tab, makeRows(1000, 3000, 4000, 6000));
+  // A selection of the persistent table.
+  Table sel = tab(tab.col("ID") < 2000);
+  checkRows (sel, makeRows(1000, 2000));
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testSelect();
+    testRead();
+  } catch (std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;                           // exit with success status
+}
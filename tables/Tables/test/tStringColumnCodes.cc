@@ -0,0 +1,166 @@
+//# tStringColumnCodes.cc: Test program for dictionary encoded String columns
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/tables/DataMan/StringDictionary.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayUtil.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+using namespace casacore;
+
+// This program tests getting String columns as dictionary codes.
+
+// The values contain short (stored in the data bucket) and long
+// (stored in string buckets) strings.
+String makeValue (uInt row)
+{
+  static const char* values[] = {"", "ab", "abcdefgh", "abcdefghi",
+                                 "a rather long value for a string bucket"};
+  return values[(row*3) % 5];
+}
+
+// Check the codes against the values in the given rows.
+void checkCodes (const Vector<uInt>& codes, const Vector<String>& dict,
+                 const Vector<String>& exp)
+{
+  AlwaysAssertExit (codes.size() == exp.size());
+  for (uInt i=0; i<codes.size(); ++i) {
+    AlwaysAssertExit (codes[i] < dict.size());
+    AlwaysAssertExit (dict[codes[i]] == exp[i]);
+  }
+  // The dictionary values are distinct and in order of first appearance.
+  uInt next = 0;
+  for (uInt i=0; i<codes.size(); ++i) {
+    AlwaysAssertExit (codes[i] <= next);
+    if (codes[i] == next) ++next;
+  }
+  AlwaysAssertExit (next == dict.size());
+}
+
+void testDictionary()
+{
+  StringDictionary dict;
+  AlwaysAssertExit (dict.code("abc") == 0);
+  AlwaysAssertExit (dict.code("") == 1);
+  AlwaysAssertExit (dict.code("abc") == 0);
+  AlwaysAssertExit (dict.code("abcd", 3) == 0);
+  AlwaysAssertExit (dict.code(String("a\0b", 3)) == 2);
+  AlwaysAssertExit (dict.size() == 3);
+  Vector<String> values;
+  dict.getValues (values);
+  AlwaysAssertExit (values.size() == 3  &&  values[0] == "abc"  &&
+                    values[1] == ""  &&  values[2] == String("a\0b", 3));
+}
+
+void createTab (uInt nrow)
+{
+  TableDesc td("", "1", TableDesc::Scratch);
+  td.addColumn (ScalarColumnDesc<String>("NAME"));
+  td.addColumn (ScalarColumnDesc<String>("FIXNAME"));
+  td.rwColumnDesc("FIXNAME").setMaxLength (8);
+  td.addColumn (ScalarColumnDesc<String>("ISMNAME"));
+  td.addColumn (ScalarColumnDesc<Int>("ID"));
+  SetupNewTable newtab("tStringColumnCodes_tmp.data", td, Table::New);
+  // Use a small bucket to have multiple buckets.
+  StandardStMan ssm(256);
+  newtab.bindAll (ssm);
+  IncrementalStMan ism;
+  newtab.bindColumn ("ISMNAME", ism);
+  Table tab(newtab, nrow);
+  ScalarColumn<String> name(tab, "NAME");
+  ScalarColumn<String> fixname(tab, "FIXNAME");
+  ScalarColumn<String> ismname(tab, "ISMNAME");
+  ScalarColumn<Int> id(tab, "ID");
+  for (uInt i=0; i<nrow; ++i) {
+    name.put (i, makeValue(i));
+    // Fixed length strings are truncated to 8 characters.
+    fixname.put (i, makeValue(i).substr(0, 8));
+    ismname.put (i, makeValue(i/4));
+    id.put (i, i);
+  }
+}
+
+void checkTab()
+{
+  Table tab("tStringColumnCodes_tmp.data");
+  Vector<uInt> codes;
+  Vector<String> dict;
+  // Check all String columns (SSM indirect and fixed length, ISM).
+  Vector<String> names(stringToVector("NAME,FIXNAME,ISMNAME"));
+  for (uInt i=0; i<names.size(); ++i) {
+    TableColumn col(tab, names[i]);
+    col.getStringCodes (codes, dict);
+    checkCodes (codes, dict, ScalarColumn<String>(tab, names[i]).getColumn());
+    AlwaysAssertExit (dict.size() == (names[i] == "FIXNAME" ? 4 : 5));
+    // Some rows only.
+    RefRows rows(2, tab.nrow()-1, 7);
+    col.getStringCodes (rows, codes, dict);
+    checkCodes (codes, dict,
+                ScalarColumn<String>(tab, names[i]).getColumnCells(rows));
+  }
+  // Access through a reference table.
+  Table sel = tab(tab.col("ID") % 3 == 1);
+  TableColumn selName(sel, "NAME");
+  selName.getStringCodes (codes, dict);
+  checkCodes (codes, dict, ScalarColumn<String>(sel, "NAME").getColumn());
+  // An empty selection.
+  Table empty = tab(tab.col("ID") < 0);
+  TableColumn(empty, "NAME").getStringCodes (codes, dict);
+  AlwaysAssertExit (codes.empty()  &&  dict.empty());
+  // A non-String column cannot be encoded.
+  Bool ok = False;
+  try {
+    TableColumn(tab, "ID").getStringCodes (codes, dict);
+  } catch (const TableInvDT&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+}
+
+int main()
+{
+  try {
+    testDictionary();
+    createTab (100);
+    checkTab();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
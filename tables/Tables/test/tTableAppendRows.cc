@@ -0,0 +1,189 @@
+//# tTableAppendRows.cc: Test program for Table::appendRows
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for Table::appendRows
+// </summary>
+
+const IPosition cellShape(2, 2, 3);
+
+void createTable()
+{
+  TableDesc td("", "1", TableDesc::Scratch);
+  td.addColumn (ScalarColumnDesc<Int> ("ID"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<String> ("NAME"));
+  td.addColumn (ArrayColumnDesc<Float> ("DATA", cellShape,
+                                        ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Bool> ("FLAG"));
+  SetupNewTable newtab("tTableAppendRows_tmp.data", td, Table::New);
+  StandardStMan ssm(256);
+  IncrementalStMan ism;
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("TIME", ism);
+  Table tab(newtab);
+}
+
+// Make the record holding the values of nrow rows starting at the given row.
+Record makeRows (uInt startRow, uInt nrow)
+{
+  Vector<Int> ids(nrow);
+  Vector<Double> times(nrow);
+  Vector<String> names(nrow);
+  Cube<Float> data(cellShape[0], cellShape[1], nrow);
+  Matrix<Bool> flags(4, nrow);
+  for (uInt i=0; i<nrow; ++i) {
+    uInt row = startRow + i;
+    ids[i] = row;
+    times[i] = row / 10;
+    names[i] = "name" + String::toString(row);
+    Matrix<Float> plane(data.xyPlane(i));
+    indgen (plane, Float(10*row));
+    flags.column(i) = (row%2 == 0);
+  }
+  Record rec;
+  rec.define ("ID", ids);
+  rec.define ("TIME", times);
+  rec.define ("NAME", names);
+  rec.define ("DATA", data);
+  rec.define ("FLAG", flags);
+  return rec;
+}
+
+void checkRows (const Table& tab)
+{
+  ScalarColumn<Int> idCol(tab, "ID");
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  ScalarColumn<String> nameCol(tab, "NAME");
+  ArrayColumn<Float> dataCol(tab, "DATA");
+  ArrayColumn<Bool> flagCol(tab, "FLAG");
+  for (rownr_t row=0; row<tab.nrow(); ++row) {
+    AlwaysAssertExit (idCol(row) == Int(row));
+    AlwaysAssertExit (timeCol(row) == Double(row/10));
+    AlwaysAssertExit (nameCol(row) == "name" + String::toString(row));
+    Matrix<Float> exp(cellShape);
+    indgen (exp, Float(10*row));
+    AlwaysAssertExit (allEQ (dataCol(row), exp));
+    AlwaysAssertExit (flagCol.shape(row) == IPosition(1,4));
+    AlwaysAssertExit (allEQ (flagCol(row), row%2 == 0));
+  }
+}
+
+void testAppend()
+{
+  Table tab("tTableAppendRows_tmp.data", Table::Update);
+  AlwaysAssertExit (tab.appendRows (25, makeRows(0, 25)) == 0);
+  AlwaysAssertExit (tab.nrow() == 25);
+  // Adding rows one by one gives the same as adding them at once.
+  for (uInt i=25; i<30; ++i) {
+    AlwaysAssertExit (tab.appendRows (1, makeRows(i, 1)) == i);
+  }
+  AlwaysAssertExit (tab.appendRows (70, makeRows(30, 70)) == 30);
+  AlwaysAssertExit (tab.nrow() == 100);
+  // Nothing is done for zero rows.
+  AlwaysAssertExit (tab.appendRows (0, Record()) == 100);
+  checkRows (tab);
+}
+
+void testPartial()
+{
+  // Columns not given are not written.
+  Table tab("tTableAppendRows_tmp.data", Table::Update);
+  Record rec;
+  rec.define ("ID", Vector<Int>(2, -1));
+  AlwaysAssertExit (tab.appendRows (2, rec, True) == 100);
+  ScalarColumn<Int> idCol(tab, "ID");
+  ArrayColumn<Bool> flagCol(tab, "FLAG");
+  AlwaysAssertExit (idCol(100) == -1  &&  idCol(101) == -1);
+  AlwaysAssertExit (! flagCol.isDefined(100));
+  tab.removeRow (RowNumbers(Vector<rownr_t>(std::vector<rownr_t>{100, 101})));
+}
+
+void testErrors()
+{
+  Table tab("tTableAppendRows_tmp.data", Table::Update);
+  rownr_t nrow = tab.nrow();
+  // Unknown column.
+  Record rec1;
+  rec1.define ("NOCOL", Vector<Int>(2));
+  // Mismatching data type.
+  Record rec2;
+  rec2.define ("ID", Vector<Double>(2));
+  // Mismatching number of rows.
+  Record rec3;
+  rec3.define ("DATA", Cube<Float>(2, 3, 3));
+  // Scalar for a scalar column is not a vector.
+  Record rec4;
+  rec4.define ("ID", Matrix<Int>(1, 2));
+  // Mismatching cell shape.
+  Record rec5;
+  rec5.define ("DATA", Cube<Float>(3, 3, 2));
+  for (const Record& rec : {rec1, rec2, rec3, rec4, rec5}) {
+    Bool ok = False;
+    try {
+      tab.appendRows (2, rec);
+    } catch (const AipsError&) {
+      ok = True;
+    }
+    AlwaysAssertExit (ok);
+  }
+  // No rows have been added.
+  AlwaysAssertExit (tab.nrow() == nrow);
+}
+
+int main()
+{
+  try {
+    createTable();
+    testAppend();
+    testPartial();
+    testErrors();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
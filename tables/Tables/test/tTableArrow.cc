@@ -0,0 +1,279 @@
+//# tTableArrow.cc: Test program for class TableArrow
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableArrow.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <cstring>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for class TableArrow
+// </summary>
+
+const uInt nrow = 50;
+const IPosition cellShape(2, 3, 2);
+
+TableDesc makeDesc()
+{
+  TableDesc td("", "1", TableDesc::Scratch);
+  td.addColumn (ScalarColumnDesc<Bool> ("FLAG_ROW"));
+  td.addColumn (ScalarColumnDesc<Int> ("ANTENNA1"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<Complex> ("GAIN"));
+  td.addColumn (ScalarColumnDesc<String> ("NAME"));
+  td.addColumn (ArrayColumnDesc<Float> ("DATA", cellShape,
+                                        ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<DComplex> ("VIS"));
+  return td;
+}
+
+Table makeTable (const String& name, uInt nr)
+{
+  SetupNewTable newtab(name, makeDesc(), Table::New);
+  StandardStMan ssm;
+  newtab.bindAll (ssm);
+  return Table(newtab, nr);
+}
+
+void fillTable (Table& tab)
+{
+  ScalarColumn<Bool> flagCol(tab, "FLAG_ROW");
+  ScalarColumn<Int> antCol(tab, "ANTENNA1");
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  ScalarColumn<Complex> gainCol(tab, "GAIN");
+  ScalarColumn<String> nameCol(tab, "NAME");
+  ArrayColumn<Float> dataCol(tab, "DATA");
+  ArrayColumn<DComplex> visCol(tab, "VIS");
+  for (uInt i=0; i<nrow; ++i) {
+    flagCol.put (i, i%3 == 0);
+    antCol.put (i, i%7);
+    timeCol.put (i, 1e9 + i);
+    gainCol.put (i, Complex(i, -Float(i)));
+    nameCol.put (i, "ant" + String::toString(i));
+    Matrix<Float> data(cellShape);
+    indgen (data, Float(i));
+    dataCol.put (i, data);
+    Vector<DComplex> vis(4);
+    indgen (vis, DComplex(i, 1));
+    visCol.put (i, vis);
+  }
+}
+
+// Check that rows in tab2 match rows in tab1 from startRow on.
+void checkTable (const Table& tab1, const Table& tab2, uInt startRow)
+{
+  ScalarColumn<Bool> flag1(tab1, "FLAG_ROW");
+  ScalarColumn<Bool> flag2(tab2, "FLAG_ROW");
+  ScalarColumn<Int> ant1(tab1, "ANTENNA1");
+  ScalarColumn<Int> ant2(tab2, "ANTENNA1");
+  ScalarColumn<Double> time1(tab1, "TIME");
+  ScalarColumn<Double> time2(tab2, "TIME");
+  ScalarColumn<Complex> gain1(tab1, "GAIN");
+  ScalarColumn<Complex> gain2(tab2, "GAIN");
+  ScalarColumn<String> name1(tab1, "NAME");
+  ScalarColumn<String> name2(tab2, "NAME");
+  for (uInt i=0; i<tab2.nrow(); ++i) {
+    AlwaysAssertExit (flag1(startRow+i) == flag2(i));
+    AlwaysAssertExit (ant1(startRow+i) == ant2(i));
+    AlwaysAssertExit (time1(startRow+i) == time2(i));
+    AlwaysAssertExit (gain1(startRow+i) == gain2(i));
+    AlwaysAssertExit (name1(startRow+i) == name2(i));
+  }
+  ArrayColumn<Float> data1(tab1, "DATA");
+  ArrayColumn<Float> data2(tab2, "DATA");
+  ArrayColumn<DComplex> vis1(tab1, "VIS");
+  ArrayColumn<DComplex> vis2(tab2, "VIS");
+  for (uInt i=0; i<tab2.nrow(); ++i) {
+    AlwaysAssertExit (allEQ (data1(startRow+i), data2(i)));
+    AlwaysAssertExit (allEQ (vis1(startRow+i), vis2(i)));
+  }
+}
+
+void testExport (const Table& tab)
+{
+  // Check the layout of some exported columns.
+  ArrowSchema schema;
+  ArrowArray array;
+  TableArrow::exportColumn (tab, "TIME", 10, 5, &schema, &array);
+  AlwaysAssertExit (strcmp (schema.format, "g") == 0);
+  AlwaysAssertExit (strcmp (schema.name, "TIME") == 0);
+  AlwaysAssertExit (array.length == 5  &&  array.n_buffers == 2);
+  const Double* times = static_cast<const Double*>(array.buffers[1]);
+  for (uInt i=0; i<5; ++i) {
+    AlwaysAssertExit (times[i] == 1e9 + 10 + i);
+  }
+  schema.release (&schema);
+  array.release (&array);
+  AlwaysAssertExit (schema.release == nullptr  &&  array.release == nullptr);
+  // Bools are packed bits.
+  TableArrow::exportColumn (tab, "FLAG_ROW", 0, nrow, &schema, &array);
+  AlwaysAssertExit (strcmp (schema.format, "b") == 0);
+  const uChar* bits = static_cast<const uChar*>(array.buffers[1]);
+  for (uInt i=0; i<nrow; ++i) {
+    AlwaysAssertExit (((bits[i/8] >> (i%8)) & 1) == (i%3 == 0));
+  }
+  schema.release (&schema);
+  array.release (&array);
+  // An array column is a fixed size list with the tensor shape.
+  TableArrow::exportColumn (tab, "DATA", 1, 3, &schema, &array);
+  AlwaysAssertExit (strcmp (schema.format, "+w:6") == 0);
+  AlwaysAssertExit (schema.n_children == 1  &&  array.n_children == 1);
+  AlwaysAssertExit (strcmp (schema.children[0]->format, "f") == 0);
+  AlwaysAssertExit (array.children[0]->length == 18);
+  const Float* data = static_cast<const Float*>(array.children[0]->buffers[1]);
+  AlwaysAssertExit (data[0] == 1  &&  data[6] == 2  &&  data[17] == 8);
+  AlwaysAssertExit (schema.metadata != nullptr);
+  // Move the child out and release it separately.
+  ArrowArray child = *array.children[0];
+  array.children[0]->release = nullptr;
+  array.release (&array);
+  AlwaysAssertExit (data[17] == 8);
+  child.release (&child);
+  schema.release (&schema);
+  // Strings use 64-bit offsets.
+  TableArrow::exportColumn (tab, "NAME", 9, 2, &schema, &array);
+  AlwaysAssertExit (strcmp (schema.format, "U") == 0);
+  const Int64* offsets = static_cast<const Int64*>(array.buffers[1]);
+  const char* chars = static_cast<const char*>(array.buffers[2]);
+  AlwaysAssertExit (offsets[0] == 0  &&  offsets[1] == 4  &&  offsets[2] == 9);
+  AlwaysAssertExit (strncmp (chars, "ant9ant10", 9) == 0);
+  schema.release (&schema);
+  array.release (&array);
+}
+
+void testRoundTrip (const Table& tab)
+{
+  Vector<String> names = tab.tableDesc().columnNames();
+  ArrowSchema schema;
+  ArrowArray array;
+  TableArrow::exportColumns (tab, names, 0, nrow, &schema, &array);
+  AlwaysAssertExit (strcmp (schema.format, "+s") == 0);
+  AlwaysAssertExit (schema.n_children == Int64(names.size()));
+  // Import into an empty table; rows are added.
+  {
+    Table tab2 = makeTable ("tTableArrow_tmp.data2", 0);
+    TableArrow::importColumns (tab2, 0, &schema, &array);
+    AlwaysAssertExit (tab2.nrow() == nrow);
+    checkTable (tab, tab2, 0);
+  }
+  // Import a part by using an offset in the struct array.
+  {
+    array.offset = 5;
+    array.length = 20;
+    Table tab2 = makeTable ("tTableArrow_tmp.data3", 0);
+    TableArrow::importColumns (tab2, 0, &schema, &array);
+    AlwaysAssertExit (tab2.nrow() == 20);
+    checkTable (tab, tab2, 5);
+    array.offset = 0;
+    array.length = nrow;
+  }
+  // Import a single column into existing rows.
+  {
+    Table tab2 = makeTable ("tTableArrow_tmp.data4", nrow);
+    for (Int64 i=0; i<schema.n_children; ++i) {
+      TableArrow::importColumn (tab2, schema.children[i]->name, 0,
+                                schema.children[i], array.children[i]);
+    }
+    checkTable (tab, tab2, 0);
+  }
+  schema.release (&schema);
+  array.release (&array);
+}
+
+void testErrors (Table& tab)
+{
+  ArrowSchema schema;
+  ArrowArray array;
+  Bool ok = False;
+  try {
+    TableArrow::exportColumn (tab, "NOCOL", 0, 1, &schema, &array);
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+  ok = False;
+  try {
+    TableArrow::exportColumn (tab, "TIME", nrow-1, 2, &schema, &array);
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+  // Import a mismatching type.
+  TableArrow::exportColumn (tab, "TIME", 0, 2, &schema, &array);
+  ok = False;
+  try {
+    TableArrow::importColumn (tab, "ANTENNA1", 0, &schema, &array);
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+  // Import null values.
+  uChar validity = 1;
+  const void* buffers[2] = {&validity, array.buffers[1]};
+  const void** origBuffers = array.buffers;
+  array.buffers = buffers;
+  array.null_count = 1;
+  ok = False;
+  try {
+    TableArrow::importColumn (tab, "TIME", 0, &schema, &array);
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+  array.buffers = origBuffers;
+  schema.release (&schema);
+  array.release (&array);
+}
+
+int main()
+{
+  try {
+    Table tab = makeTable ("tTableArrow_tmp.data", nrow);
+    fillTable (tab);
+    testExport (tab);
+    testRoundTrip (tab);
+    testErrors (tab);
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
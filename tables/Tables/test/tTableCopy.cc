@@ -121,6 +121,153 @@ void testCloneColumns()
   testCloneColumn (tsm3, True);
 }
 
+// Test copyRows for columns copied in bulk and row by row.
+void testCopyRows()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ScalarColumnDesc<String>("cs"));
+  td.addColumn (ScalarColumnDesc<DComplex>("cx"));
+  td.addColumn (ArrayColumnDesc<Float>("caf", IPosition(2,2,3),
+                                       ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Int>("cav"));
+  const rownr_t nrow = 100;
+  SetupNewTable newtab("tTableCopy_tmp.rows", td, Table::New);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<String> cs(tab, "cs");
+  ScalarColumn<DComplex> cx(tab, "cx");
+  ArrayColumn<Float> caf(tab, "caf");
+  ArrayColumn<Int> cav(tab, "cav");
+  for (rownr_t i=0; i<nrow; ++i) {
+    ci.put (i, i);
+    cs.put (i, String::toString(i));
+    cx.put (i, DComplex(i, -Int(i)));
+    caf.put (i, Matrix<Float>(2, 3, i+0.5));
+    if (i%2 == 0) {
+      cav.put (i, Vector<Int>(i%5 + 1, i));
+    }
+  }
+  // Copy rows 10-59 to rows 5-54 of an empty table.
+  SetupNewTable newtab2("tTableCopy_tmp.rows2", td, Table::New);
+  Table tab2(newtab2);
+  TableCopy::copyRows (tab2, tab, 5, 10, 50);
+  AlwaysAssertExit (tab2.nrow() == 55);
+  ScalarColumn<Int> ci2(tab2, "ci");
+  ScalarColumn<String> cs2(tab2, "cs");
+  ScalarColumn<DComplex> cx2(tab2, "cx");
+  ArrayColumn<Float> caf2(tab2, "caf");
+  ArrayColumn<Int> cav2(tab2, "cav");
+  for (rownr_t i=5; i<55; ++i) {
+    rownr_t j = i+5;
+    AlwaysAssertExit (ci2(i) == Int(j));
+    AlwaysAssertExit (cs2(i) == String::toString(j));
+    AlwaysAssertExit (cx2(i) == DComplex(j, -Int(j)));
+    AlwaysAssertExit (allEQ (caf2(i), Float(j+0.5)));
+    AlwaysAssertExit (cav2.isDefined(i) == (j%2 == 0));
+    if (j%2 == 0) {
+      AlwaysAssertExit (allEQ (cav2(i), Int(j)));
+      AlwaysAssertExit (cav2.shape(i) == IPosition(1, j%5 + 1));
+    }
+  }
+}
+
+// Check that the incremental copy is equal to the input.
+void checkIncrementalCopy (const Table& tab, const Table& tab2)
+{
+  AlwaysAssertExit (tab2.nrow() == tab.nrow());
+  ScalarColumn<Int> ci(tab, "ci"), ci2(tab2, "ci");
+  ScalarColumn<String> cs(tab, "cs"), cs2(tab2, "cs");
+  ArrayColumn<Float> caf(tab, "caf"), caf2(tab2, "caf");
+  ArrayColumn<Int> cav(tab, "cav"), cav2(tab2, "cav");
+  for (rownr_t i=0; i<tab.nrow(); ++i) {
+    AlwaysAssertExit (ci2(i) == ci(i));
+    AlwaysAssertExit (cs2(i) == cs(i));
+    AlwaysAssertExit (allEQ (caf2(i), caf(i)));
+    AlwaysAssertExit (cav2.isDefined(i) == cav.isDefined(i));
+    if (cav.isDefined(i)) {
+      AlwaysAssertExit (allEQ (cav2(i), cav(i)));
+    }
+  }
+}
+
+// Test an incremental copy that is interrupted, resumed, and synchronized.
+void testIncrementalCopy()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ScalarColumnDesc<String>("cs"));
+  td.addColumn (ArrayColumnDesc<Float>("caf", IPosition(1,4),
+                                       ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Int>("cav"));
+  SetupNewTable newtab("tTableCopy_tmp.inc", td, Table::New);
+  Table tab(newtab, 100);
+  ScalarColumn<Int> ci(tab, "ci");
+  ScalarColumn<String> cs(tab, "cs");
+  ArrayColumn<Float> caf(tab, "caf");
+  ArrayColumn<Int> cav(tab, "cav");
+  for (rownr_t i=0; i<tab.nrow(); ++i) {
+    ci.put (i, i);
+    cs.put (i, String::toString(i));
+    caf.put (i, Vector<Float>(4, i+0.5));
+    if (i%3 != 0) {
+      cav.put (i, Vector<Int>(i%4 + 1, i));
+    }
+  }
+  TableDesc std;
+  std.addColumn (ScalarColumnDesc<Int>("si"));
+  SetupNewTable newsub("tTableCopy_tmp.inc/SUB", std, Table::New);
+  Table sub(newsub, 3);
+  ScalarColumn<Int>(sub, "si").putColumn (Vector<Int>(3, 7));
+  tab.rwKeywordSet().defineTable ("SUB", sub);
+  tab.flush();
+  // Copy in blocks of 20 rows, thus 4*5 blocks for the main table and one
+  // for the subtable. Stop after 7 blocks, as if interrupted.
+  AlwaysAssertExit (TableCopy::copyIncremental ("tTableCopy_tmp.inc2", tab,
+                                                20, 7) == 7);
+  AlwaysAssertExit (! TableCopy::isCopyComplete
+                    (Table("tTableCopy_tmp.inc2")));
+  // Resume the copy.
+  AlwaysAssertExit (TableCopy::copyIncremental ("tTableCopy_tmp.inc2", tab,
+                                                20) == 14);
+  {
+    Table tab2("tTableCopy_tmp.inc2");
+    AlwaysAssertExit (TableCopy::isCopyComplete (tab2));
+    AlwaysAssertExit (TableCopy::isCopyComplete
+                      (tab2.keywordSet().asTable("SUB")));
+    AlwaysAssertExit (tab2.keywordSet().asTable("SUB").nrow() == 3);
+    checkIncrementalCopy (tab, tab2);
+  }
+  // Nothing is copied if nothing changed.
+  AlwaysAssertExit (TableCopy::copyIncremental ("tTableCopy_tmp.inc2", tab,
+                                                20) == 0);
+  // Only the changed blocks are copied.
+  ci.put (45, -1);
+  cav.put (3, Vector<Int>(2, -3));
+  AlwaysAssertExit (TableCopy::copyIncremental ("tTableCopy_tmp.inc2", tab,
+                                                20) == 2);
+  // Add rows; only the new blocks are copied.
+  tab.addRow (10);
+  for (rownr_t i=100; i<110; ++i) {
+    ci.put (i, i);
+    cs.put (i, String::toString(i));
+    caf.put (i, Vector<Float>(4, i+0.5));
+  }
+  AlwaysAssertExit (TableCopy::copyIncremental ("tTableCopy_tmp.inc2", tab,
+                                                20) == 4);
+  {
+    Table tab2("tTableCopy_tmp.inc2");
+    AlwaysAssertExit (TableCopy::isCopyComplete (tab2));
+    checkIncrementalCopy (tab, tab2);
+  }
+  // Remove rows; the last block of each column is copied again.
+  tab.removeRow (RowNumbers(Vector<rownr_t>(1, 109)));
+  AlwaysAssertExit (TableCopy::copyIncremental ("tTableCopy_tmp.inc2", tab,
+                                                20) == 4);
+  Table tab2("tTableCopy_tmp.inc2");
+  AlwaysAssertExit (TableCopy::isCopyComplete (tab2));
+  checkIncrementalCopy (tab, tab2);
+}
 
 int main (int argc, const char* argv[])
 {
@@ -165,6 +312,8 @@ int main (int argc, const char* argv[])
 
     if (argc <= 1) {
       testCloneColumns();
+      testCopyRows();
+      testIncrementalCopy();
     }
   } catch (const exception& x) {
     cout << x.what() << endl;
@@ -0,0 +1,210 @@
+//# tTableIOQueue.cc: Test program for asynchronous column reads
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/tables/Tables/TableIOQueue.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <atomic>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for TableIOQueue and the async column get functions.
+// </summary>
+
+void makeTable (rownr_t nrrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ci"));
+  td.addColumn (ArrayColumnDesc<Float>("arr", IPosition(2,4,8),
+                                       ColumnDesc::FixedShape));
+  SetupNewTable newtab("tTableIOQueue_tmp.tab", td, Table::New);
+  TiledShapeStMan tsm("TSM", IPosition(3,4,8,16));
+  newtab.bindColumn ("arr", tsm);
+  Table tab(newtab, nrrow);
+  ScalarColumn<Int> ci(tab, "ci");
+  ArrayColumn<Float> arr(tab, "arr");
+  Array<Float> data(IPosition(2,4,8));
+  for (rownr_t i=0; i<nrrow; ++i) {
+    ci.put (i, Int(i));
+    indgen (data, Float(i*100));
+    arr.put (i, data);
+  }
+}
+
+void testQueue()
+{
+  // Requests are executed in order.
+  TableIOQueue queue;
+  std::vector<int> order;
+  std::vector<std::future<int>> results;
+  for (int i=0; i<100; ++i) {
+    results.push_back (queue.submit ([&order, i]() {
+          order.push_back(i); return i; }));
+  }
+  for (int i=0; i<100; ++i) {
+    AlwaysAssertExit (results[i].get() == i);
+  }
+  queue.wait();
+  AlwaysAssertExit (queue.nrPending() == 0);
+  AlwaysAssertExit (order.size() == 100);
+  for (int i=0; i<100; ++i) {
+    AlwaysAssertExit (order[i] == i);
+  }
+  // A request without result.
+  int value = 0;
+  std::future<void> fv = queue.submit ([&value]() { value = 1; });
+  fv.get();
+  AlwaysAssertExit (value == 1);
+  // An exception is passed on by the future.
+  std::future<int> fut = queue.submit ([]() -> int {
+      throw AipsError("test exception"); });
+  Bool caught = False;
+  try {
+    fut.get();
+  } catch (const AipsError&) {
+    caught = True;
+  }
+  AlwaysAssertExit (caught);
+}
+
+void testColumns (rownr_t nrrow)
+{
+  ScalarColumn<Int> ci;
+  ArrayColumn<Float> arr;
+  std::future<Int> fi;
+  std::future<Vector<Int>> fvi, fvi2;
+  std::future<Array<Float>> fa, fslice, frange, frangeSlice, fcells, fcol;
+  {
+    // The futures keep the table alive after it goes out of scope here.
+    Table tab("tTableIOQueue_tmp.tab");
+    ci.attach (tab, "ci");
+    arr.attach (tab, "arr");
+    fi = ci.getAsync (5);
+    fvi = ci.getColumnAsync();
+    fvi2 = ci.getColumnCellsAsync (RefRows(3, 9, 2));
+    fa = arr.getAsync (7);
+    fslice = arr.getSliceAsync (7, Slicer(IPosition(2,1,2), IPosition(2,2,3)));
+    frange = arr.getColumnRangeAsync (Slicer(IPosition(1,10),
+                                             IPosition(1,20)));
+    frangeSlice = arr.getColumnRangeAsync
+      (Slicer(IPosition(1,10), IPosition(1,20)),
+       Slicer(IPosition(2,0,1), IPosition(2,4,1)));
+    fcells = arr.getColumnCellsAsync (RefRows(2, 30, 7));
+    fcol = arr.getColumnAsync();
+  }
+  AlwaysAssertExit (fi.get() == 5);
+  Vector<Int> vi = fvi.get();
+  AlwaysAssertExit (vi.size() == nrrow);
+  for (rownr_t i=0; i<nrrow; ++i) {
+    AlwaysAssertExit (vi[i] == Int(i));
+  }
+  Vector<Int> vi2 = fvi2.get();
+  AlwaysAssertExit (vi2.size() == 4  &&  vi2[0] == 3  &&  vi2[3] == 9);
+  Array<Float> expected(IPosition(2,4,8));
+  indgen (expected, Float(700));
+  AlwaysAssertExit (allEQ (fa.get(), expected));
+  AlwaysAssertExit (allEQ (fslice.get(),
+                           expected(IPosition(2,1,2), IPosition(2,2,4))));
+  Array<Float> range = frange.get();
+  AlwaysAssertExit (range.shape() == IPosition(3,4,8,20));
+  Array<Float> rangeSlice = frangeSlice.get();
+  AlwaysAssertExit (rangeSlice.shape() == IPosition(3,4,1,20));
+  for (Int i=0; i<20; ++i) {
+    indgen (expected, Float((i+10)*100));
+    AlwaysAssertExit (allEQ (range[i], expected));
+    AlwaysAssertExit (allEQ (rangeSlice[i],
+                             expected(IPosition(2,0,1), IPosition(2,3,1))));
+  }
+  Array<Float> cells = fcells.get();
+  AlwaysAssertExit (cells.shape() == IPosition(3,4,8,5));
+  for (Int i=0; i<5; ++i) {
+    indgen (expected, Float((2+i*7)*100));
+    AlwaysAssertExit (allEQ (cells[i], expected));
+  }
+  // The table was closed by the queue thread before the last result
+  // was made available.
+  AlwaysAssertExit (fcol.get().shape() == IPosition(3,4,8,nrrow));
+  AlwaysAssertExit (! Table::isOpened ("tTableIOQueue_tmp.tab"));
+}
+
+void testDoubleBuffer (rownr_t nrrow)
+{
+  // Read the next chunk while processing the current one.
+  Table tab("tTableIOQueue_tmp.tab");
+  ArrayColumn<Float> arr(tab, "arr");
+  const rownr_t chunk = 16;
+  auto request = [&] (rownr_t st) {
+    return arr.getColumnRangeAsync
+      (Slicer(IPosition(1,st), IPosition(1,std::min(chunk, nrrow-st))));
+  };
+  std::future<Array<Float>> next = request(0);
+  Double sum = 0;
+  for (rownr_t st=0; st<nrrow; st+=chunk) {
+    Array<Float> data = next.get();
+    if (st+chunk < nrrow) {
+      next = request (st+chunk);
+    }
+    sum += casacore::sum(data);
+  }
+  Double expSum = 0;
+  for (rownr_t i=0; i<nrrow; ++i) {
+    expSum += 32*Double(i*100) + 31*32/2;
+  }
+  AlwaysAssertExit (sum == expSum);
+}
+
+int main()
+{
+  try {
+    const rownr_t nrrow = 100;
+    makeTable (nrrow);
+    testQueue();
+    testColumns (nrrow);
+    testDoubleBuffer (nrrow);
+    Table tab("tTableIOQueue_tmp.tab");
+    tab.markForDelete();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -55,6 +55,7 @@ void doiter1();
 void doiter2();
 void doiter3();
 void test_cache_boundaries();
+void test_projection();
 
 int main (int argc, const char* argv[])
 {
@@ -70,6 +71,7 @@ int main (int argc, const char* argv[])
     doiter2();               // do two column iteration
     doiter3();               // do interval iteration
     test_cache_boundaries(); // test option to cache group boundaries
+    test_projection();       // test projection of the iteration tables
     return 0;                // successfully executed
 }
 
@@ -332,3 +334,45 @@ void test_cache_boundaries()
         iter2.next();
     }
 }
+
+void test_projection()
+{
+    // Iterate with and without projection (and cached boundaries) and
+    // check that the projected tables have the same rows.
+    Table tab ("tTableIter_tmp.data");
+    Block<String> sortCols(1, "col1");
+    Block<std::shared_ptr<BaseCompare>> compObj(1);
+    Block<Int> orders(1, TableIterator::Ascending);
+    for (int cache=0; cache<2; ++cache) {
+        TableIterator iter1(tab, sortCols, compObj, orders,
+                            TableIterator::ParSort, cache);
+        TableIterator iter2(tab, sortCols, compObj, orders,
+                            TableIterator::ParSort, cache);
+        iter2.next();
+        // Setting the projection restarts the iteration.
+        Block<String> cols(2);
+        cols[0] = "col3";
+        cols[1] = "col1";
+        iter2.setProjection (cols);
+        uInt nr = 0;
+        while (!iter1.pastEnd()) {
+            AlwaysAssertExit (!iter2.pastEnd());
+            Table t1 = iter1.table();
+            Table t2 = iter2.table();
+            AlwaysAssertExit (t1.tableDesc().ncolumn() == 4);
+            AlwaysAssertExit (t2.tableDesc().ncolumn() == 2);
+            AlwaysAssertExit (t2.tableDesc().isColumn ("col1"));
+            AlwaysAssertExit (t2.tableDesc().isColumn ("col3"));
+            AlwaysAssertExit (allEQ (t1.rowNumbers(tab), t2.rowNumbers(tab)));
+            AlwaysAssertExit (allEQ (ScalarColumn<float>(t1, "col3").getColumn(),
+                                     ScalarColumn<float>(t2, "col3").getColumn()));
+            AlwaysAssertExit (iter1.keyChangeAtLastNext() ==
+                              iter2.keyChangeAtLastNext());
+            iter1.next();
+            iter2.next();
+            nr++;
+        }
+        AlwaysAssertExit (iter2.pastEnd());
+        AlwaysAssertExit (nr == 10);
+    }
+}
@@ -0,0 +1,160 @@
+//# tTableLazyOpen.cc: Test program for deferred opening of data managers
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ColumnSet.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+using namespace casacore;
+
+// This program tests that the data managers of a table opened readonly
+// are only opened when one of their columns is accessed.
+// It does so by removing the file of a data manager; the table can still
+// be used as long as that data manager is not needed.
+
+const uInt nrow = 100;
+
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Double>("TIME"));
+  td.addColumn (ScalarColumnDesc<Int>("ANTENNA"));
+  td.addColumn (ArrayColumnDesc<Float>("DATA", IPosition(1,8),
+                                       ColumnDesc::FixedShape));
+  SetupNewTable newtab("tTableLazyOpen_tmp.data", td, Table::New);
+  IncrementalStMan ism("ISM");
+  newtab.bindColumn ("TIME", ism);
+  StandardStMan ssm("SSM");
+  newtab.bindColumn ("ANTENNA", ssm);
+  TiledColumnStMan tsm("TSM", IPosition(2,8,16));
+  newtab.bindColumn ("DATA", tsm);
+  Table tab(newtab, nrow);
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  ScalarColumn<Int> antCol(tab, "ANTENNA");
+  ArrayColumn<Float> dataCol(tab, "DATA");
+  for (uInt i=0; i<nrow; ++i) {
+    timeCol.put (i, i/10);
+    antCol.put (i, i%10);
+    dataCol.put (i, Vector<Float>(8, i));
+  }
+}
+
+void checkTime (const Table& tab)
+{
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  for (uInt i=0; i<nrow; ++i) {
+    AlwaysAssertExit (timeCol(i) == i/10);
+  }
+}
+
+void testLazy()
+{
+  // Remove the files of the SSM and TSM.
+  // Files are numbered in order of the data managers (ISM, SSM, TSM).
+  RegularFile("tTableLazyOpen_tmp.data/table.f1").remove();
+  RegularFile("tTableLazyOpen_tmp.data/table.f2").remove();
+  Table tab("tTableLazyOpen_tmp.data");
+  AlwaysAssertExit (tab.nrow() == nrow);
+  checkTime (tab);
+  // A selection and keywords do not need the other data managers.
+  Table sel = tab(tab.col("TIME") < 5);
+  AlwaysAssertExit (sel.nrow() == 50);
+  AlwaysAssertExit (tab.keywordSet().nfields() == 0);
+  // Accessing a column of a data manager without file fails.
+  Bool ok = False;
+  try {
+    ScalarColumn<Int> antCol(tab, "ANTENNA");
+    antCol(0);
+  } catch (const std::exception&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+}
+
+void testEager()
+{
+  // Without lazy opening the table cannot be opened at all.
+  ColumnSet::setLazyOpen (False);
+  Bool ok = False;
+  try {
+    Table tab("tTableLazyOpen_tmp.data");
+  } catch (const std::exception&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+  ColumnSet::setLazyOpen (True);
+}
+
+void testAll()
+{
+  // All columns can be read when all files exist.
+  // Reopening for write and data manager info open all data managers.
+  makeTable();
+  Table tab("tTableLazyOpen_tmp.data");
+  Record dminfo = tab.dataManagerInfo();
+  AlwaysAssertExit (dminfo.nfields() == 3);
+  checkTime (tab);
+  tab.reopenRW();
+  ScalarColumn<Int> antCol(tab, "ANTENNA");
+  ArrayColumn<Float> dataCol(tab, "DATA");
+  for (uInt i=0; i<nrow; ++i) {
+    AlwaysAssertExit (antCol(i) == Int(i%10));
+    AlwaysAssertExit (allEQ (dataCol(i), Float(i)));
+  }
+  tab.addRow();
+  antCol.put (nrow, 1);
+  AlwaysAssertExit (tab.nrow() == nrow+1);
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testLazy();
+    testEager();
+    testAll();
+  } catch (std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;                           // exit with success status
+}
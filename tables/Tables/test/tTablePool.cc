@@ -0,0 +1,164 @@
+//# tTablePool.cc: Test program for class TablePool
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License
+//# along with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TablePool.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/OS/Path.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <thread>
+#include <vector>
+
+using namespace casacore;
+
+// This program tests the TablePool class.
+
+String tabName (uInt i)
+{
+  return "tTablePool_tmp.tab" + String::toString(i);
+}
+
+void makeTables (uInt ntab)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("COL"));
+  for (uInt i=0; i<ntab; ++i) {
+    SetupNewTable newtab(tabName(i), td, Table::New);
+    Table tab(newtab, 10);
+    ScalarColumn<Int> col(tab, "COL");
+    for (uInt j=0; j<10; ++j) {
+      col.put (j, i*10+j);
+    }
+  }
+}
+
+void testLRU()
+{
+  TablePool pool(2);
+  AlwaysAssertExit (pool.maxSize() == 2);
+  Table t0 = pool.open (tabName(0));
+  AlwaysAssertExit (t0.nrow() == 10);
+  AlwaysAssertExit (pool.size() == 1);
+  AlwaysAssertExit (pool.nMisses() == 1  &&  pool.nHits() == 0);
+  // Opening again gives the same table object.
+  Table t0b = pool.open (tabName(0));
+  AlwaysAssertExit (t0b.isSameRoot (t0));
+  AlwaysAssertExit (pool.nMisses() == 1  &&  pool.nHits() == 1);
+  t0 = Table();
+  t0b = Table();
+  // The table is kept open by the pool.
+  AlwaysAssertExit (Table::isOpened (tabName(0)));
+  pool.open (tabName(1));
+  // Use table 0, so table 1 becomes least recently used.
+  pool.open (tabName(0));
+  pool.open (tabName(2));
+  Vector<String> names = pool.tableNames();
+  AlwaysAssertExit (names.size() == 2);
+  AlwaysAssertExit (names[0] == Path(tabName(2)).absoluteName());
+  AlwaysAssertExit (names[1] == Path(tabName(0)).absoluteName());
+  AlwaysAssertExit (! Table::isOpened (tabName(1)));
+  // A table still in use is not closed when evicted.
+  Table t2 = pool.open (tabName(2));
+  pool.setMaxSize (0);
+  AlwaysAssertExit (pool.size() == 0);
+  AlwaysAssertExit (Table::isOpened (tabName(2)));
+  AlwaysAssertExit (! Table::isOpened (tabName(0)));
+  t2 = Table();
+  AlwaysAssertExit (! Table::isOpened (tabName(2)));
+  // Release and clear.
+  pool.setMaxSize (10);
+  pool.open (tabName(0));
+  pool.open (tabName(1));
+  pool.release (tabName(0));
+  AlwaysAssertExit (pool.size() == 1);
+  AlwaysAssertExit (! Table::isOpened (tabName(0)));
+  pool.clear();
+  AlwaysAssertExit (pool.size() == 0);
+  AlwaysAssertExit (! Table::isOpened (tabName(1)));
+}
+
+void testUpdate()
+{
+  TablePool pool(4);
+  Table t0 = pool.open (tabName(0));
+  AlwaysAssertExit (! t0.isWritable());
+  Table t0w = pool.open (tabName(0), TableLock(), Table::Update);
+  AlwaysAssertExit (t0w.isWritable());
+  ScalarColumn<Int> col(t0w, "COL");
+  col.put (0, -1);
+  // A deleted table is not handed out anymore.
+  Table t1 = pool.open (tabName(1), TableLock(), Table::Update);
+  t1.markForDelete();
+  t1 = Table();
+  Bool ok = False;
+  try {
+    pool.open (tabName(1));
+  } catch (const AipsError&) {
+    ok = True;
+  }
+  AlwaysAssertExit (ok);
+  AlwaysAssertExit (pool.size() == 1);
+}
+
+void testThreads()
+{
+  // Each thread uses its own table, while the pool is shared.
+  TablePool pool(3);
+  std::vector<std::thread> threads;
+  for (uInt i=0; i<4; ++i) {
+    threads.emplace_back ([&pool, i]() {
+        for (uInt j=0; j<50; ++j) {
+          Table tab = pool.open (tabName(2+i));
+          AlwaysAssertExit (tab.nrow() == 10);
+        }
+      });
+  }
+  for (auto& thr : threads) {
+    thr.join();
+  }
+  AlwaysAssertExit (pool.size() == 3);
+  AlwaysAssertExit (pool.nHits() + pool.nMisses() == 200);
+}
+
+int main()
+{
+  try {
+    makeTables (6);
+    testLRU();
+    testUpdate();
+    testThreads();
+  } catch (std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;                           // exit with success status
+}